@@ -32,7 +32,7 @@ static void SpMMBenchmark(benchmark::State& state,
     state.SkipWithError("cpuinfo initialization failed");
     return;
   }
-  if (!benchmark::utils::CheckNEONFP16ARITH(state)) {
+  if (isa_check && !isa_check(state)) {
     return;
   }
 
@@ -214,6 +214,40 @@ static void SpMMBenchmark(benchmark::State& state,
   BENCHMARK_SPMM(spmm80_32x1__neonfp16arith_x2)
 #endif  // XNN_ARCH_ARM64
 
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  static void spmm80_8x1__fma3(benchmark::State& state, const char* net) {
+    SpMMBenchmark(state, xnn_f16_spmm_minmax_ukernel_8x1__fma3, 8, 1, 0.8f,
+      xnn_init_f16_scaleminmax_avx_params, benchmark::utils::CheckFMA3);
+  }
+  static void spmm80_8x1__fma3_x2(benchmark::State& state, const char* net) {
+    SpMMBenchmark(state, xnn_f16_spmm_minmax_ukernel_8x1__fma3_x2, 8, 1, 0.8f,
+      xnn_init_f16_scaleminmax_avx_params, benchmark::utils::CheckFMA3);
+  }
+  static void spmm80_16x1__fma3(benchmark::State& state, const char* net) {
+    SpMMBenchmark(state, xnn_f16_spmm_minmax_ukernel_16x1__fma3, 16, 1, 0.8f,
+      xnn_init_f16_scaleminmax_avx_params, benchmark::utils::CheckFMA3);
+  }
+  static void spmm80_16x1__fma3_x2(benchmark::State& state, const char* net) {
+    SpMMBenchmark(state, xnn_f16_spmm_minmax_ukernel_16x1__fma3_x2, 16, 1, 0.8f,
+      xnn_init_f16_scaleminmax_avx_params, benchmark::utils::CheckFMA3);
+  }
+  static void spmm80_32x1__fma3(benchmark::State& state, const char* net) {
+    SpMMBenchmark(state, xnn_f16_spmm_minmax_ukernel_32x1__fma3, 32, 1, 0.8f,
+      xnn_init_f16_scaleminmax_avx_params, benchmark::utils::CheckFMA3);
+  }
+  static void spmm80_32x1__fma3_x2(benchmark::State& state, const char* net) {
+    SpMMBenchmark(state, xnn_f16_spmm_minmax_ukernel_32x1__fma3_x2, 32, 1, 0.8f,
+      xnn_init_f16_scaleminmax_avx_params, benchmark::utils::CheckFMA3);
+  }
+
+  BENCHMARK_SPMM(spmm80_8x1__fma3)
+  BENCHMARK_SPMM(spmm80_8x1__fma3_x2)
+  BENCHMARK_SPMM(spmm80_16x1__fma3)
+  BENCHMARK_SPMM(spmm80_16x1__fma3_x2)
+  BENCHMARK_SPMM(spmm80_32x1__fma3)
+  BENCHMARK_SPMM(spmm80_32x1__fma3_x2)
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
 #ifndef XNNPACK_BENCHMARK_NO_MAIN
 BENCHMARK_MAIN();
 #endif
@@ -16,6 +16,9 @@
 #include <xnnpack/AlignedAllocator.h>
 #include <xnnpack/common.h>
 #include <xnnpack/conv.h>
+#include <xnnpack/igemm.h>
+#include <xnnpack/indirection.h>
+#include <xnnpack/operator.h>
 #include <xnnpack/pack.h>
 #include <xnnpack/params-init.h>
 #include <xnnpack/params.h>
@@ -24,6 +27,7 @@
 static void DConv3X3S2P1Benchmark(benchmark::State& state,
   xnn_f32_conv_hwc_ukernel_function conv,
   uint32_t output_channels_tile,
+  xnn_init_f32_minmax_params_fn init_params,
   benchmark::utils::IsaCheckFunction isa_check = nullptr)
 {
   if (isa_check && !isa_check(state)) {
@@ -78,8 +82,8 @@ static void DConv3X3S2P1Benchmark(benchmark::State& state,
   std::fill(output.begin(), output.end(), std::nanf(""));
 
   xnn_f32_minmax_params params;
-  xnn_init_f32_minmax_params(
-    &params, -std::numeric_limits<float>::infinity(), +std::numeric_limits<float>::infinity());
+  init_params(&params,
+    -std::numeric_limits<float>::infinity(), +std::numeric_limits<float>::infinity());
 
   size_t buffer_index = 0;
   for (auto _ : state) {
@@ -113,18 +117,150 @@ static void DConv3X3S2P1Benchmark(benchmark::State& state,
     benchmark::Counter::kIsRate);
 }
 
+// Baseline: the same 3x3 stride-2 convolution with 3 input channels computed through the indirect GEMM path,
+// which Convolution NHWC uses when no direct HWC micro-kernel is available.
+static void DConv3X3S2P1IGEMMBenchmark(benchmark::State& state,
+  xnn_f32_igemm_minmax_ukernel_function igemm,
+  uint32_t mr, uint32_t nr,
+  xnn_init_f32_minmax_params_fn init_params,
+  benchmark::utils::IsaCheckFunction isa_check = nullptr)
+{
+  if (isa_check && !isa_check(state)) {
+    return;
+  }
+
+  const size_t input_height = state.range(0);
+  const size_t input_width = state.range(1);
+  const size_t output_channels = state.range(2);
+
+  std::random_device random_device;
+  auto rng = std::mt19937(random_device());
+  auto f32rng = std::bind(std::uniform_real_distribution<float>(0.0f, 1.0f), std::ref(rng));
+
+  const size_t input_channels = 3;
+  const size_t kernel_size = 3;
+  const size_t padding = 1;
+  const size_t subsampling = 2;
+
+  const size_t output_height = (input_height + 2 * padding - kernel_size) / subsampling + 1;
+  const size_t output_width = (input_width + 2 * padding - kernel_size) / subsampling + 1;
+  const size_t output_size = output_height * output_width;
+
+  std::vector<float> input(input_height * input_width * input_channels + XNN_EXTRA_BYTES / sizeof(float));
+  std::generate(input.begin(), input.end(), std::ref(f32rng));
+  std::vector<float> kernel(output_channels * kernel_size * kernel_size * input_channels);
+  std::generate(kernel.begin(), kernel.end(), std::ref(f32rng));
+  std::vector<float> bias(output_channels);
+  std::generate(bias.begin(), bias.end(), std::ref(f32rng));
+
+  std::vector<float> zero(input_channels + XNN_EXTRA_BYTES / sizeof(float));
+
+  const size_t weights_elements = (kernel_size * kernel_size * input_channels + 1) *
+    benchmark::utils::RoundUp<size_t>(output_channels, nr);
+  const size_t indirection_elements = benchmark::utils::RoundUp<size_t>(output_size, mr) * kernel_size * kernel_size;
+  const size_t output_elements = output_size * output_channels;
+  const size_t num_buffers = 1 +
+    benchmark::utils::DivideRoundUp<size_t>(benchmark::utils::GetMaxCacheSize(),
+      sizeof(float) * (weights_elements + output_elements) + sizeof(void*) * indirection_elements);
+
+  std::vector<float, AlignedAllocator<float, 64>> packed_weights(weights_elements * num_buffers);
+  std::fill(packed_weights.begin(), packed_weights.end(), 0.0f);
+  xnn_pack_f32_conv_goki_w(
+    1 /* groups */, output_channels, kernel_size * kernel_size, input_channels,
+    nr, 1 /* kr */, 1 /* sr */,
+    kernel.data(), bias.data(), packed_weights.data(), 0 /* extra bytes */, nullptr);
+  for (size_t n = 1; n < num_buffers; n++) {
+    std::copy(packed_weights.cbegin(),
+      packed_weights.cbegin() + weights_elements,
+      packed_weights.begin() + n * weights_elements);
+  }
+
+  std::vector<const float*> indirection_buffer(indirection_elements * num_buffers);
+  xnn_operator convolution_op = { };
+  convolution_op.indirection_buffer   = reinterpret_cast<const void**>(indirection_buffer.data());
+  convolution_op.input                = input.data();
+  convolution_op.input_pixel_stride   = input_channels;
+  convolution_op.zero_buffer          = zero.data();
+  convolution_op.groups               = 1;
+  convolution_op.group_input_channels = input_channels;
+  convolution_op.batch_size           = 1;
+  convolution_op.input_height         = input_height;
+  convolution_op.input_width          = input_width;
+  convolution_op.output_height        = output_height;
+  convolution_op.output_width         = output_width;
+  convolution_op.kernel_height        = kernel_size;
+  convolution_op.kernel_width         = kernel_size;
+  convolution_op.stride_height        = subsampling;
+  convolution_op.stride_width         = subsampling;
+  convolution_op.dilation_height      = 1;
+  convolution_op.dilation_width       = 1;
+  convolution_op.padding_top          = padding;
+  convolution_op.padding_left         = padding;
+  xnn_indirection_init_conv2d(&convolution_op, mr, 2 /* log2(sizeof(float)) */);
+  for (size_t n = 1; n < num_buffers; n++) {
+    std::copy(indirection_buffer.cbegin(),
+      indirection_buffer.cbegin() + indirection_elements,
+      indirection_buffer.begin() + n * indirection_elements);
+  }
+
+  std::vector<float> output(output_elements * num_buffers);
+  std::fill(output.begin(), output.end(), std::nanf(""));
+
+  xnn_f32_minmax_params params;
+  init_params(&params,
+    -std::numeric_limits<float>::infinity(), +std::numeric_limits<float>::infinity());
+
+  size_t buffer_index = 0;
+  for (auto _ : state) {
+    state.PauseTiming();
+    benchmark::utils::PrefetchToL1(input.data(), input.size() * sizeof(float));
+    buffer_index = (buffer_index + 1) % num_buffers;
+    state.ResumeTiming();
+
+    for (uint32_t m = 0; m < output_size; m += mr) {
+      const uint32_t mb = min(output_size - m, mr);
+      for (uint32_t n = 0; n < output_channels; n += nr) {
+        const uint32_t nb = min(output_channels - n, nr);
+        igemm(
+          mb, nb, input_channels * sizeof(float), kernel_size * kernel_size * mr * sizeof(void*),
+          indirection_buffer.data() + buffer_index * indirection_elements + m * kernel_size * kernel_size,
+          packed_weights.data() + buffer_index * weights_elements + n * (kernel_size * kernel_size * input_channels + 1),
+          output.data() + buffer_index * output_elements + m * output_channels + n,
+          output_channels * sizeof(float), nr * sizeof(float),
+          0, zero.data(), &params);
+      }
+    }
+  }
+
+  const uint64_t cpu_frequency = benchmark::utils::GetCurrentCpuFrequency();
+  if (cpu_frequency != 0) {
+    state.counters["cpufreq"] = cpu_frequency;
+  }
+
+  state.counters["FLOPS"] = benchmark::Counter(
+    uint64_t(state.iterations()) * 2 *
+      output_height * output_width *
+      input_channels * output_channels *
+      kernel_size * kernel_size,
+    benchmark::Counter::kIsRate);
+}
+
 #if XNN_ARCH_ARM64
   static void f32_conv_hwc_3x3s2p1c3x8__neonfma_2x1(benchmark::State& state, const char* net) {
-    DConv3X3S2P1Benchmark(state, xnn_f32_conv_hwc_ukernel_3x3s2p1c3x8__neonfma_2x1, 8, benchmark::utils::CheckNEONFMA);
+    DConv3X3S2P1Benchmark(state, xnn_f32_conv_hwc_ukernel_3x3s2p1c3x8__neonfma_2x1, 8,
+      xnn_init_f32_minmax_params, benchmark::utils::CheckNEONFMA);
   }
   static void f32_conv_hwc_3x3s2p1c3x4__neonfma_2x1(benchmark::State& state, const char* net) {
-    DConv3X3S2P1Benchmark(state, xnn_f32_conv_hwc_ukernel_3x3s2p1c3x4__neonfma_2x1, 4, benchmark::utils::CheckNEONFMA);
+    DConv3X3S2P1Benchmark(state, xnn_f32_conv_hwc_ukernel_3x3s2p1c3x4__neonfma_2x1, 4,
+      xnn_init_f32_minmax_params, benchmark::utils::CheckNEONFMA);
   }
   static void f32_conv_hwc_3x3s2p1c3x8__neonfma_2x2(benchmark::State& state, const char* net) {
-    DConv3X3S2P1Benchmark(state, xnn_f32_conv_hwc_ukernel_3x3s2p1c3x8__neonfma_2x2, 8, benchmark::utils::CheckNEONFMA);
+    DConv3X3S2P1Benchmark(state, xnn_f32_conv_hwc_ukernel_3x3s2p1c3x8__neonfma_2x2, 8,
+      xnn_init_f32_minmax_params, benchmark::utils::CheckNEONFMA);
   }
   static void f32_conv_hwc_3x3s2p1c3x4__neonfma_2x2(benchmark::State& state, const char* net) {
-    DConv3X3S2P1Benchmark(state, xnn_f32_conv_hwc_ukernel_3x3s2p1c3x4__neonfma_2x2, 4, benchmark::utils::CheckNEONFMA);
+    DConv3X3S2P1Benchmark(state, xnn_f32_conv_hwc_ukernel_3x3s2p1c3x4__neonfma_2x2, 4,
+      xnn_init_f32_minmax_params, benchmark::utils::CheckNEONFMA);
   }
 
   BENCHMARK_DCONV(f32_conv_hwc_3x3s2p1c3x8__neonfma_2x1);
@@ -135,16 +271,20 @@ static void DConv3X3S2P1Benchmark(benchmark::State& state,
 
 #if XNN_ARCH_ARM || XNN_ARCH_ARM64
   static void f32_conv_hwc_3x3s2p1c3x8__neon_2x1(benchmark::State& state, const char* net) {
-    DConv3X3S2P1Benchmark(state, xnn_f32_conv_hwc_ukernel_3x3s2p1c3x8__neon_2x1, 8, benchmark::utils::CheckNEON);
+    DConv3X3S2P1Benchmark(state, xnn_f32_conv_hwc_ukernel_3x3s2p1c3x8__neon_2x1, 8,
+      xnn_init_f32_minmax_params, benchmark::utils::CheckNEON);
   }
   static void f32_conv_hwc_3x3s2p1c3x4__neon_2x1(benchmark::State& state, const char* net) {
-    DConv3X3S2P1Benchmark(state, xnn_f32_conv_hwc_ukernel_3x3s2p1c3x4__neon_2x1, 4, benchmark::utils::CheckNEON);
+    DConv3X3S2P1Benchmark(state, xnn_f32_conv_hwc_ukernel_3x3s2p1c3x4__neon_2x1, 4,
+      xnn_init_f32_minmax_params, benchmark::utils::CheckNEON);
   }
   static void f32_conv_hwc_3x3s2p1c3x8__neon_2x2(benchmark::State& state, const char* net) {
-    DConv3X3S2P1Benchmark(state, xnn_f32_conv_hwc_ukernel_3x3s2p1c3x8__neon_2x2, 8, benchmark::utils::CheckNEON);
+    DConv3X3S2P1Benchmark(state, xnn_f32_conv_hwc_ukernel_3x3s2p1c3x8__neon_2x2, 8,
+      xnn_init_f32_minmax_params, benchmark::utils::CheckNEON);
   }
   static void f32_conv_hwc_3x3s2p1c3x4__neon_2x2(benchmark::State& state, const char* net) {
-    DConv3X3S2P1Benchmark(state, xnn_f32_conv_hwc_ukernel_3x3s2p1c3x4__neon_2x2, 4, benchmark::utils::CheckNEON);
+    DConv3X3S2P1Benchmark(state, xnn_f32_conv_hwc_ukernel_3x3s2p1c3x4__neon_2x2, 4,
+      xnn_init_f32_minmax_params, benchmark::utils::CheckNEON);
   }
 
   BENCHMARK_DCONV(f32_conv_hwc_3x3s2p1c3x8__neon_2x1);
@@ -153,6 +293,112 @@ static void DConv3X3S2P1Benchmark(benchmark::State& state,
   BENCHMARK_DCONV(f32_conv_hwc_3x3s2p1c3x4__neon_2x2);
 #endif  // XNN_ARCH_ARM || XNN_ARCH_ARM64
 
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  static void f32_conv_hwc_3x3s2p1c3x32__avx512f_2x2(benchmark::State& state, const char* net) {
+    DConv3X3S2P1Benchmark(state, xnn_f32_conv_hwc_ukernel_3x3s2p1c3x32__avx512f_2x2, 32,
+      xnn_init_f32_minmax_scalar_params, benchmark::utils::CheckAVX512F);
+  }
+  static void f32_conv_hwc_3x3s2p1c3x32__avx512f_2x1(benchmark::State& state, const char* net) {
+    DConv3X3S2P1Benchmark(state, xnn_f32_conv_hwc_ukernel_3x3s2p1c3x32__avx512f_2x1, 32,
+      xnn_init_f32_minmax_scalar_params, benchmark::utils::CheckAVX512F);
+  }
+  static void f32_conv_hwc_3x3s2p1c3x16__avx512f_2x2(benchmark::State& state, const char* net) {
+    DConv3X3S2P1Benchmark(state, xnn_f32_conv_hwc_ukernel_3x3s2p1c3x16__avx512f_2x2, 16,
+      xnn_init_f32_minmax_scalar_params, benchmark::utils::CheckAVX512F);
+  }
+  static void f32_conv_hwc_3x3s2p1c3x16__avx512f_2x1(benchmark::State& state, const char* net) {
+    DConv3X3S2P1Benchmark(state, xnn_f32_conv_hwc_ukernel_3x3s2p1c3x16__avx512f_2x1, 16,
+      xnn_init_f32_minmax_scalar_params, benchmark::utils::CheckAVX512F);
+  }
+  static void f32_conv_hwc_3x3s2p1c3x16__fma3_2x2(benchmark::State& state, const char* net) {
+    DConv3X3S2P1Benchmark(state, xnn_f32_conv_hwc_ukernel_3x3s2p1c3x16__fma3_2x2, 16,
+      xnn_init_f32_minmax_avx_params, benchmark::utils::CheckFMA3);
+  }
+  static void f32_conv_hwc_3x3s2p1c3x16__fma3_2x1(benchmark::State& state, const char* net) {
+    DConv3X3S2P1Benchmark(state, xnn_f32_conv_hwc_ukernel_3x3s2p1c3x16__fma3_2x1, 16,
+      xnn_init_f32_minmax_avx_params, benchmark::utils::CheckFMA3);
+  }
+  static void f32_conv_hwc_3x3s2p1c3x8__fma3_2x2(benchmark::State& state, const char* net) {
+    DConv3X3S2P1Benchmark(state, xnn_f32_conv_hwc_ukernel_3x3s2p1c3x8__fma3_2x2, 8,
+      xnn_init_f32_minmax_avx_params, benchmark::utils::CheckFMA3);
+  }
+  static void f32_conv_hwc_3x3s2p1c3x8__fma3_2x1(benchmark::State& state, const char* net) {
+    DConv3X3S2P1Benchmark(state, xnn_f32_conv_hwc_ukernel_3x3s2p1c3x8__fma3_2x1, 8,
+      xnn_init_f32_minmax_avx_params, benchmark::utils::CheckFMA3);
+  }
+  static void f32_conv_hwc_3x3s2p1c3x16__avx_2x1(benchmark::State& state, const char* net) {
+    DConv3X3S2P1Benchmark(state, xnn_f32_conv_hwc_ukernel_3x3s2p1c3x16__avx_2x1, 16,
+      xnn_init_f32_minmax_avx_params, benchmark::utils::CheckAVX);
+  }
+  static void f32_conv_hwc_3x3s2p1c3x16__avx_1x1(benchmark::State& state, const char* net) {
+    DConv3X3S2P1Benchmark(state, xnn_f32_conv_hwc_ukernel_3x3s2p1c3x16__avx_1x1, 16,
+      xnn_init_f32_minmax_avx_params, benchmark::utils::CheckAVX);
+  }
+  static void f32_conv_hwc_3x3s2p1c3x8__avx_2x1(benchmark::State& state, const char* net) {
+    DConv3X3S2P1Benchmark(state, xnn_f32_conv_hwc_ukernel_3x3s2p1c3x8__avx_2x1, 8,
+      xnn_init_f32_minmax_avx_params, benchmark::utils::CheckAVX);
+  }
+  static void f32_conv_hwc_3x3s2p1c3x8__avx_1x1(benchmark::State& state, const char* net) {
+    DConv3X3S2P1Benchmark(state, xnn_f32_conv_hwc_ukernel_3x3s2p1c3x8__avx_1x1, 8,
+      xnn_init_f32_minmax_avx_params, benchmark::utils::CheckAVX);
+  }
+  static void f32_conv_hwc_3x3s2p1c3x8__sse_2x1(benchmark::State& state, const char* net) {
+    DConv3X3S2P1Benchmark(state, xnn_f32_conv_hwc_ukernel_3x3s2p1c3x8__sse_2x1, 8,
+      xnn_init_f32_minmax_sse_params);
+  }
+  static void f32_conv_hwc_3x3s2p1c3x8__sse_1x1(benchmark::State& state, const char* net) {
+    DConv3X3S2P1Benchmark(state, xnn_f32_conv_hwc_ukernel_3x3s2p1c3x8__sse_1x1, 8,
+      xnn_init_f32_minmax_sse_params);
+  }
+  static void f32_conv_hwc_3x3s2p1c3x4__sse_2x1(benchmark::State& state, const char* net) {
+    DConv3X3S2P1Benchmark(state, xnn_f32_conv_hwc_ukernel_3x3s2p1c3x4__sse_2x1, 4,
+      xnn_init_f32_minmax_sse_params);
+  }
+  static void f32_conv_hwc_3x3s2p1c3x4__sse_1x1(benchmark::State& state, const char* net) {
+    DConv3X3S2P1Benchmark(state, xnn_f32_conv_hwc_ukernel_3x3s2p1c3x4__sse_1x1, 4,
+      xnn_init_f32_minmax_sse_params);
+  }
+
+  static void f32_igemm_7x16__avx512f_broadcast(benchmark::State& state, const char* net) {
+    DConv3X3S2P1IGEMMBenchmark(state, xnn_f32_igemm_minmax_ukernel_7x16__avx512f_broadcast, 7, 16,
+      xnn_init_f32_minmax_scalar_params, benchmark::utils::CheckAVX512F);
+  }
+  static void f32_igemm_5x16__fma3_broadcast(benchmark::State& state, const char* net) {
+    DConv3X3S2P1IGEMMBenchmark(state, xnn_f32_igemm_minmax_ukernel_5x16__fma3_broadcast, 5, 16,
+      xnn_init_f32_minmax_avx_params, benchmark::utils::CheckFMA3);
+  }
+  static void f32_igemm_5x16__avx_broadcast(benchmark::State& state, const char* net) {
+    DConv3X3S2P1IGEMMBenchmark(state, xnn_f32_igemm_minmax_ukernel_5x16__avx_broadcast, 5, 16,
+      xnn_init_f32_minmax_avx_params, benchmark::utils::CheckAVX);
+  }
+  static void f32_igemm_4x8__sse_load1(benchmark::State& state, const char* net) {
+    DConv3X3S2P1IGEMMBenchmark(state, xnn_f32_igemm_minmax_ukernel_4x8__sse_load1, 4, 8,
+      xnn_init_f32_minmax_sse_params);
+  }
+
+  BENCHMARK_DCONV(f32_conv_hwc_3x3s2p1c3x32__avx512f_2x2);
+  BENCHMARK_DCONV(f32_conv_hwc_3x3s2p1c3x32__avx512f_2x1);
+  BENCHMARK_DCONV(f32_conv_hwc_3x3s2p1c3x16__avx512f_2x2);
+  BENCHMARK_DCONV(f32_conv_hwc_3x3s2p1c3x16__avx512f_2x1);
+  BENCHMARK_DCONV(f32_conv_hwc_3x3s2p1c3x16__fma3_2x2);
+  BENCHMARK_DCONV(f32_conv_hwc_3x3s2p1c3x16__fma3_2x1);
+  BENCHMARK_DCONV(f32_conv_hwc_3x3s2p1c3x8__fma3_2x2);
+  BENCHMARK_DCONV(f32_conv_hwc_3x3s2p1c3x8__fma3_2x1);
+  BENCHMARK_DCONV(f32_conv_hwc_3x3s2p1c3x16__avx_2x1);
+  BENCHMARK_DCONV(f32_conv_hwc_3x3s2p1c3x16__avx_1x1);
+  BENCHMARK_DCONV(f32_conv_hwc_3x3s2p1c3x8__avx_2x1);
+  BENCHMARK_DCONV(f32_conv_hwc_3x3s2p1c3x8__avx_1x1);
+  BENCHMARK_DCONV(f32_conv_hwc_3x3s2p1c3x8__sse_2x1);
+  BENCHMARK_DCONV(f32_conv_hwc_3x3s2p1c3x8__sse_1x1);
+  BENCHMARK_DCONV(f32_conv_hwc_3x3s2p1c3x4__sse_2x1);
+  BENCHMARK_DCONV(f32_conv_hwc_3x3s2p1c3x4__sse_1x1);
+
+  BENCHMARK_DCONV(f32_igemm_7x16__avx512f_broadcast);
+  BENCHMARK_DCONV(f32_igemm_5x16__fma3_broadcast);
+  BENCHMARK_DCONV(f32_igemm_5x16__avx_broadcast);
+  BENCHMARK_DCONV(f32_igemm_4x8__sse_load1);
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
 #ifndef XNNPACK_BENCHMARK_NO_MAIN
 BENCHMARK_MAIN();
 #endif
@@ -653,6 +653,202 @@ static void DWConv2DBenchmark(benchmark::State& state,
     DWConv2DBenchmark(state, xnn_f32_dwconv2d_chw_ukernel_5x5s2p2__sse_3x4_acc2, 5, 5, 2, 2);
   }
 
+  static void dwconv2d_chw_3x3p1__avx_1x8(benchmark::State& state, const char* net) {
+    DWConv2DBenchmark(state, xnn_f32_dwconv2d_chw_ukernel_3x3p1__avx_1x8, 3, 3, 1, 1, benchmark::utils::CheckAVX);
+  }
+  static void dwconv2d_chw_3x3p1__avx_2x8(benchmark::State& state, const char* net) {
+    DWConv2DBenchmark(state, xnn_f32_dwconv2d_chw_ukernel_3x3p1__avx_2x8, 3, 3, 1, 1, benchmark::utils::CheckAVX);
+  }
+  static void dwconv2d_chw_3x3p1__avx_3x8(benchmark::State& state, const char* net) {
+    DWConv2DBenchmark(state, xnn_f32_dwconv2d_chw_ukernel_3x3p1__avx_3x8, 3, 3, 1, 1, benchmark::utils::CheckAVX);
+  }
+  static void dwconv2d_chw_3x3p1__avx_4x8(benchmark::State& state, const char* net) {
+    DWConv2DBenchmark(state, xnn_f32_dwconv2d_chw_ukernel_3x3p1__avx_4x8, 3, 3, 1, 1, benchmark::utils::CheckAVX);
+  }
+  static void dwconv2d_chw_3x3p1__avx_5x8(benchmark::State& state, const char* net) {
+    DWConv2DBenchmark(state, xnn_f32_dwconv2d_chw_ukernel_3x3p1__avx_5x8, 3, 3, 1, 1, benchmark::utils::CheckAVX);
+  }
+  static void dwconv2d_chw_3x3p1__avx_1x8_acc2(benchmark::State& state, const char* net) {
+    DWConv2DBenchmark(state, xnn_f32_dwconv2d_chw_ukernel_3x3p1__avx_1x8_acc2, 3, 3, 1, 1, benchmark::utils::CheckAVX);
+  }
+  static void dwconv2d_chw_3x3p1__avx_1x8_acc3(benchmark::State& state, const char* net) {
+    DWConv2DBenchmark(state, xnn_f32_dwconv2d_chw_ukernel_3x3p1__avx_1x8_acc3, 3, 3, 1, 1, benchmark::utils::CheckAVX);
+  }
+  static void dwconv2d_chw_3x3p1__avx_1x8_acc4(benchmark::State& state, const char* net) {
+    DWConv2DBenchmark(state, xnn_f32_dwconv2d_chw_ukernel_3x3p1__avx_1x8_acc4, 3, 3, 1, 1, benchmark::utils::CheckAVX);
+  }
+  static void dwconv2d_chw_3x3p1__avx_2x8_acc2(benchmark::State& state, const char* net) {
+    DWConv2DBenchmark(state, xnn_f32_dwconv2d_chw_ukernel_3x3p1__avx_2x8_acc2, 3, 3, 1, 1, benchmark::utils::CheckAVX);
+  }
+  static void dwconv2d_chw_3x3s2p1__avx_1x8(benchmark::State& state, const char* net) {
+    DWConv2DBenchmark(state, xnn_f32_dwconv2d_chw_ukernel_3x3s2p1__avx_1x8, 3, 3, 1, 2, benchmark::utils::CheckAVX);
+  }
+  static void dwconv2d_chw_3x3s2p1__avx_2x8(benchmark::State& state, const char* net) {
+    DWConv2DBenchmark(state, xnn_f32_dwconv2d_chw_ukernel_3x3s2p1__avx_2x8, 3, 3, 1, 2, benchmark::utils::CheckAVX);
+  }
+  static void dwconv2d_chw_3x3s2p1__avx_3x8(benchmark::State& state, const char* net) {
+    DWConv2DBenchmark(state, xnn_f32_dwconv2d_chw_ukernel_3x3s2p1__avx_3x8, 3, 3, 1, 2, benchmark::utils::CheckAVX);
+  }
+  static void dwconv2d_chw_3x3s2p1__avx_4x8(benchmark::State& state, const char* net) {
+    DWConv2DBenchmark(state, xnn_f32_dwconv2d_chw_ukernel_3x3s2p1__avx_4x8, 3, 3, 1, 2, benchmark::utils::CheckAVX);
+  }
+  static void dwconv2d_chw_3x3s2p1__avx_1x8_acc2(benchmark::State& state, const char* net) {
+    DWConv2DBenchmark(state, xnn_f32_dwconv2d_chw_ukernel_3x3s2p1__avx_1x8_acc2, 3, 3, 1, 2, benchmark::utils::CheckAVX);
+  }
+  static void dwconv2d_chw_3x3s2p1__avx_1x8_acc3(benchmark::State& state, const char* net) {
+    DWConv2DBenchmark(state, xnn_f32_dwconv2d_chw_ukernel_3x3s2p1__avx_1x8_acc3, 3, 3, 1, 2, benchmark::utils::CheckAVX);
+  }
+  static void dwconv2d_chw_3x3s2p1__avx_1x8_acc4(benchmark::State& state, const char* net) {
+    DWConv2DBenchmark(state, xnn_f32_dwconv2d_chw_ukernel_3x3s2p1__avx_1x8_acc4, 3, 3, 1, 2, benchmark::utils::CheckAVX);
+  }
+  static void dwconv2d_chw_3x3s2p1__avx_2x8_acc2(benchmark::State& state, const char* net) {
+    DWConv2DBenchmark(state, xnn_f32_dwconv2d_chw_ukernel_3x3s2p1__avx_2x8_acc2, 3, 3, 1, 2, benchmark::utils::CheckAVX);
+  }
+  static void dwconv2d_chw_5x5p2__avx_1x8(benchmark::State& state, const char* net) {
+    DWConv2DBenchmark(state, xnn_f32_dwconv2d_chw_ukernel_5x5p2__avx_1x8, 5, 5, 2, 1, benchmark::utils::CheckAVX);
+  }
+  static void dwconv2d_chw_5x5p2__avx_2x8(benchmark::State& state, const char* net) {
+    DWConv2DBenchmark(state, xnn_f32_dwconv2d_chw_ukernel_5x5p2__avx_2x8, 5, 5, 2, 1, benchmark::utils::CheckAVX);
+  }
+  static void dwconv2d_chw_5x5p2__avx_3x8(benchmark::State& state, const char* net) {
+    DWConv2DBenchmark(state, xnn_f32_dwconv2d_chw_ukernel_5x5p2__avx_3x8, 5, 5, 2, 1, benchmark::utils::CheckAVX);
+  }
+  static void dwconv2d_chw_5x5p2__avx_1x8_acc2(benchmark::State& state, const char* net) {
+    DWConv2DBenchmark(state, xnn_f32_dwconv2d_chw_ukernel_5x5p2__avx_1x8_acc2, 5, 5, 2, 1, benchmark::utils::CheckAVX);
+  }
+  static void dwconv2d_chw_5x5p2__avx_1x8_acc3(benchmark::State& state, const char* net) {
+    DWConv2DBenchmark(state, xnn_f32_dwconv2d_chw_ukernel_5x5p2__avx_1x8_acc3, 5, 5, 2, 1, benchmark::utils::CheckAVX);
+  }
+  static void dwconv2d_chw_5x5p2__avx_1x8_acc4(benchmark::State& state, const char* net) {
+    DWConv2DBenchmark(state, xnn_f32_dwconv2d_chw_ukernel_5x5p2__avx_1x8_acc4, 5, 5, 2, 1, benchmark::utils::CheckAVX);
+  }
+  static void dwconv2d_chw_5x5p2__avx_1x8_acc5(benchmark::State& state, const char* net) {
+    DWConv2DBenchmark(state, xnn_f32_dwconv2d_chw_ukernel_5x5p2__avx_1x8_acc5, 5, 5, 2, 1, benchmark::utils::CheckAVX);
+  }
+  static void dwconv2d_chw_5x5p2__avx_2x8_acc2(benchmark::State& state, const char* net) {
+    DWConv2DBenchmark(state, xnn_f32_dwconv2d_chw_ukernel_5x5p2__avx_2x8_acc2, 5, 5, 2, 1, benchmark::utils::CheckAVX);
+  }
+  static void dwconv2d_chw_5x5p2__avx_2x8_acc3(benchmark::State& state, const char* net) {
+    DWConv2DBenchmark(state, xnn_f32_dwconv2d_chw_ukernel_5x5p2__avx_2x8_acc3, 5, 5, 2, 1, benchmark::utils::CheckAVX);
+  }
+  static void dwconv2d_chw_5x5s2p2__avx_1x8(benchmark::State& state, const char* net) {
+    DWConv2DBenchmark(state, xnn_f32_dwconv2d_chw_ukernel_5x5s2p2__avx_1x8, 5, 5, 2, 2, benchmark::utils::CheckAVX);
+  }
+  static void dwconv2d_chw_5x5s2p2__avx_2x8(benchmark::State& state, const char* net) {
+    DWConv2DBenchmark(state, xnn_f32_dwconv2d_chw_ukernel_5x5s2p2__avx_2x8, 5, 5, 2, 2, benchmark::utils::CheckAVX);
+  }
+  static void dwconv2d_chw_5x5s2p2__avx_3x8(benchmark::State& state, const char* net) {
+    DWConv2DBenchmark(state, xnn_f32_dwconv2d_chw_ukernel_5x5s2p2__avx_3x8, 5, 5, 2, 2, benchmark::utils::CheckAVX);
+  }
+  static void dwconv2d_chw_5x5s2p2__avx_1x8_acc2(benchmark::State& state, const char* net) {
+    DWConv2DBenchmark(state, xnn_f32_dwconv2d_chw_ukernel_5x5s2p2__avx_1x8_acc2, 5, 5, 2, 2, benchmark::utils::CheckAVX);
+  }
+  static void dwconv2d_chw_5x5s2p2__avx_1x8_acc3(benchmark::State& state, const char* net) {
+    DWConv2DBenchmark(state, xnn_f32_dwconv2d_chw_ukernel_5x5s2p2__avx_1x8_acc3, 5, 5, 2, 2, benchmark::utils::CheckAVX);
+  }
+  static void dwconv2d_chw_5x5s2p2__avx_1x8_acc4(benchmark::State& state, const char* net) {
+    DWConv2DBenchmark(state, xnn_f32_dwconv2d_chw_ukernel_5x5s2p2__avx_1x8_acc4, 5, 5, 2, 2, benchmark::utils::CheckAVX);
+  }
+  static void dwconv2d_chw_5x5s2p2__avx_1x8_acc5(benchmark::State& state, const char* net) {
+    DWConv2DBenchmark(state, xnn_f32_dwconv2d_chw_ukernel_5x5s2p2__avx_1x8_acc5, 5, 5, 2, 2, benchmark::utils::CheckAVX);
+  }
+  static void dwconv2d_chw_5x5s2p2__avx_2x8_acc2(benchmark::State& state, const char* net) {
+    DWConv2DBenchmark(state, xnn_f32_dwconv2d_chw_ukernel_5x5s2p2__avx_2x8_acc2, 5, 5, 2, 2, benchmark::utils::CheckAVX);
+  }
+  static void dwconv2d_chw_5x5s2p2__avx_2x8_acc3(benchmark::State& state, const char* net) {
+    DWConv2DBenchmark(state, xnn_f32_dwconv2d_chw_ukernel_5x5s2p2__avx_2x8_acc3, 5, 5, 2, 2, benchmark::utils::CheckAVX);
+  }
+  static void dwconv2d_chw_3x3p1__avx512f_1x16(benchmark::State& state, const char* net) {
+    DWConv2DBenchmark(state, xnn_f32_dwconv2d_chw_ukernel_3x3p1__avx512f_1x16, 3, 3, 1, 1, benchmark::utils::CheckAVX512F);
+  }
+  static void dwconv2d_chw_3x3p1__avx512f_2x16(benchmark::State& state, const char* net) {
+    DWConv2DBenchmark(state, xnn_f32_dwconv2d_chw_ukernel_3x3p1__avx512f_2x16, 3, 3, 1, 1, benchmark::utils::CheckAVX512F);
+  }
+  static void dwconv2d_chw_3x3p1__avx512f_3x16(benchmark::State& state, const char* net) {
+    DWConv2DBenchmark(state, xnn_f32_dwconv2d_chw_ukernel_3x3p1__avx512f_3x16, 3, 3, 1, 1, benchmark::utils::CheckAVX512F);
+  }
+  static void dwconv2d_chw_3x3p1__avx512f_4x16(benchmark::State& state, const char* net) {
+    DWConv2DBenchmark(state, xnn_f32_dwconv2d_chw_ukernel_3x3p1__avx512f_4x16, 3, 3, 1, 1, benchmark::utils::CheckAVX512F);
+  }
+  static void dwconv2d_chw_3x3p1__avx512f_1x16_acc2(benchmark::State& state, const char* net) {
+    DWConv2DBenchmark(state, xnn_f32_dwconv2d_chw_ukernel_3x3p1__avx512f_1x16_acc2, 3, 3, 1, 1, benchmark::utils::CheckAVX512F);
+  }
+  static void dwconv2d_chw_3x3p1__avx512f_1x16_acc3(benchmark::State& state, const char* net) {
+    DWConv2DBenchmark(state, xnn_f32_dwconv2d_chw_ukernel_3x3p1__avx512f_1x16_acc3, 3, 3, 1, 1, benchmark::utils::CheckAVX512F);
+  }
+  static void dwconv2d_chw_3x3p1__avx512f_1x16_acc4(benchmark::State& state, const char* net) {
+    DWConv2DBenchmark(state, xnn_f32_dwconv2d_chw_ukernel_3x3p1__avx512f_1x16_acc4, 3, 3, 1, 1, benchmark::utils::CheckAVX512F);
+  }
+  static void dwconv2d_chw_3x3p1__avx512f_2x16_acc2(benchmark::State& state, const char* net) {
+    DWConv2DBenchmark(state, xnn_f32_dwconv2d_chw_ukernel_3x3p1__avx512f_2x16_acc2, 3, 3, 1, 1, benchmark::utils::CheckAVX512F);
+  }
+  static void dwconv2d_chw_3x3s2p1__avx512f_1x16(benchmark::State& state, const char* net) {
+    DWConv2DBenchmark(state, xnn_f32_dwconv2d_chw_ukernel_3x3s2p1__avx512f_1x16, 3, 3, 1, 2, benchmark::utils::CheckAVX512F);
+  }
+  static void dwconv2d_chw_3x3s2p1__avx512f_2x16(benchmark::State& state, const char* net) {
+    DWConv2DBenchmark(state, xnn_f32_dwconv2d_chw_ukernel_3x3s2p1__avx512f_2x16, 3, 3, 1, 2, benchmark::utils::CheckAVX512F);
+  }
+  static void dwconv2d_chw_3x3s2p1__avx512f_3x16(benchmark::State& state, const char* net) {
+    DWConv2DBenchmark(state, xnn_f32_dwconv2d_chw_ukernel_3x3s2p1__avx512f_3x16, 3, 3, 1, 2, benchmark::utils::CheckAVX512F);
+  }
+  static void dwconv2d_chw_3x3s2p1__avx512f_1x16_acc2(benchmark::State& state, const char* net) {
+    DWConv2DBenchmark(state, xnn_f32_dwconv2d_chw_ukernel_3x3s2p1__avx512f_1x16_acc2, 3, 3, 1, 2, benchmark::utils::CheckAVX512F);
+  }
+  static void dwconv2d_chw_3x3s2p1__avx512f_1x16_acc3(benchmark::State& state, const char* net) {
+    DWConv2DBenchmark(state, xnn_f32_dwconv2d_chw_ukernel_3x3s2p1__avx512f_1x16_acc3, 3, 3, 1, 2, benchmark::utils::CheckAVX512F);
+  }
+  static void dwconv2d_chw_3x3s2p1__avx512f_1x16_acc4(benchmark::State& state, const char* net) {
+    DWConv2DBenchmark(state, xnn_f32_dwconv2d_chw_ukernel_3x3s2p1__avx512f_1x16_acc4, 3, 3, 1, 2, benchmark::utils::CheckAVX512F);
+  }
+  static void dwconv2d_chw_3x3s2p1__avx512f_2x16_acc2(benchmark::State& state, const char* net) {
+    DWConv2DBenchmark(state, xnn_f32_dwconv2d_chw_ukernel_3x3s2p1__avx512f_2x16_acc2, 3, 3, 1, 2, benchmark::utils::CheckAVX512F);
+  }
+  static void dwconv2d_chw_5x5p2__avx512f_1x16(benchmark::State& state, const char* net) {
+    DWConv2DBenchmark(state, xnn_f32_dwconv2d_chw_ukernel_5x5p2__avx512f_1x16, 5, 5, 2, 1, benchmark::utils::CheckAVX512F);
+  }
+  static void dwconv2d_chw_5x5p2__avx512f_2x16(benchmark::State& state, const char* net) {
+    DWConv2DBenchmark(state, xnn_f32_dwconv2d_chw_ukernel_5x5p2__avx512f_2x16, 5, 5, 2, 1, benchmark::utils::CheckAVX512F);
+  }
+  static void dwconv2d_chw_5x5p2__avx512f_3x16(benchmark::State& state, const char* net) {
+    DWConv2DBenchmark(state, xnn_f32_dwconv2d_chw_ukernel_5x5p2__avx512f_3x16, 5, 5, 2, 1, benchmark::utils::CheckAVX512F);
+  }
+  static void dwconv2d_chw_5x5p2__avx512f_4x16(benchmark::State& state, const char* net) {
+    DWConv2DBenchmark(state, xnn_f32_dwconv2d_chw_ukernel_5x5p2__avx512f_4x16, 5, 5, 2, 1, benchmark::utils::CheckAVX512F);
+  }
+  static void dwconv2d_chw_5x5p2__avx512f_1x16_acc2(benchmark::State& state, const char* net) {
+    DWConv2DBenchmark(state, xnn_f32_dwconv2d_chw_ukernel_5x5p2__avx512f_1x16_acc2, 5, 5, 2, 1, benchmark::utils::CheckAVX512F);
+  }
+  static void dwconv2d_chw_5x5p2__avx512f_1x16_acc3(benchmark::State& state, const char* net) {
+    DWConv2DBenchmark(state, xnn_f32_dwconv2d_chw_ukernel_5x5p2__avx512f_1x16_acc3, 5, 5, 2, 1, benchmark::utils::CheckAVX512F);
+  }
+  static void dwconv2d_chw_5x5p2__avx512f_1x16_acc4(benchmark::State& state, const char* net) {
+    DWConv2DBenchmark(state, xnn_f32_dwconv2d_chw_ukernel_5x5p2__avx512f_1x16_acc4, 5, 5, 2, 1, benchmark::utils::CheckAVX512F);
+  }
+  static void dwconv2d_chw_5x5p2__avx512f_2x16_acc2(benchmark::State& state, const char* net) {
+    DWConv2DBenchmark(state, xnn_f32_dwconv2d_chw_ukernel_5x5p2__avx512f_2x16_acc2, 5, 5, 2, 1, benchmark::utils::CheckAVX512F);
+  }
+  static void dwconv2d_chw_5x5s2p2__avx512f_1x16(benchmark::State& state, const char* net) {
+    DWConv2DBenchmark(state, xnn_f32_dwconv2d_chw_ukernel_5x5s2p2__avx512f_1x16, 5, 5, 2, 2, benchmark::utils::CheckAVX512F);
+  }
+  static void dwconv2d_chw_5x5s2p2__avx512f_2x16(benchmark::State& state, const char* net) {
+    DWConv2DBenchmark(state, xnn_f32_dwconv2d_chw_ukernel_5x5s2p2__avx512f_2x16, 5, 5, 2, 2, benchmark::utils::CheckAVX512F);
+  }
+  static void dwconv2d_chw_5x5s2p2__avx512f_3x16(benchmark::State& state, const char* net) {
+    DWConv2DBenchmark(state, xnn_f32_dwconv2d_chw_ukernel_5x5s2p2__avx512f_3x16, 5, 5, 2, 2, benchmark::utils::CheckAVX512F);
+  }
+  static void dwconv2d_chw_5x5s2p2__avx512f_1x16_acc2(benchmark::State& state, const char* net) {
+    DWConv2DBenchmark(state, xnn_f32_dwconv2d_chw_ukernel_5x5s2p2__avx512f_1x16_acc2, 5, 5, 2, 2, benchmark::utils::CheckAVX512F);
+  }
+  static void dwconv2d_chw_5x5s2p2__avx512f_1x16_acc3(benchmark::State& state, const char* net) {
+    DWConv2DBenchmark(state, xnn_f32_dwconv2d_chw_ukernel_5x5s2p2__avx512f_1x16_acc3, 5, 5, 2, 2, benchmark::utils::CheckAVX512F);
+  }
+  static void dwconv2d_chw_5x5s2p2__avx512f_1x16_acc4(benchmark::State& state, const char* net) {
+    DWConv2DBenchmark(state, xnn_f32_dwconv2d_chw_ukernel_5x5s2p2__avx512f_1x16_acc4, 5, 5, 2, 2, benchmark::utils::CheckAVX512F);
+  }
+  static void dwconv2d_chw_5x5s2p2__avx512f_2x16_acc2(benchmark::State& state, const char* net) {
+    DWConv2DBenchmark(state, xnn_f32_dwconv2d_chw_ukernel_5x5s2p2__avx512f_2x16_acc2, 5, 5, 2, 2, benchmark::utils::CheckAVX512F);
+  }
+
   BENCHMARK_DWCONV(dwconv2d_chw_3x3p1__sse_1x4)
   BENCHMARK_DWCONV(dwconv2d_chw_3x3p1__sse_2x4)
   BENCHMARK_DWCONV(dwconv2d_chw_3x3p1__sse_3x4)
@@ -708,6 +904,79 @@ static void DWConv2DBenchmark(benchmark::State& state,
   BENCHMARK_DWCONV(dwconv2d_chw_5x5s2p2__sse_2x4_acc2)
   BENCHMARK_DWCONV(dwconv2d_chw_5x5s2p2__sse_2x4_acc3)
   BENCHMARK_DWCONV(dwconv2d_chw_5x5s2p2__sse_3x4_acc2)
+
+  BENCHMARK_DWCONV(dwconv2d_chw_3x3p1__avx_1x8)
+  BENCHMARK_DWCONV(dwconv2d_chw_3x3p1__avx_2x8)
+  BENCHMARK_DWCONV(dwconv2d_chw_3x3p1__avx_3x8)
+  BENCHMARK_DWCONV(dwconv2d_chw_3x3p1__avx_4x8)
+  BENCHMARK_DWCONV(dwconv2d_chw_3x3p1__avx_5x8)
+  BENCHMARK_DWCONV(dwconv2d_chw_3x3p1__avx_1x8_acc2)
+  BENCHMARK_DWCONV(dwconv2d_chw_3x3p1__avx_1x8_acc3)
+  BENCHMARK_DWCONV(dwconv2d_chw_3x3p1__avx_1x8_acc4)
+  BENCHMARK_DWCONV(dwconv2d_chw_3x3p1__avx_2x8_acc2)
+
+  BENCHMARK_DWCONV(dwconv2d_chw_3x3s2p1__avx_1x8)
+  BENCHMARK_DWCONV(dwconv2d_chw_3x3s2p1__avx_2x8)
+  BENCHMARK_DWCONV(dwconv2d_chw_3x3s2p1__avx_3x8)
+  BENCHMARK_DWCONV(dwconv2d_chw_3x3s2p1__avx_4x8)
+  BENCHMARK_DWCONV(dwconv2d_chw_3x3s2p1__avx_1x8_acc2)
+  BENCHMARK_DWCONV(dwconv2d_chw_3x3s2p1__avx_1x8_acc3)
+  BENCHMARK_DWCONV(dwconv2d_chw_3x3s2p1__avx_1x8_acc4)
+  BENCHMARK_DWCONV(dwconv2d_chw_3x3s2p1__avx_2x8_acc2)
+
+  BENCHMARK_DWCONV(dwconv2d_chw_5x5p2__avx_1x8)
+  BENCHMARK_DWCONV(dwconv2d_chw_5x5p2__avx_2x8)
+  BENCHMARK_DWCONV(dwconv2d_chw_5x5p2__avx_3x8)
+  BENCHMARK_DWCONV(dwconv2d_chw_5x5p2__avx_1x8_acc2)
+  BENCHMARK_DWCONV(dwconv2d_chw_5x5p2__avx_1x8_acc3)
+  BENCHMARK_DWCONV(dwconv2d_chw_5x5p2__avx_1x8_acc4)
+  BENCHMARK_DWCONV(dwconv2d_chw_5x5p2__avx_1x8_acc5)
+  BENCHMARK_DWCONV(dwconv2d_chw_5x5p2__avx_2x8_acc2)
+  BENCHMARK_DWCONV(dwconv2d_chw_5x5p2__avx_2x8_acc3)
+
+  BENCHMARK_DWCONV(dwconv2d_chw_5x5s2p2__avx_1x8)
+  BENCHMARK_DWCONV(dwconv2d_chw_5x5s2p2__avx_2x8)
+  BENCHMARK_DWCONV(dwconv2d_chw_5x5s2p2__avx_3x8)
+  BENCHMARK_DWCONV(dwconv2d_chw_5x5s2p2__avx_1x8_acc2)
+  BENCHMARK_DWCONV(dwconv2d_chw_5x5s2p2__avx_1x8_acc3)
+  BENCHMARK_DWCONV(dwconv2d_chw_5x5s2p2__avx_1x8_acc4)
+  BENCHMARK_DWCONV(dwconv2d_chw_5x5s2p2__avx_1x8_acc5)
+  BENCHMARK_DWCONV(dwconv2d_chw_5x5s2p2__avx_2x8_acc2)
+  BENCHMARK_DWCONV(dwconv2d_chw_5x5s2p2__avx_2x8_acc3)
+
+  BENCHMARK_DWCONV(dwconv2d_chw_3x3p1__avx512f_1x16)
+  BENCHMARK_DWCONV(dwconv2d_chw_3x3p1__avx512f_2x16)
+  BENCHMARK_DWCONV(dwconv2d_chw_3x3p1__avx512f_3x16)
+  BENCHMARK_DWCONV(dwconv2d_chw_3x3p1__avx512f_4x16)
+  BENCHMARK_DWCONV(dwconv2d_chw_3x3p1__avx512f_1x16_acc2)
+  BENCHMARK_DWCONV(dwconv2d_chw_3x3p1__avx512f_1x16_acc3)
+  BENCHMARK_DWCONV(dwconv2d_chw_3x3p1__avx512f_1x16_acc4)
+  BENCHMARK_DWCONV(dwconv2d_chw_3x3p1__avx512f_2x16_acc2)
+
+  BENCHMARK_DWCONV(dwconv2d_chw_3x3s2p1__avx512f_1x16)
+  BENCHMARK_DWCONV(dwconv2d_chw_3x3s2p1__avx512f_2x16)
+  BENCHMARK_DWCONV(dwconv2d_chw_3x3s2p1__avx512f_3x16)
+  BENCHMARK_DWCONV(dwconv2d_chw_3x3s2p1__avx512f_1x16_acc2)
+  BENCHMARK_DWCONV(dwconv2d_chw_3x3s2p1__avx512f_1x16_acc3)
+  BENCHMARK_DWCONV(dwconv2d_chw_3x3s2p1__avx512f_1x16_acc4)
+  BENCHMARK_DWCONV(dwconv2d_chw_3x3s2p1__avx512f_2x16_acc2)
+
+  BENCHMARK_DWCONV(dwconv2d_chw_5x5p2__avx512f_1x16)
+  BENCHMARK_DWCONV(dwconv2d_chw_5x5p2__avx512f_2x16)
+  BENCHMARK_DWCONV(dwconv2d_chw_5x5p2__avx512f_3x16)
+  BENCHMARK_DWCONV(dwconv2d_chw_5x5p2__avx512f_4x16)
+  BENCHMARK_DWCONV(dwconv2d_chw_5x5p2__avx512f_1x16_acc2)
+  BENCHMARK_DWCONV(dwconv2d_chw_5x5p2__avx512f_1x16_acc3)
+  BENCHMARK_DWCONV(dwconv2d_chw_5x5p2__avx512f_1x16_acc4)
+  BENCHMARK_DWCONV(dwconv2d_chw_5x5p2__avx512f_2x16_acc2)
+
+  BENCHMARK_DWCONV(dwconv2d_chw_5x5s2p2__avx512f_1x16)
+  BENCHMARK_DWCONV(dwconv2d_chw_5x5s2p2__avx512f_2x16)
+  BENCHMARK_DWCONV(dwconv2d_chw_5x5s2p2__avx512f_3x16)
+  BENCHMARK_DWCONV(dwconv2d_chw_5x5s2p2__avx512f_1x16_acc2)
+  BENCHMARK_DWCONV(dwconv2d_chw_5x5s2p2__avx512f_1x16_acc3)
+  BENCHMARK_DWCONV(dwconv2d_chw_5x5s2p2__avx512f_1x16_acc4)
+  BENCHMARK_DWCONV(dwconv2d_chw_5x5s2p2__avx512f_2x16_acc2)
 #endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
 
 #if XNN_ARCH_WASMSIMD || XNN_ARCH_WASMRELAXEDSIMD
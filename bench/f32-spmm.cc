@@ -373,6 +373,142 @@ static void SpMMBenchmark(benchmark::State& state,
   // BENCHMARK_SPMM(spmm80_8x1__sse)
   // BENCHMARK_SPMM(spmm80_16x1__sse)
   BENCHMARK_SPMM(spmm80_32x1__sse)
+
+  static void spmm80_8x1__avx(benchmark::State& state, const char* net) {
+    SpMMBenchmark(state, xnn_f32_spmm_minmax_ukernel_8x1__avx, 8, 1, 0.8f, benchmark::utils::CheckAVX);
+  }
+
+  static void spmm80_8x2__avx(benchmark::State& state, const char* net) {
+    SpMMBenchmark(state, xnn_f32_spmm_minmax_ukernel_8x2__avx, 8, 2, 0.8f, benchmark::utils::CheckAVX);
+  }
+
+  static void spmm80_8x4__avx(benchmark::State& state, const char* net) {
+    SpMMBenchmark(state, xnn_f32_spmm_minmax_ukernel_8x4__avx, 8, 4, 0.8f, benchmark::utils::CheckAVX);
+  }
+
+  static void spmm80_16x1__avx(benchmark::State& state, const char* net) {
+    SpMMBenchmark(state, xnn_f32_spmm_minmax_ukernel_16x1__avx, 16, 1, 0.8f, benchmark::utils::CheckAVX);
+  }
+
+  static void spmm80_16x2__avx(benchmark::State& state, const char* net) {
+    SpMMBenchmark(state, xnn_f32_spmm_minmax_ukernel_16x2__avx, 16, 2, 0.8f, benchmark::utils::CheckAVX);
+  }
+
+  static void spmm80_16x4__avx(benchmark::State& state, const char* net) {
+    SpMMBenchmark(state, xnn_f32_spmm_minmax_ukernel_16x4__avx, 16, 4, 0.8f, benchmark::utils::CheckAVX);
+  }
+
+  static void spmm80_32x1__avx(benchmark::State& state, const char* net) {
+    SpMMBenchmark(state, xnn_f32_spmm_minmax_ukernel_32x1__avx, 32, 1, 0.8f, benchmark::utils::CheckAVX);
+  }
+
+  static void spmm80_32x2__avx(benchmark::State& state, const char* net) {
+    SpMMBenchmark(state, xnn_f32_spmm_minmax_ukernel_32x2__avx, 32, 2, 0.8f, benchmark::utils::CheckAVX);
+  }
+
+  static void spmm80_32x4__avx(benchmark::State& state, const char* net) {
+    SpMMBenchmark(state, xnn_f32_spmm_minmax_ukernel_32x4__avx, 32, 4, 0.8f, benchmark::utils::CheckAVX);
+  }
+
+  static void spmm80_8x1__fma3(benchmark::State& state, const char* net) {
+    SpMMBenchmark(state, xnn_f32_spmm_minmax_ukernel_8x1__fma3, 8, 1, 0.8f, benchmark::utils::CheckFMA3);
+  }
+
+  static void spmm80_8x2__fma3(benchmark::State& state, const char* net) {
+    SpMMBenchmark(state, xnn_f32_spmm_minmax_ukernel_8x2__fma3, 8, 2, 0.8f, benchmark::utils::CheckFMA3);
+  }
+
+  static void spmm80_8x4__fma3(benchmark::State& state, const char* net) {
+    SpMMBenchmark(state, xnn_f32_spmm_minmax_ukernel_8x4__fma3, 8, 4, 0.8f, benchmark::utils::CheckFMA3);
+  }
+
+  static void spmm80_16x1__fma3(benchmark::State& state, const char* net) {
+    SpMMBenchmark(state, xnn_f32_spmm_minmax_ukernel_16x1__fma3, 16, 1, 0.8f, benchmark::utils::CheckFMA3);
+  }
+
+  static void spmm80_16x2__fma3(benchmark::State& state, const char* net) {
+    SpMMBenchmark(state, xnn_f32_spmm_minmax_ukernel_16x2__fma3, 16, 2, 0.8f, benchmark::utils::CheckFMA3);
+  }
+
+  static void spmm80_16x4__fma3(benchmark::State& state, const char* net) {
+    SpMMBenchmark(state, xnn_f32_spmm_minmax_ukernel_16x4__fma3, 16, 4, 0.8f, benchmark::utils::CheckFMA3);
+  }
+
+  static void spmm80_32x1__fma3(benchmark::State& state, const char* net) {
+    SpMMBenchmark(state, xnn_f32_spmm_minmax_ukernel_32x1__fma3, 32, 1, 0.8f, benchmark::utils::CheckFMA3);
+  }
+
+  static void spmm80_32x2__fma3(benchmark::State& state, const char* net) {
+    SpMMBenchmark(state, xnn_f32_spmm_minmax_ukernel_32x2__fma3, 32, 2, 0.8f, benchmark::utils::CheckFMA3);
+  }
+
+  static void spmm80_32x4__fma3(benchmark::State& state, const char* net) {
+    SpMMBenchmark(state, xnn_f32_spmm_minmax_ukernel_32x4__fma3, 32, 4, 0.8f, benchmark::utils::CheckFMA3);
+  }
+
+  static void spmm80_16x1__avx512f(benchmark::State& state, const char* net) {
+    SpMMBenchmark(state, xnn_f32_spmm_minmax_ukernel_16x1__avx512f, 16, 1, 0.8f, benchmark::utils::CheckAVX512F);
+  }
+
+  static void spmm80_16x2__avx512f(benchmark::State& state, const char* net) {
+    SpMMBenchmark(state, xnn_f32_spmm_minmax_ukernel_16x2__avx512f, 16, 2, 0.8f, benchmark::utils::CheckAVX512F);
+  }
+
+  static void spmm80_16x4__avx512f(benchmark::State& state, const char* net) {
+    SpMMBenchmark(state, xnn_f32_spmm_minmax_ukernel_16x4__avx512f, 16, 4, 0.8f, benchmark::utils::CheckAVX512F);
+  }
+
+  static void spmm80_32x1__avx512f(benchmark::State& state, const char* net) {
+    SpMMBenchmark(state, xnn_f32_spmm_minmax_ukernel_32x1__avx512f, 32, 1, 0.8f, benchmark::utils::CheckAVX512F);
+  }
+
+  static void spmm80_32x2__avx512f(benchmark::State& state, const char* net) {
+    SpMMBenchmark(state, xnn_f32_spmm_minmax_ukernel_32x2__avx512f, 32, 2, 0.8f, benchmark::utils::CheckAVX512F);
+  }
+
+  static void spmm80_32x4__avx512f(benchmark::State& state, const char* net) {
+    SpMMBenchmark(state, xnn_f32_spmm_minmax_ukernel_32x4__avx512f, 32, 4, 0.8f, benchmark::utils::CheckAVX512F);
+  }
+
+  static void spmm80_64x1__avx512f(benchmark::State& state, const char* net) {
+    SpMMBenchmark(state, xnn_f32_spmm_minmax_ukernel_64x1__avx512f, 64, 1, 0.8f, benchmark::utils::CheckAVX512F);
+  }
+
+  static void spmm80_64x2__avx512f(benchmark::State& state, const char* net) {
+    SpMMBenchmark(state, xnn_f32_spmm_minmax_ukernel_64x2__avx512f, 64, 2, 0.8f, benchmark::utils::CheckAVX512F);
+  }
+
+  static void spmm80_64x4__avx512f(benchmark::State& state, const char* net) {
+    SpMMBenchmark(state, xnn_f32_spmm_minmax_ukernel_64x4__avx512f, 64, 4, 0.8f, benchmark::utils::CheckAVX512F);
+  }
+
+  BENCHMARK_SPMM(spmm80_8x1__avx)
+  BENCHMARK_SPMM(spmm80_8x2__avx)
+  BENCHMARK_SPMM(spmm80_8x4__avx)
+  BENCHMARK_SPMM(spmm80_16x1__avx)
+  BENCHMARK_SPMM(spmm80_16x2__avx)
+  BENCHMARK_SPMM(spmm80_16x4__avx)
+  BENCHMARK_SPMM(spmm80_32x1__avx)
+  BENCHMARK_SPMM(spmm80_32x2__avx)
+  BENCHMARK_SPMM(spmm80_32x4__avx)
+  BENCHMARK_SPMM(spmm80_8x1__fma3)
+  BENCHMARK_SPMM(spmm80_8x2__fma3)
+  BENCHMARK_SPMM(spmm80_8x4__fma3)
+  BENCHMARK_SPMM(spmm80_16x1__fma3)
+  BENCHMARK_SPMM(spmm80_16x2__fma3)
+  BENCHMARK_SPMM(spmm80_16x4__fma3)
+  BENCHMARK_SPMM(spmm80_32x1__fma3)
+  BENCHMARK_SPMM(spmm80_32x2__fma3)
+  BENCHMARK_SPMM(spmm80_32x4__fma3)
+  BENCHMARK_SPMM(spmm80_16x1__avx512f)
+  BENCHMARK_SPMM(spmm80_16x2__avx512f)
+  BENCHMARK_SPMM(spmm80_16x4__avx512f)
+  BENCHMARK_SPMM(spmm80_32x1__avx512f)
+  BENCHMARK_SPMM(spmm80_32x2__avx512f)
+  BENCHMARK_SPMM(spmm80_32x4__avx512f)
+  BENCHMARK_SPMM(spmm80_64x1__avx512f)
+  BENCHMARK_SPMM(spmm80_64x2__avx512f)
+  BENCHMARK_SPMM(spmm80_64x4__avx512f)
 #endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
 
 static void spmm80_1x1__scalar(benchmark::State& state, const char* net) {
@@ -0,0 +1,204 @@
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <random>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+#include "bench/utils.h"
+
+#include <xnnpack/AlignedAllocator.h>
+#include <xnnpack/common.h>
+#include <xnnpack/params.h>
+#include <xnnpack/params-init.h>
+#include <xnnpack/vunary.h>
+
+
+static void f32_vgelu(
+  benchmark::State& state,
+  xnn_f32_vgelu_ukernel_function vgelu,
+  xnn_init_f32_gelu_params_fn init_params,
+  benchmark::utils::IsaCheckFunction isa_check = nullptr)
+{
+  if (isa_check && !isa_check(state)) {
+    return;
+  }
+
+  const size_t num_elements = state.range(0);
+
+  std::random_device random_device;
+  auto rng = std::mt19937(random_device());
+  auto f32rng = std::bind(std::uniform_real_distribution<float>(-10.0f, 10.0f), std::ref(rng));
+
+  std::vector<float, AlignedAllocator<float, 64>> x(num_elements);
+  std::vector<float, AlignedAllocator<float, 64>> y(num_elements);
+  std::generate(x.begin(), x.end(), std::ref(f32rng));
+  std::fill(y.begin(), y.end(), std::nanf(""));
+
+  xnn_f32_gelu_params params;
+  init_params(&params);
+  for (auto _ : state) {
+    vgelu(num_elements * sizeof(float), x.data(), y.data(), &params);
+  }
+
+  const uint64_t cpu_frequency = benchmark::utils::GetCurrentCpuFrequency();
+  if (cpu_frequency != 0) {
+    state.counters["cpufreq"] = cpu_frequency;
+  }
+
+  const size_t elements_per_iteration = num_elements;
+  state.counters["elements"] =
+    benchmark::Counter(uint64_t(state.iterations()) * elements_per_iteration, benchmark::Counter::kIsRate);
+
+  const size_t bytes_per_iteration = 2 * num_elements * sizeof(float);
+  state.counters["bytes"] =
+    benchmark::Counter(uint64_t(state.iterations()) * bytes_per_iteration, benchmark::Counter::kIsRate);
+}
+
+#if XNN_ARCH_ARM64
+  BENCHMARK_CAPTURE(f32_vgelu, neonfma_rational_13_8_div_x4,
+                    xnn_f32_vgelu_ukernel__neonfma_rational_13_8_div_x4,
+                    xnn_init_f32_gelu_neon_rational_13_8_params)
+    ->Apply(benchmark::utils::UnaryElementwiseParameters<float, float>)
+    ->UseRealTime();
+  BENCHMARK_CAPTURE(f32_vgelu, neonfma_rational_13_8_div_x8,
+                    xnn_f32_vgelu_ukernel__neonfma_rational_13_8_div_x8,
+                    xnn_init_f32_gelu_neon_rational_13_8_params)
+    ->Apply(benchmark::utils::UnaryElementwiseParameters<float, float>)
+    ->UseRealTime();
+  BENCHMARK_CAPTURE(f32_vgelu, neonfma_rational_13_8_div_x12,
+                    xnn_f32_vgelu_ukernel__neonfma_rational_13_8_div_x12,
+                    xnn_init_f32_gelu_neon_rational_13_8_params)
+    ->Apply(benchmark::utils::UnaryElementwiseParameters<float, float>)
+    ->UseRealTime();
+  BENCHMARK_CAPTURE(f32_vgelu, neonfma_rational_13_8_div_x16,
+                    xnn_f32_vgelu_ukernel__neonfma_rational_13_8_div_x16,
+                    xnn_init_f32_gelu_neon_rational_13_8_params)
+    ->Apply(benchmark::utils::UnaryElementwiseParameters<float, float>)
+    ->UseRealTime();
+#endif  // XNN_ARCH_ARM64
+
+#if XNN_ARCH_ARM || XNN_ARCH_ARM64
+  BENCHMARK_CAPTURE(f32_vgelu, neon_rational_13_8_nr2recps_x4,
+                    xnn_f32_vgelu_ukernel__neon_rational_13_8_nr2recps_x4,
+                    xnn_init_f32_gelu_neon_rational_13_8_params,
+                    benchmark::utils::CheckNEON)
+    ->Apply(benchmark::utils::UnaryElementwiseParameters<float, float>)
+    ->UseRealTime();
+  BENCHMARK_CAPTURE(f32_vgelu, neon_rational_13_8_nr2recps_x8,
+                    xnn_f32_vgelu_ukernel__neon_rational_13_8_nr2recps_x8,
+                    xnn_init_f32_gelu_neon_rational_13_8_params,
+                    benchmark::utils::CheckNEON)
+    ->Apply(benchmark::utils::UnaryElementwiseParameters<float, float>)
+    ->UseRealTime();
+  BENCHMARK_CAPTURE(f32_vgelu, neon_rational_13_8_nr2recps_x12,
+                    xnn_f32_vgelu_ukernel__neon_rational_13_8_nr2recps_x12,
+                    xnn_init_f32_gelu_neon_rational_13_8_params,
+                    benchmark::utils::CheckNEON)
+    ->Apply(benchmark::utils::UnaryElementwiseParameters<float, float>)
+    ->UseRealTime();
+  BENCHMARK_CAPTURE(f32_vgelu, neon_rational_13_8_nr2recps_x16,
+                    xnn_f32_vgelu_ukernel__neon_rational_13_8_nr2recps_x16,
+                    xnn_init_f32_gelu_neon_rational_13_8_params,
+                    benchmark::utils::CheckNEON)
+    ->Apply(benchmark::utils::UnaryElementwiseParameters<float, float>)
+    ->UseRealTime();
+#endif  // XNN_ARCH_ARM || XNN_ARCH_ARM64
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  BENCHMARK_CAPTURE(f32_vgelu, avx512f_rational_13_8_div_x16,
+                    xnn_f32_vgelu_ukernel__avx512f_rational_13_8_div_x16,
+                    xnn_init_f32_gelu_avx512_rational_13_8_params,
+                    benchmark::utils::CheckAVX512F)
+    ->Apply(benchmark::utils::UnaryElementwiseParameters<float, float>)
+    ->UseRealTime();
+  BENCHMARK_CAPTURE(f32_vgelu, avx512f_rational_13_8_div_x32,
+                    xnn_f32_vgelu_ukernel__avx512f_rational_13_8_div_x32,
+                    xnn_init_f32_gelu_avx512_rational_13_8_params,
+                    benchmark::utils::CheckAVX512F)
+    ->Apply(benchmark::utils::UnaryElementwiseParameters<float, float>)
+    ->UseRealTime();
+  BENCHMARK_CAPTURE(f32_vgelu, avx512f_rational_13_8_div_x48,
+                    xnn_f32_vgelu_ukernel__avx512f_rational_13_8_div_x48,
+                    xnn_init_f32_gelu_avx512_rational_13_8_params,
+                    benchmark::utils::CheckAVX512F)
+    ->Apply(benchmark::utils::UnaryElementwiseParameters<float, float>)
+    ->UseRealTime();
+  BENCHMARK_CAPTURE(f32_vgelu, avx512f_rational_13_8_div_x64,
+                    xnn_f32_vgelu_ukernel__avx512f_rational_13_8_div_x64,
+                    xnn_init_f32_gelu_avx512_rational_13_8_params,
+                    benchmark::utils::CheckAVX512F)
+    ->Apply(benchmark::utils::UnaryElementwiseParameters<float, float>)
+    ->UseRealTime();
+
+  BENCHMARK_CAPTURE(f32_vgelu, avx2_rational_13_8_div_x8,
+                    xnn_f32_vgelu_ukernel__avx2_rational_13_8_div_x8,
+                    xnn_init_f32_gelu_avx_rational_13_8_params,
+                    benchmark::utils::CheckAVX2)
+    ->Apply(benchmark::utils::UnaryElementwiseParameters<float, float>)
+    ->UseRealTime();
+  BENCHMARK_CAPTURE(f32_vgelu, avx2_rational_13_8_div_x16,
+                    xnn_f32_vgelu_ukernel__avx2_rational_13_8_div_x16,
+                    xnn_init_f32_gelu_avx_rational_13_8_params,
+                    benchmark::utils::CheckAVX2)
+    ->Apply(benchmark::utils::UnaryElementwiseParameters<float, float>)
+    ->UseRealTime();
+  BENCHMARK_CAPTURE(f32_vgelu, avx2_rational_13_8_div_x24,
+                    xnn_f32_vgelu_ukernel__avx2_rational_13_8_div_x24,
+                    xnn_init_f32_gelu_avx_rational_13_8_params,
+                    benchmark::utils::CheckAVX2)
+    ->Apply(benchmark::utils::UnaryElementwiseParameters<float, float>)
+    ->UseRealTime();
+  BENCHMARK_CAPTURE(f32_vgelu, avx2_rational_13_8_div_x32,
+                    xnn_f32_vgelu_ukernel__avx2_rational_13_8_div_x32,
+                    xnn_init_f32_gelu_avx_rational_13_8_params,
+                    benchmark::utils::CheckAVX2)
+    ->Apply(benchmark::utils::UnaryElementwiseParameters<float, float>)
+    ->UseRealTime();
+
+  BENCHMARK_CAPTURE(f32_vgelu, sse2_rational_13_8_div_x4,
+                    xnn_f32_vgelu_ukernel__sse2_rational_13_8_div_x4,
+                    xnn_init_f32_gelu_sse_rational_13_8_params)
+    ->Apply(benchmark::utils::UnaryElementwiseParameters<float, float>)
+    ->UseRealTime();
+  BENCHMARK_CAPTURE(f32_vgelu, sse2_rational_13_8_div_x8,
+                    xnn_f32_vgelu_ukernel__sse2_rational_13_8_div_x8,
+                    xnn_init_f32_gelu_sse_rational_13_8_params)
+    ->Apply(benchmark::utils::UnaryElementwiseParameters<float, float>)
+    ->UseRealTime();
+  BENCHMARK_CAPTURE(f32_vgelu, sse2_rational_13_8_div_x12,
+                    xnn_f32_vgelu_ukernel__sse2_rational_13_8_div_x12,
+                    xnn_init_f32_gelu_sse_rational_13_8_params)
+    ->Apply(benchmark::utils::UnaryElementwiseParameters<float, float>)
+    ->UseRealTime();
+  BENCHMARK_CAPTURE(f32_vgelu, sse2_rational_13_8_div_x16,
+                    xnn_f32_vgelu_ukernel__sse2_rational_13_8_div_x16,
+                    xnn_init_f32_gelu_sse_rational_13_8_params)
+    ->Apply(benchmark::utils::UnaryElementwiseParameters<float, float>)
+    ->UseRealTime();
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+BENCHMARK_CAPTURE(f32_vgelu, scalar_rational_13_8_div_x1,
+                  xnn_f32_vgelu_ukernel__scalar_rational_13_8_div_x1,
+                  xnn_init_f32_gelu_scalar_rational_13_8_params)
+  ->Apply(benchmark::utils::UnaryElementwiseParameters<float, float>)
+  ->UseRealTime();
+BENCHMARK_CAPTURE(f32_vgelu, scalar_rational_13_8_div_x2,
+                  xnn_f32_vgelu_ukernel__scalar_rational_13_8_div_x2,
+                  xnn_init_f32_gelu_scalar_rational_13_8_params)
+  ->Apply(benchmark::utils::UnaryElementwiseParameters<float, float>)
+  ->UseRealTime();
+BENCHMARK_CAPTURE(f32_vgelu, scalar_rational_13_8_div_x4,
+                  xnn_f32_vgelu_ukernel__scalar_rational_13_8_div_x4,
+                  xnn_init_f32_gelu_scalar_rational_13_8_params)
+  ->Apply(benchmark::utils::UnaryElementwiseParameters<float, float>)
+  ->UseRealTime();
+
+#ifndef XNNPACK_BENCHMARK_NO_MAIN
+BENCHMARK_MAIN();
+#endif
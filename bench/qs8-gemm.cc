@@ -1285,6 +1285,40 @@ static void ruy_st(benchmark::State& state, const char* net)
 
 
 #if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  static void qs8_gemm_1x16c4__avx512vnni(benchmark::State& state, const char* net) {
+    GEMMBenchmark(state, xnn_qs8_gemm_minmax_fp32_ukernel_1x16c4__avx512vnni, 1, 16, 4, 1,
+      xnn_init_qs8_conv_minmax_fp32_avx512_params, benchmark::utils::CheckAVX512VNNI);
+  }
+  static void qs8_gemm_2x16c4__avx512vnni(benchmark::State& state, const char* net) {
+    GEMMBenchmark(state, xnn_qs8_gemm_minmax_fp32_ukernel_2x16c4__avx512vnni, 2, 16, 4, 1,
+      xnn_init_qs8_conv_minmax_fp32_avx512_params, benchmark::utils::CheckAVX512VNNI);
+  }
+  static void qs8_gemm_3x16c4__avx512vnni(benchmark::State& state, const char* net) {
+    GEMMBenchmark(state, xnn_qs8_gemm_minmax_fp32_ukernel_3x16c4__avx512vnni, 3, 16, 4, 1,
+      xnn_init_qs8_conv_minmax_fp32_avx512_params, benchmark::utils::CheckAVX512VNNI);
+  }
+  static void qs8_gemm_4x16c4__avx512vnni(benchmark::State& state, const char* net) {
+    GEMMBenchmark(state, xnn_qs8_gemm_minmax_fp32_ukernel_4x16c4__avx512vnni, 4, 16, 4, 1,
+      xnn_init_qs8_conv_minmax_fp32_avx512_params, benchmark::utils::CheckAVX512VNNI);
+  }
+
+  static void qs8_gemm_1x16c8__avx512vnni(benchmark::State& state, const char* net) {
+    GEMMBenchmark(state, xnn_qs8_gemm_minmax_fp32_ukernel_1x16c8__avx512vnni, 1, 16, 8, 1,
+      xnn_init_qs8_conv_minmax_fp32_avx512_params, benchmark::utils::CheckAVX512VNNI);
+  }
+  static void qs8_gemm_2x16c8__avx512vnni(benchmark::State& state, const char* net) {
+    GEMMBenchmark(state, xnn_qs8_gemm_minmax_fp32_ukernel_2x16c8__avx512vnni, 2, 16, 8, 1,
+      xnn_init_qs8_conv_minmax_fp32_avx512_params, benchmark::utils::CheckAVX512VNNI);
+  }
+  static void qs8_gemm_3x16c8__avx512vnni(benchmark::State& state, const char* net) {
+    GEMMBenchmark(state, xnn_qs8_gemm_minmax_fp32_ukernel_3x16c8__avx512vnni, 3, 16, 8, 1,
+      xnn_init_qs8_conv_minmax_fp32_avx512_params, benchmark::utils::CheckAVX512VNNI);
+  }
+  static void qs8_gemm_4x16c8__avx512vnni(benchmark::State& state, const char* net) {
+    GEMMBenchmark(state, xnn_qs8_gemm_minmax_fp32_ukernel_4x16c8__avx512vnni, 4, 16, 8, 1,
+      xnn_init_qs8_conv_minmax_fp32_avx512_params, benchmark::utils::CheckAVX512VNNI);
+  }
+
   static void qs8_gemm_2x16c8__avx512skx(benchmark::State& state, const char* net) {
     GEMMBenchmark(state, xnn_qs8_gemm_minmax_fp32_ukernel_2x16c8__avx512skx, 2, 16, 8, 1,
       xnn_init_qs8_conv_minmax_fp32_avx512_params, benchmark::utils::CheckAVX512SKX);
@@ -1607,6 +1641,16 @@ static void ruy_st(benchmark::State& state, const char* net)
       xnn_init_qs8_conv_minmax_fp32_sse2_params, nullptr, true);
   }
 
+  BENCHMARK_GEMM(qs8_gemm_1x16c4__avx512vnni)
+  BENCHMARK_GEMM(qs8_gemm_2x16c4__avx512vnni)
+  BENCHMARK_GEMM(qs8_gemm_3x16c4__avx512vnni)
+  BENCHMARK_GEMM(qs8_gemm_4x16c4__avx512vnni)
+
+  BENCHMARK_GEMM(qs8_gemm_1x16c8__avx512vnni)
+  BENCHMARK_GEMM(qs8_gemm_2x16c8__avx512vnni)
+  BENCHMARK_GEMM(qs8_gemm_3x16c8__avx512vnni)
+  BENCHMARK_GEMM(qs8_gemm_4x16c8__avx512vnni)
+
   BENCHMARK_GEMM(qs8_gemm_2x16c8__avx512skx)
   BENCHMARK_GEMM(qs8_gemm_3x16c8__avx512skx)
   BENCHMARK_GEMM(qs8_gemm_4x16c8__avx512skx)
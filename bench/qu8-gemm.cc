@@ -583,6 +583,62 @@ static void ruy_st(benchmark::State& state, const char* net)
 
 
 #if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  static void qu8_gemm_1x16c4__avx512vnni(benchmark::State& state, const char* net) {
+    GEMMBenchmark(state,
+      xnn_qu8_gemm_minmax_fp32_ukernel_1x16c4__avx512vnni,
+      xnn_init_qu8_conv_minmax_fp32_avx512vnni_params,
+      1, 16, 4, 1,
+      benchmark::utils::CheckAVX512VNNI);
+  }
+  static void qu8_gemm_2x16c4__avx512vnni(benchmark::State& state, const char* net) {
+    GEMMBenchmark(state,
+      xnn_qu8_gemm_minmax_fp32_ukernel_2x16c4__avx512vnni,
+      xnn_init_qu8_conv_minmax_fp32_avx512vnni_params,
+      2, 16, 4, 1,
+      benchmark::utils::CheckAVX512VNNI);
+  }
+  static void qu8_gemm_3x16c4__avx512vnni(benchmark::State& state, const char* net) {
+    GEMMBenchmark(state,
+      xnn_qu8_gemm_minmax_fp32_ukernel_3x16c4__avx512vnni,
+      xnn_init_qu8_conv_minmax_fp32_avx512vnni_params,
+      3, 16, 4, 1,
+      benchmark::utils::CheckAVX512VNNI);
+  }
+  static void qu8_gemm_4x16c4__avx512vnni(benchmark::State& state, const char* net) {
+    GEMMBenchmark(state,
+      xnn_qu8_gemm_minmax_fp32_ukernel_4x16c4__avx512vnni,
+      xnn_init_qu8_conv_minmax_fp32_avx512vnni_params,
+      4, 16, 4, 1,
+      benchmark::utils::CheckAVX512VNNI);
+  }
+  static void qu8_gemm_1x16c8__avx512vnni(benchmark::State& state, const char* net) {
+    GEMMBenchmark(state,
+      xnn_qu8_gemm_minmax_fp32_ukernel_1x16c8__avx512vnni,
+      xnn_init_qu8_conv_minmax_fp32_avx512vnni_params,
+      1, 16, 8, 1,
+      benchmark::utils::CheckAVX512VNNI);
+  }
+  static void qu8_gemm_2x16c8__avx512vnni(benchmark::State& state, const char* net) {
+    GEMMBenchmark(state,
+      xnn_qu8_gemm_minmax_fp32_ukernel_2x16c8__avx512vnni,
+      xnn_init_qu8_conv_minmax_fp32_avx512vnni_params,
+      2, 16, 8, 1,
+      benchmark::utils::CheckAVX512VNNI);
+  }
+  static void qu8_gemm_3x16c8__avx512vnni(benchmark::State& state, const char* net) {
+    GEMMBenchmark(state,
+      xnn_qu8_gemm_minmax_fp32_ukernel_3x16c8__avx512vnni,
+      xnn_init_qu8_conv_minmax_fp32_avx512vnni_params,
+      3, 16, 8, 1,
+      benchmark::utils::CheckAVX512VNNI);
+  }
+  static void qu8_gemm_4x16c8__avx512vnni(benchmark::State& state, const char* net) {
+    GEMMBenchmark(state,
+      xnn_qu8_gemm_minmax_fp32_ukernel_4x16c8__avx512vnni,
+      xnn_init_qu8_conv_minmax_fp32_avx512vnni_params,
+      4, 16, 8, 1,
+      benchmark::utils::CheckAVX512VNNI);
+  }
   static void qu8_gemm_1x16c8__avx512skx(benchmark::State& state, const char* net) {
     GEMMBenchmark(state,
       xnn_qu8_gemm_minmax_fp32_ukernel_1x16c8__avx512skx,
@@ -1011,6 +1067,16 @@ static void ruy_st(benchmark::State& state, const char* net)
       3, 4, 8, 1);
   }
 
+  BENCHMARK_GEMM(qu8_gemm_1x16c4__avx512vnni)
+  BENCHMARK_GEMM(qu8_gemm_2x16c4__avx512vnni)
+  BENCHMARK_GEMM(qu8_gemm_3x16c4__avx512vnni)
+  BENCHMARK_GEMM(qu8_gemm_4x16c4__avx512vnni)
+
+  BENCHMARK_GEMM(qu8_gemm_1x16c8__avx512vnni)
+  BENCHMARK_GEMM(qu8_gemm_2x16c8__avx512vnni)
+  BENCHMARK_GEMM(qu8_gemm_3x16c8__avx512vnni)
+  BENCHMARK_GEMM(qu8_gemm_4x16c8__avx512vnni)
+
   BENCHMARK_GEMM(qu8_gemm_1x16c8__avx512skx)
   BENCHMARK_GEMM(qu8_gemm_2x16c8__avx512skx)
   BENCHMARK_GEMM(qu8_gemm_3x16c8__avx512skx)
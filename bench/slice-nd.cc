@@ -0,0 +1,182 @@
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <algorithm>
+#include <array>
+#include <functional>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include <xnnpack.h>
+
+#include <benchmark/benchmark.h>
+#include "bench/utils.h"
+
+
+// Slices [height, width, channels] input with unit strides along height and width, and the given stride along
+// channels, i.e. the innermost dimension.
+static void slice_nd_x8(benchmark::State& state) {
+  const size_t height = static_cast<size_t>(state.range(0));
+  const size_t width = static_cast<size_t>(state.range(1));
+  const size_t channels = static_cast<size_t>(state.range(2));
+  const size_t channel_stride = static_cast<size_t>(state.range(3));
+
+  const std::array<size_t, 3> input_shape = {{height, width, channels}};
+  const std::array<size_t, 3> offsets = {{0, 0, 0}};
+  const std::array<size_t, 3> sizes = {{height, width, (channels - 1) / channel_stride + 1}};
+  const std::array<size_t, 3> strides = {{1, 1, channel_stride}};
+  const size_t output_elements = sizes[0] * sizes[1] * sizes[2];
+
+  std::random_device random_device;
+  auto rng = std::mt19937(random_device());
+  auto u8rng = std::bind(std::uniform_int_distribution<uint32_t>(0, std::numeric_limits<uint8_t>::max()), std::ref(rng));
+
+  std::vector<uint8_t> input(XNN_EXTRA_BYTES / sizeof(uint8_t) + height * width * channels);
+  std::vector<uint8_t> output(output_elements);
+  std::generate(input.begin(), input.end(), std::ref(u8rng));
+
+  xnn_status status = xnn_initialize(nullptr /* allocator */);
+  if (status != xnn_status_success) {
+    state.SkipWithError("failed to initialize XNNPACK");
+    return;
+  }
+
+  xnn_operator_t slice_op = nullptr;
+  status = xnn_create_slice_nd_x8(0 /* flags */, &slice_op);
+  if (status != xnn_status_success || slice_op == nullptr) {
+    state.SkipWithError("failed to create X8 Slice operator");
+    return;
+  }
+
+  status = xnn_setup_slice_nd_x8(
+    slice_op,
+    input_shape.size(), input_shape.data(), offsets.data(), sizes.data(), strides.data(),
+    input.data(), output.data(),
+    nullptr /* thread pool */);
+  if (status != xnn_status_success) {
+    state.SkipWithError("failed to setup X8 Slice operator");
+    return;
+  }
+
+  for (auto _ : state) {
+    status = xnn_run_operator(slice_op, nullptr /* thread pool */);
+    if (status != xnn_status_success) {
+      state.SkipWithError("failed to run X8 Slice operator");
+      return;
+    }
+  }
+
+  status = xnn_delete_operator(slice_op);
+  if (status != xnn_status_success) {
+    state.SkipWithError("failed to delete X8 Slice operator");
+    return;
+  }
+
+  const uint64_t cpu_frequency = benchmark::utils::GetCurrentCpuFrequency();
+  if (cpu_frequency != 0) {
+    state.counters["cpufreq"] = cpu_frequency;
+  }
+
+  state.counters["elements"] =
+    benchmark::Counter(uint64_t(state.iterations()) * output_elements, benchmark::Counter::kIsRate);
+
+  const size_t bytes_per_iteration = 2 * output_elements * sizeof(uint8_t);
+  state.counters["bytes"] =
+    benchmark::Counter(uint64_t(state.iterations()) * bytes_per_iteration, benchmark::Counter::kIsRate);
+}
+
+static void slice_nd_x32(benchmark::State& state) {
+  const size_t height = static_cast<size_t>(state.range(0));
+  const size_t width = static_cast<size_t>(state.range(1));
+  const size_t channels = static_cast<size_t>(state.range(2));
+  const size_t channel_stride = static_cast<size_t>(state.range(3));
+
+  const std::array<size_t, 3> input_shape = {{height, width, channels}};
+  const std::array<size_t, 3> offsets = {{0, 0, 0}};
+  const std::array<size_t, 3> sizes = {{height, width, (channels - 1) / channel_stride + 1}};
+  const std::array<size_t, 3> strides = {{1, 1, channel_stride}};
+  const size_t output_elements = sizes[0] * sizes[1] * sizes[2];
+
+  std::random_device random_device;
+  auto rng = std::mt19937(random_device());
+  auto f32rng = std::bind(std::uniform_real_distribution<float>(), std::ref(rng));
+
+  std::vector<float> input(XNN_EXTRA_BYTES / sizeof(float) + height * width * channels);
+  std::vector<float> output(output_elements);
+  std::generate(input.begin(), input.end(), std::ref(f32rng));
+
+  xnn_status status = xnn_initialize(nullptr /* allocator */);
+  if (status != xnn_status_success) {
+    state.SkipWithError("failed to initialize XNNPACK");
+    return;
+  }
+
+  xnn_operator_t slice_op = nullptr;
+  status = xnn_create_slice_nd_x32(0 /* flags */, &slice_op);
+  if (status != xnn_status_success || slice_op == nullptr) {
+    state.SkipWithError("failed to create X32 Slice operator");
+    return;
+  }
+
+  status = xnn_setup_slice_nd_x32(
+    slice_op,
+    input_shape.size(), input_shape.data(), offsets.data(), sizes.data(), strides.data(),
+    input.data(), output.data(),
+    nullptr /* thread pool */);
+  if (status != xnn_status_success) {
+    state.SkipWithError("failed to setup X32 Slice operator");
+    return;
+  }
+
+  for (auto _ : state) {
+    status = xnn_run_operator(slice_op, nullptr /* thread pool */);
+    if (status != xnn_status_success) {
+      state.SkipWithError("failed to run X32 Slice operator");
+      return;
+    }
+  }
+
+  status = xnn_delete_operator(slice_op);
+  if (status != xnn_status_success) {
+    state.SkipWithError("failed to delete X32 Slice operator");
+    return;
+  }
+
+  const uint64_t cpu_frequency = benchmark::utils::GetCurrentCpuFrequency();
+  if (cpu_frequency != 0) {
+    state.counters["cpufreq"] = cpu_frequency;
+  }
+
+  state.counters["elements"] =
+    benchmark::Counter(uint64_t(state.iterations()) * output_elements, benchmark::Counter::kIsRate);
+
+  const size_t bytes_per_iteration = 2 * output_elements * sizeof(float);
+  state.counters["bytes"] =
+    benchmark::Counter(uint64_t(state.iterations()) * bytes_per_iteration, benchmark::Counter::kIsRate);
+}
+
+static void SliceArguments(benchmark::internal::Benchmark* b)
+{
+  b->ArgNames({"H", "W", "C", "CS"});
+
+  /*       H    W    C  CS */
+  // Contiguous innermost dimension: rows are copied by the micro-kernel.
+  b->Args({56,  56,  64, 1});
+  b->Args({14,  14, 256, 1});
+  // Strided innermost dimension: elements are gathered one by one.
+  b->Args({56,  56,  64, 2});
+  b->Args({14,  14, 256, 2});
+  b->Args({14,  14, 256, 3});
+  b->Args({ 7,   7, 512, 4});
+  b->Args({ 1, 128, 512, 2});
+}
+
+BENCHMARK(slice_nd_x8)->Apply(SliceArguments)->UseRealTime();
+BENCHMARK(slice_nd_x32)->Apply(SliceArguments)->UseRealTime();
+
+#ifndef XNNPACK_BENCHMARK_NO_MAIN
+BENCHMARK_MAIN();
+#endif
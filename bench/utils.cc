@@ -298,6 +298,18 @@ bool CheckAVX512SKX(benchmark::State& state) {
   return true;
 }
 
+bool CheckAVX512VNNI(benchmark::State& state) {
+  if (!cpuinfo_initialize() || !cpuinfo_has_x86_avx512f() ||
+      !cpuinfo_has_x86_avx512cd() || !cpuinfo_has_x86_avx512bw() ||
+      !cpuinfo_has_x86_avx512dq() || !cpuinfo_has_x86_avx512vl() ||
+      !cpuinfo_has_x86_avx512vnni())
+  {
+    state.SkipWithError("no AVX512 VNNI extensions");
+    return false;
+  }
+  return true;
+}
+
 CodeMemoryHelper::CodeMemoryHelper() {
   status = xnn_allocate_code_memory(&buffer, XNN_DEFAULT_CODE_BUFFER_SIZE);
 }
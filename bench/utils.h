@@ -140,6 +140,10 @@ bool CheckAVX512F(benchmark::State& state);
 // If SKX-level AVX512 extensions are unsupported, report error in benchmark state, and return false.
 bool CheckAVX512SKX(benchmark::State& state);
 
+// Check if x86 AVX512 VNNI extension, together with SKX-level AVX512 extensions, is supported.
+// If AVX512 VNNI extensions are unsupported, report error in benchmark state, and return false.
+bool CheckAVX512VNNI(benchmark::State& state);
+
 template <class T>
 inline T DivideRoundUp(T x, T q) {
   return x / q + T(x % q != 0);
@@ -0,0 +1,193 @@
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <functional>
+#include <memory>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include <cpuinfo.h>
+#include <pthreadpool.h>
+
+#include <benchmark/benchmark.h>
+#include <fp16/fp16.h>
+
+#include "bench/utils.h"
+#include <xnnpack/AlignedAllocator.h>
+#include <xnnpack/common.h>
+#include <xnnpack/math-stubs.h>
+
+
+struct ComputeErrorContext {
+  const float* input;
+  const float* output;
+  float* ulp_error;
+  float* abs_error;
+};
+
+static void ComputeError(
+  struct ComputeErrorContext* context,
+  size_t start,
+  size_t range)
+{
+  const float* input = context->input;
+  const float* output = context->output;
+  float* ulp_error = context->ulp_error;
+  float* abs_error = context->abs_error;
+  for (size_t i = start; i < start + range; i++) {
+    const double input_val = input[i];
+    // GELU(x) = 0.5 * x * (1 + erf(x / sqrt(2))) = 0.5 * x * erfc(-x / sqrt(2)), and the latter form doesn't suffer
+    // from cancellation for negative inputs.
+    const double output_ref = 0.5 * input_val * std::erfc(-input_val / std::sqrt(2.0));
+    const double abs_error_val = std::abs(output_ref - double(output[i]));
+    abs_error[i] = float(abs_error_val);
+    // For x < -1 the approximation computes GELU(x) as a difference of nearly equal numbers, and only the absolute
+    // error is meaningful there.
+    if (input_val >= -1.0) {
+      const float output_abs = std::abs(output_ref);
+      const float output_ulp = fp32_from_bits(fp32_to_bits(output_abs) + 1) - output_abs;
+      ulp_error[i] = float(abs_error_val / output_ulp);
+    } else {
+      ulp_error[i] = 0.0f;
+    }
+  }
+}
+
+static void GELUError(benchmark::State& state,
+  xnn_f32_unary_math_function gelu,
+  benchmark::utils::IsaCheckFunction isa_check = nullptr)
+{
+  if (!cpuinfo_initialize()) {
+    state.SkipWithError("failed cpuinfo init");
+    return;
+  }
+  if (isa_check && !isa_check(state)) {
+    return;
+  }
+
+  // The smallest x for which the rational approximation of erf(x / sqrt(2)) is evaluated (-0x1.7p+2f).
+  // Below this input GELU(x) is computed as exactly 0.
+  const uint32_t min_input = 0xC0B80000;
+  // The largest x for which the rational approximation of erf(x / sqrt(2)) is evaluated (0x1.7p+2f).
+  // Above this input GELU(x) is computed as exactly x.
+  const uint32_t max_input = 0x40B80000;
+  // Number of elements in one block of inputs/outputs.
+  // Combining multiple elements in a block reduce function call overhead.
+  const size_t block_size = 16384;
+  // Number of elements in one parallelization tile. Worker threads process this many elements in each task.
+  const size_t tile_size = 64;
+
+  uint32_t num_threads = cpuinfo_get_cores_count();
+  #if XNN_ARCH_ARM || XNN_ARCH_ARM64
+    // Use all cores except for the least performant cluster
+    if (cpuinfo_get_clusters_count() > 1) {
+      num_threads -= cpuinfo_get_cluster(cpuinfo_get_clusters_count() - 1)->core_count;
+    }
+  #endif  // XNN_ARCH_ARM || XNN_ARCH_ARM64
+
+  std::unique_ptr<pthreadpool, decltype(&pthreadpool_destroy)> threadpool(
+    pthreadpool_create(num_threads), pthreadpool_destroy);
+
+  std::vector<float, AlignedAllocator<float, 64>> x(block_size);
+  std::vector<float, AlignedAllocator<float, 64>> y(block_size);
+  std::vector<float> ulp_error(block_size);
+  std::vector<float> abs_error(block_size);
+  float max_ulp_error = 0.0f;
+  float max_abs_error = 0.0f;
+
+  ComputeErrorContext context;
+  context.input = x.data();
+  context.output = y.data();
+  context.ulp_error = ulp_error.data();
+  context.abs_error = abs_error.data();
+  for (auto _ : state) {
+    for (uint32_t n = min_input; int32_t(n) < 0; n -= block_size) {
+      for (uint32_t i = 0; i < block_size; i++) {
+        x[i] = fp32_from_bits(std::max<uint32_t>(n - i, 0x80000000));
+      }
+      std::fill(y.begin(), y.end(), std::nanf(""));
+
+      gelu(block_size * sizeof(float), x.data(), y.data());
+
+      pthreadpool_parallelize_1d_tile_1d(
+          threadpool.get(),
+          reinterpret_cast<pthreadpool_task_1d_tile_1d_t>(ComputeError),
+          static_cast<void*>(&context),
+          block_size, tile_size, 0 /* flags */);
+
+      max_ulp_error = std::accumulate(ulp_error.cbegin(), ulp_error.cend(), max_ulp_error,
+        static_cast<const float& (*)(const float&, const float&)>(std::max<float>));
+      max_abs_error = std::accumulate(abs_error.cbegin(), abs_error.cend(), max_abs_error,
+        static_cast<const float& (*)(const float&, const float&)>(std::max<float>));
+    }
+    for (uint32_t n = 0; n < max_input; n += block_size) {
+      for (uint32_t i = 0; i < block_size; i++) {
+        x[i] = fp32_from_bits(std::min<uint32_t>(n + i, max_input));
+      }
+      std::fill(y.begin(), y.end(), std::nanf(""));
+
+      gelu(block_size * sizeof(float), x.data(), y.data());
+
+      pthreadpool_parallelize_1d_tile_1d(
+          threadpool.get(),
+          reinterpret_cast<pthreadpool_task_1d_tile_1d_t>(ComputeError),
+          static_cast<void*>(&context),
+          block_size, tile_size, 0 /* flags */);
+
+      max_ulp_error = std::accumulate(ulp_error.cbegin(), ulp_error.cend(), max_ulp_error,
+        static_cast<const float& (*)(const float&, const float&)>(std::max<float>));
+      max_abs_error = std::accumulate(abs_error.cbegin(), abs_error.cend(), max_abs_error,
+        static_cast<const float& (*)(const float&, const float&)>(std::max<float>));
+    }
+  }
+
+  state.counters["ULPERROR"] = benchmark::Counter(max_ulp_error);
+  state.counters["ABSERROR"] = benchmark::Counter(max_abs_error);
+}
+
+#if XNN_ARCH_ARM || XNN_ARCH_ARM64
+  BENCHMARK_CAPTURE(GELUError, neon_rational_13_8_nr2recps,
+                    xnn_math_f32_gelu__neon_rational_13_8_nr2recps,
+                    benchmark::utils::CheckNEON)
+    ->Unit(benchmark::kMillisecond)
+    ->Iterations(1);
+#endif  // XNN_ARCH_ARM || XNN_ARCH_ARM64
+
+#if XNN_ARCH_ARM64
+  BENCHMARK_CAPTURE(GELUError, neonfma_rational_13_8_div,
+                    xnn_math_f32_gelu__neonfma_rational_13_8_div)
+    ->Unit(benchmark::kMillisecond)
+    ->Iterations(1);
+#endif  // XNN_ARCH_ARM64
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  BENCHMARK_CAPTURE(GELUError, avx512f_rational_13_8_div,
+                    xnn_math_f32_gelu__avx512f_rational_13_8_div,
+                    benchmark::utils::CheckAVX512F)
+    ->Unit(benchmark::kMillisecond)
+    ->Iterations(1);
+  BENCHMARK_CAPTURE(GELUError, avx2_rational_13_8_div,
+                    xnn_math_f32_gelu__avx2_rational_13_8_div,
+                    benchmark::utils::CheckAVX2)
+    ->Unit(benchmark::kMillisecond)
+    ->Iterations(1);
+  BENCHMARK_CAPTURE(GELUError, sse2_rational_13_8_div,
+                    xnn_math_f32_gelu__sse2_rational_13_8_div)
+    ->Unit(benchmark::kMillisecond)
+    ->Iterations(1);
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+BENCHMARK_CAPTURE(GELUError, scalar_rational_13_8_div,
+                  xnn_math_f32_gelu__scalar_rational_13_8_div)
+  ->Unit(benchmark::kMillisecond)
+  ->Iterations(1);
+
+#ifndef XNNPACK_BENCHMARK_NO_MAIN
+BENCHMARK_MAIN();
+#endif
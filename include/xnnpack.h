@@ -38,6 +38,9 @@ extern "C" {
 /// Assume transposed weights in a fully connected operator.
 #define XNN_FLAG_TRANSPOSE_WEIGHTS 0x00000001
 
+/// Assume transposed second input in a batch matrix multiplication operator.
+#define XNN_FLAG_TRANSPOSE_B XNN_FLAG_TRANSPOSE_WEIGHTS
+
 /// The operator assumes NHWC layout for the input, regardless of the output layout.
 #define XNN_FLAG_INPUT_NHWC 0x00000002
 
@@ -59,6 +62,16 @@ extern "C" {
 /// Yield worker threads of the thread pool to the system scheduler after the inference.
 #define XNN_FLAG_YIELD_WORKERS 0x00000010
 
+/// Collect per-operator timing and memory traffic in a Runtime. See @ref xnn_get_runtime_profiling_info.
+#define XNN_FLAG_BASIC_PROFILING 0x00000020
+
+/// Allow a Runtime to run independent operators concurrently, each on a single thread of the thread pool.
+#define XNN_FLAG_INTER_OP_PARALLELISM 0x00000040
+
+/// Plan the workspace of a Runtime with the greedy-by-size strategy. It packs tensors with disjoint lifetimes tighter
+/// than the default strategy, and scales better to graphs with many tensors.
+#define XNN_FLAG_GREEDY_BY_SIZE_MEMORY_PLANNING 0x00000080
+
 /// Status code for any XNNPACK function call.
 enum xnn_status {
   /// The call succeeded, and all output arguments now contain valid data.
@@ -187,6 +200,8 @@ enum xnn_datatype {
   xnn_datatype_qcint8 = 6,
   /// Quantized 32-bit signed integer with shared per-channel quantization parameters.
   xnn_datatype_qcint32 = 7,
+  /// 32-bit signed integer, such as indices of the Gather Node.
+  xnn_datatype_int32 = 8,
 };
 
 /// Define a tensor-type Value and add it to a Subgraph.
@@ -582,6 +597,30 @@ enum xnn_status xnn_define_fully_connected(
   uint32_t output_id,
   uint32_t flags);
 
+/// Define a Batch Matrix Multiply Node and add it to a Subgraph.
+///
+/// The Batch Matrix Multiply Node multiplies matrices in the two innermost dimensions of its inputs, and both inputs
+/// may be computed at runtime.
+///
+/// @param subgraph - a Subgraph object that will own the created Node.
+/// @param input1_id - Value ID for the first input tensor. The input tensor must be an N-dimensional tensor defined in
+///                    the @a subgraph with [..., M, K] dimensions, where N >= 2.
+/// @param input2_id - Value ID for the second input tensor. The input tensor must be an N-dimensional tensor defined
+///                    in the @a subgraph with the same leading (batch) dimensions as the first input. If the
+///                    XNN_FLAG_TRANSPOSE_B flag is not specified, the second input must have [..., K, N] dimensions.
+///                    If the XNN_FLAG_TRANSPOSE_B flag is specified, the second input must have [..., N, K]
+///                    dimensions.
+/// @param output_id - Value ID for the output tensor. The output tensor must be an N-dimensional tensor defined in the
+///                    @a subgraph with the same leading (batch) dimensions as the inputs, and [..., M, N] dimensions.
+/// @param flags - binary features of the Batch Matrix Multiply Node. The only currently supported value is
+///                XNN_FLAG_TRANSPOSE_B.
+enum xnn_status xnn_define_batch_matrix_multiply(
+  xnn_subgraph_t subgraph,
+  uint32_t input1_id,
+  uint32_t input2_id,
+  uint32_t output_id,
+  uint32_t flags);
+
 /// Define a 2D Max Pooling Node and add it to a Subgraph.
 ///
 /// @param subgraph - a Subgraph object that will own the created Node.
@@ -872,6 +911,195 @@ enum xnn_status xnn_define_squared_difference(
   uint32_t output_id,
   uint32_t flags);
 
+/// Define a 2-Input Concatenate Node and add it to a Subgraph.
+///
+/// The 2-Input Concatenate Node concatenates two tensors along a specified axis. When all dimensions before the axis
+/// are 1 and the input tensors are internal to the Runtime, their producers write directly into the output tensor, and
+/// the Node doesn't copy any data.
+///
+/// @param subgraph - a Subgraph object that will own the created Node.
+/// @param axis - the axis to concatenate the two input tensors along.
+/// @param input1_id - Value ID for the first input tensor. The input tensor must be an N-dimensional tensor defined in
+///                    the @a subgraph with each dimension, except the axis, equal to the corresponding dimension of the
+///                    second input.
+/// @param input2_id - Value ID for the second input tensor. The input tensor must be an N-dimensional tensor defined in
+///                    the @a subgraph with each dimension, except the axis, equal to the corresponding dimension of the
+///                    first input.
+/// @param output_id - Value ID for the output tensor. The output tensor must be a N-dimensional tensor defined
+///                    in the @a subgraph with each dimension equal to the dimension of both inputs, except the axis
+///                    dimension, where it is the sum of the corresponding dimensions of both inputs.
+/// @param flags - binary features of the Concatenate Node. No supported flags are currently defined.
+enum xnn_status xnn_define_concatenate2(
+  xnn_subgraph_t subgraph,
+  size_t axis,
+  uint32_t input1_id,
+  uint32_t input2_id,
+  uint32_t output_id,
+  uint32_t flags);
+
+/// Define a 3-Input Concatenate Node and add it to a Subgraph.
+///
+/// @param subgraph - a Subgraph object that will own the created Node.
+/// @param axis - the axis to concatenate the three input tensors along.
+/// @param input1_id - Value ID for the first input tensor. The input tensor must be an N-dimensional tensor defined in
+///                    the @a subgraph with each dimension, except the axis, equal to the corresponding dimension of the
+///                    other inputs.
+/// @param input2_id - Value ID for the second input tensor. The input tensor must be an N-dimensional tensor defined in
+///                    the @a subgraph with each dimension, except the axis, equal to the corresponding dimension of the
+///                    other inputs.
+/// @param input3_id - Value ID for the third input tensor. The input tensor must be an N-dimensional tensor defined in
+///                    the @a subgraph with each dimension, except the axis, equal to the corresponding dimension of the
+///                    other inputs.
+/// @param output_id - Value ID for the output tensor. The output tensor must be a N-dimensional tensor defined
+///                    in the @a subgraph with each dimension equal to the dimension of all inputs, except the axis
+///                    dimension, where it is the sum of the corresponding dimensions of all inputs.
+/// @param flags - binary features of the Concatenate Node. No supported flags are currently defined.
+enum xnn_status xnn_define_concatenate3(
+  xnn_subgraph_t subgraph,
+  size_t axis,
+  uint32_t input1_id,
+  uint32_t input2_id,
+  uint32_t input3_id,
+  uint32_t output_id,
+  uint32_t flags);
+
+/// Define a 4-Input Concatenate Node and add it to a Subgraph.
+///
+/// @param subgraph - a Subgraph object that will own the created Node.
+/// @param axis - the axis to concatenate the four input tensors along.
+/// @param input1_id - Value ID for the first input tensor. The input tensor must be an N-dimensional tensor defined in
+///                    the @a subgraph with each dimension, except the axis, equal to the corresponding dimension of the
+///                    other inputs.
+/// @param input2_id - Value ID for the second input tensor. The input tensor must be an N-dimensional tensor defined in
+///                    the @a subgraph with each dimension, except the axis, equal to the corresponding dimension of the
+///                    other inputs.
+/// @param input3_id - Value ID for the third input tensor. The input tensor must be an N-dimensional tensor defined in
+///                    the @a subgraph with each dimension, except the axis, equal to the corresponding dimension of the
+///                    other inputs.
+/// @param input4_id - Value ID for the fourth input tensor. The input tensor must be an N-dimensional tensor defined in
+///                    the @a subgraph with each dimension, except the axis, equal to the corresponding dimension of the
+///                    other inputs.
+/// @param output_id - Value ID for the output tensor. The output tensor must be a N-dimensional tensor defined
+///                    in the @a subgraph with each dimension equal to the dimension of all inputs, except the axis
+///                    dimension, where it is the sum of the corresponding dimensions of all inputs.
+/// @param flags - binary features of the Concatenate Node. No supported flags are currently defined.
+enum xnn_status xnn_define_concatenate4(
+  xnn_subgraph_t subgraph,
+  size_t axis,
+  uint32_t input1_id,
+  uint32_t input2_id,
+  uint32_t input3_id,
+  uint32_t input4_id,
+  uint32_t output_id,
+  uint32_t flags);
+
+/// Define a 2-Output Even Split Node and add it to a Subgraph.
+///
+/// The 2-Output Even Split Node splits an input tensor into two output tensors along a specified axis evenly. When all
+/// dimensions before the axis are 1 and the tensors are internal to the Runtime, the outputs are views into the memory
+/// of the input, and the Node doesn't copy any data.
+///
+/// @param subgraph - a Subgraph object that will own the created Node.
+/// @param split_dim - the axis to split the input tensor along.
+/// @param input_id - Value ID for the input tensor. The input tensor must be an N-dimensional tensor defined in the
+///                   @a subgraph, with the @a split_dim dimension divisible by 2.
+/// @param output1_id - Value ID for the first output tensor. The output tensor must be an N-dimensional tensor defined
+///                     in the @a subgraph with each dimension, except the @a split_dim, equal to the corresponding
+///                     dimension of the input, and the @a split_dim dimension equal to 1/2 of the input one.
+/// @param output2_id - Value ID for the second output tensor. The output tensor must be an N-dimensional tensor defined
+///                     in the @a subgraph with each dimension, except the @a split_dim, equal to the corresponding
+///                     dimension of the input, and the @a split_dim dimension equal to 1/2 of the input one.
+/// @param flags - binary features of the Even Split Node. No supported flags are currently defined.
+enum xnn_status xnn_define_even_split2(
+  xnn_subgraph_t subgraph,
+  size_t split_dim,
+  uint32_t input_id,
+  uint32_t output1_id,
+  uint32_t output2_id,
+  uint32_t flags);
+
+/// Define a 3-Output Even Split Node and add it to a Subgraph.
+///
+/// @param subgraph - a Subgraph object that will own the created Node.
+/// @param split_dim - the axis to split the input tensor along.
+/// @param input_id - Value ID for the input tensor. The input tensor must be an N-dimensional tensor defined in the
+///                   @a subgraph, with the @a split_dim dimension divisible by 3.
+/// @param output1_id - Value ID for the first output tensor. The output tensor must be an N-dimensional tensor defined
+///                     in the @a subgraph with each dimension, except the @a split_dim, equal to the corresponding
+///                     dimension of the input, and the @a split_dim dimension equal to 1/3 of the input one.
+/// @param output2_id - Value ID for the second output tensor. The output tensor must be an N-dimensional tensor defined
+///                     in the @a subgraph with each dimension, except the @a split_dim, equal to the corresponding
+///                     dimension of the input, and the @a split_dim dimension equal to 1/3 of the input one.
+/// @param output3_id - Value ID for the third output tensor. The output tensor must be an N-dimensional tensor defined
+///                     in the @a subgraph with each dimension, except the @a split_dim, equal to the corresponding
+///                     dimension of the input, and the @a split_dim dimension equal to 1/3 of the input one.
+/// @param flags - binary features of the Even Split Node. No supported flags are currently defined.
+enum xnn_status xnn_define_even_split3(
+  xnn_subgraph_t subgraph,
+  size_t split_dim,
+  uint32_t input_id,
+  uint32_t output1_id,
+  uint32_t output2_id,
+  uint32_t output3_id,
+  uint32_t flags);
+
+/// Define a 4-Output Even Split Node and add it to a Subgraph.
+///
+/// @param subgraph - a Subgraph object that will own the created Node.
+/// @param split_dim - the axis to split the input tensor along.
+/// @param input_id - Value ID for the input tensor. The input tensor must be an N-dimensional tensor defined in the
+///                   @a subgraph, with the @a split_dim dimension divisible by 4.
+/// @param output1_id - Value ID for the first output tensor. The output tensor must be an N-dimensional tensor defined
+///                     in the @a subgraph with each dimension, except the @a split_dim, equal to the corresponding
+///                     dimension of the input, and the @a split_dim dimension equal to 1/4 of the input one.
+/// @param output2_id - Value ID for the second output tensor. The output tensor must be an N-dimensional tensor defined
+///                     in the @a subgraph with each dimension, except the @a split_dim, equal to the corresponding
+///                     dimension of the input, and the @a split_dim dimension equal to 1/4 of the input one.
+/// @param output3_id - Value ID for the third output tensor. The output tensor must be an N-dimensional tensor defined
+///                     in the @a subgraph with each dimension, except the @a split_dim, equal to the corresponding
+///                     dimension of the input, and the @a split_dim dimension equal to 1/4 of the input one.
+/// @param output4_id - Value ID for the fourth output tensor. The output tensor must be an N-dimensional tensor defined
+///                     in the @a subgraph with each dimension, except the @a split_dim, equal to the corresponding
+///                     dimension of the input, and the @a split_dim dimension equal to 1/4 of the input one.
+/// @param flags - binary features of the Even Split Node. No supported flags are currently defined.
+enum xnn_status xnn_define_even_split4(
+  xnn_subgraph_t subgraph,
+  size_t split_dim,
+  uint32_t input_id,
+  uint32_t output1_id,
+  uint32_t output2_id,
+  uint32_t output3_id,
+  uint32_t output4_id,
+  uint32_t flags);
+
+/// Define a Gather Node and add it to a Subgraph.
+///
+/// The Node selects slices of the input tensor along the @a axis dimension, in the order given by the indices tensor.
+///
+/// @param subgraph - a Subgraph object that will own the created Node.
+/// @param axis - the dimension of the input tensor that the indices select along.
+/// @param input_id - Value ID for the input tensor. The input tensor must be an N-dimensional tensor defined in the
+///                   @a subgraph with N greater than @a axis.
+/// @param indices_id - Value ID for the indices tensor. The indices tensor must be an M-dimensional tensor of
+///                     xnn_datatype_int32 elements defined in the @a subgraph. Every index must be in the
+///                     [0, input dimension along @a axis) range. Static indices out of this range are rejected
+///                     when the Runtime is set up, and dynamic indices out of this range make the Runtime invocation
+///                     fail with xnn_status_invalid_parameter before the Node runs.
+/// @param output_id - Value ID for the output tensor. The output tensor must be an (N + M - 1)-dimensional tensor
+///                    defined in the @a subgraph with the dimensions of the input tensor before @a axis, followed by
+///                    the dimensions of the indices tensor, followed by the dimensions of the input tensor after
+///                    @a axis. If the input tensor is quantized, the output tensor must have either the same datatype
+///                    and quantization parameters, or the FP32 datatype, in which case the gathered elements are
+///                    dequantized.
+/// @param flags - binary features of the Gather Node. No supported flags are currently defined.
+enum xnn_status xnn_define_gather(
+  xnn_subgraph_t subgraph,
+  size_t axis,
+  uint32_t input_id,
+  uint32_t indices_id,
+  uint32_t output_id,
+  uint32_t flags);
+
 /// Define a Constant Pad Node with static padding specification and add it to a Subgraph.
 ///
 /// @param subgraph - a Subgraph object that will own the created Node.
@@ -893,6 +1121,34 @@ enum xnn_status xnn_define_static_constant_pad(
   uint32_t output_id,
   uint32_t flags);
 
+/// Define a Slice Node with static slice specification and add it to a Subgraph.
+///
+/// The Node copies every @a strides[i]-th element, starting at @a offsets[i], along each dimension i of the input. If
+/// the selected elements are contiguous in the input, the output may share memory with the input, and the Node runs
+/// without copying anything.
+///
+/// @param subgraph - a Subgraph object that will own the created Node.
+/// @param num_dims - number of dimensions in the input and output tensors.
+/// @param offsets - index of the first selected element for every dimension. This array must have @a num_dims
+///                  elements.
+/// @param sizes - number of selected elements for every dimension. This array must have @a num_dims elements.
+/// @param strides - distance between selected elements for every dimension. This array must have @a num_dims
+///                  elements, or be NULL to select adjacent elements.
+/// @param input_id - Value ID for the input tensor. The input tensor must be an N-dimensional tensor defined in the
+///                   @a subgraph.
+/// @param output_id - Value ID for the output tensor. The output tensor must be an N-dimensional tensor defined in the
+///                    @a subgraph with dimensions specified by @a sizes.
+/// @param flags - binary features of the Slice Node. No supported flags are currently defined.
+enum xnn_status xnn_define_static_slice(
+  xnn_subgraph_t subgraph,
+  size_t num_dims,
+  const size_t* offsets,
+  const size_t* sizes,
+  const size_t* strides,
+  uint32_t input_id,
+  uint32_t output_id,
+  uint32_t flags);
+
 /// Define a Reshape Node with static shape specification and add it to a Subgraph.
 ///
 /// @param subgraph - a Subgraph object that will own the created Node.
@@ -910,6 +1166,26 @@ enum xnn_status xnn_define_static_reshape(
   uint32_t output_id,
   uint32_t flags);
 
+/// Define a Transpose Node with static permutation specification and add it to a Subgraph.
+///
+/// @param subgraph - a Subgraph object that will own the created Node.
+/// @param num_dims - number of dimensions in the input and output tensors.
+/// @param perm - permutation of the input dimensions: dimension i of the output tensor is dimension perm[i] of the
+///               input tensor. This array must have @a num_dims elements, and every value in [0, num_dims-1] must
+///               appear in it exactly once.
+/// @param input_id - Value ID for the input tensor. The input tensor must be an N-dimensional tensor defined in the
+///                   @a subgraph.
+/// @param output_id - Value ID for the output tensor. The output tensor must be an N-dimensional tensor defined in
+///                    the @a subgraph with the input dimensions permuted according to @a perm.
+/// @param flags - binary features of the Transpose Node. No supported flags are currently defined.
+enum xnn_status xnn_define_static_transpose(
+  xnn_subgraph_t subgraph,
+  size_t num_dims,
+  const size_t* perm,
+  uint32_t input_id,
+  uint32_t output_id,
+  uint32_t flags);
+
 /// Define a 2D Resize Bilinear Node with static output height & width specification and add it to a Subgraph.
 ///
 /// @param subgraph - a Subgraph object that will own the created Node.
@@ -1030,6 +1306,21 @@ enum xnn_status xnn_define_floor(
   uint32_t output_id,
   uint32_t flags);
 
+/// Define a GELU Node and add it to a Subgraph.
+///
+/// The Node computes the exact (erf-based) Gaussian Error Linear Unit: y = 0.5 * x * (1 + erf(x / sqrt(2))).
+///
+/// @param subgraph - a Subgraph object that will own the created Node.
+/// @param input_id - Value ID for the input tensor. The input tensor must be defined in the @a subgraph.
+/// @param output_id - Value ID for the output tensor. The output tensor must be defined in the @a subgraph, and its
+///                    shape must match the shape of the input tensor.
+/// @param flags - binary features of the GELU Node. No supported flags are currently defined.
+enum xnn_status xnn_define_gelu(
+  xnn_subgraph_t subgraph,
+  uint32_t input_id,
+  uint32_t output_id,
+  uint32_t flags);
+
 /// Define a HardSwish Node and add it to a Subgraph.
 ///
 /// @param subgraph - a Subgraph object that will own the created Node.
@@ -1043,6 +1334,31 @@ enum xnn_status xnn_define_hardswish(
   uint32_t output_id,
   uint32_t flags);
 
+/// Define a Layer Normalization Node and add it to a Subgraph.
+///
+/// The Node normalizes the input across its innermost dimension to zero mean and unit variance, and then applies a
+/// per-channel scale and shift: y = (x - mean(x)) / sqrt(variance(x) + epsilon) * gamma + beta.
+///
+/// @param subgraph - a Subgraph object that will own the created Node.
+/// @param epsilon - small positive value added to the variance for numerical stability.
+/// @param input_id - Value ID for the input tensor. The input tensor must be defined in the @a subgraph, and have at
+///                   least one dimension. The last dimension of the input tensor is normalized.
+/// @param gamma_id - Value ID for the scale tensor. The scale tensor must be a static 1D tensor defined in the
+///                   @a subgraph with [channels] dimensions, where channels is the last dimension of the input tensor.
+/// @param beta_id - Value ID for the shift tensor. The shift tensor must be a static 1D tensor defined in the
+///                  @a subgraph with [channels] dimensions, where channels is the last dimension of the input tensor.
+/// @param output_id - Value ID for the output tensor. The output tensor must be defined in the @a subgraph, and its
+///                    shape must match the shape of the input tensor.
+/// @param flags - binary features of the Layer Normalization Node. No supported flags are currently defined.
+enum xnn_status xnn_define_layer_normalization(
+  xnn_subgraph_t subgraph,
+  float epsilon,
+  uint32_t input_id,
+  uint32_t gamma_id,
+  uint32_t beta_id,
+  uint32_t output_id,
+  uint32_t flags);
+
 /// Define a Leaky ReLU Node and add it to a Subgraph.
 ///
 /// @param subgraph - a Subgraph object that will own the created Node.
@@ -1124,6 +1440,71 @@ enum xnn_status xnn_define_square_root(
   uint32_t output_id,
   uint32_t flags);
 
+/// Define a Tanh Node and add it to a Subgraph.
+///
+/// @param subgraph - a Subgraph object that will own the created Node.
+/// @param input_id - Value ID for the input tensor. The input tensor must be defined in the @a subgraph.
+/// @param output_id - Value ID for the output tensor. The output tensor must be defined in the @a subgraph, and its
+///                    shape must match the shape of the input tensor.
+/// @param flags - binary features of the Tanh Node. No supported flags are currently defined.
+enum xnn_status xnn_define_tanh(
+  xnn_subgraph_t subgraph,
+  uint32_t input_id,
+  uint32_t output_id,
+  uint32_t flags);
+
+/// Weights cache shares packed weights between operators created from the same static weights, e.g. between
+/// multiple Runtime objects created from the same model.
+typedef struct xnn_weights_cache* xnn_weights_cache_t;
+
+/// Create a weights cache object.
+///
+/// Packed weights are looked up by the address of the static weights they were packed from, together with the data
+/// type, shape, and packing layout. The static weights must not change while the weights cache exists.
+/// Weights cache is thread-safe: Runtime objects can be created and destroyed concurrently with the same cache.
+///
+/// @param weights_cache_out - pointer to the variable that will be initialized with a handle to the weights cache
+///                            object upon successful return.
+enum xnn_status xnn_create_weights_cache(
+  xnn_weights_cache_t* weights_cache_out);
+
+/// Destroy a weights cache object.
+///
+/// Packed weights still used by Runtime objects are released once all these Runtime objects are destroyed.
+///
+/// @param weights_cache - the weights cache object to destroy.
+enum xnn_status xnn_delete_weights_cache(
+  xnn_weights_cache_t weights_cache);
+
+/// Save packed weights in a weights cache object to a file.
+///
+/// The file records the GEMM microkernel parameters of the running CPU, and can be loaded with
+/// @ref xnn_create_weights_cache_from_file in another process on a CPU that selects the same GEMM microkernel
+/// parameters. Static weights which packed weights in the weights cache were packed from must still be alive, as their
+/// contents are hashed to identify them in the file.
+///
+/// @param weights_cache - the weights cache object to save.
+/// @param filename - path of the file to create or overwrite.
+enum xnn_status xnn_save_weights_cache(
+  xnn_weights_cache_t weights_cache,
+  const char* filename);
+
+/// Create a weights cache object from a file written by @ref xnn_save_weights_cache.
+///
+/// The file is memory-mapped, and operators reference packed weights in the file without copying them, so processes
+/// which load the same file share its pages. Packed weights from the file are matched to static weights by data type,
+/// shape, packing layout, and a hash of the static weights' contents. Packed weights for static weights not found in
+/// the file are packed in memory as in a weights cache created with @ref xnn_create_weights_cache. The file must not
+/// be modified while the weights cache or any Runtime object created with it exists.
+///
+/// @param filename - path of the weights cache file.
+/// @param weights_cache_out - pointer to the variable that will be initialized with a handle to the weights cache
+///                            object upon successful return. Returns xnn_status_unsupported_hardware if the file was
+///                            created on a CPU with different GEMM microkernel parameters.
+enum xnn_status xnn_create_weights_cache_from_file(
+  const char* filename,
+  xnn_weights_cache_t* weights_cache_out);
+
 /// Runtime is a combination of an execution plan for subgraph Nodes and a memory manager for subgraph Values.
 typedef struct xnn_runtime* xnn_runtime_t;
 
@@ -1133,9 +1514,19 @@ typedef struct xnn_runtime* xnn_runtime_t;
 ///                   Nodes can be added to the runtime once it is constructed.
 /// @param threadpool - the thread pool to be used for parallelisation of computations in the runtime. If the thread
 ///                     pool is NULL, the computation would run on the caller thread without parallelization.
-/// @param flags - binary features of the runtime. The only currently supported values are XNN_FLAG_SPARSE_INFERENCE
-///                and XNN_FLAG_YIELD_WORKERS. If XNN_FLAG_YIELD_WORKERS is specified, worker threads would be yielded
-///                to the system scheduler after processing the last operator in the Runtime.
+/// @param flags - binary features of the runtime. The only currently supported values are XNN_FLAG_SPARSE_INFERENCE,
+///                XNN_FLAG_YIELD_WORKERS, XNN_FLAG_BASIC_PROFILING, XNN_FLAG_INTER_OP_PARALLELISM, and
+///                XNN_FLAG_GREEDY_BY_SIZE_MEMORY_PLANNING. If
+///                XNN_FLAG_YIELD_WORKERS is specified, worker threads would be yielded to the system scheduler after
+///                processing the last operator in the Runtime. If XNN_FLAG_BASIC_PROFILING is specified, the Runtime
+///                records per-operator timing on every invocation, which can be queried with
+///                @ref xnn_get_runtime_profiling_info. If XNN_FLAG_INTER_OP_PARALLELISM is specified, and the thread
+///                pool has more than one thread, small operators that don't depend on each other are dispatched
+///                concurrently, each on a single thread, and the workspace is planned for their overlapping
+///                lifetimes. XNN_FLAG_INTER_OP_PARALLELISM is ignored when XNN_FLAG_BASIC_PROFILING is specified. If
+///                XNN_FLAG_GREEDY_BY_SIZE_MEMORY_PLANNING is specified, the workspace is planned with the greedy-by-size
+///                strategy, which places larger Values first and fills gaps between Values with overlapping lifetimes.
+///                The planned size and its lower bound can be queried with @ref xnn_get_runtime_workspace_size.
 /// @param runtime_out - pointer to the variable that will be initialized with a handle to the Runtime object upon
 ///                      successful return. Once constructed, the Runtime object is independent of the Subgraph object
 ///                      used to create it.
@@ -1145,6 +1536,73 @@ enum xnn_status xnn_create_runtime_v2(
   uint32_t flags,
   xnn_runtime_t* runtime_out);
 
+/// Create a Runtime object from a subgraph, sharing packed weights through a weights cache.
+///
+/// @param subgraph - a Subgraph object with all Values and Nodes that would be handled by the runtime. No Values or
+///                   Nodes can be added to the runtime once it is constructed.
+/// @param weights_cache - a weights cache object to look up and store packed weights of Convolution, Depthwise
+///                        Convolution, and Fully Connected Nodes with static weights. If the weights cache is NULL,
+///                        the Runtime packs its own copy of the weights, as in @ref xnn_create_runtime_v2.
+/// @param threadpool - the thread pool to be used for parallelisation of computations in the runtime. If the thread
+///                     pool is NULL, the computation would run on the caller thread without parallelization.
+/// @param flags - binary features of the runtime. Supported values are the same as in @ref xnn_create_runtime_v2,
+///                including XNN_FLAG_GREEDY_BY_SIZE_MEMORY_PLANNING.
+/// @param runtime_out - pointer to the variable that will be initialized with a handle to the Runtime object upon
+///                      successful return. Once constructed, the Runtime object is independent of the Subgraph object
+///                      used to create it, and can outlive the weights cache object.
+enum xnn_status xnn_create_runtime_v3(
+  xnn_subgraph_t subgraph,
+  xnn_weights_cache_t weights_cache,
+  pthreadpool_t threadpool,
+  uint32_t flags,
+  xnn_runtime_t* runtime_out);
+
+/// Workspace is a memory arena for intermediate tensors, which can be shared by multiple Runtime objects.
+typedef struct xnn_workspace* xnn_workspace_t;
+
+/// Create a workspace object.
+///
+/// The workspace is allocated lazily, and grows to the largest requirement of Runtime objects bound to it. Runtime
+/// objects sharing a workspace must not be invoked concurrently. When a Runtime object grows the workspace in
+/// @ref xnn_create_runtime_v4 or @ref xnn_reshape_runtime, other Runtime objects bound to the workspace must be set up
+/// again with @ref xnn_setup_runtime before they are invoked.
+///
+/// @param workspace_out - pointer to the variable that will be initialized with a handle to the workspace object upon
+///                        successful return.
+enum xnn_status xnn_create_workspace(
+  xnn_workspace_t* workspace_out);
+
+/// Release a reference to a workspace object.
+///
+/// The memory of the workspace is freed after the workspace object and all Runtime objects bound to it are released.
+///
+/// @param workspace - the workspace object to release.
+enum xnn_status xnn_release_workspace(
+  xnn_workspace_t workspace);
+
+/// Create a Runtime object from a subgraph, with intermediate tensors in a workspace shared with other Runtime objects.
+///
+/// @param subgraph - a Subgraph object with all Values and Nodes that would be handled by the runtime. No Values or
+///                   Nodes can be added to the runtime once it is constructed.
+/// @param weights_cache - a weights cache object to look up and store packed weights, or NULL, as in
+///                        @ref xnn_create_runtime_v3.
+/// @param workspace - a workspace object to allocate intermediate tensors in. If the workspace is NULL, the Runtime
+///                    allocates a workspace of its own.
+/// @param threadpool - the thread pool to be used for parallelisation of computations in the runtime. If the thread
+///                     pool is NULL, the computation would run on the caller thread without parallelization.
+/// @param flags - binary features of the runtime. Supported values are the same as in @ref xnn_create_runtime_v2,
+///                including XNN_FLAG_GREEDY_BY_SIZE_MEMORY_PLANNING.
+/// @param runtime_out - pointer to the variable that will be initialized with a handle to the Runtime object upon
+///                      successful return. Once constructed, the Runtime object is independent of the Subgraph object
+///                      used to create it, and keeps the workspace alive until the Runtime object is deleted.
+enum xnn_status xnn_create_runtime_v4(
+  xnn_subgraph_t subgraph,
+  xnn_weights_cache_t weights_cache,
+  xnn_workspace_t workspace,
+  pthreadpool_t threadpool,
+  uint32_t flags,
+  xnn_runtime_t* runtime_out);
+
 enum xnn_status xnn_create_runtime(
   xnn_subgraph_t subgraph,
   xnn_runtime_t* runtime_out);
@@ -1154,6 +1612,64 @@ struct xnn_external_value {
   void* data;
 };
 
+/// Change the shape of an external input Value in a Runtime object.
+///
+/// The new shape takes effect in the next call to @ref xnn_reshape_runtime, which must precede the next call to
+/// @ref xnn_setup_runtime. Until then, @ref xnn_setup_runtime and @ref xnn_invoke_runtime fail with
+/// xnn_status_invalid_state.
+///
+/// @param runtime - a Runtime object created with @ref xnn_create_runtime, @ref xnn_create_runtime_v2, or
+///                  @ref xnn_create_runtime_v3.
+/// @param external_id - the ID of an external input Value.
+/// @param num_dims - the number of dimensions of the new shape. Must match the number of dimensions of the Value.
+/// @param dims - the new dimensions of the Value.
+enum xnn_status xnn_reshape_external_value(
+  xnn_runtime_t runtime,
+  uint32_t external_id,
+  size_t num_dims,
+  const size_t* dims);
+
+/// Propagate shapes of external inputs through the operators of a Runtime object, and re-plan its workspace.
+///
+/// Operators and their packed weights are reused, and the workspace is re-allocated only if it needs to grow. Data
+/// pointers of external inputs and outputs must be specified again with @ref xnn_setup_runtime before the Runtime is
+/// invoked: until then, @ref xnn_invoke_runtime fails with xnn_status_invalid_state. If this function fails, the
+/// Runtime can't be set up until a subsequent call succeeds.
+///
+/// @param runtime - a Runtime object created with @ref xnn_create_runtime, @ref xnn_create_runtime_v2, or
+///                  @ref xnn_create_runtime_v3.
+enum xnn_status xnn_reshape_runtime(
+  xnn_runtime_t runtime);
+
+/// Get the shape of an external input or output Value in a Runtime object, e.g. after @ref xnn_reshape_runtime.
+///
+/// @param runtime - a Runtime object created with @ref xnn_create_runtime, @ref xnn_create_runtime_v2, or
+///                  @ref xnn_create_runtime_v3.
+/// @param external_id - the ID of an external input or output Value.
+/// @param num_dims - pointer to the variable that will be initialized with the number of dimensions of the Value.
+/// @param dims - pointer to an array of XNN_MAX_TENSOR_DIMS elements that will be initialized with the dimensions of
+///               the Value.
+enum xnn_status xnn_get_external_value_shape(
+  xnn_runtime_t runtime,
+  uint32_t external_id,
+  size_t* num_dims,
+  size_t* dims);
+
+/// Get the size of the workspace region a Runtime object uses for its internal Values, as planned when the Runtime
+/// object was created or last reshaped with @ref xnn_reshape_runtime.
+///
+/// @param runtime - a Runtime object created with @ref xnn_create_runtime, @ref xnn_create_runtime_v2, or
+///                  @ref xnn_create_runtime_v3.
+/// @param workspace_size - pointer to the variable that will be initialized with the planned size, in bytes. The
+///                         workspace itself is slightly larger, and can be larger still if it is shared with other
+///                         Runtime objects.
+/// @param workspace_lower_bound - pointer to the variable that will be initialized with the maximum total size, in
+///                                bytes, of internal Values live at the same time. No plan uses less memory.
+enum xnn_status xnn_get_runtime_workspace_size(
+  xnn_runtime_t runtime,
+  size_t* workspace_size,
+  size_t* workspace_lower_bound);
+
 /// Setup data pointers for external inputs and outputs in a Runtime object.
 ///
 /// @param runtime - a Runtime object created with @ref xnn_create_runtime or @ref xnn_create_runtime_v2.
@@ -1172,6 +1688,36 @@ enum xnn_status xnn_setup_runtime(
 enum xnn_status xnn_invoke_runtime(
   xnn_runtime_t runtime);
 
+/// Kinds of profiling information that can be queried with @ref xnn_get_runtime_profiling_info.
+enum xnn_profile_info {
+  /// Returns a size_t containing the number of operators in the execution plan.
+  xnn_profile_info_num_operators,
+  /// Returns a char[] with the null-terminated names of all operators, concatenated in execution order.
+  xnn_profile_info_operator_name,
+  /// Returns a uint64_t[] with the wall time, in nanoseconds, each operator took in the last invocation of the Runtime.
+  xnn_profile_info_operator_timing,
+  /// Returns a size_t[] with the number of bytes in the input and output tensors of each operator.
+  xnn_profile_info_operator_bytes,
+};
+
+/// Query profiling information collected by a Runtime created with the XNN_FLAG_BASIC_PROFILING flag.
+///
+/// Per-operator arrays are reported in the same order as operator names in xnn_profile_info_operator_name.
+///
+/// @param runtime - the Runtime object to query.
+/// @param param_name - the kind of profiling information to query.
+/// @param param_value_size - the size, in bytes, of the buffer pointed to by @a param_value.
+/// @param param_value - the buffer to write the profiling information into.
+/// @param param_value_size_ret - pointer to the variable that will be set to the required buffer size if
+///                               @a param_value_size is too small. In this case the function returns
+///                               xnn_status_out_of_memory and @a param_value is left unchanged.
+enum xnn_status xnn_get_runtime_profiling_info(
+  xnn_runtime_t runtime,
+  enum xnn_profile_info param_name,
+  size_t param_value_size,
+  void* param_value,
+  size_t* param_value_size_ret);
+
 /// Destroy a Runtime object, as well as operators and memory associated with it.
 ///
 /// @param runtime - the Runtime object to destroy.
@@ -1187,6 +1733,16 @@ enum xnn_status xnn_run_operator(
 enum xnn_status xnn_delete_operator(
   xnn_operator_t op);
 
+/// Type of reduction computed by the Reduce operators.
+enum xnn_reduce_operator {
+  /// Sum of the elements along the reduction axes.
+  xnn_reduce_sum,
+  /// Arithmetic mean of the elements along the reduction axes.
+  xnn_reduce_mean,
+  /// Maximum of the elements along the reduction axes.
+  xnn_reduce_max,
+};
+
 #ifndef XNN_NO_F32_OPERATORS
 
 enum xnn_status xnn_create_abs_nc_f32(
@@ -1283,6 +1839,21 @@ enum xnn_status xnn_setup_bankers_rounding_nc_f32(
   float* output,
   pthreadpool_t threadpool);
 
+enum xnn_status xnn_create_batch_matrix_multiply_nc_f32(
+  uint32_t flags,
+  xnn_operator_t* batch_matrix_multiply_op_out);
+
+enum xnn_status xnn_setup_batch_matrix_multiply_nc_f32(
+  xnn_operator_t batch_matrix_multiply_op,
+  size_t batch_size,
+  size_t m,
+  size_t k,
+  size_t n,
+  const float* input_a,
+  const float* input_b,
+  float* output,
+  pthreadpool_t threadpool);
+
 enum xnn_status xnn_create_ceiling_nc_f32(
   size_t channels,
   size_t input_stride,
@@ -1425,6 +1996,20 @@ enum xnn_status xnn_setup_floor_nc_f32(
   float* output,
   pthreadpool_t threadpool);
 
+enum xnn_status xnn_create_gelu_nc_f32(
+  size_t channels,
+  size_t input_stride,
+  size_t output_stride,
+  uint32_t flags,
+  xnn_operator_t* gelu_op_out);
+
+enum xnn_status xnn_setup_gelu_nc_f32(
+  xnn_operator_t gelu_op,
+  size_t batch_size,
+  const float* input,
+  float* output,
+  pthreadpool_t threadpool);
+
 enum xnn_status xnn_create_fully_connected_nc_f32(
   size_t input_channels,
   size_t output_channels,
@@ -1475,6 +2060,23 @@ enum xnn_status xnn_setup_hardswish_nc_f32(
   float* output,
   pthreadpool_t threadpool);
 
+enum xnn_status xnn_create_layer_normalization_nc_f32(
+  size_t channels,
+  size_t input_stride,
+  size_t output_stride,
+  float epsilon,
+  const float* gamma,
+  const float* beta,
+  uint32_t flags,
+  xnn_operator_t* layer_normalization_op_out);
+
+enum xnn_status xnn_setup_layer_normalization_nc_f32(
+  xnn_operator_t layer_normalization_op,
+  size_t batch_size,
+  const float* input,
+  float* output,
+  pthreadpool_t threadpool);
+
 enum xnn_status xnn_create_leaky_relu_nc_f32(
   size_t channels,
   size_t input_stride,
@@ -1594,6 +2196,21 @@ enum xnn_status xnn_setup_prelu_nc_f32(
   float* output,
   pthreadpool_t threadpool);
 
+enum xnn_status xnn_create_reduce_nd_f32(
+  enum xnn_reduce_operator reduce_operator_type,
+  uint32_t flags,
+  xnn_operator_t* reduce_op_out);
+
+enum xnn_status xnn_setup_reduce_nd_f32(
+  xnn_operator_t reduce_op,
+  const float* input,
+  float* output,
+  size_t num_input_dims,
+  const size_t* input_shape,
+  size_t num_reduction_axes,
+  const size_t* reduction_axes,
+  pthreadpool_t threadpool);
+
 enum xnn_status xnn_create_resize_bilinear2d_nchw_f32(
   size_t channels,
   size_t input_pixel_stride,
@@ -1718,6 +2335,20 @@ enum xnn_status xnn_setup_subtract_nd_f32(
   float* output,
   pthreadpool_t threadpool);
 
+enum xnn_status xnn_create_tanh_nc_f32(
+  size_t channels,
+  size_t input_stride,
+  size_t output_stride,
+  uint32_t flags,
+  xnn_operator_t* tanh_op_out);
+
+enum xnn_status xnn_setup_tanh_nc_f32(
+  xnn_operator_t tanh_op,
+  size_t batch_size,
+  const float* input,
+  float* output,
+  pthreadpool_t threadpool);
+
 enum xnn_status xnn_create_truncation_nc_f32(
   size_t channels,
   size_t input_stride,
@@ -1865,6 +2496,49 @@ enum xnn_status xnn_setup_depth_to_space_nchw2nhwc_x32(
   void* output,
   pthreadpool_t threadpool);
 
+enum xnn_status xnn_create_gather_nd_x32(
+  uint32_t flags,
+  xnn_operator_t* gather_op_out);
+
+enum xnn_status xnn_setup_gather_nd_x32(
+  xnn_operator_t gather_op,
+  size_t num_input_dims,
+  const size_t* input_shape,
+  size_t axis,
+  size_t num_indices,
+  const int32_t* indices,
+  const void* input,
+  void* output,
+  pthreadpool_t threadpool);
+
+enum xnn_status xnn_create_slice_nd_x32(
+  uint32_t flags,
+  xnn_operator_t* slice_op_out);
+
+enum xnn_status xnn_setup_slice_nd_x32(
+  xnn_operator_t slice_op,
+  size_t num_dims,
+  const size_t* input_shape,
+  const size_t* offsets,
+  const size_t* sizes,
+  const size_t* strides,
+  const void* input,
+  void* output,
+  pthreadpool_t threadpool);
+
+enum xnn_status xnn_create_transpose_nd_x32(
+  uint32_t flags,
+  xnn_operator_t* transpose_op_out);
+
+enum xnn_status xnn_setup_transpose_nd_x32(
+  xnn_operator_t transpose_op,
+  const void* input,
+  void* output,
+  size_t num_dims,
+  const size_t* input_shape,
+  const size_t* perm,
+  pthreadpool_t threadpool);
+
 enum xnn_status xnn_create_unpooling2d_nhwc_x32(
   uint32_t input_padding_top,
   uint32_t input_padding_right,
@@ -1890,6 +2564,23 @@ enum xnn_status xnn_setup_unpooling2d_nhwc_x32(
 
 #endif  // XNN_NO_X32_OPERATORS
 
+#ifndef XNN_NO_X16_OPERATORS
+
+enum xnn_status xnn_create_transpose_nd_x16(
+  uint32_t flags,
+  xnn_operator_t* transpose_op_out);
+
+enum xnn_status xnn_setup_transpose_nd_x16(
+  xnn_operator_t transpose_op,
+  const void* input,
+  void* output,
+  size_t num_dims,
+  const size_t* input_shape,
+  const size_t* perm,
+  pthreadpool_t threadpool);
+
+#endif  // XNN_NO_X16_OPERATORS
+
 #ifndef XNN_NO_F16_OPERATORS
 
 enum xnn_status xnn_create_add_nd_f16(
@@ -2218,6 +2909,27 @@ enum xnn_status xnn_setup_global_average_pooling_nwc_qs8(
   int8_t* output,
   pthreadpool_t threadpool);
 
+enum xnn_status xnn_create_reduce_nd_qs8(
+  enum xnn_reduce_operator reduce_operator_type,
+  int8_t input_zero_point,
+  float input_scale,
+  int8_t output_zero_point,
+  float output_scale,
+  int8_t output_min,
+  int8_t output_max,
+  uint32_t flags,
+  xnn_operator_t* reduce_op_out);
+
+enum xnn_status xnn_setup_reduce_nd_qs8(
+  xnn_operator_t reduce_op,
+  const int8_t* input,
+  int8_t* output,
+  size_t num_input_dims,
+  const size_t* input_shape,
+  size_t num_reduction_axes,
+  const size_t* reduction_axes,
+  pthreadpool_t threadpool);
+
 enum xnn_status xnn_create_multiply_nd_qs8(
   int8_t input1_zero_point,
   float input1_scale,
@@ -2775,6 +3487,63 @@ enum xnn_status xnn_setup_constant_pad_nd_x8(
   void* output,
   pthreadpool_t threadpool);
 
+enum xnn_status xnn_create_copy_nc_x8(
+  size_t channels,
+  size_t input_stride,
+  size_t output_stride,
+  uint32_t flags,
+  xnn_operator_t* copy_op_out);
+
+enum xnn_status xnn_setup_copy_nc_x8(
+  xnn_operator_t copy_op,
+  size_t batch_size,
+  const void* input,
+  void* output,
+  pthreadpool_t threadpool);
+
+enum xnn_status xnn_create_gather_nd_x8(
+  uint32_t flags,
+  xnn_operator_t* gather_op_out);
+
+enum xnn_status xnn_setup_gather_nd_x8(
+  xnn_operator_t gather_op,
+  size_t num_input_dims,
+  const size_t* input_shape,
+  size_t axis,
+  size_t num_indices,
+  const int32_t* indices,
+  const void* input,
+  void* output,
+  pthreadpool_t threadpool);
+
+enum xnn_status xnn_create_slice_nd_x8(
+  uint32_t flags,
+  xnn_operator_t* slice_op_out);
+
+enum xnn_status xnn_setup_slice_nd_x8(
+  xnn_operator_t slice_op,
+  size_t num_dims,
+  const size_t* input_shape,
+  const size_t* offsets,
+  const size_t* sizes,
+  const size_t* strides,
+  const void* input,
+  void* output,
+  pthreadpool_t threadpool);
+
+enum xnn_status xnn_create_transpose_nd_x8(
+  uint32_t flags,
+  xnn_operator_t* transpose_op_out);
+
+enum xnn_status xnn_setup_transpose_nd_x8(
+  xnn_operator_t transpose_op,
+  const void* input,
+  void* output,
+  size_t num_dims,
+  const size_t* input_shape,
+  const size_t* perm,
+  pthreadpool_t threadpool);
+
 #endif  // XNN_NO_X8_OPERATORS
 
 #ifndef XNN_NO_CVT_OPERATORS
@@ -2875,6 +3644,40 @@ enum xnn_status xnn_setup_convert_nc_qu8_f32(
   float* output,
   pthreadpool_t threadpool);
 
+enum xnn_status xnn_create_gather_nd_qs8_f32(
+  float input_scale,
+  int8_t input_zero_point,
+  uint32_t flags,
+  xnn_operator_t* gather_op_out);
+
+enum xnn_status xnn_setup_gather_nd_qs8_f32(
+  xnn_operator_t gather_op,
+  size_t num_input_dims,
+  const size_t* input_shape,
+  size_t axis,
+  size_t num_indices,
+  const int32_t* indices,
+  const int8_t* input,
+  float* output,
+  pthreadpool_t threadpool);
+
+enum xnn_status xnn_create_gather_nd_qu8_f32(
+  float input_scale,
+  uint8_t input_zero_point,
+  uint32_t flags,
+  xnn_operator_t* gather_op_out);
+
+enum xnn_status xnn_setup_gather_nd_qu8_f32(
+  xnn_operator_t gather_op,
+  size_t num_input_dims,
+  const size_t* input_shape,
+  size_t axis,
+  size_t num_indices,
+  const int32_t* indices,
+  const uint8_t* input,
+  float* output,
+  pthreadpool_t threadpool);
+
 #endif  // XNN_NO_CVT_OPERATORS
 
 #ifdef __cplusplus
@@ -16,6 +16,16 @@ tools/xngen src/f16-spmm/neonfp16arith.c.in -D MR=16 -D NR=1 -D UNROLL=2 -o src/
 tools/xngen src/f16-spmm/neonfp16arith.c.in -D MR=24 -D NR=1 -D UNROLL=2 -o src/f16-spmm/gen/24x1-minmax-neonfp16arith-x2.c &
 tools/xngen src/f16-spmm/neonfp16arith.c.in -D MR=32 -D NR=1 -D UNROLL=2 -o src/f16-spmm/gen/32x1-minmax-neonfp16arith-x2.c &
 
+################################### x86 FMA3 ##################################
+### Microkernels without unrolling
+tools/xngen src/f16-spmm/fma3.c.in -D MR=8  -D NR=1 -D UNROLL=1 -o src/f16-spmm/gen/8x1-minmax-fma3.c &
+tools/xngen src/f16-spmm/fma3.c.in -D MR=16 -D NR=1 -D UNROLL=1 -o src/f16-spmm/gen/16x1-minmax-fma3.c &
+tools/xngen src/f16-spmm/fma3.c.in -D MR=32 -D NR=1 -D UNROLL=1 -o src/f16-spmm/gen/32x1-minmax-fma3.c &
+### Microkernels with 2X unrolling
+tools/xngen src/f16-spmm/fma3.c.in -D MR=8  -D NR=1 -D UNROLL=2 -o src/f16-spmm/gen/8x1-minmax-fma3-x2.c &
+tools/xngen src/f16-spmm/fma3.c.in -D MR=16 -D NR=1 -D UNROLL=2 -o src/f16-spmm/gen/16x1-minmax-fma3-x2.c &
+tools/xngen src/f16-spmm/fma3.c.in -D MR=32 -D NR=1 -D UNROLL=2 -o src/f16-spmm/gen/32x1-minmax-fma3-x2.c &
+
 ################################## Unit tests #################################
 tools/generate-spmm-test.py --spec test/f16-spmm-minmax.yaml --output test/f16-spmm-minmax.cc &
 
@@ -25,4 +25,48 @@ tools/xngen src/f32-conv-hwc/3x3s2p0p1c3-neon-x1.c.in -D CHANNEL_TILE=8 -D HEIGH
 tools/xngen src/f32-conv-hwc/3x3s2p0p1c3-neon-x2.c.in -D CHANNEL_TILE=4 -D HEIGHT_TILE=2 -D FMA=0 -o src/f32-conv-hwc/gen/3x3s2p0p1c3x4-neon-2x2.c &
 tools/xngen src/f32-conv-hwc/3x3s2p0p1c3-neon-x2.c.in -D CHANNEL_TILE=8 -D HEIGHT_TILE=2 -D FMA=0 -o src/f32-conv-hwc/gen/3x3s2p0p1c3x8-neon-2x2.c &
 
+################################### x86 SSE ###################################
+tools/xngen src/f32-conv-hwc/3x3s2c3-sse.c.in -D PADDING_LEFT=1 -D CHANNEL_TILE=4 -D HEIGHT_TILE=1 -D WIDTH_TILE=1 -o src/f32-conv-hwc/gen/3x3s2p1c3x4-sse-1x1.c &
+tools/xngen src/f32-conv-hwc/3x3s2c3-sse.c.in -D PADDING_LEFT=1 -D CHANNEL_TILE=8 -D HEIGHT_TILE=1 -D WIDTH_TILE=1 -o src/f32-conv-hwc/gen/3x3s2p1c3x8-sse-1x1.c &
+tools/xngen src/f32-conv-hwc/3x3s2c3-sse.c.in -D PADDING_LEFT=1 -D CHANNEL_TILE=4 -D HEIGHT_TILE=2 -D WIDTH_TILE=1 -o src/f32-conv-hwc/gen/3x3s2p1c3x4-sse-2x1.c &
+tools/xngen src/f32-conv-hwc/3x3s2c3-sse.c.in -D PADDING_LEFT=1 -D CHANNEL_TILE=8 -D HEIGHT_TILE=2 -D WIDTH_TILE=1 -o src/f32-conv-hwc/gen/3x3s2p1c3x8-sse-2x1.c &
+
+tools/xngen src/f32-conv-hwc/3x3s2c3-sse.c.in -D PADDING_LEFT=0 -D CHANNEL_TILE=4 -D HEIGHT_TILE=1 -D WIDTH_TILE=1 -o src/f32-conv-hwc/gen/3x3s2p0p1c3x4-sse-1x1.c &
+tools/xngen src/f32-conv-hwc/3x3s2c3-sse.c.in -D PADDING_LEFT=0 -D CHANNEL_TILE=8 -D HEIGHT_TILE=1 -D WIDTH_TILE=1 -o src/f32-conv-hwc/gen/3x3s2p0p1c3x8-sse-1x1.c &
+tools/xngen src/f32-conv-hwc/3x3s2c3-sse.c.in -D PADDING_LEFT=0 -D CHANNEL_TILE=4 -D HEIGHT_TILE=2 -D WIDTH_TILE=1 -o src/f32-conv-hwc/gen/3x3s2p0p1c3x4-sse-2x1.c &
+tools/xngen src/f32-conv-hwc/3x3s2c3-sse.c.in -D PADDING_LEFT=0 -D CHANNEL_TILE=8 -D HEIGHT_TILE=2 -D WIDTH_TILE=1 -o src/f32-conv-hwc/gen/3x3s2p0p1c3x8-sse-2x1.c &
+
+################################### x86 AVX ###################################
+tools/xngen src/f32-conv-hwc/3x3s2c3-avx.c.in -D PADDING_LEFT=1 -D CHANNEL_TILE=8 -D HEIGHT_TILE=1 -D WIDTH_TILE=1 -D FMA=0 -o src/f32-conv-hwc/gen/3x3s2p1c3x8-avx-1x1.c &
+tools/xngen src/f32-conv-hwc/3x3s2c3-avx.c.in -D PADDING_LEFT=1 -D CHANNEL_TILE=16 -D HEIGHT_TILE=1 -D WIDTH_TILE=1 -D FMA=0 -o src/f32-conv-hwc/gen/3x3s2p1c3x16-avx-1x1.c &
+tools/xngen src/f32-conv-hwc/3x3s2c3-avx.c.in -D PADDING_LEFT=1 -D CHANNEL_TILE=8 -D HEIGHT_TILE=2 -D WIDTH_TILE=1 -D FMA=0 -o src/f32-conv-hwc/gen/3x3s2p1c3x8-avx-2x1.c &
+tools/xngen src/f32-conv-hwc/3x3s2c3-avx.c.in -D PADDING_LEFT=1 -D CHANNEL_TILE=16 -D HEIGHT_TILE=2 -D WIDTH_TILE=1 -D FMA=0 -o src/f32-conv-hwc/gen/3x3s2p1c3x16-avx-2x1.c &
+
+tools/xngen src/f32-conv-hwc/3x3s2c3-avx.c.in -D PADDING_LEFT=0 -D CHANNEL_TILE=8 -D HEIGHT_TILE=1 -D WIDTH_TILE=1 -D FMA=0 -o src/f32-conv-hwc/gen/3x3s2p0p1c3x8-avx-1x1.c &
+tools/xngen src/f32-conv-hwc/3x3s2c3-avx.c.in -D PADDING_LEFT=0 -D CHANNEL_TILE=16 -D HEIGHT_TILE=1 -D WIDTH_TILE=1 -D FMA=0 -o src/f32-conv-hwc/gen/3x3s2p0p1c3x16-avx-1x1.c &
+tools/xngen src/f32-conv-hwc/3x3s2c3-avx.c.in -D PADDING_LEFT=0 -D CHANNEL_TILE=8 -D HEIGHT_TILE=2 -D WIDTH_TILE=1 -D FMA=0 -o src/f32-conv-hwc/gen/3x3s2p0p1c3x8-avx-2x1.c &
+tools/xngen src/f32-conv-hwc/3x3s2c3-avx.c.in -D PADDING_LEFT=0 -D CHANNEL_TILE=16 -D HEIGHT_TILE=2 -D WIDTH_TILE=1 -D FMA=0 -o src/f32-conv-hwc/gen/3x3s2p0p1c3x16-avx-2x1.c &
+
+################################### x86 FMA3 ##################################
+tools/xngen src/f32-conv-hwc/3x3s2c3-avx.c.in -D PADDING_LEFT=1 -D CHANNEL_TILE=8 -D HEIGHT_TILE=2 -D WIDTH_TILE=1 -D FMA=1 -o src/f32-conv-hwc/gen/3x3s2p1c3x8-fma3-2x1.c &
+tools/xngen src/f32-conv-hwc/3x3s2c3-avx.c.in -D PADDING_LEFT=1 -D CHANNEL_TILE=16 -D HEIGHT_TILE=2 -D WIDTH_TILE=1 -D FMA=1 -o src/f32-conv-hwc/gen/3x3s2p1c3x16-fma3-2x1.c &
+tools/xngen src/f32-conv-hwc/3x3s2c3-avx.c.in -D PADDING_LEFT=1 -D CHANNEL_TILE=8 -D HEIGHT_TILE=2 -D WIDTH_TILE=2 -D FMA=1 -o src/f32-conv-hwc/gen/3x3s2p1c3x8-fma3-2x2.c &
+tools/xngen src/f32-conv-hwc/3x3s2c3-avx.c.in -D PADDING_LEFT=1 -D CHANNEL_TILE=16 -D HEIGHT_TILE=2 -D WIDTH_TILE=2 -D FMA=1 -o src/f32-conv-hwc/gen/3x3s2p1c3x16-fma3-2x2.c &
+
+tools/xngen src/f32-conv-hwc/3x3s2c3-avx.c.in -D PADDING_LEFT=0 -D CHANNEL_TILE=8 -D HEIGHT_TILE=2 -D WIDTH_TILE=1 -D FMA=1 -o src/f32-conv-hwc/gen/3x3s2p0p1c3x8-fma3-2x1.c &
+tools/xngen src/f32-conv-hwc/3x3s2c3-avx.c.in -D PADDING_LEFT=0 -D CHANNEL_TILE=16 -D HEIGHT_TILE=2 -D WIDTH_TILE=1 -D FMA=1 -o src/f32-conv-hwc/gen/3x3s2p0p1c3x16-fma3-2x1.c &
+tools/xngen src/f32-conv-hwc/3x3s2c3-avx.c.in -D PADDING_LEFT=0 -D CHANNEL_TILE=8 -D HEIGHT_TILE=2 -D WIDTH_TILE=2 -D FMA=1 -o src/f32-conv-hwc/gen/3x3s2p0p1c3x8-fma3-2x2.c &
+tools/xngen src/f32-conv-hwc/3x3s2c3-avx.c.in -D PADDING_LEFT=0 -D CHANNEL_TILE=16 -D HEIGHT_TILE=2 -D WIDTH_TILE=2 -D FMA=1 -o src/f32-conv-hwc/gen/3x3s2p0p1c3x16-fma3-2x2.c &
+
+################################# x86 AVX512F #################################
+tools/xngen src/f32-conv-hwc/3x3s2c3-avx512f.c.in -D PADDING_LEFT=1 -D CHANNEL_TILE=16 -D HEIGHT_TILE=2 -D WIDTH_TILE=1 -o src/f32-conv-hwc/gen/3x3s2p1c3x16-avx512f-2x1.c &
+tools/xngen src/f32-conv-hwc/3x3s2c3-avx512f.c.in -D PADDING_LEFT=1 -D CHANNEL_TILE=32 -D HEIGHT_TILE=2 -D WIDTH_TILE=1 -o src/f32-conv-hwc/gen/3x3s2p1c3x32-avx512f-2x1.c &
+tools/xngen src/f32-conv-hwc/3x3s2c3-avx512f.c.in -D PADDING_LEFT=1 -D CHANNEL_TILE=16 -D HEIGHT_TILE=2 -D WIDTH_TILE=2 -o src/f32-conv-hwc/gen/3x3s2p1c3x16-avx512f-2x2.c &
+tools/xngen src/f32-conv-hwc/3x3s2c3-avx512f.c.in -D PADDING_LEFT=1 -D CHANNEL_TILE=32 -D HEIGHT_TILE=2 -D WIDTH_TILE=2 -o src/f32-conv-hwc/gen/3x3s2p1c3x32-avx512f-2x2.c &
+
+tools/xngen src/f32-conv-hwc/3x3s2c3-avx512f.c.in -D PADDING_LEFT=0 -D CHANNEL_TILE=16 -D HEIGHT_TILE=2 -D WIDTH_TILE=1 -o src/f32-conv-hwc/gen/3x3s2p0p1c3x16-avx512f-2x1.c &
+tools/xngen src/f32-conv-hwc/3x3s2c3-avx512f.c.in -D PADDING_LEFT=0 -D CHANNEL_TILE=32 -D HEIGHT_TILE=2 -D WIDTH_TILE=1 -o src/f32-conv-hwc/gen/3x3s2p0p1c3x32-avx512f-2x1.c &
+tools/xngen src/f32-conv-hwc/3x3s2c3-avx512f.c.in -D PADDING_LEFT=0 -D CHANNEL_TILE=16 -D HEIGHT_TILE=2 -D WIDTH_TILE=2 -o src/f32-conv-hwc/gen/3x3s2p0p1c3x16-avx512f-2x2.c &
+tools/xngen src/f32-conv-hwc/3x3s2c3-avx512f.c.in -D PADDING_LEFT=0 -D CHANNEL_TILE=32 -D HEIGHT_TILE=2 -D WIDTH_TILE=2 -o src/f32-conv-hwc/gen/3x3s2p0p1c3x32-avx512f-2x2.c &
+
 wait
@@ -165,6 +165,81 @@ tools/xngen src/f32-dwconv2d-chw/5x5s2p2-sse.c.in -D ROW_TILE=2 -D ACCUMULATORS=
 tools/xngen src/f32-dwconv2d-chw/5x5s2p2-sse.c.in -D ROW_TILE=2 -D ACCUMULATORS=3 -o src/f32-dwconv2d-chw/gen/5x5s2p2-minmax-sse-2x4-acc3.c &
 tools/xngen src/f32-dwconv2d-chw/5x5s2p2-sse.c.in -D ROW_TILE=3 -D ACCUMULATORS=2 -o src/f32-dwconv2d-chw/gen/5x5s2p2-minmax-sse-3x4-acc2.c &
 
+################################### x86 AVX ###################################
+tools/xngen src/f32-dwconv2d-chw/3x3p1-avx.c.in -D ROW_TILE=1 -D ACCUMULATORS=1 -o src/f32-dwconv2d-chw/gen/3x3p1-minmax-avx-1x8.c &
+tools/xngen src/f32-dwconv2d-chw/3x3p1-avx.c.in -D ROW_TILE=2 -D ACCUMULATORS=1 -o src/f32-dwconv2d-chw/gen/3x3p1-minmax-avx-2x8.c &
+tools/xngen src/f32-dwconv2d-chw/3x3p1-avx.c.in -D ROW_TILE=3 -D ACCUMULATORS=1 -o src/f32-dwconv2d-chw/gen/3x3p1-minmax-avx-3x8.c &
+tools/xngen src/f32-dwconv2d-chw/3x3p1-avx.c.in -D ROW_TILE=4 -D ACCUMULATORS=1 -o src/f32-dwconv2d-chw/gen/3x3p1-minmax-avx-4x8.c &
+tools/xngen src/f32-dwconv2d-chw/3x3p1-avx.c.in -D ROW_TILE=5 -D ACCUMULATORS=1 -o src/f32-dwconv2d-chw/gen/3x3p1-minmax-avx-5x8.c &
+tools/xngen src/f32-dwconv2d-chw/3x3p1-avx.c.in -D ROW_TILE=1 -D ACCUMULATORS=2 -o src/f32-dwconv2d-chw/gen/3x3p1-minmax-avx-1x8-acc2.c &
+tools/xngen src/f32-dwconv2d-chw/3x3p1-avx.c.in -D ROW_TILE=1 -D ACCUMULATORS=3 -o src/f32-dwconv2d-chw/gen/3x3p1-minmax-avx-1x8-acc3.c &
+tools/xngen src/f32-dwconv2d-chw/3x3p1-avx.c.in -D ROW_TILE=1 -D ACCUMULATORS=4 -o src/f32-dwconv2d-chw/gen/3x3p1-minmax-avx-1x8-acc4.c &
+tools/xngen src/f32-dwconv2d-chw/3x3p1-avx.c.in -D ROW_TILE=2 -D ACCUMULATORS=2 -o src/f32-dwconv2d-chw/gen/3x3p1-minmax-avx-2x8-acc2.c &
+
+tools/xngen src/f32-dwconv2d-chw/3x3s2p1-avx.c.in -D ROW_TILE=1 -D ACCUMULATORS=1 -o src/f32-dwconv2d-chw/gen/3x3s2p1-minmax-avx-1x8.c &
+tools/xngen src/f32-dwconv2d-chw/3x3s2p1-avx.c.in -D ROW_TILE=2 -D ACCUMULATORS=1 -o src/f32-dwconv2d-chw/gen/3x3s2p1-minmax-avx-2x8.c &
+tools/xngen src/f32-dwconv2d-chw/3x3s2p1-avx.c.in -D ROW_TILE=3 -D ACCUMULATORS=1 -o src/f32-dwconv2d-chw/gen/3x3s2p1-minmax-avx-3x8.c &
+tools/xngen src/f32-dwconv2d-chw/3x3s2p1-avx.c.in -D ROW_TILE=4 -D ACCUMULATORS=1 -o src/f32-dwconv2d-chw/gen/3x3s2p1-minmax-avx-4x8.c &
+tools/xngen src/f32-dwconv2d-chw/3x3s2p1-avx.c.in -D ROW_TILE=1 -D ACCUMULATORS=2 -o src/f32-dwconv2d-chw/gen/3x3s2p1-minmax-avx-1x8-acc2.c &
+tools/xngen src/f32-dwconv2d-chw/3x3s2p1-avx.c.in -D ROW_TILE=1 -D ACCUMULATORS=3 -o src/f32-dwconv2d-chw/gen/3x3s2p1-minmax-avx-1x8-acc3.c &
+tools/xngen src/f32-dwconv2d-chw/3x3s2p1-avx.c.in -D ROW_TILE=1 -D ACCUMULATORS=4 -o src/f32-dwconv2d-chw/gen/3x3s2p1-minmax-avx-1x8-acc4.c &
+tools/xngen src/f32-dwconv2d-chw/3x3s2p1-avx.c.in -D ROW_TILE=2 -D ACCUMULATORS=2 -o src/f32-dwconv2d-chw/gen/3x3s2p1-minmax-avx-2x8-acc2.c &
+
+tools/xngen src/f32-dwconv2d-chw/5x5p2-avx.c.in -D ROW_TILE=1 -D ACCUMULATORS=1 -o src/f32-dwconv2d-chw/gen/5x5p2-minmax-avx-1x8.c &
+tools/xngen src/f32-dwconv2d-chw/5x5p2-avx.c.in -D ROW_TILE=2 -D ACCUMULATORS=1 -o src/f32-dwconv2d-chw/gen/5x5p2-minmax-avx-2x8.c &
+tools/xngen src/f32-dwconv2d-chw/5x5p2-avx.c.in -D ROW_TILE=3 -D ACCUMULATORS=1 -o src/f32-dwconv2d-chw/gen/5x5p2-minmax-avx-3x8.c &
+tools/xngen src/f32-dwconv2d-chw/5x5p2-avx.c.in -D ROW_TILE=1 -D ACCUMULATORS=2 -o src/f32-dwconv2d-chw/gen/5x5p2-minmax-avx-1x8-acc2.c &
+tools/xngen src/f32-dwconv2d-chw/5x5p2-avx.c.in -D ROW_TILE=1 -D ACCUMULATORS=3 -o src/f32-dwconv2d-chw/gen/5x5p2-minmax-avx-1x8-acc3.c &
+tools/xngen src/f32-dwconv2d-chw/5x5p2-avx.c.in -D ROW_TILE=1 -D ACCUMULATORS=4 -o src/f32-dwconv2d-chw/gen/5x5p2-minmax-avx-1x8-acc4.c &
+tools/xngen src/f32-dwconv2d-chw/5x5p2-avx.c.in -D ROW_TILE=1 -D ACCUMULATORS=5 -o src/f32-dwconv2d-chw/gen/5x5p2-minmax-avx-1x8-acc5.c &
+tools/xngen src/f32-dwconv2d-chw/5x5p2-avx.c.in -D ROW_TILE=2 -D ACCUMULATORS=2 -o src/f32-dwconv2d-chw/gen/5x5p2-minmax-avx-2x8-acc2.c &
+tools/xngen src/f32-dwconv2d-chw/5x5p2-avx.c.in -D ROW_TILE=2 -D ACCUMULATORS=3 -o src/f32-dwconv2d-chw/gen/5x5p2-minmax-avx-2x8-acc3.c &
+
+tools/xngen src/f32-dwconv2d-chw/5x5s2p2-avx.c.in -D ROW_TILE=1 -D ACCUMULATORS=1 -o src/f32-dwconv2d-chw/gen/5x5s2p2-minmax-avx-1x8.c &
+tools/xngen src/f32-dwconv2d-chw/5x5s2p2-avx.c.in -D ROW_TILE=2 -D ACCUMULATORS=1 -o src/f32-dwconv2d-chw/gen/5x5s2p2-minmax-avx-2x8.c &
+tools/xngen src/f32-dwconv2d-chw/5x5s2p2-avx.c.in -D ROW_TILE=3 -D ACCUMULATORS=1 -o src/f32-dwconv2d-chw/gen/5x5s2p2-minmax-avx-3x8.c &
+tools/xngen src/f32-dwconv2d-chw/5x5s2p2-avx.c.in -D ROW_TILE=1 -D ACCUMULATORS=2 -o src/f32-dwconv2d-chw/gen/5x5s2p2-minmax-avx-1x8-acc2.c &
+tools/xngen src/f32-dwconv2d-chw/5x5s2p2-avx.c.in -D ROW_TILE=1 -D ACCUMULATORS=3 -o src/f32-dwconv2d-chw/gen/5x5s2p2-minmax-avx-1x8-acc3.c &
+tools/xngen src/f32-dwconv2d-chw/5x5s2p2-avx.c.in -D ROW_TILE=1 -D ACCUMULATORS=4 -o src/f32-dwconv2d-chw/gen/5x5s2p2-minmax-avx-1x8-acc4.c &
+tools/xngen src/f32-dwconv2d-chw/5x5s2p2-avx.c.in -D ROW_TILE=1 -D ACCUMULATORS=5 -o src/f32-dwconv2d-chw/gen/5x5s2p2-minmax-avx-1x8-acc5.c &
+tools/xngen src/f32-dwconv2d-chw/5x5s2p2-avx.c.in -D ROW_TILE=2 -D ACCUMULATORS=2 -o src/f32-dwconv2d-chw/gen/5x5s2p2-minmax-avx-2x8-acc2.c &
+tools/xngen src/f32-dwconv2d-chw/5x5s2p2-avx.c.in -D ROW_TILE=2 -D ACCUMULATORS=3 -o src/f32-dwconv2d-chw/gen/5x5s2p2-minmax-avx-2x8-acc3.c &
+
+################################# x86 AVX512F #################################
+tools/xngen src/f32-dwconv2d-chw/3x3p1-avx512f.c.in -D ROW_TILE=1 -D ACCUMULATORS=1 -o src/f32-dwconv2d-chw/gen/3x3p1-minmax-avx512f-1x16.c &
+tools/xngen src/f32-dwconv2d-chw/3x3p1-avx512f.c.in -D ROW_TILE=2 -D ACCUMULATORS=1 -o src/f32-dwconv2d-chw/gen/3x3p1-minmax-avx512f-2x16.c &
+tools/xngen src/f32-dwconv2d-chw/3x3p1-avx512f.c.in -D ROW_TILE=3 -D ACCUMULATORS=1 -o src/f32-dwconv2d-chw/gen/3x3p1-minmax-avx512f-3x16.c &
+tools/xngen src/f32-dwconv2d-chw/3x3p1-avx512f.c.in -D ROW_TILE=4 -D ACCUMULATORS=1 -o src/f32-dwconv2d-chw/gen/3x3p1-minmax-avx512f-4x16.c &
+tools/xngen src/f32-dwconv2d-chw/3x3p1-avx512f.c.in -D ROW_TILE=1 -D ACCUMULATORS=2 -o src/f32-dwconv2d-chw/gen/3x3p1-minmax-avx512f-1x16-acc2.c &
+tools/xngen src/f32-dwconv2d-chw/3x3p1-avx512f.c.in -D ROW_TILE=1 -D ACCUMULATORS=3 -o src/f32-dwconv2d-chw/gen/3x3p1-minmax-avx512f-1x16-acc3.c &
+tools/xngen src/f32-dwconv2d-chw/3x3p1-avx512f.c.in -D ROW_TILE=1 -D ACCUMULATORS=4 -o src/f32-dwconv2d-chw/gen/3x3p1-minmax-avx512f-1x16-acc4.c &
+tools/xngen src/f32-dwconv2d-chw/3x3p1-avx512f.c.in -D ROW_TILE=2 -D ACCUMULATORS=2 -o src/f32-dwconv2d-chw/gen/3x3p1-minmax-avx512f-2x16-acc2.c &
+
+tools/xngen src/f32-dwconv2d-chw/3x3s2p1-avx512f.c.in -D ROW_TILE=1 -D ACCUMULATORS=1 -o src/f32-dwconv2d-chw/gen/3x3s2p1-minmax-avx512f-1x16.c &
+tools/xngen src/f32-dwconv2d-chw/3x3s2p1-avx512f.c.in -D ROW_TILE=2 -D ACCUMULATORS=1 -o src/f32-dwconv2d-chw/gen/3x3s2p1-minmax-avx512f-2x16.c &
+tools/xngen src/f32-dwconv2d-chw/3x3s2p1-avx512f.c.in -D ROW_TILE=3 -D ACCUMULATORS=1 -o src/f32-dwconv2d-chw/gen/3x3s2p1-minmax-avx512f-3x16.c &
+tools/xngen src/f32-dwconv2d-chw/3x3s2p1-avx512f.c.in -D ROW_TILE=1 -D ACCUMULATORS=2 -o src/f32-dwconv2d-chw/gen/3x3s2p1-minmax-avx512f-1x16-acc2.c &
+tools/xngen src/f32-dwconv2d-chw/3x3s2p1-avx512f.c.in -D ROW_TILE=1 -D ACCUMULATORS=3 -o src/f32-dwconv2d-chw/gen/3x3s2p1-minmax-avx512f-1x16-acc3.c &
+tools/xngen src/f32-dwconv2d-chw/3x3s2p1-avx512f.c.in -D ROW_TILE=1 -D ACCUMULATORS=4 -o src/f32-dwconv2d-chw/gen/3x3s2p1-minmax-avx512f-1x16-acc4.c &
+tools/xngen src/f32-dwconv2d-chw/3x3s2p1-avx512f.c.in -D ROW_TILE=2 -D ACCUMULATORS=2 -o src/f32-dwconv2d-chw/gen/3x3s2p1-minmax-avx512f-2x16-acc2.c &
+
+tools/xngen src/f32-dwconv2d-chw/5x5p2-avx512f.c.in -D ROW_TILE=1 -D ACCUMULATORS=1 -o src/f32-dwconv2d-chw/gen/5x5p2-minmax-avx512f-1x16.c &
+tools/xngen src/f32-dwconv2d-chw/5x5p2-avx512f.c.in -D ROW_TILE=2 -D ACCUMULATORS=1 -o src/f32-dwconv2d-chw/gen/5x5p2-minmax-avx512f-2x16.c &
+tools/xngen src/f32-dwconv2d-chw/5x5p2-avx512f.c.in -D ROW_TILE=3 -D ACCUMULATORS=1 -o src/f32-dwconv2d-chw/gen/5x5p2-minmax-avx512f-3x16.c &
+tools/xngen src/f32-dwconv2d-chw/5x5p2-avx512f.c.in -D ROW_TILE=4 -D ACCUMULATORS=1 -o src/f32-dwconv2d-chw/gen/5x5p2-minmax-avx512f-4x16.c &
+tools/xngen src/f32-dwconv2d-chw/5x5p2-avx512f.c.in -D ROW_TILE=1 -D ACCUMULATORS=2 -o src/f32-dwconv2d-chw/gen/5x5p2-minmax-avx512f-1x16-acc2.c &
+tools/xngen src/f32-dwconv2d-chw/5x5p2-avx512f.c.in -D ROW_TILE=1 -D ACCUMULATORS=3 -o src/f32-dwconv2d-chw/gen/5x5p2-minmax-avx512f-1x16-acc3.c &
+tools/xngen src/f32-dwconv2d-chw/5x5p2-avx512f.c.in -D ROW_TILE=1 -D ACCUMULATORS=4 -o src/f32-dwconv2d-chw/gen/5x5p2-minmax-avx512f-1x16-acc4.c &
+tools/xngen src/f32-dwconv2d-chw/5x5p2-avx512f.c.in -D ROW_TILE=2 -D ACCUMULATORS=2 -o src/f32-dwconv2d-chw/gen/5x5p2-minmax-avx512f-2x16-acc2.c &
+
+tools/xngen src/f32-dwconv2d-chw/5x5s2p2-avx512f.c.in -D ROW_TILE=1 -D ACCUMULATORS=1 -o src/f32-dwconv2d-chw/gen/5x5s2p2-minmax-avx512f-1x16.c &
+tools/xngen src/f32-dwconv2d-chw/5x5s2p2-avx512f.c.in -D ROW_TILE=2 -D ACCUMULATORS=1 -o src/f32-dwconv2d-chw/gen/5x5s2p2-minmax-avx512f-2x16.c &
+tools/xngen src/f32-dwconv2d-chw/5x5s2p2-avx512f.c.in -D ROW_TILE=3 -D ACCUMULATORS=1 -o src/f32-dwconv2d-chw/gen/5x5s2p2-minmax-avx512f-3x16.c &
+tools/xngen src/f32-dwconv2d-chw/5x5s2p2-avx512f.c.in -D ROW_TILE=1 -D ACCUMULATORS=2 -o src/f32-dwconv2d-chw/gen/5x5s2p2-minmax-avx512f-1x16-acc2.c &
+tools/xngen src/f32-dwconv2d-chw/5x5s2p2-avx512f.c.in -D ROW_TILE=1 -D ACCUMULATORS=3 -o src/f32-dwconv2d-chw/gen/5x5s2p2-minmax-avx512f-1x16-acc3.c &
+tools/xngen src/f32-dwconv2d-chw/5x5s2p2-avx512f.c.in -D ROW_TILE=1 -D ACCUMULATORS=4 -o src/f32-dwconv2d-chw/gen/5x5s2p2-minmax-avx512f-1x16-acc4.c &
+tools/xngen src/f32-dwconv2d-chw/5x5s2p2-avx512f.c.in -D ROW_TILE=2 -D ACCUMULATORS=2 -o src/f32-dwconv2d-chw/gen/5x5s2p2-minmax-avx512f-2x16-acc2.c &
+
 ################################### Scalar ####################################
 tools/xngen src/f32-dwconv2d-chw/3x3p1-scalar.c.in -D ROW_TILE=1 -D ACCUMULATORS=1 -o src/f32-dwconv2d-chw/gen/3x3p1-minmax-scalar-1x1.c &
 tools/xngen src/f32-dwconv2d-chw/3x3p1-scalar.c.in -D ROW_TILE=2 -D ACCUMULATORS=1 -o src/f32-dwconv2d-chw/gen/3x3p1-minmax-scalar-2x1.c &
@@ -73,6 +73,42 @@ tools/xngen src/f32-spmm/sse.c.in -D MR=8  -D NR=1 -D UNROLL=1 -o src/f32-spmm/g
 tools/xngen src/f32-spmm/sse.c.in -D MR=16 -D NR=1 -D UNROLL=1 -o src/f32-spmm/gen/16x1-minmax-sse.c &
 tools/xngen src/f32-spmm/sse.c.in -D MR=32 -D NR=1 -D UNROLL=1 -o src/f32-spmm/gen/32x1-minmax-sse.c &
 
+################################ x86 AVX/FMA3 #################################
+tools/xngen src/f32-spmm/avx.c.in -D MR=8  -D NR=1 -D FMA=0 -o src/f32-spmm/gen/8x1-minmax-avx.c &
+tools/xngen src/f32-spmm/avx.c.in -D MR=16 -D NR=1 -D FMA=0 -o src/f32-spmm/gen/16x1-minmax-avx.c &
+tools/xngen src/f32-spmm/avx.c.in -D MR=32 -D NR=1 -D FMA=0 -o src/f32-spmm/gen/32x1-minmax-avx.c &
+
+tools/xngen src/f32-spmm/avx.c.in -D MR=8  -D NR=2 -D FMA=0 -o src/f32-spmm/gen/8x2-minmax-avx.c &
+tools/xngen src/f32-spmm/avx.c.in -D MR=16 -D NR=2 -D FMA=0 -o src/f32-spmm/gen/16x2-minmax-avx.c &
+tools/xngen src/f32-spmm/avx.c.in -D MR=32 -D NR=2 -D FMA=0 -o src/f32-spmm/gen/32x2-minmax-avx.c &
+
+tools/xngen src/f32-spmm/avx.c.in -D MR=8  -D NR=4 -D FMA=0 -o src/f32-spmm/gen/8x4-minmax-avx.c &
+tools/xngen src/f32-spmm/avx.c.in -D MR=16 -D NR=4 -D FMA=0 -o src/f32-spmm/gen/16x4-minmax-avx.c &
+tools/xngen src/f32-spmm/avx.c.in -D MR=32 -D NR=4 -D FMA=0 -o src/f32-spmm/gen/32x4-minmax-avx.c &
+
+tools/xngen src/f32-spmm/avx.c.in -D MR=8  -D NR=1 -D FMA=1 -o src/f32-spmm/gen/8x1-minmax-fma3.c &
+tools/xngen src/f32-spmm/avx.c.in -D MR=16 -D NR=1 -D FMA=1 -o src/f32-spmm/gen/16x1-minmax-fma3.c &
+tools/xngen src/f32-spmm/avx.c.in -D MR=32 -D NR=1 -D FMA=1 -o src/f32-spmm/gen/32x1-minmax-fma3.c &
+
+tools/xngen src/f32-spmm/avx.c.in -D MR=8  -D NR=2 -D FMA=1 -o src/f32-spmm/gen/8x2-minmax-fma3.c &
+tools/xngen src/f32-spmm/avx.c.in -D MR=16 -D NR=2 -D FMA=1 -o src/f32-spmm/gen/16x2-minmax-fma3.c &
+tools/xngen src/f32-spmm/avx.c.in -D MR=32 -D NR=2 -D FMA=1 -o src/f32-spmm/gen/32x2-minmax-fma3.c &
+
+tools/xngen src/f32-spmm/avx.c.in -D MR=8  -D NR=4 -D FMA=1 -o src/f32-spmm/gen/8x4-minmax-fma3.c &
+tools/xngen src/f32-spmm/avx.c.in -D MR=16 -D NR=4 -D FMA=1 -o src/f32-spmm/gen/16x4-minmax-fma3.c &
+tools/xngen src/f32-spmm/avx.c.in -D MR=32 -D NR=4 -D FMA=1 -o src/f32-spmm/gen/32x4-minmax-fma3.c &
+
+################################## x86 AVX512 #################################
+tools/xngen src/f32-spmm/avx512f.c.in -D MR=16 -D NR=1 -o src/f32-spmm/gen/16x1-minmax-avx512f.c &
+tools/xngen src/f32-spmm/avx512f.c.in -D MR=32 -D NR=1 -o src/f32-spmm/gen/32x1-minmax-avx512f.c &
+tools/xngen src/f32-spmm/avx512f.c.in -D MR=64 -D NR=1 -o src/f32-spmm/gen/64x1-minmax-avx512f.c &
+tools/xngen src/f32-spmm/avx512f.c.in -D MR=16 -D NR=2 -o src/f32-spmm/gen/16x2-minmax-avx512f.c &
+tools/xngen src/f32-spmm/avx512f.c.in -D MR=32 -D NR=2 -o src/f32-spmm/gen/32x2-minmax-avx512f.c &
+tools/xngen src/f32-spmm/avx512f.c.in -D MR=64 -D NR=2 -o src/f32-spmm/gen/64x2-minmax-avx512f.c &
+tools/xngen src/f32-spmm/avx512f.c.in -D MR=16 -D NR=4 -o src/f32-spmm/gen/16x4-minmax-avx512f.c &
+tools/xngen src/f32-spmm/avx512f.c.in -D MR=32 -D NR=4 -o src/f32-spmm/gen/32x4-minmax-avx512f.c &
+tools/xngen src/f32-spmm/avx512f.c.in -D MR=64 -D NR=4 -o src/f32-spmm/gen/64x4-minmax-avx512f.c &
+
 ################################### WASM SIMD ###################################
 ### Microkernels without unrolling.
 tools/xngen src/f32-spmm/wasmsimd.c.in -D MR=4  -D NR=1 -D X86=0 -D UNROLL=1 -o src/f32-spmm/gen/4x1-minmax-wasmsimd-arm.c &
@@ -0,0 +1,44 @@
+#!/bin/sh
+# Copyright 2022 Google LLC
+#
+# This source code is licensed under the BSD-style license found in the
+# LICENSE file in the root directory of this source tree.
+
+################################### ARM NEON ##################################
+tools/xngen src/f32-vgelu/neon-rational-13-8.c.in -D BATCH_TILE=4  -D FMA=1 -D DIV_ALGO=div -o src/f32-vgelu/gen/vgelu-neonfma-rational-13-8-div-x4.c &
+tools/xngen src/f32-vgelu/neon-rational-13-8.c.in -D BATCH_TILE=8  -D FMA=1 -D DIV_ALGO=div -o src/f32-vgelu/gen/vgelu-neonfma-rational-13-8-div-x8.c &
+tools/xngen src/f32-vgelu/neon-rational-13-8.c.in -D BATCH_TILE=12 -D FMA=1 -D DIV_ALGO=div -o src/f32-vgelu/gen/vgelu-neonfma-rational-13-8-div-x12.c &
+tools/xngen src/f32-vgelu/neon-rational-13-8.c.in -D BATCH_TILE=16 -D FMA=1 -D DIV_ALGO=div -o src/f32-vgelu/gen/vgelu-neonfma-rational-13-8-div-x16.c &
+
+tools/xngen src/f32-vgelu/neon-rational-13-8.c.in -D BATCH_TILE=4  -D FMA=0 -D DIV_ALGO=nr2recps -o src/f32-vgelu/gen/vgelu-neon-rational-13-8-nr2recps-x4.c &
+tools/xngen src/f32-vgelu/neon-rational-13-8.c.in -D BATCH_TILE=8  -D FMA=0 -D DIV_ALGO=nr2recps -o src/f32-vgelu/gen/vgelu-neon-rational-13-8-nr2recps-x8.c &
+tools/xngen src/f32-vgelu/neon-rational-13-8.c.in -D BATCH_TILE=12 -D FMA=0 -D DIV_ALGO=nr2recps -o src/f32-vgelu/gen/vgelu-neon-rational-13-8-nr2recps-x12.c &
+tools/xngen src/f32-vgelu/neon-rational-13-8.c.in -D BATCH_TILE=16 -D FMA=0 -D DIV_ALGO=nr2recps -o src/f32-vgelu/gen/vgelu-neon-rational-13-8-nr2recps-x16.c &
+
+################################### x86 SSE ###################################
+tools/xngen src/f32-vgelu/sse-rational-13-8-div.c.in -D BATCH_TILE=4  -o src/f32-vgelu/gen/vgelu-sse2-rational-13-8-div-x4.c &
+tools/xngen src/f32-vgelu/sse-rational-13-8-div.c.in -D BATCH_TILE=8  -o src/f32-vgelu/gen/vgelu-sse2-rational-13-8-div-x8.c &
+tools/xngen src/f32-vgelu/sse-rational-13-8-div.c.in -D BATCH_TILE=12 -o src/f32-vgelu/gen/vgelu-sse2-rational-13-8-div-x12.c &
+tools/xngen src/f32-vgelu/sse-rational-13-8-div.c.in -D BATCH_TILE=16 -o src/f32-vgelu/gen/vgelu-sse2-rational-13-8-div-x16.c &
+
+################################### x86 AVX ###################################
+tools/xngen src/f32-vgelu/avx2-rational-13-8-div.c.in -D BATCH_TILE=8  -o src/f32-vgelu/gen/vgelu-avx2-rational-13-8-div-x8.c &
+tools/xngen src/f32-vgelu/avx2-rational-13-8-div.c.in -D BATCH_TILE=16 -o src/f32-vgelu/gen/vgelu-avx2-rational-13-8-div-x16.c &
+tools/xngen src/f32-vgelu/avx2-rational-13-8-div.c.in -D BATCH_TILE=24 -o src/f32-vgelu/gen/vgelu-avx2-rational-13-8-div-x24.c &
+tools/xngen src/f32-vgelu/avx2-rational-13-8-div.c.in -D BATCH_TILE=32 -o src/f32-vgelu/gen/vgelu-avx2-rational-13-8-div-x32.c &
+
+################################# x86 AVX-512 #################################
+tools/xngen src/f32-vgelu/avx512f-rational-13-8-div.c.in -D BATCH_TILE=16 -o src/f32-vgelu/gen/vgelu-avx512f-rational-13-8-div-x16.c &
+tools/xngen src/f32-vgelu/avx512f-rational-13-8-div.c.in -D BATCH_TILE=32 -o src/f32-vgelu/gen/vgelu-avx512f-rational-13-8-div-x32.c &
+tools/xngen src/f32-vgelu/avx512f-rational-13-8-div.c.in -D BATCH_TILE=48 -o src/f32-vgelu/gen/vgelu-avx512f-rational-13-8-div-x48.c &
+tools/xngen src/f32-vgelu/avx512f-rational-13-8-div.c.in -D BATCH_TILE=64 -o src/f32-vgelu/gen/vgelu-avx512f-rational-13-8-div-x64.c &
+
+################################### Scalar ####################################
+tools/xngen src/f32-vgelu/scalar-rational-13-8-div.c.in -D BATCH_TILE=1  -o src/f32-vgelu/gen/vgelu-scalar-rational-13-8-div-x1.c &
+tools/xngen src/f32-vgelu/scalar-rational-13-8-div.c.in -D BATCH_TILE=2  -o src/f32-vgelu/gen/vgelu-scalar-rational-13-8-div-x2.c &
+tools/xngen src/f32-vgelu/scalar-rational-13-8-div.c.in -D BATCH_TILE=4  -o src/f32-vgelu/gen/vgelu-scalar-rational-13-8-div-x4.c &
+
+################################## Unit tests #################################
+tools/generate-vunary-test.py --spec test/f32-vgelu.yaml --output test/f32-vgelu.cc &
+
+wait
@@ -0,0 +1,64 @@
+#!/bin/sh
+# Copyright 2022 Google LLC
+#
+# This source code is licensed under the BSD-style license found in the
+# LICENSE file in the root directory of this source tree.
+
+################################### ARM NEON ##################################
+tools/xngen src/f32-vtanh/neon-expm1minus-p6.c.in -D BATCH_TILE=4  -D FMA=1 -D DIV_ALGO=div -o src/f32-vtanh/gen/vtanh-neonfma-expm1minus-rr1-p6-div-x4.c &
+tools/xngen src/f32-vtanh/neon-expm1minus-p6.c.in -D BATCH_TILE=8  -D FMA=1 -D DIV_ALGO=div -o src/f32-vtanh/gen/vtanh-neonfma-expm1minus-rr1-p6-div-x8.c &
+tools/xngen src/f32-vtanh/neon-expm1minus-p6.c.in -D BATCH_TILE=12 -D FMA=1 -D DIV_ALGO=div -o src/f32-vtanh/gen/vtanh-neonfma-expm1minus-rr1-p6-div-x12.c &
+tools/xngen src/f32-vtanh/neon-expm1minus-p6.c.in -D BATCH_TILE=16 -D FMA=1 -D DIV_ALGO=div -o src/f32-vtanh/gen/vtanh-neonfma-expm1minus-rr1-p6-div-x16.c &
+
+tools/xngen src/f32-vtanh/neon-expm1minus-p6.c.in -D BATCH_TILE=4  -D FMA=1 -D DIV_ALGO=nr2fma -o src/f32-vtanh/gen/vtanh-neonfma-expm1minus-rr1-p6-nr2fma-x4.c &
+tools/xngen src/f32-vtanh/neon-expm1minus-p6.c.in -D BATCH_TILE=8  -D FMA=1 -D DIV_ALGO=nr2fma -o src/f32-vtanh/gen/vtanh-neonfma-expm1minus-rr1-p6-nr2fma-x8.c &
+tools/xngen src/f32-vtanh/neon-expm1minus-p6.c.in -D BATCH_TILE=12 -D FMA=1 -D DIV_ALGO=nr2fma -o src/f32-vtanh/gen/vtanh-neonfma-expm1minus-rr1-p6-nr2fma-x12.c &
+tools/xngen src/f32-vtanh/neon-expm1minus-p6.c.in -D BATCH_TILE=16 -D FMA=1 -D DIV_ALGO=nr2fma -o src/f32-vtanh/gen/vtanh-neonfma-expm1minus-rr1-p6-nr2fma-x16.c &
+
+tools/xngen src/f32-vtanh/neon-expm1minus-p6.c.in -D BATCH_TILE=4  -D FMA=1 -D DIV_ALGO=nr1recps1fma -o src/f32-vtanh/gen/vtanh-neonfma-expm1minus-rr1-p6-nr1recps1fma-x4.c &
+tools/xngen src/f32-vtanh/neon-expm1minus-p6.c.in -D BATCH_TILE=8  -D FMA=1 -D DIV_ALGO=nr1recps1fma -o src/f32-vtanh/gen/vtanh-neonfma-expm1minus-rr1-p6-nr1recps1fma-x8.c &
+tools/xngen src/f32-vtanh/neon-expm1minus-p6.c.in -D BATCH_TILE=12 -D FMA=1 -D DIV_ALGO=nr1recps1fma -o src/f32-vtanh/gen/vtanh-neonfma-expm1minus-rr1-p6-nr1recps1fma-x12.c &
+tools/xngen src/f32-vtanh/neon-expm1minus-p6.c.in -D BATCH_TILE=16 -D FMA=1 -D DIV_ALGO=nr1recps1fma -o src/f32-vtanh/gen/vtanh-neonfma-expm1minus-rr1-p6-nr1recps1fma-x16.c &
+
+tools/xngen src/f32-vtanh/neon-expm1minus-p6.c.in -D BATCH_TILE=4  -D FMA=1 -D DIV_ALGO=nr2recps -o src/f32-vtanh/gen/vtanh-neonfma-expm1minus-rr1-p6-nr2recps-x4.c &
+tools/xngen src/f32-vtanh/neon-expm1minus-p6.c.in -D BATCH_TILE=8  -D FMA=1 -D DIV_ALGO=nr2recps -o src/f32-vtanh/gen/vtanh-neonfma-expm1minus-rr1-p6-nr2recps-x8.c &
+tools/xngen src/f32-vtanh/neon-expm1minus-p6.c.in -D BATCH_TILE=12 -D FMA=1 -D DIV_ALGO=nr2recps -o src/f32-vtanh/gen/vtanh-neonfma-expm1minus-rr1-p6-nr2recps-x12.c &
+tools/xngen src/f32-vtanh/neon-expm1minus-p6.c.in -D BATCH_TILE=16 -D FMA=1 -D DIV_ALGO=nr2recps -o src/f32-vtanh/gen/vtanh-neonfma-expm1minus-rr1-p6-nr2recps-x16.c &
+
+tools/xngen src/f32-vtanh/neon-expm1minus-p6.c.in -D BATCH_TILE=4  -D FMA=0 -D DIV_ALGO=nr2recps -o src/f32-vtanh/gen/vtanh-neon-expm1minus-rr2-p6-nr2recps-x4.c &
+tools/xngen src/f32-vtanh/neon-expm1minus-p6.c.in -D BATCH_TILE=8  -D FMA=0 -D DIV_ALGO=nr2recps -o src/f32-vtanh/gen/vtanh-neon-expm1minus-rr2-p6-nr2recps-x8.c &
+tools/xngen src/f32-vtanh/neon-expm1minus-p6.c.in -D BATCH_TILE=12 -D FMA=0 -D DIV_ALGO=nr2recps -o src/f32-vtanh/gen/vtanh-neon-expm1minus-rr2-p6-nr2recps-x12.c &
+tools/xngen src/f32-vtanh/neon-expm1minus-p6.c.in -D BATCH_TILE=16 -D FMA=0 -D DIV_ALGO=nr2recps -o src/f32-vtanh/gen/vtanh-neon-expm1minus-rr2-p6-nr2recps-x16.c &
+
+################################### x86 SSE ###################################
+tools/xngen src/f32-vtanh/sse-expm1minus-rr2-p6-div.c.in -D BATCH_TILE=4  -o src/f32-vtanh/gen/vtanh-sse2-expm1minus-rr2-p6-div-x4.c &
+tools/xngen src/f32-vtanh/sse-expm1minus-rr2-p6-div.c.in -D BATCH_TILE=8  -o src/f32-vtanh/gen/vtanh-sse2-expm1minus-rr2-p6-div-x8.c &
+tools/xngen src/f32-vtanh/sse-expm1minus-rr2-p6-div.c.in -D BATCH_TILE=12 -o src/f32-vtanh/gen/vtanh-sse2-expm1minus-rr2-p6-div-x12.c &
+tools/xngen src/f32-vtanh/sse-expm1minus-rr2-p6-div.c.in -D BATCH_TILE=16 -o src/f32-vtanh/gen/vtanh-sse2-expm1minus-rr2-p6-div-x16.c &
+
+################################### x86 AVX ###################################
+tools/xngen src/f32-vtanh/avx-expm1minus-rr2-p6-div.c.in -D BATCH_TILE=8  -o src/f32-vtanh/gen/vtanh-avx-expm1minus-rr2-p6-div-x8.c &
+tools/xngen src/f32-vtanh/avx-expm1minus-rr2-p6-div.c.in -D BATCH_TILE=16 -o src/f32-vtanh/gen/vtanh-avx-expm1minus-rr2-p6-div-x16.c &
+tools/xngen src/f32-vtanh/avx-expm1minus-rr2-p6-div.c.in -D BATCH_TILE=24 -o src/f32-vtanh/gen/vtanh-avx-expm1minus-rr2-p6-div-x24.c &
+tools/xngen src/f32-vtanh/avx-expm1minus-rr2-p6-div.c.in -D BATCH_TILE=32 -o src/f32-vtanh/gen/vtanh-avx-expm1minus-rr2-p6-div-x32.c &
+
+tools/xngen src/f32-vtanh/avx2-expm1minus-rr1-p6-div.c.in -D BATCH_TILE=8  -o src/f32-vtanh/gen/vtanh-avx2-expm1minus-rr1-p6-div-x8.c &
+tools/xngen src/f32-vtanh/avx2-expm1minus-rr1-p6-div.c.in -D BATCH_TILE=16 -o src/f32-vtanh/gen/vtanh-avx2-expm1minus-rr1-p6-div-x16.c &
+tools/xngen src/f32-vtanh/avx2-expm1minus-rr1-p6-div.c.in -D BATCH_TILE=24 -o src/f32-vtanh/gen/vtanh-avx2-expm1minus-rr1-p6-div-x24.c &
+tools/xngen src/f32-vtanh/avx2-expm1minus-rr1-p6-div.c.in -D BATCH_TILE=32 -o src/f32-vtanh/gen/vtanh-avx2-expm1minus-rr1-p6-div-x32.c &
+
+################################# x86 AVX-512 #################################
+tools/xngen src/f32-vtanh/avx512f-expm1minus-rr1-p6-div.c.in -D BATCH_TILE=16 -o src/f32-vtanh/gen/vtanh-avx512f-expm1minus-rr1-p6-div-x16.c &
+tools/xngen src/f32-vtanh/avx512f-expm1minus-rr1-p6-div.c.in -D BATCH_TILE=32 -o src/f32-vtanh/gen/vtanh-avx512f-expm1minus-rr1-p6-div-x32.c &
+tools/xngen src/f32-vtanh/avx512f-expm1minus-rr1-p6-div.c.in -D BATCH_TILE=48 -o src/f32-vtanh/gen/vtanh-avx512f-expm1minus-rr1-p6-div-x48.c &
+tools/xngen src/f32-vtanh/avx512f-expm1minus-rr1-p6-div.c.in -D BATCH_TILE=64 -o src/f32-vtanh/gen/vtanh-avx512f-expm1minus-rr1-p6-div-x64.c &
+
+################################### Scalar ####################################
+tools/xngen src/f32-vtanh/scalar-expm1minus-rr2-p6-div.c.in -D BATCH_TILE=1  -o src/f32-vtanh/gen/vtanh-scalar-expm1minus-rr2-p6-div-x1.c &
+tools/xngen src/f32-vtanh/scalar-expm1minus-rr2-p6-div.c.in -D BATCH_TILE=2  -o src/f32-vtanh/gen/vtanh-scalar-expm1minus-rr2-p6-div-x2.c &
+tools/xngen src/f32-vtanh/scalar-expm1minus-rr2-p6-div.c.in -D BATCH_TILE=4  -o src/f32-vtanh/gen/vtanh-scalar-expm1minus-rr2-p6-div-x4.c &
+
+################################## Unit tests #################################
+tools/generate-vunary-test.py --spec test/f32-vtanh.yaml --output test/f32-vtanh.cc &
+
+wait
@@ -8,6 +8,7 @@
 #include <immintrin.h>
 
 #include <xnnpack/common.h>
+#include <xnnpack/conv.h>
 #include <xnnpack/dwconv.h>
 #include <xnnpack/gemm.h>
 #include <xnnpack/igemm.h>
@@ -15,10 +16,13 @@
 #include <xnnpack/lut.h>
 #include <xnnpack/math.h>
 #include <xnnpack/prelu.h>
+#include <xnnpack/rmeanvar.h>
+#include <xnnpack/spmm.h>
 #include <xnnpack/vaddsub.h>
 #include <xnnpack/vbinary.h>
 #include <xnnpack/vcvt.h>
 #include <xnnpack/vmul.h>
+#include <xnnpack/vnormcaddc.h>
 #include <xnnpack/vunary.h>
 
 
@@ -154,6 +158,713 @@ void xnn_f16_f32_vcvt_ukernel__avx_int16_x16(
   }
 }
 
+void xnn_f32_conv_hwc_ukernel_3x3s2p0p1c3x16__avx_1x1(
+    size_t input_height,
+    size_t input_width,
+    size_t output_y_start,
+    size_t output_y_end,
+    const float* input,
+    const float* zero,
+    const float* weights,
+    float* output,
+    size_t input_padding_top,
+    size_t output_channels,
+    size_t output_height_stride,
+    size_t output_width_stride,
+    const union xnn_f32_minmax_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(input_width > 1);
+  assert(output_y_end > output_y_start);
+  assert(input_padding_top <= 1);
+  assert(output_channels != 0);
+
+  const size_t input_height_stride = input_width * 3 /* channels */ * sizeof(float);
+  const size_t input_width_decrement = round_down_po2(input_width - 1, 2) * 3 /* channels */ * sizeof(float);
+  const size_t output_width = input_width / 2;
+  const size_t output_channel_decrement = output_width * output_width_stride - 16 * sizeof(float);
+  const size_t output_height_increment = output_height_stride * 1 - round_up_po2(output_channels, 16) * sizeof(float);
+
+  // Adjustment for padding processed below
+  const float* i0 = (const float*) ((uintptr_t) input +
+    input_height_stride * (output_y_start * 2 /* vertical stride */ - input_padding_top));
+  const float* i1 = (const float*) ((uintptr_t) i0 + input_height_stride);
+  const float* i2 = (const float*) ((uintptr_t) i1 + input_height_stride);
+  float* o0 = (float*) ((uintptr_t) output + output_height_stride * output_y_start);
+
+  if XNN_UNPREDICTABLE(output_y_start < input_padding_top) {
+    i0 = zero;
+  }
+
+  const __m256 vmin = _mm256_load_ps(params->avx.min);
+  const __m256 vmax = _mm256_load_ps(params->avx.max);
+
+  for (size_t output_y = output_y_start; output_y < output_y_end; output_y += 1) {
+    const size_t input_y2 = output_y * 2 + 2 - input_padding_top;
+    if XNN_UNPREDICTABLE(input_y2 >= input_height) {
+      i2 = zero;
+    }
+
+    const float* w = weights;
+    size_t c = output_channels;
+    do {
+      // voMx0 accumulates the leftmost output pixel of the next block. The input column to the left of it
+      // is either padding, or was already accumulated at the end of the previous block.
+      __m256 vo0x0c01234567 = _mm256_load_ps(w + 0);
+      __m256 vo0x0c89ABCDEF = _mm256_load_ps(w + 8);
+
+      // No padding on the left: the first input column contributes only through the left column of the kernel.
+      const __m256 vi0c0 = _mm256_broadcast_ss(i0 + 0);
+      vo0x0c01234567 = _mm256_add_ps(vo0x0c01234567, _mm256_mul_ps(_mm256_load_ps(w + 16), vi0c0));
+      vo0x0c89ABCDEF = _mm256_add_ps(vo0x0c89ABCDEF, _mm256_mul_ps(_mm256_load_ps(w + 24), vi0c0));
+      const __m256 vi1c0 = _mm256_broadcast_ss(i1 + 0);
+      vo0x0c01234567 = _mm256_add_ps(vo0x0c01234567, _mm256_mul_ps(_mm256_load_ps(w + 32), vi1c0));
+      vo0x0c89ABCDEF = _mm256_add_ps(vo0x0c89ABCDEF, _mm256_mul_ps(_mm256_load_ps(w + 40), vi1c0));
+      const __m256 vi2c0 = _mm256_broadcast_ss(i2 + 0);
+      vo0x0c01234567 = _mm256_add_ps(vo0x0c01234567, _mm256_mul_ps(_mm256_load_ps(w + 48), vi2c0));
+      vo0x0c89ABCDEF = _mm256_add_ps(vo0x0c89ABCDEF, _mm256_mul_ps(_mm256_load_ps(w + 56), vi2c0));
+      const __m256 vi0c1 = _mm256_broadcast_ss(i0 + 1);
+      vo0x0c01234567 = _mm256_add_ps(vo0x0c01234567, _mm256_mul_ps(_mm256_load_ps(w + 64), vi0c1));
+      vo0x0c89ABCDEF = _mm256_add_ps(vo0x0c89ABCDEF, _mm256_mul_ps(_mm256_load_ps(w + 72), vi0c1));
+      const __m256 vi1c1 = _mm256_broadcast_ss(i1 + 1);
+      vo0x0c01234567 = _mm256_add_ps(vo0x0c01234567, _mm256_mul_ps(_mm256_load_ps(w + 80), vi1c1));
+      vo0x0c89ABCDEF = _mm256_add_ps(vo0x0c89ABCDEF, _mm256_mul_ps(_mm256_load_ps(w + 88), vi1c1));
+      const __m256 vi2c1 = _mm256_broadcast_ss(i2 + 1);
+      vo0x0c01234567 = _mm256_add_ps(vo0x0c01234567, _mm256_mul_ps(_mm256_load_ps(w + 96), vi2c1));
+      vo0x0c89ABCDEF = _mm256_add_ps(vo0x0c89ABCDEF, _mm256_mul_ps(_mm256_load_ps(w + 104), vi2c1));
+      const __m256 vi0c2 = _mm256_broadcast_ss(i0 + 2);
+      vo0x0c01234567 = _mm256_add_ps(vo0x0c01234567, _mm256_mul_ps(_mm256_load_ps(w + 112), vi0c2));
+      vo0x0c89ABCDEF = _mm256_add_ps(vo0x0c89ABCDEF, _mm256_mul_ps(_mm256_load_ps(w + 120), vi0c2));
+      const __m256 vi1c2 = _mm256_broadcast_ss(i1 + 2);
+      vo0x0c01234567 = _mm256_add_ps(vo0x0c01234567, _mm256_mul_ps(_mm256_load_ps(w + 128), vi1c2));
+      vo0x0c89ABCDEF = _mm256_add_ps(vo0x0c89ABCDEF, _mm256_mul_ps(_mm256_load_ps(w + 136), vi1c2));
+      const __m256 vi2c2 = _mm256_broadcast_ss(i2 + 2);
+      vo0x0c01234567 = _mm256_add_ps(vo0x0c01234567, _mm256_mul_ps(_mm256_load_ps(w + 144), vi2c2));
+      vo0x0c89ABCDEF = _mm256_add_ps(vo0x0c89ABCDEF, _mm256_mul_ps(_mm256_load_ps(w + 152), vi2c2));
+
+      size_t iw = input_width - 1;
+      for (; iw >= 2; iw -= 2) {
+        __m256 vo0x1c01234567 = _mm256_load_ps(w + 0);
+        __m256 vo0x1c89ABCDEF = _mm256_load_ps(w + 8);
+
+        const __m256 vk01c0x01234567 = _mm256_load_ps(w + 160);
+        const __m256 vk01c0x89ABCDEF = _mm256_load_ps(w + 168);
+        const __m256 vk11c0x01234567 = _mm256_load_ps(w + 176);
+        const __m256 vk11c0x89ABCDEF = _mm256_load_ps(w + 184);
+        const __m256 vk21c0x01234567 = _mm256_load_ps(w + 192);
+        const __m256 vk21c0x89ABCDEF = _mm256_load_ps(w + 200);
+
+        const __m256 vi0x0c0 = _mm256_broadcast_ss(i0 + 3);
+        vo0x0c01234567 = _mm256_add_ps(vo0x0c01234567, _mm256_mul_ps(vk01c0x01234567, vi0x0c0));
+        vo0x0c89ABCDEF = _mm256_add_ps(vo0x0c89ABCDEF, _mm256_mul_ps(vk01c0x89ABCDEF, vi0x0c0));
+        const __m256 vi1x0c0 = _mm256_broadcast_ss(i1 + 3);
+        vo0x0c01234567 = _mm256_add_ps(vo0x0c01234567, _mm256_mul_ps(vk11c0x01234567, vi1x0c0));
+        vo0x0c89ABCDEF = _mm256_add_ps(vo0x0c89ABCDEF, _mm256_mul_ps(vk11c0x89ABCDEF, vi1x0c0));
+        const __m256 vi2x0c0 = _mm256_broadcast_ss(i2 + 3);
+        vo0x0c01234567 = _mm256_add_ps(vo0x0c01234567, _mm256_mul_ps(vk21c0x01234567, vi2x0c0));
+        vo0x0c89ABCDEF = _mm256_add_ps(vo0x0c89ABCDEF, _mm256_mul_ps(vk21c0x89ABCDEF, vi2x0c0));
+
+        const __m256 vk02c0x01234567 = _mm256_load_ps(w + 304);
+        const __m256 vk02c0x89ABCDEF = _mm256_load_ps(w + 312);
+        const __m256 vk12c0x01234567 = _mm256_load_ps(w + 320);
+        const __m256 vk12c0x89ABCDEF = _mm256_load_ps(w + 328);
+        const __m256 vk22c0x01234567 = _mm256_load_ps(w + 336);
+        const __m256 vk22c0x89ABCDEF = _mm256_load_ps(w + 344);
+        const __m256 vk00c0x01234567 = _mm256_load_ps(w + 16);
+        const __m256 vk00c0x89ABCDEF = _mm256_load_ps(w + 24);
+        const __m256 vk10c0x01234567 = _mm256_load_ps(w + 32);
+        const __m256 vk10c0x89ABCDEF = _mm256_load_ps(w + 40);
+        const __m256 vk20c0x01234567 = _mm256_load_ps(w + 48);
+        const __m256 vk20c0x89ABCDEF = _mm256_load_ps(w + 56);
+
+        const __m256 vi0x1c0 = _mm256_broadcast_ss(i0 + 6);
+        vo0x0c01234567 = _mm256_add_ps(vo0x0c01234567, _mm256_mul_ps(vk02c0x01234567, vi0x1c0));
+        vo0x0c89ABCDEF = _mm256_add_ps(vo0x0c89ABCDEF, _mm256_mul_ps(vk02c0x89ABCDEF, vi0x1c0));
+        vo0x1c01234567 = _mm256_add_ps(vo0x1c01234567, _mm256_mul_ps(vk00c0x01234567, vi0x1c0));
+        vo0x1c89ABCDEF = _mm256_add_ps(vo0x1c89ABCDEF, _mm256_mul_ps(vk00c0x89ABCDEF, vi0x1c0));
+        const __m256 vi1x1c0 = _mm256_broadcast_ss(i1 + 6);
+        vo0x0c01234567 = _mm256_add_ps(vo0x0c01234567, _mm256_mul_ps(vk12c0x01234567, vi1x1c0));
+        vo0x0c89ABCDEF = _mm256_add_ps(vo0x0c89ABCDEF, _mm256_mul_ps(vk12c0x89ABCDEF, vi1x1c0));
+        vo0x1c01234567 = _mm256_add_ps(vo0x1c01234567, _mm256_mul_ps(vk10c0x01234567, vi1x1c0));
+        vo0x1c89ABCDEF = _mm256_add_ps(vo0x1c89ABCDEF, _mm256_mul_ps(vk10c0x89ABCDEF, vi1x1c0));
+        const __m256 vi2x1c0 = _mm256_broadcast_ss(i2 + 6);
+        vo0x0c01234567 = _mm256_add_ps(vo0x0c01234567, _mm256_mul_ps(vk22c0x01234567, vi2x1c0));
+        vo0x0c89ABCDEF = _mm256_add_ps(vo0x0c89ABCDEF, _mm256_mul_ps(vk22c0x89ABCDEF, vi2x1c0));
+        vo0x1c01234567 = _mm256_add_ps(vo0x1c01234567, _mm256_mul_ps(vk20c0x01234567, vi2x1c0));
+        vo0x1c89ABCDEF = _mm256_add_ps(vo0x1c89ABCDEF, _mm256_mul_ps(vk20c0x89ABCDEF, vi2x1c0));
+        const __m256 vk01c1x01234567 = _mm256_load_ps(w + 208);
+        const __m256 vk01c1x89ABCDEF = _mm256_load_ps(w + 216);
+        const __m256 vk11c1x01234567 = _mm256_load_ps(w + 224);
+        const __m256 vk11c1x89ABCDEF = _mm256_load_ps(w + 232);
+        const __m256 vk21c1x01234567 = _mm256_load_ps(w + 240);
+        const __m256 vk21c1x89ABCDEF = _mm256_load_ps(w + 248);
+
+        const __m256 vi0x0c1 = _mm256_broadcast_ss(i0 + 4);
+        vo0x0c01234567 = _mm256_add_ps(vo0x0c01234567, _mm256_mul_ps(vk01c1x01234567, vi0x0c1));
+        vo0x0c89ABCDEF = _mm256_add_ps(vo0x0c89ABCDEF, _mm256_mul_ps(vk01c1x89ABCDEF, vi0x0c1));
+        const __m256 vi1x0c1 = _mm256_broadcast_ss(i1 + 4);
+        vo0x0c01234567 = _mm256_add_ps(vo0x0c01234567, _mm256_mul_ps(vk11c1x01234567, vi1x0c1));
+        vo0x0c89ABCDEF = _mm256_add_ps(vo0x0c89ABCDEF, _mm256_mul_ps(vk11c1x89ABCDEF, vi1x0c1));
+        const __m256 vi2x0c1 = _mm256_broadcast_ss(i2 + 4);
+        vo0x0c01234567 = _mm256_add_ps(vo0x0c01234567, _mm256_mul_ps(vk21c1x01234567, vi2x0c1));
+        vo0x0c89ABCDEF = _mm256_add_ps(vo0x0c89ABCDEF, _mm256_mul_ps(vk21c1x89ABCDEF, vi2x0c1));
+
+        const __m256 vk02c1x01234567 = _mm256_load_ps(w + 352);
+        const __m256 vk02c1x89ABCDEF = _mm256_load_ps(w + 360);
+        const __m256 vk12c1x01234567 = _mm256_load_ps(w + 368);
+        const __m256 vk12c1x89ABCDEF = _mm256_load_ps(w + 376);
+        const __m256 vk22c1x01234567 = _mm256_load_ps(w + 384);
+        const __m256 vk22c1x89ABCDEF = _mm256_load_ps(w + 392);
+        const __m256 vk00c1x01234567 = _mm256_load_ps(w + 64);
+        const __m256 vk00c1x89ABCDEF = _mm256_load_ps(w + 72);
+        const __m256 vk10c1x01234567 = _mm256_load_ps(w + 80);
+        const __m256 vk10c1x89ABCDEF = _mm256_load_ps(w + 88);
+        const __m256 vk20c1x01234567 = _mm256_load_ps(w + 96);
+        const __m256 vk20c1x89ABCDEF = _mm256_load_ps(w + 104);
+
+        const __m256 vi0x1c1 = _mm256_broadcast_ss(i0 + 7);
+        vo0x0c01234567 = _mm256_add_ps(vo0x0c01234567, _mm256_mul_ps(vk02c1x01234567, vi0x1c1));
+        vo0x0c89ABCDEF = _mm256_add_ps(vo0x0c89ABCDEF, _mm256_mul_ps(vk02c1x89ABCDEF, vi0x1c1));
+        vo0x1c01234567 = _mm256_add_ps(vo0x1c01234567, _mm256_mul_ps(vk00c1x01234567, vi0x1c1));
+        vo0x1c89ABCDEF = _mm256_add_ps(vo0x1c89ABCDEF, _mm256_mul_ps(vk00c1x89ABCDEF, vi0x1c1));
+        const __m256 vi1x1c1 = _mm256_broadcast_ss(i1 + 7);
+        vo0x0c01234567 = _mm256_add_ps(vo0x0c01234567, _mm256_mul_ps(vk12c1x01234567, vi1x1c1));
+        vo0x0c89ABCDEF = _mm256_add_ps(vo0x0c89ABCDEF, _mm256_mul_ps(vk12c1x89ABCDEF, vi1x1c1));
+        vo0x1c01234567 = _mm256_add_ps(vo0x1c01234567, _mm256_mul_ps(vk10c1x01234567, vi1x1c1));
+        vo0x1c89ABCDEF = _mm256_add_ps(vo0x1c89ABCDEF, _mm256_mul_ps(vk10c1x89ABCDEF, vi1x1c1));
+        const __m256 vi2x1c1 = _mm256_broadcast_ss(i2 + 7);
+        vo0x0c01234567 = _mm256_add_ps(vo0x0c01234567, _mm256_mul_ps(vk22c1x01234567, vi2x1c1));
+        vo0x0c89ABCDEF = _mm256_add_ps(vo0x0c89ABCDEF, _mm256_mul_ps(vk22c1x89ABCDEF, vi2x1c1));
+        vo0x1c01234567 = _mm256_add_ps(vo0x1c01234567, _mm256_mul_ps(vk20c1x01234567, vi2x1c1));
+        vo0x1c89ABCDEF = _mm256_add_ps(vo0x1c89ABCDEF, _mm256_mul_ps(vk20c1x89ABCDEF, vi2x1c1));
+        const __m256 vk01c2x01234567 = _mm256_load_ps(w + 256);
+        const __m256 vk01c2x89ABCDEF = _mm256_load_ps(w + 264);
+        const __m256 vk11c2x01234567 = _mm256_load_ps(w + 272);
+        const __m256 vk11c2x89ABCDEF = _mm256_load_ps(w + 280);
+        const __m256 vk21c2x01234567 = _mm256_load_ps(w + 288);
+        const __m256 vk21c2x89ABCDEF = _mm256_load_ps(w + 296);
+
+        const __m256 vi0x0c2 = _mm256_broadcast_ss(i0 + 5);
+        vo0x0c01234567 = _mm256_add_ps(vo0x0c01234567, _mm256_mul_ps(vk01c2x01234567, vi0x0c2));
+        vo0x0c89ABCDEF = _mm256_add_ps(vo0x0c89ABCDEF, _mm256_mul_ps(vk01c2x89ABCDEF, vi0x0c2));
+        const __m256 vi1x0c2 = _mm256_broadcast_ss(i1 + 5);
+        vo0x0c01234567 = _mm256_add_ps(vo0x0c01234567, _mm256_mul_ps(vk11c2x01234567, vi1x0c2));
+        vo0x0c89ABCDEF = _mm256_add_ps(vo0x0c89ABCDEF, _mm256_mul_ps(vk11c2x89ABCDEF, vi1x0c2));
+        const __m256 vi2x0c2 = _mm256_broadcast_ss(i2 + 5);
+        vo0x0c01234567 = _mm256_add_ps(vo0x0c01234567, _mm256_mul_ps(vk21c2x01234567, vi2x0c2));
+        vo0x0c89ABCDEF = _mm256_add_ps(vo0x0c89ABCDEF, _mm256_mul_ps(vk21c2x89ABCDEF, vi2x0c2));
+
+        const __m256 vk02c2x01234567 = _mm256_load_ps(w + 400);
+        const __m256 vk02c2x89ABCDEF = _mm256_load_ps(w + 408);
+        const __m256 vk12c2x01234567 = _mm256_load_ps(w + 416);
+        const __m256 vk12c2x89ABCDEF = _mm256_load_ps(w + 424);
+        const __m256 vk22c2x01234567 = _mm256_load_ps(w + 432);
+        const __m256 vk22c2x89ABCDEF = _mm256_load_ps(w + 440);
+        const __m256 vk00c2x01234567 = _mm256_load_ps(w + 112);
+        const __m256 vk00c2x89ABCDEF = _mm256_load_ps(w + 120);
+        const __m256 vk10c2x01234567 = _mm256_load_ps(w + 128);
+        const __m256 vk10c2x89ABCDEF = _mm256_load_ps(w + 136);
+        const __m256 vk20c2x01234567 = _mm256_load_ps(w + 144);
+        const __m256 vk20c2x89ABCDEF = _mm256_load_ps(w + 152);
+
+        const __m256 vi0x1c2 = _mm256_broadcast_ss(i0 + 8);
+        vo0x0c01234567 = _mm256_add_ps(vo0x0c01234567, _mm256_mul_ps(vk02c2x01234567, vi0x1c2));
+        vo0x0c89ABCDEF = _mm256_add_ps(vo0x0c89ABCDEF, _mm256_mul_ps(vk02c2x89ABCDEF, vi0x1c2));
+        vo0x1c01234567 = _mm256_add_ps(vo0x1c01234567, _mm256_mul_ps(vk00c2x01234567, vi0x1c2));
+        vo0x1c89ABCDEF = _mm256_add_ps(vo0x1c89ABCDEF, _mm256_mul_ps(vk00c2x89ABCDEF, vi0x1c2));
+        const __m256 vi1x1c2 = _mm256_broadcast_ss(i1 + 8);
+        vo0x0c01234567 = _mm256_add_ps(vo0x0c01234567, _mm256_mul_ps(vk12c2x01234567, vi1x1c2));
+        vo0x0c89ABCDEF = _mm256_add_ps(vo0x0c89ABCDEF, _mm256_mul_ps(vk12c2x89ABCDEF, vi1x1c2));
+        vo0x1c01234567 = _mm256_add_ps(vo0x1c01234567, _mm256_mul_ps(vk10c2x01234567, vi1x1c2));
+        vo0x1c89ABCDEF = _mm256_add_ps(vo0x1c89ABCDEF, _mm256_mul_ps(vk10c2x89ABCDEF, vi1x1c2));
+        const __m256 vi2x1c2 = _mm256_broadcast_ss(i2 + 8);
+        vo0x0c01234567 = _mm256_add_ps(vo0x0c01234567, _mm256_mul_ps(vk22c2x01234567, vi2x1c2));
+        vo0x0c89ABCDEF = _mm256_add_ps(vo0x0c89ABCDEF, _mm256_mul_ps(vk22c2x89ABCDEF, vi2x1c2));
+        vo0x1c01234567 = _mm256_add_ps(vo0x1c01234567, _mm256_mul_ps(vk20c2x01234567, vi2x1c2));
+        vo0x1c89ABCDEF = _mm256_add_ps(vo0x1c89ABCDEF, _mm256_mul_ps(vk20c2x89ABCDEF, vi2x1c2));
+
+        i0 += 6;
+        i1 += 6;
+        i2 += 6;
+
+        vo0x0c01234567 = _mm256_max_ps(vo0x0c01234567, vmin);
+        vo0x0c89ABCDEF = _mm256_max_ps(vo0x0c89ABCDEF, vmin);
+        vo0x0c01234567 = _mm256_min_ps(vo0x0c01234567, vmax);
+        vo0x0c89ABCDEF = _mm256_min_ps(vo0x0c89ABCDEF, vmax);
+
+        if XNN_LIKELY(c >= 16) {
+          _mm256_storeu_ps(o0, vo0x0c01234567);
+          _mm256_storeu_ps(o0 + 8, vo0x0c89ABCDEF);
+          o0 = (float*) ((uintptr_t) o0 + output_width_stride);
+        } else {
+          float* o0_tmp = o0;
+          if (c & 8) {
+            _mm256_storeu_ps((float*) ((uintptr_t) o0_tmp + output_width_stride * 0) + 0, vo0x0c01234567);
+            o0_tmp += 8;
+            vo0x0c01234567 = vo0x0c89ABCDEF;
+          }
+          __m128 vo0x0c0123 = _mm256_castps256_ps128(vo0x0c01234567);
+          if (c & 4) {
+            _mm_storeu_ps((float*) ((uintptr_t) o0_tmp + output_width_stride * 0), vo0x0c0123);
+            o0_tmp += 4;
+            vo0x0c0123 = _mm256_extractf128_ps(vo0x0c01234567, 1);
+          }
+          if (c & 2) {
+            _mm_storel_pi((__m64*) ((uintptr_t) o0_tmp + output_width_stride * 0), vo0x0c0123);
+            o0_tmp += 2;
+            vo0x0c0123 = _mm_movehl_ps(vo0x0c0123, vo0x0c0123);
+          }
+          if (c & 1) {
+            _mm_store_ss((float*) ((uintptr_t) o0_tmp + output_width_stride * 0), vo0x0c0123);
+          }
+          o0 = (float*) ((uintptr_t) o0 + output_width_stride);
+        }
+
+        vo0x0c01234567 = vo0x1c01234567;
+        vo0x0c89ABCDEF = vo0x1c89ABCDEF;
+      }
+      assert(iw < 2);
+      if XNN_UNLIKELY(iw != 0) {
+        // The last input column contributes through the center column of the kernel; the right column is padding.
+        const __m256 vk01c0x01234567 = _mm256_load_ps(w + 160);
+        const __m256 vk01c0x89ABCDEF = _mm256_load_ps(w + 168);
+        const __m256 vk11c0x01234567 = _mm256_load_ps(w + 176);
+        const __m256 vk11c0x89ABCDEF = _mm256_load_ps(w + 184);
+        const __m256 vk21c0x01234567 = _mm256_load_ps(w + 192);
+        const __m256 vk21c0x89ABCDEF = _mm256_load_ps(w + 200);
+
+        const __m256 vi0x0c0 = _mm256_broadcast_ss(i0 + 3);
+        vo0x0c01234567 = _mm256_add_ps(vo0x0c01234567, _mm256_mul_ps(vk01c0x01234567, vi0x0c0));
+        vo0x0c89ABCDEF = _mm256_add_ps(vo0x0c89ABCDEF, _mm256_mul_ps(vk01c0x89ABCDEF, vi0x0c0));
+        const __m256 vi1x0c0 = _mm256_broadcast_ss(i1 + 3);
+        vo0x0c01234567 = _mm256_add_ps(vo0x0c01234567, _mm256_mul_ps(vk11c0x01234567, vi1x0c0));
+        vo0x0c89ABCDEF = _mm256_add_ps(vo0x0c89ABCDEF, _mm256_mul_ps(vk11c0x89ABCDEF, vi1x0c0));
+        const __m256 vi2x0c0 = _mm256_broadcast_ss(i2 + 3);
+        vo0x0c01234567 = _mm256_add_ps(vo0x0c01234567, _mm256_mul_ps(vk21c0x01234567, vi2x0c0));
+        vo0x0c89ABCDEF = _mm256_add_ps(vo0x0c89ABCDEF, _mm256_mul_ps(vk21c0x89ABCDEF, vi2x0c0));
+        const __m256 vk01c1x01234567 = _mm256_load_ps(w + 208);
+        const __m256 vk01c1x89ABCDEF = _mm256_load_ps(w + 216);
+        const __m256 vk11c1x01234567 = _mm256_load_ps(w + 224);
+        const __m256 vk11c1x89ABCDEF = _mm256_load_ps(w + 232);
+        const __m256 vk21c1x01234567 = _mm256_load_ps(w + 240);
+        const __m256 vk21c1x89ABCDEF = _mm256_load_ps(w + 248);
+
+        const __m256 vi0x0c1 = _mm256_broadcast_ss(i0 + 4);
+        vo0x0c01234567 = _mm256_add_ps(vo0x0c01234567, _mm256_mul_ps(vk01c1x01234567, vi0x0c1));
+        vo0x0c89ABCDEF = _mm256_add_ps(vo0x0c89ABCDEF, _mm256_mul_ps(vk01c1x89ABCDEF, vi0x0c1));
+        const __m256 vi1x0c1 = _mm256_broadcast_ss(i1 + 4);
+        vo0x0c01234567 = _mm256_add_ps(vo0x0c01234567, _mm256_mul_ps(vk11c1x01234567, vi1x0c1));
+        vo0x0c89ABCDEF = _mm256_add_ps(vo0x0c89ABCDEF, _mm256_mul_ps(vk11c1x89ABCDEF, vi1x0c1));
+        const __m256 vi2x0c1 = _mm256_broadcast_ss(i2 + 4);
+        vo0x0c01234567 = _mm256_add_ps(vo0x0c01234567, _mm256_mul_ps(vk21c1x01234567, vi2x0c1));
+        vo0x0c89ABCDEF = _mm256_add_ps(vo0x0c89ABCDEF, _mm256_mul_ps(vk21c1x89ABCDEF, vi2x0c1));
+        const __m256 vk01c2x01234567 = _mm256_load_ps(w + 256);
+        const __m256 vk01c2x89ABCDEF = _mm256_load_ps(w + 264);
+        const __m256 vk11c2x01234567 = _mm256_load_ps(w + 272);
+        const __m256 vk11c2x89ABCDEF = _mm256_load_ps(w + 280);
+        const __m256 vk21c2x01234567 = _mm256_load_ps(w + 288);
+        const __m256 vk21c2x89ABCDEF = _mm256_load_ps(w + 296);
+
+        const __m256 vi0x0c2 = _mm256_broadcast_ss(i0 + 5);
+        vo0x0c01234567 = _mm256_add_ps(vo0x0c01234567, _mm256_mul_ps(vk01c2x01234567, vi0x0c2));
+        vo0x0c89ABCDEF = _mm256_add_ps(vo0x0c89ABCDEF, _mm256_mul_ps(vk01c2x89ABCDEF, vi0x0c2));
+        const __m256 vi1x0c2 = _mm256_broadcast_ss(i1 + 5);
+        vo0x0c01234567 = _mm256_add_ps(vo0x0c01234567, _mm256_mul_ps(vk11c2x01234567, vi1x0c2));
+        vo0x0c89ABCDEF = _mm256_add_ps(vo0x0c89ABCDEF, _mm256_mul_ps(vk11c2x89ABCDEF, vi1x0c2));
+        const __m256 vi2x0c2 = _mm256_broadcast_ss(i2 + 5);
+        vo0x0c01234567 = _mm256_add_ps(vo0x0c01234567, _mm256_mul_ps(vk21c2x01234567, vi2x0c2));
+        vo0x0c89ABCDEF = _mm256_add_ps(vo0x0c89ABCDEF, _mm256_mul_ps(vk21c2x89ABCDEF, vi2x0c2));
+
+        vo0x0c01234567 = _mm256_max_ps(vo0x0c01234567, vmin);
+        vo0x0c89ABCDEF = _mm256_max_ps(vo0x0c89ABCDEF, vmin);
+        vo0x0c01234567 = _mm256_min_ps(vo0x0c01234567, vmax);
+        vo0x0c89ABCDEF = _mm256_min_ps(vo0x0c89ABCDEF, vmax);
+
+        if XNN_LIKELY(c >= 16) {
+          _mm256_storeu_ps(o0, vo0x0c01234567);
+          _mm256_storeu_ps(o0 + 8, vo0x0c89ABCDEF);
+        } else {
+          float* o0_tmp = o0;
+          if (c & 8) {
+            _mm256_storeu_ps(o0_tmp + 0, vo0x0c01234567);
+            o0_tmp += 8;
+            vo0x0c01234567 = vo0x0c89ABCDEF;
+          }
+          __m128 vo0x0c0123 = _mm256_castps256_ps128(vo0x0c01234567);
+          if (c & 4) {
+            _mm_storeu_ps(o0_tmp, vo0x0c0123);
+            o0_tmp += 4;
+            vo0x0c0123 = _mm256_extractf128_ps(vo0x0c01234567, 1);
+          }
+          if (c & 2) {
+            _mm_storel_pi((__m64*) o0_tmp, vo0x0c0123);
+            o0_tmp += 2;
+            vo0x0c0123 = _mm_movehl_ps(vo0x0c0123, vo0x0c0123);
+          }
+          if (c & 1) {
+            _mm_store_ss(o0_tmp, vo0x0c0123);
+          }
+        }
+        o0 = (float*) ((uintptr_t) o0 + output_width_stride);
+      }
+      // Move output pointers back to the position of the first pixel in a row,
+      // and forward to the next block of output channels
+      o0 = (float*) ((uintptr_t) o0 - output_channel_decrement);
+      // Revert input pointers to the position of the first pixel in a row
+      i0 = (const float*) ((uintptr_t) i0 - input_width_decrement);
+      i1 = (const float*) ((uintptr_t) i1 - input_width_decrement);
+      i2 = (const float*) ((uintptr_t) i2 - input_width_decrement);
+      // Move to the block of weights for the next 16 output channels
+      w += 448;
+      c = doz(c, 16);
+    } while (c != 0);
+    // Move output pointers back to the position of the first channel, and forward to the next block of rows
+    o0 = (float*) ((uintptr_t) o0 + output_height_increment);
+    // Move input pointers forward to the next two rows
+    i0 = i2;
+    i1 = (const float*) ((uintptr_t) i0 + input_height_stride);
+    i2 = (const float*) ((uintptr_t) i1 + input_height_stride);
+  }
+}
+
+void xnn_f32_conv_hwc_ukernel_3x3s2p1c3x16__avx_1x1(
+    size_t input_height,
+    size_t input_width,
+    size_t output_y_start,
+    size_t output_y_end,
+    const float* input,
+    const float* zero,
+    const float* weights,
+    float* output,
+    size_t input_padding_top,
+    size_t output_channels,
+    size_t output_height_stride,
+    size_t output_width_stride,
+    const union xnn_f32_minmax_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(input_width != 0);
+  assert(output_y_end > output_y_start);
+  assert(input_padding_top <= 1);
+  assert(output_channels != 0);
+
+  const size_t input_height_stride = input_width * 3 /* channels */ * sizeof(float);
+  const size_t input_width_decrement = round_down_po2(input_width, 2) * 3 /* channels */ * sizeof(float);
+  const size_t output_width = (input_width + 1) / 2;
+  const size_t output_channel_decrement = output_width * output_width_stride - 16 * sizeof(float);
+  const size_t output_height_increment = output_height_stride * 1 - round_up_po2(output_channels, 16) * sizeof(float);
+
+  // Adjustment for padding processed below
+  const float* i0 = (const float*) ((uintptr_t) input +
+    input_height_stride * (output_y_start * 2 /* vertical stride */ - input_padding_top));
+  const float* i1 = (const float*) ((uintptr_t) i0 + input_height_stride);
+  const float* i2 = (const float*) ((uintptr_t) i1 + input_height_stride);
+  float* o0 = (float*) ((uintptr_t) output + output_height_stride * output_y_start);
+
+  if XNN_UNPREDICTABLE(output_y_start < input_padding_top) {
+    i0 = zero;
+  }
+
+  const __m256 vmin = _mm256_load_ps(params->avx.min);
+  const __m256 vmax = _mm256_load_ps(params->avx.max);
+
+  for (size_t output_y = output_y_start; output_y < output_y_end; output_y += 1) {
+    const size_t input_y2 = output_y * 2 + 2 - input_padding_top;
+    if XNN_UNPREDICTABLE(input_y2 >= input_height) {
+      i2 = zero;
+    }
+
+    const float* w = weights;
+    size_t c = output_channels;
+    do {
+      // voMx0 accumulates the leftmost output pixel of the next block. The input column to the left of it
+      // is either padding, or was already accumulated at the end of the previous block.
+      __m256 vo0x0c01234567 = _mm256_load_ps(w + 0);
+      __m256 vo0x0c89ABCDEF = _mm256_load_ps(w + 8);
+
+      size_t iw = input_width;
+      for (; iw >= 2; iw -= 2) {
+        __m256 vo0x1c01234567 = _mm256_load_ps(w + 0);
+        __m256 vo0x1c89ABCDEF = _mm256_load_ps(w + 8);
+
+        const __m256 vk01c0x01234567 = _mm256_load_ps(w + 160);
+        const __m256 vk01c0x89ABCDEF = _mm256_load_ps(w + 168);
+        const __m256 vk11c0x01234567 = _mm256_load_ps(w + 176);
+        const __m256 vk11c0x89ABCDEF = _mm256_load_ps(w + 184);
+        const __m256 vk21c0x01234567 = _mm256_load_ps(w + 192);
+        const __m256 vk21c0x89ABCDEF = _mm256_load_ps(w + 200);
+
+        const __m256 vi0x0c0 = _mm256_broadcast_ss(i0 + 0);
+        vo0x0c01234567 = _mm256_add_ps(vo0x0c01234567, _mm256_mul_ps(vk01c0x01234567, vi0x0c0));
+        vo0x0c89ABCDEF = _mm256_add_ps(vo0x0c89ABCDEF, _mm256_mul_ps(vk01c0x89ABCDEF, vi0x0c0));
+        const __m256 vi1x0c0 = _mm256_broadcast_ss(i1 + 0);
+        vo0x0c01234567 = _mm256_add_ps(vo0x0c01234567, _mm256_mul_ps(vk11c0x01234567, vi1x0c0));
+        vo0x0c89ABCDEF = _mm256_add_ps(vo0x0c89ABCDEF, _mm256_mul_ps(vk11c0x89ABCDEF, vi1x0c0));
+        const __m256 vi2x0c0 = _mm256_broadcast_ss(i2 + 0);
+        vo0x0c01234567 = _mm256_add_ps(vo0x0c01234567, _mm256_mul_ps(vk21c0x01234567, vi2x0c0));
+        vo0x0c89ABCDEF = _mm256_add_ps(vo0x0c89ABCDEF, _mm256_mul_ps(vk21c0x89ABCDEF, vi2x0c0));
+
+        const __m256 vk02c0x01234567 = _mm256_load_ps(w + 304);
+        const __m256 vk02c0x89ABCDEF = _mm256_load_ps(w + 312);
+        const __m256 vk12c0x01234567 = _mm256_load_ps(w + 320);
+        const __m256 vk12c0x89ABCDEF = _mm256_load_ps(w + 328);
+        const __m256 vk22c0x01234567 = _mm256_load_ps(w + 336);
+        const __m256 vk22c0x89ABCDEF = _mm256_load_ps(w + 344);
+        const __m256 vk00c0x01234567 = _mm256_load_ps(w + 16);
+        const __m256 vk00c0x89ABCDEF = _mm256_load_ps(w + 24);
+        const __m256 vk10c0x01234567 = _mm256_load_ps(w + 32);
+        const __m256 vk10c0x89ABCDEF = _mm256_load_ps(w + 40);
+        const __m256 vk20c0x01234567 = _mm256_load_ps(w + 48);
+        const __m256 vk20c0x89ABCDEF = _mm256_load_ps(w + 56);
+
+        const __m256 vi0x1c0 = _mm256_broadcast_ss(i0 + 3);
+        vo0x0c01234567 = _mm256_add_ps(vo0x0c01234567, _mm256_mul_ps(vk02c0x01234567, vi0x1c0));
+        vo0x0c89ABCDEF = _mm256_add_ps(vo0x0c89ABCDEF, _mm256_mul_ps(vk02c0x89ABCDEF, vi0x1c0));
+        vo0x1c01234567 = _mm256_add_ps(vo0x1c01234567, _mm256_mul_ps(vk00c0x01234567, vi0x1c0));
+        vo0x1c89ABCDEF = _mm256_add_ps(vo0x1c89ABCDEF, _mm256_mul_ps(vk00c0x89ABCDEF, vi0x1c0));
+        const __m256 vi1x1c0 = _mm256_broadcast_ss(i1 + 3);
+        vo0x0c01234567 = _mm256_add_ps(vo0x0c01234567, _mm256_mul_ps(vk12c0x01234567, vi1x1c0));
+        vo0x0c89ABCDEF = _mm256_add_ps(vo0x0c89ABCDEF, _mm256_mul_ps(vk12c0x89ABCDEF, vi1x1c0));
+        vo0x1c01234567 = _mm256_add_ps(vo0x1c01234567, _mm256_mul_ps(vk10c0x01234567, vi1x1c0));
+        vo0x1c89ABCDEF = _mm256_add_ps(vo0x1c89ABCDEF, _mm256_mul_ps(vk10c0x89ABCDEF, vi1x1c0));
+        const __m256 vi2x1c0 = _mm256_broadcast_ss(i2 + 3);
+        vo0x0c01234567 = _mm256_add_ps(vo0x0c01234567, _mm256_mul_ps(vk22c0x01234567, vi2x1c0));
+        vo0x0c89ABCDEF = _mm256_add_ps(vo0x0c89ABCDEF, _mm256_mul_ps(vk22c0x89ABCDEF, vi2x1c0));
+        vo0x1c01234567 = _mm256_add_ps(vo0x1c01234567, _mm256_mul_ps(vk20c0x01234567, vi2x1c0));
+        vo0x1c89ABCDEF = _mm256_add_ps(vo0x1c89ABCDEF, _mm256_mul_ps(vk20c0x89ABCDEF, vi2x1c0));
+        const __m256 vk01c1x01234567 = _mm256_load_ps(w + 208);
+        const __m256 vk01c1x89ABCDEF = _mm256_load_ps(w + 216);
+        const __m256 vk11c1x01234567 = _mm256_load_ps(w + 224);
+        const __m256 vk11c1x89ABCDEF = _mm256_load_ps(w + 232);
+        const __m256 vk21c1x01234567 = _mm256_load_ps(w + 240);
+        const __m256 vk21c1x89ABCDEF = _mm256_load_ps(w + 248);
+
+        const __m256 vi0x0c1 = _mm256_broadcast_ss(i0 + 1);
+        vo0x0c01234567 = _mm256_add_ps(vo0x0c01234567, _mm256_mul_ps(vk01c1x01234567, vi0x0c1));
+        vo0x0c89ABCDEF = _mm256_add_ps(vo0x0c89ABCDEF, _mm256_mul_ps(vk01c1x89ABCDEF, vi0x0c1));
+        const __m256 vi1x0c1 = _mm256_broadcast_ss(i1 + 1);
+        vo0x0c01234567 = _mm256_add_ps(vo0x0c01234567, _mm256_mul_ps(vk11c1x01234567, vi1x0c1));
+        vo0x0c89ABCDEF = _mm256_add_ps(vo0x0c89ABCDEF, _mm256_mul_ps(vk11c1x89ABCDEF, vi1x0c1));
+        const __m256 vi2x0c1 = _mm256_broadcast_ss(i2 + 1);
+        vo0x0c01234567 = _mm256_add_ps(vo0x0c01234567, _mm256_mul_ps(vk21c1x01234567, vi2x0c1));
+        vo0x0c89ABCDEF = _mm256_add_ps(vo0x0c89ABCDEF, _mm256_mul_ps(vk21c1x89ABCDEF, vi2x0c1));
+
+        const __m256 vk02c1x01234567 = _mm256_load_ps(w + 352);
+        const __m256 vk02c1x89ABCDEF = _mm256_load_ps(w + 360);
+        const __m256 vk12c1x01234567 = _mm256_load_ps(w + 368);
+        const __m256 vk12c1x89ABCDEF = _mm256_load_ps(w + 376);
+        const __m256 vk22c1x01234567 = _mm256_load_ps(w + 384);
+        const __m256 vk22c1x89ABCDEF = _mm256_load_ps(w + 392);
+        const __m256 vk00c1x01234567 = _mm256_load_ps(w + 64);
+        const __m256 vk00c1x89ABCDEF = _mm256_load_ps(w + 72);
+        const __m256 vk10c1x01234567 = _mm256_load_ps(w + 80);
+        const __m256 vk10c1x89ABCDEF = _mm256_load_ps(w + 88);
+        const __m256 vk20c1x01234567 = _mm256_load_ps(w + 96);
+        const __m256 vk20c1x89ABCDEF = _mm256_load_ps(w + 104);
+
+        const __m256 vi0x1c1 = _mm256_broadcast_ss(i0 + 4);
+        vo0x0c01234567 = _mm256_add_ps(vo0x0c01234567, _mm256_mul_ps(vk02c1x01234567, vi0x1c1));
+        vo0x0c89ABCDEF = _mm256_add_ps(vo0x0c89ABCDEF, _mm256_mul_ps(vk02c1x89ABCDEF, vi0x1c1));
+        vo0x1c01234567 = _mm256_add_ps(vo0x1c01234567, _mm256_mul_ps(vk00c1x01234567, vi0x1c1));
+        vo0x1c89ABCDEF = _mm256_add_ps(vo0x1c89ABCDEF, _mm256_mul_ps(vk00c1x89ABCDEF, vi0x1c1));
+        const __m256 vi1x1c1 = _mm256_broadcast_ss(i1 + 4);
+        vo0x0c01234567 = _mm256_add_ps(vo0x0c01234567, _mm256_mul_ps(vk12c1x01234567, vi1x1c1));
+        vo0x0c89ABCDEF = _mm256_add_ps(vo0x0c89ABCDEF, _mm256_mul_ps(vk12c1x89ABCDEF, vi1x1c1));
+        vo0x1c01234567 = _mm256_add_ps(vo0x1c01234567, _mm256_mul_ps(vk10c1x01234567, vi1x1c1));
+        vo0x1c89ABCDEF = _mm256_add_ps(vo0x1c89ABCDEF, _mm256_mul_ps(vk10c1x89ABCDEF, vi1x1c1));
+        const __m256 vi2x1c1 = _mm256_broadcast_ss(i2 + 4);
+        vo0x0c01234567 = _mm256_add_ps(vo0x0c01234567, _mm256_mul_ps(vk22c1x01234567, vi2x1c1));
+        vo0x0c89ABCDEF = _mm256_add_ps(vo0x0c89ABCDEF, _mm256_mul_ps(vk22c1x89ABCDEF, vi2x1c1));
+        vo0x1c01234567 = _mm256_add_ps(vo0x1c01234567, _mm256_mul_ps(vk20c1x01234567, vi2x1c1));
+        vo0x1c89ABCDEF = _mm256_add_ps(vo0x1c89ABCDEF, _mm256_mul_ps(vk20c1x89ABCDEF, vi2x1c1));
+        const __m256 vk01c2x01234567 = _mm256_load_ps(w + 256);
+        const __m256 vk01c2x89ABCDEF = _mm256_load_ps(w + 264);
+        const __m256 vk11c2x01234567 = _mm256_load_ps(w + 272);
+        const __m256 vk11c2x89ABCDEF = _mm256_load_ps(w + 280);
+        const __m256 vk21c2x01234567 = _mm256_load_ps(w + 288);
+        const __m256 vk21c2x89ABCDEF = _mm256_load_ps(w + 296);
+
+        const __m256 vi0x0c2 = _mm256_broadcast_ss(i0 + 2);
+        vo0x0c01234567 = _mm256_add_ps(vo0x0c01234567, _mm256_mul_ps(vk01c2x01234567, vi0x0c2));
+        vo0x0c89ABCDEF = _mm256_add_ps(vo0x0c89ABCDEF, _mm256_mul_ps(vk01c2x89ABCDEF, vi0x0c2));
+        const __m256 vi1x0c2 = _mm256_broadcast_ss(i1 + 2);
+        vo0x0c01234567 = _mm256_add_ps(vo0x0c01234567, _mm256_mul_ps(vk11c2x01234567, vi1x0c2));
+        vo0x0c89ABCDEF = _mm256_add_ps(vo0x0c89ABCDEF, _mm256_mul_ps(vk11c2x89ABCDEF, vi1x0c2));
+        const __m256 vi2x0c2 = _mm256_broadcast_ss(i2 + 2);
+        vo0x0c01234567 = _mm256_add_ps(vo0x0c01234567, _mm256_mul_ps(vk21c2x01234567, vi2x0c2));
+        vo0x0c89ABCDEF = _mm256_add_ps(vo0x0c89ABCDEF, _mm256_mul_ps(vk21c2x89ABCDEF, vi2x0c2));
+
+        const __m256 vk02c2x01234567 = _mm256_load_ps(w + 400);
+        const __m256 vk02c2x89ABCDEF = _mm256_load_ps(w + 408);
+        const __m256 vk12c2x01234567 = _mm256_load_ps(w + 416);
+        const __m256 vk12c2x89ABCDEF = _mm256_load_ps(w + 424);
+        const __m256 vk22c2x01234567 = _mm256_load_ps(w + 432);
+        const __m256 vk22c2x89ABCDEF = _mm256_load_ps(w + 440);
+        const __m256 vk00c2x01234567 = _mm256_load_ps(w + 112);
+        const __m256 vk00c2x89ABCDEF = _mm256_load_ps(w + 120);
+        const __m256 vk10c2x01234567 = _mm256_load_ps(w + 128);
+        const __m256 vk10c2x89ABCDEF = _mm256_load_ps(w + 136);
+        const __m256 vk20c2x01234567 = _mm256_load_ps(w + 144);
+        const __m256 vk20c2x89ABCDEF = _mm256_load_ps(w + 152);
+
+        const __m256 vi0x1c2 = _mm256_broadcast_ss(i0 + 5);
+        vo0x0c01234567 = _mm256_add_ps(vo0x0c01234567, _mm256_mul_ps(vk02c2x01234567, vi0x1c2));
+        vo0x0c89ABCDEF = _mm256_add_ps(vo0x0c89ABCDEF, _mm256_mul_ps(vk02c2x89ABCDEF, vi0x1c2));
+        vo0x1c01234567 = _mm256_add_ps(vo0x1c01234567, _mm256_mul_ps(vk00c2x01234567, vi0x1c2));
+        vo0x1c89ABCDEF = _mm256_add_ps(vo0x1c89ABCDEF, _mm256_mul_ps(vk00c2x89ABCDEF, vi0x1c2));
+        const __m256 vi1x1c2 = _mm256_broadcast_ss(i1 + 5);
+        vo0x0c01234567 = _mm256_add_ps(vo0x0c01234567, _mm256_mul_ps(vk12c2x01234567, vi1x1c2));
+        vo0x0c89ABCDEF = _mm256_add_ps(vo0x0c89ABCDEF, _mm256_mul_ps(vk12c2x89ABCDEF, vi1x1c2));
+        vo0x1c01234567 = _mm256_add_ps(vo0x1c01234567, _mm256_mul_ps(vk10c2x01234567, vi1x1c2));
+        vo0x1c89ABCDEF = _mm256_add_ps(vo0x1c89ABCDEF, _mm256_mul_ps(vk10c2x89ABCDEF, vi1x1c2));
+        const __m256 vi2x1c2 = _mm256_broadcast_ss(i2 + 5);
+        vo0x0c01234567 = _mm256_add_ps(vo0x0c01234567, _mm256_mul_ps(vk22c2x01234567, vi2x1c2));
+        vo0x0c89ABCDEF = _mm256_add_ps(vo0x0c89ABCDEF, _mm256_mul_ps(vk22c2x89ABCDEF, vi2x1c2));
+        vo0x1c01234567 = _mm256_add_ps(vo0x1c01234567, _mm256_mul_ps(vk20c2x01234567, vi2x1c2));
+        vo0x1c89ABCDEF = _mm256_add_ps(vo0x1c89ABCDEF, _mm256_mul_ps(vk20c2x89ABCDEF, vi2x1c2));
+
+        i0 += 6;
+        i1 += 6;
+        i2 += 6;
+
+        vo0x0c01234567 = _mm256_max_ps(vo0x0c01234567, vmin);
+        vo0x0c89ABCDEF = _mm256_max_ps(vo0x0c89ABCDEF, vmin);
+        vo0x0c01234567 = _mm256_min_ps(vo0x0c01234567, vmax);
+        vo0x0c89ABCDEF = _mm256_min_ps(vo0x0c89ABCDEF, vmax);
+
+        if XNN_LIKELY(c >= 16) {
+          _mm256_storeu_ps(o0, vo0x0c01234567);
+          _mm256_storeu_ps(o0 + 8, vo0x0c89ABCDEF);
+          o0 = (float*) ((uintptr_t) o0 + output_width_stride);
+        } else {
+          float* o0_tmp = o0;
+          if (c & 8) {
+            _mm256_storeu_ps((float*) ((uintptr_t) o0_tmp + output_width_stride * 0) + 0, vo0x0c01234567);
+            o0_tmp += 8;
+            vo0x0c01234567 = vo0x0c89ABCDEF;
+          }
+          __m128 vo0x0c0123 = _mm256_castps256_ps128(vo0x0c01234567);
+          if (c & 4) {
+            _mm_storeu_ps((float*) ((uintptr_t) o0_tmp + output_width_stride * 0), vo0x0c0123);
+            o0_tmp += 4;
+            vo0x0c0123 = _mm256_extractf128_ps(vo0x0c01234567, 1);
+          }
+          if (c & 2) {
+            _mm_storel_pi((__m64*) ((uintptr_t) o0_tmp + output_width_stride * 0), vo0x0c0123);
+            o0_tmp += 2;
+            vo0x0c0123 = _mm_movehl_ps(vo0x0c0123, vo0x0c0123);
+          }
+          if (c & 1) {
+            _mm_store_ss((float*) ((uintptr_t) o0_tmp + output_width_stride * 0), vo0x0c0123);
+          }
+          o0 = (float*) ((uintptr_t) o0 + output_width_stride);
+        }
+
+        vo0x0c01234567 = vo0x1c01234567;
+        vo0x0c89ABCDEF = vo0x1c89ABCDEF;
+      }
+      assert(iw < 2);
+      if XNN_UNLIKELY(iw != 0) {
+        // The last input column contributes through the center column of the kernel; the right column is padding.
+        const __m256 vk01c0x01234567 = _mm256_load_ps(w + 160);
+        const __m256 vk01c0x89ABCDEF = _mm256_load_ps(w + 168);
+        const __m256 vk11c0x01234567 = _mm256_load_ps(w + 176);
+        const __m256 vk11c0x89ABCDEF = _mm256_load_ps(w + 184);
+        const __m256 vk21c0x01234567 = _mm256_load_ps(w + 192);
+        const __m256 vk21c0x89ABCDEF = _mm256_load_ps(w + 200);
+
+        const __m256 vi0x0c0 = _mm256_broadcast_ss(i0 + 0);
+        vo0x0c01234567 = _mm256_add_ps(vo0x0c01234567, _mm256_mul_ps(vk01c0x01234567, vi0x0c0));
+        vo0x0c89ABCDEF = _mm256_add_ps(vo0x0c89ABCDEF, _mm256_mul_ps(vk01c0x89ABCDEF, vi0x0c0));
+        const __m256 vi1x0c0 = _mm256_broadcast_ss(i1 + 0);
+        vo0x0c01234567 = _mm256_add_ps(vo0x0c01234567, _mm256_mul_ps(vk11c0x01234567, vi1x0c0));
+        vo0x0c89ABCDEF = _mm256_add_ps(vo0x0c89ABCDEF, _mm256_mul_ps(vk11c0x89ABCDEF, vi1x0c0));
+        const __m256 vi2x0c0 = _mm256_broadcast_ss(i2 + 0);
+        vo0x0c01234567 = _mm256_add_ps(vo0x0c01234567, _mm256_mul_ps(vk21c0x01234567, vi2x0c0));
+        vo0x0c89ABCDEF = _mm256_add_ps(vo0x0c89ABCDEF, _mm256_mul_ps(vk21c0x89ABCDEF, vi2x0c0));
+        const __m256 vk01c1x01234567 = _mm256_load_ps(w + 208);
+        const __m256 vk01c1x89ABCDEF = _mm256_load_ps(w + 216);
+        const __m256 vk11c1x01234567 = _mm256_load_ps(w + 224);
+        const __m256 vk11c1x89ABCDEF = _mm256_load_ps(w + 232);
+        const __m256 vk21c1x01234567 = _mm256_load_ps(w + 240);
+        const __m256 vk21c1x89ABCDEF = _mm256_load_ps(w + 248);
+
+        const __m256 vi0x0c1 = _mm256_broadcast_ss(i0 + 1);
+        vo0x0c01234567 = _mm256_add_ps(vo0x0c01234567, _mm256_mul_ps(vk01c1x01234567, vi0x0c1));
+        vo0x0c89ABCDEF = _mm256_add_ps(vo0x0c89ABCDEF, _mm256_mul_ps(vk01c1x89ABCDEF, vi0x0c1));
+        const __m256 vi1x0c1 = _mm256_broadcast_ss(i1 + 1);
+        vo0x0c01234567 = _mm256_add_ps(vo0x0c01234567, _mm256_mul_ps(vk11c1x01234567, vi1x0c1));
+        vo0x0c89ABCDEF = _mm256_add_ps(vo0x0c89ABCDEF, _mm256_mul_ps(vk11c1x89ABCDEF, vi1x0c1));
+        const __m256 vi2x0c1 = _mm256_broadcast_ss(i2 + 1);
+        vo0x0c01234567 = _mm256_add_ps(vo0x0c01234567, _mm256_mul_ps(vk21c1x01234567, vi2x0c1));
+        vo0x0c89ABCDEF = _mm256_add_ps(vo0x0c89ABCDEF, _mm256_mul_ps(vk21c1x89ABCDEF, vi2x0c1));
+        const __m256 vk01c2x01234567 = _mm256_load_ps(w + 256);
+        const __m256 vk01c2x89ABCDEF = _mm256_load_ps(w + 264);
+        const __m256 vk11c2x01234567 = _mm256_load_ps(w + 272);
+        const __m256 vk11c2x89ABCDEF = _mm256_load_ps(w + 280);
+        const __m256 vk21c2x01234567 = _mm256_load_ps(w + 288);
+        const __m256 vk21c2x89ABCDEF = _mm256_load_ps(w + 296);
+
+        const __m256 vi0x0c2 = _mm256_broadcast_ss(i0 + 2);
+        vo0x0c01234567 = _mm256_add_ps(vo0x0c01234567, _mm256_mul_ps(vk01c2x01234567, vi0x0c2));
+        vo0x0c89ABCDEF = _mm256_add_ps(vo0x0c89ABCDEF, _mm256_mul_ps(vk01c2x89ABCDEF, vi0x0c2));
+        const __m256 vi1x0c2 = _mm256_broadcast_ss(i1 + 2);
+        vo0x0c01234567 = _mm256_add_ps(vo0x0c01234567, _mm256_mul_ps(vk11c2x01234567, vi1x0c2));
+        vo0x0c89ABCDEF = _mm256_add_ps(vo0x0c89ABCDEF, _mm256_mul_ps(vk11c2x89ABCDEF, vi1x0c2));
+        const __m256 vi2x0c2 = _mm256_broadcast_ss(i2 + 2);
+        vo0x0c01234567 = _mm256_add_ps(vo0x0c01234567, _mm256_mul_ps(vk21c2x01234567, vi2x0c2));
+        vo0x0c89ABCDEF = _mm256_add_ps(vo0x0c89ABCDEF, _mm256_mul_ps(vk21c2x89ABCDEF, vi2x0c2));
+
+        vo0x0c01234567 = _mm256_max_ps(vo0x0c01234567, vmin);
+        vo0x0c89ABCDEF = _mm256_max_ps(vo0x0c89ABCDEF, vmin);
+        vo0x0c01234567 = _mm256_min_ps(vo0x0c01234567, vmax);
+        vo0x0c89ABCDEF = _mm256_min_ps(vo0x0c89ABCDEF, vmax);
+
+        if XNN_LIKELY(c >= 16) {
+          _mm256_storeu_ps(o0, vo0x0c01234567);
+          _mm256_storeu_ps(o0 + 8, vo0x0c89ABCDEF);
+        } else {
+          float* o0_tmp = o0;
+          if (c & 8) {
+            _mm256_storeu_ps(o0_tmp + 0, vo0x0c01234567);
+            o0_tmp += 8;
+            vo0x0c01234567 = vo0x0c89ABCDEF;
+          }
+          __m128 vo0x0c0123 = _mm256_castps256_ps128(vo0x0c01234567);
+          if (c & 4) {
+            _mm_storeu_ps(o0_tmp, vo0x0c0123);
+            o0_tmp += 4;
+            vo0x0c0123 = _mm256_extractf128_ps(vo0x0c01234567, 1);
+          }
+          if (c & 2) {
+            _mm_storel_pi((__m64*) o0_tmp, vo0x0c0123);
+            o0_tmp += 2;
+            vo0x0c0123 = _mm_movehl_ps(vo0x0c0123, vo0x0c0123);
+          }
+          if (c & 1) {
+            _mm_store_ss(o0_tmp, vo0x0c0123);
+          }
+        }
+        o0 = (float*) ((uintptr_t) o0 + output_width_stride);
+      }
+      // Move output pointers back to the position of the first pixel in a row,
+      // and forward to the next block of output channels
+      o0 = (float*) ((uintptr_t) o0 - output_channel_decrement);
+      // Revert input pointers to the position of the first pixel in a row
+      i0 = (const float*) ((uintptr_t) i0 - input_width_decrement);
+      i1 = (const float*) ((uintptr_t) i1 - input_width_decrement);
+      i2 = (const float*) ((uintptr_t) i2 - input_width_decrement);
+      // Move to the block of weights for the next 16 output channels
+      w += 448;
+      c = doz(c, 16);
+    } while (c != 0);
+    // Move output pointers back to the position of the first channel, and forward to the next block of rows
+    o0 = (float*) ((uintptr_t) o0 + output_height_increment);
+    // Move input pointers forward to the next two rows
+    i0 = i2;
+    i1 = (const float*) ((uintptr_t) i0 + input_height_stride);
+    i2 = (const float*) ((uintptr_t) i1 + input_height_stride);
+  }
+}
+
 void xnn_f32_dwconv_minmax_ukernel_up16x3__avx(
     size_t channels,
     size_t output_width,
@@ -1229,6 +1940,1716 @@ void xnn_f32_dwconv_minmax_ukernel_up8x25__avx(
   } while (--output_width != 0);
 }
 
+void xnn_f32_dwconv2d_chw_ukernel_3x3p1__avx_4x8(
+    size_t input_height,
+    size_t input_width,
+    const float* input,
+    const float* weights,
+    const float* zero,
+    float* output,
+    uint32_t padding_top,
+    const union xnn_f32_chw_params params[restrict XNN_MIN_ELEMENTS(1)]) XNN_OOB_READS
+{
+  assert(input_height != 0);
+  assert(input_width != 0);
+  assert(input_width % sizeof(float) == 0);
+  assert(padding_top == 1);
+
+  const __m256 vmask = _mm256_load_ps((const float*) params->sse.mask8);
+  const __m256 vmax = _mm256_broadcast_ss(params->sse.max);
+  const __m256 vmin = _mm256_broadcast_ss(params->sse.min);
+
+  const __m256 vbias = _mm256_broadcast_ss(weights);
+  const __m256 vk00 = _mm256_broadcast_ss(weights + 1);
+  const __m256 vk01 = _mm256_broadcast_ss(weights + 2);
+  const __m256 vk02 = _mm256_broadcast_ss(weights + 3);
+  const __m256 vk10 = _mm256_broadcast_ss(weights + 4);
+  const __m256 vk11 = _mm256_broadcast_ss(weights + 5);
+  const __m256 vk12 = _mm256_broadcast_ss(weights + 6);
+  const __m256 vk20 = _mm256_broadcast_ss(weights + 7);
+  const __m256 vk21 = _mm256_broadcast_ss(weights + 8);
+  const __m256 vk22 = _mm256_broadcast_ss(weights + 9);
+
+  const size_t input_decrement = round_up_po2(input_width, 8 * sizeof(float));
+
+  const float* i0 = zero;
+  const float* i1 = input;
+  const float* i2 = (const float*) ((uintptr_t) i1 + input_width);
+  const float* i3 = (const float*) ((uintptr_t) i2 + input_width);
+  const float* i4 = (const float*) ((uintptr_t) i3 + input_width);
+  const float* i5 = (const float*) ((uintptr_t) i4 + input_width);
+
+  float* o0 = output;
+  float* o1 = (float*) ((uintptr_t) o0 + input_width);
+  float* o2 = (float*) ((uintptr_t) o1 + input_width);
+  float* o3 = (float*) ((uintptr_t) o2 + input_width);
+
+  size_t output_height = input_height;
+  do {
+    if XNN_UNPREDICTABLE(output_height < 2) {
+      i2 = zero;
+      o1 = o0;
+    }
+    if XNN_UNPREDICTABLE(output_height < 3) {
+      i3 = zero;
+      o2 = o1;
+    }
+    if XNN_UNPREDICTABLE(output_height < 4) {
+      i4 = zero;
+      o3 = o2;
+    }
+    if XNN_UNPREDICTABLE(output_height < 5) {
+      i5 = zero;
+    }
+
+    __m256 vi0x89ABCDEF = _mm256_loadu_ps(i0);
+    i0 += 8;
+    __m256 vi1x89ABCDEF = _mm256_loadu_ps(i1);
+    i1 += 8;
+    __m256 vi2x89ABCDEF = _mm256_loadu_ps(i2);
+    i2 += 8;
+    __m256 vi3x89ABCDEF = _mm256_loadu_ps(i3);
+    i3 += 8;
+    __m256 vi4x89ABCDEF = _mm256_loadu_ps(i4);
+    i4 += 8;
+    __m256 vi5x89ABCDEF = _mm256_loadu_ps(i5);
+    i5 += 8;
+
+    // vi0x456789AB = ( vi0B, vi0A, vi09, vi08, 0.0, 0.0, 0.0, 0.0 )
+    __m256 vi0x456789AB = _mm256_permute2f128_ps(vi0x89ABCDEF, vi0x89ABCDEF, 0x08);
+    // vi1x456789AB = ( vi1B, vi1A, vi19, vi18, 0.0, 0.0, 0.0, 0.0 )
+    __m256 vi1x456789AB = _mm256_permute2f128_ps(vi1x89ABCDEF, vi1x89ABCDEF, 0x08);
+    // vi2x456789AB = ( vi2B, vi2A, vi29, vi28, 0.0, 0.0, 0.0, 0.0 )
+    __m256 vi2x456789AB = _mm256_permute2f128_ps(vi2x89ABCDEF, vi2x89ABCDEF, 0x08);
+    // vi3x456789AB = ( vi3B, vi3A, vi39, vi38, 0.0, 0.0, 0.0, 0.0 )
+    __m256 vi3x456789AB = _mm256_permute2f128_ps(vi3x89ABCDEF, vi3x89ABCDEF, 0x08);
+    // vi4x456789AB = ( vi4B, vi4A, vi49, vi48, 0.0, 0.0, 0.0, 0.0 )
+    __m256 vi4x456789AB = _mm256_permute2f128_ps(vi4x89ABCDEF, vi4x89ABCDEF, 0x08);
+    // vi5x456789AB = ( vi5B, vi5A, vi59, vi58, 0.0, 0.0, 0.0, 0.0 )
+    __m256 vi5x456789AB = _mm256_permute2f128_ps(vi5x89ABCDEF, vi5x89ABCDEF, 0x08);
+
+    size_t w = input_width;
+    for (; w > 8 * sizeof(float); w -= 8 * sizeof(float)) {
+      const __m256 vi0xGHIJKLMN = _mm256_loadu_ps(i0);
+      i0 += 8;
+      const __m256 vi1xGHIJKLMN = _mm256_loadu_ps(i1);
+      i1 += 8;
+      const __m256 vi2xGHIJKLMN = _mm256_loadu_ps(i2);
+      i2 += 8;
+      const __m256 vi3xGHIJKLMN = _mm256_loadu_ps(i3);
+      i3 += 8;
+      const __m256 vi4xGHIJKLMN = _mm256_loadu_ps(i4);
+      i4 += 8;
+      const __m256 vi5xGHIJKLMN = _mm256_loadu_ps(i5);
+      i5 += 8;
+
+      __m256 vo0p0 = _mm256_add_ps(vbias, _mm256_mul_ps(vi0x89ABCDEF, vk01));
+      __m256 vo1p0 = _mm256_add_ps(vbias, _mm256_mul_ps(vi1x89ABCDEF, vk01));
+      __m256 vo2p0 = _mm256_add_ps(vbias, _mm256_mul_ps(vi2x89ABCDEF, vk01));
+      __m256 vo3p0 = _mm256_add_ps(vbias, _mm256_mul_ps(vi3x89ABCDEF, vk01));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi1x89ABCDEF, vk11));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi2x89ABCDEF, vk11));
+      vo2p0 = _mm256_add_ps(vo2p0, _mm256_mul_ps(vi3x89ABCDEF, vk11));
+      vo3p0 = _mm256_add_ps(vo3p0, _mm256_mul_ps(vi4x89ABCDEF, vk11));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi2x89ABCDEF, vk21));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi3x89ABCDEF, vk21));
+      vo2p0 = _mm256_add_ps(vo2p0, _mm256_mul_ps(vi4x89ABCDEF, vk21));
+      vo3p0 = _mm256_add_ps(vo3p0, _mm256_mul_ps(vi5x89ABCDEF, vk21));
+
+      const __m256 vi0x789ABCDE = _mm256_permute_ps(_mm256_blend_ps(vi0x89ABCDEF, vi0x456789AB, 0x88), _MM_SHUFFLE(2, 1, 0, 3));
+      const __m256 vi1x789ABCDE = _mm256_permute_ps(_mm256_blend_ps(vi1x89ABCDEF, vi1x456789AB, 0x88), _MM_SHUFFLE(2, 1, 0, 3));
+      const __m256 vi2x789ABCDE = _mm256_permute_ps(_mm256_blend_ps(vi2x89ABCDEF, vi2x456789AB, 0x88), _MM_SHUFFLE(2, 1, 0, 3));
+      const __m256 vi3x789ABCDE = _mm256_permute_ps(_mm256_blend_ps(vi3x89ABCDEF, vi3x456789AB, 0x88), _MM_SHUFFLE(2, 1, 0, 3));
+      const __m256 vi4x789ABCDE = _mm256_permute_ps(_mm256_blend_ps(vi4x89ABCDEF, vi4x456789AB, 0x88), _MM_SHUFFLE(2, 1, 0, 3));
+      const __m256 vi5x789ABCDE = _mm256_permute_ps(_mm256_blend_ps(vi5x89ABCDEF, vi5x456789AB, 0x88), _MM_SHUFFLE(2, 1, 0, 3));
+
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi0x789ABCDE, vk00));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi1x789ABCDE, vk00));
+      vo2p0 = _mm256_add_ps(vo2p0, _mm256_mul_ps(vi2x789ABCDE, vk00));
+      vo3p0 = _mm256_add_ps(vo3p0, _mm256_mul_ps(vi3x789ABCDE, vk00));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi1x789ABCDE, vk10));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi2x789ABCDE, vk10));
+      vo2p0 = _mm256_add_ps(vo2p0, _mm256_mul_ps(vi3x789ABCDE, vk10));
+      vo3p0 = _mm256_add_ps(vo3p0, _mm256_mul_ps(vi4x789ABCDE, vk10));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi2x789ABCDE, vk20));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi3x789ABCDE, vk20));
+      vo2p0 = _mm256_add_ps(vo2p0, _mm256_mul_ps(vi4x789ABCDE, vk20));
+      vo3p0 = _mm256_add_ps(vo3p0, _mm256_mul_ps(vi5x789ABCDE, vk20));
+
+      const __m256 vi0xCDEFGHIJ = _mm256_permute2f128_ps(vi0x89ABCDEF, vi0xGHIJKLMN, 0x21);
+      const __m256 vi1xCDEFGHIJ = _mm256_permute2f128_ps(vi1x89ABCDEF, vi1xGHIJKLMN, 0x21);
+      const __m256 vi2xCDEFGHIJ = _mm256_permute2f128_ps(vi2x89ABCDEF, vi2xGHIJKLMN, 0x21);
+      const __m256 vi3xCDEFGHIJ = _mm256_permute2f128_ps(vi3x89ABCDEF, vi3xGHIJKLMN, 0x21);
+      const __m256 vi4xCDEFGHIJ = _mm256_permute2f128_ps(vi4x89ABCDEF, vi4xGHIJKLMN, 0x21);
+      const __m256 vi5xCDEFGHIJ = _mm256_permute2f128_ps(vi5x89ABCDEF, vi5xGHIJKLMN, 0x21);
+
+      const __m256 vi0x9ABCDEFG = _mm256_permute_ps(_mm256_blend_ps(vi0x89ABCDEF, vi0xCDEFGHIJ, 0x11), _MM_SHUFFLE(0, 3, 2, 1));
+      vi0x456789AB = vi0xCDEFGHIJ;
+      vi0x89ABCDEF = vi0xGHIJKLMN;
+      const __m256 vi1x9ABCDEFG = _mm256_permute_ps(_mm256_blend_ps(vi1x89ABCDEF, vi1xCDEFGHIJ, 0x11), _MM_SHUFFLE(0, 3, 2, 1));
+      vi1x456789AB = vi1xCDEFGHIJ;
+      vi1x89ABCDEF = vi1xGHIJKLMN;
+      const __m256 vi2x9ABCDEFG = _mm256_permute_ps(_mm256_blend_ps(vi2x89ABCDEF, vi2xCDEFGHIJ, 0x11), _MM_SHUFFLE(0, 3, 2, 1));
+      vi2x456789AB = vi2xCDEFGHIJ;
+      vi2x89ABCDEF = vi2xGHIJKLMN;
+      const __m256 vi3x9ABCDEFG = _mm256_permute_ps(_mm256_blend_ps(vi3x89ABCDEF, vi3xCDEFGHIJ, 0x11), _MM_SHUFFLE(0, 3, 2, 1));
+      vi3x456789AB = vi3xCDEFGHIJ;
+      vi3x89ABCDEF = vi3xGHIJKLMN;
+      const __m256 vi4x9ABCDEFG = _mm256_permute_ps(_mm256_blend_ps(vi4x89ABCDEF, vi4xCDEFGHIJ, 0x11), _MM_SHUFFLE(0, 3, 2, 1));
+      vi4x456789AB = vi4xCDEFGHIJ;
+      vi4x89ABCDEF = vi4xGHIJKLMN;
+      const __m256 vi5x9ABCDEFG = _mm256_permute_ps(_mm256_blend_ps(vi5x89ABCDEF, vi5xCDEFGHIJ, 0x11), _MM_SHUFFLE(0, 3, 2, 1));
+      vi5x456789AB = vi5xCDEFGHIJ;
+      vi5x89ABCDEF = vi5xGHIJKLMN;
+
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi0x9ABCDEFG, vk02));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi1x9ABCDEFG, vk02));
+      vo2p0 = _mm256_add_ps(vo2p0, _mm256_mul_ps(vi2x9ABCDEFG, vk02));
+      vo3p0 = _mm256_add_ps(vo3p0, _mm256_mul_ps(vi3x9ABCDEFG, vk02));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi1x9ABCDEFG, vk12));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi2x9ABCDEFG, vk12));
+      vo2p0 = _mm256_add_ps(vo2p0, _mm256_mul_ps(vi3x9ABCDEFG, vk12));
+      vo3p0 = _mm256_add_ps(vo3p0, _mm256_mul_ps(vi4x9ABCDEFG, vk12));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi2x9ABCDEFG, vk22));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi3x9ABCDEFG, vk22));
+      vo2p0 = _mm256_add_ps(vo2p0, _mm256_mul_ps(vi4x9ABCDEFG, vk22));
+      vo3p0 = _mm256_add_ps(vo3p0, _mm256_mul_ps(vi5x9ABCDEFG, vk22));
+
+
+      __m256 vo0 = _mm256_max_ps(vo0p0, vmin);
+      __m256 vo1 = _mm256_max_ps(vo1p0, vmin);
+      __m256 vo2 = _mm256_max_ps(vo2p0, vmin);
+      __m256 vo3 = _mm256_max_ps(vo3p0, vmin);
+
+      vo0 = _mm256_min_ps(vo0, vmax);
+      vo1 = _mm256_min_ps(vo1, vmax);
+      vo2 = _mm256_min_ps(vo2, vmax);
+      vo3 = _mm256_min_ps(vo3, vmax);
+
+      _mm256_storeu_ps(o3, vo3);
+      o3 += 8;
+      _mm256_storeu_ps(o2, vo2);
+      o2 += 8;
+      _mm256_storeu_ps(o1, vo1);
+      o1 += 8;
+      _mm256_storeu_ps(o0, vo0);
+      o0 += 8;
+    }
+    // Always process the last block of 1..8 pixels.
+    assert(w >= 1 * sizeof(float));
+    assert(w <= 8 * sizeof(float));
+    {
+      vi0x89ABCDEF = _mm256_and_ps(vmask, vi0x89ABCDEF);
+      vi1x89ABCDEF = _mm256_and_ps(vmask, vi1x89ABCDEF);
+      vi2x89ABCDEF = _mm256_and_ps(vmask, vi2x89ABCDEF);
+      vi3x89ABCDEF = _mm256_and_ps(vmask, vi3x89ABCDEF);
+      vi4x89ABCDEF = _mm256_and_ps(vmask, vi4x89ABCDEF);
+      vi5x89ABCDEF = _mm256_and_ps(vmask, vi5x89ABCDEF);
+
+      __m256 vo0p0 = _mm256_add_ps(vbias, _mm256_mul_ps(vi0x89ABCDEF, vk01));
+      __m256 vo1p0 = _mm256_add_ps(vbias, _mm256_mul_ps(vi1x89ABCDEF, vk01));
+      __m256 vo2p0 = _mm256_add_ps(vbias, _mm256_mul_ps(vi2x89ABCDEF, vk01));
+      __m256 vo3p0 = _mm256_add_ps(vbias, _mm256_mul_ps(vi3x89ABCDEF, vk01));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi1x89ABCDEF, vk11));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi2x89ABCDEF, vk11));
+      vo2p0 = _mm256_add_ps(vo2p0, _mm256_mul_ps(vi3x89ABCDEF, vk11));
+      vo3p0 = _mm256_add_ps(vo3p0, _mm256_mul_ps(vi4x89ABCDEF, vk11));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi2x89ABCDEF, vk21));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi3x89ABCDEF, vk21));
+      vo2p0 = _mm256_add_ps(vo2p0, _mm256_mul_ps(vi4x89ABCDEF, vk21));
+      vo3p0 = _mm256_add_ps(vo3p0, _mm256_mul_ps(vi5x89ABCDEF, vk21));
+
+      const __m256 vi0x789ABCDE = _mm256_permute_ps(_mm256_blend_ps(vi0x89ABCDEF, vi0x456789AB, 0x88), _MM_SHUFFLE(2, 1, 0, 3));
+      const __m256 vi1x789ABCDE = _mm256_permute_ps(_mm256_blend_ps(vi1x89ABCDEF, vi1x456789AB, 0x88), _MM_SHUFFLE(2, 1, 0, 3));
+      const __m256 vi2x789ABCDE = _mm256_permute_ps(_mm256_blend_ps(vi2x89ABCDEF, vi2x456789AB, 0x88), _MM_SHUFFLE(2, 1, 0, 3));
+      const __m256 vi3x789ABCDE = _mm256_permute_ps(_mm256_blend_ps(vi3x89ABCDEF, vi3x456789AB, 0x88), _MM_SHUFFLE(2, 1, 0, 3));
+      const __m256 vi4x789ABCDE = _mm256_permute_ps(_mm256_blend_ps(vi4x89ABCDEF, vi4x456789AB, 0x88), _MM_SHUFFLE(2, 1, 0, 3));
+      const __m256 vi5x789ABCDE = _mm256_permute_ps(_mm256_blend_ps(vi5x89ABCDEF, vi5x456789AB, 0x88), _MM_SHUFFLE(2, 1, 0, 3));
+
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi0x789ABCDE, vk00));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi1x789ABCDE, vk00));
+      vo2p0 = _mm256_add_ps(vo2p0, _mm256_mul_ps(vi2x789ABCDE, vk00));
+      vo3p0 = _mm256_add_ps(vo3p0, _mm256_mul_ps(vi3x789ABCDE, vk00));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi1x789ABCDE, vk10));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi2x789ABCDE, vk10));
+      vo2p0 = _mm256_add_ps(vo2p0, _mm256_mul_ps(vi3x789ABCDE, vk10));
+      vo3p0 = _mm256_add_ps(vo3p0, _mm256_mul_ps(vi4x789ABCDE, vk10));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi2x789ABCDE, vk20));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi3x789ABCDE, vk20));
+      vo2p0 = _mm256_add_ps(vo2p0, _mm256_mul_ps(vi4x789ABCDE, vk20));
+      vo3p0 = _mm256_add_ps(vo3p0, _mm256_mul_ps(vi5x789ABCDE, vk20));
+
+      // vi0xCDEFGHIJ = ( 0.0, 0.0, 0.0, 0.0, vi0F, vi0E, vi0D, vi0C )
+      const __m256 vi0xCDEFGHIJ = _mm256_permute2f128_ps(vi0x89ABCDEF, vi0x89ABCDEF, 0x81);
+      // vi1xCDEFGHIJ = ( 0.0, 0.0, 0.0, 0.0, vi1F, vi1E, vi1D, vi1C )
+      const __m256 vi1xCDEFGHIJ = _mm256_permute2f128_ps(vi1x89ABCDEF, vi1x89ABCDEF, 0x81);
+      // vi2xCDEFGHIJ = ( 0.0, 0.0, 0.0, 0.0, vi2F, vi2E, vi2D, vi2C )
+      const __m256 vi2xCDEFGHIJ = _mm256_permute2f128_ps(vi2x89ABCDEF, vi2x89ABCDEF, 0x81);
+      // vi3xCDEFGHIJ = ( 0.0, 0.0, 0.0, 0.0, vi3F, vi3E, vi3D, vi3C )
+      const __m256 vi3xCDEFGHIJ = _mm256_permute2f128_ps(vi3x89ABCDEF, vi3x89ABCDEF, 0x81);
+      // vi4xCDEFGHIJ = ( 0.0, 0.0, 0.0, 0.0, vi4F, vi4E, vi4D, vi4C )
+      const __m256 vi4xCDEFGHIJ = _mm256_permute2f128_ps(vi4x89ABCDEF, vi4x89ABCDEF, 0x81);
+      // vi5xCDEFGHIJ = ( 0.0, 0.0, 0.0, 0.0, vi5F, vi5E, vi5D, vi5C )
+      const __m256 vi5xCDEFGHIJ = _mm256_permute2f128_ps(vi5x89ABCDEF, vi5x89ABCDEF, 0x81);
+
+      const __m256 vi0x9ABCDEFG = _mm256_permute_ps(_mm256_blend_ps(vi0x89ABCDEF, vi0xCDEFGHIJ, 0x11), _MM_SHUFFLE(0, 3, 2, 1));
+      const __m256 vi1x9ABCDEFG = _mm256_permute_ps(_mm256_blend_ps(vi1x89ABCDEF, vi1xCDEFGHIJ, 0x11), _MM_SHUFFLE(0, 3, 2, 1));
+      const __m256 vi2x9ABCDEFG = _mm256_permute_ps(_mm256_blend_ps(vi2x89ABCDEF, vi2xCDEFGHIJ, 0x11), _MM_SHUFFLE(0, 3, 2, 1));
+      const __m256 vi3x9ABCDEFG = _mm256_permute_ps(_mm256_blend_ps(vi3x89ABCDEF, vi3xCDEFGHIJ, 0x11), _MM_SHUFFLE(0, 3, 2, 1));
+      const __m256 vi4x9ABCDEFG = _mm256_permute_ps(_mm256_blend_ps(vi4x89ABCDEF, vi4xCDEFGHIJ, 0x11), _MM_SHUFFLE(0, 3, 2, 1));
+      const __m256 vi5x9ABCDEFG = _mm256_permute_ps(_mm256_blend_ps(vi5x89ABCDEF, vi5xCDEFGHIJ, 0x11), _MM_SHUFFLE(0, 3, 2, 1));
+
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi0x9ABCDEFG, vk02));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi1x9ABCDEFG, vk02));
+      vo2p0 = _mm256_add_ps(vo2p0, _mm256_mul_ps(vi2x9ABCDEFG, vk02));
+      vo3p0 = _mm256_add_ps(vo3p0, _mm256_mul_ps(vi3x9ABCDEFG, vk02));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi1x9ABCDEFG, vk12));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi2x9ABCDEFG, vk12));
+      vo2p0 = _mm256_add_ps(vo2p0, _mm256_mul_ps(vi3x9ABCDEFG, vk12));
+      vo3p0 = _mm256_add_ps(vo3p0, _mm256_mul_ps(vi4x9ABCDEFG, vk12));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi2x9ABCDEFG, vk22));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi3x9ABCDEFG, vk22));
+      vo2p0 = _mm256_add_ps(vo2p0, _mm256_mul_ps(vi4x9ABCDEFG, vk22));
+      vo3p0 = _mm256_add_ps(vo3p0, _mm256_mul_ps(vi5x9ABCDEFG, vk22));
+
+
+      __m256 vo0 = _mm256_max_ps(vo0p0, vmin);
+      __m256 vo1 = _mm256_max_ps(vo1p0, vmin);
+      __m256 vo2 = _mm256_max_ps(vo2p0, vmin);
+      __m256 vo3 = _mm256_max_ps(vo3p0, vmin);
+
+      vo0 = _mm256_min_ps(vo0, vmax);
+      vo1 = _mm256_min_ps(vo1, vmax);
+      vo2 = _mm256_min_ps(vo2, vmax);
+      vo3 = _mm256_min_ps(vo3, vmax);
+
+      if XNN_LIKELY(w == 8 * sizeof(float)) {
+        _mm256_storeu_ps(o3, vo3);
+        o3 += 8;
+        _mm256_storeu_ps(o2, vo2);
+        o2 += 8;
+        _mm256_storeu_ps(o1, vo1);
+        o1 += 8;
+        _mm256_storeu_ps(o0, vo0);
+        o0 += 8;
+      } else {
+        __m128 vo3_lo = _mm256_castps256_ps128(vo3);
+        __m128 vo2_lo = _mm256_castps256_ps128(vo2);
+        __m128 vo1_lo = _mm256_castps256_ps128(vo1);
+        __m128 vo0_lo = _mm256_castps256_ps128(vo0);
+        if (w & (4 * sizeof(float))) {
+          _mm_storeu_ps(o3, vo3_lo);
+          o3 += 4;
+          _mm_storeu_ps(o2, vo2_lo);
+          o2 += 4;
+          _mm_storeu_ps(o1, vo1_lo);
+          o1 += 4;
+          _mm_storeu_ps(o0, vo0_lo);
+          o0 += 4;
+
+          vo0_lo = _mm256_extractf128_ps(vo0, 1);
+          vo1_lo = _mm256_extractf128_ps(vo1, 1);
+          vo2_lo = _mm256_extractf128_ps(vo2, 1);
+          vo3_lo = _mm256_extractf128_ps(vo3, 1);
+        }
+        if (w & (2 * sizeof(float))) {
+          _mm_storel_pi((__m64*) o3, vo3_lo);
+          o3 += 2;
+          _mm_storel_pi((__m64*) o2, vo2_lo);
+          o2 += 2;
+          _mm_storel_pi((__m64*) o1, vo1_lo);
+          o1 += 2;
+          _mm_storel_pi((__m64*) o0, vo0_lo);
+          o0 += 2;
+
+          vo0_lo = _mm_movehl_ps(vo0_lo, vo0_lo);
+          vo1_lo = _mm_movehl_ps(vo1_lo, vo1_lo);
+          vo2_lo = _mm_movehl_ps(vo2_lo, vo2_lo);
+          vo3_lo = _mm_movehl_ps(vo3_lo, vo3_lo);
+        }
+        if (w & (1 * sizeof(float))) {
+          _mm_store_ss(o3, vo3_lo);
+          o3 += 1;
+          _mm_store_ss(o2, vo2_lo);
+          o2 += 1;
+          _mm_store_ss(o1, vo1_lo);
+          o1 += 1;
+          _mm_store_ss(o0, vo0_lo);
+          o0 += 1;
+        }
+      }
+    }
+
+    i0 = (const float*) ((uintptr_t) i4 - input_decrement);
+    i1 = (const float*) ((uintptr_t) i5 - input_decrement);
+    i2 = (const float*) ((uintptr_t) i1 + input_width);
+    i3 = (const float*) ((uintptr_t) i2 + input_width);
+    i4 = (const float*) ((uintptr_t) i3 + input_width);
+    i5 = (const float*) ((uintptr_t) i4 + input_width);
+
+    o0 = o3;
+    o1 = (float*) ((uintptr_t) o0 + input_width);
+    o2 = (float*) ((uintptr_t) o1 + input_width);
+    o3 = (float*) ((uintptr_t) o2 + input_width);
+
+    output_height = doz(output_height, 4);
+  } while (output_height != 0);
+}
+
+void xnn_f32_dwconv2d_chw_ukernel_3x3s2p1__avx_2x8_acc2(
+    size_t input_height,
+    size_t input_width,
+    const float* input,
+    const float* weights,
+    const float* zero,
+    float* output,
+    uint32_t padding_top,
+    const union xnn_f32_chw_params params[restrict XNN_MIN_ELEMENTS(1)]) XNN_OOB_READS
+{
+  assert(input_height != 0);
+  assert(input_width != 0);
+  assert(input_width % sizeof(float) == 0);
+  assert(padding_top >= 0);
+  assert(padding_top <= 1);
+
+  const __m256 vmask_even = _mm256_load_ps((const float*) params->sse.mask_even8);
+  const __m256 vmask_odd  = _mm256_load_ps((const float*) params->sse.mask_odd8);
+  const __m256 vmax = _mm256_broadcast_ss(params->sse.max);
+  const __m256 vmin = _mm256_broadcast_ss(params->sse.min);
+
+  const __m256 vbias = _mm256_broadcast_ss(weights);
+  const __m256 vk00 = _mm256_broadcast_ss(weights + 1);
+  const __m256 vk01 = _mm256_broadcast_ss(weights + 2);
+  const __m256 vk02 = _mm256_broadcast_ss(weights + 3);
+  const __m256 vk10 = _mm256_broadcast_ss(weights + 4);
+  const __m256 vk11 = _mm256_broadcast_ss(weights + 5);
+  const __m256 vk12 = _mm256_broadcast_ss(weights + 6);
+  const __m256 vk20 = _mm256_broadcast_ss(weights + 7);
+  const __m256 vk21 = _mm256_broadcast_ss(weights + 8);
+  const __m256 vk22 = _mm256_broadcast_ss(weights + 9);
+
+  const size_t input_decrement = round_down_po2(input_width, 8 /* SIMD output width */ * 2 /* subsampling */ * sizeof(float));
+  const size_t output_width = round_down_po2((input_width + (2 /* padding */ - 3 /* kernel size */ + 2 /* subsampling */) * sizeof(float)) / 2, sizeof(float));
+
+  const float* i0 = (const float*) ((uintptr_t) input - ((-padding_top) & input_width));
+  const float* i1 = (const float*) ((uintptr_t) i0 + input_width);
+  if XNN_UNPREDICTABLE(padding_top != 0) {
+    i0 = zero;
+  }
+  const float* i2 = (const float*) ((uintptr_t) i1 + input_width);
+  const float* i3 = (const float*) ((uintptr_t) i2 + input_width);
+  const float* i4 = (const float*) ((uintptr_t) i3 + input_width);
+
+  float* o0 = output;
+  float* o1 = (float*) ((uintptr_t) o0 + output_width);
+
+  size_t padded_input_height = input_height + padding_top + 1 /* padding bottom */;
+  size_t output_height = (padded_input_height - 3 /* kernel size */ + 2 /* subsampling */) / 2;
+  do {
+    if XNN_UNPREDICTABLE(padded_input_height < 4) {
+      i2 = zero;
+    }
+    if XNN_UNPREDICTABLE(padded_input_height < 5) {
+      i3 = zero;
+      o1 = o0;
+    }
+    if XNN_UNPREDICTABLE(padded_input_height < 6) {
+      i4 = zero;
+    }
+
+    __m256 vi0x13579BDF = _mm256_setzero_ps();
+    __m256 vi1x13579BDF = _mm256_setzero_ps();
+    __m256 vi2x13579BDF = _mm256_setzero_ps();
+    __m256 vi3x13579BDF = _mm256_setzero_ps();
+    __m256 vi4x13579BDF = _mm256_setzero_ps();
+
+    size_t w = input_width;
+    for (; w >= 16 * sizeof(float); w -= 16 * sizeof(float)) {
+      const __m256 vi0xGHIJKLMN = _mm256_loadu_ps(i0);
+      const __m256 vi0xOPQRSTUV = _mm256_loadu_ps(i0 + 8);
+      i0 += 16;
+      const __m256 vi1xGHIJKLMN = _mm256_loadu_ps(i1);
+      const __m256 vi1xOPQRSTUV = _mm256_loadu_ps(i1 + 8);
+      i1 += 16;
+      const __m256 vi2xGHIJKLMN = _mm256_loadu_ps(i2);
+      const __m256 vi2xOPQRSTUV = _mm256_loadu_ps(i2 + 8);
+      i2 += 16;
+      const __m256 vi3xGHIJKLMN = _mm256_loadu_ps(i3);
+      const __m256 vi3xOPQRSTUV = _mm256_loadu_ps(i3 + 8);
+      i3 += 16;
+      const __m256 vi4xGHIJKLMN = _mm256_loadu_ps(i4);
+      const __m256 vi4xOPQRSTUV = _mm256_loadu_ps(i4 + 8);
+      i4 += 16;
+
+      const __m256 vi0xGHIJOPQR = _mm256_permute2f128_ps(vi0xGHIJKLMN, vi0xOPQRSTUV, 0x20);
+      const __m256 vi0xKLMNSTUV = _mm256_permute2f128_ps(vi0xGHIJKLMN, vi0xOPQRSTUV, 0x31);
+      const __m256 vi1xGHIJOPQR = _mm256_permute2f128_ps(vi1xGHIJKLMN, vi1xOPQRSTUV, 0x20);
+      const __m256 vi1xKLMNSTUV = _mm256_permute2f128_ps(vi1xGHIJKLMN, vi1xOPQRSTUV, 0x31);
+      const __m256 vi2xGHIJOPQR = _mm256_permute2f128_ps(vi2xGHIJKLMN, vi2xOPQRSTUV, 0x20);
+      const __m256 vi2xKLMNSTUV = _mm256_permute2f128_ps(vi2xGHIJKLMN, vi2xOPQRSTUV, 0x31);
+      const __m256 vi3xGHIJOPQR = _mm256_permute2f128_ps(vi3xGHIJKLMN, vi3xOPQRSTUV, 0x20);
+      const __m256 vi3xKLMNSTUV = _mm256_permute2f128_ps(vi3xGHIJKLMN, vi3xOPQRSTUV, 0x31);
+      const __m256 vi4xGHIJOPQR = _mm256_permute2f128_ps(vi4xGHIJKLMN, vi4xOPQRSTUV, 0x20);
+      const __m256 vi4xKLMNSTUV = _mm256_permute2f128_ps(vi4xGHIJKLMN, vi4xOPQRSTUV, 0x31);
+
+      const __m256 vi0xGIKMOQSU = _mm256_shuffle_ps(vi0xGHIJOPQR, vi0xKLMNSTUV, _MM_SHUFFLE(2, 0, 2, 0));
+      const __m256 vi0xHJLNPRTV = _mm256_shuffle_ps(vi0xGHIJOPQR, vi0xKLMNSTUV, _MM_SHUFFLE(3, 1, 3, 1));
+      const __m256 vi1xGIKMOQSU = _mm256_shuffle_ps(vi1xGHIJOPQR, vi1xKLMNSTUV, _MM_SHUFFLE(2, 0, 2, 0));
+      const __m256 vi1xHJLNPRTV = _mm256_shuffle_ps(vi1xGHIJOPQR, vi1xKLMNSTUV, _MM_SHUFFLE(3, 1, 3, 1));
+      const __m256 vi2xGIKMOQSU = _mm256_shuffle_ps(vi2xGHIJOPQR, vi2xKLMNSTUV, _MM_SHUFFLE(2, 0, 2, 0));
+      const __m256 vi2xHJLNPRTV = _mm256_shuffle_ps(vi2xGHIJOPQR, vi2xKLMNSTUV, _MM_SHUFFLE(3, 1, 3, 1));
+      const __m256 vi3xGIKMOQSU = _mm256_shuffle_ps(vi3xGHIJOPQR, vi3xKLMNSTUV, _MM_SHUFFLE(2, 0, 2, 0));
+      const __m256 vi3xHJLNPRTV = _mm256_shuffle_ps(vi3xGHIJOPQR, vi3xKLMNSTUV, _MM_SHUFFLE(3, 1, 3, 1));
+      const __m256 vi4xGIKMOQSU = _mm256_shuffle_ps(vi4xGHIJOPQR, vi4xKLMNSTUV, _MM_SHUFFLE(2, 0, 2, 0));
+      const __m256 vi4xHJLNPRTV = _mm256_shuffle_ps(vi4xGHIJOPQR, vi4xKLMNSTUV, _MM_SHUFFLE(3, 1, 3, 1));
+
+      __m256 vo0p0 = _mm256_add_ps(vbias, _mm256_mul_ps(vi0xGIKMOQSU, vk01));
+      __m256 vo1p0 = _mm256_add_ps(vbias, _mm256_mul_ps(vi2xGIKMOQSU, vk01));
+      __m256 vo0p1 = _mm256_mul_ps(vi1xGIKMOQSU, vk11);
+      __m256 vo1p1 = _mm256_mul_ps(vi3xGIKMOQSU, vk11);
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi2xGIKMOQSU, vk21));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi4xGIKMOQSU, vk21));
+
+      const __m256 vi0x9BDFHJLN = _mm256_permute2f128_ps(vi0x13579BDF, vi0xHJLNPRTV, 0x21);
+      const __m256 vi1x9BDFHJLN = _mm256_permute2f128_ps(vi1x13579BDF, vi1xHJLNPRTV, 0x21);
+      const __m256 vi2x9BDFHJLN = _mm256_permute2f128_ps(vi2x13579BDF, vi2xHJLNPRTV, 0x21);
+      const __m256 vi3x9BDFHJLN = _mm256_permute2f128_ps(vi3x13579BDF, vi3xHJLNPRTV, 0x21);
+      const __m256 vi4x9BDFHJLN = _mm256_permute2f128_ps(vi4x13579BDF, vi4xHJLNPRTV, 0x21);
+
+      vo0p1 = _mm256_add_ps(vo0p1, _mm256_mul_ps(vi0xHJLNPRTV, vk02));
+      vo1p1 = _mm256_add_ps(vo1p1, _mm256_mul_ps(vi2xHJLNPRTV, vk02));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi1xHJLNPRTV, vk12));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi3xHJLNPRTV, vk12));
+      vo0p1 = _mm256_add_ps(vo0p1, _mm256_mul_ps(vi2xHJLNPRTV, vk22));
+      vo1p1 = _mm256_add_ps(vo1p1, _mm256_mul_ps(vi4xHJLNPRTV, vk22));
+
+      const __m256 vi0xFHJLNPRT = _mm256_permute_ps(_mm256_blend_ps(vi0xHJLNPRTV, vi0x9BDFHJLN, 0x88), _MM_SHUFFLE(2, 1, 0, 3));
+      vi0x13579BDF = vi0xHJLNPRTV;
+      const __m256 vi1xFHJLNPRT = _mm256_permute_ps(_mm256_blend_ps(vi1xHJLNPRTV, vi1x9BDFHJLN, 0x88), _MM_SHUFFLE(2, 1, 0, 3));
+      vi1x13579BDF = vi1xHJLNPRTV;
+      const __m256 vi2xFHJLNPRT = _mm256_permute_ps(_mm256_blend_ps(vi2xHJLNPRTV, vi2x9BDFHJLN, 0x88), _MM_SHUFFLE(2, 1, 0, 3));
+      vi2x13579BDF = vi2xHJLNPRTV;
+      const __m256 vi3xFHJLNPRT = _mm256_permute_ps(_mm256_blend_ps(vi3xHJLNPRTV, vi3x9BDFHJLN, 0x88), _MM_SHUFFLE(2, 1, 0, 3));
+      vi3x13579BDF = vi3xHJLNPRTV;
+      const __m256 vi4xFHJLNPRT = _mm256_permute_ps(_mm256_blend_ps(vi4xHJLNPRTV, vi4x9BDFHJLN, 0x88), _MM_SHUFFLE(2, 1, 0, 3));
+      vi4x13579BDF = vi4xHJLNPRTV;
+
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi0xFHJLNPRT, vk00));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi2xFHJLNPRT, vk00));
+      vo0p1 = _mm256_add_ps(vo0p1, _mm256_mul_ps(vi1xFHJLNPRT, vk10));
+      vo1p1 = _mm256_add_ps(vo1p1, _mm256_mul_ps(vi3xFHJLNPRT, vk10));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi2xFHJLNPRT, vk20));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi4xFHJLNPRT, vk20));
+
+      vo0p0 = _mm256_add_ps(vo0p0, vo0p1);
+      vo1p0 = _mm256_add_ps(vo1p0, vo1p1);
+
+      __m256 vo0 = _mm256_max_ps(vo0p0, vmin);
+      __m256 vo1 = _mm256_max_ps(vo1p0, vmin);
+
+      vo0 = _mm256_min_ps(vo0, vmax);
+      vo1 = _mm256_min_ps(vo1, vmax);
+
+      _mm256_storeu_ps(o1, vo1);
+      o1 += 8;
+      _mm256_storeu_ps(o0, vo0);
+      o0 += 8;
+    }
+    // Potentially process the last block of 0..15 pixels.
+    assert(w < 16 * sizeof(float));
+    if XNN_LIKELY(w != 0) {
+      const __m256 vi0xGHIJKLMN = _mm256_loadu_ps(i0);
+      const __m256 vi1xGHIJKLMN = _mm256_loadu_ps(i1);
+      const __m256 vi2xGHIJKLMN = _mm256_loadu_ps(i2);
+      const __m256 vi3xGHIJKLMN = _mm256_loadu_ps(i3);
+      const __m256 vi4xGHIJKLMN = _mm256_loadu_ps(i4);
+      __m256 vi0xOPQRSTUV = _mm256_setzero_ps();
+      __m256 vi1xOPQRSTUV = _mm256_setzero_ps();
+      __m256 vi2xOPQRSTUV = _mm256_setzero_ps();
+      __m256 vi3xOPQRSTUV = _mm256_setzero_ps();
+      __m256 vi4xOPQRSTUV = _mm256_setzero_ps();
+      if (w > 8 * sizeof(float)) {
+        vi0xOPQRSTUV = _mm256_loadu_ps(i0 + 8);
+        vi1xOPQRSTUV = _mm256_loadu_ps(i1 + 8);
+        vi2xOPQRSTUV = _mm256_loadu_ps(i2 + 8);
+        vi3xOPQRSTUV = _mm256_loadu_ps(i3 + 8);
+        vi4xOPQRSTUV = _mm256_loadu_ps(i4 + 8);
+      }
+
+      const __m256 vi0xGHIJOPQR = _mm256_permute2f128_ps(vi0xGHIJKLMN, vi0xOPQRSTUV, 0x20);
+      const __m256 vi0xKLMNSTUV = _mm256_permute2f128_ps(vi0xGHIJKLMN, vi0xOPQRSTUV, 0x31);
+      const __m256 vi1xGHIJOPQR = _mm256_permute2f128_ps(vi1xGHIJKLMN, vi1xOPQRSTUV, 0x20);
+      const __m256 vi1xKLMNSTUV = _mm256_permute2f128_ps(vi1xGHIJKLMN, vi1xOPQRSTUV, 0x31);
+      const __m256 vi2xGHIJOPQR = _mm256_permute2f128_ps(vi2xGHIJKLMN, vi2xOPQRSTUV, 0x20);
+      const __m256 vi2xKLMNSTUV = _mm256_permute2f128_ps(vi2xGHIJKLMN, vi2xOPQRSTUV, 0x31);
+      const __m256 vi3xGHIJOPQR = _mm256_permute2f128_ps(vi3xGHIJKLMN, vi3xOPQRSTUV, 0x20);
+      const __m256 vi3xKLMNSTUV = _mm256_permute2f128_ps(vi3xGHIJKLMN, vi3xOPQRSTUV, 0x31);
+      const __m256 vi4xGHIJOPQR = _mm256_permute2f128_ps(vi4xGHIJKLMN, vi4xOPQRSTUV, 0x20);
+      const __m256 vi4xKLMNSTUV = _mm256_permute2f128_ps(vi4xGHIJKLMN, vi4xOPQRSTUV, 0x31);
+
+      const __m256 vi0xGIKMOQSU = _mm256_and_ps(vmask_even, _mm256_shuffle_ps(vi0xGHIJOPQR, vi0xKLMNSTUV, _MM_SHUFFLE(2, 0, 2, 0)));
+      const __m256 vi0xHJLNPRTV = _mm256_and_ps(vmask_odd,  _mm256_shuffle_ps(vi0xGHIJOPQR, vi0xKLMNSTUV, _MM_SHUFFLE(3, 1, 3, 1)));
+      const __m256 vi1xGIKMOQSU = _mm256_and_ps(vmask_even, _mm256_shuffle_ps(vi1xGHIJOPQR, vi1xKLMNSTUV, _MM_SHUFFLE(2, 0, 2, 0)));
+      const __m256 vi1xHJLNPRTV = _mm256_and_ps(vmask_odd,  _mm256_shuffle_ps(vi1xGHIJOPQR, vi1xKLMNSTUV, _MM_SHUFFLE(3, 1, 3, 1)));
+      const __m256 vi2xGIKMOQSU = _mm256_and_ps(vmask_even, _mm256_shuffle_ps(vi2xGHIJOPQR, vi2xKLMNSTUV, _MM_SHUFFLE(2, 0, 2, 0)));
+      const __m256 vi2xHJLNPRTV = _mm256_and_ps(vmask_odd,  _mm256_shuffle_ps(vi2xGHIJOPQR, vi2xKLMNSTUV, _MM_SHUFFLE(3, 1, 3, 1)));
+      const __m256 vi3xGIKMOQSU = _mm256_and_ps(vmask_even, _mm256_shuffle_ps(vi3xGHIJOPQR, vi3xKLMNSTUV, _MM_SHUFFLE(2, 0, 2, 0)));
+      const __m256 vi3xHJLNPRTV = _mm256_and_ps(vmask_odd,  _mm256_shuffle_ps(vi3xGHIJOPQR, vi3xKLMNSTUV, _MM_SHUFFLE(3, 1, 3, 1)));
+      const __m256 vi4xGIKMOQSU = _mm256_and_ps(vmask_even, _mm256_shuffle_ps(vi4xGHIJOPQR, vi4xKLMNSTUV, _MM_SHUFFLE(2, 0, 2, 0)));
+      const __m256 vi4xHJLNPRTV = _mm256_and_ps(vmask_odd,  _mm256_shuffle_ps(vi4xGHIJOPQR, vi4xKLMNSTUV, _MM_SHUFFLE(3, 1, 3, 1)));
+
+      __m256 vo0p0 = _mm256_add_ps(vbias, _mm256_mul_ps(vi0xGIKMOQSU, vk01));
+      __m256 vo1p0 = _mm256_add_ps(vbias, _mm256_mul_ps(vi2xGIKMOQSU, vk01));
+      __m256 vo0p1 = _mm256_mul_ps(vi1xGIKMOQSU, vk11);
+      __m256 vo1p1 = _mm256_mul_ps(vi3xGIKMOQSU, vk11);
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi2xGIKMOQSU, vk21));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi4xGIKMOQSU, vk21));
+
+      const __m256 vi0x9BDFHJLN = _mm256_permute2f128_ps(vi0x13579BDF, vi0xHJLNPRTV, 0x21);
+      const __m256 vi1x9BDFHJLN = _mm256_permute2f128_ps(vi1x13579BDF, vi1xHJLNPRTV, 0x21);
+      const __m256 vi2x9BDFHJLN = _mm256_permute2f128_ps(vi2x13579BDF, vi2xHJLNPRTV, 0x21);
+      const __m256 vi3x9BDFHJLN = _mm256_permute2f128_ps(vi3x13579BDF, vi3xHJLNPRTV, 0x21);
+      const __m256 vi4x9BDFHJLN = _mm256_permute2f128_ps(vi4x13579BDF, vi4xHJLNPRTV, 0x21);
+
+      vo0p1 = _mm256_add_ps(vo0p1, _mm256_mul_ps(vi0xHJLNPRTV, vk02));
+      vo1p1 = _mm256_add_ps(vo1p1, _mm256_mul_ps(vi2xHJLNPRTV, vk02));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi1xHJLNPRTV, vk12));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi3xHJLNPRTV, vk12));
+      vo0p1 = _mm256_add_ps(vo0p1, _mm256_mul_ps(vi2xHJLNPRTV, vk22));
+      vo1p1 = _mm256_add_ps(vo1p1, _mm256_mul_ps(vi4xHJLNPRTV, vk22));
+
+      const __m256 vi0xFHJLNPRT = _mm256_permute_ps(_mm256_blend_ps(vi0xHJLNPRTV, vi0x9BDFHJLN, 0x88), _MM_SHUFFLE(2, 1, 0, 3));
+      const __m256 vi1xFHJLNPRT = _mm256_permute_ps(_mm256_blend_ps(vi1xHJLNPRTV, vi1x9BDFHJLN, 0x88), _MM_SHUFFLE(2, 1, 0, 3));
+      const __m256 vi2xFHJLNPRT = _mm256_permute_ps(_mm256_blend_ps(vi2xHJLNPRTV, vi2x9BDFHJLN, 0x88), _MM_SHUFFLE(2, 1, 0, 3));
+      const __m256 vi3xFHJLNPRT = _mm256_permute_ps(_mm256_blend_ps(vi3xHJLNPRTV, vi3x9BDFHJLN, 0x88), _MM_SHUFFLE(2, 1, 0, 3));
+      const __m256 vi4xFHJLNPRT = _mm256_permute_ps(_mm256_blend_ps(vi4xHJLNPRTV, vi4x9BDFHJLN, 0x88), _MM_SHUFFLE(2, 1, 0, 3));
+
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi0xFHJLNPRT, vk00));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi2xFHJLNPRT, vk00));
+      vo0p1 = _mm256_add_ps(vo0p1, _mm256_mul_ps(vi1xFHJLNPRT, vk10));
+      vo1p1 = _mm256_add_ps(vo1p1, _mm256_mul_ps(vi3xFHJLNPRT, vk10));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi2xFHJLNPRT, vk20));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi4xFHJLNPRT, vk20));
+
+      vo0p0 = _mm256_add_ps(vo0p0, vo0p1);
+      vo1p0 = _mm256_add_ps(vo1p0, vo1p1);
+
+      __m256 vo0 = _mm256_max_ps(vo0p0, vmin);
+      __m256 vo1 = _mm256_max_ps(vo1p0, vmin);
+
+      vo0 = _mm256_min_ps(vo0, vmax);
+      vo1 = _mm256_min_ps(vo1, vmax);
+
+      if (w == 15 * sizeof(float)) {
+        _mm256_storeu_ps(o1, vo1);
+        o1 += 8;
+        _mm256_storeu_ps(o0, vo0);
+        o0 += 8;
+      } else {
+        __m128 vo1_lo = _mm256_castps256_ps128(vo1);
+        __m128 vo0_lo = _mm256_castps256_ps128(vo0);
+        w += 1 * sizeof(float);
+        if (w & (8 * sizeof(float))) {
+          _mm_storeu_ps(o1, vo1_lo);
+          o1 += 4;
+          _mm_storeu_ps(o0, vo0_lo);
+          o0 += 4;
+
+          vo0_lo = _mm256_extractf128_ps(vo0, 1);
+          vo1_lo = _mm256_extractf128_ps(vo1, 1);
+        }
+        if (w & (4 * sizeof(float))) {
+          _mm_storel_pi((__m64*) o1, vo1_lo);
+          o1 += 2;
+          _mm_storel_pi((__m64*) o0, vo0_lo);
+          o0 += 2;
+
+          vo0_lo = _mm_movehl_ps(vo0_lo, vo0_lo);
+          vo1_lo = _mm_movehl_ps(vo1_lo, vo1_lo);
+        }
+        if (w & (2 * sizeof(float))) {
+          _mm_store_ss(o1, vo1_lo);
+          o1 += 1;
+          _mm_store_ss(o0, vo0_lo);
+          o0 += 1;
+        }
+      }
+    }
+
+    i0 = (const float*) ((uintptr_t) i4 - input_decrement);
+    i1 = (const float*) ((uintptr_t) i0 + input_width);
+    i2 = (const float*) ((uintptr_t) i1 + input_width);
+    i3 = (const float*) ((uintptr_t) i2 + input_width);
+    i4 = (const float*) ((uintptr_t) i3 + input_width);
+
+    o0 = o1;
+    o1 = (float*) ((uintptr_t) o0 + output_width);
+
+    output_height = doz(output_height, 2);
+    padded_input_height = doz(padded_input_height, 4);
+  } while (output_height != 0);
+}
+
+void xnn_f32_dwconv2d_chw_ukernel_5x5p2__avx_2x8(
+    size_t input_height,
+    size_t input_width,
+    const float* input,
+    const float* weights,
+    const float* zero,
+    float* output,
+    uint32_t padding_top,
+    const union xnn_f32_chw_params params[restrict XNN_MIN_ELEMENTS(1)]) XNN_OOB_READS
+{
+  assert(input_height != 0);
+  assert(input_width != 0);
+  assert(input_width % sizeof(float) == 0);
+  assert(padding_top == 2);
+
+  const __m256 vmask = _mm256_load_ps((const float*) params->sse.mask8);
+  const __m256 vmax = _mm256_broadcast_ss(params->sse.max);
+  const __m256 vmin = _mm256_broadcast_ss(params->sse.min);
+
+  const __m256 vbias = _mm256_broadcast_ss(weights);
+  const __m256 vk00 = _mm256_broadcast_ss(weights + 1);
+  const __m256 vk01 = _mm256_broadcast_ss(weights + 2);
+  const __m256 vk02 = _mm256_broadcast_ss(weights + 3);
+  const __m256 vk03 = _mm256_broadcast_ss(weights + 4);
+  const __m256 vk04 = _mm256_broadcast_ss(weights + 5);
+  const __m256 vk10 = _mm256_broadcast_ss(weights + 6);
+  const __m256 vk11 = _mm256_broadcast_ss(weights + 7);
+  const __m256 vk12 = _mm256_broadcast_ss(weights + 8);
+  const __m256 vk13 = _mm256_broadcast_ss(weights + 9);
+  const __m256 vk14 = _mm256_broadcast_ss(weights + 10);
+  const __m256 vk20 = _mm256_broadcast_ss(weights + 11);
+  const __m256 vk21 = _mm256_broadcast_ss(weights + 12);
+  const __m256 vk22 = _mm256_broadcast_ss(weights + 13);
+  const __m256 vk23 = _mm256_broadcast_ss(weights + 14);
+  const __m256 vk24 = _mm256_broadcast_ss(weights + 15);
+  const __m256 vk30 = _mm256_broadcast_ss(weights + 16);
+  const __m256 vk31 = _mm256_broadcast_ss(weights + 17);
+  const __m256 vk32 = _mm256_broadcast_ss(weights + 18);
+  const __m256 vk33 = _mm256_broadcast_ss(weights + 19);
+  const __m256 vk34 = _mm256_broadcast_ss(weights + 20);
+  const __m256 vk40 = _mm256_broadcast_ss(weights + 21);
+  const __m256 vk41 = _mm256_broadcast_ss(weights + 22);
+  const __m256 vk42 = _mm256_broadcast_ss(weights + 23);
+  const __m256 vk43 = _mm256_broadcast_ss(weights + 24);
+  const __m256 vk44 = _mm256_broadcast_ss(weights + 25);
+
+  const size_t input_decrement = round_up_po2(input_width, 8 * sizeof(float));
+
+  const float* i0 = zero;
+  const float* i1 = zero;
+  const float* i2 = input;
+  const float* i3 = (const float*) ((uintptr_t) i2 + input_width);
+  const float* i4 = (const float*) ((uintptr_t) i3 + input_width);
+  const float* i5 = (const float*) ((uintptr_t) i4 + input_width);
+
+  float* o0 = output;
+  float* o1 = (float*) ((uintptr_t) o0 + input_width);
+
+  size_t output_height = input_height;
+  do {
+    if XNN_UNPREDICTABLE(output_height < 2) {
+      i3 = zero;
+      o1 = o0;
+    }
+    if XNN_UNPREDICTABLE(output_height < 3) {
+      i4 = zero;
+    }
+    if XNN_UNPREDICTABLE(output_height < 4) {
+      i5 = zero;
+    }
+
+    __m256 vi0x89ABCDEF = _mm256_loadu_ps(i0);
+    i0 += 8;
+    __m256 vi1x89ABCDEF = _mm256_loadu_ps(i1);
+    i1 += 8;
+    __m256 vi2x89ABCDEF = _mm256_loadu_ps(i2);
+    i2 += 8;
+    __m256 vi3x89ABCDEF = _mm256_loadu_ps(i3);
+    i3 += 8;
+    __m256 vi4x89ABCDEF = _mm256_loadu_ps(i4);
+    i4 += 8;
+    __m256 vi5x89ABCDEF = _mm256_loadu_ps(i5);
+    i5 += 8;
+
+    // vi0x456789AB = ( vi0B, vi0A, vi09, vi08, 0.0, 0.0, 0.0, 0.0 )
+    __m256 vi0x456789AB = _mm256_permute2f128_ps(vi0x89ABCDEF, vi0x89ABCDEF, 0x08);
+    // vi1x456789AB = ( vi1B, vi1A, vi19, vi18, 0.0, 0.0, 0.0, 0.0 )
+    __m256 vi1x456789AB = _mm256_permute2f128_ps(vi1x89ABCDEF, vi1x89ABCDEF, 0x08);
+    // vi2x456789AB = ( vi2B, vi2A, vi29, vi28, 0.0, 0.0, 0.0, 0.0 )
+    __m256 vi2x456789AB = _mm256_permute2f128_ps(vi2x89ABCDEF, vi2x89ABCDEF, 0x08);
+    // vi3x456789AB = ( vi3B, vi3A, vi39, vi38, 0.0, 0.0, 0.0, 0.0 )
+    __m256 vi3x456789AB = _mm256_permute2f128_ps(vi3x89ABCDEF, vi3x89ABCDEF, 0x08);
+    // vi4x456789AB = ( vi4B, vi4A, vi49, vi48, 0.0, 0.0, 0.0, 0.0 )
+    __m256 vi4x456789AB = _mm256_permute2f128_ps(vi4x89ABCDEF, vi4x89ABCDEF, 0x08);
+    // vi5x456789AB = ( vi5B, vi5A, vi59, vi58, 0.0, 0.0, 0.0, 0.0 )
+    __m256 vi5x456789AB = _mm256_permute2f128_ps(vi5x89ABCDEF, vi5x89ABCDEF, 0x08);
+
+    size_t w = input_width;
+    for (; w > 16 * sizeof(float); w -= 8 * sizeof(float)) {
+      __m256 vo0p0 = _mm256_add_ps(vbias, _mm256_mul_ps(vi0x89ABCDEF, vk02));
+      __m256 vo1p0 = _mm256_add_ps(vbias, _mm256_mul_ps(vi1x89ABCDEF, vk02));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi1x89ABCDEF, vk12));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi2x89ABCDEF, vk12));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi2x89ABCDEF, vk22));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi3x89ABCDEF, vk22));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi3x89ABCDEF, vk32));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi4x89ABCDEF, vk32));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi4x89ABCDEF, vk42));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi5x89ABCDEF, vk42));
+
+      const __m256 vi0xGHIJKLMN = _mm256_loadu_ps(i0);
+      i0 += 8;
+      const __m256 vi1xGHIJKLMN = _mm256_loadu_ps(i1);
+      i1 += 8;
+      const __m256 vi2xGHIJKLMN = _mm256_loadu_ps(i2);
+      i2 += 8;
+      const __m256 vi3xGHIJKLMN = _mm256_loadu_ps(i3);
+      i3 += 8;
+      const __m256 vi4xGHIJKLMN = _mm256_loadu_ps(i4);
+      i4 += 8;
+      const __m256 vi5xGHIJKLMN = _mm256_loadu_ps(i5);
+      i5 += 8;
+
+      const __m256 vi0x789ABCDE = _mm256_permute_ps(_mm256_blend_ps(vi0x89ABCDEF, vi0x456789AB, 0x88), _MM_SHUFFLE(2, 1, 0, 3));
+      const __m256 vi1x789ABCDE = _mm256_permute_ps(_mm256_blend_ps(vi1x89ABCDEF, vi1x456789AB, 0x88), _MM_SHUFFLE(2, 1, 0, 3));
+      const __m256 vi2x789ABCDE = _mm256_permute_ps(_mm256_blend_ps(vi2x89ABCDEF, vi2x456789AB, 0x88), _MM_SHUFFLE(2, 1, 0, 3));
+      const __m256 vi3x789ABCDE = _mm256_permute_ps(_mm256_blend_ps(vi3x89ABCDEF, vi3x456789AB, 0x88), _MM_SHUFFLE(2, 1, 0, 3));
+      const __m256 vi4x789ABCDE = _mm256_permute_ps(_mm256_blend_ps(vi4x89ABCDEF, vi4x456789AB, 0x88), _MM_SHUFFLE(2, 1, 0, 3));
+      const __m256 vi5x789ABCDE = _mm256_permute_ps(_mm256_blend_ps(vi5x89ABCDEF, vi5x456789AB, 0x88), _MM_SHUFFLE(2, 1, 0, 3));
+
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi0x789ABCDE, vk01));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi1x789ABCDE, vk01));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi1x789ABCDE, vk11));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi2x789ABCDE, vk11));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi2x789ABCDE, vk21));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi3x789ABCDE, vk21));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi3x789ABCDE, vk31));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi4x789ABCDE, vk31));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi4x789ABCDE, vk41));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi5x789ABCDE, vk41));
+
+      const __m256 vi0x6789ABCD = _mm256_shuffle_ps(vi0x456789AB, vi0x89ABCDEF, _MM_SHUFFLE(1, 0, 3, 2));
+      const __m256 vi1x6789ABCD = _mm256_shuffle_ps(vi1x456789AB, vi1x89ABCDEF, _MM_SHUFFLE(1, 0, 3, 2));
+      const __m256 vi2x6789ABCD = _mm256_shuffle_ps(vi2x456789AB, vi2x89ABCDEF, _MM_SHUFFLE(1, 0, 3, 2));
+      const __m256 vi3x6789ABCD = _mm256_shuffle_ps(vi3x456789AB, vi3x89ABCDEF, _MM_SHUFFLE(1, 0, 3, 2));
+      const __m256 vi4x6789ABCD = _mm256_shuffle_ps(vi4x456789AB, vi4x89ABCDEF, _MM_SHUFFLE(1, 0, 3, 2));
+      const __m256 vi5x6789ABCD = _mm256_shuffle_ps(vi5x456789AB, vi5x89ABCDEF, _MM_SHUFFLE(1, 0, 3, 2));
+
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi0x6789ABCD, vk00));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi1x6789ABCD, vk00));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi1x6789ABCD, vk10));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi2x6789ABCD, vk10));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi2x6789ABCD, vk20));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi3x6789ABCD, vk20));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi3x6789ABCD, vk30));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi4x6789ABCD, vk30));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi4x6789ABCD, vk40));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi5x6789ABCD, vk40));
+
+      const __m256 vi0xCDEFGHIJ = _mm256_permute2f128_ps(vi0x89ABCDEF, vi0xGHIJKLMN, 0x21);
+      const __m256 vi1xCDEFGHIJ = _mm256_permute2f128_ps(vi1x89ABCDEF, vi1xGHIJKLMN, 0x21);
+      const __m256 vi2xCDEFGHIJ = _mm256_permute2f128_ps(vi2x89ABCDEF, vi2xGHIJKLMN, 0x21);
+      const __m256 vi3xCDEFGHIJ = _mm256_permute2f128_ps(vi3x89ABCDEF, vi3xGHIJKLMN, 0x21);
+      const __m256 vi4xCDEFGHIJ = _mm256_permute2f128_ps(vi4x89ABCDEF, vi4xGHIJKLMN, 0x21);
+      const __m256 vi5xCDEFGHIJ = _mm256_permute2f128_ps(vi5x89ABCDEF, vi5xGHIJKLMN, 0x21);
+
+      const __m256 vi0x9ABCDEFG = _mm256_permute_ps(_mm256_blend_ps(vi0x89ABCDEF, vi0xCDEFGHIJ, 0x11), _MM_SHUFFLE(0, 3, 2, 1));
+      const __m256 vi1x9ABCDEFG = _mm256_permute_ps(_mm256_blend_ps(vi1x89ABCDEF, vi1xCDEFGHIJ, 0x11), _MM_SHUFFLE(0, 3, 2, 1));
+      const __m256 vi2x9ABCDEFG = _mm256_permute_ps(_mm256_blend_ps(vi2x89ABCDEF, vi2xCDEFGHIJ, 0x11), _MM_SHUFFLE(0, 3, 2, 1));
+      const __m256 vi3x9ABCDEFG = _mm256_permute_ps(_mm256_blend_ps(vi3x89ABCDEF, vi3xCDEFGHIJ, 0x11), _MM_SHUFFLE(0, 3, 2, 1));
+      const __m256 vi4x9ABCDEFG = _mm256_permute_ps(_mm256_blend_ps(vi4x89ABCDEF, vi4xCDEFGHIJ, 0x11), _MM_SHUFFLE(0, 3, 2, 1));
+      const __m256 vi5x9ABCDEFG = _mm256_permute_ps(_mm256_blend_ps(vi5x89ABCDEF, vi5xCDEFGHIJ, 0x11), _MM_SHUFFLE(0, 3, 2, 1));
+
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi0x9ABCDEFG, vk03));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi1x9ABCDEFG, vk03));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi1x9ABCDEFG, vk13));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi2x9ABCDEFG, vk13));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi2x9ABCDEFG, vk23));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi3x9ABCDEFG, vk23));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi3x9ABCDEFG, vk33));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi4x9ABCDEFG, vk33));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi4x9ABCDEFG, vk43));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi5x9ABCDEFG, vk43));
+
+      const __m256 vi0xABCDEFGH = _mm256_shuffle_ps(vi0x89ABCDEF, vi0xCDEFGHIJ, _MM_SHUFFLE(1, 0, 3, 2));
+      vi0x456789AB = vi0xCDEFGHIJ;
+      vi0x89ABCDEF = vi0xGHIJKLMN;
+      const __m256 vi1xABCDEFGH = _mm256_shuffle_ps(vi1x89ABCDEF, vi1xCDEFGHIJ, _MM_SHUFFLE(1, 0, 3, 2));
+      vi1x456789AB = vi1xCDEFGHIJ;
+      vi1x89ABCDEF = vi1xGHIJKLMN;
+      const __m256 vi2xABCDEFGH = _mm256_shuffle_ps(vi2x89ABCDEF, vi2xCDEFGHIJ, _MM_SHUFFLE(1, 0, 3, 2));
+      vi2x456789AB = vi2xCDEFGHIJ;
+      vi2x89ABCDEF = vi2xGHIJKLMN;
+      const __m256 vi3xABCDEFGH = _mm256_shuffle_ps(vi3x89ABCDEF, vi3xCDEFGHIJ, _MM_SHUFFLE(1, 0, 3, 2));
+      vi3x456789AB = vi3xCDEFGHIJ;
+      vi3x89ABCDEF = vi3xGHIJKLMN;
+      const __m256 vi4xABCDEFGH = _mm256_shuffle_ps(vi4x89ABCDEF, vi4xCDEFGHIJ, _MM_SHUFFLE(1, 0, 3, 2));
+      vi4x456789AB = vi4xCDEFGHIJ;
+      vi4x89ABCDEF = vi4xGHIJKLMN;
+      const __m256 vi5xABCDEFGH = _mm256_shuffle_ps(vi5x89ABCDEF, vi5xCDEFGHIJ, _MM_SHUFFLE(1, 0, 3, 2));
+      vi5x456789AB = vi5xCDEFGHIJ;
+      vi5x89ABCDEF = vi5xGHIJKLMN;
+
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi0xABCDEFGH, vk04));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi1xABCDEFGH, vk04));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi1xABCDEFGH, vk14));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi2xABCDEFGH, vk14));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi2xABCDEFGH, vk24));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi3xABCDEFGH, vk24));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi3xABCDEFGH, vk34));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi4xABCDEFGH, vk34));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi4xABCDEFGH, vk44));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi5xABCDEFGH, vk44));
+
+
+      __m256 vo0 = _mm256_max_ps(vo0p0, vmin);
+      __m256 vo1 = _mm256_max_ps(vo1p0, vmin);
+
+      vo0 = _mm256_min_ps(vo0, vmax);
+      vo1 = _mm256_min_ps(vo1, vmax);
+
+      _mm256_storeu_ps(o1, vo1);
+      o1 += 8;
+      _mm256_storeu_ps(o0, vo0);
+      o0 += 8;
+    }
+    // Always process the last block of 9..16 pixels.
+    if XNN_LIKELY(w > 8 * sizeof(float)) {
+      __m256 vo0p0 = _mm256_add_ps(vbias, _mm256_mul_ps(vi0x89ABCDEF, vk02));
+      __m256 vo1p0 = _mm256_add_ps(vbias, _mm256_mul_ps(vi1x89ABCDEF, vk02));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi1x89ABCDEF, vk12));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi2x89ABCDEF, vk12));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi2x89ABCDEF, vk22));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi3x89ABCDEF, vk22));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi3x89ABCDEF, vk32));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi4x89ABCDEF, vk32));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi4x89ABCDEF, vk42));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi5x89ABCDEF, vk42));
+
+      const __m256 vi0xGHIJKLMN = _mm256_and_ps(_mm256_loadu_ps(i0), vmask);
+      i0 += 8;
+      const __m256 vi1xGHIJKLMN = _mm256_and_ps(_mm256_loadu_ps(i1), vmask);
+      i1 += 8;
+      const __m256 vi2xGHIJKLMN = _mm256_and_ps(_mm256_loadu_ps(i2), vmask);
+      i2 += 8;
+      const __m256 vi3xGHIJKLMN = _mm256_and_ps(_mm256_loadu_ps(i3), vmask);
+      i3 += 8;
+      const __m256 vi4xGHIJKLMN = _mm256_and_ps(_mm256_loadu_ps(i4), vmask);
+      i4 += 8;
+      const __m256 vi5xGHIJKLMN = _mm256_and_ps(_mm256_loadu_ps(i5), vmask);
+      i5 += 8;
+
+      const __m256 vi0x789ABCDE = _mm256_permute_ps(_mm256_blend_ps(vi0x89ABCDEF, vi0x456789AB, 0x88), _MM_SHUFFLE(2, 1, 0, 3));
+      const __m256 vi1x789ABCDE = _mm256_permute_ps(_mm256_blend_ps(vi1x89ABCDEF, vi1x456789AB, 0x88), _MM_SHUFFLE(2, 1, 0, 3));
+      const __m256 vi2x789ABCDE = _mm256_permute_ps(_mm256_blend_ps(vi2x89ABCDEF, vi2x456789AB, 0x88), _MM_SHUFFLE(2, 1, 0, 3));
+      const __m256 vi3x789ABCDE = _mm256_permute_ps(_mm256_blend_ps(vi3x89ABCDEF, vi3x456789AB, 0x88), _MM_SHUFFLE(2, 1, 0, 3));
+      const __m256 vi4x789ABCDE = _mm256_permute_ps(_mm256_blend_ps(vi4x89ABCDEF, vi4x456789AB, 0x88), _MM_SHUFFLE(2, 1, 0, 3));
+      const __m256 vi5x789ABCDE = _mm256_permute_ps(_mm256_blend_ps(vi5x89ABCDEF, vi5x456789AB, 0x88), _MM_SHUFFLE(2, 1, 0, 3));
+
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi0x789ABCDE, vk01));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi1x789ABCDE, vk01));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi1x789ABCDE, vk11));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi2x789ABCDE, vk11));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi2x789ABCDE, vk21));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi3x789ABCDE, vk21));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi3x789ABCDE, vk31));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi4x789ABCDE, vk31));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi4x789ABCDE, vk41));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi5x789ABCDE, vk41));
+
+      const __m256 vi0x6789ABCD = _mm256_shuffle_ps(vi0x456789AB, vi0x89ABCDEF, _MM_SHUFFLE(1, 0, 3, 2));
+      const __m256 vi1x6789ABCD = _mm256_shuffle_ps(vi1x456789AB, vi1x89ABCDEF, _MM_SHUFFLE(1, 0, 3, 2));
+      const __m256 vi2x6789ABCD = _mm256_shuffle_ps(vi2x456789AB, vi2x89ABCDEF, _MM_SHUFFLE(1, 0, 3, 2));
+      const __m256 vi3x6789ABCD = _mm256_shuffle_ps(vi3x456789AB, vi3x89ABCDEF, _MM_SHUFFLE(1, 0, 3, 2));
+      const __m256 vi4x6789ABCD = _mm256_shuffle_ps(vi4x456789AB, vi4x89ABCDEF, _MM_SHUFFLE(1, 0, 3, 2));
+      const __m256 vi5x6789ABCD = _mm256_shuffle_ps(vi5x456789AB, vi5x89ABCDEF, _MM_SHUFFLE(1, 0, 3, 2));
+
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi0x6789ABCD, vk00));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi1x6789ABCD, vk00));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi1x6789ABCD, vk10));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi2x6789ABCD, vk10));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi2x6789ABCD, vk20));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi3x6789ABCD, vk20));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi3x6789ABCD, vk30));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi4x6789ABCD, vk30));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi4x6789ABCD, vk40));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi5x6789ABCD, vk40));
+
+      const __m256 vi0xCDEFGHIJ = _mm256_permute2f128_ps(vi0x89ABCDEF, vi0xGHIJKLMN, 0x21);
+      const __m256 vi1xCDEFGHIJ = _mm256_permute2f128_ps(vi1x89ABCDEF, vi1xGHIJKLMN, 0x21);
+      const __m256 vi2xCDEFGHIJ = _mm256_permute2f128_ps(vi2x89ABCDEF, vi2xGHIJKLMN, 0x21);
+      const __m256 vi3xCDEFGHIJ = _mm256_permute2f128_ps(vi3x89ABCDEF, vi3xGHIJKLMN, 0x21);
+      const __m256 vi4xCDEFGHIJ = _mm256_permute2f128_ps(vi4x89ABCDEF, vi4xGHIJKLMN, 0x21);
+      const __m256 vi5xCDEFGHIJ = _mm256_permute2f128_ps(vi5x89ABCDEF, vi5xGHIJKLMN, 0x21);
+
+      const __m256 vi0x9ABCDEFG = _mm256_permute_ps(_mm256_blend_ps(vi0x89ABCDEF, vi0xCDEFGHIJ, 0x11), _MM_SHUFFLE(0, 3, 2, 1));
+      const __m256 vi1x9ABCDEFG = _mm256_permute_ps(_mm256_blend_ps(vi1x89ABCDEF, vi1xCDEFGHIJ, 0x11), _MM_SHUFFLE(0, 3, 2, 1));
+      const __m256 vi2x9ABCDEFG = _mm256_permute_ps(_mm256_blend_ps(vi2x89ABCDEF, vi2xCDEFGHIJ, 0x11), _MM_SHUFFLE(0, 3, 2, 1));
+      const __m256 vi3x9ABCDEFG = _mm256_permute_ps(_mm256_blend_ps(vi3x89ABCDEF, vi3xCDEFGHIJ, 0x11), _MM_SHUFFLE(0, 3, 2, 1));
+      const __m256 vi4x9ABCDEFG = _mm256_permute_ps(_mm256_blend_ps(vi4x89ABCDEF, vi4xCDEFGHIJ, 0x11), _MM_SHUFFLE(0, 3, 2, 1));
+      const __m256 vi5x9ABCDEFG = _mm256_permute_ps(_mm256_blend_ps(vi5x89ABCDEF, vi5xCDEFGHIJ, 0x11), _MM_SHUFFLE(0, 3, 2, 1));
+
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi0x9ABCDEFG, vk03));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi1x9ABCDEFG, vk03));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi1x9ABCDEFG, vk13));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi2x9ABCDEFG, vk13));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi2x9ABCDEFG, vk23));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi3x9ABCDEFG, vk23));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi3x9ABCDEFG, vk33));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi4x9ABCDEFG, vk33));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi4x9ABCDEFG, vk43));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi5x9ABCDEFG, vk43));
+
+      const __m256 vi0xABCDEFGH = _mm256_shuffle_ps(vi0x89ABCDEF, vi0xCDEFGHIJ, _MM_SHUFFLE(1, 0, 3, 2));
+      vi0x456789AB = vi0xCDEFGHIJ;
+      vi0x89ABCDEF = vi0xGHIJKLMN;
+      const __m256 vi1xABCDEFGH = _mm256_shuffle_ps(vi1x89ABCDEF, vi1xCDEFGHIJ, _MM_SHUFFLE(1, 0, 3, 2));
+      vi1x456789AB = vi1xCDEFGHIJ;
+      vi1x89ABCDEF = vi1xGHIJKLMN;
+      const __m256 vi2xABCDEFGH = _mm256_shuffle_ps(vi2x89ABCDEF, vi2xCDEFGHIJ, _MM_SHUFFLE(1, 0, 3, 2));
+      vi2x456789AB = vi2xCDEFGHIJ;
+      vi2x89ABCDEF = vi2xGHIJKLMN;
+      const __m256 vi3xABCDEFGH = _mm256_shuffle_ps(vi3x89ABCDEF, vi3xCDEFGHIJ, _MM_SHUFFLE(1, 0, 3, 2));
+      vi3x456789AB = vi3xCDEFGHIJ;
+      vi3x89ABCDEF = vi3xGHIJKLMN;
+      const __m256 vi4xABCDEFGH = _mm256_shuffle_ps(vi4x89ABCDEF, vi4xCDEFGHIJ, _MM_SHUFFLE(1, 0, 3, 2));
+      vi4x456789AB = vi4xCDEFGHIJ;
+      vi4x89ABCDEF = vi4xGHIJKLMN;
+      const __m256 vi5xABCDEFGH = _mm256_shuffle_ps(vi5x89ABCDEF, vi5xCDEFGHIJ, _MM_SHUFFLE(1, 0, 3, 2));
+      vi5x456789AB = vi5xCDEFGHIJ;
+      vi5x89ABCDEF = vi5xGHIJKLMN;
+
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi0xABCDEFGH, vk04));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi1xABCDEFGH, vk04));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi1xABCDEFGH, vk14));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi2xABCDEFGH, vk14));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi2xABCDEFGH, vk24));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi3xABCDEFGH, vk24));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi3xABCDEFGH, vk34));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi4xABCDEFGH, vk34));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi4xABCDEFGH, vk44));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi5xABCDEFGH, vk44));
+
+
+      __m256 vo0 = _mm256_max_ps(vo0p0, vmin);
+      __m256 vo1 = _mm256_max_ps(vo1p0, vmin);
+
+      vo0 = _mm256_min_ps(vo0, vmax);
+      vo1 = _mm256_min_ps(vo1, vmax);
+
+      _mm256_storeu_ps(o1, vo1);
+      o1 += 8;
+      _mm256_storeu_ps(o0, vo0);
+      o0 += 8;
+
+      w -= 8 * sizeof(float);
+    }
+    assert(w >= 1 * sizeof(float));
+    assert(w <= 8 * sizeof(float));
+    {
+      vi0x89ABCDEF = _mm256_and_ps(vi0x89ABCDEF, vmask);
+      vi1x89ABCDEF = _mm256_and_ps(vi1x89ABCDEF, vmask);
+      vi2x89ABCDEF = _mm256_and_ps(vi2x89ABCDEF, vmask);
+      vi3x89ABCDEF = _mm256_and_ps(vi3x89ABCDEF, vmask);
+      vi4x89ABCDEF = _mm256_and_ps(vi4x89ABCDEF, vmask);
+      vi5x89ABCDEF = _mm256_and_ps(vi5x89ABCDEF, vmask);
+
+      __m256 vo0p0 = _mm256_add_ps(vbias, _mm256_mul_ps(vi0x89ABCDEF, vk02));
+      __m256 vo1p0 = _mm256_add_ps(vbias, _mm256_mul_ps(vi1x89ABCDEF, vk02));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi1x89ABCDEF, vk12));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi2x89ABCDEF, vk12));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi2x89ABCDEF, vk22));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi3x89ABCDEF, vk22));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi3x89ABCDEF, vk32));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi4x89ABCDEF, vk32));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi4x89ABCDEF, vk42));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi5x89ABCDEF, vk42));
+
+      const __m256 vi0x789ABCDE = _mm256_permute_ps(_mm256_blend_ps(vi0x89ABCDEF, vi0x456789AB, 0x88), _MM_SHUFFLE(2, 1, 0, 3));
+      const __m256 vi1x789ABCDE = _mm256_permute_ps(_mm256_blend_ps(vi1x89ABCDEF, vi1x456789AB, 0x88), _MM_SHUFFLE(2, 1, 0, 3));
+      const __m256 vi2x789ABCDE = _mm256_permute_ps(_mm256_blend_ps(vi2x89ABCDEF, vi2x456789AB, 0x88), _MM_SHUFFLE(2, 1, 0, 3));
+      const __m256 vi3x789ABCDE = _mm256_permute_ps(_mm256_blend_ps(vi3x89ABCDEF, vi3x456789AB, 0x88), _MM_SHUFFLE(2, 1, 0, 3));
+      const __m256 vi4x789ABCDE = _mm256_permute_ps(_mm256_blend_ps(vi4x89ABCDEF, vi4x456789AB, 0x88), _MM_SHUFFLE(2, 1, 0, 3));
+      const __m256 vi5x789ABCDE = _mm256_permute_ps(_mm256_blend_ps(vi5x89ABCDEF, vi5x456789AB, 0x88), _MM_SHUFFLE(2, 1, 0, 3));
+
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi0x789ABCDE, vk01));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi1x789ABCDE, vk01));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi1x789ABCDE, vk11));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi2x789ABCDE, vk11));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi2x789ABCDE, vk21));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi3x789ABCDE, vk21));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi3x789ABCDE, vk31));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi4x789ABCDE, vk31));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi4x789ABCDE, vk41));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi5x789ABCDE, vk41));
+
+      const __m256 vi0x6789ABCD = _mm256_shuffle_ps(vi0x456789AB, vi0x89ABCDEF, _MM_SHUFFLE(1, 0, 3, 2));
+      const __m256 vi1x6789ABCD = _mm256_shuffle_ps(vi1x456789AB, vi1x89ABCDEF, _MM_SHUFFLE(1, 0, 3, 2));
+      const __m256 vi2x6789ABCD = _mm256_shuffle_ps(vi2x456789AB, vi2x89ABCDEF, _MM_SHUFFLE(1, 0, 3, 2));
+      const __m256 vi3x6789ABCD = _mm256_shuffle_ps(vi3x456789AB, vi3x89ABCDEF, _MM_SHUFFLE(1, 0, 3, 2));
+      const __m256 vi4x6789ABCD = _mm256_shuffle_ps(vi4x456789AB, vi4x89ABCDEF, _MM_SHUFFLE(1, 0, 3, 2));
+      const __m256 vi5x6789ABCD = _mm256_shuffle_ps(vi5x456789AB, vi5x89ABCDEF, _MM_SHUFFLE(1, 0, 3, 2));
+
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi0x6789ABCD, vk00));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi1x6789ABCD, vk00));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi1x6789ABCD, vk10));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi2x6789ABCD, vk10));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi2x6789ABCD, vk20));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi3x6789ABCD, vk20));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi3x6789ABCD, vk30));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi4x6789ABCD, vk30));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi4x6789ABCD, vk40));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi5x6789ABCD, vk40));
+
+      // vi0xCDEFGHIJ = ( 0.0, 0.0, 0.0, 0.0, vi0F, vi0E, vi0D, vi0C )
+      const __m256 vi0xCDEFGHIJ = _mm256_permute2f128_ps(vi0x89ABCDEF, vi0x89ABCDEF, 0x81);
+      // vi1xCDEFGHIJ = ( 0.0, 0.0, 0.0, 0.0, vi1F, vi1E, vi1D, vi1C )
+      const __m256 vi1xCDEFGHIJ = _mm256_permute2f128_ps(vi1x89ABCDEF, vi1x89ABCDEF, 0x81);
+      // vi2xCDEFGHIJ = ( 0.0, 0.0, 0.0, 0.0, vi2F, vi2E, vi2D, vi2C )
+      const __m256 vi2xCDEFGHIJ = _mm256_permute2f128_ps(vi2x89ABCDEF, vi2x89ABCDEF, 0x81);
+      // vi3xCDEFGHIJ = ( 0.0, 0.0, 0.0, 0.0, vi3F, vi3E, vi3D, vi3C )
+      const __m256 vi3xCDEFGHIJ = _mm256_permute2f128_ps(vi3x89ABCDEF, vi3x89ABCDEF, 0x81);
+      // vi4xCDEFGHIJ = ( 0.0, 0.0, 0.0, 0.0, vi4F, vi4E, vi4D, vi4C )
+      const __m256 vi4xCDEFGHIJ = _mm256_permute2f128_ps(vi4x89ABCDEF, vi4x89ABCDEF, 0x81);
+      // vi5xCDEFGHIJ = ( 0.0, 0.0, 0.0, 0.0, vi5F, vi5E, vi5D, vi5C )
+      const __m256 vi5xCDEFGHIJ = _mm256_permute2f128_ps(vi5x89ABCDEF, vi5x89ABCDEF, 0x81);
+
+      const __m256 vi0x9ABCDEFG = _mm256_permute_ps(_mm256_blend_ps(vi0x89ABCDEF, vi0xCDEFGHIJ, 0x11), _MM_SHUFFLE(0, 3, 2, 1));
+      const __m256 vi1x9ABCDEFG = _mm256_permute_ps(_mm256_blend_ps(vi1x89ABCDEF, vi1xCDEFGHIJ, 0x11), _MM_SHUFFLE(0, 3, 2, 1));
+      const __m256 vi2x9ABCDEFG = _mm256_permute_ps(_mm256_blend_ps(vi2x89ABCDEF, vi2xCDEFGHIJ, 0x11), _MM_SHUFFLE(0, 3, 2, 1));
+      const __m256 vi3x9ABCDEFG = _mm256_permute_ps(_mm256_blend_ps(vi3x89ABCDEF, vi3xCDEFGHIJ, 0x11), _MM_SHUFFLE(0, 3, 2, 1));
+      const __m256 vi4x9ABCDEFG = _mm256_permute_ps(_mm256_blend_ps(vi4x89ABCDEF, vi4xCDEFGHIJ, 0x11), _MM_SHUFFLE(0, 3, 2, 1));
+      const __m256 vi5x9ABCDEFG = _mm256_permute_ps(_mm256_blend_ps(vi5x89ABCDEF, vi5xCDEFGHIJ, 0x11), _MM_SHUFFLE(0, 3, 2, 1));
+
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi0x9ABCDEFG, vk03));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi1x9ABCDEFG, vk03));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi1x9ABCDEFG, vk13));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi2x9ABCDEFG, vk13));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi2x9ABCDEFG, vk23));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi3x9ABCDEFG, vk23));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi3x9ABCDEFG, vk33));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi4x9ABCDEFG, vk33));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi4x9ABCDEFG, vk43));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi5x9ABCDEFG, vk43));
+
+      const __m256 vi0xABCDEFGH = _mm256_shuffle_ps(vi0x89ABCDEF, vi0xCDEFGHIJ, _MM_SHUFFLE(1, 0, 3, 2));
+      const __m256 vi1xABCDEFGH = _mm256_shuffle_ps(vi1x89ABCDEF, vi1xCDEFGHIJ, _MM_SHUFFLE(1, 0, 3, 2));
+      const __m256 vi2xABCDEFGH = _mm256_shuffle_ps(vi2x89ABCDEF, vi2xCDEFGHIJ, _MM_SHUFFLE(1, 0, 3, 2));
+      const __m256 vi3xABCDEFGH = _mm256_shuffle_ps(vi3x89ABCDEF, vi3xCDEFGHIJ, _MM_SHUFFLE(1, 0, 3, 2));
+      const __m256 vi4xABCDEFGH = _mm256_shuffle_ps(vi4x89ABCDEF, vi4xCDEFGHIJ, _MM_SHUFFLE(1, 0, 3, 2));
+      const __m256 vi5xABCDEFGH = _mm256_shuffle_ps(vi5x89ABCDEF, vi5xCDEFGHIJ, _MM_SHUFFLE(1, 0, 3, 2));
+
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi0xABCDEFGH, vk04));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi1xABCDEFGH, vk04));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi1xABCDEFGH, vk14));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi2xABCDEFGH, vk14));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi2xABCDEFGH, vk24));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi3xABCDEFGH, vk24));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi3xABCDEFGH, vk34));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi4xABCDEFGH, vk34));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi4xABCDEFGH, vk44));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi5xABCDEFGH, vk44));
+
+
+      __m256 vo0 = _mm256_max_ps(vo0p0, vmin);
+      __m256 vo1 = _mm256_max_ps(vo1p0, vmin);
+
+      vo0 = _mm256_min_ps(vo0, vmax);
+      vo1 = _mm256_min_ps(vo1, vmax);
+
+      if XNN_LIKELY(w & (8 * sizeof(float))) {
+        _mm256_storeu_ps(o1, vo1);
+        o1 += 8;
+        _mm256_storeu_ps(o0, vo0);
+        o0 += 8;
+      } else {
+        __m128 vo1_lo = _mm256_castps256_ps128(vo1);
+        __m128 vo0_lo = _mm256_castps256_ps128(vo0);
+        if (w & (4 * sizeof(float))) {
+          _mm_storeu_ps(o1, vo1_lo);
+          o1 += 4;
+          _mm_storeu_ps(o0, vo0_lo);
+          o0 += 4;
+
+          vo0_lo = _mm256_extractf128_ps(vo0, 1);
+          vo1_lo = _mm256_extractf128_ps(vo1, 1);
+        }
+        if (w & (2 * sizeof(float))) {
+          _mm_storel_pi((__m64*) o1, vo1_lo);
+          o1 += 2;
+          _mm_storel_pi((__m64*) o0, vo0_lo);
+          o0 += 2;
+
+          vo0_lo = _mm_movehl_ps(vo0_lo, vo0_lo);
+          vo1_lo = _mm_movehl_ps(vo1_lo, vo1_lo);
+        }
+        if (w & (1 * sizeof(float))) {
+          _mm_store_ss(o1, vo1_lo);
+          o1 += 1;
+          _mm_store_ss(o0, vo0_lo);
+          o0 += 1;
+        }
+      }
+    }
+
+    i0 = (const float*) ((uintptr_t) i2 - input_decrement);
+    i1 = (const float*) ((uintptr_t) i3 - input_decrement);
+    i2 = (const float*) ((uintptr_t) i1 + input_width);
+    i3 = (const float*) ((uintptr_t) i2 + input_width);
+    i4 = (const float*) ((uintptr_t) i3 + input_width);
+    i5 = (const float*) ((uintptr_t) i4 + input_width);
+
+    o0 = o1;
+    o1 = (float*) ((uintptr_t) o0 + input_width);
+
+    output_height = doz(output_height, 2);
+  } while (output_height != 0);
+}
+
+void xnn_f32_dwconv2d_chw_ukernel_5x5s2p2__avx_1x8_acc3(
+    size_t input_height,
+    size_t input_width,
+    const float* input,
+    const float* weights,
+    const float* zero,
+    float* output,
+    uint32_t padding_top,
+    const union xnn_f32_chw_params params[restrict XNN_MIN_ELEMENTS(1)]) XNN_OOB_READS
+{
+  assert(input_height != 0);
+  assert(input_width != 0);
+  assert(input_width % sizeof(float) == 0);
+  assert(padding_top >= 1);
+  assert(padding_top <= 2);
+
+  const __m256 vmask_even = _mm256_load_ps((const float*) params->sse.mask_even8);
+  const __m256 vmask_odd  = _mm256_load_ps((const float*) params->sse.mask_odd8);
+  const __m256 vmax = _mm256_broadcast_ss(params->sse.max);
+  const __m256 vmin = _mm256_broadcast_ss(params->sse.min);
+
+  const __m256 vbias = _mm256_broadcast_ss(weights);
+  const __m256 vk00 = _mm256_broadcast_ss(weights + 1);
+  const __m256 vk01 = _mm256_broadcast_ss(weights + 2);
+  const __m256 vk02 = _mm256_broadcast_ss(weights + 3);
+  const __m256 vk03 = _mm256_broadcast_ss(weights + 4);
+  const __m256 vk04 = _mm256_broadcast_ss(weights + 5);
+  const __m256 vk10 = _mm256_broadcast_ss(weights + 6);
+  const __m256 vk11 = _mm256_broadcast_ss(weights + 7);
+  const __m256 vk12 = _mm256_broadcast_ss(weights + 8);
+  const __m256 vk13 = _mm256_broadcast_ss(weights + 9);
+  const __m256 vk14 = _mm256_broadcast_ss(weights + 10);
+  const __m256 vk20 = _mm256_broadcast_ss(weights + 11);
+  const __m256 vk21 = _mm256_broadcast_ss(weights + 12);
+  const __m256 vk22 = _mm256_broadcast_ss(weights + 13);
+  const __m256 vk23 = _mm256_broadcast_ss(weights + 14);
+  const __m256 vk24 = _mm256_broadcast_ss(weights + 15);
+  const __m256 vk30 = _mm256_broadcast_ss(weights + 16);
+  const __m256 vk31 = _mm256_broadcast_ss(weights + 17);
+  const __m256 vk32 = _mm256_broadcast_ss(weights + 18);
+  const __m256 vk33 = _mm256_broadcast_ss(weights + 19);
+  const __m256 vk34 = _mm256_broadcast_ss(weights + 20);
+  const __m256 vk40 = _mm256_broadcast_ss(weights + 21);
+  const __m256 vk41 = _mm256_broadcast_ss(weights + 22);
+  const __m256 vk42 = _mm256_broadcast_ss(weights + 23);
+  const __m256 vk43 = _mm256_broadcast_ss(weights + 24);
+  const __m256 vk44 = _mm256_broadcast_ss(weights + 25);
+
+  const uint32_t padding_top_less_1 = padding_top - 1;
+  const size_t input_decrement = round_up_po2(input_width, 8 /* SIMD output width */ * 2 /* subsampling */ * sizeof(float));
+
+  const float* i0 = zero;
+  const float* i1 = (const float*) ((uintptr_t) input - ((-padding_top_less_1) & input_width));
+  const float* i2 = (const float*) ((uintptr_t) i1 + input_width);
+  if XNN_UNPREDICTABLE(padding_top_less_1 != 0) {
+    i1 = zero;
+  }
+  const float* i3 = (const float*) ((uintptr_t) i2 + input_width);
+  const float* i4 = (const float*) ((uintptr_t) i3 + input_width);
+
+
+  float* o0 = output;
+
+  size_t padded_input_height = input_height + (padding_top_less_1 + 1) + 2 /* padding bottom */;
+  size_t output_height = (padded_input_height - 5 /* kernel size */ + 2 /* subsampling */) / 2;
+  do {
+    if XNN_UNPREDICTABLE(padded_input_height < 6) {
+      i3 = zero;
+    }
+    if XNN_UNPREDICTABLE(padded_input_height < 7) {
+      i4 = zero;
+    }
+
+    __m256 vi0x02468ACE = _mm256_setzero_ps();
+    __m256 vi1x02468ACE = _mm256_setzero_ps();
+    __m256 vi2x02468ACE = _mm256_setzero_ps();
+    __m256 vi3x02468ACE = _mm256_setzero_ps();
+    __m256 vi4x02468ACE = _mm256_setzero_ps();
+
+    __m256 vi0x13579BDF = _mm256_setzero_ps();
+    __m256 vi1x13579BDF = _mm256_setzero_ps();
+    __m256 vi2x13579BDF = _mm256_setzero_ps();
+    __m256 vi3x13579BDF = _mm256_setzero_ps();
+    __m256 vi4x13579BDF = _mm256_setzero_ps();
+
+    const __m256 vi0xGHIJKLMN = _mm256_loadu_ps(i0);
+    const __m256 vi1xGHIJKLMN = _mm256_loadu_ps(i1);
+    const __m256 vi2xGHIJKLMN = _mm256_loadu_ps(i2);
+    const __m256 vi3xGHIJKLMN = _mm256_loadu_ps(i3);
+    const __m256 vi4xGHIJKLMN = _mm256_loadu_ps(i4);
+    __m256 vi0xOPQRSTUV = _mm256_setzero_ps();
+    __m256 vi1xOPQRSTUV = _mm256_setzero_ps();
+    __m256 vi2xOPQRSTUV = _mm256_setzero_ps();
+    __m256 vi3xOPQRSTUV = _mm256_setzero_ps();
+    __m256 vi4xOPQRSTUV = _mm256_setzero_ps();
+    if XNN_LIKELY(input_width > 8 * sizeof(float)) {
+      vi0xOPQRSTUV = _mm256_loadu_ps(i0 + 8);
+      vi1xOPQRSTUV = _mm256_loadu_ps(i1 + 8);
+      vi2xOPQRSTUV = _mm256_loadu_ps(i2 + 8);
+      vi3xOPQRSTUV = _mm256_loadu_ps(i3 + 8);
+      vi4xOPQRSTUV = _mm256_loadu_ps(i4 + 8);
+    }
+    i0 += 16;
+    i1 += 16;
+    i2 += 16;
+    i3 += 16;
+    i4 += 16;
+
+    const __m256 vi0xGHIJOPQR = _mm256_permute2f128_ps(vi0xGHIJKLMN, vi0xOPQRSTUV, 0x20);
+    const __m256 vi0xKLMNSTUV = _mm256_permute2f128_ps(vi0xGHIJKLMN, vi0xOPQRSTUV, 0x31);
+    const __m256 vi1xGHIJOPQR = _mm256_permute2f128_ps(vi1xGHIJKLMN, vi1xOPQRSTUV, 0x20);
+    const __m256 vi1xKLMNSTUV = _mm256_permute2f128_ps(vi1xGHIJKLMN, vi1xOPQRSTUV, 0x31);
+    const __m256 vi2xGHIJOPQR = _mm256_permute2f128_ps(vi2xGHIJKLMN, vi2xOPQRSTUV, 0x20);
+    const __m256 vi2xKLMNSTUV = _mm256_permute2f128_ps(vi2xGHIJKLMN, vi2xOPQRSTUV, 0x31);
+    const __m256 vi3xGHIJOPQR = _mm256_permute2f128_ps(vi3xGHIJKLMN, vi3xOPQRSTUV, 0x20);
+    const __m256 vi3xKLMNSTUV = _mm256_permute2f128_ps(vi3xGHIJKLMN, vi3xOPQRSTUV, 0x31);
+    const __m256 vi4xGHIJOPQR = _mm256_permute2f128_ps(vi4xGHIJKLMN, vi4xOPQRSTUV, 0x20);
+    const __m256 vi4xKLMNSTUV = _mm256_permute2f128_ps(vi4xGHIJKLMN, vi4xOPQRSTUV, 0x31);
+
+    __m256 vi0xGIKMOQSU = _mm256_shuffle_ps(vi0xGHIJOPQR, vi0xKLMNSTUV, _MM_SHUFFLE(2, 0, 2, 0));
+    __m256 vi0xHJLNPRTV = _mm256_shuffle_ps(vi0xGHIJOPQR, vi0xKLMNSTUV, _MM_SHUFFLE(3, 1, 3, 1));
+    __m256 vi1xGIKMOQSU = _mm256_shuffle_ps(vi1xGHIJOPQR, vi1xKLMNSTUV, _MM_SHUFFLE(2, 0, 2, 0));
+    __m256 vi1xHJLNPRTV = _mm256_shuffle_ps(vi1xGHIJOPQR, vi1xKLMNSTUV, _MM_SHUFFLE(3, 1, 3, 1));
+    __m256 vi2xGIKMOQSU = _mm256_shuffle_ps(vi2xGHIJOPQR, vi2xKLMNSTUV, _MM_SHUFFLE(2, 0, 2, 0));
+    __m256 vi2xHJLNPRTV = _mm256_shuffle_ps(vi2xGHIJOPQR, vi2xKLMNSTUV, _MM_SHUFFLE(3, 1, 3, 1));
+    __m256 vi3xGIKMOQSU = _mm256_shuffle_ps(vi3xGHIJOPQR, vi3xKLMNSTUV, _MM_SHUFFLE(2, 0, 2, 0));
+    __m256 vi3xHJLNPRTV = _mm256_shuffle_ps(vi3xGHIJOPQR, vi3xKLMNSTUV, _MM_SHUFFLE(3, 1, 3, 1));
+    __m256 vi4xGIKMOQSU = _mm256_shuffle_ps(vi4xGHIJOPQR, vi4xKLMNSTUV, _MM_SHUFFLE(2, 0, 2, 0));
+    __m256 vi4xHJLNPRTV = _mm256_shuffle_ps(vi4xGHIJOPQR, vi4xKLMNSTUV, _MM_SHUFFLE(3, 1, 3, 1));
+
+    size_t w = input_width;
+    for (; w > 32 * sizeof(float); w -= 16 * sizeof(float)) {
+      __m256 vo0p0 = _mm256_add_ps(vbias, _mm256_mul_ps(vi0xGIKMOQSU, vk02));
+      __m256 vo0p1 = _mm256_mul_ps(vi1xGIKMOQSU, vk12);
+      __m256 vo0p2 = _mm256_mul_ps(vi2xGIKMOQSU, vk22);
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi3xGIKMOQSU, vk32));
+      vo0p1 = _mm256_add_ps(vo0p1, _mm256_mul_ps(vi4xGIKMOQSU, vk42));
+
+      const __m256 vi0xWXYZabcd = _mm256_loadu_ps(i0);
+      const __m256 vi0xefghijkl = _mm256_loadu_ps(i0 + 8);
+      i0 += 16;
+      const __m256 vi1xWXYZabcd = _mm256_loadu_ps(i1);
+      const __m256 vi1xefghijkl = _mm256_loadu_ps(i1 + 8);
+      i1 += 16;
+      const __m256 vi2xWXYZabcd = _mm256_loadu_ps(i2);
+      const __m256 vi2xefghijkl = _mm256_loadu_ps(i2 + 8);
+      i2 += 16;
+      const __m256 vi3xWXYZabcd = _mm256_loadu_ps(i3);
+      const __m256 vi3xefghijkl = _mm256_loadu_ps(i3 + 8);
+      i3 += 16;
+      const __m256 vi4xWXYZabcd = _mm256_loadu_ps(i4);
+      const __m256 vi4xefghijkl = _mm256_loadu_ps(i4 + 8);
+      i4 += 16;
+
+      vo0p2 = _mm256_add_ps(vo0p2, _mm256_mul_ps(vi0xHJLNPRTV, vk03));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi1xHJLNPRTV, vk13));
+      vo0p1 = _mm256_add_ps(vo0p1, _mm256_mul_ps(vi2xHJLNPRTV, vk23));
+      vo0p2 = _mm256_add_ps(vo0p2, _mm256_mul_ps(vi3xHJLNPRTV, vk33));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi4xHJLNPRTV, vk43));
+
+      const __m256 vi0x8ACEGIKM = _mm256_permute2f128_ps(vi0x02468ACE, vi0xGIKMOQSU, 0x21);
+      vi0x02468ACE = vi0xGIKMOQSU;
+      const __m256 vi1x8ACEGIKM = _mm256_permute2f128_ps(vi1x02468ACE, vi1xGIKMOQSU, 0x21);
+      vi1x02468ACE = vi1xGIKMOQSU;
+      const __m256 vi2x8ACEGIKM = _mm256_permute2f128_ps(vi2x02468ACE, vi2xGIKMOQSU, 0x21);
+      vi2x02468ACE = vi2xGIKMOQSU;
+      const __m256 vi3x8ACEGIKM = _mm256_permute2f128_ps(vi3x02468ACE, vi3xGIKMOQSU, 0x21);
+      vi3x02468ACE = vi3xGIKMOQSU;
+      const __m256 vi4x8ACEGIKM = _mm256_permute2f128_ps(vi4x02468ACE, vi4xGIKMOQSU, 0x21);
+      vi4x02468ACE = vi4xGIKMOQSU;
+
+      const __m256 vi0xEGIKMOQS = _mm256_permute_ps(_mm256_blend_ps(vi0xGIKMOQSU, vi0x8ACEGIKM, 0x88), _MM_SHUFFLE(2, 1, 0, 3));
+      const __m256 vi1xEGIKMOQS = _mm256_permute_ps(_mm256_blend_ps(vi1xGIKMOQSU, vi1x8ACEGIKM, 0x88), _MM_SHUFFLE(2, 1, 0, 3));
+      const __m256 vi2xEGIKMOQS = _mm256_permute_ps(_mm256_blend_ps(vi2xGIKMOQSU, vi2x8ACEGIKM, 0x88), _MM_SHUFFLE(2, 1, 0, 3));
+      const __m256 vi3xEGIKMOQS = _mm256_permute_ps(_mm256_blend_ps(vi3xGIKMOQSU, vi3x8ACEGIKM, 0x88), _MM_SHUFFLE(2, 1, 0, 3));
+      const __m256 vi4xEGIKMOQS = _mm256_permute_ps(_mm256_blend_ps(vi4xGIKMOQSU, vi4x8ACEGIKM, 0x88), _MM_SHUFFLE(2, 1, 0, 3));
+
+      vo0p1 = _mm256_add_ps(vo0p1, _mm256_mul_ps(vi0xEGIKMOQS, vk00));
+      vo0p2 = _mm256_add_ps(vo0p2, _mm256_mul_ps(vi1xEGIKMOQS, vk10));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi2xEGIKMOQS, vk20));
+      vo0p1 = _mm256_add_ps(vo0p1, _mm256_mul_ps(vi3xEGIKMOQS, vk30));
+      vo0p2 = _mm256_add_ps(vo0p2, _mm256_mul_ps(vi4xEGIKMOQS, vk40));
+
+      const __m256 vi0x9BDFHJLN = _mm256_permute2f128_ps(vi0x13579BDF, vi0xHJLNPRTV, 0x21);
+      vi0x13579BDF = vi0xHJLNPRTV;
+      const __m256 vi1x9BDFHJLN = _mm256_permute2f128_ps(vi1x13579BDF, vi1xHJLNPRTV, 0x21);
+      vi1x13579BDF = vi1xHJLNPRTV;
+      const __m256 vi2x9BDFHJLN = _mm256_permute2f128_ps(vi2x13579BDF, vi2xHJLNPRTV, 0x21);
+      vi2x13579BDF = vi2xHJLNPRTV;
+      const __m256 vi3x9BDFHJLN = _mm256_permute2f128_ps(vi3x13579BDF, vi3xHJLNPRTV, 0x21);
+      vi3x13579BDF = vi3xHJLNPRTV;
+      const __m256 vi4x9BDFHJLN = _mm256_permute2f128_ps(vi4x13579BDF, vi4xHJLNPRTV, 0x21);
+      vi4x13579BDF = vi4xHJLNPRTV;
+
+      const __m256 vi0xFHJLNPRT = _mm256_permute_ps(_mm256_blend_ps(vi0xHJLNPRTV, vi0x9BDFHJLN, 0x88), _MM_SHUFFLE(2, 1, 0, 3));
+      const __m256 vi1xFHJLNPRT = _mm256_permute_ps(_mm256_blend_ps(vi1xHJLNPRTV, vi1x9BDFHJLN, 0x88), _MM_SHUFFLE(2, 1, 0, 3));
+      const __m256 vi2xFHJLNPRT = _mm256_permute_ps(_mm256_blend_ps(vi2xHJLNPRTV, vi2x9BDFHJLN, 0x88), _MM_SHUFFLE(2, 1, 0, 3));
+      const __m256 vi3xFHJLNPRT = _mm256_permute_ps(_mm256_blend_ps(vi3xHJLNPRTV, vi3x9BDFHJLN, 0x88), _MM_SHUFFLE(2, 1, 0, 3));
+      const __m256 vi4xFHJLNPRT = _mm256_permute_ps(_mm256_blend_ps(vi4xHJLNPRTV, vi4x9BDFHJLN, 0x88), _MM_SHUFFLE(2, 1, 0, 3));
+
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi0xFHJLNPRT, vk01));
+      vo0p1 = _mm256_add_ps(vo0p1, _mm256_mul_ps(vi1xFHJLNPRT, vk11));
+      vo0p2 = _mm256_add_ps(vo0p2, _mm256_mul_ps(vi2xFHJLNPRT, vk21));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi3xFHJLNPRT, vk31));
+      vo0p1 = _mm256_add_ps(vo0p1, _mm256_mul_ps(vi4xFHJLNPRT, vk41));
+
+      const __m256 vi0xWXYZefgh = _mm256_permute2f128_ps(vi0xWXYZabcd, vi0xefghijkl, 0x20);
+      const __m256 vi0xabcdijkl = _mm256_permute2f128_ps(vi0xWXYZabcd, vi0xefghijkl, 0x31);
+      const __m256 vi1xWXYZefgh = _mm256_permute2f128_ps(vi1xWXYZabcd, vi1xefghijkl, 0x20);
+      const __m256 vi1xabcdijkl = _mm256_permute2f128_ps(vi1xWXYZabcd, vi1xefghijkl, 0x31);
+      const __m256 vi2xWXYZefgh = _mm256_permute2f128_ps(vi2xWXYZabcd, vi2xefghijkl, 0x20);
+      const __m256 vi2xabcdijkl = _mm256_permute2f128_ps(vi2xWXYZabcd, vi2xefghijkl, 0x31);
+      const __m256 vi3xWXYZefgh = _mm256_permute2f128_ps(vi3xWXYZabcd, vi3xefghijkl, 0x20);
+      const __m256 vi3xabcdijkl = _mm256_permute2f128_ps(vi3xWXYZabcd, vi3xefghijkl, 0x31);
+      const __m256 vi4xWXYZefgh = _mm256_permute2f128_ps(vi4xWXYZabcd, vi4xefghijkl, 0x20);
+      const __m256 vi4xabcdijkl = _mm256_permute2f128_ps(vi4xWXYZabcd, vi4xefghijkl, 0x31);
+
+      const __m256 vi0xWYacegik = _mm256_shuffle_ps(vi0xWXYZefgh, vi0xabcdijkl, _MM_SHUFFLE(2, 0, 2, 0));
+      const __m256 vi0xXZbdfhjl = _mm256_shuffle_ps(vi0xWXYZefgh, vi0xabcdijkl, _MM_SHUFFLE(3, 1, 3, 1));
+      const __m256 vi1xWYacegik = _mm256_shuffle_ps(vi1xWXYZefgh, vi1xabcdijkl, _MM_SHUFFLE(2, 0, 2, 0));
+      const __m256 vi1xXZbdfhjl = _mm256_shuffle_ps(vi1xWXYZefgh, vi1xabcdijkl, _MM_SHUFFLE(3, 1, 3, 1));
+      const __m256 vi2xWYacegik = _mm256_shuffle_ps(vi2xWXYZefgh, vi2xabcdijkl, _MM_SHUFFLE(2, 0, 2, 0));
+      const __m256 vi2xXZbdfhjl = _mm256_shuffle_ps(vi2xWXYZefgh, vi2xabcdijkl, _MM_SHUFFLE(3, 1, 3, 1));
+      const __m256 vi3xWYacegik = _mm256_shuffle_ps(vi3xWXYZefgh, vi3xabcdijkl, _MM_SHUFFLE(2, 0, 2, 0));
+      const __m256 vi3xXZbdfhjl = _mm256_shuffle_ps(vi3xWXYZefgh, vi3xabcdijkl, _MM_SHUFFLE(3, 1, 3, 1));
+      const __m256 vi4xWYacegik = _mm256_shuffle_ps(vi4xWXYZefgh, vi4xabcdijkl, _MM_SHUFFLE(2, 0, 2, 0));
+      const __m256 vi4xXZbdfhjl = _mm256_shuffle_ps(vi4xWXYZefgh, vi4xabcdijkl, _MM_SHUFFLE(3, 1, 3, 1));
+
+      const __m256 vi0xOQSUWYac = _mm256_permute2f128_ps(vi0xGIKMOQSU, vi0xWYacegik, 0x21);
+      const __m256 vi1xOQSUWYac = _mm256_permute2f128_ps(vi1xGIKMOQSU, vi1xWYacegik, 0x21);
+      const __m256 vi2xOQSUWYac = _mm256_permute2f128_ps(vi2xGIKMOQSU, vi2xWYacegik, 0x21);
+      const __m256 vi3xOQSUWYac = _mm256_permute2f128_ps(vi3xGIKMOQSU, vi3xWYacegik, 0x21);
+      const __m256 vi4xOQSUWYac = _mm256_permute2f128_ps(vi4xGIKMOQSU, vi4xWYacegik, 0x21);
+
+      const __m256 vi0xIKMOQSUW = _mm256_permute_ps(_mm256_blend_ps(vi0xGIKMOQSU, vi0xOQSUWYac, 0x11), _MM_SHUFFLE(0, 3, 2, 1));
+      vi0xGIKMOQSU = vi0xWYacegik;
+      vi0xHJLNPRTV = vi0xXZbdfhjl;
+      const __m256 vi1xIKMOQSUW = _mm256_permute_ps(_mm256_blend_ps(vi1xGIKMOQSU, vi1xOQSUWYac, 0x11), _MM_SHUFFLE(0, 3, 2, 1));
+      vi1xGIKMOQSU = vi1xWYacegik;
+      vi1xHJLNPRTV = vi1xXZbdfhjl;
+      const __m256 vi2xIKMOQSUW = _mm256_permute_ps(_mm256_blend_ps(vi2xGIKMOQSU, vi2xOQSUWYac, 0x11), _MM_SHUFFLE(0, 3, 2, 1));
+      vi2xGIKMOQSU = vi2xWYacegik;
+      vi2xHJLNPRTV = vi2xXZbdfhjl;
+      const __m256 vi3xIKMOQSUW = _mm256_permute_ps(_mm256_blend_ps(vi3xGIKMOQSU, vi3xOQSUWYac, 0x11), _MM_SHUFFLE(0, 3, 2, 1));
+      vi3xGIKMOQSU = vi3xWYacegik;
+      vi3xHJLNPRTV = vi3xXZbdfhjl;
+      const __m256 vi4xIKMOQSUW = _mm256_permute_ps(_mm256_blend_ps(vi4xGIKMOQSU, vi4xOQSUWYac, 0x11), _MM_SHUFFLE(0, 3, 2, 1));
+      vi4xGIKMOQSU = vi4xWYacegik;
+      vi4xHJLNPRTV = vi4xXZbdfhjl;
+
+      vo0p2 = _mm256_add_ps(vo0p2, _mm256_mul_ps(vi0xIKMOQSUW, vk04));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi1xIKMOQSUW, vk14));
+      vo0p1 = _mm256_add_ps(vo0p1, _mm256_mul_ps(vi2xIKMOQSUW, vk24));
+      vo0p2 = _mm256_add_ps(vo0p2, _mm256_mul_ps(vi3xIKMOQSUW, vk34));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi4xIKMOQSUW, vk44));
+
+      vo0p0 = _mm256_add_ps(vo0p0, vo0p1);
+      vo0p0 = _mm256_add_ps(vo0p0, vo0p2);
+
+      __m256 vo0 = _mm256_max_ps(vo0p0, vmin);
+
+      vo0 = _mm256_min_ps(vo0, vmax);
+
+      _mm256_storeu_ps(o0, vo0);
+      o0 += 8;
+    }
+    // Process the next-to-last block, loading only the part of the last block that lies within the row.
+    if XNN_LIKELY(w > 16 * sizeof(float)) {
+      __m256 vo0p0 = _mm256_add_ps(vbias, _mm256_mul_ps(vi0xGIKMOQSU, vk02));
+      __m256 vo0p1 = _mm256_mul_ps(vi1xGIKMOQSU, vk12);
+      __m256 vo0p2 = _mm256_mul_ps(vi2xGIKMOQSU, vk22);
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi3xGIKMOQSU, vk32));
+      vo0p1 = _mm256_add_ps(vo0p1, _mm256_mul_ps(vi4xGIKMOQSU, vk42));
+
+      const __m256 vi0xWXYZabcd = _mm256_loadu_ps(i0);
+      const __m256 vi1xWXYZabcd = _mm256_loadu_ps(i1);
+      const __m256 vi2xWXYZabcd = _mm256_loadu_ps(i2);
+      const __m256 vi3xWXYZabcd = _mm256_loadu_ps(i3);
+      const __m256 vi4xWXYZabcd = _mm256_loadu_ps(i4);
+      __m256 vi0xefghijkl = _mm256_setzero_ps();
+      __m256 vi1xefghijkl = _mm256_setzero_ps();
+      __m256 vi2xefghijkl = _mm256_setzero_ps();
+      __m256 vi3xefghijkl = _mm256_setzero_ps();
+      __m256 vi4xefghijkl = _mm256_setzero_ps();
+      if (w > 24 * sizeof(float)) {
+        vi0xefghijkl = _mm256_loadu_ps(i0 + 8);
+        vi1xefghijkl = _mm256_loadu_ps(i1 + 8);
+        vi2xefghijkl = _mm256_loadu_ps(i2 + 8);
+        vi3xefghijkl = _mm256_loadu_ps(i3 + 8);
+        vi4xefghijkl = _mm256_loadu_ps(i4 + 8);
+      }
+      i0 += 16;
+      i1 += 16;
+      i2 += 16;
+      i3 += 16;
+      i4 += 16;
+
+      vo0p2 = _mm256_add_ps(vo0p2, _mm256_mul_ps(vi0xHJLNPRTV, vk03));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi1xHJLNPRTV, vk13));
+      vo0p1 = _mm256_add_ps(vo0p1, _mm256_mul_ps(vi2xHJLNPRTV, vk23));
+      vo0p2 = _mm256_add_ps(vo0p2, _mm256_mul_ps(vi3xHJLNPRTV, vk33));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi4xHJLNPRTV, vk43));
+
+      const __m256 vi0x8ACEGIKM = _mm256_permute2f128_ps(vi0x02468ACE, vi0xGIKMOQSU, 0x21);
+      vi0x02468ACE = vi0xGIKMOQSU;
+      const __m256 vi1x8ACEGIKM = _mm256_permute2f128_ps(vi1x02468ACE, vi1xGIKMOQSU, 0x21);
+      vi1x02468ACE = vi1xGIKMOQSU;
+      const __m256 vi2x8ACEGIKM = _mm256_permute2f128_ps(vi2x02468ACE, vi2xGIKMOQSU, 0x21);
+      vi2x02468ACE = vi2xGIKMOQSU;
+      const __m256 vi3x8ACEGIKM = _mm256_permute2f128_ps(vi3x02468ACE, vi3xGIKMOQSU, 0x21);
+      vi3x02468ACE = vi3xGIKMOQSU;
+      const __m256 vi4x8ACEGIKM = _mm256_permute2f128_ps(vi4x02468ACE, vi4xGIKMOQSU, 0x21);
+      vi4x02468ACE = vi4xGIKMOQSU;
+
+      const __m256 vi0xEGIKMOQS = _mm256_permute_ps(_mm256_blend_ps(vi0xGIKMOQSU, vi0x8ACEGIKM, 0x88), _MM_SHUFFLE(2, 1, 0, 3));
+      const __m256 vi1xEGIKMOQS = _mm256_permute_ps(_mm256_blend_ps(vi1xGIKMOQSU, vi1x8ACEGIKM, 0x88), _MM_SHUFFLE(2, 1, 0, 3));
+      const __m256 vi2xEGIKMOQS = _mm256_permute_ps(_mm256_blend_ps(vi2xGIKMOQSU, vi2x8ACEGIKM, 0x88), _MM_SHUFFLE(2, 1, 0, 3));
+      const __m256 vi3xEGIKMOQS = _mm256_permute_ps(_mm256_blend_ps(vi3xGIKMOQSU, vi3x8ACEGIKM, 0x88), _MM_SHUFFLE(2, 1, 0, 3));
+      const __m256 vi4xEGIKMOQS = _mm256_permute_ps(_mm256_blend_ps(vi4xGIKMOQSU, vi4x8ACEGIKM, 0x88), _MM_SHUFFLE(2, 1, 0, 3));
+
+      vo0p1 = _mm256_add_ps(vo0p1, _mm256_mul_ps(vi0xEGIKMOQS, vk00));
+      vo0p2 = _mm256_add_ps(vo0p2, _mm256_mul_ps(vi1xEGIKMOQS, vk10));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi2xEGIKMOQS, vk20));
+      vo0p1 = _mm256_add_ps(vo0p1, _mm256_mul_ps(vi3xEGIKMOQS, vk30));
+      vo0p2 = _mm256_add_ps(vo0p2, _mm256_mul_ps(vi4xEGIKMOQS, vk40));
+
+      const __m256 vi0x9BDFHJLN = _mm256_permute2f128_ps(vi0x13579BDF, vi0xHJLNPRTV, 0x21);
+      vi0x13579BDF = vi0xHJLNPRTV;
+      const __m256 vi1x9BDFHJLN = _mm256_permute2f128_ps(vi1x13579BDF, vi1xHJLNPRTV, 0x21);
+      vi1x13579BDF = vi1xHJLNPRTV;
+      const __m256 vi2x9BDFHJLN = _mm256_permute2f128_ps(vi2x13579BDF, vi2xHJLNPRTV, 0x21);
+      vi2x13579BDF = vi2xHJLNPRTV;
+      const __m256 vi3x9BDFHJLN = _mm256_permute2f128_ps(vi3x13579BDF, vi3xHJLNPRTV, 0x21);
+      vi3x13579BDF = vi3xHJLNPRTV;
+      const __m256 vi4x9BDFHJLN = _mm256_permute2f128_ps(vi4x13579BDF, vi4xHJLNPRTV, 0x21);
+      vi4x13579BDF = vi4xHJLNPRTV;
+
+      const __m256 vi0xFHJLNPRT = _mm256_permute_ps(_mm256_blend_ps(vi0xHJLNPRTV, vi0x9BDFHJLN, 0x88), _MM_SHUFFLE(2, 1, 0, 3));
+      const __m256 vi1xFHJLNPRT = _mm256_permute_ps(_mm256_blend_ps(vi1xHJLNPRTV, vi1x9BDFHJLN, 0x88), _MM_SHUFFLE(2, 1, 0, 3));
+      const __m256 vi2xFHJLNPRT = _mm256_permute_ps(_mm256_blend_ps(vi2xHJLNPRTV, vi2x9BDFHJLN, 0x88), _MM_SHUFFLE(2, 1, 0, 3));
+      const __m256 vi3xFHJLNPRT = _mm256_permute_ps(_mm256_blend_ps(vi3xHJLNPRTV, vi3x9BDFHJLN, 0x88), _MM_SHUFFLE(2, 1, 0, 3));
+      const __m256 vi4xFHJLNPRT = _mm256_permute_ps(_mm256_blend_ps(vi4xHJLNPRTV, vi4x9BDFHJLN, 0x88), _MM_SHUFFLE(2, 1, 0, 3));
+
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi0xFHJLNPRT, vk01));
+      vo0p1 = _mm256_add_ps(vo0p1, _mm256_mul_ps(vi1xFHJLNPRT, vk11));
+      vo0p2 = _mm256_add_ps(vo0p2, _mm256_mul_ps(vi2xFHJLNPRT, vk21));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi3xFHJLNPRT, vk31));
+      vo0p1 = _mm256_add_ps(vo0p1, _mm256_mul_ps(vi4xFHJLNPRT, vk41));
+
+      const __m256 vi0xWXYZefgh = _mm256_permute2f128_ps(vi0xWXYZabcd, vi0xefghijkl, 0x20);
+      const __m256 vi0xabcdijkl = _mm256_permute2f128_ps(vi0xWXYZabcd, vi0xefghijkl, 0x31);
+      const __m256 vi1xWXYZefgh = _mm256_permute2f128_ps(vi1xWXYZabcd, vi1xefghijkl, 0x20);
+      const __m256 vi1xabcdijkl = _mm256_permute2f128_ps(vi1xWXYZabcd, vi1xefghijkl, 0x31);
+      const __m256 vi2xWXYZefgh = _mm256_permute2f128_ps(vi2xWXYZabcd, vi2xefghijkl, 0x20);
+      const __m256 vi2xabcdijkl = _mm256_permute2f128_ps(vi2xWXYZabcd, vi2xefghijkl, 0x31);
+      const __m256 vi3xWXYZefgh = _mm256_permute2f128_ps(vi3xWXYZabcd, vi3xefghijkl, 0x20);
+      const __m256 vi3xabcdijkl = _mm256_permute2f128_ps(vi3xWXYZabcd, vi3xefghijkl, 0x31);
+      const __m256 vi4xWXYZefgh = _mm256_permute2f128_ps(vi4xWXYZabcd, vi4xefghijkl, 0x20);
+      const __m256 vi4xabcdijkl = _mm256_permute2f128_ps(vi4xWXYZabcd, vi4xefghijkl, 0x31);
+
+      const __m256 vi0xWYacegik = _mm256_shuffle_ps(vi0xWXYZefgh, vi0xabcdijkl, _MM_SHUFFLE(2, 0, 2, 0));
+      const __m256 vi0xXZbdfhjl = _mm256_shuffle_ps(vi0xWXYZefgh, vi0xabcdijkl, _MM_SHUFFLE(3, 1, 3, 1));
+      const __m256 vi1xWYacegik = _mm256_shuffle_ps(vi1xWXYZefgh, vi1xabcdijkl, _MM_SHUFFLE(2, 0, 2, 0));
+      const __m256 vi1xXZbdfhjl = _mm256_shuffle_ps(vi1xWXYZefgh, vi1xabcdijkl, _MM_SHUFFLE(3, 1, 3, 1));
+      const __m256 vi2xWYacegik = _mm256_shuffle_ps(vi2xWXYZefgh, vi2xabcdijkl, _MM_SHUFFLE(2, 0, 2, 0));
+      const __m256 vi2xXZbdfhjl = _mm256_shuffle_ps(vi2xWXYZefgh, vi2xabcdijkl, _MM_SHUFFLE(3, 1, 3, 1));
+      const __m256 vi3xWYacegik = _mm256_shuffle_ps(vi3xWXYZefgh, vi3xabcdijkl, _MM_SHUFFLE(2, 0, 2, 0));
+      const __m256 vi3xXZbdfhjl = _mm256_shuffle_ps(vi3xWXYZefgh, vi3xabcdijkl, _MM_SHUFFLE(3, 1, 3, 1));
+      const __m256 vi4xWYacegik = _mm256_shuffle_ps(vi4xWXYZefgh, vi4xabcdijkl, _MM_SHUFFLE(2, 0, 2, 0));
+      const __m256 vi4xXZbdfhjl = _mm256_shuffle_ps(vi4xWXYZefgh, vi4xabcdijkl, _MM_SHUFFLE(3, 1, 3, 1));
+
+      const __m256 vi0xOQSUWYac = _mm256_permute2f128_ps(vi0xGIKMOQSU, vi0xWYacegik, 0x21);
+      const __m256 vi1xOQSUWYac = _mm256_permute2f128_ps(vi1xGIKMOQSU, vi1xWYacegik, 0x21);
+      const __m256 vi2xOQSUWYac = _mm256_permute2f128_ps(vi2xGIKMOQSU, vi2xWYacegik, 0x21);
+      const __m256 vi3xOQSUWYac = _mm256_permute2f128_ps(vi3xGIKMOQSU, vi3xWYacegik, 0x21);
+      const __m256 vi4xOQSUWYac = _mm256_permute2f128_ps(vi4xGIKMOQSU, vi4xWYacegik, 0x21);
+
+      const __m256 vi0xIKMOQSUW = _mm256_permute_ps(_mm256_blend_ps(vi0xGIKMOQSU, vi0xOQSUWYac, 0x11), _MM_SHUFFLE(0, 3, 2, 1));
+      vi0xGIKMOQSU = vi0xWYacegik;
+      vi0xHJLNPRTV = vi0xXZbdfhjl;
+      const __m256 vi1xIKMOQSUW = _mm256_permute_ps(_mm256_blend_ps(vi1xGIKMOQSU, vi1xOQSUWYac, 0x11), _MM_SHUFFLE(0, 3, 2, 1));
+      vi1xGIKMOQSU = vi1xWYacegik;
+      vi1xHJLNPRTV = vi1xXZbdfhjl;
+      const __m256 vi2xIKMOQSUW = _mm256_permute_ps(_mm256_blend_ps(vi2xGIKMOQSU, vi2xOQSUWYac, 0x11), _MM_SHUFFLE(0, 3, 2, 1));
+      vi2xGIKMOQSU = vi2xWYacegik;
+      vi2xHJLNPRTV = vi2xXZbdfhjl;
+      const __m256 vi3xIKMOQSUW = _mm256_permute_ps(_mm256_blend_ps(vi3xGIKMOQSU, vi3xOQSUWYac, 0x11), _MM_SHUFFLE(0, 3, 2, 1));
+      vi3xGIKMOQSU = vi3xWYacegik;
+      vi3xHJLNPRTV = vi3xXZbdfhjl;
+      const __m256 vi4xIKMOQSUW = _mm256_permute_ps(_mm256_blend_ps(vi4xGIKMOQSU, vi4xOQSUWYac, 0x11), _MM_SHUFFLE(0, 3, 2, 1));
+      vi4xGIKMOQSU = vi4xWYacegik;
+      vi4xHJLNPRTV = vi4xXZbdfhjl;
+
+      vo0p2 = _mm256_add_ps(vo0p2, _mm256_mul_ps(vi0xIKMOQSUW, vk04));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi1xIKMOQSUW, vk14));
+      vo0p1 = _mm256_add_ps(vo0p1, _mm256_mul_ps(vi2xIKMOQSUW, vk24));
+      vo0p2 = _mm256_add_ps(vo0p2, _mm256_mul_ps(vi3xIKMOQSUW, vk34));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi4xIKMOQSUW, vk44));
+
+      vo0p0 = _mm256_add_ps(vo0p0, vo0p1);
+      vo0p0 = _mm256_add_ps(vo0p0, vo0p2);
+
+      __m256 vo0 = _mm256_max_ps(vo0p0, vmin);
+
+      vo0 = _mm256_min_ps(vo0, vmax);
+
+      _mm256_storeu_ps(o0, vo0);
+      o0 += 8;
+
+      w -= 16 * sizeof(float);
+    }
+    // Last block has 1-16 pixels to process.
+    assert(w <= 16 * sizeof(float));
+    assert(w >= 1 * sizeof(float));
+    {
+      vi0xGIKMOQSU = _mm256_and_ps(vi0xGIKMOQSU, vmask_even);
+      vi0xHJLNPRTV = _mm256_and_ps(vi0xHJLNPRTV, vmask_odd);
+      vi1xGIKMOQSU = _mm256_and_ps(vi1xGIKMOQSU, vmask_even);
+      vi1xHJLNPRTV = _mm256_and_ps(vi1xHJLNPRTV, vmask_odd);
+      vi2xGIKMOQSU = _mm256_and_ps(vi2xGIKMOQSU, vmask_even);
+      vi2xHJLNPRTV = _mm256_and_ps(vi2xHJLNPRTV, vmask_odd);
+      vi3xGIKMOQSU = _mm256_and_ps(vi3xGIKMOQSU, vmask_even);
+      vi3xHJLNPRTV = _mm256_and_ps(vi3xHJLNPRTV, vmask_odd);
+      vi4xGIKMOQSU = _mm256_and_ps(vi4xGIKMOQSU, vmask_even);
+      vi4xHJLNPRTV = _mm256_and_ps(vi4xHJLNPRTV, vmask_odd);
+
+      __m256 vo0p0 = _mm256_add_ps(vbias, _mm256_mul_ps(vi0xGIKMOQSU, vk02));
+      __m256 vo0p1 = _mm256_mul_ps(vi1xGIKMOQSU, vk12);
+      __m256 vo0p2 = _mm256_mul_ps(vi2xGIKMOQSU, vk22);
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi3xGIKMOQSU, vk32));
+      vo0p1 = _mm256_add_ps(vo0p1, _mm256_mul_ps(vi4xGIKMOQSU, vk42));
+
+      vo0p2 = _mm256_add_ps(vo0p2, _mm256_mul_ps(vi0xHJLNPRTV, vk03));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi1xHJLNPRTV, vk13));
+      vo0p1 = _mm256_add_ps(vo0p1, _mm256_mul_ps(vi2xHJLNPRTV, vk23));
+      vo0p2 = _mm256_add_ps(vo0p2, _mm256_mul_ps(vi3xHJLNPRTV, vk33));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi4xHJLNPRTV, vk43));
+
+      const __m256 vi0x8ACEGIKM = _mm256_permute2f128_ps(vi0x02468ACE, vi0xGIKMOQSU, 0x21);
+      const __m256 vi1x8ACEGIKM = _mm256_permute2f128_ps(vi1x02468ACE, vi1xGIKMOQSU, 0x21);
+      const __m256 vi2x8ACEGIKM = _mm256_permute2f128_ps(vi2x02468ACE, vi2xGIKMOQSU, 0x21);
+      const __m256 vi3x8ACEGIKM = _mm256_permute2f128_ps(vi3x02468ACE, vi3xGIKMOQSU, 0x21);
+      const __m256 vi4x8ACEGIKM = _mm256_permute2f128_ps(vi4x02468ACE, vi4xGIKMOQSU, 0x21);
+
+      const __m256 vi0xEGIKMOQS = _mm256_permute_ps(_mm256_blend_ps(vi0xGIKMOQSU, vi0x8ACEGIKM, 0x88), _MM_SHUFFLE(2, 1, 0, 3));
+      const __m256 vi1xEGIKMOQS = _mm256_permute_ps(_mm256_blend_ps(vi1xGIKMOQSU, vi1x8ACEGIKM, 0x88), _MM_SHUFFLE(2, 1, 0, 3));
+      const __m256 vi2xEGIKMOQS = _mm256_permute_ps(_mm256_blend_ps(vi2xGIKMOQSU, vi2x8ACEGIKM, 0x88), _MM_SHUFFLE(2, 1, 0, 3));
+      const __m256 vi3xEGIKMOQS = _mm256_permute_ps(_mm256_blend_ps(vi3xGIKMOQSU, vi3x8ACEGIKM, 0x88), _MM_SHUFFLE(2, 1, 0, 3));
+      const __m256 vi4xEGIKMOQS = _mm256_permute_ps(_mm256_blend_ps(vi4xGIKMOQSU, vi4x8ACEGIKM, 0x88), _MM_SHUFFLE(2, 1, 0, 3));
+
+      vo0p1 = _mm256_add_ps(vo0p1, _mm256_mul_ps(vi0xEGIKMOQS, vk00));
+      vo0p2 = _mm256_add_ps(vo0p2, _mm256_mul_ps(vi1xEGIKMOQS, vk10));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi2xEGIKMOQS, vk20));
+      vo0p1 = _mm256_add_ps(vo0p1, _mm256_mul_ps(vi3xEGIKMOQS, vk30));
+      vo0p2 = _mm256_add_ps(vo0p2, _mm256_mul_ps(vi4xEGIKMOQS, vk40));
+
+      const __m256 vi0x9BDFHJLN = _mm256_permute2f128_ps(vi0x13579BDF, vi0xHJLNPRTV, 0x21);
+      const __m256 vi1x9BDFHJLN = _mm256_permute2f128_ps(vi1x13579BDF, vi1xHJLNPRTV, 0x21);
+      const __m256 vi2x9BDFHJLN = _mm256_permute2f128_ps(vi2x13579BDF, vi2xHJLNPRTV, 0x21);
+      const __m256 vi3x9BDFHJLN = _mm256_permute2f128_ps(vi3x13579BDF, vi3xHJLNPRTV, 0x21);
+      const __m256 vi4x9BDFHJLN = _mm256_permute2f128_ps(vi4x13579BDF, vi4xHJLNPRTV, 0x21);
+
+      const __m256 vi0xFHJLNPRT = _mm256_permute_ps(_mm256_blend_ps(vi0xHJLNPRTV, vi0x9BDFHJLN, 0x88), _MM_SHUFFLE(2, 1, 0, 3));
+      const __m256 vi1xFHJLNPRT = _mm256_permute_ps(_mm256_blend_ps(vi1xHJLNPRTV, vi1x9BDFHJLN, 0x88), _MM_SHUFFLE(2, 1, 0, 3));
+      const __m256 vi2xFHJLNPRT = _mm256_permute_ps(_mm256_blend_ps(vi2xHJLNPRTV, vi2x9BDFHJLN, 0x88), _MM_SHUFFLE(2, 1, 0, 3));
+      const __m256 vi3xFHJLNPRT = _mm256_permute_ps(_mm256_blend_ps(vi3xHJLNPRTV, vi3x9BDFHJLN, 0x88), _MM_SHUFFLE(2, 1, 0, 3));
+      const __m256 vi4xFHJLNPRT = _mm256_permute_ps(_mm256_blend_ps(vi4xHJLNPRTV, vi4x9BDFHJLN, 0x88), _MM_SHUFFLE(2, 1, 0, 3));
+
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi0xFHJLNPRT, vk01));
+      vo0p1 = _mm256_add_ps(vo0p1, _mm256_mul_ps(vi1xFHJLNPRT, vk11));
+      vo0p2 = _mm256_add_ps(vo0p2, _mm256_mul_ps(vi2xFHJLNPRT, vk21));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi3xFHJLNPRT, vk31));
+      vo0p1 = _mm256_add_ps(vo0p1, _mm256_mul_ps(vi4xFHJLNPRT, vk41));
+
+      // vi0xOQSUWYac = ( 0.0, 0.0, 0.0, 0.0, vi0U, vi0S, vi0Q, vi0O )
+      const __m256 vi0xOQSUWYac = _mm256_permute2f128_ps(vi0xGIKMOQSU, vi0xGIKMOQSU, 0x81);
+      // vi1xOQSUWYac = ( 0.0, 0.0, 0.0, 0.0, vi1U, vi1S, vi1Q, vi1O )
+      const __m256 vi1xOQSUWYac = _mm256_permute2f128_ps(vi1xGIKMOQSU, vi1xGIKMOQSU, 0x81);
+      // vi2xOQSUWYac = ( 0.0, 0.0, 0.0, 0.0, vi2U, vi2S, vi2Q, vi2O )
+      const __m256 vi2xOQSUWYac = _mm256_permute2f128_ps(vi2xGIKMOQSU, vi2xGIKMOQSU, 0x81);
+      // vi3xOQSUWYac = ( 0.0, 0.0, 0.0, 0.0, vi3U, vi3S, vi3Q, vi3O )
+      const __m256 vi3xOQSUWYac = _mm256_permute2f128_ps(vi3xGIKMOQSU, vi3xGIKMOQSU, 0x81);
+      // vi4xOQSUWYac = ( 0.0, 0.0, 0.0, 0.0, vi4U, vi4S, vi4Q, vi4O )
+      const __m256 vi4xOQSUWYac = _mm256_permute2f128_ps(vi4xGIKMOQSU, vi4xGIKMOQSU, 0x81);
+
+      const __m256 vi0xIKMOQSUW = _mm256_permute_ps(_mm256_blend_ps(vi0xGIKMOQSU, vi0xOQSUWYac, 0x11), _MM_SHUFFLE(0, 3, 2, 1));
+      const __m256 vi1xIKMOQSUW = _mm256_permute_ps(_mm256_blend_ps(vi1xGIKMOQSU, vi1xOQSUWYac, 0x11), _MM_SHUFFLE(0, 3, 2, 1));
+      const __m256 vi2xIKMOQSUW = _mm256_permute_ps(_mm256_blend_ps(vi2xGIKMOQSU, vi2xOQSUWYac, 0x11), _MM_SHUFFLE(0, 3, 2, 1));
+      const __m256 vi3xIKMOQSUW = _mm256_permute_ps(_mm256_blend_ps(vi3xGIKMOQSU, vi3xOQSUWYac, 0x11), _MM_SHUFFLE(0, 3, 2, 1));
+      const __m256 vi4xIKMOQSUW = _mm256_permute_ps(_mm256_blend_ps(vi4xGIKMOQSU, vi4xOQSUWYac, 0x11), _MM_SHUFFLE(0, 3, 2, 1));
+
+      vo0p2 = _mm256_add_ps(vo0p2, _mm256_mul_ps(vi0xIKMOQSUW, vk04));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi1xIKMOQSUW, vk14));
+      vo0p1 = _mm256_add_ps(vo0p1, _mm256_mul_ps(vi2xIKMOQSUW, vk24));
+      vo0p2 = _mm256_add_ps(vo0p2, _mm256_mul_ps(vi3xIKMOQSUW, vk34));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi4xIKMOQSUW, vk44));
+
+      vo0p0 = _mm256_add_ps(vo0p0, vo0p1);
+      vo0p0 = _mm256_add_ps(vo0p0, vo0p2);
+
+      __m256 vo0 = _mm256_max_ps(vo0p0, vmin);
+
+      vo0 = _mm256_min_ps(vo0, vmax);
+
+      const size_t w_tmp = (w + 1 * sizeof(float)) / (2 * sizeof(float));
+      if XNN_LIKELY(w_tmp >= 8) {
+        _mm256_storeu_ps(o0, vo0);
+        o0 += 8;
+      } else {
+        __m128 vo0_lo = _mm256_castps256_ps128(vo0);
+        if (w_tmp & 4) {
+          _mm_storeu_ps(o0, vo0_lo);
+          o0 += 4;
+
+          vo0_lo = _mm256_extractf128_ps(vo0, 1);
+        }
+        if (w_tmp & 2) {
+          _mm_storel_pi((__m64*) o0, vo0_lo);
+          o0 += 2;
+
+          vo0_lo = _mm_movehl_ps(vo0_lo, vo0_lo);
+        }
+        if (w_tmp & 1) {
+          _mm_store_ss(o0, vo0_lo);
+          o0 += 1;
+        }
+      }
+    }
+
+    i0 = (const float*) ((uintptr_t) i2 - input_decrement);
+    i1 = (const float*) ((uintptr_t) i3 - input_decrement);
+    i2 = (const float*) ((uintptr_t) i4 - input_decrement);
+    i3 = (const float*) ((uintptr_t) i2 + input_width);
+    i4 = (const float*) ((uintptr_t) i3 + input_width);
+
+
+    output_height -= 1;
+    padded_input_height -= 2;
+  } while (output_height != 0);
+}
+
 void xnn_f32_f16_vcvt_ukernel__avx_x24(
     size_t n,
     const float* input,
@@ -2489,26 +4910,1160 @@ void xnn_f32_qu8_vcvt_ukernel__avx_x32(
   }
 }
 
-void xnn_f32_vadd_minmax_ukernel__avx_x16(
+void xnn_f32_rmeanvar_ukernel__avx(
     size_t n,
-    const float* a,
-    const float* b,
-    float* y,
-    const union xnn_f32_minmax_params params[restrict XNN_MIN_ELEMENTS(1)])
+    const float* x,
+    float* mean,
+    float* variance)
 {
   assert(n != 0);
   assert(n % sizeof(float) == 0);
-  assert(a != NULL);
-  assert(b != NULL);
-  assert(y != NULL);
-
-  const __m256 vy_min = _mm256_load_ps(params->avx.min);
-  const __m256 vy_max = _mm256_load_ps(params->avx.max);
 
-  for (; n >= 16 * sizeof(float); n -= 16 * sizeof(float)) {
-    const __m256 va01234567 = _mm256_loadu_ps(a);
-    const __m256 va89ABCDEF = _mm256_loadu_ps(a + 8);
-    a += 16;
+  // Every lane of every accumulator runs its own Welford recurrence:
+  //   delta := x - mean
+  //   mean := mean + delta / count
+  //   m2 := m2 + delta * (x - mean)
+  // All lanes see the same number of elements, so the reciprocal of the element count is shared between them.
+  __m256 vmean0 = _mm256_setzero_ps();
+  __m256 vmean1 = _mm256_setzero_ps();
+  __m256 vmean2 = _mm256_setzero_ps();
+  __m256 vmean3 = _mm256_setzero_ps();
+  __m256 vm2_0 = _mm256_setzero_ps();
+  __m256 vm2_1 = _mm256_setzero_ps();
+  __m256 vm2_2 = _mm256_setzero_ps();
+  __m256 vm2_3 = _mm256_setzero_ps();
+  float vcount = 0.0f;
+  for (; n >= 32 * sizeof(float); n -= 32 * sizeof(float)) {
+    const __m256 vx0 = _mm256_loadu_ps(x);
+    const __m256 vx1 = _mm256_loadu_ps(x + 8);
+    const __m256 vx2 = _mm256_loadu_ps(x + 16);
+    const __m256 vx3 = _mm256_loadu_ps(x + 24);
+    x += 32;
+
+    vcount += 1.0f;
+    const __m256 vrcp_count = _mm256_set1_ps(1.0f / vcount);
+
+    const __m256 vdelta0 = _mm256_sub_ps(vx0, vmean0);
+    const __m256 vdelta1 = _mm256_sub_ps(vx1, vmean1);
+    const __m256 vdelta2 = _mm256_sub_ps(vx2, vmean2);
+    const __m256 vdelta3 = _mm256_sub_ps(vx3, vmean3);
+
+    vmean0 = _mm256_add_ps(vmean0, _mm256_mul_ps(vdelta0, vrcp_count));
+    vmean1 = _mm256_add_ps(vmean1, _mm256_mul_ps(vdelta1, vrcp_count));
+    vmean2 = _mm256_add_ps(vmean2, _mm256_mul_ps(vdelta2, vrcp_count));
+    vmean3 = _mm256_add_ps(vmean3, _mm256_mul_ps(vdelta3, vrcp_count));
+
+    vm2_0 = _mm256_add_ps(vm2_0, _mm256_mul_ps(vdelta0, _mm256_sub_ps(vx0, vmean0)));
+    vm2_1 = _mm256_add_ps(vm2_1, _mm256_mul_ps(vdelta1, _mm256_sub_ps(vx1, vmean1)));
+    vm2_2 = _mm256_add_ps(vm2_2, _mm256_mul_ps(vdelta2, _mm256_sub_ps(vx2, vmean2)));
+    vm2_3 = _mm256_add_ps(vm2_3, _mm256_mul_ps(vdelta3, _mm256_sub_ps(vx3, vmean3)));
+  }
+
+  // Merge pairs of accumulators with equal element counts (Chan et al.):
+  //   mean := (mean_a + mean_b) / 2
+  //   m2 := m2_a + m2_b + (mean_b - mean_a)**2 * count / 2
+  const __m256 vhalf = _mm256_set1_ps(0.5f);
+  __m256 vhalf_count = _mm256_set1_ps(vcount * 0.5f);
+  const __m256 vdelta01 = _mm256_sub_ps(vmean1, vmean0);
+  const __m256 vdelta23 = _mm256_sub_ps(vmean3, vmean2);
+  const __m256 vmean01 = _mm256_add_ps(vmean0, _mm256_mul_ps(vdelta01, vhalf));
+  const __m256 vmean23 = _mm256_add_ps(vmean2, _mm256_mul_ps(vdelta23, vhalf));
+  const __m256 vm2_01 = _mm256_add_ps(_mm256_add_ps(vm2_0, vm2_1), _mm256_mul_ps(_mm256_mul_ps(vdelta01, vdelta01), vhalf_count));
+  const __m256 vm2_23 = _mm256_add_ps(_mm256_add_ps(vm2_2, vm2_3), _mm256_mul_ps(_mm256_mul_ps(vdelta23, vdelta23), vhalf_count));
+  vcount += vcount;
+
+  vhalf_count = _mm256_set1_ps(vcount * 0.5f);
+  const __m256 vdelta0123 = _mm256_sub_ps(vmean23, vmean01);
+  __m256 vmean = _mm256_add_ps(vmean01, _mm256_mul_ps(vdelta0123, vhalf));
+  __m256 vm2 = _mm256_add_ps(_mm256_add_ps(vm2_01, vm2_23), _mm256_mul_ps(_mm256_mul_ps(vdelta0123, vdelta0123), vhalf_count));
+  vcount += vcount;
+
+  for (; n >= 8 * sizeof(float); n -= 8 * sizeof(float)) {
+    const __m256 vx = _mm256_loadu_ps(x);
+    x += 8;
+
+    vcount += 1.0f;
+    const __m256 vrcp_count = _mm256_set1_ps(1.0f / vcount);
+
+    const __m256 vdelta = _mm256_sub_ps(vx, vmean);
+    vmean = _mm256_add_ps(vmean, _mm256_mul_ps(vdelta, vrcp_count));
+    vm2 = _mm256_add_ps(vm2, _mm256_mul_ps(vdelta, _mm256_sub_ps(vx, vmean)));
+  }
+
+  // Merge the lanes of the accumulator.
+  const __m128 vhalf_lo = _mm256_castps256_ps128(vhalf);
+  __m128 vhalf_count_lo = _mm_set1_ps(vcount * 0.5f);
+  __m128 vmean_lo = _mm256_castps256_ps128(vmean);
+  __m128 vm2_lo = _mm256_castps256_ps128(vm2);
+  const __m128 vdelta_hi = _mm_sub_ps(_mm256_extractf128_ps(vmean, 1), vmean_lo);
+  vmean_lo = _mm_add_ps(vmean_lo, _mm_mul_ps(vdelta_hi, vhalf_lo));
+  vm2_lo = _mm_add_ps(_mm_add_ps(vm2_lo, _mm256_extractf128_ps(vm2, 1)), _mm_mul_ps(_mm_mul_ps(vdelta_hi, vdelta_hi), vhalf_count_lo));
+  vcount += vcount;
+
+  vhalf_count_lo = _mm_set1_ps(vcount * 0.5f);
+  const __m128 vdelta_lh = _mm_sub_ps(_mm_movehl_ps(vmean_lo, vmean_lo), vmean_lo);
+  vmean_lo = _mm_add_ps(vmean_lo, _mm_mul_ps(vdelta_lh, vhalf_lo));
+  vm2_lo = _mm_add_ps(_mm_add_ps(vm2_lo, _mm_movehl_ps(vm2_lo, vm2_lo)), _mm_mul_ps(_mm_mul_ps(vdelta_lh, vdelta_lh), vhalf_count_lo));
+  vcount += vcount;
+
+  vhalf_count_lo = _mm_set_ss(vcount * 0.5f);
+  const __m128 vdelta_odd = _mm_sub_ss(_mm_movehdup_ps(vmean_lo), vmean_lo);
+  vmean_lo = _mm_add_ss(vmean_lo, _mm_mul_ss(vdelta_odd, vhalf_lo));
+  vm2_lo = _mm_add_ss(_mm_add_ss(vm2_lo, _mm_movehdup_ps(vm2_lo)), _mm_mul_ss(_mm_mul_ss(vdelta_odd, vdelta_odd), vhalf_count_lo));
+  vcount += vcount;
+
+  float vmean_ll = _mm_cvtss_f32(vmean_lo);
+  float vm2_ll = _mm_cvtss_f32(vm2_lo);
+  if XNN_UNLIKELY(n != 0) {
+    do {
+      const float vx = *x++;
+      vcount += 1.0f;
+      const float vdelta = vx - vmean_ll;
+      vmean_ll += vdelta / vcount;
+      vm2_ll += vdelta * (vx - vmean_ll);
+      n -= sizeof(float);
+    } while (n != 0);
+  }
+  *mean = vmean_ll;
+  *variance = vm2_ll / vcount;
+}
+
+void xnn_f32_spmm_minmax_ukernel_16x4__avx(
+    size_t mc,
+    size_t nc,
+    const float*restrict input,
+    const float*restrict weights,
+    const int32_t*restrict widx_dmap,
+    const uint32_t*restrict nidx_nnzmap,
+    float*restrict output,
+    size_t output_stride,
+    const union xnn_f32_minmax_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(mc != 0);
+  assert(mc % sizeof(float) == 0);
+  assert(nc != 0);
+
+  const __m256 vmin = _mm256_broadcast_ss(params->sse.min);
+  const __m256 vmax = _mm256_broadcast_ss(params->sse.max);
+  size_t output_decrement = output_stride * nc - 16 * sizeof(float);
+  while XNN_LIKELY(mc >= 16 * sizeof(float)) {
+    const float*restrict w = weights;
+    const int32_t* dmap = widx_dmap;
+    const uint32_t* nnzmap = nidx_nnzmap;
+    size_t n = nc;
+    while (n >= 4) {
+      uint32_t nnz = *nnzmap++;
+      __m256 vacc01234567n0 = _mm256_broadcast_ss(w); w += 1;
+      __m256 vacc89ABCDEFn0 = vacc01234567n0;
+      __m256 vacc01234567n1 = _mm256_broadcast_ss(w); w += 1;
+      __m256 vacc89ABCDEFn1 = vacc01234567n1;
+      __m256 vacc01234567n2 = _mm256_broadcast_ss(w); w += 1;
+      __m256 vacc89ABCDEFn2 = vacc01234567n2;
+      __m256 vacc01234567n3 = _mm256_broadcast_ss(w); w += 1;
+      __m256 vacc89ABCDEFn3 = vacc01234567n3;
+      if XNN_LIKELY(nnz != 0) {
+        do {
+          const intptr_t diff = *dmap++;
+          const __m256 vi01234567 = _mm256_loadu_ps(input);
+          const __m256 vi89ABCDEF = _mm256_loadu_ps(input + 8);
+          input = (const float*restrict) ((uintptr_t) input + (uintptr_t) diff);
+          const __m256 vw0 = _mm256_broadcast_ss(w);
+          const __m256 vw1 = _mm256_broadcast_ss(w + 1);
+          const __m256 vw2 = _mm256_broadcast_ss(w + 2);
+          const __m256 vw3 = _mm256_broadcast_ss(w + 3);
+          w += 4;
+          vacc01234567n0 = _mm256_add_ps(vacc01234567n0, _mm256_mul_ps(vi01234567, vw0));
+          vacc89ABCDEFn0 = _mm256_add_ps(vacc89ABCDEFn0, _mm256_mul_ps(vi89ABCDEF, vw0));
+          vacc01234567n1 = _mm256_add_ps(vacc01234567n1, _mm256_mul_ps(vi01234567, vw1));
+          vacc89ABCDEFn1 = _mm256_add_ps(vacc89ABCDEFn1, _mm256_mul_ps(vi89ABCDEF, vw1));
+          vacc01234567n2 = _mm256_add_ps(vacc01234567n2, _mm256_mul_ps(vi01234567, vw2));
+          vacc89ABCDEFn2 = _mm256_add_ps(vacc89ABCDEFn2, _mm256_mul_ps(vi89ABCDEF, vw2));
+          vacc01234567n3 = _mm256_add_ps(vacc01234567n3, _mm256_mul_ps(vi01234567, vw3));
+          vacc89ABCDEFn3 = _mm256_add_ps(vacc89ABCDEFn3, _mm256_mul_ps(vi89ABCDEF, vw3));
+        } while (--nnz != 0);
+      }
+      __m256 vout01234567n0 = _mm256_min_ps(vacc01234567n0, vmax);
+      __m256 vout89ABCDEFn0 = _mm256_min_ps(vacc89ABCDEFn0, vmax);
+      __m256 vout01234567n1 = _mm256_min_ps(vacc01234567n1, vmax);
+      __m256 vout89ABCDEFn1 = _mm256_min_ps(vacc89ABCDEFn1, vmax);
+      __m256 vout01234567n2 = _mm256_min_ps(vacc01234567n2, vmax);
+      __m256 vout89ABCDEFn2 = _mm256_min_ps(vacc89ABCDEFn2, vmax);
+      __m256 vout01234567n3 = _mm256_min_ps(vacc01234567n3, vmax);
+      __m256 vout89ABCDEFn3 = _mm256_min_ps(vacc89ABCDEFn3, vmax);
+      vout01234567n0 = _mm256_max_ps(vout01234567n0, vmin);
+      vout89ABCDEFn0 = _mm256_max_ps(vout89ABCDEFn0, vmin);
+      vout01234567n1 = _mm256_max_ps(vout01234567n1, vmin);
+      vout89ABCDEFn1 = _mm256_max_ps(vout89ABCDEFn1, vmin);
+      vout01234567n2 = _mm256_max_ps(vout01234567n2, vmin);
+      vout89ABCDEFn2 = _mm256_max_ps(vout89ABCDEFn2, vmin);
+      vout01234567n3 = _mm256_max_ps(vout01234567n3, vmin);
+      vout89ABCDEFn3 = _mm256_max_ps(vout89ABCDEFn3, vmin);
+      _mm256_storeu_ps(output, vout01234567n0);
+      _mm256_storeu_ps(output + 8, vout89ABCDEFn0);
+      output = (float*restrict) ((uintptr_t) output + output_stride);
+      _mm256_storeu_ps(output, vout01234567n1);
+      _mm256_storeu_ps(output + 8, vout89ABCDEFn1);
+      output = (float*restrict) ((uintptr_t) output + output_stride);
+      _mm256_storeu_ps(output, vout01234567n2);
+      _mm256_storeu_ps(output + 8, vout89ABCDEFn2);
+      output = (float*restrict) ((uintptr_t) output + output_stride);
+      _mm256_storeu_ps(output, vout01234567n3);
+      _mm256_storeu_ps(output + 8, vout89ABCDEFn3);
+      output = (float*restrict) ((uintptr_t) output + output_stride);
+      n -= 4;
+    }
+
+    // clean up loop, fall back to nr=1
+    while XNN_UNLIKELY(n != 0) {
+      uint32_t nnz = *nnzmap++;
+      __m256 vacc01234567 = _mm256_broadcast_ss(w); w += 1;
+      __m256 vacc89ABCDEF = vacc01234567;
+      if XNN_LIKELY(nnz != 0) {
+        do {
+          const intptr_t diff = *dmap++;
+          const __m256 vi01234567 = _mm256_loadu_ps(input);
+          const __m256 vi89ABCDEF = _mm256_loadu_ps(input + 8);
+          input = (const float*restrict) ((uintptr_t) input + (uintptr_t) diff);
+          const __m256 vw = _mm256_broadcast_ss(w); w += 1;
+          vacc01234567 = _mm256_add_ps(vacc01234567, _mm256_mul_ps(vi01234567, vw));
+          vacc89ABCDEF = _mm256_add_ps(vacc89ABCDEF, _mm256_mul_ps(vi89ABCDEF, vw));
+        } while (--nnz != 0);
+      }
+      __m256 vout01234567 = _mm256_min_ps(vacc01234567, vmax);
+      __m256 vout89ABCDEF = _mm256_min_ps(vacc89ABCDEF, vmax);
+      vout01234567 = _mm256_max_ps(vout01234567, vmin);
+      vout89ABCDEF = _mm256_max_ps(vout89ABCDEF, vmin);
+      _mm256_storeu_ps(output, vout01234567);
+      _mm256_storeu_ps(output + 8, vout89ABCDEF);
+      output = (float*restrict) ((uintptr_t) output + output_stride);
+      n -= 1;
+    }
+    output = (float*restrict) ((uintptr_t) output - output_decrement);
+    input += 16;
+    mc -= 16 * sizeof(float);
+  }
+  if XNN_UNLIKELY(mc != 0) {
+    output_decrement += 8 * sizeof(float);
+    if (mc & (8 * sizeof(float))) {
+      const float*restrict w = weights;
+      const int32_t* dmap = widx_dmap;
+      const uint32_t* nnzmap = nidx_nnzmap;
+      size_t n = nc;
+      while (n >= 4) {
+        uint32_t nnz = *nnzmap++;
+        __m256 vacc01234567n0 = _mm256_broadcast_ss(w); w += 1;
+        __m256 vacc01234567n1 = _mm256_broadcast_ss(w); w += 1;
+        __m256 vacc01234567n2 = _mm256_broadcast_ss(w); w += 1;
+        __m256 vacc01234567n3 = _mm256_broadcast_ss(w); w += 1;
+        if XNN_LIKELY(nnz != 0) {
+          do {
+            const intptr_t diff = *dmap++;
+            const __m256 vi01234567 = _mm256_loadu_ps(input);
+            input = (const float*restrict) ((uintptr_t) input + (uintptr_t) diff);
+            const __m256 vw0 = _mm256_broadcast_ss(w);
+            const __m256 vw1 = _mm256_broadcast_ss(w + 1);
+            const __m256 vw2 = _mm256_broadcast_ss(w + 2);
+            const __m256 vw3 = _mm256_broadcast_ss(w + 3);
+            w += 4;
+            vacc01234567n0 = _mm256_add_ps(vacc01234567n0, _mm256_mul_ps(vi01234567, vw0));
+            vacc01234567n1 = _mm256_add_ps(vacc01234567n1, _mm256_mul_ps(vi01234567, vw1));
+            vacc01234567n2 = _mm256_add_ps(vacc01234567n2, _mm256_mul_ps(vi01234567, vw2));
+            vacc01234567n3 = _mm256_add_ps(vacc01234567n3, _mm256_mul_ps(vi01234567, vw3));
+          } while (--nnz != 0);
+        }
+        __m256 vout01234567n0 = _mm256_min_ps(vacc01234567n0, vmax);
+        __m256 vout01234567n1 = _mm256_min_ps(vacc01234567n1, vmax);
+        __m256 vout01234567n2 = _mm256_min_ps(vacc01234567n2, vmax);
+        __m256 vout01234567n3 = _mm256_min_ps(vacc01234567n3, vmax);
+        vout01234567n0 = _mm256_max_ps(vout01234567n0, vmin);
+        vout01234567n1 = _mm256_max_ps(vout01234567n1, vmin);
+        vout01234567n2 = _mm256_max_ps(vout01234567n2, vmin);
+        vout01234567n3 = _mm256_max_ps(vout01234567n3, vmin);
+        _mm256_storeu_ps(output, vout01234567n0);
+        output = (float*restrict) ((uintptr_t) output + output_stride);
+        _mm256_storeu_ps(output, vout01234567n1);
+        output = (float*restrict) ((uintptr_t) output + output_stride);
+        _mm256_storeu_ps(output, vout01234567n2);
+        output = (float*restrict) ((uintptr_t) output + output_stride);
+        _mm256_storeu_ps(output, vout01234567n3);
+        output = (float*restrict) ((uintptr_t) output + output_stride);
+        n -= 4;
+      }
+
+      // clean up loop, fall back to nr=1
+      while XNN_UNLIKELY(n != 0) {
+        uint32_t nnz = *nnzmap++;
+        __m256 vacc01234567 = _mm256_broadcast_ss(w); w += 1;
+        if XNN_LIKELY(nnz != 0) {
+          do {
+            const intptr_t diff = *dmap++;
+            const __m256 vi01234567 = _mm256_loadu_ps(input);
+            input = (const float*restrict) ((uintptr_t) input + (uintptr_t) diff);
+            const __m256 vw = _mm256_broadcast_ss(w); w += 1;
+            vacc01234567 = _mm256_add_ps(vacc01234567, _mm256_mul_ps(vi01234567, vw));
+          } while (--nnz != 0);
+        }
+        __m256 vout01234567 = _mm256_min_ps(vacc01234567, vmax);
+        vout01234567 = _mm256_max_ps(vout01234567, vmin);
+        _mm256_storeu_ps(output, vout01234567);
+        output = (float*restrict) ((uintptr_t) output + output_stride);
+        n -= 1;
+      }
+      output = (float*restrict) ((uintptr_t) output - output_decrement);
+      input += 8;
+    }
+    output_decrement += 4 * sizeof(float);
+    if (mc & (4 * sizeof(float))) {
+      const float*restrict w = weights;
+      const int32_t* dmap = widx_dmap;
+      const uint32_t* nnzmap = nidx_nnzmap;
+      size_t n = nc;
+      while (n >= 4) {
+        uint32_t nnz = *nnzmap++;
+        __m128 vacc0123n0 = _mm_broadcast_ss(w); w += 1;
+        __m128 vacc0123n1 = _mm_broadcast_ss(w); w += 1;
+        __m128 vacc0123n2 = _mm_broadcast_ss(w); w += 1;
+        __m128 vacc0123n3 = _mm_broadcast_ss(w); w += 1;
+        if XNN_LIKELY(nnz != 0) {
+          do {
+            const intptr_t diff = *dmap++;
+            const __m128 vi0123 = _mm_loadu_ps(input);
+            input = (const float*restrict) ((uintptr_t) input + (uintptr_t) diff);
+            const __m128 vw0 = _mm_broadcast_ss(w);
+            const __m128 vw1 = _mm_broadcast_ss(w + 1);
+            const __m128 vw2 = _mm_broadcast_ss(w + 2);
+            const __m128 vw3 = _mm_broadcast_ss(w + 3);
+            w += 4;
+            vacc0123n0 = _mm_add_ps(vacc0123n0, _mm_mul_ps(vi0123, vw0));
+            vacc0123n1 = _mm_add_ps(vacc0123n1, _mm_mul_ps(vi0123, vw1));
+            vacc0123n2 = _mm_add_ps(vacc0123n2, _mm_mul_ps(vi0123, vw2));
+            vacc0123n3 = _mm_add_ps(vacc0123n3, _mm_mul_ps(vi0123, vw3));
+          } while (--nnz != 0);
+        }
+        __m128 vout0123n0 = _mm_min_ps(vacc0123n0, _mm256_castps256_ps128(vmax));
+        __m128 vout0123n1 = _mm_min_ps(vacc0123n1, _mm256_castps256_ps128(vmax));
+        __m128 vout0123n2 = _mm_min_ps(vacc0123n2, _mm256_castps256_ps128(vmax));
+        __m128 vout0123n3 = _mm_min_ps(vacc0123n3, _mm256_castps256_ps128(vmax));
+        vout0123n0 = _mm_max_ps(vout0123n0, _mm256_castps256_ps128(vmin));
+        vout0123n1 = _mm_max_ps(vout0123n1, _mm256_castps256_ps128(vmin));
+        vout0123n2 = _mm_max_ps(vout0123n2, _mm256_castps256_ps128(vmin));
+        vout0123n3 = _mm_max_ps(vout0123n3, _mm256_castps256_ps128(vmin));
+        _mm_storeu_ps(output, vout0123n0);
+        output = (float*restrict) ((uintptr_t) output + output_stride);
+        _mm_storeu_ps(output, vout0123n1);
+        output = (float*restrict) ((uintptr_t) output + output_stride);
+        _mm_storeu_ps(output, vout0123n2);
+        output = (float*restrict) ((uintptr_t) output + output_stride);
+        _mm_storeu_ps(output, vout0123n3);
+        output = (float*restrict) ((uintptr_t) output + output_stride);
+        n -= 4;
+      }
+
+      // clean up loop, fall back to nr=1
+      while XNN_UNLIKELY(n != 0) {
+        uint32_t nnz = *nnzmap++;
+        __m128 vacc0123 = _mm_broadcast_ss(w); w += 1;
+        if XNN_LIKELY(nnz != 0) {
+          do {
+            const intptr_t diff = *dmap++;
+            const __m128 vi0123 = _mm_loadu_ps(input);
+            input = (const float*restrict) ((uintptr_t) input + (uintptr_t) diff);
+            const __m128 vw = _mm_broadcast_ss(w); w += 1;
+            vacc0123 = _mm_add_ps(vacc0123, _mm_mul_ps(vi0123, vw));
+          } while (--nnz != 0);
+        }
+        __m128 vout0123 = _mm_min_ps(vacc0123, _mm256_castps256_ps128(vmax));
+        vout0123 = _mm_max_ps(vout0123, _mm256_castps256_ps128(vmin));
+        _mm_storeu_ps(output, vout0123);
+        output = (float*restrict) ((uintptr_t) output + output_stride);
+        n -= 1;
+      }
+      output = (float*restrict) ((uintptr_t) output - output_decrement);
+      input += 4;
+    }
+    output_decrement += 2 * sizeof(float);
+    if (mc & (2 * sizeof(float))) {
+      const float*restrict w = weights;
+      const int32_t* dmap = widx_dmap;
+      const uint32_t* nnzmap = nidx_nnzmap;
+      size_t n = nc;
+      while (n >= 4) {
+        uint32_t nnz = *nnzmap++;
+        __m128 vacc01n0 = _mm_broadcast_ss(w); w += 1;
+        __m128 vacc01n1 = _mm_broadcast_ss(w); w += 1;
+        __m128 vacc01n2 = _mm_broadcast_ss(w); w += 1;
+        __m128 vacc01n3 = _mm_broadcast_ss(w); w += 1;
+        if XNN_LIKELY(nnz != 0) {
+          do {
+            const intptr_t diff = *dmap++;
+            const __m128 vi01 = _mm_loadl_pi(_mm_undefined_ps(), (const __m64*) input);
+            input = (const float*restrict) ((uintptr_t) input + (uintptr_t) diff);
+            const __m128 vw0 = _mm_broadcast_ss(w);
+            const __m128 vw1 = _mm_broadcast_ss(w + 1);
+            const __m128 vw2 = _mm_broadcast_ss(w + 2);
+            const __m128 vw3 = _mm_broadcast_ss(w + 3);
+            w += 4;
+            vacc01n0 = _mm_add_ps(vacc01n0, _mm_mul_ps(vi01, vw0));
+            vacc01n1 = _mm_add_ps(vacc01n1, _mm_mul_ps(vi01, vw1));
+            vacc01n2 = _mm_add_ps(vacc01n2, _mm_mul_ps(vi01, vw2));
+            vacc01n3 = _mm_add_ps(vacc01n3, _mm_mul_ps(vi01, vw3));
+          } while (--nnz != 0);
+        }
+        __m128 vout01n0 = _mm_min_ps(vacc01n0, _mm256_castps256_ps128(vmax));
+        __m128 vout01n1 = _mm_min_ps(vacc01n1, _mm256_castps256_ps128(vmax));
+        __m128 vout01n2 = _mm_min_ps(vacc01n2, _mm256_castps256_ps128(vmax));
+        __m128 vout01n3 = _mm_min_ps(vacc01n3, _mm256_castps256_ps128(vmax));
+        vout01n0 = _mm_max_ps(vout01n0, _mm256_castps256_ps128(vmin));
+        vout01n1 = _mm_max_ps(vout01n1, _mm256_castps256_ps128(vmin));
+        vout01n2 = _mm_max_ps(vout01n2, _mm256_castps256_ps128(vmin));
+        vout01n3 = _mm_max_ps(vout01n3, _mm256_castps256_ps128(vmin));
+        _mm_storel_pi((__m64*) output, vout01n0);
+        output = (float*restrict) ((uintptr_t) output + output_stride);
+        _mm_storel_pi((__m64*) output, vout01n1);
+        output = (float*restrict) ((uintptr_t) output + output_stride);
+        _mm_storel_pi((__m64*) output, vout01n2);
+        output = (float*restrict) ((uintptr_t) output + output_stride);
+        _mm_storel_pi((__m64*) output, vout01n3);
+        output = (float*restrict) ((uintptr_t) output + output_stride);
+        n -= 4;
+      }
+
+      // clean up loop, fall back to nr=1
+      while XNN_UNLIKELY(n != 0) {
+        uint32_t nnz = *nnzmap++;
+        __m128 vacc01 = _mm_broadcast_ss(w); w += 1;
+        if XNN_LIKELY(nnz != 0) {
+          do {
+            const intptr_t diff = *dmap++;
+            const __m128 vi01 = _mm_loadl_pi(_mm_undefined_ps(), (const __m64*) input);
+            input = (const float*restrict) ((uintptr_t) input + (uintptr_t) diff);
+            const __m128 vw = _mm_broadcast_ss(w); w += 1;
+            vacc01 = _mm_add_ps(vacc01, _mm_mul_ps(vi01, vw));
+          } while (--nnz != 0);
+        }
+        __m128 vout01 = _mm_min_ps(vacc01, _mm256_castps256_ps128(vmax));
+        vout01 = _mm_max_ps(vout01, _mm256_castps256_ps128(vmin));
+        _mm_storel_pi((__m64*) output, vout01);
+        output = (float*restrict) ((uintptr_t) output + output_stride);
+        n -= 1;
+      }
+      output = (float*restrict) ((uintptr_t) output - output_decrement);
+      input += 2;
+    }
+    output_decrement += 1 * sizeof(float);
+    if (mc & (1 * sizeof(float))) {
+      const float*restrict w = weights;
+      const int32_t* dmap = widx_dmap;
+      const uint32_t* nnzmap = nidx_nnzmap;
+      size_t n = nc;
+      while (n >= 4) {
+        uint32_t nnz = *nnzmap++;
+        __m128 vacc0n0 = _mm_broadcast_ss(w); w += 1;
+        __m128 vacc0n1 = _mm_broadcast_ss(w); w += 1;
+        __m128 vacc0n2 = _mm_broadcast_ss(w); w += 1;
+        __m128 vacc0n3 = _mm_broadcast_ss(w); w += 1;
+        if XNN_LIKELY(nnz != 0) {
+          do {
+            const intptr_t diff = *dmap++;
+            const __m128 vi0 = _mm_load_ss(input);
+            input = (const float*restrict) ((uintptr_t) input + (uintptr_t) diff);
+            const __m128 vw0 = _mm_broadcast_ss(w);
+            const __m128 vw1 = _mm_broadcast_ss(w + 1);
+            const __m128 vw2 = _mm_broadcast_ss(w + 2);
+            const __m128 vw3 = _mm_broadcast_ss(w + 3);
+            w += 4;
+            vacc0n0 = _mm_add_ps(vacc0n0, _mm_mul_ps(vi0, vw0));
+            vacc0n1 = _mm_add_ps(vacc0n1, _mm_mul_ps(vi0, vw1));
+            vacc0n2 = _mm_add_ps(vacc0n2, _mm_mul_ps(vi0, vw2));
+            vacc0n3 = _mm_add_ps(vacc0n3, _mm_mul_ps(vi0, vw3));
+          } while (--nnz != 0);
+        }
+        __m128 vout0n0 = _mm_min_ps(vacc0n0, _mm256_castps256_ps128(vmax));
+        __m128 vout0n1 = _mm_min_ps(vacc0n1, _mm256_castps256_ps128(vmax));
+        __m128 vout0n2 = _mm_min_ps(vacc0n2, _mm256_castps256_ps128(vmax));
+        __m128 vout0n3 = _mm_min_ps(vacc0n3, _mm256_castps256_ps128(vmax));
+        vout0n0 = _mm_max_ps(vout0n0, _mm256_castps256_ps128(vmin));
+        vout0n1 = _mm_max_ps(vout0n1, _mm256_castps256_ps128(vmin));
+        vout0n2 = _mm_max_ps(vout0n2, _mm256_castps256_ps128(vmin));
+        vout0n3 = _mm_max_ps(vout0n3, _mm256_castps256_ps128(vmin));
+        _mm_store_ss(output, vout0n0);
+        output = (float*restrict) ((uintptr_t) output + output_stride);
+        _mm_store_ss(output, vout0n1);
+        output = (float*restrict) ((uintptr_t) output + output_stride);
+        _mm_store_ss(output, vout0n2);
+        output = (float*restrict) ((uintptr_t) output + output_stride);
+        _mm_store_ss(output, vout0n3);
+        output = (float*restrict) ((uintptr_t) output + output_stride);
+        n -= 4;
+      }
+
+      // clean up loop, fall back to nr=1
+      while XNN_UNLIKELY(n != 0) {
+        uint32_t nnz = *nnzmap++;
+        __m128 vacc0 = _mm_broadcast_ss(w); w += 1;
+        if XNN_LIKELY(nnz != 0) {
+          do {
+            const intptr_t diff = *dmap++;
+            const __m128 vi0 = _mm_load_ss(input);
+            input = (const float*restrict) ((uintptr_t) input + (uintptr_t) diff);
+            const __m128 vw = _mm_broadcast_ss(w); w += 1;
+            vacc0 = _mm_add_ps(vacc0, _mm_mul_ps(vi0, vw));
+          } while (--nnz != 0);
+        }
+        __m128 vout0 = _mm_min_ps(vacc0, _mm256_castps256_ps128(vmax));
+        vout0 = _mm_max_ps(vout0, _mm256_castps256_ps128(vmin));
+        _mm_store_ss(output, vout0);
+        output = (float*restrict) ((uintptr_t) output + output_stride);
+        n -= 1;
+      }
+      output = (float*restrict) ((uintptr_t) output - output_decrement);
+      input += 1;
+    }
+  }
+}
+
+void xnn_f32_spmm_minmax_ukernel_32x1__avx(
+    size_t mc,
+    size_t nc,
+    const float*restrict input,
+    const float*restrict weights,
+    const int32_t*restrict widx_dmap,
+    const uint32_t*restrict nidx_nnzmap,
+    float*restrict output,
+    size_t output_stride,
+    const union xnn_f32_minmax_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(mc != 0);
+  assert(mc % sizeof(float) == 0);
+  assert(nc != 0);
+
+  const __m256 vmin = _mm256_broadcast_ss(params->sse.min);
+  const __m256 vmax = _mm256_broadcast_ss(params->sse.max);
+  size_t output_decrement = output_stride * nc - 32 * sizeof(float);
+  while XNN_LIKELY(mc >= 32 * sizeof(float)) {
+    const float*restrict w = weights;
+    const int32_t* dmap = widx_dmap;
+    const uint32_t* nnzmap = nidx_nnzmap;
+    size_t n = nc;
+    do {
+      uint32_t nnz = *nnzmap++;
+      __m256 vacc01234567 = _mm256_broadcast_ss(w); w += 1;
+      __m256 vacc89ABCDEF = vacc01234567;
+      __m256 vaccGHIJKLMN = vacc01234567;
+      __m256 vaccOPQRSTUV = vacc01234567;
+      if XNN_LIKELY(nnz != 0) {
+        do {
+          const intptr_t diff = *dmap++;
+          const __m256 vi01234567 = _mm256_loadu_ps(input);
+          const __m256 vi89ABCDEF = _mm256_loadu_ps(input + 8);
+          const __m256 viGHIJKLMN = _mm256_loadu_ps(input + 16);
+          const __m256 viOPQRSTUV = _mm256_loadu_ps(input + 24);
+          input = (const float*restrict) ((uintptr_t) input + (uintptr_t) diff);
+          const __m256 vw = _mm256_broadcast_ss(w); w += 1;
+          vacc01234567 = _mm256_add_ps(vacc01234567, _mm256_mul_ps(vi01234567, vw));
+          vacc89ABCDEF = _mm256_add_ps(vacc89ABCDEF, _mm256_mul_ps(vi89ABCDEF, vw));
+          vaccGHIJKLMN = _mm256_add_ps(vaccGHIJKLMN, _mm256_mul_ps(viGHIJKLMN, vw));
+          vaccOPQRSTUV = _mm256_add_ps(vaccOPQRSTUV, _mm256_mul_ps(viOPQRSTUV, vw));
+        } while (--nnz != 0);
+      }
+      __m256 vout01234567 = _mm256_min_ps(vacc01234567, vmax);
+      __m256 vout89ABCDEF = _mm256_min_ps(vacc89ABCDEF, vmax);
+      __m256 voutGHIJKLMN = _mm256_min_ps(vaccGHIJKLMN, vmax);
+      __m256 voutOPQRSTUV = _mm256_min_ps(vaccOPQRSTUV, vmax);
+      vout01234567 = _mm256_max_ps(vout01234567, vmin);
+      vout89ABCDEF = _mm256_max_ps(vout89ABCDEF, vmin);
+      voutGHIJKLMN = _mm256_max_ps(voutGHIJKLMN, vmin);
+      voutOPQRSTUV = _mm256_max_ps(voutOPQRSTUV, vmin);
+      _mm256_storeu_ps(output, vout01234567);
+      _mm256_storeu_ps(output + 8, vout89ABCDEF);
+      _mm256_storeu_ps(output + 16, voutGHIJKLMN);
+      _mm256_storeu_ps(output + 24, voutOPQRSTUV);
+      output = (float*restrict) ((uintptr_t) output + output_stride);
+    } while (--n != 0);
+    output = (float*restrict) ((uintptr_t) output - output_decrement);
+    input += 32;
+    mc -= 32 * sizeof(float);
+  }
+  if XNN_UNLIKELY(mc != 0) {
+    output_decrement += 16 * sizeof(float);
+    if (mc & (16 * sizeof(float))) {
+      const float*restrict w = weights;
+      const int32_t* dmap = widx_dmap;
+      const uint32_t* nnzmap = nidx_nnzmap;
+      size_t n = nc;
+      do {
+        uint32_t nnz = *nnzmap++;
+        __m256 vacc01234567 = _mm256_broadcast_ss(w); w += 1;
+        __m256 vacc89ABCDEF = vacc01234567;
+        if XNN_LIKELY(nnz != 0) {
+          do {
+            const intptr_t diff = *dmap++;
+            const __m256 vi01234567 = _mm256_loadu_ps(input);
+            const __m256 vi89ABCDEF = _mm256_loadu_ps(input + 8);
+            input = (const float*restrict) ((uintptr_t) input + (uintptr_t) diff);
+            const __m256 vw = _mm256_broadcast_ss(w); w += 1;
+            vacc01234567 = _mm256_add_ps(vacc01234567, _mm256_mul_ps(vi01234567, vw));
+            vacc89ABCDEF = _mm256_add_ps(vacc89ABCDEF, _mm256_mul_ps(vi89ABCDEF, vw));
+          } while (--nnz != 0);
+        }
+        __m256 vout01234567 = _mm256_min_ps(vacc01234567, vmax);
+        __m256 vout89ABCDEF = _mm256_min_ps(vacc89ABCDEF, vmax);
+        vout01234567 = _mm256_max_ps(vout01234567, vmin);
+        vout89ABCDEF = _mm256_max_ps(vout89ABCDEF, vmin);
+        _mm256_storeu_ps(output, vout01234567);
+        _mm256_storeu_ps(output + 8, vout89ABCDEF);
+        output = (float*restrict) ((uintptr_t) output + output_stride);
+      } while (--n != 0);
+      output = (float*restrict) ((uintptr_t) output - output_decrement);
+      input += 16;
+    }
+    output_decrement += 8 * sizeof(float);
+    if (mc & (8 * sizeof(float))) {
+      const float*restrict w = weights;
+      const int32_t* dmap = widx_dmap;
+      const uint32_t* nnzmap = nidx_nnzmap;
+      size_t n = nc;
+      do {
+        uint32_t nnz = *nnzmap++;
+        __m256 vacc01234567 = _mm256_broadcast_ss(w); w += 1;
+        if XNN_LIKELY(nnz != 0) {
+          do {
+            const intptr_t diff = *dmap++;
+            const __m256 vi01234567 = _mm256_loadu_ps(input);
+            input = (const float*restrict) ((uintptr_t) input + (uintptr_t) diff);
+            const __m256 vw = _mm256_broadcast_ss(w); w += 1;
+            vacc01234567 = _mm256_add_ps(vacc01234567, _mm256_mul_ps(vi01234567, vw));
+          } while (--nnz != 0);
+        }
+        __m256 vout01234567 = _mm256_min_ps(vacc01234567, vmax);
+        vout01234567 = _mm256_max_ps(vout01234567, vmin);
+        _mm256_storeu_ps(output, vout01234567);
+        output = (float*restrict) ((uintptr_t) output + output_stride);
+      } while (--n != 0);
+      output = (float*restrict) ((uintptr_t) output - output_decrement);
+      input += 8;
+    }
+    output_decrement += 4 * sizeof(float);
+    if (mc & (4 * sizeof(float))) {
+      const float*restrict w = weights;
+      const int32_t* dmap = widx_dmap;
+      const uint32_t* nnzmap = nidx_nnzmap;
+      size_t n = nc;
+      do {
+        uint32_t nnz = *nnzmap++;
+        __m128 vacc0123 = _mm_broadcast_ss(w); w += 1;
+        if XNN_LIKELY(nnz != 0) {
+          do {
+            const intptr_t diff = *dmap++;
+            const __m128 vi0123 = _mm_loadu_ps(input);
+            input = (const float*restrict) ((uintptr_t) input + (uintptr_t) diff);
+            const __m128 vw = _mm_broadcast_ss(w); w += 1;
+            vacc0123 = _mm_add_ps(vacc0123, _mm_mul_ps(vi0123, vw));
+          } while (--nnz != 0);
+        }
+        __m128 vout0123 = _mm_min_ps(vacc0123, _mm256_castps256_ps128(vmax));
+        vout0123 = _mm_max_ps(vout0123, _mm256_castps256_ps128(vmin));
+        _mm_storeu_ps(output, vout0123);
+        output = (float*restrict) ((uintptr_t) output + output_stride);
+      } while (--n != 0);
+      output = (float*restrict) ((uintptr_t) output - output_decrement);
+      input += 4;
+    }
+    output_decrement += 2 * sizeof(float);
+    if (mc & (2 * sizeof(float))) {
+      const float*restrict w = weights;
+      const int32_t* dmap = widx_dmap;
+      const uint32_t* nnzmap = nidx_nnzmap;
+      size_t n = nc;
+      do {
+        uint32_t nnz = *nnzmap++;
+        __m128 vacc01 = _mm_broadcast_ss(w); w += 1;
+        if XNN_LIKELY(nnz != 0) {
+          do {
+            const intptr_t diff = *dmap++;
+            const __m128 vi01 = _mm_loadl_pi(_mm_undefined_ps(), (const __m64*) input);
+            input = (const float*restrict) ((uintptr_t) input + (uintptr_t) diff);
+            const __m128 vw = _mm_broadcast_ss(w); w += 1;
+            vacc01 = _mm_add_ps(vacc01, _mm_mul_ps(vi01, vw));
+          } while (--nnz != 0);
+        }
+        __m128 vout01 = _mm_min_ps(vacc01, _mm256_castps256_ps128(vmax));
+        vout01 = _mm_max_ps(vout01, _mm256_castps256_ps128(vmin));
+        _mm_storel_pi((__m64*) output, vout01);
+        output = (float*restrict) ((uintptr_t) output + output_stride);
+      } while (--n != 0);
+      output = (float*restrict) ((uintptr_t) output - output_decrement);
+      input += 2;
+    }
+    output_decrement += 1 * sizeof(float);
+    if (mc & (1 * sizeof(float))) {
+      const float*restrict w = weights;
+      const int32_t* dmap = widx_dmap;
+      const uint32_t* nnzmap = nidx_nnzmap;
+      size_t n = nc;
+      do {
+        uint32_t nnz = *nnzmap++;
+        __m128 vacc0 = _mm_broadcast_ss(w); w += 1;
+        if XNN_LIKELY(nnz != 0) {
+          do {
+            const intptr_t diff = *dmap++;
+            const __m128 vi0 = _mm_load_ss(input);
+            input = (const float*restrict) ((uintptr_t) input + (uintptr_t) diff);
+            const __m128 vw = _mm_broadcast_ss(w); w += 1;
+            vacc0 = _mm_add_ps(vacc0, _mm_mul_ps(vi0, vw));
+          } while (--nnz != 0);
+        }
+        __m128 vout0 = _mm_min_ps(vacc0, _mm256_castps256_ps128(vmax));
+        vout0 = _mm_max_ps(vout0, _mm256_castps256_ps128(vmin));
+        _mm_store_ss(output, vout0);
+        output = (float*restrict) ((uintptr_t) output + output_stride);
+      } while (--n != 0);
+      output = (float*restrict) ((uintptr_t) output - output_decrement);
+      input += 1;
+    }
+  }
+}
+
+void xnn_f32_spmm_minmax_ukernel_32x2__avx(
+    size_t mc,
+    size_t nc,
+    const float*restrict input,
+    const float*restrict weights,
+    const int32_t*restrict widx_dmap,
+    const uint32_t*restrict nidx_nnzmap,
+    float*restrict output,
+    size_t output_stride,
+    const union xnn_f32_minmax_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(mc != 0);
+  assert(mc % sizeof(float) == 0);
+  assert(nc != 0);
+
+  const __m256 vmin = _mm256_broadcast_ss(params->sse.min);
+  const __m256 vmax = _mm256_broadcast_ss(params->sse.max);
+  size_t output_decrement = output_stride * nc - 32 * sizeof(float);
+  while XNN_LIKELY(mc >= 32 * sizeof(float)) {
+    const float*restrict w = weights;
+    const int32_t* dmap = widx_dmap;
+    const uint32_t* nnzmap = nidx_nnzmap;
+    size_t n = nc;
+    while (n >= 2) {
+      uint32_t nnz = *nnzmap++;
+      __m256 vacc01234567n0 = _mm256_broadcast_ss(w); w += 1;
+      __m256 vacc89ABCDEFn0 = vacc01234567n0;
+      __m256 vaccGHIJKLMNn0 = vacc01234567n0;
+      __m256 vaccOPQRSTUVn0 = vacc01234567n0;
+      __m256 vacc01234567n1 = _mm256_broadcast_ss(w); w += 1;
+      __m256 vacc89ABCDEFn1 = vacc01234567n1;
+      __m256 vaccGHIJKLMNn1 = vacc01234567n1;
+      __m256 vaccOPQRSTUVn1 = vacc01234567n1;
+      if XNN_LIKELY(nnz != 0) {
+        do {
+          const intptr_t diff = *dmap++;
+          const __m256 vi01234567 = _mm256_loadu_ps(input);
+          const __m256 vi89ABCDEF = _mm256_loadu_ps(input + 8);
+          const __m256 viGHIJKLMN = _mm256_loadu_ps(input + 16);
+          const __m256 viOPQRSTUV = _mm256_loadu_ps(input + 24);
+          input = (const float*restrict) ((uintptr_t) input + (uintptr_t) diff);
+          const __m256 vw0 = _mm256_broadcast_ss(w);
+          const __m256 vw1 = _mm256_broadcast_ss(w + 1);
+          w += 2;
+          vacc01234567n0 = _mm256_add_ps(vacc01234567n0, _mm256_mul_ps(vi01234567, vw0));
+          vacc89ABCDEFn0 = _mm256_add_ps(vacc89ABCDEFn0, _mm256_mul_ps(vi89ABCDEF, vw0));
+          vaccGHIJKLMNn0 = _mm256_add_ps(vaccGHIJKLMNn0, _mm256_mul_ps(viGHIJKLMN, vw0));
+          vaccOPQRSTUVn0 = _mm256_add_ps(vaccOPQRSTUVn0, _mm256_mul_ps(viOPQRSTUV, vw0));
+          vacc01234567n1 = _mm256_add_ps(vacc01234567n1, _mm256_mul_ps(vi01234567, vw1));
+          vacc89ABCDEFn1 = _mm256_add_ps(vacc89ABCDEFn1, _mm256_mul_ps(vi89ABCDEF, vw1));
+          vaccGHIJKLMNn1 = _mm256_add_ps(vaccGHIJKLMNn1, _mm256_mul_ps(viGHIJKLMN, vw1));
+          vaccOPQRSTUVn1 = _mm256_add_ps(vaccOPQRSTUVn1, _mm256_mul_ps(viOPQRSTUV, vw1));
+        } while (--nnz != 0);
+      }
+      __m256 vout01234567n0 = _mm256_min_ps(vacc01234567n0, vmax);
+      __m256 vout89ABCDEFn0 = _mm256_min_ps(vacc89ABCDEFn0, vmax);
+      __m256 voutGHIJKLMNn0 = _mm256_min_ps(vaccGHIJKLMNn0, vmax);
+      __m256 voutOPQRSTUVn0 = _mm256_min_ps(vaccOPQRSTUVn0, vmax);
+      __m256 vout01234567n1 = _mm256_min_ps(vacc01234567n1, vmax);
+      __m256 vout89ABCDEFn1 = _mm256_min_ps(vacc89ABCDEFn1, vmax);
+      __m256 voutGHIJKLMNn1 = _mm256_min_ps(vaccGHIJKLMNn1, vmax);
+      __m256 voutOPQRSTUVn1 = _mm256_min_ps(vaccOPQRSTUVn1, vmax);
+      vout01234567n0 = _mm256_max_ps(vout01234567n0, vmin);
+      vout89ABCDEFn0 = _mm256_max_ps(vout89ABCDEFn0, vmin);
+      voutGHIJKLMNn0 = _mm256_max_ps(voutGHIJKLMNn0, vmin);
+      voutOPQRSTUVn0 = _mm256_max_ps(voutOPQRSTUVn0, vmin);
+      vout01234567n1 = _mm256_max_ps(vout01234567n1, vmin);
+      vout89ABCDEFn1 = _mm256_max_ps(vout89ABCDEFn1, vmin);
+      voutGHIJKLMNn1 = _mm256_max_ps(voutGHIJKLMNn1, vmin);
+      voutOPQRSTUVn1 = _mm256_max_ps(voutOPQRSTUVn1, vmin);
+      _mm256_storeu_ps(output, vout01234567n0);
+      _mm256_storeu_ps(output + 8, vout89ABCDEFn0);
+      _mm256_storeu_ps(output + 16, voutGHIJKLMNn0);
+      _mm256_storeu_ps(output + 24, voutOPQRSTUVn0);
+      output = (float*restrict) ((uintptr_t) output + output_stride);
+      _mm256_storeu_ps(output, vout01234567n1);
+      _mm256_storeu_ps(output + 8, vout89ABCDEFn1);
+      _mm256_storeu_ps(output + 16, voutGHIJKLMNn1);
+      _mm256_storeu_ps(output + 24, voutOPQRSTUVn1);
+      output = (float*restrict) ((uintptr_t) output + output_stride);
+      n -= 2;
+    }
+
+    // clean up loop, fall back to nr=1
+    while XNN_UNLIKELY(n != 0) {
+      uint32_t nnz = *nnzmap++;
+      __m256 vacc01234567 = _mm256_broadcast_ss(w); w += 1;
+      __m256 vacc89ABCDEF = vacc01234567;
+      __m256 vaccGHIJKLMN = vacc01234567;
+      __m256 vaccOPQRSTUV = vacc01234567;
+      if XNN_LIKELY(nnz != 0) {
+        do {
+          const intptr_t diff = *dmap++;
+          const __m256 vi01234567 = _mm256_loadu_ps(input);
+          const __m256 vi89ABCDEF = _mm256_loadu_ps(input + 8);
+          const __m256 viGHIJKLMN = _mm256_loadu_ps(input + 16);
+          const __m256 viOPQRSTUV = _mm256_loadu_ps(input + 24);
+          input = (const float*restrict) ((uintptr_t) input + (uintptr_t) diff);
+          const __m256 vw = _mm256_broadcast_ss(w); w += 1;
+          vacc01234567 = _mm256_add_ps(vacc01234567, _mm256_mul_ps(vi01234567, vw));
+          vacc89ABCDEF = _mm256_add_ps(vacc89ABCDEF, _mm256_mul_ps(vi89ABCDEF, vw));
+          vaccGHIJKLMN = _mm256_add_ps(vaccGHIJKLMN, _mm256_mul_ps(viGHIJKLMN, vw));
+          vaccOPQRSTUV = _mm256_add_ps(vaccOPQRSTUV, _mm256_mul_ps(viOPQRSTUV, vw));
+        } while (--nnz != 0);
+      }
+      __m256 vout01234567 = _mm256_min_ps(vacc01234567, vmax);
+      __m256 vout89ABCDEF = _mm256_min_ps(vacc89ABCDEF, vmax);
+      __m256 voutGHIJKLMN = _mm256_min_ps(vaccGHIJKLMN, vmax);
+      __m256 voutOPQRSTUV = _mm256_min_ps(vaccOPQRSTUV, vmax);
+      vout01234567 = _mm256_max_ps(vout01234567, vmin);
+      vout89ABCDEF = _mm256_max_ps(vout89ABCDEF, vmin);
+      voutGHIJKLMN = _mm256_max_ps(voutGHIJKLMN, vmin);
+      voutOPQRSTUV = _mm256_max_ps(voutOPQRSTUV, vmin);
+      _mm256_storeu_ps(output, vout01234567);
+      _mm256_storeu_ps(output + 8, vout89ABCDEF);
+      _mm256_storeu_ps(output + 16, voutGHIJKLMN);
+      _mm256_storeu_ps(output + 24, voutOPQRSTUV);
+      output = (float*restrict) ((uintptr_t) output + output_stride);
+      n -= 1;
+    }
+    output = (float*restrict) ((uintptr_t) output - output_decrement);
+    input += 32;
+    mc -= 32 * sizeof(float);
+  }
+  if XNN_UNLIKELY(mc != 0) {
+    output_decrement += 16 * sizeof(float);
+    if (mc & (16 * sizeof(float))) {
+      const float*restrict w = weights;
+      const int32_t* dmap = widx_dmap;
+      const uint32_t* nnzmap = nidx_nnzmap;
+      size_t n = nc;
+      while (n >= 2) {
+        uint32_t nnz = *nnzmap++;
+        __m256 vacc01234567n0 = _mm256_broadcast_ss(w); w += 1;
+        __m256 vacc89ABCDEFn0 = vacc01234567n0;
+        __m256 vacc01234567n1 = _mm256_broadcast_ss(w); w += 1;
+        __m256 vacc89ABCDEFn1 = vacc01234567n1;
+        if XNN_LIKELY(nnz != 0) {
+          do {
+            const intptr_t diff = *dmap++;
+            const __m256 vi01234567 = _mm256_loadu_ps(input);
+            const __m256 vi89ABCDEF = _mm256_loadu_ps(input + 8);
+            input = (const float*restrict) ((uintptr_t) input + (uintptr_t) diff);
+            const __m256 vw0 = _mm256_broadcast_ss(w);
+            const __m256 vw1 = _mm256_broadcast_ss(w + 1);
+            w += 2;
+            vacc01234567n0 = _mm256_add_ps(vacc01234567n0, _mm256_mul_ps(vi01234567, vw0));
+            vacc89ABCDEFn0 = _mm256_add_ps(vacc89ABCDEFn0, _mm256_mul_ps(vi89ABCDEF, vw0));
+            vacc01234567n1 = _mm256_add_ps(vacc01234567n1, _mm256_mul_ps(vi01234567, vw1));
+            vacc89ABCDEFn1 = _mm256_add_ps(vacc89ABCDEFn1, _mm256_mul_ps(vi89ABCDEF, vw1));
+          } while (--nnz != 0);
+        }
+        __m256 vout01234567n0 = _mm256_min_ps(vacc01234567n0, vmax);
+        __m256 vout89ABCDEFn0 = _mm256_min_ps(vacc89ABCDEFn0, vmax);
+        __m256 vout01234567n1 = _mm256_min_ps(vacc01234567n1, vmax);
+        __m256 vout89ABCDEFn1 = _mm256_min_ps(vacc89ABCDEFn1, vmax);
+        vout01234567n0 = _mm256_max_ps(vout01234567n0, vmin);
+        vout89ABCDEFn0 = _mm256_max_ps(vout89ABCDEFn0, vmin);
+        vout01234567n1 = _mm256_max_ps(vout01234567n1, vmin);
+        vout89ABCDEFn1 = _mm256_max_ps(vout89ABCDEFn1, vmin);
+        _mm256_storeu_ps(output, vout01234567n0);
+        _mm256_storeu_ps(output + 8, vout89ABCDEFn0);
+        output = (float*restrict) ((uintptr_t) output + output_stride);
+        _mm256_storeu_ps(output, vout01234567n1);
+        _mm256_storeu_ps(output + 8, vout89ABCDEFn1);
+        output = (float*restrict) ((uintptr_t) output + output_stride);
+        n -= 2;
+      }
+
+      // clean up loop, fall back to nr=1
+      while XNN_UNLIKELY(n != 0) {
+        uint32_t nnz = *nnzmap++;
+        __m256 vacc01234567 = _mm256_broadcast_ss(w); w += 1;
+        __m256 vacc89ABCDEF = vacc01234567;
+        if XNN_LIKELY(nnz != 0) {
+          do {
+            const intptr_t diff = *dmap++;
+            const __m256 vi01234567 = _mm256_loadu_ps(input);
+            const __m256 vi89ABCDEF = _mm256_loadu_ps(input + 8);
+            input = (const float*restrict) ((uintptr_t) input + (uintptr_t) diff);
+            const __m256 vw = _mm256_broadcast_ss(w); w += 1;
+            vacc01234567 = _mm256_add_ps(vacc01234567, _mm256_mul_ps(vi01234567, vw));
+            vacc89ABCDEF = _mm256_add_ps(vacc89ABCDEF, _mm256_mul_ps(vi89ABCDEF, vw));
+          } while (--nnz != 0);
+        }
+        __m256 vout01234567 = _mm256_min_ps(vacc01234567, vmax);
+        __m256 vout89ABCDEF = _mm256_min_ps(vacc89ABCDEF, vmax);
+        vout01234567 = _mm256_max_ps(vout01234567, vmin);
+        vout89ABCDEF = _mm256_max_ps(vout89ABCDEF, vmin);
+        _mm256_storeu_ps(output, vout01234567);
+        _mm256_storeu_ps(output + 8, vout89ABCDEF);
+        output = (float*restrict) ((uintptr_t) output + output_stride);
+        n -= 1;
+      }
+      output = (float*restrict) ((uintptr_t) output - output_decrement);
+      input += 16;
+    }
+    output_decrement += 8 * sizeof(float);
+    if (mc & (8 * sizeof(float))) {
+      const float*restrict w = weights;
+      const int32_t* dmap = widx_dmap;
+      const uint32_t* nnzmap = nidx_nnzmap;
+      size_t n = nc;
+      while (n >= 2) {
+        uint32_t nnz = *nnzmap++;
+        __m256 vacc01234567n0 = _mm256_broadcast_ss(w); w += 1;
+        __m256 vacc01234567n1 = _mm256_broadcast_ss(w); w += 1;
+        if XNN_LIKELY(nnz != 0) {
+          do {
+            const intptr_t diff = *dmap++;
+            const __m256 vi01234567 = _mm256_loadu_ps(input);
+            input = (const float*restrict) ((uintptr_t) input + (uintptr_t) diff);
+            const __m256 vw0 = _mm256_broadcast_ss(w);
+            const __m256 vw1 = _mm256_broadcast_ss(w + 1);
+            w += 2;
+            vacc01234567n0 = _mm256_add_ps(vacc01234567n0, _mm256_mul_ps(vi01234567, vw0));
+            vacc01234567n1 = _mm256_add_ps(vacc01234567n1, _mm256_mul_ps(vi01234567, vw1));
+          } while (--nnz != 0);
+        }
+        __m256 vout01234567n0 = _mm256_min_ps(vacc01234567n0, vmax);
+        __m256 vout01234567n1 = _mm256_min_ps(vacc01234567n1, vmax);
+        vout01234567n0 = _mm256_max_ps(vout01234567n0, vmin);
+        vout01234567n1 = _mm256_max_ps(vout01234567n1, vmin);
+        _mm256_storeu_ps(output, vout01234567n0);
+        output = (float*restrict) ((uintptr_t) output + output_stride);
+        _mm256_storeu_ps(output, vout01234567n1);
+        output = (float*restrict) ((uintptr_t) output + output_stride);
+        n -= 2;
+      }
+
+      // clean up loop, fall back to nr=1
+      while XNN_UNLIKELY(n != 0) {
+        uint32_t nnz = *nnzmap++;
+        __m256 vacc01234567 = _mm256_broadcast_ss(w); w += 1;
+        if XNN_LIKELY(nnz != 0) {
+          do {
+            const intptr_t diff = *dmap++;
+            const __m256 vi01234567 = _mm256_loadu_ps(input);
+            input = (const float*restrict) ((uintptr_t) input + (uintptr_t) diff);
+            const __m256 vw = _mm256_broadcast_ss(w); w += 1;
+            vacc01234567 = _mm256_add_ps(vacc01234567, _mm256_mul_ps(vi01234567, vw));
+          } while (--nnz != 0);
+        }
+        __m256 vout01234567 = _mm256_min_ps(vacc01234567, vmax);
+        vout01234567 = _mm256_max_ps(vout01234567, vmin);
+        _mm256_storeu_ps(output, vout01234567);
+        output = (float*restrict) ((uintptr_t) output + output_stride);
+        n -= 1;
+      }
+      output = (float*restrict) ((uintptr_t) output - output_decrement);
+      input += 8;
+    }
+    output_decrement += 4 * sizeof(float);
+    if (mc & (4 * sizeof(float))) {
+      const float*restrict w = weights;
+      const int32_t* dmap = widx_dmap;
+      const uint32_t* nnzmap = nidx_nnzmap;
+      size_t n = nc;
+      while (n >= 2) {
+        uint32_t nnz = *nnzmap++;
+        __m128 vacc0123n0 = _mm_broadcast_ss(w); w += 1;
+        __m128 vacc0123n1 = _mm_broadcast_ss(w); w += 1;
+        if XNN_LIKELY(nnz != 0) {
+          do {
+            const intptr_t diff = *dmap++;
+            const __m128 vi0123 = _mm_loadu_ps(input);
+            input = (const float*restrict) ((uintptr_t) input + (uintptr_t) diff);
+            const __m128 vw0 = _mm_broadcast_ss(w);
+            const __m128 vw1 = _mm_broadcast_ss(w + 1);
+            w += 2;
+            vacc0123n0 = _mm_add_ps(vacc0123n0, _mm_mul_ps(vi0123, vw0));
+            vacc0123n1 = _mm_add_ps(vacc0123n1, _mm_mul_ps(vi0123, vw1));
+          } while (--nnz != 0);
+        }
+        __m128 vout0123n0 = _mm_min_ps(vacc0123n0, _mm256_castps256_ps128(vmax));
+        __m128 vout0123n1 = _mm_min_ps(vacc0123n1, _mm256_castps256_ps128(vmax));
+        vout0123n0 = _mm_max_ps(vout0123n0, _mm256_castps256_ps128(vmin));
+        vout0123n1 = _mm_max_ps(vout0123n1, _mm256_castps256_ps128(vmin));
+        _mm_storeu_ps(output, vout0123n0);
+        output = (float*restrict) ((uintptr_t) output + output_stride);
+        _mm_storeu_ps(output, vout0123n1);
+        output = (float*restrict) ((uintptr_t) output + output_stride);
+        n -= 2;
+      }
+
+      // clean up loop, fall back to nr=1
+      while XNN_UNLIKELY(n != 0) {
+        uint32_t nnz = *nnzmap++;
+        __m128 vacc0123 = _mm_broadcast_ss(w); w += 1;
+        if XNN_LIKELY(nnz != 0) {
+          do {
+            const intptr_t diff = *dmap++;
+            const __m128 vi0123 = _mm_loadu_ps(input);
+            input = (const float*restrict) ((uintptr_t) input + (uintptr_t) diff);
+            const __m128 vw = _mm_broadcast_ss(w); w += 1;
+            vacc0123 = _mm_add_ps(vacc0123, _mm_mul_ps(vi0123, vw));
+          } while (--nnz != 0);
+        }
+        __m128 vout0123 = _mm_min_ps(vacc0123, _mm256_castps256_ps128(vmax));
+        vout0123 = _mm_max_ps(vout0123, _mm256_castps256_ps128(vmin));
+        _mm_storeu_ps(output, vout0123);
+        output = (float*restrict) ((uintptr_t) output + output_stride);
+        n -= 1;
+      }
+      output = (float*restrict) ((uintptr_t) output - output_decrement);
+      input += 4;
+    }
+    output_decrement += 2 * sizeof(float);
+    if (mc & (2 * sizeof(float))) {
+      const float*restrict w = weights;
+      const int32_t* dmap = widx_dmap;
+      const uint32_t* nnzmap = nidx_nnzmap;
+      size_t n = nc;
+      while (n >= 2) {
+        uint32_t nnz = *nnzmap++;
+        __m128 vacc01n0 = _mm_broadcast_ss(w); w += 1;
+        __m128 vacc01n1 = _mm_broadcast_ss(w); w += 1;
+        if XNN_LIKELY(nnz != 0) {
+          do {
+            const intptr_t diff = *dmap++;
+            const __m128 vi01 = _mm_loadl_pi(_mm_undefined_ps(), (const __m64*) input);
+            input = (const float*restrict) ((uintptr_t) input + (uintptr_t) diff);
+            const __m128 vw0 = _mm_broadcast_ss(w);
+            const __m128 vw1 = _mm_broadcast_ss(w + 1);
+            w += 2;
+            vacc01n0 = _mm_add_ps(vacc01n0, _mm_mul_ps(vi01, vw0));
+            vacc01n1 = _mm_add_ps(vacc01n1, _mm_mul_ps(vi01, vw1));
+          } while (--nnz != 0);
+        }
+        __m128 vout01n0 = _mm_min_ps(vacc01n0, _mm256_castps256_ps128(vmax));
+        __m128 vout01n1 = _mm_min_ps(vacc01n1, _mm256_castps256_ps128(vmax));
+        vout01n0 = _mm_max_ps(vout01n0, _mm256_castps256_ps128(vmin));
+        vout01n1 = _mm_max_ps(vout01n1, _mm256_castps256_ps128(vmin));
+        _mm_storel_pi((__m64*) output, vout01n0);
+        output = (float*restrict) ((uintptr_t) output + output_stride);
+        _mm_storel_pi((__m64*) output, vout01n1);
+        output = (float*restrict) ((uintptr_t) output + output_stride);
+        n -= 2;
+      }
+
+      // clean up loop, fall back to nr=1
+      while XNN_UNLIKELY(n != 0) {
+        uint32_t nnz = *nnzmap++;
+        __m128 vacc01 = _mm_broadcast_ss(w); w += 1;
+        if XNN_LIKELY(nnz != 0) {
+          do {
+            const intptr_t diff = *dmap++;
+            const __m128 vi01 = _mm_loadl_pi(_mm_undefined_ps(), (const __m64*) input);
+            input = (const float*restrict) ((uintptr_t) input + (uintptr_t) diff);
+            const __m128 vw = _mm_broadcast_ss(w); w += 1;
+            vacc01 = _mm_add_ps(vacc01, _mm_mul_ps(vi01, vw));
+          } while (--nnz != 0);
+        }
+        __m128 vout01 = _mm_min_ps(vacc01, _mm256_castps256_ps128(vmax));
+        vout01 = _mm_max_ps(vout01, _mm256_castps256_ps128(vmin));
+        _mm_storel_pi((__m64*) output, vout01);
+        output = (float*restrict) ((uintptr_t) output + output_stride);
+        n -= 1;
+      }
+      output = (float*restrict) ((uintptr_t) output - output_decrement);
+      input += 2;
+    }
+    output_decrement += 1 * sizeof(float);
+    if (mc & (1 * sizeof(float))) {
+      const float*restrict w = weights;
+      const int32_t* dmap = widx_dmap;
+      const uint32_t* nnzmap = nidx_nnzmap;
+      size_t n = nc;
+      while (n >= 2) {
+        uint32_t nnz = *nnzmap++;
+        __m128 vacc0n0 = _mm_broadcast_ss(w); w += 1;
+        __m128 vacc0n1 = _mm_broadcast_ss(w); w += 1;
+        if XNN_LIKELY(nnz != 0) {
+          do {
+            const intptr_t diff = *dmap++;
+            const __m128 vi0 = _mm_load_ss(input);
+            input = (const float*restrict) ((uintptr_t) input + (uintptr_t) diff);
+            const __m128 vw0 = _mm_broadcast_ss(w);
+            const __m128 vw1 = _mm_broadcast_ss(w + 1);
+            w += 2;
+            vacc0n0 = _mm_add_ps(vacc0n0, _mm_mul_ps(vi0, vw0));
+            vacc0n1 = _mm_add_ps(vacc0n1, _mm_mul_ps(vi0, vw1));
+          } while (--nnz != 0);
+        }
+        __m128 vout0n0 = _mm_min_ps(vacc0n0, _mm256_castps256_ps128(vmax));
+        __m128 vout0n1 = _mm_min_ps(vacc0n1, _mm256_castps256_ps128(vmax));
+        vout0n0 = _mm_max_ps(vout0n0, _mm256_castps256_ps128(vmin));
+        vout0n1 = _mm_max_ps(vout0n1, _mm256_castps256_ps128(vmin));
+        _mm_store_ss(output, vout0n0);
+        output = (float*restrict) ((uintptr_t) output + output_stride);
+        _mm_store_ss(output, vout0n1);
+        output = (float*restrict) ((uintptr_t) output + output_stride);
+        n -= 2;
+      }
+
+      // clean up loop, fall back to nr=1
+      while XNN_UNLIKELY(n != 0) {
+        uint32_t nnz = *nnzmap++;
+        __m128 vacc0 = _mm_broadcast_ss(w); w += 1;
+        if XNN_LIKELY(nnz != 0) {
+          do {
+            const intptr_t diff = *dmap++;
+            const __m128 vi0 = _mm_load_ss(input);
+            input = (const float*restrict) ((uintptr_t) input + (uintptr_t) diff);
+            const __m128 vw = _mm_broadcast_ss(w); w += 1;
+            vacc0 = _mm_add_ps(vacc0, _mm_mul_ps(vi0, vw));
+          } while (--nnz != 0);
+        }
+        __m128 vout0 = _mm_min_ps(vacc0, _mm256_castps256_ps128(vmax));
+        vout0 = _mm_max_ps(vout0, _mm256_castps256_ps128(vmin));
+        _mm_store_ss(output, vout0);
+        output = (float*restrict) ((uintptr_t) output + output_stride);
+        n -= 1;
+      }
+      output = (float*restrict) ((uintptr_t) output - output_decrement);
+      input += 1;
+    }
+  }
+}
+
+void xnn_f32_vadd_minmax_ukernel__avx_x16(
+    size_t n,
+    const float* a,
+    const float* b,
+    float* y,
+    const union xnn_f32_minmax_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(n != 0);
+  assert(n % sizeof(float) == 0);
+  assert(a != NULL);
+  assert(b != NULL);
+  assert(y != NULL);
+
+  const __m256 vy_min = _mm256_load_ps(params->avx.min);
+  const __m256 vy_max = _mm256_load_ps(params->avx.max);
+
+  for (; n >= 16 * sizeof(float); n -= 16 * sizeof(float)) {
+    const __m256 va01234567 = _mm256_loadu_ps(a);
+    const __m256 va89ABCDEF = _mm256_loadu_ps(a + 8);
+    a += 16;
 
     const __m256 vb01234567 = _mm256_loadu_ps(b);
     const __m256 vb89ABCDEF = _mm256_loadu_ps(b + 8);
@@ -4078,6 +7633,73 @@ void xnn_f32_vlrelu_ukernel__avx_x16(
   }
 }
 
+void xnn_f32_vnormcaddc_ukernel_c16__avx(
+    size_t channels,
+    const float* input,
+    const float* mean,
+    const float* inv_stddev,
+    const float* weights,
+    float* output,
+    const union xnn_f32_default_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(channels != 0);
+  assert(channels % sizeof(float) == 0);
+
+  const __m256 vmean = _mm256_broadcast_ss(mean);
+  const __m256 vinv_stddev = _mm256_broadcast_ss(inv_stddev);
+  for (; channels >= 16 * sizeof(float); channels -= 16 * sizeof(float)) {
+    const __m256 vx01234567 = _mm256_loadu_ps(input);
+    const __m256 vx89ABCDEF = _mm256_loadu_ps(input + 8);
+    input += 16;
+
+    const __m256 vscale01234567 = _mm256_load_ps(weights);
+    const __m256 vscale89ABCDEF = _mm256_load_ps(weights + 8);
+    const __m256 vbias01234567 = _mm256_load_ps(weights + 16);
+    const __m256 vbias89ABCDEF = _mm256_load_ps(weights + 24);
+    weights += 32;
+
+    const __m256 vnorm01234567 = _mm256_mul_ps(_mm256_sub_ps(vx01234567, vmean), vinv_stddev);
+    const __m256 vnorm89ABCDEF = _mm256_mul_ps(_mm256_sub_ps(vx89ABCDEF, vmean), vinv_stddev);
+
+    const __m256 vy01234567 = _mm256_add_ps(_mm256_mul_ps(vnorm01234567, vscale01234567), vbias01234567);
+    const __m256 vy89ABCDEF = _mm256_add_ps(_mm256_mul_ps(vnorm89ABCDEF, vscale89ABCDEF), vbias89ABCDEF);
+
+    _mm256_storeu_ps(output, vy01234567);
+    _mm256_storeu_ps(output + 8, vy89ABCDEF);
+    output += 16;
+  }
+  if (channels >= 8 * sizeof(float)) {
+    const __m256 vx = _mm256_loadu_ps(input);
+    input += 8;
+
+    const __m256 vscale = _mm256_load_ps(weights);
+    const __m256 vbias = _mm256_load_ps(weights + 16);
+    weights += 8;
+
+    const __m256 vnorm = _mm256_mul_ps(_mm256_sub_ps(vx, vmean), vinv_stddev);
+    const __m256 vy = _mm256_add_ps(_mm256_mul_ps(vnorm, vscale), vbias);
+
+    _mm256_storeu_ps(output, vy);
+    output += 8;
+    channels -= 8 * sizeof(float);
+  }
+  if XNN_UNLIKELY(channels != 0) {
+    assert(channels >= 1 * sizeof(float));
+    assert(channels <= 7 * sizeof(float));
+    const __m256i vmask = _mm256_loadu_si256((const __m256i*) ((uintptr_t) &params->avx.mask_table[7] - channels));
+
+    const __m256 vx = _mm256_maskload_ps(input, vmask);
+
+    const __m256 vscale = _mm256_load_ps(weights);
+    const __m256 vbias = _mm256_load_ps(weights + 16);
+
+    const __m256 vnorm = _mm256_mul_ps(_mm256_sub_ps(vx, vmean), vinv_stddev);
+    const __m256 vy = _mm256_add_ps(_mm256_mul_ps(vnorm, vscale), vbias);
+
+    _mm256_maskstore_ps(output, vmask, vy);
+  }
+}
+
 void xnn_f32_vrndd_ukernel__avx_x16(
     size_t n,
     const float* x,
@@ -4589,6 +8211,230 @@ void xnn_f32_vsqrt_ukernel__avx_sqrt_x8(
   }
 }
 
+void xnn_f32_vtanh_ukernel__avx_expm1minus_rr2_p6_div_x32(
+    size_t n,
+    const float* x,
+    float* y,
+    const union xnn_f32_tanh_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(n != 0);
+  assert(n % sizeof(float) == 0);
+  assert(x != NULL);
+  assert(y != NULL);
+
+  const __m256 vsign_mask = _mm256_load_ps(params->avx_expm1minus_rr2_p6.sign_mask);
+  const __m256 vsat_cutoff = _mm256_load_ps(params->avx_expm1minus_rr2_p6.sat_cutoff);
+  const __m256 vlog2e = _mm256_load_ps(params->avx_expm1minus_rr2_p6.log2e);
+  const __m256 vmagic_bias = _mm256_load_ps(params->avx_expm1minus_rr2_p6.magic_bias);
+  const __m256 vminus_ln2_hi = _mm256_load_ps(params->avx_expm1minus_rr2_p6.minus_ln2_hi);
+  const __m256 vminus_ln2_lo = _mm256_load_ps(params->avx_expm1minus_rr2_p6.minus_ln2_lo);
+  const __m256 vc6 = _mm256_load_ps(params->avx_expm1minus_rr2_p6.c6);
+  const __m256 vc5 = _mm256_load_ps(params->avx_expm1minus_rr2_p6.c5);
+  const __m256 vc4 = _mm256_load_ps(params->avx_expm1minus_rr2_p6.c4);
+  const __m256 vc3 = _mm256_load_ps(params->avx_expm1minus_rr2_p6.c3);
+  const __m256 vc2 = _mm256_load_ps(params->avx_expm1minus_rr2_p6.c2);
+  const __m256 vone = _mm256_load_ps(params->avx_expm1minus_rr2_p6.one);
+  const __m256 vminus_two = _mm256_load_ps(params->avx_expm1minus_rr2_p6.minus_two);
+
+  for (; n >= 32 * sizeof(float); n -= 32 * sizeof(float)) {
+    const __m256 vx0 = _mm256_loadu_ps(x);
+    const __m256 vx1 = _mm256_loadu_ps(x + 8);
+    const __m256 vx2 = _mm256_loadu_ps(x + 16);
+    const __m256 vx3 = _mm256_loadu_ps(x + 24);
+    x += 32;
+
+    __m256 vz0 = _mm256_or_ps(vx0, vsign_mask);
+    __m256 vz1 = _mm256_or_ps(vx1, vsign_mask);
+    __m256 vz2 = _mm256_or_ps(vx2, vsign_mask);
+    __m256 vz3 = _mm256_or_ps(vx3, vsign_mask);
+
+    vz0 = _mm256_max_ps(vsat_cutoff, _mm256_add_ps(vz0, vz0));
+    vz1 = _mm256_max_ps(vsat_cutoff, _mm256_add_ps(vz1, vz1));
+    vz2 = _mm256_max_ps(vsat_cutoff, _mm256_add_ps(vz2, vz2));
+    vz3 = _mm256_max_ps(vsat_cutoff, _mm256_add_ps(vz3, vz3));
+
+    __m256 vn0 = _mm256_add_ps(_mm256_mul_ps(vz0, vlog2e), vmagic_bias);
+    __m256 vn1 = _mm256_add_ps(_mm256_mul_ps(vz1, vlog2e), vmagic_bias);
+    __m256 vn2 = _mm256_add_ps(_mm256_mul_ps(vz2, vlog2e), vmagic_bias);
+    __m256 vn3 = _mm256_add_ps(_mm256_mul_ps(vz3, vlog2e), vmagic_bias);
+
+    const __m128 vs0_lo = _mm_castsi128_ps(_mm_slli_epi32(_mm_castps_si128(_mm256_castps256_ps128(vn0)), 23));
+    const __m128 vs0_hi = _mm_castsi128_ps(_mm_slli_epi32(_mm_castps_si128(_mm256_extractf128_ps(vn0, 1)), 23));
+    vn0 = _mm256_sub_ps(vn0, vmagic_bias);
+    const __m128 vs1_lo = _mm_castsi128_ps(_mm_slli_epi32(_mm_castps_si128(_mm256_castps256_ps128(vn1)), 23));
+    const __m128 vs1_hi = _mm_castsi128_ps(_mm_slli_epi32(_mm_castps_si128(_mm256_extractf128_ps(vn1, 1)), 23));
+    vn1 = _mm256_sub_ps(vn1, vmagic_bias);
+    const __m128 vs2_lo = _mm_castsi128_ps(_mm_slli_epi32(_mm_castps_si128(_mm256_castps256_ps128(vn2)), 23));
+    const __m128 vs2_hi = _mm_castsi128_ps(_mm_slli_epi32(_mm_castps_si128(_mm256_extractf128_ps(vn2, 1)), 23));
+    vn2 = _mm256_sub_ps(vn2, vmagic_bias);
+    const __m128 vs3_lo = _mm_castsi128_ps(_mm_slli_epi32(_mm_castps_si128(_mm256_castps256_ps128(vn3)), 23));
+    const __m128 vs3_hi = _mm_castsi128_ps(_mm_slli_epi32(_mm_castps_si128(_mm256_extractf128_ps(vn3, 1)), 23));
+    vn3 = _mm256_sub_ps(vn3, vmagic_bias);
+
+    __m256 vt0 = _mm256_add_ps(_mm256_mul_ps(vn0, vminus_ln2_hi), vz0);
+    const __m256 vs0 = _mm256_insertf128_ps(_mm256_castps128_ps256(vs0_lo), vs0_hi, 1);
+    __m256 vt1 = _mm256_add_ps(_mm256_mul_ps(vn1, vminus_ln2_hi), vz1);
+    const __m256 vs1 = _mm256_insertf128_ps(_mm256_castps128_ps256(vs1_lo), vs1_hi, 1);
+    __m256 vt2 = _mm256_add_ps(_mm256_mul_ps(vn2, vminus_ln2_hi), vz2);
+    const __m256 vs2 = _mm256_insertf128_ps(_mm256_castps128_ps256(vs2_lo), vs2_hi, 1);
+    __m256 vt3 = _mm256_add_ps(_mm256_mul_ps(vn3, vminus_ln2_hi), vz3);
+    const __m256 vs3 = _mm256_insertf128_ps(_mm256_castps128_ps256(vs3_lo), vs3_hi, 1);
+
+    vt0 = _mm256_add_ps(_mm256_mul_ps(vn0, vminus_ln2_lo), vt0);
+    vt1 = _mm256_add_ps(_mm256_mul_ps(vn1, vminus_ln2_lo), vt1);
+    vt2 = _mm256_add_ps(_mm256_mul_ps(vn2, vminus_ln2_lo), vt2);
+    vt3 = _mm256_add_ps(_mm256_mul_ps(vn3, vminus_ln2_lo), vt3);
+
+    __m256 vp0 = _mm256_add_ps(_mm256_mul_ps(vc6, vt0), vc5);
+    __m256 vp1 = _mm256_add_ps(_mm256_mul_ps(vc6, vt1), vc5);
+    __m256 vp2 = _mm256_add_ps(_mm256_mul_ps(vc6, vt2), vc5);
+    __m256 vp3 = _mm256_add_ps(_mm256_mul_ps(vc6, vt3), vc5);
+
+    vp0 = _mm256_add_ps(_mm256_mul_ps(vp0, vt0), vc4);
+    vp1 = _mm256_add_ps(_mm256_mul_ps(vp1, vt1), vc4);
+    vp2 = _mm256_add_ps(_mm256_mul_ps(vp2, vt2), vc4);
+    vp3 = _mm256_add_ps(_mm256_mul_ps(vp3, vt3), vc4);
+
+    vp0 = _mm256_add_ps(_mm256_mul_ps(vp0, vt0), vc3);
+    vp1 = _mm256_add_ps(_mm256_mul_ps(vp1, vt1), vc3);
+    vp2 = _mm256_add_ps(_mm256_mul_ps(vp2, vt2), vc3);
+    vp3 = _mm256_add_ps(_mm256_mul_ps(vp3, vt3), vc3);
+
+    vp0 = _mm256_add_ps(_mm256_mul_ps(vp0, vt0), vc2);
+    vp1 = _mm256_add_ps(_mm256_mul_ps(vp1, vt1), vc2);
+    vp2 = _mm256_add_ps(_mm256_mul_ps(vp2, vt2), vc2);
+    vp3 = _mm256_add_ps(_mm256_mul_ps(vp3, vt3), vc2);
+
+    vp0 = _mm256_mul_ps(vp0, vt0);
+    vp1 = _mm256_mul_ps(vp1, vt1);
+    vp2 = _mm256_mul_ps(vp2, vt2);
+    vp3 = _mm256_mul_ps(vp3, vt3);
+
+    vt0 = _mm256_mul_ps(vt0, vs0);
+    const __m256 vsm10 = _mm256_sub_ps(vs0, vone);
+    vt1 = _mm256_mul_ps(vt1, vs1);
+    const __m256 vsm11 = _mm256_sub_ps(vs1, vone);
+    vt2 = _mm256_mul_ps(vt2, vs2);
+    const __m256 vsm12 = _mm256_sub_ps(vs2, vone);
+    vt3 = _mm256_mul_ps(vt3, vs3);
+    const __m256 vsm13 = _mm256_sub_ps(vs3, vone);
+
+    vp0 = _mm256_add_ps(_mm256_mul_ps(vp0, vt0), vt0);
+    vp1 = _mm256_add_ps(_mm256_mul_ps(vp1, vt1), vt1);
+    vp2 = _mm256_add_ps(_mm256_mul_ps(vp2, vt2), vt2);
+    vp3 = _mm256_add_ps(_mm256_mul_ps(vp3, vt3), vt3);
+
+    const __m256 vemo0 = _mm256_add_ps(vp0, vsm10);
+    const __m256 vemo1 = _mm256_add_ps(vp1, vsm11);
+    const __m256 vemo2 = _mm256_add_ps(vp2, vsm12);
+    const __m256 vemo3 = _mm256_add_ps(vp3, vsm13);
+
+    const __m256 vepo0 = _mm256_sub_ps(vemo0, vminus_two);
+    const __m256 vepo1 = _mm256_sub_ps(vemo1, vminus_two);
+    const __m256 vepo2 = _mm256_sub_ps(vemo2, vminus_two);
+    const __m256 vepo3 = _mm256_sub_ps(vemo3, vminus_two);
+
+    __m256 vy0 = _mm256_div_ps(vemo0, vepo0);
+    __m256 vy1 = _mm256_div_ps(vemo1, vepo1);
+    __m256 vy2 = _mm256_div_ps(vemo2, vepo2);
+    __m256 vy3 = _mm256_div_ps(vemo3, vepo3);
+
+    vy0 = _mm256_or_ps(_mm256_andnot_ps(vsign_mask, vy0), _mm256_and_ps(vsign_mask, vx0));
+    vy1 = _mm256_or_ps(_mm256_andnot_ps(vsign_mask, vy1), _mm256_and_ps(vsign_mask, vx1));
+    vy2 = _mm256_or_ps(_mm256_andnot_ps(vsign_mask, vy2), _mm256_and_ps(vsign_mask, vx2));
+    vy3 = _mm256_or_ps(_mm256_andnot_ps(vsign_mask, vy3), _mm256_and_ps(vsign_mask, vx3));
+
+    _mm256_storeu_ps(y, vy0);
+    _mm256_storeu_ps(y + 8, vy1);
+    _mm256_storeu_ps(y + 16, vy2);
+    _mm256_storeu_ps(y + 24, vy3);
+    y += 32;
+  }
+  for (; n >= 8 * sizeof(float); n -= 8 * sizeof(float)) {
+    const __m256 vx = _mm256_loadu_ps(x);
+    x += 8;
+
+    __m256 vz = _mm256_or_ps(vx, vsign_mask);
+    vz = _mm256_max_ps(vsat_cutoff, _mm256_add_ps(vz, vz));
+
+    __m256 vn = _mm256_add_ps(_mm256_mul_ps(vz, vlog2e), vmagic_bias);
+    const __m128 vs_lo = _mm_castsi128_ps(_mm_slli_epi32(_mm_castps_si128(_mm256_castps256_ps128(vn)), 23));
+    const __m128 vs_hi = _mm_castsi128_ps(_mm_slli_epi32(_mm_castps_si128(_mm256_extractf128_ps(vn, 1)), 23));
+    vn = _mm256_sub_ps(vn, vmagic_bias);
+
+    __m256 vt = _mm256_add_ps(_mm256_mul_ps(vn, vminus_ln2_hi), vz);
+    const __m256 vs = _mm256_insertf128_ps(_mm256_castps128_ps256(vs_lo), vs_hi, 1);
+    vt = _mm256_add_ps(_mm256_mul_ps(vn, vminus_ln2_lo), vt);
+
+    __m256 vp = _mm256_add_ps(_mm256_mul_ps(vc6, vt), vc5);
+    vp = _mm256_add_ps(_mm256_mul_ps(vp, vt), vc4);
+    vp = _mm256_add_ps(_mm256_mul_ps(vp, vt), vc3);
+    vp = _mm256_add_ps(_mm256_mul_ps(vp, vt), vc2);
+    vp = _mm256_mul_ps(vp, vt);
+
+    vt = _mm256_mul_ps(vt, vs);
+    const __m256 vsm1 = _mm256_sub_ps(vs, vone);
+    vp = _mm256_add_ps(_mm256_mul_ps(vp, vt), vt);
+    const __m256 vemo = _mm256_add_ps(vp, vsm1);
+    const __m256 vepo = _mm256_sub_ps(vemo, vminus_two);
+
+    __m256 vy = _mm256_div_ps(vemo, vepo);
+    vy = _mm256_or_ps(_mm256_andnot_ps(vsign_mask, vy), _mm256_and_ps(vsign_mask, vx));
+
+    _mm256_storeu_ps(y, vy);
+    y += 8;
+  }
+  if XNN_UNLIKELY(n != 0) {
+    assert(n >= 1 * sizeof(float));
+    assert(n <= 7 * sizeof(float));
+    const __m256i vmask = _mm256_loadu_si256((const __m256i*) ((uintptr_t) &params->avx_expm1minus_rr2_p6.mask_table[7] - n));
+
+    const __m256 vx = _mm256_maskload_ps(x, vmask);
+
+    __m256 vz = _mm256_or_ps(vx, vsign_mask);
+    vz = _mm256_max_ps(vsat_cutoff, _mm256_add_ps(vz, vz));
+
+    __m256 vn = _mm256_add_ps(_mm256_mul_ps(vz, vlog2e), vmagic_bias);
+    const __m128 vs_lo = _mm_castsi128_ps(_mm_slli_epi32(_mm_castps_si128(_mm256_castps256_ps128(vn)), 23));
+    const __m128 vs_hi = _mm_castsi128_ps(_mm_slli_epi32(_mm_castps_si128(_mm256_extractf128_ps(vn, 1)), 23));
+    vn = _mm256_sub_ps(vn, vmagic_bias);
+
+    __m256 vt = _mm256_add_ps(_mm256_mul_ps(vn, vminus_ln2_hi), vz);
+    const __m256 vs = _mm256_insertf128_ps(_mm256_castps128_ps256(vs_lo), vs_hi, 1);
+    vt = _mm256_add_ps(_mm256_mul_ps(vn, vminus_ln2_lo), vt);
+
+    __m256 vp = _mm256_add_ps(_mm256_mul_ps(vc6, vt), vc5);
+    vp = _mm256_add_ps(_mm256_mul_ps(vp, vt), vc4);
+    vp = _mm256_add_ps(_mm256_mul_ps(vp, vt), vc3);
+    vp = _mm256_add_ps(_mm256_mul_ps(vp, vt), vc2);
+    vp = _mm256_mul_ps(vp, vt);
+
+    vt = _mm256_mul_ps(vt, vs);
+    const __m256 vsm1 = _mm256_sub_ps(vs, vone);
+    vp = _mm256_add_ps(_mm256_mul_ps(vp, vt), vt);
+    const __m256 vemo = _mm256_add_ps(vp, vsm1);
+    const __m256 vepo = _mm256_sub_ps(vemo, vminus_two);
+
+    __m256 vy = _mm256_div_ps(vemo, vepo);
+    vy = _mm256_or_ps(_mm256_andnot_ps(vsign_mask, vy), _mm256_and_ps(vsign_mask, vx));
+
+    __m128 vy_lo = _mm256_castps256_ps128(vy);
+    if (n & (4 * sizeof(float))) {
+      _mm_storeu_ps(y, vy_lo);
+      vy_lo = _mm256_extractf128_ps(vy, 1);
+      y += 4;
+    }
+    if (n & (2 * sizeof(float))) {
+      _mm_storel_pi((__m64*) y, vy_lo);
+      vy_lo = _mm_movehl_ps(vy_lo, vy_lo);
+      y += 2;
+    }
+    if (n & (1 * sizeof(float))) {
+      _mm_store_ss(y, vy_lo);
+    }
+  }
+}
+
 void xnn_f32_vabs_ukernel__avx_x16(
     size_t n,
     const float* x,
@@ -19,6 +19,622 @@
 #include <xnnpack/vunary.h>
 
 
+void xnn_f16_gemm_minmax_ukernel_1x16__avx2_broadcast(
+    size_t mr,
+    size_t nc,
+    size_t kc,
+    const void*restrict a,
+    size_t a_stride,
+    const void*restrict w,
+    void*restrict c,
+    size_t cm_stride,
+    size_t cn_stride,
+    const union xnn_f16_scaleminmax_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(mr != 0);
+  assert(mr <= 1);
+  assert(nc != 0);
+  assert(kc != 0);
+  assert(kc % sizeof(uint16_t) == 0);
+  assert(a != NULL);
+  assert(w != NULL);
+  assert(c != NULL);
+
+  const uint16_t* a0 = a;
+  uint16_t* c0 = c;
+
+  do {
+    __m256 vacc0x01234567 = _mm256_cvtph_ps(_mm_load_si128((const __m128i*) w));
+    __m256 vacc0x89ABCDEF = _mm256_cvtph_ps(_mm_load_si128((const __m128i*) ((const uint16_t*) w + 8)));
+    w = (const uint16_t*) w + 16;
+
+    size_t k = kc;
+    do {
+      const __m256 va0 = _mm256_cvtph_ps(_mm_set1_epi16((short) *a0));
+      a0 += 1;
+
+      const __m256 vb01234567 = _mm256_cvtph_ps(_mm_load_si128((const __m128i*) w));
+      const __m256 vb89ABCDEF = _mm256_cvtph_ps(_mm_load_si128((const __m128i*) ((const uint16_t*) w + 8)));
+      w = (const uint16_t*) w + 16;
+
+      vacc0x01234567 = _mm256_cvtph_ps(_mm256_cvtps_ph(_mm256_fmadd_ps(va0, vb01234567, vacc0x01234567), _MM_FROUND_NO_EXC));
+      vacc0x89ABCDEF = _mm256_cvtph_ps(_mm256_cvtps_ph(_mm256_fmadd_ps(va0, vb89ABCDEF, vacc0x89ABCDEF), _MM_FROUND_NO_EXC));
+
+      k -= sizeof(uint16_t);
+    } while (k != 0);
+
+    const __m256 vscale = _mm256_load_ps(params->avx.scale);
+    vacc0x01234567 = _mm256_cvtph_ps(_mm256_cvtps_ph(_mm256_mul_ps(vacc0x01234567, vscale), _MM_FROUND_NO_EXC));
+    vacc0x89ABCDEF = _mm256_cvtph_ps(_mm256_cvtps_ph(_mm256_mul_ps(vacc0x89ABCDEF, vscale), _MM_FROUND_NO_EXC));
+
+    const __m256 vmin = _mm256_load_ps(params->avx.min);
+    vacc0x01234567 = _mm256_max_ps(vacc0x01234567, vmin);
+    vacc0x89ABCDEF = _mm256_max_ps(vacc0x89ABCDEF, vmin);
+
+    const __m256 vmax = _mm256_load_ps(params->avx.max);
+    vacc0x01234567 = _mm256_min_ps(vacc0x01234567, vmax);
+    vacc0x89ABCDEF = _mm256_min_ps(vacc0x89ABCDEF, vmax);
+
+    if XNN_LIKELY(nc >= 16) {
+      _mm_storeu_si128((__m128i*) c0, _mm256_cvtps_ph(vacc0x01234567, _MM_FROUND_NO_EXC));
+      _mm_storeu_si128((__m128i*) (c0 + 8), _mm256_cvtps_ph(vacc0x89ABCDEF, _MM_FROUND_NO_EXC));
+      c0 = (uint16_t*) ((uintptr_t) c0 + cn_stride);
+
+      a0 = (const uint16_t*) ((uintptr_t) a0 - kc);
+
+      nc -= 16;
+    } else {
+      __m128i vh0x01234567 = _mm256_cvtps_ph(vacc0x01234567, _MM_FROUND_NO_EXC);
+      if (nc & 8) {
+        _mm_storeu_si128((__m128i*) c0, vh0x01234567);
+
+        vh0x01234567 = _mm256_cvtps_ph(vacc0x89ABCDEF, _MM_FROUND_NO_EXC);
+
+        c0 += 8;
+      }
+      if (nc & 4) {
+        _mm_storel_epi64((__m128i*) c0, vh0x01234567);
+
+        vh0x01234567 = _mm_unpackhi_epi64(vh0x01234567, vh0x01234567);
+
+        c0 += 4;
+      }
+      if (nc & 2) {
+        _mm_storeu_si32(c0, vh0x01234567);
+
+        vh0x01234567 = _mm_srli_epi64(vh0x01234567, 32);
+
+        c0 += 2;
+      }
+      if (nc & 1) {
+        *c0 = (uint16_t) _mm_extract_epi16(vh0x01234567, 0);
+      }
+
+      nc = 0;
+    }
+  } while (nc != 0);
+}
+
+void xnn_f16_gemm_minmax_ukernel_4x16__avx2_broadcast(
+    size_t mr,
+    size_t nc,
+    size_t kc,
+    const void*restrict a,
+    size_t a_stride,
+    const void*restrict w,
+    void*restrict c,
+    size_t cm_stride,
+    size_t cn_stride,
+    const union xnn_f16_scaleminmax_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(mr != 0);
+  assert(mr <= 4);
+  assert(nc != 0);
+  assert(kc != 0);
+  assert(kc % sizeof(uint16_t) == 0);
+  assert(a != NULL);
+  assert(w != NULL);
+  assert(c != NULL);
+
+  const uint16_t* a0 = a;
+  uint16_t* c0 = c;
+  const uint16_t* a1 = (const uint16_t*) ((uintptr_t) a0 + a_stride);
+  uint16_t* c1 = (uint16_t*) ((uintptr_t) c0 + cm_stride);
+  if XNN_UNPREDICTABLE(mr < 2) {
+    a1 = a0;
+    c1 = c0;
+  }
+  const uint16_t* a2 = (const uint16_t*) ((uintptr_t) a1 + a_stride);
+  uint16_t* c2 = (uint16_t*) ((uintptr_t) c1 + cm_stride);
+  if XNN_UNPREDICTABLE(mr <= 2) {
+    a2 = a1;
+    c2 = c1;
+  }
+  const uint16_t* a3 = (const uint16_t*) ((uintptr_t) a2 + a_stride);
+  uint16_t* c3 = (uint16_t*) ((uintptr_t) c2 + cm_stride);
+  if XNN_UNPREDICTABLE(mr != 4) {
+    a3 = a2;
+    c3 = c2;
+  }
+
+  do {
+    __m256 vacc0x01234567 = _mm256_cvtph_ps(_mm_load_si128((const __m128i*) w));
+    __m256 vacc0x89ABCDEF = _mm256_cvtph_ps(_mm_load_si128((const __m128i*) ((const uint16_t*) w + 8)));
+    __m256 vacc1x01234567 = vacc0x01234567;
+    __m256 vacc1x89ABCDEF = vacc0x89ABCDEF;
+    __m256 vacc2x01234567 = vacc0x01234567;
+    __m256 vacc2x89ABCDEF = vacc0x89ABCDEF;
+    __m256 vacc3x01234567 = vacc0x01234567;
+    __m256 vacc3x89ABCDEF = vacc0x89ABCDEF;
+    w = (const uint16_t*) w + 16;
+
+    size_t k = kc;
+    do {
+      const __m256 va0 = _mm256_cvtph_ps(_mm_set1_epi16((short) *a0));
+      a0 += 1;
+      const __m256 va1 = _mm256_cvtph_ps(_mm_set1_epi16((short) *a1));
+      a1 += 1;
+      const __m256 va2 = _mm256_cvtph_ps(_mm_set1_epi16((short) *a2));
+      a2 += 1;
+      const __m256 va3 = _mm256_cvtph_ps(_mm_set1_epi16((short) *a3));
+      a3 += 1;
+
+      const __m256 vb01234567 = _mm256_cvtph_ps(_mm_load_si128((const __m128i*) w));
+      const __m256 vb89ABCDEF = _mm256_cvtph_ps(_mm_load_si128((const __m128i*) ((const uint16_t*) w + 8)));
+      w = (const uint16_t*) w + 16;
+
+      vacc0x01234567 = _mm256_cvtph_ps(_mm256_cvtps_ph(_mm256_fmadd_ps(va0, vb01234567, vacc0x01234567), _MM_FROUND_NO_EXC));
+      vacc1x01234567 = _mm256_cvtph_ps(_mm256_cvtps_ph(_mm256_fmadd_ps(va1, vb01234567, vacc1x01234567), _MM_FROUND_NO_EXC));
+      vacc2x01234567 = _mm256_cvtph_ps(_mm256_cvtps_ph(_mm256_fmadd_ps(va2, vb01234567, vacc2x01234567), _MM_FROUND_NO_EXC));
+      vacc3x01234567 = _mm256_cvtph_ps(_mm256_cvtps_ph(_mm256_fmadd_ps(va3, vb01234567, vacc3x01234567), _MM_FROUND_NO_EXC));
+      vacc0x89ABCDEF = _mm256_cvtph_ps(_mm256_cvtps_ph(_mm256_fmadd_ps(va0, vb89ABCDEF, vacc0x89ABCDEF), _MM_FROUND_NO_EXC));
+      vacc1x89ABCDEF = _mm256_cvtph_ps(_mm256_cvtps_ph(_mm256_fmadd_ps(va1, vb89ABCDEF, vacc1x89ABCDEF), _MM_FROUND_NO_EXC));
+      vacc2x89ABCDEF = _mm256_cvtph_ps(_mm256_cvtps_ph(_mm256_fmadd_ps(va2, vb89ABCDEF, vacc2x89ABCDEF), _MM_FROUND_NO_EXC));
+      vacc3x89ABCDEF = _mm256_cvtph_ps(_mm256_cvtps_ph(_mm256_fmadd_ps(va3, vb89ABCDEF, vacc3x89ABCDEF), _MM_FROUND_NO_EXC));
+
+      k -= sizeof(uint16_t);
+    } while (k != 0);
+
+    const __m256 vscale = _mm256_load_ps(params->avx.scale);
+    vacc0x01234567 = _mm256_cvtph_ps(_mm256_cvtps_ph(_mm256_mul_ps(vacc0x01234567, vscale), _MM_FROUND_NO_EXC));
+    vacc1x01234567 = _mm256_cvtph_ps(_mm256_cvtps_ph(_mm256_mul_ps(vacc1x01234567, vscale), _MM_FROUND_NO_EXC));
+    vacc2x01234567 = _mm256_cvtph_ps(_mm256_cvtps_ph(_mm256_mul_ps(vacc2x01234567, vscale), _MM_FROUND_NO_EXC));
+    vacc3x01234567 = _mm256_cvtph_ps(_mm256_cvtps_ph(_mm256_mul_ps(vacc3x01234567, vscale), _MM_FROUND_NO_EXC));
+    vacc0x89ABCDEF = _mm256_cvtph_ps(_mm256_cvtps_ph(_mm256_mul_ps(vacc0x89ABCDEF, vscale), _MM_FROUND_NO_EXC));
+    vacc1x89ABCDEF = _mm256_cvtph_ps(_mm256_cvtps_ph(_mm256_mul_ps(vacc1x89ABCDEF, vscale), _MM_FROUND_NO_EXC));
+    vacc2x89ABCDEF = _mm256_cvtph_ps(_mm256_cvtps_ph(_mm256_mul_ps(vacc2x89ABCDEF, vscale), _MM_FROUND_NO_EXC));
+    vacc3x89ABCDEF = _mm256_cvtph_ps(_mm256_cvtps_ph(_mm256_mul_ps(vacc3x89ABCDEF, vscale), _MM_FROUND_NO_EXC));
+
+    const __m256 vmin = _mm256_load_ps(params->avx.min);
+    vacc0x01234567 = _mm256_max_ps(vacc0x01234567, vmin);
+    vacc1x01234567 = _mm256_max_ps(vacc1x01234567, vmin);
+    vacc2x01234567 = _mm256_max_ps(vacc2x01234567, vmin);
+    vacc3x01234567 = _mm256_max_ps(vacc3x01234567, vmin);
+    vacc0x89ABCDEF = _mm256_max_ps(vacc0x89ABCDEF, vmin);
+    vacc1x89ABCDEF = _mm256_max_ps(vacc1x89ABCDEF, vmin);
+    vacc2x89ABCDEF = _mm256_max_ps(vacc2x89ABCDEF, vmin);
+    vacc3x89ABCDEF = _mm256_max_ps(vacc3x89ABCDEF, vmin);
+
+    const __m256 vmax = _mm256_load_ps(params->avx.max);
+    vacc0x01234567 = _mm256_min_ps(vacc0x01234567, vmax);
+    vacc1x01234567 = _mm256_min_ps(vacc1x01234567, vmax);
+    vacc2x01234567 = _mm256_min_ps(vacc2x01234567, vmax);
+    vacc3x01234567 = _mm256_min_ps(vacc3x01234567, vmax);
+    vacc0x89ABCDEF = _mm256_min_ps(vacc0x89ABCDEF, vmax);
+    vacc1x89ABCDEF = _mm256_min_ps(vacc1x89ABCDEF, vmax);
+    vacc2x89ABCDEF = _mm256_min_ps(vacc2x89ABCDEF, vmax);
+    vacc3x89ABCDEF = _mm256_min_ps(vacc3x89ABCDEF, vmax);
+
+    if XNN_LIKELY(nc >= 16) {
+      _mm_storeu_si128((__m128i*) c3, _mm256_cvtps_ph(vacc3x01234567, _MM_FROUND_NO_EXC));
+      _mm_storeu_si128((__m128i*) (c3 + 8), _mm256_cvtps_ph(vacc3x89ABCDEF, _MM_FROUND_NO_EXC));
+      c3 = (uint16_t*) ((uintptr_t) c3 + cn_stride);
+      _mm_storeu_si128((__m128i*) c2, _mm256_cvtps_ph(vacc2x01234567, _MM_FROUND_NO_EXC));
+      _mm_storeu_si128((__m128i*) (c2 + 8), _mm256_cvtps_ph(vacc2x89ABCDEF, _MM_FROUND_NO_EXC));
+      c2 = (uint16_t*) ((uintptr_t) c2 + cn_stride);
+      _mm_storeu_si128((__m128i*) c1, _mm256_cvtps_ph(vacc1x01234567, _MM_FROUND_NO_EXC));
+      _mm_storeu_si128((__m128i*) (c1 + 8), _mm256_cvtps_ph(vacc1x89ABCDEF, _MM_FROUND_NO_EXC));
+      c1 = (uint16_t*) ((uintptr_t) c1 + cn_stride);
+      _mm_storeu_si128((__m128i*) c0, _mm256_cvtps_ph(vacc0x01234567, _MM_FROUND_NO_EXC));
+      _mm_storeu_si128((__m128i*) (c0 + 8), _mm256_cvtps_ph(vacc0x89ABCDEF, _MM_FROUND_NO_EXC));
+      c0 = (uint16_t*) ((uintptr_t) c0 + cn_stride);
+
+      a3 = (const uint16_t*) ((uintptr_t) a3 - kc);
+      a2 = (const uint16_t*) ((uintptr_t) a2 - kc);
+      a1 = (const uint16_t*) ((uintptr_t) a1 - kc);
+      a0 = (const uint16_t*) ((uintptr_t) a0 - kc);
+
+      nc -= 16;
+    } else {
+      __m128i vh3x01234567 = _mm256_cvtps_ph(vacc3x01234567, _MM_FROUND_NO_EXC);
+      __m128i vh2x01234567 = _mm256_cvtps_ph(vacc2x01234567, _MM_FROUND_NO_EXC);
+      __m128i vh1x01234567 = _mm256_cvtps_ph(vacc1x01234567, _MM_FROUND_NO_EXC);
+      __m128i vh0x01234567 = _mm256_cvtps_ph(vacc0x01234567, _MM_FROUND_NO_EXC);
+      if (nc & 8) {
+        _mm_storeu_si128((__m128i*) c3, vh3x01234567);
+        _mm_storeu_si128((__m128i*) c2, vh2x01234567);
+        _mm_storeu_si128((__m128i*) c1, vh1x01234567);
+        _mm_storeu_si128((__m128i*) c0, vh0x01234567);
+
+        vh3x01234567 = _mm256_cvtps_ph(vacc3x89ABCDEF, _MM_FROUND_NO_EXC);
+        vh2x01234567 = _mm256_cvtps_ph(vacc2x89ABCDEF, _MM_FROUND_NO_EXC);
+        vh1x01234567 = _mm256_cvtps_ph(vacc1x89ABCDEF, _MM_FROUND_NO_EXC);
+        vh0x01234567 = _mm256_cvtps_ph(vacc0x89ABCDEF, _MM_FROUND_NO_EXC);
+
+        c3 += 8;
+        c2 += 8;
+        c1 += 8;
+        c0 += 8;
+      }
+      if (nc & 4) {
+        _mm_storel_epi64((__m128i*) c3, vh3x01234567);
+        _mm_storel_epi64((__m128i*) c2, vh2x01234567);
+        _mm_storel_epi64((__m128i*) c1, vh1x01234567);
+        _mm_storel_epi64((__m128i*) c0, vh0x01234567);
+
+        vh3x01234567 = _mm_unpackhi_epi64(vh3x01234567, vh3x01234567);
+        vh2x01234567 = _mm_unpackhi_epi64(vh2x01234567, vh2x01234567);
+        vh1x01234567 = _mm_unpackhi_epi64(vh1x01234567, vh1x01234567);
+        vh0x01234567 = _mm_unpackhi_epi64(vh0x01234567, vh0x01234567);
+
+        c3 += 4;
+        c2 += 4;
+        c1 += 4;
+        c0 += 4;
+      }
+      if (nc & 2) {
+        _mm_storeu_si32(c3, vh3x01234567);
+        _mm_storeu_si32(c2, vh2x01234567);
+        _mm_storeu_si32(c1, vh1x01234567);
+        _mm_storeu_si32(c0, vh0x01234567);
+
+        vh3x01234567 = _mm_srli_epi64(vh3x01234567, 32);
+        vh2x01234567 = _mm_srli_epi64(vh2x01234567, 32);
+        vh1x01234567 = _mm_srli_epi64(vh1x01234567, 32);
+        vh0x01234567 = _mm_srli_epi64(vh0x01234567, 32);
+
+        c3 += 2;
+        c2 += 2;
+        c1 += 2;
+        c0 += 2;
+      }
+      if (nc & 1) {
+        *c3 = (uint16_t) _mm_extract_epi16(vh3x01234567, 0);
+        *c2 = (uint16_t) _mm_extract_epi16(vh2x01234567, 0);
+        *c1 = (uint16_t) _mm_extract_epi16(vh1x01234567, 0);
+        *c0 = (uint16_t) _mm_extract_epi16(vh0x01234567, 0);
+      }
+
+      nc = 0;
+    }
+  } while (nc != 0);
+}
+
+void xnn_f16_igemm_minmax_ukernel_1x16__avx2_broadcast(
+    size_t mr,
+    size_t nc,
+    size_t kc,
+    size_t ks,
+    const void**restrict a,
+    const void*restrict w,
+    void*restrict c,
+    size_t cm_stride,
+    size_t cn_stride,
+    size_t a_offset,
+    const void* zero,
+    const union xnn_f16_scaleminmax_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(mr != 0);
+  assert(mr <= 1);
+  assert(nc != 0);
+  assert(kc != 0);
+  assert(kc % sizeof(uint16_t) == 0);
+  assert(ks != 0);
+  assert(ks % (1 * sizeof(void*)) == 0);
+  assert(a_offset % sizeof(uint16_t) == 0);
+  assert(a != NULL);
+  assert(w != NULL);
+  assert(c != NULL);
+
+  uint16_t* c0 = c;
+
+  do {
+    __m256 vacc0x01234567 = _mm256_cvtph_ps(_mm_load_si128((const __m128i*) w));
+    __m256 vacc0x89ABCDEF = _mm256_cvtph_ps(_mm_load_si128((const __m128i*) ((const uint16_t*) w + 8)));
+    w = (const uint16_t*) w + 16;
+
+    size_t p = ks;
+    do {
+      const uint16_t* restrict a0 = (const uint16_t*) a[0];
+      assert(a0 != NULL);
+      if XNN_UNPREDICTABLE(a0 != zero) {
+        a0 = (const uint16_t*) ((uintptr_t) a0 + a_offset);
+      }
+      a += 1;
+
+      size_t k = kc;
+      do {
+        const __m256 vb01234567 = _mm256_cvtph_ps(_mm_load_si128((const __m128i*) w));
+        const __m256 vb89ABCDEF = _mm256_cvtph_ps(_mm_load_si128((const __m128i*) ((const uint16_t*) w + 8)));
+        w = (const uint16_t*) w + 16;
+
+        const __m256 va0 = _mm256_cvtph_ps(_mm_set1_epi16((short) *a0));
+        a0 += 1;
+
+        vacc0x01234567 = _mm256_cvtph_ps(_mm256_cvtps_ph(_mm256_fmadd_ps(va0, vb01234567, vacc0x01234567), _MM_FROUND_NO_EXC));
+        vacc0x89ABCDEF = _mm256_cvtph_ps(_mm256_cvtps_ph(_mm256_fmadd_ps(va0, vb89ABCDEF, vacc0x89ABCDEF), _MM_FROUND_NO_EXC));
+
+        k -= sizeof(uint16_t);
+      } while (k != 0);
+      p -= 1 * sizeof(void*);
+    } while (p != 0);
+
+    const __m256 vscale = _mm256_load_ps(params->avx.scale);
+    vacc0x01234567 = _mm256_cvtph_ps(_mm256_cvtps_ph(_mm256_mul_ps(vacc0x01234567, vscale), _MM_FROUND_NO_EXC));
+    vacc0x89ABCDEF = _mm256_cvtph_ps(_mm256_cvtps_ph(_mm256_mul_ps(vacc0x89ABCDEF, vscale), _MM_FROUND_NO_EXC));
+
+    const __m256 vmin = _mm256_load_ps(params->avx.min);
+    vacc0x01234567 = _mm256_max_ps(vacc0x01234567, vmin);
+    vacc0x89ABCDEF = _mm256_max_ps(vacc0x89ABCDEF, vmin);
+
+    const __m256 vmax = _mm256_load_ps(params->avx.max);
+    vacc0x01234567 = _mm256_min_ps(vacc0x01234567, vmax);
+    vacc0x89ABCDEF = _mm256_min_ps(vacc0x89ABCDEF, vmax);
+
+    if XNN_LIKELY(nc >= 16) {
+      _mm_storeu_si128((__m128i*) c0, _mm256_cvtps_ph(vacc0x01234567, _MM_FROUND_NO_EXC));
+      _mm_storeu_si128((__m128i*) (c0 + 8), _mm256_cvtps_ph(vacc0x89ABCDEF, _MM_FROUND_NO_EXC));
+      c0 = (uint16_t*) ((uintptr_t) c0 + cn_stride);
+
+      a = (const void**restrict) ((uintptr_t) a - ks);
+      nc -= 16;
+    } else {
+      __m128i vh0x01234567 = _mm256_cvtps_ph(vacc0x01234567, _MM_FROUND_NO_EXC);
+      if (nc & 8) {
+        _mm_storeu_si128((__m128i*) c0, vh0x01234567);
+
+        vh0x01234567 = _mm256_cvtps_ph(vacc0x89ABCDEF, _MM_FROUND_NO_EXC);
+
+        c0 += 8;
+      }
+      if (nc & 4) {
+        _mm_storel_epi64((__m128i*) c0, vh0x01234567);
+
+        vh0x01234567 = _mm_unpackhi_epi64(vh0x01234567, vh0x01234567);
+
+        c0 += 4;
+      }
+      if (nc & 2) {
+        _mm_storeu_si32(c0, vh0x01234567);
+
+        vh0x01234567 = _mm_srli_epi64(vh0x01234567, 32);
+
+        c0 += 2;
+      }
+      if (nc & 1) {
+        *c0 = _mm_extract_epi16(vh0x01234567, 0);
+      }
+
+      nc = 0;
+    }
+  } while (nc != 0);
+}
+
+void xnn_f16_igemm_minmax_ukernel_4x16__avx2_broadcast(
+    size_t mr,
+    size_t nc,
+    size_t kc,
+    size_t ks,
+    const void**restrict a,
+    const void*restrict w,
+    void*restrict c,
+    size_t cm_stride,
+    size_t cn_stride,
+    size_t a_offset,
+    const void* zero,
+    const union xnn_f16_scaleminmax_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(mr != 0);
+  assert(mr <= 4);
+  assert(nc != 0);
+  assert(kc != 0);
+  assert(kc % sizeof(uint16_t) == 0);
+  assert(ks != 0);
+  assert(ks % (4 * sizeof(void*)) == 0);
+  assert(a_offset % sizeof(uint16_t) == 0);
+  assert(a != NULL);
+  assert(w != NULL);
+  assert(c != NULL);
+
+  uint16_t* c0 = c;
+  uint16_t* c1 = (uint16_t*) ((uintptr_t) c0 + cm_stride);
+  if XNN_UNPREDICTABLE(mr < 2) {
+    c1 = c0;
+  }
+  uint16_t* c2 = (uint16_t*) ((uintptr_t) c1 + cm_stride);
+  if XNN_UNPREDICTABLE(mr <= 2) {
+    c2 = c1;
+  }
+  uint16_t* c3 = (uint16_t*) ((uintptr_t) c2 + cm_stride);
+  if XNN_UNPREDICTABLE(mr != 4) {
+    c3 = c2;
+  }
+
+  do {
+    __m256 vacc0x01234567 = _mm256_cvtph_ps(_mm_load_si128((const __m128i*) w));
+    __m256 vacc0x89ABCDEF = _mm256_cvtph_ps(_mm_load_si128((const __m128i*) ((const uint16_t*) w + 8)));
+    __m256 vacc1x01234567 = vacc0x01234567;
+    __m256 vacc1x89ABCDEF = vacc0x89ABCDEF;
+    __m256 vacc2x01234567 = vacc0x01234567;
+    __m256 vacc2x89ABCDEF = vacc0x89ABCDEF;
+    __m256 vacc3x01234567 = vacc0x01234567;
+    __m256 vacc3x89ABCDEF = vacc0x89ABCDEF;
+    w = (const uint16_t*) w + 16;
+
+    size_t p = ks;
+    do {
+      const uint16_t* restrict a0 = (const uint16_t*) a[0];
+      assert(a0 != NULL);
+      if XNN_UNPREDICTABLE(a0 != zero) {
+        a0 = (const uint16_t*) ((uintptr_t) a0 + a_offset);
+      }
+      const uint16_t* restrict a1 = (const uint16_t*) a[1];
+      assert(a1 != NULL);
+      if XNN_UNPREDICTABLE(a1 != zero) {
+        a1 = (const uint16_t*) ((uintptr_t) a1 + a_offset);
+      }
+      const uint16_t* restrict a2 = (const uint16_t*) a[2];
+      assert(a2 != NULL);
+      if XNN_UNPREDICTABLE(a2 != zero) {
+        a2 = (const uint16_t*) ((uintptr_t) a2 + a_offset);
+      }
+      const uint16_t* restrict a3 = (const uint16_t*) a[3];
+      assert(a3 != NULL);
+      if XNN_UNPREDICTABLE(a3 != zero) {
+        a3 = (const uint16_t*) ((uintptr_t) a3 + a_offset);
+      }
+      a += 4;
+
+      size_t k = kc;
+      do {
+        const __m256 vb01234567 = _mm256_cvtph_ps(_mm_load_si128((const __m128i*) w));
+        const __m256 vb89ABCDEF = _mm256_cvtph_ps(_mm_load_si128((const __m128i*) ((const uint16_t*) w + 8)));
+        w = (const uint16_t*) w + 16;
+
+        const __m256 va0 = _mm256_cvtph_ps(_mm_set1_epi16((short) *a0));
+        a0 += 1;
+        const __m256 va1 = _mm256_cvtph_ps(_mm_set1_epi16((short) *a1));
+        a1 += 1;
+        const __m256 va2 = _mm256_cvtph_ps(_mm_set1_epi16((short) *a2));
+        a2 += 1;
+        const __m256 va3 = _mm256_cvtph_ps(_mm_set1_epi16((short) *a3));
+        a3 += 1;
+
+        vacc0x01234567 = _mm256_cvtph_ps(_mm256_cvtps_ph(_mm256_fmadd_ps(va0, vb01234567, vacc0x01234567), _MM_FROUND_NO_EXC));
+        vacc0x89ABCDEF = _mm256_cvtph_ps(_mm256_cvtps_ph(_mm256_fmadd_ps(va0, vb89ABCDEF, vacc0x89ABCDEF), _MM_FROUND_NO_EXC));
+        vacc1x01234567 = _mm256_cvtph_ps(_mm256_cvtps_ph(_mm256_fmadd_ps(va1, vb01234567, vacc1x01234567), _MM_FROUND_NO_EXC));
+        vacc1x89ABCDEF = _mm256_cvtph_ps(_mm256_cvtps_ph(_mm256_fmadd_ps(va1, vb89ABCDEF, vacc1x89ABCDEF), _MM_FROUND_NO_EXC));
+        vacc2x01234567 = _mm256_cvtph_ps(_mm256_cvtps_ph(_mm256_fmadd_ps(va2, vb01234567, vacc2x01234567), _MM_FROUND_NO_EXC));
+        vacc2x89ABCDEF = _mm256_cvtph_ps(_mm256_cvtps_ph(_mm256_fmadd_ps(va2, vb89ABCDEF, vacc2x89ABCDEF), _MM_FROUND_NO_EXC));
+        vacc3x01234567 = _mm256_cvtph_ps(_mm256_cvtps_ph(_mm256_fmadd_ps(va3, vb01234567, vacc3x01234567), _MM_FROUND_NO_EXC));
+        vacc3x89ABCDEF = _mm256_cvtph_ps(_mm256_cvtps_ph(_mm256_fmadd_ps(va3, vb89ABCDEF, vacc3x89ABCDEF), _MM_FROUND_NO_EXC));
+
+        k -= sizeof(uint16_t);
+      } while (k != 0);
+      p -= 4 * sizeof(void*);
+    } while (p != 0);
+
+    const __m256 vscale = _mm256_load_ps(params->avx.scale);
+    vacc0x01234567 = _mm256_cvtph_ps(_mm256_cvtps_ph(_mm256_mul_ps(vacc0x01234567, vscale), _MM_FROUND_NO_EXC));
+    vacc1x01234567 = _mm256_cvtph_ps(_mm256_cvtps_ph(_mm256_mul_ps(vacc1x01234567, vscale), _MM_FROUND_NO_EXC));
+    vacc2x01234567 = _mm256_cvtph_ps(_mm256_cvtps_ph(_mm256_mul_ps(vacc2x01234567, vscale), _MM_FROUND_NO_EXC));
+    vacc3x01234567 = _mm256_cvtph_ps(_mm256_cvtps_ph(_mm256_mul_ps(vacc3x01234567, vscale), _MM_FROUND_NO_EXC));
+    vacc0x89ABCDEF = _mm256_cvtph_ps(_mm256_cvtps_ph(_mm256_mul_ps(vacc0x89ABCDEF, vscale), _MM_FROUND_NO_EXC));
+    vacc1x89ABCDEF = _mm256_cvtph_ps(_mm256_cvtps_ph(_mm256_mul_ps(vacc1x89ABCDEF, vscale), _MM_FROUND_NO_EXC));
+    vacc2x89ABCDEF = _mm256_cvtph_ps(_mm256_cvtps_ph(_mm256_mul_ps(vacc2x89ABCDEF, vscale), _MM_FROUND_NO_EXC));
+    vacc3x89ABCDEF = _mm256_cvtph_ps(_mm256_cvtps_ph(_mm256_mul_ps(vacc3x89ABCDEF, vscale), _MM_FROUND_NO_EXC));
+
+    const __m256 vmin = _mm256_load_ps(params->avx.min);
+    vacc0x01234567 = _mm256_max_ps(vacc0x01234567, vmin);
+    vacc1x01234567 = _mm256_max_ps(vacc1x01234567, vmin);
+    vacc2x01234567 = _mm256_max_ps(vacc2x01234567, vmin);
+    vacc3x01234567 = _mm256_max_ps(vacc3x01234567, vmin);
+    vacc0x89ABCDEF = _mm256_max_ps(vacc0x89ABCDEF, vmin);
+    vacc1x89ABCDEF = _mm256_max_ps(vacc1x89ABCDEF, vmin);
+    vacc2x89ABCDEF = _mm256_max_ps(vacc2x89ABCDEF, vmin);
+    vacc3x89ABCDEF = _mm256_max_ps(vacc3x89ABCDEF, vmin);
+
+    const __m256 vmax = _mm256_load_ps(params->avx.max);
+    vacc0x01234567 = _mm256_min_ps(vacc0x01234567, vmax);
+    vacc1x01234567 = _mm256_min_ps(vacc1x01234567, vmax);
+    vacc2x01234567 = _mm256_min_ps(vacc2x01234567, vmax);
+    vacc3x01234567 = _mm256_min_ps(vacc3x01234567, vmax);
+    vacc0x89ABCDEF = _mm256_min_ps(vacc0x89ABCDEF, vmax);
+    vacc1x89ABCDEF = _mm256_min_ps(vacc1x89ABCDEF, vmax);
+    vacc2x89ABCDEF = _mm256_min_ps(vacc2x89ABCDEF, vmax);
+    vacc3x89ABCDEF = _mm256_min_ps(vacc3x89ABCDEF, vmax);
+
+    if XNN_LIKELY(nc >= 16) {
+      _mm_storeu_si128((__m128i*) c3, _mm256_cvtps_ph(vacc3x01234567, _MM_FROUND_NO_EXC));
+      _mm_storeu_si128((__m128i*) (c3 + 8), _mm256_cvtps_ph(vacc3x89ABCDEF, _MM_FROUND_NO_EXC));
+      c3 = (uint16_t*) ((uintptr_t) c3 + cn_stride);
+      _mm_storeu_si128((__m128i*) c2, _mm256_cvtps_ph(vacc2x01234567, _MM_FROUND_NO_EXC));
+      _mm_storeu_si128((__m128i*) (c2 + 8), _mm256_cvtps_ph(vacc2x89ABCDEF, _MM_FROUND_NO_EXC));
+      c2 = (uint16_t*) ((uintptr_t) c2 + cn_stride);
+      _mm_storeu_si128((__m128i*) c1, _mm256_cvtps_ph(vacc1x01234567, _MM_FROUND_NO_EXC));
+      _mm_storeu_si128((__m128i*) (c1 + 8), _mm256_cvtps_ph(vacc1x89ABCDEF, _MM_FROUND_NO_EXC));
+      c1 = (uint16_t*) ((uintptr_t) c1 + cn_stride);
+      _mm_storeu_si128((__m128i*) c0, _mm256_cvtps_ph(vacc0x01234567, _MM_FROUND_NO_EXC));
+      _mm_storeu_si128((__m128i*) (c0 + 8), _mm256_cvtps_ph(vacc0x89ABCDEF, _MM_FROUND_NO_EXC));
+      c0 = (uint16_t*) ((uintptr_t) c0 + cn_stride);
+
+      a = (const void**restrict) ((uintptr_t) a - ks);
+      nc -= 16;
+    } else {
+      __m128i vh3x01234567 = _mm256_cvtps_ph(vacc3x01234567, _MM_FROUND_NO_EXC);
+      __m128i vh2x01234567 = _mm256_cvtps_ph(vacc2x01234567, _MM_FROUND_NO_EXC);
+      __m128i vh1x01234567 = _mm256_cvtps_ph(vacc1x01234567, _MM_FROUND_NO_EXC);
+      __m128i vh0x01234567 = _mm256_cvtps_ph(vacc0x01234567, _MM_FROUND_NO_EXC);
+      if (nc & 8) {
+        _mm_storeu_si128((__m128i*) c3, vh3x01234567);
+        _mm_storeu_si128((__m128i*) c2, vh2x01234567);
+        _mm_storeu_si128((__m128i*) c1, vh1x01234567);
+        _mm_storeu_si128((__m128i*) c0, vh0x01234567);
+
+        vh3x01234567 = _mm256_cvtps_ph(vacc3x89ABCDEF, _MM_FROUND_NO_EXC);
+        vh2x01234567 = _mm256_cvtps_ph(vacc2x89ABCDEF, _MM_FROUND_NO_EXC);
+        vh1x01234567 = _mm256_cvtps_ph(vacc1x89ABCDEF, _MM_FROUND_NO_EXC);
+        vh0x01234567 = _mm256_cvtps_ph(vacc0x89ABCDEF, _MM_FROUND_NO_EXC);
+
+        c3 += 8;
+        c2 += 8;
+        c1 += 8;
+        c0 += 8;
+      }
+      if (nc & 4) {
+        _mm_storel_epi64((__m128i*) c3, vh3x01234567);
+        _mm_storel_epi64((__m128i*) c2, vh2x01234567);
+        _mm_storel_epi64((__m128i*) c1, vh1x01234567);
+        _mm_storel_epi64((__m128i*) c0, vh0x01234567);
+
+        vh3x01234567 = _mm_unpackhi_epi64(vh3x01234567, vh3x01234567);
+        vh2x01234567 = _mm_unpackhi_epi64(vh2x01234567, vh2x01234567);
+        vh1x01234567 = _mm_unpackhi_epi64(vh1x01234567, vh1x01234567);
+        vh0x01234567 = _mm_unpackhi_epi64(vh0x01234567, vh0x01234567);
+
+        c3 += 4;
+        c2 += 4;
+        c1 += 4;
+        c0 += 4;
+      }
+      if (nc & 2) {
+        _mm_storeu_si32(c3, vh3x01234567);
+        _mm_storeu_si32(c2, vh2x01234567);
+        _mm_storeu_si32(c1, vh1x01234567);
+        _mm_storeu_si32(c0, vh0x01234567);
+
+        vh3x01234567 = _mm_srli_epi64(vh3x01234567, 32);
+        vh2x01234567 = _mm_srli_epi64(vh2x01234567, 32);
+        vh1x01234567 = _mm_srli_epi64(vh1x01234567, 32);
+        vh0x01234567 = _mm_srli_epi64(vh0x01234567, 32);
+
+        c3 += 2;
+        c2 += 2;
+        c1 += 2;
+        c0 += 2;
+      }
+      if (nc & 1) {
+        *c3 = _mm_extract_epi16(vh3x01234567, 0);
+        *c2 = _mm_extract_epi16(vh2x01234567, 0);
+        *c1 = _mm_extract_epi16(vh1x01234567, 0);
+        *c0 = _mm_extract_epi16(vh0x01234567, 0);
+      }
+
+      nc = 0;
+    }
+  } while (nc != 0);
+}
+
 void xnn_f32_qs8_vcvt_ukernel__avx2_x64(
     size_t n,
     const float* x,
@@ -507,6 +1123,208 @@ void xnn_f32_velu_ukernel__avx2_rr1_lut4_p4_perm_x56(
   }
 }
 
+void xnn_f32_vgelu_ukernel__avx2_rational_13_8_div_x32(
+    size_t n,
+    const float* x,
+    float* y,
+    const union xnn_f32_gelu_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(n != 0);
+  assert(n % sizeof(float) == 0);
+  assert(x != NULL);
+  assert(y != NULL);
+
+  const __m256 vminus_cutoff = _mm256_load_ps(params->avx_rational_13_8.minus_cutoff);
+  const __m256 vcutoff = _mm256_load_ps(params->avx_rational_13_8.cutoff);
+  const __m256 valpha13 = _mm256_load_ps(params->avx_rational_13_8.alpha13);
+  const __m256 valpha11 = _mm256_load_ps(params->avx_rational_13_8.alpha11);
+  const __m256 valpha9 = _mm256_load_ps(params->avx_rational_13_8.alpha9);
+  const __m256 valpha7 = _mm256_load_ps(params->avx_rational_13_8.alpha7);
+  const __m256 valpha5 = _mm256_load_ps(params->avx_rational_13_8.alpha5);
+  const __m256 valpha3 = _mm256_load_ps(params->avx_rational_13_8.alpha3);
+  const __m256 valpha1 = _mm256_load_ps(params->avx_rational_13_8.alpha1);
+  const __m256 vbeta8 = _mm256_load_ps(params->avx_rational_13_8.beta8);
+  const __m256 vbeta6 = _mm256_load_ps(params->avx_rational_13_8.beta6);
+  const __m256 vbeta4 = _mm256_load_ps(params->avx_rational_13_8.beta4);
+  const __m256 vbeta2 = _mm256_load_ps(params->avx_rational_13_8.beta2);
+  const __m256 vbeta0 = _mm256_load_ps(params->avx_rational_13_8.beta0);
+  const __m256 vminus_one = _mm256_load_ps(params->avx_rational_13_8.minus_one);
+  const __m256 vone = _mm256_load_ps(params->avx_rational_13_8.one);
+  const __m256 vhalf = _mm256_load_ps(params->avx_rational_13_8.half);
+
+  for (; n >= 32 * sizeof(float); n -= 32 * sizeof(float)) {
+    const __m256 vx0 = _mm256_loadu_ps(x);
+    const __m256 vx1 = _mm256_loadu_ps(x + 8);
+    const __m256 vx2 = _mm256_loadu_ps(x + 16);
+    const __m256 vx3 = _mm256_loadu_ps(x + 24);
+    x += 32;
+
+    const __m256 vz0 = _mm256_max_ps(vminus_cutoff, _mm256_min_ps(vx0, vcutoff));
+    const __m256 vz1 = _mm256_max_ps(vminus_cutoff, _mm256_min_ps(vx1, vcutoff));
+    const __m256 vz2 = _mm256_max_ps(vminus_cutoff, _mm256_min_ps(vx2, vcutoff));
+    const __m256 vz3 = _mm256_max_ps(vminus_cutoff, _mm256_min_ps(vx3, vcutoff));
+
+    const __m256 vz20 = _mm256_mul_ps(vz0, vz0);
+    const __m256 vz21 = _mm256_mul_ps(vz1, vz1);
+    const __m256 vz22 = _mm256_mul_ps(vz2, vz2);
+    const __m256 vz23 = _mm256_mul_ps(vz3, vz3);
+
+    __m256 vp0 = _mm256_fmadd_ps(valpha13, vz20, valpha11);
+    __m256 vp1 = _mm256_fmadd_ps(valpha13, vz21, valpha11);
+    __m256 vp2 = _mm256_fmadd_ps(valpha13, vz22, valpha11);
+    __m256 vp3 = _mm256_fmadd_ps(valpha13, vz23, valpha11);
+
+    vp0 = _mm256_fmadd_ps(vp0, vz20, valpha9);
+    vp1 = _mm256_fmadd_ps(vp1, vz21, valpha9);
+    vp2 = _mm256_fmadd_ps(vp2, vz22, valpha9);
+    vp3 = _mm256_fmadd_ps(vp3, vz23, valpha9);
+
+    vp0 = _mm256_fmadd_ps(vp0, vz20, valpha7);
+    vp1 = _mm256_fmadd_ps(vp1, vz21, valpha7);
+    vp2 = _mm256_fmadd_ps(vp2, vz22, valpha7);
+    vp3 = _mm256_fmadd_ps(vp3, vz23, valpha7);
+
+    vp0 = _mm256_fmadd_ps(vp0, vz20, valpha5);
+    vp1 = _mm256_fmadd_ps(vp1, vz21, valpha5);
+    vp2 = _mm256_fmadd_ps(vp2, vz22, valpha5);
+    vp3 = _mm256_fmadd_ps(vp3, vz23, valpha5);
+
+    vp0 = _mm256_fmadd_ps(vp0, vz20, valpha3);
+    vp1 = _mm256_fmadd_ps(vp1, vz21, valpha3);
+    vp2 = _mm256_fmadd_ps(vp2, vz22, valpha3);
+    vp3 = _mm256_fmadd_ps(vp3, vz23, valpha3);
+
+    vp0 = _mm256_fmadd_ps(vp0, vz20, valpha1);
+    vp1 = _mm256_fmadd_ps(vp1, vz21, valpha1);
+    vp2 = _mm256_fmadd_ps(vp2, vz22, valpha1);
+    vp3 = _mm256_fmadd_ps(vp3, vz23, valpha1);
+
+    vp0 = _mm256_mul_ps(vp0, vz0);
+    vp1 = _mm256_mul_ps(vp1, vz1);
+    vp2 = _mm256_mul_ps(vp2, vz2);
+    vp3 = _mm256_mul_ps(vp3, vz3);
+
+    __m256 vq0 = _mm256_fmadd_ps(vbeta8, vz20, vbeta6);
+    __m256 vq1 = _mm256_fmadd_ps(vbeta8, vz21, vbeta6);
+    __m256 vq2 = _mm256_fmadd_ps(vbeta8, vz22, vbeta6);
+    __m256 vq3 = _mm256_fmadd_ps(vbeta8, vz23, vbeta6);
+
+    vq0 = _mm256_fmadd_ps(vq0, vz20, vbeta4);
+    vq1 = _mm256_fmadd_ps(vq1, vz21, vbeta4);
+    vq2 = _mm256_fmadd_ps(vq2, vz22, vbeta4);
+    vq3 = _mm256_fmadd_ps(vq3, vz23, vbeta4);
+
+    vq0 = _mm256_fmadd_ps(vq0, vz20, vbeta2);
+    vq1 = _mm256_fmadd_ps(vq1, vz21, vbeta2);
+    vq2 = _mm256_fmadd_ps(vq2, vz22, vbeta2);
+    vq3 = _mm256_fmadd_ps(vq3, vz23, vbeta2);
+
+    vq0 = _mm256_fmadd_ps(vq0, vz20, vbeta0);
+    vq1 = _mm256_fmadd_ps(vq1, vz21, vbeta0);
+    vq2 = _mm256_fmadd_ps(vq2, vz22, vbeta0);
+    vq3 = _mm256_fmadd_ps(vq3, vz23, vbeta0);
+
+    __m256 verf0 = _mm256_div_ps(vp0, vq0);
+    __m256 verf1 = _mm256_div_ps(vp1, vq1);
+    __m256 verf2 = _mm256_div_ps(vp2, vq2);
+    __m256 verf3 = _mm256_div_ps(vp3, vq3);
+
+    verf0 = _mm256_max_ps(vminus_one, _mm256_min_ps(verf0, vone));
+    verf1 = _mm256_max_ps(vminus_one, _mm256_min_ps(verf1, vone));
+    verf2 = _mm256_max_ps(vminus_one, _mm256_min_ps(verf2, vone));
+    verf3 = _mm256_max_ps(vminus_one, _mm256_min_ps(verf3, vone));
+
+    const __m256 vhalfx0 = _mm256_mul_ps(vx0, vhalf);
+    const __m256 vhalfx1 = _mm256_mul_ps(vx1, vhalf);
+    const __m256 vhalfx2 = _mm256_mul_ps(vx2, vhalf);
+    const __m256 vhalfx3 = _mm256_mul_ps(vx3, vhalf);
+
+    const __m256 vy0 = _mm256_fmadd_ps(vhalfx0, verf0, vhalfx0);
+    const __m256 vy1 = _mm256_fmadd_ps(vhalfx1, verf1, vhalfx1);
+    const __m256 vy2 = _mm256_fmadd_ps(vhalfx2, verf2, vhalfx2);
+    const __m256 vy3 = _mm256_fmadd_ps(vhalfx3, verf3, vhalfx3);
+
+    _mm256_storeu_ps(y, vy0);
+    _mm256_storeu_ps(y + 8, vy1);
+    _mm256_storeu_ps(y + 16, vy2);
+    _mm256_storeu_ps(y + 24, vy3);
+    y += 32;
+  }
+  for (; n >= 8 * sizeof(float); n -= 8 * sizeof(float)) {
+    const __m256 vx = _mm256_loadu_ps(x);
+    x += 8;
+
+    const __m256 vz = _mm256_max_ps(vminus_cutoff, _mm256_min_ps(vx, vcutoff));
+    const __m256 vz2 = _mm256_mul_ps(vz, vz);
+
+    __m256 vp = _mm256_fmadd_ps(valpha13, vz2, valpha11);
+    vp = _mm256_fmadd_ps(vp, vz2, valpha9);
+    vp = _mm256_fmadd_ps(vp, vz2, valpha7);
+    vp = _mm256_fmadd_ps(vp, vz2, valpha5);
+    vp = _mm256_fmadd_ps(vp, vz2, valpha3);
+    vp = _mm256_fmadd_ps(vp, vz2, valpha1);
+    vp = _mm256_mul_ps(vp, vz);
+
+    __m256 vq = _mm256_fmadd_ps(vbeta8, vz2, vbeta6);
+    vq = _mm256_fmadd_ps(vq, vz2, vbeta4);
+    vq = _mm256_fmadd_ps(vq, vz2, vbeta2);
+    vq = _mm256_fmadd_ps(vq, vz2, vbeta0);
+
+    __m256 verf = _mm256_div_ps(vp, vq);
+    verf = _mm256_max_ps(vminus_one, _mm256_min_ps(verf, vone));
+
+    const __m256 vhalfx = _mm256_mul_ps(vx, vhalf);
+    const __m256 vy = _mm256_fmadd_ps(vhalfx, verf, vhalfx);
+
+    _mm256_storeu_ps(y, vy);
+    y += 8;
+  }
+  if XNN_UNLIKELY(n != 0) {
+    assert(n >= 1 * sizeof(float));
+    assert(n <= 7 * sizeof(float));
+    const __m256i vmask = _mm256_loadu_si256((const __m256i*) ((uintptr_t) &params->avx_rational_13_8.mask_table[7] - n));
+
+    const __m256 vx = _mm256_maskload_ps(x, vmask);
+
+    const __m256 vz = _mm256_max_ps(vminus_cutoff, _mm256_min_ps(vx, vcutoff));
+    const __m256 vz2 = _mm256_mul_ps(vz, vz);
+
+    __m256 vp = _mm256_fmadd_ps(valpha13, vz2, valpha11);
+    vp = _mm256_fmadd_ps(vp, vz2, valpha9);
+    vp = _mm256_fmadd_ps(vp, vz2, valpha7);
+    vp = _mm256_fmadd_ps(vp, vz2, valpha5);
+    vp = _mm256_fmadd_ps(vp, vz2, valpha3);
+    vp = _mm256_fmadd_ps(vp, vz2, valpha1);
+    vp = _mm256_mul_ps(vp, vz);
+
+    __m256 vq = _mm256_fmadd_ps(vbeta8, vz2, vbeta6);
+    vq = _mm256_fmadd_ps(vq, vz2, vbeta4);
+    vq = _mm256_fmadd_ps(vq, vz2, vbeta2);
+    vq = _mm256_fmadd_ps(vq, vz2, vbeta0);
+
+    __m256 verf = _mm256_div_ps(vp, vq);
+    verf = _mm256_max_ps(vminus_one, _mm256_min_ps(verf, vone));
+
+    const __m256 vhalfx = _mm256_mul_ps(vx, vhalf);
+    const __m256 vy = _mm256_fmadd_ps(vhalfx, verf, vhalfx);
+
+    __m128 vy_lo = _mm256_castps256_ps128(vy);
+    if (n & (4 * sizeof(float))) {
+      _mm_storeu_ps(y, vy_lo);
+      vy_lo = _mm256_extractf128_ps(vy, 1);
+      y += 4;
+    }
+    if (n & (2 * sizeof(float))) {
+      _mm_storel_pi((__m64*) y, vy_lo);
+      vy_lo = _mm_movehl_ps(vy_lo, vy_lo);
+      y += 2;
+    }
+    if (n & (1 * sizeof(float))) {
+      _mm_store_ss(y, vy_lo);
+    }
+  }
+}
+
 void xnn_f32_vsigmoid_ukernel__avx2_rr1_p5_div_x40(
     size_t n,
     const float* x,
@@ -707,6 +1525,210 @@ void xnn_f32_vsigmoid_ukernel__avx2_rr1_p5_div_x40(
   }
 }
 
+void xnn_f32_vtanh_ukernel__avx2_expm1minus_rr1_p6_div_x32(
+    size_t n,
+    const float* x,
+    float* y,
+    const union xnn_f32_tanh_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(n != 0);
+  assert(n % sizeof(float) == 0);
+  assert(x != NULL);
+  assert(y != NULL);
+
+  const __m256 vsign_mask = _mm256_load_ps(params->avx2_expm1minus_rr1_p6.sign_mask);
+  const __m256 vsat_cutoff = _mm256_load_ps(params->avx2_expm1minus_rr1_p6.sat_cutoff);
+  const __m256 vlog2e = _mm256_load_ps(params->avx2_expm1minus_rr1_p6.log2e);
+  const __m256 vmagic_bias = _mm256_load_ps(params->avx2_expm1minus_rr1_p6.magic_bias);
+  const __m256 vminus_ln2 = _mm256_load_ps(params->avx2_expm1minus_rr1_p6.minus_ln2);
+  const __m256 vc6 = _mm256_load_ps(params->avx2_expm1minus_rr1_p6.c6);
+  const __m256 vc5 = _mm256_load_ps(params->avx2_expm1minus_rr1_p6.c5);
+  const __m256 vc4 = _mm256_load_ps(params->avx2_expm1minus_rr1_p6.c4);
+  const __m256 vc3 = _mm256_load_ps(params->avx2_expm1minus_rr1_p6.c3);
+  const __m256 vc2 = _mm256_load_ps(params->avx2_expm1minus_rr1_p6.c2);
+  const __m256 vone = _mm256_load_ps(params->avx2_expm1minus_rr1_p6.one);
+  const __m256 vminus_two = _mm256_load_ps(params->avx2_expm1minus_rr1_p6.minus_two);
+
+  for (; n >= 32 * sizeof(float); n -= 32 * sizeof(float)) {
+    const __m256 vx0 = _mm256_loadu_ps(x);
+    const __m256 vx1 = _mm256_loadu_ps(x + 8);
+    const __m256 vx2 = _mm256_loadu_ps(x + 16);
+    const __m256 vx3 = _mm256_loadu_ps(x + 24);
+    x += 32;
+
+    __m256 vz0 = _mm256_or_ps(vx0, vsign_mask);
+    __m256 vz1 = _mm256_or_ps(vx1, vsign_mask);
+    __m256 vz2 = _mm256_or_ps(vx2, vsign_mask);
+    __m256 vz3 = _mm256_or_ps(vx3, vsign_mask);
+
+    vz0 = _mm256_max_ps(vsat_cutoff, _mm256_add_ps(vz0, vz0));
+    vz1 = _mm256_max_ps(vsat_cutoff, _mm256_add_ps(vz1, vz1));
+    vz2 = _mm256_max_ps(vsat_cutoff, _mm256_add_ps(vz2, vz2));
+    vz3 = _mm256_max_ps(vsat_cutoff, _mm256_add_ps(vz3, vz3));
+
+    __m256 vn0 = _mm256_fmadd_ps(vz0, vlog2e, vmagic_bias);
+    __m256 vn1 = _mm256_fmadd_ps(vz1, vlog2e, vmagic_bias);
+    __m256 vn2 = _mm256_fmadd_ps(vz2, vlog2e, vmagic_bias);
+    __m256 vn3 = _mm256_fmadd_ps(vz3, vlog2e, vmagic_bias);
+
+    const __m256 vs0 = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_castps_si256(vn0), 23));
+    vn0 = _mm256_sub_ps(vn0, vmagic_bias);
+    const __m256 vs1 = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_castps_si256(vn1), 23));
+    vn1 = _mm256_sub_ps(vn1, vmagic_bias);
+    const __m256 vs2 = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_castps_si256(vn2), 23));
+    vn2 = _mm256_sub_ps(vn2, vmagic_bias);
+    const __m256 vs3 = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_castps_si256(vn3), 23));
+    vn3 = _mm256_sub_ps(vn3, vmagic_bias);
+
+    __m256 vt0 = _mm256_fmadd_ps(vn0, vminus_ln2, vz0);
+    __m256 vt1 = _mm256_fmadd_ps(vn1, vminus_ln2, vz1);
+    __m256 vt2 = _mm256_fmadd_ps(vn2, vminus_ln2, vz2);
+    __m256 vt3 = _mm256_fmadd_ps(vn3, vminus_ln2, vz3);
+
+    __m256 vp0 = _mm256_fmadd_ps(vc6, vt0, vc5);
+    __m256 vp1 = _mm256_fmadd_ps(vc6, vt1, vc5);
+    __m256 vp2 = _mm256_fmadd_ps(vc6, vt2, vc5);
+    __m256 vp3 = _mm256_fmadd_ps(vc6, vt3, vc5);
+
+    vp0 = _mm256_fmadd_ps(vp0, vt0, vc4);
+    vp1 = _mm256_fmadd_ps(vp1, vt1, vc4);
+    vp2 = _mm256_fmadd_ps(vp2, vt2, vc4);
+    vp3 = _mm256_fmadd_ps(vp3, vt3, vc4);
+
+    vp0 = _mm256_fmadd_ps(vp0, vt0, vc3);
+    vp1 = _mm256_fmadd_ps(vp1, vt1, vc3);
+    vp2 = _mm256_fmadd_ps(vp2, vt2, vc3);
+    vp3 = _mm256_fmadd_ps(vp3, vt3, vc3);
+
+    vp0 = _mm256_fmadd_ps(vp0, vt0, vc2);
+    vp1 = _mm256_fmadd_ps(vp1, vt1, vc2);
+    vp2 = _mm256_fmadd_ps(vp2, vt2, vc2);
+    vp3 = _mm256_fmadd_ps(vp3, vt3, vc2);
+
+    vp0 = _mm256_mul_ps(vp0, vt0);
+    vp1 = _mm256_mul_ps(vp1, vt1);
+    vp2 = _mm256_mul_ps(vp2, vt2);
+    vp3 = _mm256_mul_ps(vp3, vt3);
+
+    vt0 = _mm256_mul_ps(vt0, vs0);
+    const __m256 vsm10 = _mm256_sub_ps(vs0, vone);
+    vt1 = _mm256_mul_ps(vt1, vs1);
+    const __m256 vsm11 = _mm256_sub_ps(vs1, vone);
+    vt2 = _mm256_mul_ps(vt2, vs2);
+    const __m256 vsm12 = _mm256_sub_ps(vs2, vone);
+    vt3 = _mm256_mul_ps(vt3, vs3);
+    const __m256 vsm13 = _mm256_sub_ps(vs3, vone);
+
+    vp0 = _mm256_fmadd_ps(vp0, vt0, vt0);
+    vp1 = _mm256_fmadd_ps(vp1, vt1, vt1);
+    vp2 = _mm256_fmadd_ps(vp2, vt2, vt2);
+    vp3 = _mm256_fmadd_ps(vp3, vt3, vt3);
+
+    const __m256 vemo0 = _mm256_add_ps(vp0, vsm10);
+    const __m256 vemo1 = _mm256_add_ps(vp1, vsm11);
+    const __m256 vemo2 = _mm256_add_ps(vp2, vsm12);
+    const __m256 vemo3 = _mm256_add_ps(vp3, vsm13);
+
+    const __m256 vepo0 = _mm256_sub_ps(vemo0, vminus_two);
+    const __m256 vepo1 = _mm256_sub_ps(vemo1, vminus_two);
+    const __m256 vepo2 = _mm256_sub_ps(vemo2, vminus_two);
+    const __m256 vepo3 = _mm256_sub_ps(vemo3, vminus_two);
+
+    __m256 vy0 = _mm256_div_ps(vemo0, vepo0);
+    __m256 vy1 = _mm256_div_ps(vemo1, vepo1);
+    __m256 vy2 = _mm256_div_ps(vemo2, vepo2);
+    __m256 vy3 = _mm256_div_ps(vemo3, vepo3);
+
+    vy0 = _mm256_or_ps(_mm256_andnot_ps(vsign_mask, vy0), _mm256_and_ps(vsign_mask, vx0));
+    vy1 = _mm256_or_ps(_mm256_andnot_ps(vsign_mask, vy1), _mm256_and_ps(vsign_mask, vx1));
+    vy2 = _mm256_or_ps(_mm256_andnot_ps(vsign_mask, vy2), _mm256_and_ps(vsign_mask, vx2));
+    vy3 = _mm256_or_ps(_mm256_andnot_ps(vsign_mask, vy3), _mm256_and_ps(vsign_mask, vx3));
+
+    _mm256_storeu_ps(y, vy0);
+    _mm256_storeu_ps(y + 8, vy1);
+    _mm256_storeu_ps(y + 16, vy2);
+    _mm256_storeu_ps(y + 24, vy3);
+    y += 32;
+  }
+  for (; n >= 8 * sizeof(float); n -= 8 * sizeof(float)) {
+    const __m256 vx = _mm256_loadu_ps(x);
+    x += 8;
+
+    __m256 vz = _mm256_or_ps(vx, vsign_mask);
+    vz = _mm256_max_ps(vsat_cutoff, _mm256_add_ps(vz, vz));
+
+    __m256 vn = _mm256_fmadd_ps(vz, vlog2e, vmagic_bias);
+    const __m256 vs = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_castps_si256(vn), 23));
+    vn = _mm256_sub_ps(vn, vmagic_bias);
+
+    __m256 vt = _mm256_fmadd_ps(vn, vminus_ln2, vz);
+
+    __m256 vp = _mm256_fmadd_ps(vc6, vt, vc5);
+    vp = _mm256_fmadd_ps(vp, vt, vc4);
+    vp = _mm256_fmadd_ps(vp, vt, vc3);
+    vp = _mm256_fmadd_ps(vp, vt, vc2);
+    vp = _mm256_mul_ps(vp, vt);
+
+    vt = _mm256_mul_ps(vt, vs);
+    const __m256 vsm1 = _mm256_sub_ps(vs, vone);
+    vp = _mm256_fmadd_ps(vp, vt, vt);
+    const __m256 vemo = _mm256_add_ps(vp, vsm1);
+    const __m256 vepo = _mm256_sub_ps(vemo, vminus_two);
+
+    __m256 vy = _mm256_div_ps(vemo, vepo);
+    vy = _mm256_or_ps(_mm256_andnot_ps(vsign_mask, vy), _mm256_and_ps(vsign_mask, vx));
+
+    _mm256_storeu_ps(y, vy);
+    y += 8;
+  }
+  if XNN_UNLIKELY(n != 0) {
+    assert(n >= 1 * sizeof(float));
+    assert(n <= 7 * sizeof(float));
+    const __m256i vmask = _mm256_loadu_si256((const __m256i*) ((uintptr_t) &params->avx2_expm1minus_rr1_p6.mask_table[7] - n));
+
+    const __m256 vx = _mm256_maskload_ps(x, vmask);
+
+    __m256 vz = _mm256_or_ps(vx, vsign_mask);
+    vz = _mm256_max_ps(vsat_cutoff, _mm256_add_ps(vz, vz));
+
+    __m256 vn = _mm256_fmadd_ps(vz, vlog2e, vmagic_bias);
+    const __m256 vs = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_castps_si256(vn), 23));
+    vn = _mm256_sub_ps(vn, vmagic_bias);
+
+    __m256 vt = _mm256_fmadd_ps(vn, vminus_ln2, vz);
+
+    __m256 vp = _mm256_fmadd_ps(vc6, vt, vc5);
+    vp = _mm256_fmadd_ps(vp, vt, vc4);
+    vp = _mm256_fmadd_ps(vp, vt, vc3);
+    vp = _mm256_fmadd_ps(vp, vt, vc2);
+    vp = _mm256_mul_ps(vp, vt);
+
+    vt = _mm256_mul_ps(vt, vs);
+    const __m256 vsm1 = _mm256_sub_ps(vs, vone);
+    vp = _mm256_fmadd_ps(vp, vt, vt);
+    const __m256 vemo = _mm256_add_ps(vp, vsm1);
+    const __m256 vepo = _mm256_sub_ps(vemo, vminus_two);
+
+    __m256 vy = _mm256_div_ps(vemo, vepo);
+    vy = _mm256_or_ps(_mm256_andnot_ps(vsign_mask, vy), _mm256_and_ps(vsign_mask, vx));
+
+    __m128 vy_lo = _mm256_castps256_ps128(vy);
+    if (n & (4 * sizeof(float))) {
+      _mm_storeu_ps(y, vy_lo);
+      vy_lo = _mm256_extractf128_ps(vy, 1);
+      y += 4;
+    }
+    if (n & (2 * sizeof(float))) {
+      _mm_storel_pi((__m64*) y, vy_lo);
+      vy_lo = _mm_movehl_ps(vy_lo, vy_lo);
+      y += 2;
+    }
+    if (n & (1 * sizeof(float))) {
+      _mm_store_ss(y, vy_lo);
+    }
+  }
+}
+
 void xnn_qc8_dwconv_minmax_fp32_ukernel_up16x25__avx2_mul32(
     size_t channels,
     size_t output_width,
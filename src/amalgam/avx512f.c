@@ -8,16 +8,1831 @@
 #include <immintrin.h>
 
 #include <xnnpack/common.h>
+#include <xnnpack/conv.h>
 #include <xnnpack/dwconv.h>
 #include <xnnpack/gemm.h>
 #include <xnnpack/igemm.h>
 #include <xnnpack/intrinsics-polyfill.h>
 #include <xnnpack/math.h>
 #include <xnnpack/prelu.h>
+#include <xnnpack/rmeanvar.h>
+#include <xnnpack/spmm.h>
 #include <xnnpack/vbinary.h>
+#include <xnnpack/vnormcaddc.h>
 #include <xnnpack/vunary.h>
 
 
+void xnn_f32_conv_hwc_ukernel_3x3s2p0p1c3x32__avx512f_2x2(
+    size_t input_height,
+    size_t input_width,
+    size_t output_y_start,
+    size_t output_y_end,
+    const float* input,
+    const float* zero,
+    const float* weights,
+    float* output,
+    size_t input_padding_top,
+    size_t output_channels,
+    size_t output_height_stride,
+    size_t output_width_stride,
+    const union xnn_f32_minmax_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(input_width > 1);
+  assert(output_y_end > output_y_start);
+  assert(input_padding_top <= 1);
+  assert(output_channels != 0);
+
+  const size_t input_height_stride = input_width * 3 /* channels */ * sizeof(float);
+  const size_t input_width_decrement = round_down_po2(input_width - 1, 2) * 3 /* channels */ * sizeof(float);
+  const size_t output_width = input_width / 2;
+  const size_t output_channel_decrement = output_width * output_width_stride - 32 * sizeof(float);
+  const size_t output_height_increment = output_height_stride * 2 - round_up_po2(output_channels, 32) * sizeof(float);
+
+  // Adjustment for padding processed below
+  const float* i0 = (const float*) ((uintptr_t) input +
+    input_height_stride * (output_y_start * 2 /* vertical stride */ - input_padding_top));
+  const float* i1 = (const float*) ((uintptr_t) i0 + input_height_stride);
+  const float* i2 = (const float*) ((uintptr_t) i1 + input_height_stride);
+  const float* i3 = (const float*) ((uintptr_t) i2 + input_height_stride);
+  const float* i4 = (const float*) ((uintptr_t) i3 + input_height_stride);
+  float* o0 = (float*) ((uintptr_t) output + output_height_stride * output_y_start);
+  float* o1 = (float*) ((uintptr_t) o0 + output_height_stride);
+
+  if XNN_UNPREDICTABLE(output_y_start < input_padding_top) {
+    i0 = zero;
+  }
+
+  const __m512 vmin = _mm512_set1_ps(params->scalar.min);
+  const __m512 vmax = _mm512_set1_ps(params->scalar.max);
+
+  for (size_t output_y = output_y_start; output_y < output_y_end; output_y += 2) {
+    const size_t input_y2 = output_y * 2 + 2 - input_padding_top;
+    const size_t input_y4 = input_y2 + 2;
+    if XNN_UNPREDICTABLE(input_y2 > input_height) {
+      i1 = zero;
+    }
+    if XNN_UNPREDICTABLE(input_y2 >= input_height) {
+      i2 = zero;
+    }
+    if XNN_UNPREDICTABLE(input_y4 > input_height) {
+      i3 = zero;
+    }
+    if XNN_UNPREDICTABLE(input_y4 >= input_height) {
+      i4 = zero;
+    }
+    if XNN_UNPREDICTABLE(output_y + 2 > output_y_end) {
+      o1 = o0;
+    }
+
+    const float* w = weights;
+    size_t c = output_channels;
+    do {
+      // voMx0 accumulates the leftmost output pixel of the next block. The input column to the left of it
+      // is either padding, or was already accumulated at the end of the previous block.
+      __m512 vo0x0c0123456789ABCDEF = _mm512_load_ps(w + 0);
+      __m512 vo0x0cGHIJKLMNOPQRSTUV = _mm512_load_ps(w + 16);
+      __m512 vo1x0c0123456789ABCDEF = vo0x0c0123456789ABCDEF;
+      __m512 vo1x0cGHIJKLMNOPQRSTUV = vo0x0cGHIJKLMNOPQRSTUV;
+
+      // No padding on the left: the first input column contributes only through the left column of the kernel.
+      const __m512 vi0c0 = _mm512_set1_ps(i0[0]);
+      vo0x0c0123456789ABCDEF = _mm512_fmadd_ps(_mm512_load_ps(w + 32), vi0c0, vo0x0c0123456789ABCDEF);
+      vo0x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(_mm512_load_ps(w + 48), vi0c0, vo0x0cGHIJKLMNOPQRSTUV);
+      const __m512 vi1c0 = _mm512_set1_ps(i1[0]);
+      vo0x0c0123456789ABCDEF = _mm512_fmadd_ps(_mm512_load_ps(w + 64), vi1c0, vo0x0c0123456789ABCDEF);
+      vo0x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(_mm512_load_ps(w + 80), vi1c0, vo0x0cGHIJKLMNOPQRSTUV);
+      const __m512 vi2c0 = _mm512_set1_ps(i2[0]);
+      vo0x0c0123456789ABCDEF = _mm512_fmadd_ps(_mm512_load_ps(w + 96), vi2c0, vo0x0c0123456789ABCDEF);
+      vo0x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(_mm512_load_ps(w + 112), vi2c0, vo0x0cGHIJKLMNOPQRSTUV);
+      vo1x0c0123456789ABCDEF = _mm512_fmadd_ps(_mm512_load_ps(w + 32), vi2c0, vo1x0c0123456789ABCDEF);
+      vo1x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(_mm512_load_ps(w + 48), vi2c0, vo1x0cGHIJKLMNOPQRSTUV);
+      const __m512 vi3c0 = _mm512_set1_ps(i3[0]);
+      vo1x0c0123456789ABCDEF = _mm512_fmadd_ps(_mm512_load_ps(w + 64), vi3c0, vo1x0c0123456789ABCDEF);
+      vo1x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(_mm512_load_ps(w + 80), vi3c0, vo1x0cGHIJKLMNOPQRSTUV);
+      const __m512 vi4c0 = _mm512_set1_ps(i4[0]);
+      vo1x0c0123456789ABCDEF = _mm512_fmadd_ps(_mm512_load_ps(w + 96), vi4c0, vo1x0c0123456789ABCDEF);
+      vo1x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(_mm512_load_ps(w + 112), vi4c0, vo1x0cGHIJKLMNOPQRSTUV);
+      const __m512 vi0c1 = _mm512_set1_ps(i0[1]);
+      vo0x0c0123456789ABCDEF = _mm512_fmadd_ps(_mm512_load_ps(w + 128), vi0c1, vo0x0c0123456789ABCDEF);
+      vo0x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(_mm512_load_ps(w + 144), vi0c1, vo0x0cGHIJKLMNOPQRSTUV);
+      const __m512 vi1c1 = _mm512_set1_ps(i1[1]);
+      vo0x0c0123456789ABCDEF = _mm512_fmadd_ps(_mm512_load_ps(w + 160), vi1c1, vo0x0c0123456789ABCDEF);
+      vo0x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(_mm512_load_ps(w + 176), vi1c1, vo0x0cGHIJKLMNOPQRSTUV);
+      const __m512 vi2c1 = _mm512_set1_ps(i2[1]);
+      vo0x0c0123456789ABCDEF = _mm512_fmadd_ps(_mm512_load_ps(w + 192), vi2c1, vo0x0c0123456789ABCDEF);
+      vo0x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(_mm512_load_ps(w + 208), vi2c1, vo0x0cGHIJKLMNOPQRSTUV);
+      vo1x0c0123456789ABCDEF = _mm512_fmadd_ps(_mm512_load_ps(w + 128), vi2c1, vo1x0c0123456789ABCDEF);
+      vo1x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(_mm512_load_ps(w + 144), vi2c1, vo1x0cGHIJKLMNOPQRSTUV);
+      const __m512 vi3c1 = _mm512_set1_ps(i3[1]);
+      vo1x0c0123456789ABCDEF = _mm512_fmadd_ps(_mm512_load_ps(w + 160), vi3c1, vo1x0c0123456789ABCDEF);
+      vo1x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(_mm512_load_ps(w + 176), vi3c1, vo1x0cGHIJKLMNOPQRSTUV);
+      const __m512 vi4c1 = _mm512_set1_ps(i4[1]);
+      vo1x0c0123456789ABCDEF = _mm512_fmadd_ps(_mm512_load_ps(w + 192), vi4c1, vo1x0c0123456789ABCDEF);
+      vo1x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(_mm512_load_ps(w + 208), vi4c1, vo1x0cGHIJKLMNOPQRSTUV);
+      const __m512 vi0c2 = _mm512_set1_ps(i0[2]);
+      vo0x0c0123456789ABCDEF = _mm512_fmadd_ps(_mm512_load_ps(w + 224), vi0c2, vo0x0c0123456789ABCDEF);
+      vo0x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(_mm512_load_ps(w + 240), vi0c2, vo0x0cGHIJKLMNOPQRSTUV);
+      const __m512 vi1c2 = _mm512_set1_ps(i1[2]);
+      vo0x0c0123456789ABCDEF = _mm512_fmadd_ps(_mm512_load_ps(w + 256), vi1c2, vo0x0c0123456789ABCDEF);
+      vo0x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(_mm512_load_ps(w + 272), vi1c2, vo0x0cGHIJKLMNOPQRSTUV);
+      const __m512 vi2c2 = _mm512_set1_ps(i2[2]);
+      vo0x0c0123456789ABCDEF = _mm512_fmadd_ps(_mm512_load_ps(w + 288), vi2c2, vo0x0c0123456789ABCDEF);
+      vo0x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(_mm512_load_ps(w + 304), vi2c2, vo0x0cGHIJKLMNOPQRSTUV);
+      vo1x0c0123456789ABCDEF = _mm512_fmadd_ps(_mm512_load_ps(w + 224), vi2c2, vo1x0c0123456789ABCDEF);
+      vo1x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(_mm512_load_ps(w + 240), vi2c2, vo1x0cGHIJKLMNOPQRSTUV);
+      const __m512 vi3c2 = _mm512_set1_ps(i3[2]);
+      vo1x0c0123456789ABCDEF = _mm512_fmadd_ps(_mm512_load_ps(w + 256), vi3c2, vo1x0c0123456789ABCDEF);
+      vo1x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(_mm512_load_ps(w + 272), vi3c2, vo1x0cGHIJKLMNOPQRSTUV);
+      const __m512 vi4c2 = _mm512_set1_ps(i4[2]);
+      vo1x0c0123456789ABCDEF = _mm512_fmadd_ps(_mm512_load_ps(w + 288), vi4c2, vo1x0c0123456789ABCDEF);
+      vo1x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(_mm512_load_ps(w + 304), vi4c2, vo1x0cGHIJKLMNOPQRSTUV);
+
+      size_t iw = input_width - 1;
+      for (; iw >= 4; iw -= 4) {
+        __m512 vo0x1c0123456789ABCDEF = _mm512_load_ps(w + 0);
+        __m512 vo0x1cGHIJKLMNOPQRSTUV = _mm512_load_ps(w + 16);
+        __m512 vo1x1c0123456789ABCDEF = vo0x1c0123456789ABCDEF;
+        __m512 vo1x1cGHIJKLMNOPQRSTUV = vo0x1cGHIJKLMNOPQRSTUV;
+        __m512 vo0x2c0123456789ABCDEF = vo0x1c0123456789ABCDEF;
+        __m512 vo0x2cGHIJKLMNOPQRSTUV = vo0x1cGHIJKLMNOPQRSTUV;
+        __m512 vo1x2c0123456789ABCDEF = vo0x1c0123456789ABCDEF;
+        __m512 vo1x2cGHIJKLMNOPQRSTUV = vo0x1cGHIJKLMNOPQRSTUV;
+
+        const __m512 vk01c0x0123456789ABCDEF = _mm512_load_ps(w + 320);
+        const __m512 vk01c0xGHIJKLMNOPQRSTUV = _mm512_load_ps(w + 336);
+        const __m512 vk11c0x0123456789ABCDEF = _mm512_load_ps(w + 352);
+        const __m512 vk11c0xGHIJKLMNOPQRSTUV = _mm512_load_ps(w + 368);
+        const __m512 vk21c0x0123456789ABCDEF = _mm512_load_ps(w + 384);
+        const __m512 vk21c0xGHIJKLMNOPQRSTUV = _mm512_load_ps(w + 400);
+
+        const __m512 vi0x0c0 = _mm512_set1_ps(i0[3]);
+        const __m512 vi0x2c0 = _mm512_set1_ps(i0[9]);
+        vo0x0c0123456789ABCDEF = _mm512_fmadd_ps(vk01c0x0123456789ABCDEF, vi0x0c0, vo0x0c0123456789ABCDEF);
+        vo0x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk01c0xGHIJKLMNOPQRSTUV, vi0x0c0, vo0x0cGHIJKLMNOPQRSTUV);
+        vo0x1c0123456789ABCDEF = _mm512_fmadd_ps(vk01c0x0123456789ABCDEF, vi0x2c0, vo0x1c0123456789ABCDEF);
+        vo0x1cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk01c0xGHIJKLMNOPQRSTUV, vi0x2c0, vo0x1cGHIJKLMNOPQRSTUV);
+        const __m512 vi1x0c0 = _mm512_set1_ps(i1[3]);
+        const __m512 vi1x2c0 = _mm512_set1_ps(i1[9]);
+        vo0x0c0123456789ABCDEF = _mm512_fmadd_ps(vk11c0x0123456789ABCDEF, vi1x0c0, vo0x0c0123456789ABCDEF);
+        vo0x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk11c0xGHIJKLMNOPQRSTUV, vi1x0c0, vo0x0cGHIJKLMNOPQRSTUV);
+        vo0x1c0123456789ABCDEF = _mm512_fmadd_ps(vk11c0x0123456789ABCDEF, vi1x2c0, vo0x1c0123456789ABCDEF);
+        vo0x1cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk11c0xGHIJKLMNOPQRSTUV, vi1x2c0, vo0x1cGHIJKLMNOPQRSTUV);
+        const __m512 vi2x0c0 = _mm512_set1_ps(i2[3]);
+        const __m512 vi2x2c0 = _mm512_set1_ps(i2[9]);
+        vo0x0c0123456789ABCDEF = _mm512_fmadd_ps(vk21c0x0123456789ABCDEF, vi2x0c0, vo0x0c0123456789ABCDEF);
+        vo0x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk21c0xGHIJKLMNOPQRSTUV, vi2x0c0, vo0x0cGHIJKLMNOPQRSTUV);
+        vo0x1c0123456789ABCDEF = _mm512_fmadd_ps(vk21c0x0123456789ABCDEF, vi2x2c0, vo0x1c0123456789ABCDEF);
+        vo0x1cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk21c0xGHIJKLMNOPQRSTUV, vi2x2c0, vo0x1cGHIJKLMNOPQRSTUV);
+        vo1x0c0123456789ABCDEF = _mm512_fmadd_ps(vk01c0x0123456789ABCDEF, vi2x0c0, vo1x0c0123456789ABCDEF);
+        vo1x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk01c0xGHIJKLMNOPQRSTUV, vi2x0c0, vo1x0cGHIJKLMNOPQRSTUV);
+        vo1x1c0123456789ABCDEF = _mm512_fmadd_ps(vk01c0x0123456789ABCDEF, vi2x2c0, vo1x1c0123456789ABCDEF);
+        vo1x1cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk01c0xGHIJKLMNOPQRSTUV, vi2x2c0, vo1x1cGHIJKLMNOPQRSTUV);
+        const __m512 vi3x0c0 = _mm512_set1_ps(i3[3]);
+        const __m512 vi3x2c0 = _mm512_set1_ps(i3[9]);
+        vo1x0c0123456789ABCDEF = _mm512_fmadd_ps(vk11c0x0123456789ABCDEF, vi3x0c0, vo1x0c0123456789ABCDEF);
+        vo1x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk11c0xGHIJKLMNOPQRSTUV, vi3x0c0, vo1x0cGHIJKLMNOPQRSTUV);
+        vo1x1c0123456789ABCDEF = _mm512_fmadd_ps(vk11c0x0123456789ABCDEF, vi3x2c0, vo1x1c0123456789ABCDEF);
+        vo1x1cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk11c0xGHIJKLMNOPQRSTUV, vi3x2c0, vo1x1cGHIJKLMNOPQRSTUV);
+        const __m512 vi4x0c0 = _mm512_set1_ps(i4[3]);
+        const __m512 vi4x2c0 = _mm512_set1_ps(i4[9]);
+        vo1x0c0123456789ABCDEF = _mm512_fmadd_ps(vk21c0x0123456789ABCDEF, vi4x0c0, vo1x0c0123456789ABCDEF);
+        vo1x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk21c0xGHIJKLMNOPQRSTUV, vi4x0c0, vo1x0cGHIJKLMNOPQRSTUV);
+        vo1x1c0123456789ABCDEF = _mm512_fmadd_ps(vk21c0x0123456789ABCDEF, vi4x2c0, vo1x1c0123456789ABCDEF);
+        vo1x1cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk21c0xGHIJKLMNOPQRSTUV, vi4x2c0, vo1x1cGHIJKLMNOPQRSTUV);
+
+        const __m512 vk02c0x0123456789ABCDEF = _mm512_load_ps(w + 608);
+        const __m512 vk02c0xGHIJKLMNOPQRSTUV = _mm512_load_ps(w + 624);
+        const __m512 vk12c0x0123456789ABCDEF = _mm512_load_ps(w + 640);
+        const __m512 vk12c0xGHIJKLMNOPQRSTUV = _mm512_load_ps(w + 656);
+        const __m512 vk22c0x0123456789ABCDEF = _mm512_load_ps(w + 672);
+        const __m512 vk22c0xGHIJKLMNOPQRSTUV = _mm512_load_ps(w + 688);
+        const __m512 vk00c0x0123456789ABCDEF = _mm512_load_ps(w + 32);
+        const __m512 vk00c0xGHIJKLMNOPQRSTUV = _mm512_load_ps(w + 48);
+        const __m512 vk10c0x0123456789ABCDEF = _mm512_load_ps(w + 64);
+        const __m512 vk10c0xGHIJKLMNOPQRSTUV = _mm512_load_ps(w + 80);
+        const __m512 vk20c0x0123456789ABCDEF = _mm512_load_ps(w + 96);
+        const __m512 vk20c0xGHIJKLMNOPQRSTUV = _mm512_load_ps(w + 112);
+
+        const __m512 vi0x1c0 = _mm512_set1_ps(i0[6]);
+        const __m512 vi0x3c0 = _mm512_set1_ps(i0[12]);
+        vo0x0c0123456789ABCDEF = _mm512_fmadd_ps(vk02c0x0123456789ABCDEF, vi0x1c0, vo0x0c0123456789ABCDEF);
+        vo0x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk02c0xGHIJKLMNOPQRSTUV, vi0x1c0, vo0x0cGHIJKLMNOPQRSTUV);
+        vo0x1c0123456789ABCDEF = _mm512_fmadd_ps(vk00c0x0123456789ABCDEF, vi0x1c0, vo0x1c0123456789ABCDEF);
+        vo0x1cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk00c0xGHIJKLMNOPQRSTUV, vi0x1c0, vo0x1cGHIJKLMNOPQRSTUV);
+        vo0x1c0123456789ABCDEF = _mm512_fmadd_ps(vk02c0x0123456789ABCDEF, vi0x3c0, vo0x1c0123456789ABCDEF);
+        vo0x1cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk02c0xGHIJKLMNOPQRSTUV, vi0x3c0, vo0x1cGHIJKLMNOPQRSTUV);
+        vo0x2c0123456789ABCDEF = _mm512_fmadd_ps(vk00c0x0123456789ABCDEF, vi0x3c0, vo0x2c0123456789ABCDEF);
+        vo0x2cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk00c0xGHIJKLMNOPQRSTUV, vi0x3c0, vo0x2cGHIJKLMNOPQRSTUV);
+        const __m512 vi1x1c0 = _mm512_set1_ps(i1[6]);
+        const __m512 vi1x3c0 = _mm512_set1_ps(i1[12]);
+        vo0x0c0123456789ABCDEF = _mm512_fmadd_ps(vk12c0x0123456789ABCDEF, vi1x1c0, vo0x0c0123456789ABCDEF);
+        vo0x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk12c0xGHIJKLMNOPQRSTUV, vi1x1c0, vo0x0cGHIJKLMNOPQRSTUV);
+        vo0x1c0123456789ABCDEF = _mm512_fmadd_ps(vk10c0x0123456789ABCDEF, vi1x1c0, vo0x1c0123456789ABCDEF);
+        vo0x1cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk10c0xGHIJKLMNOPQRSTUV, vi1x1c0, vo0x1cGHIJKLMNOPQRSTUV);
+        vo0x1c0123456789ABCDEF = _mm512_fmadd_ps(vk12c0x0123456789ABCDEF, vi1x3c0, vo0x1c0123456789ABCDEF);
+        vo0x1cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk12c0xGHIJKLMNOPQRSTUV, vi1x3c0, vo0x1cGHIJKLMNOPQRSTUV);
+        vo0x2c0123456789ABCDEF = _mm512_fmadd_ps(vk10c0x0123456789ABCDEF, vi1x3c0, vo0x2c0123456789ABCDEF);
+        vo0x2cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk10c0xGHIJKLMNOPQRSTUV, vi1x3c0, vo0x2cGHIJKLMNOPQRSTUV);
+        const __m512 vi2x1c0 = _mm512_set1_ps(i2[6]);
+        const __m512 vi2x3c0 = _mm512_set1_ps(i2[12]);
+        vo0x0c0123456789ABCDEF = _mm512_fmadd_ps(vk22c0x0123456789ABCDEF, vi2x1c0, vo0x0c0123456789ABCDEF);
+        vo0x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk22c0xGHIJKLMNOPQRSTUV, vi2x1c0, vo0x0cGHIJKLMNOPQRSTUV);
+        vo0x1c0123456789ABCDEF = _mm512_fmadd_ps(vk20c0x0123456789ABCDEF, vi2x1c0, vo0x1c0123456789ABCDEF);
+        vo0x1cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk20c0xGHIJKLMNOPQRSTUV, vi2x1c0, vo0x1cGHIJKLMNOPQRSTUV);
+        vo0x1c0123456789ABCDEF = _mm512_fmadd_ps(vk22c0x0123456789ABCDEF, vi2x3c0, vo0x1c0123456789ABCDEF);
+        vo0x1cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk22c0xGHIJKLMNOPQRSTUV, vi2x3c0, vo0x1cGHIJKLMNOPQRSTUV);
+        vo0x2c0123456789ABCDEF = _mm512_fmadd_ps(vk20c0x0123456789ABCDEF, vi2x3c0, vo0x2c0123456789ABCDEF);
+        vo0x2cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk20c0xGHIJKLMNOPQRSTUV, vi2x3c0, vo0x2cGHIJKLMNOPQRSTUV);
+        vo1x0c0123456789ABCDEF = _mm512_fmadd_ps(vk02c0x0123456789ABCDEF, vi2x1c0, vo1x0c0123456789ABCDEF);
+        vo1x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk02c0xGHIJKLMNOPQRSTUV, vi2x1c0, vo1x0cGHIJKLMNOPQRSTUV);
+        vo1x1c0123456789ABCDEF = _mm512_fmadd_ps(vk00c0x0123456789ABCDEF, vi2x1c0, vo1x1c0123456789ABCDEF);
+        vo1x1cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk00c0xGHIJKLMNOPQRSTUV, vi2x1c0, vo1x1cGHIJKLMNOPQRSTUV);
+        vo1x1c0123456789ABCDEF = _mm512_fmadd_ps(vk02c0x0123456789ABCDEF, vi2x3c0, vo1x1c0123456789ABCDEF);
+        vo1x1cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk02c0xGHIJKLMNOPQRSTUV, vi2x3c0, vo1x1cGHIJKLMNOPQRSTUV);
+        vo1x2c0123456789ABCDEF = _mm512_fmadd_ps(vk00c0x0123456789ABCDEF, vi2x3c0, vo1x2c0123456789ABCDEF);
+        vo1x2cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk00c0xGHIJKLMNOPQRSTUV, vi2x3c0, vo1x2cGHIJKLMNOPQRSTUV);
+        const __m512 vi3x1c0 = _mm512_set1_ps(i3[6]);
+        const __m512 vi3x3c0 = _mm512_set1_ps(i3[12]);
+        vo1x0c0123456789ABCDEF = _mm512_fmadd_ps(vk12c0x0123456789ABCDEF, vi3x1c0, vo1x0c0123456789ABCDEF);
+        vo1x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk12c0xGHIJKLMNOPQRSTUV, vi3x1c0, vo1x0cGHIJKLMNOPQRSTUV);
+        vo1x1c0123456789ABCDEF = _mm512_fmadd_ps(vk10c0x0123456789ABCDEF, vi3x1c0, vo1x1c0123456789ABCDEF);
+        vo1x1cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk10c0xGHIJKLMNOPQRSTUV, vi3x1c0, vo1x1cGHIJKLMNOPQRSTUV);
+        vo1x1c0123456789ABCDEF = _mm512_fmadd_ps(vk12c0x0123456789ABCDEF, vi3x3c0, vo1x1c0123456789ABCDEF);
+        vo1x1cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk12c0xGHIJKLMNOPQRSTUV, vi3x3c0, vo1x1cGHIJKLMNOPQRSTUV);
+        vo1x2c0123456789ABCDEF = _mm512_fmadd_ps(vk10c0x0123456789ABCDEF, vi3x3c0, vo1x2c0123456789ABCDEF);
+        vo1x2cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk10c0xGHIJKLMNOPQRSTUV, vi3x3c0, vo1x2cGHIJKLMNOPQRSTUV);
+        const __m512 vi4x1c0 = _mm512_set1_ps(i4[6]);
+        const __m512 vi4x3c0 = _mm512_set1_ps(i4[12]);
+        vo1x0c0123456789ABCDEF = _mm512_fmadd_ps(vk22c0x0123456789ABCDEF, vi4x1c0, vo1x0c0123456789ABCDEF);
+        vo1x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk22c0xGHIJKLMNOPQRSTUV, vi4x1c0, vo1x0cGHIJKLMNOPQRSTUV);
+        vo1x1c0123456789ABCDEF = _mm512_fmadd_ps(vk20c0x0123456789ABCDEF, vi4x1c0, vo1x1c0123456789ABCDEF);
+        vo1x1cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk20c0xGHIJKLMNOPQRSTUV, vi4x1c0, vo1x1cGHIJKLMNOPQRSTUV);
+        vo1x1c0123456789ABCDEF = _mm512_fmadd_ps(vk22c0x0123456789ABCDEF, vi4x3c0, vo1x1c0123456789ABCDEF);
+        vo1x1cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk22c0xGHIJKLMNOPQRSTUV, vi4x3c0, vo1x1cGHIJKLMNOPQRSTUV);
+        vo1x2c0123456789ABCDEF = _mm512_fmadd_ps(vk20c0x0123456789ABCDEF, vi4x3c0, vo1x2c0123456789ABCDEF);
+        vo1x2cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk20c0xGHIJKLMNOPQRSTUV, vi4x3c0, vo1x2cGHIJKLMNOPQRSTUV);
+        const __m512 vk01c1x0123456789ABCDEF = _mm512_load_ps(w + 416);
+        const __m512 vk01c1xGHIJKLMNOPQRSTUV = _mm512_load_ps(w + 432);
+        const __m512 vk11c1x0123456789ABCDEF = _mm512_load_ps(w + 448);
+        const __m512 vk11c1xGHIJKLMNOPQRSTUV = _mm512_load_ps(w + 464);
+        const __m512 vk21c1x0123456789ABCDEF = _mm512_load_ps(w + 480);
+        const __m512 vk21c1xGHIJKLMNOPQRSTUV = _mm512_load_ps(w + 496);
+
+        const __m512 vi0x0c1 = _mm512_set1_ps(i0[4]);
+        const __m512 vi0x2c1 = _mm512_set1_ps(i0[10]);
+        vo0x0c0123456789ABCDEF = _mm512_fmadd_ps(vk01c1x0123456789ABCDEF, vi0x0c1, vo0x0c0123456789ABCDEF);
+        vo0x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk01c1xGHIJKLMNOPQRSTUV, vi0x0c1, vo0x0cGHIJKLMNOPQRSTUV);
+        vo0x1c0123456789ABCDEF = _mm512_fmadd_ps(vk01c1x0123456789ABCDEF, vi0x2c1, vo0x1c0123456789ABCDEF);
+        vo0x1cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk01c1xGHIJKLMNOPQRSTUV, vi0x2c1, vo0x1cGHIJKLMNOPQRSTUV);
+        const __m512 vi1x0c1 = _mm512_set1_ps(i1[4]);
+        const __m512 vi1x2c1 = _mm512_set1_ps(i1[10]);
+        vo0x0c0123456789ABCDEF = _mm512_fmadd_ps(vk11c1x0123456789ABCDEF, vi1x0c1, vo0x0c0123456789ABCDEF);
+        vo0x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk11c1xGHIJKLMNOPQRSTUV, vi1x0c1, vo0x0cGHIJKLMNOPQRSTUV);
+        vo0x1c0123456789ABCDEF = _mm512_fmadd_ps(vk11c1x0123456789ABCDEF, vi1x2c1, vo0x1c0123456789ABCDEF);
+        vo0x1cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk11c1xGHIJKLMNOPQRSTUV, vi1x2c1, vo0x1cGHIJKLMNOPQRSTUV);
+        const __m512 vi2x0c1 = _mm512_set1_ps(i2[4]);
+        const __m512 vi2x2c1 = _mm512_set1_ps(i2[10]);
+        vo0x0c0123456789ABCDEF = _mm512_fmadd_ps(vk21c1x0123456789ABCDEF, vi2x0c1, vo0x0c0123456789ABCDEF);
+        vo0x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk21c1xGHIJKLMNOPQRSTUV, vi2x0c1, vo0x0cGHIJKLMNOPQRSTUV);
+        vo0x1c0123456789ABCDEF = _mm512_fmadd_ps(vk21c1x0123456789ABCDEF, vi2x2c1, vo0x1c0123456789ABCDEF);
+        vo0x1cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk21c1xGHIJKLMNOPQRSTUV, vi2x2c1, vo0x1cGHIJKLMNOPQRSTUV);
+        vo1x0c0123456789ABCDEF = _mm512_fmadd_ps(vk01c1x0123456789ABCDEF, vi2x0c1, vo1x0c0123456789ABCDEF);
+        vo1x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk01c1xGHIJKLMNOPQRSTUV, vi2x0c1, vo1x0cGHIJKLMNOPQRSTUV);
+        vo1x1c0123456789ABCDEF = _mm512_fmadd_ps(vk01c1x0123456789ABCDEF, vi2x2c1, vo1x1c0123456789ABCDEF);
+        vo1x1cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk01c1xGHIJKLMNOPQRSTUV, vi2x2c1, vo1x1cGHIJKLMNOPQRSTUV);
+        const __m512 vi3x0c1 = _mm512_set1_ps(i3[4]);
+        const __m512 vi3x2c1 = _mm512_set1_ps(i3[10]);
+        vo1x0c0123456789ABCDEF = _mm512_fmadd_ps(vk11c1x0123456789ABCDEF, vi3x0c1, vo1x0c0123456789ABCDEF);
+        vo1x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk11c1xGHIJKLMNOPQRSTUV, vi3x0c1, vo1x0cGHIJKLMNOPQRSTUV);
+        vo1x1c0123456789ABCDEF = _mm512_fmadd_ps(vk11c1x0123456789ABCDEF, vi3x2c1, vo1x1c0123456789ABCDEF);
+        vo1x1cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk11c1xGHIJKLMNOPQRSTUV, vi3x2c1, vo1x1cGHIJKLMNOPQRSTUV);
+        const __m512 vi4x0c1 = _mm512_set1_ps(i4[4]);
+        const __m512 vi4x2c1 = _mm512_set1_ps(i4[10]);
+        vo1x0c0123456789ABCDEF = _mm512_fmadd_ps(vk21c1x0123456789ABCDEF, vi4x0c1, vo1x0c0123456789ABCDEF);
+        vo1x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk21c1xGHIJKLMNOPQRSTUV, vi4x0c1, vo1x0cGHIJKLMNOPQRSTUV);
+        vo1x1c0123456789ABCDEF = _mm512_fmadd_ps(vk21c1x0123456789ABCDEF, vi4x2c1, vo1x1c0123456789ABCDEF);
+        vo1x1cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk21c1xGHIJKLMNOPQRSTUV, vi4x2c1, vo1x1cGHIJKLMNOPQRSTUV);
+
+        const __m512 vk02c1x0123456789ABCDEF = _mm512_load_ps(w + 704);
+        const __m512 vk02c1xGHIJKLMNOPQRSTUV = _mm512_load_ps(w + 720);
+        const __m512 vk12c1x0123456789ABCDEF = _mm512_load_ps(w + 736);
+        const __m512 vk12c1xGHIJKLMNOPQRSTUV = _mm512_load_ps(w + 752);
+        const __m512 vk22c1x0123456789ABCDEF = _mm512_load_ps(w + 768);
+        const __m512 vk22c1xGHIJKLMNOPQRSTUV = _mm512_load_ps(w + 784);
+        const __m512 vk00c1x0123456789ABCDEF = _mm512_load_ps(w + 128);
+        const __m512 vk00c1xGHIJKLMNOPQRSTUV = _mm512_load_ps(w + 144);
+        const __m512 vk10c1x0123456789ABCDEF = _mm512_load_ps(w + 160);
+        const __m512 vk10c1xGHIJKLMNOPQRSTUV = _mm512_load_ps(w + 176);
+        const __m512 vk20c1x0123456789ABCDEF = _mm512_load_ps(w + 192);
+        const __m512 vk20c1xGHIJKLMNOPQRSTUV = _mm512_load_ps(w + 208);
+
+        const __m512 vi0x1c1 = _mm512_set1_ps(i0[7]);
+        const __m512 vi0x3c1 = _mm512_set1_ps(i0[13]);
+        vo0x0c0123456789ABCDEF = _mm512_fmadd_ps(vk02c1x0123456789ABCDEF, vi0x1c1, vo0x0c0123456789ABCDEF);
+        vo0x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk02c1xGHIJKLMNOPQRSTUV, vi0x1c1, vo0x0cGHIJKLMNOPQRSTUV);
+        vo0x1c0123456789ABCDEF = _mm512_fmadd_ps(vk00c1x0123456789ABCDEF, vi0x1c1, vo0x1c0123456789ABCDEF);
+        vo0x1cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk00c1xGHIJKLMNOPQRSTUV, vi0x1c1, vo0x1cGHIJKLMNOPQRSTUV);
+        vo0x1c0123456789ABCDEF = _mm512_fmadd_ps(vk02c1x0123456789ABCDEF, vi0x3c1, vo0x1c0123456789ABCDEF);
+        vo0x1cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk02c1xGHIJKLMNOPQRSTUV, vi0x3c1, vo0x1cGHIJKLMNOPQRSTUV);
+        vo0x2c0123456789ABCDEF = _mm512_fmadd_ps(vk00c1x0123456789ABCDEF, vi0x3c1, vo0x2c0123456789ABCDEF);
+        vo0x2cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk00c1xGHIJKLMNOPQRSTUV, vi0x3c1, vo0x2cGHIJKLMNOPQRSTUV);
+        const __m512 vi1x1c1 = _mm512_set1_ps(i1[7]);
+        const __m512 vi1x3c1 = _mm512_set1_ps(i1[13]);
+        vo0x0c0123456789ABCDEF = _mm512_fmadd_ps(vk12c1x0123456789ABCDEF, vi1x1c1, vo0x0c0123456789ABCDEF);
+        vo0x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk12c1xGHIJKLMNOPQRSTUV, vi1x1c1, vo0x0cGHIJKLMNOPQRSTUV);
+        vo0x1c0123456789ABCDEF = _mm512_fmadd_ps(vk10c1x0123456789ABCDEF, vi1x1c1, vo0x1c0123456789ABCDEF);
+        vo0x1cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk10c1xGHIJKLMNOPQRSTUV, vi1x1c1, vo0x1cGHIJKLMNOPQRSTUV);
+        vo0x1c0123456789ABCDEF = _mm512_fmadd_ps(vk12c1x0123456789ABCDEF, vi1x3c1, vo0x1c0123456789ABCDEF);
+        vo0x1cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk12c1xGHIJKLMNOPQRSTUV, vi1x3c1, vo0x1cGHIJKLMNOPQRSTUV);
+        vo0x2c0123456789ABCDEF = _mm512_fmadd_ps(vk10c1x0123456789ABCDEF, vi1x3c1, vo0x2c0123456789ABCDEF);
+        vo0x2cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk10c1xGHIJKLMNOPQRSTUV, vi1x3c1, vo0x2cGHIJKLMNOPQRSTUV);
+        const __m512 vi2x1c1 = _mm512_set1_ps(i2[7]);
+        const __m512 vi2x3c1 = _mm512_set1_ps(i2[13]);
+        vo0x0c0123456789ABCDEF = _mm512_fmadd_ps(vk22c1x0123456789ABCDEF, vi2x1c1, vo0x0c0123456789ABCDEF);
+        vo0x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk22c1xGHIJKLMNOPQRSTUV, vi2x1c1, vo0x0cGHIJKLMNOPQRSTUV);
+        vo0x1c0123456789ABCDEF = _mm512_fmadd_ps(vk20c1x0123456789ABCDEF, vi2x1c1, vo0x1c0123456789ABCDEF);
+        vo0x1cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk20c1xGHIJKLMNOPQRSTUV, vi2x1c1, vo0x1cGHIJKLMNOPQRSTUV);
+        vo0x1c0123456789ABCDEF = _mm512_fmadd_ps(vk22c1x0123456789ABCDEF, vi2x3c1, vo0x1c0123456789ABCDEF);
+        vo0x1cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk22c1xGHIJKLMNOPQRSTUV, vi2x3c1, vo0x1cGHIJKLMNOPQRSTUV);
+        vo0x2c0123456789ABCDEF = _mm512_fmadd_ps(vk20c1x0123456789ABCDEF, vi2x3c1, vo0x2c0123456789ABCDEF);
+        vo0x2cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk20c1xGHIJKLMNOPQRSTUV, vi2x3c1, vo0x2cGHIJKLMNOPQRSTUV);
+        vo1x0c0123456789ABCDEF = _mm512_fmadd_ps(vk02c1x0123456789ABCDEF, vi2x1c1, vo1x0c0123456789ABCDEF);
+        vo1x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk02c1xGHIJKLMNOPQRSTUV, vi2x1c1, vo1x0cGHIJKLMNOPQRSTUV);
+        vo1x1c0123456789ABCDEF = _mm512_fmadd_ps(vk00c1x0123456789ABCDEF, vi2x1c1, vo1x1c0123456789ABCDEF);
+        vo1x1cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk00c1xGHIJKLMNOPQRSTUV, vi2x1c1, vo1x1cGHIJKLMNOPQRSTUV);
+        vo1x1c0123456789ABCDEF = _mm512_fmadd_ps(vk02c1x0123456789ABCDEF, vi2x3c1, vo1x1c0123456789ABCDEF);
+        vo1x1cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk02c1xGHIJKLMNOPQRSTUV, vi2x3c1, vo1x1cGHIJKLMNOPQRSTUV);
+        vo1x2c0123456789ABCDEF = _mm512_fmadd_ps(vk00c1x0123456789ABCDEF, vi2x3c1, vo1x2c0123456789ABCDEF);
+        vo1x2cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk00c1xGHIJKLMNOPQRSTUV, vi2x3c1, vo1x2cGHIJKLMNOPQRSTUV);
+        const __m512 vi3x1c1 = _mm512_set1_ps(i3[7]);
+        const __m512 vi3x3c1 = _mm512_set1_ps(i3[13]);
+        vo1x0c0123456789ABCDEF = _mm512_fmadd_ps(vk12c1x0123456789ABCDEF, vi3x1c1, vo1x0c0123456789ABCDEF);
+        vo1x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk12c1xGHIJKLMNOPQRSTUV, vi3x1c1, vo1x0cGHIJKLMNOPQRSTUV);
+        vo1x1c0123456789ABCDEF = _mm512_fmadd_ps(vk10c1x0123456789ABCDEF, vi3x1c1, vo1x1c0123456789ABCDEF);
+        vo1x1cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk10c1xGHIJKLMNOPQRSTUV, vi3x1c1, vo1x1cGHIJKLMNOPQRSTUV);
+        vo1x1c0123456789ABCDEF = _mm512_fmadd_ps(vk12c1x0123456789ABCDEF, vi3x3c1, vo1x1c0123456789ABCDEF);
+        vo1x1cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk12c1xGHIJKLMNOPQRSTUV, vi3x3c1, vo1x1cGHIJKLMNOPQRSTUV);
+        vo1x2c0123456789ABCDEF = _mm512_fmadd_ps(vk10c1x0123456789ABCDEF, vi3x3c1, vo1x2c0123456789ABCDEF);
+        vo1x2cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk10c1xGHIJKLMNOPQRSTUV, vi3x3c1, vo1x2cGHIJKLMNOPQRSTUV);
+        const __m512 vi4x1c1 = _mm512_set1_ps(i4[7]);
+        const __m512 vi4x3c1 = _mm512_set1_ps(i4[13]);
+        vo1x0c0123456789ABCDEF = _mm512_fmadd_ps(vk22c1x0123456789ABCDEF, vi4x1c1, vo1x0c0123456789ABCDEF);
+        vo1x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk22c1xGHIJKLMNOPQRSTUV, vi4x1c1, vo1x0cGHIJKLMNOPQRSTUV);
+        vo1x1c0123456789ABCDEF = _mm512_fmadd_ps(vk20c1x0123456789ABCDEF, vi4x1c1, vo1x1c0123456789ABCDEF);
+        vo1x1cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk20c1xGHIJKLMNOPQRSTUV, vi4x1c1, vo1x1cGHIJKLMNOPQRSTUV);
+        vo1x1c0123456789ABCDEF = _mm512_fmadd_ps(vk22c1x0123456789ABCDEF, vi4x3c1, vo1x1c0123456789ABCDEF);
+        vo1x1cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk22c1xGHIJKLMNOPQRSTUV, vi4x3c1, vo1x1cGHIJKLMNOPQRSTUV);
+        vo1x2c0123456789ABCDEF = _mm512_fmadd_ps(vk20c1x0123456789ABCDEF, vi4x3c1, vo1x2c0123456789ABCDEF);
+        vo1x2cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk20c1xGHIJKLMNOPQRSTUV, vi4x3c1, vo1x2cGHIJKLMNOPQRSTUV);
+        const __m512 vk01c2x0123456789ABCDEF = _mm512_load_ps(w + 512);
+        const __m512 vk01c2xGHIJKLMNOPQRSTUV = _mm512_load_ps(w + 528);
+        const __m512 vk11c2x0123456789ABCDEF = _mm512_load_ps(w + 544);
+        const __m512 vk11c2xGHIJKLMNOPQRSTUV = _mm512_load_ps(w + 560);
+        const __m512 vk21c2x0123456789ABCDEF = _mm512_load_ps(w + 576);
+        const __m512 vk21c2xGHIJKLMNOPQRSTUV = _mm512_load_ps(w + 592);
+
+        const __m512 vi0x0c2 = _mm512_set1_ps(i0[5]);
+        const __m512 vi0x2c2 = _mm512_set1_ps(i0[11]);
+        vo0x0c0123456789ABCDEF = _mm512_fmadd_ps(vk01c2x0123456789ABCDEF, vi0x0c2, vo0x0c0123456789ABCDEF);
+        vo0x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk01c2xGHIJKLMNOPQRSTUV, vi0x0c2, vo0x0cGHIJKLMNOPQRSTUV);
+        vo0x1c0123456789ABCDEF = _mm512_fmadd_ps(vk01c2x0123456789ABCDEF, vi0x2c2, vo0x1c0123456789ABCDEF);
+        vo0x1cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk01c2xGHIJKLMNOPQRSTUV, vi0x2c2, vo0x1cGHIJKLMNOPQRSTUV);
+        const __m512 vi1x0c2 = _mm512_set1_ps(i1[5]);
+        const __m512 vi1x2c2 = _mm512_set1_ps(i1[11]);
+        vo0x0c0123456789ABCDEF = _mm512_fmadd_ps(vk11c2x0123456789ABCDEF, vi1x0c2, vo0x0c0123456789ABCDEF);
+        vo0x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk11c2xGHIJKLMNOPQRSTUV, vi1x0c2, vo0x0cGHIJKLMNOPQRSTUV);
+        vo0x1c0123456789ABCDEF = _mm512_fmadd_ps(vk11c2x0123456789ABCDEF, vi1x2c2, vo0x1c0123456789ABCDEF);
+        vo0x1cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk11c2xGHIJKLMNOPQRSTUV, vi1x2c2, vo0x1cGHIJKLMNOPQRSTUV);
+        const __m512 vi2x0c2 = _mm512_set1_ps(i2[5]);
+        const __m512 vi2x2c2 = _mm512_set1_ps(i2[11]);
+        vo0x0c0123456789ABCDEF = _mm512_fmadd_ps(vk21c2x0123456789ABCDEF, vi2x0c2, vo0x0c0123456789ABCDEF);
+        vo0x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk21c2xGHIJKLMNOPQRSTUV, vi2x0c2, vo0x0cGHIJKLMNOPQRSTUV);
+        vo0x1c0123456789ABCDEF = _mm512_fmadd_ps(vk21c2x0123456789ABCDEF, vi2x2c2, vo0x1c0123456789ABCDEF);
+        vo0x1cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk21c2xGHIJKLMNOPQRSTUV, vi2x2c2, vo0x1cGHIJKLMNOPQRSTUV);
+        vo1x0c0123456789ABCDEF = _mm512_fmadd_ps(vk01c2x0123456789ABCDEF, vi2x0c2, vo1x0c0123456789ABCDEF);
+        vo1x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk01c2xGHIJKLMNOPQRSTUV, vi2x0c2, vo1x0cGHIJKLMNOPQRSTUV);
+        vo1x1c0123456789ABCDEF = _mm512_fmadd_ps(vk01c2x0123456789ABCDEF, vi2x2c2, vo1x1c0123456789ABCDEF);
+        vo1x1cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk01c2xGHIJKLMNOPQRSTUV, vi2x2c2, vo1x1cGHIJKLMNOPQRSTUV);
+        const __m512 vi3x0c2 = _mm512_set1_ps(i3[5]);
+        const __m512 vi3x2c2 = _mm512_set1_ps(i3[11]);
+        vo1x0c0123456789ABCDEF = _mm512_fmadd_ps(vk11c2x0123456789ABCDEF, vi3x0c2, vo1x0c0123456789ABCDEF);
+        vo1x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk11c2xGHIJKLMNOPQRSTUV, vi3x0c2, vo1x0cGHIJKLMNOPQRSTUV);
+        vo1x1c0123456789ABCDEF = _mm512_fmadd_ps(vk11c2x0123456789ABCDEF, vi3x2c2, vo1x1c0123456789ABCDEF);
+        vo1x1cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk11c2xGHIJKLMNOPQRSTUV, vi3x2c2, vo1x1cGHIJKLMNOPQRSTUV);
+        const __m512 vi4x0c2 = _mm512_set1_ps(i4[5]);
+        const __m512 vi4x2c2 = _mm512_set1_ps(i4[11]);
+        vo1x0c0123456789ABCDEF = _mm512_fmadd_ps(vk21c2x0123456789ABCDEF, vi4x0c2, vo1x0c0123456789ABCDEF);
+        vo1x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk21c2xGHIJKLMNOPQRSTUV, vi4x0c2, vo1x0cGHIJKLMNOPQRSTUV);
+        vo1x1c0123456789ABCDEF = _mm512_fmadd_ps(vk21c2x0123456789ABCDEF, vi4x2c2, vo1x1c0123456789ABCDEF);
+        vo1x1cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk21c2xGHIJKLMNOPQRSTUV, vi4x2c2, vo1x1cGHIJKLMNOPQRSTUV);
+
+        const __m512 vk02c2x0123456789ABCDEF = _mm512_load_ps(w + 800);
+        const __m512 vk02c2xGHIJKLMNOPQRSTUV = _mm512_load_ps(w + 816);
+        const __m512 vk12c2x0123456789ABCDEF = _mm512_load_ps(w + 832);
+        const __m512 vk12c2xGHIJKLMNOPQRSTUV = _mm512_load_ps(w + 848);
+        const __m512 vk22c2x0123456789ABCDEF = _mm512_load_ps(w + 864);
+        const __m512 vk22c2xGHIJKLMNOPQRSTUV = _mm512_load_ps(w + 880);
+        const __m512 vk00c2x0123456789ABCDEF = _mm512_load_ps(w + 224);
+        const __m512 vk00c2xGHIJKLMNOPQRSTUV = _mm512_load_ps(w + 240);
+        const __m512 vk10c2x0123456789ABCDEF = _mm512_load_ps(w + 256);
+        const __m512 vk10c2xGHIJKLMNOPQRSTUV = _mm512_load_ps(w + 272);
+        const __m512 vk20c2x0123456789ABCDEF = _mm512_load_ps(w + 288);
+        const __m512 vk20c2xGHIJKLMNOPQRSTUV = _mm512_load_ps(w + 304);
+
+        const __m512 vi0x1c2 = _mm512_set1_ps(i0[8]);
+        const __m512 vi0x3c2 = _mm512_set1_ps(i0[14]);
+        vo0x0c0123456789ABCDEF = _mm512_fmadd_ps(vk02c2x0123456789ABCDEF, vi0x1c2, vo0x0c0123456789ABCDEF);
+        vo0x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk02c2xGHIJKLMNOPQRSTUV, vi0x1c2, vo0x0cGHIJKLMNOPQRSTUV);
+        vo0x1c0123456789ABCDEF = _mm512_fmadd_ps(vk00c2x0123456789ABCDEF, vi0x1c2, vo0x1c0123456789ABCDEF);
+        vo0x1cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk00c2xGHIJKLMNOPQRSTUV, vi0x1c2, vo0x1cGHIJKLMNOPQRSTUV);
+        vo0x1c0123456789ABCDEF = _mm512_fmadd_ps(vk02c2x0123456789ABCDEF, vi0x3c2, vo0x1c0123456789ABCDEF);
+        vo0x1cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk02c2xGHIJKLMNOPQRSTUV, vi0x3c2, vo0x1cGHIJKLMNOPQRSTUV);
+        vo0x2c0123456789ABCDEF = _mm512_fmadd_ps(vk00c2x0123456789ABCDEF, vi0x3c2, vo0x2c0123456789ABCDEF);
+        vo0x2cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk00c2xGHIJKLMNOPQRSTUV, vi0x3c2, vo0x2cGHIJKLMNOPQRSTUV);
+        const __m512 vi1x1c2 = _mm512_set1_ps(i1[8]);
+        const __m512 vi1x3c2 = _mm512_set1_ps(i1[14]);
+        vo0x0c0123456789ABCDEF = _mm512_fmadd_ps(vk12c2x0123456789ABCDEF, vi1x1c2, vo0x0c0123456789ABCDEF);
+        vo0x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk12c2xGHIJKLMNOPQRSTUV, vi1x1c2, vo0x0cGHIJKLMNOPQRSTUV);
+        vo0x1c0123456789ABCDEF = _mm512_fmadd_ps(vk10c2x0123456789ABCDEF, vi1x1c2, vo0x1c0123456789ABCDEF);
+        vo0x1cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk10c2xGHIJKLMNOPQRSTUV, vi1x1c2, vo0x1cGHIJKLMNOPQRSTUV);
+        vo0x1c0123456789ABCDEF = _mm512_fmadd_ps(vk12c2x0123456789ABCDEF, vi1x3c2, vo0x1c0123456789ABCDEF);
+        vo0x1cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk12c2xGHIJKLMNOPQRSTUV, vi1x3c2, vo0x1cGHIJKLMNOPQRSTUV);
+        vo0x2c0123456789ABCDEF = _mm512_fmadd_ps(vk10c2x0123456789ABCDEF, vi1x3c2, vo0x2c0123456789ABCDEF);
+        vo0x2cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk10c2xGHIJKLMNOPQRSTUV, vi1x3c2, vo0x2cGHIJKLMNOPQRSTUV);
+        const __m512 vi2x1c2 = _mm512_set1_ps(i2[8]);
+        const __m512 vi2x3c2 = _mm512_set1_ps(i2[14]);
+        vo0x0c0123456789ABCDEF = _mm512_fmadd_ps(vk22c2x0123456789ABCDEF, vi2x1c2, vo0x0c0123456789ABCDEF);
+        vo0x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk22c2xGHIJKLMNOPQRSTUV, vi2x1c2, vo0x0cGHIJKLMNOPQRSTUV);
+        vo0x1c0123456789ABCDEF = _mm512_fmadd_ps(vk20c2x0123456789ABCDEF, vi2x1c2, vo0x1c0123456789ABCDEF);
+        vo0x1cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk20c2xGHIJKLMNOPQRSTUV, vi2x1c2, vo0x1cGHIJKLMNOPQRSTUV);
+        vo0x1c0123456789ABCDEF = _mm512_fmadd_ps(vk22c2x0123456789ABCDEF, vi2x3c2, vo0x1c0123456789ABCDEF);
+        vo0x1cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk22c2xGHIJKLMNOPQRSTUV, vi2x3c2, vo0x1cGHIJKLMNOPQRSTUV);
+        vo0x2c0123456789ABCDEF = _mm512_fmadd_ps(vk20c2x0123456789ABCDEF, vi2x3c2, vo0x2c0123456789ABCDEF);
+        vo0x2cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk20c2xGHIJKLMNOPQRSTUV, vi2x3c2, vo0x2cGHIJKLMNOPQRSTUV);
+        vo1x0c0123456789ABCDEF = _mm512_fmadd_ps(vk02c2x0123456789ABCDEF, vi2x1c2, vo1x0c0123456789ABCDEF);
+        vo1x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk02c2xGHIJKLMNOPQRSTUV, vi2x1c2, vo1x0cGHIJKLMNOPQRSTUV);
+        vo1x1c0123456789ABCDEF = _mm512_fmadd_ps(vk00c2x0123456789ABCDEF, vi2x1c2, vo1x1c0123456789ABCDEF);
+        vo1x1cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk00c2xGHIJKLMNOPQRSTUV, vi2x1c2, vo1x1cGHIJKLMNOPQRSTUV);
+        vo1x1c0123456789ABCDEF = _mm512_fmadd_ps(vk02c2x0123456789ABCDEF, vi2x3c2, vo1x1c0123456789ABCDEF);
+        vo1x1cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk02c2xGHIJKLMNOPQRSTUV, vi2x3c2, vo1x1cGHIJKLMNOPQRSTUV);
+        vo1x2c0123456789ABCDEF = _mm512_fmadd_ps(vk00c2x0123456789ABCDEF, vi2x3c2, vo1x2c0123456789ABCDEF);
+        vo1x2cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk00c2xGHIJKLMNOPQRSTUV, vi2x3c2, vo1x2cGHIJKLMNOPQRSTUV);
+        const __m512 vi3x1c2 = _mm512_set1_ps(i3[8]);
+        const __m512 vi3x3c2 = _mm512_set1_ps(i3[14]);
+        vo1x0c0123456789ABCDEF = _mm512_fmadd_ps(vk12c2x0123456789ABCDEF, vi3x1c2, vo1x0c0123456789ABCDEF);
+        vo1x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk12c2xGHIJKLMNOPQRSTUV, vi3x1c2, vo1x0cGHIJKLMNOPQRSTUV);
+        vo1x1c0123456789ABCDEF = _mm512_fmadd_ps(vk10c2x0123456789ABCDEF, vi3x1c2, vo1x1c0123456789ABCDEF);
+        vo1x1cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk10c2xGHIJKLMNOPQRSTUV, vi3x1c2, vo1x1cGHIJKLMNOPQRSTUV);
+        vo1x1c0123456789ABCDEF = _mm512_fmadd_ps(vk12c2x0123456789ABCDEF, vi3x3c2, vo1x1c0123456789ABCDEF);
+        vo1x1cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk12c2xGHIJKLMNOPQRSTUV, vi3x3c2, vo1x1cGHIJKLMNOPQRSTUV);
+        vo1x2c0123456789ABCDEF = _mm512_fmadd_ps(vk10c2x0123456789ABCDEF, vi3x3c2, vo1x2c0123456789ABCDEF);
+        vo1x2cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk10c2xGHIJKLMNOPQRSTUV, vi3x3c2, vo1x2cGHIJKLMNOPQRSTUV);
+        const __m512 vi4x1c2 = _mm512_set1_ps(i4[8]);
+        const __m512 vi4x3c2 = _mm512_set1_ps(i4[14]);
+        vo1x0c0123456789ABCDEF = _mm512_fmadd_ps(vk22c2x0123456789ABCDEF, vi4x1c2, vo1x0c0123456789ABCDEF);
+        vo1x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk22c2xGHIJKLMNOPQRSTUV, vi4x1c2, vo1x0cGHIJKLMNOPQRSTUV);
+        vo1x1c0123456789ABCDEF = _mm512_fmadd_ps(vk20c2x0123456789ABCDEF, vi4x1c2, vo1x1c0123456789ABCDEF);
+        vo1x1cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk20c2xGHIJKLMNOPQRSTUV, vi4x1c2, vo1x1cGHIJKLMNOPQRSTUV);
+        vo1x1c0123456789ABCDEF = _mm512_fmadd_ps(vk22c2x0123456789ABCDEF, vi4x3c2, vo1x1c0123456789ABCDEF);
+        vo1x1cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk22c2xGHIJKLMNOPQRSTUV, vi4x3c2, vo1x1cGHIJKLMNOPQRSTUV);
+        vo1x2c0123456789ABCDEF = _mm512_fmadd_ps(vk20c2x0123456789ABCDEF, vi4x3c2, vo1x2c0123456789ABCDEF);
+        vo1x2cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk20c2xGHIJKLMNOPQRSTUV, vi4x3c2, vo1x2cGHIJKLMNOPQRSTUV);
+
+        i0 += 12;
+        i1 += 12;
+        i2 += 12;
+        i3 += 12;
+        i4 += 12;
+
+        vo0x0c0123456789ABCDEF = _mm512_max_ps(vo0x0c0123456789ABCDEF, vmin);
+        vo0x0cGHIJKLMNOPQRSTUV = _mm512_max_ps(vo0x0cGHIJKLMNOPQRSTUV, vmin);
+        vo0x1c0123456789ABCDEF = _mm512_max_ps(vo0x1c0123456789ABCDEF, vmin);
+        vo0x1cGHIJKLMNOPQRSTUV = _mm512_max_ps(vo0x1cGHIJKLMNOPQRSTUV, vmin);
+        vo1x0c0123456789ABCDEF = _mm512_max_ps(vo1x0c0123456789ABCDEF, vmin);
+        vo1x0cGHIJKLMNOPQRSTUV = _mm512_max_ps(vo1x0cGHIJKLMNOPQRSTUV, vmin);
+        vo1x1c0123456789ABCDEF = _mm512_max_ps(vo1x1c0123456789ABCDEF, vmin);
+        vo1x1cGHIJKLMNOPQRSTUV = _mm512_max_ps(vo1x1cGHIJKLMNOPQRSTUV, vmin);
+        vo0x0c0123456789ABCDEF = _mm512_min_ps(vo0x0c0123456789ABCDEF, vmax);
+        vo0x0cGHIJKLMNOPQRSTUV = _mm512_min_ps(vo0x0cGHIJKLMNOPQRSTUV, vmax);
+        vo0x1c0123456789ABCDEF = _mm512_min_ps(vo0x1c0123456789ABCDEF, vmax);
+        vo0x1cGHIJKLMNOPQRSTUV = _mm512_min_ps(vo0x1cGHIJKLMNOPQRSTUV, vmax);
+        vo1x0c0123456789ABCDEF = _mm512_min_ps(vo1x0c0123456789ABCDEF, vmax);
+        vo1x0cGHIJKLMNOPQRSTUV = _mm512_min_ps(vo1x0cGHIJKLMNOPQRSTUV, vmax);
+        vo1x1c0123456789ABCDEF = _mm512_min_ps(vo1x1c0123456789ABCDEF, vmax);
+        vo1x1cGHIJKLMNOPQRSTUV = _mm512_min_ps(vo1x1cGHIJKLMNOPQRSTUV, vmax);
+
+        if XNN_LIKELY(c >= 32) {
+          _mm512_storeu_ps(o1, vo1x0c0123456789ABCDEF);
+          _mm512_storeu_ps(o1 + 16, vo1x0cGHIJKLMNOPQRSTUV);
+          o1 = (float*) ((uintptr_t) o1 + output_width_stride);
+          _mm512_storeu_ps(o1, vo1x1c0123456789ABCDEF);
+          _mm512_storeu_ps(o1 + 16, vo1x1cGHIJKLMNOPQRSTUV);
+          o1 = (float*) ((uintptr_t) o1 + output_width_stride);
+          _mm512_storeu_ps(o0, vo0x0c0123456789ABCDEF);
+          _mm512_storeu_ps(o0 + 16, vo0x0cGHIJKLMNOPQRSTUV);
+          o0 = (float*) ((uintptr_t) o0 + output_width_stride);
+          _mm512_storeu_ps(o0, vo0x1c0123456789ABCDEF);
+          _mm512_storeu_ps(o0 + 16, vo0x1cGHIJKLMNOPQRSTUV);
+          o0 = (float*) ((uintptr_t) o0 + output_width_stride);
+        } else {
+          float* o1_tmp = o1;
+          float* o0_tmp = o0;
+          if (c & 16) {
+            _mm512_storeu_ps((float*) ((uintptr_t) o1_tmp + output_width_stride * 1) + 0, vo1x1c0123456789ABCDEF);
+            _mm512_storeu_ps((float*) ((uintptr_t) o1_tmp + output_width_stride * 0) + 0, vo1x0c0123456789ABCDEF);
+            _mm512_storeu_ps((float*) ((uintptr_t) o0_tmp + output_width_stride * 1) + 0, vo0x1c0123456789ABCDEF);
+            _mm512_storeu_ps((float*) ((uintptr_t) o0_tmp + output_width_stride * 0) + 0, vo0x0c0123456789ABCDEF);
+            o1_tmp += 16;
+            o0_tmp += 16;
+            vo0x0c0123456789ABCDEF = vo0x0cGHIJKLMNOPQRSTUV;
+            vo0x1c0123456789ABCDEF = vo0x1cGHIJKLMNOPQRSTUV;
+            vo1x0c0123456789ABCDEF = vo1x0cGHIJKLMNOPQRSTUV;
+            vo1x1c0123456789ABCDEF = vo1x1cGHIJKLMNOPQRSTUV;
+          }
+          // Prepare mask for valid 32-bit elements (depends on c).
+          const __mmask16 vmask = _cvtu32_mask16((uint16_t) ((uint32_t) (UINT32_C(1) << (c & 15)) - UINT32_C(1)));
+          _mm512_mask_storeu_ps((float*) ((uintptr_t) o1_tmp + output_width_stride * 1), vmask, vo1x1c0123456789ABCDEF);
+          _mm512_mask_storeu_ps((float*) ((uintptr_t) o1_tmp + output_width_stride * 0), vmask, vo1x0c0123456789ABCDEF);
+          _mm512_mask_storeu_ps((float*) ((uintptr_t) o0_tmp + output_width_stride * 1), vmask, vo0x1c0123456789ABCDEF);
+          _mm512_mask_storeu_ps((float*) ((uintptr_t) o0_tmp + output_width_stride * 0), vmask, vo0x0c0123456789ABCDEF);
+          o1 = (float*) ((uintptr_t) o1 + output_width_stride * 2);
+          o0 = (float*) ((uintptr_t) o0 + output_width_stride * 2);
+        }
+
+        vo0x0c0123456789ABCDEF = vo0x2c0123456789ABCDEF;
+        vo0x0cGHIJKLMNOPQRSTUV = vo0x2cGHIJKLMNOPQRSTUV;
+        vo1x0c0123456789ABCDEF = vo1x2c0123456789ABCDEF;
+        vo1x0cGHIJKLMNOPQRSTUV = vo1x2cGHIJKLMNOPQRSTUV;
+      }
+      if (iw >= 2) {
+        __m512 vo0x1c0123456789ABCDEF = _mm512_load_ps(w + 0);
+        __m512 vo0x1cGHIJKLMNOPQRSTUV = _mm512_load_ps(w + 16);
+        __m512 vo1x1c0123456789ABCDEF = vo0x1c0123456789ABCDEF;
+        __m512 vo1x1cGHIJKLMNOPQRSTUV = vo0x1cGHIJKLMNOPQRSTUV;
+
+        const __m512 vk01c0x0123456789ABCDEF = _mm512_load_ps(w + 320);
+        const __m512 vk01c0xGHIJKLMNOPQRSTUV = _mm512_load_ps(w + 336);
+        const __m512 vk11c0x0123456789ABCDEF = _mm512_load_ps(w + 352);
+        const __m512 vk11c0xGHIJKLMNOPQRSTUV = _mm512_load_ps(w + 368);
+        const __m512 vk21c0x0123456789ABCDEF = _mm512_load_ps(w + 384);
+        const __m512 vk21c0xGHIJKLMNOPQRSTUV = _mm512_load_ps(w + 400);
+
+        const __m512 vi0x0c0 = _mm512_set1_ps(i0[3]);
+        vo0x0c0123456789ABCDEF = _mm512_fmadd_ps(vk01c0x0123456789ABCDEF, vi0x0c0, vo0x0c0123456789ABCDEF);
+        vo0x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk01c0xGHIJKLMNOPQRSTUV, vi0x0c0, vo0x0cGHIJKLMNOPQRSTUV);
+        const __m512 vi1x0c0 = _mm512_set1_ps(i1[3]);
+        vo0x0c0123456789ABCDEF = _mm512_fmadd_ps(vk11c0x0123456789ABCDEF, vi1x0c0, vo0x0c0123456789ABCDEF);
+        vo0x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk11c0xGHIJKLMNOPQRSTUV, vi1x0c0, vo0x0cGHIJKLMNOPQRSTUV);
+        const __m512 vi2x0c0 = _mm512_set1_ps(i2[3]);
+        vo0x0c0123456789ABCDEF = _mm512_fmadd_ps(vk21c0x0123456789ABCDEF, vi2x0c0, vo0x0c0123456789ABCDEF);
+        vo0x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk21c0xGHIJKLMNOPQRSTUV, vi2x0c0, vo0x0cGHIJKLMNOPQRSTUV);
+        vo1x0c0123456789ABCDEF = _mm512_fmadd_ps(vk01c0x0123456789ABCDEF, vi2x0c0, vo1x0c0123456789ABCDEF);
+        vo1x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk01c0xGHIJKLMNOPQRSTUV, vi2x0c0, vo1x0cGHIJKLMNOPQRSTUV);
+        const __m512 vi3x0c0 = _mm512_set1_ps(i3[3]);
+        vo1x0c0123456789ABCDEF = _mm512_fmadd_ps(vk11c0x0123456789ABCDEF, vi3x0c0, vo1x0c0123456789ABCDEF);
+        vo1x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk11c0xGHIJKLMNOPQRSTUV, vi3x0c0, vo1x0cGHIJKLMNOPQRSTUV);
+        const __m512 vi4x0c0 = _mm512_set1_ps(i4[3]);
+        vo1x0c0123456789ABCDEF = _mm512_fmadd_ps(vk21c0x0123456789ABCDEF, vi4x0c0, vo1x0c0123456789ABCDEF);
+        vo1x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk21c0xGHIJKLMNOPQRSTUV, vi4x0c0, vo1x0cGHIJKLMNOPQRSTUV);
+
+        const __m512 vk02c0x0123456789ABCDEF = _mm512_load_ps(w + 608);
+        const __m512 vk02c0xGHIJKLMNOPQRSTUV = _mm512_load_ps(w + 624);
+        const __m512 vk12c0x0123456789ABCDEF = _mm512_load_ps(w + 640);
+        const __m512 vk12c0xGHIJKLMNOPQRSTUV = _mm512_load_ps(w + 656);
+        const __m512 vk22c0x0123456789ABCDEF = _mm512_load_ps(w + 672);
+        const __m512 vk22c0xGHIJKLMNOPQRSTUV = _mm512_load_ps(w + 688);
+        const __m512 vk00c0x0123456789ABCDEF = _mm512_load_ps(w + 32);
+        const __m512 vk00c0xGHIJKLMNOPQRSTUV = _mm512_load_ps(w + 48);
+        const __m512 vk10c0x0123456789ABCDEF = _mm512_load_ps(w + 64);
+        const __m512 vk10c0xGHIJKLMNOPQRSTUV = _mm512_load_ps(w + 80);
+        const __m512 vk20c0x0123456789ABCDEF = _mm512_load_ps(w + 96);
+        const __m512 vk20c0xGHIJKLMNOPQRSTUV = _mm512_load_ps(w + 112);
+
+        const __m512 vi0x1c0 = _mm512_set1_ps(i0[6]);
+        vo0x0c0123456789ABCDEF = _mm512_fmadd_ps(vk02c0x0123456789ABCDEF, vi0x1c0, vo0x0c0123456789ABCDEF);
+        vo0x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk02c0xGHIJKLMNOPQRSTUV, vi0x1c0, vo0x0cGHIJKLMNOPQRSTUV);
+        vo0x1c0123456789ABCDEF = _mm512_fmadd_ps(vk00c0x0123456789ABCDEF, vi0x1c0, vo0x1c0123456789ABCDEF);
+        vo0x1cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk00c0xGHIJKLMNOPQRSTUV, vi0x1c0, vo0x1cGHIJKLMNOPQRSTUV);
+        const __m512 vi1x1c0 = _mm512_set1_ps(i1[6]);
+        vo0x0c0123456789ABCDEF = _mm512_fmadd_ps(vk12c0x0123456789ABCDEF, vi1x1c0, vo0x0c0123456789ABCDEF);
+        vo0x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk12c0xGHIJKLMNOPQRSTUV, vi1x1c0, vo0x0cGHIJKLMNOPQRSTUV);
+        vo0x1c0123456789ABCDEF = _mm512_fmadd_ps(vk10c0x0123456789ABCDEF, vi1x1c0, vo0x1c0123456789ABCDEF);
+        vo0x1cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk10c0xGHIJKLMNOPQRSTUV, vi1x1c0, vo0x1cGHIJKLMNOPQRSTUV);
+        const __m512 vi2x1c0 = _mm512_set1_ps(i2[6]);
+        vo0x0c0123456789ABCDEF = _mm512_fmadd_ps(vk22c0x0123456789ABCDEF, vi2x1c0, vo0x0c0123456789ABCDEF);
+        vo0x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk22c0xGHIJKLMNOPQRSTUV, vi2x1c0, vo0x0cGHIJKLMNOPQRSTUV);
+        vo0x1c0123456789ABCDEF = _mm512_fmadd_ps(vk20c0x0123456789ABCDEF, vi2x1c0, vo0x1c0123456789ABCDEF);
+        vo0x1cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk20c0xGHIJKLMNOPQRSTUV, vi2x1c0, vo0x1cGHIJKLMNOPQRSTUV);
+        vo1x0c0123456789ABCDEF = _mm512_fmadd_ps(vk02c0x0123456789ABCDEF, vi2x1c0, vo1x0c0123456789ABCDEF);
+        vo1x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk02c0xGHIJKLMNOPQRSTUV, vi2x1c0, vo1x0cGHIJKLMNOPQRSTUV);
+        vo1x1c0123456789ABCDEF = _mm512_fmadd_ps(vk00c0x0123456789ABCDEF, vi2x1c0, vo1x1c0123456789ABCDEF);
+        vo1x1cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk00c0xGHIJKLMNOPQRSTUV, vi2x1c0, vo1x1cGHIJKLMNOPQRSTUV);
+        const __m512 vi3x1c0 = _mm512_set1_ps(i3[6]);
+        vo1x0c0123456789ABCDEF = _mm512_fmadd_ps(vk12c0x0123456789ABCDEF, vi3x1c0, vo1x0c0123456789ABCDEF);
+        vo1x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk12c0xGHIJKLMNOPQRSTUV, vi3x1c0, vo1x0cGHIJKLMNOPQRSTUV);
+        vo1x1c0123456789ABCDEF = _mm512_fmadd_ps(vk10c0x0123456789ABCDEF, vi3x1c0, vo1x1c0123456789ABCDEF);
+        vo1x1cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk10c0xGHIJKLMNOPQRSTUV, vi3x1c0, vo1x1cGHIJKLMNOPQRSTUV);
+        const __m512 vi4x1c0 = _mm512_set1_ps(i4[6]);
+        vo1x0c0123456789ABCDEF = _mm512_fmadd_ps(vk22c0x0123456789ABCDEF, vi4x1c0, vo1x0c0123456789ABCDEF);
+        vo1x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk22c0xGHIJKLMNOPQRSTUV, vi4x1c0, vo1x0cGHIJKLMNOPQRSTUV);
+        vo1x1c0123456789ABCDEF = _mm512_fmadd_ps(vk20c0x0123456789ABCDEF, vi4x1c0, vo1x1c0123456789ABCDEF);
+        vo1x1cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk20c0xGHIJKLMNOPQRSTUV, vi4x1c0, vo1x1cGHIJKLMNOPQRSTUV);
+        const __m512 vk01c1x0123456789ABCDEF = _mm512_load_ps(w + 416);
+        const __m512 vk01c1xGHIJKLMNOPQRSTUV = _mm512_load_ps(w + 432);
+        const __m512 vk11c1x0123456789ABCDEF = _mm512_load_ps(w + 448);
+        const __m512 vk11c1xGHIJKLMNOPQRSTUV = _mm512_load_ps(w + 464);
+        const __m512 vk21c1x0123456789ABCDEF = _mm512_load_ps(w + 480);
+        const __m512 vk21c1xGHIJKLMNOPQRSTUV = _mm512_load_ps(w + 496);
+
+        const __m512 vi0x0c1 = _mm512_set1_ps(i0[4]);
+        vo0x0c0123456789ABCDEF = _mm512_fmadd_ps(vk01c1x0123456789ABCDEF, vi0x0c1, vo0x0c0123456789ABCDEF);
+        vo0x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk01c1xGHIJKLMNOPQRSTUV, vi0x0c1, vo0x0cGHIJKLMNOPQRSTUV);
+        const __m512 vi1x0c1 = _mm512_set1_ps(i1[4]);
+        vo0x0c0123456789ABCDEF = _mm512_fmadd_ps(vk11c1x0123456789ABCDEF, vi1x0c1, vo0x0c0123456789ABCDEF);
+        vo0x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk11c1xGHIJKLMNOPQRSTUV, vi1x0c1, vo0x0cGHIJKLMNOPQRSTUV);
+        const __m512 vi2x0c1 = _mm512_set1_ps(i2[4]);
+        vo0x0c0123456789ABCDEF = _mm512_fmadd_ps(vk21c1x0123456789ABCDEF, vi2x0c1, vo0x0c0123456789ABCDEF);
+        vo0x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk21c1xGHIJKLMNOPQRSTUV, vi2x0c1, vo0x0cGHIJKLMNOPQRSTUV);
+        vo1x0c0123456789ABCDEF = _mm512_fmadd_ps(vk01c1x0123456789ABCDEF, vi2x0c1, vo1x0c0123456789ABCDEF);
+        vo1x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk01c1xGHIJKLMNOPQRSTUV, vi2x0c1, vo1x0cGHIJKLMNOPQRSTUV);
+        const __m512 vi3x0c1 = _mm512_set1_ps(i3[4]);
+        vo1x0c0123456789ABCDEF = _mm512_fmadd_ps(vk11c1x0123456789ABCDEF, vi3x0c1, vo1x0c0123456789ABCDEF);
+        vo1x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk11c1xGHIJKLMNOPQRSTUV, vi3x0c1, vo1x0cGHIJKLMNOPQRSTUV);
+        const __m512 vi4x0c1 = _mm512_set1_ps(i4[4]);
+        vo1x0c0123456789ABCDEF = _mm512_fmadd_ps(vk21c1x0123456789ABCDEF, vi4x0c1, vo1x0c0123456789ABCDEF);
+        vo1x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk21c1xGHIJKLMNOPQRSTUV, vi4x0c1, vo1x0cGHIJKLMNOPQRSTUV);
+
+        const __m512 vk02c1x0123456789ABCDEF = _mm512_load_ps(w + 704);
+        const __m512 vk02c1xGHIJKLMNOPQRSTUV = _mm512_load_ps(w + 720);
+        const __m512 vk12c1x0123456789ABCDEF = _mm512_load_ps(w + 736);
+        const __m512 vk12c1xGHIJKLMNOPQRSTUV = _mm512_load_ps(w + 752);
+        const __m512 vk22c1x0123456789ABCDEF = _mm512_load_ps(w + 768);
+        const __m512 vk22c1xGHIJKLMNOPQRSTUV = _mm512_load_ps(w + 784);
+        const __m512 vk00c1x0123456789ABCDEF = _mm512_load_ps(w + 128);
+        const __m512 vk00c1xGHIJKLMNOPQRSTUV = _mm512_load_ps(w + 144);
+        const __m512 vk10c1x0123456789ABCDEF = _mm512_load_ps(w + 160);
+        const __m512 vk10c1xGHIJKLMNOPQRSTUV = _mm512_load_ps(w + 176);
+        const __m512 vk20c1x0123456789ABCDEF = _mm512_load_ps(w + 192);
+        const __m512 vk20c1xGHIJKLMNOPQRSTUV = _mm512_load_ps(w + 208);
+
+        const __m512 vi0x1c1 = _mm512_set1_ps(i0[7]);
+        vo0x0c0123456789ABCDEF = _mm512_fmadd_ps(vk02c1x0123456789ABCDEF, vi0x1c1, vo0x0c0123456789ABCDEF);
+        vo0x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk02c1xGHIJKLMNOPQRSTUV, vi0x1c1, vo0x0cGHIJKLMNOPQRSTUV);
+        vo0x1c0123456789ABCDEF = _mm512_fmadd_ps(vk00c1x0123456789ABCDEF, vi0x1c1, vo0x1c0123456789ABCDEF);
+        vo0x1cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk00c1xGHIJKLMNOPQRSTUV, vi0x1c1, vo0x1cGHIJKLMNOPQRSTUV);
+        const __m512 vi1x1c1 = _mm512_set1_ps(i1[7]);
+        vo0x0c0123456789ABCDEF = _mm512_fmadd_ps(vk12c1x0123456789ABCDEF, vi1x1c1, vo0x0c0123456789ABCDEF);
+        vo0x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk12c1xGHIJKLMNOPQRSTUV, vi1x1c1, vo0x0cGHIJKLMNOPQRSTUV);
+        vo0x1c0123456789ABCDEF = _mm512_fmadd_ps(vk10c1x0123456789ABCDEF, vi1x1c1, vo0x1c0123456789ABCDEF);
+        vo0x1cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk10c1xGHIJKLMNOPQRSTUV, vi1x1c1, vo0x1cGHIJKLMNOPQRSTUV);
+        const __m512 vi2x1c1 = _mm512_set1_ps(i2[7]);
+        vo0x0c0123456789ABCDEF = _mm512_fmadd_ps(vk22c1x0123456789ABCDEF, vi2x1c1, vo0x0c0123456789ABCDEF);
+        vo0x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk22c1xGHIJKLMNOPQRSTUV, vi2x1c1, vo0x0cGHIJKLMNOPQRSTUV);
+        vo0x1c0123456789ABCDEF = _mm512_fmadd_ps(vk20c1x0123456789ABCDEF, vi2x1c1, vo0x1c0123456789ABCDEF);
+        vo0x1cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk20c1xGHIJKLMNOPQRSTUV, vi2x1c1, vo0x1cGHIJKLMNOPQRSTUV);
+        vo1x0c0123456789ABCDEF = _mm512_fmadd_ps(vk02c1x0123456789ABCDEF, vi2x1c1, vo1x0c0123456789ABCDEF);
+        vo1x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk02c1xGHIJKLMNOPQRSTUV, vi2x1c1, vo1x0cGHIJKLMNOPQRSTUV);
+        vo1x1c0123456789ABCDEF = _mm512_fmadd_ps(vk00c1x0123456789ABCDEF, vi2x1c1, vo1x1c0123456789ABCDEF);
+        vo1x1cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk00c1xGHIJKLMNOPQRSTUV, vi2x1c1, vo1x1cGHIJKLMNOPQRSTUV);
+        const __m512 vi3x1c1 = _mm512_set1_ps(i3[7]);
+        vo1x0c0123456789ABCDEF = _mm512_fmadd_ps(vk12c1x0123456789ABCDEF, vi3x1c1, vo1x0c0123456789ABCDEF);
+        vo1x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk12c1xGHIJKLMNOPQRSTUV, vi3x1c1, vo1x0cGHIJKLMNOPQRSTUV);
+        vo1x1c0123456789ABCDEF = _mm512_fmadd_ps(vk10c1x0123456789ABCDEF, vi3x1c1, vo1x1c0123456789ABCDEF);
+        vo1x1cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk10c1xGHIJKLMNOPQRSTUV, vi3x1c1, vo1x1cGHIJKLMNOPQRSTUV);
+        const __m512 vi4x1c1 = _mm512_set1_ps(i4[7]);
+        vo1x0c0123456789ABCDEF = _mm512_fmadd_ps(vk22c1x0123456789ABCDEF, vi4x1c1, vo1x0c0123456789ABCDEF);
+        vo1x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk22c1xGHIJKLMNOPQRSTUV, vi4x1c1, vo1x0cGHIJKLMNOPQRSTUV);
+        vo1x1c0123456789ABCDEF = _mm512_fmadd_ps(vk20c1x0123456789ABCDEF, vi4x1c1, vo1x1c0123456789ABCDEF);
+        vo1x1cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk20c1xGHIJKLMNOPQRSTUV, vi4x1c1, vo1x1cGHIJKLMNOPQRSTUV);
+        const __m512 vk01c2x0123456789ABCDEF = _mm512_load_ps(w + 512);
+        const __m512 vk01c2xGHIJKLMNOPQRSTUV = _mm512_load_ps(w + 528);
+        const __m512 vk11c2x0123456789ABCDEF = _mm512_load_ps(w + 544);
+        const __m512 vk11c2xGHIJKLMNOPQRSTUV = _mm512_load_ps(w + 560);
+        const __m512 vk21c2x0123456789ABCDEF = _mm512_load_ps(w + 576);
+        const __m512 vk21c2xGHIJKLMNOPQRSTUV = _mm512_load_ps(w + 592);
+
+        const __m512 vi0x0c2 = _mm512_set1_ps(i0[5]);
+        vo0x0c0123456789ABCDEF = _mm512_fmadd_ps(vk01c2x0123456789ABCDEF, vi0x0c2, vo0x0c0123456789ABCDEF);
+        vo0x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk01c2xGHIJKLMNOPQRSTUV, vi0x0c2, vo0x0cGHIJKLMNOPQRSTUV);
+        const __m512 vi1x0c2 = _mm512_set1_ps(i1[5]);
+        vo0x0c0123456789ABCDEF = _mm512_fmadd_ps(vk11c2x0123456789ABCDEF, vi1x0c2, vo0x0c0123456789ABCDEF);
+        vo0x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk11c2xGHIJKLMNOPQRSTUV, vi1x0c2, vo0x0cGHIJKLMNOPQRSTUV);
+        const __m512 vi2x0c2 = _mm512_set1_ps(i2[5]);
+        vo0x0c0123456789ABCDEF = _mm512_fmadd_ps(vk21c2x0123456789ABCDEF, vi2x0c2, vo0x0c0123456789ABCDEF);
+        vo0x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk21c2xGHIJKLMNOPQRSTUV, vi2x0c2, vo0x0cGHIJKLMNOPQRSTUV);
+        vo1x0c0123456789ABCDEF = _mm512_fmadd_ps(vk01c2x0123456789ABCDEF, vi2x0c2, vo1x0c0123456789ABCDEF);
+        vo1x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk01c2xGHIJKLMNOPQRSTUV, vi2x0c2, vo1x0cGHIJKLMNOPQRSTUV);
+        const __m512 vi3x0c2 = _mm512_set1_ps(i3[5]);
+        vo1x0c0123456789ABCDEF = _mm512_fmadd_ps(vk11c2x0123456789ABCDEF, vi3x0c2, vo1x0c0123456789ABCDEF);
+        vo1x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk11c2xGHIJKLMNOPQRSTUV, vi3x0c2, vo1x0cGHIJKLMNOPQRSTUV);
+        const __m512 vi4x0c2 = _mm512_set1_ps(i4[5]);
+        vo1x0c0123456789ABCDEF = _mm512_fmadd_ps(vk21c2x0123456789ABCDEF, vi4x0c2, vo1x0c0123456789ABCDEF);
+        vo1x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk21c2xGHIJKLMNOPQRSTUV, vi4x0c2, vo1x0cGHIJKLMNOPQRSTUV);
+
+        const __m512 vk02c2x0123456789ABCDEF = _mm512_load_ps(w + 800);
+        const __m512 vk02c2xGHIJKLMNOPQRSTUV = _mm512_load_ps(w + 816);
+        const __m512 vk12c2x0123456789ABCDEF = _mm512_load_ps(w + 832);
+        const __m512 vk12c2xGHIJKLMNOPQRSTUV = _mm512_load_ps(w + 848);
+        const __m512 vk22c2x0123456789ABCDEF = _mm512_load_ps(w + 864);
+        const __m512 vk22c2xGHIJKLMNOPQRSTUV = _mm512_load_ps(w + 880);
+        const __m512 vk00c2x0123456789ABCDEF = _mm512_load_ps(w + 224);
+        const __m512 vk00c2xGHIJKLMNOPQRSTUV = _mm512_load_ps(w + 240);
+        const __m512 vk10c2x0123456789ABCDEF = _mm512_load_ps(w + 256);
+        const __m512 vk10c2xGHIJKLMNOPQRSTUV = _mm512_load_ps(w + 272);
+        const __m512 vk20c2x0123456789ABCDEF = _mm512_load_ps(w + 288);
+        const __m512 vk20c2xGHIJKLMNOPQRSTUV = _mm512_load_ps(w + 304);
+
+        const __m512 vi0x1c2 = _mm512_set1_ps(i0[8]);
+        vo0x0c0123456789ABCDEF = _mm512_fmadd_ps(vk02c2x0123456789ABCDEF, vi0x1c2, vo0x0c0123456789ABCDEF);
+        vo0x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk02c2xGHIJKLMNOPQRSTUV, vi0x1c2, vo0x0cGHIJKLMNOPQRSTUV);
+        vo0x1c0123456789ABCDEF = _mm512_fmadd_ps(vk00c2x0123456789ABCDEF, vi0x1c2, vo0x1c0123456789ABCDEF);
+        vo0x1cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk00c2xGHIJKLMNOPQRSTUV, vi0x1c2, vo0x1cGHIJKLMNOPQRSTUV);
+        const __m512 vi1x1c2 = _mm512_set1_ps(i1[8]);
+        vo0x0c0123456789ABCDEF = _mm512_fmadd_ps(vk12c2x0123456789ABCDEF, vi1x1c2, vo0x0c0123456789ABCDEF);
+        vo0x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk12c2xGHIJKLMNOPQRSTUV, vi1x1c2, vo0x0cGHIJKLMNOPQRSTUV);
+        vo0x1c0123456789ABCDEF = _mm512_fmadd_ps(vk10c2x0123456789ABCDEF, vi1x1c2, vo0x1c0123456789ABCDEF);
+        vo0x1cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk10c2xGHIJKLMNOPQRSTUV, vi1x1c2, vo0x1cGHIJKLMNOPQRSTUV);
+        const __m512 vi2x1c2 = _mm512_set1_ps(i2[8]);
+        vo0x0c0123456789ABCDEF = _mm512_fmadd_ps(vk22c2x0123456789ABCDEF, vi2x1c2, vo0x0c0123456789ABCDEF);
+        vo0x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk22c2xGHIJKLMNOPQRSTUV, vi2x1c2, vo0x0cGHIJKLMNOPQRSTUV);
+        vo0x1c0123456789ABCDEF = _mm512_fmadd_ps(vk20c2x0123456789ABCDEF, vi2x1c2, vo0x1c0123456789ABCDEF);
+        vo0x1cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk20c2xGHIJKLMNOPQRSTUV, vi2x1c2, vo0x1cGHIJKLMNOPQRSTUV);
+        vo1x0c0123456789ABCDEF = _mm512_fmadd_ps(vk02c2x0123456789ABCDEF, vi2x1c2, vo1x0c0123456789ABCDEF);
+        vo1x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk02c2xGHIJKLMNOPQRSTUV, vi2x1c2, vo1x0cGHIJKLMNOPQRSTUV);
+        vo1x1c0123456789ABCDEF = _mm512_fmadd_ps(vk00c2x0123456789ABCDEF, vi2x1c2, vo1x1c0123456789ABCDEF);
+        vo1x1cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk00c2xGHIJKLMNOPQRSTUV, vi2x1c2, vo1x1cGHIJKLMNOPQRSTUV);
+        const __m512 vi3x1c2 = _mm512_set1_ps(i3[8]);
+        vo1x0c0123456789ABCDEF = _mm512_fmadd_ps(vk12c2x0123456789ABCDEF, vi3x1c2, vo1x0c0123456789ABCDEF);
+        vo1x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk12c2xGHIJKLMNOPQRSTUV, vi3x1c2, vo1x0cGHIJKLMNOPQRSTUV);
+        vo1x1c0123456789ABCDEF = _mm512_fmadd_ps(vk10c2x0123456789ABCDEF, vi3x1c2, vo1x1c0123456789ABCDEF);
+        vo1x1cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk10c2xGHIJKLMNOPQRSTUV, vi3x1c2, vo1x1cGHIJKLMNOPQRSTUV);
+        const __m512 vi4x1c2 = _mm512_set1_ps(i4[8]);
+        vo1x0c0123456789ABCDEF = _mm512_fmadd_ps(vk22c2x0123456789ABCDEF, vi4x1c2, vo1x0c0123456789ABCDEF);
+        vo1x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk22c2xGHIJKLMNOPQRSTUV, vi4x1c2, vo1x0cGHIJKLMNOPQRSTUV);
+        vo1x1c0123456789ABCDEF = _mm512_fmadd_ps(vk20c2x0123456789ABCDEF, vi4x1c2, vo1x1c0123456789ABCDEF);
+        vo1x1cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk20c2xGHIJKLMNOPQRSTUV, vi4x1c2, vo1x1cGHIJKLMNOPQRSTUV);
+
+        i0 += 6;
+        i1 += 6;
+        i2 += 6;
+        i3 += 6;
+        i4 += 6;
+
+        vo0x0c0123456789ABCDEF = _mm512_max_ps(vo0x0c0123456789ABCDEF, vmin);
+        vo0x0cGHIJKLMNOPQRSTUV = _mm512_max_ps(vo0x0cGHIJKLMNOPQRSTUV, vmin);
+        vo1x0c0123456789ABCDEF = _mm512_max_ps(vo1x0c0123456789ABCDEF, vmin);
+        vo1x0cGHIJKLMNOPQRSTUV = _mm512_max_ps(vo1x0cGHIJKLMNOPQRSTUV, vmin);
+        vo0x0c0123456789ABCDEF = _mm512_min_ps(vo0x0c0123456789ABCDEF, vmax);
+        vo0x0cGHIJKLMNOPQRSTUV = _mm512_min_ps(vo0x0cGHIJKLMNOPQRSTUV, vmax);
+        vo1x0c0123456789ABCDEF = _mm512_min_ps(vo1x0c0123456789ABCDEF, vmax);
+        vo1x0cGHIJKLMNOPQRSTUV = _mm512_min_ps(vo1x0cGHIJKLMNOPQRSTUV, vmax);
+
+        if XNN_LIKELY(c >= 32) {
+          _mm512_storeu_ps(o1, vo1x0c0123456789ABCDEF);
+          _mm512_storeu_ps(o1 + 16, vo1x0cGHIJKLMNOPQRSTUV);
+          o1 = (float*) ((uintptr_t) o1 + output_width_stride);
+          _mm512_storeu_ps(o0, vo0x0c0123456789ABCDEF);
+          _mm512_storeu_ps(o0 + 16, vo0x0cGHIJKLMNOPQRSTUV);
+          o0 = (float*) ((uintptr_t) o0 + output_width_stride);
+        } else {
+          float* o1_tmp = o1;
+          float* o0_tmp = o0;
+          if (c & 16) {
+            _mm512_storeu_ps((float*) ((uintptr_t) o1_tmp + output_width_stride * 0) + 0, vo1x0c0123456789ABCDEF);
+            _mm512_storeu_ps((float*) ((uintptr_t) o0_tmp + output_width_stride * 0) + 0, vo0x0c0123456789ABCDEF);
+            o1_tmp += 16;
+            o0_tmp += 16;
+            vo0x0c0123456789ABCDEF = vo0x0cGHIJKLMNOPQRSTUV;
+            vo1x0c0123456789ABCDEF = vo1x0cGHIJKLMNOPQRSTUV;
+          }
+          // Prepare mask for valid 32-bit elements (depends on c).
+          const __mmask16 vmask = _cvtu32_mask16((uint16_t) ((uint32_t) (UINT32_C(1) << (c & 15)) - UINT32_C(1)));
+          _mm512_mask_storeu_ps((float*) ((uintptr_t) o1_tmp + output_width_stride * 0), vmask, vo1x0c0123456789ABCDEF);
+          _mm512_mask_storeu_ps((float*) ((uintptr_t) o0_tmp + output_width_stride * 0), vmask, vo0x0c0123456789ABCDEF);
+          o1 = (float*) ((uintptr_t) o1 + output_width_stride);
+          o0 = (float*) ((uintptr_t) o0 + output_width_stride);
+        }
+
+        vo0x0c0123456789ABCDEF = vo0x1c0123456789ABCDEF;
+        vo0x0cGHIJKLMNOPQRSTUV = vo0x1cGHIJKLMNOPQRSTUV;
+        vo1x0c0123456789ABCDEF = vo1x1c0123456789ABCDEF;
+        vo1x0cGHIJKLMNOPQRSTUV = vo1x1cGHIJKLMNOPQRSTUV;
+        iw -= 2;
+      }
+      assert(iw < 2);
+      if XNN_UNLIKELY(iw != 0) {
+        // The last input column contributes through the center column of the kernel; the right column is padding.
+        const __m512 vk01c0x0123456789ABCDEF = _mm512_load_ps(w + 320);
+        const __m512 vk01c0xGHIJKLMNOPQRSTUV = _mm512_load_ps(w + 336);
+        const __m512 vk11c0x0123456789ABCDEF = _mm512_load_ps(w + 352);
+        const __m512 vk11c0xGHIJKLMNOPQRSTUV = _mm512_load_ps(w + 368);
+        const __m512 vk21c0x0123456789ABCDEF = _mm512_load_ps(w + 384);
+        const __m512 vk21c0xGHIJKLMNOPQRSTUV = _mm512_load_ps(w + 400);
+
+        const __m512 vi0x0c0 = _mm512_set1_ps(i0[3]);
+        vo0x0c0123456789ABCDEF = _mm512_fmadd_ps(vk01c0x0123456789ABCDEF, vi0x0c0, vo0x0c0123456789ABCDEF);
+        vo0x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk01c0xGHIJKLMNOPQRSTUV, vi0x0c0, vo0x0cGHIJKLMNOPQRSTUV);
+        const __m512 vi1x0c0 = _mm512_set1_ps(i1[3]);
+        vo0x0c0123456789ABCDEF = _mm512_fmadd_ps(vk11c0x0123456789ABCDEF, vi1x0c0, vo0x0c0123456789ABCDEF);
+        vo0x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk11c0xGHIJKLMNOPQRSTUV, vi1x0c0, vo0x0cGHIJKLMNOPQRSTUV);
+        const __m512 vi2x0c0 = _mm512_set1_ps(i2[3]);
+        vo0x0c0123456789ABCDEF = _mm512_fmadd_ps(vk21c0x0123456789ABCDEF, vi2x0c0, vo0x0c0123456789ABCDEF);
+        vo0x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk21c0xGHIJKLMNOPQRSTUV, vi2x0c0, vo0x0cGHIJKLMNOPQRSTUV);
+        vo1x0c0123456789ABCDEF = _mm512_fmadd_ps(vk01c0x0123456789ABCDEF, vi2x0c0, vo1x0c0123456789ABCDEF);
+        vo1x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk01c0xGHIJKLMNOPQRSTUV, vi2x0c0, vo1x0cGHIJKLMNOPQRSTUV);
+        const __m512 vi3x0c0 = _mm512_set1_ps(i3[3]);
+        vo1x0c0123456789ABCDEF = _mm512_fmadd_ps(vk11c0x0123456789ABCDEF, vi3x0c0, vo1x0c0123456789ABCDEF);
+        vo1x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk11c0xGHIJKLMNOPQRSTUV, vi3x0c0, vo1x0cGHIJKLMNOPQRSTUV);
+        const __m512 vi4x0c0 = _mm512_set1_ps(i4[3]);
+        vo1x0c0123456789ABCDEF = _mm512_fmadd_ps(vk21c0x0123456789ABCDEF, vi4x0c0, vo1x0c0123456789ABCDEF);
+        vo1x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk21c0xGHIJKLMNOPQRSTUV, vi4x0c0, vo1x0cGHIJKLMNOPQRSTUV);
+        const __m512 vk01c1x0123456789ABCDEF = _mm512_load_ps(w + 416);
+        const __m512 vk01c1xGHIJKLMNOPQRSTUV = _mm512_load_ps(w + 432);
+        const __m512 vk11c1x0123456789ABCDEF = _mm512_load_ps(w + 448);
+        const __m512 vk11c1xGHIJKLMNOPQRSTUV = _mm512_load_ps(w + 464);
+        const __m512 vk21c1x0123456789ABCDEF = _mm512_load_ps(w + 480);
+        const __m512 vk21c1xGHIJKLMNOPQRSTUV = _mm512_load_ps(w + 496);
+
+        const __m512 vi0x0c1 = _mm512_set1_ps(i0[4]);
+        vo0x0c0123456789ABCDEF = _mm512_fmadd_ps(vk01c1x0123456789ABCDEF, vi0x0c1, vo0x0c0123456789ABCDEF);
+        vo0x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk01c1xGHIJKLMNOPQRSTUV, vi0x0c1, vo0x0cGHIJKLMNOPQRSTUV);
+        const __m512 vi1x0c1 = _mm512_set1_ps(i1[4]);
+        vo0x0c0123456789ABCDEF = _mm512_fmadd_ps(vk11c1x0123456789ABCDEF, vi1x0c1, vo0x0c0123456789ABCDEF);
+        vo0x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk11c1xGHIJKLMNOPQRSTUV, vi1x0c1, vo0x0cGHIJKLMNOPQRSTUV);
+        const __m512 vi2x0c1 = _mm512_set1_ps(i2[4]);
+        vo0x0c0123456789ABCDEF = _mm512_fmadd_ps(vk21c1x0123456789ABCDEF, vi2x0c1, vo0x0c0123456789ABCDEF);
+        vo0x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk21c1xGHIJKLMNOPQRSTUV, vi2x0c1, vo0x0cGHIJKLMNOPQRSTUV);
+        vo1x0c0123456789ABCDEF = _mm512_fmadd_ps(vk01c1x0123456789ABCDEF, vi2x0c1, vo1x0c0123456789ABCDEF);
+        vo1x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk01c1xGHIJKLMNOPQRSTUV, vi2x0c1, vo1x0cGHIJKLMNOPQRSTUV);
+        const __m512 vi3x0c1 = _mm512_set1_ps(i3[4]);
+        vo1x0c0123456789ABCDEF = _mm512_fmadd_ps(vk11c1x0123456789ABCDEF, vi3x0c1, vo1x0c0123456789ABCDEF);
+        vo1x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk11c1xGHIJKLMNOPQRSTUV, vi3x0c1, vo1x0cGHIJKLMNOPQRSTUV);
+        const __m512 vi4x0c1 = _mm512_set1_ps(i4[4]);
+        vo1x0c0123456789ABCDEF = _mm512_fmadd_ps(vk21c1x0123456789ABCDEF, vi4x0c1, vo1x0c0123456789ABCDEF);
+        vo1x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk21c1xGHIJKLMNOPQRSTUV, vi4x0c1, vo1x0cGHIJKLMNOPQRSTUV);
+        const __m512 vk01c2x0123456789ABCDEF = _mm512_load_ps(w + 512);
+        const __m512 vk01c2xGHIJKLMNOPQRSTUV = _mm512_load_ps(w + 528);
+        const __m512 vk11c2x0123456789ABCDEF = _mm512_load_ps(w + 544);
+        const __m512 vk11c2xGHIJKLMNOPQRSTUV = _mm512_load_ps(w + 560);
+        const __m512 vk21c2x0123456789ABCDEF = _mm512_load_ps(w + 576);
+        const __m512 vk21c2xGHIJKLMNOPQRSTUV = _mm512_load_ps(w + 592);
+
+        const __m512 vi0x0c2 = _mm512_set1_ps(i0[5]);
+        vo0x0c0123456789ABCDEF = _mm512_fmadd_ps(vk01c2x0123456789ABCDEF, vi0x0c2, vo0x0c0123456789ABCDEF);
+        vo0x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk01c2xGHIJKLMNOPQRSTUV, vi0x0c2, vo0x0cGHIJKLMNOPQRSTUV);
+        const __m512 vi1x0c2 = _mm512_set1_ps(i1[5]);
+        vo0x0c0123456789ABCDEF = _mm512_fmadd_ps(vk11c2x0123456789ABCDEF, vi1x0c2, vo0x0c0123456789ABCDEF);
+        vo0x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk11c2xGHIJKLMNOPQRSTUV, vi1x0c2, vo0x0cGHIJKLMNOPQRSTUV);
+        const __m512 vi2x0c2 = _mm512_set1_ps(i2[5]);
+        vo0x0c0123456789ABCDEF = _mm512_fmadd_ps(vk21c2x0123456789ABCDEF, vi2x0c2, vo0x0c0123456789ABCDEF);
+        vo0x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk21c2xGHIJKLMNOPQRSTUV, vi2x0c2, vo0x0cGHIJKLMNOPQRSTUV);
+        vo1x0c0123456789ABCDEF = _mm512_fmadd_ps(vk01c2x0123456789ABCDEF, vi2x0c2, vo1x0c0123456789ABCDEF);
+        vo1x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk01c2xGHIJKLMNOPQRSTUV, vi2x0c2, vo1x0cGHIJKLMNOPQRSTUV);
+        const __m512 vi3x0c2 = _mm512_set1_ps(i3[5]);
+        vo1x0c0123456789ABCDEF = _mm512_fmadd_ps(vk11c2x0123456789ABCDEF, vi3x0c2, vo1x0c0123456789ABCDEF);
+        vo1x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk11c2xGHIJKLMNOPQRSTUV, vi3x0c2, vo1x0cGHIJKLMNOPQRSTUV);
+        const __m512 vi4x0c2 = _mm512_set1_ps(i4[5]);
+        vo1x0c0123456789ABCDEF = _mm512_fmadd_ps(vk21c2x0123456789ABCDEF, vi4x0c2, vo1x0c0123456789ABCDEF);
+        vo1x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk21c2xGHIJKLMNOPQRSTUV, vi4x0c2, vo1x0cGHIJKLMNOPQRSTUV);
+
+        vo0x0c0123456789ABCDEF = _mm512_max_ps(vo0x0c0123456789ABCDEF, vmin);
+        vo0x0cGHIJKLMNOPQRSTUV = _mm512_max_ps(vo0x0cGHIJKLMNOPQRSTUV, vmin);
+        vo1x0c0123456789ABCDEF = _mm512_max_ps(vo1x0c0123456789ABCDEF, vmin);
+        vo1x0cGHIJKLMNOPQRSTUV = _mm512_max_ps(vo1x0cGHIJKLMNOPQRSTUV, vmin);
+        vo0x0c0123456789ABCDEF = _mm512_min_ps(vo0x0c0123456789ABCDEF, vmax);
+        vo0x0cGHIJKLMNOPQRSTUV = _mm512_min_ps(vo0x0cGHIJKLMNOPQRSTUV, vmax);
+        vo1x0c0123456789ABCDEF = _mm512_min_ps(vo1x0c0123456789ABCDEF, vmax);
+        vo1x0cGHIJKLMNOPQRSTUV = _mm512_min_ps(vo1x0cGHIJKLMNOPQRSTUV, vmax);
+
+        if XNN_LIKELY(c >= 32) {
+          _mm512_storeu_ps(o1, vo1x0c0123456789ABCDEF);
+          _mm512_storeu_ps(o1 + 16, vo1x0cGHIJKLMNOPQRSTUV);
+          _mm512_storeu_ps(o0, vo0x0c0123456789ABCDEF);
+          _mm512_storeu_ps(o0 + 16, vo0x0cGHIJKLMNOPQRSTUV);
+        } else {
+          float* o1_tmp = o1;
+          float* o0_tmp = o0;
+          if (c & 16) {
+            _mm512_storeu_ps(o1_tmp + 0, vo1x0c0123456789ABCDEF);
+            _mm512_storeu_ps(o0_tmp + 0, vo0x0c0123456789ABCDEF);
+            o1_tmp += 16;
+            o0_tmp += 16;
+            vo0x0c0123456789ABCDEF = vo0x0cGHIJKLMNOPQRSTUV;
+            vo1x0c0123456789ABCDEF = vo1x0cGHIJKLMNOPQRSTUV;
+          }
+          // Prepare mask for valid 32-bit elements (depends on c).
+          const __mmask16 vmask = _cvtu32_mask16((uint16_t) ((uint32_t) (UINT32_C(1) << (c & 15)) - UINT32_C(1)));
+          _mm512_mask_storeu_ps(o1_tmp, vmask, vo1x0c0123456789ABCDEF);
+          _mm512_mask_storeu_ps(o0_tmp, vmask, vo0x0c0123456789ABCDEF);
+        }
+        o1 = (float*) ((uintptr_t) o1 + output_width_stride);
+        o0 = (float*) ((uintptr_t) o0 + output_width_stride);
+      }
+      // Move output pointers back to the position of the first pixel in a row,
+      // and forward to the next block of output channels
+      o0 = (float*) ((uintptr_t) o0 - output_channel_decrement);
+      o1 = (float*) ((uintptr_t) o1 - output_channel_decrement);
+      // Revert input pointers to the position of the first pixel in a row
+      i0 = (const float*) ((uintptr_t) i0 - input_width_decrement);
+      i1 = (const float*) ((uintptr_t) i1 - input_width_decrement);
+      i2 = (const float*) ((uintptr_t) i2 - input_width_decrement);
+      i3 = (const float*) ((uintptr_t) i3 - input_width_decrement);
+      i4 = (const float*) ((uintptr_t) i4 - input_width_decrement);
+      // Move to the block of weights for the next 32 output channels
+      w += 896;
+      c = doz(c, 32);
+    } while (c != 0);
+    // Move output pointers back to the position of the first channel, and forward to the next block of rows
+    o0 = (float*) ((uintptr_t) o0 + output_height_increment);
+    o1 = (float*) ((uintptr_t) o1 + output_height_increment);
+    // Move input pointers forward to the next four rows
+    i0 = i4;
+    i1 = (const float*) ((uintptr_t) i0 + input_height_stride);
+    i2 = (const float*) ((uintptr_t) i1 + input_height_stride);
+    i3 = (const float*) ((uintptr_t) i2 + input_height_stride);
+    i4 = (const float*) ((uintptr_t) i3 + input_height_stride);
+  }
+}
+
+void xnn_f32_conv_hwc_ukernel_3x3s2p1c3x32__avx512f_2x2(
+    size_t input_height,
+    size_t input_width,
+    size_t output_y_start,
+    size_t output_y_end,
+    const float* input,
+    const float* zero,
+    const float* weights,
+    float* output,
+    size_t input_padding_top,
+    size_t output_channels,
+    size_t output_height_stride,
+    size_t output_width_stride,
+    const union xnn_f32_minmax_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(input_width != 0);
+  assert(output_y_end > output_y_start);
+  assert(input_padding_top <= 1);
+  assert(output_channels != 0);
+
+  const size_t input_height_stride = input_width * 3 /* channels */ * sizeof(float);
+  const size_t input_width_decrement = round_down_po2(input_width, 2) * 3 /* channels */ * sizeof(float);
+  const size_t output_width = (input_width + 1) / 2;
+  const size_t output_channel_decrement = output_width * output_width_stride - 32 * sizeof(float);
+  const size_t output_height_increment = output_height_stride * 2 - round_up_po2(output_channels, 32) * sizeof(float);
+
+  // Adjustment for padding processed below
+  const float* i0 = (const float*) ((uintptr_t) input +
+    input_height_stride * (output_y_start * 2 /* vertical stride */ - input_padding_top));
+  const float* i1 = (const float*) ((uintptr_t) i0 + input_height_stride);
+  const float* i2 = (const float*) ((uintptr_t) i1 + input_height_stride);
+  const float* i3 = (const float*) ((uintptr_t) i2 + input_height_stride);
+  const float* i4 = (const float*) ((uintptr_t) i3 + input_height_stride);
+  float* o0 = (float*) ((uintptr_t) output + output_height_stride * output_y_start);
+  float* o1 = (float*) ((uintptr_t) o0 + output_height_stride);
+
+  if XNN_UNPREDICTABLE(output_y_start < input_padding_top) {
+    i0 = zero;
+  }
+
+  const __m512 vmin = _mm512_set1_ps(params->scalar.min);
+  const __m512 vmax = _mm512_set1_ps(params->scalar.max);
+
+  for (size_t output_y = output_y_start; output_y < output_y_end; output_y += 2) {
+    const size_t input_y2 = output_y * 2 + 2 - input_padding_top;
+    const size_t input_y4 = input_y2 + 2;
+    if XNN_UNPREDICTABLE(input_y2 > input_height) {
+      i1 = zero;
+    }
+    if XNN_UNPREDICTABLE(input_y2 >= input_height) {
+      i2 = zero;
+    }
+    if XNN_UNPREDICTABLE(input_y4 > input_height) {
+      i3 = zero;
+    }
+    if XNN_UNPREDICTABLE(input_y4 >= input_height) {
+      i4 = zero;
+    }
+    if XNN_UNPREDICTABLE(output_y + 2 > output_y_end) {
+      o1 = o0;
+    }
+
+    const float* w = weights;
+    size_t c = output_channels;
+    do {
+      // voMx0 accumulates the leftmost output pixel of the next block. The input column to the left of it
+      // is either padding, or was already accumulated at the end of the previous block.
+      __m512 vo0x0c0123456789ABCDEF = _mm512_load_ps(w + 0);
+      __m512 vo0x0cGHIJKLMNOPQRSTUV = _mm512_load_ps(w + 16);
+      __m512 vo1x0c0123456789ABCDEF = vo0x0c0123456789ABCDEF;
+      __m512 vo1x0cGHIJKLMNOPQRSTUV = vo0x0cGHIJKLMNOPQRSTUV;
+
+      size_t iw = input_width;
+      for (; iw >= 4; iw -= 4) {
+        __m512 vo0x1c0123456789ABCDEF = _mm512_load_ps(w + 0);
+        __m512 vo0x1cGHIJKLMNOPQRSTUV = _mm512_load_ps(w + 16);
+        __m512 vo1x1c0123456789ABCDEF = vo0x1c0123456789ABCDEF;
+        __m512 vo1x1cGHIJKLMNOPQRSTUV = vo0x1cGHIJKLMNOPQRSTUV;
+        __m512 vo0x2c0123456789ABCDEF = vo0x1c0123456789ABCDEF;
+        __m512 vo0x2cGHIJKLMNOPQRSTUV = vo0x1cGHIJKLMNOPQRSTUV;
+        __m512 vo1x2c0123456789ABCDEF = vo0x1c0123456789ABCDEF;
+        __m512 vo1x2cGHIJKLMNOPQRSTUV = vo0x1cGHIJKLMNOPQRSTUV;
+
+        const __m512 vk01c0x0123456789ABCDEF = _mm512_load_ps(w + 320);
+        const __m512 vk01c0xGHIJKLMNOPQRSTUV = _mm512_load_ps(w + 336);
+        const __m512 vk11c0x0123456789ABCDEF = _mm512_load_ps(w + 352);
+        const __m512 vk11c0xGHIJKLMNOPQRSTUV = _mm512_load_ps(w + 368);
+        const __m512 vk21c0x0123456789ABCDEF = _mm512_load_ps(w + 384);
+        const __m512 vk21c0xGHIJKLMNOPQRSTUV = _mm512_load_ps(w + 400);
+
+        const __m512 vi0x0c0 = _mm512_set1_ps(i0[0]);
+        const __m512 vi0x2c0 = _mm512_set1_ps(i0[6]);
+        vo0x0c0123456789ABCDEF = _mm512_fmadd_ps(vk01c0x0123456789ABCDEF, vi0x0c0, vo0x0c0123456789ABCDEF);
+        vo0x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk01c0xGHIJKLMNOPQRSTUV, vi0x0c0, vo0x0cGHIJKLMNOPQRSTUV);
+        vo0x1c0123456789ABCDEF = _mm512_fmadd_ps(vk01c0x0123456789ABCDEF, vi0x2c0, vo0x1c0123456789ABCDEF);
+        vo0x1cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk01c0xGHIJKLMNOPQRSTUV, vi0x2c0, vo0x1cGHIJKLMNOPQRSTUV);
+        const __m512 vi1x0c0 = _mm512_set1_ps(i1[0]);
+        const __m512 vi1x2c0 = _mm512_set1_ps(i1[6]);
+        vo0x0c0123456789ABCDEF = _mm512_fmadd_ps(vk11c0x0123456789ABCDEF, vi1x0c0, vo0x0c0123456789ABCDEF);
+        vo0x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk11c0xGHIJKLMNOPQRSTUV, vi1x0c0, vo0x0cGHIJKLMNOPQRSTUV);
+        vo0x1c0123456789ABCDEF = _mm512_fmadd_ps(vk11c0x0123456789ABCDEF, vi1x2c0, vo0x1c0123456789ABCDEF);
+        vo0x1cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk11c0xGHIJKLMNOPQRSTUV, vi1x2c0, vo0x1cGHIJKLMNOPQRSTUV);
+        const __m512 vi2x0c0 = _mm512_set1_ps(i2[0]);
+        const __m512 vi2x2c0 = _mm512_set1_ps(i2[6]);
+        vo0x0c0123456789ABCDEF = _mm512_fmadd_ps(vk21c0x0123456789ABCDEF, vi2x0c0, vo0x0c0123456789ABCDEF);
+        vo0x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk21c0xGHIJKLMNOPQRSTUV, vi2x0c0, vo0x0cGHIJKLMNOPQRSTUV);
+        vo0x1c0123456789ABCDEF = _mm512_fmadd_ps(vk21c0x0123456789ABCDEF, vi2x2c0, vo0x1c0123456789ABCDEF);
+        vo0x1cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk21c0xGHIJKLMNOPQRSTUV, vi2x2c0, vo0x1cGHIJKLMNOPQRSTUV);
+        vo1x0c0123456789ABCDEF = _mm512_fmadd_ps(vk01c0x0123456789ABCDEF, vi2x0c0, vo1x0c0123456789ABCDEF);
+        vo1x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk01c0xGHIJKLMNOPQRSTUV, vi2x0c0, vo1x0cGHIJKLMNOPQRSTUV);
+        vo1x1c0123456789ABCDEF = _mm512_fmadd_ps(vk01c0x0123456789ABCDEF, vi2x2c0, vo1x1c0123456789ABCDEF);
+        vo1x1cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk01c0xGHIJKLMNOPQRSTUV, vi2x2c0, vo1x1cGHIJKLMNOPQRSTUV);
+        const __m512 vi3x0c0 = _mm512_set1_ps(i3[0]);
+        const __m512 vi3x2c0 = _mm512_set1_ps(i3[6]);
+        vo1x0c0123456789ABCDEF = _mm512_fmadd_ps(vk11c0x0123456789ABCDEF, vi3x0c0, vo1x0c0123456789ABCDEF);
+        vo1x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk11c0xGHIJKLMNOPQRSTUV, vi3x0c0, vo1x0cGHIJKLMNOPQRSTUV);
+        vo1x1c0123456789ABCDEF = _mm512_fmadd_ps(vk11c0x0123456789ABCDEF, vi3x2c0, vo1x1c0123456789ABCDEF);
+        vo1x1cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk11c0xGHIJKLMNOPQRSTUV, vi3x2c0, vo1x1cGHIJKLMNOPQRSTUV);
+        const __m512 vi4x0c0 = _mm512_set1_ps(i4[0]);
+        const __m512 vi4x2c0 = _mm512_set1_ps(i4[6]);
+        vo1x0c0123456789ABCDEF = _mm512_fmadd_ps(vk21c0x0123456789ABCDEF, vi4x0c0, vo1x0c0123456789ABCDEF);
+        vo1x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk21c0xGHIJKLMNOPQRSTUV, vi4x0c0, vo1x0cGHIJKLMNOPQRSTUV);
+        vo1x1c0123456789ABCDEF = _mm512_fmadd_ps(vk21c0x0123456789ABCDEF, vi4x2c0, vo1x1c0123456789ABCDEF);
+        vo1x1cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk21c0xGHIJKLMNOPQRSTUV, vi4x2c0, vo1x1cGHIJKLMNOPQRSTUV);
+
+        const __m512 vk02c0x0123456789ABCDEF = _mm512_load_ps(w + 608);
+        const __m512 vk02c0xGHIJKLMNOPQRSTUV = _mm512_load_ps(w + 624);
+        const __m512 vk12c0x0123456789ABCDEF = _mm512_load_ps(w + 640);
+        const __m512 vk12c0xGHIJKLMNOPQRSTUV = _mm512_load_ps(w + 656);
+        const __m512 vk22c0x0123456789ABCDEF = _mm512_load_ps(w + 672);
+        const __m512 vk22c0xGHIJKLMNOPQRSTUV = _mm512_load_ps(w + 688);
+        const __m512 vk00c0x0123456789ABCDEF = _mm512_load_ps(w + 32);
+        const __m512 vk00c0xGHIJKLMNOPQRSTUV = _mm512_load_ps(w + 48);
+        const __m512 vk10c0x0123456789ABCDEF = _mm512_load_ps(w + 64);
+        const __m512 vk10c0xGHIJKLMNOPQRSTUV = _mm512_load_ps(w + 80);
+        const __m512 vk20c0x0123456789ABCDEF = _mm512_load_ps(w + 96);
+        const __m512 vk20c0xGHIJKLMNOPQRSTUV = _mm512_load_ps(w + 112);
+
+        const __m512 vi0x1c0 = _mm512_set1_ps(i0[3]);
+        const __m512 vi0x3c0 = _mm512_set1_ps(i0[9]);
+        vo0x0c0123456789ABCDEF = _mm512_fmadd_ps(vk02c0x0123456789ABCDEF, vi0x1c0, vo0x0c0123456789ABCDEF);
+        vo0x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk02c0xGHIJKLMNOPQRSTUV, vi0x1c0, vo0x0cGHIJKLMNOPQRSTUV);
+        vo0x1c0123456789ABCDEF = _mm512_fmadd_ps(vk00c0x0123456789ABCDEF, vi0x1c0, vo0x1c0123456789ABCDEF);
+        vo0x1cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk00c0xGHIJKLMNOPQRSTUV, vi0x1c0, vo0x1cGHIJKLMNOPQRSTUV);
+        vo0x1c0123456789ABCDEF = _mm512_fmadd_ps(vk02c0x0123456789ABCDEF, vi0x3c0, vo0x1c0123456789ABCDEF);
+        vo0x1cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk02c0xGHIJKLMNOPQRSTUV, vi0x3c0, vo0x1cGHIJKLMNOPQRSTUV);
+        vo0x2c0123456789ABCDEF = _mm512_fmadd_ps(vk00c0x0123456789ABCDEF, vi0x3c0, vo0x2c0123456789ABCDEF);
+        vo0x2cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk00c0xGHIJKLMNOPQRSTUV, vi0x3c0, vo0x2cGHIJKLMNOPQRSTUV);
+        const __m512 vi1x1c0 = _mm512_set1_ps(i1[3]);
+        const __m512 vi1x3c0 = _mm512_set1_ps(i1[9]);
+        vo0x0c0123456789ABCDEF = _mm512_fmadd_ps(vk12c0x0123456789ABCDEF, vi1x1c0, vo0x0c0123456789ABCDEF);
+        vo0x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk12c0xGHIJKLMNOPQRSTUV, vi1x1c0, vo0x0cGHIJKLMNOPQRSTUV);
+        vo0x1c0123456789ABCDEF = _mm512_fmadd_ps(vk10c0x0123456789ABCDEF, vi1x1c0, vo0x1c0123456789ABCDEF);
+        vo0x1cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk10c0xGHIJKLMNOPQRSTUV, vi1x1c0, vo0x1cGHIJKLMNOPQRSTUV);
+        vo0x1c0123456789ABCDEF = _mm512_fmadd_ps(vk12c0x0123456789ABCDEF, vi1x3c0, vo0x1c0123456789ABCDEF);
+        vo0x1cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk12c0xGHIJKLMNOPQRSTUV, vi1x3c0, vo0x1cGHIJKLMNOPQRSTUV);
+        vo0x2c0123456789ABCDEF = _mm512_fmadd_ps(vk10c0x0123456789ABCDEF, vi1x3c0, vo0x2c0123456789ABCDEF);
+        vo0x2cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk10c0xGHIJKLMNOPQRSTUV, vi1x3c0, vo0x2cGHIJKLMNOPQRSTUV);
+        const __m512 vi2x1c0 = _mm512_set1_ps(i2[3]);
+        const __m512 vi2x3c0 = _mm512_set1_ps(i2[9]);
+        vo0x0c0123456789ABCDEF = _mm512_fmadd_ps(vk22c0x0123456789ABCDEF, vi2x1c0, vo0x0c0123456789ABCDEF);
+        vo0x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk22c0xGHIJKLMNOPQRSTUV, vi2x1c0, vo0x0cGHIJKLMNOPQRSTUV);
+        vo0x1c0123456789ABCDEF = _mm512_fmadd_ps(vk20c0x0123456789ABCDEF, vi2x1c0, vo0x1c0123456789ABCDEF);
+        vo0x1cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk20c0xGHIJKLMNOPQRSTUV, vi2x1c0, vo0x1cGHIJKLMNOPQRSTUV);
+        vo0x1c0123456789ABCDEF = _mm512_fmadd_ps(vk22c0x0123456789ABCDEF, vi2x3c0, vo0x1c0123456789ABCDEF);
+        vo0x1cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk22c0xGHIJKLMNOPQRSTUV, vi2x3c0, vo0x1cGHIJKLMNOPQRSTUV);
+        vo0x2c0123456789ABCDEF = _mm512_fmadd_ps(vk20c0x0123456789ABCDEF, vi2x3c0, vo0x2c0123456789ABCDEF);
+        vo0x2cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk20c0xGHIJKLMNOPQRSTUV, vi2x3c0, vo0x2cGHIJKLMNOPQRSTUV);
+        vo1x0c0123456789ABCDEF = _mm512_fmadd_ps(vk02c0x0123456789ABCDEF, vi2x1c0, vo1x0c0123456789ABCDEF);
+        vo1x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk02c0xGHIJKLMNOPQRSTUV, vi2x1c0, vo1x0cGHIJKLMNOPQRSTUV);
+        vo1x1c0123456789ABCDEF = _mm512_fmadd_ps(vk00c0x0123456789ABCDEF, vi2x1c0, vo1x1c0123456789ABCDEF);
+        vo1x1cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk00c0xGHIJKLMNOPQRSTUV, vi2x1c0, vo1x1cGHIJKLMNOPQRSTUV);
+        vo1x1c0123456789ABCDEF = _mm512_fmadd_ps(vk02c0x0123456789ABCDEF, vi2x3c0, vo1x1c0123456789ABCDEF);
+        vo1x1cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk02c0xGHIJKLMNOPQRSTUV, vi2x3c0, vo1x1cGHIJKLMNOPQRSTUV);
+        vo1x2c0123456789ABCDEF = _mm512_fmadd_ps(vk00c0x0123456789ABCDEF, vi2x3c0, vo1x2c0123456789ABCDEF);
+        vo1x2cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk00c0xGHIJKLMNOPQRSTUV, vi2x3c0, vo1x2cGHIJKLMNOPQRSTUV);
+        const __m512 vi3x1c0 = _mm512_set1_ps(i3[3]);
+        const __m512 vi3x3c0 = _mm512_set1_ps(i3[9]);
+        vo1x0c0123456789ABCDEF = _mm512_fmadd_ps(vk12c0x0123456789ABCDEF, vi3x1c0, vo1x0c0123456789ABCDEF);
+        vo1x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk12c0xGHIJKLMNOPQRSTUV, vi3x1c0, vo1x0cGHIJKLMNOPQRSTUV);
+        vo1x1c0123456789ABCDEF = _mm512_fmadd_ps(vk10c0x0123456789ABCDEF, vi3x1c0, vo1x1c0123456789ABCDEF);
+        vo1x1cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk10c0xGHIJKLMNOPQRSTUV, vi3x1c0, vo1x1cGHIJKLMNOPQRSTUV);
+        vo1x1c0123456789ABCDEF = _mm512_fmadd_ps(vk12c0x0123456789ABCDEF, vi3x3c0, vo1x1c0123456789ABCDEF);
+        vo1x1cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk12c0xGHIJKLMNOPQRSTUV, vi3x3c0, vo1x1cGHIJKLMNOPQRSTUV);
+        vo1x2c0123456789ABCDEF = _mm512_fmadd_ps(vk10c0x0123456789ABCDEF, vi3x3c0, vo1x2c0123456789ABCDEF);
+        vo1x2cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk10c0xGHIJKLMNOPQRSTUV, vi3x3c0, vo1x2cGHIJKLMNOPQRSTUV);
+        const __m512 vi4x1c0 = _mm512_set1_ps(i4[3]);
+        const __m512 vi4x3c0 = _mm512_set1_ps(i4[9]);
+        vo1x0c0123456789ABCDEF = _mm512_fmadd_ps(vk22c0x0123456789ABCDEF, vi4x1c0, vo1x0c0123456789ABCDEF);
+        vo1x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk22c0xGHIJKLMNOPQRSTUV, vi4x1c0, vo1x0cGHIJKLMNOPQRSTUV);
+        vo1x1c0123456789ABCDEF = _mm512_fmadd_ps(vk20c0x0123456789ABCDEF, vi4x1c0, vo1x1c0123456789ABCDEF);
+        vo1x1cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk20c0xGHIJKLMNOPQRSTUV, vi4x1c0, vo1x1cGHIJKLMNOPQRSTUV);
+        vo1x1c0123456789ABCDEF = _mm512_fmadd_ps(vk22c0x0123456789ABCDEF, vi4x3c0, vo1x1c0123456789ABCDEF);
+        vo1x1cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk22c0xGHIJKLMNOPQRSTUV, vi4x3c0, vo1x1cGHIJKLMNOPQRSTUV);
+        vo1x2c0123456789ABCDEF = _mm512_fmadd_ps(vk20c0x0123456789ABCDEF, vi4x3c0, vo1x2c0123456789ABCDEF);
+        vo1x2cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk20c0xGHIJKLMNOPQRSTUV, vi4x3c0, vo1x2cGHIJKLMNOPQRSTUV);
+        const __m512 vk01c1x0123456789ABCDEF = _mm512_load_ps(w + 416);
+        const __m512 vk01c1xGHIJKLMNOPQRSTUV = _mm512_load_ps(w + 432);
+        const __m512 vk11c1x0123456789ABCDEF = _mm512_load_ps(w + 448);
+        const __m512 vk11c1xGHIJKLMNOPQRSTUV = _mm512_load_ps(w + 464);
+        const __m512 vk21c1x0123456789ABCDEF = _mm512_load_ps(w + 480);
+        const __m512 vk21c1xGHIJKLMNOPQRSTUV = _mm512_load_ps(w + 496);
+
+        const __m512 vi0x0c1 = _mm512_set1_ps(i0[1]);
+        const __m512 vi0x2c1 = _mm512_set1_ps(i0[7]);
+        vo0x0c0123456789ABCDEF = _mm512_fmadd_ps(vk01c1x0123456789ABCDEF, vi0x0c1, vo0x0c0123456789ABCDEF);
+        vo0x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk01c1xGHIJKLMNOPQRSTUV, vi0x0c1, vo0x0cGHIJKLMNOPQRSTUV);
+        vo0x1c0123456789ABCDEF = _mm512_fmadd_ps(vk01c1x0123456789ABCDEF, vi0x2c1, vo0x1c0123456789ABCDEF);
+        vo0x1cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk01c1xGHIJKLMNOPQRSTUV, vi0x2c1, vo0x1cGHIJKLMNOPQRSTUV);
+        const __m512 vi1x0c1 = _mm512_set1_ps(i1[1]);
+        const __m512 vi1x2c1 = _mm512_set1_ps(i1[7]);
+        vo0x0c0123456789ABCDEF = _mm512_fmadd_ps(vk11c1x0123456789ABCDEF, vi1x0c1, vo0x0c0123456789ABCDEF);
+        vo0x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk11c1xGHIJKLMNOPQRSTUV, vi1x0c1, vo0x0cGHIJKLMNOPQRSTUV);
+        vo0x1c0123456789ABCDEF = _mm512_fmadd_ps(vk11c1x0123456789ABCDEF, vi1x2c1, vo0x1c0123456789ABCDEF);
+        vo0x1cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk11c1xGHIJKLMNOPQRSTUV, vi1x2c1, vo0x1cGHIJKLMNOPQRSTUV);
+        const __m512 vi2x0c1 = _mm512_set1_ps(i2[1]);
+        const __m512 vi2x2c1 = _mm512_set1_ps(i2[7]);
+        vo0x0c0123456789ABCDEF = _mm512_fmadd_ps(vk21c1x0123456789ABCDEF, vi2x0c1, vo0x0c0123456789ABCDEF);
+        vo0x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk21c1xGHIJKLMNOPQRSTUV, vi2x0c1, vo0x0cGHIJKLMNOPQRSTUV);
+        vo0x1c0123456789ABCDEF = _mm512_fmadd_ps(vk21c1x0123456789ABCDEF, vi2x2c1, vo0x1c0123456789ABCDEF);
+        vo0x1cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk21c1xGHIJKLMNOPQRSTUV, vi2x2c1, vo0x1cGHIJKLMNOPQRSTUV);
+        vo1x0c0123456789ABCDEF = _mm512_fmadd_ps(vk01c1x0123456789ABCDEF, vi2x0c1, vo1x0c0123456789ABCDEF);
+        vo1x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk01c1xGHIJKLMNOPQRSTUV, vi2x0c1, vo1x0cGHIJKLMNOPQRSTUV);
+        vo1x1c0123456789ABCDEF = _mm512_fmadd_ps(vk01c1x0123456789ABCDEF, vi2x2c1, vo1x1c0123456789ABCDEF);
+        vo1x1cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk01c1xGHIJKLMNOPQRSTUV, vi2x2c1, vo1x1cGHIJKLMNOPQRSTUV);
+        const __m512 vi3x0c1 = _mm512_set1_ps(i3[1]);
+        const __m512 vi3x2c1 = _mm512_set1_ps(i3[7]);
+        vo1x0c0123456789ABCDEF = _mm512_fmadd_ps(vk11c1x0123456789ABCDEF, vi3x0c1, vo1x0c0123456789ABCDEF);
+        vo1x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk11c1xGHIJKLMNOPQRSTUV, vi3x0c1, vo1x0cGHIJKLMNOPQRSTUV);
+        vo1x1c0123456789ABCDEF = _mm512_fmadd_ps(vk11c1x0123456789ABCDEF, vi3x2c1, vo1x1c0123456789ABCDEF);
+        vo1x1cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk11c1xGHIJKLMNOPQRSTUV, vi3x2c1, vo1x1cGHIJKLMNOPQRSTUV);
+        const __m512 vi4x0c1 = _mm512_set1_ps(i4[1]);
+        const __m512 vi4x2c1 = _mm512_set1_ps(i4[7]);
+        vo1x0c0123456789ABCDEF = _mm512_fmadd_ps(vk21c1x0123456789ABCDEF, vi4x0c1, vo1x0c0123456789ABCDEF);
+        vo1x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk21c1xGHIJKLMNOPQRSTUV, vi4x0c1, vo1x0cGHIJKLMNOPQRSTUV);
+        vo1x1c0123456789ABCDEF = _mm512_fmadd_ps(vk21c1x0123456789ABCDEF, vi4x2c1, vo1x1c0123456789ABCDEF);
+        vo1x1cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk21c1xGHIJKLMNOPQRSTUV, vi4x2c1, vo1x1cGHIJKLMNOPQRSTUV);
+
+        const __m512 vk02c1x0123456789ABCDEF = _mm512_load_ps(w + 704);
+        const __m512 vk02c1xGHIJKLMNOPQRSTUV = _mm512_load_ps(w + 720);
+        const __m512 vk12c1x0123456789ABCDEF = _mm512_load_ps(w + 736);
+        const __m512 vk12c1xGHIJKLMNOPQRSTUV = _mm512_load_ps(w + 752);
+        const __m512 vk22c1x0123456789ABCDEF = _mm512_load_ps(w + 768);
+        const __m512 vk22c1xGHIJKLMNOPQRSTUV = _mm512_load_ps(w + 784);
+        const __m512 vk00c1x0123456789ABCDEF = _mm512_load_ps(w + 128);
+        const __m512 vk00c1xGHIJKLMNOPQRSTUV = _mm512_load_ps(w + 144);
+        const __m512 vk10c1x0123456789ABCDEF = _mm512_load_ps(w + 160);
+        const __m512 vk10c1xGHIJKLMNOPQRSTUV = _mm512_load_ps(w + 176);
+        const __m512 vk20c1x0123456789ABCDEF = _mm512_load_ps(w + 192);
+        const __m512 vk20c1xGHIJKLMNOPQRSTUV = _mm512_load_ps(w + 208);
+
+        const __m512 vi0x1c1 = _mm512_set1_ps(i0[4]);
+        const __m512 vi0x3c1 = _mm512_set1_ps(i0[10]);
+        vo0x0c0123456789ABCDEF = _mm512_fmadd_ps(vk02c1x0123456789ABCDEF, vi0x1c1, vo0x0c0123456789ABCDEF);
+        vo0x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk02c1xGHIJKLMNOPQRSTUV, vi0x1c1, vo0x0cGHIJKLMNOPQRSTUV);
+        vo0x1c0123456789ABCDEF = _mm512_fmadd_ps(vk00c1x0123456789ABCDEF, vi0x1c1, vo0x1c0123456789ABCDEF);
+        vo0x1cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk00c1xGHIJKLMNOPQRSTUV, vi0x1c1, vo0x1cGHIJKLMNOPQRSTUV);
+        vo0x1c0123456789ABCDEF = _mm512_fmadd_ps(vk02c1x0123456789ABCDEF, vi0x3c1, vo0x1c0123456789ABCDEF);
+        vo0x1cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk02c1xGHIJKLMNOPQRSTUV, vi0x3c1, vo0x1cGHIJKLMNOPQRSTUV);
+        vo0x2c0123456789ABCDEF = _mm512_fmadd_ps(vk00c1x0123456789ABCDEF, vi0x3c1, vo0x2c0123456789ABCDEF);
+        vo0x2cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk00c1xGHIJKLMNOPQRSTUV, vi0x3c1, vo0x2cGHIJKLMNOPQRSTUV);
+        const __m512 vi1x1c1 = _mm512_set1_ps(i1[4]);
+        const __m512 vi1x3c1 = _mm512_set1_ps(i1[10]);
+        vo0x0c0123456789ABCDEF = _mm512_fmadd_ps(vk12c1x0123456789ABCDEF, vi1x1c1, vo0x0c0123456789ABCDEF);
+        vo0x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk12c1xGHIJKLMNOPQRSTUV, vi1x1c1, vo0x0cGHIJKLMNOPQRSTUV);
+        vo0x1c0123456789ABCDEF = _mm512_fmadd_ps(vk10c1x0123456789ABCDEF, vi1x1c1, vo0x1c0123456789ABCDEF);
+        vo0x1cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk10c1xGHIJKLMNOPQRSTUV, vi1x1c1, vo0x1cGHIJKLMNOPQRSTUV);
+        vo0x1c0123456789ABCDEF = _mm512_fmadd_ps(vk12c1x0123456789ABCDEF, vi1x3c1, vo0x1c0123456789ABCDEF);
+        vo0x1cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk12c1xGHIJKLMNOPQRSTUV, vi1x3c1, vo0x1cGHIJKLMNOPQRSTUV);
+        vo0x2c0123456789ABCDEF = _mm512_fmadd_ps(vk10c1x0123456789ABCDEF, vi1x3c1, vo0x2c0123456789ABCDEF);
+        vo0x2cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk10c1xGHIJKLMNOPQRSTUV, vi1x3c1, vo0x2cGHIJKLMNOPQRSTUV);
+        const __m512 vi2x1c1 = _mm512_set1_ps(i2[4]);
+        const __m512 vi2x3c1 = _mm512_set1_ps(i2[10]);
+        vo0x0c0123456789ABCDEF = _mm512_fmadd_ps(vk22c1x0123456789ABCDEF, vi2x1c1, vo0x0c0123456789ABCDEF);
+        vo0x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk22c1xGHIJKLMNOPQRSTUV, vi2x1c1, vo0x0cGHIJKLMNOPQRSTUV);
+        vo0x1c0123456789ABCDEF = _mm512_fmadd_ps(vk20c1x0123456789ABCDEF, vi2x1c1, vo0x1c0123456789ABCDEF);
+        vo0x1cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk20c1xGHIJKLMNOPQRSTUV, vi2x1c1, vo0x1cGHIJKLMNOPQRSTUV);
+        vo0x1c0123456789ABCDEF = _mm512_fmadd_ps(vk22c1x0123456789ABCDEF, vi2x3c1, vo0x1c0123456789ABCDEF);
+        vo0x1cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk22c1xGHIJKLMNOPQRSTUV, vi2x3c1, vo0x1cGHIJKLMNOPQRSTUV);
+        vo0x2c0123456789ABCDEF = _mm512_fmadd_ps(vk20c1x0123456789ABCDEF, vi2x3c1, vo0x2c0123456789ABCDEF);
+        vo0x2cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk20c1xGHIJKLMNOPQRSTUV, vi2x3c1, vo0x2cGHIJKLMNOPQRSTUV);
+        vo1x0c0123456789ABCDEF = _mm512_fmadd_ps(vk02c1x0123456789ABCDEF, vi2x1c1, vo1x0c0123456789ABCDEF);
+        vo1x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk02c1xGHIJKLMNOPQRSTUV, vi2x1c1, vo1x0cGHIJKLMNOPQRSTUV);
+        vo1x1c0123456789ABCDEF = _mm512_fmadd_ps(vk00c1x0123456789ABCDEF, vi2x1c1, vo1x1c0123456789ABCDEF);
+        vo1x1cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk00c1xGHIJKLMNOPQRSTUV, vi2x1c1, vo1x1cGHIJKLMNOPQRSTUV);
+        vo1x1c0123456789ABCDEF = _mm512_fmadd_ps(vk02c1x0123456789ABCDEF, vi2x3c1, vo1x1c0123456789ABCDEF);
+        vo1x1cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk02c1xGHIJKLMNOPQRSTUV, vi2x3c1, vo1x1cGHIJKLMNOPQRSTUV);
+        vo1x2c0123456789ABCDEF = _mm512_fmadd_ps(vk00c1x0123456789ABCDEF, vi2x3c1, vo1x2c0123456789ABCDEF);
+        vo1x2cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk00c1xGHIJKLMNOPQRSTUV, vi2x3c1, vo1x2cGHIJKLMNOPQRSTUV);
+        const __m512 vi3x1c1 = _mm512_set1_ps(i3[4]);
+        const __m512 vi3x3c1 = _mm512_set1_ps(i3[10]);
+        vo1x0c0123456789ABCDEF = _mm512_fmadd_ps(vk12c1x0123456789ABCDEF, vi3x1c1, vo1x0c0123456789ABCDEF);
+        vo1x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk12c1xGHIJKLMNOPQRSTUV, vi3x1c1, vo1x0cGHIJKLMNOPQRSTUV);
+        vo1x1c0123456789ABCDEF = _mm512_fmadd_ps(vk10c1x0123456789ABCDEF, vi3x1c1, vo1x1c0123456789ABCDEF);
+        vo1x1cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk10c1xGHIJKLMNOPQRSTUV, vi3x1c1, vo1x1cGHIJKLMNOPQRSTUV);
+        vo1x1c0123456789ABCDEF = _mm512_fmadd_ps(vk12c1x0123456789ABCDEF, vi3x3c1, vo1x1c0123456789ABCDEF);
+        vo1x1cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk12c1xGHIJKLMNOPQRSTUV, vi3x3c1, vo1x1cGHIJKLMNOPQRSTUV);
+        vo1x2c0123456789ABCDEF = _mm512_fmadd_ps(vk10c1x0123456789ABCDEF, vi3x3c1, vo1x2c0123456789ABCDEF);
+        vo1x2cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk10c1xGHIJKLMNOPQRSTUV, vi3x3c1, vo1x2cGHIJKLMNOPQRSTUV);
+        const __m512 vi4x1c1 = _mm512_set1_ps(i4[4]);
+        const __m512 vi4x3c1 = _mm512_set1_ps(i4[10]);
+        vo1x0c0123456789ABCDEF = _mm512_fmadd_ps(vk22c1x0123456789ABCDEF, vi4x1c1, vo1x0c0123456789ABCDEF);
+        vo1x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk22c1xGHIJKLMNOPQRSTUV, vi4x1c1, vo1x0cGHIJKLMNOPQRSTUV);
+        vo1x1c0123456789ABCDEF = _mm512_fmadd_ps(vk20c1x0123456789ABCDEF, vi4x1c1, vo1x1c0123456789ABCDEF);
+        vo1x1cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk20c1xGHIJKLMNOPQRSTUV, vi4x1c1, vo1x1cGHIJKLMNOPQRSTUV);
+        vo1x1c0123456789ABCDEF = _mm512_fmadd_ps(vk22c1x0123456789ABCDEF, vi4x3c1, vo1x1c0123456789ABCDEF);
+        vo1x1cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk22c1xGHIJKLMNOPQRSTUV, vi4x3c1, vo1x1cGHIJKLMNOPQRSTUV);
+        vo1x2c0123456789ABCDEF = _mm512_fmadd_ps(vk20c1x0123456789ABCDEF, vi4x3c1, vo1x2c0123456789ABCDEF);
+        vo1x2cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk20c1xGHIJKLMNOPQRSTUV, vi4x3c1, vo1x2cGHIJKLMNOPQRSTUV);
+        const __m512 vk01c2x0123456789ABCDEF = _mm512_load_ps(w + 512);
+        const __m512 vk01c2xGHIJKLMNOPQRSTUV = _mm512_load_ps(w + 528);
+        const __m512 vk11c2x0123456789ABCDEF = _mm512_load_ps(w + 544);
+        const __m512 vk11c2xGHIJKLMNOPQRSTUV = _mm512_load_ps(w + 560);
+        const __m512 vk21c2x0123456789ABCDEF = _mm512_load_ps(w + 576);
+        const __m512 vk21c2xGHIJKLMNOPQRSTUV = _mm512_load_ps(w + 592);
+
+        const __m512 vi0x0c2 = _mm512_set1_ps(i0[2]);
+        const __m512 vi0x2c2 = _mm512_set1_ps(i0[8]);
+        vo0x0c0123456789ABCDEF = _mm512_fmadd_ps(vk01c2x0123456789ABCDEF, vi0x0c2, vo0x0c0123456789ABCDEF);
+        vo0x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk01c2xGHIJKLMNOPQRSTUV, vi0x0c2, vo0x0cGHIJKLMNOPQRSTUV);
+        vo0x1c0123456789ABCDEF = _mm512_fmadd_ps(vk01c2x0123456789ABCDEF, vi0x2c2, vo0x1c0123456789ABCDEF);
+        vo0x1cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk01c2xGHIJKLMNOPQRSTUV, vi0x2c2, vo0x1cGHIJKLMNOPQRSTUV);
+        const __m512 vi1x0c2 = _mm512_set1_ps(i1[2]);
+        const __m512 vi1x2c2 = _mm512_set1_ps(i1[8]);
+        vo0x0c0123456789ABCDEF = _mm512_fmadd_ps(vk11c2x0123456789ABCDEF, vi1x0c2, vo0x0c0123456789ABCDEF);
+        vo0x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk11c2xGHIJKLMNOPQRSTUV, vi1x0c2, vo0x0cGHIJKLMNOPQRSTUV);
+        vo0x1c0123456789ABCDEF = _mm512_fmadd_ps(vk11c2x0123456789ABCDEF, vi1x2c2, vo0x1c0123456789ABCDEF);
+        vo0x1cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk11c2xGHIJKLMNOPQRSTUV, vi1x2c2, vo0x1cGHIJKLMNOPQRSTUV);
+        const __m512 vi2x0c2 = _mm512_set1_ps(i2[2]);
+        const __m512 vi2x2c2 = _mm512_set1_ps(i2[8]);
+        vo0x0c0123456789ABCDEF = _mm512_fmadd_ps(vk21c2x0123456789ABCDEF, vi2x0c2, vo0x0c0123456789ABCDEF);
+        vo0x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk21c2xGHIJKLMNOPQRSTUV, vi2x0c2, vo0x0cGHIJKLMNOPQRSTUV);
+        vo0x1c0123456789ABCDEF = _mm512_fmadd_ps(vk21c2x0123456789ABCDEF, vi2x2c2, vo0x1c0123456789ABCDEF);
+        vo0x1cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk21c2xGHIJKLMNOPQRSTUV, vi2x2c2, vo0x1cGHIJKLMNOPQRSTUV);
+        vo1x0c0123456789ABCDEF = _mm512_fmadd_ps(vk01c2x0123456789ABCDEF, vi2x0c2, vo1x0c0123456789ABCDEF);
+        vo1x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk01c2xGHIJKLMNOPQRSTUV, vi2x0c2, vo1x0cGHIJKLMNOPQRSTUV);
+        vo1x1c0123456789ABCDEF = _mm512_fmadd_ps(vk01c2x0123456789ABCDEF, vi2x2c2, vo1x1c0123456789ABCDEF);
+        vo1x1cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk01c2xGHIJKLMNOPQRSTUV, vi2x2c2, vo1x1cGHIJKLMNOPQRSTUV);
+        const __m512 vi3x0c2 = _mm512_set1_ps(i3[2]);
+        const __m512 vi3x2c2 = _mm512_set1_ps(i3[8]);
+        vo1x0c0123456789ABCDEF = _mm512_fmadd_ps(vk11c2x0123456789ABCDEF, vi3x0c2, vo1x0c0123456789ABCDEF);
+        vo1x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk11c2xGHIJKLMNOPQRSTUV, vi3x0c2, vo1x0cGHIJKLMNOPQRSTUV);
+        vo1x1c0123456789ABCDEF = _mm512_fmadd_ps(vk11c2x0123456789ABCDEF, vi3x2c2, vo1x1c0123456789ABCDEF);
+        vo1x1cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk11c2xGHIJKLMNOPQRSTUV, vi3x2c2, vo1x1cGHIJKLMNOPQRSTUV);
+        const __m512 vi4x0c2 = _mm512_set1_ps(i4[2]);
+        const __m512 vi4x2c2 = _mm512_set1_ps(i4[8]);
+        vo1x0c0123456789ABCDEF = _mm512_fmadd_ps(vk21c2x0123456789ABCDEF, vi4x0c2, vo1x0c0123456789ABCDEF);
+        vo1x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk21c2xGHIJKLMNOPQRSTUV, vi4x0c2, vo1x0cGHIJKLMNOPQRSTUV);
+        vo1x1c0123456789ABCDEF = _mm512_fmadd_ps(vk21c2x0123456789ABCDEF, vi4x2c2, vo1x1c0123456789ABCDEF);
+        vo1x1cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk21c2xGHIJKLMNOPQRSTUV, vi4x2c2, vo1x1cGHIJKLMNOPQRSTUV);
+
+        const __m512 vk02c2x0123456789ABCDEF = _mm512_load_ps(w + 800);
+        const __m512 vk02c2xGHIJKLMNOPQRSTUV = _mm512_load_ps(w + 816);
+        const __m512 vk12c2x0123456789ABCDEF = _mm512_load_ps(w + 832);
+        const __m512 vk12c2xGHIJKLMNOPQRSTUV = _mm512_load_ps(w + 848);
+        const __m512 vk22c2x0123456789ABCDEF = _mm512_load_ps(w + 864);
+        const __m512 vk22c2xGHIJKLMNOPQRSTUV = _mm512_load_ps(w + 880);
+        const __m512 vk00c2x0123456789ABCDEF = _mm512_load_ps(w + 224);
+        const __m512 vk00c2xGHIJKLMNOPQRSTUV = _mm512_load_ps(w + 240);
+        const __m512 vk10c2x0123456789ABCDEF = _mm512_load_ps(w + 256);
+        const __m512 vk10c2xGHIJKLMNOPQRSTUV = _mm512_load_ps(w + 272);
+        const __m512 vk20c2x0123456789ABCDEF = _mm512_load_ps(w + 288);
+        const __m512 vk20c2xGHIJKLMNOPQRSTUV = _mm512_load_ps(w + 304);
+
+        const __m512 vi0x1c2 = _mm512_set1_ps(i0[5]);
+        const __m512 vi0x3c2 = _mm512_set1_ps(i0[11]);
+        vo0x0c0123456789ABCDEF = _mm512_fmadd_ps(vk02c2x0123456789ABCDEF, vi0x1c2, vo0x0c0123456789ABCDEF);
+        vo0x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk02c2xGHIJKLMNOPQRSTUV, vi0x1c2, vo0x0cGHIJKLMNOPQRSTUV);
+        vo0x1c0123456789ABCDEF = _mm512_fmadd_ps(vk00c2x0123456789ABCDEF, vi0x1c2, vo0x1c0123456789ABCDEF);
+        vo0x1cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk00c2xGHIJKLMNOPQRSTUV, vi0x1c2, vo0x1cGHIJKLMNOPQRSTUV);
+        vo0x1c0123456789ABCDEF = _mm512_fmadd_ps(vk02c2x0123456789ABCDEF, vi0x3c2, vo0x1c0123456789ABCDEF);
+        vo0x1cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk02c2xGHIJKLMNOPQRSTUV, vi0x3c2, vo0x1cGHIJKLMNOPQRSTUV);
+        vo0x2c0123456789ABCDEF = _mm512_fmadd_ps(vk00c2x0123456789ABCDEF, vi0x3c2, vo0x2c0123456789ABCDEF);
+        vo0x2cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk00c2xGHIJKLMNOPQRSTUV, vi0x3c2, vo0x2cGHIJKLMNOPQRSTUV);
+        const __m512 vi1x1c2 = _mm512_set1_ps(i1[5]);
+        const __m512 vi1x3c2 = _mm512_set1_ps(i1[11]);
+        vo0x0c0123456789ABCDEF = _mm512_fmadd_ps(vk12c2x0123456789ABCDEF, vi1x1c2, vo0x0c0123456789ABCDEF);
+        vo0x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk12c2xGHIJKLMNOPQRSTUV, vi1x1c2, vo0x0cGHIJKLMNOPQRSTUV);
+        vo0x1c0123456789ABCDEF = _mm512_fmadd_ps(vk10c2x0123456789ABCDEF, vi1x1c2, vo0x1c0123456789ABCDEF);
+        vo0x1cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk10c2xGHIJKLMNOPQRSTUV, vi1x1c2, vo0x1cGHIJKLMNOPQRSTUV);
+        vo0x1c0123456789ABCDEF = _mm512_fmadd_ps(vk12c2x0123456789ABCDEF, vi1x3c2, vo0x1c0123456789ABCDEF);
+        vo0x1cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk12c2xGHIJKLMNOPQRSTUV, vi1x3c2, vo0x1cGHIJKLMNOPQRSTUV);
+        vo0x2c0123456789ABCDEF = _mm512_fmadd_ps(vk10c2x0123456789ABCDEF, vi1x3c2, vo0x2c0123456789ABCDEF);
+        vo0x2cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk10c2xGHIJKLMNOPQRSTUV, vi1x3c2, vo0x2cGHIJKLMNOPQRSTUV);
+        const __m512 vi2x1c2 = _mm512_set1_ps(i2[5]);
+        const __m512 vi2x3c2 = _mm512_set1_ps(i2[11]);
+        vo0x0c0123456789ABCDEF = _mm512_fmadd_ps(vk22c2x0123456789ABCDEF, vi2x1c2, vo0x0c0123456789ABCDEF);
+        vo0x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk22c2xGHIJKLMNOPQRSTUV, vi2x1c2, vo0x0cGHIJKLMNOPQRSTUV);
+        vo0x1c0123456789ABCDEF = _mm512_fmadd_ps(vk20c2x0123456789ABCDEF, vi2x1c2, vo0x1c0123456789ABCDEF);
+        vo0x1cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk20c2xGHIJKLMNOPQRSTUV, vi2x1c2, vo0x1cGHIJKLMNOPQRSTUV);
+        vo0x1c0123456789ABCDEF = _mm512_fmadd_ps(vk22c2x0123456789ABCDEF, vi2x3c2, vo0x1c0123456789ABCDEF);
+        vo0x1cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk22c2xGHIJKLMNOPQRSTUV, vi2x3c2, vo0x1cGHIJKLMNOPQRSTUV);
+        vo0x2c0123456789ABCDEF = _mm512_fmadd_ps(vk20c2x0123456789ABCDEF, vi2x3c2, vo0x2c0123456789ABCDEF);
+        vo0x2cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk20c2xGHIJKLMNOPQRSTUV, vi2x3c2, vo0x2cGHIJKLMNOPQRSTUV);
+        vo1x0c0123456789ABCDEF = _mm512_fmadd_ps(vk02c2x0123456789ABCDEF, vi2x1c2, vo1x0c0123456789ABCDEF);
+        vo1x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk02c2xGHIJKLMNOPQRSTUV, vi2x1c2, vo1x0cGHIJKLMNOPQRSTUV);
+        vo1x1c0123456789ABCDEF = _mm512_fmadd_ps(vk00c2x0123456789ABCDEF, vi2x1c2, vo1x1c0123456789ABCDEF);
+        vo1x1cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk00c2xGHIJKLMNOPQRSTUV, vi2x1c2, vo1x1cGHIJKLMNOPQRSTUV);
+        vo1x1c0123456789ABCDEF = _mm512_fmadd_ps(vk02c2x0123456789ABCDEF, vi2x3c2, vo1x1c0123456789ABCDEF);
+        vo1x1cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk02c2xGHIJKLMNOPQRSTUV, vi2x3c2, vo1x1cGHIJKLMNOPQRSTUV);
+        vo1x2c0123456789ABCDEF = _mm512_fmadd_ps(vk00c2x0123456789ABCDEF, vi2x3c2, vo1x2c0123456789ABCDEF);
+        vo1x2cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk00c2xGHIJKLMNOPQRSTUV, vi2x3c2, vo1x2cGHIJKLMNOPQRSTUV);
+        const __m512 vi3x1c2 = _mm512_set1_ps(i3[5]);
+        const __m512 vi3x3c2 = _mm512_set1_ps(i3[11]);
+        vo1x0c0123456789ABCDEF = _mm512_fmadd_ps(vk12c2x0123456789ABCDEF, vi3x1c2, vo1x0c0123456789ABCDEF);
+        vo1x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk12c2xGHIJKLMNOPQRSTUV, vi3x1c2, vo1x0cGHIJKLMNOPQRSTUV);
+        vo1x1c0123456789ABCDEF = _mm512_fmadd_ps(vk10c2x0123456789ABCDEF, vi3x1c2, vo1x1c0123456789ABCDEF);
+        vo1x1cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk10c2xGHIJKLMNOPQRSTUV, vi3x1c2, vo1x1cGHIJKLMNOPQRSTUV);
+        vo1x1c0123456789ABCDEF = _mm512_fmadd_ps(vk12c2x0123456789ABCDEF, vi3x3c2, vo1x1c0123456789ABCDEF);
+        vo1x1cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk12c2xGHIJKLMNOPQRSTUV, vi3x3c2, vo1x1cGHIJKLMNOPQRSTUV);
+        vo1x2c0123456789ABCDEF = _mm512_fmadd_ps(vk10c2x0123456789ABCDEF, vi3x3c2, vo1x2c0123456789ABCDEF);
+        vo1x2cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk10c2xGHIJKLMNOPQRSTUV, vi3x3c2, vo1x2cGHIJKLMNOPQRSTUV);
+        const __m512 vi4x1c2 = _mm512_set1_ps(i4[5]);
+        const __m512 vi4x3c2 = _mm512_set1_ps(i4[11]);
+        vo1x0c0123456789ABCDEF = _mm512_fmadd_ps(vk22c2x0123456789ABCDEF, vi4x1c2, vo1x0c0123456789ABCDEF);
+        vo1x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk22c2xGHIJKLMNOPQRSTUV, vi4x1c2, vo1x0cGHIJKLMNOPQRSTUV);
+        vo1x1c0123456789ABCDEF = _mm512_fmadd_ps(vk20c2x0123456789ABCDEF, vi4x1c2, vo1x1c0123456789ABCDEF);
+        vo1x1cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk20c2xGHIJKLMNOPQRSTUV, vi4x1c2, vo1x1cGHIJKLMNOPQRSTUV);
+        vo1x1c0123456789ABCDEF = _mm512_fmadd_ps(vk22c2x0123456789ABCDEF, vi4x3c2, vo1x1c0123456789ABCDEF);
+        vo1x1cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk22c2xGHIJKLMNOPQRSTUV, vi4x3c2, vo1x1cGHIJKLMNOPQRSTUV);
+        vo1x2c0123456789ABCDEF = _mm512_fmadd_ps(vk20c2x0123456789ABCDEF, vi4x3c2, vo1x2c0123456789ABCDEF);
+        vo1x2cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk20c2xGHIJKLMNOPQRSTUV, vi4x3c2, vo1x2cGHIJKLMNOPQRSTUV);
+
+        i0 += 12;
+        i1 += 12;
+        i2 += 12;
+        i3 += 12;
+        i4 += 12;
+
+        vo0x0c0123456789ABCDEF = _mm512_max_ps(vo0x0c0123456789ABCDEF, vmin);
+        vo0x0cGHIJKLMNOPQRSTUV = _mm512_max_ps(vo0x0cGHIJKLMNOPQRSTUV, vmin);
+        vo0x1c0123456789ABCDEF = _mm512_max_ps(vo0x1c0123456789ABCDEF, vmin);
+        vo0x1cGHIJKLMNOPQRSTUV = _mm512_max_ps(vo0x1cGHIJKLMNOPQRSTUV, vmin);
+        vo1x0c0123456789ABCDEF = _mm512_max_ps(vo1x0c0123456789ABCDEF, vmin);
+        vo1x0cGHIJKLMNOPQRSTUV = _mm512_max_ps(vo1x0cGHIJKLMNOPQRSTUV, vmin);
+        vo1x1c0123456789ABCDEF = _mm512_max_ps(vo1x1c0123456789ABCDEF, vmin);
+        vo1x1cGHIJKLMNOPQRSTUV = _mm512_max_ps(vo1x1cGHIJKLMNOPQRSTUV, vmin);
+        vo0x0c0123456789ABCDEF = _mm512_min_ps(vo0x0c0123456789ABCDEF, vmax);
+        vo0x0cGHIJKLMNOPQRSTUV = _mm512_min_ps(vo0x0cGHIJKLMNOPQRSTUV, vmax);
+        vo0x1c0123456789ABCDEF = _mm512_min_ps(vo0x1c0123456789ABCDEF, vmax);
+        vo0x1cGHIJKLMNOPQRSTUV = _mm512_min_ps(vo0x1cGHIJKLMNOPQRSTUV, vmax);
+        vo1x0c0123456789ABCDEF = _mm512_min_ps(vo1x0c0123456789ABCDEF, vmax);
+        vo1x0cGHIJKLMNOPQRSTUV = _mm512_min_ps(vo1x0cGHIJKLMNOPQRSTUV, vmax);
+        vo1x1c0123456789ABCDEF = _mm512_min_ps(vo1x1c0123456789ABCDEF, vmax);
+        vo1x1cGHIJKLMNOPQRSTUV = _mm512_min_ps(vo1x1cGHIJKLMNOPQRSTUV, vmax);
+
+        if XNN_LIKELY(c >= 32) {
+          _mm512_storeu_ps(o1, vo1x0c0123456789ABCDEF);
+          _mm512_storeu_ps(o1 + 16, vo1x0cGHIJKLMNOPQRSTUV);
+          o1 = (float*) ((uintptr_t) o1 + output_width_stride);
+          _mm512_storeu_ps(o1, vo1x1c0123456789ABCDEF);
+          _mm512_storeu_ps(o1 + 16, vo1x1cGHIJKLMNOPQRSTUV);
+          o1 = (float*) ((uintptr_t) o1 + output_width_stride);
+          _mm512_storeu_ps(o0, vo0x0c0123456789ABCDEF);
+          _mm512_storeu_ps(o0 + 16, vo0x0cGHIJKLMNOPQRSTUV);
+          o0 = (float*) ((uintptr_t) o0 + output_width_stride);
+          _mm512_storeu_ps(o0, vo0x1c0123456789ABCDEF);
+          _mm512_storeu_ps(o0 + 16, vo0x1cGHIJKLMNOPQRSTUV);
+          o0 = (float*) ((uintptr_t) o0 + output_width_stride);
+        } else {
+          float* o1_tmp = o1;
+          float* o0_tmp = o0;
+          if (c & 16) {
+            _mm512_storeu_ps((float*) ((uintptr_t) o1_tmp + output_width_stride * 1) + 0, vo1x1c0123456789ABCDEF);
+            _mm512_storeu_ps((float*) ((uintptr_t) o1_tmp + output_width_stride * 0) + 0, vo1x0c0123456789ABCDEF);
+            _mm512_storeu_ps((float*) ((uintptr_t) o0_tmp + output_width_stride * 1) + 0, vo0x1c0123456789ABCDEF);
+            _mm512_storeu_ps((float*) ((uintptr_t) o0_tmp + output_width_stride * 0) + 0, vo0x0c0123456789ABCDEF);
+            o1_tmp += 16;
+            o0_tmp += 16;
+            vo0x0c0123456789ABCDEF = vo0x0cGHIJKLMNOPQRSTUV;
+            vo0x1c0123456789ABCDEF = vo0x1cGHIJKLMNOPQRSTUV;
+            vo1x0c0123456789ABCDEF = vo1x0cGHIJKLMNOPQRSTUV;
+            vo1x1c0123456789ABCDEF = vo1x1cGHIJKLMNOPQRSTUV;
+          }
+          // Prepare mask for valid 32-bit elements (depends on c).
+          const __mmask16 vmask = _cvtu32_mask16((uint16_t) ((uint32_t) (UINT32_C(1) << (c & 15)) - UINT32_C(1)));
+          _mm512_mask_storeu_ps((float*) ((uintptr_t) o1_tmp + output_width_stride * 1), vmask, vo1x1c0123456789ABCDEF);
+          _mm512_mask_storeu_ps((float*) ((uintptr_t) o1_tmp + output_width_stride * 0), vmask, vo1x0c0123456789ABCDEF);
+          _mm512_mask_storeu_ps((float*) ((uintptr_t) o0_tmp + output_width_stride * 1), vmask, vo0x1c0123456789ABCDEF);
+          _mm512_mask_storeu_ps((float*) ((uintptr_t) o0_tmp + output_width_stride * 0), vmask, vo0x0c0123456789ABCDEF);
+          o1 = (float*) ((uintptr_t) o1 + output_width_stride * 2);
+          o0 = (float*) ((uintptr_t) o0 + output_width_stride * 2);
+        }
+
+        vo0x0c0123456789ABCDEF = vo0x2c0123456789ABCDEF;
+        vo0x0cGHIJKLMNOPQRSTUV = vo0x2cGHIJKLMNOPQRSTUV;
+        vo1x0c0123456789ABCDEF = vo1x2c0123456789ABCDEF;
+        vo1x0cGHIJKLMNOPQRSTUV = vo1x2cGHIJKLMNOPQRSTUV;
+      }
+      if (iw >= 2) {
+        __m512 vo0x1c0123456789ABCDEF = _mm512_load_ps(w + 0);
+        __m512 vo0x1cGHIJKLMNOPQRSTUV = _mm512_load_ps(w + 16);
+        __m512 vo1x1c0123456789ABCDEF = vo0x1c0123456789ABCDEF;
+        __m512 vo1x1cGHIJKLMNOPQRSTUV = vo0x1cGHIJKLMNOPQRSTUV;
+
+        const __m512 vk01c0x0123456789ABCDEF = _mm512_load_ps(w + 320);
+        const __m512 vk01c0xGHIJKLMNOPQRSTUV = _mm512_load_ps(w + 336);
+        const __m512 vk11c0x0123456789ABCDEF = _mm512_load_ps(w + 352);
+        const __m512 vk11c0xGHIJKLMNOPQRSTUV = _mm512_load_ps(w + 368);
+        const __m512 vk21c0x0123456789ABCDEF = _mm512_load_ps(w + 384);
+        const __m512 vk21c0xGHIJKLMNOPQRSTUV = _mm512_load_ps(w + 400);
+
+        const __m512 vi0x0c0 = _mm512_set1_ps(i0[0]);
+        vo0x0c0123456789ABCDEF = _mm512_fmadd_ps(vk01c0x0123456789ABCDEF, vi0x0c0, vo0x0c0123456789ABCDEF);
+        vo0x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk01c0xGHIJKLMNOPQRSTUV, vi0x0c0, vo0x0cGHIJKLMNOPQRSTUV);
+        const __m512 vi1x0c0 = _mm512_set1_ps(i1[0]);
+        vo0x0c0123456789ABCDEF = _mm512_fmadd_ps(vk11c0x0123456789ABCDEF, vi1x0c0, vo0x0c0123456789ABCDEF);
+        vo0x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk11c0xGHIJKLMNOPQRSTUV, vi1x0c0, vo0x0cGHIJKLMNOPQRSTUV);
+        const __m512 vi2x0c0 = _mm512_set1_ps(i2[0]);
+        vo0x0c0123456789ABCDEF = _mm512_fmadd_ps(vk21c0x0123456789ABCDEF, vi2x0c0, vo0x0c0123456789ABCDEF);
+        vo0x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk21c0xGHIJKLMNOPQRSTUV, vi2x0c0, vo0x0cGHIJKLMNOPQRSTUV);
+        vo1x0c0123456789ABCDEF = _mm512_fmadd_ps(vk01c0x0123456789ABCDEF, vi2x0c0, vo1x0c0123456789ABCDEF);
+        vo1x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk01c0xGHIJKLMNOPQRSTUV, vi2x0c0, vo1x0cGHIJKLMNOPQRSTUV);
+        const __m512 vi3x0c0 = _mm512_set1_ps(i3[0]);
+        vo1x0c0123456789ABCDEF = _mm512_fmadd_ps(vk11c0x0123456789ABCDEF, vi3x0c0, vo1x0c0123456789ABCDEF);
+        vo1x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk11c0xGHIJKLMNOPQRSTUV, vi3x0c0, vo1x0cGHIJKLMNOPQRSTUV);
+        const __m512 vi4x0c0 = _mm512_set1_ps(i4[0]);
+        vo1x0c0123456789ABCDEF = _mm512_fmadd_ps(vk21c0x0123456789ABCDEF, vi4x0c0, vo1x0c0123456789ABCDEF);
+        vo1x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk21c0xGHIJKLMNOPQRSTUV, vi4x0c0, vo1x0cGHIJKLMNOPQRSTUV);
+
+        const __m512 vk02c0x0123456789ABCDEF = _mm512_load_ps(w + 608);
+        const __m512 vk02c0xGHIJKLMNOPQRSTUV = _mm512_load_ps(w + 624);
+        const __m512 vk12c0x0123456789ABCDEF = _mm512_load_ps(w + 640);
+        const __m512 vk12c0xGHIJKLMNOPQRSTUV = _mm512_load_ps(w + 656);
+        const __m512 vk22c0x0123456789ABCDEF = _mm512_load_ps(w + 672);
+        const __m512 vk22c0xGHIJKLMNOPQRSTUV = _mm512_load_ps(w + 688);
+        const __m512 vk00c0x0123456789ABCDEF = _mm512_load_ps(w + 32);
+        const __m512 vk00c0xGHIJKLMNOPQRSTUV = _mm512_load_ps(w + 48);
+        const __m512 vk10c0x0123456789ABCDEF = _mm512_load_ps(w + 64);
+        const __m512 vk10c0xGHIJKLMNOPQRSTUV = _mm512_load_ps(w + 80);
+        const __m512 vk20c0x0123456789ABCDEF = _mm512_load_ps(w + 96);
+        const __m512 vk20c0xGHIJKLMNOPQRSTUV = _mm512_load_ps(w + 112);
+
+        const __m512 vi0x1c0 = _mm512_set1_ps(i0[3]);
+        vo0x0c0123456789ABCDEF = _mm512_fmadd_ps(vk02c0x0123456789ABCDEF, vi0x1c0, vo0x0c0123456789ABCDEF);
+        vo0x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk02c0xGHIJKLMNOPQRSTUV, vi0x1c0, vo0x0cGHIJKLMNOPQRSTUV);
+        vo0x1c0123456789ABCDEF = _mm512_fmadd_ps(vk00c0x0123456789ABCDEF, vi0x1c0, vo0x1c0123456789ABCDEF);
+        vo0x1cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk00c0xGHIJKLMNOPQRSTUV, vi0x1c0, vo0x1cGHIJKLMNOPQRSTUV);
+        const __m512 vi1x1c0 = _mm512_set1_ps(i1[3]);
+        vo0x0c0123456789ABCDEF = _mm512_fmadd_ps(vk12c0x0123456789ABCDEF, vi1x1c0, vo0x0c0123456789ABCDEF);
+        vo0x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk12c0xGHIJKLMNOPQRSTUV, vi1x1c0, vo0x0cGHIJKLMNOPQRSTUV);
+        vo0x1c0123456789ABCDEF = _mm512_fmadd_ps(vk10c0x0123456789ABCDEF, vi1x1c0, vo0x1c0123456789ABCDEF);
+        vo0x1cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk10c0xGHIJKLMNOPQRSTUV, vi1x1c0, vo0x1cGHIJKLMNOPQRSTUV);
+        const __m512 vi2x1c0 = _mm512_set1_ps(i2[3]);
+        vo0x0c0123456789ABCDEF = _mm512_fmadd_ps(vk22c0x0123456789ABCDEF, vi2x1c0, vo0x0c0123456789ABCDEF);
+        vo0x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk22c0xGHIJKLMNOPQRSTUV, vi2x1c0, vo0x0cGHIJKLMNOPQRSTUV);
+        vo0x1c0123456789ABCDEF = _mm512_fmadd_ps(vk20c0x0123456789ABCDEF, vi2x1c0, vo0x1c0123456789ABCDEF);
+        vo0x1cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk20c0xGHIJKLMNOPQRSTUV, vi2x1c0, vo0x1cGHIJKLMNOPQRSTUV);
+        vo1x0c0123456789ABCDEF = _mm512_fmadd_ps(vk02c0x0123456789ABCDEF, vi2x1c0, vo1x0c0123456789ABCDEF);
+        vo1x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk02c0xGHIJKLMNOPQRSTUV, vi2x1c0, vo1x0cGHIJKLMNOPQRSTUV);
+        vo1x1c0123456789ABCDEF = _mm512_fmadd_ps(vk00c0x0123456789ABCDEF, vi2x1c0, vo1x1c0123456789ABCDEF);
+        vo1x1cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk00c0xGHIJKLMNOPQRSTUV, vi2x1c0, vo1x1cGHIJKLMNOPQRSTUV);
+        const __m512 vi3x1c0 = _mm512_set1_ps(i3[3]);
+        vo1x0c0123456789ABCDEF = _mm512_fmadd_ps(vk12c0x0123456789ABCDEF, vi3x1c0, vo1x0c0123456789ABCDEF);
+        vo1x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk12c0xGHIJKLMNOPQRSTUV, vi3x1c0, vo1x0cGHIJKLMNOPQRSTUV);
+        vo1x1c0123456789ABCDEF = _mm512_fmadd_ps(vk10c0x0123456789ABCDEF, vi3x1c0, vo1x1c0123456789ABCDEF);
+        vo1x1cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk10c0xGHIJKLMNOPQRSTUV, vi3x1c0, vo1x1cGHIJKLMNOPQRSTUV);
+        const __m512 vi4x1c0 = _mm512_set1_ps(i4[3]);
+        vo1x0c0123456789ABCDEF = _mm512_fmadd_ps(vk22c0x0123456789ABCDEF, vi4x1c0, vo1x0c0123456789ABCDEF);
+        vo1x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk22c0xGHIJKLMNOPQRSTUV, vi4x1c0, vo1x0cGHIJKLMNOPQRSTUV);
+        vo1x1c0123456789ABCDEF = _mm512_fmadd_ps(vk20c0x0123456789ABCDEF, vi4x1c0, vo1x1c0123456789ABCDEF);
+        vo1x1cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk20c0xGHIJKLMNOPQRSTUV, vi4x1c0, vo1x1cGHIJKLMNOPQRSTUV);
+        const __m512 vk01c1x0123456789ABCDEF = _mm512_load_ps(w + 416);
+        const __m512 vk01c1xGHIJKLMNOPQRSTUV = _mm512_load_ps(w + 432);
+        const __m512 vk11c1x0123456789ABCDEF = _mm512_load_ps(w + 448);
+        const __m512 vk11c1xGHIJKLMNOPQRSTUV = _mm512_load_ps(w + 464);
+        const __m512 vk21c1x0123456789ABCDEF = _mm512_load_ps(w + 480);
+        const __m512 vk21c1xGHIJKLMNOPQRSTUV = _mm512_load_ps(w + 496);
+
+        const __m512 vi0x0c1 = _mm512_set1_ps(i0[1]);
+        vo0x0c0123456789ABCDEF = _mm512_fmadd_ps(vk01c1x0123456789ABCDEF, vi0x0c1, vo0x0c0123456789ABCDEF);
+        vo0x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk01c1xGHIJKLMNOPQRSTUV, vi0x0c1, vo0x0cGHIJKLMNOPQRSTUV);
+        const __m512 vi1x0c1 = _mm512_set1_ps(i1[1]);
+        vo0x0c0123456789ABCDEF = _mm512_fmadd_ps(vk11c1x0123456789ABCDEF, vi1x0c1, vo0x0c0123456789ABCDEF);
+        vo0x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk11c1xGHIJKLMNOPQRSTUV, vi1x0c1, vo0x0cGHIJKLMNOPQRSTUV);
+        const __m512 vi2x0c1 = _mm512_set1_ps(i2[1]);
+        vo0x0c0123456789ABCDEF = _mm512_fmadd_ps(vk21c1x0123456789ABCDEF, vi2x0c1, vo0x0c0123456789ABCDEF);
+        vo0x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk21c1xGHIJKLMNOPQRSTUV, vi2x0c1, vo0x0cGHIJKLMNOPQRSTUV);
+        vo1x0c0123456789ABCDEF = _mm512_fmadd_ps(vk01c1x0123456789ABCDEF, vi2x0c1, vo1x0c0123456789ABCDEF);
+        vo1x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk01c1xGHIJKLMNOPQRSTUV, vi2x0c1, vo1x0cGHIJKLMNOPQRSTUV);
+        const __m512 vi3x0c1 = _mm512_set1_ps(i3[1]);
+        vo1x0c0123456789ABCDEF = _mm512_fmadd_ps(vk11c1x0123456789ABCDEF, vi3x0c1, vo1x0c0123456789ABCDEF);
+        vo1x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk11c1xGHIJKLMNOPQRSTUV, vi3x0c1, vo1x0cGHIJKLMNOPQRSTUV);
+        const __m512 vi4x0c1 = _mm512_set1_ps(i4[1]);
+        vo1x0c0123456789ABCDEF = _mm512_fmadd_ps(vk21c1x0123456789ABCDEF, vi4x0c1, vo1x0c0123456789ABCDEF);
+        vo1x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk21c1xGHIJKLMNOPQRSTUV, vi4x0c1, vo1x0cGHIJKLMNOPQRSTUV);
+
+        const __m512 vk02c1x0123456789ABCDEF = _mm512_load_ps(w + 704);
+        const __m512 vk02c1xGHIJKLMNOPQRSTUV = _mm512_load_ps(w + 720);
+        const __m512 vk12c1x0123456789ABCDEF = _mm512_load_ps(w + 736);
+        const __m512 vk12c1xGHIJKLMNOPQRSTUV = _mm512_load_ps(w + 752);
+        const __m512 vk22c1x0123456789ABCDEF = _mm512_load_ps(w + 768);
+        const __m512 vk22c1xGHIJKLMNOPQRSTUV = _mm512_load_ps(w + 784);
+        const __m512 vk00c1x0123456789ABCDEF = _mm512_load_ps(w + 128);
+        const __m512 vk00c1xGHIJKLMNOPQRSTUV = _mm512_load_ps(w + 144);
+        const __m512 vk10c1x0123456789ABCDEF = _mm512_load_ps(w + 160);
+        const __m512 vk10c1xGHIJKLMNOPQRSTUV = _mm512_load_ps(w + 176);
+        const __m512 vk20c1x0123456789ABCDEF = _mm512_load_ps(w + 192);
+        const __m512 vk20c1xGHIJKLMNOPQRSTUV = _mm512_load_ps(w + 208);
+
+        const __m512 vi0x1c1 = _mm512_set1_ps(i0[4]);
+        vo0x0c0123456789ABCDEF = _mm512_fmadd_ps(vk02c1x0123456789ABCDEF, vi0x1c1, vo0x0c0123456789ABCDEF);
+        vo0x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk02c1xGHIJKLMNOPQRSTUV, vi0x1c1, vo0x0cGHIJKLMNOPQRSTUV);
+        vo0x1c0123456789ABCDEF = _mm512_fmadd_ps(vk00c1x0123456789ABCDEF, vi0x1c1, vo0x1c0123456789ABCDEF);
+        vo0x1cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk00c1xGHIJKLMNOPQRSTUV, vi0x1c1, vo0x1cGHIJKLMNOPQRSTUV);
+        const __m512 vi1x1c1 = _mm512_set1_ps(i1[4]);
+        vo0x0c0123456789ABCDEF = _mm512_fmadd_ps(vk12c1x0123456789ABCDEF, vi1x1c1, vo0x0c0123456789ABCDEF);
+        vo0x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk12c1xGHIJKLMNOPQRSTUV, vi1x1c1, vo0x0cGHIJKLMNOPQRSTUV);
+        vo0x1c0123456789ABCDEF = _mm512_fmadd_ps(vk10c1x0123456789ABCDEF, vi1x1c1, vo0x1c0123456789ABCDEF);
+        vo0x1cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk10c1xGHIJKLMNOPQRSTUV, vi1x1c1, vo0x1cGHIJKLMNOPQRSTUV);
+        const __m512 vi2x1c1 = _mm512_set1_ps(i2[4]);
+        vo0x0c0123456789ABCDEF = _mm512_fmadd_ps(vk22c1x0123456789ABCDEF, vi2x1c1, vo0x0c0123456789ABCDEF);
+        vo0x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk22c1xGHIJKLMNOPQRSTUV, vi2x1c1, vo0x0cGHIJKLMNOPQRSTUV);
+        vo0x1c0123456789ABCDEF = _mm512_fmadd_ps(vk20c1x0123456789ABCDEF, vi2x1c1, vo0x1c0123456789ABCDEF);
+        vo0x1cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk20c1xGHIJKLMNOPQRSTUV, vi2x1c1, vo0x1cGHIJKLMNOPQRSTUV);
+        vo1x0c0123456789ABCDEF = _mm512_fmadd_ps(vk02c1x0123456789ABCDEF, vi2x1c1, vo1x0c0123456789ABCDEF);
+        vo1x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk02c1xGHIJKLMNOPQRSTUV, vi2x1c1, vo1x0cGHIJKLMNOPQRSTUV);
+        vo1x1c0123456789ABCDEF = _mm512_fmadd_ps(vk00c1x0123456789ABCDEF, vi2x1c1, vo1x1c0123456789ABCDEF);
+        vo1x1cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk00c1xGHIJKLMNOPQRSTUV, vi2x1c1, vo1x1cGHIJKLMNOPQRSTUV);
+        const __m512 vi3x1c1 = _mm512_set1_ps(i3[4]);
+        vo1x0c0123456789ABCDEF = _mm512_fmadd_ps(vk12c1x0123456789ABCDEF, vi3x1c1, vo1x0c0123456789ABCDEF);
+        vo1x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk12c1xGHIJKLMNOPQRSTUV, vi3x1c1, vo1x0cGHIJKLMNOPQRSTUV);
+        vo1x1c0123456789ABCDEF = _mm512_fmadd_ps(vk10c1x0123456789ABCDEF, vi3x1c1, vo1x1c0123456789ABCDEF);
+        vo1x1cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk10c1xGHIJKLMNOPQRSTUV, vi3x1c1, vo1x1cGHIJKLMNOPQRSTUV);
+        const __m512 vi4x1c1 = _mm512_set1_ps(i4[4]);
+        vo1x0c0123456789ABCDEF = _mm512_fmadd_ps(vk22c1x0123456789ABCDEF, vi4x1c1, vo1x0c0123456789ABCDEF);
+        vo1x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk22c1xGHIJKLMNOPQRSTUV, vi4x1c1, vo1x0cGHIJKLMNOPQRSTUV);
+        vo1x1c0123456789ABCDEF = _mm512_fmadd_ps(vk20c1x0123456789ABCDEF, vi4x1c1, vo1x1c0123456789ABCDEF);
+        vo1x1cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk20c1xGHIJKLMNOPQRSTUV, vi4x1c1, vo1x1cGHIJKLMNOPQRSTUV);
+        const __m512 vk01c2x0123456789ABCDEF = _mm512_load_ps(w + 512);
+        const __m512 vk01c2xGHIJKLMNOPQRSTUV = _mm512_load_ps(w + 528);
+        const __m512 vk11c2x0123456789ABCDEF = _mm512_load_ps(w + 544);
+        const __m512 vk11c2xGHIJKLMNOPQRSTUV = _mm512_load_ps(w + 560);
+        const __m512 vk21c2x0123456789ABCDEF = _mm512_load_ps(w + 576);
+        const __m512 vk21c2xGHIJKLMNOPQRSTUV = _mm512_load_ps(w + 592);
+
+        const __m512 vi0x0c2 = _mm512_set1_ps(i0[2]);
+        vo0x0c0123456789ABCDEF = _mm512_fmadd_ps(vk01c2x0123456789ABCDEF, vi0x0c2, vo0x0c0123456789ABCDEF);
+        vo0x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk01c2xGHIJKLMNOPQRSTUV, vi0x0c2, vo0x0cGHIJKLMNOPQRSTUV);
+        const __m512 vi1x0c2 = _mm512_set1_ps(i1[2]);
+        vo0x0c0123456789ABCDEF = _mm512_fmadd_ps(vk11c2x0123456789ABCDEF, vi1x0c2, vo0x0c0123456789ABCDEF);
+        vo0x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk11c2xGHIJKLMNOPQRSTUV, vi1x0c2, vo0x0cGHIJKLMNOPQRSTUV);
+        const __m512 vi2x0c2 = _mm512_set1_ps(i2[2]);
+        vo0x0c0123456789ABCDEF = _mm512_fmadd_ps(vk21c2x0123456789ABCDEF, vi2x0c2, vo0x0c0123456789ABCDEF);
+        vo0x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk21c2xGHIJKLMNOPQRSTUV, vi2x0c2, vo0x0cGHIJKLMNOPQRSTUV);
+        vo1x0c0123456789ABCDEF = _mm512_fmadd_ps(vk01c2x0123456789ABCDEF, vi2x0c2, vo1x0c0123456789ABCDEF);
+        vo1x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk01c2xGHIJKLMNOPQRSTUV, vi2x0c2, vo1x0cGHIJKLMNOPQRSTUV);
+        const __m512 vi3x0c2 = _mm512_set1_ps(i3[2]);
+        vo1x0c0123456789ABCDEF = _mm512_fmadd_ps(vk11c2x0123456789ABCDEF, vi3x0c2, vo1x0c0123456789ABCDEF);
+        vo1x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk11c2xGHIJKLMNOPQRSTUV, vi3x0c2, vo1x0cGHIJKLMNOPQRSTUV);
+        const __m512 vi4x0c2 = _mm512_set1_ps(i4[2]);
+        vo1x0c0123456789ABCDEF = _mm512_fmadd_ps(vk21c2x0123456789ABCDEF, vi4x0c2, vo1x0c0123456789ABCDEF);
+        vo1x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk21c2xGHIJKLMNOPQRSTUV, vi4x0c2, vo1x0cGHIJKLMNOPQRSTUV);
+
+        const __m512 vk02c2x0123456789ABCDEF = _mm512_load_ps(w + 800);
+        const __m512 vk02c2xGHIJKLMNOPQRSTUV = _mm512_load_ps(w + 816);
+        const __m512 vk12c2x0123456789ABCDEF = _mm512_load_ps(w + 832);
+        const __m512 vk12c2xGHIJKLMNOPQRSTUV = _mm512_load_ps(w + 848);
+        const __m512 vk22c2x0123456789ABCDEF = _mm512_load_ps(w + 864);
+        const __m512 vk22c2xGHIJKLMNOPQRSTUV = _mm512_load_ps(w + 880);
+        const __m512 vk00c2x0123456789ABCDEF = _mm512_load_ps(w + 224);
+        const __m512 vk00c2xGHIJKLMNOPQRSTUV = _mm512_load_ps(w + 240);
+        const __m512 vk10c2x0123456789ABCDEF = _mm512_load_ps(w + 256);
+        const __m512 vk10c2xGHIJKLMNOPQRSTUV = _mm512_load_ps(w + 272);
+        const __m512 vk20c2x0123456789ABCDEF = _mm512_load_ps(w + 288);
+        const __m512 vk20c2xGHIJKLMNOPQRSTUV = _mm512_load_ps(w + 304);
+
+        const __m512 vi0x1c2 = _mm512_set1_ps(i0[5]);
+        vo0x0c0123456789ABCDEF = _mm512_fmadd_ps(vk02c2x0123456789ABCDEF, vi0x1c2, vo0x0c0123456789ABCDEF);
+        vo0x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk02c2xGHIJKLMNOPQRSTUV, vi0x1c2, vo0x0cGHIJKLMNOPQRSTUV);
+        vo0x1c0123456789ABCDEF = _mm512_fmadd_ps(vk00c2x0123456789ABCDEF, vi0x1c2, vo0x1c0123456789ABCDEF);
+        vo0x1cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk00c2xGHIJKLMNOPQRSTUV, vi0x1c2, vo0x1cGHIJKLMNOPQRSTUV);
+        const __m512 vi1x1c2 = _mm512_set1_ps(i1[5]);
+        vo0x0c0123456789ABCDEF = _mm512_fmadd_ps(vk12c2x0123456789ABCDEF, vi1x1c2, vo0x0c0123456789ABCDEF);
+        vo0x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk12c2xGHIJKLMNOPQRSTUV, vi1x1c2, vo0x0cGHIJKLMNOPQRSTUV);
+        vo0x1c0123456789ABCDEF = _mm512_fmadd_ps(vk10c2x0123456789ABCDEF, vi1x1c2, vo0x1c0123456789ABCDEF);
+        vo0x1cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk10c2xGHIJKLMNOPQRSTUV, vi1x1c2, vo0x1cGHIJKLMNOPQRSTUV);
+        const __m512 vi2x1c2 = _mm512_set1_ps(i2[5]);
+        vo0x0c0123456789ABCDEF = _mm512_fmadd_ps(vk22c2x0123456789ABCDEF, vi2x1c2, vo0x0c0123456789ABCDEF);
+        vo0x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk22c2xGHIJKLMNOPQRSTUV, vi2x1c2, vo0x0cGHIJKLMNOPQRSTUV);
+        vo0x1c0123456789ABCDEF = _mm512_fmadd_ps(vk20c2x0123456789ABCDEF, vi2x1c2, vo0x1c0123456789ABCDEF);
+        vo0x1cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk20c2xGHIJKLMNOPQRSTUV, vi2x1c2, vo0x1cGHIJKLMNOPQRSTUV);
+        vo1x0c0123456789ABCDEF = _mm512_fmadd_ps(vk02c2x0123456789ABCDEF, vi2x1c2, vo1x0c0123456789ABCDEF);
+        vo1x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk02c2xGHIJKLMNOPQRSTUV, vi2x1c2, vo1x0cGHIJKLMNOPQRSTUV);
+        vo1x1c0123456789ABCDEF = _mm512_fmadd_ps(vk00c2x0123456789ABCDEF, vi2x1c2, vo1x1c0123456789ABCDEF);
+        vo1x1cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk00c2xGHIJKLMNOPQRSTUV, vi2x1c2, vo1x1cGHIJKLMNOPQRSTUV);
+        const __m512 vi3x1c2 = _mm512_set1_ps(i3[5]);
+        vo1x0c0123456789ABCDEF = _mm512_fmadd_ps(vk12c2x0123456789ABCDEF, vi3x1c2, vo1x0c0123456789ABCDEF);
+        vo1x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk12c2xGHIJKLMNOPQRSTUV, vi3x1c2, vo1x0cGHIJKLMNOPQRSTUV);
+        vo1x1c0123456789ABCDEF = _mm512_fmadd_ps(vk10c2x0123456789ABCDEF, vi3x1c2, vo1x1c0123456789ABCDEF);
+        vo1x1cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk10c2xGHIJKLMNOPQRSTUV, vi3x1c2, vo1x1cGHIJKLMNOPQRSTUV);
+        const __m512 vi4x1c2 = _mm512_set1_ps(i4[5]);
+        vo1x0c0123456789ABCDEF = _mm512_fmadd_ps(vk22c2x0123456789ABCDEF, vi4x1c2, vo1x0c0123456789ABCDEF);
+        vo1x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk22c2xGHIJKLMNOPQRSTUV, vi4x1c2, vo1x0cGHIJKLMNOPQRSTUV);
+        vo1x1c0123456789ABCDEF = _mm512_fmadd_ps(vk20c2x0123456789ABCDEF, vi4x1c2, vo1x1c0123456789ABCDEF);
+        vo1x1cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk20c2xGHIJKLMNOPQRSTUV, vi4x1c2, vo1x1cGHIJKLMNOPQRSTUV);
+
+        i0 += 6;
+        i1 += 6;
+        i2 += 6;
+        i3 += 6;
+        i4 += 6;
+
+        vo0x0c0123456789ABCDEF = _mm512_max_ps(vo0x0c0123456789ABCDEF, vmin);
+        vo0x0cGHIJKLMNOPQRSTUV = _mm512_max_ps(vo0x0cGHIJKLMNOPQRSTUV, vmin);
+        vo1x0c0123456789ABCDEF = _mm512_max_ps(vo1x0c0123456789ABCDEF, vmin);
+        vo1x0cGHIJKLMNOPQRSTUV = _mm512_max_ps(vo1x0cGHIJKLMNOPQRSTUV, vmin);
+        vo0x0c0123456789ABCDEF = _mm512_min_ps(vo0x0c0123456789ABCDEF, vmax);
+        vo0x0cGHIJKLMNOPQRSTUV = _mm512_min_ps(vo0x0cGHIJKLMNOPQRSTUV, vmax);
+        vo1x0c0123456789ABCDEF = _mm512_min_ps(vo1x0c0123456789ABCDEF, vmax);
+        vo1x0cGHIJKLMNOPQRSTUV = _mm512_min_ps(vo1x0cGHIJKLMNOPQRSTUV, vmax);
+
+        if XNN_LIKELY(c >= 32) {
+          _mm512_storeu_ps(o1, vo1x0c0123456789ABCDEF);
+          _mm512_storeu_ps(o1 + 16, vo1x0cGHIJKLMNOPQRSTUV);
+          o1 = (float*) ((uintptr_t) o1 + output_width_stride);
+          _mm512_storeu_ps(o0, vo0x0c0123456789ABCDEF);
+          _mm512_storeu_ps(o0 + 16, vo0x0cGHIJKLMNOPQRSTUV);
+          o0 = (float*) ((uintptr_t) o0 + output_width_stride);
+        } else {
+          float* o1_tmp = o1;
+          float* o0_tmp = o0;
+          if (c & 16) {
+            _mm512_storeu_ps((float*) ((uintptr_t) o1_tmp + output_width_stride * 0) + 0, vo1x0c0123456789ABCDEF);
+            _mm512_storeu_ps((float*) ((uintptr_t) o0_tmp + output_width_stride * 0) + 0, vo0x0c0123456789ABCDEF);
+            o1_tmp += 16;
+            o0_tmp += 16;
+            vo0x0c0123456789ABCDEF = vo0x0cGHIJKLMNOPQRSTUV;
+            vo1x0c0123456789ABCDEF = vo1x0cGHIJKLMNOPQRSTUV;
+          }
+          // Prepare mask for valid 32-bit elements (depends on c).
+          const __mmask16 vmask = _cvtu32_mask16((uint16_t) ((uint32_t) (UINT32_C(1) << (c & 15)) - UINT32_C(1)));
+          _mm512_mask_storeu_ps((float*) ((uintptr_t) o1_tmp + output_width_stride * 0), vmask, vo1x0c0123456789ABCDEF);
+          _mm512_mask_storeu_ps((float*) ((uintptr_t) o0_tmp + output_width_stride * 0), vmask, vo0x0c0123456789ABCDEF);
+          o1 = (float*) ((uintptr_t) o1 + output_width_stride);
+          o0 = (float*) ((uintptr_t) o0 + output_width_stride);
+        }
+
+        vo0x0c0123456789ABCDEF = vo0x1c0123456789ABCDEF;
+        vo0x0cGHIJKLMNOPQRSTUV = vo0x1cGHIJKLMNOPQRSTUV;
+        vo1x0c0123456789ABCDEF = vo1x1c0123456789ABCDEF;
+        vo1x0cGHIJKLMNOPQRSTUV = vo1x1cGHIJKLMNOPQRSTUV;
+        iw -= 2;
+      }
+      assert(iw < 2);
+      if XNN_UNLIKELY(iw != 0) {
+        // The last input column contributes through the center column of the kernel; the right column is padding.
+        const __m512 vk01c0x0123456789ABCDEF = _mm512_load_ps(w + 320);
+        const __m512 vk01c0xGHIJKLMNOPQRSTUV = _mm512_load_ps(w + 336);
+        const __m512 vk11c0x0123456789ABCDEF = _mm512_load_ps(w + 352);
+        const __m512 vk11c0xGHIJKLMNOPQRSTUV = _mm512_load_ps(w + 368);
+        const __m512 vk21c0x0123456789ABCDEF = _mm512_load_ps(w + 384);
+        const __m512 vk21c0xGHIJKLMNOPQRSTUV = _mm512_load_ps(w + 400);
+
+        const __m512 vi0x0c0 = _mm512_set1_ps(i0[0]);
+        vo0x0c0123456789ABCDEF = _mm512_fmadd_ps(vk01c0x0123456789ABCDEF, vi0x0c0, vo0x0c0123456789ABCDEF);
+        vo0x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk01c0xGHIJKLMNOPQRSTUV, vi0x0c0, vo0x0cGHIJKLMNOPQRSTUV);
+        const __m512 vi1x0c0 = _mm512_set1_ps(i1[0]);
+        vo0x0c0123456789ABCDEF = _mm512_fmadd_ps(vk11c0x0123456789ABCDEF, vi1x0c0, vo0x0c0123456789ABCDEF);
+        vo0x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk11c0xGHIJKLMNOPQRSTUV, vi1x0c0, vo0x0cGHIJKLMNOPQRSTUV);
+        const __m512 vi2x0c0 = _mm512_set1_ps(i2[0]);
+        vo0x0c0123456789ABCDEF = _mm512_fmadd_ps(vk21c0x0123456789ABCDEF, vi2x0c0, vo0x0c0123456789ABCDEF);
+        vo0x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk21c0xGHIJKLMNOPQRSTUV, vi2x0c0, vo0x0cGHIJKLMNOPQRSTUV);
+        vo1x0c0123456789ABCDEF = _mm512_fmadd_ps(vk01c0x0123456789ABCDEF, vi2x0c0, vo1x0c0123456789ABCDEF);
+        vo1x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk01c0xGHIJKLMNOPQRSTUV, vi2x0c0, vo1x0cGHIJKLMNOPQRSTUV);
+        const __m512 vi3x0c0 = _mm512_set1_ps(i3[0]);
+        vo1x0c0123456789ABCDEF = _mm512_fmadd_ps(vk11c0x0123456789ABCDEF, vi3x0c0, vo1x0c0123456789ABCDEF);
+        vo1x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk11c0xGHIJKLMNOPQRSTUV, vi3x0c0, vo1x0cGHIJKLMNOPQRSTUV);
+        const __m512 vi4x0c0 = _mm512_set1_ps(i4[0]);
+        vo1x0c0123456789ABCDEF = _mm512_fmadd_ps(vk21c0x0123456789ABCDEF, vi4x0c0, vo1x0c0123456789ABCDEF);
+        vo1x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk21c0xGHIJKLMNOPQRSTUV, vi4x0c0, vo1x0cGHIJKLMNOPQRSTUV);
+        const __m512 vk01c1x0123456789ABCDEF = _mm512_load_ps(w + 416);
+        const __m512 vk01c1xGHIJKLMNOPQRSTUV = _mm512_load_ps(w + 432);
+        const __m512 vk11c1x0123456789ABCDEF = _mm512_load_ps(w + 448);
+        const __m512 vk11c1xGHIJKLMNOPQRSTUV = _mm512_load_ps(w + 464);
+        const __m512 vk21c1x0123456789ABCDEF = _mm512_load_ps(w + 480);
+        const __m512 vk21c1xGHIJKLMNOPQRSTUV = _mm512_load_ps(w + 496);
+
+        const __m512 vi0x0c1 = _mm512_set1_ps(i0[1]);
+        vo0x0c0123456789ABCDEF = _mm512_fmadd_ps(vk01c1x0123456789ABCDEF, vi0x0c1, vo0x0c0123456789ABCDEF);
+        vo0x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk01c1xGHIJKLMNOPQRSTUV, vi0x0c1, vo0x0cGHIJKLMNOPQRSTUV);
+        const __m512 vi1x0c1 = _mm512_set1_ps(i1[1]);
+        vo0x0c0123456789ABCDEF = _mm512_fmadd_ps(vk11c1x0123456789ABCDEF, vi1x0c1, vo0x0c0123456789ABCDEF);
+        vo0x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk11c1xGHIJKLMNOPQRSTUV, vi1x0c1, vo0x0cGHIJKLMNOPQRSTUV);
+        const __m512 vi2x0c1 = _mm512_set1_ps(i2[1]);
+        vo0x0c0123456789ABCDEF = _mm512_fmadd_ps(vk21c1x0123456789ABCDEF, vi2x0c1, vo0x0c0123456789ABCDEF);
+        vo0x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk21c1xGHIJKLMNOPQRSTUV, vi2x0c1, vo0x0cGHIJKLMNOPQRSTUV);
+        vo1x0c0123456789ABCDEF = _mm512_fmadd_ps(vk01c1x0123456789ABCDEF, vi2x0c1, vo1x0c0123456789ABCDEF);
+        vo1x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk01c1xGHIJKLMNOPQRSTUV, vi2x0c1, vo1x0cGHIJKLMNOPQRSTUV);
+        const __m512 vi3x0c1 = _mm512_set1_ps(i3[1]);
+        vo1x0c0123456789ABCDEF = _mm512_fmadd_ps(vk11c1x0123456789ABCDEF, vi3x0c1, vo1x0c0123456789ABCDEF);
+        vo1x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk11c1xGHIJKLMNOPQRSTUV, vi3x0c1, vo1x0cGHIJKLMNOPQRSTUV);
+        const __m512 vi4x0c1 = _mm512_set1_ps(i4[1]);
+        vo1x0c0123456789ABCDEF = _mm512_fmadd_ps(vk21c1x0123456789ABCDEF, vi4x0c1, vo1x0c0123456789ABCDEF);
+        vo1x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk21c1xGHIJKLMNOPQRSTUV, vi4x0c1, vo1x0cGHIJKLMNOPQRSTUV);
+        const __m512 vk01c2x0123456789ABCDEF = _mm512_load_ps(w + 512);
+        const __m512 vk01c2xGHIJKLMNOPQRSTUV = _mm512_load_ps(w + 528);
+        const __m512 vk11c2x0123456789ABCDEF = _mm512_load_ps(w + 544);
+        const __m512 vk11c2xGHIJKLMNOPQRSTUV = _mm512_load_ps(w + 560);
+        const __m512 vk21c2x0123456789ABCDEF = _mm512_load_ps(w + 576);
+        const __m512 vk21c2xGHIJKLMNOPQRSTUV = _mm512_load_ps(w + 592);
+
+        const __m512 vi0x0c2 = _mm512_set1_ps(i0[2]);
+        vo0x0c0123456789ABCDEF = _mm512_fmadd_ps(vk01c2x0123456789ABCDEF, vi0x0c2, vo0x0c0123456789ABCDEF);
+        vo0x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk01c2xGHIJKLMNOPQRSTUV, vi0x0c2, vo0x0cGHIJKLMNOPQRSTUV);
+        const __m512 vi1x0c2 = _mm512_set1_ps(i1[2]);
+        vo0x0c0123456789ABCDEF = _mm512_fmadd_ps(vk11c2x0123456789ABCDEF, vi1x0c2, vo0x0c0123456789ABCDEF);
+        vo0x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk11c2xGHIJKLMNOPQRSTUV, vi1x0c2, vo0x0cGHIJKLMNOPQRSTUV);
+        const __m512 vi2x0c2 = _mm512_set1_ps(i2[2]);
+        vo0x0c0123456789ABCDEF = _mm512_fmadd_ps(vk21c2x0123456789ABCDEF, vi2x0c2, vo0x0c0123456789ABCDEF);
+        vo0x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk21c2xGHIJKLMNOPQRSTUV, vi2x0c2, vo0x0cGHIJKLMNOPQRSTUV);
+        vo1x0c0123456789ABCDEF = _mm512_fmadd_ps(vk01c2x0123456789ABCDEF, vi2x0c2, vo1x0c0123456789ABCDEF);
+        vo1x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk01c2xGHIJKLMNOPQRSTUV, vi2x0c2, vo1x0cGHIJKLMNOPQRSTUV);
+        const __m512 vi3x0c2 = _mm512_set1_ps(i3[2]);
+        vo1x0c0123456789ABCDEF = _mm512_fmadd_ps(vk11c2x0123456789ABCDEF, vi3x0c2, vo1x0c0123456789ABCDEF);
+        vo1x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk11c2xGHIJKLMNOPQRSTUV, vi3x0c2, vo1x0cGHIJKLMNOPQRSTUV);
+        const __m512 vi4x0c2 = _mm512_set1_ps(i4[2]);
+        vo1x0c0123456789ABCDEF = _mm512_fmadd_ps(vk21c2x0123456789ABCDEF, vi4x0c2, vo1x0c0123456789ABCDEF);
+        vo1x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk21c2xGHIJKLMNOPQRSTUV, vi4x0c2, vo1x0cGHIJKLMNOPQRSTUV);
+
+        vo0x0c0123456789ABCDEF = _mm512_max_ps(vo0x0c0123456789ABCDEF, vmin);
+        vo0x0cGHIJKLMNOPQRSTUV = _mm512_max_ps(vo0x0cGHIJKLMNOPQRSTUV, vmin);
+        vo1x0c0123456789ABCDEF = _mm512_max_ps(vo1x0c0123456789ABCDEF, vmin);
+        vo1x0cGHIJKLMNOPQRSTUV = _mm512_max_ps(vo1x0cGHIJKLMNOPQRSTUV, vmin);
+        vo0x0c0123456789ABCDEF = _mm512_min_ps(vo0x0c0123456789ABCDEF, vmax);
+        vo0x0cGHIJKLMNOPQRSTUV = _mm512_min_ps(vo0x0cGHIJKLMNOPQRSTUV, vmax);
+        vo1x0c0123456789ABCDEF = _mm512_min_ps(vo1x0c0123456789ABCDEF, vmax);
+        vo1x0cGHIJKLMNOPQRSTUV = _mm512_min_ps(vo1x0cGHIJKLMNOPQRSTUV, vmax);
+
+        if XNN_LIKELY(c >= 32) {
+          _mm512_storeu_ps(o1, vo1x0c0123456789ABCDEF);
+          _mm512_storeu_ps(o1 + 16, vo1x0cGHIJKLMNOPQRSTUV);
+          _mm512_storeu_ps(o0, vo0x0c0123456789ABCDEF);
+          _mm512_storeu_ps(o0 + 16, vo0x0cGHIJKLMNOPQRSTUV);
+        } else {
+          float* o1_tmp = o1;
+          float* o0_tmp = o0;
+          if (c & 16) {
+            _mm512_storeu_ps(o1_tmp + 0, vo1x0c0123456789ABCDEF);
+            _mm512_storeu_ps(o0_tmp + 0, vo0x0c0123456789ABCDEF);
+            o1_tmp += 16;
+            o0_tmp += 16;
+            vo0x0c0123456789ABCDEF = vo0x0cGHIJKLMNOPQRSTUV;
+            vo1x0c0123456789ABCDEF = vo1x0cGHIJKLMNOPQRSTUV;
+          }
+          // Prepare mask for valid 32-bit elements (depends on c).
+          const __mmask16 vmask = _cvtu32_mask16((uint16_t) ((uint32_t) (UINT32_C(1) << (c & 15)) - UINT32_C(1)));
+          _mm512_mask_storeu_ps(o1_tmp, vmask, vo1x0c0123456789ABCDEF);
+          _mm512_mask_storeu_ps(o0_tmp, vmask, vo0x0c0123456789ABCDEF);
+        }
+        o1 = (float*) ((uintptr_t) o1 + output_width_stride);
+        o0 = (float*) ((uintptr_t) o0 + output_width_stride);
+      }
+      // Move output pointers back to the position of the first pixel in a row,
+      // and forward to the next block of output channels
+      o0 = (float*) ((uintptr_t) o0 - output_channel_decrement);
+      o1 = (float*) ((uintptr_t) o1 - output_channel_decrement);
+      // Revert input pointers to the position of the first pixel in a row
+      i0 = (const float*) ((uintptr_t) i0 - input_width_decrement);
+      i1 = (const float*) ((uintptr_t) i1 - input_width_decrement);
+      i2 = (const float*) ((uintptr_t) i2 - input_width_decrement);
+      i3 = (const float*) ((uintptr_t) i3 - input_width_decrement);
+      i4 = (const float*) ((uintptr_t) i4 - input_width_decrement);
+      // Move to the block of weights for the next 32 output channels
+      w += 896;
+      c = doz(c, 32);
+    } while (c != 0);
+    // Move output pointers back to the position of the first channel, and forward to the next block of rows
+    o0 = (float*) ((uintptr_t) o0 + output_height_increment);
+    o1 = (float*) ((uintptr_t) o1 + output_height_increment);
+    // Move input pointers forward to the next four rows
+    i0 = i4;
+    i1 = (const float*) ((uintptr_t) i0 + input_height_stride);
+    i2 = (const float*) ((uintptr_t) i1 + input_height_stride);
+    i3 = (const float*) ((uintptr_t) i2 + input_height_stride);
+    i4 = (const float*) ((uintptr_t) i3 + input_height_stride);
+  }
+}
+
 void xnn_f32_dwconv_minmax_ukernel_up16x25__avx512f(
     size_t channels,
     size_t output_width,
@@ -853,6 +2668,1887 @@ void xnn_f32_dwconv_minmax_ukernel_up16x9__avx512f(
   } while (--output_width != 0);
 }
 
+void xnn_f32_dwconv2d_chw_ukernel_3x3p1__avx512f_4x16(
+    size_t input_height,
+    size_t input_width,
+    const float* input,
+    const float* weights,
+    const float* zero,
+    float* output,
+    uint32_t padding_top,
+    const union xnn_f32_chw_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(input_height != 0);
+  assert(input_width != 0);
+  assert(input_width % sizeof(float) == 0);
+  assert(padding_top == 1);
+
+  // Mask of the valid pixels in the last block of 1..16 pixels of each row.
+  const __mmask16 vmask = _cvtu32_mask16(UINT32_C(0xFFFF) >> (15 - (((input_width - 1 * sizeof(float)) / sizeof(float)) & 15)));
+  const __mmask16 vmask_first = input_width > 16 * sizeof(float) ? _cvtu32_mask16(UINT32_C(0xFFFF)) : vmask;
+  const __m512 vmax = _mm512_set1_ps(params->sse.max[0]);
+  const __m512 vmin = _mm512_set1_ps(params->sse.min[0]);
+
+  const __m512 vbias = _mm512_set1_ps(weights[0]);
+  const __m512 vk00 = _mm512_set1_ps(weights[1]);
+  const __m512 vk01 = _mm512_set1_ps(weights[2]);
+  const __m512 vk02 = _mm512_set1_ps(weights[3]);
+  const __m512 vk10 = _mm512_set1_ps(weights[4]);
+  const __m512 vk11 = _mm512_set1_ps(weights[5]);
+  const __m512 vk12 = _mm512_set1_ps(weights[6]);
+  const __m512 vk20 = _mm512_set1_ps(weights[7]);
+  const __m512 vk21 = _mm512_set1_ps(weights[8]);
+  const __m512 vk22 = _mm512_set1_ps(weights[9]);
+
+  const size_t input_decrement = round_up_po2(input_width, 16 * sizeof(float));
+
+  const float* i0 = zero;
+  const float* i1 = input;
+  const float* i2 = (const float*) ((uintptr_t) i1 + input_width);
+  const float* i3 = (const float*) ((uintptr_t) i2 + input_width);
+  const float* i4 = (const float*) ((uintptr_t) i3 + input_width);
+  const float* i5 = (const float*) ((uintptr_t) i4 + input_width);
+
+  float* o0 = output;
+  float* o1 = (float*) ((uintptr_t) o0 + input_width);
+  float* o2 = (float*) ((uintptr_t) o1 + input_width);
+  float* o3 = (float*) ((uintptr_t) o2 + input_width);
+
+  size_t output_height = input_height;
+  do {
+    if XNN_UNPREDICTABLE(output_height < 2) {
+      i2 = zero;
+      o1 = o0;
+    }
+    if XNN_UNPREDICTABLE(output_height < 3) {
+      i3 = zero;
+      o2 = o1;
+    }
+    if XNN_UNPREDICTABLE(output_height < 4) {
+      i4 = zero;
+      o3 = o2;
+    }
+    if XNN_UNPREDICTABLE(output_height < 5) {
+      i5 = zero;
+    }
+
+    __m512 vi0x0123456789ABCDEF = _mm512_setzero_ps();
+    __m512 vi1x0123456789ABCDEF = _mm512_setzero_ps();
+    __m512 vi2x0123456789ABCDEF = _mm512_setzero_ps();
+    __m512 vi3x0123456789ABCDEF = _mm512_setzero_ps();
+    __m512 vi4x0123456789ABCDEF = _mm512_setzero_ps();
+    __m512 vi5x0123456789ABCDEF = _mm512_setzero_ps();
+
+    __m512 vi0xGHIJKLMNOPQRSTUV = _mm512_maskz_loadu_ps(vmask_first, i0);
+    i0 += 16;
+    __m512 vi1xGHIJKLMNOPQRSTUV = _mm512_maskz_loadu_ps(vmask_first, i1);
+    i1 += 16;
+    __m512 vi2xGHIJKLMNOPQRSTUV = _mm512_maskz_loadu_ps(vmask_first, i2);
+    i2 += 16;
+    __m512 vi3xGHIJKLMNOPQRSTUV = _mm512_maskz_loadu_ps(vmask_first, i3);
+    i3 += 16;
+    __m512 vi4xGHIJKLMNOPQRSTUV = _mm512_maskz_loadu_ps(vmask_first, i4);
+    i4 += 16;
+    __m512 vi5xGHIJKLMNOPQRSTUV = _mm512_maskz_loadu_ps(vmask_first, i5);
+    i5 += 16;
+
+    size_t w = input_width;
+    for (; w > 32 * sizeof(float); w -= 16 * sizeof(float)) {
+      __m512 vo0p0 = _mm512_fmadd_ps(vi0xGHIJKLMNOPQRSTUV, vk01, vbias);
+      __m512 vo1p0 = _mm512_fmadd_ps(vi1xGHIJKLMNOPQRSTUV, vk01, vbias);
+      __m512 vo2p0 = _mm512_fmadd_ps(vi2xGHIJKLMNOPQRSTUV, vk01, vbias);
+      __m512 vo3p0 = _mm512_fmadd_ps(vi3xGHIJKLMNOPQRSTUV, vk01, vbias);
+      vo0p0 = _mm512_fmadd_ps(vi1xGHIJKLMNOPQRSTUV, vk11, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi2xGHIJKLMNOPQRSTUV, vk11, vo1p0);
+      vo2p0 = _mm512_fmadd_ps(vi3xGHIJKLMNOPQRSTUV, vk11, vo2p0);
+      vo3p0 = _mm512_fmadd_ps(vi4xGHIJKLMNOPQRSTUV, vk11, vo3p0);
+      vo0p0 = _mm512_fmadd_ps(vi2xGHIJKLMNOPQRSTUV, vk21, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi3xGHIJKLMNOPQRSTUV, vk21, vo1p0);
+      vo2p0 = _mm512_fmadd_ps(vi4xGHIJKLMNOPQRSTUV, vk21, vo2p0);
+      vo3p0 = _mm512_fmadd_ps(vi5xGHIJKLMNOPQRSTUV, vk21, vo3p0);
+
+      const __m512 vi0xWXYZabcdefghijkl = _mm512_loadu_ps(i0);
+      i0 += 16;
+      const __m512 vi1xWXYZabcdefghijkl = _mm512_loadu_ps(i1);
+      i1 += 16;
+      const __m512 vi2xWXYZabcdefghijkl = _mm512_loadu_ps(i2);
+      i2 += 16;
+      const __m512 vi3xWXYZabcdefghijkl = _mm512_loadu_ps(i3);
+      i3 += 16;
+      const __m512 vi4xWXYZabcdefghijkl = _mm512_loadu_ps(i4);
+      i4 += 16;
+      const __m512 vi5xWXYZabcdefghijkl = _mm512_loadu_ps(i5);
+      i5 += 16;
+
+      const __m512 vi0xFGHIJKLMNOPQRSTU = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi0xGHIJKLMNOPQRSTUV), _mm512_castps_si512(vi0x0123456789ABCDEF), 15));
+      const __m512 vi1xFGHIJKLMNOPQRSTU = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi1xGHIJKLMNOPQRSTUV), _mm512_castps_si512(vi1x0123456789ABCDEF), 15));
+      const __m512 vi2xFGHIJKLMNOPQRSTU = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi2xGHIJKLMNOPQRSTUV), _mm512_castps_si512(vi2x0123456789ABCDEF), 15));
+      const __m512 vi3xFGHIJKLMNOPQRSTU = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi3xGHIJKLMNOPQRSTUV), _mm512_castps_si512(vi3x0123456789ABCDEF), 15));
+      const __m512 vi4xFGHIJKLMNOPQRSTU = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi4xGHIJKLMNOPQRSTUV), _mm512_castps_si512(vi4x0123456789ABCDEF), 15));
+      const __m512 vi5xFGHIJKLMNOPQRSTU = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi5xGHIJKLMNOPQRSTUV), _mm512_castps_si512(vi5x0123456789ABCDEF), 15));
+
+      vo0p0 = _mm512_fmadd_ps(vi0xFGHIJKLMNOPQRSTU, vk00, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi1xFGHIJKLMNOPQRSTU, vk00, vo1p0);
+      vo2p0 = _mm512_fmadd_ps(vi2xFGHIJKLMNOPQRSTU, vk00, vo2p0);
+      vo3p0 = _mm512_fmadd_ps(vi3xFGHIJKLMNOPQRSTU, vk00, vo3p0);
+      vo0p0 = _mm512_fmadd_ps(vi1xFGHIJKLMNOPQRSTU, vk10, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi2xFGHIJKLMNOPQRSTU, vk10, vo1p0);
+      vo2p0 = _mm512_fmadd_ps(vi3xFGHIJKLMNOPQRSTU, vk10, vo2p0);
+      vo3p0 = _mm512_fmadd_ps(vi4xFGHIJKLMNOPQRSTU, vk10, vo3p0);
+      vo0p0 = _mm512_fmadd_ps(vi2xFGHIJKLMNOPQRSTU, vk20, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi3xFGHIJKLMNOPQRSTU, vk20, vo1p0);
+      vo2p0 = _mm512_fmadd_ps(vi4xFGHIJKLMNOPQRSTU, vk20, vo2p0);
+      vo3p0 = _mm512_fmadd_ps(vi5xFGHIJKLMNOPQRSTU, vk20, vo3p0);
+
+      const __m512 vi0xHIJKLMNOPQRSTUVW = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi0xWXYZabcdefghijkl), _mm512_castps_si512(vi0xGHIJKLMNOPQRSTUV), 1));
+      vi0x0123456789ABCDEF = vi0xGHIJKLMNOPQRSTUV;
+      vi0xGHIJKLMNOPQRSTUV = vi0xWXYZabcdefghijkl;
+      const __m512 vi1xHIJKLMNOPQRSTUVW = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi1xWXYZabcdefghijkl), _mm512_castps_si512(vi1xGHIJKLMNOPQRSTUV), 1));
+      vi1x0123456789ABCDEF = vi1xGHIJKLMNOPQRSTUV;
+      vi1xGHIJKLMNOPQRSTUV = vi1xWXYZabcdefghijkl;
+      const __m512 vi2xHIJKLMNOPQRSTUVW = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi2xWXYZabcdefghijkl), _mm512_castps_si512(vi2xGHIJKLMNOPQRSTUV), 1));
+      vi2x0123456789ABCDEF = vi2xGHIJKLMNOPQRSTUV;
+      vi2xGHIJKLMNOPQRSTUV = vi2xWXYZabcdefghijkl;
+      const __m512 vi3xHIJKLMNOPQRSTUVW = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi3xWXYZabcdefghijkl), _mm512_castps_si512(vi3xGHIJKLMNOPQRSTUV), 1));
+      vi3x0123456789ABCDEF = vi3xGHIJKLMNOPQRSTUV;
+      vi3xGHIJKLMNOPQRSTUV = vi3xWXYZabcdefghijkl;
+      const __m512 vi4xHIJKLMNOPQRSTUVW = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi4xWXYZabcdefghijkl), _mm512_castps_si512(vi4xGHIJKLMNOPQRSTUV), 1));
+      vi4x0123456789ABCDEF = vi4xGHIJKLMNOPQRSTUV;
+      vi4xGHIJKLMNOPQRSTUV = vi4xWXYZabcdefghijkl;
+      const __m512 vi5xHIJKLMNOPQRSTUVW = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi5xWXYZabcdefghijkl), _mm512_castps_si512(vi5xGHIJKLMNOPQRSTUV), 1));
+      vi5x0123456789ABCDEF = vi5xGHIJKLMNOPQRSTUV;
+      vi5xGHIJKLMNOPQRSTUV = vi5xWXYZabcdefghijkl;
+
+      vo0p0 = _mm512_fmadd_ps(vi0xHIJKLMNOPQRSTUVW, vk02, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi1xHIJKLMNOPQRSTUVW, vk02, vo1p0);
+      vo2p0 = _mm512_fmadd_ps(vi2xHIJKLMNOPQRSTUVW, vk02, vo2p0);
+      vo3p0 = _mm512_fmadd_ps(vi3xHIJKLMNOPQRSTUVW, vk02, vo3p0);
+      vo0p0 = _mm512_fmadd_ps(vi1xHIJKLMNOPQRSTUVW, vk12, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi2xHIJKLMNOPQRSTUVW, vk12, vo1p0);
+      vo2p0 = _mm512_fmadd_ps(vi3xHIJKLMNOPQRSTUVW, vk12, vo2p0);
+      vo3p0 = _mm512_fmadd_ps(vi4xHIJKLMNOPQRSTUVW, vk12, vo3p0);
+      vo0p0 = _mm512_fmadd_ps(vi2xHIJKLMNOPQRSTUVW, vk22, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi3xHIJKLMNOPQRSTUVW, vk22, vo1p0);
+      vo2p0 = _mm512_fmadd_ps(vi4xHIJKLMNOPQRSTUVW, vk22, vo2p0);
+      vo3p0 = _mm512_fmadd_ps(vi5xHIJKLMNOPQRSTUVW, vk22, vo3p0);
+
+
+      __m512 vo0 = _mm512_max_ps(vo0p0, vmin);
+      __m512 vo1 = _mm512_max_ps(vo1p0, vmin);
+      __m512 vo2 = _mm512_max_ps(vo2p0, vmin);
+      __m512 vo3 = _mm512_max_ps(vo3p0, vmin);
+
+      vo0 = _mm512_min_ps(vo0, vmax);
+      vo1 = _mm512_min_ps(vo1, vmax);
+      vo2 = _mm512_min_ps(vo2, vmax);
+      vo3 = _mm512_min_ps(vo3, vmax);
+
+      _mm512_storeu_ps(o3, vo3);
+      o3 += 16;
+      _mm512_storeu_ps(o2, vo2);
+      o2 += 16;
+      _mm512_storeu_ps(o1, vo1);
+      o1 += 16;
+      _mm512_storeu_ps(o0, vo0);
+      o0 += 16;
+    }
+    // Process the next-to-last block of 16 pixels; the last block is loaded with a mask.
+    if XNN_LIKELY(w > 16 * sizeof(float)) {
+      __m512 vo0p0 = _mm512_fmadd_ps(vi0xGHIJKLMNOPQRSTUV, vk01, vbias);
+      __m512 vo1p0 = _mm512_fmadd_ps(vi1xGHIJKLMNOPQRSTUV, vk01, vbias);
+      __m512 vo2p0 = _mm512_fmadd_ps(vi2xGHIJKLMNOPQRSTUV, vk01, vbias);
+      __m512 vo3p0 = _mm512_fmadd_ps(vi3xGHIJKLMNOPQRSTUV, vk01, vbias);
+      vo0p0 = _mm512_fmadd_ps(vi1xGHIJKLMNOPQRSTUV, vk11, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi2xGHIJKLMNOPQRSTUV, vk11, vo1p0);
+      vo2p0 = _mm512_fmadd_ps(vi3xGHIJKLMNOPQRSTUV, vk11, vo2p0);
+      vo3p0 = _mm512_fmadd_ps(vi4xGHIJKLMNOPQRSTUV, vk11, vo3p0);
+      vo0p0 = _mm512_fmadd_ps(vi2xGHIJKLMNOPQRSTUV, vk21, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi3xGHIJKLMNOPQRSTUV, vk21, vo1p0);
+      vo2p0 = _mm512_fmadd_ps(vi4xGHIJKLMNOPQRSTUV, vk21, vo2p0);
+      vo3p0 = _mm512_fmadd_ps(vi5xGHIJKLMNOPQRSTUV, vk21, vo3p0);
+
+      const __m512 vi0xWXYZabcdefghijkl = _mm512_maskz_loadu_ps(vmask, i0);
+      i0 += 16;
+      const __m512 vi1xWXYZabcdefghijkl = _mm512_maskz_loadu_ps(vmask, i1);
+      i1 += 16;
+      const __m512 vi2xWXYZabcdefghijkl = _mm512_maskz_loadu_ps(vmask, i2);
+      i2 += 16;
+      const __m512 vi3xWXYZabcdefghijkl = _mm512_maskz_loadu_ps(vmask, i3);
+      i3 += 16;
+      const __m512 vi4xWXYZabcdefghijkl = _mm512_maskz_loadu_ps(vmask, i4);
+      i4 += 16;
+      const __m512 vi5xWXYZabcdefghijkl = _mm512_maskz_loadu_ps(vmask, i5);
+      i5 += 16;
+
+      const __m512 vi0xFGHIJKLMNOPQRSTU = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi0xGHIJKLMNOPQRSTUV), _mm512_castps_si512(vi0x0123456789ABCDEF), 15));
+      const __m512 vi1xFGHIJKLMNOPQRSTU = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi1xGHIJKLMNOPQRSTUV), _mm512_castps_si512(vi1x0123456789ABCDEF), 15));
+      const __m512 vi2xFGHIJKLMNOPQRSTU = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi2xGHIJKLMNOPQRSTUV), _mm512_castps_si512(vi2x0123456789ABCDEF), 15));
+      const __m512 vi3xFGHIJKLMNOPQRSTU = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi3xGHIJKLMNOPQRSTUV), _mm512_castps_si512(vi3x0123456789ABCDEF), 15));
+      const __m512 vi4xFGHIJKLMNOPQRSTU = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi4xGHIJKLMNOPQRSTUV), _mm512_castps_si512(vi4x0123456789ABCDEF), 15));
+      const __m512 vi5xFGHIJKLMNOPQRSTU = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi5xGHIJKLMNOPQRSTUV), _mm512_castps_si512(vi5x0123456789ABCDEF), 15));
+
+      vo0p0 = _mm512_fmadd_ps(vi0xFGHIJKLMNOPQRSTU, vk00, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi1xFGHIJKLMNOPQRSTU, vk00, vo1p0);
+      vo2p0 = _mm512_fmadd_ps(vi2xFGHIJKLMNOPQRSTU, vk00, vo2p0);
+      vo3p0 = _mm512_fmadd_ps(vi3xFGHIJKLMNOPQRSTU, vk00, vo3p0);
+      vo0p0 = _mm512_fmadd_ps(vi1xFGHIJKLMNOPQRSTU, vk10, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi2xFGHIJKLMNOPQRSTU, vk10, vo1p0);
+      vo2p0 = _mm512_fmadd_ps(vi3xFGHIJKLMNOPQRSTU, vk10, vo2p0);
+      vo3p0 = _mm512_fmadd_ps(vi4xFGHIJKLMNOPQRSTU, vk10, vo3p0);
+      vo0p0 = _mm512_fmadd_ps(vi2xFGHIJKLMNOPQRSTU, vk20, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi3xFGHIJKLMNOPQRSTU, vk20, vo1p0);
+      vo2p0 = _mm512_fmadd_ps(vi4xFGHIJKLMNOPQRSTU, vk20, vo2p0);
+      vo3p0 = _mm512_fmadd_ps(vi5xFGHIJKLMNOPQRSTU, vk20, vo3p0);
+
+      const __m512 vi0xHIJKLMNOPQRSTUVW = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi0xWXYZabcdefghijkl), _mm512_castps_si512(vi0xGHIJKLMNOPQRSTUV), 1));
+      vi0x0123456789ABCDEF = vi0xGHIJKLMNOPQRSTUV;
+      vi0xGHIJKLMNOPQRSTUV = vi0xWXYZabcdefghijkl;
+      const __m512 vi1xHIJKLMNOPQRSTUVW = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi1xWXYZabcdefghijkl), _mm512_castps_si512(vi1xGHIJKLMNOPQRSTUV), 1));
+      vi1x0123456789ABCDEF = vi1xGHIJKLMNOPQRSTUV;
+      vi1xGHIJKLMNOPQRSTUV = vi1xWXYZabcdefghijkl;
+      const __m512 vi2xHIJKLMNOPQRSTUVW = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi2xWXYZabcdefghijkl), _mm512_castps_si512(vi2xGHIJKLMNOPQRSTUV), 1));
+      vi2x0123456789ABCDEF = vi2xGHIJKLMNOPQRSTUV;
+      vi2xGHIJKLMNOPQRSTUV = vi2xWXYZabcdefghijkl;
+      const __m512 vi3xHIJKLMNOPQRSTUVW = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi3xWXYZabcdefghijkl), _mm512_castps_si512(vi3xGHIJKLMNOPQRSTUV), 1));
+      vi3x0123456789ABCDEF = vi3xGHIJKLMNOPQRSTUV;
+      vi3xGHIJKLMNOPQRSTUV = vi3xWXYZabcdefghijkl;
+      const __m512 vi4xHIJKLMNOPQRSTUVW = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi4xWXYZabcdefghijkl), _mm512_castps_si512(vi4xGHIJKLMNOPQRSTUV), 1));
+      vi4x0123456789ABCDEF = vi4xGHIJKLMNOPQRSTUV;
+      vi4xGHIJKLMNOPQRSTUV = vi4xWXYZabcdefghijkl;
+      const __m512 vi5xHIJKLMNOPQRSTUVW = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi5xWXYZabcdefghijkl), _mm512_castps_si512(vi5xGHIJKLMNOPQRSTUV), 1));
+      vi5x0123456789ABCDEF = vi5xGHIJKLMNOPQRSTUV;
+      vi5xGHIJKLMNOPQRSTUV = vi5xWXYZabcdefghijkl;
+
+      vo0p0 = _mm512_fmadd_ps(vi0xHIJKLMNOPQRSTUVW, vk02, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi1xHIJKLMNOPQRSTUVW, vk02, vo1p0);
+      vo2p0 = _mm512_fmadd_ps(vi2xHIJKLMNOPQRSTUVW, vk02, vo2p0);
+      vo3p0 = _mm512_fmadd_ps(vi3xHIJKLMNOPQRSTUVW, vk02, vo3p0);
+      vo0p0 = _mm512_fmadd_ps(vi1xHIJKLMNOPQRSTUVW, vk12, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi2xHIJKLMNOPQRSTUVW, vk12, vo1p0);
+      vo2p0 = _mm512_fmadd_ps(vi3xHIJKLMNOPQRSTUVW, vk12, vo2p0);
+      vo3p0 = _mm512_fmadd_ps(vi4xHIJKLMNOPQRSTUVW, vk12, vo3p0);
+      vo0p0 = _mm512_fmadd_ps(vi2xHIJKLMNOPQRSTUVW, vk22, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi3xHIJKLMNOPQRSTUVW, vk22, vo1p0);
+      vo2p0 = _mm512_fmadd_ps(vi4xHIJKLMNOPQRSTUVW, vk22, vo2p0);
+      vo3p0 = _mm512_fmadd_ps(vi5xHIJKLMNOPQRSTUVW, vk22, vo3p0);
+
+
+      __m512 vo0 = _mm512_max_ps(vo0p0, vmin);
+      __m512 vo1 = _mm512_max_ps(vo1p0, vmin);
+      __m512 vo2 = _mm512_max_ps(vo2p0, vmin);
+      __m512 vo3 = _mm512_max_ps(vo3p0, vmin);
+
+      vo0 = _mm512_min_ps(vo0, vmax);
+      vo1 = _mm512_min_ps(vo1, vmax);
+      vo2 = _mm512_min_ps(vo2, vmax);
+      vo3 = _mm512_min_ps(vo3, vmax);
+
+      _mm512_storeu_ps(o3, vo3);
+      o3 += 16;
+      _mm512_storeu_ps(o2, vo2);
+      o2 += 16;
+      _mm512_storeu_ps(o1, vo1);
+      o1 += 16;
+      _mm512_storeu_ps(o0, vo0);
+      o0 += 16;
+      w -= 16 * sizeof(float);
+    }
+    // Always process the last block of 1..16 pixels.
+    assert(w >= 1 * sizeof(float));
+    assert(w <= 16 * sizeof(float));
+    {
+      __m512 vo0p0 = _mm512_fmadd_ps(vi0xGHIJKLMNOPQRSTUV, vk01, vbias);
+      __m512 vo1p0 = _mm512_fmadd_ps(vi1xGHIJKLMNOPQRSTUV, vk01, vbias);
+      __m512 vo2p0 = _mm512_fmadd_ps(vi2xGHIJKLMNOPQRSTUV, vk01, vbias);
+      __m512 vo3p0 = _mm512_fmadd_ps(vi3xGHIJKLMNOPQRSTUV, vk01, vbias);
+      vo0p0 = _mm512_fmadd_ps(vi1xGHIJKLMNOPQRSTUV, vk11, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi2xGHIJKLMNOPQRSTUV, vk11, vo1p0);
+      vo2p0 = _mm512_fmadd_ps(vi3xGHIJKLMNOPQRSTUV, vk11, vo2p0);
+      vo3p0 = _mm512_fmadd_ps(vi4xGHIJKLMNOPQRSTUV, vk11, vo3p0);
+      vo0p0 = _mm512_fmadd_ps(vi2xGHIJKLMNOPQRSTUV, vk21, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi3xGHIJKLMNOPQRSTUV, vk21, vo1p0);
+      vo2p0 = _mm512_fmadd_ps(vi4xGHIJKLMNOPQRSTUV, vk21, vo2p0);
+      vo3p0 = _mm512_fmadd_ps(vi5xGHIJKLMNOPQRSTUV, vk21, vo3p0);
+
+      const __m512 vi0xFGHIJKLMNOPQRSTU = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi0xGHIJKLMNOPQRSTUV), _mm512_castps_si512(vi0x0123456789ABCDEF), 15));
+      const __m512 vi1xFGHIJKLMNOPQRSTU = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi1xGHIJKLMNOPQRSTUV), _mm512_castps_si512(vi1x0123456789ABCDEF), 15));
+      const __m512 vi2xFGHIJKLMNOPQRSTU = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi2xGHIJKLMNOPQRSTUV), _mm512_castps_si512(vi2x0123456789ABCDEF), 15));
+      const __m512 vi3xFGHIJKLMNOPQRSTU = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi3xGHIJKLMNOPQRSTUV), _mm512_castps_si512(vi3x0123456789ABCDEF), 15));
+      const __m512 vi4xFGHIJKLMNOPQRSTU = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi4xGHIJKLMNOPQRSTUV), _mm512_castps_si512(vi4x0123456789ABCDEF), 15));
+      const __m512 vi5xFGHIJKLMNOPQRSTU = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi5xGHIJKLMNOPQRSTUV), _mm512_castps_si512(vi5x0123456789ABCDEF), 15));
+
+      vo0p0 = _mm512_fmadd_ps(vi0xFGHIJKLMNOPQRSTU, vk00, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi1xFGHIJKLMNOPQRSTU, vk00, vo1p0);
+      vo2p0 = _mm512_fmadd_ps(vi2xFGHIJKLMNOPQRSTU, vk00, vo2p0);
+      vo3p0 = _mm512_fmadd_ps(vi3xFGHIJKLMNOPQRSTU, vk00, vo3p0);
+      vo0p0 = _mm512_fmadd_ps(vi1xFGHIJKLMNOPQRSTU, vk10, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi2xFGHIJKLMNOPQRSTU, vk10, vo1p0);
+      vo2p0 = _mm512_fmadd_ps(vi3xFGHIJKLMNOPQRSTU, vk10, vo2p0);
+      vo3p0 = _mm512_fmadd_ps(vi4xFGHIJKLMNOPQRSTU, vk10, vo3p0);
+      vo0p0 = _mm512_fmadd_ps(vi2xFGHIJKLMNOPQRSTU, vk20, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi3xFGHIJKLMNOPQRSTU, vk20, vo1p0);
+      vo2p0 = _mm512_fmadd_ps(vi4xFGHIJKLMNOPQRSTU, vk20, vo2p0);
+      vo3p0 = _mm512_fmadd_ps(vi5xFGHIJKLMNOPQRSTU, vk20, vo3p0);
+
+      const __m512 vi0xHIJKLMNOPQRSTUVW = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_setzero_si512(), _mm512_castps_si512(vi0xGHIJKLMNOPQRSTUV), 1));
+      const __m512 vi1xHIJKLMNOPQRSTUVW = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_setzero_si512(), _mm512_castps_si512(vi1xGHIJKLMNOPQRSTUV), 1));
+      const __m512 vi2xHIJKLMNOPQRSTUVW = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_setzero_si512(), _mm512_castps_si512(vi2xGHIJKLMNOPQRSTUV), 1));
+      const __m512 vi3xHIJKLMNOPQRSTUVW = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_setzero_si512(), _mm512_castps_si512(vi3xGHIJKLMNOPQRSTUV), 1));
+      const __m512 vi4xHIJKLMNOPQRSTUVW = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_setzero_si512(), _mm512_castps_si512(vi4xGHIJKLMNOPQRSTUV), 1));
+      const __m512 vi5xHIJKLMNOPQRSTUVW = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_setzero_si512(), _mm512_castps_si512(vi5xGHIJKLMNOPQRSTUV), 1));
+
+      vo0p0 = _mm512_fmadd_ps(vi0xHIJKLMNOPQRSTUVW, vk02, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi1xHIJKLMNOPQRSTUVW, vk02, vo1p0);
+      vo2p0 = _mm512_fmadd_ps(vi2xHIJKLMNOPQRSTUVW, vk02, vo2p0);
+      vo3p0 = _mm512_fmadd_ps(vi3xHIJKLMNOPQRSTUVW, vk02, vo3p0);
+      vo0p0 = _mm512_fmadd_ps(vi1xHIJKLMNOPQRSTUVW, vk12, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi2xHIJKLMNOPQRSTUVW, vk12, vo1p0);
+      vo2p0 = _mm512_fmadd_ps(vi3xHIJKLMNOPQRSTUVW, vk12, vo2p0);
+      vo3p0 = _mm512_fmadd_ps(vi4xHIJKLMNOPQRSTUVW, vk12, vo3p0);
+      vo0p0 = _mm512_fmadd_ps(vi2xHIJKLMNOPQRSTUVW, vk22, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi3xHIJKLMNOPQRSTUVW, vk22, vo1p0);
+      vo2p0 = _mm512_fmadd_ps(vi4xHIJKLMNOPQRSTUVW, vk22, vo2p0);
+      vo3p0 = _mm512_fmadd_ps(vi5xHIJKLMNOPQRSTUVW, vk22, vo3p0);
+
+
+      __m512 vo0 = _mm512_max_ps(vo0p0, vmin);
+      __m512 vo1 = _mm512_max_ps(vo1p0, vmin);
+      __m512 vo2 = _mm512_max_ps(vo2p0, vmin);
+      __m512 vo3 = _mm512_max_ps(vo3p0, vmin);
+
+      vo0 = _mm512_min_ps(vo0, vmax);
+      vo1 = _mm512_min_ps(vo1, vmax);
+      vo2 = _mm512_min_ps(vo2, vmax);
+      vo3 = _mm512_min_ps(vo3, vmax);
+
+      _mm512_mask_storeu_ps(o3, vmask, vo3);
+      o3 += w / sizeof(float);
+      _mm512_mask_storeu_ps(o2, vmask, vo2);
+      o2 += w / sizeof(float);
+      _mm512_mask_storeu_ps(o1, vmask, vo1);
+      o1 += w / sizeof(float);
+      _mm512_mask_storeu_ps(o0, vmask, vo0);
+      o0 += w / sizeof(float);
+    }
+
+    i0 = (const float*) ((uintptr_t) i4 - input_decrement);
+    i1 = (const float*) ((uintptr_t) i5 - input_decrement);
+    i2 = (const float*) ((uintptr_t) i1 + input_width);
+    i3 = (const float*) ((uintptr_t) i2 + input_width);
+    i4 = (const float*) ((uintptr_t) i3 + input_width);
+    i5 = (const float*) ((uintptr_t) i4 + input_width);
+
+    o0 = o3;
+    o1 = (float*) ((uintptr_t) o0 + input_width);
+    o2 = (float*) ((uintptr_t) o1 + input_width);
+    o3 = (float*) ((uintptr_t) o2 + input_width);
+
+    output_height = doz(output_height, 4);
+  } while (output_height != 0);
+}
+
+void xnn_f32_dwconv2d_chw_ukernel_3x3s2p1__avx512f_2x16_acc2(
+    size_t input_height,
+    size_t input_width,
+    const float* input,
+    const float* weights,
+    const float* zero,
+    float* output,
+    uint32_t padding_top,
+    const union xnn_f32_chw_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(input_height != 0);
+  assert(input_width != 0);
+  assert(input_width % sizeof(float) == 0);
+  assert(padding_top >= 0);
+  assert(padding_top <= 1);
+
+  // Masks of the valid pixels in the last block of 1..32 pixels of each row.
+  const uint32_t vmask_bits = UINT32_C(0xFFFFFFFF) >> (31 - (((input_width - 1 * sizeof(float)) / sizeof(float)) & 31));
+  const __mmask16 vmask_lo = _cvtu32_mask16(vmask_bits);
+  const __mmask16 vmask_hi = _cvtu32_mask16(vmask_bits >> 16);
+  const __m512i vidx_even = _mm512_set_epi32(30, 28, 26, 24, 22, 20, 18, 16, 14, 12, 10, 8, 6, 4, 2, 0);
+  const __m512i vidx_odd = _mm512_set_epi32(31, 29, 27, 25, 23, 21, 19, 17, 15, 13, 11, 9, 7, 5, 3, 1);
+  const __m512 vmax = _mm512_set1_ps(params->sse.max[0]);
+  const __m512 vmin = _mm512_set1_ps(params->sse.min[0]);
+
+  const __m512 vbias = _mm512_set1_ps(weights[0]);
+  const __m512 vk00 = _mm512_set1_ps(weights[1]);
+  const __m512 vk01 = _mm512_set1_ps(weights[2]);
+  const __m512 vk02 = _mm512_set1_ps(weights[3]);
+  const __m512 vk10 = _mm512_set1_ps(weights[4]);
+  const __m512 vk11 = _mm512_set1_ps(weights[5]);
+  const __m512 vk12 = _mm512_set1_ps(weights[6]);
+  const __m512 vk20 = _mm512_set1_ps(weights[7]);
+  const __m512 vk21 = _mm512_set1_ps(weights[8]);
+  const __m512 vk22 = _mm512_set1_ps(weights[9]);
+
+  const size_t input_decrement = round_down_po2(input_width, 16 /* SIMD output width */ * 2 /* subsampling */ * sizeof(float));
+  const size_t output_width = round_down_po2((input_width + (2 /* padding */ - 3 /* kernel size */ + 2 /* subsampling */) * sizeof(float)) / 2, sizeof(float));
+
+  const float* i0 = (const float*) ((uintptr_t) input - ((-padding_top) & input_width));
+  const float* i1 = (const float*) ((uintptr_t) i0 + input_width);
+  if XNN_UNPREDICTABLE(padding_top != 0) {
+    i0 = zero;
+  }
+  const float* i2 = (const float*) ((uintptr_t) i1 + input_width);
+  const float* i3 = (const float*) ((uintptr_t) i2 + input_width);
+  const float* i4 = (const float*) ((uintptr_t) i3 + input_width);
+
+  float* o0 = output;
+  float* o1 = (float*) ((uintptr_t) o0 + output_width);
+
+  size_t padded_input_height = input_height + padding_top + 1 /* padding bottom */;
+  size_t output_height = (padded_input_height - 3 /* kernel size */ + 2 /* subsampling */) / 2;
+  do {
+    if XNN_UNPREDICTABLE(padded_input_height < 4) {
+      i2 = zero;
+    }
+    if XNN_UNPREDICTABLE(padded_input_height < 5) {
+      i3 = zero;
+      o1 = o0;
+    }
+    if XNN_UNPREDICTABLE(padded_input_height < 6) {
+      i4 = zero;
+    }
+
+    __m512 vi0_prev_odd = _mm512_setzero_ps();
+    __m512 vi1_prev_odd = _mm512_setzero_ps();
+    __m512 vi2_prev_odd = _mm512_setzero_ps();
+    __m512 vi3_prev_odd = _mm512_setzero_ps();
+    __m512 vi4_prev_odd = _mm512_setzero_ps();
+
+    size_t w = input_width;
+    for (; w >= 32 * sizeof(float); w -= 32 * sizeof(float)) {
+      const __m512 vi0_lo = _mm512_loadu_ps(i0);
+      const __m512 vi0_hi = _mm512_loadu_ps(i0 + 16);
+      i0 += 32;
+      const __m512 vi1_lo = _mm512_loadu_ps(i1);
+      const __m512 vi1_hi = _mm512_loadu_ps(i1 + 16);
+      i1 += 32;
+      const __m512 vi2_lo = _mm512_loadu_ps(i2);
+      const __m512 vi2_hi = _mm512_loadu_ps(i2 + 16);
+      i2 += 32;
+      const __m512 vi3_lo = _mm512_loadu_ps(i3);
+      const __m512 vi3_hi = _mm512_loadu_ps(i3 + 16);
+      i3 += 32;
+      const __m512 vi4_lo = _mm512_loadu_ps(i4);
+      const __m512 vi4_hi = _mm512_loadu_ps(i4 + 16);
+      i4 += 32;
+
+      const __m512 vi0_even = _mm512_permutex2var_ps(vi0_lo, vidx_even, vi0_hi);
+      const __m512 vi0_odd = _mm512_permutex2var_ps(vi0_lo, vidx_odd, vi0_hi);
+      const __m512 vi1_even = _mm512_permutex2var_ps(vi1_lo, vidx_even, vi1_hi);
+      const __m512 vi1_odd = _mm512_permutex2var_ps(vi1_lo, vidx_odd, vi1_hi);
+      const __m512 vi2_even = _mm512_permutex2var_ps(vi2_lo, vidx_even, vi2_hi);
+      const __m512 vi2_odd = _mm512_permutex2var_ps(vi2_lo, vidx_odd, vi2_hi);
+      const __m512 vi3_even = _mm512_permutex2var_ps(vi3_lo, vidx_even, vi3_hi);
+      const __m512 vi3_odd = _mm512_permutex2var_ps(vi3_lo, vidx_odd, vi3_hi);
+      const __m512 vi4_even = _mm512_permutex2var_ps(vi4_lo, vidx_even, vi4_hi);
+      const __m512 vi4_odd = _mm512_permutex2var_ps(vi4_lo, vidx_odd, vi4_hi);
+
+      __m512 vo0p0 = _mm512_fmadd_ps(vi0_even, vk01, vbias);
+      __m512 vo1p0 = _mm512_fmadd_ps(vi2_even, vk01, vbias);
+      __m512 vo0p1 = _mm512_mul_ps(vi1_even, vk11);
+      __m512 vo1p1 = _mm512_mul_ps(vi3_even, vk11);
+      vo0p0 = _mm512_fmadd_ps(vi2_even, vk21, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi4_even, vk21, vo1p0);
+
+      vo0p1 = _mm512_fmadd_ps(vi0_odd, vk02, vo0p1);
+      vo1p1 = _mm512_fmadd_ps(vi2_odd, vk02, vo1p1);
+      vo0p0 = _mm512_fmadd_ps(vi1_odd, vk12, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi3_odd, vk12, vo1p0);
+      vo0p1 = _mm512_fmadd_ps(vi2_odd, vk22, vo0p1);
+      vo1p1 = _mm512_fmadd_ps(vi4_odd, vk22, vo1p1);
+
+      const __m512 vi0_odd_left = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi0_odd), _mm512_castps_si512(vi0_prev_odd), 15));
+      vi0_prev_odd = vi0_odd;
+      const __m512 vi1_odd_left = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi1_odd), _mm512_castps_si512(vi1_prev_odd), 15));
+      vi1_prev_odd = vi1_odd;
+      const __m512 vi2_odd_left = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi2_odd), _mm512_castps_si512(vi2_prev_odd), 15));
+      vi2_prev_odd = vi2_odd;
+      const __m512 vi3_odd_left = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi3_odd), _mm512_castps_si512(vi3_prev_odd), 15));
+      vi3_prev_odd = vi3_odd;
+      const __m512 vi4_odd_left = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi4_odd), _mm512_castps_si512(vi4_prev_odd), 15));
+      vi4_prev_odd = vi4_odd;
+
+      vo0p0 = _mm512_fmadd_ps(vi0_odd_left, vk00, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi2_odd_left, vk00, vo1p0);
+      vo0p1 = _mm512_fmadd_ps(vi1_odd_left, vk10, vo0p1);
+      vo1p1 = _mm512_fmadd_ps(vi3_odd_left, vk10, vo1p1);
+      vo0p0 = _mm512_fmadd_ps(vi2_odd_left, vk20, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi4_odd_left, vk20, vo1p0);
+
+      vo0p0 = _mm512_add_ps(vo0p0, vo0p1);
+      vo1p0 = _mm512_add_ps(vo1p0, vo1p1);
+
+      __m512 vo0 = _mm512_max_ps(vo0p0, vmin);
+      __m512 vo1 = _mm512_max_ps(vo1p0, vmin);
+
+      vo0 = _mm512_min_ps(vo0, vmax);
+      vo1 = _mm512_min_ps(vo1, vmax);
+
+      _mm512_storeu_ps(o1, vo1);
+      o1 += 16;
+      _mm512_storeu_ps(o0, vo0);
+      o0 += 16;
+    }
+    // Potentially process the last block of 0..31 pixels.
+    assert(w < 32 * sizeof(float));
+    if XNN_LIKELY(w != 0) {
+      const __m512 vi0_lo = _mm512_maskz_loadu_ps(vmask_lo, i0);
+      const __m512 vi0_hi = _mm512_maskz_loadu_ps(vmask_hi, i0 + 16);
+      const __m512 vi1_lo = _mm512_maskz_loadu_ps(vmask_lo, i1);
+      const __m512 vi1_hi = _mm512_maskz_loadu_ps(vmask_hi, i1 + 16);
+      const __m512 vi2_lo = _mm512_maskz_loadu_ps(vmask_lo, i2);
+      const __m512 vi2_hi = _mm512_maskz_loadu_ps(vmask_hi, i2 + 16);
+      const __m512 vi3_lo = _mm512_maskz_loadu_ps(vmask_lo, i3);
+      const __m512 vi3_hi = _mm512_maskz_loadu_ps(vmask_hi, i3 + 16);
+      const __m512 vi4_lo = _mm512_maskz_loadu_ps(vmask_lo, i4);
+      const __m512 vi4_hi = _mm512_maskz_loadu_ps(vmask_hi, i4 + 16);
+
+      const __m512 vi0_even = _mm512_permutex2var_ps(vi0_lo, vidx_even, vi0_hi);
+      const __m512 vi0_odd = _mm512_permutex2var_ps(vi0_lo, vidx_odd, vi0_hi);
+      const __m512 vi1_even = _mm512_permutex2var_ps(vi1_lo, vidx_even, vi1_hi);
+      const __m512 vi1_odd = _mm512_permutex2var_ps(vi1_lo, vidx_odd, vi1_hi);
+      const __m512 vi2_even = _mm512_permutex2var_ps(vi2_lo, vidx_even, vi2_hi);
+      const __m512 vi2_odd = _mm512_permutex2var_ps(vi2_lo, vidx_odd, vi2_hi);
+      const __m512 vi3_even = _mm512_permutex2var_ps(vi3_lo, vidx_even, vi3_hi);
+      const __m512 vi3_odd = _mm512_permutex2var_ps(vi3_lo, vidx_odd, vi3_hi);
+      const __m512 vi4_even = _mm512_permutex2var_ps(vi4_lo, vidx_even, vi4_hi);
+      const __m512 vi4_odd = _mm512_permutex2var_ps(vi4_lo, vidx_odd, vi4_hi);
+
+      __m512 vo0p0 = _mm512_fmadd_ps(vi0_even, vk01, vbias);
+      __m512 vo1p0 = _mm512_fmadd_ps(vi2_even, vk01, vbias);
+      __m512 vo0p1 = _mm512_mul_ps(vi1_even, vk11);
+      __m512 vo1p1 = _mm512_mul_ps(vi3_even, vk11);
+      vo0p0 = _mm512_fmadd_ps(vi2_even, vk21, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi4_even, vk21, vo1p0);
+
+      vo0p1 = _mm512_fmadd_ps(vi0_odd, vk02, vo0p1);
+      vo1p1 = _mm512_fmadd_ps(vi2_odd, vk02, vo1p1);
+      vo0p0 = _mm512_fmadd_ps(vi1_odd, vk12, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi3_odd, vk12, vo1p0);
+      vo0p1 = _mm512_fmadd_ps(vi2_odd, vk22, vo0p1);
+      vo1p1 = _mm512_fmadd_ps(vi4_odd, vk22, vo1p1);
+
+      const __m512 vi0_odd_left = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi0_odd), _mm512_castps_si512(vi0_prev_odd), 15));
+      vi0_prev_odd = vi0_odd;
+      const __m512 vi1_odd_left = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi1_odd), _mm512_castps_si512(vi1_prev_odd), 15));
+      vi1_prev_odd = vi1_odd;
+      const __m512 vi2_odd_left = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi2_odd), _mm512_castps_si512(vi2_prev_odd), 15));
+      vi2_prev_odd = vi2_odd;
+      const __m512 vi3_odd_left = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi3_odd), _mm512_castps_si512(vi3_prev_odd), 15));
+      vi3_prev_odd = vi3_odd;
+      const __m512 vi4_odd_left = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi4_odd), _mm512_castps_si512(vi4_prev_odd), 15));
+      vi4_prev_odd = vi4_odd;
+
+      vo0p0 = _mm512_fmadd_ps(vi0_odd_left, vk00, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi2_odd_left, vk00, vo1p0);
+      vo0p1 = _mm512_fmadd_ps(vi1_odd_left, vk10, vo0p1);
+      vo1p1 = _mm512_fmadd_ps(vi3_odd_left, vk10, vo1p1);
+      vo0p0 = _mm512_fmadd_ps(vi2_odd_left, vk20, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi4_odd_left, vk20, vo1p0);
+
+      vo0p0 = _mm512_add_ps(vo0p0, vo0p1);
+      vo1p0 = _mm512_add_ps(vo1p0, vo1p1);
+
+      __m512 vo0 = _mm512_max_ps(vo0p0, vmin);
+      __m512 vo1 = _mm512_max_ps(vo1p0, vmin);
+
+      vo0 = _mm512_min_ps(vo0, vmax);
+      vo1 = _mm512_min_ps(vo1, vmax);
+
+      const size_t w_tmp = (w + 1 * sizeof(float)) / (2 * sizeof(float));
+      const __mmask16 vmask_output = _cvtu32_mask16((UINT32_C(1) << w_tmp) - UINT32_C(1));
+      _mm512_mask_storeu_ps(o1, vmask_output, vo1);
+      o1 += w_tmp;
+      _mm512_mask_storeu_ps(o0, vmask_output, vo0);
+      o0 += w_tmp;
+    }
+
+    i0 = (const float*) ((uintptr_t) i4 - input_decrement);
+    i1 = (const float*) ((uintptr_t) i0 + input_width);
+    i2 = (const float*) ((uintptr_t) i1 + input_width);
+    i3 = (const float*) ((uintptr_t) i2 + input_width);
+    i4 = (const float*) ((uintptr_t) i3 + input_width);
+
+    o0 = o1;
+    o1 = (float*) ((uintptr_t) o0 + output_width);
+
+    output_height = doz(output_height, 2);
+    padded_input_height = doz(padded_input_height, 4);
+  } while (output_height != 0);
+}
+
+void xnn_f32_dwconv2d_chw_ukernel_5x5p2__avx512f_4x16(
+    size_t input_height,
+    size_t input_width,
+    const float* input,
+    const float* weights,
+    const float* zero,
+    float* output,
+    uint32_t padding_top,
+    const union xnn_f32_chw_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(input_height != 0);
+  assert(input_width != 0);
+  assert(input_width % sizeof(float) == 0);
+  assert(padding_top == 2);
+
+  // Mask of the valid pixels in the last block of 1..16 pixels of each row.
+  const __mmask16 vmask = _cvtu32_mask16(UINT32_C(0xFFFF) >> (15 - (((input_width - 1 * sizeof(float)) / sizeof(float)) & 15)));
+  const __mmask16 vmask_first = input_width > 16 * sizeof(float) ? _cvtu32_mask16(UINT32_C(0xFFFF)) : vmask;
+  const __m512 vmax = _mm512_set1_ps(params->sse.max[0]);
+  const __m512 vmin = _mm512_set1_ps(params->sse.min[0]);
+
+  const __m512 vbias = _mm512_set1_ps(weights[0]);
+  const __m512 vk00 = _mm512_set1_ps(weights[1]);
+  const __m512 vk01 = _mm512_set1_ps(weights[2]);
+  const __m512 vk02 = _mm512_set1_ps(weights[3]);
+  const __m512 vk03 = _mm512_set1_ps(weights[4]);
+  const __m512 vk04 = _mm512_set1_ps(weights[5]);
+  const __m512 vk10 = _mm512_set1_ps(weights[6]);
+  const __m512 vk11 = _mm512_set1_ps(weights[7]);
+  const __m512 vk12 = _mm512_set1_ps(weights[8]);
+  const __m512 vk13 = _mm512_set1_ps(weights[9]);
+  const __m512 vk14 = _mm512_set1_ps(weights[10]);
+  const __m512 vk20 = _mm512_set1_ps(weights[11]);
+  const __m512 vk21 = _mm512_set1_ps(weights[12]);
+  const __m512 vk22 = _mm512_set1_ps(weights[13]);
+  const __m512 vk23 = _mm512_set1_ps(weights[14]);
+  const __m512 vk24 = _mm512_set1_ps(weights[15]);
+  const __m512 vk30 = _mm512_set1_ps(weights[16]);
+  const __m512 vk31 = _mm512_set1_ps(weights[17]);
+  const __m512 vk32 = _mm512_set1_ps(weights[18]);
+  const __m512 vk33 = _mm512_set1_ps(weights[19]);
+  const __m512 vk34 = _mm512_set1_ps(weights[20]);
+  const __m512 vk40 = _mm512_set1_ps(weights[21]);
+  const __m512 vk41 = _mm512_set1_ps(weights[22]);
+  const __m512 vk42 = _mm512_set1_ps(weights[23]);
+  const __m512 vk43 = _mm512_set1_ps(weights[24]);
+  const __m512 vk44 = _mm512_set1_ps(weights[25]);
+
+  const size_t input_decrement = round_up_po2(input_width, 16 * sizeof(float));
+
+  const float* i0 = zero;
+  const float* i1 = zero;
+  const float* i2 = input;
+  const float* i3 = (const float*) ((uintptr_t) i2 + input_width);
+  const float* i4 = (const float*) ((uintptr_t) i3 + input_width);
+  const float* i5 = (const float*) ((uintptr_t) i4 + input_width);
+  const float* i6 = (const float*) ((uintptr_t) i5 + input_width);
+  const float* i7 = (const float*) ((uintptr_t) i6 + input_width);
+
+  float* o0 = output;
+  float* o1 = (float*) ((uintptr_t) o0 + input_width);
+  float* o2 = (float*) ((uintptr_t) o1 + input_width);
+  float* o3 = (float*) ((uintptr_t) o2 + input_width);
+
+  size_t output_height = input_height;
+  do {
+    if XNN_UNPREDICTABLE(output_height < 2) {
+      i3 = zero;
+      o1 = o0;
+    }
+    if XNN_UNPREDICTABLE(output_height < 3) {
+      i4 = zero;
+      o2 = o1;
+    }
+    if XNN_UNPREDICTABLE(output_height < 4) {
+      i5 = zero;
+      o3 = o2;
+    }
+    if XNN_UNPREDICTABLE(output_height < 5) {
+      i6 = zero;
+    }
+    if XNN_UNPREDICTABLE(output_height < 6) {
+      i7 = zero;
+    }
+
+    __m512 vi0x0123456789ABCDEF = _mm512_setzero_ps();
+    __m512 vi1x0123456789ABCDEF = _mm512_setzero_ps();
+    __m512 vi2x0123456789ABCDEF = _mm512_setzero_ps();
+    __m512 vi3x0123456789ABCDEF = _mm512_setzero_ps();
+    __m512 vi4x0123456789ABCDEF = _mm512_setzero_ps();
+    __m512 vi5x0123456789ABCDEF = _mm512_setzero_ps();
+    __m512 vi6x0123456789ABCDEF = _mm512_setzero_ps();
+    __m512 vi7x0123456789ABCDEF = _mm512_setzero_ps();
+
+    __m512 vi0xGHIJKLMNOPQRSTUV = _mm512_maskz_loadu_ps(vmask_first, i0);
+    i0 += 16;
+    __m512 vi1xGHIJKLMNOPQRSTUV = _mm512_maskz_loadu_ps(vmask_first, i1);
+    i1 += 16;
+    __m512 vi2xGHIJKLMNOPQRSTUV = _mm512_maskz_loadu_ps(vmask_first, i2);
+    i2 += 16;
+    __m512 vi3xGHIJKLMNOPQRSTUV = _mm512_maskz_loadu_ps(vmask_first, i3);
+    i3 += 16;
+    __m512 vi4xGHIJKLMNOPQRSTUV = _mm512_maskz_loadu_ps(vmask_first, i4);
+    i4 += 16;
+    __m512 vi5xGHIJKLMNOPQRSTUV = _mm512_maskz_loadu_ps(vmask_first, i5);
+    i5 += 16;
+    __m512 vi6xGHIJKLMNOPQRSTUV = _mm512_maskz_loadu_ps(vmask_first, i6);
+    i6 += 16;
+    __m512 vi7xGHIJKLMNOPQRSTUV = _mm512_maskz_loadu_ps(vmask_first, i7);
+    i7 += 16;
+
+    size_t w = input_width;
+    for (; w > 32 * sizeof(float); w -= 16 * sizeof(float)) {
+      __m512 vo0p0 = _mm512_fmadd_ps(vi0xGHIJKLMNOPQRSTUV, vk02, vbias);
+      __m512 vo1p0 = _mm512_fmadd_ps(vi1xGHIJKLMNOPQRSTUV, vk02, vbias);
+      __m512 vo2p0 = _mm512_fmadd_ps(vi2xGHIJKLMNOPQRSTUV, vk02, vbias);
+      __m512 vo3p0 = _mm512_fmadd_ps(vi3xGHIJKLMNOPQRSTUV, vk02, vbias);
+      vo0p0 = _mm512_fmadd_ps(vi1xGHIJKLMNOPQRSTUV, vk12, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi2xGHIJKLMNOPQRSTUV, vk12, vo1p0);
+      vo2p0 = _mm512_fmadd_ps(vi3xGHIJKLMNOPQRSTUV, vk12, vo2p0);
+      vo3p0 = _mm512_fmadd_ps(vi4xGHIJKLMNOPQRSTUV, vk12, vo3p0);
+      vo0p0 = _mm512_fmadd_ps(vi2xGHIJKLMNOPQRSTUV, vk22, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi3xGHIJKLMNOPQRSTUV, vk22, vo1p0);
+      vo2p0 = _mm512_fmadd_ps(vi4xGHIJKLMNOPQRSTUV, vk22, vo2p0);
+      vo3p0 = _mm512_fmadd_ps(vi5xGHIJKLMNOPQRSTUV, vk22, vo3p0);
+      vo0p0 = _mm512_fmadd_ps(vi3xGHIJKLMNOPQRSTUV, vk32, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi4xGHIJKLMNOPQRSTUV, vk32, vo1p0);
+      vo2p0 = _mm512_fmadd_ps(vi5xGHIJKLMNOPQRSTUV, vk32, vo2p0);
+      vo3p0 = _mm512_fmadd_ps(vi6xGHIJKLMNOPQRSTUV, vk32, vo3p0);
+      vo0p0 = _mm512_fmadd_ps(vi4xGHIJKLMNOPQRSTUV, vk42, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi5xGHIJKLMNOPQRSTUV, vk42, vo1p0);
+      vo2p0 = _mm512_fmadd_ps(vi6xGHIJKLMNOPQRSTUV, vk42, vo2p0);
+      vo3p0 = _mm512_fmadd_ps(vi7xGHIJKLMNOPQRSTUV, vk42, vo3p0);
+
+      const __m512 vi0xWXYZabcdefghijkl = _mm512_loadu_ps(i0);
+      i0 += 16;
+      const __m512 vi1xWXYZabcdefghijkl = _mm512_loadu_ps(i1);
+      i1 += 16;
+      const __m512 vi2xWXYZabcdefghijkl = _mm512_loadu_ps(i2);
+      i2 += 16;
+      const __m512 vi3xWXYZabcdefghijkl = _mm512_loadu_ps(i3);
+      i3 += 16;
+      const __m512 vi4xWXYZabcdefghijkl = _mm512_loadu_ps(i4);
+      i4 += 16;
+      const __m512 vi5xWXYZabcdefghijkl = _mm512_loadu_ps(i5);
+      i5 += 16;
+      const __m512 vi6xWXYZabcdefghijkl = _mm512_loadu_ps(i6);
+      i6 += 16;
+      const __m512 vi7xWXYZabcdefghijkl = _mm512_loadu_ps(i7);
+      i7 += 16;
+
+      const __m512 vi0xFGHIJKLMNOPQRSTU = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi0xGHIJKLMNOPQRSTUV), _mm512_castps_si512(vi0x0123456789ABCDEF), 15));
+      const __m512 vi1xFGHIJKLMNOPQRSTU = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi1xGHIJKLMNOPQRSTUV), _mm512_castps_si512(vi1x0123456789ABCDEF), 15));
+      const __m512 vi2xFGHIJKLMNOPQRSTU = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi2xGHIJKLMNOPQRSTUV), _mm512_castps_si512(vi2x0123456789ABCDEF), 15));
+      const __m512 vi3xFGHIJKLMNOPQRSTU = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi3xGHIJKLMNOPQRSTUV), _mm512_castps_si512(vi3x0123456789ABCDEF), 15));
+      const __m512 vi4xFGHIJKLMNOPQRSTU = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi4xGHIJKLMNOPQRSTUV), _mm512_castps_si512(vi4x0123456789ABCDEF), 15));
+      const __m512 vi5xFGHIJKLMNOPQRSTU = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi5xGHIJKLMNOPQRSTUV), _mm512_castps_si512(vi5x0123456789ABCDEF), 15));
+      const __m512 vi6xFGHIJKLMNOPQRSTU = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi6xGHIJKLMNOPQRSTUV), _mm512_castps_si512(vi6x0123456789ABCDEF), 15));
+      const __m512 vi7xFGHIJKLMNOPQRSTU = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi7xGHIJKLMNOPQRSTUV), _mm512_castps_si512(vi7x0123456789ABCDEF), 15));
+
+      vo0p0 = _mm512_fmadd_ps(vi0xFGHIJKLMNOPQRSTU, vk01, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi1xFGHIJKLMNOPQRSTU, vk01, vo1p0);
+      vo2p0 = _mm512_fmadd_ps(vi2xFGHIJKLMNOPQRSTU, vk01, vo2p0);
+      vo3p0 = _mm512_fmadd_ps(vi3xFGHIJKLMNOPQRSTU, vk01, vo3p0);
+      vo0p0 = _mm512_fmadd_ps(vi1xFGHIJKLMNOPQRSTU, vk11, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi2xFGHIJKLMNOPQRSTU, vk11, vo1p0);
+      vo2p0 = _mm512_fmadd_ps(vi3xFGHIJKLMNOPQRSTU, vk11, vo2p0);
+      vo3p0 = _mm512_fmadd_ps(vi4xFGHIJKLMNOPQRSTU, vk11, vo3p0);
+      vo0p0 = _mm512_fmadd_ps(vi2xFGHIJKLMNOPQRSTU, vk21, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi3xFGHIJKLMNOPQRSTU, vk21, vo1p0);
+      vo2p0 = _mm512_fmadd_ps(vi4xFGHIJKLMNOPQRSTU, vk21, vo2p0);
+      vo3p0 = _mm512_fmadd_ps(vi5xFGHIJKLMNOPQRSTU, vk21, vo3p0);
+      vo0p0 = _mm512_fmadd_ps(vi3xFGHIJKLMNOPQRSTU, vk31, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi4xFGHIJKLMNOPQRSTU, vk31, vo1p0);
+      vo2p0 = _mm512_fmadd_ps(vi5xFGHIJKLMNOPQRSTU, vk31, vo2p0);
+      vo3p0 = _mm512_fmadd_ps(vi6xFGHIJKLMNOPQRSTU, vk31, vo3p0);
+      vo0p0 = _mm512_fmadd_ps(vi4xFGHIJKLMNOPQRSTU, vk41, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi5xFGHIJKLMNOPQRSTU, vk41, vo1p0);
+      vo2p0 = _mm512_fmadd_ps(vi6xFGHIJKLMNOPQRSTU, vk41, vo2p0);
+      vo3p0 = _mm512_fmadd_ps(vi7xFGHIJKLMNOPQRSTU, vk41, vo3p0);
+
+      const __m512 vi0xEFGHIJKLMNOPQRST = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi0xGHIJKLMNOPQRSTUV), _mm512_castps_si512(vi0x0123456789ABCDEF), 14));
+      const __m512 vi1xEFGHIJKLMNOPQRST = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi1xGHIJKLMNOPQRSTUV), _mm512_castps_si512(vi1x0123456789ABCDEF), 14));
+      const __m512 vi2xEFGHIJKLMNOPQRST = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi2xGHIJKLMNOPQRSTUV), _mm512_castps_si512(vi2x0123456789ABCDEF), 14));
+      const __m512 vi3xEFGHIJKLMNOPQRST = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi3xGHIJKLMNOPQRSTUV), _mm512_castps_si512(vi3x0123456789ABCDEF), 14));
+      const __m512 vi4xEFGHIJKLMNOPQRST = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi4xGHIJKLMNOPQRSTUV), _mm512_castps_si512(vi4x0123456789ABCDEF), 14));
+      const __m512 vi5xEFGHIJKLMNOPQRST = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi5xGHIJKLMNOPQRSTUV), _mm512_castps_si512(vi5x0123456789ABCDEF), 14));
+      const __m512 vi6xEFGHIJKLMNOPQRST = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi6xGHIJKLMNOPQRSTUV), _mm512_castps_si512(vi6x0123456789ABCDEF), 14));
+      const __m512 vi7xEFGHIJKLMNOPQRST = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi7xGHIJKLMNOPQRSTUV), _mm512_castps_si512(vi7x0123456789ABCDEF), 14));
+
+      vo0p0 = _mm512_fmadd_ps(vi0xEFGHIJKLMNOPQRST, vk00, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi1xEFGHIJKLMNOPQRST, vk00, vo1p0);
+      vo2p0 = _mm512_fmadd_ps(vi2xEFGHIJKLMNOPQRST, vk00, vo2p0);
+      vo3p0 = _mm512_fmadd_ps(vi3xEFGHIJKLMNOPQRST, vk00, vo3p0);
+      vo0p0 = _mm512_fmadd_ps(vi1xEFGHIJKLMNOPQRST, vk10, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi2xEFGHIJKLMNOPQRST, vk10, vo1p0);
+      vo2p0 = _mm512_fmadd_ps(vi3xEFGHIJKLMNOPQRST, vk10, vo2p0);
+      vo3p0 = _mm512_fmadd_ps(vi4xEFGHIJKLMNOPQRST, vk10, vo3p0);
+      vo0p0 = _mm512_fmadd_ps(vi2xEFGHIJKLMNOPQRST, vk20, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi3xEFGHIJKLMNOPQRST, vk20, vo1p0);
+      vo2p0 = _mm512_fmadd_ps(vi4xEFGHIJKLMNOPQRST, vk20, vo2p0);
+      vo3p0 = _mm512_fmadd_ps(vi5xEFGHIJKLMNOPQRST, vk20, vo3p0);
+      vo0p0 = _mm512_fmadd_ps(vi3xEFGHIJKLMNOPQRST, vk30, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi4xEFGHIJKLMNOPQRST, vk30, vo1p0);
+      vo2p0 = _mm512_fmadd_ps(vi5xEFGHIJKLMNOPQRST, vk30, vo2p0);
+      vo3p0 = _mm512_fmadd_ps(vi6xEFGHIJKLMNOPQRST, vk30, vo3p0);
+      vo0p0 = _mm512_fmadd_ps(vi4xEFGHIJKLMNOPQRST, vk40, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi5xEFGHIJKLMNOPQRST, vk40, vo1p0);
+      vo2p0 = _mm512_fmadd_ps(vi6xEFGHIJKLMNOPQRST, vk40, vo2p0);
+      vo3p0 = _mm512_fmadd_ps(vi7xEFGHIJKLMNOPQRST, vk40, vo3p0);
+
+      const __m512 vi0xHIJKLMNOPQRSTUVW = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi0xWXYZabcdefghijkl), _mm512_castps_si512(vi0xGHIJKLMNOPQRSTUV), 1));
+      const __m512 vi1xHIJKLMNOPQRSTUVW = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi1xWXYZabcdefghijkl), _mm512_castps_si512(vi1xGHIJKLMNOPQRSTUV), 1));
+      const __m512 vi2xHIJKLMNOPQRSTUVW = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi2xWXYZabcdefghijkl), _mm512_castps_si512(vi2xGHIJKLMNOPQRSTUV), 1));
+      const __m512 vi3xHIJKLMNOPQRSTUVW = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi3xWXYZabcdefghijkl), _mm512_castps_si512(vi3xGHIJKLMNOPQRSTUV), 1));
+      const __m512 vi4xHIJKLMNOPQRSTUVW = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi4xWXYZabcdefghijkl), _mm512_castps_si512(vi4xGHIJKLMNOPQRSTUV), 1));
+      const __m512 vi5xHIJKLMNOPQRSTUVW = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi5xWXYZabcdefghijkl), _mm512_castps_si512(vi5xGHIJKLMNOPQRSTUV), 1));
+      const __m512 vi6xHIJKLMNOPQRSTUVW = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi6xWXYZabcdefghijkl), _mm512_castps_si512(vi6xGHIJKLMNOPQRSTUV), 1));
+      const __m512 vi7xHIJKLMNOPQRSTUVW = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi7xWXYZabcdefghijkl), _mm512_castps_si512(vi7xGHIJKLMNOPQRSTUV), 1));
+
+      vo0p0 = _mm512_fmadd_ps(vi0xHIJKLMNOPQRSTUVW, vk03, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi1xHIJKLMNOPQRSTUVW, vk03, vo1p0);
+      vo2p0 = _mm512_fmadd_ps(vi2xHIJKLMNOPQRSTUVW, vk03, vo2p0);
+      vo3p0 = _mm512_fmadd_ps(vi3xHIJKLMNOPQRSTUVW, vk03, vo3p0);
+      vo0p0 = _mm512_fmadd_ps(vi1xHIJKLMNOPQRSTUVW, vk13, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi2xHIJKLMNOPQRSTUVW, vk13, vo1p0);
+      vo2p0 = _mm512_fmadd_ps(vi3xHIJKLMNOPQRSTUVW, vk13, vo2p0);
+      vo3p0 = _mm512_fmadd_ps(vi4xHIJKLMNOPQRSTUVW, vk13, vo3p0);
+      vo0p0 = _mm512_fmadd_ps(vi2xHIJKLMNOPQRSTUVW, vk23, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi3xHIJKLMNOPQRSTUVW, vk23, vo1p0);
+      vo2p0 = _mm512_fmadd_ps(vi4xHIJKLMNOPQRSTUVW, vk23, vo2p0);
+      vo3p0 = _mm512_fmadd_ps(vi5xHIJKLMNOPQRSTUVW, vk23, vo3p0);
+      vo0p0 = _mm512_fmadd_ps(vi3xHIJKLMNOPQRSTUVW, vk33, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi4xHIJKLMNOPQRSTUVW, vk33, vo1p0);
+      vo2p0 = _mm512_fmadd_ps(vi5xHIJKLMNOPQRSTUVW, vk33, vo2p0);
+      vo3p0 = _mm512_fmadd_ps(vi6xHIJKLMNOPQRSTUVW, vk33, vo3p0);
+      vo0p0 = _mm512_fmadd_ps(vi4xHIJKLMNOPQRSTUVW, vk43, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi5xHIJKLMNOPQRSTUVW, vk43, vo1p0);
+      vo2p0 = _mm512_fmadd_ps(vi6xHIJKLMNOPQRSTUVW, vk43, vo2p0);
+      vo3p0 = _mm512_fmadd_ps(vi7xHIJKLMNOPQRSTUVW, vk43, vo3p0);
+
+      const __m512 vi0xIJKLMNOPQRSTUVWX = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi0xWXYZabcdefghijkl), _mm512_castps_si512(vi0xGHIJKLMNOPQRSTUV), 2));
+      vi0x0123456789ABCDEF = vi0xGHIJKLMNOPQRSTUV;
+      vi0xGHIJKLMNOPQRSTUV = vi0xWXYZabcdefghijkl;
+      const __m512 vi1xIJKLMNOPQRSTUVWX = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi1xWXYZabcdefghijkl), _mm512_castps_si512(vi1xGHIJKLMNOPQRSTUV), 2));
+      vi1x0123456789ABCDEF = vi1xGHIJKLMNOPQRSTUV;
+      vi1xGHIJKLMNOPQRSTUV = vi1xWXYZabcdefghijkl;
+      const __m512 vi2xIJKLMNOPQRSTUVWX = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi2xWXYZabcdefghijkl), _mm512_castps_si512(vi2xGHIJKLMNOPQRSTUV), 2));
+      vi2x0123456789ABCDEF = vi2xGHIJKLMNOPQRSTUV;
+      vi2xGHIJKLMNOPQRSTUV = vi2xWXYZabcdefghijkl;
+      const __m512 vi3xIJKLMNOPQRSTUVWX = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi3xWXYZabcdefghijkl), _mm512_castps_si512(vi3xGHIJKLMNOPQRSTUV), 2));
+      vi3x0123456789ABCDEF = vi3xGHIJKLMNOPQRSTUV;
+      vi3xGHIJKLMNOPQRSTUV = vi3xWXYZabcdefghijkl;
+      const __m512 vi4xIJKLMNOPQRSTUVWX = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi4xWXYZabcdefghijkl), _mm512_castps_si512(vi4xGHIJKLMNOPQRSTUV), 2));
+      vi4x0123456789ABCDEF = vi4xGHIJKLMNOPQRSTUV;
+      vi4xGHIJKLMNOPQRSTUV = vi4xWXYZabcdefghijkl;
+      const __m512 vi5xIJKLMNOPQRSTUVWX = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi5xWXYZabcdefghijkl), _mm512_castps_si512(vi5xGHIJKLMNOPQRSTUV), 2));
+      vi5x0123456789ABCDEF = vi5xGHIJKLMNOPQRSTUV;
+      vi5xGHIJKLMNOPQRSTUV = vi5xWXYZabcdefghijkl;
+      const __m512 vi6xIJKLMNOPQRSTUVWX = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi6xWXYZabcdefghijkl), _mm512_castps_si512(vi6xGHIJKLMNOPQRSTUV), 2));
+      vi6x0123456789ABCDEF = vi6xGHIJKLMNOPQRSTUV;
+      vi6xGHIJKLMNOPQRSTUV = vi6xWXYZabcdefghijkl;
+      const __m512 vi7xIJKLMNOPQRSTUVWX = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi7xWXYZabcdefghijkl), _mm512_castps_si512(vi7xGHIJKLMNOPQRSTUV), 2));
+      vi7x0123456789ABCDEF = vi7xGHIJKLMNOPQRSTUV;
+      vi7xGHIJKLMNOPQRSTUV = vi7xWXYZabcdefghijkl;
+
+      vo0p0 = _mm512_fmadd_ps(vi0xIJKLMNOPQRSTUVWX, vk04, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi1xIJKLMNOPQRSTUVWX, vk04, vo1p0);
+      vo2p0 = _mm512_fmadd_ps(vi2xIJKLMNOPQRSTUVWX, vk04, vo2p0);
+      vo3p0 = _mm512_fmadd_ps(vi3xIJKLMNOPQRSTUVWX, vk04, vo3p0);
+      vo0p0 = _mm512_fmadd_ps(vi1xIJKLMNOPQRSTUVWX, vk14, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi2xIJKLMNOPQRSTUVWX, vk14, vo1p0);
+      vo2p0 = _mm512_fmadd_ps(vi3xIJKLMNOPQRSTUVWX, vk14, vo2p0);
+      vo3p0 = _mm512_fmadd_ps(vi4xIJKLMNOPQRSTUVWX, vk14, vo3p0);
+      vo0p0 = _mm512_fmadd_ps(vi2xIJKLMNOPQRSTUVWX, vk24, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi3xIJKLMNOPQRSTUVWX, vk24, vo1p0);
+      vo2p0 = _mm512_fmadd_ps(vi4xIJKLMNOPQRSTUVWX, vk24, vo2p0);
+      vo3p0 = _mm512_fmadd_ps(vi5xIJKLMNOPQRSTUVWX, vk24, vo3p0);
+      vo0p0 = _mm512_fmadd_ps(vi3xIJKLMNOPQRSTUVWX, vk34, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi4xIJKLMNOPQRSTUVWX, vk34, vo1p0);
+      vo2p0 = _mm512_fmadd_ps(vi5xIJKLMNOPQRSTUVWX, vk34, vo2p0);
+      vo3p0 = _mm512_fmadd_ps(vi6xIJKLMNOPQRSTUVWX, vk34, vo3p0);
+      vo0p0 = _mm512_fmadd_ps(vi4xIJKLMNOPQRSTUVWX, vk44, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi5xIJKLMNOPQRSTUVWX, vk44, vo1p0);
+      vo2p0 = _mm512_fmadd_ps(vi6xIJKLMNOPQRSTUVWX, vk44, vo2p0);
+      vo3p0 = _mm512_fmadd_ps(vi7xIJKLMNOPQRSTUVWX, vk44, vo3p0);
+
+
+      __m512 vo0 = _mm512_max_ps(vo0p0, vmin);
+      __m512 vo1 = _mm512_max_ps(vo1p0, vmin);
+      __m512 vo2 = _mm512_max_ps(vo2p0, vmin);
+      __m512 vo3 = _mm512_max_ps(vo3p0, vmin);
+
+      vo0 = _mm512_min_ps(vo0, vmax);
+      vo1 = _mm512_min_ps(vo1, vmax);
+      vo2 = _mm512_min_ps(vo2, vmax);
+      vo3 = _mm512_min_ps(vo3, vmax);
+
+      _mm512_storeu_ps(o3, vo3);
+      o3 += 16;
+      _mm512_storeu_ps(o2, vo2);
+      o2 += 16;
+      _mm512_storeu_ps(o1, vo1);
+      o1 += 16;
+      _mm512_storeu_ps(o0, vo0);
+      o0 += 16;
+    }
+    // Process the next-to-last block of 16 pixels; the last block is loaded with a mask.
+    if XNN_LIKELY(w > 16 * sizeof(float)) {
+      __m512 vo0p0 = _mm512_fmadd_ps(vi0xGHIJKLMNOPQRSTUV, vk02, vbias);
+      __m512 vo1p0 = _mm512_fmadd_ps(vi1xGHIJKLMNOPQRSTUV, vk02, vbias);
+      __m512 vo2p0 = _mm512_fmadd_ps(vi2xGHIJKLMNOPQRSTUV, vk02, vbias);
+      __m512 vo3p0 = _mm512_fmadd_ps(vi3xGHIJKLMNOPQRSTUV, vk02, vbias);
+      vo0p0 = _mm512_fmadd_ps(vi1xGHIJKLMNOPQRSTUV, vk12, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi2xGHIJKLMNOPQRSTUV, vk12, vo1p0);
+      vo2p0 = _mm512_fmadd_ps(vi3xGHIJKLMNOPQRSTUV, vk12, vo2p0);
+      vo3p0 = _mm512_fmadd_ps(vi4xGHIJKLMNOPQRSTUV, vk12, vo3p0);
+      vo0p0 = _mm512_fmadd_ps(vi2xGHIJKLMNOPQRSTUV, vk22, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi3xGHIJKLMNOPQRSTUV, vk22, vo1p0);
+      vo2p0 = _mm512_fmadd_ps(vi4xGHIJKLMNOPQRSTUV, vk22, vo2p0);
+      vo3p0 = _mm512_fmadd_ps(vi5xGHIJKLMNOPQRSTUV, vk22, vo3p0);
+      vo0p0 = _mm512_fmadd_ps(vi3xGHIJKLMNOPQRSTUV, vk32, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi4xGHIJKLMNOPQRSTUV, vk32, vo1p0);
+      vo2p0 = _mm512_fmadd_ps(vi5xGHIJKLMNOPQRSTUV, vk32, vo2p0);
+      vo3p0 = _mm512_fmadd_ps(vi6xGHIJKLMNOPQRSTUV, vk32, vo3p0);
+      vo0p0 = _mm512_fmadd_ps(vi4xGHIJKLMNOPQRSTUV, vk42, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi5xGHIJKLMNOPQRSTUV, vk42, vo1p0);
+      vo2p0 = _mm512_fmadd_ps(vi6xGHIJKLMNOPQRSTUV, vk42, vo2p0);
+      vo3p0 = _mm512_fmadd_ps(vi7xGHIJKLMNOPQRSTUV, vk42, vo3p0);
+
+      const __m512 vi0xWXYZabcdefghijkl = _mm512_maskz_loadu_ps(vmask, i0);
+      i0 += 16;
+      const __m512 vi1xWXYZabcdefghijkl = _mm512_maskz_loadu_ps(vmask, i1);
+      i1 += 16;
+      const __m512 vi2xWXYZabcdefghijkl = _mm512_maskz_loadu_ps(vmask, i2);
+      i2 += 16;
+      const __m512 vi3xWXYZabcdefghijkl = _mm512_maskz_loadu_ps(vmask, i3);
+      i3 += 16;
+      const __m512 vi4xWXYZabcdefghijkl = _mm512_maskz_loadu_ps(vmask, i4);
+      i4 += 16;
+      const __m512 vi5xWXYZabcdefghijkl = _mm512_maskz_loadu_ps(vmask, i5);
+      i5 += 16;
+      const __m512 vi6xWXYZabcdefghijkl = _mm512_maskz_loadu_ps(vmask, i6);
+      i6 += 16;
+      const __m512 vi7xWXYZabcdefghijkl = _mm512_maskz_loadu_ps(vmask, i7);
+      i7 += 16;
+
+      const __m512 vi0xFGHIJKLMNOPQRSTU = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi0xGHIJKLMNOPQRSTUV), _mm512_castps_si512(vi0x0123456789ABCDEF), 15));
+      const __m512 vi1xFGHIJKLMNOPQRSTU = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi1xGHIJKLMNOPQRSTUV), _mm512_castps_si512(vi1x0123456789ABCDEF), 15));
+      const __m512 vi2xFGHIJKLMNOPQRSTU = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi2xGHIJKLMNOPQRSTUV), _mm512_castps_si512(vi2x0123456789ABCDEF), 15));
+      const __m512 vi3xFGHIJKLMNOPQRSTU = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi3xGHIJKLMNOPQRSTUV), _mm512_castps_si512(vi3x0123456789ABCDEF), 15));
+      const __m512 vi4xFGHIJKLMNOPQRSTU = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi4xGHIJKLMNOPQRSTUV), _mm512_castps_si512(vi4x0123456789ABCDEF), 15));
+      const __m512 vi5xFGHIJKLMNOPQRSTU = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi5xGHIJKLMNOPQRSTUV), _mm512_castps_si512(vi5x0123456789ABCDEF), 15));
+      const __m512 vi6xFGHIJKLMNOPQRSTU = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi6xGHIJKLMNOPQRSTUV), _mm512_castps_si512(vi6x0123456789ABCDEF), 15));
+      const __m512 vi7xFGHIJKLMNOPQRSTU = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi7xGHIJKLMNOPQRSTUV), _mm512_castps_si512(vi7x0123456789ABCDEF), 15));
+
+      vo0p0 = _mm512_fmadd_ps(vi0xFGHIJKLMNOPQRSTU, vk01, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi1xFGHIJKLMNOPQRSTU, vk01, vo1p0);
+      vo2p0 = _mm512_fmadd_ps(vi2xFGHIJKLMNOPQRSTU, vk01, vo2p0);
+      vo3p0 = _mm512_fmadd_ps(vi3xFGHIJKLMNOPQRSTU, vk01, vo3p0);
+      vo0p0 = _mm512_fmadd_ps(vi1xFGHIJKLMNOPQRSTU, vk11, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi2xFGHIJKLMNOPQRSTU, vk11, vo1p0);
+      vo2p0 = _mm512_fmadd_ps(vi3xFGHIJKLMNOPQRSTU, vk11, vo2p0);
+      vo3p0 = _mm512_fmadd_ps(vi4xFGHIJKLMNOPQRSTU, vk11, vo3p0);
+      vo0p0 = _mm512_fmadd_ps(vi2xFGHIJKLMNOPQRSTU, vk21, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi3xFGHIJKLMNOPQRSTU, vk21, vo1p0);
+      vo2p0 = _mm512_fmadd_ps(vi4xFGHIJKLMNOPQRSTU, vk21, vo2p0);
+      vo3p0 = _mm512_fmadd_ps(vi5xFGHIJKLMNOPQRSTU, vk21, vo3p0);
+      vo0p0 = _mm512_fmadd_ps(vi3xFGHIJKLMNOPQRSTU, vk31, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi4xFGHIJKLMNOPQRSTU, vk31, vo1p0);
+      vo2p0 = _mm512_fmadd_ps(vi5xFGHIJKLMNOPQRSTU, vk31, vo2p0);
+      vo3p0 = _mm512_fmadd_ps(vi6xFGHIJKLMNOPQRSTU, vk31, vo3p0);
+      vo0p0 = _mm512_fmadd_ps(vi4xFGHIJKLMNOPQRSTU, vk41, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi5xFGHIJKLMNOPQRSTU, vk41, vo1p0);
+      vo2p0 = _mm512_fmadd_ps(vi6xFGHIJKLMNOPQRSTU, vk41, vo2p0);
+      vo3p0 = _mm512_fmadd_ps(vi7xFGHIJKLMNOPQRSTU, vk41, vo3p0);
+
+      const __m512 vi0xEFGHIJKLMNOPQRST = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi0xGHIJKLMNOPQRSTUV), _mm512_castps_si512(vi0x0123456789ABCDEF), 14));
+      const __m512 vi1xEFGHIJKLMNOPQRST = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi1xGHIJKLMNOPQRSTUV), _mm512_castps_si512(vi1x0123456789ABCDEF), 14));
+      const __m512 vi2xEFGHIJKLMNOPQRST = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi2xGHIJKLMNOPQRSTUV), _mm512_castps_si512(vi2x0123456789ABCDEF), 14));
+      const __m512 vi3xEFGHIJKLMNOPQRST = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi3xGHIJKLMNOPQRSTUV), _mm512_castps_si512(vi3x0123456789ABCDEF), 14));
+      const __m512 vi4xEFGHIJKLMNOPQRST = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi4xGHIJKLMNOPQRSTUV), _mm512_castps_si512(vi4x0123456789ABCDEF), 14));
+      const __m512 vi5xEFGHIJKLMNOPQRST = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi5xGHIJKLMNOPQRSTUV), _mm512_castps_si512(vi5x0123456789ABCDEF), 14));
+      const __m512 vi6xEFGHIJKLMNOPQRST = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi6xGHIJKLMNOPQRSTUV), _mm512_castps_si512(vi6x0123456789ABCDEF), 14));
+      const __m512 vi7xEFGHIJKLMNOPQRST = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi7xGHIJKLMNOPQRSTUV), _mm512_castps_si512(vi7x0123456789ABCDEF), 14));
+
+      vo0p0 = _mm512_fmadd_ps(vi0xEFGHIJKLMNOPQRST, vk00, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi1xEFGHIJKLMNOPQRST, vk00, vo1p0);
+      vo2p0 = _mm512_fmadd_ps(vi2xEFGHIJKLMNOPQRST, vk00, vo2p0);
+      vo3p0 = _mm512_fmadd_ps(vi3xEFGHIJKLMNOPQRST, vk00, vo3p0);
+      vo0p0 = _mm512_fmadd_ps(vi1xEFGHIJKLMNOPQRST, vk10, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi2xEFGHIJKLMNOPQRST, vk10, vo1p0);
+      vo2p0 = _mm512_fmadd_ps(vi3xEFGHIJKLMNOPQRST, vk10, vo2p0);
+      vo3p0 = _mm512_fmadd_ps(vi4xEFGHIJKLMNOPQRST, vk10, vo3p0);
+      vo0p0 = _mm512_fmadd_ps(vi2xEFGHIJKLMNOPQRST, vk20, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi3xEFGHIJKLMNOPQRST, vk20, vo1p0);
+      vo2p0 = _mm512_fmadd_ps(vi4xEFGHIJKLMNOPQRST, vk20, vo2p0);
+      vo3p0 = _mm512_fmadd_ps(vi5xEFGHIJKLMNOPQRST, vk20, vo3p0);
+      vo0p0 = _mm512_fmadd_ps(vi3xEFGHIJKLMNOPQRST, vk30, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi4xEFGHIJKLMNOPQRST, vk30, vo1p0);
+      vo2p0 = _mm512_fmadd_ps(vi5xEFGHIJKLMNOPQRST, vk30, vo2p0);
+      vo3p0 = _mm512_fmadd_ps(vi6xEFGHIJKLMNOPQRST, vk30, vo3p0);
+      vo0p0 = _mm512_fmadd_ps(vi4xEFGHIJKLMNOPQRST, vk40, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi5xEFGHIJKLMNOPQRST, vk40, vo1p0);
+      vo2p0 = _mm512_fmadd_ps(vi6xEFGHIJKLMNOPQRST, vk40, vo2p0);
+      vo3p0 = _mm512_fmadd_ps(vi7xEFGHIJKLMNOPQRST, vk40, vo3p0);
+
+      const __m512 vi0xHIJKLMNOPQRSTUVW = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi0xWXYZabcdefghijkl), _mm512_castps_si512(vi0xGHIJKLMNOPQRSTUV), 1));
+      const __m512 vi1xHIJKLMNOPQRSTUVW = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi1xWXYZabcdefghijkl), _mm512_castps_si512(vi1xGHIJKLMNOPQRSTUV), 1));
+      const __m512 vi2xHIJKLMNOPQRSTUVW = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi2xWXYZabcdefghijkl), _mm512_castps_si512(vi2xGHIJKLMNOPQRSTUV), 1));
+      const __m512 vi3xHIJKLMNOPQRSTUVW = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi3xWXYZabcdefghijkl), _mm512_castps_si512(vi3xGHIJKLMNOPQRSTUV), 1));
+      const __m512 vi4xHIJKLMNOPQRSTUVW = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi4xWXYZabcdefghijkl), _mm512_castps_si512(vi4xGHIJKLMNOPQRSTUV), 1));
+      const __m512 vi5xHIJKLMNOPQRSTUVW = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi5xWXYZabcdefghijkl), _mm512_castps_si512(vi5xGHIJKLMNOPQRSTUV), 1));
+      const __m512 vi6xHIJKLMNOPQRSTUVW = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi6xWXYZabcdefghijkl), _mm512_castps_si512(vi6xGHIJKLMNOPQRSTUV), 1));
+      const __m512 vi7xHIJKLMNOPQRSTUVW = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi7xWXYZabcdefghijkl), _mm512_castps_si512(vi7xGHIJKLMNOPQRSTUV), 1));
+
+      vo0p0 = _mm512_fmadd_ps(vi0xHIJKLMNOPQRSTUVW, vk03, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi1xHIJKLMNOPQRSTUVW, vk03, vo1p0);
+      vo2p0 = _mm512_fmadd_ps(vi2xHIJKLMNOPQRSTUVW, vk03, vo2p0);
+      vo3p0 = _mm512_fmadd_ps(vi3xHIJKLMNOPQRSTUVW, vk03, vo3p0);
+      vo0p0 = _mm512_fmadd_ps(vi1xHIJKLMNOPQRSTUVW, vk13, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi2xHIJKLMNOPQRSTUVW, vk13, vo1p0);
+      vo2p0 = _mm512_fmadd_ps(vi3xHIJKLMNOPQRSTUVW, vk13, vo2p0);
+      vo3p0 = _mm512_fmadd_ps(vi4xHIJKLMNOPQRSTUVW, vk13, vo3p0);
+      vo0p0 = _mm512_fmadd_ps(vi2xHIJKLMNOPQRSTUVW, vk23, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi3xHIJKLMNOPQRSTUVW, vk23, vo1p0);
+      vo2p0 = _mm512_fmadd_ps(vi4xHIJKLMNOPQRSTUVW, vk23, vo2p0);
+      vo3p0 = _mm512_fmadd_ps(vi5xHIJKLMNOPQRSTUVW, vk23, vo3p0);
+      vo0p0 = _mm512_fmadd_ps(vi3xHIJKLMNOPQRSTUVW, vk33, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi4xHIJKLMNOPQRSTUVW, vk33, vo1p0);
+      vo2p0 = _mm512_fmadd_ps(vi5xHIJKLMNOPQRSTUVW, vk33, vo2p0);
+      vo3p0 = _mm512_fmadd_ps(vi6xHIJKLMNOPQRSTUVW, vk33, vo3p0);
+      vo0p0 = _mm512_fmadd_ps(vi4xHIJKLMNOPQRSTUVW, vk43, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi5xHIJKLMNOPQRSTUVW, vk43, vo1p0);
+      vo2p0 = _mm512_fmadd_ps(vi6xHIJKLMNOPQRSTUVW, vk43, vo2p0);
+      vo3p0 = _mm512_fmadd_ps(vi7xHIJKLMNOPQRSTUVW, vk43, vo3p0);
+
+      const __m512 vi0xIJKLMNOPQRSTUVWX = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi0xWXYZabcdefghijkl), _mm512_castps_si512(vi0xGHIJKLMNOPQRSTUV), 2));
+      vi0x0123456789ABCDEF = vi0xGHIJKLMNOPQRSTUV;
+      vi0xGHIJKLMNOPQRSTUV = vi0xWXYZabcdefghijkl;
+      const __m512 vi1xIJKLMNOPQRSTUVWX = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi1xWXYZabcdefghijkl), _mm512_castps_si512(vi1xGHIJKLMNOPQRSTUV), 2));
+      vi1x0123456789ABCDEF = vi1xGHIJKLMNOPQRSTUV;
+      vi1xGHIJKLMNOPQRSTUV = vi1xWXYZabcdefghijkl;
+      const __m512 vi2xIJKLMNOPQRSTUVWX = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi2xWXYZabcdefghijkl), _mm512_castps_si512(vi2xGHIJKLMNOPQRSTUV), 2));
+      vi2x0123456789ABCDEF = vi2xGHIJKLMNOPQRSTUV;
+      vi2xGHIJKLMNOPQRSTUV = vi2xWXYZabcdefghijkl;
+      const __m512 vi3xIJKLMNOPQRSTUVWX = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi3xWXYZabcdefghijkl), _mm512_castps_si512(vi3xGHIJKLMNOPQRSTUV), 2));
+      vi3x0123456789ABCDEF = vi3xGHIJKLMNOPQRSTUV;
+      vi3xGHIJKLMNOPQRSTUV = vi3xWXYZabcdefghijkl;
+      const __m512 vi4xIJKLMNOPQRSTUVWX = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi4xWXYZabcdefghijkl), _mm512_castps_si512(vi4xGHIJKLMNOPQRSTUV), 2));
+      vi4x0123456789ABCDEF = vi4xGHIJKLMNOPQRSTUV;
+      vi4xGHIJKLMNOPQRSTUV = vi4xWXYZabcdefghijkl;
+      const __m512 vi5xIJKLMNOPQRSTUVWX = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi5xWXYZabcdefghijkl), _mm512_castps_si512(vi5xGHIJKLMNOPQRSTUV), 2));
+      vi5x0123456789ABCDEF = vi5xGHIJKLMNOPQRSTUV;
+      vi5xGHIJKLMNOPQRSTUV = vi5xWXYZabcdefghijkl;
+      const __m512 vi6xIJKLMNOPQRSTUVWX = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi6xWXYZabcdefghijkl), _mm512_castps_si512(vi6xGHIJKLMNOPQRSTUV), 2));
+      vi6x0123456789ABCDEF = vi6xGHIJKLMNOPQRSTUV;
+      vi6xGHIJKLMNOPQRSTUV = vi6xWXYZabcdefghijkl;
+      const __m512 vi7xIJKLMNOPQRSTUVWX = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi7xWXYZabcdefghijkl), _mm512_castps_si512(vi7xGHIJKLMNOPQRSTUV), 2));
+      vi7x0123456789ABCDEF = vi7xGHIJKLMNOPQRSTUV;
+      vi7xGHIJKLMNOPQRSTUV = vi7xWXYZabcdefghijkl;
+
+      vo0p0 = _mm512_fmadd_ps(vi0xIJKLMNOPQRSTUVWX, vk04, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi1xIJKLMNOPQRSTUVWX, vk04, vo1p0);
+      vo2p0 = _mm512_fmadd_ps(vi2xIJKLMNOPQRSTUVWX, vk04, vo2p0);
+      vo3p0 = _mm512_fmadd_ps(vi3xIJKLMNOPQRSTUVWX, vk04, vo3p0);
+      vo0p0 = _mm512_fmadd_ps(vi1xIJKLMNOPQRSTUVWX, vk14, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi2xIJKLMNOPQRSTUVWX, vk14, vo1p0);
+      vo2p0 = _mm512_fmadd_ps(vi3xIJKLMNOPQRSTUVWX, vk14, vo2p0);
+      vo3p0 = _mm512_fmadd_ps(vi4xIJKLMNOPQRSTUVWX, vk14, vo3p0);
+      vo0p0 = _mm512_fmadd_ps(vi2xIJKLMNOPQRSTUVWX, vk24, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi3xIJKLMNOPQRSTUVWX, vk24, vo1p0);
+      vo2p0 = _mm512_fmadd_ps(vi4xIJKLMNOPQRSTUVWX, vk24, vo2p0);
+      vo3p0 = _mm512_fmadd_ps(vi5xIJKLMNOPQRSTUVWX, vk24, vo3p0);
+      vo0p0 = _mm512_fmadd_ps(vi3xIJKLMNOPQRSTUVWX, vk34, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi4xIJKLMNOPQRSTUVWX, vk34, vo1p0);
+      vo2p0 = _mm512_fmadd_ps(vi5xIJKLMNOPQRSTUVWX, vk34, vo2p0);
+      vo3p0 = _mm512_fmadd_ps(vi6xIJKLMNOPQRSTUVWX, vk34, vo3p0);
+      vo0p0 = _mm512_fmadd_ps(vi4xIJKLMNOPQRSTUVWX, vk44, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi5xIJKLMNOPQRSTUVWX, vk44, vo1p0);
+      vo2p0 = _mm512_fmadd_ps(vi6xIJKLMNOPQRSTUVWX, vk44, vo2p0);
+      vo3p0 = _mm512_fmadd_ps(vi7xIJKLMNOPQRSTUVWX, vk44, vo3p0);
+
+
+      __m512 vo0 = _mm512_max_ps(vo0p0, vmin);
+      __m512 vo1 = _mm512_max_ps(vo1p0, vmin);
+      __m512 vo2 = _mm512_max_ps(vo2p0, vmin);
+      __m512 vo3 = _mm512_max_ps(vo3p0, vmin);
+
+      vo0 = _mm512_min_ps(vo0, vmax);
+      vo1 = _mm512_min_ps(vo1, vmax);
+      vo2 = _mm512_min_ps(vo2, vmax);
+      vo3 = _mm512_min_ps(vo3, vmax);
+
+      _mm512_storeu_ps(o3, vo3);
+      o3 += 16;
+      _mm512_storeu_ps(o2, vo2);
+      o2 += 16;
+      _mm512_storeu_ps(o1, vo1);
+      o1 += 16;
+      _mm512_storeu_ps(o0, vo0);
+      o0 += 16;
+      w -= 16 * sizeof(float);
+    }
+    // Always process the last block of 1..16 pixels.
+    assert(w >= 1 * sizeof(float));
+    assert(w <= 16 * sizeof(float));
+    {
+      __m512 vo0p0 = _mm512_fmadd_ps(vi0xGHIJKLMNOPQRSTUV, vk02, vbias);
+      __m512 vo1p0 = _mm512_fmadd_ps(vi1xGHIJKLMNOPQRSTUV, vk02, vbias);
+      __m512 vo2p0 = _mm512_fmadd_ps(vi2xGHIJKLMNOPQRSTUV, vk02, vbias);
+      __m512 vo3p0 = _mm512_fmadd_ps(vi3xGHIJKLMNOPQRSTUV, vk02, vbias);
+      vo0p0 = _mm512_fmadd_ps(vi1xGHIJKLMNOPQRSTUV, vk12, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi2xGHIJKLMNOPQRSTUV, vk12, vo1p0);
+      vo2p0 = _mm512_fmadd_ps(vi3xGHIJKLMNOPQRSTUV, vk12, vo2p0);
+      vo3p0 = _mm512_fmadd_ps(vi4xGHIJKLMNOPQRSTUV, vk12, vo3p0);
+      vo0p0 = _mm512_fmadd_ps(vi2xGHIJKLMNOPQRSTUV, vk22, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi3xGHIJKLMNOPQRSTUV, vk22, vo1p0);
+      vo2p0 = _mm512_fmadd_ps(vi4xGHIJKLMNOPQRSTUV, vk22, vo2p0);
+      vo3p0 = _mm512_fmadd_ps(vi5xGHIJKLMNOPQRSTUV, vk22, vo3p0);
+      vo0p0 = _mm512_fmadd_ps(vi3xGHIJKLMNOPQRSTUV, vk32, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi4xGHIJKLMNOPQRSTUV, vk32, vo1p0);
+      vo2p0 = _mm512_fmadd_ps(vi5xGHIJKLMNOPQRSTUV, vk32, vo2p0);
+      vo3p0 = _mm512_fmadd_ps(vi6xGHIJKLMNOPQRSTUV, vk32, vo3p0);
+      vo0p0 = _mm512_fmadd_ps(vi4xGHIJKLMNOPQRSTUV, vk42, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi5xGHIJKLMNOPQRSTUV, vk42, vo1p0);
+      vo2p0 = _mm512_fmadd_ps(vi6xGHIJKLMNOPQRSTUV, vk42, vo2p0);
+      vo3p0 = _mm512_fmadd_ps(vi7xGHIJKLMNOPQRSTUV, vk42, vo3p0);
+
+      const __m512 vi0xFGHIJKLMNOPQRSTU = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi0xGHIJKLMNOPQRSTUV), _mm512_castps_si512(vi0x0123456789ABCDEF), 15));
+      const __m512 vi1xFGHIJKLMNOPQRSTU = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi1xGHIJKLMNOPQRSTUV), _mm512_castps_si512(vi1x0123456789ABCDEF), 15));
+      const __m512 vi2xFGHIJKLMNOPQRSTU = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi2xGHIJKLMNOPQRSTUV), _mm512_castps_si512(vi2x0123456789ABCDEF), 15));
+      const __m512 vi3xFGHIJKLMNOPQRSTU = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi3xGHIJKLMNOPQRSTUV), _mm512_castps_si512(vi3x0123456789ABCDEF), 15));
+      const __m512 vi4xFGHIJKLMNOPQRSTU = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi4xGHIJKLMNOPQRSTUV), _mm512_castps_si512(vi4x0123456789ABCDEF), 15));
+      const __m512 vi5xFGHIJKLMNOPQRSTU = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi5xGHIJKLMNOPQRSTUV), _mm512_castps_si512(vi5x0123456789ABCDEF), 15));
+      const __m512 vi6xFGHIJKLMNOPQRSTU = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi6xGHIJKLMNOPQRSTUV), _mm512_castps_si512(vi6x0123456789ABCDEF), 15));
+      const __m512 vi7xFGHIJKLMNOPQRSTU = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi7xGHIJKLMNOPQRSTUV), _mm512_castps_si512(vi7x0123456789ABCDEF), 15));
+
+      vo0p0 = _mm512_fmadd_ps(vi0xFGHIJKLMNOPQRSTU, vk01, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi1xFGHIJKLMNOPQRSTU, vk01, vo1p0);
+      vo2p0 = _mm512_fmadd_ps(vi2xFGHIJKLMNOPQRSTU, vk01, vo2p0);
+      vo3p0 = _mm512_fmadd_ps(vi3xFGHIJKLMNOPQRSTU, vk01, vo3p0);
+      vo0p0 = _mm512_fmadd_ps(vi1xFGHIJKLMNOPQRSTU, vk11, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi2xFGHIJKLMNOPQRSTU, vk11, vo1p0);
+      vo2p0 = _mm512_fmadd_ps(vi3xFGHIJKLMNOPQRSTU, vk11, vo2p0);
+      vo3p0 = _mm512_fmadd_ps(vi4xFGHIJKLMNOPQRSTU, vk11, vo3p0);
+      vo0p0 = _mm512_fmadd_ps(vi2xFGHIJKLMNOPQRSTU, vk21, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi3xFGHIJKLMNOPQRSTU, vk21, vo1p0);
+      vo2p0 = _mm512_fmadd_ps(vi4xFGHIJKLMNOPQRSTU, vk21, vo2p0);
+      vo3p0 = _mm512_fmadd_ps(vi5xFGHIJKLMNOPQRSTU, vk21, vo3p0);
+      vo0p0 = _mm512_fmadd_ps(vi3xFGHIJKLMNOPQRSTU, vk31, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi4xFGHIJKLMNOPQRSTU, vk31, vo1p0);
+      vo2p0 = _mm512_fmadd_ps(vi5xFGHIJKLMNOPQRSTU, vk31, vo2p0);
+      vo3p0 = _mm512_fmadd_ps(vi6xFGHIJKLMNOPQRSTU, vk31, vo3p0);
+      vo0p0 = _mm512_fmadd_ps(vi4xFGHIJKLMNOPQRSTU, vk41, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi5xFGHIJKLMNOPQRSTU, vk41, vo1p0);
+      vo2p0 = _mm512_fmadd_ps(vi6xFGHIJKLMNOPQRSTU, vk41, vo2p0);
+      vo3p0 = _mm512_fmadd_ps(vi7xFGHIJKLMNOPQRSTU, vk41, vo3p0);
+
+      const __m512 vi0xEFGHIJKLMNOPQRST = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi0xGHIJKLMNOPQRSTUV), _mm512_castps_si512(vi0x0123456789ABCDEF), 14));
+      const __m512 vi1xEFGHIJKLMNOPQRST = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi1xGHIJKLMNOPQRSTUV), _mm512_castps_si512(vi1x0123456789ABCDEF), 14));
+      const __m512 vi2xEFGHIJKLMNOPQRST = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi2xGHIJKLMNOPQRSTUV), _mm512_castps_si512(vi2x0123456789ABCDEF), 14));
+      const __m512 vi3xEFGHIJKLMNOPQRST = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi3xGHIJKLMNOPQRSTUV), _mm512_castps_si512(vi3x0123456789ABCDEF), 14));
+      const __m512 vi4xEFGHIJKLMNOPQRST = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi4xGHIJKLMNOPQRSTUV), _mm512_castps_si512(vi4x0123456789ABCDEF), 14));
+      const __m512 vi5xEFGHIJKLMNOPQRST = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi5xGHIJKLMNOPQRSTUV), _mm512_castps_si512(vi5x0123456789ABCDEF), 14));
+      const __m512 vi6xEFGHIJKLMNOPQRST = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi6xGHIJKLMNOPQRSTUV), _mm512_castps_si512(vi6x0123456789ABCDEF), 14));
+      const __m512 vi7xEFGHIJKLMNOPQRST = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi7xGHIJKLMNOPQRSTUV), _mm512_castps_si512(vi7x0123456789ABCDEF), 14));
+
+      vo0p0 = _mm512_fmadd_ps(vi0xEFGHIJKLMNOPQRST, vk00, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi1xEFGHIJKLMNOPQRST, vk00, vo1p0);
+      vo2p0 = _mm512_fmadd_ps(vi2xEFGHIJKLMNOPQRST, vk00, vo2p0);
+      vo3p0 = _mm512_fmadd_ps(vi3xEFGHIJKLMNOPQRST, vk00, vo3p0);
+      vo0p0 = _mm512_fmadd_ps(vi1xEFGHIJKLMNOPQRST, vk10, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi2xEFGHIJKLMNOPQRST, vk10, vo1p0);
+      vo2p0 = _mm512_fmadd_ps(vi3xEFGHIJKLMNOPQRST, vk10, vo2p0);
+      vo3p0 = _mm512_fmadd_ps(vi4xEFGHIJKLMNOPQRST, vk10, vo3p0);
+      vo0p0 = _mm512_fmadd_ps(vi2xEFGHIJKLMNOPQRST, vk20, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi3xEFGHIJKLMNOPQRST, vk20, vo1p0);
+      vo2p0 = _mm512_fmadd_ps(vi4xEFGHIJKLMNOPQRST, vk20, vo2p0);
+      vo3p0 = _mm512_fmadd_ps(vi5xEFGHIJKLMNOPQRST, vk20, vo3p0);
+      vo0p0 = _mm512_fmadd_ps(vi3xEFGHIJKLMNOPQRST, vk30, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi4xEFGHIJKLMNOPQRST, vk30, vo1p0);
+      vo2p0 = _mm512_fmadd_ps(vi5xEFGHIJKLMNOPQRST, vk30, vo2p0);
+      vo3p0 = _mm512_fmadd_ps(vi6xEFGHIJKLMNOPQRST, vk30, vo3p0);
+      vo0p0 = _mm512_fmadd_ps(vi4xEFGHIJKLMNOPQRST, vk40, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi5xEFGHIJKLMNOPQRST, vk40, vo1p0);
+      vo2p0 = _mm512_fmadd_ps(vi6xEFGHIJKLMNOPQRST, vk40, vo2p0);
+      vo3p0 = _mm512_fmadd_ps(vi7xEFGHIJKLMNOPQRST, vk40, vo3p0);
+
+      const __m512 vi0xHIJKLMNOPQRSTUVW = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_setzero_si512(), _mm512_castps_si512(vi0xGHIJKLMNOPQRSTUV), 1));
+      const __m512 vi1xHIJKLMNOPQRSTUVW = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_setzero_si512(), _mm512_castps_si512(vi1xGHIJKLMNOPQRSTUV), 1));
+      const __m512 vi2xHIJKLMNOPQRSTUVW = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_setzero_si512(), _mm512_castps_si512(vi2xGHIJKLMNOPQRSTUV), 1));
+      const __m512 vi3xHIJKLMNOPQRSTUVW = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_setzero_si512(), _mm512_castps_si512(vi3xGHIJKLMNOPQRSTUV), 1));
+      const __m512 vi4xHIJKLMNOPQRSTUVW = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_setzero_si512(), _mm512_castps_si512(vi4xGHIJKLMNOPQRSTUV), 1));
+      const __m512 vi5xHIJKLMNOPQRSTUVW = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_setzero_si512(), _mm512_castps_si512(vi5xGHIJKLMNOPQRSTUV), 1));
+      const __m512 vi6xHIJKLMNOPQRSTUVW = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_setzero_si512(), _mm512_castps_si512(vi6xGHIJKLMNOPQRSTUV), 1));
+      const __m512 vi7xHIJKLMNOPQRSTUVW = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_setzero_si512(), _mm512_castps_si512(vi7xGHIJKLMNOPQRSTUV), 1));
+
+      vo0p0 = _mm512_fmadd_ps(vi0xHIJKLMNOPQRSTUVW, vk03, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi1xHIJKLMNOPQRSTUVW, vk03, vo1p0);
+      vo2p0 = _mm512_fmadd_ps(vi2xHIJKLMNOPQRSTUVW, vk03, vo2p0);
+      vo3p0 = _mm512_fmadd_ps(vi3xHIJKLMNOPQRSTUVW, vk03, vo3p0);
+      vo0p0 = _mm512_fmadd_ps(vi1xHIJKLMNOPQRSTUVW, vk13, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi2xHIJKLMNOPQRSTUVW, vk13, vo1p0);
+      vo2p0 = _mm512_fmadd_ps(vi3xHIJKLMNOPQRSTUVW, vk13, vo2p0);
+      vo3p0 = _mm512_fmadd_ps(vi4xHIJKLMNOPQRSTUVW, vk13, vo3p0);
+      vo0p0 = _mm512_fmadd_ps(vi2xHIJKLMNOPQRSTUVW, vk23, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi3xHIJKLMNOPQRSTUVW, vk23, vo1p0);
+      vo2p0 = _mm512_fmadd_ps(vi4xHIJKLMNOPQRSTUVW, vk23, vo2p0);
+      vo3p0 = _mm512_fmadd_ps(vi5xHIJKLMNOPQRSTUVW, vk23, vo3p0);
+      vo0p0 = _mm512_fmadd_ps(vi3xHIJKLMNOPQRSTUVW, vk33, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi4xHIJKLMNOPQRSTUVW, vk33, vo1p0);
+      vo2p0 = _mm512_fmadd_ps(vi5xHIJKLMNOPQRSTUVW, vk33, vo2p0);
+      vo3p0 = _mm512_fmadd_ps(vi6xHIJKLMNOPQRSTUVW, vk33, vo3p0);
+      vo0p0 = _mm512_fmadd_ps(vi4xHIJKLMNOPQRSTUVW, vk43, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi5xHIJKLMNOPQRSTUVW, vk43, vo1p0);
+      vo2p0 = _mm512_fmadd_ps(vi6xHIJKLMNOPQRSTUVW, vk43, vo2p0);
+      vo3p0 = _mm512_fmadd_ps(vi7xHIJKLMNOPQRSTUVW, vk43, vo3p0);
+
+      const __m512 vi0xIJKLMNOPQRSTUVWX = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_setzero_si512(), _mm512_castps_si512(vi0xGHIJKLMNOPQRSTUV), 2));
+      const __m512 vi1xIJKLMNOPQRSTUVWX = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_setzero_si512(), _mm512_castps_si512(vi1xGHIJKLMNOPQRSTUV), 2));
+      const __m512 vi2xIJKLMNOPQRSTUVWX = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_setzero_si512(), _mm512_castps_si512(vi2xGHIJKLMNOPQRSTUV), 2));
+      const __m512 vi3xIJKLMNOPQRSTUVWX = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_setzero_si512(), _mm512_castps_si512(vi3xGHIJKLMNOPQRSTUV), 2));
+      const __m512 vi4xIJKLMNOPQRSTUVWX = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_setzero_si512(), _mm512_castps_si512(vi4xGHIJKLMNOPQRSTUV), 2));
+      const __m512 vi5xIJKLMNOPQRSTUVWX = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_setzero_si512(), _mm512_castps_si512(vi5xGHIJKLMNOPQRSTUV), 2));
+      const __m512 vi6xIJKLMNOPQRSTUVWX = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_setzero_si512(), _mm512_castps_si512(vi6xGHIJKLMNOPQRSTUV), 2));
+      const __m512 vi7xIJKLMNOPQRSTUVWX = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_setzero_si512(), _mm512_castps_si512(vi7xGHIJKLMNOPQRSTUV), 2));
+
+      vo0p0 = _mm512_fmadd_ps(vi0xIJKLMNOPQRSTUVWX, vk04, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi1xIJKLMNOPQRSTUVWX, vk04, vo1p0);
+      vo2p0 = _mm512_fmadd_ps(vi2xIJKLMNOPQRSTUVWX, vk04, vo2p0);
+      vo3p0 = _mm512_fmadd_ps(vi3xIJKLMNOPQRSTUVWX, vk04, vo3p0);
+      vo0p0 = _mm512_fmadd_ps(vi1xIJKLMNOPQRSTUVWX, vk14, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi2xIJKLMNOPQRSTUVWX, vk14, vo1p0);
+      vo2p0 = _mm512_fmadd_ps(vi3xIJKLMNOPQRSTUVWX, vk14, vo2p0);
+      vo3p0 = _mm512_fmadd_ps(vi4xIJKLMNOPQRSTUVWX, vk14, vo3p0);
+      vo0p0 = _mm512_fmadd_ps(vi2xIJKLMNOPQRSTUVWX, vk24, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi3xIJKLMNOPQRSTUVWX, vk24, vo1p0);
+      vo2p0 = _mm512_fmadd_ps(vi4xIJKLMNOPQRSTUVWX, vk24, vo2p0);
+      vo3p0 = _mm512_fmadd_ps(vi5xIJKLMNOPQRSTUVWX, vk24, vo3p0);
+      vo0p0 = _mm512_fmadd_ps(vi3xIJKLMNOPQRSTUVWX, vk34, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi4xIJKLMNOPQRSTUVWX, vk34, vo1p0);
+      vo2p0 = _mm512_fmadd_ps(vi5xIJKLMNOPQRSTUVWX, vk34, vo2p0);
+      vo3p0 = _mm512_fmadd_ps(vi6xIJKLMNOPQRSTUVWX, vk34, vo3p0);
+      vo0p0 = _mm512_fmadd_ps(vi4xIJKLMNOPQRSTUVWX, vk44, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi5xIJKLMNOPQRSTUVWX, vk44, vo1p0);
+      vo2p0 = _mm512_fmadd_ps(vi6xIJKLMNOPQRSTUVWX, vk44, vo2p0);
+      vo3p0 = _mm512_fmadd_ps(vi7xIJKLMNOPQRSTUVWX, vk44, vo3p0);
+
+
+      __m512 vo0 = _mm512_max_ps(vo0p0, vmin);
+      __m512 vo1 = _mm512_max_ps(vo1p0, vmin);
+      __m512 vo2 = _mm512_max_ps(vo2p0, vmin);
+      __m512 vo3 = _mm512_max_ps(vo3p0, vmin);
+
+      vo0 = _mm512_min_ps(vo0, vmax);
+      vo1 = _mm512_min_ps(vo1, vmax);
+      vo2 = _mm512_min_ps(vo2, vmax);
+      vo3 = _mm512_min_ps(vo3, vmax);
+
+      _mm512_mask_storeu_ps(o3, vmask, vo3);
+      o3 += w / sizeof(float);
+      _mm512_mask_storeu_ps(o2, vmask, vo2);
+      o2 += w / sizeof(float);
+      _mm512_mask_storeu_ps(o1, vmask, vo1);
+      o1 += w / sizeof(float);
+      _mm512_mask_storeu_ps(o0, vmask, vo0);
+      o0 += w / sizeof(float);
+    }
+
+    i0 = (const float*) ((uintptr_t) i4 - input_decrement);
+    i1 = (const float*) ((uintptr_t) i5 - input_decrement);
+    i2 = (const float*) ((uintptr_t) i1 + input_width);
+    i3 = (const float*) ((uintptr_t) i2 + input_width);
+    i4 = (const float*) ((uintptr_t) i3 + input_width);
+    i5 = (const float*) ((uintptr_t) i4 + input_width);
+    i6 = (const float*) ((uintptr_t) i5 + input_width);
+    i7 = (const float*) ((uintptr_t) i6 + input_width);
+
+    o0 = o3;
+    o1 = (float*) ((uintptr_t) o0 + input_width);
+    o2 = (float*) ((uintptr_t) o1 + input_width);
+    o3 = (float*) ((uintptr_t) o2 + input_width);
+
+    output_height = doz(output_height, 4);
+  } while (output_height != 0);
+}
+
+void xnn_f32_dwconv2d_chw_ukernel_5x5s2p2__avx512f_2x16_acc2(
+    size_t input_height,
+    size_t input_width,
+    const float* input,
+    const float* weights,
+    const float* zero,
+    float* output,
+    uint32_t padding_top,
+    const union xnn_f32_chw_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(input_height != 0);
+  assert(input_width != 0);
+  assert(input_width % sizeof(float) == 0);
+  assert(padding_top >= 1);
+  assert(padding_top <= 2);
+
+  // Masks of the valid pixels in the last block of 1..32 pixels of each row.
+  const uint32_t vmask_bits = UINT32_C(0xFFFFFFFF) >> (31 - (((input_width - 1 * sizeof(float)) / sizeof(float)) & 31));
+  const __mmask16 vmask_lo = _cvtu32_mask16(vmask_bits);
+  const __mmask16 vmask_hi = _cvtu32_mask16(vmask_bits >> 16);
+  const __mmask16 vmask_first_lo = input_width > 32 * sizeof(float) ? _cvtu32_mask16(UINT32_C(0xFFFF)) : vmask_lo;
+  const __mmask16 vmask_first_hi = input_width > 32 * sizeof(float) ? _cvtu32_mask16(UINT32_C(0xFFFF)) : vmask_hi;
+  const __m512i vidx_even = _mm512_set_epi32(30, 28, 26, 24, 22, 20, 18, 16, 14, 12, 10, 8, 6, 4, 2, 0);
+  const __m512i vidx_odd = _mm512_set_epi32(31, 29, 27, 25, 23, 21, 19, 17, 15, 13, 11, 9, 7, 5, 3, 1);
+  const __m512 vmax = _mm512_set1_ps(params->sse.max[0]);
+  const __m512 vmin = _mm512_set1_ps(params->sse.min[0]);
+
+  const __m512 vbias = _mm512_set1_ps(weights[0]);
+  const __m512 vk00 = _mm512_set1_ps(weights[1]);
+  const __m512 vk01 = _mm512_set1_ps(weights[2]);
+  const __m512 vk02 = _mm512_set1_ps(weights[3]);
+  const __m512 vk03 = _mm512_set1_ps(weights[4]);
+  const __m512 vk04 = _mm512_set1_ps(weights[5]);
+  const __m512 vk10 = _mm512_set1_ps(weights[6]);
+  const __m512 vk11 = _mm512_set1_ps(weights[7]);
+  const __m512 vk12 = _mm512_set1_ps(weights[8]);
+  const __m512 vk13 = _mm512_set1_ps(weights[9]);
+  const __m512 vk14 = _mm512_set1_ps(weights[10]);
+  const __m512 vk20 = _mm512_set1_ps(weights[11]);
+  const __m512 vk21 = _mm512_set1_ps(weights[12]);
+  const __m512 vk22 = _mm512_set1_ps(weights[13]);
+  const __m512 vk23 = _mm512_set1_ps(weights[14]);
+  const __m512 vk24 = _mm512_set1_ps(weights[15]);
+  const __m512 vk30 = _mm512_set1_ps(weights[16]);
+  const __m512 vk31 = _mm512_set1_ps(weights[17]);
+  const __m512 vk32 = _mm512_set1_ps(weights[18]);
+  const __m512 vk33 = _mm512_set1_ps(weights[19]);
+  const __m512 vk34 = _mm512_set1_ps(weights[20]);
+  const __m512 vk40 = _mm512_set1_ps(weights[21]);
+  const __m512 vk41 = _mm512_set1_ps(weights[22]);
+  const __m512 vk42 = _mm512_set1_ps(weights[23]);
+  const __m512 vk43 = _mm512_set1_ps(weights[24]);
+  const __m512 vk44 = _mm512_set1_ps(weights[25]);
+
+  const uint32_t padding_top_less_1 = padding_top - 1;
+  const size_t input_decrement = round_up_po2(input_width, 16 /* SIMD output width */ * 2 /* subsampling */ * sizeof(float));
+
+  const float* i0 = zero;
+  const float* i1 = (const float*) ((uintptr_t) input - ((-padding_top_less_1) & input_width));
+  const float* i2 = (const float*) ((uintptr_t) i1 + input_width);
+  if XNN_UNPREDICTABLE(padding_top_less_1 != 0) {
+    i1 = zero;
+  }
+  const float* i3 = (const float*) ((uintptr_t) i2 + input_width);
+  const float* i4 = (const float*) ((uintptr_t) i3 + input_width);
+  const float* i5 = (const float*) ((uintptr_t) i4 + input_width);
+  const float* i6 = (const float*) ((uintptr_t) i5 + input_width);
+
+  const size_t output_width = round_down_po2((input_width + (2 /* padding */ - 3 /* kernel size */ + 2 /* subsampling */) * sizeof(float)) / 2, sizeof(float));
+
+  float* o0 = output;
+  float* o1 = (float*) ((uintptr_t) o0 + output_width);
+
+  size_t padded_input_height = input_height + (padding_top_less_1 + 1) + 2 /* padding bottom */;
+  size_t output_height = (padded_input_height - 5 /* kernel size */ + 2 /* subsampling */) / 2;
+  do {
+    if XNN_UNPREDICTABLE(padded_input_height < 6) {
+      i3 = zero;
+    }
+    if XNN_UNPREDICTABLE(padded_input_height < 7) {
+      i4 = zero;
+      o1 = o0;
+    }
+    if XNN_UNPREDICTABLE(padded_input_height < 8) {
+      i5 = zero;
+    }
+    if XNN_UNPREDICTABLE(padded_input_height < 9) {
+      i6 = zero;
+    }
+
+    __m512 vi0_prev_even = _mm512_setzero_ps();
+    __m512 vi0_prev_odd = _mm512_setzero_ps();
+    __m512 vi1_prev_even = _mm512_setzero_ps();
+    __m512 vi1_prev_odd = _mm512_setzero_ps();
+    __m512 vi2_prev_even = _mm512_setzero_ps();
+    __m512 vi2_prev_odd = _mm512_setzero_ps();
+    __m512 vi3_prev_even = _mm512_setzero_ps();
+    __m512 vi3_prev_odd = _mm512_setzero_ps();
+    __m512 vi4_prev_even = _mm512_setzero_ps();
+    __m512 vi4_prev_odd = _mm512_setzero_ps();
+    __m512 vi5_prev_even = _mm512_setzero_ps();
+    __m512 vi5_prev_odd = _mm512_setzero_ps();
+    __m512 vi6_prev_even = _mm512_setzero_ps();
+    __m512 vi6_prev_odd = _mm512_setzero_ps();
+
+    const __m512 vi0_lo = _mm512_maskz_loadu_ps(vmask_first_lo, i0);
+    const __m512 vi0_hi = _mm512_maskz_loadu_ps(vmask_first_hi, i0 + 16);
+    i0 += 32;
+    const __m512 vi1_lo = _mm512_maskz_loadu_ps(vmask_first_lo, i1);
+    const __m512 vi1_hi = _mm512_maskz_loadu_ps(vmask_first_hi, i1 + 16);
+    i1 += 32;
+    const __m512 vi2_lo = _mm512_maskz_loadu_ps(vmask_first_lo, i2);
+    const __m512 vi2_hi = _mm512_maskz_loadu_ps(vmask_first_hi, i2 + 16);
+    i2 += 32;
+    const __m512 vi3_lo = _mm512_maskz_loadu_ps(vmask_first_lo, i3);
+    const __m512 vi3_hi = _mm512_maskz_loadu_ps(vmask_first_hi, i3 + 16);
+    i3 += 32;
+    const __m512 vi4_lo = _mm512_maskz_loadu_ps(vmask_first_lo, i4);
+    const __m512 vi4_hi = _mm512_maskz_loadu_ps(vmask_first_hi, i4 + 16);
+    i4 += 32;
+    const __m512 vi5_lo = _mm512_maskz_loadu_ps(vmask_first_lo, i5);
+    const __m512 vi5_hi = _mm512_maskz_loadu_ps(vmask_first_hi, i5 + 16);
+    i5 += 32;
+    const __m512 vi6_lo = _mm512_maskz_loadu_ps(vmask_first_lo, i6);
+    const __m512 vi6_hi = _mm512_maskz_loadu_ps(vmask_first_hi, i6 + 16);
+    i6 += 32;
+
+    __m512 vi0_even = _mm512_permutex2var_ps(vi0_lo, vidx_even, vi0_hi);
+    __m512 vi0_odd = _mm512_permutex2var_ps(vi0_lo, vidx_odd, vi0_hi);
+    __m512 vi1_even = _mm512_permutex2var_ps(vi1_lo, vidx_even, vi1_hi);
+    __m512 vi1_odd = _mm512_permutex2var_ps(vi1_lo, vidx_odd, vi1_hi);
+    __m512 vi2_even = _mm512_permutex2var_ps(vi2_lo, vidx_even, vi2_hi);
+    __m512 vi2_odd = _mm512_permutex2var_ps(vi2_lo, vidx_odd, vi2_hi);
+    __m512 vi3_even = _mm512_permutex2var_ps(vi3_lo, vidx_even, vi3_hi);
+    __m512 vi3_odd = _mm512_permutex2var_ps(vi3_lo, vidx_odd, vi3_hi);
+    __m512 vi4_even = _mm512_permutex2var_ps(vi4_lo, vidx_even, vi4_hi);
+    __m512 vi4_odd = _mm512_permutex2var_ps(vi4_lo, vidx_odd, vi4_hi);
+    __m512 vi5_even = _mm512_permutex2var_ps(vi5_lo, vidx_even, vi5_hi);
+    __m512 vi5_odd = _mm512_permutex2var_ps(vi5_lo, vidx_odd, vi5_hi);
+    __m512 vi6_even = _mm512_permutex2var_ps(vi6_lo, vidx_even, vi6_hi);
+    __m512 vi6_odd = _mm512_permutex2var_ps(vi6_lo, vidx_odd, vi6_hi);
+
+    size_t w = input_width;
+    for (; w > 64 * sizeof(float); w -= 32 * sizeof(float)) {
+      __m512 vo0p0 = _mm512_fmadd_ps(vi0_even, vk02, vbias);
+      __m512 vo1p0 = _mm512_fmadd_ps(vi2_even, vk02, vbias);
+      __m512 vo0p1 = _mm512_mul_ps(vi1_even, vk12);
+      __m512 vo1p1 = _mm512_mul_ps(vi3_even, vk12);
+      vo0p0 = _mm512_fmadd_ps(vi2_even, vk22, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi4_even, vk22, vo1p0);
+      vo0p1 = _mm512_fmadd_ps(vi3_even, vk32, vo0p1);
+      vo1p1 = _mm512_fmadd_ps(vi5_even, vk32, vo1p1);
+      vo0p0 = _mm512_fmadd_ps(vi4_even, vk42, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi6_even, vk42, vo1p0);
+
+      const __m512 vi0_next_lo = _mm512_loadu_ps(i0);
+      const __m512 vi0_next_hi = _mm512_loadu_ps(i0 + 16);
+      i0 += 32;
+      const __m512 vi1_next_lo = _mm512_loadu_ps(i1);
+      const __m512 vi1_next_hi = _mm512_loadu_ps(i1 + 16);
+      i1 += 32;
+      const __m512 vi2_next_lo = _mm512_loadu_ps(i2);
+      const __m512 vi2_next_hi = _mm512_loadu_ps(i2 + 16);
+      i2 += 32;
+      const __m512 vi3_next_lo = _mm512_loadu_ps(i3);
+      const __m512 vi3_next_hi = _mm512_loadu_ps(i3 + 16);
+      i3 += 32;
+      const __m512 vi4_next_lo = _mm512_loadu_ps(i4);
+      const __m512 vi4_next_hi = _mm512_loadu_ps(i4 + 16);
+      i4 += 32;
+      const __m512 vi5_next_lo = _mm512_loadu_ps(i5);
+      const __m512 vi5_next_hi = _mm512_loadu_ps(i5 + 16);
+      i5 += 32;
+      const __m512 vi6_next_lo = _mm512_loadu_ps(i6);
+      const __m512 vi6_next_hi = _mm512_loadu_ps(i6 + 16);
+      i6 += 32;
+
+      vo0p1 = _mm512_fmadd_ps(vi0_odd, vk03, vo0p1);
+      vo1p1 = _mm512_fmadd_ps(vi2_odd, vk03, vo1p1);
+      vo0p0 = _mm512_fmadd_ps(vi1_odd, vk13, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi3_odd, vk13, vo1p0);
+      vo0p1 = _mm512_fmadd_ps(vi2_odd, vk23, vo0p1);
+      vo1p1 = _mm512_fmadd_ps(vi4_odd, vk23, vo1p1);
+      vo0p0 = _mm512_fmadd_ps(vi3_odd, vk33, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi5_odd, vk33, vo1p0);
+      vo0p1 = _mm512_fmadd_ps(vi4_odd, vk43, vo0p1);
+      vo1p1 = _mm512_fmadd_ps(vi6_odd, vk43, vo1p1);
+
+      const __m512 vi0_even_left = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi0_even), _mm512_castps_si512(vi0_prev_even), 15));
+      vi0_prev_even = vi0_even;
+      const __m512 vi1_even_left = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi1_even), _mm512_castps_si512(vi1_prev_even), 15));
+      vi1_prev_even = vi1_even;
+      const __m512 vi2_even_left = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi2_even), _mm512_castps_si512(vi2_prev_even), 15));
+      vi2_prev_even = vi2_even;
+      const __m512 vi3_even_left = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi3_even), _mm512_castps_si512(vi3_prev_even), 15));
+      vi3_prev_even = vi3_even;
+      const __m512 vi4_even_left = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi4_even), _mm512_castps_si512(vi4_prev_even), 15));
+      vi4_prev_even = vi4_even;
+      const __m512 vi5_even_left = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi5_even), _mm512_castps_si512(vi5_prev_even), 15));
+      vi5_prev_even = vi5_even;
+      const __m512 vi6_even_left = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi6_even), _mm512_castps_si512(vi6_prev_even), 15));
+      vi6_prev_even = vi6_even;
+
+      vo0p0 = _mm512_fmadd_ps(vi0_even_left, vk00, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi2_even_left, vk00, vo1p0);
+      vo0p1 = _mm512_fmadd_ps(vi1_even_left, vk10, vo0p1);
+      vo1p1 = _mm512_fmadd_ps(vi3_even_left, vk10, vo1p1);
+      vo0p0 = _mm512_fmadd_ps(vi2_even_left, vk20, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi4_even_left, vk20, vo1p0);
+      vo0p1 = _mm512_fmadd_ps(vi3_even_left, vk30, vo0p1);
+      vo1p1 = _mm512_fmadd_ps(vi5_even_left, vk30, vo1p1);
+      vo0p0 = _mm512_fmadd_ps(vi4_even_left, vk40, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi6_even_left, vk40, vo1p0);
+
+      const __m512 vi0_odd_left = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi0_odd), _mm512_castps_si512(vi0_prev_odd), 15));
+      vi0_prev_odd = vi0_odd;
+      const __m512 vi1_odd_left = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi1_odd), _mm512_castps_si512(vi1_prev_odd), 15));
+      vi1_prev_odd = vi1_odd;
+      const __m512 vi2_odd_left = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi2_odd), _mm512_castps_si512(vi2_prev_odd), 15));
+      vi2_prev_odd = vi2_odd;
+      const __m512 vi3_odd_left = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi3_odd), _mm512_castps_si512(vi3_prev_odd), 15));
+      vi3_prev_odd = vi3_odd;
+      const __m512 vi4_odd_left = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi4_odd), _mm512_castps_si512(vi4_prev_odd), 15));
+      vi4_prev_odd = vi4_odd;
+      const __m512 vi5_odd_left = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi5_odd), _mm512_castps_si512(vi5_prev_odd), 15));
+      vi5_prev_odd = vi5_odd;
+      const __m512 vi6_odd_left = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi6_odd), _mm512_castps_si512(vi6_prev_odd), 15));
+      vi6_prev_odd = vi6_odd;
+
+      vo0p1 = _mm512_fmadd_ps(vi0_odd_left, vk01, vo0p1);
+      vo1p1 = _mm512_fmadd_ps(vi2_odd_left, vk01, vo1p1);
+      vo0p0 = _mm512_fmadd_ps(vi1_odd_left, vk11, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi3_odd_left, vk11, vo1p0);
+      vo0p1 = _mm512_fmadd_ps(vi2_odd_left, vk21, vo0p1);
+      vo1p1 = _mm512_fmadd_ps(vi4_odd_left, vk21, vo1p1);
+      vo0p0 = _mm512_fmadd_ps(vi3_odd_left, vk31, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi5_odd_left, vk31, vo1p0);
+      vo0p1 = _mm512_fmadd_ps(vi4_odd_left, vk41, vo0p1);
+      vo1p1 = _mm512_fmadd_ps(vi6_odd_left, vk41, vo1p1);
+
+      const __m512 vi0_next_even = _mm512_permutex2var_ps(vi0_next_lo, vidx_even, vi0_next_hi);
+      const __m512 vi0_next_odd = _mm512_permutex2var_ps(vi0_next_lo, vidx_odd, vi0_next_hi);
+      const __m512 vi1_next_even = _mm512_permutex2var_ps(vi1_next_lo, vidx_even, vi1_next_hi);
+      const __m512 vi1_next_odd = _mm512_permutex2var_ps(vi1_next_lo, vidx_odd, vi1_next_hi);
+      const __m512 vi2_next_even = _mm512_permutex2var_ps(vi2_next_lo, vidx_even, vi2_next_hi);
+      const __m512 vi2_next_odd = _mm512_permutex2var_ps(vi2_next_lo, vidx_odd, vi2_next_hi);
+      const __m512 vi3_next_even = _mm512_permutex2var_ps(vi3_next_lo, vidx_even, vi3_next_hi);
+      const __m512 vi3_next_odd = _mm512_permutex2var_ps(vi3_next_lo, vidx_odd, vi3_next_hi);
+      const __m512 vi4_next_even = _mm512_permutex2var_ps(vi4_next_lo, vidx_even, vi4_next_hi);
+      const __m512 vi4_next_odd = _mm512_permutex2var_ps(vi4_next_lo, vidx_odd, vi4_next_hi);
+      const __m512 vi5_next_even = _mm512_permutex2var_ps(vi5_next_lo, vidx_even, vi5_next_hi);
+      const __m512 vi5_next_odd = _mm512_permutex2var_ps(vi5_next_lo, vidx_odd, vi5_next_hi);
+      const __m512 vi6_next_even = _mm512_permutex2var_ps(vi6_next_lo, vidx_even, vi6_next_hi);
+      const __m512 vi6_next_odd = _mm512_permutex2var_ps(vi6_next_lo, vidx_odd, vi6_next_hi);
+
+      const __m512 vi0_even_right = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi0_next_even), _mm512_castps_si512(vi0_even), 1));
+      vi0_even = vi0_next_even;
+      vi0_odd = vi0_next_odd;
+      const __m512 vi1_even_right = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi1_next_even), _mm512_castps_si512(vi1_even), 1));
+      vi1_even = vi1_next_even;
+      vi1_odd = vi1_next_odd;
+      const __m512 vi2_even_right = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi2_next_even), _mm512_castps_si512(vi2_even), 1));
+      vi2_even = vi2_next_even;
+      vi2_odd = vi2_next_odd;
+      const __m512 vi3_even_right = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi3_next_even), _mm512_castps_si512(vi3_even), 1));
+      vi3_even = vi3_next_even;
+      vi3_odd = vi3_next_odd;
+      const __m512 vi4_even_right = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi4_next_even), _mm512_castps_si512(vi4_even), 1));
+      vi4_even = vi4_next_even;
+      vi4_odd = vi4_next_odd;
+      const __m512 vi5_even_right = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi5_next_even), _mm512_castps_si512(vi5_even), 1));
+      vi5_even = vi5_next_even;
+      vi5_odd = vi5_next_odd;
+      const __m512 vi6_even_right = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi6_next_even), _mm512_castps_si512(vi6_even), 1));
+      vi6_even = vi6_next_even;
+      vi6_odd = vi6_next_odd;
+
+      vo0p0 = _mm512_fmadd_ps(vi0_even_right, vk04, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi2_even_right, vk04, vo1p0);
+      vo0p1 = _mm512_fmadd_ps(vi1_even_right, vk14, vo0p1);
+      vo1p1 = _mm512_fmadd_ps(vi3_even_right, vk14, vo1p1);
+      vo0p0 = _mm512_fmadd_ps(vi2_even_right, vk24, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi4_even_right, vk24, vo1p0);
+      vo0p1 = _mm512_fmadd_ps(vi3_even_right, vk34, vo0p1);
+      vo1p1 = _mm512_fmadd_ps(vi5_even_right, vk34, vo1p1);
+      vo0p0 = _mm512_fmadd_ps(vi4_even_right, vk44, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi6_even_right, vk44, vo1p0);
+
+      vo0p0 = _mm512_add_ps(vo0p0, vo0p1);
+      vo1p0 = _mm512_add_ps(vo1p0, vo1p1);
+
+      __m512 vo0 = _mm512_max_ps(vo0p0, vmin);
+      __m512 vo1 = _mm512_max_ps(vo1p0, vmin);
+
+      vo0 = _mm512_min_ps(vo0, vmax);
+      vo1 = _mm512_min_ps(vo1, vmax);
+
+      _mm512_storeu_ps(o1, vo1);
+      o1 += 16;
+      _mm512_storeu_ps(o0, vo0);
+      o0 += 16;
+    }
+    // Process the next-to-last block of 32 pixels; the last block is loaded with masks.
+    if XNN_LIKELY(w > 32 * sizeof(float)) {
+      __m512 vo0p0 = _mm512_fmadd_ps(vi0_even, vk02, vbias);
+      __m512 vo1p0 = _mm512_fmadd_ps(vi2_even, vk02, vbias);
+      __m512 vo0p1 = _mm512_mul_ps(vi1_even, vk12);
+      __m512 vo1p1 = _mm512_mul_ps(vi3_even, vk12);
+      vo0p0 = _mm512_fmadd_ps(vi2_even, vk22, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi4_even, vk22, vo1p0);
+      vo0p1 = _mm512_fmadd_ps(vi3_even, vk32, vo0p1);
+      vo1p1 = _mm512_fmadd_ps(vi5_even, vk32, vo1p1);
+      vo0p0 = _mm512_fmadd_ps(vi4_even, vk42, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi6_even, vk42, vo1p0);
+
+      const __m512 vi0_next_lo = _mm512_maskz_loadu_ps(vmask_lo, i0);
+      const __m512 vi0_next_hi = _mm512_maskz_loadu_ps(vmask_hi, i0 + 16);
+      i0 += 32;
+      const __m512 vi1_next_lo = _mm512_maskz_loadu_ps(vmask_lo, i1);
+      const __m512 vi1_next_hi = _mm512_maskz_loadu_ps(vmask_hi, i1 + 16);
+      i1 += 32;
+      const __m512 vi2_next_lo = _mm512_maskz_loadu_ps(vmask_lo, i2);
+      const __m512 vi2_next_hi = _mm512_maskz_loadu_ps(vmask_hi, i2 + 16);
+      i2 += 32;
+      const __m512 vi3_next_lo = _mm512_maskz_loadu_ps(vmask_lo, i3);
+      const __m512 vi3_next_hi = _mm512_maskz_loadu_ps(vmask_hi, i3 + 16);
+      i3 += 32;
+      const __m512 vi4_next_lo = _mm512_maskz_loadu_ps(vmask_lo, i4);
+      const __m512 vi4_next_hi = _mm512_maskz_loadu_ps(vmask_hi, i4 + 16);
+      i4 += 32;
+      const __m512 vi5_next_lo = _mm512_maskz_loadu_ps(vmask_lo, i5);
+      const __m512 vi5_next_hi = _mm512_maskz_loadu_ps(vmask_hi, i5 + 16);
+      i5 += 32;
+      const __m512 vi6_next_lo = _mm512_maskz_loadu_ps(vmask_lo, i6);
+      const __m512 vi6_next_hi = _mm512_maskz_loadu_ps(vmask_hi, i6 + 16);
+      i6 += 32;
+
+      vo0p1 = _mm512_fmadd_ps(vi0_odd, vk03, vo0p1);
+      vo1p1 = _mm512_fmadd_ps(vi2_odd, vk03, vo1p1);
+      vo0p0 = _mm512_fmadd_ps(vi1_odd, vk13, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi3_odd, vk13, vo1p0);
+      vo0p1 = _mm512_fmadd_ps(vi2_odd, vk23, vo0p1);
+      vo1p1 = _mm512_fmadd_ps(vi4_odd, vk23, vo1p1);
+      vo0p0 = _mm512_fmadd_ps(vi3_odd, vk33, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi5_odd, vk33, vo1p0);
+      vo0p1 = _mm512_fmadd_ps(vi4_odd, vk43, vo0p1);
+      vo1p1 = _mm512_fmadd_ps(vi6_odd, vk43, vo1p1);
+
+      const __m512 vi0_even_left = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi0_even), _mm512_castps_si512(vi0_prev_even), 15));
+      vi0_prev_even = vi0_even;
+      const __m512 vi1_even_left = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi1_even), _mm512_castps_si512(vi1_prev_even), 15));
+      vi1_prev_even = vi1_even;
+      const __m512 vi2_even_left = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi2_even), _mm512_castps_si512(vi2_prev_even), 15));
+      vi2_prev_even = vi2_even;
+      const __m512 vi3_even_left = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi3_even), _mm512_castps_si512(vi3_prev_even), 15));
+      vi3_prev_even = vi3_even;
+      const __m512 vi4_even_left = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi4_even), _mm512_castps_si512(vi4_prev_even), 15));
+      vi4_prev_even = vi4_even;
+      const __m512 vi5_even_left = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi5_even), _mm512_castps_si512(vi5_prev_even), 15));
+      vi5_prev_even = vi5_even;
+      const __m512 vi6_even_left = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi6_even), _mm512_castps_si512(vi6_prev_even), 15));
+      vi6_prev_even = vi6_even;
+
+      vo0p0 = _mm512_fmadd_ps(vi0_even_left, vk00, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi2_even_left, vk00, vo1p0);
+      vo0p1 = _mm512_fmadd_ps(vi1_even_left, vk10, vo0p1);
+      vo1p1 = _mm512_fmadd_ps(vi3_even_left, vk10, vo1p1);
+      vo0p0 = _mm512_fmadd_ps(vi2_even_left, vk20, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi4_even_left, vk20, vo1p0);
+      vo0p1 = _mm512_fmadd_ps(vi3_even_left, vk30, vo0p1);
+      vo1p1 = _mm512_fmadd_ps(vi5_even_left, vk30, vo1p1);
+      vo0p0 = _mm512_fmadd_ps(vi4_even_left, vk40, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi6_even_left, vk40, vo1p0);
+
+      const __m512 vi0_odd_left = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi0_odd), _mm512_castps_si512(vi0_prev_odd), 15));
+      vi0_prev_odd = vi0_odd;
+      const __m512 vi1_odd_left = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi1_odd), _mm512_castps_si512(vi1_prev_odd), 15));
+      vi1_prev_odd = vi1_odd;
+      const __m512 vi2_odd_left = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi2_odd), _mm512_castps_si512(vi2_prev_odd), 15));
+      vi2_prev_odd = vi2_odd;
+      const __m512 vi3_odd_left = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi3_odd), _mm512_castps_si512(vi3_prev_odd), 15));
+      vi3_prev_odd = vi3_odd;
+      const __m512 vi4_odd_left = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi4_odd), _mm512_castps_si512(vi4_prev_odd), 15));
+      vi4_prev_odd = vi4_odd;
+      const __m512 vi5_odd_left = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi5_odd), _mm512_castps_si512(vi5_prev_odd), 15));
+      vi5_prev_odd = vi5_odd;
+      const __m512 vi6_odd_left = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi6_odd), _mm512_castps_si512(vi6_prev_odd), 15));
+      vi6_prev_odd = vi6_odd;
+
+      vo0p1 = _mm512_fmadd_ps(vi0_odd_left, vk01, vo0p1);
+      vo1p1 = _mm512_fmadd_ps(vi2_odd_left, vk01, vo1p1);
+      vo0p0 = _mm512_fmadd_ps(vi1_odd_left, vk11, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi3_odd_left, vk11, vo1p0);
+      vo0p1 = _mm512_fmadd_ps(vi2_odd_left, vk21, vo0p1);
+      vo1p1 = _mm512_fmadd_ps(vi4_odd_left, vk21, vo1p1);
+      vo0p0 = _mm512_fmadd_ps(vi3_odd_left, vk31, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi5_odd_left, vk31, vo1p0);
+      vo0p1 = _mm512_fmadd_ps(vi4_odd_left, vk41, vo0p1);
+      vo1p1 = _mm512_fmadd_ps(vi6_odd_left, vk41, vo1p1);
+
+      const __m512 vi0_next_even = _mm512_permutex2var_ps(vi0_next_lo, vidx_even, vi0_next_hi);
+      const __m512 vi0_next_odd = _mm512_permutex2var_ps(vi0_next_lo, vidx_odd, vi0_next_hi);
+      const __m512 vi1_next_even = _mm512_permutex2var_ps(vi1_next_lo, vidx_even, vi1_next_hi);
+      const __m512 vi1_next_odd = _mm512_permutex2var_ps(vi1_next_lo, vidx_odd, vi1_next_hi);
+      const __m512 vi2_next_even = _mm512_permutex2var_ps(vi2_next_lo, vidx_even, vi2_next_hi);
+      const __m512 vi2_next_odd = _mm512_permutex2var_ps(vi2_next_lo, vidx_odd, vi2_next_hi);
+      const __m512 vi3_next_even = _mm512_permutex2var_ps(vi3_next_lo, vidx_even, vi3_next_hi);
+      const __m512 vi3_next_odd = _mm512_permutex2var_ps(vi3_next_lo, vidx_odd, vi3_next_hi);
+      const __m512 vi4_next_even = _mm512_permutex2var_ps(vi4_next_lo, vidx_even, vi4_next_hi);
+      const __m512 vi4_next_odd = _mm512_permutex2var_ps(vi4_next_lo, vidx_odd, vi4_next_hi);
+      const __m512 vi5_next_even = _mm512_permutex2var_ps(vi5_next_lo, vidx_even, vi5_next_hi);
+      const __m512 vi5_next_odd = _mm512_permutex2var_ps(vi5_next_lo, vidx_odd, vi5_next_hi);
+      const __m512 vi6_next_even = _mm512_permutex2var_ps(vi6_next_lo, vidx_even, vi6_next_hi);
+      const __m512 vi6_next_odd = _mm512_permutex2var_ps(vi6_next_lo, vidx_odd, vi6_next_hi);
+
+      const __m512 vi0_even_right = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi0_next_even), _mm512_castps_si512(vi0_even), 1));
+      vi0_even = vi0_next_even;
+      vi0_odd = vi0_next_odd;
+      const __m512 vi1_even_right = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi1_next_even), _mm512_castps_si512(vi1_even), 1));
+      vi1_even = vi1_next_even;
+      vi1_odd = vi1_next_odd;
+      const __m512 vi2_even_right = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi2_next_even), _mm512_castps_si512(vi2_even), 1));
+      vi2_even = vi2_next_even;
+      vi2_odd = vi2_next_odd;
+      const __m512 vi3_even_right = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi3_next_even), _mm512_castps_si512(vi3_even), 1));
+      vi3_even = vi3_next_even;
+      vi3_odd = vi3_next_odd;
+      const __m512 vi4_even_right = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi4_next_even), _mm512_castps_si512(vi4_even), 1));
+      vi4_even = vi4_next_even;
+      vi4_odd = vi4_next_odd;
+      const __m512 vi5_even_right = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi5_next_even), _mm512_castps_si512(vi5_even), 1));
+      vi5_even = vi5_next_even;
+      vi5_odd = vi5_next_odd;
+      const __m512 vi6_even_right = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi6_next_even), _mm512_castps_si512(vi6_even), 1));
+      vi6_even = vi6_next_even;
+      vi6_odd = vi6_next_odd;
+
+      vo0p0 = _mm512_fmadd_ps(vi0_even_right, vk04, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi2_even_right, vk04, vo1p0);
+      vo0p1 = _mm512_fmadd_ps(vi1_even_right, vk14, vo0p1);
+      vo1p1 = _mm512_fmadd_ps(vi3_even_right, vk14, vo1p1);
+      vo0p0 = _mm512_fmadd_ps(vi2_even_right, vk24, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi4_even_right, vk24, vo1p0);
+      vo0p1 = _mm512_fmadd_ps(vi3_even_right, vk34, vo0p1);
+      vo1p1 = _mm512_fmadd_ps(vi5_even_right, vk34, vo1p1);
+      vo0p0 = _mm512_fmadd_ps(vi4_even_right, vk44, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi6_even_right, vk44, vo1p0);
+
+      vo0p0 = _mm512_add_ps(vo0p0, vo0p1);
+      vo1p0 = _mm512_add_ps(vo1p0, vo1p1);
+
+      __m512 vo0 = _mm512_max_ps(vo0p0, vmin);
+      __m512 vo1 = _mm512_max_ps(vo1p0, vmin);
+
+      vo0 = _mm512_min_ps(vo0, vmax);
+      vo1 = _mm512_min_ps(vo1, vmax);
+
+      _mm512_storeu_ps(o1, vo1);
+      o1 += 16;
+      _mm512_storeu_ps(o0, vo0);
+      o0 += 16;
+
+      w -= 32 * sizeof(float);
+    }
+    // Always process the last block of 1..32 pixels.
+    assert(w >= 1 * sizeof(float));
+    assert(w <= 32 * sizeof(float));
+    {
+      __m512 vo0p0 = _mm512_fmadd_ps(vi0_even, vk02, vbias);
+      __m512 vo1p0 = _mm512_fmadd_ps(vi2_even, vk02, vbias);
+      __m512 vo0p1 = _mm512_mul_ps(vi1_even, vk12);
+      __m512 vo1p1 = _mm512_mul_ps(vi3_even, vk12);
+      vo0p0 = _mm512_fmadd_ps(vi2_even, vk22, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi4_even, vk22, vo1p0);
+      vo0p1 = _mm512_fmadd_ps(vi3_even, vk32, vo0p1);
+      vo1p1 = _mm512_fmadd_ps(vi5_even, vk32, vo1p1);
+      vo0p0 = _mm512_fmadd_ps(vi4_even, vk42, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi6_even, vk42, vo1p0);
+
+      vo0p1 = _mm512_fmadd_ps(vi0_odd, vk03, vo0p1);
+      vo1p1 = _mm512_fmadd_ps(vi2_odd, vk03, vo1p1);
+      vo0p0 = _mm512_fmadd_ps(vi1_odd, vk13, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi3_odd, vk13, vo1p0);
+      vo0p1 = _mm512_fmadd_ps(vi2_odd, vk23, vo0p1);
+      vo1p1 = _mm512_fmadd_ps(vi4_odd, vk23, vo1p1);
+      vo0p0 = _mm512_fmadd_ps(vi3_odd, vk33, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi5_odd, vk33, vo1p0);
+      vo0p1 = _mm512_fmadd_ps(vi4_odd, vk43, vo0p1);
+      vo1p1 = _mm512_fmadd_ps(vi6_odd, vk43, vo1p1);
+
+      const __m512 vi0_even_left = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi0_even), _mm512_castps_si512(vi0_prev_even), 15));
+      const __m512 vi1_even_left = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi1_even), _mm512_castps_si512(vi1_prev_even), 15));
+      const __m512 vi2_even_left = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi2_even), _mm512_castps_si512(vi2_prev_even), 15));
+      const __m512 vi3_even_left = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi3_even), _mm512_castps_si512(vi3_prev_even), 15));
+      const __m512 vi4_even_left = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi4_even), _mm512_castps_si512(vi4_prev_even), 15));
+      const __m512 vi5_even_left = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi5_even), _mm512_castps_si512(vi5_prev_even), 15));
+      const __m512 vi6_even_left = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi6_even), _mm512_castps_si512(vi6_prev_even), 15));
+
+      vo0p0 = _mm512_fmadd_ps(vi0_even_left, vk00, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi2_even_left, vk00, vo1p0);
+      vo0p1 = _mm512_fmadd_ps(vi1_even_left, vk10, vo0p1);
+      vo1p1 = _mm512_fmadd_ps(vi3_even_left, vk10, vo1p1);
+      vo0p0 = _mm512_fmadd_ps(vi2_even_left, vk20, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi4_even_left, vk20, vo1p0);
+      vo0p1 = _mm512_fmadd_ps(vi3_even_left, vk30, vo0p1);
+      vo1p1 = _mm512_fmadd_ps(vi5_even_left, vk30, vo1p1);
+      vo0p0 = _mm512_fmadd_ps(vi4_even_left, vk40, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi6_even_left, vk40, vo1p0);
+
+      const __m512 vi0_odd_left = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi0_odd), _mm512_castps_si512(vi0_prev_odd), 15));
+      const __m512 vi1_odd_left = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi1_odd), _mm512_castps_si512(vi1_prev_odd), 15));
+      const __m512 vi2_odd_left = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi2_odd), _mm512_castps_si512(vi2_prev_odd), 15));
+      const __m512 vi3_odd_left = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi3_odd), _mm512_castps_si512(vi3_prev_odd), 15));
+      const __m512 vi4_odd_left = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi4_odd), _mm512_castps_si512(vi4_prev_odd), 15));
+      const __m512 vi5_odd_left = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi5_odd), _mm512_castps_si512(vi5_prev_odd), 15));
+      const __m512 vi6_odd_left = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi6_odd), _mm512_castps_si512(vi6_prev_odd), 15));
+
+      vo0p1 = _mm512_fmadd_ps(vi0_odd_left, vk01, vo0p1);
+      vo1p1 = _mm512_fmadd_ps(vi2_odd_left, vk01, vo1p1);
+      vo0p0 = _mm512_fmadd_ps(vi1_odd_left, vk11, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi3_odd_left, vk11, vo1p0);
+      vo0p1 = _mm512_fmadd_ps(vi2_odd_left, vk21, vo0p1);
+      vo1p1 = _mm512_fmadd_ps(vi4_odd_left, vk21, vo1p1);
+      vo0p0 = _mm512_fmadd_ps(vi3_odd_left, vk31, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi5_odd_left, vk31, vo1p0);
+      vo0p1 = _mm512_fmadd_ps(vi4_odd_left, vk41, vo0p1);
+      vo1p1 = _mm512_fmadd_ps(vi6_odd_left, vk41, vo1p1);
+
+      const __m512 vi0_even_right = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_setzero_si512(), _mm512_castps_si512(vi0_even), 1));
+      const __m512 vi1_even_right = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_setzero_si512(), _mm512_castps_si512(vi1_even), 1));
+      const __m512 vi2_even_right = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_setzero_si512(), _mm512_castps_si512(vi2_even), 1));
+      const __m512 vi3_even_right = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_setzero_si512(), _mm512_castps_si512(vi3_even), 1));
+      const __m512 vi4_even_right = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_setzero_si512(), _mm512_castps_si512(vi4_even), 1));
+      const __m512 vi5_even_right = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_setzero_si512(), _mm512_castps_si512(vi5_even), 1));
+      const __m512 vi6_even_right = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_setzero_si512(), _mm512_castps_si512(vi6_even), 1));
+
+      vo0p0 = _mm512_fmadd_ps(vi0_even_right, vk04, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi2_even_right, vk04, vo1p0);
+      vo0p1 = _mm512_fmadd_ps(vi1_even_right, vk14, vo0p1);
+      vo1p1 = _mm512_fmadd_ps(vi3_even_right, vk14, vo1p1);
+      vo0p0 = _mm512_fmadd_ps(vi2_even_right, vk24, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi4_even_right, vk24, vo1p0);
+      vo0p1 = _mm512_fmadd_ps(vi3_even_right, vk34, vo0p1);
+      vo1p1 = _mm512_fmadd_ps(vi5_even_right, vk34, vo1p1);
+      vo0p0 = _mm512_fmadd_ps(vi4_even_right, vk44, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi6_even_right, vk44, vo1p0);
+
+      vo0p0 = _mm512_add_ps(vo0p0, vo0p1);
+      vo1p0 = _mm512_add_ps(vo1p0, vo1p1);
+
+      __m512 vo0 = _mm512_max_ps(vo0p0, vmin);
+      __m512 vo1 = _mm512_max_ps(vo1p0, vmin);
+
+      vo0 = _mm512_min_ps(vo0, vmax);
+      vo1 = _mm512_min_ps(vo1, vmax);
+
+      const size_t w_tmp = (w + 1 * sizeof(float)) / (2 * sizeof(float));
+      const __mmask16 vmask_output = _cvtu32_mask16((UINT32_C(1) << w_tmp) - UINT32_C(1));
+      _mm512_mask_storeu_ps(o1, vmask_output, vo1);
+      o1 += w_tmp;
+      _mm512_mask_storeu_ps(o0, vmask_output, vo0);
+      o0 += w_tmp;
+    }
+
+    i0 = (const float*) ((uintptr_t) i4 - input_decrement);
+    i1 = (const float*) ((uintptr_t) i5 - input_decrement);
+    i2 = (const float*) ((uintptr_t) i6 - input_decrement);
+    i3 = (const float*) ((uintptr_t) i2 + input_width);
+    i4 = (const float*) ((uintptr_t) i3 + input_width);
+    i5 = (const float*) ((uintptr_t) i4 + input_width);
+    i6 = (const float*) ((uintptr_t) i5 + input_width);
+
+    o0 = o1;
+    o1 = (float*) ((uintptr_t) o0 + output_width);
+
+    output_height = doz(output_height, 2);
+    padded_input_height = doz(padded_input_height, 4);
+  } while (output_height != 0);
+}
+
 void xnn_f32_gemm_minmax_ukernel_1x16__avx512f_broadcast(
     size_t mr,
     size_t nc,
@@ -1433,6 +5129,1162 @@ void xnn_f32_prelu_ukernel__avx512f_2x16(
   } while (rows != 0);
 }
 
+void xnn_f32_rmeanvar_ukernel__avx512f(
+    size_t n,
+    const float* x,
+    float* mean,
+    float* variance)
+{
+  assert(n != 0);
+  assert(n % sizeof(float) == 0);
+
+  // Every lane of every accumulator runs its own Welford recurrence:
+  //   delta := x - mean
+  //   mean := mean + delta / count
+  //   m2 := m2 + delta * (x - mean)
+  // All lanes see the same number of elements, so the reciprocal of the element count is shared between them.
+  __m512 vmean0 = _mm512_setzero_ps();
+  __m512 vmean1 = _mm512_setzero_ps();
+  __m512 vmean2 = _mm512_setzero_ps();
+  __m512 vmean3 = _mm512_setzero_ps();
+  __m512 vm2_0 = _mm512_setzero_ps();
+  __m512 vm2_1 = _mm512_setzero_ps();
+  __m512 vm2_2 = _mm512_setzero_ps();
+  __m512 vm2_3 = _mm512_setzero_ps();
+  float vcount = 0.0f;
+  for (; n >= 64 * sizeof(float); n -= 64 * sizeof(float)) {
+    const __m512 vx0 = _mm512_loadu_ps(x);
+    const __m512 vx1 = _mm512_loadu_ps(x + 16);
+    const __m512 vx2 = _mm512_loadu_ps(x + 32);
+    const __m512 vx3 = _mm512_loadu_ps(x + 48);
+    x += 64;
+
+    vcount += 1.0f;
+    const __m512 vrcp_count = _mm512_set1_ps(1.0f / vcount);
+
+    const __m512 vdelta0 = _mm512_sub_ps(vx0, vmean0);
+    const __m512 vdelta1 = _mm512_sub_ps(vx1, vmean1);
+    const __m512 vdelta2 = _mm512_sub_ps(vx2, vmean2);
+    const __m512 vdelta3 = _mm512_sub_ps(vx3, vmean3);
+
+    vmean0 = _mm512_fmadd_ps(vdelta0, vrcp_count, vmean0);
+    vmean1 = _mm512_fmadd_ps(vdelta1, vrcp_count, vmean1);
+    vmean2 = _mm512_fmadd_ps(vdelta2, vrcp_count, vmean2);
+    vmean3 = _mm512_fmadd_ps(vdelta3, vrcp_count, vmean3);
+
+    vm2_0 = _mm512_fmadd_ps(vdelta0, _mm512_sub_ps(vx0, vmean0), vm2_0);
+    vm2_1 = _mm512_fmadd_ps(vdelta1, _mm512_sub_ps(vx1, vmean1), vm2_1);
+    vm2_2 = _mm512_fmadd_ps(vdelta2, _mm512_sub_ps(vx2, vmean2), vm2_2);
+    vm2_3 = _mm512_fmadd_ps(vdelta3, _mm512_sub_ps(vx3, vmean3), vm2_3);
+  }
+
+  // Merge pairs of accumulators with equal element counts (Chan et al.):
+  //   mean := (mean_a + mean_b) / 2
+  //   m2 := m2_a + m2_b + (mean_b - mean_a)**2 * count / 2
+  const __m512 vhalf = _mm512_set1_ps(0.5f);
+  __m512 vhalf_count = _mm512_set1_ps(vcount * 0.5f);
+  const __m512 vdelta01 = _mm512_sub_ps(vmean1, vmean0);
+  const __m512 vdelta23 = _mm512_sub_ps(vmean3, vmean2);
+  const __m512 vmean01 = _mm512_fmadd_ps(vdelta01, vhalf, vmean0);
+  const __m512 vmean23 = _mm512_fmadd_ps(vdelta23, vhalf, vmean2);
+  const __m512 vm2_01 = _mm512_fmadd_ps(_mm512_mul_ps(vdelta01, vdelta01), vhalf_count, _mm512_add_ps(vm2_0, vm2_1));
+  const __m512 vm2_23 = _mm512_fmadd_ps(_mm512_mul_ps(vdelta23, vdelta23), vhalf_count, _mm512_add_ps(vm2_2, vm2_3));
+  vcount += vcount;
+
+  vhalf_count = _mm512_set1_ps(vcount * 0.5f);
+  const __m512 vdelta0123 = _mm512_sub_ps(vmean23, vmean01);
+  __m512 vmean = _mm512_fmadd_ps(vdelta0123, vhalf, vmean01);
+  __m512 vm2 = _mm512_fmadd_ps(_mm512_mul_ps(vdelta0123, vdelta0123), vhalf_count, _mm512_add_ps(vm2_01, vm2_23));
+  vcount += vcount;
+
+  for (; n >= 16 * sizeof(float); n -= 16 * sizeof(float)) {
+    const __m512 vx = _mm512_loadu_ps(x);
+    x += 16;
+
+    vcount += 1.0f;
+    const __m512 vrcp_count = _mm512_set1_ps(1.0f / vcount);
+
+    const __m512 vdelta = _mm512_sub_ps(vx, vmean);
+    vmean = _mm512_fmadd_ps(vdelta, vrcp_count, vmean);
+    vm2 = _mm512_fmadd_ps(vdelta, _mm512_sub_ps(vx, vmean), vm2);
+  }
+
+  // Merge the lanes of the accumulator.
+  const __m256 vhalf_lo = _mm512_castps512_ps256(vhalf);
+  const __m256 vhalf_count_lo = _mm256_set1_ps(vcount * 0.5f);
+  __m256 vmean_lo = _mm512_castps512_ps256(vmean);
+  __m256 vm2_lo = _mm512_castps512_ps256(vm2);
+  const __m256 vdelta_hi = _mm256_sub_ps(_mm512_castps512_ps256(_mm512_shuffle_f32x4(vmean, vmean, _MM_SHUFFLE(3, 2, 3, 2))), vmean_lo);
+  vmean_lo = _mm256_add_ps(vmean_lo, _mm256_mul_ps(vdelta_hi, vhalf_lo));
+  vm2_lo = _mm256_add_ps(_mm256_add_ps(vm2_lo, _mm512_castps512_ps256(_mm512_shuffle_f32x4(vm2, vm2, _MM_SHUFFLE(3, 2, 3, 2)))),
+    _mm256_mul_ps(_mm256_mul_ps(vdelta_hi, vdelta_hi), vhalf_count_lo));
+  vcount += vcount;
+
+  const __m128 vhalf_ll = _mm256_castps256_ps128(vhalf_lo);
+  __m128 vhalf_count_ll = _mm_set1_ps(vcount * 0.5f);
+  __m128 vmean_ll = _mm256_castps256_ps128(vmean_lo);
+  __m128 vm2_ll = _mm256_castps256_ps128(vm2_lo);
+  const __m128 vdelta_lh = _mm_sub_ps(_mm256_extractf128_ps(vmean_lo, 1), vmean_ll);
+  vmean_ll = _mm_add_ps(vmean_ll, _mm_mul_ps(vdelta_lh, vhalf_ll));
+  vm2_ll = _mm_add_ps(_mm_add_ps(vm2_ll, _mm256_extractf128_ps(vm2_lo, 1)), _mm_mul_ps(_mm_mul_ps(vdelta_lh, vdelta_lh), vhalf_count_ll));
+  vcount += vcount;
+
+  vhalf_count_ll = _mm_set1_ps(vcount * 0.5f);
+  const __m128 vdelta_llh = _mm_sub_ps(_mm_movehl_ps(vmean_ll, vmean_ll), vmean_ll);
+  vmean_ll = _mm_add_ps(vmean_ll, _mm_mul_ps(vdelta_llh, vhalf_ll));
+  vm2_ll = _mm_add_ps(_mm_add_ps(vm2_ll, _mm_movehl_ps(vm2_ll, vm2_ll)), _mm_mul_ps(_mm_mul_ps(vdelta_llh, vdelta_llh), vhalf_count_ll));
+  vcount += vcount;
+
+  vhalf_count_ll = _mm_set_ss(vcount * 0.5f);
+  const __m128 vdelta_odd = _mm_sub_ss(_mm_movehdup_ps(vmean_ll), vmean_ll);
+  vmean_ll = _mm_add_ss(vmean_ll, _mm_mul_ss(vdelta_odd, vhalf_ll));
+  vm2_ll = _mm_add_ss(_mm_add_ss(vm2_ll, _mm_movehdup_ps(vm2_ll)), _mm_mul_ss(_mm_mul_ss(vdelta_odd, vdelta_odd), vhalf_count_ll));
+  vcount += vcount;
+
+  float vmean_lll = _mm_cvtss_f32(vmean_ll);
+  float vm2_lll = _mm_cvtss_f32(vm2_ll);
+  if XNN_UNLIKELY(n != 0) {
+    do {
+      const float vx = *x++;
+      vcount += 1.0f;
+      const float vdelta = vx - vmean_lll;
+      vmean_lll += vdelta / vcount;
+      vm2_lll += vdelta * (vx - vmean_lll);
+      n -= sizeof(float);
+    } while (n != 0);
+  }
+  *mean = vmean_lll;
+  *variance = vm2_lll / vcount;
+}
+
+void xnn_f32_spmm_minmax_ukernel_32x1__avx512f(
+    size_t mc,
+    size_t nc,
+    const float*restrict input,
+    const float*restrict weights,
+    const int32_t*restrict widx_dmap,
+    const uint32_t*restrict nidx_nnzmap,
+    float*restrict output,
+    size_t output_stride,
+    const union xnn_f32_minmax_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(mc != 0);
+  assert(mc % sizeof(float) == 0);
+  assert(nc != 0);
+
+  const __m512 vmin = _mm512_set1_ps(params->sse.min[0]);
+  const __m512 vmax = _mm512_set1_ps(params->sse.max[0]);
+  size_t output_decrement = output_stride * nc - 32 * sizeof(float);
+  while XNN_LIKELY(mc >= 32 * sizeof(float)) {
+    const float*restrict w = weights;
+    const int32_t* dmap = widx_dmap;
+    const uint32_t* nnzmap = nidx_nnzmap;
+    size_t n = nc;
+    do {
+      uint32_t nnz = *nnzmap++;
+      __m512 vacc0123456789ABCDEF = _mm512_set1_ps(*w); w += 1;
+      __m512 vaccGHIJKLMNOPQRSTUV = vacc0123456789ABCDEF;
+      if XNN_LIKELY(nnz != 0) {
+        do {
+          const intptr_t diff = *dmap++;
+          const __m512 vi0123456789ABCDEF = _mm512_loadu_ps(input);
+          const __m512 viGHIJKLMNOPQRSTUV = _mm512_loadu_ps(input + 16);
+          input = (const float*restrict) ((uintptr_t) input + (uintptr_t) diff);
+          const __m512 vw = _mm512_set1_ps(*w); w += 1;
+          vacc0123456789ABCDEF = _mm512_fmadd_ps(vi0123456789ABCDEF, vw, vacc0123456789ABCDEF);
+          vaccGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(viGHIJKLMNOPQRSTUV, vw, vaccGHIJKLMNOPQRSTUV);
+        } while (--nnz != 0);
+      }
+      __m512 vout0123456789ABCDEF = _mm512_min_ps(vacc0123456789ABCDEF, vmax);
+      __m512 voutGHIJKLMNOPQRSTUV = _mm512_min_ps(vaccGHIJKLMNOPQRSTUV, vmax);
+      vout0123456789ABCDEF = _mm512_max_ps(vout0123456789ABCDEF, vmin);
+      voutGHIJKLMNOPQRSTUV = _mm512_max_ps(voutGHIJKLMNOPQRSTUV, vmin);
+      _mm512_storeu_ps(output, vout0123456789ABCDEF);
+      _mm512_storeu_ps(output + 16, voutGHIJKLMNOPQRSTUV);
+      output = (float*restrict) ((uintptr_t) output + output_stride);
+    } while (--n != 0);
+    output = (float*restrict) ((uintptr_t) output - output_decrement);
+    input += 32;
+    mc -= 32 * sizeof(float);
+  }
+  if XNN_UNLIKELY(mc != 0) {
+    output_decrement += 16 * sizeof(float);
+    if (mc & (16 * sizeof(float))) {
+      const float*restrict w = weights;
+      const int32_t* dmap = widx_dmap;
+      const uint32_t* nnzmap = nidx_nnzmap;
+      size_t n = nc;
+      do {
+        uint32_t nnz = *nnzmap++;
+        __m512 vacc0123456789ABCDEF = _mm512_set1_ps(*w); w += 1;
+        if XNN_LIKELY(nnz != 0) {
+          do {
+            const intptr_t diff = *dmap++;
+            const __m512 vi0123456789ABCDEF = _mm512_loadu_ps(input);
+            input = (const float*restrict) ((uintptr_t) input + (uintptr_t) diff);
+            const __m512 vw = _mm512_set1_ps(*w); w += 1;
+            vacc0123456789ABCDEF = _mm512_fmadd_ps(vi0123456789ABCDEF, vw, vacc0123456789ABCDEF);
+          } while (--nnz != 0);
+        }
+        __m512 vout0123456789ABCDEF = _mm512_min_ps(vacc0123456789ABCDEF, vmax);
+        vout0123456789ABCDEF = _mm512_max_ps(vout0123456789ABCDEF, vmin);
+        _mm512_storeu_ps(output, vout0123456789ABCDEF);
+        output = (float*restrict) ((uintptr_t) output + output_stride);
+      } while (--n != 0);
+      output = (float*restrict) ((uintptr_t) output - output_decrement);
+      input += 16;
+    }
+    output_decrement += 8 * sizeof(float);
+    if (mc & (8 * sizeof(float))) {
+      const __mmask16 vmask = _cvtu32_mask16(UINT32_C(0xff));
+      const float*restrict w = weights;
+      const int32_t* dmap = widx_dmap;
+      const uint32_t* nnzmap = nidx_nnzmap;
+      size_t n = nc;
+      do {
+        uint32_t nnz = *nnzmap++;
+        __m512 vacc01234567 = _mm512_set1_ps(*w); w += 1;
+        if XNN_LIKELY(nnz != 0) {
+          do {
+            const intptr_t diff = *dmap++;
+            const __m512 vi01234567 = _mm512_maskz_loadu_ps(vmask, input);
+            input = (const float*restrict) ((uintptr_t) input + (uintptr_t) diff);
+            const __m512 vw = _mm512_set1_ps(*w); w += 1;
+            vacc01234567 = _mm512_fmadd_ps(vi01234567, vw, vacc01234567);
+          } while (--nnz != 0);
+        }
+        __m512 vout01234567 = _mm512_min_ps(vacc01234567, vmax);
+        vout01234567 = _mm512_max_ps(vout01234567, vmin);
+        _mm512_mask_storeu_ps(output, vmask, vout01234567);
+        output = (float*restrict) ((uintptr_t) output + output_stride);
+      } while (--n != 0);
+      output = (float*restrict) ((uintptr_t) output - output_decrement);
+      input += 8;
+    }
+    output_decrement += 4 * sizeof(float);
+    if (mc & (4 * sizeof(float))) {
+      const __mmask16 vmask = _cvtu32_mask16(UINT32_C(0xf));
+      const float*restrict w = weights;
+      const int32_t* dmap = widx_dmap;
+      const uint32_t* nnzmap = nidx_nnzmap;
+      size_t n = nc;
+      do {
+        uint32_t nnz = *nnzmap++;
+        __m512 vacc0123 = _mm512_set1_ps(*w); w += 1;
+        if XNN_LIKELY(nnz != 0) {
+          do {
+            const intptr_t diff = *dmap++;
+            const __m512 vi0123 = _mm512_maskz_loadu_ps(vmask, input);
+            input = (const float*restrict) ((uintptr_t) input + (uintptr_t) diff);
+            const __m512 vw = _mm512_set1_ps(*w); w += 1;
+            vacc0123 = _mm512_fmadd_ps(vi0123, vw, vacc0123);
+          } while (--nnz != 0);
+        }
+        __m512 vout0123 = _mm512_min_ps(vacc0123, vmax);
+        vout0123 = _mm512_max_ps(vout0123, vmin);
+        _mm512_mask_storeu_ps(output, vmask, vout0123);
+        output = (float*restrict) ((uintptr_t) output + output_stride);
+      } while (--n != 0);
+      output = (float*restrict) ((uintptr_t) output - output_decrement);
+      input += 4;
+    }
+    output_decrement += 2 * sizeof(float);
+    if (mc & (2 * sizeof(float))) {
+      const __mmask16 vmask = _cvtu32_mask16(UINT32_C(0x3));
+      const float*restrict w = weights;
+      const int32_t* dmap = widx_dmap;
+      const uint32_t* nnzmap = nidx_nnzmap;
+      size_t n = nc;
+      do {
+        uint32_t nnz = *nnzmap++;
+        __m512 vacc01 = _mm512_set1_ps(*w); w += 1;
+        if XNN_LIKELY(nnz != 0) {
+          do {
+            const intptr_t diff = *dmap++;
+            const __m512 vi01 = _mm512_maskz_loadu_ps(vmask, input);
+            input = (const float*restrict) ((uintptr_t) input + (uintptr_t) diff);
+            const __m512 vw = _mm512_set1_ps(*w); w += 1;
+            vacc01 = _mm512_fmadd_ps(vi01, vw, vacc01);
+          } while (--nnz != 0);
+        }
+        __m512 vout01 = _mm512_min_ps(vacc01, vmax);
+        vout01 = _mm512_max_ps(vout01, vmin);
+        _mm512_mask_storeu_ps(output, vmask, vout01);
+        output = (float*restrict) ((uintptr_t) output + output_stride);
+      } while (--n != 0);
+      output = (float*restrict) ((uintptr_t) output - output_decrement);
+      input += 2;
+    }
+    output_decrement += 1 * sizeof(float);
+    if (mc & (1 * sizeof(float))) {
+      const __mmask16 vmask = _cvtu32_mask16(UINT32_C(0x1));
+      const float*restrict w = weights;
+      const int32_t* dmap = widx_dmap;
+      const uint32_t* nnzmap = nidx_nnzmap;
+      size_t n = nc;
+      do {
+        uint32_t nnz = *nnzmap++;
+        __m512 vacc0 = _mm512_set1_ps(*w); w += 1;
+        if XNN_LIKELY(nnz != 0) {
+          do {
+            const intptr_t diff = *dmap++;
+            const __m512 vi0 = _mm512_maskz_loadu_ps(vmask, input);
+            input = (const float*restrict) ((uintptr_t) input + (uintptr_t) diff);
+            const __m512 vw = _mm512_set1_ps(*w); w += 1;
+            vacc0 = _mm512_fmadd_ps(vi0, vw, vacc0);
+          } while (--nnz != 0);
+        }
+        __m512 vout0 = _mm512_min_ps(vacc0, vmax);
+        vout0 = _mm512_max_ps(vout0, vmin);
+        _mm512_mask_storeu_ps(output, vmask, vout0);
+        output = (float*restrict) ((uintptr_t) output + output_stride);
+      } while (--n != 0);
+      output = (float*restrict) ((uintptr_t) output - output_decrement);
+      input += 1;
+    }
+  }
+}
+
+void xnn_f32_spmm_minmax_ukernel_32x2__avx512f(
+    size_t mc,
+    size_t nc,
+    const float*restrict input,
+    const float*restrict weights,
+    const int32_t*restrict widx_dmap,
+    const uint32_t*restrict nidx_nnzmap,
+    float*restrict output,
+    size_t output_stride,
+    const union xnn_f32_minmax_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(mc != 0);
+  assert(mc % sizeof(float) == 0);
+  assert(nc != 0);
+
+  const __m512 vmin = _mm512_set1_ps(params->sse.min[0]);
+  const __m512 vmax = _mm512_set1_ps(params->sse.max[0]);
+  size_t output_decrement = output_stride * nc - 32 * sizeof(float);
+  while XNN_LIKELY(mc >= 32 * sizeof(float)) {
+    const float*restrict w = weights;
+    const int32_t* dmap = widx_dmap;
+    const uint32_t* nnzmap = nidx_nnzmap;
+    size_t n = nc;
+    while (n >= 2) {
+      uint32_t nnz = *nnzmap++;
+      __m512 vacc0123456789ABCDEFn0 = _mm512_set1_ps(*w); w += 1;
+      __m512 vaccGHIJKLMNOPQRSTUVn0 = vacc0123456789ABCDEFn0;
+      __m512 vacc0123456789ABCDEFn1 = _mm512_set1_ps(*w); w += 1;
+      __m512 vaccGHIJKLMNOPQRSTUVn1 = vacc0123456789ABCDEFn1;
+      if XNN_LIKELY(nnz != 0) {
+        do {
+          const intptr_t diff = *dmap++;
+          const __m512 vi0123456789ABCDEF = _mm512_loadu_ps(input);
+          const __m512 viGHIJKLMNOPQRSTUV = _mm512_loadu_ps(input + 16);
+          input = (const float*restrict) ((uintptr_t) input + (uintptr_t) diff);
+          const __m512 vw0 = _mm512_set1_ps(w[0]);
+          const __m512 vw1 = _mm512_set1_ps(w[1]);
+          w += 2;
+          vacc0123456789ABCDEFn0 = _mm512_fmadd_ps(vi0123456789ABCDEF, vw0, vacc0123456789ABCDEFn0);
+          vaccGHIJKLMNOPQRSTUVn0 = _mm512_fmadd_ps(viGHIJKLMNOPQRSTUV, vw0, vaccGHIJKLMNOPQRSTUVn0);
+          vacc0123456789ABCDEFn1 = _mm512_fmadd_ps(vi0123456789ABCDEF, vw1, vacc0123456789ABCDEFn1);
+          vaccGHIJKLMNOPQRSTUVn1 = _mm512_fmadd_ps(viGHIJKLMNOPQRSTUV, vw1, vaccGHIJKLMNOPQRSTUVn1);
+        } while (--nnz != 0);
+      }
+      __m512 vout0123456789ABCDEFn0 = _mm512_min_ps(vacc0123456789ABCDEFn0, vmax);
+      __m512 voutGHIJKLMNOPQRSTUVn0 = _mm512_min_ps(vaccGHIJKLMNOPQRSTUVn0, vmax);
+      __m512 vout0123456789ABCDEFn1 = _mm512_min_ps(vacc0123456789ABCDEFn1, vmax);
+      __m512 voutGHIJKLMNOPQRSTUVn1 = _mm512_min_ps(vaccGHIJKLMNOPQRSTUVn1, vmax);
+      vout0123456789ABCDEFn0 = _mm512_max_ps(vout0123456789ABCDEFn0, vmin);
+      voutGHIJKLMNOPQRSTUVn0 = _mm512_max_ps(voutGHIJKLMNOPQRSTUVn0, vmin);
+      vout0123456789ABCDEFn1 = _mm512_max_ps(vout0123456789ABCDEFn1, vmin);
+      voutGHIJKLMNOPQRSTUVn1 = _mm512_max_ps(voutGHIJKLMNOPQRSTUVn1, vmin);
+      _mm512_storeu_ps(output, vout0123456789ABCDEFn0);
+      _mm512_storeu_ps(output + 16, voutGHIJKLMNOPQRSTUVn0);
+      output = (float*restrict) ((uintptr_t) output + output_stride);
+      _mm512_storeu_ps(output, vout0123456789ABCDEFn1);
+      _mm512_storeu_ps(output + 16, voutGHIJKLMNOPQRSTUVn1);
+      output = (float*restrict) ((uintptr_t) output + output_stride);
+      n -= 2;
+    }
+
+    // clean up loop, fall back to nr=1
+    while XNN_UNLIKELY(n != 0) {
+      uint32_t nnz = *nnzmap++;
+      __m512 vacc0123456789ABCDEF = _mm512_set1_ps(*w); w += 1;
+      __m512 vaccGHIJKLMNOPQRSTUV = vacc0123456789ABCDEF;
+      if XNN_LIKELY(nnz != 0) {
+        do {
+          const intptr_t diff = *dmap++;
+          const __m512 vi0123456789ABCDEF = _mm512_loadu_ps(input);
+          const __m512 viGHIJKLMNOPQRSTUV = _mm512_loadu_ps(input + 16);
+          input = (const float*restrict) ((uintptr_t) input + (uintptr_t) diff);
+          const __m512 vw = _mm512_set1_ps(*w); w += 1;
+          vacc0123456789ABCDEF = _mm512_fmadd_ps(vi0123456789ABCDEF, vw, vacc0123456789ABCDEF);
+          vaccGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(viGHIJKLMNOPQRSTUV, vw, vaccGHIJKLMNOPQRSTUV);
+        } while (--nnz != 0);
+      }
+      __m512 vout0123456789ABCDEF = _mm512_min_ps(vacc0123456789ABCDEF, vmax);
+      __m512 voutGHIJKLMNOPQRSTUV = _mm512_min_ps(vaccGHIJKLMNOPQRSTUV, vmax);
+      vout0123456789ABCDEF = _mm512_max_ps(vout0123456789ABCDEF, vmin);
+      voutGHIJKLMNOPQRSTUV = _mm512_max_ps(voutGHIJKLMNOPQRSTUV, vmin);
+      _mm512_storeu_ps(output, vout0123456789ABCDEF);
+      _mm512_storeu_ps(output + 16, voutGHIJKLMNOPQRSTUV);
+      output = (float*restrict) ((uintptr_t) output + output_stride);
+      n -= 1;
+    }
+    output = (float*restrict) ((uintptr_t) output - output_decrement);
+    input += 32;
+    mc -= 32 * sizeof(float);
+  }
+  if XNN_UNLIKELY(mc != 0) {
+    output_decrement += 16 * sizeof(float);
+    if (mc & (16 * sizeof(float))) {
+      const float*restrict w = weights;
+      const int32_t* dmap = widx_dmap;
+      const uint32_t* nnzmap = nidx_nnzmap;
+      size_t n = nc;
+      while (n >= 2) {
+        uint32_t nnz = *nnzmap++;
+        __m512 vacc0123456789ABCDEFn0 = _mm512_set1_ps(*w); w += 1;
+        __m512 vacc0123456789ABCDEFn1 = _mm512_set1_ps(*w); w += 1;
+        if XNN_LIKELY(nnz != 0) {
+          do {
+            const intptr_t diff = *dmap++;
+            const __m512 vi0123456789ABCDEF = _mm512_loadu_ps(input);
+            input = (const float*restrict) ((uintptr_t) input + (uintptr_t) diff);
+            const __m512 vw0 = _mm512_set1_ps(w[0]);
+            const __m512 vw1 = _mm512_set1_ps(w[1]);
+            w += 2;
+            vacc0123456789ABCDEFn0 = _mm512_fmadd_ps(vi0123456789ABCDEF, vw0, vacc0123456789ABCDEFn0);
+            vacc0123456789ABCDEFn1 = _mm512_fmadd_ps(vi0123456789ABCDEF, vw1, vacc0123456789ABCDEFn1);
+          } while (--nnz != 0);
+        }
+        __m512 vout0123456789ABCDEFn0 = _mm512_min_ps(vacc0123456789ABCDEFn0, vmax);
+        __m512 vout0123456789ABCDEFn1 = _mm512_min_ps(vacc0123456789ABCDEFn1, vmax);
+        vout0123456789ABCDEFn0 = _mm512_max_ps(vout0123456789ABCDEFn0, vmin);
+        vout0123456789ABCDEFn1 = _mm512_max_ps(vout0123456789ABCDEFn1, vmin);
+        _mm512_storeu_ps(output, vout0123456789ABCDEFn0);
+        output = (float*restrict) ((uintptr_t) output + output_stride);
+        _mm512_storeu_ps(output, vout0123456789ABCDEFn1);
+        output = (float*restrict) ((uintptr_t) output + output_stride);
+        n -= 2;
+      }
+
+      // clean up loop, fall back to nr=1
+      while XNN_UNLIKELY(n != 0) {
+        uint32_t nnz = *nnzmap++;
+        __m512 vacc0123456789ABCDEF = _mm512_set1_ps(*w); w += 1;
+        if XNN_LIKELY(nnz != 0) {
+          do {
+            const intptr_t diff = *dmap++;
+            const __m512 vi0123456789ABCDEF = _mm512_loadu_ps(input);
+            input = (const float*restrict) ((uintptr_t) input + (uintptr_t) diff);
+            const __m512 vw = _mm512_set1_ps(*w); w += 1;
+            vacc0123456789ABCDEF = _mm512_fmadd_ps(vi0123456789ABCDEF, vw, vacc0123456789ABCDEF);
+          } while (--nnz != 0);
+        }
+        __m512 vout0123456789ABCDEF = _mm512_min_ps(vacc0123456789ABCDEF, vmax);
+        vout0123456789ABCDEF = _mm512_max_ps(vout0123456789ABCDEF, vmin);
+        _mm512_storeu_ps(output, vout0123456789ABCDEF);
+        output = (float*restrict) ((uintptr_t) output + output_stride);
+        n -= 1;
+      }
+      output = (float*restrict) ((uintptr_t) output - output_decrement);
+      input += 16;
+    }
+    output_decrement += 8 * sizeof(float);
+    if (mc & (8 * sizeof(float))) {
+      const __mmask16 vmask = _cvtu32_mask16(UINT32_C(0xff));
+      const float*restrict w = weights;
+      const int32_t* dmap = widx_dmap;
+      const uint32_t* nnzmap = nidx_nnzmap;
+      size_t n = nc;
+      while (n >= 2) {
+        uint32_t nnz = *nnzmap++;
+        __m512 vacc01234567n0 = _mm512_set1_ps(*w); w += 1;
+        __m512 vacc01234567n1 = _mm512_set1_ps(*w); w += 1;
+        if XNN_LIKELY(nnz != 0) {
+          do {
+            const intptr_t diff = *dmap++;
+            const __m512 vi01234567 = _mm512_maskz_loadu_ps(vmask, input);
+            input = (const float*restrict) ((uintptr_t) input + (uintptr_t) diff);
+            const __m512 vw0 = _mm512_set1_ps(w[0]);
+            const __m512 vw1 = _mm512_set1_ps(w[1]);
+            w += 2;
+            vacc01234567n0 = _mm512_fmadd_ps(vi01234567, vw0, vacc01234567n0);
+            vacc01234567n1 = _mm512_fmadd_ps(vi01234567, vw1, vacc01234567n1);
+          } while (--nnz != 0);
+        }
+        __m512 vout01234567n0 = _mm512_min_ps(vacc01234567n0, vmax);
+        __m512 vout01234567n1 = _mm512_min_ps(vacc01234567n1, vmax);
+        vout01234567n0 = _mm512_max_ps(vout01234567n0, vmin);
+        vout01234567n1 = _mm512_max_ps(vout01234567n1, vmin);
+        _mm512_mask_storeu_ps(output, vmask, vout01234567n0);
+        output = (float*restrict) ((uintptr_t) output + output_stride);
+        _mm512_mask_storeu_ps(output, vmask, vout01234567n1);
+        output = (float*restrict) ((uintptr_t) output + output_stride);
+        n -= 2;
+      }
+
+      // clean up loop, fall back to nr=1
+      while XNN_UNLIKELY(n != 0) {
+        uint32_t nnz = *nnzmap++;
+        __m512 vacc01234567 = _mm512_set1_ps(*w); w += 1;
+        if XNN_LIKELY(nnz != 0) {
+          do {
+            const intptr_t diff = *dmap++;
+            const __m512 vi01234567 = _mm512_maskz_loadu_ps(vmask, input);
+            input = (const float*restrict) ((uintptr_t) input + (uintptr_t) diff);
+            const __m512 vw = _mm512_set1_ps(*w); w += 1;
+            vacc01234567 = _mm512_fmadd_ps(vi01234567, vw, vacc01234567);
+          } while (--nnz != 0);
+        }
+        __m512 vout01234567 = _mm512_min_ps(vacc01234567, vmax);
+        vout01234567 = _mm512_max_ps(vout01234567, vmin);
+        _mm512_mask_storeu_ps(output, vmask, vout01234567);
+        output = (float*restrict) ((uintptr_t) output + output_stride);
+        n -= 1;
+      }
+      output = (float*restrict) ((uintptr_t) output - output_decrement);
+      input += 8;
+    }
+    output_decrement += 4 * sizeof(float);
+    if (mc & (4 * sizeof(float))) {
+      const __mmask16 vmask = _cvtu32_mask16(UINT32_C(0xf));
+      const float*restrict w = weights;
+      const int32_t* dmap = widx_dmap;
+      const uint32_t* nnzmap = nidx_nnzmap;
+      size_t n = nc;
+      while (n >= 2) {
+        uint32_t nnz = *nnzmap++;
+        __m512 vacc0123n0 = _mm512_set1_ps(*w); w += 1;
+        __m512 vacc0123n1 = _mm512_set1_ps(*w); w += 1;
+        if XNN_LIKELY(nnz != 0) {
+          do {
+            const intptr_t diff = *dmap++;
+            const __m512 vi0123 = _mm512_maskz_loadu_ps(vmask, input);
+            input = (const float*restrict) ((uintptr_t) input + (uintptr_t) diff);
+            const __m512 vw0 = _mm512_set1_ps(w[0]);
+            const __m512 vw1 = _mm512_set1_ps(w[1]);
+            w += 2;
+            vacc0123n0 = _mm512_fmadd_ps(vi0123, vw0, vacc0123n0);
+            vacc0123n1 = _mm512_fmadd_ps(vi0123, vw1, vacc0123n1);
+          } while (--nnz != 0);
+        }
+        __m512 vout0123n0 = _mm512_min_ps(vacc0123n0, vmax);
+        __m512 vout0123n1 = _mm512_min_ps(vacc0123n1, vmax);
+        vout0123n0 = _mm512_max_ps(vout0123n0, vmin);
+        vout0123n1 = _mm512_max_ps(vout0123n1, vmin);
+        _mm512_mask_storeu_ps(output, vmask, vout0123n0);
+        output = (float*restrict) ((uintptr_t) output + output_stride);
+        _mm512_mask_storeu_ps(output, vmask, vout0123n1);
+        output = (float*restrict) ((uintptr_t) output + output_stride);
+        n -= 2;
+      }
+
+      // clean up loop, fall back to nr=1
+      while XNN_UNLIKELY(n != 0) {
+        uint32_t nnz = *nnzmap++;
+        __m512 vacc0123 = _mm512_set1_ps(*w); w += 1;
+        if XNN_LIKELY(nnz != 0) {
+          do {
+            const intptr_t diff = *dmap++;
+            const __m512 vi0123 = _mm512_maskz_loadu_ps(vmask, input);
+            input = (const float*restrict) ((uintptr_t) input + (uintptr_t) diff);
+            const __m512 vw = _mm512_set1_ps(*w); w += 1;
+            vacc0123 = _mm512_fmadd_ps(vi0123, vw, vacc0123);
+          } while (--nnz != 0);
+        }
+        __m512 vout0123 = _mm512_min_ps(vacc0123, vmax);
+        vout0123 = _mm512_max_ps(vout0123, vmin);
+        _mm512_mask_storeu_ps(output, vmask, vout0123);
+        output = (float*restrict) ((uintptr_t) output + output_stride);
+        n -= 1;
+      }
+      output = (float*restrict) ((uintptr_t) output - output_decrement);
+      input += 4;
+    }
+    output_decrement += 2 * sizeof(float);
+    if (mc & (2 * sizeof(float))) {
+      const __mmask16 vmask = _cvtu32_mask16(UINT32_C(0x3));
+      const float*restrict w = weights;
+      const int32_t* dmap = widx_dmap;
+      const uint32_t* nnzmap = nidx_nnzmap;
+      size_t n = nc;
+      while (n >= 2) {
+        uint32_t nnz = *nnzmap++;
+        __m512 vacc01n0 = _mm512_set1_ps(*w); w += 1;
+        __m512 vacc01n1 = _mm512_set1_ps(*w); w += 1;
+        if XNN_LIKELY(nnz != 0) {
+          do {
+            const intptr_t diff = *dmap++;
+            const __m512 vi01 = _mm512_maskz_loadu_ps(vmask, input);
+            input = (const float*restrict) ((uintptr_t) input + (uintptr_t) diff);
+            const __m512 vw0 = _mm512_set1_ps(w[0]);
+            const __m512 vw1 = _mm512_set1_ps(w[1]);
+            w += 2;
+            vacc01n0 = _mm512_fmadd_ps(vi01, vw0, vacc01n0);
+            vacc01n1 = _mm512_fmadd_ps(vi01, vw1, vacc01n1);
+          } while (--nnz != 0);
+        }
+        __m512 vout01n0 = _mm512_min_ps(vacc01n0, vmax);
+        __m512 vout01n1 = _mm512_min_ps(vacc01n1, vmax);
+        vout01n0 = _mm512_max_ps(vout01n0, vmin);
+        vout01n1 = _mm512_max_ps(vout01n1, vmin);
+        _mm512_mask_storeu_ps(output, vmask, vout01n0);
+        output = (float*restrict) ((uintptr_t) output + output_stride);
+        _mm512_mask_storeu_ps(output, vmask, vout01n1);
+        output = (float*restrict) ((uintptr_t) output + output_stride);
+        n -= 2;
+      }
+
+      // clean up loop, fall back to nr=1
+      while XNN_UNLIKELY(n != 0) {
+        uint32_t nnz = *nnzmap++;
+        __m512 vacc01 = _mm512_set1_ps(*w); w += 1;
+        if XNN_LIKELY(nnz != 0) {
+          do {
+            const intptr_t diff = *dmap++;
+            const __m512 vi01 = _mm512_maskz_loadu_ps(vmask, input);
+            input = (const float*restrict) ((uintptr_t) input + (uintptr_t) diff);
+            const __m512 vw = _mm512_set1_ps(*w); w += 1;
+            vacc01 = _mm512_fmadd_ps(vi01, vw, vacc01);
+          } while (--nnz != 0);
+        }
+        __m512 vout01 = _mm512_min_ps(vacc01, vmax);
+        vout01 = _mm512_max_ps(vout01, vmin);
+        _mm512_mask_storeu_ps(output, vmask, vout01);
+        output = (float*restrict) ((uintptr_t) output + output_stride);
+        n -= 1;
+      }
+      output = (float*restrict) ((uintptr_t) output - output_decrement);
+      input += 2;
+    }
+    output_decrement += 1 * sizeof(float);
+    if (mc & (1 * sizeof(float))) {
+      const __mmask16 vmask = _cvtu32_mask16(UINT32_C(0x1));
+      const float*restrict w = weights;
+      const int32_t* dmap = widx_dmap;
+      const uint32_t* nnzmap = nidx_nnzmap;
+      size_t n = nc;
+      while (n >= 2) {
+        uint32_t nnz = *nnzmap++;
+        __m512 vacc0n0 = _mm512_set1_ps(*w); w += 1;
+        __m512 vacc0n1 = _mm512_set1_ps(*w); w += 1;
+        if XNN_LIKELY(nnz != 0) {
+          do {
+            const intptr_t diff = *dmap++;
+            const __m512 vi0 = _mm512_maskz_loadu_ps(vmask, input);
+            input = (const float*restrict) ((uintptr_t) input + (uintptr_t) diff);
+            const __m512 vw0 = _mm512_set1_ps(w[0]);
+            const __m512 vw1 = _mm512_set1_ps(w[1]);
+            w += 2;
+            vacc0n0 = _mm512_fmadd_ps(vi0, vw0, vacc0n0);
+            vacc0n1 = _mm512_fmadd_ps(vi0, vw1, vacc0n1);
+          } while (--nnz != 0);
+        }
+        __m512 vout0n0 = _mm512_min_ps(vacc0n0, vmax);
+        __m512 vout0n1 = _mm512_min_ps(vacc0n1, vmax);
+        vout0n0 = _mm512_max_ps(vout0n0, vmin);
+        vout0n1 = _mm512_max_ps(vout0n1, vmin);
+        _mm512_mask_storeu_ps(output, vmask, vout0n0);
+        output = (float*restrict) ((uintptr_t) output + output_stride);
+        _mm512_mask_storeu_ps(output, vmask, vout0n1);
+        output = (float*restrict) ((uintptr_t) output + output_stride);
+        n -= 2;
+      }
+
+      // clean up loop, fall back to nr=1
+      while XNN_UNLIKELY(n != 0) {
+        uint32_t nnz = *nnzmap++;
+        __m512 vacc0 = _mm512_set1_ps(*w); w += 1;
+        if XNN_LIKELY(nnz != 0) {
+          do {
+            const intptr_t diff = *dmap++;
+            const __m512 vi0 = _mm512_maskz_loadu_ps(vmask, input);
+            input = (const float*restrict) ((uintptr_t) input + (uintptr_t) diff);
+            const __m512 vw = _mm512_set1_ps(*w); w += 1;
+            vacc0 = _mm512_fmadd_ps(vi0, vw, vacc0);
+          } while (--nnz != 0);
+        }
+        __m512 vout0 = _mm512_min_ps(vacc0, vmax);
+        vout0 = _mm512_max_ps(vout0, vmin);
+        _mm512_mask_storeu_ps(output, vmask, vout0);
+        output = (float*restrict) ((uintptr_t) output + output_stride);
+        n -= 1;
+      }
+      output = (float*restrict) ((uintptr_t) output - output_decrement);
+      input += 1;
+    }
+  }
+}
+
+void xnn_f32_spmm_minmax_ukernel_32x4__avx512f(
+    size_t mc,
+    size_t nc,
+    const float*restrict input,
+    const float*restrict weights,
+    const int32_t*restrict widx_dmap,
+    const uint32_t*restrict nidx_nnzmap,
+    float*restrict output,
+    size_t output_stride,
+    const union xnn_f32_minmax_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(mc != 0);
+  assert(mc % sizeof(float) == 0);
+  assert(nc != 0);
+
+  const __m512 vmin = _mm512_set1_ps(params->sse.min[0]);
+  const __m512 vmax = _mm512_set1_ps(params->sse.max[0]);
+  size_t output_decrement = output_stride * nc - 32 * sizeof(float);
+  while XNN_LIKELY(mc >= 32 * sizeof(float)) {
+    const float*restrict w = weights;
+    const int32_t* dmap = widx_dmap;
+    const uint32_t* nnzmap = nidx_nnzmap;
+    size_t n = nc;
+    while (n >= 4) {
+      uint32_t nnz = *nnzmap++;
+      __m512 vacc0123456789ABCDEFn0 = _mm512_set1_ps(*w); w += 1;
+      __m512 vaccGHIJKLMNOPQRSTUVn0 = vacc0123456789ABCDEFn0;
+      __m512 vacc0123456789ABCDEFn1 = _mm512_set1_ps(*w); w += 1;
+      __m512 vaccGHIJKLMNOPQRSTUVn1 = vacc0123456789ABCDEFn1;
+      __m512 vacc0123456789ABCDEFn2 = _mm512_set1_ps(*w); w += 1;
+      __m512 vaccGHIJKLMNOPQRSTUVn2 = vacc0123456789ABCDEFn2;
+      __m512 vacc0123456789ABCDEFn3 = _mm512_set1_ps(*w); w += 1;
+      __m512 vaccGHIJKLMNOPQRSTUVn3 = vacc0123456789ABCDEFn3;
+      if XNN_LIKELY(nnz != 0) {
+        do {
+          const intptr_t diff = *dmap++;
+          const __m512 vi0123456789ABCDEF = _mm512_loadu_ps(input);
+          const __m512 viGHIJKLMNOPQRSTUV = _mm512_loadu_ps(input + 16);
+          input = (const float*restrict) ((uintptr_t) input + (uintptr_t) diff);
+          const __m512 vw0 = _mm512_set1_ps(w[0]);
+          const __m512 vw1 = _mm512_set1_ps(w[1]);
+          const __m512 vw2 = _mm512_set1_ps(w[2]);
+          const __m512 vw3 = _mm512_set1_ps(w[3]);
+          w += 4;
+          vacc0123456789ABCDEFn0 = _mm512_fmadd_ps(vi0123456789ABCDEF, vw0, vacc0123456789ABCDEFn0);
+          vaccGHIJKLMNOPQRSTUVn0 = _mm512_fmadd_ps(viGHIJKLMNOPQRSTUV, vw0, vaccGHIJKLMNOPQRSTUVn0);
+          vacc0123456789ABCDEFn1 = _mm512_fmadd_ps(vi0123456789ABCDEF, vw1, vacc0123456789ABCDEFn1);
+          vaccGHIJKLMNOPQRSTUVn1 = _mm512_fmadd_ps(viGHIJKLMNOPQRSTUV, vw1, vaccGHIJKLMNOPQRSTUVn1);
+          vacc0123456789ABCDEFn2 = _mm512_fmadd_ps(vi0123456789ABCDEF, vw2, vacc0123456789ABCDEFn2);
+          vaccGHIJKLMNOPQRSTUVn2 = _mm512_fmadd_ps(viGHIJKLMNOPQRSTUV, vw2, vaccGHIJKLMNOPQRSTUVn2);
+          vacc0123456789ABCDEFn3 = _mm512_fmadd_ps(vi0123456789ABCDEF, vw3, vacc0123456789ABCDEFn3);
+          vaccGHIJKLMNOPQRSTUVn3 = _mm512_fmadd_ps(viGHIJKLMNOPQRSTUV, vw3, vaccGHIJKLMNOPQRSTUVn3);
+        } while (--nnz != 0);
+      }
+      __m512 vout0123456789ABCDEFn0 = _mm512_min_ps(vacc0123456789ABCDEFn0, vmax);
+      __m512 voutGHIJKLMNOPQRSTUVn0 = _mm512_min_ps(vaccGHIJKLMNOPQRSTUVn0, vmax);
+      __m512 vout0123456789ABCDEFn1 = _mm512_min_ps(vacc0123456789ABCDEFn1, vmax);
+      __m512 voutGHIJKLMNOPQRSTUVn1 = _mm512_min_ps(vaccGHIJKLMNOPQRSTUVn1, vmax);
+      __m512 vout0123456789ABCDEFn2 = _mm512_min_ps(vacc0123456789ABCDEFn2, vmax);
+      __m512 voutGHIJKLMNOPQRSTUVn2 = _mm512_min_ps(vaccGHIJKLMNOPQRSTUVn2, vmax);
+      __m512 vout0123456789ABCDEFn3 = _mm512_min_ps(vacc0123456789ABCDEFn3, vmax);
+      __m512 voutGHIJKLMNOPQRSTUVn3 = _mm512_min_ps(vaccGHIJKLMNOPQRSTUVn3, vmax);
+      vout0123456789ABCDEFn0 = _mm512_max_ps(vout0123456789ABCDEFn0, vmin);
+      voutGHIJKLMNOPQRSTUVn0 = _mm512_max_ps(voutGHIJKLMNOPQRSTUVn0, vmin);
+      vout0123456789ABCDEFn1 = _mm512_max_ps(vout0123456789ABCDEFn1, vmin);
+      voutGHIJKLMNOPQRSTUVn1 = _mm512_max_ps(voutGHIJKLMNOPQRSTUVn1, vmin);
+      vout0123456789ABCDEFn2 = _mm512_max_ps(vout0123456789ABCDEFn2, vmin);
+      voutGHIJKLMNOPQRSTUVn2 = _mm512_max_ps(voutGHIJKLMNOPQRSTUVn2, vmin);
+      vout0123456789ABCDEFn3 = _mm512_max_ps(vout0123456789ABCDEFn3, vmin);
+      voutGHIJKLMNOPQRSTUVn3 = _mm512_max_ps(voutGHIJKLMNOPQRSTUVn3, vmin);
+      _mm512_storeu_ps(output, vout0123456789ABCDEFn0);
+      _mm512_storeu_ps(output + 16, voutGHIJKLMNOPQRSTUVn0);
+      output = (float*restrict) ((uintptr_t) output + output_stride);
+      _mm512_storeu_ps(output, vout0123456789ABCDEFn1);
+      _mm512_storeu_ps(output + 16, voutGHIJKLMNOPQRSTUVn1);
+      output = (float*restrict) ((uintptr_t) output + output_stride);
+      _mm512_storeu_ps(output, vout0123456789ABCDEFn2);
+      _mm512_storeu_ps(output + 16, voutGHIJKLMNOPQRSTUVn2);
+      output = (float*restrict) ((uintptr_t) output + output_stride);
+      _mm512_storeu_ps(output, vout0123456789ABCDEFn3);
+      _mm512_storeu_ps(output + 16, voutGHIJKLMNOPQRSTUVn3);
+      output = (float*restrict) ((uintptr_t) output + output_stride);
+      n -= 4;
+    }
+
+    // clean up loop, fall back to nr=1
+    while XNN_UNLIKELY(n != 0) {
+      uint32_t nnz = *nnzmap++;
+      __m512 vacc0123456789ABCDEF = _mm512_set1_ps(*w); w += 1;
+      __m512 vaccGHIJKLMNOPQRSTUV = vacc0123456789ABCDEF;
+      if XNN_LIKELY(nnz != 0) {
+        do {
+          const intptr_t diff = *dmap++;
+          const __m512 vi0123456789ABCDEF = _mm512_loadu_ps(input);
+          const __m512 viGHIJKLMNOPQRSTUV = _mm512_loadu_ps(input + 16);
+          input = (const float*restrict) ((uintptr_t) input + (uintptr_t) diff);
+          const __m512 vw = _mm512_set1_ps(*w); w += 1;
+          vacc0123456789ABCDEF = _mm512_fmadd_ps(vi0123456789ABCDEF, vw, vacc0123456789ABCDEF);
+          vaccGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(viGHIJKLMNOPQRSTUV, vw, vaccGHIJKLMNOPQRSTUV);
+        } while (--nnz != 0);
+      }
+      __m512 vout0123456789ABCDEF = _mm512_min_ps(vacc0123456789ABCDEF, vmax);
+      __m512 voutGHIJKLMNOPQRSTUV = _mm512_min_ps(vaccGHIJKLMNOPQRSTUV, vmax);
+      vout0123456789ABCDEF = _mm512_max_ps(vout0123456789ABCDEF, vmin);
+      voutGHIJKLMNOPQRSTUV = _mm512_max_ps(voutGHIJKLMNOPQRSTUV, vmin);
+      _mm512_storeu_ps(output, vout0123456789ABCDEF);
+      _mm512_storeu_ps(output + 16, voutGHIJKLMNOPQRSTUV);
+      output = (float*restrict) ((uintptr_t) output + output_stride);
+      n -= 1;
+    }
+    output = (float*restrict) ((uintptr_t) output - output_decrement);
+    input += 32;
+    mc -= 32 * sizeof(float);
+  }
+  if XNN_UNLIKELY(mc != 0) {
+    output_decrement += 16 * sizeof(float);
+    if (mc & (16 * sizeof(float))) {
+      const float*restrict w = weights;
+      const int32_t* dmap = widx_dmap;
+      const uint32_t* nnzmap = nidx_nnzmap;
+      size_t n = nc;
+      while (n >= 4) {
+        uint32_t nnz = *nnzmap++;
+        __m512 vacc0123456789ABCDEFn0 = _mm512_set1_ps(*w); w += 1;
+        __m512 vacc0123456789ABCDEFn1 = _mm512_set1_ps(*w); w += 1;
+        __m512 vacc0123456789ABCDEFn2 = _mm512_set1_ps(*w); w += 1;
+        __m512 vacc0123456789ABCDEFn3 = _mm512_set1_ps(*w); w += 1;
+        if XNN_LIKELY(nnz != 0) {
+          do {
+            const intptr_t diff = *dmap++;
+            const __m512 vi0123456789ABCDEF = _mm512_loadu_ps(input);
+            input = (const float*restrict) ((uintptr_t) input + (uintptr_t) diff);
+            const __m512 vw0 = _mm512_set1_ps(w[0]);
+            const __m512 vw1 = _mm512_set1_ps(w[1]);
+            const __m512 vw2 = _mm512_set1_ps(w[2]);
+            const __m512 vw3 = _mm512_set1_ps(w[3]);
+            w += 4;
+            vacc0123456789ABCDEFn0 = _mm512_fmadd_ps(vi0123456789ABCDEF, vw0, vacc0123456789ABCDEFn0);
+            vacc0123456789ABCDEFn1 = _mm512_fmadd_ps(vi0123456789ABCDEF, vw1, vacc0123456789ABCDEFn1);
+            vacc0123456789ABCDEFn2 = _mm512_fmadd_ps(vi0123456789ABCDEF, vw2, vacc0123456789ABCDEFn2);
+            vacc0123456789ABCDEFn3 = _mm512_fmadd_ps(vi0123456789ABCDEF, vw3, vacc0123456789ABCDEFn3);
+          } while (--nnz != 0);
+        }
+        __m512 vout0123456789ABCDEFn0 = _mm512_min_ps(vacc0123456789ABCDEFn0, vmax);
+        __m512 vout0123456789ABCDEFn1 = _mm512_min_ps(vacc0123456789ABCDEFn1, vmax);
+        __m512 vout0123456789ABCDEFn2 = _mm512_min_ps(vacc0123456789ABCDEFn2, vmax);
+        __m512 vout0123456789ABCDEFn3 = _mm512_min_ps(vacc0123456789ABCDEFn3, vmax);
+        vout0123456789ABCDEFn0 = _mm512_max_ps(vout0123456789ABCDEFn0, vmin);
+        vout0123456789ABCDEFn1 = _mm512_max_ps(vout0123456789ABCDEFn1, vmin);
+        vout0123456789ABCDEFn2 = _mm512_max_ps(vout0123456789ABCDEFn2, vmin);
+        vout0123456789ABCDEFn3 = _mm512_max_ps(vout0123456789ABCDEFn3, vmin);
+        _mm512_storeu_ps(output, vout0123456789ABCDEFn0);
+        output = (float*restrict) ((uintptr_t) output + output_stride);
+        _mm512_storeu_ps(output, vout0123456789ABCDEFn1);
+        output = (float*restrict) ((uintptr_t) output + output_stride);
+        _mm512_storeu_ps(output, vout0123456789ABCDEFn2);
+        output = (float*restrict) ((uintptr_t) output + output_stride);
+        _mm512_storeu_ps(output, vout0123456789ABCDEFn3);
+        output = (float*restrict) ((uintptr_t) output + output_stride);
+        n -= 4;
+      }
+
+      // clean up loop, fall back to nr=1
+      while XNN_UNLIKELY(n != 0) {
+        uint32_t nnz = *nnzmap++;
+        __m512 vacc0123456789ABCDEF = _mm512_set1_ps(*w); w += 1;
+        if XNN_LIKELY(nnz != 0) {
+          do {
+            const intptr_t diff = *dmap++;
+            const __m512 vi0123456789ABCDEF = _mm512_loadu_ps(input);
+            input = (const float*restrict) ((uintptr_t) input + (uintptr_t) diff);
+            const __m512 vw = _mm512_set1_ps(*w); w += 1;
+            vacc0123456789ABCDEF = _mm512_fmadd_ps(vi0123456789ABCDEF, vw, vacc0123456789ABCDEF);
+          } while (--nnz != 0);
+        }
+        __m512 vout0123456789ABCDEF = _mm512_min_ps(vacc0123456789ABCDEF, vmax);
+        vout0123456789ABCDEF = _mm512_max_ps(vout0123456789ABCDEF, vmin);
+        _mm512_storeu_ps(output, vout0123456789ABCDEF);
+        output = (float*restrict) ((uintptr_t) output + output_stride);
+        n -= 1;
+      }
+      output = (float*restrict) ((uintptr_t) output - output_decrement);
+      input += 16;
+    }
+    output_decrement += 8 * sizeof(float);
+    if (mc & (8 * sizeof(float))) {
+      const __mmask16 vmask = _cvtu32_mask16(UINT32_C(0xff));
+      const float*restrict w = weights;
+      const int32_t* dmap = widx_dmap;
+      const uint32_t* nnzmap = nidx_nnzmap;
+      size_t n = nc;
+      while (n >= 4) {
+        uint32_t nnz = *nnzmap++;
+        __m512 vacc01234567n0 = _mm512_set1_ps(*w); w += 1;
+        __m512 vacc01234567n1 = _mm512_set1_ps(*w); w += 1;
+        __m512 vacc01234567n2 = _mm512_set1_ps(*w); w += 1;
+        __m512 vacc01234567n3 = _mm512_set1_ps(*w); w += 1;
+        if XNN_LIKELY(nnz != 0) {
+          do {
+            const intptr_t diff = *dmap++;
+            const __m512 vi01234567 = _mm512_maskz_loadu_ps(vmask, input);
+            input = (const float*restrict) ((uintptr_t) input + (uintptr_t) diff);
+            const __m512 vw0 = _mm512_set1_ps(w[0]);
+            const __m512 vw1 = _mm512_set1_ps(w[1]);
+            const __m512 vw2 = _mm512_set1_ps(w[2]);
+            const __m512 vw3 = _mm512_set1_ps(w[3]);
+            w += 4;
+            vacc01234567n0 = _mm512_fmadd_ps(vi01234567, vw0, vacc01234567n0);
+            vacc01234567n1 = _mm512_fmadd_ps(vi01234567, vw1, vacc01234567n1);
+            vacc01234567n2 = _mm512_fmadd_ps(vi01234567, vw2, vacc01234567n2);
+            vacc01234567n3 = _mm512_fmadd_ps(vi01234567, vw3, vacc01234567n3);
+          } while (--nnz != 0);
+        }
+        __m512 vout01234567n0 = _mm512_min_ps(vacc01234567n0, vmax);
+        __m512 vout01234567n1 = _mm512_min_ps(vacc01234567n1, vmax);
+        __m512 vout01234567n2 = _mm512_min_ps(vacc01234567n2, vmax);
+        __m512 vout01234567n3 = _mm512_min_ps(vacc01234567n3, vmax);
+        vout01234567n0 = _mm512_max_ps(vout01234567n0, vmin);
+        vout01234567n1 = _mm512_max_ps(vout01234567n1, vmin);
+        vout01234567n2 = _mm512_max_ps(vout01234567n2, vmin);
+        vout01234567n3 = _mm512_max_ps(vout01234567n3, vmin);
+        _mm512_mask_storeu_ps(output, vmask, vout01234567n0);
+        output = (float*restrict) ((uintptr_t) output + output_stride);
+        _mm512_mask_storeu_ps(output, vmask, vout01234567n1);
+        output = (float*restrict) ((uintptr_t) output + output_stride);
+        _mm512_mask_storeu_ps(output, vmask, vout01234567n2);
+        output = (float*restrict) ((uintptr_t) output + output_stride);
+        _mm512_mask_storeu_ps(output, vmask, vout01234567n3);
+        output = (float*restrict) ((uintptr_t) output + output_stride);
+        n -= 4;
+      }
+
+      // clean up loop, fall back to nr=1
+      while XNN_UNLIKELY(n != 0) {
+        uint32_t nnz = *nnzmap++;
+        __m512 vacc01234567 = _mm512_set1_ps(*w); w += 1;
+        if XNN_LIKELY(nnz != 0) {
+          do {
+            const intptr_t diff = *dmap++;
+            const __m512 vi01234567 = _mm512_maskz_loadu_ps(vmask, input);
+            input = (const float*restrict) ((uintptr_t) input + (uintptr_t) diff);
+            const __m512 vw = _mm512_set1_ps(*w); w += 1;
+            vacc01234567 = _mm512_fmadd_ps(vi01234567, vw, vacc01234567);
+          } while (--nnz != 0);
+        }
+        __m512 vout01234567 = _mm512_min_ps(vacc01234567, vmax);
+        vout01234567 = _mm512_max_ps(vout01234567, vmin);
+        _mm512_mask_storeu_ps(output, vmask, vout01234567);
+        output = (float*restrict) ((uintptr_t) output + output_stride);
+        n -= 1;
+      }
+      output = (float*restrict) ((uintptr_t) output - output_decrement);
+      input += 8;
+    }
+    output_decrement += 4 * sizeof(float);
+    if (mc & (4 * sizeof(float))) {
+      const __mmask16 vmask = _cvtu32_mask16(UINT32_C(0xf));
+      const float*restrict w = weights;
+      const int32_t* dmap = widx_dmap;
+      const uint32_t* nnzmap = nidx_nnzmap;
+      size_t n = nc;
+      while (n >= 4) {
+        uint32_t nnz = *nnzmap++;
+        __m512 vacc0123n0 = _mm512_set1_ps(*w); w += 1;
+        __m512 vacc0123n1 = _mm512_set1_ps(*w); w += 1;
+        __m512 vacc0123n2 = _mm512_set1_ps(*w); w += 1;
+        __m512 vacc0123n3 = _mm512_set1_ps(*w); w += 1;
+        if XNN_LIKELY(nnz != 0) {
+          do {
+            const intptr_t diff = *dmap++;
+            const __m512 vi0123 = _mm512_maskz_loadu_ps(vmask, input);
+            input = (const float*restrict) ((uintptr_t) input + (uintptr_t) diff);
+            const __m512 vw0 = _mm512_set1_ps(w[0]);
+            const __m512 vw1 = _mm512_set1_ps(w[1]);
+            const __m512 vw2 = _mm512_set1_ps(w[2]);
+            const __m512 vw3 = _mm512_set1_ps(w[3]);
+            w += 4;
+            vacc0123n0 = _mm512_fmadd_ps(vi0123, vw0, vacc0123n0);
+            vacc0123n1 = _mm512_fmadd_ps(vi0123, vw1, vacc0123n1);
+            vacc0123n2 = _mm512_fmadd_ps(vi0123, vw2, vacc0123n2);
+            vacc0123n3 = _mm512_fmadd_ps(vi0123, vw3, vacc0123n3);
+          } while (--nnz != 0);
+        }
+        __m512 vout0123n0 = _mm512_min_ps(vacc0123n0, vmax);
+        __m512 vout0123n1 = _mm512_min_ps(vacc0123n1, vmax);
+        __m512 vout0123n2 = _mm512_min_ps(vacc0123n2, vmax);
+        __m512 vout0123n3 = _mm512_min_ps(vacc0123n3, vmax);
+        vout0123n0 = _mm512_max_ps(vout0123n0, vmin);
+        vout0123n1 = _mm512_max_ps(vout0123n1, vmin);
+        vout0123n2 = _mm512_max_ps(vout0123n2, vmin);
+        vout0123n3 = _mm512_max_ps(vout0123n3, vmin);
+        _mm512_mask_storeu_ps(output, vmask, vout0123n0);
+        output = (float*restrict) ((uintptr_t) output + output_stride);
+        _mm512_mask_storeu_ps(output, vmask, vout0123n1);
+        output = (float*restrict) ((uintptr_t) output + output_stride);
+        _mm512_mask_storeu_ps(output, vmask, vout0123n2);
+        output = (float*restrict) ((uintptr_t) output + output_stride);
+        _mm512_mask_storeu_ps(output, vmask, vout0123n3);
+        output = (float*restrict) ((uintptr_t) output + output_stride);
+        n -= 4;
+      }
+
+      // clean up loop, fall back to nr=1
+      while XNN_UNLIKELY(n != 0) {
+        uint32_t nnz = *nnzmap++;
+        __m512 vacc0123 = _mm512_set1_ps(*w); w += 1;
+        if XNN_LIKELY(nnz != 0) {
+          do {
+            const intptr_t diff = *dmap++;
+            const __m512 vi0123 = _mm512_maskz_loadu_ps(vmask, input);
+            input = (const float*restrict) ((uintptr_t) input + (uintptr_t) diff);
+            const __m512 vw = _mm512_set1_ps(*w); w += 1;
+            vacc0123 = _mm512_fmadd_ps(vi0123, vw, vacc0123);
+          } while (--nnz != 0);
+        }
+        __m512 vout0123 = _mm512_min_ps(vacc0123, vmax);
+        vout0123 = _mm512_max_ps(vout0123, vmin);
+        _mm512_mask_storeu_ps(output, vmask, vout0123);
+        output = (float*restrict) ((uintptr_t) output + output_stride);
+        n -= 1;
+      }
+      output = (float*restrict) ((uintptr_t) output - output_decrement);
+      input += 4;
+    }
+    output_decrement += 2 * sizeof(float);
+    if (mc & (2 * sizeof(float))) {
+      const __mmask16 vmask = _cvtu32_mask16(UINT32_C(0x3));
+      const float*restrict w = weights;
+      const int32_t* dmap = widx_dmap;
+      const uint32_t* nnzmap = nidx_nnzmap;
+      size_t n = nc;
+      while (n >= 4) {
+        uint32_t nnz = *nnzmap++;
+        __m512 vacc01n0 = _mm512_set1_ps(*w); w += 1;
+        __m512 vacc01n1 = _mm512_set1_ps(*w); w += 1;
+        __m512 vacc01n2 = _mm512_set1_ps(*w); w += 1;
+        __m512 vacc01n3 = _mm512_set1_ps(*w); w += 1;
+        if XNN_LIKELY(nnz != 0) {
+          do {
+            const intptr_t diff = *dmap++;
+            const __m512 vi01 = _mm512_maskz_loadu_ps(vmask, input);
+            input = (const float*restrict) ((uintptr_t) input + (uintptr_t) diff);
+            const __m512 vw0 = _mm512_set1_ps(w[0]);
+            const __m512 vw1 = _mm512_set1_ps(w[1]);
+            const __m512 vw2 = _mm512_set1_ps(w[2]);
+            const __m512 vw3 = _mm512_set1_ps(w[3]);
+            w += 4;
+            vacc01n0 = _mm512_fmadd_ps(vi01, vw0, vacc01n0);
+            vacc01n1 = _mm512_fmadd_ps(vi01, vw1, vacc01n1);
+            vacc01n2 = _mm512_fmadd_ps(vi01, vw2, vacc01n2);
+            vacc01n3 = _mm512_fmadd_ps(vi01, vw3, vacc01n3);
+          } while (--nnz != 0);
+        }
+        __m512 vout01n0 = _mm512_min_ps(vacc01n0, vmax);
+        __m512 vout01n1 = _mm512_min_ps(vacc01n1, vmax);
+        __m512 vout01n2 = _mm512_min_ps(vacc01n2, vmax);
+        __m512 vout01n3 = _mm512_min_ps(vacc01n3, vmax);
+        vout01n0 = _mm512_max_ps(vout01n0, vmin);
+        vout01n1 = _mm512_max_ps(vout01n1, vmin);
+        vout01n2 = _mm512_max_ps(vout01n2, vmin);
+        vout01n3 = _mm512_max_ps(vout01n3, vmin);
+        _mm512_mask_storeu_ps(output, vmask, vout01n0);
+        output = (float*restrict) ((uintptr_t) output + output_stride);
+        _mm512_mask_storeu_ps(output, vmask, vout01n1);
+        output = (float*restrict) ((uintptr_t) output + output_stride);
+        _mm512_mask_storeu_ps(output, vmask, vout01n2);
+        output = (float*restrict) ((uintptr_t) output + output_stride);
+        _mm512_mask_storeu_ps(output, vmask, vout01n3);
+        output = (float*restrict) ((uintptr_t) output + output_stride);
+        n -= 4;
+      }
+
+      // clean up loop, fall back to nr=1
+      while XNN_UNLIKELY(n != 0) {
+        uint32_t nnz = *nnzmap++;
+        __m512 vacc01 = _mm512_set1_ps(*w); w += 1;
+        if XNN_LIKELY(nnz != 0) {
+          do {
+            const intptr_t diff = *dmap++;
+            const __m512 vi01 = _mm512_maskz_loadu_ps(vmask, input);
+            input = (const float*restrict) ((uintptr_t) input + (uintptr_t) diff);
+            const __m512 vw = _mm512_set1_ps(*w); w += 1;
+            vacc01 = _mm512_fmadd_ps(vi01, vw, vacc01);
+          } while (--nnz != 0);
+        }
+        __m512 vout01 = _mm512_min_ps(vacc01, vmax);
+        vout01 = _mm512_max_ps(vout01, vmin);
+        _mm512_mask_storeu_ps(output, vmask, vout01);
+        output = (float*restrict) ((uintptr_t) output + output_stride);
+        n -= 1;
+      }
+      output = (float*restrict) ((uintptr_t) output - output_decrement);
+      input += 2;
+    }
+    output_decrement += 1 * sizeof(float);
+    if (mc & (1 * sizeof(float))) {
+      const __mmask16 vmask = _cvtu32_mask16(UINT32_C(0x1));
+      const float*restrict w = weights;
+      const int32_t* dmap = widx_dmap;
+      const uint32_t* nnzmap = nidx_nnzmap;
+      size_t n = nc;
+      while (n >= 4) {
+        uint32_t nnz = *nnzmap++;
+        __m512 vacc0n0 = _mm512_set1_ps(*w); w += 1;
+        __m512 vacc0n1 = _mm512_set1_ps(*w); w += 1;
+        __m512 vacc0n2 = _mm512_set1_ps(*w); w += 1;
+        __m512 vacc0n3 = _mm512_set1_ps(*w); w += 1;
+        if XNN_LIKELY(nnz != 0) {
+          do {
+            const intptr_t diff = *dmap++;
+            const __m512 vi0 = _mm512_maskz_loadu_ps(vmask, input);
+            input = (const float*restrict) ((uintptr_t) input + (uintptr_t) diff);
+            const __m512 vw0 = _mm512_set1_ps(w[0]);
+            const __m512 vw1 = _mm512_set1_ps(w[1]);
+            const __m512 vw2 = _mm512_set1_ps(w[2]);
+            const __m512 vw3 = _mm512_set1_ps(w[3]);
+            w += 4;
+            vacc0n0 = _mm512_fmadd_ps(vi0, vw0, vacc0n0);
+            vacc0n1 = _mm512_fmadd_ps(vi0, vw1, vacc0n1);
+            vacc0n2 = _mm512_fmadd_ps(vi0, vw2, vacc0n2);
+            vacc0n3 = _mm512_fmadd_ps(vi0, vw3, vacc0n3);
+          } while (--nnz != 0);
+        }
+        __m512 vout0n0 = _mm512_min_ps(vacc0n0, vmax);
+        __m512 vout0n1 = _mm512_min_ps(vacc0n1, vmax);
+        __m512 vout0n2 = _mm512_min_ps(vacc0n2, vmax);
+        __m512 vout0n3 = _mm512_min_ps(vacc0n3, vmax);
+        vout0n0 = _mm512_max_ps(vout0n0, vmin);
+        vout0n1 = _mm512_max_ps(vout0n1, vmin);
+        vout0n2 = _mm512_max_ps(vout0n2, vmin);
+        vout0n3 = _mm512_max_ps(vout0n3, vmin);
+        _mm512_mask_storeu_ps(output, vmask, vout0n0);
+        output = (float*restrict) ((uintptr_t) output + output_stride);
+        _mm512_mask_storeu_ps(output, vmask, vout0n1);
+        output = (float*restrict) ((uintptr_t) output + output_stride);
+        _mm512_mask_storeu_ps(output, vmask, vout0n2);
+        output = (float*restrict) ((uintptr_t) output + output_stride);
+        _mm512_mask_storeu_ps(output, vmask, vout0n3);
+        output = (float*restrict) ((uintptr_t) output + output_stride);
+        n -= 4;
+      }
+
+      // clean up loop, fall back to nr=1
+      while XNN_UNLIKELY(n != 0) {
+        uint32_t nnz = *nnzmap++;
+        __m512 vacc0 = _mm512_set1_ps(*w); w += 1;
+        if XNN_LIKELY(nnz != 0) {
+          do {
+            const intptr_t diff = *dmap++;
+            const __m512 vi0 = _mm512_maskz_loadu_ps(vmask, input);
+            input = (const float*restrict) ((uintptr_t) input + (uintptr_t) diff);
+            const __m512 vw = _mm512_set1_ps(*w); w += 1;
+            vacc0 = _mm512_fmadd_ps(vi0, vw, vacc0);
+          } while (--nnz != 0);
+        }
+        __m512 vout0 = _mm512_min_ps(vacc0, vmax);
+        vout0 = _mm512_max_ps(vout0, vmin);
+        _mm512_mask_storeu_ps(output, vmask, vout0);
+        output = (float*restrict) ((uintptr_t) output + output_stride);
+        n -= 1;
+      }
+      output = (float*restrict) ((uintptr_t) output - output_decrement);
+      input += 1;
+    }
+  }
+}
+
 void xnn_f32_vadd_minmax_ukernel__avx512f_x32(
     size_t n,
     const float* a,
@@ -2622,6 +7474,197 @@ void xnn_f32_velu_ukernel__avx512f_rr1_lut16_p3_perm_x64(
   }
 }
 
+void xnn_f32_vgelu_ukernel__avx512f_rational_13_8_div_x64(
+    size_t n,
+    const float* x,
+    float* y,
+    const union xnn_f32_gelu_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(n != 0);
+  assert(n % sizeof(float) == 0);
+  assert(x != NULL);
+  assert(y != NULL);
+
+  const __m512 vminus_cutoff = _mm512_set1_ps(params->avx512_rational_13_8.minus_cutoff);
+  const __m512 vcutoff = _mm512_set1_ps(params->avx512_rational_13_8.cutoff);
+  const __m512 valpha13 = _mm512_set1_ps(params->avx512_rational_13_8.alpha13);
+  const __m512 valpha11 = _mm512_set1_ps(params->avx512_rational_13_8.alpha11);
+  const __m512 valpha9 = _mm512_set1_ps(params->avx512_rational_13_8.alpha9);
+  const __m512 valpha7 = _mm512_set1_ps(params->avx512_rational_13_8.alpha7);
+  const __m512 valpha5 = _mm512_set1_ps(params->avx512_rational_13_8.alpha5);
+  const __m512 valpha3 = _mm512_set1_ps(params->avx512_rational_13_8.alpha3);
+  const __m512 valpha1 = _mm512_set1_ps(params->avx512_rational_13_8.alpha1);
+  const __m512 vbeta8 = _mm512_set1_ps(params->avx512_rational_13_8.beta8);
+  const __m512 vbeta6 = _mm512_set1_ps(params->avx512_rational_13_8.beta6);
+  const __m512 vbeta4 = _mm512_set1_ps(params->avx512_rational_13_8.beta4);
+  const __m512 vbeta2 = _mm512_set1_ps(params->avx512_rational_13_8.beta2);
+  const __m512 vbeta0 = _mm512_set1_ps(params->avx512_rational_13_8.beta0);
+  const __m512 vminus_one = _mm512_set1_ps(params->avx512_rational_13_8.minus_one);
+  const __m512 vone = _mm512_set1_ps(params->avx512_rational_13_8.one);
+  const __m512 vhalf = _mm512_set1_ps(params->avx512_rational_13_8.half);
+
+  for (; n >= 64 * sizeof(float); n -= 64 * sizeof(float)) {
+    const __m512 vx0 = _mm512_loadu_ps(x);
+    const __m512 vx1 = _mm512_loadu_ps(x + 16);
+    const __m512 vx2 = _mm512_loadu_ps(x + 32);
+    const __m512 vx3 = _mm512_loadu_ps(x + 48);
+    x += 64;
+
+    const __m512 vz0 = _mm512_max_ps(vminus_cutoff, _mm512_min_ps(vx0, vcutoff));
+    const __m512 vz1 = _mm512_max_ps(vminus_cutoff, _mm512_min_ps(vx1, vcutoff));
+    const __m512 vz2 = _mm512_max_ps(vminus_cutoff, _mm512_min_ps(vx2, vcutoff));
+    const __m512 vz3 = _mm512_max_ps(vminus_cutoff, _mm512_min_ps(vx3, vcutoff));
+
+    const __m512 vz20 = _mm512_mul_ps(vz0, vz0);
+    const __m512 vz21 = _mm512_mul_ps(vz1, vz1);
+    const __m512 vz22 = _mm512_mul_ps(vz2, vz2);
+    const __m512 vz23 = _mm512_mul_ps(vz3, vz3);
+
+    __m512 vp0 = _mm512_fmadd_ps(valpha13, vz20, valpha11);
+    __m512 vp1 = _mm512_fmadd_ps(valpha13, vz21, valpha11);
+    __m512 vp2 = _mm512_fmadd_ps(valpha13, vz22, valpha11);
+    __m512 vp3 = _mm512_fmadd_ps(valpha13, vz23, valpha11);
+
+    vp0 = _mm512_fmadd_ps(vp0, vz20, valpha9);
+    vp1 = _mm512_fmadd_ps(vp1, vz21, valpha9);
+    vp2 = _mm512_fmadd_ps(vp2, vz22, valpha9);
+    vp3 = _mm512_fmadd_ps(vp3, vz23, valpha9);
+
+    vp0 = _mm512_fmadd_ps(vp0, vz20, valpha7);
+    vp1 = _mm512_fmadd_ps(vp1, vz21, valpha7);
+    vp2 = _mm512_fmadd_ps(vp2, vz22, valpha7);
+    vp3 = _mm512_fmadd_ps(vp3, vz23, valpha7);
+
+    vp0 = _mm512_fmadd_ps(vp0, vz20, valpha5);
+    vp1 = _mm512_fmadd_ps(vp1, vz21, valpha5);
+    vp2 = _mm512_fmadd_ps(vp2, vz22, valpha5);
+    vp3 = _mm512_fmadd_ps(vp3, vz23, valpha5);
+
+    vp0 = _mm512_fmadd_ps(vp0, vz20, valpha3);
+    vp1 = _mm512_fmadd_ps(vp1, vz21, valpha3);
+    vp2 = _mm512_fmadd_ps(vp2, vz22, valpha3);
+    vp3 = _mm512_fmadd_ps(vp3, vz23, valpha3);
+
+    vp0 = _mm512_fmadd_ps(vp0, vz20, valpha1);
+    vp1 = _mm512_fmadd_ps(vp1, vz21, valpha1);
+    vp2 = _mm512_fmadd_ps(vp2, vz22, valpha1);
+    vp3 = _mm512_fmadd_ps(vp3, vz23, valpha1);
+
+    vp0 = _mm512_mul_ps(vp0, vz0);
+    vp1 = _mm512_mul_ps(vp1, vz1);
+    vp2 = _mm512_mul_ps(vp2, vz2);
+    vp3 = _mm512_mul_ps(vp3, vz3);
+
+    __m512 vq0 = _mm512_fmadd_ps(vbeta8, vz20, vbeta6);
+    __m512 vq1 = _mm512_fmadd_ps(vbeta8, vz21, vbeta6);
+    __m512 vq2 = _mm512_fmadd_ps(vbeta8, vz22, vbeta6);
+    __m512 vq3 = _mm512_fmadd_ps(vbeta8, vz23, vbeta6);
+
+    vq0 = _mm512_fmadd_ps(vq0, vz20, vbeta4);
+    vq1 = _mm512_fmadd_ps(vq1, vz21, vbeta4);
+    vq2 = _mm512_fmadd_ps(vq2, vz22, vbeta4);
+    vq3 = _mm512_fmadd_ps(vq3, vz23, vbeta4);
+
+    vq0 = _mm512_fmadd_ps(vq0, vz20, vbeta2);
+    vq1 = _mm512_fmadd_ps(vq1, vz21, vbeta2);
+    vq2 = _mm512_fmadd_ps(vq2, vz22, vbeta2);
+    vq3 = _mm512_fmadd_ps(vq3, vz23, vbeta2);
+
+    vq0 = _mm512_fmadd_ps(vq0, vz20, vbeta0);
+    vq1 = _mm512_fmadd_ps(vq1, vz21, vbeta0);
+    vq2 = _mm512_fmadd_ps(vq2, vz22, vbeta0);
+    vq3 = _mm512_fmadd_ps(vq3, vz23, vbeta0);
+
+    __m512 verf0 = _mm512_div_ps(vp0, vq0);
+    __m512 verf1 = _mm512_div_ps(vp1, vq1);
+    __m512 verf2 = _mm512_div_ps(vp2, vq2);
+    __m512 verf3 = _mm512_div_ps(vp3, vq3);
+
+    verf0 = _mm512_max_ps(vminus_one, _mm512_min_ps(verf0, vone));
+    verf1 = _mm512_max_ps(vminus_one, _mm512_min_ps(verf1, vone));
+    verf2 = _mm512_max_ps(vminus_one, _mm512_min_ps(verf2, vone));
+    verf3 = _mm512_max_ps(vminus_one, _mm512_min_ps(verf3, vone));
+
+    const __m512 vhalfx0 = _mm512_mul_ps(vx0, vhalf);
+    const __m512 vhalfx1 = _mm512_mul_ps(vx1, vhalf);
+    const __m512 vhalfx2 = _mm512_mul_ps(vx2, vhalf);
+    const __m512 vhalfx3 = _mm512_mul_ps(vx3, vhalf);
+
+    const __m512 vy0 = _mm512_fmadd_ps(vhalfx0, verf0, vhalfx0);
+    const __m512 vy1 = _mm512_fmadd_ps(vhalfx1, verf1, vhalfx1);
+    const __m512 vy2 = _mm512_fmadd_ps(vhalfx2, verf2, vhalfx2);
+    const __m512 vy3 = _mm512_fmadd_ps(vhalfx3, verf3, vhalfx3);
+
+    _mm512_storeu_ps(y, vy0);
+    _mm512_storeu_ps(y + 16, vy1);
+    _mm512_storeu_ps(y + 32, vy2);
+    _mm512_storeu_ps(y + 48, vy3);
+    y += 64;
+  }
+  for (; n >= 16 * sizeof(float); n -= 16 * sizeof(float)) {
+    const __m512 vx = _mm512_loadu_ps(x);
+    x += 16;
+
+    const __m512 vz = _mm512_max_ps(vminus_cutoff, _mm512_min_ps(vx, vcutoff));
+    const __m512 vz2 = _mm512_mul_ps(vz, vz);
+
+    __m512 vp = _mm512_fmadd_ps(valpha13, vz2, valpha11);
+    vp = _mm512_fmadd_ps(vp, vz2, valpha9);
+    vp = _mm512_fmadd_ps(vp, vz2, valpha7);
+    vp = _mm512_fmadd_ps(vp, vz2, valpha5);
+    vp = _mm512_fmadd_ps(vp, vz2, valpha3);
+    vp = _mm512_fmadd_ps(vp, vz2, valpha1);
+    vp = _mm512_mul_ps(vp, vz);
+
+    __m512 vq = _mm512_fmadd_ps(vbeta8, vz2, vbeta6);
+    vq = _mm512_fmadd_ps(vq, vz2, vbeta4);
+    vq = _mm512_fmadd_ps(vq, vz2, vbeta2);
+    vq = _mm512_fmadd_ps(vq, vz2, vbeta0);
+
+    __m512 verf = _mm512_div_ps(vp, vq);
+    verf = _mm512_max_ps(vminus_one, _mm512_min_ps(verf, vone));
+
+    const __m512 vhalfx = _mm512_mul_ps(vx, vhalf);
+    const __m512 vy = _mm512_fmadd_ps(vhalfx, verf, vhalfx);
+
+    _mm512_storeu_ps(y, vy);
+    y += 16;
+  }
+  if XNN_UNLIKELY(n != 0) {
+    assert(n >= 1 * sizeof(float));
+    assert(n <= 15 * sizeof(float));
+    // Prepare mask for valid 32-bit elements (depends on n).
+    n >>= 2 /* log2(sizeof(float)) */;
+    const __mmask16 vmask = _cvtu32_mask16((uint16_t) ((uint32_t) (UINT32_C(1) << n) - UINT32_C(1)));
+
+    const __m512 vx = _mm512_maskz_loadu_ps(vmask, x);
+
+    const __m512 vz = _mm512_max_ps(vminus_cutoff, _mm512_min_ps(vx, vcutoff));
+    const __m512 vz2 = _mm512_mul_ps(vz, vz);
+
+    __m512 vp = _mm512_fmadd_ps(valpha13, vz2, valpha11);
+    vp = _mm512_fmadd_ps(vp, vz2, valpha9);
+    vp = _mm512_fmadd_ps(vp, vz2, valpha7);
+    vp = _mm512_fmadd_ps(vp, vz2, valpha5);
+    vp = _mm512_fmadd_ps(vp, vz2, valpha3);
+    vp = _mm512_fmadd_ps(vp, vz2, valpha1);
+    vp = _mm512_mul_ps(vp, vz);
+
+    __m512 vq = _mm512_fmadd_ps(vbeta8, vz2, vbeta6);
+    vq = _mm512_fmadd_ps(vq, vz2, vbeta4);
+    vq = _mm512_fmadd_ps(vq, vz2, vbeta2);
+    vq = _mm512_fmadd_ps(vq, vz2, vbeta0);
+
+    __m512 verf = _mm512_div_ps(vp, vq);
+    verf = _mm512_max_ps(vminus_one, _mm512_min_ps(verf, vone));
+
+    const __m512 vhalfx = _mm512_mul_ps(vx, vhalf);
+    const __m512 vy = _mm512_fmadd_ps(vhalfx, verf, vhalfx);
+
+    _mm512_mask_storeu_ps(y, vmask, vy);
+  }
+}
+
 void xnn_f32_vhswish_ukernel__avx512f_x16(
     size_t n,
     const float* x,
@@ -2699,6 +7742,74 @@ void xnn_f32_vlrelu_ukernel__avx512f_x16(
   }
 }
 
+void xnn_f32_vnormcaddc_ukernel_c32__avx512f(
+    size_t channels,
+    const float* input,
+    const float* mean,
+    const float* inv_stddev,
+    const float* weights,
+    float* output,
+    const union xnn_f32_default_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(channels != 0);
+  assert(channels % sizeof(float) == 0);
+
+  const __m512 vmean = _mm512_set1_ps(*mean);
+  const __m512 vinv_stddev = _mm512_set1_ps(*inv_stddev);
+  for (; channels >= 32 * sizeof(float); channels -= 32 * sizeof(float)) {
+    const __m512 vx0123456789ABCDEF = _mm512_loadu_ps(input);
+    const __m512 vxGHIJKLMNOPQRSTUV = _mm512_loadu_ps(input + 16);
+    input += 32;
+
+    const __m512 vscale0123456789ABCDEF = _mm512_load_ps(weights);
+    const __m512 vscaleGHIJKLMNOPQRSTUV = _mm512_load_ps(weights + 16);
+    const __m512 vbias0123456789ABCDEF = _mm512_load_ps(weights + 32);
+    const __m512 vbiasGHIJKLMNOPQRSTUV = _mm512_load_ps(weights + 48);
+    weights += 64;
+
+    const __m512 vnorm0123456789ABCDEF = _mm512_mul_ps(_mm512_sub_ps(vx0123456789ABCDEF, vmean), vinv_stddev);
+    const __m512 vnormGHIJKLMNOPQRSTUV = _mm512_mul_ps(_mm512_sub_ps(vxGHIJKLMNOPQRSTUV, vmean), vinv_stddev);
+
+    const __m512 vy0123456789ABCDEF = _mm512_fmadd_ps(vnorm0123456789ABCDEF, vscale0123456789ABCDEF, vbias0123456789ABCDEF);
+    const __m512 vyGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vnormGHIJKLMNOPQRSTUV, vscaleGHIJKLMNOPQRSTUV, vbiasGHIJKLMNOPQRSTUV);
+
+    _mm512_storeu_ps(output, vy0123456789ABCDEF);
+    _mm512_storeu_ps(output + 16, vyGHIJKLMNOPQRSTUV);
+    output += 32;
+  }
+  if (channels >= 16 * sizeof(float)) {
+    const __m512 vx = _mm512_loadu_ps(input);
+    input += 16;
+
+    const __m512 vscale = _mm512_load_ps(weights);
+    const __m512 vbias = _mm512_load_ps(weights + 32);
+    weights += 16;
+
+    const __m512 vnorm = _mm512_mul_ps(_mm512_sub_ps(vx, vmean), vinv_stddev);
+    const __m512 vy = _mm512_fmadd_ps(vnorm, vscale, vbias);
+
+    _mm512_storeu_ps(output, vy);
+    output += 16;
+    channels -= 16 * sizeof(float);
+  }
+  if XNN_UNLIKELY(channels != 0) {
+    assert(channels >= 1 * sizeof(float));
+    assert(channels <= 15 * sizeof(float));
+    // Prepare mask for valid 32-bit elements (depends on channels).
+    const __mmask16 vmask = _cvtu32_mask16((uint16_t) ((uint32_t) (UINT32_C(1) << (channels >> 2 /* log2(sizeof(float)) */)) - UINT32_C(1)));
+
+    const __m512 vx = _mm512_maskz_loadu_ps(vmask, input);
+
+    const __m512 vscale = _mm512_load_ps(weights);
+    const __m512 vbias = _mm512_load_ps(weights + 32);
+
+    const __m512 vnorm = _mm512_mul_ps(_mm512_sub_ps(vx, vmean), vinv_stddev);
+    const __m512 vy = _mm512_fmadd_ps(vnorm, vscale, vbias);
+
+    _mm512_mask_storeu_ps(output, vmask, vy);
+  }
+}
+
 void xnn_f32_vrndd_ukernel__avx512f_x16(
     size_t n,
     const float* x,
@@ -2980,6 +8091,198 @@ void xnn_f32_vsigmoid_ukernel__avx512f_rr2_lut32_p2_perm2_scalef_div_x64(
   }
 }
 
+void xnn_f32_vtanh_ukernel__avx512f_expm1minus_rr1_p6_div_x64(
+    size_t n,
+    const float* x,
+    float* y,
+    const union xnn_f32_tanh_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(n != 0);
+  assert(n % sizeof(float) == 0);
+  assert(x != NULL);
+  assert(y != NULL);
+
+  const __m512i vsign_mask = _mm512_set1_epi32((int) params->avx512_expm1minus_rr1_p6.sign_mask);
+  const __m512 vsat_cutoff = _mm512_set1_ps(params->avx512_expm1minus_rr1_p6.sat_cutoff);
+  const __m512 vlog2e = _mm512_set1_ps(params->avx512_expm1minus_rr1_p6.log2e);
+  const __m512 vmagic_bias = _mm512_set1_ps(params->avx512_expm1minus_rr1_p6.magic_bias);
+  const __m512 vminus_ln2 = _mm512_set1_ps(params->avx512_expm1minus_rr1_p6.minus_ln2);
+  const __m512 vc6 = _mm512_set1_ps(params->avx512_expm1minus_rr1_p6.c6);
+  const __m512 vc5 = _mm512_set1_ps(params->avx512_expm1minus_rr1_p6.c5);
+  const __m512 vc4 = _mm512_set1_ps(params->avx512_expm1minus_rr1_p6.c4);
+  const __m512 vc3 = _mm512_set1_ps(params->avx512_expm1minus_rr1_p6.c3);
+  const __m512 vc2 = _mm512_set1_ps(params->avx512_expm1minus_rr1_p6.c2);
+  const __m512 vone = _mm512_set1_ps(params->avx512_expm1minus_rr1_p6.one);
+  const __m512 vminus_two = _mm512_set1_ps(params->avx512_expm1minus_rr1_p6.minus_two);
+
+  for (; n >= 64 * sizeof(float); n -= 64 * sizeof(float)) {
+    const __m512 vx0 = _mm512_loadu_ps(x);
+    const __m512 vx1 = _mm512_loadu_ps(x + 16);
+    const __m512 vx2 = _mm512_loadu_ps(x + 32);
+    const __m512 vx3 = _mm512_loadu_ps(x + 48);
+    x += 64;
+
+    __m512 vz0 = _mm512_castsi512_ps(_mm512_or_epi32(_mm512_castps_si512(vx0), vsign_mask));
+    __m512 vz1 = _mm512_castsi512_ps(_mm512_or_epi32(_mm512_castps_si512(vx1), vsign_mask));
+    __m512 vz2 = _mm512_castsi512_ps(_mm512_or_epi32(_mm512_castps_si512(vx2), vsign_mask));
+    __m512 vz3 = _mm512_castsi512_ps(_mm512_or_epi32(_mm512_castps_si512(vx3), vsign_mask));
+
+    vz0 = _mm512_max_ps(vsat_cutoff, _mm512_add_ps(vz0, vz0));
+    vz1 = _mm512_max_ps(vsat_cutoff, _mm512_add_ps(vz1, vz1));
+    vz2 = _mm512_max_ps(vsat_cutoff, _mm512_add_ps(vz2, vz2));
+    vz3 = _mm512_max_ps(vsat_cutoff, _mm512_add_ps(vz3, vz3));
+
+    __m512 vn0 = _mm512_fmadd_ps(vz0, vlog2e, vmagic_bias);
+    __m512 vn1 = _mm512_fmadd_ps(vz1, vlog2e, vmagic_bias);
+    __m512 vn2 = _mm512_fmadd_ps(vz2, vlog2e, vmagic_bias);
+    __m512 vn3 = _mm512_fmadd_ps(vz3, vlog2e, vmagic_bias);
+
+    const __m512 vs0 = _mm512_castsi512_ps(_mm512_slli_epi32(_mm512_castps_si512(vn0), 23));
+    vn0 = _mm512_sub_ps(vn0, vmagic_bias);
+    const __m512 vs1 = _mm512_castsi512_ps(_mm512_slli_epi32(_mm512_castps_si512(vn1), 23));
+    vn1 = _mm512_sub_ps(vn1, vmagic_bias);
+    const __m512 vs2 = _mm512_castsi512_ps(_mm512_slli_epi32(_mm512_castps_si512(vn2), 23));
+    vn2 = _mm512_sub_ps(vn2, vmagic_bias);
+    const __m512 vs3 = _mm512_castsi512_ps(_mm512_slli_epi32(_mm512_castps_si512(vn3), 23));
+    vn3 = _mm512_sub_ps(vn3, vmagic_bias);
+
+    __m512 vt0 = _mm512_fmadd_ps(vn0, vminus_ln2, vz0);
+    __m512 vt1 = _mm512_fmadd_ps(vn1, vminus_ln2, vz1);
+    __m512 vt2 = _mm512_fmadd_ps(vn2, vminus_ln2, vz2);
+    __m512 vt3 = _mm512_fmadd_ps(vn3, vminus_ln2, vz3);
+
+    __m512 vp0 = _mm512_fmadd_ps(vc6, vt0, vc5);
+    __m512 vp1 = _mm512_fmadd_ps(vc6, vt1, vc5);
+    __m512 vp2 = _mm512_fmadd_ps(vc6, vt2, vc5);
+    __m512 vp3 = _mm512_fmadd_ps(vc6, vt3, vc5);
+
+    vp0 = _mm512_fmadd_ps(vp0, vt0, vc4);
+    vp1 = _mm512_fmadd_ps(vp1, vt1, vc4);
+    vp2 = _mm512_fmadd_ps(vp2, vt2, vc4);
+    vp3 = _mm512_fmadd_ps(vp3, vt3, vc4);
+
+    vp0 = _mm512_fmadd_ps(vp0, vt0, vc3);
+    vp1 = _mm512_fmadd_ps(vp1, vt1, vc3);
+    vp2 = _mm512_fmadd_ps(vp2, vt2, vc3);
+    vp3 = _mm512_fmadd_ps(vp3, vt3, vc3);
+
+    vp0 = _mm512_fmadd_ps(vp0, vt0, vc2);
+    vp1 = _mm512_fmadd_ps(vp1, vt1, vc2);
+    vp2 = _mm512_fmadd_ps(vp2, vt2, vc2);
+    vp3 = _mm512_fmadd_ps(vp3, vt3, vc2);
+
+    vp0 = _mm512_mul_ps(vp0, vt0);
+    vt0 = _mm512_mul_ps(vt0, vs0);
+    vp1 = _mm512_mul_ps(vp1, vt1);
+    vt1 = _mm512_mul_ps(vt1, vs1);
+    vp2 = _mm512_mul_ps(vp2, vt2);
+    vt2 = _mm512_mul_ps(vt2, vs2);
+    vp3 = _mm512_mul_ps(vp3, vt3);
+    vt3 = _mm512_mul_ps(vt3, vs3);
+
+    const __m512 vsm10 = _mm512_sub_ps(vs0, vone);
+    vp0 = _mm512_fmadd_ps(vp0, vt0, vt0);
+    const __m512 vsm11 = _mm512_sub_ps(vs1, vone);
+    vp1 = _mm512_fmadd_ps(vp1, vt1, vt1);
+    const __m512 vsm12 = _mm512_sub_ps(vs2, vone);
+    vp2 = _mm512_fmadd_ps(vp2, vt2, vt2);
+    const __m512 vsm13 = _mm512_sub_ps(vs3, vone);
+    vp3 = _mm512_fmadd_ps(vp3, vt3, vt3);
+
+    const __m512 vemo0 = _mm512_add_ps(vp0, vsm10);
+    const __m512 vemo1 = _mm512_add_ps(vp1, vsm11);
+    const __m512 vemo2 = _mm512_add_ps(vp2, vsm12);
+    const __m512 vemo3 = _mm512_add_ps(vp3, vsm13);
+
+    const __m512 vepo0 = _mm512_sub_ps(vemo0, vminus_two);
+    const __m512 vepo1 = _mm512_sub_ps(vemo1, vminus_two);
+    const __m512 vepo2 = _mm512_sub_ps(vemo2, vminus_two);
+    const __m512 vepo3 = _mm512_sub_ps(vemo3, vminus_two);
+
+    __m512 vy0 = _mm512_div_ps(vemo0, vepo0);
+    __m512 vy1 = _mm512_div_ps(vemo1, vepo1);
+    __m512 vy2 = _mm512_div_ps(vemo2, vepo2);
+    __m512 vy3 = _mm512_div_ps(vemo3, vepo3);
+
+    vy0 = _mm512_castsi512_ps(_mm512_ternarylogic_epi32(vsign_mask, _mm512_castps_si512(vy0), _mm512_castps_si512(vx0), 0xAC));
+    vy1 = _mm512_castsi512_ps(_mm512_ternarylogic_epi32(vsign_mask, _mm512_castps_si512(vy1), _mm512_castps_si512(vx1), 0xAC));
+    vy2 = _mm512_castsi512_ps(_mm512_ternarylogic_epi32(vsign_mask, _mm512_castps_si512(vy2), _mm512_castps_si512(vx2), 0xAC));
+    vy3 = _mm512_castsi512_ps(_mm512_ternarylogic_epi32(vsign_mask, _mm512_castps_si512(vy3), _mm512_castps_si512(vx3), 0xAC));
+
+    _mm512_storeu_ps(y, vy0);
+    _mm512_storeu_ps(y + 16, vy1);
+    _mm512_storeu_ps(y + 32, vy2);
+    _mm512_storeu_ps(y + 48, vy3);
+    y += 64;
+  }
+  for (; n >= 16 * sizeof(float); n -= 16 * sizeof(float)) {
+    const __m512 vx = _mm512_loadu_ps(x);
+    x += 16;
+
+    __m512 vz = _mm512_castsi512_ps(_mm512_or_epi32(_mm512_castps_si512(vx), vsign_mask));
+    vz = _mm512_max_ps(vsat_cutoff, _mm512_add_ps(vz, vz));
+
+    __m512 vn = _mm512_fmadd_ps(vz, vlog2e, vmagic_bias);
+    const __m512 vs = _mm512_castsi512_ps(_mm512_slli_epi32(_mm512_castps_si512(vn), 23));
+    vn = _mm512_sub_ps(vn, vmagic_bias);
+
+    __m512 vt = _mm512_fmadd_ps(vn, vminus_ln2, vz);
+
+    __m512 vp = _mm512_fmadd_ps(vc6, vt, vc5);
+    vp = _mm512_fmadd_ps(vp, vt, vc4);
+    vp = _mm512_fmadd_ps(vp, vt, vc3);
+    vp = _mm512_fmadd_ps(vp, vt, vc2);
+    vp = _mm512_mul_ps(vp, vt);
+
+    vt = _mm512_mul_ps(vt, vs);
+    const __m512 vsm1 = _mm512_sub_ps(vs, vone);
+    vp = _mm512_fmadd_ps(vp, vt, vt);
+    const __m512 vemo = _mm512_add_ps(vp, vsm1);
+    const __m512 vepo = _mm512_sub_ps(vemo, vminus_two);
+
+    __m512 vy = _mm512_div_ps(vemo, vepo);
+    vy = _mm512_castsi512_ps(_mm512_ternarylogic_epi32(vsign_mask, _mm512_castps_si512(vy), _mm512_castps_si512(vx), 0xAC));
+
+    _mm512_storeu_ps(y, vy);
+    y += 16;
+  }
+  if XNN_UNLIKELY(n != 0) {
+    assert(n >= 1 * sizeof(float));
+    assert(n <= 15 * sizeof(float));
+    // Prepare mask for valid 32-bit elements (depends on n).
+    n >>= 2 /* log2(sizeof(float)) */;
+    const __mmask16 vmask = _cvtu32_mask16((uint16_t) ((uint32_t) (UINT32_C(1) << n) - UINT32_C(1)));
+
+    const __m512 vx = _mm512_maskz_loadu_ps(vmask, x);
+
+    __m512 vz = _mm512_castsi512_ps(_mm512_or_epi32(_mm512_castps_si512(vx), vsign_mask));
+    vz = _mm512_max_ps(vsat_cutoff, _mm512_add_ps(vz, vz));
+
+    __m512 vn = _mm512_fmadd_ps(vz, vlog2e, vmagic_bias);
+    const __m512 vs = _mm512_castsi512_ps(_mm512_slli_epi32(_mm512_castps_si512(vn), 23));
+    vn = _mm512_sub_ps(vn, vmagic_bias);
+
+    __m512 vt = _mm512_fmadd_ps(vn, vminus_ln2, vz);
+
+    __m512 vp = _mm512_fmadd_ps(vc6, vt, vc5);
+    vp = _mm512_fmadd_ps(vp, vt, vc4);
+    vp = _mm512_fmadd_ps(vp, vt, vc3);
+    vp = _mm512_fmadd_ps(vp, vt, vc2);
+    vp = _mm512_mul_ps(vp, vt);
+
+    vt = _mm512_mul_ps(vt, vs);
+    const __m512 vsm1 = _mm512_sub_ps(vs, vone);
+    vp = _mm512_fmadd_ps(vp, vt, vt);
+    const __m512 vemo = _mm512_add_ps(vp, vsm1);
+    const __m512 vepo = _mm512_sub_ps(vemo, vminus_two);
+
+    __m512 vy = _mm512_div_ps(vemo, vepo);
+    vy = _mm512_castsi512_ps(_mm512_ternarylogic_epi32(vsign_mask, _mm512_castps_si512(vy), _mm512_castps_si512(vx), 0xAC));
+
+    _mm512_mask_storeu_ps(y, vmask, vy);
+  }
+}
+
 void xnn_f32_vabs_ukernel__avx512f_x16(
     size_t n,
     const float* x,
@@ -8,8 +8,12 @@
 #include <immintrin.h>
 
 #include <xnnpack/common.h>
+#include <xnnpack/gavgpool.h>
 #include <xnnpack/intrinsics-polyfill.h>
+#include <xnnpack/math.h>
+#include <xnnpack/vbinary.h>
 #include <xnnpack/vcvt.h>
+#include <xnnpack/vunary.h>
 
 
 void xnn_f16_f32_vcvt_ukernel__f16c_x16(
@@ -62,6 +66,683 @@ void xnn_f16_f32_vcvt_ukernel__f16c_x16(
   }
 }
 
+void xnn_f16_gavgpool_minmax_ukernel_7p7x__f16c_c8(
+    size_t rows,
+    size_t channels,
+    const void* input,
+    size_t input_stride,
+    const void* zero,
+    void* buffer,
+    void* output_ptr,
+    const union xnn_f16_scaleminmax_params params[restrict XNN_MIN_ELEMENTS(1)]) XNN_OOB_READS
+{
+  assert(rows > 7);
+  assert(channels != 0);
+
+  uint16_t* output = (uint16_t*) output_ptr;
+  const uint16_t* i0 = (const uint16_t*) input;
+  const uint16_t* i1 = (const uint16_t*) ((uintptr_t) i0 + input_stride);
+  const uint16_t* i2 = (const uint16_t*) ((uintptr_t) i1 + input_stride);
+  const uint16_t* i3 = (const uint16_t*) ((uintptr_t) i2 + input_stride);
+  const uint16_t* i4 = (const uint16_t*) ((uintptr_t) i3 + input_stride);
+  const uint16_t* i5 = (const uint16_t*) ((uintptr_t) i4 + input_stride);
+  const uint16_t* i6 = (const uint16_t*) ((uintptr_t) i5 + input_stride);
+  const size_t packed_channels = round_up_po2(channels, 8);
+  const size_t input_increment = 7 * input_stride - packed_channels * sizeof(uint16_t);
+
+  // Partial sums are kept in FP32 in the buffer, and rounded to FP16 only once, in the final output.
+  float* b = (float*) buffer;
+  for (size_t c = 0; c < channels; c += 8) {
+    const __m256 vi0 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i0)); i0 += 8;
+    const __m256 vi1 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i1)); i1 += 8;
+    const __m256 vi2 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i2)); i2 += 8;
+    const __m256 vi3 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i3)); i3 += 8;
+    const __m256 vi4 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i4)); i4 += 8;
+    const __m256 vi5 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i5)); i5 += 8;
+    const __m256 vi6 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i6)); i6 += 8;
+
+    const __m256 vsum01 = _mm256_add_ps(vi0, vi1);
+    const __m256 vsum23 = _mm256_add_ps(vi2, vi3);
+    const __m256 vsum45 = _mm256_add_ps(vi4, vi5);
+
+    const __m256 vsum016 = _mm256_add_ps(vsum01, vi6);
+    const __m256 vsum2345 = _mm256_add_ps(vsum23, vsum45);
+
+    const __m256 vsum = _mm256_add_ps(vsum016, vsum2345);
+
+    _mm256_storeu_ps(b, vsum); b += 8;
+  }
+  for (rows -= 7; rows > 7; rows -= 7) {
+    b = (float*) buffer;
+
+    i0 = (const uint16_t*) ((uintptr_t) i0 + input_increment);
+    i1 = (const uint16_t*) ((uintptr_t) i1 + input_increment);
+    i2 = (const uint16_t*) ((uintptr_t) i2 + input_increment);
+    i3 = (const uint16_t*) ((uintptr_t) i3 + input_increment);
+    i4 = (const uint16_t*) ((uintptr_t) i4 + input_increment);
+    i5 = (const uint16_t*) ((uintptr_t) i5 + input_increment);
+    i6 = (const uint16_t*) ((uintptr_t) i6 + input_increment);
+
+    for (size_t c = 0; c < channels; c += 8) {
+      const __m256 vi0 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i0)); i0 += 8;
+      const __m256 vi1 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i1)); i1 += 8;
+      const __m256 vi2 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i2)); i2 += 8;
+      const __m256 vi3 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i3)); i3 += 8;
+      const __m256 vi4 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i4)); i4 += 8;
+      const __m256 vi5 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i5)); i5 += 8;
+      const __m256 vi6 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i6)); i6 += 8;
+      const __m256 vacc = _mm256_loadu_ps(b);
+
+      const __m256 vsum01 = _mm256_add_ps(vi0, vi1);
+      const __m256 vsum23 = _mm256_add_ps(vi2, vi3);
+      const __m256 vsum45 = _mm256_add_ps(vi4, vi5);
+      const __m256 vsum6a = _mm256_add_ps(vi6, vacc);
+
+      const __m256 vsum0123 = _mm256_add_ps(vsum01, vsum23);
+      const __m256 vsum456a = _mm256_add_ps(vsum45, vsum6a);
+
+      const __m256 vsum = _mm256_add_ps(vsum0123, vsum456a);
+
+      _mm256_storeu_ps(b, vsum); b += 8;
+    }
+  }
+
+  i0 = (const uint16_t*) ((uintptr_t) i0 + input_increment);
+  i1 = (const uint16_t*) ((uintptr_t) i1 + input_increment);
+  if (rows < 2) {
+    i1 = (const uint16_t*) zero;
+  }
+  i2 = (const uint16_t*) ((uintptr_t) i2 + input_increment);
+  if (rows <= 2) {
+    i2 = (const uint16_t*) zero;
+  }
+  i3 = (const uint16_t*) ((uintptr_t) i3 + input_increment);
+  if (rows < 4) {
+    i3 = (const uint16_t*) zero;
+  }
+  i4 = (const uint16_t*) ((uintptr_t) i4 + input_increment);
+  if (rows <= 4) {
+    i4 = (const uint16_t*) zero;
+  }
+  i5 = (const uint16_t*) ((uintptr_t) i5 + input_increment);
+  if (rows < 6) {
+    i5 = (const uint16_t*) zero;
+  }
+  i6 = (const uint16_t*) ((uintptr_t) i6 + input_increment);
+  if (rows <= 6) {
+    i6 = (const uint16_t*) zero;
+  }
+  const __m256 vscale = _mm256_load_ps(params->avx.scale);
+  const __m256 vmin = _mm256_load_ps(params->avx.min);
+  const __m256 vmax = _mm256_load_ps(params->avx.max);
+
+  b = (float*) buffer;
+  while (channels >= 8) {
+    const __m256 vi0 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i0)); i0 += 8;
+    const __m256 vi1 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i1)); i1 += 8;
+    const __m256 vi2 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i2)); i2 += 8;
+    const __m256 vi3 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i3)); i3 += 8;
+    const __m256 vi4 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i4)); i4 += 8;
+    const __m256 vi5 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i5)); i5 += 8;
+    const __m256 vi6 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i6)); i6 += 8;
+    const __m256 vacc = _mm256_loadu_ps(b); b += 8;
+
+    const __m256 vsum01 = _mm256_add_ps(vi0, vi1);
+    const __m256 vsum23 = _mm256_add_ps(vi2, vi3);
+    const __m256 vsum45 = _mm256_add_ps(vi4, vi5);
+    const __m256 vsum6a = _mm256_add_ps(vi6, vacc);
+
+    const __m256 vsum0123 = _mm256_add_ps(vsum01, vsum23);
+    const __m256 vsum456a = _mm256_add_ps(vsum45, vsum6a);
+
+    const __m256 vsum = _mm256_add_ps(vsum0123, vsum456a);
+
+    __m256 vout = _mm256_mul_ps(vsum, vscale);
+    vout = _mm256_max_ps(vout, vmin);
+    vout = _mm256_min_ps(vout, vmax);
+
+    _mm_storeu_si128((__m128i*) output, _mm256_cvtps_ph(vout, _MM_FROUND_NO_EXC)); output += 8;
+
+    channels -= 8;
+  }
+  if (channels != 0) {
+    const __m256 vi0 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i0));
+    const __m256 vi1 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i1));
+    const __m256 vi2 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i2));
+    const __m256 vi3 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i3));
+    const __m256 vi4 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i4));
+    const __m256 vi5 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i5));
+    const __m256 vi6 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i6));
+    const __m256 vacc = _mm256_loadu_ps(b);
+
+    const __m256 vsum01 = _mm256_add_ps(vi0, vi1);
+    const __m256 vsum23 = _mm256_add_ps(vi2, vi3);
+    const __m256 vsum45 = _mm256_add_ps(vi4, vi5);
+    const __m256 vsum6a = _mm256_add_ps(vi6, vacc);
+
+    const __m256 vsum0123 = _mm256_add_ps(vsum01, vsum23);
+    const __m256 vsum456a = _mm256_add_ps(vsum45, vsum6a);
+
+    const __m256 vsum = _mm256_add_ps(vsum0123, vsum456a);
+
+    __m256 vout = _mm256_mul_ps(vsum, vscale);
+    vout = _mm256_max_ps(vout, vmin);
+    vout = _mm256_min_ps(vout, vmax);
+
+    __m128i vh = _mm256_cvtps_ph(vout, _MM_FROUND_NO_EXC);
+    if (channels & 4) {
+      _mm_storel_epi64((__m128i*) output, vh); output += 4;
+      vh = _mm_unpackhi_epi64(vh, vh);
+    }
+    if (channels & 2) {
+      *((uint32_t*) output) = (uint32_t) _mm_cvtsi128_si32(vh); output += 2;
+      vh = _mm_srli_epi64(vh, 32);
+    }
+    if (channels & 1) {
+      *output = (uint16_t) _mm_extract_epi16(vh, 0);
+    }
+  }
+}
+
+void xnn_f16_gavgpool_minmax_ukernel_7x__f16c_c8(
+    size_t rows,
+    size_t channels,
+    const void* input,
+    size_t input_stride,
+    const void* zero,
+    void* output_ptr,
+    const union xnn_f16_scaleminmax_params params[restrict XNN_MIN_ELEMENTS(1)]) XNN_OOB_READS
+{
+  assert(rows != 0);
+  assert(rows <= 7);
+  assert(channels != 0);
+
+  uint16_t* output = (uint16_t*) output_ptr;
+  const uint16_t* i0 = (const uint16_t*) input;
+  const uint16_t* i1 = (const uint16_t*) ((uintptr_t) i0 + input_stride);
+  if (rows < 2) {
+    i1 = (const uint16_t*) zero;
+  }
+  const uint16_t* i2 = (const uint16_t*) ((uintptr_t) i1 + input_stride);
+  if (rows <= 2) {
+    i2 = (const uint16_t*) zero;
+  }
+  const uint16_t* i3 = (const uint16_t*) ((uintptr_t) i2 + input_stride);
+  if (rows < 4) {
+    i3 = (const uint16_t*) zero;
+  }
+  const uint16_t* i4 = (const uint16_t*) ((uintptr_t) i3 + input_stride);
+  if (rows <= 4) {
+    i4 = (const uint16_t*) zero;
+  }
+  const uint16_t* i5 = (const uint16_t*) ((uintptr_t) i4 + input_stride);
+  if (rows < 6) {
+    i5 = (const uint16_t*) zero;
+  }
+  const uint16_t* i6 = (const uint16_t*) ((uintptr_t) i5 + input_stride);
+  if (rows <= 6) {
+    i6 = (const uint16_t*) zero;
+  }
+  const __m256 vscale = _mm256_load_ps(params->avx.scale);
+  const __m256 vmin = _mm256_load_ps(params->avx.min);
+  const __m256 vmax = _mm256_load_ps(params->avx.max);
+
+  while (channels >= 8) {
+    const __m256 vi0 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i0)); i0 += 8;
+    const __m256 vi1 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i1)); i1 += 8;
+    const __m256 vi2 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i2)); i2 += 8;
+    const __m256 vi3 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i3)); i3 += 8;
+    const __m256 vi4 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i4)); i4 += 8;
+    const __m256 vi5 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i5)); i5 += 8;
+    const __m256 vi6 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i6)); i6 += 8;
+
+    const __m256 vsum01 = _mm256_add_ps(vi0, vi1);
+    const __m256 vsum23 = _mm256_add_ps(vi2, vi3);
+    const __m256 vsum45 = _mm256_add_ps(vi4, vi5);
+
+    const __m256 vsum016 = _mm256_add_ps(vsum01, vi6);
+    const __m256 vsum2345 = _mm256_add_ps(vsum23, vsum45);
+
+    const __m256 vsum = _mm256_add_ps(vsum016, vsum2345);
+
+    __m256 vout = _mm256_mul_ps(vsum, vscale);
+    vout = _mm256_max_ps(vout, vmin);
+    vout = _mm256_min_ps(vout, vmax);
+
+    _mm_storeu_si128((__m128i*) output, _mm256_cvtps_ph(vout, _MM_FROUND_NO_EXC)); output += 8;
+
+    channels -= 8;
+  }
+  if (channels != 0) {
+    const __m256 vi0 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i0));
+    const __m256 vi1 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i1));
+    const __m256 vi2 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i2));
+    const __m256 vi3 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i3));
+    const __m256 vi4 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i4));
+    const __m256 vi5 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i5));
+    const __m256 vi6 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i6));
+
+    const __m256 vsum01 = _mm256_add_ps(vi0, vi1);
+    const __m256 vsum23 = _mm256_add_ps(vi2, vi3);
+    const __m256 vsum45 = _mm256_add_ps(vi4, vi5);
+
+    const __m256 vsum016 = _mm256_add_ps(vsum01, vi6);
+    const __m256 vsum2345 = _mm256_add_ps(vsum23, vsum45);
+
+    const __m256 vsum = _mm256_add_ps(vsum016, vsum2345);
+
+    __m256 vout = _mm256_mul_ps(vsum, vscale);
+    vout = _mm256_max_ps(vout, vmin);
+    vout = _mm256_min_ps(vout, vmax);
+
+    __m128i vh = _mm256_cvtps_ph(vout, _MM_FROUND_NO_EXC);
+    if (channels & 4) {
+      _mm_storel_epi64((__m128i*) output, vh); output += 4;
+      vh = _mm_unpackhi_epi64(vh, vh);
+    }
+    if (channels & 2) {
+      *((uint32_t*) output) = (uint32_t) _mm_cvtsi128_si32(vh); output += 2;
+      vh = _mm_srli_epi64(vh, 32);
+    }
+    if (channels & 1) {
+      *output = (uint16_t) _mm_extract_epi16(vh, 0);
+    }
+  }
+}
+
+void xnn_f16_vadd_minmax_ukernel__f16c_x16(
+    size_t n,
+    const void* restrict a_ptr,
+    const void* restrict b_ptr,
+    void* restrict y_ptr,
+    const union xnn_f16_minmax_params params[restrict XNN_MIN_ELEMENTS(1)]) XNN_OOB_READS
+{
+  assert(n != 0);
+  assert(n % sizeof(uint16_t) == 0);
+  assert(a_ptr != NULL);
+  assert(b_ptr != NULL);
+  assert(y_ptr != NULL);
+
+  const uint16_t* a = (const uint16_t*) a_ptr;
+  const uint16_t* b = (const uint16_t*) b_ptr;
+  uint16_t* y = (uint16_t*) y_ptr;
+
+  const __m256 vy_min = _mm256_load_ps(params->avx.min);
+  const __m256 vy_max = _mm256_load_ps(params->avx.max);
+
+  for (; n >= 16 * sizeof(uint16_t); n -= 16 * sizeof(uint16_t)) {
+    const __m256 va01234567 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) a));
+    const __m256 vb01234567 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) b));
+    const __m256 va456789AB = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) (a + 8)));
+    const __m256 vb456789AB = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) (b + 8)));
+    a += 16;
+    b += 16;
+
+    __m256 vy01234567 = _mm256_cvtph_ps(_mm256_cvtps_ph(_mm256_add_ps(va01234567, vb01234567), _MM_FROUND_NO_EXC));
+    __m256 vy456789AB = _mm256_cvtph_ps(_mm256_cvtps_ph(_mm256_add_ps(va456789AB, vb456789AB), _MM_FROUND_NO_EXC));
+
+
+    vy01234567 = _mm256_max_ps(vy01234567, vy_min);
+    vy456789AB = _mm256_max_ps(vy456789AB, vy_min);
+
+    vy01234567 = _mm256_min_ps(vy01234567, vy_max);
+    vy456789AB = _mm256_min_ps(vy456789AB, vy_max);
+
+    _mm_storeu_si128((__m128i*) y, _mm256_cvtps_ph(vy01234567, _MM_FROUND_NO_EXC));
+    _mm_storeu_si128((__m128i*) (y + 8), _mm256_cvtps_ph(vy456789AB, _MM_FROUND_NO_EXC));
+    y += 16;
+  }
+  for (; n >= 8 * sizeof(uint16_t); n -= 8 * sizeof(uint16_t)) {
+    const __m256 va = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) a));
+    const __m256 vb = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) b));
+    a += 8;
+    b += 8;
+
+    __m256 vy = _mm256_cvtph_ps(_mm256_cvtps_ph(_mm256_add_ps(va, vb), _MM_FROUND_NO_EXC));
+
+    vy = _mm256_max_ps(vy, vy_min);
+    vy = _mm256_min_ps(vy, vy_max);
+
+    _mm_storeu_si128((__m128i*) y, _mm256_cvtps_ph(vy, _MM_FROUND_NO_EXC));
+    y += 8;
+  }
+  if XNN_UNLIKELY(n != 0) {
+    const __m256 va = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) a));
+    const __m256 vb = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) b));
+
+    __m256 vy = _mm256_cvtph_ps(_mm256_cvtps_ph(_mm256_add_ps(va, vb), _MM_FROUND_NO_EXC));
+
+    vy = _mm256_max_ps(vy, vy_min);
+    vy = _mm256_min_ps(vy, vy_max);
+
+    __m128i vh = _mm256_cvtps_ph(vy, _MM_FROUND_NO_EXC);
+    if (n & (4 * sizeof(uint16_t))) {
+      _mm_storel_epi64((__m128i*) y, vh);
+      vh = _mm_unpackhi_epi64(vh, vh);
+      y += 4;
+    }
+    if (n & (2 * sizeof(uint16_t))) {
+      *((uint32_t*) y) = (uint32_t) _mm_cvtsi128_si32(vh);
+      vh = _mm_srli_epi64(vh, 32);
+      y += 2;
+    }
+    if (n & (1 * sizeof(uint16_t))) {
+      *y = (uint16_t) _mm_extract_epi16(vh, 0);
+    }
+  }
+}
+
+void xnn_f16_vaddc_minmax_ukernel__f16c_x16(
+    size_t n,
+    const void* restrict a_ptr,
+    const void* restrict b_ptr,
+    void* restrict y_ptr,
+    const union xnn_f16_minmax_params params[restrict XNN_MIN_ELEMENTS(1)]) XNN_OOB_READS
+{
+  assert(n != 0);
+  assert(n % sizeof(uint16_t) == 0);
+  assert(a_ptr != NULL);
+  assert(b_ptr != NULL);
+  assert(y_ptr != NULL);
+
+  const uint16_t* a = (const uint16_t*) a_ptr;
+  const uint16_t* b = (const uint16_t*) b_ptr;
+  uint16_t* y = (uint16_t*) y_ptr;
+
+  const __m256 vy_min = _mm256_load_ps(params->avx.min);
+  const __m256 vy_max = _mm256_load_ps(params->avx.max);
+
+  const __m256 vb = _mm256_cvtph_ps(_mm_set1_epi16((short) *b));
+  for (; n >= 16 * sizeof(uint16_t); n -= 16 * sizeof(uint16_t)) {
+    const __m256 va01234567 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) a));
+    const __m256 va456789AB = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) (a + 8)));
+    a += 16;
+
+    __m256 vy01234567 = _mm256_cvtph_ps(_mm256_cvtps_ph(_mm256_add_ps(va01234567, vb), _MM_FROUND_NO_EXC));
+    __m256 vy456789AB = _mm256_cvtph_ps(_mm256_cvtps_ph(_mm256_add_ps(va456789AB, vb), _MM_FROUND_NO_EXC));
+
+
+    vy01234567 = _mm256_max_ps(vy01234567, vy_min);
+    vy456789AB = _mm256_max_ps(vy456789AB, vy_min);
+
+    vy01234567 = _mm256_min_ps(vy01234567, vy_max);
+    vy456789AB = _mm256_min_ps(vy456789AB, vy_max);
+
+    _mm_storeu_si128((__m128i*) y, _mm256_cvtps_ph(vy01234567, _MM_FROUND_NO_EXC));
+    _mm_storeu_si128((__m128i*) (y + 8), _mm256_cvtps_ph(vy456789AB, _MM_FROUND_NO_EXC));
+    y += 16;
+  }
+  for (; n >= 8 * sizeof(uint16_t); n -= 8 * sizeof(uint16_t)) {
+    const __m256 va = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) a));
+    a += 8;
+
+    __m256 vy = _mm256_cvtph_ps(_mm256_cvtps_ph(_mm256_add_ps(va, vb), _MM_FROUND_NO_EXC));
+
+    vy = _mm256_max_ps(vy, vy_min);
+    vy = _mm256_min_ps(vy, vy_max);
+
+    _mm_storeu_si128((__m128i*) y, _mm256_cvtps_ph(vy, _MM_FROUND_NO_EXC));
+    y += 8;
+  }
+  if XNN_UNLIKELY(n != 0) {
+    const __m256 va = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) a));
+
+    __m256 vy = _mm256_cvtph_ps(_mm256_cvtps_ph(_mm256_add_ps(va, vb), _MM_FROUND_NO_EXC));
+
+    vy = _mm256_max_ps(vy, vy_min);
+    vy = _mm256_min_ps(vy, vy_max);
+
+    __m128i vh = _mm256_cvtps_ph(vy, _MM_FROUND_NO_EXC);
+    if (n & (4 * sizeof(uint16_t))) {
+      _mm_storel_epi64((__m128i*) y, vh);
+      vh = _mm_unpackhi_epi64(vh, vh);
+      y += 4;
+    }
+    if (n & (2 * sizeof(uint16_t))) {
+      *((uint32_t*) y) = (uint32_t) _mm_cvtsi128_si32(vh);
+      vh = _mm_srli_epi64(vh, 32);
+      y += 2;
+    }
+    if (n & (1 * sizeof(uint16_t))) {
+      *y = (uint16_t) _mm_extract_epi16(vh, 0);
+    }
+  }
+}
+
+void xnn_f16_vmul_minmax_ukernel__f16c_x16(
+    size_t n,
+    const void* restrict a_ptr,
+    const void* restrict b_ptr,
+    void* restrict y_ptr,
+    const union xnn_f16_minmax_params params[restrict XNN_MIN_ELEMENTS(1)]) XNN_OOB_READS
+{
+  assert(n != 0);
+  assert(n % sizeof(uint16_t) == 0);
+  assert(a_ptr != NULL);
+  assert(b_ptr != NULL);
+  assert(y_ptr != NULL);
+
+  const uint16_t* a = (const uint16_t*) a_ptr;
+  const uint16_t* b = (const uint16_t*) b_ptr;
+  uint16_t* y = (uint16_t*) y_ptr;
+
+  const __m256 vy_min = _mm256_load_ps(params->avx.min);
+  const __m256 vy_max = _mm256_load_ps(params->avx.max);
+
+  for (; n >= 16 * sizeof(uint16_t); n -= 16 * sizeof(uint16_t)) {
+    const __m256 va01234567 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) a));
+    const __m256 vb01234567 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) b));
+    const __m256 va456789AB = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) (a + 8)));
+    const __m256 vb456789AB = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) (b + 8)));
+    a += 16;
+    b += 16;
+
+    __m256 vy01234567 = _mm256_cvtph_ps(_mm256_cvtps_ph(_mm256_mul_ps(va01234567, vb01234567), _MM_FROUND_NO_EXC));
+    __m256 vy456789AB = _mm256_cvtph_ps(_mm256_cvtps_ph(_mm256_mul_ps(va456789AB, vb456789AB), _MM_FROUND_NO_EXC));
+
+
+    vy01234567 = _mm256_max_ps(vy01234567, vy_min);
+    vy456789AB = _mm256_max_ps(vy456789AB, vy_min);
+
+    vy01234567 = _mm256_min_ps(vy01234567, vy_max);
+    vy456789AB = _mm256_min_ps(vy456789AB, vy_max);
+
+    _mm_storeu_si128((__m128i*) y, _mm256_cvtps_ph(vy01234567, _MM_FROUND_NO_EXC));
+    _mm_storeu_si128((__m128i*) (y + 8), _mm256_cvtps_ph(vy456789AB, _MM_FROUND_NO_EXC));
+    y += 16;
+  }
+  for (; n >= 8 * sizeof(uint16_t); n -= 8 * sizeof(uint16_t)) {
+    const __m256 va = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) a));
+    const __m256 vb = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) b));
+    a += 8;
+    b += 8;
+
+    __m256 vy = _mm256_cvtph_ps(_mm256_cvtps_ph(_mm256_mul_ps(va, vb), _MM_FROUND_NO_EXC));
+
+    vy = _mm256_max_ps(vy, vy_min);
+    vy = _mm256_min_ps(vy, vy_max);
+
+    _mm_storeu_si128((__m128i*) y, _mm256_cvtps_ph(vy, _MM_FROUND_NO_EXC));
+    y += 8;
+  }
+  if XNN_UNLIKELY(n != 0) {
+    const __m256 va = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) a));
+    const __m256 vb = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) b));
+
+    __m256 vy = _mm256_cvtph_ps(_mm256_cvtps_ph(_mm256_mul_ps(va, vb), _MM_FROUND_NO_EXC));
+
+    vy = _mm256_max_ps(vy, vy_min);
+    vy = _mm256_min_ps(vy, vy_max);
+
+    __m128i vh = _mm256_cvtps_ph(vy, _MM_FROUND_NO_EXC);
+    if (n & (4 * sizeof(uint16_t))) {
+      _mm_storel_epi64((__m128i*) y, vh);
+      vh = _mm_unpackhi_epi64(vh, vh);
+      y += 4;
+    }
+    if (n & (2 * sizeof(uint16_t))) {
+      *((uint32_t*) y) = (uint32_t) _mm_cvtsi128_si32(vh);
+      vh = _mm_srli_epi64(vh, 32);
+      y += 2;
+    }
+    if (n & (1 * sizeof(uint16_t))) {
+      *y = (uint16_t) _mm_extract_epi16(vh, 0);
+    }
+  }
+}
+
+void xnn_f16_vmulc_minmax_ukernel__f16c_x16(
+    size_t n,
+    const void* restrict a_ptr,
+    const void* restrict b_ptr,
+    void* restrict y_ptr,
+    const union xnn_f16_minmax_params params[restrict XNN_MIN_ELEMENTS(1)]) XNN_OOB_READS
+{
+  assert(n != 0);
+  assert(n % sizeof(uint16_t) == 0);
+  assert(a_ptr != NULL);
+  assert(b_ptr != NULL);
+  assert(y_ptr != NULL);
+
+  const uint16_t* a = (const uint16_t*) a_ptr;
+  const uint16_t* b = (const uint16_t*) b_ptr;
+  uint16_t* y = (uint16_t*) y_ptr;
+
+  const __m256 vy_min = _mm256_load_ps(params->avx.min);
+  const __m256 vy_max = _mm256_load_ps(params->avx.max);
+
+  const __m256 vb = _mm256_cvtph_ps(_mm_set1_epi16((short) *b));
+  for (; n >= 16 * sizeof(uint16_t); n -= 16 * sizeof(uint16_t)) {
+    const __m256 va01234567 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) a));
+    const __m256 va456789AB = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) (a + 8)));
+    a += 16;
+
+    __m256 vy01234567 = _mm256_cvtph_ps(_mm256_cvtps_ph(_mm256_mul_ps(va01234567, vb), _MM_FROUND_NO_EXC));
+    __m256 vy456789AB = _mm256_cvtph_ps(_mm256_cvtps_ph(_mm256_mul_ps(va456789AB, vb), _MM_FROUND_NO_EXC));
+
+
+    vy01234567 = _mm256_max_ps(vy01234567, vy_min);
+    vy456789AB = _mm256_max_ps(vy456789AB, vy_min);
+
+    vy01234567 = _mm256_min_ps(vy01234567, vy_max);
+    vy456789AB = _mm256_min_ps(vy456789AB, vy_max);
+
+    _mm_storeu_si128((__m128i*) y, _mm256_cvtps_ph(vy01234567, _MM_FROUND_NO_EXC));
+    _mm_storeu_si128((__m128i*) (y + 8), _mm256_cvtps_ph(vy456789AB, _MM_FROUND_NO_EXC));
+    y += 16;
+  }
+  for (; n >= 8 * sizeof(uint16_t); n -= 8 * sizeof(uint16_t)) {
+    const __m256 va = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) a));
+    a += 8;
+
+    __m256 vy = _mm256_cvtph_ps(_mm256_cvtps_ph(_mm256_mul_ps(va, vb), _MM_FROUND_NO_EXC));
+
+    vy = _mm256_max_ps(vy, vy_min);
+    vy = _mm256_min_ps(vy, vy_max);
+
+    _mm_storeu_si128((__m128i*) y, _mm256_cvtps_ph(vy, _MM_FROUND_NO_EXC));
+    y += 8;
+  }
+  if XNN_UNLIKELY(n != 0) {
+    const __m256 va = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) a));
+
+    __m256 vy = _mm256_cvtph_ps(_mm256_cvtps_ph(_mm256_mul_ps(va, vb), _MM_FROUND_NO_EXC));
+
+    vy = _mm256_max_ps(vy, vy_min);
+    vy = _mm256_min_ps(vy, vy_max);
+
+    __m128i vh = _mm256_cvtps_ph(vy, _MM_FROUND_NO_EXC);
+    if (n & (4 * sizeof(uint16_t))) {
+      _mm_storel_epi64((__m128i*) y, vh);
+      vh = _mm_unpackhi_epi64(vh, vh);
+      y += 4;
+    }
+    if (n & (2 * sizeof(uint16_t))) {
+      *((uint32_t*) y) = (uint32_t) _mm_cvtsi128_si32(vh);
+      vh = _mm_srli_epi64(vh, 32);
+      y += 2;
+    }
+    if (n & (1 * sizeof(uint16_t))) {
+      *y = (uint16_t) _mm_extract_epi16(vh, 0);
+    }
+  }
+}
+
+void xnn_f16_vhswish_ukernel__f16c_x16(
+    size_t n,
+    const void* restrict x_ptr,
+    void* restrict y_ptr,
+    const union xnn_f16_hswish_params params[restrict XNN_MIN_ELEMENTS(1)]) XNN_OOB_READS
+{
+  assert(n != 0);
+  assert(n % sizeof(uint16_t) == 0);
+
+  const uint16_t* x = (const uint16_t*) x_ptr;
+  uint16_t* y = (uint16_t*) y_ptr;
+
+  const __m256 vsixth = _mm256_load_ps(params->avx.sixth);
+  const __m256 vthree = _mm256_load_ps(params->avx.three);
+  const __m128i vsix = _mm_load_si128((const __m128i*) params->avx.six);
+  const __m128i vzero = _mm_setzero_si128();
+
+  for (; n >= 16 * sizeof(uint16_t); n -= 16 * sizeof(uint16_t)) {
+    __m256 vx01234567 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) x));
+    __m256 vx89ABCDEF = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) (x + 8)));
+    x += 16;
+
+    __m128i vacc01234567 = _mm256_cvtps_ph(_mm256_add_ps(vx01234567, vthree), _MM_FROUND_NO_EXC);
+    vx01234567 = _mm256_cvtph_ps(_mm256_cvtps_ph(_mm256_mul_ps(vx01234567, vsixth), _MM_FROUND_NO_EXC));
+    __m128i vacc89ABCDEF = _mm256_cvtps_ph(_mm256_add_ps(vx89ABCDEF, vthree), _MM_FROUND_NO_EXC);
+    vx89ABCDEF = _mm256_cvtph_ps(_mm256_cvtps_ph(_mm256_mul_ps(vx89ABCDEF, vsixth), _MM_FROUND_NO_EXC));
+
+    vacc01234567 = _mm_max_epi16(vacc01234567, vzero);
+    vacc89ABCDEF = _mm_max_epi16(vacc89ABCDEF, vzero);
+
+    vacc01234567 = _mm_min_epi16(vacc01234567, vsix);
+    vacc89ABCDEF = _mm_min_epi16(vacc89ABCDEF, vsix);
+
+    vacc01234567 = _mm256_cvtps_ph(_mm256_mul_ps(_mm256_cvtph_ps(vacc01234567), vx01234567), _MM_FROUND_NO_EXC);
+    vacc89ABCDEF = _mm256_cvtps_ph(_mm256_mul_ps(_mm256_cvtph_ps(vacc89ABCDEF), vx89ABCDEF), _MM_FROUND_NO_EXC);
+
+    _mm_storeu_si128((__m128i*) y, vacc01234567);
+    _mm_storeu_si128((__m128i*) (y + 8), vacc89ABCDEF);
+    y += 16;
+  }
+  for (; n >= 8 * sizeof(uint16_t); n -= 8 * sizeof(uint16_t)) {
+    __m256 vx = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) x));
+    x += 8;
+    __m128i vacc = _mm256_cvtps_ph(_mm256_add_ps(vx, vthree), _MM_FROUND_NO_EXC);
+    vx = _mm256_cvtph_ps(_mm256_cvtps_ph(_mm256_mul_ps(vx, vsixth), _MM_FROUND_NO_EXC));
+    vacc = _mm_max_epi16(vacc, vzero);
+    vacc = _mm_min_epi16(vacc, vsix);
+    vacc = _mm256_cvtps_ph(_mm256_mul_ps(_mm256_cvtph_ps(vacc), vx), _MM_FROUND_NO_EXC);
+    _mm_storeu_si128((__m128i*) y, vacc);
+    y += 8;
+  }
+  if XNN_UNLIKELY(n != 0) {
+    __m256 vx = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) x));
+    __m128i vacc = _mm256_cvtps_ph(_mm256_add_ps(vx, vthree), _MM_FROUND_NO_EXC);
+    vx = _mm256_cvtph_ps(_mm256_cvtps_ph(_mm256_mul_ps(vx, vsixth), _MM_FROUND_NO_EXC));
+    vacc = _mm_max_epi16(vacc, vzero);
+    vacc = _mm_min_epi16(vacc, vsix);
+    vacc = _mm256_cvtps_ph(_mm256_mul_ps(_mm256_cvtph_ps(vacc), vx), _MM_FROUND_NO_EXC);
+
+    if (n & (4 * sizeof(uint16_t))) {
+      _mm_storel_epi64((__m128i*) y, vacc);
+      vacc = _mm_unpackhi_epi64(vacc, vacc);
+      y += 4;
+    }
+    if (n & (2 * sizeof(uint16_t))) {
+      *((uint32_t*) y) = (uint32_t) _mm_cvtsi128_si32(vacc);
+      vacc = _mm_srli_epi64(vacc, 32);
+      y += 2;
+    }
+    if (n & (1 * sizeof(uint16_t))) {
+      *y = (uint16_t) _mm_extract_epi16(vacc, 0);
+    }
+  }
+}
+
 void xnn_f32_f16_vcvt_ukernel__f16c_x16(
     size_t n,
     const float* input,
@@ -8,12 +8,3035 @@
 #include <immintrin.h>
 
 #include <xnnpack/common.h>
+#include <xnnpack/conv.h>
 #include <xnnpack/dwconv.h>
 #include <xnnpack/gemm.h>
 #include <xnnpack/igemm.h>
+#include <xnnpack/math.h>
+#include <xnnpack/spmm.h>
+#include <xnnpack/vmulcaddc.h>
 #include <xnnpack/vunary.h>
 
 
+void xnn_f16_dwconv_minmax_ukernel_up16x4__fma3(
+    size_t channels,
+    size_t output_width,
+    const void** input,
+    const void* weights,
+    void* output,
+    size_t input_stride,
+    size_t output_increment,
+    size_t input_offset,
+    const void* zero,
+    const union xnn_f16_minmax_params params[restrict XNN_MIN_ELEMENTS(1)]) XNN_OOB_READS
+{
+  assert(channels != 0);
+  assert(output_width != 0);
+
+  const __m256 vmax = _mm256_load_ps(params->avx.max);
+  const __m256 vmin = _mm256_load_ps(params->avx.min);
+
+  uint16_t* o = (uint16_t*) output;
+  do {
+    const uint16_t* i0 = input[0];
+    assert(i0 != NULL);
+    if XNN_UNPREDICTABLE(i0 != zero) {
+      i0 = (const uint16_t*) ((uintptr_t) i0 + input_offset);
+    }
+    const uint16_t* i1 = input[1];
+    assert(i1 != NULL);
+    if XNN_UNPREDICTABLE(i1 != zero) {
+      i1 = (const uint16_t*) ((uintptr_t) i1 + input_offset);
+    }
+    const uint16_t* i2 = input[2];
+    assert(i2 != NULL);
+    if XNN_UNPREDICTABLE(i2 != zero) {
+      i2 = (const uint16_t*) ((uintptr_t) i2 + input_offset);
+    }
+    const uint16_t* i3 = input[3];
+    assert(i3 != NULL);
+    if XNN_UNPREDICTABLE(i3 != zero) {
+      i3 = (const uint16_t*) ((uintptr_t) i3 + input_offset);
+    }
+    input = (const void**) ((uintptr_t) input + input_stride);
+
+    size_t c = channels;
+    const uint16_t* w = weights;
+    for (; c >= 16; c -= 16) {
+      __m256 vacc01234567p0 = _mm256_cvtph_ps(_mm_load_si128((const __m128i*) w));
+      __m256 vacc89ABCDEFp0 = _mm256_cvtph_ps(_mm_load_si128((const __m128i*) (w + 8)));
+
+
+      const __m256 vi0x01234567 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i0));
+      const __m256 vi0x89ABCDEF = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) (i0 + 8)));
+      i0 += 16;
+
+      const __m256 vk0x01234567 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) (w + 16)));
+      const __m256 vk0x89ABCDEF = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) (w + 24)));
+      vacc01234567p0 = _mm256_cvtph_ps(_mm256_cvtps_ph(_mm256_fmadd_ps(vi0x01234567, vk0x01234567, vacc01234567p0), _MM_FROUND_NO_EXC));
+      vacc89ABCDEFp0 = _mm256_cvtph_ps(_mm256_cvtps_ph(_mm256_fmadd_ps(vi0x89ABCDEF, vk0x89ABCDEF, vacc89ABCDEFp0), _MM_FROUND_NO_EXC));
+
+      const __m256 vi1x01234567 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i1));
+      const __m256 vi1x89ABCDEF = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) (i1 + 8)));
+      i1 += 16;
+
+      const __m256 vk1x01234567 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) (w + 32)));
+      const __m256 vk1x89ABCDEF = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) (w + 40)));
+      vacc01234567p0 = _mm256_cvtph_ps(_mm256_cvtps_ph(_mm256_fmadd_ps(vi1x01234567, vk1x01234567, vacc01234567p0), _MM_FROUND_NO_EXC));
+      vacc89ABCDEFp0 = _mm256_cvtph_ps(_mm256_cvtps_ph(_mm256_fmadd_ps(vi1x89ABCDEF, vk1x89ABCDEF, vacc89ABCDEFp0), _MM_FROUND_NO_EXC));
+
+      const __m256 vi2x01234567 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i2));
+      const __m256 vi2x89ABCDEF = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) (i2 + 8)));
+      i2 += 16;
+
+      const __m256 vk2x01234567 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) (w + 48)));
+      const __m256 vk2x89ABCDEF = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) (w + 56)));
+      vacc01234567p0 = _mm256_cvtph_ps(_mm256_cvtps_ph(_mm256_fmadd_ps(vi2x01234567, vk2x01234567, vacc01234567p0), _MM_FROUND_NO_EXC));
+      vacc89ABCDEFp0 = _mm256_cvtph_ps(_mm256_cvtps_ph(_mm256_fmadd_ps(vi2x89ABCDEF, vk2x89ABCDEF, vacc89ABCDEFp0), _MM_FROUND_NO_EXC));
+
+      const __m256 vi3x01234567 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i3));
+      const __m256 vi3x89ABCDEF = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) (i3 + 8)));
+      i3 += 16;
+
+      const __m256 vk3x01234567 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) (w + 64)));
+      const __m256 vk3x89ABCDEF = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) (w + 72)));
+      vacc01234567p0 = _mm256_cvtph_ps(_mm256_cvtps_ph(_mm256_fmadd_ps(vi3x01234567, vk3x01234567, vacc01234567p0), _MM_FROUND_NO_EXC));
+      vacc89ABCDEFp0 = _mm256_cvtph_ps(_mm256_cvtps_ph(_mm256_fmadd_ps(vi3x89ABCDEF, vk3x89ABCDEF, vacc89ABCDEFp0), _MM_FROUND_NO_EXC));
+
+      w += 80;
+
+
+      __m256 vacc01234567 = _mm256_max_ps(vacc01234567p0, vmin);
+      __m256 vacc89ABCDEF = _mm256_max_ps(vacc89ABCDEFp0, vmin);
+      vacc01234567 = _mm256_min_ps(vacc01234567, vmax);
+      vacc89ABCDEF = _mm256_min_ps(vacc89ABCDEF, vmax);
+
+      _mm_storeu_si128((__m128i*) o, _mm256_cvtps_ph(vacc01234567, _MM_FROUND_NO_EXC));
+      _mm_storeu_si128((__m128i*) (o + 8), _mm256_cvtps_ph(vacc89ABCDEF, _MM_FROUND_NO_EXC));
+      o += 16;
+    }
+    for (; c >= 8; c -= 8) {
+      __m256 vacc01234567p0 = _mm256_cvtph_ps(_mm_load_si128((const __m128i*) w));
+
+      const __m256 vi0x01234567 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i0));
+      i0 += 8;
+
+      const __m256 vk0x01234567 = _mm256_cvtph_ps(_mm_load_si128((const __m128i*) (w + 16)));
+      vacc01234567p0 = _mm256_cvtph_ps(_mm256_cvtps_ph(_mm256_fmadd_ps(vi0x01234567, vk0x01234567, vacc01234567p0), _MM_FROUND_NO_EXC));
+
+      const __m256 vi1x01234567 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i1));
+      i1 += 8;
+
+      const __m256 vk1x01234567 = _mm256_cvtph_ps(_mm_load_si128((const __m128i*) (w + 32)));
+      vacc01234567p0 = _mm256_cvtph_ps(_mm256_cvtps_ph(_mm256_fmadd_ps(vi1x01234567, vk1x01234567, vacc01234567p0), _MM_FROUND_NO_EXC));
+
+      const __m256 vi2x01234567 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i2));
+      i2 += 8;
+
+      const __m256 vk2x01234567 = _mm256_cvtph_ps(_mm_load_si128((const __m128i*) (w + 48)));
+      vacc01234567p0 = _mm256_cvtph_ps(_mm256_cvtps_ph(_mm256_fmadd_ps(vi2x01234567, vk2x01234567, vacc01234567p0), _MM_FROUND_NO_EXC));
+
+      const __m256 vi3x01234567 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i3));
+      i3 += 8;
+
+      const __m256 vk3x01234567 = _mm256_cvtph_ps(_mm_load_si128((const __m128i*) (w + 64)));
+      vacc01234567p0 = _mm256_cvtph_ps(_mm256_cvtps_ph(_mm256_fmadd_ps(vi3x01234567, vk3x01234567, vacc01234567p0), _MM_FROUND_NO_EXC));
+
+      w += 8;
+
+
+      __m256 vacc01234567 = _mm256_max_ps(vacc01234567p0, vmin);
+      vacc01234567 = _mm256_min_ps(vacc01234567, vmax);
+
+      _mm_storeu_si128((__m128i*) o, _mm256_cvtps_ph(vacc01234567, _MM_FROUND_NO_EXC));
+      o += 8;
+    }
+    if XNN_UNLIKELY(c != 0) {
+      assert(c >= 1);
+      assert(c <= 7);
+
+      __m256 vacc01234567p0 = _mm256_cvtph_ps(_mm_load_si128((const __m128i*) w));
+
+      const __m256 vi0x01234567 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i0));
+
+      const __m256 vk0x01234567 = _mm256_cvtph_ps(_mm_load_si128((const __m128i*) (w + 16)));
+      vacc01234567p0 = _mm256_cvtph_ps(_mm256_cvtps_ph(_mm256_fmadd_ps(vi0x01234567, vk0x01234567, vacc01234567p0), _MM_FROUND_NO_EXC));
+
+      const __m256 vi1x01234567 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i1));
+
+      const __m256 vk1x01234567 = _mm256_cvtph_ps(_mm_load_si128((const __m128i*) (w + 32)));
+      vacc01234567p0 = _mm256_cvtph_ps(_mm256_cvtps_ph(_mm256_fmadd_ps(vi1x01234567, vk1x01234567, vacc01234567p0), _MM_FROUND_NO_EXC));
+
+      const __m256 vi2x01234567 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i2));
+
+      const __m256 vk2x01234567 = _mm256_cvtph_ps(_mm_load_si128((const __m128i*) (w + 48)));
+      vacc01234567p0 = _mm256_cvtph_ps(_mm256_cvtps_ph(_mm256_fmadd_ps(vi2x01234567, vk2x01234567, vacc01234567p0), _MM_FROUND_NO_EXC));
+
+      const __m256 vi3x01234567 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i3));
+
+      const __m256 vk3x01234567 = _mm256_cvtph_ps(_mm_load_si128((const __m128i*) (w + 64)));
+      vacc01234567p0 = _mm256_cvtph_ps(_mm256_cvtps_ph(_mm256_fmadd_ps(vi3x01234567, vk3x01234567, vacc01234567p0), _MM_FROUND_NO_EXC));
+
+
+      __m256 vacc01234567 = _mm256_max_ps(vacc01234567p0, vmin);
+      vacc01234567 = _mm256_min_ps(vacc01234567, vmax);
+
+      __m128i vh01234567 = _mm256_cvtps_ph(vacc01234567, _MM_FROUND_NO_EXC);
+      if (c & 4) {
+        _mm_storel_epi64((__m128i*) o, vh01234567);
+        vh01234567 = _mm_unpackhi_epi64(vh01234567, vh01234567);
+        o += 4;
+      }
+      if (c & 2) {
+        *((uint32_t*) o) = (uint32_t) _mm_cvtsi128_si32(vh01234567);
+        vh01234567 = _mm_srli_epi64(vh01234567, 32);
+        o += 2;
+      }
+      if (c & 1) {
+        *((uint16_t*) o) = (uint16_t) _mm_extract_epi16(vh01234567, 0);
+        o += 1;
+      }
+    }
+
+    o = (uint16_t*) ((uintptr_t) o + output_increment);
+  } while (--output_width != 0);
+}
+
+void xnn_f16_dwconv_minmax_ukernel_up16x9__fma3(
+    size_t channels,
+    size_t output_width,
+    const void** input,
+    const void* weights,
+    void* output,
+    size_t input_stride,
+    size_t output_increment,
+    size_t input_offset,
+    const void* zero,
+    const union xnn_f16_minmax_params params[restrict XNN_MIN_ELEMENTS(1)]) XNN_OOB_READS
+{
+  assert(channels != 0);
+  assert(output_width != 0);
+
+  const __m256 vmax = _mm256_load_ps(params->avx.max);
+  const __m256 vmin = _mm256_load_ps(params->avx.min);
+
+  uint16_t* o = (uint16_t*) output;
+  do {
+    const uint16_t* i0 = input[0];
+    assert(i0 != NULL);
+    if XNN_UNPREDICTABLE(i0 != zero) {
+      i0 = (const uint16_t*) ((uintptr_t) i0 + input_offset);
+    }
+    const uint16_t* i1 = input[1];
+    assert(i1 != NULL);
+    if XNN_UNPREDICTABLE(i1 != zero) {
+      i1 = (const uint16_t*) ((uintptr_t) i1 + input_offset);
+    }
+    const uint16_t* i2 = input[2];
+    assert(i2 != NULL);
+    if XNN_UNPREDICTABLE(i2 != zero) {
+      i2 = (const uint16_t*) ((uintptr_t) i2 + input_offset);
+    }
+    const uint16_t* i3 = input[3];
+    assert(i3 != NULL);
+    if XNN_UNPREDICTABLE(i3 != zero) {
+      i3 = (const uint16_t*) ((uintptr_t) i3 + input_offset);
+    }
+    const uint16_t* i4 = input[4];
+    assert(i4 != NULL);
+    if XNN_UNPREDICTABLE(i4 != zero) {
+      i4 = (const uint16_t*) ((uintptr_t) i4 + input_offset);
+    }
+    const uint16_t* i5 = input[5];
+    assert(i5 != NULL);
+    if XNN_UNPREDICTABLE(i5 != zero) {
+      i5 = (const uint16_t*) ((uintptr_t) i5 + input_offset);
+    }
+    const uint16_t* i6 = input[6];
+    assert(i6 != NULL);
+    if XNN_UNPREDICTABLE(i6 != zero) {
+      i6 = (const uint16_t*) ((uintptr_t) i6 + input_offset);
+    }
+    const uint16_t* i7 = input[7];
+    assert(i7 != NULL);
+    if XNN_UNPREDICTABLE(i7 != zero) {
+      i7 = (const uint16_t*) ((uintptr_t) i7 + input_offset);
+    }
+    const uint16_t* i8 = input[8];
+    assert(i8 != NULL);
+    if XNN_UNPREDICTABLE(i8 != zero) {
+      i8 = (const uint16_t*) ((uintptr_t) i8 + input_offset);
+    }
+    input = (const void**) ((uintptr_t) input + input_stride);
+
+    size_t c = channels;
+    const uint16_t* w = weights;
+    for (; c >= 16; c -= 16) {
+      __m256 vacc01234567p0 = _mm256_cvtph_ps(_mm_load_si128((const __m128i*) w));
+      __m256 vacc89ABCDEFp0 = _mm256_cvtph_ps(_mm_load_si128((const __m128i*) (w + 8)));
+
+
+      const __m256 vi0x01234567 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i0));
+      const __m256 vi0x89ABCDEF = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) (i0 + 8)));
+      i0 += 16;
+
+      const __m256 vk0x01234567 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) (w + 16)));
+      const __m256 vk0x89ABCDEF = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) (w + 24)));
+      vacc01234567p0 = _mm256_cvtph_ps(_mm256_cvtps_ph(_mm256_fmadd_ps(vi0x01234567, vk0x01234567, vacc01234567p0), _MM_FROUND_NO_EXC));
+      vacc89ABCDEFp0 = _mm256_cvtph_ps(_mm256_cvtps_ph(_mm256_fmadd_ps(vi0x89ABCDEF, vk0x89ABCDEF, vacc89ABCDEFp0), _MM_FROUND_NO_EXC));
+
+      const __m256 vi1x01234567 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i1));
+      const __m256 vi1x89ABCDEF = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) (i1 + 8)));
+      i1 += 16;
+
+      const __m256 vk1x01234567 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) (w + 32)));
+      const __m256 vk1x89ABCDEF = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) (w + 40)));
+      vacc01234567p0 = _mm256_cvtph_ps(_mm256_cvtps_ph(_mm256_fmadd_ps(vi1x01234567, vk1x01234567, vacc01234567p0), _MM_FROUND_NO_EXC));
+      vacc89ABCDEFp0 = _mm256_cvtph_ps(_mm256_cvtps_ph(_mm256_fmadd_ps(vi1x89ABCDEF, vk1x89ABCDEF, vacc89ABCDEFp0), _MM_FROUND_NO_EXC));
+
+      const __m256 vi2x01234567 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i2));
+      const __m256 vi2x89ABCDEF = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) (i2 + 8)));
+      i2 += 16;
+
+      const __m256 vk2x01234567 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) (w + 48)));
+      const __m256 vk2x89ABCDEF = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) (w + 56)));
+      vacc01234567p0 = _mm256_cvtph_ps(_mm256_cvtps_ph(_mm256_fmadd_ps(vi2x01234567, vk2x01234567, vacc01234567p0), _MM_FROUND_NO_EXC));
+      vacc89ABCDEFp0 = _mm256_cvtph_ps(_mm256_cvtps_ph(_mm256_fmadd_ps(vi2x89ABCDEF, vk2x89ABCDEF, vacc89ABCDEFp0), _MM_FROUND_NO_EXC));
+
+      const __m256 vi3x01234567 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i3));
+      const __m256 vi3x89ABCDEF = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) (i3 + 8)));
+      i3 += 16;
+
+      const __m256 vk3x01234567 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) (w + 64)));
+      const __m256 vk3x89ABCDEF = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) (w + 72)));
+      vacc01234567p0 = _mm256_cvtph_ps(_mm256_cvtps_ph(_mm256_fmadd_ps(vi3x01234567, vk3x01234567, vacc01234567p0), _MM_FROUND_NO_EXC));
+      vacc89ABCDEFp0 = _mm256_cvtph_ps(_mm256_cvtps_ph(_mm256_fmadd_ps(vi3x89ABCDEF, vk3x89ABCDEF, vacc89ABCDEFp0), _MM_FROUND_NO_EXC));
+
+      const __m256 vi4x01234567 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i4));
+      const __m256 vi4x89ABCDEF = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) (i4 + 8)));
+      i4 += 16;
+
+      const __m256 vk4x01234567 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) (w + 80)));
+      const __m256 vk4x89ABCDEF = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) (w + 88)));
+      vacc01234567p0 = _mm256_cvtph_ps(_mm256_cvtps_ph(_mm256_fmadd_ps(vi4x01234567, vk4x01234567, vacc01234567p0), _MM_FROUND_NO_EXC));
+      vacc89ABCDEFp0 = _mm256_cvtph_ps(_mm256_cvtps_ph(_mm256_fmadd_ps(vi4x89ABCDEF, vk4x89ABCDEF, vacc89ABCDEFp0), _MM_FROUND_NO_EXC));
+
+      const __m256 vi5x01234567 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i5));
+      const __m256 vi5x89ABCDEF = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) (i5 + 8)));
+      i5 += 16;
+
+      const __m256 vk5x01234567 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) (w + 96)));
+      const __m256 vk5x89ABCDEF = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) (w + 104)));
+      vacc01234567p0 = _mm256_cvtph_ps(_mm256_cvtps_ph(_mm256_fmadd_ps(vi5x01234567, vk5x01234567, vacc01234567p0), _MM_FROUND_NO_EXC));
+      vacc89ABCDEFp0 = _mm256_cvtph_ps(_mm256_cvtps_ph(_mm256_fmadd_ps(vi5x89ABCDEF, vk5x89ABCDEF, vacc89ABCDEFp0), _MM_FROUND_NO_EXC));
+
+      const __m256 vi6x01234567 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i6));
+      const __m256 vi6x89ABCDEF = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) (i6 + 8)));
+      i6 += 16;
+
+      const __m256 vk6x01234567 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) (w + 112)));
+      const __m256 vk6x89ABCDEF = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) (w + 120)));
+      vacc01234567p0 = _mm256_cvtph_ps(_mm256_cvtps_ph(_mm256_fmadd_ps(vi6x01234567, vk6x01234567, vacc01234567p0), _MM_FROUND_NO_EXC));
+      vacc89ABCDEFp0 = _mm256_cvtph_ps(_mm256_cvtps_ph(_mm256_fmadd_ps(vi6x89ABCDEF, vk6x89ABCDEF, vacc89ABCDEFp0), _MM_FROUND_NO_EXC));
+
+      const __m256 vi7x01234567 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i7));
+      const __m256 vi7x89ABCDEF = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) (i7 + 8)));
+      i7 += 16;
+
+      const __m256 vk7x01234567 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) (w + 128)));
+      const __m256 vk7x89ABCDEF = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) (w + 136)));
+      vacc01234567p0 = _mm256_cvtph_ps(_mm256_cvtps_ph(_mm256_fmadd_ps(vi7x01234567, vk7x01234567, vacc01234567p0), _MM_FROUND_NO_EXC));
+      vacc89ABCDEFp0 = _mm256_cvtph_ps(_mm256_cvtps_ph(_mm256_fmadd_ps(vi7x89ABCDEF, vk7x89ABCDEF, vacc89ABCDEFp0), _MM_FROUND_NO_EXC));
+
+      const __m256 vi8x01234567 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i8));
+      const __m256 vi8x89ABCDEF = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) (i8 + 8)));
+      i8 += 16;
+
+      const __m256 vk8x01234567 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) (w + 144)));
+      const __m256 vk8x89ABCDEF = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) (w + 152)));
+      vacc01234567p0 = _mm256_cvtph_ps(_mm256_cvtps_ph(_mm256_fmadd_ps(vi8x01234567, vk8x01234567, vacc01234567p0), _MM_FROUND_NO_EXC));
+      vacc89ABCDEFp0 = _mm256_cvtph_ps(_mm256_cvtps_ph(_mm256_fmadd_ps(vi8x89ABCDEF, vk8x89ABCDEF, vacc89ABCDEFp0), _MM_FROUND_NO_EXC));
+
+      w += 160;
+
+
+      __m256 vacc01234567 = _mm256_max_ps(vacc01234567p0, vmin);
+      __m256 vacc89ABCDEF = _mm256_max_ps(vacc89ABCDEFp0, vmin);
+      vacc01234567 = _mm256_min_ps(vacc01234567, vmax);
+      vacc89ABCDEF = _mm256_min_ps(vacc89ABCDEF, vmax);
+
+      _mm_storeu_si128((__m128i*) o, _mm256_cvtps_ph(vacc01234567, _MM_FROUND_NO_EXC));
+      _mm_storeu_si128((__m128i*) (o + 8), _mm256_cvtps_ph(vacc89ABCDEF, _MM_FROUND_NO_EXC));
+      o += 16;
+    }
+    for (; c >= 8; c -= 8) {
+      __m256 vacc01234567p0 = _mm256_cvtph_ps(_mm_load_si128((const __m128i*) w));
+
+      const __m256 vi0x01234567 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i0));
+      i0 += 8;
+
+      const __m256 vk0x01234567 = _mm256_cvtph_ps(_mm_load_si128((const __m128i*) (w + 16)));
+      vacc01234567p0 = _mm256_cvtph_ps(_mm256_cvtps_ph(_mm256_fmadd_ps(vi0x01234567, vk0x01234567, vacc01234567p0), _MM_FROUND_NO_EXC));
+
+      const __m256 vi1x01234567 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i1));
+      i1 += 8;
+
+      const __m256 vk1x01234567 = _mm256_cvtph_ps(_mm_load_si128((const __m128i*) (w + 32)));
+      vacc01234567p0 = _mm256_cvtph_ps(_mm256_cvtps_ph(_mm256_fmadd_ps(vi1x01234567, vk1x01234567, vacc01234567p0), _MM_FROUND_NO_EXC));
+
+      const __m256 vi2x01234567 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i2));
+      i2 += 8;
+
+      const __m256 vk2x01234567 = _mm256_cvtph_ps(_mm_load_si128((const __m128i*) (w + 48)));
+      vacc01234567p0 = _mm256_cvtph_ps(_mm256_cvtps_ph(_mm256_fmadd_ps(vi2x01234567, vk2x01234567, vacc01234567p0), _MM_FROUND_NO_EXC));
+
+      const __m256 vi3x01234567 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i3));
+      i3 += 8;
+
+      const __m256 vk3x01234567 = _mm256_cvtph_ps(_mm_load_si128((const __m128i*) (w + 64)));
+      vacc01234567p0 = _mm256_cvtph_ps(_mm256_cvtps_ph(_mm256_fmadd_ps(vi3x01234567, vk3x01234567, vacc01234567p0), _MM_FROUND_NO_EXC));
+
+      const __m256 vi4x01234567 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i4));
+      i4 += 8;
+
+      const __m256 vk4x01234567 = _mm256_cvtph_ps(_mm_load_si128((const __m128i*) (w + 80)));
+      vacc01234567p0 = _mm256_cvtph_ps(_mm256_cvtps_ph(_mm256_fmadd_ps(vi4x01234567, vk4x01234567, vacc01234567p0), _MM_FROUND_NO_EXC));
+
+      const __m256 vi5x01234567 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i5));
+      i5 += 8;
+
+      const __m256 vk5x01234567 = _mm256_cvtph_ps(_mm_load_si128((const __m128i*) (w + 96)));
+      vacc01234567p0 = _mm256_cvtph_ps(_mm256_cvtps_ph(_mm256_fmadd_ps(vi5x01234567, vk5x01234567, vacc01234567p0), _MM_FROUND_NO_EXC));
+
+      const __m256 vi6x01234567 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i6));
+      i6 += 8;
+
+      const __m256 vk6x01234567 = _mm256_cvtph_ps(_mm_load_si128((const __m128i*) (w + 112)));
+      vacc01234567p0 = _mm256_cvtph_ps(_mm256_cvtps_ph(_mm256_fmadd_ps(vi6x01234567, vk6x01234567, vacc01234567p0), _MM_FROUND_NO_EXC));
+
+      const __m256 vi7x01234567 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i7));
+      i7 += 8;
+
+      const __m256 vk7x01234567 = _mm256_cvtph_ps(_mm_load_si128((const __m128i*) (w + 128)));
+      vacc01234567p0 = _mm256_cvtph_ps(_mm256_cvtps_ph(_mm256_fmadd_ps(vi7x01234567, vk7x01234567, vacc01234567p0), _MM_FROUND_NO_EXC));
+
+      const __m256 vi8x01234567 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i8));
+      i8 += 8;
+
+      const __m256 vk8x01234567 = _mm256_cvtph_ps(_mm_load_si128((const __m128i*) (w + 144)));
+      vacc01234567p0 = _mm256_cvtph_ps(_mm256_cvtps_ph(_mm256_fmadd_ps(vi8x01234567, vk8x01234567, vacc01234567p0), _MM_FROUND_NO_EXC));
+
+      w += 8;
+
+
+      __m256 vacc01234567 = _mm256_max_ps(vacc01234567p0, vmin);
+      vacc01234567 = _mm256_min_ps(vacc01234567, vmax);
+
+      _mm_storeu_si128((__m128i*) o, _mm256_cvtps_ph(vacc01234567, _MM_FROUND_NO_EXC));
+      o += 8;
+    }
+    if XNN_UNLIKELY(c != 0) {
+      assert(c >= 1);
+      assert(c <= 7);
+
+      __m256 vacc01234567p0 = _mm256_cvtph_ps(_mm_load_si128((const __m128i*) w));
+
+      const __m256 vi0x01234567 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i0));
+
+      const __m256 vk0x01234567 = _mm256_cvtph_ps(_mm_load_si128((const __m128i*) (w + 16)));
+      vacc01234567p0 = _mm256_cvtph_ps(_mm256_cvtps_ph(_mm256_fmadd_ps(vi0x01234567, vk0x01234567, vacc01234567p0), _MM_FROUND_NO_EXC));
+
+      const __m256 vi1x01234567 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i1));
+
+      const __m256 vk1x01234567 = _mm256_cvtph_ps(_mm_load_si128((const __m128i*) (w + 32)));
+      vacc01234567p0 = _mm256_cvtph_ps(_mm256_cvtps_ph(_mm256_fmadd_ps(vi1x01234567, vk1x01234567, vacc01234567p0), _MM_FROUND_NO_EXC));
+
+      const __m256 vi2x01234567 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i2));
+
+      const __m256 vk2x01234567 = _mm256_cvtph_ps(_mm_load_si128((const __m128i*) (w + 48)));
+      vacc01234567p0 = _mm256_cvtph_ps(_mm256_cvtps_ph(_mm256_fmadd_ps(vi2x01234567, vk2x01234567, vacc01234567p0), _MM_FROUND_NO_EXC));
+
+      const __m256 vi3x01234567 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i3));
+
+      const __m256 vk3x01234567 = _mm256_cvtph_ps(_mm_load_si128((const __m128i*) (w + 64)));
+      vacc01234567p0 = _mm256_cvtph_ps(_mm256_cvtps_ph(_mm256_fmadd_ps(vi3x01234567, vk3x01234567, vacc01234567p0), _MM_FROUND_NO_EXC));
+
+      const __m256 vi4x01234567 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i4));
+
+      const __m256 vk4x01234567 = _mm256_cvtph_ps(_mm_load_si128((const __m128i*) (w + 80)));
+      vacc01234567p0 = _mm256_cvtph_ps(_mm256_cvtps_ph(_mm256_fmadd_ps(vi4x01234567, vk4x01234567, vacc01234567p0), _MM_FROUND_NO_EXC));
+
+      const __m256 vi5x01234567 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i5));
+
+      const __m256 vk5x01234567 = _mm256_cvtph_ps(_mm_load_si128((const __m128i*) (w + 96)));
+      vacc01234567p0 = _mm256_cvtph_ps(_mm256_cvtps_ph(_mm256_fmadd_ps(vi5x01234567, vk5x01234567, vacc01234567p0), _MM_FROUND_NO_EXC));
+
+      const __m256 vi6x01234567 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i6));
+
+      const __m256 vk6x01234567 = _mm256_cvtph_ps(_mm_load_si128((const __m128i*) (w + 112)));
+      vacc01234567p0 = _mm256_cvtph_ps(_mm256_cvtps_ph(_mm256_fmadd_ps(vi6x01234567, vk6x01234567, vacc01234567p0), _MM_FROUND_NO_EXC));
+
+      const __m256 vi7x01234567 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i7));
+
+      const __m256 vk7x01234567 = _mm256_cvtph_ps(_mm_load_si128((const __m128i*) (w + 128)));
+      vacc01234567p0 = _mm256_cvtph_ps(_mm256_cvtps_ph(_mm256_fmadd_ps(vi7x01234567, vk7x01234567, vacc01234567p0), _MM_FROUND_NO_EXC));
+
+      const __m256 vi8x01234567 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i8));
+
+      const __m256 vk8x01234567 = _mm256_cvtph_ps(_mm_load_si128((const __m128i*) (w + 144)));
+      vacc01234567p0 = _mm256_cvtph_ps(_mm256_cvtps_ph(_mm256_fmadd_ps(vi8x01234567, vk8x01234567, vacc01234567p0), _MM_FROUND_NO_EXC));
+
+
+      __m256 vacc01234567 = _mm256_max_ps(vacc01234567p0, vmin);
+      vacc01234567 = _mm256_min_ps(vacc01234567, vmax);
+
+      __m128i vh01234567 = _mm256_cvtps_ph(vacc01234567, _MM_FROUND_NO_EXC);
+      if (c & 4) {
+        _mm_storel_epi64((__m128i*) o, vh01234567);
+        vh01234567 = _mm_unpackhi_epi64(vh01234567, vh01234567);
+        o += 4;
+      }
+      if (c & 2) {
+        *((uint32_t*) o) = (uint32_t) _mm_cvtsi128_si32(vh01234567);
+        vh01234567 = _mm_srli_epi64(vh01234567, 32);
+        o += 2;
+      }
+      if (c & 1) {
+        *((uint16_t*) o) = (uint16_t) _mm_extract_epi16(vh01234567, 0);
+        o += 1;
+      }
+    }
+
+    o = (uint16_t*) ((uintptr_t) o + output_increment);
+  } while (--output_width != 0);
+}
+
+void xnn_f16_dwconv_minmax_ukernel_up8x25__fma3_acc2(
+    size_t channels,
+    size_t output_width,
+    const void** input,
+    const void* weights,
+    void* output,
+    size_t input_stride,
+    size_t output_increment,
+    size_t input_offset,
+    const void* zero,
+    const union xnn_f16_minmax_params params[restrict XNN_MIN_ELEMENTS(1)]) XNN_OOB_READS
+{
+  assert(channels != 0);
+  assert(output_width != 0);
+
+  const __m256 vmax = _mm256_load_ps(params->avx.max);
+  const __m256 vmin = _mm256_load_ps(params->avx.min);
+
+  uint16_t* o = (uint16_t*) output;
+  do {
+    const uint16_t* i0 = input[0];
+    assert(i0 != NULL);
+    if XNN_UNPREDICTABLE(i0 != zero) {
+      i0 = (const uint16_t*) ((uintptr_t) i0 + input_offset);
+    }
+    const uint16_t* i1 = input[1];
+    assert(i1 != NULL);
+    if XNN_UNPREDICTABLE(i1 != zero) {
+      i1 = (const uint16_t*) ((uintptr_t) i1 + input_offset);
+    }
+    const uint16_t* i2 = input[2];
+    assert(i2 != NULL);
+    if XNN_UNPREDICTABLE(i2 != zero) {
+      i2 = (const uint16_t*) ((uintptr_t) i2 + input_offset);
+    }
+    const uint16_t* i3 = input[3];
+    assert(i3 != NULL);
+    if XNN_UNPREDICTABLE(i3 != zero) {
+      i3 = (const uint16_t*) ((uintptr_t) i3 + input_offset);
+    }
+    const uint16_t* i4 = input[4];
+    assert(i4 != NULL);
+    if XNN_UNPREDICTABLE(i4 != zero) {
+      i4 = (const uint16_t*) ((uintptr_t) i4 + input_offset);
+    }
+    const uint16_t* i5 = input[5];
+    assert(i5 != NULL);
+    if XNN_UNPREDICTABLE(i5 != zero) {
+      i5 = (const uint16_t*) ((uintptr_t) i5 + input_offset);
+    }
+    const uint16_t* i6 = input[6];
+    assert(i6 != NULL);
+    if XNN_UNPREDICTABLE(i6 != zero) {
+      i6 = (const uint16_t*) ((uintptr_t) i6 + input_offset);
+    }
+    const uint16_t* i7 = input[7];
+    assert(i7 != NULL);
+    if XNN_UNPREDICTABLE(i7 != zero) {
+      i7 = (const uint16_t*) ((uintptr_t) i7 + input_offset);
+    }
+    const uint16_t* i8 = input[8];
+    assert(i8 != NULL);
+    if XNN_UNPREDICTABLE(i8 != zero) {
+      i8 = (const uint16_t*) ((uintptr_t) i8 + input_offset);
+    }
+    const uint16_t* i9 = input[9];
+    assert(i9 != NULL);
+    if XNN_UNPREDICTABLE(i9 != zero) {
+      i9 = (const uint16_t*) ((uintptr_t) i9 + input_offset);
+    }
+    const uint16_t* i10 = input[10];
+    assert(i10 != NULL);
+    if XNN_UNPREDICTABLE(i10 != zero) {
+      i10 = (const uint16_t*) ((uintptr_t) i10 + input_offset);
+    }
+    const uint16_t* i11 = input[11];
+    assert(i11 != NULL);
+    if XNN_UNPREDICTABLE(i11 != zero) {
+      i11 = (const uint16_t*) ((uintptr_t) i11 + input_offset);
+    }
+    const uint16_t* i12 = input[12];
+    assert(i12 != NULL);
+    if XNN_UNPREDICTABLE(i12 != zero) {
+      i12 = (const uint16_t*) ((uintptr_t) i12 + input_offset);
+    }
+    const uint16_t* i13 = input[13];
+    assert(i13 != NULL);
+    if XNN_UNPREDICTABLE(i13 != zero) {
+      i13 = (const uint16_t*) ((uintptr_t) i13 + input_offset);
+    }
+    const uint16_t* i14 = input[14];
+    assert(i14 != NULL);
+    if XNN_UNPREDICTABLE(i14 != zero) {
+      i14 = (const uint16_t*) ((uintptr_t) i14 + input_offset);
+    }
+    const uint16_t* i15 = input[15];
+    assert(i15 != NULL);
+    if XNN_UNPREDICTABLE(i15 != zero) {
+      i15 = (const uint16_t*) ((uintptr_t) i15 + input_offset);
+    }
+    const uint16_t* i16 = input[16];
+    assert(i16 != NULL);
+    if XNN_UNPREDICTABLE(i16 != zero) {
+      i16 = (const uint16_t*) ((uintptr_t) i16 + input_offset);
+    }
+    const uint16_t* i17 = input[17];
+    assert(i17 != NULL);
+    if XNN_UNPREDICTABLE(i17 != zero) {
+      i17 = (const uint16_t*) ((uintptr_t) i17 + input_offset);
+    }
+    const uint16_t* i18 = input[18];
+    assert(i18 != NULL);
+    if XNN_UNPREDICTABLE(i18 != zero) {
+      i18 = (const uint16_t*) ((uintptr_t) i18 + input_offset);
+    }
+    const uint16_t* i19 = input[19];
+    assert(i19 != NULL);
+    if XNN_UNPREDICTABLE(i19 != zero) {
+      i19 = (const uint16_t*) ((uintptr_t) i19 + input_offset);
+    }
+    const uint16_t* i20 = input[20];
+    assert(i20 != NULL);
+    if XNN_UNPREDICTABLE(i20 != zero) {
+      i20 = (const uint16_t*) ((uintptr_t) i20 + input_offset);
+    }
+    const uint16_t* i21 = input[21];
+    assert(i21 != NULL);
+    if XNN_UNPREDICTABLE(i21 != zero) {
+      i21 = (const uint16_t*) ((uintptr_t) i21 + input_offset);
+    }
+    const uint16_t* i22 = input[22];
+    assert(i22 != NULL);
+    if XNN_UNPREDICTABLE(i22 != zero) {
+      i22 = (const uint16_t*) ((uintptr_t) i22 + input_offset);
+    }
+    const uint16_t* i23 = input[23];
+    assert(i23 != NULL);
+    if XNN_UNPREDICTABLE(i23 != zero) {
+      i23 = (const uint16_t*) ((uintptr_t) i23 + input_offset);
+    }
+    const uint16_t* i24 = input[24];
+    assert(i24 != NULL);
+    if XNN_UNPREDICTABLE(i24 != zero) {
+      i24 = (const uint16_t*) ((uintptr_t) i24 + input_offset);
+    }
+    input = (const void**) ((uintptr_t) input + input_stride);
+
+    size_t c = channels;
+    const uint16_t* w = weights;
+    for (; c >= 8; c -= 8) {
+      __m256 vacc01234567p0 = _mm256_cvtph_ps(_mm_load_si128((const __m128i*) w));
+
+
+      const __m256 vi0x01234567 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i0));
+      i0 += 8;
+
+      const __m256 vk0x01234567 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) (w + 8)));
+      vacc01234567p0 = _mm256_cvtph_ps(_mm256_cvtps_ph(_mm256_fmadd_ps(vi0x01234567, vk0x01234567, vacc01234567p0), _MM_FROUND_NO_EXC));
+
+      const __m256 vi1x01234567 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i1));
+      i1 += 8;
+
+      const __m256 vk1x01234567 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) (w + 16)));
+      __m256 vacc01234567p1 = _mm256_cvtph_ps(_mm256_cvtps_ph(_mm256_mul_ps(vi1x01234567, vk1x01234567), _MM_FROUND_NO_EXC));
+
+      const __m256 vi2x01234567 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i2));
+      i2 += 8;
+
+      const __m256 vk2x01234567 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) (w + 24)));
+      vacc01234567p0 = _mm256_cvtph_ps(_mm256_cvtps_ph(_mm256_fmadd_ps(vi2x01234567, vk2x01234567, vacc01234567p0), _MM_FROUND_NO_EXC));
+
+      const __m256 vi3x01234567 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i3));
+      i3 += 8;
+
+      const __m256 vk3x01234567 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) (w + 32)));
+      vacc01234567p1 = _mm256_cvtph_ps(_mm256_cvtps_ph(_mm256_fmadd_ps(vi3x01234567, vk3x01234567, vacc01234567p1), _MM_FROUND_NO_EXC));
+
+      const __m256 vi4x01234567 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i4));
+      i4 += 8;
+
+      const __m256 vk4x01234567 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) (w + 40)));
+      vacc01234567p0 = _mm256_cvtph_ps(_mm256_cvtps_ph(_mm256_fmadd_ps(vi4x01234567, vk4x01234567, vacc01234567p0), _MM_FROUND_NO_EXC));
+
+      const __m256 vi5x01234567 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i5));
+      i5 += 8;
+
+      const __m256 vk5x01234567 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) (w + 48)));
+      vacc01234567p1 = _mm256_cvtph_ps(_mm256_cvtps_ph(_mm256_fmadd_ps(vi5x01234567, vk5x01234567, vacc01234567p1), _MM_FROUND_NO_EXC));
+
+      const __m256 vi6x01234567 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i6));
+      i6 += 8;
+
+      const __m256 vk6x01234567 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) (w + 56)));
+      vacc01234567p0 = _mm256_cvtph_ps(_mm256_cvtps_ph(_mm256_fmadd_ps(vi6x01234567, vk6x01234567, vacc01234567p0), _MM_FROUND_NO_EXC));
+
+      const __m256 vi7x01234567 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i7));
+      i7 += 8;
+
+      const __m256 vk7x01234567 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) (w + 64)));
+      vacc01234567p1 = _mm256_cvtph_ps(_mm256_cvtps_ph(_mm256_fmadd_ps(vi7x01234567, vk7x01234567, vacc01234567p1), _MM_FROUND_NO_EXC));
+
+      const __m256 vi8x01234567 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i8));
+      i8 += 8;
+
+      const __m256 vk8x01234567 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) (w + 72)));
+      vacc01234567p0 = _mm256_cvtph_ps(_mm256_cvtps_ph(_mm256_fmadd_ps(vi8x01234567, vk8x01234567, vacc01234567p0), _MM_FROUND_NO_EXC));
+
+      const __m256 vi9x01234567 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i9));
+      i9 += 8;
+
+      const __m256 vk9x01234567 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) (w + 80)));
+      vacc01234567p1 = _mm256_cvtph_ps(_mm256_cvtps_ph(_mm256_fmadd_ps(vi9x01234567, vk9x01234567, vacc01234567p1), _MM_FROUND_NO_EXC));
+
+      const __m256 vi10x01234567 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i10));
+      i10 += 8;
+
+      const __m256 vk10x01234567 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) (w + 88)));
+      vacc01234567p0 = _mm256_cvtph_ps(_mm256_cvtps_ph(_mm256_fmadd_ps(vi10x01234567, vk10x01234567, vacc01234567p0), _MM_FROUND_NO_EXC));
+
+      const __m256 vi11x01234567 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i11));
+      i11 += 8;
+
+      const __m256 vk11x01234567 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) (w + 96)));
+      vacc01234567p1 = _mm256_cvtph_ps(_mm256_cvtps_ph(_mm256_fmadd_ps(vi11x01234567, vk11x01234567, vacc01234567p1), _MM_FROUND_NO_EXC));
+
+      const __m256 vi12x01234567 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i12));
+      i12 += 8;
+
+      const __m256 vk12x01234567 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) (w + 104)));
+      vacc01234567p0 = _mm256_cvtph_ps(_mm256_cvtps_ph(_mm256_fmadd_ps(vi12x01234567, vk12x01234567, vacc01234567p0), _MM_FROUND_NO_EXC));
+
+      const __m256 vi13x01234567 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i13));
+      i13 += 8;
+
+      const __m256 vk13x01234567 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) (w + 112)));
+      vacc01234567p1 = _mm256_cvtph_ps(_mm256_cvtps_ph(_mm256_fmadd_ps(vi13x01234567, vk13x01234567, vacc01234567p1), _MM_FROUND_NO_EXC));
+
+      const __m256 vi14x01234567 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i14));
+      i14 += 8;
+
+      const __m256 vk14x01234567 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) (w + 120)));
+      vacc01234567p0 = _mm256_cvtph_ps(_mm256_cvtps_ph(_mm256_fmadd_ps(vi14x01234567, vk14x01234567, vacc01234567p0), _MM_FROUND_NO_EXC));
+
+      const __m256 vi15x01234567 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i15));
+      i15 += 8;
+
+      const __m256 vk15x01234567 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) (w + 128)));
+      vacc01234567p1 = _mm256_cvtph_ps(_mm256_cvtps_ph(_mm256_fmadd_ps(vi15x01234567, vk15x01234567, vacc01234567p1), _MM_FROUND_NO_EXC));
+
+      const __m256 vi16x01234567 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i16));
+      i16 += 8;
+
+      const __m256 vk16x01234567 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) (w + 136)));
+      vacc01234567p0 = _mm256_cvtph_ps(_mm256_cvtps_ph(_mm256_fmadd_ps(vi16x01234567, vk16x01234567, vacc01234567p0), _MM_FROUND_NO_EXC));
+
+      const __m256 vi17x01234567 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i17));
+      i17 += 8;
+
+      const __m256 vk17x01234567 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) (w + 144)));
+      vacc01234567p1 = _mm256_cvtph_ps(_mm256_cvtps_ph(_mm256_fmadd_ps(vi17x01234567, vk17x01234567, vacc01234567p1), _MM_FROUND_NO_EXC));
+
+      const __m256 vi18x01234567 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i18));
+      i18 += 8;
+
+      const __m256 vk18x01234567 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) (w + 152)));
+      vacc01234567p0 = _mm256_cvtph_ps(_mm256_cvtps_ph(_mm256_fmadd_ps(vi18x01234567, vk18x01234567, vacc01234567p0), _MM_FROUND_NO_EXC));
+
+      const __m256 vi19x01234567 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i19));
+      i19 += 8;
+
+      const __m256 vk19x01234567 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) (w + 160)));
+      vacc01234567p1 = _mm256_cvtph_ps(_mm256_cvtps_ph(_mm256_fmadd_ps(vi19x01234567, vk19x01234567, vacc01234567p1), _MM_FROUND_NO_EXC));
+
+      const __m256 vi20x01234567 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i20));
+      i20 += 8;
+
+      const __m256 vk20x01234567 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) (w + 168)));
+      vacc01234567p0 = _mm256_cvtph_ps(_mm256_cvtps_ph(_mm256_fmadd_ps(vi20x01234567, vk20x01234567, vacc01234567p0), _MM_FROUND_NO_EXC));
+
+      const __m256 vi21x01234567 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i21));
+      i21 += 8;
+
+      const __m256 vk21x01234567 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) (w + 176)));
+      vacc01234567p1 = _mm256_cvtph_ps(_mm256_cvtps_ph(_mm256_fmadd_ps(vi21x01234567, vk21x01234567, vacc01234567p1), _MM_FROUND_NO_EXC));
+
+      const __m256 vi22x01234567 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i22));
+      i22 += 8;
+
+      const __m256 vk22x01234567 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) (w + 184)));
+      vacc01234567p0 = _mm256_cvtph_ps(_mm256_cvtps_ph(_mm256_fmadd_ps(vi22x01234567, vk22x01234567, vacc01234567p0), _MM_FROUND_NO_EXC));
+
+      const __m256 vi23x01234567 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i23));
+      i23 += 8;
+
+      const __m256 vk23x01234567 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) (w + 192)));
+      vacc01234567p1 = _mm256_cvtph_ps(_mm256_cvtps_ph(_mm256_fmadd_ps(vi23x01234567, vk23x01234567, vacc01234567p1), _MM_FROUND_NO_EXC));
+
+      const __m256 vi24x01234567 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i24));
+      i24 += 8;
+
+      const __m256 vk24x01234567 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) (w + 200)));
+      vacc01234567p0 = _mm256_cvtph_ps(_mm256_cvtps_ph(_mm256_fmadd_ps(vi24x01234567, vk24x01234567, vacc01234567p0), _MM_FROUND_NO_EXC));
+
+      w += 208;
+
+      // Add up all accumulators to vacc01234567p0
+      vacc01234567p0 = _mm256_cvtph_ps(_mm256_cvtps_ph(_mm256_add_ps(vacc01234567p0, vacc01234567p1), _MM_FROUND_NO_EXC));
+
+      __m256 vacc01234567 = _mm256_max_ps(vacc01234567p0, vmin);
+      vacc01234567 = _mm256_min_ps(vacc01234567, vmax);
+
+      _mm_storeu_si128((__m128i*) o, _mm256_cvtps_ph(vacc01234567, _MM_FROUND_NO_EXC));
+      o += 8;
+    }
+    if XNN_UNLIKELY(c != 0) {
+      assert(c >= 1);
+      assert(c <= 7);
+
+      __m256 vacc01234567p0 = _mm256_cvtph_ps(_mm_load_si128((const __m128i*) w));
+
+      const __m256 vi0x01234567 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i0));
+
+      const __m256 vk0x01234567 = _mm256_cvtph_ps(_mm_load_si128((const __m128i*) (w + 8)));
+      vacc01234567p0 = _mm256_cvtph_ps(_mm256_cvtps_ph(_mm256_fmadd_ps(vi0x01234567, vk0x01234567, vacc01234567p0), _MM_FROUND_NO_EXC));
+
+      const __m256 vi1x01234567 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i1));
+
+      const __m256 vk1x01234567 = _mm256_cvtph_ps(_mm_load_si128((const __m128i*) (w + 16)));
+      __m256 vacc01234567p1 = _mm256_cvtph_ps(_mm256_cvtps_ph(_mm256_mul_ps(vi1x01234567, vk1x01234567), _MM_FROUND_NO_EXC));
+
+      const __m256 vi2x01234567 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i2));
+
+      const __m256 vk2x01234567 = _mm256_cvtph_ps(_mm_load_si128((const __m128i*) (w + 24)));
+      vacc01234567p0 = _mm256_cvtph_ps(_mm256_cvtps_ph(_mm256_fmadd_ps(vi2x01234567, vk2x01234567, vacc01234567p0), _MM_FROUND_NO_EXC));
+
+      const __m256 vi3x01234567 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i3));
+
+      const __m256 vk3x01234567 = _mm256_cvtph_ps(_mm_load_si128((const __m128i*) (w + 32)));
+      vacc01234567p1 = _mm256_cvtph_ps(_mm256_cvtps_ph(_mm256_fmadd_ps(vi3x01234567, vk3x01234567, vacc01234567p1), _MM_FROUND_NO_EXC));
+
+      const __m256 vi4x01234567 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i4));
+
+      const __m256 vk4x01234567 = _mm256_cvtph_ps(_mm_load_si128((const __m128i*) (w + 40)));
+      vacc01234567p0 = _mm256_cvtph_ps(_mm256_cvtps_ph(_mm256_fmadd_ps(vi4x01234567, vk4x01234567, vacc01234567p0), _MM_FROUND_NO_EXC));
+
+      const __m256 vi5x01234567 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i5));
+
+      const __m256 vk5x01234567 = _mm256_cvtph_ps(_mm_load_si128((const __m128i*) (w + 48)));
+      vacc01234567p1 = _mm256_cvtph_ps(_mm256_cvtps_ph(_mm256_fmadd_ps(vi5x01234567, vk5x01234567, vacc01234567p1), _MM_FROUND_NO_EXC));
+
+      const __m256 vi6x01234567 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i6));
+
+      const __m256 vk6x01234567 = _mm256_cvtph_ps(_mm_load_si128((const __m128i*) (w + 56)));
+      vacc01234567p0 = _mm256_cvtph_ps(_mm256_cvtps_ph(_mm256_fmadd_ps(vi6x01234567, vk6x01234567, vacc01234567p0), _MM_FROUND_NO_EXC));
+
+      const __m256 vi7x01234567 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i7));
+
+      const __m256 vk7x01234567 = _mm256_cvtph_ps(_mm_load_si128((const __m128i*) (w + 64)));
+      vacc01234567p1 = _mm256_cvtph_ps(_mm256_cvtps_ph(_mm256_fmadd_ps(vi7x01234567, vk7x01234567, vacc01234567p1), _MM_FROUND_NO_EXC));
+
+      const __m256 vi8x01234567 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i8));
+
+      const __m256 vk8x01234567 = _mm256_cvtph_ps(_mm_load_si128((const __m128i*) (w + 72)));
+      vacc01234567p0 = _mm256_cvtph_ps(_mm256_cvtps_ph(_mm256_fmadd_ps(vi8x01234567, vk8x01234567, vacc01234567p0), _MM_FROUND_NO_EXC));
+
+      const __m256 vi9x01234567 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i9));
+
+      const __m256 vk9x01234567 = _mm256_cvtph_ps(_mm_load_si128((const __m128i*) (w + 80)));
+      vacc01234567p1 = _mm256_cvtph_ps(_mm256_cvtps_ph(_mm256_fmadd_ps(vi9x01234567, vk9x01234567, vacc01234567p1), _MM_FROUND_NO_EXC));
+
+      const __m256 vi10x01234567 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i10));
+
+      const __m256 vk10x01234567 = _mm256_cvtph_ps(_mm_load_si128((const __m128i*) (w + 88)));
+      vacc01234567p0 = _mm256_cvtph_ps(_mm256_cvtps_ph(_mm256_fmadd_ps(vi10x01234567, vk10x01234567, vacc01234567p0), _MM_FROUND_NO_EXC));
+
+      const __m256 vi11x01234567 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i11));
+
+      const __m256 vk11x01234567 = _mm256_cvtph_ps(_mm_load_si128((const __m128i*) (w + 96)));
+      vacc01234567p1 = _mm256_cvtph_ps(_mm256_cvtps_ph(_mm256_fmadd_ps(vi11x01234567, vk11x01234567, vacc01234567p1), _MM_FROUND_NO_EXC));
+
+      const __m256 vi12x01234567 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i12));
+
+      const __m256 vk12x01234567 = _mm256_cvtph_ps(_mm_load_si128((const __m128i*) (w + 104)));
+      vacc01234567p0 = _mm256_cvtph_ps(_mm256_cvtps_ph(_mm256_fmadd_ps(vi12x01234567, vk12x01234567, vacc01234567p0), _MM_FROUND_NO_EXC));
+
+      const __m256 vi13x01234567 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i13));
+
+      const __m256 vk13x01234567 = _mm256_cvtph_ps(_mm_load_si128((const __m128i*) (w + 112)));
+      vacc01234567p1 = _mm256_cvtph_ps(_mm256_cvtps_ph(_mm256_fmadd_ps(vi13x01234567, vk13x01234567, vacc01234567p1), _MM_FROUND_NO_EXC));
+
+      const __m256 vi14x01234567 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i14));
+
+      const __m256 vk14x01234567 = _mm256_cvtph_ps(_mm_load_si128((const __m128i*) (w + 120)));
+      vacc01234567p0 = _mm256_cvtph_ps(_mm256_cvtps_ph(_mm256_fmadd_ps(vi14x01234567, vk14x01234567, vacc01234567p0), _MM_FROUND_NO_EXC));
+
+      const __m256 vi15x01234567 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i15));
+
+      const __m256 vk15x01234567 = _mm256_cvtph_ps(_mm_load_si128((const __m128i*) (w + 128)));
+      vacc01234567p1 = _mm256_cvtph_ps(_mm256_cvtps_ph(_mm256_fmadd_ps(vi15x01234567, vk15x01234567, vacc01234567p1), _MM_FROUND_NO_EXC));
+
+      const __m256 vi16x01234567 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i16));
+
+      const __m256 vk16x01234567 = _mm256_cvtph_ps(_mm_load_si128((const __m128i*) (w + 136)));
+      vacc01234567p0 = _mm256_cvtph_ps(_mm256_cvtps_ph(_mm256_fmadd_ps(vi16x01234567, vk16x01234567, vacc01234567p0), _MM_FROUND_NO_EXC));
+
+      const __m256 vi17x01234567 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i17));
+
+      const __m256 vk17x01234567 = _mm256_cvtph_ps(_mm_load_si128((const __m128i*) (w + 144)));
+      vacc01234567p1 = _mm256_cvtph_ps(_mm256_cvtps_ph(_mm256_fmadd_ps(vi17x01234567, vk17x01234567, vacc01234567p1), _MM_FROUND_NO_EXC));
+
+      const __m256 vi18x01234567 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i18));
+
+      const __m256 vk18x01234567 = _mm256_cvtph_ps(_mm_load_si128((const __m128i*) (w + 152)));
+      vacc01234567p0 = _mm256_cvtph_ps(_mm256_cvtps_ph(_mm256_fmadd_ps(vi18x01234567, vk18x01234567, vacc01234567p0), _MM_FROUND_NO_EXC));
+
+      const __m256 vi19x01234567 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i19));
+
+      const __m256 vk19x01234567 = _mm256_cvtph_ps(_mm_load_si128((const __m128i*) (w + 160)));
+      vacc01234567p1 = _mm256_cvtph_ps(_mm256_cvtps_ph(_mm256_fmadd_ps(vi19x01234567, vk19x01234567, vacc01234567p1), _MM_FROUND_NO_EXC));
+
+      const __m256 vi20x01234567 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i20));
+
+      const __m256 vk20x01234567 = _mm256_cvtph_ps(_mm_load_si128((const __m128i*) (w + 168)));
+      vacc01234567p0 = _mm256_cvtph_ps(_mm256_cvtps_ph(_mm256_fmadd_ps(vi20x01234567, vk20x01234567, vacc01234567p0), _MM_FROUND_NO_EXC));
+
+      const __m256 vi21x01234567 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i21));
+
+      const __m256 vk21x01234567 = _mm256_cvtph_ps(_mm_load_si128((const __m128i*) (w + 176)));
+      vacc01234567p1 = _mm256_cvtph_ps(_mm256_cvtps_ph(_mm256_fmadd_ps(vi21x01234567, vk21x01234567, vacc01234567p1), _MM_FROUND_NO_EXC));
+
+      const __m256 vi22x01234567 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i22));
+
+      const __m256 vk22x01234567 = _mm256_cvtph_ps(_mm_load_si128((const __m128i*) (w + 184)));
+      vacc01234567p0 = _mm256_cvtph_ps(_mm256_cvtps_ph(_mm256_fmadd_ps(vi22x01234567, vk22x01234567, vacc01234567p0), _MM_FROUND_NO_EXC));
+
+      const __m256 vi23x01234567 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i23));
+
+      const __m256 vk23x01234567 = _mm256_cvtph_ps(_mm_load_si128((const __m128i*) (w + 192)));
+      vacc01234567p1 = _mm256_cvtph_ps(_mm256_cvtps_ph(_mm256_fmadd_ps(vi23x01234567, vk23x01234567, vacc01234567p1), _MM_FROUND_NO_EXC));
+
+      const __m256 vi24x01234567 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i24));
+
+      const __m256 vk24x01234567 = _mm256_cvtph_ps(_mm_load_si128((const __m128i*) (w + 200)));
+      vacc01234567p0 = _mm256_cvtph_ps(_mm256_cvtps_ph(_mm256_fmadd_ps(vi24x01234567, vk24x01234567, vacc01234567p0), _MM_FROUND_NO_EXC));
+
+      // Add up all accumulators to vacc01234567p0
+      vacc01234567p0 = _mm256_cvtph_ps(_mm256_cvtps_ph(_mm256_add_ps(vacc01234567p0, vacc01234567p1), _MM_FROUND_NO_EXC));
+
+      __m256 vacc01234567 = _mm256_max_ps(vacc01234567p0, vmin);
+      vacc01234567 = _mm256_min_ps(vacc01234567, vmax);
+
+      __m128i vh01234567 = _mm256_cvtps_ph(vacc01234567, _MM_FROUND_NO_EXC);
+      if (c & 4) {
+        _mm_storel_epi64((__m128i*) o, vh01234567);
+        vh01234567 = _mm_unpackhi_epi64(vh01234567, vh01234567);
+        o += 4;
+      }
+      if (c & 2) {
+        *((uint32_t*) o) = (uint32_t) _mm_cvtsi128_si32(vh01234567);
+        vh01234567 = _mm_srli_epi64(vh01234567, 32);
+        o += 2;
+      }
+      if (c & 1) {
+        *((uint16_t*) o) = (uint16_t) _mm_extract_epi16(vh01234567, 0);
+        o += 1;
+      }
+    }
+
+    o = (uint16_t*) ((uintptr_t) o + output_increment);
+  } while (--output_width != 0);
+}
+
+void xnn_f16_vmulcaddc_minmax_ukernel_c8__fma3_2x(
+    size_t rows,
+    size_t channels,
+    const void*restrict input,
+    size_t input_stride,
+    const void*restrict weights,
+    void*restrict output,
+    size_t output_stride,
+    const union xnn_f16_minmax_params params[restrict XNN_MIN_ELEMENTS(1)]) XNN_OOB_READS
+{
+  assert(rows != 0);
+  assert(channels != 0);
+  assert(channels % sizeof(uint16_t) == 0);
+
+  const uint16_t* i0 = (const uint16_t*) input;
+  uint16_t* o0 = (uint16_t*) output;
+  const uint16_t* i1 = (const uint16_t*) ((uintptr_t) i0 + input_stride);
+  uint16_t* o1 = (uint16_t*) ((uintptr_t) o0 + output_stride);
+
+  const size_t input_increment = input_stride * 2 - channels;
+  const size_t output_increment = output_stride * 2 - channels;
+
+  const __m256 vmin = _mm256_load_ps(params->avx.min);
+  const __m256 vmax = _mm256_load_ps(params->avx.max);
+  do {
+    if XNN_UNPREDICTABLE(rows < 2) {
+      i1 = i0;
+      o1 = o0;
+    }
+
+    const uint16_t* w = (const uint16_t*) weights;
+    size_t c = channels;
+    for (; c >= 8 * sizeof(uint16_t); c -= 8 * sizeof(uint16_t)) {
+      const __m256 vscale = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) w));
+
+      __m256 vacc0 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i0));
+      i0 += 8;
+      __m256 vacc1 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i1));
+      i1 += 8;
+
+      const __m256 vbias = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) (w + 8)));
+      w += 16;
+
+      vacc0 = _mm256_fmadd_ps(vacc0, vscale, vbias);
+      vacc1 = _mm256_fmadd_ps(vacc1, vscale, vbias);
+
+      vacc0 = _mm256_max_ps(vacc0, vmin);
+      vacc1 = _mm256_max_ps(vacc1, vmin);
+
+      vacc0 = _mm256_min_ps(vacc0, vmax);
+      vacc1 = _mm256_min_ps(vacc1, vmax);
+
+      _mm_storeu_si128((__m128i*) o0, _mm256_cvtps_ph(vacc0, _MM_FROUND_NO_EXC));
+      o0 += 8;
+      _mm_storeu_si128((__m128i*) o1, _mm256_cvtps_ph(vacc1, _MM_FROUND_NO_EXC));
+      o1 += 8;
+    }
+    if XNN_UNLIKELY(c != 0) {
+      const __m256 vscale = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) w));
+
+      __m256 vacc0 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i0));
+      i0 = (const uint16_t*) ((uintptr_t) i0 + c);
+      __m256 vacc1 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i1));
+      i1 = (const uint16_t*) ((uintptr_t) i1 + c);
+
+      const __m256 vbias = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) (w + 8)));
+
+      vacc0 = _mm256_fmadd_ps(vacc0, vscale, vbias);
+      vacc1 = _mm256_fmadd_ps(vacc1, vscale, vbias);
+
+      vacc0 = _mm256_max_ps(vacc0, vmin);
+      vacc1 = _mm256_max_ps(vacc1, vmin);
+
+      vacc0 = _mm256_min_ps(vacc0, vmax);
+      vacc1 = _mm256_min_ps(vacc1, vmax);
+
+      __m128i vh0 = _mm256_cvtps_ph(vacc0, _MM_FROUND_NO_EXC);
+      __m128i vh1 = _mm256_cvtps_ph(vacc1, _MM_FROUND_NO_EXC);
+
+      if (c & (4 * sizeof(uint16_t))) {
+        _mm_storel_epi64((__m128i*) o0, vh0);
+        _mm_storel_epi64((__m128i*) o1, vh1);
+
+        vh0 = _mm_unpackhi_epi64(vh0, vh0);
+        vh1 = _mm_unpackhi_epi64(vh1, vh1);
+
+        o0 += 4;
+        o1 += 4;
+      }
+      if (c & (2 * sizeof(uint16_t))) {
+        *((uint32_t*) o0) = (uint32_t) _mm_cvtsi128_si32(vh0);
+        *((uint32_t*) o1) = (uint32_t) _mm_cvtsi128_si32(vh1);
+
+        vh0 = _mm_srli_epi64(vh0, 32);
+        vh1 = _mm_srli_epi64(vh1, 32);
+
+        o0 += 2;
+        o1 += 2;
+      }
+      if (c & (1 * sizeof(uint16_t))) {
+        *o0 = (uint16_t) _mm_extract_epi16(vh0, 0);
+        *o1 = (uint16_t) _mm_extract_epi16(vh1, 0);
+
+        o0 += 1;
+        o1 += 1;
+      }
+    }
+    i0 = (const uint16_t*) ((uintptr_t) i0 + input_increment);
+    o0 = (uint16_t*) ((uintptr_t) o0 + output_increment);
+    i1 = (const uint16_t*) ((uintptr_t) i1 + input_increment);
+    o1 = (uint16_t*) ((uintptr_t) o1 + output_increment);
+    rows = doz(rows, 2);
+  } while (rows != 0);
+}
+
+void xnn_f32_conv_hwc_ukernel_3x3s2p0p1c3x16__fma3_2x2(
+    size_t input_height,
+    size_t input_width,
+    size_t output_y_start,
+    size_t output_y_end,
+    const float* input,
+    const float* zero,
+    const float* weights,
+    float* output,
+    size_t input_padding_top,
+    size_t output_channels,
+    size_t output_height_stride,
+    size_t output_width_stride,
+    const union xnn_f32_minmax_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(input_width > 1);
+  assert(output_y_end > output_y_start);
+  assert(input_padding_top <= 1);
+  assert(output_channels != 0);
+
+  const size_t input_height_stride = input_width * 3 /* channels */ * sizeof(float);
+  const size_t input_width_decrement = round_down_po2(input_width - 1, 2) * 3 /* channels */ * sizeof(float);
+  const size_t output_width = input_width / 2;
+  const size_t output_channel_decrement = output_width * output_width_stride - 16 * sizeof(float);
+  const size_t output_height_increment = output_height_stride * 2 - round_up_po2(output_channels, 16) * sizeof(float);
+
+  // Adjustment for padding processed below
+  const float* i0 = (const float*) ((uintptr_t) input +
+    input_height_stride * (output_y_start * 2 /* vertical stride */ - input_padding_top));
+  const float* i1 = (const float*) ((uintptr_t) i0 + input_height_stride);
+  const float* i2 = (const float*) ((uintptr_t) i1 + input_height_stride);
+  const float* i3 = (const float*) ((uintptr_t) i2 + input_height_stride);
+  const float* i4 = (const float*) ((uintptr_t) i3 + input_height_stride);
+  float* o0 = (float*) ((uintptr_t) output + output_height_stride * output_y_start);
+  float* o1 = (float*) ((uintptr_t) o0 + output_height_stride);
+
+  if XNN_UNPREDICTABLE(output_y_start < input_padding_top) {
+    i0 = zero;
+  }
+
+  const __m256 vmin = _mm256_load_ps(params->avx.min);
+  const __m256 vmax = _mm256_load_ps(params->avx.max);
+
+  for (size_t output_y = output_y_start; output_y < output_y_end; output_y += 2) {
+    const size_t input_y2 = output_y * 2 + 2 - input_padding_top;
+    const size_t input_y4 = input_y2 + 2;
+    if XNN_UNPREDICTABLE(input_y2 > input_height) {
+      i1 = zero;
+    }
+    if XNN_UNPREDICTABLE(input_y2 >= input_height) {
+      i2 = zero;
+    }
+    if XNN_UNPREDICTABLE(input_y4 > input_height) {
+      i3 = zero;
+    }
+    if XNN_UNPREDICTABLE(input_y4 >= input_height) {
+      i4 = zero;
+    }
+    if XNN_UNPREDICTABLE(output_y + 2 > output_y_end) {
+      o1 = o0;
+    }
+
+    const float* w = weights;
+    size_t c = output_channels;
+    do {
+      // voMx0 accumulates the leftmost output pixel of the next block. The input column to the left of it
+      // is either padding, or was already accumulated at the end of the previous block.
+      __m256 vo0x0c01234567 = _mm256_load_ps(w + 0);
+      __m256 vo0x0c89ABCDEF = _mm256_load_ps(w + 8);
+      __m256 vo1x0c01234567 = vo0x0c01234567;
+      __m256 vo1x0c89ABCDEF = vo0x0c89ABCDEF;
+
+      // No padding on the left: the first input column contributes only through the left column of the kernel.
+      const __m256 vi0c0 = _mm256_broadcast_ss(i0 + 0);
+      vo0x0c01234567 = _mm256_fmadd_ps(_mm256_load_ps(w + 16), vi0c0, vo0x0c01234567);
+      vo0x0c89ABCDEF = _mm256_fmadd_ps(_mm256_load_ps(w + 24), vi0c0, vo0x0c89ABCDEF);
+      const __m256 vi1c0 = _mm256_broadcast_ss(i1 + 0);
+      vo0x0c01234567 = _mm256_fmadd_ps(_mm256_load_ps(w + 32), vi1c0, vo0x0c01234567);
+      vo0x0c89ABCDEF = _mm256_fmadd_ps(_mm256_load_ps(w + 40), vi1c0, vo0x0c89ABCDEF);
+      const __m256 vi2c0 = _mm256_broadcast_ss(i2 + 0);
+      vo0x0c01234567 = _mm256_fmadd_ps(_mm256_load_ps(w + 48), vi2c0, vo0x0c01234567);
+      vo0x0c89ABCDEF = _mm256_fmadd_ps(_mm256_load_ps(w + 56), vi2c0, vo0x0c89ABCDEF);
+      vo1x0c01234567 = _mm256_fmadd_ps(_mm256_load_ps(w + 16), vi2c0, vo1x0c01234567);
+      vo1x0c89ABCDEF = _mm256_fmadd_ps(_mm256_load_ps(w + 24), vi2c0, vo1x0c89ABCDEF);
+      const __m256 vi3c0 = _mm256_broadcast_ss(i3 + 0);
+      vo1x0c01234567 = _mm256_fmadd_ps(_mm256_load_ps(w + 32), vi3c0, vo1x0c01234567);
+      vo1x0c89ABCDEF = _mm256_fmadd_ps(_mm256_load_ps(w + 40), vi3c0, vo1x0c89ABCDEF);
+      const __m256 vi4c0 = _mm256_broadcast_ss(i4 + 0);
+      vo1x0c01234567 = _mm256_fmadd_ps(_mm256_load_ps(w + 48), vi4c0, vo1x0c01234567);
+      vo1x0c89ABCDEF = _mm256_fmadd_ps(_mm256_load_ps(w + 56), vi4c0, vo1x0c89ABCDEF);
+      const __m256 vi0c1 = _mm256_broadcast_ss(i0 + 1);
+      vo0x0c01234567 = _mm256_fmadd_ps(_mm256_load_ps(w + 64), vi0c1, vo0x0c01234567);
+      vo0x0c89ABCDEF = _mm256_fmadd_ps(_mm256_load_ps(w + 72), vi0c1, vo0x0c89ABCDEF);
+      const __m256 vi1c1 = _mm256_broadcast_ss(i1 + 1);
+      vo0x0c01234567 = _mm256_fmadd_ps(_mm256_load_ps(w + 80), vi1c1, vo0x0c01234567);
+      vo0x0c89ABCDEF = _mm256_fmadd_ps(_mm256_load_ps(w + 88), vi1c1, vo0x0c89ABCDEF);
+      const __m256 vi2c1 = _mm256_broadcast_ss(i2 + 1);
+      vo0x0c01234567 = _mm256_fmadd_ps(_mm256_load_ps(w + 96), vi2c1, vo0x0c01234567);
+      vo0x0c89ABCDEF = _mm256_fmadd_ps(_mm256_load_ps(w + 104), vi2c1, vo0x0c89ABCDEF);
+      vo1x0c01234567 = _mm256_fmadd_ps(_mm256_load_ps(w + 64), vi2c1, vo1x0c01234567);
+      vo1x0c89ABCDEF = _mm256_fmadd_ps(_mm256_load_ps(w + 72), vi2c1, vo1x0c89ABCDEF);
+      const __m256 vi3c1 = _mm256_broadcast_ss(i3 + 1);
+      vo1x0c01234567 = _mm256_fmadd_ps(_mm256_load_ps(w + 80), vi3c1, vo1x0c01234567);
+      vo1x0c89ABCDEF = _mm256_fmadd_ps(_mm256_load_ps(w + 88), vi3c1, vo1x0c89ABCDEF);
+      const __m256 vi4c1 = _mm256_broadcast_ss(i4 + 1);
+      vo1x0c01234567 = _mm256_fmadd_ps(_mm256_load_ps(w + 96), vi4c1, vo1x0c01234567);
+      vo1x0c89ABCDEF = _mm256_fmadd_ps(_mm256_load_ps(w + 104), vi4c1, vo1x0c89ABCDEF);
+      const __m256 vi0c2 = _mm256_broadcast_ss(i0 + 2);
+      vo0x0c01234567 = _mm256_fmadd_ps(_mm256_load_ps(w + 112), vi0c2, vo0x0c01234567);
+      vo0x0c89ABCDEF = _mm256_fmadd_ps(_mm256_load_ps(w + 120), vi0c2, vo0x0c89ABCDEF);
+      const __m256 vi1c2 = _mm256_broadcast_ss(i1 + 2);
+      vo0x0c01234567 = _mm256_fmadd_ps(_mm256_load_ps(w + 128), vi1c2, vo0x0c01234567);
+      vo0x0c89ABCDEF = _mm256_fmadd_ps(_mm256_load_ps(w + 136), vi1c2, vo0x0c89ABCDEF);
+      const __m256 vi2c2 = _mm256_broadcast_ss(i2 + 2);
+      vo0x0c01234567 = _mm256_fmadd_ps(_mm256_load_ps(w + 144), vi2c2, vo0x0c01234567);
+      vo0x0c89ABCDEF = _mm256_fmadd_ps(_mm256_load_ps(w + 152), vi2c2, vo0x0c89ABCDEF);
+      vo1x0c01234567 = _mm256_fmadd_ps(_mm256_load_ps(w + 112), vi2c2, vo1x0c01234567);
+      vo1x0c89ABCDEF = _mm256_fmadd_ps(_mm256_load_ps(w + 120), vi2c2, vo1x0c89ABCDEF);
+      const __m256 vi3c2 = _mm256_broadcast_ss(i3 + 2);
+      vo1x0c01234567 = _mm256_fmadd_ps(_mm256_load_ps(w + 128), vi3c2, vo1x0c01234567);
+      vo1x0c89ABCDEF = _mm256_fmadd_ps(_mm256_load_ps(w + 136), vi3c2, vo1x0c89ABCDEF);
+      const __m256 vi4c2 = _mm256_broadcast_ss(i4 + 2);
+      vo1x0c01234567 = _mm256_fmadd_ps(_mm256_load_ps(w + 144), vi4c2, vo1x0c01234567);
+      vo1x0c89ABCDEF = _mm256_fmadd_ps(_mm256_load_ps(w + 152), vi4c2, vo1x0c89ABCDEF);
+
+      size_t iw = input_width - 1;
+      for (; iw >= 4; iw -= 4) {
+        __m256 vo0x1c01234567 = _mm256_load_ps(w + 0);
+        __m256 vo0x1c89ABCDEF = _mm256_load_ps(w + 8);
+        __m256 vo1x1c01234567 = vo0x1c01234567;
+        __m256 vo1x1c89ABCDEF = vo0x1c89ABCDEF;
+        __m256 vo0x2c01234567 = vo0x1c01234567;
+        __m256 vo0x2c89ABCDEF = vo0x1c89ABCDEF;
+        __m256 vo1x2c01234567 = vo0x1c01234567;
+        __m256 vo1x2c89ABCDEF = vo0x1c89ABCDEF;
+
+        const __m256 vk01c0x01234567 = _mm256_load_ps(w + 160);
+        const __m256 vk01c0x89ABCDEF = _mm256_load_ps(w + 168);
+        const __m256 vk11c0x01234567 = _mm256_load_ps(w + 176);
+        const __m256 vk11c0x89ABCDEF = _mm256_load_ps(w + 184);
+        const __m256 vk21c0x01234567 = _mm256_load_ps(w + 192);
+        const __m256 vk21c0x89ABCDEF = _mm256_load_ps(w + 200);
+
+        const __m256 vi0x0c0 = _mm256_broadcast_ss(i0 + 3);
+        const __m256 vi0x2c0 = _mm256_broadcast_ss(i0 + 9);
+        vo0x0c01234567 = _mm256_fmadd_ps(vk01c0x01234567, vi0x0c0, vo0x0c01234567);
+        vo0x0c89ABCDEF = _mm256_fmadd_ps(vk01c0x89ABCDEF, vi0x0c0, vo0x0c89ABCDEF);
+        vo0x1c01234567 = _mm256_fmadd_ps(vk01c0x01234567, vi0x2c0, vo0x1c01234567);
+        vo0x1c89ABCDEF = _mm256_fmadd_ps(vk01c0x89ABCDEF, vi0x2c0, vo0x1c89ABCDEF);
+        const __m256 vi1x0c0 = _mm256_broadcast_ss(i1 + 3);
+        const __m256 vi1x2c0 = _mm256_broadcast_ss(i1 + 9);
+        vo0x0c01234567 = _mm256_fmadd_ps(vk11c0x01234567, vi1x0c0, vo0x0c01234567);
+        vo0x0c89ABCDEF = _mm256_fmadd_ps(vk11c0x89ABCDEF, vi1x0c0, vo0x0c89ABCDEF);
+        vo0x1c01234567 = _mm256_fmadd_ps(vk11c0x01234567, vi1x2c0, vo0x1c01234567);
+        vo0x1c89ABCDEF = _mm256_fmadd_ps(vk11c0x89ABCDEF, vi1x2c0, vo0x1c89ABCDEF);
+        const __m256 vi2x0c0 = _mm256_broadcast_ss(i2 + 3);
+        const __m256 vi2x2c0 = _mm256_broadcast_ss(i2 + 9);
+        vo0x0c01234567 = _mm256_fmadd_ps(vk21c0x01234567, vi2x0c0, vo0x0c01234567);
+        vo0x0c89ABCDEF = _mm256_fmadd_ps(vk21c0x89ABCDEF, vi2x0c0, vo0x0c89ABCDEF);
+        vo0x1c01234567 = _mm256_fmadd_ps(vk21c0x01234567, vi2x2c0, vo0x1c01234567);
+        vo0x1c89ABCDEF = _mm256_fmadd_ps(vk21c0x89ABCDEF, vi2x2c0, vo0x1c89ABCDEF);
+        vo1x0c01234567 = _mm256_fmadd_ps(vk01c0x01234567, vi2x0c0, vo1x0c01234567);
+        vo1x0c89ABCDEF = _mm256_fmadd_ps(vk01c0x89ABCDEF, vi2x0c0, vo1x0c89ABCDEF);
+        vo1x1c01234567 = _mm256_fmadd_ps(vk01c0x01234567, vi2x2c0, vo1x1c01234567);
+        vo1x1c89ABCDEF = _mm256_fmadd_ps(vk01c0x89ABCDEF, vi2x2c0, vo1x1c89ABCDEF);
+        const __m256 vi3x0c0 = _mm256_broadcast_ss(i3 + 3);
+        const __m256 vi3x2c0 = _mm256_broadcast_ss(i3 + 9);
+        vo1x0c01234567 = _mm256_fmadd_ps(vk11c0x01234567, vi3x0c0, vo1x0c01234567);
+        vo1x0c89ABCDEF = _mm256_fmadd_ps(vk11c0x89ABCDEF, vi3x0c0, vo1x0c89ABCDEF);
+        vo1x1c01234567 = _mm256_fmadd_ps(vk11c0x01234567, vi3x2c0, vo1x1c01234567);
+        vo1x1c89ABCDEF = _mm256_fmadd_ps(vk11c0x89ABCDEF, vi3x2c0, vo1x1c89ABCDEF);
+        const __m256 vi4x0c0 = _mm256_broadcast_ss(i4 + 3);
+        const __m256 vi4x2c0 = _mm256_broadcast_ss(i4 + 9);
+        vo1x0c01234567 = _mm256_fmadd_ps(vk21c0x01234567, vi4x0c0, vo1x0c01234567);
+        vo1x0c89ABCDEF = _mm256_fmadd_ps(vk21c0x89ABCDEF, vi4x0c0, vo1x0c89ABCDEF);
+        vo1x1c01234567 = _mm256_fmadd_ps(vk21c0x01234567, vi4x2c0, vo1x1c01234567);
+        vo1x1c89ABCDEF = _mm256_fmadd_ps(vk21c0x89ABCDEF, vi4x2c0, vo1x1c89ABCDEF);
+
+        const __m256 vk02c0x01234567 = _mm256_load_ps(w + 304);
+        const __m256 vk02c0x89ABCDEF = _mm256_load_ps(w + 312);
+        const __m256 vk12c0x01234567 = _mm256_load_ps(w + 320);
+        const __m256 vk12c0x89ABCDEF = _mm256_load_ps(w + 328);
+        const __m256 vk22c0x01234567 = _mm256_load_ps(w + 336);
+        const __m256 vk22c0x89ABCDEF = _mm256_load_ps(w + 344);
+        const __m256 vk00c0x01234567 = _mm256_load_ps(w + 16);
+        const __m256 vk00c0x89ABCDEF = _mm256_load_ps(w + 24);
+        const __m256 vk10c0x01234567 = _mm256_load_ps(w + 32);
+        const __m256 vk10c0x89ABCDEF = _mm256_load_ps(w + 40);
+        const __m256 vk20c0x01234567 = _mm256_load_ps(w + 48);
+        const __m256 vk20c0x89ABCDEF = _mm256_load_ps(w + 56);
+
+        const __m256 vi0x1c0 = _mm256_broadcast_ss(i0 + 6);
+        const __m256 vi0x3c0 = _mm256_broadcast_ss(i0 + 12);
+        vo0x0c01234567 = _mm256_fmadd_ps(vk02c0x01234567, vi0x1c0, vo0x0c01234567);
+        vo0x0c89ABCDEF = _mm256_fmadd_ps(vk02c0x89ABCDEF, vi0x1c0, vo0x0c89ABCDEF);
+        vo0x1c01234567 = _mm256_fmadd_ps(vk00c0x01234567, vi0x1c0, vo0x1c01234567);
+        vo0x1c89ABCDEF = _mm256_fmadd_ps(vk00c0x89ABCDEF, vi0x1c0, vo0x1c89ABCDEF);
+        vo0x1c01234567 = _mm256_fmadd_ps(vk02c0x01234567, vi0x3c0, vo0x1c01234567);
+        vo0x1c89ABCDEF = _mm256_fmadd_ps(vk02c0x89ABCDEF, vi0x3c0, vo0x1c89ABCDEF);
+        vo0x2c01234567 = _mm256_fmadd_ps(vk00c0x01234567, vi0x3c0, vo0x2c01234567);
+        vo0x2c89ABCDEF = _mm256_fmadd_ps(vk00c0x89ABCDEF, vi0x3c0, vo0x2c89ABCDEF);
+        const __m256 vi1x1c0 = _mm256_broadcast_ss(i1 + 6);
+        const __m256 vi1x3c0 = _mm256_broadcast_ss(i1 + 12);
+        vo0x0c01234567 = _mm256_fmadd_ps(vk12c0x01234567, vi1x1c0, vo0x0c01234567);
+        vo0x0c89ABCDEF = _mm256_fmadd_ps(vk12c0x89ABCDEF, vi1x1c0, vo0x0c89ABCDEF);
+        vo0x1c01234567 = _mm256_fmadd_ps(vk10c0x01234567, vi1x1c0, vo0x1c01234567);
+        vo0x1c89ABCDEF = _mm256_fmadd_ps(vk10c0x89ABCDEF, vi1x1c0, vo0x1c89ABCDEF);
+        vo0x1c01234567 = _mm256_fmadd_ps(vk12c0x01234567, vi1x3c0, vo0x1c01234567);
+        vo0x1c89ABCDEF = _mm256_fmadd_ps(vk12c0x89ABCDEF, vi1x3c0, vo0x1c89ABCDEF);
+        vo0x2c01234567 = _mm256_fmadd_ps(vk10c0x01234567, vi1x3c0, vo0x2c01234567);
+        vo0x2c89ABCDEF = _mm256_fmadd_ps(vk10c0x89ABCDEF, vi1x3c0, vo0x2c89ABCDEF);
+        const __m256 vi2x1c0 = _mm256_broadcast_ss(i2 + 6);
+        const __m256 vi2x3c0 = _mm256_broadcast_ss(i2 + 12);
+        vo0x0c01234567 = _mm256_fmadd_ps(vk22c0x01234567, vi2x1c0, vo0x0c01234567);
+        vo0x0c89ABCDEF = _mm256_fmadd_ps(vk22c0x89ABCDEF, vi2x1c0, vo0x0c89ABCDEF);
+        vo0x1c01234567 = _mm256_fmadd_ps(vk20c0x01234567, vi2x1c0, vo0x1c01234567);
+        vo0x1c89ABCDEF = _mm256_fmadd_ps(vk20c0x89ABCDEF, vi2x1c0, vo0x1c89ABCDEF);
+        vo0x1c01234567 = _mm256_fmadd_ps(vk22c0x01234567, vi2x3c0, vo0x1c01234567);
+        vo0x1c89ABCDEF = _mm256_fmadd_ps(vk22c0x89ABCDEF, vi2x3c0, vo0x1c89ABCDEF);
+        vo0x2c01234567 = _mm256_fmadd_ps(vk20c0x01234567, vi2x3c0, vo0x2c01234567);
+        vo0x2c89ABCDEF = _mm256_fmadd_ps(vk20c0x89ABCDEF, vi2x3c0, vo0x2c89ABCDEF);
+        vo1x0c01234567 = _mm256_fmadd_ps(vk02c0x01234567, vi2x1c0, vo1x0c01234567);
+        vo1x0c89ABCDEF = _mm256_fmadd_ps(vk02c0x89ABCDEF, vi2x1c0, vo1x0c89ABCDEF);
+        vo1x1c01234567 = _mm256_fmadd_ps(vk00c0x01234567, vi2x1c0, vo1x1c01234567);
+        vo1x1c89ABCDEF = _mm256_fmadd_ps(vk00c0x89ABCDEF, vi2x1c0, vo1x1c89ABCDEF);
+        vo1x1c01234567 = _mm256_fmadd_ps(vk02c0x01234567, vi2x3c0, vo1x1c01234567);
+        vo1x1c89ABCDEF = _mm256_fmadd_ps(vk02c0x89ABCDEF, vi2x3c0, vo1x1c89ABCDEF);
+        vo1x2c01234567 = _mm256_fmadd_ps(vk00c0x01234567, vi2x3c0, vo1x2c01234567);
+        vo1x2c89ABCDEF = _mm256_fmadd_ps(vk00c0x89ABCDEF, vi2x3c0, vo1x2c89ABCDEF);
+        const __m256 vi3x1c0 = _mm256_broadcast_ss(i3 + 6);
+        const __m256 vi3x3c0 = _mm256_broadcast_ss(i3 + 12);
+        vo1x0c01234567 = _mm256_fmadd_ps(vk12c0x01234567, vi3x1c0, vo1x0c01234567);
+        vo1x0c89ABCDEF = _mm256_fmadd_ps(vk12c0x89ABCDEF, vi3x1c0, vo1x0c89ABCDEF);
+        vo1x1c01234567 = _mm256_fmadd_ps(vk10c0x01234567, vi3x1c0, vo1x1c01234567);
+        vo1x1c89ABCDEF = _mm256_fmadd_ps(vk10c0x89ABCDEF, vi3x1c0, vo1x1c89ABCDEF);
+        vo1x1c01234567 = _mm256_fmadd_ps(vk12c0x01234567, vi3x3c0, vo1x1c01234567);
+        vo1x1c89ABCDEF = _mm256_fmadd_ps(vk12c0x89ABCDEF, vi3x3c0, vo1x1c89ABCDEF);
+        vo1x2c01234567 = _mm256_fmadd_ps(vk10c0x01234567, vi3x3c0, vo1x2c01234567);
+        vo1x2c89ABCDEF = _mm256_fmadd_ps(vk10c0x89ABCDEF, vi3x3c0, vo1x2c89ABCDEF);
+        const __m256 vi4x1c0 = _mm256_broadcast_ss(i4 + 6);
+        const __m256 vi4x3c0 = _mm256_broadcast_ss(i4 + 12);
+        vo1x0c01234567 = _mm256_fmadd_ps(vk22c0x01234567, vi4x1c0, vo1x0c01234567);
+        vo1x0c89ABCDEF = _mm256_fmadd_ps(vk22c0x89ABCDEF, vi4x1c0, vo1x0c89ABCDEF);
+        vo1x1c01234567 = _mm256_fmadd_ps(vk20c0x01234567, vi4x1c0, vo1x1c01234567);
+        vo1x1c89ABCDEF = _mm256_fmadd_ps(vk20c0x89ABCDEF, vi4x1c0, vo1x1c89ABCDEF);
+        vo1x1c01234567 = _mm256_fmadd_ps(vk22c0x01234567, vi4x3c0, vo1x1c01234567);
+        vo1x1c89ABCDEF = _mm256_fmadd_ps(vk22c0x89ABCDEF, vi4x3c0, vo1x1c89ABCDEF);
+        vo1x2c01234567 = _mm256_fmadd_ps(vk20c0x01234567, vi4x3c0, vo1x2c01234567);
+        vo1x2c89ABCDEF = _mm256_fmadd_ps(vk20c0x89ABCDEF, vi4x3c0, vo1x2c89ABCDEF);
+        const __m256 vk01c1x01234567 = _mm256_load_ps(w + 208);
+        const __m256 vk01c1x89ABCDEF = _mm256_load_ps(w + 216);
+        const __m256 vk11c1x01234567 = _mm256_load_ps(w + 224);
+        const __m256 vk11c1x89ABCDEF = _mm256_load_ps(w + 232);
+        const __m256 vk21c1x01234567 = _mm256_load_ps(w + 240);
+        const __m256 vk21c1x89ABCDEF = _mm256_load_ps(w + 248);
+
+        const __m256 vi0x0c1 = _mm256_broadcast_ss(i0 + 4);
+        const __m256 vi0x2c1 = _mm256_broadcast_ss(i0 + 10);
+        vo0x0c01234567 = _mm256_fmadd_ps(vk01c1x01234567, vi0x0c1, vo0x0c01234567);
+        vo0x0c89ABCDEF = _mm256_fmadd_ps(vk01c1x89ABCDEF, vi0x0c1, vo0x0c89ABCDEF);
+        vo0x1c01234567 = _mm256_fmadd_ps(vk01c1x01234567, vi0x2c1, vo0x1c01234567);
+        vo0x1c89ABCDEF = _mm256_fmadd_ps(vk01c1x89ABCDEF, vi0x2c1, vo0x1c89ABCDEF);
+        const __m256 vi1x0c1 = _mm256_broadcast_ss(i1 + 4);
+        const __m256 vi1x2c1 = _mm256_broadcast_ss(i1 + 10);
+        vo0x0c01234567 = _mm256_fmadd_ps(vk11c1x01234567, vi1x0c1, vo0x0c01234567);
+        vo0x0c89ABCDEF = _mm256_fmadd_ps(vk11c1x89ABCDEF, vi1x0c1, vo0x0c89ABCDEF);
+        vo0x1c01234567 = _mm256_fmadd_ps(vk11c1x01234567, vi1x2c1, vo0x1c01234567);
+        vo0x1c89ABCDEF = _mm256_fmadd_ps(vk11c1x89ABCDEF, vi1x2c1, vo0x1c89ABCDEF);
+        const __m256 vi2x0c1 = _mm256_broadcast_ss(i2 + 4);
+        const __m256 vi2x2c1 = _mm256_broadcast_ss(i2 + 10);
+        vo0x0c01234567 = _mm256_fmadd_ps(vk21c1x01234567, vi2x0c1, vo0x0c01234567);
+        vo0x0c89ABCDEF = _mm256_fmadd_ps(vk21c1x89ABCDEF, vi2x0c1, vo0x0c89ABCDEF);
+        vo0x1c01234567 = _mm256_fmadd_ps(vk21c1x01234567, vi2x2c1, vo0x1c01234567);
+        vo0x1c89ABCDEF = _mm256_fmadd_ps(vk21c1x89ABCDEF, vi2x2c1, vo0x1c89ABCDEF);
+        vo1x0c01234567 = _mm256_fmadd_ps(vk01c1x01234567, vi2x0c1, vo1x0c01234567);
+        vo1x0c89ABCDEF = _mm256_fmadd_ps(vk01c1x89ABCDEF, vi2x0c1, vo1x0c89ABCDEF);
+        vo1x1c01234567 = _mm256_fmadd_ps(vk01c1x01234567, vi2x2c1, vo1x1c01234567);
+        vo1x1c89ABCDEF = _mm256_fmadd_ps(vk01c1x89ABCDEF, vi2x2c1, vo1x1c89ABCDEF);
+        const __m256 vi3x0c1 = _mm256_broadcast_ss(i3 + 4);
+        const __m256 vi3x2c1 = _mm256_broadcast_ss(i3 + 10);
+        vo1x0c01234567 = _mm256_fmadd_ps(vk11c1x01234567, vi3x0c1, vo1x0c01234567);
+        vo1x0c89ABCDEF = _mm256_fmadd_ps(vk11c1x89ABCDEF, vi3x0c1, vo1x0c89ABCDEF);
+        vo1x1c01234567 = _mm256_fmadd_ps(vk11c1x01234567, vi3x2c1, vo1x1c01234567);
+        vo1x1c89ABCDEF = _mm256_fmadd_ps(vk11c1x89ABCDEF, vi3x2c1, vo1x1c89ABCDEF);
+        const __m256 vi4x0c1 = _mm256_broadcast_ss(i4 + 4);
+        const __m256 vi4x2c1 = _mm256_broadcast_ss(i4 + 10);
+        vo1x0c01234567 = _mm256_fmadd_ps(vk21c1x01234567, vi4x0c1, vo1x0c01234567);
+        vo1x0c89ABCDEF = _mm256_fmadd_ps(vk21c1x89ABCDEF, vi4x0c1, vo1x0c89ABCDEF);
+        vo1x1c01234567 = _mm256_fmadd_ps(vk21c1x01234567, vi4x2c1, vo1x1c01234567);
+        vo1x1c89ABCDEF = _mm256_fmadd_ps(vk21c1x89ABCDEF, vi4x2c1, vo1x1c89ABCDEF);
+
+        const __m256 vk02c1x01234567 = _mm256_load_ps(w + 352);
+        const __m256 vk02c1x89ABCDEF = _mm256_load_ps(w + 360);
+        const __m256 vk12c1x01234567 = _mm256_load_ps(w + 368);
+        const __m256 vk12c1x89ABCDEF = _mm256_load_ps(w + 376);
+        const __m256 vk22c1x01234567 = _mm256_load_ps(w + 384);
+        const __m256 vk22c1x89ABCDEF = _mm256_load_ps(w + 392);
+        const __m256 vk00c1x01234567 = _mm256_load_ps(w + 64);
+        const __m256 vk00c1x89ABCDEF = _mm256_load_ps(w + 72);
+        const __m256 vk10c1x01234567 = _mm256_load_ps(w + 80);
+        const __m256 vk10c1x89ABCDEF = _mm256_load_ps(w + 88);
+        const __m256 vk20c1x01234567 = _mm256_load_ps(w + 96);
+        const __m256 vk20c1x89ABCDEF = _mm256_load_ps(w + 104);
+
+        const __m256 vi0x1c1 = _mm256_broadcast_ss(i0 + 7);
+        const __m256 vi0x3c1 = _mm256_broadcast_ss(i0 + 13);
+        vo0x0c01234567 = _mm256_fmadd_ps(vk02c1x01234567, vi0x1c1, vo0x0c01234567);
+        vo0x0c89ABCDEF = _mm256_fmadd_ps(vk02c1x89ABCDEF, vi0x1c1, vo0x0c89ABCDEF);
+        vo0x1c01234567 = _mm256_fmadd_ps(vk00c1x01234567, vi0x1c1, vo0x1c01234567);
+        vo0x1c89ABCDEF = _mm256_fmadd_ps(vk00c1x89ABCDEF, vi0x1c1, vo0x1c89ABCDEF);
+        vo0x1c01234567 = _mm256_fmadd_ps(vk02c1x01234567, vi0x3c1, vo0x1c01234567);
+        vo0x1c89ABCDEF = _mm256_fmadd_ps(vk02c1x89ABCDEF, vi0x3c1, vo0x1c89ABCDEF);
+        vo0x2c01234567 = _mm256_fmadd_ps(vk00c1x01234567, vi0x3c1, vo0x2c01234567);
+        vo0x2c89ABCDEF = _mm256_fmadd_ps(vk00c1x89ABCDEF, vi0x3c1, vo0x2c89ABCDEF);
+        const __m256 vi1x1c1 = _mm256_broadcast_ss(i1 + 7);
+        const __m256 vi1x3c1 = _mm256_broadcast_ss(i1 + 13);
+        vo0x0c01234567 = _mm256_fmadd_ps(vk12c1x01234567, vi1x1c1, vo0x0c01234567);
+        vo0x0c89ABCDEF = _mm256_fmadd_ps(vk12c1x89ABCDEF, vi1x1c1, vo0x0c89ABCDEF);
+        vo0x1c01234567 = _mm256_fmadd_ps(vk10c1x01234567, vi1x1c1, vo0x1c01234567);
+        vo0x1c89ABCDEF = _mm256_fmadd_ps(vk10c1x89ABCDEF, vi1x1c1, vo0x1c89ABCDEF);
+        vo0x1c01234567 = _mm256_fmadd_ps(vk12c1x01234567, vi1x3c1, vo0x1c01234567);
+        vo0x1c89ABCDEF = _mm256_fmadd_ps(vk12c1x89ABCDEF, vi1x3c1, vo0x1c89ABCDEF);
+        vo0x2c01234567 = _mm256_fmadd_ps(vk10c1x01234567, vi1x3c1, vo0x2c01234567);
+        vo0x2c89ABCDEF = _mm256_fmadd_ps(vk10c1x89ABCDEF, vi1x3c1, vo0x2c89ABCDEF);
+        const __m256 vi2x1c1 = _mm256_broadcast_ss(i2 + 7);
+        const __m256 vi2x3c1 = _mm256_broadcast_ss(i2 + 13);
+        vo0x0c01234567 = _mm256_fmadd_ps(vk22c1x01234567, vi2x1c1, vo0x0c01234567);
+        vo0x0c89ABCDEF = _mm256_fmadd_ps(vk22c1x89ABCDEF, vi2x1c1, vo0x0c89ABCDEF);
+        vo0x1c01234567 = _mm256_fmadd_ps(vk20c1x01234567, vi2x1c1, vo0x1c01234567);
+        vo0x1c89ABCDEF = _mm256_fmadd_ps(vk20c1x89ABCDEF, vi2x1c1, vo0x1c89ABCDEF);
+        vo0x1c01234567 = _mm256_fmadd_ps(vk22c1x01234567, vi2x3c1, vo0x1c01234567);
+        vo0x1c89ABCDEF = _mm256_fmadd_ps(vk22c1x89ABCDEF, vi2x3c1, vo0x1c89ABCDEF);
+        vo0x2c01234567 = _mm256_fmadd_ps(vk20c1x01234567, vi2x3c1, vo0x2c01234567);
+        vo0x2c89ABCDEF = _mm256_fmadd_ps(vk20c1x89ABCDEF, vi2x3c1, vo0x2c89ABCDEF);
+        vo1x0c01234567 = _mm256_fmadd_ps(vk02c1x01234567, vi2x1c1, vo1x0c01234567);
+        vo1x0c89ABCDEF = _mm256_fmadd_ps(vk02c1x89ABCDEF, vi2x1c1, vo1x0c89ABCDEF);
+        vo1x1c01234567 = _mm256_fmadd_ps(vk00c1x01234567, vi2x1c1, vo1x1c01234567);
+        vo1x1c89ABCDEF = _mm256_fmadd_ps(vk00c1x89ABCDEF, vi2x1c1, vo1x1c89ABCDEF);
+        vo1x1c01234567 = _mm256_fmadd_ps(vk02c1x01234567, vi2x3c1, vo1x1c01234567);
+        vo1x1c89ABCDEF = _mm256_fmadd_ps(vk02c1x89ABCDEF, vi2x3c1, vo1x1c89ABCDEF);
+        vo1x2c01234567 = _mm256_fmadd_ps(vk00c1x01234567, vi2x3c1, vo1x2c01234567);
+        vo1x2c89ABCDEF = _mm256_fmadd_ps(vk00c1x89ABCDEF, vi2x3c1, vo1x2c89ABCDEF);
+        const __m256 vi3x1c1 = _mm256_broadcast_ss(i3 + 7);
+        const __m256 vi3x3c1 = _mm256_broadcast_ss(i3 + 13);
+        vo1x0c01234567 = _mm256_fmadd_ps(vk12c1x01234567, vi3x1c1, vo1x0c01234567);
+        vo1x0c89ABCDEF = _mm256_fmadd_ps(vk12c1x89ABCDEF, vi3x1c1, vo1x0c89ABCDEF);
+        vo1x1c01234567 = _mm256_fmadd_ps(vk10c1x01234567, vi3x1c1, vo1x1c01234567);
+        vo1x1c89ABCDEF = _mm256_fmadd_ps(vk10c1x89ABCDEF, vi3x1c1, vo1x1c89ABCDEF);
+        vo1x1c01234567 = _mm256_fmadd_ps(vk12c1x01234567, vi3x3c1, vo1x1c01234567);
+        vo1x1c89ABCDEF = _mm256_fmadd_ps(vk12c1x89ABCDEF, vi3x3c1, vo1x1c89ABCDEF);
+        vo1x2c01234567 = _mm256_fmadd_ps(vk10c1x01234567, vi3x3c1, vo1x2c01234567);
+        vo1x2c89ABCDEF = _mm256_fmadd_ps(vk10c1x89ABCDEF, vi3x3c1, vo1x2c89ABCDEF);
+        const __m256 vi4x1c1 = _mm256_broadcast_ss(i4 + 7);
+        const __m256 vi4x3c1 = _mm256_broadcast_ss(i4 + 13);
+        vo1x0c01234567 = _mm256_fmadd_ps(vk22c1x01234567, vi4x1c1, vo1x0c01234567);
+        vo1x0c89ABCDEF = _mm256_fmadd_ps(vk22c1x89ABCDEF, vi4x1c1, vo1x0c89ABCDEF);
+        vo1x1c01234567 = _mm256_fmadd_ps(vk20c1x01234567, vi4x1c1, vo1x1c01234567);
+        vo1x1c89ABCDEF = _mm256_fmadd_ps(vk20c1x89ABCDEF, vi4x1c1, vo1x1c89ABCDEF);
+        vo1x1c01234567 = _mm256_fmadd_ps(vk22c1x01234567, vi4x3c1, vo1x1c01234567);
+        vo1x1c89ABCDEF = _mm256_fmadd_ps(vk22c1x89ABCDEF, vi4x3c1, vo1x1c89ABCDEF);
+        vo1x2c01234567 = _mm256_fmadd_ps(vk20c1x01234567, vi4x3c1, vo1x2c01234567);
+        vo1x2c89ABCDEF = _mm256_fmadd_ps(vk20c1x89ABCDEF, vi4x3c1, vo1x2c89ABCDEF);
+        const __m256 vk01c2x01234567 = _mm256_load_ps(w + 256);
+        const __m256 vk01c2x89ABCDEF = _mm256_load_ps(w + 264);
+        const __m256 vk11c2x01234567 = _mm256_load_ps(w + 272);
+        const __m256 vk11c2x89ABCDEF = _mm256_load_ps(w + 280);
+        const __m256 vk21c2x01234567 = _mm256_load_ps(w + 288);
+        const __m256 vk21c2x89ABCDEF = _mm256_load_ps(w + 296);
+
+        const __m256 vi0x0c2 = _mm256_broadcast_ss(i0 + 5);
+        const __m256 vi0x2c2 = _mm256_broadcast_ss(i0 + 11);
+        vo0x0c01234567 = _mm256_fmadd_ps(vk01c2x01234567, vi0x0c2, vo0x0c01234567);
+        vo0x0c89ABCDEF = _mm256_fmadd_ps(vk01c2x89ABCDEF, vi0x0c2, vo0x0c89ABCDEF);
+        vo0x1c01234567 = _mm256_fmadd_ps(vk01c2x01234567, vi0x2c2, vo0x1c01234567);
+        vo0x1c89ABCDEF = _mm256_fmadd_ps(vk01c2x89ABCDEF, vi0x2c2, vo0x1c89ABCDEF);
+        const __m256 vi1x0c2 = _mm256_broadcast_ss(i1 + 5);
+        const __m256 vi1x2c2 = _mm256_broadcast_ss(i1 + 11);
+        vo0x0c01234567 = _mm256_fmadd_ps(vk11c2x01234567, vi1x0c2, vo0x0c01234567);
+        vo0x0c89ABCDEF = _mm256_fmadd_ps(vk11c2x89ABCDEF, vi1x0c2, vo0x0c89ABCDEF);
+        vo0x1c01234567 = _mm256_fmadd_ps(vk11c2x01234567, vi1x2c2, vo0x1c01234567);
+        vo0x1c89ABCDEF = _mm256_fmadd_ps(vk11c2x89ABCDEF, vi1x2c2, vo0x1c89ABCDEF);
+        const __m256 vi2x0c2 = _mm256_broadcast_ss(i2 + 5);
+        const __m256 vi2x2c2 = _mm256_broadcast_ss(i2 + 11);
+        vo0x0c01234567 = _mm256_fmadd_ps(vk21c2x01234567, vi2x0c2, vo0x0c01234567);
+        vo0x0c89ABCDEF = _mm256_fmadd_ps(vk21c2x89ABCDEF, vi2x0c2, vo0x0c89ABCDEF);
+        vo0x1c01234567 = _mm256_fmadd_ps(vk21c2x01234567, vi2x2c2, vo0x1c01234567);
+        vo0x1c89ABCDEF = _mm256_fmadd_ps(vk21c2x89ABCDEF, vi2x2c2, vo0x1c89ABCDEF);
+        vo1x0c01234567 = _mm256_fmadd_ps(vk01c2x01234567, vi2x0c2, vo1x0c01234567);
+        vo1x0c89ABCDEF = _mm256_fmadd_ps(vk01c2x89ABCDEF, vi2x0c2, vo1x0c89ABCDEF);
+        vo1x1c01234567 = _mm256_fmadd_ps(vk01c2x01234567, vi2x2c2, vo1x1c01234567);
+        vo1x1c89ABCDEF = _mm256_fmadd_ps(vk01c2x89ABCDEF, vi2x2c2, vo1x1c89ABCDEF);
+        const __m256 vi3x0c2 = _mm256_broadcast_ss(i3 + 5);
+        const __m256 vi3x2c2 = _mm256_broadcast_ss(i3 + 11);
+        vo1x0c01234567 = _mm256_fmadd_ps(vk11c2x01234567, vi3x0c2, vo1x0c01234567);
+        vo1x0c89ABCDEF = _mm256_fmadd_ps(vk11c2x89ABCDEF, vi3x0c2, vo1x0c89ABCDEF);
+        vo1x1c01234567 = _mm256_fmadd_ps(vk11c2x01234567, vi3x2c2, vo1x1c01234567);
+        vo1x1c89ABCDEF = _mm256_fmadd_ps(vk11c2x89ABCDEF, vi3x2c2, vo1x1c89ABCDEF);
+        const __m256 vi4x0c2 = _mm256_broadcast_ss(i4 + 5);
+        const __m256 vi4x2c2 = _mm256_broadcast_ss(i4 + 11);
+        vo1x0c01234567 = _mm256_fmadd_ps(vk21c2x01234567, vi4x0c2, vo1x0c01234567);
+        vo1x0c89ABCDEF = _mm256_fmadd_ps(vk21c2x89ABCDEF, vi4x0c2, vo1x0c89ABCDEF);
+        vo1x1c01234567 = _mm256_fmadd_ps(vk21c2x01234567, vi4x2c2, vo1x1c01234567);
+        vo1x1c89ABCDEF = _mm256_fmadd_ps(vk21c2x89ABCDEF, vi4x2c2, vo1x1c89ABCDEF);
+
+        const __m256 vk02c2x01234567 = _mm256_load_ps(w + 400);
+        const __m256 vk02c2x89ABCDEF = _mm256_load_ps(w + 408);
+        const __m256 vk12c2x01234567 = _mm256_load_ps(w + 416);
+        const __m256 vk12c2x89ABCDEF = _mm256_load_ps(w + 424);
+        const __m256 vk22c2x01234567 = _mm256_load_ps(w + 432);
+        const __m256 vk22c2x89ABCDEF = _mm256_load_ps(w + 440);
+        const __m256 vk00c2x01234567 = _mm256_load_ps(w + 112);
+        const __m256 vk00c2x89ABCDEF = _mm256_load_ps(w + 120);
+        const __m256 vk10c2x01234567 = _mm256_load_ps(w + 128);
+        const __m256 vk10c2x89ABCDEF = _mm256_load_ps(w + 136);
+        const __m256 vk20c2x01234567 = _mm256_load_ps(w + 144);
+        const __m256 vk20c2x89ABCDEF = _mm256_load_ps(w + 152);
+
+        const __m256 vi0x1c2 = _mm256_broadcast_ss(i0 + 8);
+        const __m256 vi0x3c2 = _mm256_broadcast_ss(i0 + 14);
+        vo0x0c01234567 = _mm256_fmadd_ps(vk02c2x01234567, vi0x1c2, vo0x0c01234567);
+        vo0x0c89ABCDEF = _mm256_fmadd_ps(vk02c2x89ABCDEF, vi0x1c2, vo0x0c89ABCDEF);
+        vo0x1c01234567 = _mm256_fmadd_ps(vk00c2x01234567, vi0x1c2, vo0x1c01234567);
+        vo0x1c89ABCDEF = _mm256_fmadd_ps(vk00c2x89ABCDEF, vi0x1c2, vo0x1c89ABCDEF);
+        vo0x1c01234567 = _mm256_fmadd_ps(vk02c2x01234567, vi0x3c2, vo0x1c01234567);
+        vo0x1c89ABCDEF = _mm256_fmadd_ps(vk02c2x89ABCDEF, vi0x3c2, vo0x1c89ABCDEF);
+        vo0x2c01234567 = _mm256_fmadd_ps(vk00c2x01234567, vi0x3c2, vo0x2c01234567);
+        vo0x2c89ABCDEF = _mm256_fmadd_ps(vk00c2x89ABCDEF, vi0x3c2, vo0x2c89ABCDEF);
+        const __m256 vi1x1c2 = _mm256_broadcast_ss(i1 + 8);
+        const __m256 vi1x3c2 = _mm256_broadcast_ss(i1 + 14);
+        vo0x0c01234567 = _mm256_fmadd_ps(vk12c2x01234567, vi1x1c2, vo0x0c01234567);
+        vo0x0c89ABCDEF = _mm256_fmadd_ps(vk12c2x89ABCDEF, vi1x1c2, vo0x0c89ABCDEF);
+        vo0x1c01234567 = _mm256_fmadd_ps(vk10c2x01234567, vi1x1c2, vo0x1c01234567);
+        vo0x1c89ABCDEF = _mm256_fmadd_ps(vk10c2x89ABCDEF, vi1x1c2, vo0x1c89ABCDEF);
+        vo0x1c01234567 = _mm256_fmadd_ps(vk12c2x01234567, vi1x3c2, vo0x1c01234567);
+        vo0x1c89ABCDEF = _mm256_fmadd_ps(vk12c2x89ABCDEF, vi1x3c2, vo0x1c89ABCDEF);
+        vo0x2c01234567 = _mm256_fmadd_ps(vk10c2x01234567, vi1x3c2, vo0x2c01234567);
+        vo0x2c89ABCDEF = _mm256_fmadd_ps(vk10c2x89ABCDEF, vi1x3c2, vo0x2c89ABCDEF);
+        const __m256 vi2x1c2 = _mm256_broadcast_ss(i2 + 8);
+        const __m256 vi2x3c2 = _mm256_broadcast_ss(i2 + 14);
+        vo0x0c01234567 = _mm256_fmadd_ps(vk22c2x01234567, vi2x1c2, vo0x0c01234567);
+        vo0x0c89ABCDEF = _mm256_fmadd_ps(vk22c2x89ABCDEF, vi2x1c2, vo0x0c89ABCDEF);
+        vo0x1c01234567 = _mm256_fmadd_ps(vk20c2x01234567, vi2x1c2, vo0x1c01234567);
+        vo0x1c89ABCDEF = _mm256_fmadd_ps(vk20c2x89ABCDEF, vi2x1c2, vo0x1c89ABCDEF);
+        vo0x1c01234567 = _mm256_fmadd_ps(vk22c2x01234567, vi2x3c2, vo0x1c01234567);
+        vo0x1c89ABCDEF = _mm256_fmadd_ps(vk22c2x89ABCDEF, vi2x3c2, vo0x1c89ABCDEF);
+        vo0x2c01234567 = _mm256_fmadd_ps(vk20c2x01234567, vi2x3c2, vo0x2c01234567);
+        vo0x2c89ABCDEF = _mm256_fmadd_ps(vk20c2x89ABCDEF, vi2x3c2, vo0x2c89ABCDEF);
+        vo1x0c01234567 = _mm256_fmadd_ps(vk02c2x01234567, vi2x1c2, vo1x0c01234567);
+        vo1x0c89ABCDEF = _mm256_fmadd_ps(vk02c2x89ABCDEF, vi2x1c2, vo1x0c89ABCDEF);
+        vo1x1c01234567 = _mm256_fmadd_ps(vk00c2x01234567, vi2x1c2, vo1x1c01234567);
+        vo1x1c89ABCDEF = _mm256_fmadd_ps(vk00c2x89ABCDEF, vi2x1c2, vo1x1c89ABCDEF);
+        vo1x1c01234567 = _mm256_fmadd_ps(vk02c2x01234567, vi2x3c2, vo1x1c01234567);
+        vo1x1c89ABCDEF = _mm256_fmadd_ps(vk02c2x89ABCDEF, vi2x3c2, vo1x1c89ABCDEF);
+        vo1x2c01234567 = _mm256_fmadd_ps(vk00c2x01234567, vi2x3c2, vo1x2c01234567);
+        vo1x2c89ABCDEF = _mm256_fmadd_ps(vk00c2x89ABCDEF, vi2x3c2, vo1x2c89ABCDEF);
+        const __m256 vi3x1c2 = _mm256_broadcast_ss(i3 + 8);
+        const __m256 vi3x3c2 = _mm256_broadcast_ss(i3 + 14);
+        vo1x0c01234567 = _mm256_fmadd_ps(vk12c2x01234567, vi3x1c2, vo1x0c01234567);
+        vo1x0c89ABCDEF = _mm256_fmadd_ps(vk12c2x89ABCDEF, vi3x1c2, vo1x0c89ABCDEF);
+        vo1x1c01234567 = _mm256_fmadd_ps(vk10c2x01234567, vi3x1c2, vo1x1c01234567);
+        vo1x1c89ABCDEF = _mm256_fmadd_ps(vk10c2x89ABCDEF, vi3x1c2, vo1x1c89ABCDEF);
+        vo1x1c01234567 = _mm256_fmadd_ps(vk12c2x01234567, vi3x3c2, vo1x1c01234567);
+        vo1x1c89ABCDEF = _mm256_fmadd_ps(vk12c2x89ABCDEF, vi3x3c2, vo1x1c89ABCDEF);
+        vo1x2c01234567 = _mm256_fmadd_ps(vk10c2x01234567, vi3x3c2, vo1x2c01234567);
+        vo1x2c89ABCDEF = _mm256_fmadd_ps(vk10c2x89ABCDEF, vi3x3c2, vo1x2c89ABCDEF);
+        const __m256 vi4x1c2 = _mm256_broadcast_ss(i4 + 8);
+        const __m256 vi4x3c2 = _mm256_broadcast_ss(i4 + 14);
+        vo1x0c01234567 = _mm256_fmadd_ps(vk22c2x01234567, vi4x1c2, vo1x0c01234567);
+        vo1x0c89ABCDEF = _mm256_fmadd_ps(vk22c2x89ABCDEF, vi4x1c2, vo1x0c89ABCDEF);
+        vo1x1c01234567 = _mm256_fmadd_ps(vk20c2x01234567, vi4x1c2, vo1x1c01234567);
+        vo1x1c89ABCDEF = _mm256_fmadd_ps(vk20c2x89ABCDEF, vi4x1c2, vo1x1c89ABCDEF);
+        vo1x1c01234567 = _mm256_fmadd_ps(vk22c2x01234567, vi4x3c2, vo1x1c01234567);
+        vo1x1c89ABCDEF = _mm256_fmadd_ps(vk22c2x89ABCDEF, vi4x3c2, vo1x1c89ABCDEF);
+        vo1x2c01234567 = _mm256_fmadd_ps(vk20c2x01234567, vi4x3c2, vo1x2c01234567);
+        vo1x2c89ABCDEF = _mm256_fmadd_ps(vk20c2x89ABCDEF, vi4x3c2, vo1x2c89ABCDEF);
+
+        i0 += 12;
+        i1 += 12;
+        i2 += 12;
+        i3 += 12;
+        i4 += 12;
+
+        vo0x0c01234567 = _mm256_max_ps(vo0x0c01234567, vmin);
+        vo0x0c89ABCDEF = _mm256_max_ps(vo0x0c89ABCDEF, vmin);
+        vo0x1c01234567 = _mm256_max_ps(vo0x1c01234567, vmin);
+        vo0x1c89ABCDEF = _mm256_max_ps(vo0x1c89ABCDEF, vmin);
+        vo1x0c01234567 = _mm256_max_ps(vo1x0c01234567, vmin);
+        vo1x0c89ABCDEF = _mm256_max_ps(vo1x0c89ABCDEF, vmin);
+        vo1x1c01234567 = _mm256_max_ps(vo1x1c01234567, vmin);
+        vo1x1c89ABCDEF = _mm256_max_ps(vo1x1c89ABCDEF, vmin);
+        vo0x0c01234567 = _mm256_min_ps(vo0x0c01234567, vmax);
+        vo0x0c89ABCDEF = _mm256_min_ps(vo0x0c89ABCDEF, vmax);
+        vo0x1c01234567 = _mm256_min_ps(vo0x1c01234567, vmax);
+        vo0x1c89ABCDEF = _mm256_min_ps(vo0x1c89ABCDEF, vmax);
+        vo1x0c01234567 = _mm256_min_ps(vo1x0c01234567, vmax);
+        vo1x0c89ABCDEF = _mm256_min_ps(vo1x0c89ABCDEF, vmax);
+        vo1x1c01234567 = _mm256_min_ps(vo1x1c01234567, vmax);
+        vo1x1c89ABCDEF = _mm256_min_ps(vo1x1c89ABCDEF, vmax);
+
+        if XNN_LIKELY(c >= 16) {
+          _mm256_storeu_ps(o1, vo1x0c01234567);
+          _mm256_storeu_ps(o1 + 8, vo1x0c89ABCDEF);
+          o1 = (float*) ((uintptr_t) o1 + output_width_stride);
+          _mm256_storeu_ps(o1, vo1x1c01234567);
+          _mm256_storeu_ps(o1 + 8, vo1x1c89ABCDEF);
+          o1 = (float*) ((uintptr_t) o1 + output_width_stride);
+          _mm256_storeu_ps(o0, vo0x0c01234567);
+          _mm256_storeu_ps(o0 + 8, vo0x0c89ABCDEF);
+          o0 = (float*) ((uintptr_t) o0 + output_width_stride);
+          _mm256_storeu_ps(o0, vo0x1c01234567);
+          _mm256_storeu_ps(o0 + 8, vo0x1c89ABCDEF);
+          o0 = (float*) ((uintptr_t) o0 + output_width_stride);
+        } else {
+          float* o1_tmp = o1;
+          float* o0_tmp = o0;
+          if (c & 8) {
+            _mm256_storeu_ps((float*) ((uintptr_t) o1_tmp + output_width_stride * 1) + 0, vo1x1c01234567);
+            _mm256_storeu_ps((float*) ((uintptr_t) o1_tmp + output_width_stride * 0) + 0, vo1x0c01234567);
+            _mm256_storeu_ps((float*) ((uintptr_t) o0_tmp + output_width_stride * 1) + 0, vo0x1c01234567);
+            _mm256_storeu_ps((float*) ((uintptr_t) o0_tmp + output_width_stride * 0) + 0, vo0x0c01234567);
+            o1_tmp += 8;
+            o0_tmp += 8;
+            vo0x0c01234567 = vo0x0c89ABCDEF;
+            vo0x1c01234567 = vo0x1c89ABCDEF;
+            vo1x0c01234567 = vo1x0c89ABCDEF;
+            vo1x1c01234567 = vo1x1c89ABCDEF;
+          }
+          __m128 vo0x0c0123 = _mm256_castps256_ps128(vo0x0c01234567);
+          __m128 vo0x1c0123 = _mm256_castps256_ps128(vo0x1c01234567);
+          __m128 vo1x0c0123 = _mm256_castps256_ps128(vo1x0c01234567);
+          __m128 vo1x1c0123 = _mm256_castps256_ps128(vo1x1c01234567);
+          if (c & 4) {
+            _mm_storeu_ps((float*) ((uintptr_t) o1_tmp + output_width_stride * 1), vo1x1c0123);
+            _mm_storeu_ps((float*) ((uintptr_t) o1_tmp + output_width_stride * 0), vo1x0c0123);
+            _mm_storeu_ps((float*) ((uintptr_t) o0_tmp + output_width_stride * 1), vo0x1c0123);
+            _mm_storeu_ps((float*) ((uintptr_t) o0_tmp + output_width_stride * 0), vo0x0c0123);
+            o1_tmp += 4;
+            o0_tmp += 4;
+            vo0x0c0123 = _mm256_extractf128_ps(vo0x0c01234567, 1);
+            vo0x1c0123 = _mm256_extractf128_ps(vo0x1c01234567, 1);
+            vo1x0c0123 = _mm256_extractf128_ps(vo1x0c01234567, 1);
+            vo1x1c0123 = _mm256_extractf128_ps(vo1x1c01234567, 1);
+          }
+          if (c & 2) {
+            _mm_storel_pi((__m64*) ((uintptr_t) o1_tmp + output_width_stride * 1), vo1x1c0123);
+            _mm_storel_pi((__m64*) ((uintptr_t) o1_tmp + output_width_stride * 0), vo1x0c0123);
+            _mm_storel_pi((__m64*) ((uintptr_t) o0_tmp + output_width_stride * 1), vo0x1c0123);
+            _mm_storel_pi((__m64*) ((uintptr_t) o0_tmp + output_width_stride * 0), vo0x0c0123);
+            o1_tmp += 2;
+            o0_tmp += 2;
+            vo0x0c0123 = _mm_movehl_ps(vo0x0c0123, vo0x0c0123);
+            vo0x1c0123 = _mm_movehl_ps(vo0x1c0123, vo0x1c0123);
+            vo1x0c0123 = _mm_movehl_ps(vo1x0c0123, vo1x0c0123);
+            vo1x1c0123 = _mm_movehl_ps(vo1x1c0123, vo1x1c0123);
+          }
+          if (c & 1) {
+            _mm_store_ss((float*) ((uintptr_t) o1_tmp + output_width_stride * 1), vo1x1c0123);
+            _mm_store_ss((float*) ((uintptr_t) o1_tmp + output_width_stride * 0), vo1x0c0123);
+            _mm_store_ss((float*) ((uintptr_t) o0_tmp + output_width_stride * 1), vo0x1c0123);
+            _mm_store_ss((float*) ((uintptr_t) o0_tmp + output_width_stride * 0), vo0x0c0123);
+          }
+          o1 = (float*) ((uintptr_t) o1 + output_width_stride * 2);
+          o0 = (float*) ((uintptr_t) o0 + output_width_stride * 2);
+        }
+
+        vo0x0c01234567 = vo0x2c01234567;
+        vo0x0c89ABCDEF = vo0x2c89ABCDEF;
+        vo1x0c01234567 = vo1x2c01234567;
+        vo1x0c89ABCDEF = vo1x2c89ABCDEF;
+      }
+      if (iw >= 2) {
+        __m256 vo0x1c01234567 = _mm256_load_ps(w + 0);
+        __m256 vo0x1c89ABCDEF = _mm256_load_ps(w + 8);
+        __m256 vo1x1c01234567 = vo0x1c01234567;
+        __m256 vo1x1c89ABCDEF = vo0x1c89ABCDEF;
+
+        const __m256 vk01c0x01234567 = _mm256_load_ps(w + 160);
+        const __m256 vk01c0x89ABCDEF = _mm256_load_ps(w + 168);
+        const __m256 vk11c0x01234567 = _mm256_load_ps(w + 176);
+        const __m256 vk11c0x89ABCDEF = _mm256_load_ps(w + 184);
+        const __m256 vk21c0x01234567 = _mm256_load_ps(w + 192);
+        const __m256 vk21c0x89ABCDEF = _mm256_load_ps(w + 200);
+
+        const __m256 vi0x0c0 = _mm256_broadcast_ss(i0 + 3);
+        vo0x0c01234567 = _mm256_fmadd_ps(vk01c0x01234567, vi0x0c0, vo0x0c01234567);
+        vo0x0c89ABCDEF = _mm256_fmadd_ps(vk01c0x89ABCDEF, vi0x0c0, vo0x0c89ABCDEF);
+        const __m256 vi1x0c0 = _mm256_broadcast_ss(i1 + 3);
+        vo0x0c01234567 = _mm256_fmadd_ps(vk11c0x01234567, vi1x0c0, vo0x0c01234567);
+        vo0x0c89ABCDEF = _mm256_fmadd_ps(vk11c0x89ABCDEF, vi1x0c0, vo0x0c89ABCDEF);
+        const __m256 vi2x0c0 = _mm256_broadcast_ss(i2 + 3);
+        vo0x0c01234567 = _mm256_fmadd_ps(vk21c0x01234567, vi2x0c0, vo0x0c01234567);
+        vo0x0c89ABCDEF = _mm256_fmadd_ps(vk21c0x89ABCDEF, vi2x0c0, vo0x0c89ABCDEF);
+        vo1x0c01234567 = _mm256_fmadd_ps(vk01c0x01234567, vi2x0c0, vo1x0c01234567);
+        vo1x0c89ABCDEF = _mm256_fmadd_ps(vk01c0x89ABCDEF, vi2x0c0, vo1x0c89ABCDEF);
+        const __m256 vi3x0c0 = _mm256_broadcast_ss(i3 + 3);
+        vo1x0c01234567 = _mm256_fmadd_ps(vk11c0x01234567, vi3x0c0, vo1x0c01234567);
+        vo1x0c89ABCDEF = _mm256_fmadd_ps(vk11c0x89ABCDEF, vi3x0c0, vo1x0c89ABCDEF);
+        const __m256 vi4x0c0 = _mm256_broadcast_ss(i4 + 3);
+        vo1x0c01234567 = _mm256_fmadd_ps(vk21c0x01234567, vi4x0c0, vo1x0c01234567);
+        vo1x0c89ABCDEF = _mm256_fmadd_ps(vk21c0x89ABCDEF, vi4x0c0, vo1x0c89ABCDEF);
+
+        const __m256 vk02c0x01234567 = _mm256_load_ps(w + 304);
+        const __m256 vk02c0x89ABCDEF = _mm256_load_ps(w + 312);
+        const __m256 vk12c0x01234567 = _mm256_load_ps(w + 320);
+        const __m256 vk12c0x89ABCDEF = _mm256_load_ps(w + 328);
+        const __m256 vk22c0x01234567 = _mm256_load_ps(w + 336);
+        const __m256 vk22c0x89ABCDEF = _mm256_load_ps(w + 344);
+        const __m256 vk00c0x01234567 = _mm256_load_ps(w + 16);
+        const __m256 vk00c0x89ABCDEF = _mm256_load_ps(w + 24);
+        const __m256 vk10c0x01234567 = _mm256_load_ps(w + 32);
+        const __m256 vk10c0x89ABCDEF = _mm256_load_ps(w + 40);
+        const __m256 vk20c0x01234567 = _mm256_load_ps(w + 48);
+        const __m256 vk20c0x89ABCDEF = _mm256_load_ps(w + 56);
+
+        const __m256 vi0x1c0 = _mm256_broadcast_ss(i0 + 6);
+        vo0x0c01234567 = _mm256_fmadd_ps(vk02c0x01234567, vi0x1c0, vo0x0c01234567);
+        vo0x0c89ABCDEF = _mm256_fmadd_ps(vk02c0x89ABCDEF, vi0x1c0, vo0x0c89ABCDEF);
+        vo0x1c01234567 = _mm256_fmadd_ps(vk00c0x01234567, vi0x1c0, vo0x1c01234567);
+        vo0x1c89ABCDEF = _mm256_fmadd_ps(vk00c0x89ABCDEF, vi0x1c0, vo0x1c89ABCDEF);
+        const __m256 vi1x1c0 = _mm256_broadcast_ss(i1 + 6);
+        vo0x0c01234567 = _mm256_fmadd_ps(vk12c0x01234567, vi1x1c0, vo0x0c01234567);
+        vo0x0c89ABCDEF = _mm256_fmadd_ps(vk12c0x89ABCDEF, vi1x1c0, vo0x0c89ABCDEF);
+        vo0x1c01234567 = _mm256_fmadd_ps(vk10c0x01234567, vi1x1c0, vo0x1c01234567);
+        vo0x1c89ABCDEF = _mm256_fmadd_ps(vk10c0x89ABCDEF, vi1x1c0, vo0x1c89ABCDEF);
+        const __m256 vi2x1c0 = _mm256_broadcast_ss(i2 + 6);
+        vo0x0c01234567 = _mm256_fmadd_ps(vk22c0x01234567, vi2x1c0, vo0x0c01234567);
+        vo0x0c89ABCDEF = _mm256_fmadd_ps(vk22c0x89ABCDEF, vi2x1c0, vo0x0c89ABCDEF);
+        vo0x1c01234567 = _mm256_fmadd_ps(vk20c0x01234567, vi2x1c0, vo0x1c01234567);
+        vo0x1c89ABCDEF = _mm256_fmadd_ps(vk20c0x89ABCDEF, vi2x1c0, vo0x1c89ABCDEF);
+        vo1x0c01234567 = _mm256_fmadd_ps(vk02c0x01234567, vi2x1c0, vo1x0c01234567);
+        vo1x0c89ABCDEF = _mm256_fmadd_ps(vk02c0x89ABCDEF, vi2x1c0, vo1x0c89ABCDEF);
+        vo1x1c01234567 = _mm256_fmadd_ps(vk00c0x01234567, vi2x1c0, vo1x1c01234567);
+        vo1x1c89ABCDEF = _mm256_fmadd_ps(vk00c0x89ABCDEF, vi2x1c0, vo1x1c89ABCDEF);
+        const __m256 vi3x1c0 = _mm256_broadcast_ss(i3 + 6);
+        vo1x0c01234567 = _mm256_fmadd_ps(vk12c0x01234567, vi3x1c0, vo1x0c01234567);
+        vo1x0c89ABCDEF = _mm256_fmadd_ps(vk12c0x89ABCDEF, vi3x1c0, vo1x0c89ABCDEF);
+        vo1x1c01234567 = _mm256_fmadd_ps(vk10c0x01234567, vi3x1c0, vo1x1c01234567);
+        vo1x1c89ABCDEF = _mm256_fmadd_ps(vk10c0x89ABCDEF, vi3x1c0, vo1x1c89ABCDEF);
+        const __m256 vi4x1c0 = _mm256_broadcast_ss(i4 + 6);
+        vo1x0c01234567 = _mm256_fmadd_ps(vk22c0x01234567, vi4x1c0, vo1x0c01234567);
+        vo1x0c89ABCDEF = _mm256_fmadd_ps(vk22c0x89ABCDEF, vi4x1c0, vo1x0c89ABCDEF);
+        vo1x1c01234567 = _mm256_fmadd_ps(vk20c0x01234567, vi4x1c0, vo1x1c01234567);
+        vo1x1c89ABCDEF = _mm256_fmadd_ps(vk20c0x89ABCDEF, vi4x1c0, vo1x1c89ABCDEF);
+        const __m256 vk01c1x01234567 = _mm256_load_ps(w + 208);
+        const __m256 vk01c1x89ABCDEF = _mm256_load_ps(w + 216);
+        const __m256 vk11c1x01234567 = _mm256_load_ps(w + 224);
+        const __m256 vk11c1x89ABCDEF = _mm256_load_ps(w + 232);
+        const __m256 vk21c1x01234567 = _mm256_load_ps(w + 240);
+        const __m256 vk21c1x89ABCDEF = _mm256_load_ps(w + 248);
+
+        const __m256 vi0x0c1 = _mm256_broadcast_ss(i0 + 4);
+        vo0x0c01234567 = _mm256_fmadd_ps(vk01c1x01234567, vi0x0c1, vo0x0c01234567);
+        vo0x0c89ABCDEF = _mm256_fmadd_ps(vk01c1x89ABCDEF, vi0x0c1, vo0x0c89ABCDEF);
+        const __m256 vi1x0c1 = _mm256_broadcast_ss(i1 + 4);
+        vo0x0c01234567 = _mm256_fmadd_ps(vk11c1x01234567, vi1x0c1, vo0x0c01234567);
+        vo0x0c89ABCDEF = _mm256_fmadd_ps(vk11c1x89ABCDEF, vi1x0c1, vo0x0c89ABCDEF);
+        const __m256 vi2x0c1 = _mm256_broadcast_ss(i2 + 4);
+        vo0x0c01234567 = _mm256_fmadd_ps(vk21c1x01234567, vi2x0c1, vo0x0c01234567);
+        vo0x0c89ABCDEF = _mm256_fmadd_ps(vk21c1x89ABCDEF, vi2x0c1, vo0x0c89ABCDEF);
+        vo1x0c01234567 = _mm256_fmadd_ps(vk01c1x01234567, vi2x0c1, vo1x0c01234567);
+        vo1x0c89ABCDEF = _mm256_fmadd_ps(vk01c1x89ABCDEF, vi2x0c1, vo1x0c89ABCDEF);
+        const __m256 vi3x0c1 = _mm256_broadcast_ss(i3 + 4);
+        vo1x0c01234567 = _mm256_fmadd_ps(vk11c1x01234567, vi3x0c1, vo1x0c01234567);
+        vo1x0c89ABCDEF = _mm256_fmadd_ps(vk11c1x89ABCDEF, vi3x0c1, vo1x0c89ABCDEF);
+        const __m256 vi4x0c1 = _mm256_broadcast_ss(i4 + 4);
+        vo1x0c01234567 = _mm256_fmadd_ps(vk21c1x01234567, vi4x0c1, vo1x0c01234567);
+        vo1x0c89ABCDEF = _mm256_fmadd_ps(vk21c1x89ABCDEF, vi4x0c1, vo1x0c89ABCDEF);
+
+        const __m256 vk02c1x01234567 = _mm256_load_ps(w + 352);
+        const __m256 vk02c1x89ABCDEF = _mm256_load_ps(w + 360);
+        const __m256 vk12c1x01234567 = _mm256_load_ps(w + 368);
+        const __m256 vk12c1x89ABCDEF = _mm256_load_ps(w + 376);
+        const __m256 vk22c1x01234567 = _mm256_load_ps(w + 384);
+        const __m256 vk22c1x89ABCDEF = _mm256_load_ps(w + 392);
+        const __m256 vk00c1x01234567 = _mm256_load_ps(w + 64);
+        const __m256 vk00c1x89ABCDEF = _mm256_load_ps(w + 72);
+        const __m256 vk10c1x01234567 = _mm256_load_ps(w + 80);
+        const __m256 vk10c1x89ABCDEF = _mm256_load_ps(w + 88);
+        const __m256 vk20c1x01234567 = _mm256_load_ps(w + 96);
+        const __m256 vk20c1x89ABCDEF = _mm256_load_ps(w + 104);
+
+        const __m256 vi0x1c1 = _mm256_broadcast_ss(i0 + 7);
+        vo0x0c01234567 = _mm256_fmadd_ps(vk02c1x01234567, vi0x1c1, vo0x0c01234567);
+        vo0x0c89ABCDEF = _mm256_fmadd_ps(vk02c1x89ABCDEF, vi0x1c1, vo0x0c89ABCDEF);
+        vo0x1c01234567 = _mm256_fmadd_ps(vk00c1x01234567, vi0x1c1, vo0x1c01234567);
+        vo0x1c89ABCDEF = _mm256_fmadd_ps(vk00c1x89ABCDEF, vi0x1c1, vo0x1c89ABCDEF);
+        const __m256 vi1x1c1 = _mm256_broadcast_ss(i1 + 7);
+        vo0x0c01234567 = _mm256_fmadd_ps(vk12c1x01234567, vi1x1c1, vo0x0c01234567);
+        vo0x0c89ABCDEF = _mm256_fmadd_ps(vk12c1x89ABCDEF, vi1x1c1, vo0x0c89ABCDEF);
+        vo0x1c01234567 = _mm256_fmadd_ps(vk10c1x01234567, vi1x1c1, vo0x1c01234567);
+        vo0x1c89ABCDEF = _mm256_fmadd_ps(vk10c1x89ABCDEF, vi1x1c1, vo0x1c89ABCDEF);
+        const __m256 vi2x1c1 = _mm256_broadcast_ss(i2 + 7);
+        vo0x0c01234567 = _mm256_fmadd_ps(vk22c1x01234567, vi2x1c1, vo0x0c01234567);
+        vo0x0c89ABCDEF = _mm256_fmadd_ps(vk22c1x89ABCDEF, vi2x1c1, vo0x0c89ABCDEF);
+        vo0x1c01234567 = _mm256_fmadd_ps(vk20c1x01234567, vi2x1c1, vo0x1c01234567);
+        vo0x1c89ABCDEF = _mm256_fmadd_ps(vk20c1x89ABCDEF, vi2x1c1, vo0x1c89ABCDEF);
+        vo1x0c01234567 = _mm256_fmadd_ps(vk02c1x01234567, vi2x1c1, vo1x0c01234567);
+        vo1x0c89ABCDEF = _mm256_fmadd_ps(vk02c1x89ABCDEF, vi2x1c1, vo1x0c89ABCDEF);
+        vo1x1c01234567 = _mm256_fmadd_ps(vk00c1x01234567, vi2x1c1, vo1x1c01234567);
+        vo1x1c89ABCDEF = _mm256_fmadd_ps(vk00c1x89ABCDEF, vi2x1c1, vo1x1c89ABCDEF);
+        const __m256 vi3x1c1 = _mm256_broadcast_ss(i3 + 7);
+        vo1x0c01234567 = _mm256_fmadd_ps(vk12c1x01234567, vi3x1c1, vo1x0c01234567);
+        vo1x0c89ABCDEF = _mm256_fmadd_ps(vk12c1x89ABCDEF, vi3x1c1, vo1x0c89ABCDEF);
+        vo1x1c01234567 = _mm256_fmadd_ps(vk10c1x01234567, vi3x1c1, vo1x1c01234567);
+        vo1x1c89ABCDEF = _mm256_fmadd_ps(vk10c1x89ABCDEF, vi3x1c1, vo1x1c89ABCDEF);
+        const __m256 vi4x1c1 = _mm256_broadcast_ss(i4 + 7);
+        vo1x0c01234567 = _mm256_fmadd_ps(vk22c1x01234567, vi4x1c1, vo1x0c01234567);
+        vo1x0c89ABCDEF = _mm256_fmadd_ps(vk22c1x89ABCDEF, vi4x1c1, vo1x0c89ABCDEF);
+        vo1x1c01234567 = _mm256_fmadd_ps(vk20c1x01234567, vi4x1c1, vo1x1c01234567);
+        vo1x1c89ABCDEF = _mm256_fmadd_ps(vk20c1x89ABCDEF, vi4x1c1, vo1x1c89ABCDEF);
+        const __m256 vk01c2x01234567 = _mm256_load_ps(w + 256);
+        const __m256 vk01c2x89ABCDEF = _mm256_load_ps(w + 264);
+        const __m256 vk11c2x01234567 = _mm256_load_ps(w + 272);
+        const __m256 vk11c2x89ABCDEF = _mm256_load_ps(w + 280);
+        const __m256 vk21c2x01234567 = _mm256_load_ps(w + 288);
+        const __m256 vk21c2x89ABCDEF = _mm256_load_ps(w + 296);
+
+        const __m256 vi0x0c2 = _mm256_broadcast_ss(i0 + 5);
+        vo0x0c01234567 = _mm256_fmadd_ps(vk01c2x01234567, vi0x0c2, vo0x0c01234567);
+        vo0x0c89ABCDEF = _mm256_fmadd_ps(vk01c2x89ABCDEF, vi0x0c2, vo0x0c89ABCDEF);
+        const __m256 vi1x0c2 = _mm256_broadcast_ss(i1 + 5);
+        vo0x0c01234567 = _mm256_fmadd_ps(vk11c2x01234567, vi1x0c2, vo0x0c01234567);
+        vo0x0c89ABCDEF = _mm256_fmadd_ps(vk11c2x89ABCDEF, vi1x0c2, vo0x0c89ABCDEF);
+        const __m256 vi2x0c2 = _mm256_broadcast_ss(i2 + 5);
+        vo0x0c01234567 = _mm256_fmadd_ps(vk21c2x01234567, vi2x0c2, vo0x0c01234567);
+        vo0x0c89ABCDEF = _mm256_fmadd_ps(vk21c2x89ABCDEF, vi2x0c2, vo0x0c89ABCDEF);
+        vo1x0c01234567 = _mm256_fmadd_ps(vk01c2x01234567, vi2x0c2, vo1x0c01234567);
+        vo1x0c89ABCDEF = _mm256_fmadd_ps(vk01c2x89ABCDEF, vi2x0c2, vo1x0c89ABCDEF);
+        const __m256 vi3x0c2 = _mm256_broadcast_ss(i3 + 5);
+        vo1x0c01234567 = _mm256_fmadd_ps(vk11c2x01234567, vi3x0c2, vo1x0c01234567);
+        vo1x0c89ABCDEF = _mm256_fmadd_ps(vk11c2x89ABCDEF, vi3x0c2, vo1x0c89ABCDEF);
+        const __m256 vi4x0c2 = _mm256_broadcast_ss(i4 + 5);
+        vo1x0c01234567 = _mm256_fmadd_ps(vk21c2x01234567, vi4x0c2, vo1x0c01234567);
+        vo1x0c89ABCDEF = _mm256_fmadd_ps(vk21c2x89ABCDEF, vi4x0c2, vo1x0c89ABCDEF);
+
+        const __m256 vk02c2x01234567 = _mm256_load_ps(w + 400);
+        const __m256 vk02c2x89ABCDEF = _mm256_load_ps(w + 408);
+        const __m256 vk12c2x01234567 = _mm256_load_ps(w + 416);
+        const __m256 vk12c2x89ABCDEF = _mm256_load_ps(w + 424);
+        const __m256 vk22c2x01234567 = _mm256_load_ps(w + 432);
+        const __m256 vk22c2x89ABCDEF = _mm256_load_ps(w + 440);
+        const __m256 vk00c2x01234567 = _mm256_load_ps(w + 112);
+        const __m256 vk00c2x89ABCDEF = _mm256_load_ps(w + 120);
+        const __m256 vk10c2x01234567 = _mm256_load_ps(w + 128);
+        const __m256 vk10c2x89ABCDEF = _mm256_load_ps(w + 136);
+        const __m256 vk20c2x01234567 = _mm256_load_ps(w + 144);
+        const __m256 vk20c2x89ABCDEF = _mm256_load_ps(w + 152);
+
+        const __m256 vi0x1c2 = _mm256_broadcast_ss(i0 + 8);
+        vo0x0c01234567 = _mm256_fmadd_ps(vk02c2x01234567, vi0x1c2, vo0x0c01234567);
+        vo0x0c89ABCDEF = _mm256_fmadd_ps(vk02c2x89ABCDEF, vi0x1c2, vo0x0c89ABCDEF);
+        vo0x1c01234567 = _mm256_fmadd_ps(vk00c2x01234567, vi0x1c2, vo0x1c01234567);
+        vo0x1c89ABCDEF = _mm256_fmadd_ps(vk00c2x89ABCDEF, vi0x1c2, vo0x1c89ABCDEF);
+        const __m256 vi1x1c2 = _mm256_broadcast_ss(i1 + 8);
+        vo0x0c01234567 = _mm256_fmadd_ps(vk12c2x01234567, vi1x1c2, vo0x0c01234567);
+        vo0x0c89ABCDEF = _mm256_fmadd_ps(vk12c2x89ABCDEF, vi1x1c2, vo0x0c89ABCDEF);
+        vo0x1c01234567 = _mm256_fmadd_ps(vk10c2x01234567, vi1x1c2, vo0x1c01234567);
+        vo0x1c89ABCDEF = _mm256_fmadd_ps(vk10c2x89ABCDEF, vi1x1c2, vo0x1c89ABCDEF);
+        const __m256 vi2x1c2 = _mm256_broadcast_ss(i2 + 8);
+        vo0x0c01234567 = _mm256_fmadd_ps(vk22c2x01234567, vi2x1c2, vo0x0c01234567);
+        vo0x0c89ABCDEF = _mm256_fmadd_ps(vk22c2x89ABCDEF, vi2x1c2, vo0x0c89ABCDEF);
+        vo0x1c01234567 = _mm256_fmadd_ps(vk20c2x01234567, vi2x1c2, vo0x1c01234567);
+        vo0x1c89ABCDEF = _mm256_fmadd_ps(vk20c2x89ABCDEF, vi2x1c2, vo0x1c89ABCDEF);
+        vo1x0c01234567 = _mm256_fmadd_ps(vk02c2x01234567, vi2x1c2, vo1x0c01234567);
+        vo1x0c89ABCDEF = _mm256_fmadd_ps(vk02c2x89ABCDEF, vi2x1c2, vo1x0c89ABCDEF);
+        vo1x1c01234567 = _mm256_fmadd_ps(vk00c2x01234567, vi2x1c2, vo1x1c01234567);
+        vo1x1c89ABCDEF = _mm256_fmadd_ps(vk00c2x89ABCDEF, vi2x1c2, vo1x1c89ABCDEF);
+        const __m256 vi3x1c2 = _mm256_broadcast_ss(i3 + 8);
+        vo1x0c01234567 = _mm256_fmadd_ps(vk12c2x01234567, vi3x1c2, vo1x0c01234567);
+        vo1x0c89ABCDEF = _mm256_fmadd_ps(vk12c2x89ABCDEF, vi3x1c2, vo1x0c89ABCDEF);
+        vo1x1c01234567 = _mm256_fmadd_ps(vk10c2x01234567, vi3x1c2, vo1x1c01234567);
+        vo1x1c89ABCDEF = _mm256_fmadd_ps(vk10c2x89ABCDEF, vi3x1c2, vo1x1c89ABCDEF);
+        const __m256 vi4x1c2 = _mm256_broadcast_ss(i4 + 8);
+        vo1x0c01234567 = _mm256_fmadd_ps(vk22c2x01234567, vi4x1c2, vo1x0c01234567);
+        vo1x0c89ABCDEF = _mm256_fmadd_ps(vk22c2x89ABCDEF, vi4x1c2, vo1x0c89ABCDEF);
+        vo1x1c01234567 = _mm256_fmadd_ps(vk20c2x01234567, vi4x1c2, vo1x1c01234567);
+        vo1x1c89ABCDEF = _mm256_fmadd_ps(vk20c2x89ABCDEF, vi4x1c2, vo1x1c89ABCDEF);
+
+        i0 += 6;
+        i1 += 6;
+        i2 += 6;
+        i3 += 6;
+        i4 += 6;
+
+        vo0x0c01234567 = _mm256_max_ps(vo0x0c01234567, vmin);
+        vo0x0c89ABCDEF = _mm256_max_ps(vo0x0c89ABCDEF, vmin);
+        vo1x0c01234567 = _mm256_max_ps(vo1x0c01234567, vmin);
+        vo1x0c89ABCDEF = _mm256_max_ps(vo1x0c89ABCDEF, vmin);
+        vo0x0c01234567 = _mm256_min_ps(vo0x0c01234567, vmax);
+        vo0x0c89ABCDEF = _mm256_min_ps(vo0x0c89ABCDEF, vmax);
+        vo1x0c01234567 = _mm256_min_ps(vo1x0c01234567, vmax);
+        vo1x0c89ABCDEF = _mm256_min_ps(vo1x0c89ABCDEF, vmax);
+
+        if XNN_LIKELY(c >= 16) {
+          _mm256_storeu_ps(o1, vo1x0c01234567);
+          _mm256_storeu_ps(o1 + 8, vo1x0c89ABCDEF);
+          o1 = (float*) ((uintptr_t) o1 + output_width_stride);
+          _mm256_storeu_ps(o0, vo0x0c01234567);
+          _mm256_storeu_ps(o0 + 8, vo0x0c89ABCDEF);
+          o0 = (float*) ((uintptr_t) o0 + output_width_stride);
+        } else {
+          float* o1_tmp = o1;
+          float* o0_tmp = o0;
+          if (c & 8) {
+            _mm256_storeu_ps((float*) ((uintptr_t) o1_tmp + output_width_stride * 0) + 0, vo1x0c01234567);
+            _mm256_storeu_ps((float*) ((uintptr_t) o0_tmp + output_width_stride * 0) + 0, vo0x0c01234567);
+            o1_tmp += 8;
+            o0_tmp += 8;
+            vo0x0c01234567 = vo0x0c89ABCDEF;
+            vo1x0c01234567 = vo1x0c89ABCDEF;
+          }
+          __m128 vo0x0c0123 = _mm256_castps256_ps128(vo0x0c01234567);
+          __m128 vo1x0c0123 = _mm256_castps256_ps128(vo1x0c01234567);
+          if (c & 4) {
+            _mm_storeu_ps((float*) ((uintptr_t) o1_tmp + output_width_stride * 0), vo1x0c0123);
+            _mm_storeu_ps((float*) ((uintptr_t) o0_tmp + output_width_stride * 0), vo0x0c0123);
+            o1_tmp += 4;
+            o0_tmp += 4;
+            vo0x0c0123 = _mm256_extractf128_ps(vo0x0c01234567, 1);
+            vo1x0c0123 = _mm256_extractf128_ps(vo1x0c01234567, 1);
+          }
+          if (c & 2) {
+            _mm_storel_pi((__m64*) ((uintptr_t) o1_tmp + output_width_stride * 0), vo1x0c0123);
+            _mm_storel_pi((__m64*) ((uintptr_t) o0_tmp + output_width_stride * 0), vo0x0c0123);
+            o1_tmp += 2;
+            o0_tmp += 2;
+            vo0x0c0123 = _mm_movehl_ps(vo0x0c0123, vo0x0c0123);
+            vo1x0c0123 = _mm_movehl_ps(vo1x0c0123, vo1x0c0123);
+          }
+          if (c & 1) {
+            _mm_store_ss((float*) ((uintptr_t) o1_tmp + output_width_stride * 0), vo1x0c0123);
+            _mm_store_ss((float*) ((uintptr_t) o0_tmp + output_width_stride * 0), vo0x0c0123);
+          }
+          o1 = (float*) ((uintptr_t) o1 + output_width_stride);
+          o0 = (float*) ((uintptr_t) o0 + output_width_stride);
+        }
+
+        vo0x0c01234567 = vo0x1c01234567;
+        vo0x0c89ABCDEF = vo0x1c89ABCDEF;
+        vo1x0c01234567 = vo1x1c01234567;
+        vo1x0c89ABCDEF = vo1x1c89ABCDEF;
+        iw -= 2;
+      }
+      assert(iw < 2);
+      if XNN_UNLIKELY(iw != 0) {
+        // The last input column contributes through the center column of the kernel; the right column is padding.
+        const __m256 vk01c0x01234567 = _mm256_load_ps(w + 160);
+        const __m256 vk01c0x89ABCDEF = _mm256_load_ps(w + 168);
+        const __m256 vk11c0x01234567 = _mm256_load_ps(w + 176);
+        const __m256 vk11c0x89ABCDEF = _mm256_load_ps(w + 184);
+        const __m256 vk21c0x01234567 = _mm256_load_ps(w + 192);
+        const __m256 vk21c0x89ABCDEF = _mm256_load_ps(w + 200);
+
+        const __m256 vi0x0c0 = _mm256_broadcast_ss(i0 + 3);
+        vo0x0c01234567 = _mm256_fmadd_ps(vk01c0x01234567, vi0x0c0, vo0x0c01234567);
+        vo0x0c89ABCDEF = _mm256_fmadd_ps(vk01c0x89ABCDEF, vi0x0c0, vo0x0c89ABCDEF);
+        const __m256 vi1x0c0 = _mm256_broadcast_ss(i1 + 3);
+        vo0x0c01234567 = _mm256_fmadd_ps(vk11c0x01234567, vi1x0c0, vo0x0c01234567);
+        vo0x0c89ABCDEF = _mm256_fmadd_ps(vk11c0x89ABCDEF, vi1x0c0, vo0x0c89ABCDEF);
+        const __m256 vi2x0c0 = _mm256_broadcast_ss(i2 + 3);
+        vo0x0c01234567 = _mm256_fmadd_ps(vk21c0x01234567, vi2x0c0, vo0x0c01234567);
+        vo0x0c89ABCDEF = _mm256_fmadd_ps(vk21c0x89ABCDEF, vi2x0c0, vo0x0c89ABCDEF);
+        vo1x0c01234567 = _mm256_fmadd_ps(vk01c0x01234567, vi2x0c0, vo1x0c01234567);
+        vo1x0c89ABCDEF = _mm256_fmadd_ps(vk01c0x89ABCDEF, vi2x0c0, vo1x0c89ABCDEF);
+        const __m256 vi3x0c0 = _mm256_broadcast_ss(i3 + 3);
+        vo1x0c01234567 = _mm256_fmadd_ps(vk11c0x01234567, vi3x0c0, vo1x0c01234567);
+        vo1x0c89ABCDEF = _mm256_fmadd_ps(vk11c0x89ABCDEF, vi3x0c0, vo1x0c89ABCDEF);
+        const __m256 vi4x0c0 = _mm256_broadcast_ss(i4 + 3);
+        vo1x0c01234567 = _mm256_fmadd_ps(vk21c0x01234567, vi4x0c0, vo1x0c01234567);
+        vo1x0c89ABCDEF = _mm256_fmadd_ps(vk21c0x89ABCDEF, vi4x0c0, vo1x0c89ABCDEF);
+        const __m256 vk01c1x01234567 = _mm256_load_ps(w + 208);
+        const __m256 vk01c1x89ABCDEF = _mm256_load_ps(w + 216);
+        const __m256 vk11c1x01234567 = _mm256_load_ps(w + 224);
+        const __m256 vk11c1x89ABCDEF = _mm256_load_ps(w + 232);
+        const __m256 vk21c1x01234567 = _mm256_load_ps(w + 240);
+        const __m256 vk21c1x89ABCDEF = _mm256_load_ps(w + 248);
+
+        const __m256 vi0x0c1 = _mm256_broadcast_ss(i0 + 4);
+        vo0x0c01234567 = _mm256_fmadd_ps(vk01c1x01234567, vi0x0c1, vo0x0c01234567);
+        vo0x0c89ABCDEF = _mm256_fmadd_ps(vk01c1x89ABCDEF, vi0x0c1, vo0x0c89ABCDEF);
+        const __m256 vi1x0c1 = _mm256_broadcast_ss(i1 + 4);
+        vo0x0c01234567 = _mm256_fmadd_ps(vk11c1x01234567, vi1x0c1, vo0x0c01234567);
+        vo0x0c89ABCDEF = _mm256_fmadd_ps(vk11c1x89ABCDEF, vi1x0c1, vo0x0c89ABCDEF);
+        const __m256 vi2x0c1 = _mm256_broadcast_ss(i2 + 4);
+        vo0x0c01234567 = _mm256_fmadd_ps(vk21c1x01234567, vi2x0c1, vo0x0c01234567);
+        vo0x0c89ABCDEF = _mm256_fmadd_ps(vk21c1x89ABCDEF, vi2x0c1, vo0x0c89ABCDEF);
+        vo1x0c01234567 = _mm256_fmadd_ps(vk01c1x01234567, vi2x0c1, vo1x0c01234567);
+        vo1x0c89ABCDEF = _mm256_fmadd_ps(vk01c1x89ABCDEF, vi2x0c1, vo1x0c89ABCDEF);
+        const __m256 vi3x0c1 = _mm256_broadcast_ss(i3 + 4);
+        vo1x0c01234567 = _mm256_fmadd_ps(vk11c1x01234567, vi3x0c1, vo1x0c01234567);
+        vo1x0c89ABCDEF = _mm256_fmadd_ps(vk11c1x89ABCDEF, vi3x0c1, vo1x0c89ABCDEF);
+        const __m256 vi4x0c1 = _mm256_broadcast_ss(i4 + 4);
+        vo1x0c01234567 = _mm256_fmadd_ps(vk21c1x01234567, vi4x0c1, vo1x0c01234567);
+        vo1x0c89ABCDEF = _mm256_fmadd_ps(vk21c1x89ABCDEF, vi4x0c1, vo1x0c89ABCDEF);
+        const __m256 vk01c2x01234567 = _mm256_load_ps(w + 256);
+        const __m256 vk01c2x89ABCDEF = _mm256_load_ps(w + 264);
+        const __m256 vk11c2x01234567 = _mm256_load_ps(w + 272);
+        const __m256 vk11c2x89ABCDEF = _mm256_load_ps(w + 280);
+        const __m256 vk21c2x01234567 = _mm256_load_ps(w + 288);
+        const __m256 vk21c2x89ABCDEF = _mm256_load_ps(w + 296);
+
+        const __m256 vi0x0c2 = _mm256_broadcast_ss(i0 + 5);
+        vo0x0c01234567 = _mm256_fmadd_ps(vk01c2x01234567, vi0x0c2, vo0x0c01234567);
+        vo0x0c89ABCDEF = _mm256_fmadd_ps(vk01c2x89ABCDEF, vi0x0c2, vo0x0c89ABCDEF);
+        const __m256 vi1x0c2 = _mm256_broadcast_ss(i1 + 5);
+        vo0x0c01234567 = _mm256_fmadd_ps(vk11c2x01234567, vi1x0c2, vo0x0c01234567);
+        vo0x0c89ABCDEF = _mm256_fmadd_ps(vk11c2x89ABCDEF, vi1x0c2, vo0x0c89ABCDEF);
+        const __m256 vi2x0c2 = _mm256_broadcast_ss(i2 + 5);
+        vo0x0c01234567 = _mm256_fmadd_ps(vk21c2x01234567, vi2x0c2, vo0x0c01234567);
+        vo0x0c89ABCDEF = _mm256_fmadd_ps(vk21c2x89ABCDEF, vi2x0c2, vo0x0c89ABCDEF);
+        vo1x0c01234567 = _mm256_fmadd_ps(vk01c2x01234567, vi2x0c2, vo1x0c01234567);
+        vo1x0c89ABCDEF = _mm256_fmadd_ps(vk01c2x89ABCDEF, vi2x0c2, vo1x0c89ABCDEF);
+        const __m256 vi3x0c2 = _mm256_broadcast_ss(i3 + 5);
+        vo1x0c01234567 = _mm256_fmadd_ps(vk11c2x01234567, vi3x0c2, vo1x0c01234567);
+        vo1x0c89ABCDEF = _mm256_fmadd_ps(vk11c2x89ABCDEF, vi3x0c2, vo1x0c89ABCDEF);
+        const __m256 vi4x0c2 = _mm256_broadcast_ss(i4 + 5);
+        vo1x0c01234567 = _mm256_fmadd_ps(vk21c2x01234567, vi4x0c2, vo1x0c01234567);
+        vo1x0c89ABCDEF = _mm256_fmadd_ps(vk21c2x89ABCDEF, vi4x0c2, vo1x0c89ABCDEF);
+
+        vo0x0c01234567 = _mm256_max_ps(vo0x0c01234567, vmin);
+        vo0x0c89ABCDEF = _mm256_max_ps(vo0x0c89ABCDEF, vmin);
+        vo1x0c01234567 = _mm256_max_ps(vo1x0c01234567, vmin);
+        vo1x0c89ABCDEF = _mm256_max_ps(vo1x0c89ABCDEF, vmin);
+        vo0x0c01234567 = _mm256_min_ps(vo0x0c01234567, vmax);
+        vo0x0c89ABCDEF = _mm256_min_ps(vo0x0c89ABCDEF, vmax);
+        vo1x0c01234567 = _mm256_min_ps(vo1x0c01234567, vmax);
+        vo1x0c89ABCDEF = _mm256_min_ps(vo1x0c89ABCDEF, vmax);
+
+        if XNN_LIKELY(c >= 16) {
+          _mm256_storeu_ps(o1, vo1x0c01234567);
+          _mm256_storeu_ps(o1 + 8, vo1x0c89ABCDEF);
+          _mm256_storeu_ps(o0, vo0x0c01234567);
+          _mm256_storeu_ps(o0 + 8, vo0x0c89ABCDEF);
+        } else {
+          float* o1_tmp = o1;
+          float* o0_tmp = o0;
+          if (c & 8) {
+            _mm256_storeu_ps(o1_tmp + 0, vo1x0c01234567);
+            _mm256_storeu_ps(o0_tmp + 0, vo0x0c01234567);
+            o1_tmp += 8;
+            o0_tmp += 8;
+            vo0x0c01234567 = vo0x0c89ABCDEF;
+            vo1x0c01234567 = vo1x0c89ABCDEF;
+          }
+          __m128 vo0x0c0123 = _mm256_castps256_ps128(vo0x0c01234567);
+          __m128 vo1x0c0123 = _mm256_castps256_ps128(vo1x0c01234567);
+          if (c & 4) {
+            _mm_storeu_ps(o1_tmp, vo1x0c0123);
+            _mm_storeu_ps(o0_tmp, vo0x0c0123);
+            o1_tmp += 4;
+            o0_tmp += 4;
+            vo0x0c0123 = _mm256_extractf128_ps(vo0x0c01234567, 1);
+            vo1x0c0123 = _mm256_extractf128_ps(vo1x0c01234567, 1);
+          }
+          if (c & 2) {
+            _mm_storel_pi((__m64*) o1_tmp, vo1x0c0123);
+            _mm_storel_pi((__m64*) o0_tmp, vo0x0c0123);
+            o1_tmp += 2;
+            o0_tmp += 2;
+            vo0x0c0123 = _mm_movehl_ps(vo0x0c0123, vo0x0c0123);
+            vo1x0c0123 = _mm_movehl_ps(vo1x0c0123, vo1x0c0123);
+          }
+          if (c & 1) {
+            _mm_store_ss(o1_tmp, vo1x0c0123);
+            _mm_store_ss(o0_tmp, vo0x0c0123);
+          }
+        }
+        o1 = (float*) ((uintptr_t) o1 + output_width_stride);
+        o0 = (float*) ((uintptr_t) o0 + output_width_stride);
+      }
+      // Move output pointers back to the position of the first pixel in a row,
+      // and forward to the next block of output channels
+      o0 = (float*) ((uintptr_t) o0 - output_channel_decrement);
+      o1 = (float*) ((uintptr_t) o1 - output_channel_decrement);
+      // Revert input pointers to the position of the first pixel in a row
+      i0 = (const float*) ((uintptr_t) i0 - input_width_decrement);
+      i1 = (const float*) ((uintptr_t) i1 - input_width_decrement);
+      i2 = (const float*) ((uintptr_t) i2 - input_width_decrement);
+      i3 = (const float*) ((uintptr_t) i3 - input_width_decrement);
+      i4 = (const float*) ((uintptr_t) i4 - input_width_decrement);
+      // Move to the block of weights for the next 16 output channels
+      w += 448;
+      c = doz(c, 16);
+    } while (c != 0);
+    // Move output pointers back to the position of the first channel, and forward to the next block of rows
+    o0 = (float*) ((uintptr_t) o0 + output_height_increment);
+    o1 = (float*) ((uintptr_t) o1 + output_height_increment);
+    // Move input pointers forward to the next four rows
+    i0 = i4;
+    i1 = (const float*) ((uintptr_t) i0 + input_height_stride);
+    i2 = (const float*) ((uintptr_t) i1 + input_height_stride);
+    i3 = (const float*) ((uintptr_t) i2 + input_height_stride);
+    i4 = (const float*) ((uintptr_t) i3 + input_height_stride);
+  }
+}
+
+void xnn_f32_conv_hwc_ukernel_3x3s2p1c3x16__fma3_2x2(
+    size_t input_height,
+    size_t input_width,
+    size_t output_y_start,
+    size_t output_y_end,
+    const float* input,
+    const float* zero,
+    const float* weights,
+    float* output,
+    size_t input_padding_top,
+    size_t output_channels,
+    size_t output_height_stride,
+    size_t output_width_stride,
+    const union xnn_f32_minmax_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(input_width != 0);
+  assert(output_y_end > output_y_start);
+  assert(input_padding_top <= 1);
+  assert(output_channels != 0);
+
+  const size_t input_height_stride = input_width * 3 /* channels */ * sizeof(float);
+  const size_t input_width_decrement = round_down_po2(input_width, 2) * 3 /* channels */ * sizeof(float);
+  const size_t output_width = (input_width + 1) / 2;
+  const size_t output_channel_decrement = output_width * output_width_stride - 16 * sizeof(float);
+  const size_t output_height_increment = output_height_stride * 2 - round_up_po2(output_channels, 16) * sizeof(float);
+
+  // Adjustment for padding processed below
+  const float* i0 = (const float*) ((uintptr_t) input +
+    input_height_stride * (output_y_start * 2 /* vertical stride */ - input_padding_top));
+  const float* i1 = (const float*) ((uintptr_t) i0 + input_height_stride);
+  const float* i2 = (const float*) ((uintptr_t) i1 + input_height_stride);
+  const float* i3 = (const float*) ((uintptr_t) i2 + input_height_stride);
+  const float* i4 = (const float*) ((uintptr_t) i3 + input_height_stride);
+  float* o0 = (float*) ((uintptr_t) output + output_height_stride * output_y_start);
+  float* o1 = (float*) ((uintptr_t) o0 + output_height_stride);
+
+  if XNN_UNPREDICTABLE(output_y_start < input_padding_top) {
+    i0 = zero;
+  }
+
+  const __m256 vmin = _mm256_load_ps(params->avx.min);
+  const __m256 vmax = _mm256_load_ps(params->avx.max);
+
+  for (size_t output_y = output_y_start; output_y < output_y_end; output_y += 2) {
+    const size_t input_y2 = output_y * 2 + 2 - input_padding_top;
+    const size_t input_y4 = input_y2 + 2;
+    if XNN_UNPREDICTABLE(input_y2 > input_height) {
+      i1 = zero;
+    }
+    if XNN_UNPREDICTABLE(input_y2 >= input_height) {
+      i2 = zero;
+    }
+    if XNN_UNPREDICTABLE(input_y4 > input_height) {
+      i3 = zero;
+    }
+    if XNN_UNPREDICTABLE(input_y4 >= input_height) {
+      i4 = zero;
+    }
+    if XNN_UNPREDICTABLE(output_y + 2 > output_y_end) {
+      o1 = o0;
+    }
+
+    const float* w = weights;
+    size_t c = output_channels;
+    do {
+      // voMx0 accumulates the leftmost output pixel of the next block. The input column to the left of it
+      // is either padding, or was already accumulated at the end of the previous block.
+      __m256 vo0x0c01234567 = _mm256_load_ps(w + 0);
+      __m256 vo0x0c89ABCDEF = _mm256_load_ps(w + 8);
+      __m256 vo1x0c01234567 = vo0x0c01234567;
+      __m256 vo1x0c89ABCDEF = vo0x0c89ABCDEF;
+
+      size_t iw = input_width;
+      for (; iw >= 4; iw -= 4) {
+        __m256 vo0x1c01234567 = _mm256_load_ps(w + 0);
+        __m256 vo0x1c89ABCDEF = _mm256_load_ps(w + 8);
+        __m256 vo1x1c01234567 = vo0x1c01234567;
+        __m256 vo1x1c89ABCDEF = vo0x1c89ABCDEF;
+        __m256 vo0x2c01234567 = vo0x1c01234567;
+        __m256 vo0x2c89ABCDEF = vo0x1c89ABCDEF;
+        __m256 vo1x2c01234567 = vo0x1c01234567;
+        __m256 vo1x2c89ABCDEF = vo0x1c89ABCDEF;
+
+        const __m256 vk01c0x01234567 = _mm256_load_ps(w + 160);
+        const __m256 vk01c0x89ABCDEF = _mm256_load_ps(w + 168);
+        const __m256 vk11c0x01234567 = _mm256_load_ps(w + 176);
+        const __m256 vk11c0x89ABCDEF = _mm256_load_ps(w + 184);
+        const __m256 vk21c0x01234567 = _mm256_load_ps(w + 192);
+        const __m256 vk21c0x89ABCDEF = _mm256_load_ps(w + 200);
+
+        const __m256 vi0x0c0 = _mm256_broadcast_ss(i0 + 0);
+        const __m256 vi0x2c0 = _mm256_broadcast_ss(i0 + 6);
+        vo0x0c01234567 = _mm256_fmadd_ps(vk01c0x01234567, vi0x0c0, vo0x0c01234567);
+        vo0x0c89ABCDEF = _mm256_fmadd_ps(vk01c0x89ABCDEF, vi0x0c0, vo0x0c89ABCDEF);
+        vo0x1c01234567 = _mm256_fmadd_ps(vk01c0x01234567, vi0x2c0, vo0x1c01234567);
+        vo0x1c89ABCDEF = _mm256_fmadd_ps(vk01c0x89ABCDEF, vi0x2c0, vo0x1c89ABCDEF);
+        const __m256 vi1x0c0 = _mm256_broadcast_ss(i1 + 0);
+        const __m256 vi1x2c0 = _mm256_broadcast_ss(i1 + 6);
+        vo0x0c01234567 = _mm256_fmadd_ps(vk11c0x01234567, vi1x0c0, vo0x0c01234567);
+        vo0x0c89ABCDEF = _mm256_fmadd_ps(vk11c0x89ABCDEF, vi1x0c0, vo0x0c89ABCDEF);
+        vo0x1c01234567 = _mm256_fmadd_ps(vk11c0x01234567, vi1x2c0, vo0x1c01234567);
+        vo0x1c89ABCDEF = _mm256_fmadd_ps(vk11c0x89ABCDEF, vi1x2c0, vo0x1c89ABCDEF);
+        const __m256 vi2x0c0 = _mm256_broadcast_ss(i2 + 0);
+        const __m256 vi2x2c0 = _mm256_broadcast_ss(i2 + 6);
+        vo0x0c01234567 = _mm256_fmadd_ps(vk21c0x01234567, vi2x0c0, vo0x0c01234567);
+        vo0x0c89ABCDEF = _mm256_fmadd_ps(vk21c0x89ABCDEF, vi2x0c0, vo0x0c89ABCDEF);
+        vo0x1c01234567 = _mm256_fmadd_ps(vk21c0x01234567, vi2x2c0, vo0x1c01234567);
+        vo0x1c89ABCDEF = _mm256_fmadd_ps(vk21c0x89ABCDEF, vi2x2c0, vo0x1c89ABCDEF);
+        vo1x0c01234567 = _mm256_fmadd_ps(vk01c0x01234567, vi2x0c0, vo1x0c01234567);
+        vo1x0c89ABCDEF = _mm256_fmadd_ps(vk01c0x89ABCDEF, vi2x0c0, vo1x0c89ABCDEF);
+        vo1x1c01234567 = _mm256_fmadd_ps(vk01c0x01234567, vi2x2c0, vo1x1c01234567);
+        vo1x1c89ABCDEF = _mm256_fmadd_ps(vk01c0x89ABCDEF, vi2x2c0, vo1x1c89ABCDEF);
+        const __m256 vi3x0c0 = _mm256_broadcast_ss(i3 + 0);
+        const __m256 vi3x2c0 = _mm256_broadcast_ss(i3 + 6);
+        vo1x0c01234567 = _mm256_fmadd_ps(vk11c0x01234567, vi3x0c0, vo1x0c01234567);
+        vo1x0c89ABCDEF = _mm256_fmadd_ps(vk11c0x89ABCDEF, vi3x0c0, vo1x0c89ABCDEF);
+        vo1x1c01234567 = _mm256_fmadd_ps(vk11c0x01234567, vi3x2c0, vo1x1c01234567);
+        vo1x1c89ABCDEF = _mm256_fmadd_ps(vk11c0x89ABCDEF, vi3x2c0, vo1x1c89ABCDEF);
+        const __m256 vi4x0c0 = _mm256_broadcast_ss(i4 + 0);
+        const __m256 vi4x2c0 = _mm256_broadcast_ss(i4 + 6);
+        vo1x0c01234567 = _mm256_fmadd_ps(vk21c0x01234567, vi4x0c0, vo1x0c01234567);
+        vo1x0c89ABCDEF = _mm256_fmadd_ps(vk21c0x89ABCDEF, vi4x0c0, vo1x0c89ABCDEF);
+        vo1x1c01234567 = _mm256_fmadd_ps(vk21c0x01234567, vi4x2c0, vo1x1c01234567);
+        vo1x1c89ABCDEF = _mm256_fmadd_ps(vk21c0x89ABCDEF, vi4x2c0, vo1x1c89ABCDEF);
+
+        const __m256 vk02c0x01234567 = _mm256_load_ps(w + 304);
+        const __m256 vk02c0x89ABCDEF = _mm256_load_ps(w + 312);
+        const __m256 vk12c0x01234567 = _mm256_load_ps(w + 320);
+        const __m256 vk12c0x89ABCDEF = _mm256_load_ps(w + 328);
+        const __m256 vk22c0x01234567 = _mm256_load_ps(w + 336);
+        const __m256 vk22c0x89ABCDEF = _mm256_load_ps(w + 344);
+        const __m256 vk00c0x01234567 = _mm256_load_ps(w + 16);
+        const __m256 vk00c0x89ABCDEF = _mm256_load_ps(w + 24);
+        const __m256 vk10c0x01234567 = _mm256_load_ps(w + 32);
+        const __m256 vk10c0x89ABCDEF = _mm256_load_ps(w + 40);
+        const __m256 vk20c0x01234567 = _mm256_load_ps(w + 48);
+        const __m256 vk20c0x89ABCDEF = _mm256_load_ps(w + 56);
+
+        const __m256 vi0x1c0 = _mm256_broadcast_ss(i0 + 3);
+        const __m256 vi0x3c0 = _mm256_broadcast_ss(i0 + 9);
+        vo0x0c01234567 = _mm256_fmadd_ps(vk02c0x01234567, vi0x1c0, vo0x0c01234567);
+        vo0x0c89ABCDEF = _mm256_fmadd_ps(vk02c0x89ABCDEF, vi0x1c0, vo0x0c89ABCDEF);
+        vo0x1c01234567 = _mm256_fmadd_ps(vk00c0x01234567, vi0x1c0, vo0x1c01234567);
+        vo0x1c89ABCDEF = _mm256_fmadd_ps(vk00c0x89ABCDEF, vi0x1c0, vo0x1c89ABCDEF);
+        vo0x1c01234567 = _mm256_fmadd_ps(vk02c0x01234567, vi0x3c0, vo0x1c01234567);
+        vo0x1c89ABCDEF = _mm256_fmadd_ps(vk02c0x89ABCDEF, vi0x3c0, vo0x1c89ABCDEF);
+        vo0x2c01234567 = _mm256_fmadd_ps(vk00c0x01234567, vi0x3c0, vo0x2c01234567);
+        vo0x2c89ABCDEF = _mm256_fmadd_ps(vk00c0x89ABCDEF, vi0x3c0, vo0x2c89ABCDEF);
+        const __m256 vi1x1c0 = _mm256_broadcast_ss(i1 + 3);
+        const __m256 vi1x3c0 = _mm256_broadcast_ss(i1 + 9);
+        vo0x0c01234567 = _mm256_fmadd_ps(vk12c0x01234567, vi1x1c0, vo0x0c01234567);
+        vo0x0c89ABCDEF = _mm256_fmadd_ps(vk12c0x89ABCDEF, vi1x1c0, vo0x0c89ABCDEF);
+        vo0x1c01234567 = _mm256_fmadd_ps(vk10c0x01234567, vi1x1c0, vo0x1c01234567);
+        vo0x1c89ABCDEF = _mm256_fmadd_ps(vk10c0x89ABCDEF, vi1x1c0, vo0x1c89ABCDEF);
+        vo0x1c01234567 = _mm256_fmadd_ps(vk12c0x01234567, vi1x3c0, vo0x1c01234567);
+        vo0x1c89ABCDEF = _mm256_fmadd_ps(vk12c0x89ABCDEF, vi1x3c0, vo0x1c89ABCDEF);
+        vo0x2c01234567 = _mm256_fmadd_ps(vk10c0x01234567, vi1x3c0, vo0x2c01234567);
+        vo0x2c89ABCDEF = _mm256_fmadd_ps(vk10c0x89ABCDEF, vi1x3c0, vo0x2c89ABCDEF);
+        const __m256 vi2x1c0 = _mm256_broadcast_ss(i2 + 3);
+        const __m256 vi2x3c0 = _mm256_broadcast_ss(i2 + 9);
+        vo0x0c01234567 = _mm256_fmadd_ps(vk22c0x01234567, vi2x1c0, vo0x0c01234567);
+        vo0x0c89ABCDEF = _mm256_fmadd_ps(vk22c0x89ABCDEF, vi2x1c0, vo0x0c89ABCDEF);
+        vo0x1c01234567 = _mm256_fmadd_ps(vk20c0x01234567, vi2x1c0, vo0x1c01234567);
+        vo0x1c89ABCDEF = _mm256_fmadd_ps(vk20c0x89ABCDEF, vi2x1c0, vo0x1c89ABCDEF);
+        vo0x1c01234567 = _mm256_fmadd_ps(vk22c0x01234567, vi2x3c0, vo0x1c01234567);
+        vo0x1c89ABCDEF = _mm256_fmadd_ps(vk22c0x89ABCDEF, vi2x3c0, vo0x1c89ABCDEF);
+        vo0x2c01234567 = _mm256_fmadd_ps(vk20c0x01234567, vi2x3c0, vo0x2c01234567);
+        vo0x2c89ABCDEF = _mm256_fmadd_ps(vk20c0x89ABCDEF, vi2x3c0, vo0x2c89ABCDEF);
+        vo1x0c01234567 = _mm256_fmadd_ps(vk02c0x01234567, vi2x1c0, vo1x0c01234567);
+        vo1x0c89ABCDEF = _mm256_fmadd_ps(vk02c0x89ABCDEF, vi2x1c0, vo1x0c89ABCDEF);
+        vo1x1c01234567 = _mm256_fmadd_ps(vk00c0x01234567, vi2x1c0, vo1x1c01234567);
+        vo1x1c89ABCDEF = _mm256_fmadd_ps(vk00c0x89ABCDEF, vi2x1c0, vo1x1c89ABCDEF);
+        vo1x1c01234567 = _mm256_fmadd_ps(vk02c0x01234567, vi2x3c0, vo1x1c01234567);
+        vo1x1c89ABCDEF = _mm256_fmadd_ps(vk02c0x89ABCDEF, vi2x3c0, vo1x1c89ABCDEF);
+        vo1x2c01234567 = _mm256_fmadd_ps(vk00c0x01234567, vi2x3c0, vo1x2c01234567);
+        vo1x2c89ABCDEF = _mm256_fmadd_ps(vk00c0x89ABCDEF, vi2x3c0, vo1x2c89ABCDEF);
+        const __m256 vi3x1c0 = _mm256_broadcast_ss(i3 + 3);
+        const __m256 vi3x3c0 = _mm256_broadcast_ss(i3 + 9);
+        vo1x0c01234567 = _mm256_fmadd_ps(vk12c0x01234567, vi3x1c0, vo1x0c01234567);
+        vo1x0c89ABCDEF = _mm256_fmadd_ps(vk12c0x89ABCDEF, vi3x1c0, vo1x0c89ABCDEF);
+        vo1x1c01234567 = _mm256_fmadd_ps(vk10c0x01234567, vi3x1c0, vo1x1c01234567);
+        vo1x1c89ABCDEF = _mm256_fmadd_ps(vk10c0x89ABCDEF, vi3x1c0, vo1x1c89ABCDEF);
+        vo1x1c01234567 = _mm256_fmadd_ps(vk12c0x01234567, vi3x3c0, vo1x1c01234567);
+        vo1x1c89ABCDEF = _mm256_fmadd_ps(vk12c0x89ABCDEF, vi3x3c0, vo1x1c89ABCDEF);
+        vo1x2c01234567 = _mm256_fmadd_ps(vk10c0x01234567, vi3x3c0, vo1x2c01234567);
+        vo1x2c89ABCDEF = _mm256_fmadd_ps(vk10c0x89ABCDEF, vi3x3c0, vo1x2c89ABCDEF);
+        const __m256 vi4x1c0 = _mm256_broadcast_ss(i4 + 3);
+        const __m256 vi4x3c0 = _mm256_broadcast_ss(i4 + 9);
+        vo1x0c01234567 = _mm256_fmadd_ps(vk22c0x01234567, vi4x1c0, vo1x0c01234567);
+        vo1x0c89ABCDEF = _mm256_fmadd_ps(vk22c0x89ABCDEF, vi4x1c0, vo1x0c89ABCDEF);
+        vo1x1c01234567 = _mm256_fmadd_ps(vk20c0x01234567, vi4x1c0, vo1x1c01234567);
+        vo1x1c89ABCDEF = _mm256_fmadd_ps(vk20c0x89ABCDEF, vi4x1c0, vo1x1c89ABCDEF);
+        vo1x1c01234567 = _mm256_fmadd_ps(vk22c0x01234567, vi4x3c0, vo1x1c01234567);
+        vo1x1c89ABCDEF = _mm256_fmadd_ps(vk22c0x89ABCDEF, vi4x3c0, vo1x1c89ABCDEF);
+        vo1x2c01234567 = _mm256_fmadd_ps(vk20c0x01234567, vi4x3c0, vo1x2c01234567);
+        vo1x2c89ABCDEF = _mm256_fmadd_ps(vk20c0x89ABCDEF, vi4x3c0, vo1x2c89ABCDEF);
+        const __m256 vk01c1x01234567 = _mm256_load_ps(w + 208);
+        const __m256 vk01c1x89ABCDEF = _mm256_load_ps(w + 216);
+        const __m256 vk11c1x01234567 = _mm256_load_ps(w + 224);
+        const __m256 vk11c1x89ABCDEF = _mm256_load_ps(w + 232);
+        const __m256 vk21c1x01234567 = _mm256_load_ps(w + 240);
+        const __m256 vk21c1x89ABCDEF = _mm256_load_ps(w + 248);
+
+        const __m256 vi0x0c1 = _mm256_broadcast_ss(i0 + 1);
+        const __m256 vi0x2c1 = _mm256_broadcast_ss(i0 + 7);
+        vo0x0c01234567 = _mm256_fmadd_ps(vk01c1x01234567, vi0x0c1, vo0x0c01234567);
+        vo0x0c89ABCDEF = _mm256_fmadd_ps(vk01c1x89ABCDEF, vi0x0c1, vo0x0c89ABCDEF);
+        vo0x1c01234567 = _mm256_fmadd_ps(vk01c1x01234567, vi0x2c1, vo0x1c01234567);
+        vo0x1c89ABCDEF = _mm256_fmadd_ps(vk01c1x89ABCDEF, vi0x2c1, vo0x1c89ABCDEF);
+        const __m256 vi1x0c1 = _mm256_broadcast_ss(i1 + 1);
+        const __m256 vi1x2c1 = _mm256_broadcast_ss(i1 + 7);
+        vo0x0c01234567 = _mm256_fmadd_ps(vk11c1x01234567, vi1x0c1, vo0x0c01234567);
+        vo0x0c89ABCDEF = _mm256_fmadd_ps(vk11c1x89ABCDEF, vi1x0c1, vo0x0c89ABCDEF);
+        vo0x1c01234567 = _mm256_fmadd_ps(vk11c1x01234567, vi1x2c1, vo0x1c01234567);
+        vo0x1c89ABCDEF = _mm256_fmadd_ps(vk11c1x89ABCDEF, vi1x2c1, vo0x1c89ABCDEF);
+        const __m256 vi2x0c1 = _mm256_broadcast_ss(i2 + 1);
+        const __m256 vi2x2c1 = _mm256_broadcast_ss(i2 + 7);
+        vo0x0c01234567 = _mm256_fmadd_ps(vk21c1x01234567, vi2x0c1, vo0x0c01234567);
+        vo0x0c89ABCDEF = _mm256_fmadd_ps(vk21c1x89ABCDEF, vi2x0c1, vo0x0c89ABCDEF);
+        vo0x1c01234567 = _mm256_fmadd_ps(vk21c1x01234567, vi2x2c1, vo0x1c01234567);
+        vo0x1c89ABCDEF = _mm256_fmadd_ps(vk21c1x89ABCDEF, vi2x2c1, vo0x1c89ABCDEF);
+        vo1x0c01234567 = _mm256_fmadd_ps(vk01c1x01234567, vi2x0c1, vo1x0c01234567);
+        vo1x0c89ABCDEF = _mm256_fmadd_ps(vk01c1x89ABCDEF, vi2x0c1, vo1x0c89ABCDEF);
+        vo1x1c01234567 = _mm256_fmadd_ps(vk01c1x01234567, vi2x2c1, vo1x1c01234567);
+        vo1x1c89ABCDEF = _mm256_fmadd_ps(vk01c1x89ABCDEF, vi2x2c1, vo1x1c89ABCDEF);
+        const __m256 vi3x0c1 = _mm256_broadcast_ss(i3 + 1);
+        const __m256 vi3x2c1 = _mm256_broadcast_ss(i3 + 7);
+        vo1x0c01234567 = _mm256_fmadd_ps(vk11c1x01234567, vi3x0c1, vo1x0c01234567);
+        vo1x0c89ABCDEF = _mm256_fmadd_ps(vk11c1x89ABCDEF, vi3x0c1, vo1x0c89ABCDEF);
+        vo1x1c01234567 = _mm256_fmadd_ps(vk11c1x01234567, vi3x2c1, vo1x1c01234567);
+        vo1x1c89ABCDEF = _mm256_fmadd_ps(vk11c1x89ABCDEF, vi3x2c1, vo1x1c89ABCDEF);
+        const __m256 vi4x0c1 = _mm256_broadcast_ss(i4 + 1);
+        const __m256 vi4x2c1 = _mm256_broadcast_ss(i4 + 7);
+        vo1x0c01234567 = _mm256_fmadd_ps(vk21c1x01234567, vi4x0c1, vo1x0c01234567);
+        vo1x0c89ABCDEF = _mm256_fmadd_ps(vk21c1x89ABCDEF, vi4x0c1, vo1x0c89ABCDEF);
+        vo1x1c01234567 = _mm256_fmadd_ps(vk21c1x01234567, vi4x2c1, vo1x1c01234567);
+        vo1x1c89ABCDEF = _mm256_fmadd_ps(vk21c1x89ABCDEF, vi4x2c1, vo1x1c89ABCDEF);
+
+        const __m256 vk02c1x01234567 = _mm256_load_ps(w + 352);
+        const __m256 vk02c1x89ABCDEF = _mm256_load_ps(w + 360);
+        const __m256 vk12c1x01234567 = _mm256_load_ps(w + 368);
+        const __m256 vk12c1x89ABCDEF = _mm256_load_ps(w + 376);
+        const __m256 vk22c1x01234567 = _mm256_load_ps(w + 384);
+        const __m256 vk22c1x89ABCDEF = _mm256_load_ps(w + 392);
+        const __m256 vk00c1x01234567 = _mm256_load_ps(w + 64);
+        const __m256 vk00c1x89ABCDEF = _mm256_load_ps(w + 72);
+        const __m256 vk10c1x01234567 = _mm256_load_ps(w + 80);
+        const __m256 vk10c1x89ABCDEF = _mm256_load_ps(w + 88);
+        const __m256 vk20c1x01234567 = _mm256_load_ps(w + 96);
+        const __m256 vk20c1x89ABCDEF = _mm256_load_ps(w + 104);
+
+        const __m256 vi0x1c1 = _mm256_broadcast_ss(i0 + 4);
+        const __m256 vi0x3c1 = _mm256_broadcast_ss(i0 + 10);
+        vo0x0c01234567 = _mm256_fmadd_ps(vk02c1x01234567, vi0x1c1, vo0x0c01234567);
+        vo0x0c89ABCDEF = _mm256_fmadd_ps(vk02c1x89ABCDEF, vi0x1c1, vo0x0c89ABCDEF);
+        vo0x1c01234567 = _mm256_fmadd_ps(vk00c1x01234567, vi0x1c1, vo0x1c01234567);
+        vo0x1c89ABCDEF = _mm256_fmadd_ps(vk00c1x89ABCDEF, vi0x1c1, vo0x1c89ABCDEF);
+        vo0x1c01234567 = _mm256_fmadd_ps(vk02c1x01234567, vi0x3c1, vo0x1c01234567);
+        vo0x1c89ABCDEF = _mm256_fmadd_ps(vk02c1x89ABCDEF, vi0x3c1, vo0x1c89ABCDEF);
+        vo0x2c01234567 = _mm256_fmadd_ps(vk00c1x01234567, vi0x3c1, vo0x2c01234567);
+        vo0x2c89ABCDEF = _mm256_fmadd_ps(vk00c1x89ABCDEF, vi0x3c1, vo0x2c89ABCDEF);
+        const __m256 vi1x1c1 = _mm256_broadcast_ss(i1 + 4);
+        const __m256 vi1x3c1 = _mm256_broadcast_ss(i1 + 10);
+        vo0x0c01234567 = _mm256_fmadd_ps(vk12c1x01234567, vi1x1c1, vo0x0c01234567);
+        vo0x0c89ABCDEF = _mm256_fmadd_ps(vk12c1x89ABCDEF, vi1x1c1, vo0x0c89ABCDEF);
+        vo0x1c01234567 = _mm256_fmadd_ps(vk10c1x01234567, vi1x1c1, vo0x1c01234567);
+        vo0x1c89ABCDEF = _mm256_fmadd_ps(vk10c1x89ABCDEF, vi1x1c1, vo0x1c89ABCDEF);
+        vo0x1c01234567 = _mm256_fmadd_ps(vk12c1x01234567, vi1x3c1, vo0x1c01234567);
+        vo0x1c89ABCDEF = _mm256_fmadd_ps(vk12c1x89ABCDEF, vi1x3c1, vo0x1c89ABCDEF);
+        vo0x2c01234567 = _mm256_fmadd_ps(vk10c1x01234567, vi1x3c1, vo0x2c01234567);
+        vo0x2c89ABCDEF = _mm256_fmadd_ps(vk10c1x89ABCDEF, vi1x3c1, vo0x2c89ABCDEF);
+        const __m256 vi2x1c1 = _mm256_broadcast_ss(i2 + 4);
+        const __m256 vi2x3c1 = _mm256_broadcast_ss(i2 + 10);
+        vo0x0c01234567 = _mm256_fmadd_ps(vk22c1x01234567, vi2x1c1, vo0x0c01234567);
+        vo0x0c89ABCDEF = _mm256_fmadd_ps(vk22c1x89ABCDEF, vi2x1c1, vo0x0c89ABCDEF);
+        vo0x1c01234567 = _mm256_fmadd_ps(vk20c1x01234567, vi2x1c1, vo0x1c01234567);
+        vo0x1c89ABCDEF = _mm256_fmadd_ps(vk20c1x89ABCDEF, vi2x1c1, vo0x1c89ABCDEF);
+        vo0x1c01234567 = _mm256_fmadd_ps(vk22c1x01234567, vi2x3c1, vo0x1c01234567);
+        vo0x1c89ABCDEF = _mm256_fmadd_ps(vk22c1x89ABCDEF, vi2x3c1, vo0x1c89ABCDEF);
+        vo0x2c01234567 = _mm256_fmadd_ps(vk20c1x01234567, vi2x3c1, vo0x2c01234567);
+        vo0x2c89ABCDEF = _mm256_fmadd_ps(vk20c1x89ABCDEF, vi2x3c1, vo0x2c89ABCDEF);
+        vo1x0c01234567 = _mm256_fmadd_ps(vk02c1x01234567, vi2x1c1, vo1x0c01234567);
+        vo1x0c89ABCDEF = _mm256_fmadd_ps(vk02c1x89ABCDEF, vi2x1c1, vo1x0c89ABCDEF);
+        vo1x1c01234567 = _mm256_fmadd_ps(vk00c1x01234567, vi2x1c1, vo1x1c01234567);
+        vo1x1c89ABCDEF = _mm256_fmadd_ps(vk00c1x89ABCDEF, vi2x1c1, vo1x1c89ABCDEF);
+        vo1x1c01234567 = _mm256_fmadd_ps(vk02c1x01234567, vi2x3c1, vo1x1c01234567);
+        vo1x1c89ABCDEF = _mm256_fmadd_ps(vk02c1x89ABCDEF, vi2x3c1, vo1x1c89ABCDEF);
+        vo1x2c01234567 = _mm256_fmadd_ps(vk00c1x01234567, vi2x3c1, vo1x2c01234567);
+        vo1x2c89ABCDEF = _mm256_fmadd_ps(vk00c1x89ABCDEF, vi2x3c1, vo1x2c89ABCDEF);
+        const __m256 vi3x1c1 = _mm256_broadcast_ss(i3 + 4);
+        const __m256 vi3x3c1 = _mm256_broadcast_ss(i3 + 10);
+        vo1x0c01234567 = _mm256_fmadd_ps(vk12c1x01234567, vi3x1c1, vo1x0c01234567);
+        vo1x0c89ABCDEF = _mm256_fmadd_ps(vk12c1x89ABCDEF, vi3x1c1, vo1x0c89ABCDEF);
+        vo1x1c01234567 = _mm256_fmadd_ps(vk10c1x01234567, vi3x1c1, vo1x1c01234567);
+        vo1x1c89ABCDEF = _mm256_fmadd_ps(vk10c1x89ABCDEF, vi3x1c1, vo1x1c89ABCDEF);
+        vo1x1c01234567 = _mm256_fmadd_ps(vk12c1x01234567, vi3x3c1, vo1x1c01234567);
+        vo1x1c89ABCDEF = _mm256_fmadd_ps(vk12c1x89ABCDEF, vi3x3c1, vo1x1c89ABCDEF);
+        vo1x2c01234567 = _mm256_fmadd_ps(vk10c1x01234567, vi3x3c1, vo1x2c01234567);
+        vo1x2c89ABCDEF = _mm256_fmadd_ps(vk10c1x89ABCDEF, vi3x3c1, vo1x2c89ABCDEF);
+        const __m256 vi4x1c1 = _mm256_broadcast_ss(i4 + 4);
+        const __m256 vi4x3c1 = _mm256_broadcast_ss(i4 + 10);
+        vo1x0c01234567 = _mm256_fmadd_ps(vk22c1x01234567, vi4x1c1, vo1x0c01234567);
+        vo1x0c89ABCDEF = _mm256_fmadd_ps(vk22c1x89ABCDEF, vi4x1c1, vo1x0c89ABCDEF);
+        vo1x1c01234567 = _mm256_fmadd_ps(vk20c1x01234567, vi4x1c1, vo1x1c01234567);
+        vo1x1c89ABCDEF = _mm256_fmadd_ps(vk20c1x89ABCDEF, vi4x1c1, vo1x1c89ABCDEF);
+        vo1x1c01234567 = _mm256_fmadd_ps(vk22c1x01234567, vi4x3c1, vo1x1c01234567);
+        vo1x1c89ABCDEF = _mm256_fmadd_ps(vk22c1x89ABCDEF, vi4x3c1, vo1x1c89ABCDEF);
+        vo1x2c01234567 = _mm256_fmadd_ps(vk20c1x01234567, vi4x3c1, vo1x2c01234567);
+        vo1x2c89ABCDEF = _mm256_fmadd_ps(vk20c1x89ABCDEF, vi4x3c1, vo1x2c89ABCDEF);
+        const __m256 vk01c2x01234567 = _mm256_load_ps(w + 256);
+        const __m256 vk01c2x89ABCDEF = _mm256_load_ps(w + 264);
+        const __m256 vk11c2x01234567 = _mm256_load_ps(w + 272);
+        const __m256 vk11c2x89ABCDEF = _mm256_load_ps(w + 280);
+        const __m256 vk21c2x01234567 = _mm256_load_ps(w + 288);
+        const __m256 vk21c2x89ABCDEF = _mm256_load_ps(w + 296);
+
+        const __m256 vi0x0c2 = _mm256_broadcast_ss(i0 + 2);
+        const __m256 vi0x2c2 = _mm256_broadcast_ss(i0 + 8);
+        vo0x0c01234567 = _mm256_fmadd_ps(vk01c2x01234567, vi0x0c2, vo0x0c01234567);
+        vo0x0c89ABCDEF = _mm256_fmadd_ps(vk01c2x89ABCDEF, vi0x0c2, vo0x0c89ABCDEF);
+        vo0x1c01234567 = _mm256_fmadd_ps(vk01c2x01234567, vi0x2c2, vo0x1c01234567);
+        vo0x1c89ABCDEF = _mm256_fmadd_ps(vk01c2x89ABCDEF, vi0x2c2, vo0x1c89ABCDEF);
+        const __m256 vi1x0c2 = _mm256_broadcast_ss(i1 + 2);
+        const __m256 vi1x2c2 = _mm256_broadcast_ss(i1 + 8);
+        vo0x0c01234567 = _mm256_fmadd_ps(vk11c2x01234567, vi1x0c2, vo0x0c01234567);
+        vo0x0c89ABCDEF = _mm256_fmadd_ps(vk11c2x89ABCDEF, vi1x0c2, vo0x0c89ABCDEF);
+        vo0x1c01234567 = _mm256_fmadd_ps(vk11c2x01234567, vi1x2c2, vo0x1c01234567);
+        vo0x1c89ABCDEF = _mm256_fmadd_ps(vk11c2x89ABCDEF, vi1x2c2, vo0x1c89ABCDEF);
+        const __m256 vi2x0c2 = _mm256_broadcast_ss(i2 + 2);
+        const __m256 vi2x2c2 = _mm256_broadcast_ss(i2 + 8);
+        vo0x0c01234567 = _mm256_fmadd_ps(vk21c2x01234567, vi2x0c2, vo0x0c01234567);
+        vo0x0c89ABCDEF = _mm256_fmadd_ps(vk21c2x89ABCDEF, vi2x0c2, vo0x0c89ABCDEF);
+        vo0x1c01234567 = _mm256_fmadd_ps(vk21c2x01234567, vi2x2c2, vo0x1c01234567);
+        vo0x1c89ABCDEF = _mm256_fmadd_ps(vk21c2x89ABCDEF, vi2x2c2, vo0x1c89ABCDEF);
+        vo1x0c01234567 = _mm256_fmadd_ps(vk01c2x01234567, vi2x0c2, vo1x0c01234567);
+        vo1x0c89ABCDEF = _mm256_fmadd_ps(vk01c2x89ABCDEF, vi2x0c2, vo1x0c89ABCDEF);
+        vo1x1c01234567 = _mm256_fmadd_ps(vk01c2x01234567, vi2x2c2, vo1x1c01234567);
+        vo1x1c89ABCDEF = _mm256_fmadd_ps(vk01c2x89ABCDEF, vi2x2c2, vo1x1c89ABCDEF);
+        const __m256 vi3x0c2 = _mm256_broadcast_ss(i3 + 2);
+        const __m256 vi3x2c2 = _mm256_broadcast_ss(i3 + 8);
+        vo1x0c01234567 = _mm256_fmadd_ps(vk11c2x01234567, vi3x0c2, vo1x0c01234567);
+        vo1x0c89ABCDEF = _mm256_fmadd_ps(vk11c2x89ABCDEF, vi3x0c2, vo1x0c89ABCDEF);
+        vo1x1c01234567 = _mm256_fmadd_ps(vk11c2x01234567, vi3x2c2, vo1x1c01234567);
+        vo1x1c89ABCDEF = _mm256_fmadd_ps(vk11c2x89ABCDEF, vi3x2c2, vo1x1c89ABCDEF);
+        const __m256 vi4x0c2 = _mm256_broadcast_ss(i4 + 2);
+        const __m256 vi4x2c2 = _mm256_broadcast_ss(i4 + 8);
+        vo1x0c01234567 = _mm256_fmadd_ps(vk21c2x01234567, vi4x0c2, vo1x0c01234567);
+        vo1x0c89ABCDEF = _mm256_fmadd_ps(vk21c2x89ABCDEF, vi4x0c2, vo1x0c89ABCDEF);
+        vo1x1c01234567 = _mm256_fmadd_ps(vk21c2x01234567, vi4x2c2, vo1x1c01234567);
+        vo1x1c89ABCDEF = _mm256_fmadd_ps(vk21c2x89ABCDEF, vi4x2c2, vo1x1c89ABCDEF);
+
+        const __m256 vk02c2x01234567 = _mm256_load_ps(w + 400);
+        const __m256 vk02c2x89ABCDEF = _mm256_load_ps(w + 408);
+        const __m256 vk12c2x01234567 = _mm256_load_ps(w + 416);
+        const __m256 vk12c2x89ABCDEF = _mm256_load_ps(w + 424);
+        const __m256 vk22c2x01234567 = _mm256_load_ps(w + 432);
+        const __m256 vk22c2x89ABCDEF = _mm256_load_ps(w + 440);
+        const __m256 vk00c2x01234567 = _mm256_load_ps(w + 112);
+        const __m256 vk00c2x89ABCDEF = _mm256_load_ps(w + 120);
+        const __m256 vk10c2x01234567 = _mm256_load_ps(w + 128);
+        const __m256 vk10c2x89ABCDEF = _mm256_load_ps(w + 136);
+        const __m256 vk20c2x01234567 = _mm256_load_ps(w + 144);
+        const __m256 vk20c2x89ABCDEF = _mm256_load_ps(w + 152);
+
+        const __m256 vi0x1c2 = _mm256_broadcast_ss(i0 + 5);
+        const __m256 vi0x3c2 = _mm256_broadcast_ss(i0 + 11);
+        vo0x0c01234567 = _mm256_fmadd_ps(vk02c2x01234567, vi0x1c2, vo0x0c01234567);
+        vo0x0c89ABCDEF = _mm256_fmadd_ps(vk02c2x89ABCDEF, vi0x1c2, vo0x0c89ABCDEF);
+        vo0x1c01234567 = _mm256_fmadd_ps(vk00c2x01234567, vi0x1c2, vo0x1c01234567);
+        vo0x1c89ABCDEF = _mm256_fmadd_ps(vk00c2x89ABCDEF, vi0x1c2, vo0x1c89ABCDEF);
+        vo0x1c01234567 = _mm256_fmadd_ps(vk02c2x01234567, vi0x3c2, vo0x1c01234567);
+        vo0x1c89ABCDEF = _mm256_fmadd_ps(vk02c2x89ABCDEF, vi0x3c2, vo0x1c89ABCDEF);
+        vo0x2c01234567 = _mm256_fmadd_ps(vk00c2x01234567, vi0x3c2, vo0x2c01234567);
+        vo0x2c89ABCDEF = _mm256_fmadd_ps(vk00c2x89ABCDEF, vi0x3c2, vo0x2c89ABCDEF);
+        const __m256 vi1x1c2 = _mm256_broadcast_ss(i1 + 5);
+        const __m256 vi1x3c2 = _mm256_broadcast_ss(i1 + 11);
+        vo0x0c01234567 = _mm256_fmadd_ps(vk12c2x01234567, vi1x1c2, vo0x0c01234567);
+        vo0x0c89ABCDEF = _mm256_fmadd_ps(vk12c2x89ABCDEF, vi1x1c2, vo0x0c89ABCDEF);
+        vo0x1c01234567 = _mm256_fmadd_ps(vk10c2x01234567, vi1x1c2, vo0x1c01234567);
+        vo0x1c89ABCDEF = _mm256_fmadd_ps(vk10c2x89ABCDEF, vi1x1c2, vo0x1c89ABCDEF);
+        vo0x1c01234567 = _mm256_fmadd_ps(vk12c2x01234567, vi1x3c2, vo0x1c01234567);
+        vo0x1c89ABCDEF = _mm256_fmadd_ps(vk12c2x89ABCDEF, vi1x3c2, vo0x1c89ABCDEF);
+        vo0x2c01234567 = _mm256_fmadd_ps(vk10c2x01234567, vi1x3c2, vo0x2c01234567);
+        vo0x2c89ABCDEF = _mm256_fmadd_ps(vk10c2x89ABCDEF, vi1x3c2, vo0x2c89ABCDEF);
+        const __m256 vi2x1c2 = _mm256_broadcast_ss(i2 + 5);
+        const __m256 vi2x3c2 = _mm256_broadcast_ss(i2 + 11);
+        vo0x0c01234567 = _mm256_fmadd_ps(vk22c2x01234567, vi2x1c2, vo0x0c01234567);
+        vo0x0c89ABCDEF = _mm256_fmadd_ps(vk22c2x89ABCDEF, vi2x1c2, vo0x0c89ABCDEF);
+        vo0x1c01234567 = _mm256_fmadd_ps(vk20c2x01234567, vi2x1c2, vo0x1c01234567);
+        vo0x1c89ABCDEF = _mm256_fmadd_ps(vk20c2x89ABCDEF, vi2x1c2, vo0x1c89ABCDEF);
+        vo0x1c01234567 = _mm256_fmadd_ps(vk22c2x01234567, vi2x3c2, vo0x1c01234567);
+        vo0x1c89ABCDEF = _mm256_fmadd_ps(vk22c2x89ABCDEF, vi2x3c2, vo0x1c89ABCDEF);
+        vo0x2c01234567 = _mm256_fmadd_ps(vk20c2x01234567, vi2x3c2, vo0x2c01234567);
+        vo0x2c89ABCDEF = _mm256_fmadd_ps(vk20c2x89ABCDEF, vi2x3c2, vo0x2c89ABCDEF);
+        vo1x0c01234567 = _mm256_fmadd_ps(vk02c2x01234567, vi2x1c2, vo1x0c01234567);
+        vo1x0c89ABCDEF = _mm256_fmadd_ps(vk02c2x89ABCDEF, vi2x1c2, vo1x0c89ABCDEF);
+        vo1x1c01234567 = _mm256_fmadd_ps(vk00c2x01234567, vi2x1c2, vo1x1c01234567);
+        vo1x1c89ABCDEF = _mm256_fmadd_ps(vk00c2x89ABCDEF, vi2x1c2, vo1x1c89ABCDEF);
+        vo1x1c01234567 = _mm256_fmadd_ps(vk02c2x01234567, vi2x3c2, vo1x1c01234567);
+        vo1x1c89ABCDEF = _mm256_fmadd_ps(vk02c2x89ABCDEF, vi2x3c2, vo1x1c89ABCDEF);
+        vo1x2c01234567 = _mm256_fmadd_ps(vk00c2x01234567, vi2x3c2, vo1x2c01234567);
+        vo1x2c89ABCDEF = _mm256_fmadd_ps(vk00c2x89ABCDEF, vi2x3c2, vo1x2c89ABCDEF);
+        const __m256 vi3x1c2 = _mm256_broadcast_ss(i3 + 5);
+        const __m256 vi3x3c2 = _mm256_broadcast_ss(i3 + 11);
+        vo1x0c01234567 = _mm256_fmadd_ps(vk12c2x01234567, vi3x1c2, vo1x0c01234567);
+        vo1x0c89ABCDEF = _mm256_fmadd_ps(vk12c2x89ABCDEF, vi3x1c2, vo1x0c89ABCDEF);
+        vo1x1c01234567 = _mm256_fmadd_ps(vk10c2x01234567, vi3x1c2, vo1x1c01234567);
+        vo1x1c89ABCDEF = _mm256_fmadd_ps(vk10c2x89ABCDEF, vi3x1c2, vo1x1c89ABCDEF);
+        vo1x1c01234567 = _mm256_fmadd_ps(vk12c2x01234567, vi3x3c2, vo1x1c01234567);
+        vo1x1c89ABCDEF = _mm256_fmadd_ps(vk12c2x89ABCDEF, vi3x3c2, vo1x1c89ABCDEF);
+        vo1x2c01234567 = _mm256_fmadd_ps(vk10c2x01234567, vi3x3c2, vo1x2c01234567);
+        vo1x2c89ABCDEF = _mm256_fmadd_ps(vk10c2x89ABCDEF, vi3x3c2, vo1x2c89ABCDEF);
+        const __m256 vi4x1c2 = _mm256_broadcast_ss(i4 + 5);
+        const __m256 vi4x3c2 = _mm256_broadcast_ss(i4 + 11);
+        vo1x0c01234567 = _mm256_fmadd_ps(vk22c2x01234567, vi4x1c2, vo1x0c01234567);
+        vo1x0c89ABCDEF = _mm256_fmadd_ps(vk22c2x89ABCDEF, vi4x1c2, vo1x0c89ABCDEF);
+        vo1x1c01234567 = _mm256_fmadd_ps(vk20c2x01234567, vi4x1c2, vo1x1c01234567);
+        vo1x1c89ABCDEF = _mm256_fmadd_ps(vk20c2x89ABCDEF, vi4x1c2, vo1x1c89ABCDEF);
+        vo1x1c01234567 = _mm256_fmadd_ps(vk22c2x01234567, vi4x3c2, vo1x1c01234567);
+        vo1x1c89ABCDEF = _mm256_fmadd_ps(vk22c2x89ABCDEF, vi4x3c2, vo1x1c89ABCDEF);
+        vo1x2c01234567 = _mm256_fmadd_ps(vk20c2x01234567, vi4x3c2, vo1x2c01234567);
+        vo1x2c89ABCDEF = _mm256_fmadd_ps(vk20c2x89ABCDEF, vi4x3c2, vo1x2c89ABCDEF);
+
+        i0 += 12;
+        i1 += 12;
+        i2 += 12;
+        i3 += 12;
+        i4 += 12;
+
+        vo0x0c01234567 = _mm256_max_ps(vo0x0c01234567, vmin);
+        vo0x0c89ABCDEF = _mm256_max_ps(vo0x0c89ABCDEF, vmin);
+        vo0x1c01234567 = _mm256_max_ps(vo0x1c01234567, vmin);
+        vo0x1c89ABCDEF = _mm256_max_ps(vo0x1c89ABCDEF, vmin);
+        vo1x0c01234567 = _mm256_max_ps(vo1x0c01234567, vmin);
+        vo1x0c89ABCDEF = _mm256_max_ps(vo1x0c89ABCDEF, vmin);
+        vo1x1c01234567 = _mm256_max_ps(vo1x1c01234567, vmin);
+        vo1x1c89ABCDEF = _mm256_max_ps(vo1x1c89ABCDEF, vmin);
+        vo0x0c01234567 = _mm256_min_ps(vo0x0c01234567, vmax);
+        vo0x0c89ABCDEF = _mm256_min_ps(vo0x0c89ABCDEF, vmax);
+        vo0x1c01234567 = _mm256_min_ps(vo0x1c01234567, vmax);
+        vo0x1c89ABCDEF = _mm256_min_ps(vo0x1c89ABCDEF, vmax);
+        vo1x0c01234567 = _mm256_min_ps(vo1x0c01234567, vmax);
+        vo1x0c89ABCDEF = _mm256_min_ps(vo1x0c89ABCDEF, vmax);
+        vo1x1c01234567 = _mm256_min_ps(vo1x1c01234567, vmax);
+        vo1x1c89ABCDEF = _mm256_min_ps(vo1x1c89ABCDEF, vmax);
+
+        if XNN_LIKELY(c >= 16) {
+          _mm256_storeu_ps(o1, vo1x0c01234567);
+          _mm256_storeu_ps(o1 + 8, vo1x0c89ABCDEF);
+          o1 = (float*) ((uintptr_t) o1 + output_width_stride);
+          _mm256_storeu_ps(o1, vo1x1c01234567);
+          _mm256_storeu_ps(o1 + 8, vo1x1c89ABCDEF);
+          o1 = (float*) ((uintptr_t) o1 + output_width_stride);
+          _mm256_storeu_ps(o0, vo0x0c01234567);
+          _mm256_storeu_ps(o0 + 8, vo0x0c89ABCDEF);
+          o0 = (float*) ((uintptr_t) o0 + output_width_stride);
+          _mm256_storeu_ps(o0, vo0x1c01234567);
+          _mm256_storeu_ps(o0 + 8, vo0x1c89ABCDEF);
+          o0 = (float*) ((uintptr_t) o0 + output_width_stride);
+        } else {
+          float* o1_tmp = o1;
+          float* o0_tmp = o0;
+          if (c & 8) {
+            _mm256_storeu_ps((float*) ((uintptr_t) o1_tmp + output_width_stride * 1) + 0, vo1x1c01234567);
+            _mm256_storeu_ps((float*) ((uintptr_t) o1_tmp + output_width_stride * 0) + 0, vo1x0c01234567);
+            _mm256_storeu_ps((float*) ((uintptr_t) o0_tmp + output_width_stride * 1) + 0, vo0x1c01234567);
+            _mm256_storeu_ps((float*) ((uintptr_t) o0_tmp + output_width_stride * 0) + 0, vo0x0c01234567);
+            o1_tmp += 8;
+            o0_tmp += 8;
+            vo0x0c01234567 = vo0x0c89ABCDEF;
+            vo0x1c01234567 = vo0x1c89ABCDEF;
+            vo1x0c01234567 = vo1x0c89ABCDEF;
+            vo1x1c01234567 = vo1x1c89ABCDEF;
+          }
+          __m128 vo0x0c0123 = _mm256_castps256_ps128(vo0x0c01234567);
+          __m128 vo0x1c0123 = _mm256_castps256_ps128(vo0x1c01234567);
+          __m128 vo1x0c0123 = _mm256_castps256_ps128(vo1x0c01234567);
+          __m128 vo1x1c0123 = _mm256_castps256_ps128(vo1x1c01234567);
+          if (c & 4) {
+            _mm_storeu_ps((float*) ((uintptr_t) o1_tmp + output_width_stride * 1), vo1x1c0123);
+            _mm_storeu_ps((float*) ((uintptr_t) o1_tmp + output_width_stride * 0), vo1x0c0123);
+            _mm_storeu_ps((float*) ((uintptr_t) o0_tmp + output_width_stride * 1), vo0x1c0123);
+            _mm_storeu_ps((float*) ((uintptr_t) o0_tmp + output_width_stride * 0), vo0x0c0123);
+            o1_tmp += 4;
+            o0_tmp += 4;
+            vo0x0c0123 = _mm256_extractf128_ps(vo0x0c01234567, 1);
+            vo0x1c0123 = _mm256_extractf128_ps(vo0x1c01234567, 1);
+            vo1x0c0123 = _mm256_extractf128_ps(vo1x0c01234567, 1);
+            vo1x1c0123 = _mm256_extractf128_ps(vo1x1c01234567, 1);
+          }
+          if (c & 2) {
+            _mm_storel_pi((__m64*) ((uintptr_t) o1_tmp + output_width_stride * 1), vo1x1c0123);
+            _mm_storel_pi((__m64*) ((uintptr_t) o1_tmp + output_width_stride * 0), vo1x0c0123);
+            _mm_storel_pi((__m64*) ((uintptr_t) o0_tmp + output_width_stride * 1), vo0x1c0123);
+            _mm_storel_pi((__m64*) ((uintptr_t) o0_tmp + output_width_stride * 0), vo0x0c0123);
+            o1_tmp += 2;
+            o0_tmp += 2;
+            vo0x0c0123 = _mm_movehl_ps(vo0x0c0123, vo0x0c0123);
+            vo0x1c0123 = _mm_movehl_ps(vo0x1c0123, vo0x1c0123);
+            vo1x0c0123 = _mm_movehl_ps(vo1x0c0123, vo1x0c0123);
+            vo1x1c0123 = _mm_movehl_ps(vo1x1c0123, vo1x1c0123);
+          }
+          if (c & 1) {
+            _mm_store_ss((float*) ((uintptr_t) o1_tmp + output_width_stride * 1), vo1x1c0123);
+            _mm_store_ss((float*) ((uintptr_t) o1_tmp + output_width_stride * 0), vo1x0c0123);
+            _mm_store_ss((float*) ((uintptr_t) o0_tmp + output_width_stride * 1), vo0x1c0123);
+            _mm_store_ss((float*) ((uintptr_t) o0_tmp + output_width_stride * 0), vo0x0c0123);
+          }
+          o1 = (float*) ((uintptr_t) o1 + output_width_stride * 2);
+          o0 = (float*) ((uintptr_t) o0 + output_width_stride * 2);
+        }
+
+        vo0x0c01234567 = vo0x2c01234567;
+        vo0x0c89ABCDEF = vo0x2c89ABCDEF;
+        vo1x0c01234567 = vo1x2c01234567;
+        vo1x0c89ABCDEF = vo1x2c89ABCDEF;
+      }
+      if (iw >= 2) {
+        __m256 vo0x1c01234567 = _mm256_load_ps(w + 0);
+        __m256 vo0x1c89ABCDEF = _mm256_load_ps(w + 8);
+        __m256 vo1x1c01234567 = vo0x1c01234567;
+        __m256 vo1x1c89ABCDEF = vo0x1c89ABCDEF;
+
+        const __m256 vk01c0x01234567 = _mm256_load_ps(w + 160);
+        const __m256 vk01c0x89ABCDEF = _mm256_load_ps(w + 168);
+        const __m256 vk11c0x01234567 = _mm256_load_ps(w + 176);
+        const __m256 vk11c0x89ABCDEF = _mm256_load_ps(w + 184);
+        const __m256 vk21c0x01234567 = _mm256_load_ps(w + 192);
+        const __m256 vk21c0x89ABCDEF = _mm256_load_ps(w + 200);
+
+        const __m256 vi0x0c0 = _mm256_broadcast_ss(i0 + 0);
+        vo0x0c01234567 = _mm256_fmadd_ps(vk01c0x01234567, vi0x0c0, vo0x0c01234567);
+        vo0x0c89ABCDEF = _mm256_fmadd_ps(vk01c0x89ABCDEF, vi0x0c0, vo0x0c89ABCDEF);
+        const __m256 vi1x0c0 = _mm256_broadcast_ss(i1 + 0);
+        vo0x0c01234567 = _mm256_fmadd_ps(vk11c0x01234567, vi1x0c0, vo0x0c01234567);
+        vo0x0c89ABCDEF = _mm256_fmadd_ps(vk11c0x89ABCDEF, vi1x0c0, vo0x0c89ABCDEF);
+        const __m256 vi2x0c0 = _mm256_broadcast_ss(i2 + 0);
+        vo0x0c01234567 = _mm256_fmadd_ps(vk21c0x01234567, vi2x0c0, vo0x0c01234567);
+        vo0x0c89ABCDEF = _mm256_fmadd_ps(vk21c0x89ABCDEF, vi2x0c0, vo0x0c89ABCDEF);
+        vo1x0c01234567 = _mm256_fmadd_ps(vk01c0x01234567, vi2x0c0, vo1x0c01234567);
+        vo1x0c89ABCDEF = _mm256_fmadd_ps(vk01c0x89ABCDEF, vi2x0c0, vo1x0c89ABCDEF);
+        const __m256 vi3x0c0 = _mm256_broadcast_ss(i3 + 0);
+        vo1x0c01234567 = _mm256_fmadd_ps(vk11c0x01234567, vi3x0c0, vo1x0c01234567);
+        vo1x0c89ABCDEF = _mm256_fmadd_ps(vk11c0x89ABCDEF, vi3x0c0, vo1x0c89ABCDEF);
+        const __m256 vi4x0c0 = _mm256_broadcast_ss(i4 + 0);
+        vo1x0c01234567 = _mm256_fmadd_ps(vk21c0x01234567, vi4x0c0, vo1x0c01234567);
+        vo1x0c89ABCDEF = _mm256_fmadd_ps(vk21c0x89ABCDEF, vi4x0c0, vo1x0c89ABCDEF);
+
+        const __m256 vk02c0x01234567 = _mm256_load_ps(w + 304);
+        const __m256 vk02c0x89ABCDEF = _mm256_load_ps(w + 312);
+        const __m256 vk12c0x01234567 = _mm256_load_ps(w + 320);
+        const __m256 vk12c0x89ABCDEF = _mm256_load_ps(w + 328);
+        const __m256 vk22c0x01234567 = _mm256_load_ps(w + 336);
+        const __m256 vk22c0x89ABCDEF = _mm256_load_ps(w + 344);
+        const __m256 vk00c0x01234567 = _mm256_load_ps(w + 16);
+        const __m256 vk00c0x89ABCDEF = _mm256_load_ps(w + 24);
+        const __m256 vk10c0x01234567 = _mm256_load_ps(w + 32);
+        const __m256 vk10c0x89ABCDEF = _mm256_load_ps(w + 40);
+        const __m256 vk20c0x01234567 = _mm256_load_ps(w + 48);
+        const __m256 vk20c0x89ABCDEF = _mm256_load_ps(w + 56);
+
+        const __m256 vi0x1c0 = _mm256_broadcast_ss(i0 + 3);
+        vo0x0c01234567 = _mm256_fmadd_ps(vk02c0x01234567, vi0x1c0, vo0x0c01234567);
+        vo0x0c89ABCDEF = _mm256_fmadd_ps(vk02c0x89ABCDEF, vi0x1c0, vo0x0c89ABCDEF);
+        vo0x1c01234567 = _mm256_fmadd_ps(vk00c0x01234567, vi0x1c0, vo0x1c01234567);
+        vo0x1c89ABCDEF = _mm256_fmadd_ps(vk00c0x89ABCDEF, vi0x1c0, vo0x1c89ABCDEF);
+        const __m256 vi1x1c0 = _mm256_broadcast_ss(i1 + 3);
+        vo0x0c01234567 = _mm256_fmadd_ps(vk12c0x01234567, vi1x1c0, vo0x0c01234567);
+        vo0x0c89ABCDEF = _mm256_fmadd_ps(vk12c0x89ABCDEF, vi1x1c0, vo0x0c89ABCDEF);
+        vo0x1c01234567 = _mm256_fmadd_ps(vk10c0x01234567, vi1x1c0, vo0x1c01234567);
+        vo0x1c89ABCDEF = _mm256_fmadd_ps(vk10c0x89ABCDEF, vi1x1c0, vo0x1c89ABCDEF);
+        const __m256 vi2x1c0 = _mm256_broadcast_ss(i2 + 3);
+        vo0x0c01234567 = _mm256_fmadd_ps(vk22c0x01234567, vi2x1c0, vo0x0c01234567);
+        vo0x0c89ABCDEF = _mm256_fmadd_ps(vk22c0x89ABCDEF, vi2x1c0, vo0x0c89ABCDEF);
+        vo0x1c01234567 = _mm256_fmadd_ps(vk20c0x01234567, vi2x1c0, vo0x1c01234567);
+        vo0x1c89ABCDEF = _mm256_fmadd_ps(vk20c0x89ABCDEF, vi2x1c0, vo0x1c89ABCDEF);
+        vo1x0c01234567 = _mm256_fmadd_ps(vk02c0x01234567, vi2x1c0, vo1x0c01234567);
+        vo1x0c89ABCDEF = _mm256_fmadd_ps(vk02c0x89ABCDEF, vi2x1c0, vo1x0c89ABCDEF);
+        vo1x1c01234567 = _mm256_fmadd_ps(vk00c0x01234567, vi2x1c0, vo1x1c01234567);
+        vo1x1c89ABCDEF = _mm256_fmadd_ps(vk00c0x89ABCDEF, vi2x1c0, vo1x1c89ABCDEF);
+        const __m256 vi3x1c0 = _mm256_broadcast_ss(i3 + 3);
+        vo1x0c01234567 = _mm256_fmadd_ps(vk12c0x01234567, vi3x1c0, vo1x0c01234567);
+        vo1x0c89ABCDEF = _mm256_fmadd_ps(vk12c0x89ABCDEF, vi3x1c0, vo1x0c89ABCDEF);
+        vo1x1c01234567 = _mm256_fmadd_ps(vk10c0x01234567, vi3x1c0, vo1x1c01234567);
+        vo1x1c89ABCDEF = _mm256_fmadd_ps(vk10c0x89ABCDEF, vi3x1c0, vo1x1c89ABCDEF);
+        const __m256 vi4x1c0 = _mm256_broadcast_ss(i4 + 3);
+        vo1x0c01234567 = _mm256_fmadd_ps(vk22c0x01234567, vi4x1c0, vo1x0c01234567);
+        vo1x0c89ABCDEF = _mm256_fmadd_ps(vk22c0x89ABCDEF, vi4x1c0, vo1x0c89ABCDEF);
+        vo1x1c01234567 = _mm256_fmadd_ps(vk20c0x01234567, vi4x1c0, vo1x1c01234567);
+        vo1x1c89ABCDEF = _mm256_fmadd_ps(vk20c0x89ABCDEF, vi4x1c0, vo1x1c89ABCDEF);
+        const __m256 vk01c1x01234567 = _mm256_load_ps(w + 208);
+        const __m256 vk01c1x89ABCDEF = _mm256_load_ps(w + 216);
+        const __m256 vk11c1x01234567 = _mm256_load_ps(w + 224);
+        const __m256 vk11c1x89ABCDEF = _mm256_load_ps(w + 232);
+        const __m256 vk21c1x01234567 = _mm256_load_ps(w + 240);
+        const __m256 vk21c1x89ABCDEF = _mm256_load_ps(w + 248);
+
+        const __m256 vi0x0c1 = _mm256_broadcast_ss(i0 + 1);
+        vo0x0c01234567 = _mm256_fmadd_ps(vk01c1x01234567, vi0x0c1, vo0x0c01234567);
+        vo0x0c89ABCDEF = _mm256_fmadd_ps(vk01c1x89ABCDEF, vi0x0c1, vo0x0c89ABCDEF);
+        const __m256 vi1x0c1 = _mm256_broadcast_ss(i1 + 1);
+        vo0x0c01234567 = _mm256_fmadd_ps(vk11c1x01234567, vi1x0c1, vo0x0c01234567);
+        vo0x0c89ABCDEF = _mm256_fmadd_ps(vk11c1x89ABCDEF, vi1x0c1, vo0x0c89ABCDEF);
+        const __m256 vi2x0c1 = _mm256_broadcast_ss(i2 + 1);
+        vo0x0c01234567 = _mm256_fmadd_ps(vk21c1x01234567, vi2x0c1, vo0x0c01234567);
+        vo0x0c89ABCDEF = _mm256_fmadd_ps(vk21c1x89ABCDEF, vi2x0c1, vo0x0c89ABCDEF);
+        vo1x0c01234567 = _mm256_fmadd_ps(vk01c1x01234567, vi2x0c1, vo1x0c01234567);
+        vo1x0c89ABCDEF = _mm256_fmadd_ps(vk01c1x89ABCDEF, vi2x0c1, vo1x0c89ABCDEF);
+        const __m256 vi3x0c1 = _mm256_broadcast_ss(i3 + 1);
+        vo1x0c01234567 = _mm256_fmadd_ps(vk11c1x01234567, vi3x0c1, vo1x0c01234567);
+        vo1x0c89ABCDEF = _mm256_fmadd_ps(vk11c1x89ABCDEF, vi3x0c1, vo1x0c89ABCDEF);
+        const __m256 vi4x0c1 = _mm256_broadcast_ss(i4 + 1);
+        vo1x0c01234567 = _mm256_fmadd_ps(vk21c1x01234567, vi4x0c1, vo1x0c01234567);
+        vo1x0c89ABCDEF = _mm256_fmadd_ps(vk21c1x89ABCDEF, vi4x0c1, vo1x0c89ABCDEF);
+
+        const __m256 vk02c1x01234567 = _mm256_load_ps(w + 352);
+        const __m256 vk02c1x89ABCDEF = _mm256_load_ps(w + 360);
+        const __m256 vk12c1x01234567 = _mm256_load_ps(w + 368);
+        const __m256 vk12c1x89ABCDEF = _mm256_load_ps(w + 376);
+        const __m256 vk22c1x01234567 = _mm256_load_ps(w + 384);
+        const __m256 vk22c1x89ABCDEF = _mm256_load_ps(w + 392);
+        const __m256 vk00c1x01234567 = _mm256_load_ps(w + 64);
+        const __m256 vk00c1x89ABCDEF = _mm256_load_ps(w + 72);
+        const __m256 vk10c1x01234567 = _mm256_load_ps(w + 80);
+        const __m256 vk10c1x89ABCDEF = _mm256_load_ps(w + 88);
+        const __m256 vk20c1x01234567 = _mm256_load_ps(w + 96);
+        const __m256 vk20c1x89ABCDEF = _mm256_load_ps(w + 104);
+
+        const __m256 vi0x1c1 = _mm256_broadcast_ss(i0 + 4);
+        vo0x0c01234567 = _mm256_fmadd_ps(vk02c1x01234567, vi0x1c1, vo0x0c01234567);
+        vo0x0c89ABCDEF = _mm256_fmadd_ps(vk02c1x89ABCDEF, vi0x1c1, vo0x0c89ABCDEF);
+        vo0x1c01234567 = _mm256_fmadd_ps(vk00c1x01234567, vi0x1c1, vo0x1c01234567);
+        vo0x1c89ABCDEF = _mm256_fmadd_ps(vk00c1x89ABCDEF, vi0x1c1, vo0x1c89ABCDEF);
+        const __m256 vi1x1c1 = _mm256_broadcast_ss(i1 + 4);
+        vo0x0c01234567 = _mm256_fmadd_ps(vk12c1x01234567, vi1x1c1, vo0x0c01234567);
+        vo0x0c89ABCDEF = _mm256_fmadd_ps(vk12c1x89ABCDEF, vi1x1c1, vo0x0c89ABCDEF);
+        vo0x1c01234567 = _mm256_fmadd_ps(vk10c1x01234567, vi1x1c1, vo0x1c01234567);
+        vo0x1c89ABCDEF = _mm256_fmadd_ps(vk10c1x89ABCDEF, vi1x1c1, vo0x1c89ABCDEF);
+        const __m256 vi2x1c1 = _mm256_broadcast_ss(i2 + 4);
+        vo0x0c01234567 = _mm256_fmadd_ps(vk22c1x01234567, vi2x1c1, vo0x0c01234567);
+        vo0x0c89ABCDEF = _mm256_fmadd_ps(vk22c1x89ABCDEF, vi2x1c1, vo0x0c89ABCDEF);
+        vo0x1c01234567 = _mm256_fmadd_ps(vk20c1x01234567, vi2x1c1, vo0x1c01234567);
+        vo0x1c89ABCDEF = _mm256_fmadd_ps(vk20c1x89ABCDEF, vi2x1c1, vo0x1c89ABCDEF);
+        vo1x0c01234567 = _mm256_fmadd_ps(vk02c1x01234567, vi2x1c1, vo1x0c01234567);
+        vo1x0c89ABCDEF = _mm256_fmadd_ps(vk02c1x89ABCDEF, vi2x1c1, vo1x0c89ABCDEF);
+        vo1x1c01234567 = _mm256_fmadd_ps(vk00c1x01234567, vi2x1c1, vo1x1c01234567);
+        vo1x1c89ABCDEF = _mm256_fmadd_ps(vk00c1x89ABCDEF, vi2x1c1, vo1x1c89ABCDEF);
+        const __m256 vi3x1c1 = _mm256_broadcast_ss(i3 + 4);
+        vo1x0c01234567 = _mm256_fmadd_ps(vk12c1x01234567, vi3x1c1, vo1x0c01234567);
+        vo1x0c89ABCDEF = _mm256_fmadd_ps(vk12c1x89ABCDEF, vi3x1c1, vo1x0c89ABCDEF);
+        vo1x1c01234567 = _mm256_fmadd_ps(vk10c1x01234567, vi3x1c1, vo1x1c01234567);
+        vo1x1c89ABCDEF = _mm256_fmadd_ps(vk10c1x89ABCDEF, vi3x1c1, vo1x1c89ABCDEF);
+        const __m256 vi4x1c1 = _mm256_broadcast_ss(i4 + 4);
+        vo1x0c01234567 = _mm256_fmadd_ps(vk22c1x01234567, vi4x1c1, vo1x0c01234567);
+        vo1x0c89ABCDEF = _mm256_fmadd_ps(vk22c1x89ABCDEF, vi4x1c1, vo1x0c89ABCDEF);
+        vo1x1c01234567 = _mm256_fmadd_ps(vk20c1x01234567, vi4x1c1, vo1x1c01234567);
+        vo1x1c89ABCDEF = _mm256_fmadd_ps(vk20c1x89ABCDEF, vi4x1c1, vo1x1c89ABCDEF);
+        const __m256 vk01c2x01234567 = _mm256_load_ps(w + 256);
+        const __m256 vk01c2x89ABCDEF = _mm256_load_ps(w + 264);
+        const __m256 vk11c2x01234567 = _mm256_load_ps(w + 272);
+        const __m256 vk11c2x89ABCDEF = _mm256_load_ps(w + 280);
+        const __m256 vk21c2x01234567 = _mm256_load_ps(w + 288);
+        const __m256 vk21c2x89ABCDEF = _mm256_load_ps(w + 296);
+
+        const __m256 vi0x0c2 = _mm256_broadcast_ss(i0 + 2);
+        vo0x0c01234567 = _mm256_fmadd_ps(vk01c2x01234567, vi0x0c2, vo0x0c01234567);
+        vo0x0c89ABCDEF = _mm256_fmadd_ps(vk01c2x89ABCDEF, vi0x0c2, vo0x0c89ABCDEF);
+        const __m256 vi1x0c2 = _mm256_broadcast_ss(i1 + 2);
+        vo0x0c01234567 = _mm256_fmadd_ps(vk11c2x01234567, vi1x0c2, vo0x0c01234567);
+        vo0x0c89ABCDEF = _mm256_fmadd_ps(vk11c2x89ABCDEF, vi1x0c2, vo0x0c89ABCDEF);
+        const __m256 vi2x0c2 = _mm256_broadcast_ss(i2 + 2);
+        vo0x0c01234567 = _mm256_fmadd_ps(vk21c2x01234567, vi2x0c2, vo0x0c01234567);
+        vo0x0c89ABCDEF = _mm256_fmadd_ps(vk21c2x89ABCDEF, vi2x0c2, vo0x0c89ABCDEF);
+        vo1x0c01234567 = _mm256_fmadd_ps(vk01c2x01234567, vi2x0c2, vo1x0c01234567);
+        vo1x0c89ABCDEF = _mm256_fmadd_ps(vk01c2x89ABCDEF, vi2x0c2, vo1x0c89ABCDEF);
+        const __m256 vi3x0c2 = _mm256_broadcast_ss(i3 + 2);
+        vo1x0c01234567 = _mm256_fmadd_ps(vk11c2x01234567, vi3x0c2, vo1x0c01234567);
+        vo1x0c89ABCDEF = _mm256_fmadd_ps(vk11c2x89ABCDEF, vi3x0c2, vo1x0c89ABCDEF);
+        const __m256 vi4x0c2 = _mm256_broadcast_ss(i4 + 2);
+        vo1x0c01234567 = _mm256_fmadd_ps(vk21c2x01234567, vi4x0c2, vo1x0c01234567);
+        vo1x0c89ABCDEF = _mm256_fmadd_ps(vk21c2x89ABCDEF, vi4x0c2, vo1x0c89ABCDEF);
+
+        const __m256 vk02c2x01234567 = _mm256_load_ps(w + 400);
+        const __m256 vk02c2x89ABCDEF = _mm256_load_ps(w + 408);
+        const __m256 vk12c2x01234567 = _mm256_load_ps(w + 416);
+        const __m256 vk12c2x89ABCDEF = _mm256_load_ps(w + 424);
+        const __m256 vk22c2x01234567 = _mm256_load_ps(w + 432);
+        const __m256 vk22c2x89ABCDEF = _mm256_load_ps(w + 440);
+        const __m256 vk00c2x01234567 = _mm256_load_ps(w + 112);
+        const __m256 vk00c2x89ABCDEF = _mm256_load_ps(w + 120);
+        const __m256 vk10c2x01234567 = _mm256_load_ps(w + 128);
+        const __m256 vk10c2x89ABCDEF = _mm256_load_ps(w + 136);
+        const __m256 vk20c2x01234567 = _mm256_load_ps(w + 144);
+        const __m256 vk20c2x89ABCDEF = _mm256_load_ps(w + 152);
+
+        const __m256 vi0x1c2 = _mm256_broadcast_ss(i0 + 5);
+        vo0x0c01234567 = _mm256_fmadd_ps(vk02c2x01234567, vi0x1c2, vo0x0c01234567);
+        vo0x0c89ABCDEF = _mm256_fmadd_ps(vk02c2x89ABCDEF, vi0x1c2, vo0x0c89ABCDEF);
+        vo0x1c01234567 = _mm256_fmadd_ps(vk00c2x01234567, vi0x1c2, vo0x1c01234567);
+        vo0x1c89ABCDEF = _mm256_fmadd_ps(vk00c2x89ABCDEF, vi0x1c2, vo0x1c89ABCDEF);
+        const __m256 vi1x1c2 = _mm256_broadcast_ss(i1 + 5);
+        vo0x0c01234567 = _mm256_fmadd_ps(vk12c2x01234567, vi1x1c2, vo0x0c01234567);
+        vo0x0c89ABCDEF = _mm256_fmadd_ps(vk12c2x89ABCDEF, vi1x1c2, vo0x0c89ABCDEF);
+        vo0x1c01234567 = _mm256_fmadd_ps(vk10c2x01234567, vi1x1c2, vo0x1c01234567);
+        vo0x1c89ABCDEF = _mm256_fmadd_ps(vk10c2x89ABCDEF, vi1x1c2, vo0x1c89ABCDEF);
+        const __m256 vi2x1c2 = _mm256_broadcast_ss(i2 + 5);
+        vo0x0c01234567 = _mm256_fmadd_ps(vk22c2x01234567, vi2x1c2, vo0x0c01234567);
+        vo0x0c89ABCDEF = _mm256_fmadd_ps(vk22c2x89ABCDEF, vi2x1c2, vo0x0c89ABCDEF);
+        vo0x1c01234567 = _mm256_fmadd_ps(vk20c2x01234567, vi2x1c2, vo0x1c01234567);
+        vo0x1c89ABCDEF = _mm256_fmadd_ps(vk20c2x89ABCDEF, vi2x1c2, vo0x1c89ABCDEF);
+        vo1x0c01234567 = _mm256_fmadd_ps(vk02c2x01234567, vi2x1c2, vo1x0c01234567);
+        vo1x0c89ABCDEF = _mm256_fmadd_ps(vk02c2x89ABCDEF, vi2x1c2, vo1x0c89ABCDEF);
+        vo1x1c01234567 = _mm256_fmadd_ps(vk00c2x01234567, vi2x1c2, vo1x1c01234567);
+        vo1x1c89ABCDEF = _mm256_fmadd_ps(vk00c2x89ABCDEF, vi2x1c2, vo1x1c89ABCDEF);
+        const __m256 vi3x1c2 = _mm256_broadcast_ss(i3 + 5);
+        vo1x0c01234567 = _mm256_fmadd_ps(vk12c2x01234567, vi3x1c2, vo1x0c01234567);
+        vo1x0c89ABCDEF = _mm256_fmadd_ps(vk12c2x89ABCDEF, vi3x1c2, vo1x0c89ABCDEF);
+        vo1x1c01234567 = _mm256_fmadd_ps(vk10c2x01234567, vi3x1c2, vo1x1c01234567);
+        vo1x1c89ABCDEF = _mm256_fmadd_ps(vk10c2x89ABCDEF, vi3x1c2, vo1x1c89ABCDEF);
+        const __m256 vi4x1c2 = _mm256_broadcast_ss(i4 + 5);
+        vo1x0c01234567 = _mm256_fmadd_ps(vk22c2x01234567, vi4x1c2, vo1x0c01234567);
+        vo1x0c89ABCDEF = _mm256_fmadd_ps(vk22c2x89ABCDEF, vi4x1c2, vo1x0c89ABCDEF);
+        vo1x1c01234567 = _mm256_fmadd_ps(vk20c2x01234567, vi4x1c2, vo1x1c01234567);
+        vo1x1c89ABCDEF = _mm256_fmadd_ps(vk20c2x89ABCDEF, vi4x1c2, vo1x1c89ABCDEF);
+
+        i0 += 6;
+        i1 += 6;
+        i2 += 6;
+        i3 += 6;
+        i4 += 6;
+
+        vo0x0c01234567 = _mm256_max_ps(vo0x0c01234567, vmin);
+        vo0x0c89ABCDEF = _mm256_max_ps(vo0x0c89ABCDEF, vmin);
+        vo1x0c01234567 = _mm256_max_ps(vo1x0c01234567, vmin);
+        vo1x0c89ABCDEF = _mm256_max_ps(vo1x0c89ABCDEF, vmin);
+        vo0x0c01234567 = _mm256_min_ps(vo0x0c01234567, vmax);
+        vo0x0c89ABCDEF = _mm256_min_ps(vo0x0c89ABCDEF, vmax);
+        vo1x0c01234567 = _mm256_min_ps(vo1x0c01234567, vmax);
+        vo1x0c89ABCDEF = _mm256_min_ps(vo1x0c89ABCDEF, vmax);
+
+        if XNN_LIKELY(c >= 16) {
+          _mm256_storeu_ps(o1, vo1x0c01234567);
+          _mm256_storeu_ps(o1 + 8, vo1x0c89ABCDEF);
+          o1 = (float*) ((uintptr_t) o1 + output_width_stride);
+          _mm256_storeu_ps(o0, vo0x0c01234567);
+          _mm256_storeu_ps(o0 + 8, vo0x0c89ABCDEF);
+          o0 = (float*) ((uintptr_t) o0 + output_width_stride);
+        } else {
+          float* o1_tmp = o1;
+          float* o0_tmp = o0;
+          if (c & 8) {
+            _mm256_storeu_ps((float*) ((uintptr_t) o1_tmp + output_width_stride * 0) + 0, vo1x0c01234567);
+            _mm256_storeu_ps((float*) ((uintptr_t) o0_tmp + output_width_stride * 0) + 0, vo0x0c01234567);
+            o1_tmp += 8;
+            o0_tmp += 8;
+            vo0x0c01234567 = vo0x0c89ABCDEF;
+            vo1x0c01234567 = vo1x0c89ABCDEF;
+          }
+          __m128 vo0x0c0123 = _mm256_castps256_ps128(vo0x0c01234567);
+          __m128 vo1x0c0123 = _mm256_castps256_ps128(vo1x0c01234567);
+          if (c & 4) {
+            _mm_storeu_ps((float*) ((uintptr_t) o1_tmp + output_width_stride * 0), vo1x0c0123);
+            _mm_storeu_ps((float*) ((uintptr_t) o0_tmp + output_width_stride * 0), vo0x0c0123);
+            o1_tmp += 4;
+            o0_tmp += 4;
+            vo0x0c0123 = _mm256_extractf128_ps(vo0x0c01234567, 1);
+            vo1x0c0123 = _mm256_extractf128_ps(vo1x0c01234567, 1);
+          }
+          if (c & 2) {
+            _mm_storel_pi((__m64*) ((uintptr_t) o1_tmp + output_width_stride * 0), vo1x0c0123);
+            _mm_storel_pi((__m64*) ((uintptr_t) o0_tmp + output_width_stride * 0), vo0x0c0123);
+            o1_tmp += 2;
+            o0_tmp += 2;
+            vo0x0c0123 = _mm_movehl_ps(vo0x0c0123, vo0x0c0123);
+            vo1x0c0123 = _mm_movehl_ps(vo1x0c0123, vo1x0c0123);
+          }
+          if (c & 1) {
+            _mm_store_ss((float*) ((uintptr_t) o1_tmp + output_width_stride * 0), vo1x0c0123);
+            _mm_store_ss((float*) ((uintptr_t) o0_tmp + output_width_stride * 0), vo0x0c0123);
+          }
+          o1 = (float*) ((uintptr_t) o1 + output_width_stride);
+          o0 = (float*) ((uintptr_t) o0 + output_width_stride);
+        }
+
+        vo0x0c01234567 = vo0x1c01234567;
+        vo0x0c89ABCDEF = vo0x1c89ABCDEF;
+        vo1x0c01234567 = vo1x1c01234567;
+        vo1x0c89ABCDEF = vo1x1c89ABCDEF;
+        iw -= 2;
+      }
+      assert(iw < 2);
+      if XNN_UNLIKELY(iw != 0) {
+        // The last input column contributes through the center column of the kernel; the right column is padding.
+        const __m256 vk01c0x01234567 = _mm256_load_ps(w + 160);
+        const __m256 vk01c0x89ABCDEF = _mm256_load_ps(w + 168);
+        const __m256 vk11c0x01234567 = _mm256_load_ps(w + 176);
+        const __m256 vk11c0x89ABCDEF = _mm256_load_ps(w + 184);
+        const __m256 vk21c0x01234567 = _mm256_load_ps(w + 192);
+        const __m256 vk21c0x89ABCDEF = _mm256_load_ps(w + 200);
+
+        const __m256 vi0x0c0 = _mm256_broadcast_ss(i0 + 0);
+        vo0x0c01234567 = _mm256_fmadd_ps(vk01c0x01234567, vi0x0c0, vo0x0c01234567);
+        vo0x0c89ABCDEF = _mm256_fmadd_ps(vk01c0x89ABCDEF, vi0x0c0, vo0x0c89ABCDEF);
+        const __m256 vi1x0c0 = _mm256_broadcast_ss(i1 + 0);
+        vo0x0c01234567 = _mm256_fmadd_ps(vk11c0x01234567, vi1x0c0, vo0x0c01234567);
+        vo0x0c89ABCDEF = _mm256_fmadd_ps(vk11c0x89ABCDEF, vi1x0c0, vo0x0c89ABCDEF);
+        const __m256 vi2x0c0 = _mm256_broadcast_ss(i2 + 0);
+        vo0x0c01234567 = _mm256_fmadd_ps(vk21c0x01234567, vi2x0c0, vo0x0c01234567);
+        vo0x0c89ABCDEF = _mm256_fmadd_ps(vk21c0x89ABCDEF, vi2x0c0, vo0x0c89ABCDEF);
+        vo1x0c01234567 = _mm256_fmadd_ps(vk01c0x01234567, vi2x0c0, vo1x0c01234567);
+        vo1x0c89ABCDEF = _mm256_fmadd_ps(vk01c0x89ABCDEF, vi2x0c0, vo1x0c89ABCDEF);
+        const __m256 vi3x0c0 = _mm256_broadcast_ss(i3 + 0);
+        vo1x0c01234567 = _mm256_fmadd_ps(vk11c0x01234567, vi3x0c0, vo1x0c01234567);
+        vo1x0c89ABCDEF = _mm256_fmadd_ps(vk11c0x89ABCDEF, vi3x0c0, vo1x0c89ABCDEF);
+        const __m256 vi4x0c0 = _mm256_broadcast_ss(i4 + 0);
+        vo1x0c01234567 = _mm256_fmadd_ps(vk21c0x01234567, vi4x0c0, vo1x0c01234567);
+        vo1x0c89ABCDEF = _mm256_fmadd_ps(vk21c0x89ABCDEF, vi4x0c0, vo1x0c89ABCDEF);
+        const __m256 vk01c1x01234567 = _mm256_load_ps(w + 208);
+        const __m256 vk01c1x89ABCDEF = _mm256_load_ps(w + 216);
+        const __m256 vk11c1x01234567 = _mm256_load_ps(w + 224);
+        const __m256 vk11c1x89ABCDEF = _mm256_load_ps(w + 232);
+        const __m256 vk21c1x01234567 = _mm256_load_ps(w + 240);
+        const __m256 vk21c1x89ABCDEF = _mm256_load_ps(w + 248);
+
+        const __m256 vi0x0c1 = _mm256_broadcast_ss(i0 + 1);
+        vo0x0c01234567 = _mm256_fmadd_ps(vk01c1x01234567, vi0x0c1, vo0x0c01234567);
+        vo0x0c89ABCDEF = _mm256_fmadd_ps(vk01c1x89ABCDEF, vi0x0c1, vo0x0c89ABCDEF);
+        const __m256 vi1x0c1 = _mm256_broadcast_ss(i1 + 1);
+        vo0x0c01234567 = _mm256_fmadd_ps(vk11c1x01234567, vi1x0c1, vo0x0c01234567);
+        vo0x0c89ABCDEF = _mm256_fmadd_ps(vk11c1x89ABCDEF, vi1x0c1, vo0x0c89ABCDEF);
+        const __m256 vi2x0c1 = _mm256_broadcast_ss(i2 + 1);
+        vo0x0c01234567 = _mm256_fmadd_ps(vk21c1x01234567, vi2x0c1, vo0x0c01234567);
+        vo0x0c89ABCDEF = _mm256_fmadd_ps(vk21c1x89ABCDEF, vi2x0c1, vo0x0c89ABCDEF);
+        vo1x0c01234567 = _mm256_fmadd_ps(vk01c1x01234567, vi2x0c1, vo1x0c01234567);
+        vo1x0c89ABCDEF = _mm256_fmadd_ps(vk01c1x89ABCDEF, vi2x0c1, vo1x0c89ABCDEF);
+        const __m256 vi3x0c1 = _mm256_broadcast_ss(i3 + 1);
+        vo1x0c01234567 = _mm256_fmadd_ps(vk11c1x01234567, vi3x0c1, vo1x0c01234567);
+        vo1x0c89ABCDEF = _mm256_fmadd_ps(vk11c1x89ABCDEF, vi3x0c1, vo1x0c89ABCDEF);
+        const __m256 vi4x0c1 = _mm256_broadcast_ss(i4 + 1);
+        vo1x0c01234567 = _mm256_fmadd_ps(vk21c1x01234567, vi4x0c1, vo1x0c01234567);
+        vo1x0c89ABCDEF = _mm256_fmadd_ps(vk21c1x89ABCDEF, vi4x0c1, vo1x0c89ABCDEF);
+        const __m256 vk01c2x01234567 = _mm256_load_ps(w + 256);
+        const __m256 vk01c2x89ABCDEF = _mm256_load_ps(w + 264);
+        const __m256 vk11c2x01234567 = _mm256_load_ps(w + 272);
+        const __m256 vk11c2x89ABCDEF = _mm256_load_ps(w + 280);
+        const __m256 vk21c2x01234567 = _mm256_load_ps(w + 288);
+        const __m256 vk21c2x89ABCDEF = _mm256_load_ps(w + 296);
+
+        const __m256 vi0x0c2 = _mm256_broadcast_ss(i0 + 2);
+        vo0x0c01234567 = _mm256_fmadd_ps(vk01c2x01234567, vi0x0c2, vo0x0c01234567);
+        vo0x0c89ABCDEF = _mm256_fmadd_ps(vk01c2x89ABCDEF, vi0x0c2, vo0x0c89ABCDEF);
+        const __m256 vi1x0c2 = _mm256_broadcast_ss(i1 + 2);
+        vo0x0c01234567 = _mm256_fmadd_ps(vk11c2x01234567, vi1x0c2, vo0x0c01234567);
+        vo0x0c89ABCDEF = _mm256_fmadd_ps(vk11c2x89ABCDEF, vi1x0c2, vo0x0c89ABCDEF);
+        const __m256 vi2x0c2 = _mm256_broadcast_ss(i2 + 2);
+        vo0x0c01234567 = _mm256_fmadd_ps(vk21c2x01234567, vi2x0c2, vo0x0c01234567);
+        vo0x0c89ABCDEF = _mm256_fmadd_ps(vk21c2x89ABCDEF, vi2x0c2, vo0x0c89ABCDEF);
+        vo1x0c01234567 = _mm256_fmadd_ps(vk01c2x01234567, vi2x0c2, vo1x0c01234567);
+        vo1x0c89ABCDEF = _mm256_fmadd_ps(vk01c2x89ABCDEF, vi2x0c2, vo1x0c89ABCDEF);
+        const __m256 vi3x0c2 = _mm256_broadcast_ss(i3 + 2);
+        vo1x0c01234567 = _mm256_fmadd_ps(vk11c2x01234567, vi3x0c2, vo1x0c01234567);
+        vo1x0c89ABCDEF = _mm256_fmadd_ps(vk11c2x89ABCDEF, vi3x0c2, vo1x0c89ABCDEF);
+        const __m256 vi4x0c2 = _mm256_broadcast_ss(i4 + 2);
+        vo1x0c01234567 = _mm256_fmadd_ps(vk21c2x01234567, vi4x0c2, vo1x0c01234567);
+        vo1x0c89ABCDEF = _mm256_fmadd_ps(vk21c2x89ABCDEF, vi4x0c2, vo1x0c89ABCDEF);
+
+        vo0x0c01234567 = _mm256_max_ps(vo0x0c01234567, vmin);
+        vo0x0c89ABCDEF = _mm256_max_ps(vo0x0c89ABCDEF, vmin);
+        vo1x0c01234567 = _mm256_max_ps(vo1x0c01234567, vmin);
+        vo1x0c89ABCDEF = _mm256_max_ps(vo1x0c89ABCDEF, vmin);
+        vo0x0c01234567 = _mm256_min_ps(vo0x0c01234567, vmax);
+        vo0x0c89ABCDEF = _mm256_min_ps(vo0x0c89ABCDEF, vmax);
+        vo1x0c01234567 = _mm256_min_ps(vo1x0c01234567, vmax);
+        vo1x0c89ABCDEF = _mm256_min_ps(vo1x0c89ABCDEF, vmax);
+
+        if XNN_LIKELY(c >= 16) {
+          _mm256_storeu_ps(o1, vo1x0c01234567);
+          _mm256_storeu_ps(o1 + 8, vo1x0c89ABCDEF);
+          _mm256_storeu_ps(o0, vo0x0c01234567);
+          _mm256_storeu_ps(o0 + 8, vo0x0c89ABCDEF);
+        } else {
+          float* o1_tmp = o1;
+          float* o0_tmp = o0;
+          if (c & 8) {
+            _mm256_storeu_ps(o1_tmp + 0, vo1x0c01234567);
+            _mm256_storeu_ps(o0_tmp + 0, vo0x0c01234567);
+            o1_tmp += 8;
+            o0_tmp += 8;
+            vo0x0c01234567 = vo0x0c89ABCDEF;
+            vo1x0c01234567 = vo1x0c89ABCDEF;
+          }
+          __m128 vo0x0c0123 = _mm256_castps256_ps128(vo0x0c01234567);
+          __m128 vo1x0c0123 = _mm256_castps256_ps128(vo1x0c01234567);
+          if (c & 4) {
+            _mm_storeu_ps(o1_tmp, vo1x0c0123);
+            _mm_storeu_ps(o0_tmp, vo0x0c0123);
+            o1_tmp += 4;
+            o0_tmp += 4;
+            vo0x0c0123 = _mm256_extractf128_ps(vo0x0c01234567, 1);
+            vo1x0c0123 = _mm256_extractf128_ps(vo1x0c01234567, 1);
+          }
+          if (c & 2) {
+            _mm_storel_pi((__m64*) o1_tmp, vo1x0c0123);
+            _mm_storel_pi((__m64*) o0_tmp, vo0x0c0123);
+            o1_tmp += 2;
+            o0_tmp += 2;
+            vo0x0c0123 = _mm_movehl_ps(vo0x0c0123, vo0x0c0123);
+            vo1x0c0123 = _mm_movehl_ps(vo1x0c0123, vo1x0c0123);
+          }
+          if (c & 1) {
+            _mm_store_ss(o1_tmp, vo1x0c0123);
+            _mm_store_ss(o0_tmp, vo0x0c0123);
+          }
+        }
+        o1 = (float*) ((uintptr_t) o1 + output_width_stride);
+        o0 = (float*) ((uintptr_t) o0 + output_width_stride);
+      }
+      // Move output pointers back to the position of the first pixel in a row,
+      // and forward to the next block of output channels
+      o0 = (float*) ((uintptr_t) o0 - output_channel_decrement);
+      o1 = (float*) ((uintptr_t) o1 - output_channel_decrement);
+      // Revert input pointers to the position of the first pixel in a row
+      i0 = (const float*) ((uintptr_t) i0 - input_width_decrement);
+      i1 = (const float*) ((uintptr_t) i1 - input_width_decrement);
+      i2 = (const float*) ((uintptr_t) i2 - input_width_decrement);
+      i3 = (const float*) ((uintptr_t) i3 - input_width_decrement);
+      i4 = (const float*) ((uintptr_t) i4 - input_width_decrement);
+      // Move to the block of weights for the next 16 output channels
+      w += 448;
+      c = doz(c, 16);
+    } while (c != 0);
+    // Move output pointers back to the position of the first channel, and forward to the next block of rows
+    o0 = (float*) ((uintptr_t) o0 + output_height_increment);
+    o1 = (float*) ((uintptr_t) o1 + output_height_increment);
+    // Move input pointers forward to the next four rows
+    i0 = i4;
+    i1 = (const float*) ((uintptr_t) i0 + input_height_stride);
+    i2 = (const float*) ((uintptr_t) i1 + input_height_stride);
+    i3 = (const float*) ((uintptr_t) i2 + input_height_stride);
+    i4 = (const float*) ((uintptr_t) i3 + input_height_stride);
+  }
+}
+
 void xnn_f32_dwconv_minmax_ukernel_up16x3__fma3(
     size_t channels,
     size_t output_width,
@@ -2569,6 +5592,1022 @@ void xnn_f32_igemm_minmax_ukernel_5x16__fma3_broadcast(
   } while (nc != 0);
 }
 
+void xnn_f32_spmm_minmax_ukernel_16x4__fma3(
+    size_t mc,
+    size_t nc,
+    const float*restrict input,
+    const float*restrict weights,
+    const int32_t*restrict widx_dmap,
+    const uint32_t*restrict nidx_nnzmap,
+    float*restrict output,
+    size_t output_stride,
+    const union xnn_f32_minmax_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(mc != 0);
+  assert(mc % sizeof(float) == 0);
+  assert(nc != 0);
+
+  const __m256 vmin = _mm256_broadcast_ss(params->sse.min);
+  const __m256 vmax = _mm256_broadcast_ss(params->sse.max);
+  size_t output_decrement = output_stride * nc - 16 * sizeof(float);
+  while XNN_LIKELY(mc >= 16 * sizeof(float)) {
+    const float*restrict w = weights;
+    const int32_t* dmap = widx_dmap;
+    const uint32_t* nnzmap = nidx_nnzmap;
+    size_t n = nc;
+    while (n >= 4) {
+      uint32_t nnz = *nnzmap++;
+      __m256 vacc01234567n0 = _mm256_broadcast_ss(w); w += 1;
+      __m256 vacc89ABCDEFn0 = vacc01234567n0;
+      __m256 vacc01234567n1 = _mm256_broadcast_ss(w); w += 1;
+      __m256 vacc89ABCDEFn1 = vacc01234567n1;
+      __m256 vacc01234567n2 = _mm256_broadcast_ss(w); w += 1;
+      __m256 vacc89ABCDEFn2 = vacc01234567n2;
+      __m256 vacc01234567n3 = _mm256_broadcast_ss(w); w += 1;
+      __m256 vacc89ABCDEFn3 = vacc01234567n3;
+      if XNN_LIKELY(nnz != 0) {
+        do {
+          const intptr_t diff = *dmap++;
+          const __m256 vi01234567 = _mm256_loadu_ps(input);
+          const __m256 vi89ABCDEF = _mm256_loadu_ps(input + 8);
+          input = (const float*restrict) ((uintptr_t) input + (uintptr_t) diff);
+          const __m256 vw0 = _mm256_broadcast_ss(w);
+          const __m256 vw1 = _mm256_broadcast_ss(w + 1);
+          const __m256 vw2 = _mm256_broadcast_ss(w + 2);
+          const __m256 vw3 = _mm256_broadcast_ss(w + 3);
+          w += 4;
+          vacc01234567n0 = _mm256_fmadd_ps(vi01234567, vw0, vacc01234567n0);
+          vacc89ABCDEFn0 = _mm256_fmadd_ps(vi89ABCDEF, vw0, vacc89ABCDEFn0);
+          vacc01234567n1 = _mm256_fmadd_ps(vi01234567, vw1, vacc01234567n1);
+          vacc89ABCDEFn1 = _mm256_fmadd_ps(vi89ABCDEF, vw1, vacc89ABCDEFn1);
+          vacc01234567n2 = _mm256_fmadd_ps(vi01234567, vw2, vacc01234567n2);
+          vacc89ABCDEFn2 = _mm256_fmadd_ps(vi89ABCDEF, vw2, vacc89ABCDEFn2);
+          vacc01234567n3 = _mm256_fmadd_ps(vi01234567, vw3, vacc01234567n3);
+          vacc89ABCDEFn3 = _mm256_fmadd_ps(vi89ABCDEF, vw3, vacc89ABCDEFn3);
+        } while (--nnz != 0);
+      }
+      __m256 vout01234567n0 = _mm256_min_ps(vacc01234567n0, vmax);
+      __m256 vout89ABCDEFn0 = _mm256_min_ps(vacc89ABCDEFn0, vmax);
+      __m256 vout01234567n1 = _mm256_min_ps(vacc01234567n1, vmax);
+      __m256 vout89ABCDEFn1 = _mm256_min_ps(vacc89ABCDEFn1, vmax);
+      __m256 vout01234567n2 = _mm256_min_ps(vacc01234567n2, vmax);
+      __m256 vout89ABCDEFn2 = _mm256_min_ps(vacc89ABCDEFn2, vmax);
+      __m256 vout01234567n3 = _mm256_min_ps(vacc01234567n3, vmax);
+      __m256 vout89ABCDEFn3 = _mm256_min_ps(vacc89ABCDEFn3, vmax);
+      vout01234567n0 = _mm256_max_ps(vout01234567n0, vmin);
+      vout89ABCDEFn0 = _mm256_max_ps(vout89ABCDEFn0, vmin);
+      vout01234567n1 = _mm256_max_ps(vout01234567n1, vmin);
+      vout89ABCDEFn1 = _mm256_max_ps(vout89ABCDEFn1, vmin);
+      vout01234567n2 = _mm256_max_ps(vout01234567n2, vmin);
+      vout89ABCDEFn2 = _mm256_max_ps(vout89ABCDEFn2, vmin);
+      vout01234567n3 = _mm256_max_ps(vout01234567n3, vmin);
+      vout89ABCDEFn3 = _mm256_max_ps(vout89ABCDEFn3, vmin);
+      _mm256_storeu_ps(output, vout01234567n0);
+      _mm256_storeu_ps(output + 8, vout89ABCDEFn0);
+      output = (float*restrict) ((uintptr_t) output + output_stride);
+      _mm256_storeu_ps(output, vout01234567n1);
+      _mm256_storeu_ps(output + 8, vout89ABCDEFn1);
+      output = (float*restrict) ((uintptr_t) output + output_stride);
+      _mm256_storeu_ps(output, vout01234567n2);
+      _mm256_storeu_ps(output + 8, vout89ABCDEFn2);
+      output = (float*restrict) ((uintptr_t) output + output_stride);
+      _mm256_storeu_ps(output, vout01234567n3);
+      _mm256_storeu_ps(output + 8, vout89ABCDEFn3);
+      output = (float*restrict) ((uintptr_t) output + output_stride);
+      n -= 4;
+    }
+
+    // clean up loop, fall back to nr=1
+    while XNN_UNLIKELY(n != 0) {
+      uint32_t nnz = *nnzmap++;
+      __m256 vacc01234567 = _mm256_broadcast_ss(w); w += 1;
+      __m256 vacc89ABCDEF = vacc01234567;
+      if XNN_LIKELY(nnz != 0) {
+        do {
+          const intptr_t diff = *dmap++;
+          const __m256 vi01234567 = _mm256_loadu_ps(input);
+          const __m256 vi89ABCDEF = _mm256_loadu_ps(input + 8);
+          input = (const float*restrict) ((uintptr_t) input + (uintptr_t) diff);
+          const __m256 vw = _mm256_broadcast_ss(w); w += 1;
+          vacc01234567 = _mm256_fmadd_ps(vi01234567, vw, vacc01234567);
+          vacc89ABCDEF = _mm256_fmadd_ps(vi89ABCDEF, vw, vacc89ABCDEF);
+        } while (--nnz != 0);
+      }
+      __m256 vout01234567 = _mm256_min_ps(vacc01234567, vmax);
+      __m256 vout89ABCDEF = _mm256_min_ps(vacc89ABCDEF, vmax);
+      vout01234567 = _mm256_max_ps(vout01234567, vmin);
+      vout89ABCDEF = _mm256_max_ps(vout89ABCDEF, vmin);
+      _mm256_storeu_ps(output, vout01234567);
+      _mm256_storeu_ps(output + 8, vout89ABCDEF);
+      output = (float*restrict) ((uintptr_t) output + output_stride);
+      n -= 1;
+    }
+    output = (float*restrict) ((uintptr_t) output - output_decrement);
+    input += 16;
+    mc -= 16 * sizeof(float);
+  }
+  if XNN_UNLIKELY(mc != 0) {
+    output_decrement += 8 * sizeof(float);
+    if (mc & (8 * sizeof(float))) {
+      const float*restrict w = weights;
+      const int32_t* dmap = widx_dmap;
+      const uint32_t* nnzmap = nidx_nnzmap;
+      size_t n = nc;
+      while (n >= 4) {
+        uint32_t nnz = *nnzmap++;
+        __m256 vacc01234567n0 = _mm256_broadcast_ss(w); w += 1;
+        __m256 vacc01234567n1 = _mm256_broadcast_ss(w); w += 1;
+        __m256 vacc01234567n2 = _mm256_broadcast_ss(w); w += 1;
+        __m256 vacc01234567n3 = _mm256_broadcast_ss(w); w += 1;
+        if XNN_LIKELY(nnz != 0) {
+          do {
+            const intptr_t diff = *dmap++;
+            const __m256 vi01234567 = _mm256_loadu_ps(input);
+            input = (const float*restrict) ((uintptr_t) input + (uintptr_t) diff);
+            const __m256 vw0 = _mm256_broadcast_ss(w);
+            const __m256 vw1 = _mm256_broadcast_ss(w + 1);
+            const __m256 vw2 = _mm256_broadcast_ss(w + 2);
+            const __m256 vw3 = _mm256_broadcast_ss(w + 3);
+            w += 4;
+            vacc01234567n0 = _mm256_fmadd_ps(vi01234567, vw0, vacc01234567n0);
+            vacc01234567n1 = _mm256_fmadd_ps(vi01234567, vw1, vacc01234567n1);
+            vacc01234567n2 = _mm256_fmadd_ps(vi01234567, vw2, vacc01234567n2);
+            vacc01234567n3 = _mm256_fmadd_ps(vi01234567, vw3, vacc01234567n3);
+          } while (--nnz != 0);
+        }
+        __m256 vout01234567n0 = _mm256_min_ps(vacc01234567n0, vmax);
+        __m256 vout01234567n1 = _mm256_min_ps(vacc01234567n1, vmax);
+        __m256 vout01234567n2 = _mm256_min_ps(vacc01234567n2, vmax);
+        __m256 vout01234567n3 = _mm256_min_ps(vacc01234567n3, vmax);
+        vout01234567n0 = _mm256_max_ps(vout01234567n0, vmin);
+        vout01234567n1 = _mm256_max_ps(vout01234567n1, vmin);
+        vout01234567n2 = _mm256_max_ps(vout01234567n2, vmin);
+        vout01234567n3 = _mm256_max_ps(vout01234567n3, vmin);
+        _mm256_storeu_ps(output, vout01234567n0);
+        output = (float*restrict) ((uintptr_t) output + output_stride);
+        _mm256_storeu_ps(output, vout01234567n1);
+        output = (float*restrict) ((uintptr_t) output + output_stride);
+        _mm256_storeu_ps(output, vout01234567n2);
+        output = (float*restrict) ((uintptr_t) output + output_stride);
+        _mm256_storeu_ps(output, vout01234567n3);
+        output = (float*restrict) ((uintptr_t) output + output_stride);
+        n -= 4;
+      }
+
+      // clean up loop, fall back to nr=1
+      while XNN_UNLIKELY(n != 0) {
+        uint32_t nnz = *nnzmap++;
+        __m256 vacc01234567 = _mm256_broadcast_ss(w); w += 1;
+        if XNN_LIKELY(nnz != 0) {
+          do {
+            const intptr_t diff = *dmap++;
+            const __m256 vi01234567 = _mm256_loadu_ps(input);
+            input = (const float*restrict) ((uintptr_t) input + (uintptr_t) diff);
+            const __m256 vw = _mm256_broadcast_ss(w); w += 1;
+            vacc01234567 = _mm256_fmadd_ps(vi01234567, vw, vacc01234567);
+          } while (--nnz != 0);
+        }
+        __m256 vout01234567 = _mm256_min_ps(vacc01234567, vmax);
+        vout01234567 = _mm256_max_ps(vout01234567, vmin);
+        _mm256_storeu_ps(output, vout01234567);
+        output = (float*restrict) ((uintptr_t) output + output_stride);
+        n -= 1;
+      }
+      output = (float*restrict) ((uintptr_t) output - output_decrement);
+      input += 8;
+    }
+    output_decrement += 4 * sizeof(float);
+    if (mc & (4 * sizeof(float))) {
+      const float*restrict w = weights;
+      const int32_t* dmap = widx_dmap;
+      const uint32_t* nnzmap = nidx_nnzmap;
+      size_t n = nc;
+      while (n >= 4) {
+        uint32_t nnz = *nnzmap++;
+        __m128 vacc0123n0 = _mm_broadcast_ss(w); w += 1;
+        __m128 vacc0123n1 = _mm_broadcast_ss(w); w += 1;
+        __m128 vacc0123n2 = _mm_broadcast_ss(w); w += 1;
+        __m128 vacc0123n3 = _mm_broadcast_ss(w); w += 1;
+        if XNN_LIKELY(nnz != 0) {
+          do {
+            const intptr_t diff = *dmap++;
+            const __m128 vi0123 = _mm_loadu_ps(input);
+            input = (const float*restrict) ((uintptr_t) input + (uintptr_t) diff);
+            const __m128 vw0 = _mm_broadcast_ss(w);
+            const __m128 vw1 = _mm_broadcast_ss(w + 1);
+            const __m128 vw2 = _mm_broadcast_ss(w + 2);
+            const __m128 vw3 = _mm_broadcast_ss(w + 3);
+            w += 4;
+            vacc0123n0 = _mm_fmadd_ps(vi0123, vw0, vacc0123n0);
+            vacc0123n1 = _mm_fmadd_ps(vi0123, vw1, vacc0123n1);
+            vacc0123n2 = _mm_fmadd_ps(vi0123, vw2, vacc0123n2);
+            vacc0123n3 = _mm_fmadd_ps(vi0123, vw3, vacc0123n3);
+          } while (--nnz != 0);
+        }
+        __m128 vout0123n0 = _mm_min_ps(vacc0123n0, _mm256_castps256_ps128(vmax));
+        __m128 vout0123n1 = _mm_min_ps(vacc0123n1, _mm256_castps256_ps128(vmax));
+        __m128 vout0123n2 = _mm_min_ps(vacc0123n2, _mm256_castps256_ps128(vmax));
+        __m128 vout0123n3 = _mm_min_ps(vacc0123n3, _mm256_castps256_ps128(vmax));
+        vout0123n0 = _mm_max_ps(vout0123n0, _mm256_castps256_ps128(vmin));
+        vout0123n1 = _mm_max_ps(vout0123n1, _mm256_castps256_ps128(vmin));
+        vout0123n2 = _mm_max_ps(vout0123n2, _mm256_castps256_ps128(vmin));
+        vout0123n3 = _mm_max_ps(vout0123n3, _mm256_castps256_ps128(vmin));
+        _mm_storeu_ps(output, vout0123n0);
+        output = (float*restrict) ((uintptr_t) output + output_stride);
+        _mm_storeu_ps(output, vout0123n1);
+        output = (float*restrict) ((uintptr_t) output + output_stride);
+        _mm_storeu_ps(output, vout0123n2);
+        output = (float*restrict) ((uintptr_t) output + output_stride);
+        _mm_storeu_ps(output, vout0123n3);
+        output = (float*restrict) ((uintptr_t) output + output_stride);
+        n -= 4;
+      }
+
+      // clean up loop, fall back to nr=1
+      while XNN_UNLIKELY(n != 0) {
+        uint32_t nnz = *nnzmap++;
+        __m128 vacc0123 = _mm_broadcast_ss(w); w += 1;
+        if XNN_LIKELY(nnz != 0) {
+          do {
+            const intptr_t diff = *dmap++;
+            const __m128 vi0123 = _mm_loadu_ps(input);
+            input = (const float*restrict) ((uintptr_t) input + (uintptr_t) diff);
+            const __m128 vw = _mm_broadcast_ss(w); w += 1;
+            vacc0123 = _mm_fmadd_ps(vi0123, vw, vacc0123);
+          } while (--nnz != 0);
+        }
+        __m128 vout0123 = _mm_min_ps(vacc0123, _mm256_castps256_ps128(vmax));
+        vout0123 = _mm_max_ps(vout0123, _mm256_castps256_ps128(vmin));
+        _mm_storeu_ps(output, vout0123);
+        output = (float*restrict) ((uintptr_t) output + output_stride);
+        n -= 1;
+      }
+      output = (float*restrict) ((uintptr_t) output - output_decrement);
+      input += 4;
+    }
+    output_decrement += 2 * sizeof(float);
+    if (mc & (2 * sizeof(float))) {
+      const float*restrict w = weights;
+      const int32_t* dmap = widx_dmap;
+      const uint32_t* nnzmap = nidx_nnzmap;
+      size_t n = nc;
+      while (n >= 4) {
+        uint32_t nnz = *nnzmap++;
+        __m128 vacc01n0 = _mm_broadcast_ss(w); w += 1;
+        __m128 vacc01n1 = _mm_broadcast_ss(w); w += 1;
+        __m128 vacc01n2 = _mm_broadcast_ss(w); w += 1;
+        __m128 vacc01n3 = _mm_broadcast_ss(w); w += 1;
+        if XNN_LIKELY(nnz != 0) {
+          do {
+            const intptr_t diff = *dmap++;
+            const __m128 vi01 = _mm_loadl_pi(_mm_undefined_ps(), (const __m64*) input);
+            input = (const float*restrict) ((uintptr_t) input + (uintptr_t) diff);
+            const __m128 vw0 = _mm_broadcast_ss(w);
+            const __m128 vw1 = _mm_broadcast_ss(w + 1);
+            const __m128 vw2 = _mm_broadcast_ss(w + 2);
+            const __m128 vw3 = _mm_broadcast_ss(w + 3);
+            w += 4;
+            vacc01n0 = _mm_fmadd_ps(vi01, vw0, vacc01n0);
+            vacc01n1 = _mm_fmadd_ps(vi01, vw1, vacc01n1);
+            vacc01n2 = _mm_fmadd_ps(vi01, vw2, vacc01n2);
+            vacc01n3 = _mm_fmadd_ps(vi01, vw3, vacc01n3);
+          } while (--nnz != 0);
+        }
+        __m128 vout01n0 = _mm_min_ps(vacc01n0, _mm256_castps256_ps128(vmax));
+        __m128 vout01n1 = _mm_min_ps(vacc01n1, _mm256_castps256_ps128(vmax));
+        __m128 vout01n2 = _mm_min_ps(vacc01n2, _mm256_castps256_ps128(vmax));
+        __m128 vout01n3 = _mm_min_ps(vacc01n3, _mm256_castps256_ps128(vmax));
+        vout01n0 = _mm_max_ps(vout01n0, _mm256_castps256_ps128(vmin));
+        vout01n1 = _mm_max_ps(vout01n1, _mm256_castps256_ps128(vmin));
+        vout01n2 = _mm_max_ps(vout01n2, _mm256_castps256_ps128(vmin));
+        vout01n3 = _mm_max_ps(vout01n3, _mm256_castps256_ps128(vmin));
+        _mm_storel_pi((__m64*) output, vout01n0);
+        output = (float*restrict) ((uintptr_t) output + output_stride);
+        _mm_storel_pi((__m64*) output, vout01n1);
+        output = (float*restrict) ((uintptr_t) output + output_stride);
+        _mm_storel_pi((__m64*) output, vout01n2);
+        output = (float*restrict) ((uintptr_t) output + output_stride);
+        _mm_storel_pi((__m64*) output, vout01n3);
+        output = (float*restrict) ((uintptr_t) output + output_stride);
+        n -= 4;
+      }
+
+      // clean up loop, fall back to nr=1
+      while XNN_UNLIKELY(n != 0) {
+        uint32_t nnz = *nnzmap++;
+        __m128 vacc01 = _mm_broadcast_ss(w); w += 1;
+        if XNN_LIKELY(nnz != 0) {
+          do {
+            const intptr_t diff = *dmap++;
+            const __m128 vi01 = _mm_loadl_pi(_mm_undefined_ps(), (const __m64*) input);
+            input = (const float*restrict) ((uintptr_t) input + (uintptr_t) diff);
+            const __m128 vw = _mm_broadcast_ss(w); w += 1;
+            vacc01 = _mm_fmadd_ps(vi01, vw, vacc01);
+          } while (--nnz != 0);
+        }
+        __m128 vout01 = _mm_min_ps(vacc01, _mm256_castps256_ps128(vmax));
+        vout01 = _mm_max_ps(vout01, _mm256_castps256_ps128(vmin));
+        _mm_storel_pi((__m64*) output, vout01);
+        output = (float*restrict) ((uintptr_t) output + output_stride);
+        n -= 1;
+      }
+      output = (float*restrict) ((uintptr_t) output - output_decrement);
+      input += 2;
+    }
+    output_decrement += 1 * sizeof(float);
+    if (mc & (1 * sizeof(float))) {
+      const float*restrict w = weights;
+      const int32_t* dmap = widx_dmap;
+      const uint32_t* nnzmap = nidx_nnzmap;
+      size_t n = nc;
+      while (n >= 4) {
+        uint32_t nnz = *nnzmap++;
+        __m128 vacc0n0 = _mm_broadcast_ss(w); w += 1;
+        __m128 vacc0n1 = _mm_broadcast_ss(w); w += 1;
+        __m128 vacc0n2 = _mm_broadcast_ss(w); w += 1;
+        __m128 vacc0n3 = _mm_broadcast_ss(w); w += 1;
+        if XNN_LIKELY(nnz != 0) {
+          do {
+            const intptr_t diff = *dmap++;
+            const __m128 vi0 = _mm_load_ss(input);
+            input = (const float*restrict) ((uintptr_t) input + (uintptr_t) diff);
+            const __m128 vw0 = _mm_broadcast_ss(w);
+            const __m128 vw1 = _mm_broadcast_ss(w + 1);
+            const __m128 vw2 = _mm_broadcast_ss(w + 2);
+            const __m128 vw3 = _mm_broadcast_ss(w + 3);
+            w += 4;
+            vacc0n0 = _mm_fmadd_ps(vi0, vw0, vacc0n0);
+            vacc0n1 = _mm_fmadd_ps(vi0, vw1, vacc0n1);
+            vacc0n2 = _mm_fmadd_ps(vi0, vw2, vacc0n2);
+            vacc0n3 = _mm_fmadd_ps(vi0, vw3, vacc0n3);
+          } while (--nnz != 0);
+        }
+        __m128 vout0n0 = _mm_min_ps(vacc0n0, _mm256_castps256_ps128(vmax));
+        __m128 vout0n1 = _mm_min_ps(vacc0n1, _mm256_castps256_ps128(vmax));
+        __m128 vout0n2 = _mm_min_ps(vacc0n2, _mm256_castps256_ps128(vmax));
+        __m128 vout0n3 = _mm_min_ps(vacc0n3, _mm256_castps256_ps128(vmax));
+        vout0n0 = _mm_max_ps(vout0n0, _mm256_castps256_ps128(vmin));
+        vout0n1 = _mm_max_ps(vout0n1, _mm256_castps256_ps128(vmin));
+        vout0n2 = _mm_max_ps(vout0n2, _mm256_castps256_ps128(vmin));
+        vout0n3 = _mm_max_ps(vout0n3, _mm256_castps256_ps128(vmin));
+        _mm_store_ss(output, vout0n0);
+        output = (float*restrict) ((uintptr_t) output + output_stride);
+        _mm_store_ss(output, vout0n1);
+        output = (float*restrict) ((uintptr_t) output + output_stride);
+        _mm_store_ss(output, vout0n2);
+        output = (float*restrict) ((uintptr_t) output + output_stride);
+        _mm_store_ss(output, vout0n3);
+        output = (float*restrict) ((uintptr_t) output + output_stride);
+        n -= 4;
+      }
+
+      // clean up loop, fall back to nr=1
+      while XNN_UNLIKELY(n != 0) {
+        uint32_t nnz = *nnzmap++;
+        __m128 vacc0 = _mm_broadcast_ss(w); w += 1;
+        if XNN_LIKELY(nnz != 0) {
+          do {
+            const intptr_t diff = *dmap++;
+            const __m128 vi0 = _mm_load_ss(input);
+            input = (const float*restrict) ((uintptr_t) input + (uintptr_t) diff);
+            const __m128 vw = _mm_broadcast_ss(w); w += 1;
+            vacc0 = _mm_fmadd_ps(vi0, vw, vacc0);
+          } while (--nnz != 0);
+        }
+        __m128 vout0 = _mm_min_ps(vacc0, _mm256_castps256_ps128(vmax));
+        vout0 = _mm_max_ps(vout0, _mm256_castps256_ps128(vmin));
+        _mm_store_ss(output, vout0);
+        output = (float*restrict) ((uintptr_t) output + output_stride);
+        n -= 1;
+      }
+      output = (float*restrict) ((uintptr_t) output - output_decrement);
+      input += 1;
+    }
+  }
+}
+
+void xnn_f32_spmm_minmax_ukernel_32x1__fma3(
+    size_t mc,
+    size_t nc,
+    const float*restrict input,
+    const float*restrict weights,
+    const int32_t*restrict widx_dmap,
+    const uint32_t*restrict nidx_nnzmap,
+    float*restrict output,
+    size_t output_stride,
+    const union xnn_f32_minmax_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(mc != 0);
+  assert(mc % sizeof(float) == 0);
+  assert(nc != 0);
+
+  const __m256 vmin = _mm256_broadcast_ss(params->sse.min);
+  const __m256 vmax = _mm256_broadcast_ss(params->sse.max);
+  size_t output_decrement = output_stride * nc - 32 * sizeof(float);
+  while XNN_LIKELY(mc >= 32 * sizeof(float)) {
+    const float*restrict w = weights;
+    const int32_t* dmap = widx_dmap;
+    const uint32_t* nnzmap = nidx_nnzmap;
+    size_t n = nc;
+    do {
+      uint32_t nnz = *nnzmap++;
+      __m256 vacc01234567 = _mm256_broadcast_ss(w); w += 1;
+      __m256 vacc89ABCDEF = vacc01234567;
+      __m256 vaccGHIJKLMN = vacc01234567;
+      __m256 vaccOPQRSTUV = vacc01234567;
+      if XNN_LIKELY(nnz != 0) {
+        do {
+          const intptr_t diff = *dmap++;
+          const __m256 vi01234567 = _mm256_loadu_ps(input);
+          const __m256 vi89ABCDEF = _mm256_loadu_ps(input + 8);
+          const __m256 viGHIJKLMN = _mm256_loadu_ps(input + 16);
+          const __m256 viOPQRSTUV = _mm256_loadu_ps(input + 24);
+          input = (const float*restrict) ((uintptr_t) input + (uintptr_t) diff);
+          const __m256 vw = _mm256_broadcast_ss(w); w += 1;
+          vacc01234567 = _mm256_fmadd_ps(vi01234567, vw, vacc01234567);
+          vacc89ABCDEF = _mm256_fmadd_ps(vi89ABCDEF, vw, vacc89ABCDEF);
+          vaccGHIJKLMN = _mm256_fmadd_ps(viGHIJKLMN, vw, vaccGHIJKLMN);
+          vaccOPQRSTUV = _mm256_fmadd_ps(viOPQRSTUV, vw, vaccOPQRSTUV);
+        } while (--nnz != 0);
+      }
+      __m256 vout01234567 = _mm256_min_ps(vacc01234567, vmax);
+      __m256 vout89ABCDEF = _mm256_min_ps(vacc89ABCDEF, vmax);
+      __m256 voutGHIJKLMN = _mm256_min_ps(vaccGHIJKLMN, vmax);
+      __m256 voutOPQRSTUV = _mm256_min_ps(vaccOPQRSTUV, vmax);
+      vout01234567 = _mm256_max_ps(vout01234567, vmin);
+      vout89ABCDEF = _mm256_max_ps(vout89ABCDEF, vmin);
+      voutGHIJKLMN = _mm256_max_ps(voutGHIJKLMN, vmin);
+      voutOPQRSTUV = _mm256_max_ps(voutOPQRSTUV, vmin);
+      _mm256_storeu_ps(output, vout01234567);
+      _mm256_storeu_ps(output + 8, vout89ABCDEF);
+      _mm256_storeu_ps(output + 16, voutGHIJKLMN);
+      _mm256_storeu_ps(output + 24, voutOPQRSTUV);
+      output = (float*restrict) ((uintptr_t) output + output_stride);
+    } while (--n != 0);
+    output = (float*restrict) ((uintptr_t) output - output_decrement);
+    input += 32;
+    mc -= 32 * sizeof(float);
+  }
+  if XNN_UNLIKELY(mc != 0) {
+    output_decrement += 16 * sizeof(float);
+    if (mc & (16 * sizeof(float))) {
+      const float*restrict w = weights;
+      const int32_t* dmap = widx_dmap;
+      const uint32_t* nnzmap = nidx_nnzmap;
+      size_t n = nc;
+      do {
+        uint32_t nnz = *nnzmap++;
+        __m256 vacc01234567 = _mm256_broadcast_ss(w); w += 1;
+        __m256 vacc89ABCDEF = vacc01234567;
+        if XNN_LIKELY(nnz != 0) {
+          do {
+            const intptr_t diff = *dmap++;
+            const __m256 vi01234567 = _mm256_loadu_ps(input);
+            const __m256 vi89ABCDEF = _mm256_loadu_ps(input + 8);
+            input = (const float*restrict) ((uintptr_t) input + (uintptr_t) diff);
+            const __m256 vw = _mm256_broadcast_ss(w); w += 1;
+            vacc01234567 = _mm256_fmadd_ps(vi01234567, vw, vacc01234567);
+            vacc89ABCDEF = _mm256_fmadd_ps(vi89ABCDEF, vw, vacc89ABCDEF);
+          } while (--nnz != 0);
+        }
+        __m256 vout01234567 = _mm256_min_ps(vacc01234567, vmax);
+        __m256 vout89ABCDEF = _mm256_min_ps(vacc89ABCDEF, vmax);
+        vout01234567 = _mm256_max_ps(vout01234567, vmin);
+        vout89ABCDEF = _mm256_max_ps(vout89ABCDEF, vmin);
+        _mm256_storeu_ps(output, vout01234567);
+        _mm256_storeu_ps(output + 8, vout89ABCDEF);
+        output = (float*restrict) ((uintptr_t) output + output_stride);
+      } while (--n != 0);
+      output = (float*restrict) ((uintptr_t) output - output_decrement);
+      input += 16;
+    }
+    output_decrement += 8 * sizeof(float);
+    if (mc & (8 * sizeof(float))) {
+      const float*restrict w = weights;
+      const int32_t* dmap = widx_dmap;
+      const uint32_t* nnzmap = nidx_nnzmap;
+      size_t n = nc;
+      do {
+        uint32_t nnz = *nnzmap++;
+        __m256 vacc01234567 = _mm256_broadcast_ss(w); w += 1;
+        if XNN_LIKELY(nnz != 0) {
+          do {
+            const intptr_t diff = *dmap++;
+            const __m256 vi01234567 = _mm256_loadu_ps(input);
+            input = (const float*restrict) ((uintptr_t) input + (uintptr_t) diff);
+            const __m256 vw = _mm256_broadcast_ss(w); w += 1;
+            vacc01234567 = _mm256_fmadd_ps(vi01234567, vw, vacc01234567);
+          } while (--nnz != 0);
+        }
+        __m256 vout01234567 = _mm256_min_ps(vacc01234567, vmax);
+        vout01234567 = _mm256_max_ps(vout01234567, vmin);
+        _mm256_storeu_ps(output, vout01234567);
+        output = (float*restrict) ((uintptr_t) output + output_stride);
+      } while (--n != 0);
+      output = (float*restrict) ((uintptr_t) output - output_decrement);
+      input += 8;
+    }
+    output_decrement += 4 * sizeof(float);
+    if (mc & (4 * sizeof(float))) {
+      const float*restrict w = weights;
+      const int32_t* dmap = widx_dmap;
+      const uint32_t* nnzmap = nidx_nnzmap;
+      size_t n = nc;
+      do {
+        uint32_t nnz = *nnzmap++;
+        __m128 vacc0123 = _mm_broadcast_ss(w); w += 1;
+        if XNN_LIKELY(nnz != 0) {
+          do {
+            const intptr_t diff = *dmap++;
+            const __m128 vi0123 = _mm_loadu_ps(input);
+            input = (const float*restrict) ((uintptr_t) input + (uintptr_t) diff);
+            const __m128 vw = _mm_broadcast_ss(w); w += 1;
+            vacc0123 = _mm_fmadd_ps(vi0123, vw, vacc0123);
+          } while (--nnz != 0);
+        }
+        __m128 vout0123 = _mm_min_ps(vacc0123, _mm256_castps256_ps128(vmax));
+        vout0123 = _mm_max_ps(vout0123, _mm256_castps256_ps128(vmin));
+        _mm_storeu_ps(output, vout0123);
+        output = (float*restrict) ((uintptr_t) output + output_stride);
+      } while (--n != 0);
+      output = (float*restrict) ((uintptr_t) output - output_decrement);
+      input += 4;
+    }
+    output_decrement += 2 * sizeof(float);
+    if (mc & (2 * sizeof(float))) {
+      const float*restrict w = weights;
+      const int32_t* dmap = widx_dmap;
+      const uint32_t* nnzmap = nidx_nnzmap;
+      size_t n = nc;
+      do {
+        uint32_t nnz = *nnzmap++;
+        __m128 vacc01 = _mm_broadcast_ss(w); w += 1;
+        if XNN_LIKELY(nnz != 0) {
+          do {
+            const intptr_t diff = *dmap++;
+            const __m128 vi01 = _mm_loadl_pi(_mm_undefined_ps(), (const __m64*) input);
+            input = (const float*restrict) ((uintptr_t) input + (uintptr_t) diff);
+            const __m128 vw = _mm_broadcast_ss(w); w += 1;
+            vacc01 = _mm_fmadd_ps(vi01, vw, vacc01);
+          } while (--nnz != 0);
+        }
+        __m128 vout01 = _mm_min_ps(vacc01, _mm256_castps256_ps128(vmax));
+        vout01 = _mm_max_ps(vout01, _mm256_castps256_ps128(vmin));
+        _mm_storel_pi((__m64*) output, vout01);
+        output = (float*restrict) ((uintptr_t) output + output_stride);
+      } while (--n != 0);
+      output = (float*restrict) ((uintptr_t) output - output_decrement);
+      input += 2;
+    }
+    output_decrement += 1 * sizeof(float);
+    if (mc & (1 * sizeof(float))) {
+      const float*restrict w = weights;
+      const int32_t* dmap = widx_dmap;
+      const uint32_t* nnzmap = nidx_nnzmap;
+      size_t n = nc;
+      do {
+        uint32_t nnz = *nnzmap++;
+        __m128 vacc0 = _mm_broadcast_ss(w); w += 1;
+        if XNN_LIKELY(nnz != 0) {
+          do {
+            const intptr_t diff = *dmap++;
+            const __m128 vi0 = _mm_load_ss(input);
+            input = (const float*restrict) ((uintptr_t) input + (uintptr_t) diff);
+            const __m128 vw = _mm_broadcast_ss(w); w += 1;
+            vacc0 = _mm_fmadd_ps(vi0, vw, vacc0);
+          } while (--nnz != 0);
+        }
+        __m128 vout0 = _mm_min_ps(vacc0, _mm256_castps256_ps128(vmax));
+        vout0 = _mm_max_ps(vout0, _mm256_castps256_ps128(vmin));
+        _mm_store_ss(output, vout0);
+        output = (float*restrict) ((uintptr_t) output + output_stride);
+      } while (--n != 0);
+      output = (float*restrict) ((uintptr_t) output - output_decrement);
+      input += 1;
+    }
+  }
+}
+
+void xnn_f32_spmm_minmax_ukernel_32x2__fma3(
+    size_t mc,
+    size_t nc,
+    const float*restrict input,
+    const float*restrict weights,
+    const int32_t*restrict widx_dmap,
+    const uint32_t*restrict nidx_nnzmap,
+    float*restrict output,
+    size_t output_stride,
+    const union xnn_f32_minmax_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(mc != 0);
+  assert(mc % sizeof(float) == 0);
+  assert(nc != 0);
+
+  const __m256 vmin = _mm256_broadcast_ss(params->sse.min);
+  const __m256 vmax = _mm256_broadcast_ss(params->sse.max);
+  size_t output_decrement = output_stride * nc - 32 * sizeof(float);
+  while XNN_LIKELY(mc >= 32 * sizeof(float)) {
+    const float*restrict w = weights;
+    const int32_t* dmap = widx_dmap;
+    const uint32_t* nnzmap = nidx_nnzmap;
+    size_t n = nc;
+    while (n >= 2) {
+      uint32_t nnz = *nnzmap++;
+      __m256 vacc01234567n0 = _mm256_broadcast_ss(w); w += 1;
+      __m256 vacc89ABCDEFn0 = vacc01234567n0;
+      __m256 vaccGHIJKLMNn0 = vacc01234567n0;
+      __m256 vaccOPQRSTUVn0 = vacc01234567n0;
+      __m256 vacc01234567n1 = _mm256_broadcast_ss(w); w += 1;
+      __m256 vacc89ABCDEFn1 = vacc01234567n1;
+      __m256 vaccGHIJKLMNn1 = vacc01234567n1;
+      __m256 vaccOPQRSTUVn1 = vacc01234567n1;
+      if XNN_LIKELY(nnz != 0) {
+        do {
+          const intptr_t diff = *dmap++;
+          const __m256 vi01234567 = _mm256_loadu_ps(input);
+          const __m256 vi89ABCDEF = _mm256_loadu_ps(input + 8);
+          const __m256 viGHIJKLMN = _mm256_loadu_ps(input + 16);
+          const __m256 viOPQRSTUV = _mm256_loadu_ps(input + 24);
+          input = (const float*restrict) ((uintptr_t) input + (uintptr_t) diff);
+          const __m256 vw0 = _mm256_broadcast_ss(w);
+          const __m256 vw1 = _mm256_broadcast_ss(w + 1);
+          w += 2;
+          vacc01234567n0 = _mm256_fmadd_ps(vi01234567, vw0, vacc01234567n0);
+          vacc89ABCDEFn0 = _mm256_fmadd_ps(vi89ABCDEF, vw0, vacc89ABCDEFn0);
+          vaccGHIJKLMNn0 = _mm256_fmadd_ps(viGHIJKLMN, vw0, vaccGHIJKLMNn0);
+          vaccOPQRSTUVn0 = _mm256_fmadd_ps(viOPQRSTUV, vw0, vaccOPQRSTUVn0);
+          vacc01234567n1 = _mm256_fmadd_ps(vi01234567, vw1, vacc01234567n1);
+          vacc89ABCDEFn1 = _mm256_fmadd_ps(vi89ABCDEF, vw1, vacc89ABCDEFn1);
+          vaccGHIJKLMNn1 = _mm256_fmadd_ps(viGHIJKLMN, vw1, vaccGHIJKLMNn1);
+          vaccOPQRSTUVn1 = _mm256_fmadd_ps(viOPQRSTUV, vw1, vaccOPQRSTUVn1);
+        } while (--nnz != 0);
+      }
+      __m256 vout01234567n0 = _mm256_min_ps(vacc01234567n0, vmax);
+      __m256 vout89ABCDEFn0 = _mm256_min_ps(vacc89ABCDEFn0, vmax);
+      __m256 voutGHIJKLMNn0 = _mm256_min_ps(vaccGHIJKLMNn0, vmax);
+      __m256 voutOPQRSTUVn0 = _mm256_min_ps(vaccOPQRSTUVn0, vmax);
+      __m256 vout01234567n1 = _mm256_min_ps(vacc01234567n1, vmax);
+      __m256 vout89ABCDEFn1 = _mm256_min_ps(vacc89ABCDEFn1, vmax);
+      __m256 voutGHIJKLMNn1 = _mm256_min_ps(vaccGHIJKLMNn1, vmax);
+      __m256 voutOPQRSTUVn1 = _mm256_min_ps(vaccOPQRSTUVn1, vmax);
+      vout01234567n0 = _mm256_max_ps(vout01234567n0, vmin);
+      vout89ABCDEFn0 = _mm256_max_ps(vout89ABCDEFn0, vmin);
+      voutGHIJKLMNn0 = _mm256_max_ps(voutGHIJKLMNn0, vmin);
+      voutOPQRSTUVn0 = _mm256_max_ps(voutOPQRSTUVn0, vmin);
+      vout01234567n1 = _mm256_max_ps(vout01234567n1, vmin);
+      vout89ABCDEFn1 = _mm256_max_ps(vout89ABCDEFn1, vmin);
+      voutGHIJKLMNn1 = _mm256_max_ps(voutGHIJKLMNn1, vmin);
+      voutOPQRSTUVn1 = _mm256_max_ps(voutOPQRSTUVn1, vmin);
+      _mm256_storeu_ps(output, vout01234567n0);
+      _mm256_storeu_ps(output + 8, vout89ABCDEFn0);
+      _mm256_storeu_ps(output + 16, voutGHIJKLMNn0);
+      _mm256_storeu_ps(output + 24, voutOPQRSTUVn0);
+      output = (float*restrict) ((uintptr_t) output + output_stride);
+      _mm256_storeu_ps(output, vout01234567n1);
+      _mm256_storeu_ps(output + 8, vout89ABCDEFn1);
+      _mm256_storeu_ps(output + 16, voutGHIJKLMNn1);
+      _mm256_storeu_ps(output + 24, voutOPQRSTUVn1);
+      output = (float*restrict) ((uintptr_t) output + output_stride);
+      n -= 2;
+    }
+
+    // clean up loop, fall back to nr=1
+    while XNN_UNLIKELY(n != 0) {
+      uint32_t nnz = *nnzmap++;
+      __m256 vacc01234567 = _mm256_broadcast_ss(w); w += 1;
+      __m256 vacc89ABCDEF = vacc01234567;
+      __m256 vaccGHIJKLMN = vacc01234567;
+      __m256 vaccOPQRSTUV = vacc01234567;
+      if XNN_LIKELY(nnz != 0) {
+        do {
+          const intptr_t diff = *dmap++;
+          const __m256 vi01234567 = _mm256_loadu_ps(input);
+          const __m256 vi89ABCDEF = _mm256_loadu_ps(input + 8);
+          const __m256 viGHIJKLMN = _mm256_loadu_ps(input + 16);
+          const __m256 viOPQRSTUV = _mm256_loadu_ps(input + 24);
+          input = (const float*restrict) ((uintptr_t) input + (uintptr_t) diff);
+          const __m256 vw = _mm256_broadcast_ss(w); w += 1;
+          vacc01234567 = _mm256_fmadd_ps(vi01234567, vw, vacc01234567);
+          vacc89ABCDEF = _mm256_fmadd_ps(vi89ABCDEF, vw, vacc89ABCDEF);
+          vaccGHIJKLMN = _mm256_fmadd_ps(viGHIJKLMN, vw, vaccGHIJKLMN);
+          vaccOPQRSTUV = _mm256_fmadd_ps(viOPQRSTUV, vw, vaccOPQRSTUV);
+        } while (--nnz != 0);
+      }
+      __m256 vout01234567 = _mm256_min_ps(vacc01234567, vmax);
+      __m256 vout89ABCDEF = _mm256_min_ps(vacc89ABCDEF, vmax);
+      __m256 voutGHIJKLMN = _mm256_min_ps(vaccGHIJKLMN, vmax);
+      __m256 voutOPQRSTUV = _mm256_min_ps(vaccOPQRSTUV, vmax);
+      vout01234567 = _mm256_max_ps(vout01234567, vmin);
+      vout89ABCDEF = _mm256_max_ps(vout89ABCDEF, vmin);
+      voutGHIJKLMN = _mm256_max_ps(voutGHIJKLMN, vmin);
+      voutOPQRSTUV = _mm256_max_ps(voutOPQRSTUV, vmin);
+      _mm256_storeu_ps(output, vout01234567);
+      _mm256_storeu_ps(output + 8, vout89ABCDEF);
+      _mm256_storeu_ps(output + 16, voutGHIJKLMN);
+      _mm256_storeu_ps(output + 24, voutOPQRSTUV);
+      output = (float*restrict) ((uintptr_t) output + output_stride);
+      n -= 1;
+    }
+    output = (float*restrict) ((uintptr_t) output - output_decrement);
+    input += 32;
+    mc -= 32 * sizeof(float);
+  }
+  if XNN_UNLIKELY(mc != 0) {
+    output_decrement += 16 * sizeof(float);
+    if (mc & (16 * sizeof(float))) {
+      const float*restrict w = weights;
+      const int32_t* dmap = widx_dmap;
+      const uint32_t* nnzmap = nidx_nnzmap;
+      size_t n = nc;
+      while (n >= 2) {
+        uint32_t nnz = *nnzmap++;
+        __m256 vacc01234567n0 = _mm256_broadcast_ss(w); w += 1;
+        __m256 vacc89ABCDEFn0 = vacc01234567n0;
+        __m256 vacc01234567n1 = _mm256_broadcast_ss(w); w += 1;
+        __m256 vacc89ABCDEFn1 = vacc01234567n1;
+        if XNN_LIKELY(nnz != 0) {
+          do {
+            const intptr_t diff = *dmap++;
+            const __m256 vi01234567 = _mm256_loadu_ps(input);
+            const __m256 vi89ABCDEF = _mm256_loadu_ps(input + 8);
+            input = (const float*restrict) ((uintptr_t) input + (uintptr_t) diff);
+            const __m256 vw0 = _mm256_broadcast_ss(w);
+            const __m256 vw1 = _mm256_broadcast_ss(w + 1);
+            w += 2;
+            vacc01234567n0 = _mm256_fmadd_ps(vi01234567, vw0, vacc01234567n0);
+            vacc89ABCDEFn0 = _mm256_fmadd_ps(vi89ABCDEF, vw0, vacc89ABCDEFn0);
+            vacc01234567n1 = _mm256_fmadd_ps(vi01234567, vw1, vacc01234567n1);
+            vacc89ABCDEFn1 = _mm256_fmadd_ps(vi89ABCDEF, vw1, vacc89ABCDEFn1);
+          } while (--nnz != 0);
+        }
+        __m256 vout01234567n0 = _mm256_min_ps(vacc01234567n0, vmax);
+        __m256 vout89ABCDEFn0 = _mm256_min_ps(vacc89ABCDEFn0, vmax);
+        __m256 vout01234567n1 = _mm256_min_ps(vacc01234567n1, vmax);
+        __m256 vout89ABCDEFn1 = _mm256_min_ps(vacc89ABCDEFn1, vmax);
+        vout01234567n0 = _mm256_max_ps(vout01234567n0, vmin);
+        vout89ABCDEFn0 = _mm256_max_ps(vout89ABCDEFn0, vmin);
+        vout01234567n1 = _mm256_max_ps(vout01234567n1, vmin);
+        vout89ABCDEFn1 = _mm256_max_ps(vout89ABCDEFn1, vmin);
+        _mm256_storeu_ps(output, vout01234567n0);
+        _mm256_storeu_ps(output + 8, vout89ABCDEFn0);
+        output = (float*restrict) ((uintptr_t) output + output_stride);
+        _mm256_storeu_ps(output, vout01234567n1);
+        _mm256_storeu_ps(output + 8, vout89ABCDEFn1);
+        output = (float*restrict) ((uintptr_t) output + output_stride);
+        n -= 2;
+      }
+
+      // clean up loop, fall back to nr=1
+      while XNN_UNLIKELY(n != 0) {
+        uint32_t nnz = *nnzmap++;
+        __m256 vacc01234567 = _mm256_broadcast_ss(w); w += 1;
+        __m256 vacc89ABCDEF = vacc01234567;
+        if XNN_LIKELY(nnz != 0) {
+          do {
+            const intptr_t diff = *dmap++;
+            const __m256 vi01234567 = _mm256_loadu_ps(input);
+            const __m256 vi89ABCDEF = _mm256_loadu_ps(input + 8);
+            input = (const float*restrict) ((uintptr_t) input + (uintptr_t) diff);
+            const __m256 vw = _mm256_broadcast_ss(w); w += 1;
+            vacc01234567 = _mm256_fmadd_ps(vi01234567, vw, vacc01234567);
+            vacc89ABCDEF = _mm256_fmadd_ps(vi89ABCDEF, vw, vacc89ABCDEF);
+          } while (--nnz != 0);
+        }
+        __m256 vout01234567 = _mm256_min_ps(vacc01234567, vmax);
+        __m256 vout89ABCDEF = _mm256_min_ps(vacc89ABCDEF, vmax);
+        vout01234567 = _mm256_max_ps(vout01234567, vmin);
+        vout89ABCDEF = _mm256_max_ps(vout89ABCDEF, vmin);
+        _mm256_storeu_ps(output, vout01234567);
+        _mm256_storeu_ps(output + 8, vout89ABCDEF);
+        output = (float*restrict) ((uintptr_t) output + output_stride);
+        n -= 1;
+      }
+      output = (float*restrict) ((uintptr_t) output - output_decrement);
+      input += 16;
+    }
+    output_decrement += 8 * sizeof(float);
+    if (mc & (8 * sizeof(float))) {
+      const float*restrict w = weights;
+      const int32_t* dmap = widx_dmap;
+      const uint32_t* nnzmap = nidx_nnzmap;
+      size_t n = nc;
+      while (n >= 2) {
+        uint32_t nnz = *nnzmap++;
+        __m256 vacc01234567n0 = _mm256_broadcast_ss(w); w += 1;
+        __m256 vacc01234567n1 = _mm256_broadcast_ss(w); w += 1;
+        if XNN_LIKELY(nnz != 0) {
+          do {
+            const intptr_t diff = *dmap++;
+            const __m256 vi01234567 = _mm256_loadu_ps(input);
+            input = (const float*restrict) ((uintptr_t) input + (uintptr_t) diff);
+            const __m256 vw0 = _mm256_broadcast_ss(w);
+            const __m256 vw1 = _mm256_broadcast_ss(w + 1);
+            w += 2;
+            vacc01234567n0 = _mm256_fmadd_ps(vi01234567, vw0, vacc01234567n0);
+            vacc01234567n1 = _mm256_fmadd_ps(vi01234567, vw1, vacc01234567n1);
+          } while (--nnz != 0);
+        }
+        __m256 vout01234567n0 = _mm256_min_ps(vacc01234567n0, vmax);
+        __m256 vout01234567n1 = _mm256_min_ps(vacc01234567n1, vmax);
+        vout01234567n0 = _mm256_max_ps(vout01234567n0, vmin);
+        vout01234567n1 = _mm256_max_ps(vout01234567n1, vmin);
+        _mm256_storeu_ps(output, vout01234567n0);
+        output = (float*restrict) ((uintptr_t) output + output_stride);
+        _mm256_storeu_ps(output, vout01234567n1);
+        output = (float*restrict) ((uintptr_t) output + output_stride);
+        n -= 2;
+      }
+
+      // clean up loop, fall back to nr=1
+      while XNN_UNLIKELY(n != 0) {
+        uint32_t nnz = *nnzmap++;
+        __m256 vacc01234567 = _mm256_broadcast_ss(w); w += 1;
+        if XNN_LIKELY(nnz != 0) {
+          do {
+            const intptr_t diff = *dmap++;
+            const __m256 vi01234567 = _mm256_loadu_ps(input);
+            input = (const float*restrict) ((uintptr_t) input + (uintptr_t) diff);
+            const __m256 vw = _mm256_broadcast_ss(w); w += 1;
+            vacc01234567 = _mm256_fmadd_ps(vi01234567, vw, vacc01234567);
+          } while (--nnz != 0);
+        }
+        __m256 vout01234567 = _mm256_min_ps(vacc01234567, vmax);
+        vout01234567 = _mm256_max_ps(vout01234567, vmin);
+        _mm256_storeu_ps(output, vout01234567);
+        output = (float*restrict) ((uintptr_t) output + output_stride);
+        n -= 1;
+      }
+      output = (float*restrict) ((uintptr_t) output - output_decrement);
+      input += 8;
+    }
+    output_decrement += 4 * sizeof(float);
+    if (mc & (4 * sizeof(float))) {
+      const float*restrict w = weights;
+      const int32_t* dmap = widx_dmap;
+      const uint32_t* nnzmap = nidx_nnzmap;
+      size_t n = nc;
+      while (n >= 2) {
+        uint32_t nnz = *nnzmap++;
+        __m128 vacc0123n0 = _mm_broadcast_ss(w); w += 1;
+        __m128 vacc0123n1 = _mm_broadcast_ss(w); w += 1;
+        if XNN_LIKELY(nnz != 0) {
+          do {
+            const intptr_t diff = *dmap++;
+            const __m128 vi0123 = _mm_loadu_ps(input);
+            input = (const float*restrict) ((uintptr_t) input + (uintptr_t) diff);
+            const __m128 vw0 = _mm_broadcast_ss(w);
+            const __m128 vw1 = _mm_broadcast_ss(w + 1);
+            w += 2;
+            vacc0123n0 = _mm_fmadd_ps(vi0123, vw0, vacc0123n0);
+            vacc0123n1 = _mm_fmadd_ps(vi0123, vw1, vacc0123n1);
+          } while (--nnz != 0);
+        }
+        __m128 vout0123n0 = _mm_min_ps(vacc0123n0, _mm256_castps256_ps128(vmax));
+        __m128 vout0123n1 = _mm_min_ps(vacc0123n1, _mm256_castps256_ps128(vmax));
+        vout0123n0 = _mm_max_ps(vout0123n0, _mm256_castps256_ps128(vmin));
+        vout0123n1 = _mm_max_ps(vout0123n1, _mm256_castps256_ps128(vmin));
+        _mm_storeu_ps(output, vout0123n0);
+        output = (float*restrict) ((uintptr_t) output + output_stride);
+        _mm_storeu_ps(output, vout0123n1);
+        output = (float*restrict) ((uintptr_t) output + output_stride);
+        n -= 2;
+      }
+
+      // clean up loop, fall back to nr=1
+      while XNN_UNLIKELY(n != 0) {
+        uint32_t nnz = *nnzmap++;
+        __m128 vacc0123 = _mm_broadcast_ss(w); w += 1;
+        if XNN_LIKELY(nnz != 0) {
+          do {
+            const intptr_t diff = *dmap++;
+            const __m128 vi0123 = _mm_loadu_ps(input);
+            input = (const float*restrict) ((uintptr_t) input + (uintptr_t) diff);
+            const __m128 vw = _mm_broadcast_ss(w); w += 1;
+            vacc0123 = _mm_fmadd_ps(vi0123, vw, vacc0123);
+          } while (--nnz != 0);
+        }
+        __m128 vout0123 = _mm_min_ps(vacc0123, _mm256_castps256_ps128(vmax));
+        vout0123 = _mm_max_ps(vout0123, _mm256_castps256_ps128(vmin));
+        _mm_storeu_ps(output, vout0123);
+        output = (float*restrict) ((uintptr_t) output + output_stride);
+        n -= 1;
+      }
+      output = (float*restrict) ((uintptr_t) output - output_decrement);
+      input += 4;
+    }
+    output_decrement += 2 * sizeof(float);
+    if (mc & (2 * sizeof(float))) {
+      const float*restrict w = weights;
+      const int32_t* dmap = widx_dmap;
+      const uint32_t* nnzmap = nidx_nnzmap;
+      size_t n = nc;
+      while (n >= 2) {
+        uint32_t nnz = *nnzmap++;
+        __m128 vacc01n0 = _mm_broadcast_ss(w); w += 1;
+        __m128 vacc01n1 = _mm_broadcast_ss(w); w += 1;
+        if XNN_LIKELY(nnz != 0) {
+          do {
+            const intptr_t diff = *dmap++;
+            const __m128 vi01 = _mm_loadl_pi(_mm_undefined_ps(), (const __m64*) input);
+            input = (const float*restrict) ((uintptr_t) input + (uintptr_t) diff);
+            const __m128 vw0 = _mm_broadcast_ss(w);
+            const __m128 vw1 = _mm_broadcast_ss(w + 1);
+            w += 2;
+            vacc01n0 = _mm_fmadd_ps(vi01, vw0, vacc01n0);
+            vacc01n1 = _mm_fmadd_ps(vi01, vw1, vacc01n1);
+          } while (--nnz != 0);
+        }
+        __m128 vout01n0 = _mm_min_ps(vacc01n0, _mm256_castps256_ps128(vmax));
+        __m128 vout01n1 = _mm_min_ps(vacc01n1, _mm256_castps256_ps128(vmax));
+        vout01n0 = _mm_max_ps(vout01n0, _mm256_castps256_ps128(vmin));
+        vout01n1 = _mm_max_ps(vout01n1, _mm256_castps256_ps128(vmin));
+        _mm_storel_pi((__m64*) output, vout01n0);
+        output = (float*restrict) ((uintptr_t) output + output_stride);
+        _mm_storel_pi((__m64*) output, vout01n1);
+        output = (float*restrict) ((uintptr_t) output + output_stride);
+        n -= 2;
+      }
+
+      // clean up loop, fall back to nr=1
+      while XNN_UNLIKELY(n != 0) {
+        uint32_t nnz = *nnzmap++;
+        __m128 vacc01 = _mm_broadcast_ss(w); w += 1;
+        if XNN_LIKELY(nnz != 0) {
+          do {
+            const intptr_t diff = *dmap++;
+            const __m128 vi01 = _mm_loadl_pi(_mm_undefined_ps(), (const __m64*) input);
+            input = (const float*restrict) ((uintptr_t) input + (uintptr_t) diff);
+            const __m128 vw = _mm_broadcast_ss(w); w += 1;
+            vacc01 = _mm_fmadd_ps(vi01, vw, vacc01);
+          } while (--nnz != 0);
+        }
+        __m128 vout01 = _mm_min_ps(vacc01, _mm256_castps256_ps128(vmax));
+        vout01 = _mm_max_ps(vout01, _mm256_castps256_ps128(vmin));
+        _mm_storel_pi((__m64*) output, vout01);
+        output = (float*restrict) ((uintptr_t) output + output_stride);
+        n -= 1;
+      }
+      output = (float*restrict) ((uintptr_t) output - output_decrement);
+      input += 2;
+    }
+    output_decrement += 1 * sizeof(float);
+    if (mc & (1 * sizeof(float))) {
+      const float*restrict w = weights;
+      const int32_t* dmap = widx_dmap;
+      const uint32_t* nnzmap = nidx_nnzmap;
+      size_t n = nc;
+      while (n >= 2) {
+        uint32_t nnz = *nnzmap++;
+        __m128 vacc0n0 = _mm_broadcast_ss(w); w += 1;
+        __m128 vacc0n1 = _mm_broadcast_ss(w); w += 1;
+        if XNN_LIKELY(nnz != 0) {
+          do {
+            const intptr_t diff = *dmap++;
+            const __m128 vi0 = _mm_load_ss(input);
+            input = (const float*restrict) ((uintptr_t) input + (uintptr_t) diff);
+            const __m128 vw0 = _mm_broadcast_ss(w);
+            const __m128 vw1 = _mm_broadcast_ss(w + 1);
+            w += 2;
+            vacc0n0 = _mm_fmadd_ps(vi0, vw0, vacc0n0);
+            vacc0n1 = _mm_fmadd_ps(vi0, vw1, vacc0n1);
+          } while (--nnz != 0);
+        }
+        __m128 vout0n0 = _mm_min_ps(vacc0n0, _mm256_castps256_ps128(vmax));
+        __m128 vout0n1 = _mm_min_ps(vacc0n1, _mm256_castps256_ps128(vmax));
+        vout0n0 = _mm_max_ps(vout0n0, _mm256_castps256_ps128(vmin));
+        vout0n1 = _mm_max_ps(vout0n1, _mm256_castps256_ps128(vmin));
+        _mm_store_ss(output, vout0n0);
+        output = (float*restrict) ((uintptr_t) output + output_stride);
+        _mm_store_ss(output, vout0n1);
+        output = (float*restrict) ((uintptr_t) output + output_stride);
+        n -= 2;
+      }
+
+      // clean up loop, fall back to nr=1
+      while XNN_UNLIKELY(n != 0) {
+        uint32_t nnz = *nnzmap++;
+        __m128 vacc0 = _mm_broadcast_ss(w); w += 1;
+        if XNN_LIKELY(nnz != 0) {
+          do {
+            const intptr_t diff = *dmap++;
+            const __m128 vi0 = _mm_load_ss(input);
+            input = (const float*restrict) ((uintptr_t) input + (uintptr_t) diff);
+            const __m128 vw = _mm_broadcast_ss(w); w += 1;
+            vacc0 = _mm_fmadd_ps(vi0, vw, vacc0);
+          } while (--nnz != 0);
+        }
+        __m128 vout0 = _mm_min_ps(vacc0, _mm256_castps256_ps128(vmax));
+        vout0 = _mm_max_ps(vout0, _mm256_castps256_ps128(vmin));
+        _mm_store_ss(output, vout0);
+        output = (float*restrict) ((uintptr_t) output + output_stride);
+        n -= 1;
+      }
+      output = (float*restrict) ((uintptr_t) output - output_decrement);
+      input += 1;
+    }
+  }
+}
+
 void xnn_f32_vhswish_ukernel__fma3_x16(
     size_t n,
     const float* x,
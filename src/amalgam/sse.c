@@ -4,6 +4,7 @@
 // LICENSE file in the root directory of this source tree.
 
 #include <assert.h>
+#include <stdio.h>
 
 #include <immintrin.h>
 
@@ -21,9 +22,12 @@
 #include <xnnpack/packx.h>
 #include <xnnpack/pavgpool.h>
 #include <xnnpack/rmax.h>
+#include <xnnpack/rmeanvar.h>
 #include <xnnpack/spmm.h>
+#include <xnnpack/transpose.h>
 #include <xnnpack/vbinary.h>
 #include <xnnpack/vmulcaddc.h>
+#include <xnnpack/vnormcaddc.h>
 #include <xnnpack/vunary.h>
 
 
@@ -518,6 +522,1015 @@ void xnn_f32_avgpool_minmax_ukernel_9x__sse_c4(
   } while (--output_pixels != 0);
 }
 
+void xnn_f32_conv_hwc_ukernel_3x3s2p0p1c3x8__sse_2x1(
+    size_t input_height,
+    size_t input_width,
+    size_t output_y_start,
+    size_t output_y_end,
+    const float* input,
+    const float* zero,
+    const float* weights,
+    float* output,
+    size_t input_padding_top,
+    size_t output_channels,
+    size_t output_height_stride,
+    size_t output_width_stride,
+    const union xnn_f32_minmax_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(input_width > 1);
+  assert(output_y_end > output_y_start);
+  assert(input_padding_top <= 1);
+  assert(output_channels != 0);
+
+  const size_t input_height_stride = input_width * 3 /* channels */ * sizeof(float);
+  const size_t input_width_decrement = round_down_po2(input_width - 1, 2) * 3 /* channels */ * sizeof(float);
+  const size_t output_width = input_width / 2;
+  const size_t output_channel_decrement = output_width * output_width_stride - 8 * sizeof(float);
+  const size_t output_height_increment = output_height_stride * 2 - round_up_po2(output_channels, 8) * sizeof(float);
+
+  // Adjustment for padding processed below
+  const float* i0 = (const float*) ((uintptr_t) input +
+    input_height_stride * (output_y_start * 2 /* vertical stride */ - input_padding_top));
+  const float* i1 = (const float*) ((uintptr_t) i0 + input_height_stride);
+  const float* i2 = (const float*) ((uintptr_t) i1 + input_height_stride);
+  const float* i3 = (const float*) ((uintptr_t) i2 + input_height_stride);
+  const float* i4 = (const float*) ((uintptr_t) i3 + input_height_stride);
+  float* o0 = (float*) ((uintptr_t) output + output_height_stride * output_y_start);
+  float* o1 = (float*) ((uintptr_t) o0 + output_height_stride);
+
+  if XNN_UNPREDICTABLE(output_y_start < input_padding_top) {
+    i0 = zero;
+  }
+
+  const __m128 vmin = _mm_load_ps(params->sse.min);
+  const __m128 vmax = _mm_load_ps(params->sse.max);
+
+  for (size_t output_y = output_y_start; output_y < output_y_end; output_y += 2) {
+    const size_t input_y2 = output_y * 2 + 2 - input_padding_top;
+    const size_t input_y4 = input_y2 + 2;
+    if XNN_UNPREDICTABLE(input_y2 > input_height) {
+      i1 = zero;
+    }
+    if XNN_UNPREDICTABLE(input_y2 >= input_height) {
+      i2 = zero;
+    }
+    if XNN_UNPREDICTABLE(input_y4 > input_height) {
+      i3 = zero;
+    }
+    if XNN_UNPREDICTABLE(input_y4 >= input_height) {
+      i4 = zero;
+    }
+    if XNN_UNPREDICTABLE(output_y + 2 > output_y_end) {
+      o1 = o0;
+    }
+
+    const float* w = weights;
+    size_t c = output_channels;
+    do {
+      // voMx0 accumulates the leftmost output pixel of the next block. The input column to the left of it
+      // is either padding, or was already accumulated at the end of the previous block.
+      __m128 vo0x0c0123 = _mm_load_ps(w + 0);
+      __m128 vo0x0c4567 = _mm_load_ps(w + 4);
+      __m128 vo1x0c0123 = vo0x0c0123;
+      __m128 vo1x0c4567 = vo0x0c4567;
+
+      // No padding on the left: the first input column contributes only through the left column of the kernel.
+      const __m128 vi0c0 = _mm_load1_ps(i0 + 0);
+      vo0x0c0123 = _mm_add_ps(vo0x0c0123, _mm_mul_ps(_mm_load_ps(w + 8), vi0c0));
+      vo0x0c4567 = _mm_add_ps(vo0x0c4567, _mm_mul_ps(_mm_load_ps(w + 12), vi0c0));
+      const __m128 vi1c0 = _mm_load1_ps(i1 + 0);
+      vo0x0c0123 = _mm_add_ps(vo0x0c0123, _mm_mul_ps(_mm_load_ps(w + 16), vi1c0));
+      vo0x0c4567 = _mm_add_ps(vo0x0c4567, _mm_mul_ps(_mm_load_ps(w + 20), vi1c0));
+      const __m128 vi2c0 = _mm_load1_ps(i2 + 0);
+      vo0x0c0123 = _mm_add_ps(vo0x0c0123, _mm_mul_ps(_mm_load_ps(w + 24), vi2c0));
+      vo0x0c4567 = _mm_add_ps(vo0x0c4567, _mm_mul_ps(_mm_load_ps(w + 28), vi2c0));
+      vo1x0c0123 = _mm_add_ps(vo1x0c0123, _mm_mul_ps(_mm_load_ps(w + 8), vi2c0));
+      vo1x0c4567 = _mm_add_ps(vo1x0c4567, _mm_mul_ps(_mm_load_ps(w + 12), vi2c0));
+      const __m128 vi3c0 = _mm_load1_ps(i3 + 0);
+      vo1x0c0123 = _mm_add_ps(vo1x0c0123, _mm_mul_ps(_mm_load_ps(w + 16), vi3c0));
+      vo1x0c4567 = _mm_add_ps(vo1x0c4567, _mm_mul_ps(_mm_load_ps(w + 20), vi3c0));
+      const __m128 vi4c0 = _mm_load1_ps(i4 + 0);
+      vo1x0c0123 = _mm_add_ps(vo1x0c0123, _mm_mul_ps(_mm_load_ps(w + 24), vi4c0));
+      vo1x0c4567 = _mm_add_ps(vo1x0c4567, _mm_mul_ps(_mm_load_ps(w + 28), vi4c0));
+      const __m128 vi0c1 = _mm_load1_ps(i0 + 1);
+      vo0x0c0123 = _mm_add_ps(vo0x0c0123, _mm_mul_ps(_mm_load_ps(w + 32), vi0c1));
+      vo0x0c4567 = _mm_add_ps(vo0x0c4567, _mm_mul_ps(_mm_load_ps(w + 36), vi0c1));
+      const __m128 vi1c1 = _mm_load1_ps(i1 + 1);
+      vo0x0c0123 = _mm_add_ps(vo0x0c0123, _mm_mul_ps(_mm_load_ps(w + 40), vi1c1));
+      vo0x0c4567 = _mm_add_ps(vo0x0c4567, _mm_mul_ps(_mm_load_ps(w + 44), vi1c1));
+      const __m128 vi2c1 = _mm_load1_ps(i2 + 1);
+      vo0x0c0123 = _mm_add_ps(vo0x0c0123, _mm_mul_ps(_mm_load_ps(w + 48), vi2c1));
+      vo0x0c4567 = _mm_add_ps(vo0x0c4567, _mm_mul_ps(_mm_load_ps(w + 52), vi2c1));
+      vo1x0c0123 = _mm_add_ps(vo1x0c0123, _mm_mul_ps(_mm_load_ps(w + 32), vi2c1));
+      vo1x0c4567 = _mm_add_ps(vo1x0c4567, _mm_mul_ps(_mm_load_ps(w + 36), vi2c1));
+      const __m128 vi3c1 = _mm_load1_ps(i3 + 1);
+      vo1x0c0123 = _mm_add_ps(vo1x0c0123, _mm_mul_ps(_mm_load_ps(w + 40), vi3c1));
+      vo1x0c4567 = _mm_add_ps(vo1x0c4567, _mm_mul_ps(_mm_load_ps(w + 44), vi3c1));
+      const __m128 vi4c1 = _mm_load1_ps(i4 + 1);
+      vo1x0c0123 = _mm_add_ps(vo1x0c0123, _mm_mul_ps(_mm_load_ps(w + 48), vi4c1));
+      vo1x0c4567 = _mm_add_ps(vo1x0c4567, _mm_mul_ps(_mm_load_ps(w + 52), vi4c1));
+      const __m128 vi0c2 = _mm_load1_ps(i0 + 2);
+      vo0x0c0123 = _mm_add_ps(vo0x0c0123, _mm_mul_ps(_mm_load_ps(w + 56), vi0c2));
+      vo0x0c4567 = _mm_add_ps(vo0x0c4567, _mm_mul_ps(_mm_load_ps(w + 60), vi0c2));
+      const __m128 vi1c2 = _mm_load1_ps(i1 + 2);
+      vo0x0c0123 = _mm_add_ps(vo0x0c0123, _mm_mul_ps(_mm_load_ps(w + 64), vi1c2));
+      vo0x0c4567 = _mm_add_ps(vo0x0c4567, _mm_mul_ps(_mm_load_ps(w + 68), vi1c2));
+      const __m128 vi2c2 = _mm_load1_ps(i2 + 2);
+      vo0x0c0123 = _mm_add_ps(vo0x0c0123, _mm_mul_ps(_mm_load_ps(w + 72), vi2c2));
+      vo0x0c4567 = _mm_add_ps(vo0x0c4567, _mm_mul_ps(_mm_load_ps(w + 76), vi2c2));
+      vo1x0c0123 = _mm_add_ps(vo1x0c0123, _mm_mul_ps(_mm_load_ps(w + 56), vi2c2));
+      vo1x0c4567 = _mm_add_ps(vo1x0c4567, _mm_mul_ps(_mm_load_ps(w + 60), vi2c2));
+      const __m128 vi3c2 = _mm_load1_ps(i3 + 2);
+      vo1x0c0123 = _mm_add_ps(vo1x0c0123, _mm_mul_ps(_mm_load_ps(w + 64), vi3c2));
+      vo1x0c4567 = _mm_add_ps(vo1x0c4567, _mm_mul_ps(_mm_load_ps(w + 68), vi3c2));
+      const __m128 vi4c2 = _mm_load1_ps(i4 + 2);
+      vo1x0c0123 = _mm_add_ps(vo1x0c0123, _mm_mul_ps(_mm_load_ps(w + 72), vi4c2));
+      vo1x0c4567 = _mm_add_ps(vo1x0c4567, _mm_mul_ps(_mm_load_ps(w + 76), vi4c2));
+
+      size_t iw = input_width - 1;
+      for (; iw >= 2; iw -= 2) {
+        __m128 vo0x1c0123 = _mm_load_ps(w + 0);
+        __m128 vo0x1c4567 = _mm_load_ps(w + 4);
+        __m128 vo1x1c0123 = vo0x1c0123;
+        __m128 vo1x1c4567 = vo0x1c4567;
+
+        const __m128 vk01c0x0123 = _mm_load_ps(w + 80);
+        const __m128 vk01c0x4567 = _mm_load_ps(w + 84);
+        const __m128 vk11c0x0123 = _mm_load_ps(w + 88);
+        const __m128 vk11c0x4567 = _mm_load_ps(w + 92);
+        const __m128 vk21c0x0123 = _mm_load_ps(w + 96);
+        const __m128 vk21c0x4567 = _mm_load_ps(w + 100);
+
+        const __m128 vi0x0c0 = _mm_load1_ps(i0 + 3);
+        vo0x0c0123 = _mm_add_ps(vo0x0c0123, _mm_mul_ps(vk01c0x0123, vi0x0c0));
+        vo0x0c4567 = _mm_add_ps(vo0x0c4567, _mm_mul_ps(vk01c0x4567, vi0x0c0));
+        const __m128 vi1x0c0 = _mm_load1_ps(i1 + 3);
+        vo0x0c0123 = _mm_add_ps(vo0x0c0123, _mm_mul_ps(vk11c0x0123, vi1x0c0));
+        vo0x0c4567 = _mm_add_ps(vo0x0c4567, _mm_mul_ps(vk11c0x4567, vi1x0c0));
+        const __m128 vi2x0c0 = _mm_load1_ps(i2 + 3);
+        vo0x0c0123 = _mm_add_ps(vo0x0c0123, _mm_mul_ps(vk21c0x0123, vi2x0c0));
+        vo0x0c4567 = _mm_add_ps(vo0x0c4567, _mm_mul_ps(vk21c0x4567, vi2x0c0));
+        vo1x0c0123 = _mm_add_ps(vo1x0c0123, _mm_mul_ps(vk01c0x0123, vi2x0c0));
+        vo1x0c4567 = _mm_add_ps(vo1x0c4567, _mm_mul_ps(vk01c0x4567, vi2x0c0));
+        const __m128 vi3x0c0 = _mm_load1_ps(i3 + 3);
+        vo1x0c0123 = _mm_add_ps(vo1x0c0123, _mm_mul_ps(vk11c0x0123, vi3x0c0));
+        vo1x0c4567 = _mm_add_ps(vo1x0c4567, _mm_mul_ps(vk11c0x4567, vi3x0c0));
+        const __m128 vi4x0c0 = _mm_load1_ps(i4 + 3);
+        vo1x0c0123 = _mm_add_ps(vo1x0c0123, _mm_mul_ps(vk21c0x0123, vi4x0c0));
+        vo1x0c4567 = _mm_add_ps(vo1x0c4567, _mm_mul_ps(vk21c0x4567, vi4x0c0));
+
+        const __m128 vk02c0x0123 = _mm_load_ps(w + 152);
+        const __m128 vk02c0x4567 = _mm_load_ps(w + 156);
+        const __m128 vk12c0x0123 = _mm_load_ps(w + 160);
+        const __m128 vk12c0x4567 = _mm_load_ps(w + 164);
+        const __m128 vk22c0x0123 = _mm_load_ps(w + 168);
+        const __m128 vk22c0x4567 = _mm_load_ps(w + 172);
+        const __m128 vk00c0x0123 = _mm_load_ps(w + 8);
+        const __m128 vk00c0x4567 = _mm_load_ps(w + 12);
+        const __m128 vk10c0x0123 = _mm_load_ps(w + 16);
+        const __m128 vk10c0x4567 = _mm_load_ps(w + 20);
+        const __m128 vk20c0x0123 = _mm_load_ps(w + 24);
+        const __m128 vk20c0x4567 = _mm_load_ps(w + 28);
+
+        const __m128 vi0x1c0 = _mm_load1_ps(i0 + 6);
+        vo0x0c0123 = _mm_add_ps(vo0x0c0123, _mm_mul_ps(vk02c0x0123, vi0x1c0));
+        vo0x0c4567 = _mm_add_ps(vo0x0c4567, _mm_mul_ps(vk02c0x4567, vi0x1c0));
+        vo0x1c0123 = _mm_add_ps(vo0x1c0123, _mm_mul_ps(vk00c0x0123, vi0x1c0));
+        vo0x1c4567 = _mm_add_ps(vo0x1c4567, _mm_mul_ps(vk00c0x4567, vi0x1c0));
+        const __m128 vi1x1c0 = _mm_load1_ps(i1 + 6);
+        vo0x0c0123 = _mm_add_ps(vo0x0c0123, _mm_mul_ps(vk12c0x0123, vi1x1c0));
+        vo0x0c4567 = _mm_add_ps(vo0x0c4567, _mm_mul_ps(vk12c0x4567, vi1x1c0));
+        vo0x1c0123 = _mm_add_ps(vo0x1c0123, _mm_mul_ps(vk10c0x0123, vi1x1c0));
+        vo0x1c4567 = _mm_add_ps(vo0x1c4567, _mm_mul_ps(vk10c0x4567, vi1x1c0));
+        const __m128 vi2x1c0 = _mm_load1_ps(i2 + 6);
+        vo0x0c0123 = _mm_add_ps(vo0x0c0123, _mm_mul_ps(vk22c0x0123, vi2x1c0));
+        vo0x0c4567 = _mm_add_ps(vo0x0c4567, _mm_mul_ps(vk22c0x4567, vi2x1c0));
+        vo0x1c0123 = _mm_add_ps(vo0x1c0123, _mm_mul_ps(vk20c0x0123, vi2x1c0));
+        vo0x1c4567 = _mm_add_ps(vo0x1c4567, _mm_mul_ps(vk20c0x4567, vi2x1c0));
+        vo1x0c0123 = _mm_add_ps(vo1x0c0123, _mm_mul_ps(vk02c0x0123, vi2x1c0));
+        vo1x0c4567 = _mm_add_ps(vo1x0c4567, _mm_mul_ps(vk02c0x4567, vi2x1c0));
+        vo1x1c0123 = _mm_add_ps(vo1x1c0123, _mm_mul_ps(vk00c0x0123, vi2x1c0));
+        vo1x1c4567 = _mm_add_ps(vo1x1c4567, _mm_mul_ps(vk00c0x4567, vi2x1c0));
+        const __m128 vi3x1c0 = _mm_load1_ps(i3 + 6);
+        vo1x0c0123 = _mm_add_ps(vo1x0c0123, _mm_mul_ps(vk12c0x0123, vi3x1c0));
+        vo1x0c4567 = _mm_add_ps(vo1x0c4567, _mm_mul_ps(vk12c0x4567, vi3x1c0));
+        vo1x1c0123 = _mm_add_ps(vo1x1c0123, _mm_mul_ps(vk10c0x0123, vi3x1c0));
+        vo1x1c4567 = _mm_add_ps(vo1x1c4567, _mm_mul_ps(vk10c0x4567, vi3x1c0));
+        const __m128 vi4x1c0 = _mm_load1_ps(i4 + 6);
+        vo1x0c0123 = _mm_add_ps(vo1x0c0123, _mm_mul_ps(vk22c0x0123, vi4x1c0));
+        vo1x0c4567 = _mm_add_ps(vo1x0c4567, _mm_mul_ps(vk22c0x4567, vi4x1c0));
+        vo1x1c0123 = _mm_add_ps(vo1x1c0123, _mm_mul_ps(vk20c0x0123, vi4x1c0));
+        vo1x1c4567 = _mm_add_ps(vo1x1c4567, _mm_mul_ps(vk20c0x4567, vi4x1c0));
+        const __m128 vk01c1x0123 = _mm_load_ps(w + 104);
+        const __m128 vk01c1x4567 = _mm_load_ps(w + 108);
+        const __m128 vk11c1x0123 = _mm_load_ps(w + 112);
+        const __m128 vk11c1x4567 = _mm_load_ps(w + 116);
+        const __m128 vk21c1x0123 = _mm_load_ps(w + 120);
+        const __m128 vk21c1x4567 = _mm_load_ps(w + 124);
+
+        const __m128 vi0x0c1 = _mm_load1_ps(i0 + 4);
+        vo0x0c0123 = _mm_add_ps(vo0x0c0123, _mm_mul_ps(vk01c1x0123, vi0x0c1));
+        vo0x0c4567 = _mm_add_ps(vo0x0c4567, _mm_mul_ps(vk01c1x4567, vi0x0c1));
+        const __m128 vi1x0c1 = _mm_load1_ps(i1 + 4);
+        vo0x0c0123 = _mm_add_ps(vo0x0c0123, _mm_mul_ps(vk11c1x0123, vi1x0c1));
+        vo0x0c4567 = _mm_add_ps(vo0x0c4567, _mm_mul_ps(vk11c1x4567, vi1x0c1));
+        const __m128 vi2x0c1 = _mm_load1_ps(i2 + 4);
+        vo0x0c0123 = _mm_add_ps(vo0x0c0123, _mm_mul_ps(vk21c1x0123, vi2x0c1));
+        vo0x0c4567 = _mm_add_ps(vo0x0c4567, _mm_mul_ps(vk21c1x4567, vi2x0c1));
+        vo1x0c0123 = _mm_add_ps(vo1x0c0123, _mm_mul_ps(vk01c1x0123, vi2x0c1));
+        vo1x0c4567 = _mm_add_ps(vo1x0c4567, _mm_mul_ps(vk01c1x4567, vi2x0c1));
+        const __m128 vi3x0c1 = _mm_load1_ps(i3 + 4);
+        vo1x0c0123 = _mm_add_ps(vo1x0c0123, _mm_mul_ps(vk11c1x0123, vi3x0c1));
+        vo1x0c4567 = _mm_add_ps(vo1x0c4567, _mm_mul_ps(vk11c1x4567, vi3x0c1));
+        const __m128 vi4x0c1 = _mm_load1_ps(i4 + 4);
+        vo1x0c0123 = _mm_add_ps(vo1x0c0123, _mm_mul_ps(vk21c1x0123, vi4x0c1));
+        vo1x0c4567 = _mm_add_ps(vo1x0c4567, _mm_mul_ps(vk21c1x4567, vi4x0c1));
+
+        const __m128 vk02c1x0123 = _mm_load_ps(w + 176);
+        const __m128 vk02c1x4567 = _mm_load_ps(w + 180);
+        const __m128 vk12c1x0123 = _mm_load_ps(w + 184);
+        const __m128 vk12c1x4567 = _mm_load_ps(w + 188);
+        const __m128 vk22c1x0123 = _mm_load_ps(w + 192);
+        const __m128 vk22c1x4567 = _mm_load_ps(w + 196);
+        const __m128 vk00c1x0123 = _mm_load_ps(w + 32);
+        const __m128 vk00c1x4567 = _mm_load_ps(w + 36);
+        const __m128 vk10c1x0123 = _mm_load_ps(w + 40);
+        const __m128 vk10c1x4567 = _mm_load_ps(w + 44);
+        const __m128 vk20c1x0123 = _mm_load_ps(w + 48);
+        const __m128 vk20c1x4567 = _mm_load_ps(w + 52);
+
+        const __m128 vi0x1c1 = _mm_load1_ps(i0 + 7);
+        vo0x0c0123 = _mm_add_ps(vo0x0c0123, _mm_mul_ps(vk02c1x0123, vi0x1c1));
+        vo0x0c4567 = _mm_add_ps(vo0x0c4567, _mm_mul_ps(vk02c1x4567, vi0x1c1));
+        vo0x1c0123 = _mm_add_ps(vo0x1c0123, _mm_mul_ps(vk00c1x0123, vi0x1c1));
+        vo0x1c4567 = _mm_add_ps(vo0x1c4567, _mm_mul_ps(vk00c1x4567, vi0x1c1));
+        const __m128 vi1x1c1 = _mm_load1_ps(i1 + 7);
+        vo0x0c0123 = _mm_add_ps(vo0x0c0123, _mm_mul_ps(vk12c1x0123, vi1x1c1));
+        vo0x0c4567 = _mm_add_ps(vo0x0c4567, _mm_mul_ps(vk12c1x4567, vi1x1c1));
+        vo0x1c0123 = _mm_add_ps(vo0x1c0123, _mm_mul_ps(vk10c1x0123, vi1x1c1));
+        vo0x1c4567 = _mm_add_ps(vo0x1c4567, _mm_mul_ps(vk10c1x4567, vi1x1c1));
+        const __m128 vi2x1c1 = _mm_load1_ps(i2 + 7);
+        vo0x0c0123 = _mm_add_ps(vo0x0c0123, _mm_mul_ps(vk22c1x0123, vi2x1c1));
+        vo0x0c4567 = _mm_add_ps(vo0x0c4567, _mm_mul_ps(vk22c1x4567, vi2x1c1));
+        vo0x1c0123 = _mm_add_ps(vo0x1c0123, _mm_mul_ps(vk20c1x0123, vi2x1c1));
+        vo0x1c4567 = _mm_add_ps(vo0x1c4567, _mm_mul_ps(vk20c1x4567, vi2x1c1));
+        vo1x0c0123 = _mm_add_ps(vo1x0c0123, _mm_mul_ps(vk02c1x0123, vi2x1c1));
+        vo1x0c4567 = _mm_add_ps(vo1x0c4567, _mm_mul_ps(vk02c1x4567, vi2x1c1));
+        vo1x1c0123 = _mm_add_ps(vo1x1c0123, _mm_mul_ps(vk00c1x0123, vi2x1c1));
+        vo1x1c4567 = _mm_add_ps(vo1x1c4567, _mm_mul_ps(vk00c1x4567, vi2x1c1));
+        const __m128 vi3x1c1 = _mm_load1_ps(i3 + 7);
+        vo1x0c0123 = _mm_add_ps(vo1x0c0123, _mm_mul_ps(vk12c1x0123, vi3x1c1));
+        vo1x0c4567 = _mm_add_ps(vo1x0c4567, _mm_mul_ps(vk12c1x4567, vi3x1c1));
+        vo1x1c0123 = _mm_add_ps(vo1x1c0123, _mm_mul_ps(vk10c1x0123, vi3x1c1));
+        vo1x1c4567 = _mm_add_ps(vo1x1c4567, _mm_mul_ps(vk10c1x4567, vi3x1c1));
+        const __m128 vi4x1c1 = _mm_load1_ps(i4 + 7);
+        vo1x0c0123 = _mm_add_ps(vo1x0c0123, _mm_mul_ps(vk22c1x0123, vi4x1c1));
+        vo1x0c4567 = _mm_add_ps(vo1x0c4567, _mm_mul_ps(vk22c1x4567, vi4x1c1));
+        vo1x1c0123 = _mm_add_ps(vo1x1c0123, _mm_mul_ps(vk20c1x0123, vi4x1c1));
+        vo1x1c4567 = _mm_add_ps(vo1x1c4567, _mm_mul_ps(vk20c1x4567, vi4x1c1));
+        const __m128 vk01c2x0123 = _mm_load_ps(w + 128);
+        const __m128 vk01c2x4567 = _mm_load_ps(w + 132);
+        const __m128 vk11c2x0123 = _mm_load_ps(w + 136);
+        const __m128 vk11c2x4567 = _mm_load_ps(w + 140);
+        const __m128 vk21c2x0123 = _mm_load_ps(w + 144);
+        const __m128 vk21c2x4567 = _mm_load_ps(w + 148);
+
+        const __m128 vi0x0c2 = _mm_load1_ps(i0 + 5);
+        vo0x0c0123 = _mm_add_ps(vo0x0c0123, _mm_mul_ps(vk01c2x0123, vi0x0c2));
+        vo0x0c4567 = _mm_add_ps(vo0x0c4567, _mm_mul_ps(vk01c2x4567, vi0x0c2));
+        const __m128 vi1x0c2 = _mm_load1_ps(i1 + 5);
+        vo0x0c0123 = _mm_add_ps(vo0x0c0123, _mm_mul_ps(vk11c2x0123, vi1x0c2));
+        vo0x0c4567 = _mm_add_ps(vo0x0c4567, _mm_mul_ps(vk11c2x4567, vi1x0c2));
+        const __m128 vi2x0c2 = _mm_load1_ps(i2 + 5);
+        vo0x0c0123 = _mm_add_ps(vo0x0c0123, _mm_mul_ps(vk21c2x0123, vi2x0c2));
+        vo0x0c4567 = _mm_add_ps(vo0x0c4567, _mm_mul_ps(vk21c2x4567, vi2x0c2));
+        vo1x0c0123 = _mm_add_ps(vo1x0c0123, _mm_mul_ps(vk01c2x0123, vi2x0c2));
+        vo1x0c4567 = _mm_add_ps(vo1x0c4567, _mm_mul_ps(vk01c2x4567, vi2x0c2));
+        const __m128 vi3x0c2 = _mm_load1_ps(i3 + 5);
+        vo1x0c0123 = _mm_add_ps(vo1x0c0123, _mm_mul_ps(vk11c2x0123, vi3x0c2));
+        vo1x0c4567 = _mm_add_ps(vo1x0c4567, _mm_mul_ps(vk11c2x4567, vi3x0c2));
+        const __m128 vi4x0c2 = _mm_load1_ps(i4 + 5);
+        vo1x0c0123 = _mm_add_ps(vo1x0c0123, _mm_mul_ps(vk21c2x0123, vi4x0c2));
+        vo1x0c4567 = _mm_add_ps(vo1x0c4567, _mm_mul_ps(vk21c2x4567, vi4x0c2));
+
+        const __m128 vk02c2x0123 = _mm_load_ps(w + 200);
+        const __m128 vk02c2x4567 = _mm_load_ps(w + 204);
+        const __m128 vk12c2x0123 = _mm_load_ps(w + 208);
+        const __m128 vk12c2x4567 = _mm_load_ps(w + 212);
+        const __m128 vk22c2x0123 = _mm_load_ps(w + 216);
+        const __m128 vk22c2x4567 = _mm_load_ps(w + 220);
+        const __m128 vk00c2x0123 = _mm_load_ps(w + 56);
+        const __m128 vk00c2x4567 = _mm_load_ps(w + 60);
+        const __m128 vk10c2x0123 = _mm_load_ps(w + 64);
+        const __m128 vk10c2x4567 = _mm_load_ps(w + 68);
+        const __m128 vk20c2x0123 = _mm_load_ps(w + 72);
+        const __m128 vk20c2x4567 = _mm_load_ps(w + 76);
+
+        const __m128 vi0x1c2 = _mm_load1_ps(i0 + 8);
+        vo0x0c0123 = _mm_add_ps(vo0x0c0123, _mm_mul_ps(vk02c2x0123, vi0x1c2));
+        vo0x0c4567 = _mm_add_ps(vo0x0c4567, _mm_mul_ps(vk02c2x4567, vi0x1c2));
+        vo0x1c0123 = _mm_add_ps(vo0x1c0123, _mm_mul_ps(vk00c2x0123, vi0x1c2));
+        vo0x1c4567 = _mm_add_ps(vo0x1c4567, _mm_mul_ps(vk00c2x4567, vi0x1c2));
+        const __m128 vi1x1c2 = _mm_load1_ps(i1 + 8);
+        vo0x0c0123 = _mm_add_ps(vo0x0c0123, _mm_mul_ps(vk12c2x0123, vi1x1c2));
+        vo0x0c4567 = _mm_add_ps(vo0x0c4567, _mm_mul_ps(vk12c2x4567, vi1x1c2));
+        vo0x1c0123 = _mm_add_ps(vo0x1c0123, _mm_mul_ps(vk10c2x0123, vi1x1c2));
+        vo0x1c4567 = _mm_add_ps(vo0x1c4567, _mm_mul_ps(vk10c2x4567, vi1x1c2));
+        const __m128 vi2x1c2 = _mm_load1_ps(i2 + 8);
+        vo0x0c0123 = _mm_add_ps(vo0x0c0123, _mm_mul_ps(vk22c2x0123, vi2x1c2));
+        vo0x0c4567 = _mm_add_ps(vo0x0c4567, _mm_mul_ps(vk22c2x4567, vi2x1c2));
+        vo0x1c0123 = _mm_add_ps(vo0x1c0123, _mm_mul_ps(vk20c2x0123, vi2x1c2));
+        vo0x1c4567 = _mm_add_ps(vo0x1c4567, _mm_mul_ps(vk20c2x4567, vi2x1c2));
+        vo1x0c0123 = _mm_add_ps(vo1x0c0123, _mm_mul_ps(vk02c2x0123, vi2x1c2));
+        vo1x0c4567 = _mm_add_ps(vo1x0c4567, _mm_mul_ps(vk02c2x4567, vi2x1c2));
+        vo1x1c0123 = _mm_add_ps(vo1x1c0123, _mm_mul_ps(vk00c2x0123, vi2x1c2));
+        vo1x1c4567 = _mm_add_ps(vo1x1c4567, _mm_mul_ps(vk00c2x4567, vi2x1c2));
+        const __m128 vi3x1c2 = _mm_load1_ps(i3 + 8);
+        vo1x0c0123 = _mm_add_ps(vo1x0c0123, _mm_mul_ps(vk12c2x0123, vi3x1c2));
+        vo1x0c4567 = _mm_add_ps(vo1x0c4567, _mm_mul_ps(vk12c2x4567, vi3x1c2));
+        vo1x1c0123 = _mm_add_ps(vo1x1c0123, _mm_mul_ps(vk10c2x0123, vi3x1c2));
+        vo1x1c4567 = _mm_add_ps(vo1x1c4567, _mm_mul_ps(vk10c2x4567, vi3x1c2));
+        const __m128 vi4x1c2 = _mm_load1_ps(i4 + 8);
+        vo1x0c0123 = _mm_add_ps(vo1x0c0123, _mm_mul_ps(vk22c2x0123, vi4x1c2));
+        vo1x0c4567 = _mm_add_ps(vo1x0c4567, _mm_mul_ps(vk22c2x4567, vi4x1c2));
+        vo1x1c0123 = _mm_add_ps(vo1x1c0123, _mm_mul_ps(vk20c2x0123, vi4x1c2));
+        vo1x1c4567 = _mm_add_ps(vo1x1c4567, _mm_mul_ps(vk20c2x4567, vi4x1c2));
+
+        i0 += 6;
+        i1 += 6;
+        i2 += 6;
+        i3 += 6;
+        i4 += 6;
+
+        vo0x0c0123 = _mm_max_ps(vo0x0c0123, vmin);
+        vo0x0c4567 = _mm_max_ps(vo0x0c4567, vmin);
+        vo1x0c0123 = _mm_max_ps(vo1x0c0123, vmin);
+        vo1x0c4567 = _mm_max_ps(vo1x0c4567, vmin);
+        vo0x0c0123 = _mm_min_ps(vo0x0c0123, vmax);
+        vo0x0c4567 = _mm_min_ps(vo0x0c4567, vmax);
+        vo1x0c0123 = _mm_min_ps(vo1x0c0123, vmax);
+        vo1x0c4567 = _mm_min_ps(vo1x0c4567, vmax);
+
+        if XNN_LIKELY(c >= 8) {
+          _mm_storeu_ps(o1, vo1x0c0123);
+          _mm_storeu_ps(o1 + 4, vo1x0c4567);
+          o1 = (float*) ((uintptr_t) o1 + output_width_stride);
+          _mm_storeu_ps(o0, vo0x0c0123);
+          _mm_storeu_ps(o0 + 4, vo0x0c4567);
+          o0 = (float*) ((uintptr_t) o0 + output_width_stride);
+        } else {
+          float* o1_tmp = o1;
+          float* o0_tmp = o0;
+          if (c & 4) {
+            _mm_storeu_ps((float*) ((uintptr_t) o1_tmp + output_width_stride * 0) + 0, vo1x0c0123);
+            _mm_storeu_ps((float*) ((uintptr_t) o0_tmp + output_width_stride * 0) + 0, vo0x0c0123);
+            o1_tmp += 4;
+            o0_tmp += 4;
+            vo0x0c0123 = vo0x0c4567;
+            vo1x0c0123 = vo1x0c4567;
+          }
+          if (c & 2) {
+            _mm_storel_pi((__m64*) ((uintptr_t) o1_tmp + output_width_stride * 0), vo1x0c0123);
+            _mm_storel_pi((__m64*) ((uintptr_t) o0_tmp + output_width_stride * 0), vo0x0c0123);
+            o1_tmp += 2;
+            o0_tmp += 2;
+            vo0x0c0123 = _mm_movehl_ps(vo0x0c0123, vo0x0c0123);
+            vo1x0c0123 = _mm_movehl_ps(vo1x0c0123, vo1x0c0123);
+          }
+          if (c & 1) {
+            _mm_store_ss((float*) ((uintptr_t) o1_tmp + output_width_stride * 0), vo1x0c0123);
+            _mm_store_ss((float*) ((uintptr_t) o0_tmp + output_width_stride * 0), vo0x0c0123);
+          }
+          o1 = (float*) ((uintptr_t) o1 + output_width_stride);
+          o0 = (float*) ((uintptr_t) o0 + output_width_stride);
+        }
+
+        vo0x0c0123 = vo0x1c0123;
+        vo0x0c4567 = vo0x1c4567;
+        vo1x0c0123 = vo1x1c0123;
+        vo1x0c4567 = vo1x1c4567;
+      }
+      assert(iw < 2);
+      if XNN_UNLIKELY(iw != 0) {
+        // The last input column contributes through the center column of the kernel; the right column is padding.
+        const __m128 vk01c0x0123 = _mm_load_ps(w + 80);
+        const __m128 vk01c0x4567 = _mm_load_ps(w + 84);
+        const __m128 vk11c0x0123 = _mm_load_ps(w + 88);
+        const __m128 vk11c0x4567 = _mm_load_ps(w + 92);
+        const __m128 vk21c0x0123 = _mm_load_ps(w + 96);
+        const __m128 vk21c0x4567 = _mm_load_ps(w + 100);
+
+        const __m128 vi0x0c0 = _mm_load1_ps(i0 + 3);
+        vo0x0c0123 = _mm_add_ps(vo0x0c0123, _mm_mul_ps(vk01c0x0123, vi0x0c0));
+        vo0x0c4567 = _mm_add_ps(vo0x0c4567, _mm_mul_ps(vk01c0x4567, vi0x0c0));
+        const __m128 vi1x0c0 = _mm_load1_ps(i1 + 3);
+        vo0x0c0123 = _mm_add_ps(vo0x0c0123, _mm_mul_ps(vk11c0x0123, vi1x0c0));
+        vo0x0c4567 = _mm_add_ps(vo0x0c4567, _mm_mul_ps(vk11c0x4567, vi1x0c0));
+        const __m128 vi2x0c0 = _mm_load1_ps(i2 + 3);
+        vo0x0c0123 = _mm_add_ps(vo0x0c0123, _mm_mul_ps(vk21c0x0123, vi2x0c0));
+        vo0x0c4567 = _mm_add_ps(vo0x0c4567, _mm_mul_ps(vk21c0x4567, vi2x0c0));
+        vo1x0c0123 = _mm_add_ps(vo1x0c0123, _mm_mul_ps(vk01c0x0123, vi2x0c0));
+        vo1x0c4567 = _mm_add_ps(vo1x0c4567, _mm_mul_ps(vk01c0x4567, vi2x0c0));
+        const __m128 vi3x0c0 = _mm_load1_ps(i3 + 3);
+        vo1x0c0123 = _mm_add_ps(vo1x0c0123, _mm_mul_ps(vk11c0x0123, vi3x0c0));
+        vo1x0c4567 = _mm_add_ps(vo1x0c4567, _mm_mul_ps(vk11c0x4567, vi3x0c0));
+        const __m128 vi4x0c0 = _mm_load1_ps(i4 + 3);
+        vo1x0c0123 = _mm_add_ps(vo1x0c0123, _mm_mul_ps(vk21c0x0123, vi4x0c0));
+        vo1x0c4567 = _mm_add_ps(vo1x0c4567, _mm_mul_ps(vk21c0x4567, vi4x0c0));
+        const __m128 vk01c1x0123 = _mm_load_ps(w + 104);
+        const __m128 vk01c1x4567 = _mm_load_ps(w + 108);
+        const __m128 vk11c1x0123 = _mm_load_ps(w + 112);
+        const __m128 vk11c1x4567 = _mm_load_ps(w + 116);
+        const __m128 vk21c1x0123 = _mm_load_ps(w + 120);
+        const __m128 vk21c1x4567 = _mm_load_ps(w + 124);
+
+        const __m128 vi0x0c1 = _mm_load1_ps(i0 + 4);
+        vo0x0c0123 = _mm_add_ps(vo0x0c0123, _mm_mul_ps(vk01c1x0123, vi0x0c1));
+        vo0x0c4567 = _mm_add_ps(vo0x0c4567, _mm_mul_ps(vk01c1x4567, vi0x0c1));
+        const __m128 vi1x0c1 = _mm_load1_ps(i1 + 4);
+        vo0x0c0123 = _mm_add_ps(vo0x0c0123, _mm_mul_ps(vk11c1x0123, vi1x0c1));
+        vo0x0c4567 = _mm_add_ps(vo0x0c4567, _mm_mul_ps(vk11c1x4567, vi1x0c1));
+        const __m128 vi2x0c1 = _mm_load1_ps(i2 + 4);
+        vo0x0c0123 = _mm_add_ps(vo0x0c0123, _mm_mul_ps(vk21c1x0123, vi2x0c1));
+        vo0x0c4567 = _mm_add_ps(vo0x0c4567, _mm_mul_ps(vk21c1x4567, vi2x0c1));
+        vo1x0c0123 = _mm_add_ps(vo1x0c0123, _mm_mul_ps(vk01c1x0123, vi2x0c1));
+        vo1x0c4567 = _mm_add_ps(vo1x0c4567, _mm_mul_ps(vk01c1x4567, vi2x0c1));
+        const __m128 vi3x0c1 = _mm_load1_ps(i3 + 4);
+        vo1x0c0123 = _mm_add_ps(vo1x0c0123, _mm_mul_ps(vk11c1x0123, vi3x0c1));
+        vo1x0c4567 = _mm_add_ps(vo1x0c4567, _mm_mul_ps(vk11c1x4567, vi3x0c1));
+        const __m128 vi4x0c1 = _mm_load1_ps(i4 + 4);
+        vo1x0c0123 = _mm_add_ps(vo1x0c0123, _mm_mul_ps(vk21c1x0123, vi4x0c1));
+        vo1x0c4567 = _mm_add_ps(vo1x0c4567, _mm_mul_ps(vk21c1x4567, vi4x0c1));
+        const __m128 vk01c2x0123 = _mm_load_ps(w + 128);
+        const __m128 vk01c2x4567 = _mm_load_ps(w + 132);
+        const __m128 vk11c2x0123 = _mm_load_ps(w + 136);
+        const __m128 vk11c2x4567 = _mm_load_ps(w + 140);
+        const __m128 vk21c2x0123 = _mm_load_ps(w + 144);
+        const __m128 vk21c2x4567 = _mm_load_ps(w + 148);
+
+        const __m128 vi0x0c2 = _mm_load1_ps(i0 + 5);
+        vo0x0c0123 = _mm_add_ps(vo0x0c0123, _mm_mul_ps(vk01c2x0123, vi0x0c2));
+        vo0x0c4567 = _mm_add_ps(vo0x0c4567, _mm_mul_ps(vk01c2x4567, vi0x0c2));
+        const __m128 vi1x0c2 = _mm_load1_ps(i1 + 5);
+        vo0x0c0123 = _mm_add_ps(vo0x0c0123, _mm_mul_ps(vk11c2x0123, vi1x0c2));
+        vo0x0c4567 = _mm_add_ps(vo0x0c4567, _mm_mul_ps(vk11c2x4567, vi1x0c2));
+        const __m128 vi2x0c2 = _mm_load1_ps(i2 + 5);
+        vo0x0c0123 = _mm_add_ps(vo0x0c0123, _mm_mul_ps(vk21c2x0123, vi2x0c2));
+        vo0x0c4567 = _mm_add_ps(vo0x0c4567, _mm_mul_ps(vk21c2x4567, vi2x0c2));
+        vo1x0c0123 = _mm_add_ps(vo1x0c0123, _mm_mul_ps(vk01c2x0123, vi2x0c2));
+        vo1x0c4567 = _mm_add_ps(vo1x0c4567, _mm_mul_ps(vk01c2x4567, vi2x0c2));
+        const __m128 vi3x0c2 = _mm_load1_ps(i3 + 5);
+        vo1x0c0123 = _mm_add_ps(vo1x0c0123, _mm_mul_ps(vk11c2x0123, vi3x0c2));
+        vo1x0c4567 = _mm_add_ps(vo1x0c4567, _mm_mul_ps(vk11c2x4567, vi3x0c2));
+        const __m128 vi4x0c2 = _mm_load1_ps(i4 + 5);
+        vo1x0c0123 = _mm_add_ps(vo1x0c0123, _mm_mul_ps(vk21c2x0123, vi4x0c2));
+        vo1x0c4567 = _mm_add_ps(vo1x0c4567, _mm_mul_ps(vk21c2x4567, vi4x0c2));
+
+        vo0x0c0123 = _mm_max_ps(vo0x0c0123, vmin);
+        vo0x0c4567 = _mm_max_ps(vo0x0c4567, vmin);
+        vo1x0c0123 = _mm_max_ps(vo1x0c0123, vmin);
+        vo1x0c4567 = _mm_max_ps(vo1x0c4567, vmin);
+        vo0x0c0123 = _mm_min_ps(vo0x0c0123, vmax);
+        vo0x0c4567 = _mm_min_ps(vo0x0c4567, vmax);
+        vo1x0c0123 = _mm_min_ps(vo1x0c0123, vmax);
+        vo1x0c4567 = _mm_min_ps(vo1x0c4567, vmax);
+
+        if XNN_LIKELY(c >= 8) {
+          _mm_storeu_ps(o1, vo1x0c0123);
+          _mm_storeu_ps(o1 + 4, vo1x0c4567);
+          _mm_storeu_ps(o0, vo0x0c0123);
+          _mm_storeu_ps(o0 + 4, vo0x0c4567);
+        } else {
+          float* o1_tmp = o1;
+          float* o0_tmp = o0;
+          if (c & 4) {
+            _mm_storeu_ps(o1_tmp + 0, vo1x0c0123);
+            _mm_storeu_ps(o0_tmp + 0, vo0x0c0123);
+            o1_tmp += 4;
+            o0_tmp += 4;
+            vo0x0c0123 = vo0x0c4567;
+            vo1x0c0123 = vo1x0c4567;
+          }
+          if (c & 2) {
+            _mm_storel_pi((__m64*) o1_tmp, vo1x0c0123);
+            _mm_storel_pi((__m64*) o0_tmp, vo0x0c0123);
+            o1_tmp += 2;
+            o0_tmp += 2;
+            vo0x0c0123 = _mm_movehl_ps(vo0x0c0123, vo0x0c0123);
+            vo1x0c0123 = _mm_movehl_ps(vo1x0c0123, vo1x0c0123);
+          }
+          if (c & 1) {
+            _mm_store_ss(o1_tmp, vo1x0c0123);
+            _mm_store_ss(o0_tmp, vo0x0c0123);
+          }
+        }
+        o1 = (float*) ((uintptr_t) o1 + output_width_stride);
+        o0 = (float*) ((uintptr_t) o0 + output_width_stride);
+      }
+      // Move output pointers back to the position of the first pixel in a row,
+      // and forward to the next block of output channels
+      o0 = (float*) ((uintptr_t) o0 - output_channel_decrement);
+      o1 = (float*) ((uintptr_t) o1 - output_channel_decrement);
+      // Revert input pointers to the position of the first pixel in a row
+      i0 = (const float*) ((uintptr_t) i0 - input_width_decrement);
+      i1 = (const float*) ((uintptr_t) i1 - input_width_decrement);
+      i2 = (const float*) ((uintptr_t) i2 - input_width_decrement);
+      i3 = (const float*) ((uintptr_t) i3 - input_width_decrement);
+      i4 = (const float*) ((uintptr_t) i4 - input_width_decrement);
+      // Move to the block of weights for the next 8 output channels
+      w += 224;
+      c = doz(c, 8);
+    } while (c != 0);
+    // Move output pointers back to the position of the first channel, and forward to the next block of rows
+    o0 = (float*) ((uintptr_t) o0 + output_height_increment);
+    o1 = (float*) ((uintptr_t) o1 + output_height_increment);
+    // Move input pointers forward to the next four rows
+    i0 = i4;
+    i1 = (const float*) ((uintptr_t) i0 + input_height_stride);
+    i2 = (const float*) ((uintptr_t) i1 + input_height_stride);
+    i3 = (const float*) ((uintptr_t) i2 + input_height_stride);
+    i4 = (const float*) ((uintptr_t) i3 + input_height_stride);
+  }
+}
+
+void xnn_f32_conv_hwc_ukernel_3x3s2p1c3x8__sse_2x1(
+    size_t input_height,
+    size_t input_width,
+    size_t output_y_start,
+    size_t output_y_end,
+    const float* input,
+    const float* zero,
+    const float* weights,
+    float* output,
+    size_t input_padding_top,
+    size_t output_channels,
+    size_t output_height_stride,
+    size_t output_width_stride,
+    const union xnn_f32_minmax_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(input_width != 0);
+  assert(output_y_end > output_y_start);
+  assert(input_padding_top <= 1);
+  assert(output_channels != 0);
+
+  const size_t input_height_stride = input_width * 3 /* channels */ * sizeof(float);
+  const size_t input_width_decrement = round_down_po2(input_width, 2) * 3 /* channels */ * sizeof(float);
+  const size_t output_width = (input_width + 1) / 2;
+  const size_t output_channel_decrement = output_width * output_width_stride - 8 * sizeof(float);
+  const size_t output_height_increment = output_height_stride * 2 - round_up_po2(output_channels, 8) * sizeof(float);
+
+  // Adjustment for padding processed below
+  const float* i0 = (const float*) ((uintptr_t) input +
+    input_height_stride * (output_y_start * 2 /* vertical stride */ - input_padding_top));
+  const float* i1 = (const float*) ((uintptr_t) i0 + input_height_stride);
+  const float* i2 = (const float*) ((uintptr_t) i1 + input_height_stride);
+  const float* i3 = (const float*) ((uintptr_t) i2 + input_height_stride);
+  const float* i4 = (const float*) ((uintptr_t) i3 + input_height_stride);
+  float* o0 = (float*) ((uintptr_t) output + output_height_stride * output_y_start);
+  float* o1 = (float*) ((uintptr_t) o0 + output_height_stride);
+
+  if XNN_UNPREDICTABLE(output_y_start < input_padding_top) {
+    i0 = zero;
+  }
+
+  const __m128 vmin = _mm_load_ps(params->sse.min);
+  const __m128 vmax = _mm_load_ps(params->sse.max);
+
+  for (size_t output_y = output_y_start; output_y < output_y_end; output_y += 2) {
+    const size_t input_y2 = output_y * 2 + 2 - input_padding_top;
+    const size_t input_y4 = input_y2 + 2;
+    if XNN_UNPREDICTABLE(input_y2 > input_height) {
+      i1 = zero;
+    }
+    if XNN_UNPREDICTABLE(input_y2 >= input_height) {
+      i2 = zero;
+    }
+    if XNN_UNPREDICTABLE(input_y4 > input_height) {
+      i3 = zero;
+    }
+    if XNN_UNPREDICTABLE(input_y4 >= input_height) {
+      i4 = zero;
+    }
+    if XNN_UNPREDICTABLE(output_y + 2 > output_y_end) {
+      o1 = o0;
+    }
+
+    const float* w = weights;
+    size_t c = output_channels;
+    do {
+      // voMx0 accumulates the leftmost output pixel of the next block. The input column to the left of it
+      // is either padding, or was already accumulated at the end of the previous block.
+      __m128 vo0x0c0123 = _mm_load_ps(w + 0);
+      __m128 vo0x0c4567 = _mm_load_ps(w + 4);
+      __m128 vo1x0c0123 = vo0x0c0123;
+      __m128 vo1x0c4567 = vo0x0c4567;
+
+      size_t iw = input_width;
+      for (; iw >= 2; iw -= 2) {
+        __m128 vo0x1c0123 = _mm_load_ps(w + 0);
+        __m128 vo0x1c4567 = _mm_load_ps(w + 4);
+        __m128 vo1x1c0123 = vo0x1c0123;
+        __m128 vo1x1c4567 = vo0x1c4567;
+
+        const __m128 vk01c0x0123 = _mm_load_ps(w + 80);
+        const __m128 vk01c0x4567 = _mm_load_ps(w + 84);
+        const __m128 vk11c0x0123 = _mm_load_ps(w + 88);
+        const __m128 vk11c0x4567 = _mm_load_ps(w + 92);
+        const __m128 vk21c0x0123 = _mm_load_ps(w + 96);
+        const __m128 vk21c0x4567 = _mm_load_ps(w + 100);
+
+        const __m128 vi0x0c0 = _mm_load1_ps(i0 + 0);
+        vo0x0c0123 = _mm_add_ps(vo0x0c0123, _mm_mul_ps(vk01c0x0123, vi0x0c0));
+        vo0x0c4567 = _mm_add_ps(vo0x0c4567, _mm_mul_ps(vk01c0x4567, vi0x0c0));
+        const __m128 vi1x0c0 = _mm_load1_ps(i1 + 0);
+        vo0x0c0123 = _mm_add_ps(vo0x0c0123, _mm_mul_ps(vk11c0x0123, vi1x0c0));
+        vo0x0c4567 = _mm_add_ps(vo0x0c4567, _mm_mul_ps(vk11c0x4567, vi1x0c0));
+        const __m128 vi2x0c0 = _mm_load1_ps(i2 + 0);
+        vo0x0c0123 = _mm_add_ps(vo0x0c0123, _mm_mul_ps(vk21c0x0123, vi2x0c0));
+        vo0x0c4567 = _mm_add_ps(vo0x0c4567, _mm_mul_ps(vk21c0x4567, vi2x0c0));
+        vo1x0c0123 = _mm_add_ps(vo1x0c0123, _mm_mul_ps(vk01c0x0123, vi2x0c0));
+        vo1x0c4567 = _mm_add_ps(vo1x0c4567, _mm_mul_ps(vk01c0x4567, vi2x0c0));
+        const __m128 vi3x0c0 = _mm_load1_ps(i3 + 0);
+        vo1x0c0123 = _mm_add_ps(vo1x0c0123, _mm_mul_ps(vk11c0x0123, vi3x0c0));
+        vo1x0c4567 = _mm_add_ps(vo1x0c4567, _mm_mul_ps(vk11c0x4567, vi3x0c0));
+        const __m128 vi4x0c0 = _mm_load1_ps(i4 + 0);
+        vo1x0c0123 = _mm_add_ps(vo1x0c0123, _mm_mul_ps(vk21c0x0123, vi4x0c0));
+        vo1x0c4567 = _mm_add_ps(vo1x0c4567, _mm_mul_ps(vk21c0x4567, vi4x0c0));
+
+        const __m128 vk02c0x0123 = _mm_load_ps(w + 152);
+        const __m128 vk02c0x4567 = _mm_load_ps(w + 156);
+        const __m128 vk12c0x0123 = _mm_load_ps(w + 160);
+        const __m128 vk12c0x4567 = _mm_load_ps(w + 164);
+        const __m128 vk22c0x0123 = _mm_load_ps(w + 168);
+        const __m128 vk22c0x4567 = _mm_load_ps(w + 172);
+        const __m128 vk00c0x0123 = _mm_load_ps(w + 8);
+        const __m128 vk00c0x4567 = _mm_load_ps(w + 12);
+        const __m128 vk10c0x0123 = _mm_load_ps(w + 16);
+        const __m128 vk10c0x4567 = _mm_load_ps(w + 20);
+        const __m128 vk20c0x0123 = _mm_load_ps(w + 24);
+        const __m128 vk20c0x4567 = _mm_load_ps(w + 28);
+
+        const __m128 vi0x1c0 = _mm_load1_ps(i0 + 3);
+        vo0x0c0123 = _mm_add_ps(vo0x0c0123, _mm_mul_ps(vk02c0x0123, vi0x1c0));
+        vo0x0c4567 = _mm_add_ps(vo0x0c4567, _mm_mul_ps(vk02c0x4567, vi0x1c0));
+        vo0x1c0123 = _mm_add_ps(vo0x1c0123, _mm_mul_ps(vk00c0x0123, vi0x1c0));
+        vo0x1c4567 = _mm_add_ps(vo0x1c4567, _mm_mul_ps(vk00c0x4567, vi0x1c0));
+        const __m128 vi1x1c0 = _mm_load1_ps(i1 + 3);
+        vo0x0c0123 = _mm_add_ps(vo0x0c0123, _mm_mul_ps(vk12c0x0123, vi1x1c0));
+        vo0x0c4567 = _mm_add_ps(vo0x0c4567, _mm_mul_ps(vk12c0x4567, vi1x1c0));
+        vo0x1c0123 = _mm_add_ps(vo0x1c0123, _mm_mul_ps(vk10c0x0123, vi1x1c0));
+        vo0x1c4567 = _mm_add_ps(vo0x1c4567, _mm_mul_ps(vk10c0x4567, vi1x1c0));
+        const __m128 vi2x1c0 = _mm_load1_ps(i2 + 3);
+        vo0x0c0123 = _mm_add_ps(vo0x0c0123, _mm_mul_ps(vk22c0x0123, vi2x1c0));
+        vo0x0c4567 = _mm_add_ps(vo0x0c4567, _mm_mul_ps(vk22c0x4567, vi2x1c0));
+        vo0x1c0123 = _mm_add_ps(vo0x1c0123, _mm_mul_ps(vk20c0x0123, vi2x1c0));
+        vo0x1c4567 = _mm_add_ps(vo0x1c4567, _mm_mul_ps(vk20c0x4567, vi2x1c0));
+        vo1x0c0123 = _mm_add_ps(vo1x0c0123, _mm_mul_ps(vk02c0x0123, vi2x1c0));
+        vo1x0c4567 = _mm_add_ps(vo1x0c4567, _mm_mul_ps(vk02c0x4567, vi2x1c0));
+        vo1x1c0123 = _mm_add_ps(vo1x1c0123, _mm_mul_ps(vk00c0x0123, vi2x1c0));
+        vo1x1c4567 = _mm_add_ps(vo1x1c4567, _mm_mul_ps(vk00c0x4567, vi2x1c0));
+        const __m128 vi3x1c0 = _mm_load1_ps(i3 + 3);
+        vo1x0c0123 = _mm_add_ps(vo1x0c0123, _mm_mul_ps(vk12c0x0123, vi3x1c0));
+        vo1x0c4567 = _mm_add_ps(vo1x0c4567, _mm_mul_ps(vk12c0x4567, vi3x1c0));
+        vo1x1c0123 = _mm_add_ps(vo1x1c0123, _mm_mul_ps(vk10c0x0123, vi3x1c0));
+        vo1x1c4567 = _mm_add_ps(vo1x1c4567, _mm_mul_ps(vk10c0x4567, vi3x1c0));
+        const __m128 vi4x1c0 = _mm_load1_ps(i4 + 3);
+        vo1x0c0123 = _mm_add_ps(vo1x0c0123, _mm_mul_ps(vk22c0x0123, vi4x1c0));
+        vo1x0c4567 = _mm_add_ps(vo1x0c4567, _mm_mul_ps(vk22c0x4567, vi4x1c0));
+        vo1x1c0123 = _mm_add_ps(vo1x1c0123, _mm_mul_ps(vk20c0x0123, vi4x1c0));
+        vo1x1c4567 = _mm_add_ps(vo1x1c4567, _mm_mul_ps(vk20c0x4567, vi4x1c0));
+        const __m128 vk01c1x0123 = _mm_load_ps(w + 104);
+        const __m128 vk01c1x4567 = _mm_load_ps(w + 108);
+        const __m128 vk11c1x0123 = _mm_load_ps(w + 112);
+        const __m128 vk11c1x4567 = _mm_load_ps(w + 116);
+        const __m128 vk21c1x0123 = _mm_load_ps(w + 120);
+        const __m128 vk21c1x4567 = _mm_load_ps(w + 124);
+
+        const __m128 vi0x0c1 = _mm_load1_ps(i0 + 1);
+        vo0x0c0123 = _mm_add_ps(vo0x0c0123, _mm_mul_ps(vk01c1x0123, vi0x0c1));
+        vo0x0c4567 = _mm_add_ps(vo0x0c4567, _mm_mul_ps(vk01c1x4567, vi0x0c1));
+        const __m128 vi1x0c1 = _mm_load1_ps(i1 + 1);
+        vo0x0c0123 = _mm_add_ps(vo0x0c0123, _mm_mul_ps(vk11c1x0123, vi1x0c1));
+        vo0x0c4567 = _mm_add_ps(vo0x0c4567, _mm_mul_ps(vk11c1x4567, vi1x0c1));
+        const __m128 vi2x0c1 = _mm_load1_ps(i2 + 1);
+        vo0x0c0123 = _mm_add_ps(vo0x0c0123, _mm_mul_ps(vk21c1x0123, vi2x0c1));
+        vo0x0c4567 = _mm_add_ps(vo0x0c4567, _mm_mul_ps(vk21c1x4567, vi2x0c1));
+        vo1x0c0123 = _mm_add_ps(vo1x0c0123, _mm_mul_ps(vk01c1x0123, vi2x0c1));
+        vo1x0c4567 = _mm_add_ps(vo1x0c4567, _mm_mul_ps(vk01c1x4567, vi2x0c1));
+        const __m128 vi3x0c1 = _mm_load1_ps(i3 + 1);
+        vo1x0c0123 = _mm_add_ps(vo1x0c0123, _mm_mul_ps(vk11c1x0123, vi3x0c1));
+        vo1x0c4567 = _mm_add_ps(vo1x0c4567, _mm_mul_ps(vk11c1x4567, vi3x0c1));
+        const __m128 vi4x0c1 = _mm_load1_ps(i4 + 1);
+        vo1x0c0123 = _mm_add_ps(vo1x0c0123, _mm_mul_ps(vk21c1x0123, vi4x0c1));
+        vo1x0c4567 = _mm_add_ps(vo1x0c4567, _mm_mul_ps(vk21c1x4567, vi4x0c1));
+
+        const __m128 vk02c1x0123 = _mm_load_ps(w + 176);
+        const __m128 vk02c1x4567 = _mm_load_ps(w + 180);
+        const __m128 vk12c1x0123 = _mm_load_ps(w + 184);
+        const __m128 vk12c1x4567 = _mm_load_ps(w + 188);
+        const __m128 vk22c1x0123 = _mm_load_ps(w + 192);
+        const __m128 vk22c1x4567 = _mm_load_ps(w + 196);
+        const __m128 vk00c1x0123 = _mm_load_ps(w + 32);
+        const __m128 vk00c1x4567 = _mm_load_ps(w + 36);
+        const __m128 vk10c1x0123 = _mm_load_ps(w + 40);
+        const __m128 vk10c1x4567 = _mm_load_ps(w + 44);
+        const __m128 vk20c1x0123 = _mm_load_ps(w + 48);
+        const __m128 vk20c1x4567 = _mm_load_ps(w + 52);
+
+        const __m128 vi0x1c1 = _mm_load1_ps(i0 + 4);
+        vo0x0c0123 = _mm_add_ps(vo0x0c0123, _mm_mul_ps(vk02c1x0123, vi0x1c1));
+        vo0x0c4567 = _mm_add_ps(vo0x0c4567, _mm_mul_ps(vk02c1x4567, vi0x1c1));
+        vo0x1c0123 = _mm_add_ps(vo0x1c0123, _mm_mul_ps(vk00c1x0123, vi0x1c1));
+        vo0x1c4567 = _mm_add_ps(vo0x1c4567, _mm_mul_ps(vk00c1x4567, vi0x1c1));
+        const __m128 vi1x1c1 = _mm_load1_ps(i1 + 4);
+        vo0x0c0123 = _mm_add_ps(vo0x0c0123, _mm_mul_ps(vk12c1x0123, vi1x1c1));
+        vo0x0c4567 = _mm_add_ps(vo0x0c4567, _mm_mul_ps(vk12c1x4567, vi1x1c1));
+        vo0x1c0123 = _mm_add_ps(vo0x1c0123, _mm_mul_ps(vk10c1x0123, vi1x1c1));
+        vo0x1c4567 = _mm_add_ps(vo0x1c4567, _mm_mul_ps(vk10c1x4567, vi1x1c1));
+        const __m128 vi2x1c1 = _mm_load1_ps(i2 + 4);
+        vo0x0c0123 = _mm_add_ps(vo0x0c0123, _mm_mul_ps(vk22c1x0123, vi2x1c1));
+        vo0x0c4567 = _mm_add_ps(vo0x0c4567, _mm_mul_ps(vk22c1x4567, vi2x1c1));
+        vo0x1c0123 = _mm_add_ps(vo0x1c0123, _mm_mul_ps(vk20c1x0123, vi2x1c1));
+        vo0x1c4567 = _mm_add_ps(vo0x1c4567, _mm_mul_ps(vk20c1x4567, vi2x1c1));
+        vo1x0c0123 = _mm_add_ps(vo1x0c0123, _mm_mul_ps(vk02c1x0123, vi2x1c1));
+        vo1x0c4567 = _mm_add_ps(vo1x0c4567, _mm_mul_ps(vk02c1x4567, vi2x1c1));
+        vo1x1c0123 = _mm_add_ps(vo1x1c0123, _mm_mul_ps(vk00c1x0123, vi2x1c1));
+        vo1x1c4567 = _mm_add_ps(vo1x1c4567, _mm_mul_ps(vk00c1x4567, vi2x1c1));
+        const __m128 vi3x1c1 = _mm_load1_ps(i3 + 4);
+        vo1x0c0123 = _mm_add_ps(vo1x0c0123, _mm_mul_ps(vk12c1x0123, vi3x1c1));
+        vo1x0c4567 = _mm_add_ps(vo1x0c4567, _mm_mul_ps(vk12c1x4567, vi3x1c1));
+        vo1x1c0123 = _mm_add_ps(vo1x1c0123, _mm_mul_ps(vk10c1x0123, vi3x1c1));
+        vo1x1c4567 = _mm_add_ps(vo1x1c4567, _mm_mul_ps(vk10c1x4567, vi3x1c1));
+        const __m128 vi4x1c1 = _mm_load1_ps(i4 + 4);
+        vo1x0c0123 = _mm_add_ps(vo1x0c0123, _mm_mul_ps(vk22c1x0123, vi4x1c1));
+        vo1x0c4567 = _mm_add_ps(vo1x0c4567, _mm_mul_ps(vk22c1x4567, vi4x1c1));
+        vo1x1c0123 = _mm_add_ps(vo1x1c0123, _mm_mul_ps(vk20c1x0123, vi4x1c1));
+        vo1x1c4567 = _mm_add_ps(vo1x1c4567, _mm_mul_ps(vk20c1x4567, vi4x1c1));
+        const __m128 vk01c2x0123 = _mm_load_ps(w + 128);
+        const __m128 vk01c2x4567 = _mm_load_ps(w + 132);
+        const __m128 vk11c2x0123 = _mm_load_ps(w + 136);
+        const __m128 vk11c2x4567 = _mm_load_ps(w + 140);
+        const __m128 vk21c2x0123 = _mm_load_ps(w + 144);
+        const __m128 vk21c2x4567 = _mm_load_ps(w + 148);
+
+        const __m128 vi0x0c2 = _mm_load1_ps(i0 + 2);
+        vo0x0c0123 = _mm_add_ps(vo0x0c0123, _mm_mul_ps(vk01c2x0123, vi0x0c2));
+        vo0x0c4567 = _mm_add_ps(vo0x0c4567, _mm_mul_ps(vk01c2x4567, vi0x0c2));
+        const __m128 vi1x0c2 = _mm_load1_ps(i1 + 2);
+        vo0x0c0123 = _mm_add_ps(vo0x0c0123, _mm_mul_ps(vk11c2x0123, vi1x0c2));
+        vo0x0c4567 = _mm_add_ps(vo0x0c4567, _mm_mul_ps(vk11c2x4567, vi1x0c2));
+        const __m128 vi2x0c2 = _mm_load1_ps(i2 + 2);
+        vo0x0c0123 = _mm_add_ps(vo0x0c0123, _mm_mul_ps(vk21c2x0123, vi2x0c2));
+        vo0x0c4567 = _mm_add_ps(vo0x0c4567, _mm_mul_ps(vk21c2x4567, vi2x0c2));
+        vo1x0c0123 = _mm_add_ps(vo1x0c0123, _mm_mul_ps(vk01c2x0123, vi2x0c2));
+        vo1x0c4567 = _mm_add_ps(vo1x0c4567, _mm_mul_ps(vk01c2x4567, vi2x0c2));
+        const __m128 vi3x0c2 = _mm_load1_ps(i3 + 2);
+        vo1x0c0123 = _mm_add_ps(vo1x0c0123, _mm_mul_ps(vk11c2x0123, vi3x0c2));
+        vo1x0c4567 = _mm_add_ps(vo1x0c4567, _mm_mul_ps(vk11c2x4567, vi3x0c2));
+        const __m128 vi4x0c2 = _mm_load1_ps(i4 + 2);
+        vo1x0c0123 = _mm_add_ps(vo1x0c0123, _mm_mul_ps(vk21c2x0123, vi4x0c2));
+        vo1x0c4567 = _mm_add_ps(vo1x0c4567, _mm_mul_ps(vk21c2x4567, vi4x0c2));
+
+        const __m128 vk02c2x0123 = _mm_load_ps(w + 200);
+        const __m128 vk02c2x4567 = _mm_load_ps(w + 204);
+        const __m128 vk12c2x0123 = _mm_load_ps(w + 208);
+        const __m128 vk12c2x4567 = _mm_load_ps(w + 212);
+        const __m128 vk22c2x0123 = _mm_load_ps(w + 216);
+        const __m128 vk22c2x4567 = _mm_load_ps(w + 220);
+        const __m128 vk00c2x0123 = _mm_load_ps(w + 56);
+        const __m128 vk00c2x4567 = _mm_load_ps(w + 60);
+        const __m128 vk10c2x0123 = _mm_load_ps(w + 64);
+        const __m128 vk10c2x4567 = _mm_load_ps(w + 68);
+        const __m128 vk20c2x0123 = _mm_load_ps(w + 72);
+        const __m128 vk20c2x4567 = _mm_load_ps(w + 76);
+
+        const __m128 vi0x1c2 = _mm_load1_ps(i0 + 5);
+        vo0x0c0123 = _mm_add_ps(vo0x0c0123, _mm_mul_ps(vk02c2x0123, vi0x1c2));
+        vo0x0c4567 = _mm_add_ps(vo0x0c4567, _mm_mul_ps(vk02c2x4567, vi0x1c2));
+        vo0x1c0123 = _mm_add_ps(vo0x1c0123, _mm_mul_ps(vk00c2x0123, vi0x1c2));
+        vo0x1c4567 = _mm_add_ps(vo0x1c4567, _mm_mul_ps(vk00c2x4567, vi0x1c2));
+        const __m128 vi1x1c2 = _mm_load1_ps(i1 + 5);
+        vo0x0c0123 = _mm_add_ps(vo0x0c0123, _mm_mul_ps(vk12c2x0123, vi1x1c2));
+        vo0x0c4567 = _mm_add_ps(vo0x0c4567, _mm_mul_ps(vk12c2x4567, vi1x1c2));
+        vo0x1c0123 = _mm_add_ps(vo0x1c0123, _mm_mul_ps(vk10c2x0123, vi1x1c2));
+        vo0x1c4567 = _mm_add_ps(vo0x1c4567, _mm_mul_ps(vk10c2x4567, vi1x1c2));
+        const __m128 vi2x1c2 = _mm_load1_ps(i2 + 5);
+        vo0x0c0123 = _mm_add_ps(vo0x0c0123, _mm_mul_ps(vk22c2x0123, vi2x1c2));
+        vo0x0c4567 = _mm_add_ps(vo0x0c4567, _mm_mul_ps(vk22c2x4567, vi2x1c2));
+        vo0x1c0123 = _mm_add_ps(vo0x1c0123, _mm_mul_ps(vk20c2x0123, vi2x1c2));
+        vo0x1c4567 = _mm_add_ps(vo0x1c4567, _mm_mul_ps(vk20c2x4567, vi2x1c2));
+        vo1x0c0123 = _mm_add_ps(vo1x0c0123, _mm_mul_ps(vk02c2x0123, vi2x1c2));
+        vo1x0c4567 = _mm_add_ps(vo1x0c4567, _mm_mul_ps(vk02c2x4567, vi2x1c2));
+        vo1x1c0123 = _mm_add_ps(vo1x1c0123, _mm_mul_ps(vk00c2x0123, vi2x1c2));
+        vo1x1c4567 = _mm_add_ps(vo1x1c4567, _mm_mul_ps(vk00c2x4567, vi2x1c2));
+        const __m128 vi3x1c2 = _mm_load1_ps(i3 + 5);
+        vo1x0c0123 = _mm_add_ps(vo1x0c0123, _mm_mul_ps(vk12c2x0123, vi3x1c2));
+        vo1x0c4567 = _mm_add_ps(vo1x0c4567, _mm_mul_ps(vk12c2x4567, vi3x1c2));
+        vo1x1c0123 = _mm_add_ps(vo1x1c0123, _mm_mul_ps(vk10c2x0123, vi3x1c2));
+        vo1x1c4567 = _mm_add_ps(vo1x1c4567, _mm_mul_ps(vk10c2x4567, vi3x1c2));
+        const __m128 vi4x1c2 = _mm_load1_ps(i4 + 5);
+        vo1x0c0123 = _mm_add_ps(vo1x0c0123, _mm_mul_ps(vk22c2x0123, vi4x1c2));
+        vo1x0c4567 = _mm_add_ps(vo1x0c4567, _mm_mul_ps(vk22c2x4567, vi4x1c2));
+        vo1x1c0123 = _mm_add_ps(vo1x1c0123, _mm_mul_ps(vk20c2x0123, vi4x1c2));
+        vo1x1c4567 = _mm_add_ps(vo1x1c4567, _mm_mul_ps(vk20c2x4567, vi4x1c2));
+
+        i0 += 6;
+        i1 += 6;
+        i2 += 6;
+        i3 += 6;
+        i4 += 6;
+
+        vo0x0c0123 = _mm_max_ps(vo0x0c0123, vmin);
+        vo0x0c4567 = _mm_max_ps(vo0x0c4567, vmin);
+        vo1x0c0123 = _mm_max_ps(vo1x0c0123, vmin);
+        vo1x0c4567 = _mm_max_ps(vo1x0c4567, vmin);
+        vo0x0c0123 = _mm_min_ps(vo0x0c0123, vmax);
+        vo0x0c4567 = _mm_min_ps(vo0x0c4567, vmax);
+        vo1x0c0123 = _mm_min_ps(vo1x0c0123, vmax);
+        vo1x0c4567 = _mm_min_ps(vo1x0c4567, vmax);
+
+        if XNN_LIKELY(c >= 8) {
+          _mm_storeu_ps(o1, vo1x0c0123);
+          _mm_storeu_ps(o1 + 4, vo1x0c4567);
+          o1 = (float*) ((uintptr_t) o1 + output_width_stride);
+          _mm_storeu_ps(o0, vo0x0c0123);
+          _mm_storeu_ps(o0 + 4, vo0x0c4567);
+          o0 = (float*) ((uintptr_t) o0 + output_width_stride);
+        } else {
+          float* o1_tmp = o1;
+          float* o0_tmp = o0;
+          if (c & 4) {
+            _mm_storeu_ps((float*) ((uintptr_t) o1_tmp + output_width_stride * 0) + 0, vo1x0c0123);
+            _mm_storeu_ps((float*) ((uintptr_t) o0_tmp + output_width_stride * 0) + 0, vo0x0c0123);
+            o1_tmp += 4;
+            o0_tmp += 4;
+            vo0x0c0123 = vo0x0c4567;
+            vo1x0c0123 = vo1x0c4567;
+          }
+          if (c & 2) {
+            _mm_storel_pi((__m64*) ((uintptr_t) o1_tmp + output_width_stride * 0), vo1x0c0123);
+            _mm_storel_pi((__m64*) ((uintptr_t) o0_tmp + output_width_stride * 0), vo0x0c0123);
+            o1_tmp += 2;
+            o0_tmp += 2;
+            vo0x0c0123 = _mm_movehl_ps(vo0x0c0123, vo0x0c0123);
+            vo1x0c0123 = _mm_movehl_ps(vo1x0c0123, vo1x0c0123);
+          }
+          if (c & 1) {
+            _mm_store_ss((float*) ((uintptr_t) o1_tmp + output_width_stride * 0), vo1x0c0123);
+            _mm_store_ss((float*) ((uintptr_t) o0_tmp + output_width_stride * 0), vo0x0c0123);
+          }
+          o1 = (float*) ((uintptr_t) o1 + output_width_stride);
+          o0 = (float*) ((uintptr_t) o0 + output_width_stride);
+        }
+
+        vo0x0c0123 = vo0x1c0123;
+        vo0x0c4567 = vo0x1c4567;
+        vo1x0c0123 = vo1x1c0123;
+        vo1x0c4567 = vo1x1c4567;
+      }
+      assert(iw < 2);
+      if XNN_UNLIKELY(iw != 0) {
+        // The last input column contributes through the center column of the kernel; the right column is padding.
+        const __m128 vk01c0x0123 = _mm_load_ps(w + 80);
+        const __m128 vk01c0x4567 = _mm_load_ps(w + 84);
+        const __m128 vk11c0x0123 = _mm_load_ps(w + 88);
+        const __m128 vk11c0x4567 = _mm_load_ps(w + 92);
+        const __m128 vk21c0x0123 = _mm_load_ps(w + 96);
+        const __m128 vk21c0x4567 = _mm_load_ps(w + 100);
+
+        const __m128 vi0x0c0 = _mm_load1_ps(i0 + 0);
+        vo0x0c0123 = _mm_add_ps(vo0x0c0123, _mm_mul_ps(vk01c0x0123, vi0x0c0));
+        vo0x0c4567 = _mm_add_ps(vo0x0c4567, _mm_mul_ps(vk01c0x4567, vi0x0c0));
+        const __m128 vi1x0c0 = _mm_load1_ps(i1 + 0);
+        vo0x0c0123 = _mm_add_ps(vo0x0c0123, _mm_mul_ps(vk11c0x0123, vi1x0c0));
+        vo0x0c4567 = _mm_add_ps(vo0x0c4567, _mm_mul_ps(vk11c0x4567, vi1x0c0));
+        const __m128 vi2x0c0 = _mm_load1_ps(i2 + 0);
+        vo0x0c0123 = _mm_add_ps(vo0x0c0123, _mm_mul_ps(vk21c0x0123, vi2x0c0));
+        vo0x0c4567 = _mm_add_ps(vo0x0c4567, _mm_mul_ps(vk21c0x4567, vi2x0c0));
+        vo1x0c0123 = _mm_add_ps(vo1x0c0123, _mm_mul_ps(vk01c0x0123, vi2x0c0));
+        vo1x0c4567 = _mm_add_ps(vo1x0c4567, _mm_mul_ps(vk01c0x4567, vi2x0c0));
+        const __m128 vi3x0c0 = _mm_load1_ps(i3 + 0);
+        vo1x0c0123 = _mm_add_ps(vo1x0c0123, _mm_mul_ps(vk11c0x0123, vi3x0c0));
+        vo1x0c4567 = _mm_add_ps(vo1x0c4567, _mm_mul_ps(vk11c0x4567, vi3x0c0));
+        const __m128 vi4x0c0 = _mm_load1_ps(i4 + 0);
+        vo1x0c0123 = _mm_add_ps(vo1x0c0123, _mm_mul_ps(vk21c0x0123, vi4x0c0));
+        vo1x0c4567 = _mm_add_ps(vo1x0c4567, _mm_mul_ps(vk21c0x4567, vi4x0c0));
+        const __m128 vk01c1x0123 = _mm_load_ps(w + 104);
+        const __m128 vk01c1x4567 = _mm_load_ps(w + 108);
+        const __m128 vk11c1x0123 = _mm_load_ps(w + 112);
+        const __m128 vk11c1x4567 = _mm_load_ps(w + 116);
+        const __m128 vk21c1x0123 = _mm_load_ps(w + 120);
+        const __m128 vk21c1x4567 = _mm_load_ps(w + 124);
+
+        const __m128 vi0x0c1 = _mm_load1_ps(i0 + 1);
+        vo0x0c0123 = _mm_add_ps(vo0x0c0123, _mm_mul_ps(vk01c1x0123, vi0x0c1));
+        vo0x0c4567 = _mm_add_ps(vo0x0c4567, _mm_mul_ps(vk01c1x4567, vi0x0c1));
+        const __m128 vi1x0c1 = _mm_load1_ps(i1 + 1);
+        vo0x0c0123 = _mm_add_ps(vo0x0c0123, _mm_mul_ps(vk11c1x0123, vi1x0c1));
+        vo0x0c4567 = _mm_add_ps(vo0x0c4567, _mm_mul_ps(vk11c1x4567, vi1x0c1));
+        const __m128 vi2x0c1 = _mm_load1_ps(i2 + 1);
+        vo0x0c0123 = _mm_add_ps(vo0x0c0123, _mm_mul_ps(vk21c1x0123, vi2x0c1));
+        vo0x0c4567 = _mm_add_ps(vo0x0c4567, _mm_mul_ps(vk21c1x4567, vi2x0c1));
+        vo1x0c0123 = _mm_add_ps(vo1x0c0123, _mm_mul_ps(vk01c1x0123, vi2x0c1));
+        vo1x0c4567 = _mm_add_ps(vo1x0c4567, _mm_mul_ps(vk01c1x4567, vi2x0c1));
+        const __m128 vi3x0c1 = _mm_load1_ps(i3 + 1);
+        vo1x0c0123 = _mm_add_ps(vo1x0c0123, _mm_mul_ps(vk11c1x0123, vi3x0c1));
+        vo1x0c4567 = _mm_add_ps(vo1x0c4567, _mm_mul_ps(vk11c1x4567, vi3x0c1));
+        const __m128 vi4x0c1 = _mm_load1_ps(i4 + 1);
+        vo1x0c0123 = _mm_add_ps(vo1x0c0123, _mm_mul_ps(vk21c1x0123, vi4x0c1));
+        vo1x0c4567 = _mm_add_ps(vo1x0c4567, _mm_mul_ps(vk21c1x4567, vi4x0c1));
+        const __m128 vk01c2x0123 = _mm_load_ps(w + 128);
+        const __m128 vk01c2x4567 = _mm_load_ps(w + 132);
+        const __m128 vk11c2x0123 = _mm_load_ps(w + 136);
+        const __m128 vk11c2x4567 = _mm_load_ps(w + 140);
+        const __m128 vk21c2x0123 = _mm_load_ps(w + 144);
+        const __m128 vk21c2x4567 = _mm_load_ps(w + 148);
+
+        const __m128 vi0x0c2 = _mm_load1_ps(i0 + 2);
+        vo0x0c0123 = _mm_add_ps(vo0x0c0123, _mm_mul_ps(vk01c2x0123, vi0x0c2));
+        vo0x0c4567 = _mm_add_ps(vo0x0c4567, _mm_mul_ps(vk01c2x4567, vi0x0c2));
+        const __m128 vi1x0c2 = _mm_load1_ps(i1 + 2);
+        vo0x0c0123 = _mm_add_ps(vo0x0c0123, _mm_mul_ps(vk11c2x0123, vi1x0c2));
+        vo0x0c4567 = _mm_add_ps(vo0x0c4567, _mm_mul_ps(vk11c2x4567, vi1x0c2));
+        const __m128 vi2x0c2 = _mm_load1_ps(i2 + 2);
+        vo0x0c0123 = _mm_add_ps(vo0x0c0123, _mm_mul_ps(vk21c2x0123, vi2x0c2));
+        vo0x0c4567 = _mm_add_ps(vo0x0c4567, _mm_mul_ps(vk21c2x4567, vi2x0c2));
+        vo1x0c0123 = _mm_add_ps(vo1x0c0123, _mm_mul_ps(vk01c2x0123, vi2x0c2));
+        vo1x0c4567 = _mm_add_ps(vo1x0c4567, _mm_mul_ps(vk01c2x4567, vi2x0c2));
+        const __m128 vi3x0c2 = _mm_load1_ps(i3 + 2);
+        vo1x0c0123 = _mm_add_ps(vo1x0c0123, _mm_mul_ps(vk11c2x0123, vi3x0c2));
+        vo1x0c4567 = _mm_add_ps(vo1x0c4567, _mm_mul_ps(vk11c2x4567, vi3x0c2));
+        const __m128 vi4x0c2 = _mm_load1_ps(i4 + 2);
+        vo1x0c0123 = _mm_add_ps(vo1x0c0123, _mm_mul_ps(vk21c2x0123, vi4x0c2));
+        vo1x0c4567 = _mm_add_ps(vo1x0c4567, _mm_mul_ps(vk21c2x4567, vi4x0c2));
+
+        vo0x0c0123 = _mm_max_ps(vo0x0c0123, vmin);
+        vo0x0c4567 = _mm_max_ps(vo0x0c4567, vmin);
+        vo1x0c0123 = _mm_max_ps(vo1x0c0123, vmin);
+        vo1x0c4567 = _mm_max_ps(vo1x0c4567, vmin);
+        vo0x0c0123 = _mm_min_ps(vo0x0c0123, vmax);
+        vo0x0c4567 = _mm_min_ps(vo0x0c4567, vmax);
+        vo1x0c0123 = _mm_min_ps(vo1x0c0123, vmax);
+        vo1x0c4567 = _mm_min_ps(vo1x0c4567, vmax);
+
+        if XNN_LIKELY(c >= 8) {
+          _mm_storeu_ps(o1, vo1x0c0123);
+          _mm_storeu_ps(o1 + 4, vo1x0c4567);
+          _mm_storeu_ps(o0, vo0x0c0123);
+          _mm_storeu_ps(o0 + 4, vo0x0c4567);
+        } else {
+          float* o1_tmp = o1;
+          float* o0_tmp = o0;
+          if (c & 4) {
+            _mm_storeu_ps(o1_tmp + 0, vo1x0c0123);
+            _mm_storeu_ps(o0_tmp + 0, vo0x0c0123);
+            o1_tmp += 4;
+            o0_tmp += 4;
+            vo0x0c0123 = vo0x0c4567;
+            vo1x0c0123 = vo1x0c4567;
+          }
+          if (c & 2) {
+            _mm_storel_pi((__m64*) o1_tmp, vo1x0c0123);
+            _mm_storel_pi((__m64*) o0_tmp, vo0x0c0123);
+            o1_tmp += 2;
+            o0_tmp += 2;
+            vo0x0c0123 = _mm_movehl_ps(vo0x0c0123, vo0x0c0123);
+            vo1x0c0123 = _mm_movehl_ps(vo1x0c0123, vo1x0c0123);
+          }
+          if (c & 1) {
+            _mm_store_ss(o1_tmp, vo1x0c0123);
+            _mm_store_ss(o0_tmp, vo0x0c0123);
+          }
+        }
+        o1 = (float*) ((uintptr_t) o1 + output_width_stride);
+        o0 = (float*) ((uintptr_t) o0 + output_width_stride);
+      }
+      // Move output pointers back to the position of the first pixel in a row,
+      // and forward to the next block of output channels
+      o0 = (float*) ((uintptr_t) o0 - output_channel_decrement);
+      o1 = (float*) ((uintptr_t) o1 - output_channel_decrement);
+      // Revert input pointers to the position of the first pixel in a row
+      i0 = (const float*) ((uintptr_t) i0 - input_width_decrement);
+      i1 = (const float*) ((uintptr_t) i1 - input_width_decrement);
+      i2 = (const float*) ((uintptr_t) i2 - input_width_decrement);
+      i3 = (const float*) ((uintptr_t) i3 - input_width_decrement);
+      i4 = (const float*) ((uintptr_t) i4 - input_width_decrement);
+      // Move to the block of weights for the next 8 output channels
+      w += 224;
+      c = doz(c, 8);
+    } while (c != 0);
+    // Move output pointers back to the position of the first channel, and forward to the next block of rows
+    o0 = (float*) ((uintptr_t) o0 + output_height_increment);
+    o1 = (float*) ((uintptr_t) o1 + output_height_increment);
+    // Move input pointers forward to the next four rows
+    i0 = i4;
+    i1 = (const float*) ((uintptr_t) i0 + input_height_stride);
+    i2 = (const float*) ((uintptr_t) i1 + input_height_stride);
+    i3 = (const float*) ((uintptr_t) i2 + input_height_stride);
+    i4 = (const float*) ((uintptr_t) i3 + input_height_stride);
+  }
+}
+
 void xnn_f32_conv_hwc2chw_ukernel_3x3s2p1c3x4__sse_2x2(
     size_t input_height,
     size_t input_width,
@@ -6497,6 +7510,69 @@ void xnn_f32_pavgpool_minmax_ukernel_9x__sse_c4(
   } while (--output_pixels != 0);
 }
 
+void xnn_f32_rdmax_ukernel_c16__sse(
+    size_t rows,
+    size_t channels,
+    const float* input,
+    size_t input_stride,
+    float* output,
+    const union xnn_f32_default_params params[restrict XNN_MIN_ELEMENTS(1)]) XNN_OOB_READS
+{
+  assert(rows != 0);
+  assert(channels != 0);
+
+  for (; channels >= 16; channels -= 16) {
+    const float* i = input;
+    __m128 vmax0123 = _mm_loadu_ps(i);
+    __m128 vmax4567 = _mm_loadu_ps(i + 4);
+    __m128 vmax89AB = _mm_loadu_ps(i + 8);
+    __m128 vmaxCDEF = _mm_loadu_ps(i + 12);
+    for (size_t r = rows - 1; r != 0; r--) {
+      i = (const float*) ((uintptr_t) i + input_stride);
+      vmax0123 = _mm_max_ps(vmax0123, _mm_loadu_ps(i));
+      vmax4567 = _mm_max_ps(vmax4567, _mm_loadu_ps(i + 4));
+      vmax89AB = _mm_max_ps(vmax89AB, _mm_loadu_ps(i + 8));
+      vmaxCDEF = _mm_max_ps(vmaxCDEF, _mm_loadu_ps(i + 12));
+    }
+    input += 16;
+
+    _mm_storeu_ps(output, vmax0123);
+    _mm_storeu_ps(output + 4, vmax4567);
+    _mm_storeu_ps(output + 8, vmax89AB);
+    _mm_storeu_ps(output + 12, vmaxCDEF);
+    output += 16;
+  }
+  for (; channels >= 4; channels -= 4) {
+    const float* i = input;
+    __m128 vmax = _mm_loadu_ps(i);
+    for (size_t r = rows - 1; r != 0; r--) {
+      i = (const float*) ((uintptr_t) i + input_stride);
+      vmax = _mm_max_ps(vmax, _mm_loadu_ps(i));
+    }
+    input += 4;
+
+    _mm_storeu_ps(output, vmax);
+    output += 4;
+  }
+  if XNN_UNLIKELY(channels != 0) {
+    const float* i = input;
+    __m128 vmax = _mm_loadu_ps(i);
+    for (size_t r = rows - 1; r != 0; r--) {
+      i = (const float*) ((uintptr_t) i + input_stride);
+      vmax = _mm_max_ps(vmax, _mm_loadu_ps(i));
+    }
+
+    if (channels & 2) {
+      _mm_storel_pi((__m64*) output, vmax);
+      vmax = _mm_movehl_ps(vmax, vmax);
+      output += 2;
+    }
+    if (channels & 1) {
+      _mm_store_ss(output, vmax);
+    }
+  }
+}
+
 void xnn_f32_rmax_ukernel__sse(
     size_t n,
     const float* x,
@@ -6540,6 +7616,115 @@ void xnn_f32_rmax_ukernel__sse(
   _mm_store_ss(y, vmax_lo);
 }
 
+void xnn_f32_rmeanvar_ukernel__sse(
+    size_t n,
+    const float* x,
+    float* mean,
+    float* variance)
+{
+  assert(n != 0);
+  assert(n % sizeof(float) == 0);
+
+  // Every lane of every accumulator runs its own Welford recurrence:
+  //   delta := x - mean
+  //   mean := mean + delta / count
+  //   m2 := m2 + delta * (x - mean)
+  // All lanes see the same number of elements, so the reciprocal of the element count is shared between them.
+  __m128 vmean0 = _mm_setzero_ps();
+  __m128 vmean1 = _mm_setzero_ps();
+  __m128 vmean2 = _mm_setzero_ps();
+  __m128 vmean3 = _mm_setzero_ps();
+  __m128 vm2_0 = _mm_setzero_ps();
+  __m128 vm2_1 = _mm_setzero_ps();
+  __m128 vm2_2 = _mm_setzero_ps();
+  __m128 vm2_3 = _mm_setzero_ps();
+  float vcount = 0.0f;
+  for (; n >= 16 * sizeof(float); n -= 16 * sizeof(float)) {
+    const __m128 vx0 = _mm_loadu_ps(x);
+    const __m128 vx1 = _mm_loadu_ps(x + 4);
+    const __m128 vx2 = _mm_loadu_ps(x + 8);
+    const __m128 vx3 = _mm_loadu_ps(x + 12);
+    x += 16;
+
+    vcount += 1.0f;
+    const __m128 vrcp_count = _mm_set1_ps(1.0f / vcount);
+
+    const __m128 vdelta0 = _mm_sub_ps(vx0, vmean0);
+    const __m128 vdelta1 = _mm_sub_ps(vx1, vmean1);
+    const __m128 vdelta2 = _mm_sub_ps(vx2, vmean2);
+    const __m128 vdelta3 = _mm_sub_ps(vx3, vmean3);
+
+    vmean0 = _mm_add_ps(vmean0, _mm_mul_ps(vdelta0, vrcp_count));
+    vmean1 = _mm_add_ps(vmean1, _mm_mul_ps(vdelta1, vrcp_count));
+    vmean2 = _mm_add_ps(vmean2, _mm_mul_ps(vdelta2, vrcp_count));
+    vmean3 = _mm_add_ps(vmean3, _mm_mul_ps(vdelta3, vrcp_count));
+
+    vm2_0 = _mm_add_ps(vm2_0, _mm_mul_ps(vdelta0, _mm_sub_ps(vx0, vmean0)));
+    vm2_1 = _mm_add_ps(vm2_1, _mm_mul_ps(vdelta1, _mm_sub_ps(vx1, vmean1)));
+    vm2_2 = _mm_add_ps(vm2_2, _mm_mul_ps(vdelta2, _mm_sub_ps(vx2, vmean2)));
+    vm2_3 = _mm_add_ps(vm2_3, _mm_mul_ps(vdelta3, _mm_sub_ps(vx3, vmean3)));
+  }
+
+  // Merge pairs of accumulators with equal element counts (Chan et al.):
+  //   mean := (mean_a + mean_b) / 2
+  //   m2 := m2_a + m2_b + (mean_b - mean_a)**2 * count / 2
+  const __m128 vhalf = _mm_set1_ps(0.5f);
+  __m128 vhalf_count = _mm_set1_ps(vcount * 0.5f);
+  const __m128 vdelta01 = _mm_sub_ps(vmean1, vmean0);
+  const __m128 vdelta23 = _mm_sub_ps(vmean3, vmean2);
+  const __m128 vmean01 = _mm_add_ps(vmean0, _mm_mul_ps(vdelta01, vhalf));
+  const __m128 vmean23 = _mm_add_ps(vmean2, _mm_mul_ps(vdelta23, vhalf));
+  const __m128 vm2_01 = _mm_add_ps(_mm_add_ps(vm2_0, vm2_1), _mm_mul_ps(_mm_mul_ps(vdelta01, vdelta01), vhalf_count));
+  const __m128 vm2_23 = _mm_add_ps(_mm_add_ps(vm2_2, vm2_3), _mm_mul_ps(_mm_mul_ps(vdelta23, vdelta23), vhalf_count));
+  vcount += vcount;
+
+  vhalf_count = _mm_set1_ps(vcount * 0.5f);
+  const __m128 vdelta0123 = _mm_sub_ps(vmean23, vmean01);
+  __m128 vmean = _mm_add_ps(vmean01, _mm_mul_ps(vdelta0123, vhalf));
+  __m128 vm2 = _mm_add_ps(_mm_add_ps(vm2_01, vm2_23), _mm_mul_ps(_mm_mul_ps(vdelta0123, vdelta0123), vhalf_count));
+  vcount += vcount;
+
+  for (; n >= 4 * sizeof(float); n -= 4 * sizeof(float)) {
+    const __m128 vx = _mm_loadu_ps(x);
+    x += 4;
+
+    vcount += 1.0f;
+    const __m128 vrcp_count = _mm_set1_ps(1.0f / vcount);
+
+    const __m128 vdelta = _mm_sub_ps(vx, vmean);
+    vmean = _mm_add_ps(vmean, _mm_mul_ps(vdelta, vrcp_count));
+    vm2 = _mm_add_ps(vm2, _mm_mul_ps(vdelta, _mm_sub_ps(vx, vmean)));
+  }
+
+  // Merge the lanes of the accumulator.
+  vhalf_count = _mm_set1_ps(vcount * 0.5f);
+  const __m128 vdelta_hi = _mm_sub_ps(_mm_movehl_ps(vmean, vmean), vmean);
+  vmean = _mm_add_ps(vmean, _mm_mul_ps(vdelta_hi, vhalf));
+  vm2 = _mm_add_ps(_mm_add_ps(vm2, _mm_movehl_ps(vm2, vm2)), _mm_mul_ps(_mm_mul_ps(vdelta_hi, vdelta_hi), vhalf_count));
+  vcount += vcount;
+
+  vhalf_count = _mm_set_ss(vcount * 0.5f);
+  const __m128 vdelta_odd = _mm_sub_ss(_mm_shuffle_ps(vmean, vmean, _MM_SHUFFLE(1, 1, 1, 1)), vmean);
+  vmean = _mm_add_ss(vmean, _mm_mul_ss(vdelta_odd, vhalf));
+  vm2 = _mm_add_ss(_mm_add_ss(vm2, _mm_shuffle_ps(vm2, vm2, _MM_SHUFFLE(1, 1, 1, 1))), _mm_mul_ss(_mm_mul_ss(vdelta_odd, vdelta_odd), vhalf_count));
+  vcount += vcount;
+
+  float vmean_lo = _mm_cvtss_f32(vmean);
+  float vm2_lo = _mm_cvtss_f32(vm2);
+  if XNN_UNLIKELY(n != 0) {
+    do {
+      const float vx = *x++;
+      vcount += 1.0f;
+      const float vdelta = vx - vmean_lo;
+      vmean_lo += vdelta / vcount;
+      vm2_lo += vdelta * (vx - vmean_lo);
+      n -= sizeof(float);
+    } while (n != 0);
+  }
+  *mean = vmean_lo;
+  *variance = vm2_lo / vcount;
+}
+
 void xnn_f32_spmm_minmax_ukernel_32x1__sse(
     size_t mc,
     size_t nc,
@@ -6555,6 +7740,8 @@ void xnn_f32_spmm_minmax_ukernel_32x1__sse(
   assert(mc % sizeof(float) == 0);
   assert(nc != 0);
 
+  // printf("mc(%d), nc(%d), input(%f, %f, %f, %f), weights(%f, %f, %f, %f)\n", (int)mc, (int)nc, input[0], input[1], input[2], input[3], weights[0], weights[1], weights[2], weights[3]);
+
   const __m128 vmin = _mm_load_ps(params->sse.min);
   const __m128 vmax = _mm_load_ps(params->sse.max);
   size_t output_decrement = output_stride * nc - 32 * sizeof(float);
@@ -8074,6 +9261,76 @@ void xnn_f32_vmulcaddc_minmax_ukernel_c4__sse_2x(
   } while (rows != 0);
 }
 
+void xnn_f32_vnormcaddc_ukernel_c8__sse(
+    size_t channels,
+    const float* input,
+    const float* mean,
+    const float* inv_stddev,
+    const float* weights,
+    float* output,
+    const union xnn_f32_default_params params[restrict XNN_MIN_ELEMENTS(1)]) XNN_OOB_READS
+{
+  assert(channels != 0);
+  assert(channels % sizeof(float) == 0);
+
+  const __m128 vmean = _mm_load1_ps(mean);
+  const __m128 vinv_stddev = _mm_load1_ps(inv_stddev);
+  for (; channels >= 8 * sizeof(float); channels -= 8 * sizeof(float)) {
+    const __m128 vx0123 = _mm_loadu_ps(input);
+    const __m128 vx4567 = _mm_loadu_ps(input + 4);
+    input += 8;
+
+    const __m128 vscale0123 = _mm_load_ps(weights);
+    const __m128 vscale4567 = _mm_load_ps(weights + 4);
+    const __m128 vbias0123 = _mm_load_ps(weights + 8);
+    const __m128 vbias4567 = _mm_load_ps(weights + 12);
+    weights += 16;
+
+    const __m128 vnorm0123 = _mm_mul_ps(_mm_sub_ps(vx0123, vmean), vinv_stddev);
+    const __m128 vnorm4567 = _mm_mul_ps(_mm_sub_ps(vx4567, vmean), vinv_stddev);
+
+    const __m128 vy0123 = _mm_add_ps(_mm_mul_ps(vnorm0123, vscale0123), vbias0123);
+    const __m128 vy4567 = _mm_add_ps(_mm_mul_ps(vnorm4567, vscale4567), vbias4567);
+
+    _mm_storeu_ps(output, vy0123);
+    _mm_storeu_ps(output + 4, vy4567);
+    output += 8;
+  }
+  if (channels >= 4 * sizeof(float)) {
+    const __m128 vx0123 = _mm_loadu_ps(input);
+    input += 4;
+
+    const __m128 vscale0123 = _mm_load_ps(weights);
+    const __m128 vbias0123 = _mm_load_ps(weights + 8);
+    weights += 4;
+
+    const __m128 vnorm0123 = _mm_mul_ps(_mm_sub_ps(vx0123, vmean), vinv_stddev);
+    const __m128 vy0123 = _mm_add_ps(_mm_mul_ps(vnorm0123, vscale0123), vbias0123);
+
+    _mm_storeu_ps(output, vy0123);
+    output += 4;
+    channels -= 4 * sizeof(float);
+  }
+  if XNN_UNLIKELY(channels != 0) {
+    const __m128 vx0123 = _mm_loadu_ps(input);
+
+    const __m128 vscale0123 = _mm_load_ps(weights);
+    const __m128 vbias0123 = _mm_load_ps(weights + 8);
+
+    const __m128 vnorm0123 = _mm_mul_ps(_mm_sub_ps(vx0123, vmean), vinv_stddev);
+    __m128 vy0123 = _mm_add_ps(_mm_mul_ps(vnorm0123, vscale0123), vbias0123);
+
+    if (channels & (2 * sizeof(float))) {
+      _mm_storel_pi((__m64*) output, vy0123);
+      vy0123 = _mm_movehl_ps(vy0123, vy0123);
+      output += 2;
+    }
+    if (channels & (1 * sizeof(float))) {
+      _mm_store_ss(output, vy0123);
+    }
+  }
+}
+
 void xnn_f32_vsqrt_ukernel__sse_sqrt_x4(
     size_t n,
     const float* x,
@@ -8313,3 +9570,111 @@ void xnn_x32_packx_ukernel_4x__sse(
     } while (--k != 0);
   }
 }
+
+void xnn_x32_transpose_ukernel__4x4_sse(
+    const uint32_t* input,
+    uint32_t* output,
+    size_t input_stride,
+    size_t output_stride,
+    size_t block_width,
+    size_t block_height)
+{
+  assert(output_stride >= block_height * sizeof(uint32_t));
+  assert(input_stride >= block_width * sizeof(uint32_t));
+
+  const size_t tile_height = 4;
+  const size_t tile_width = 4;
+  const size_t tile_wbytes = tile_width * sizeof(float);
+  const size_t input_vreset = tile_wbytes - round_down_po2(block_height, tile_height) * input_stride;
+  const size_t output_vreset = tile_height * output_stride - round_down_po2(block_height, 2) * sizeof(uint32_t);
+  const size_t input_offset = tile_height * input_stride;
+
+  const float* i0 = (const float*) input;
+  const float* i1 = (const float*) ((uintptr_t) i0 + input_stride);
+  const float* i2 = (const float*) ((uintptr_t) i1 + input_stride);
+  const float* i3 = (const float*) ((uintptr_t) i2 + input_stride);
+
+  float* o0 = (float*) output;
+  float* o1 = (float*) ((uintptr_t) o0 + output_stride);
+  float* o2 = (float*) ((uintptr_t) o1 + output_stride);
+  float* o3 = (float*) ((uintptr_t) o2 + output_stride);
+
+  do {
+    if XNN_UNPREDICTABLE(block_width < 2) {
+      o1 = o0;
+    }
+    if XNN_UNPREDICTABLE(block_width <= 2) {
+      o2 = o0;
+    }
+    if XNN_UNPREDICTABLE(block_width < 4) {
+      o3 = o0;
+    }
+    size_t bh = block_height;
+    for (; bh >= 4; bh -= 4) {
+      __m128 v0 = _mm_loadu_ps(i0);
+      i0 = (const float*) ((uintptr_t) i0 + input_offset);
+      __m128 v1 = _mm_loadu_ps(i1);
+      i1 = (const float*) ((uintptr_t) i1 + input_offset);
+      __m128 v2 = _mm_loadu_ps(i2);
+      i2 = (const float*) ((uintptr_t) i2 + input_offset);
+      __m128 v3 = _mm_loadu_ps(i3);
+      i3 = (const float*) ((uintptr_t) i3 + input_offset);
+
+      _MM_TRANSPOSE4_PS(v0, v1, v2, v3);
+
+      _mm_storeu_ps(o3, v3);
+      o3 = (float*) ((uintptr_t) o3 + tile_wbytes);
+      _mm_storeu_ps(o2, v2);
+      o2 = (float*) ((uintptr_t) o2 + tile_wbytes);
+      _mm_storeu_ps(o1, v1);
+      o1 = (float*) ((uintptr_t) o1 + tile_wbytes);
+      _mm_storeu_ps(o0, v0);
+      o0 = (float*) ((uintptr_t) o0 + tile_wbytes);
+    }
+
+    if (bh != 0) {
+      if XNN_UNPREDICTABLE(bh <= 2) {
+        i2 = i0;
+      }
+      if XNN_UNPREDICTABLE(bh < 2) {
+        i1 = i0;
+      }
+      __m128 v0 = _mm_loadu_ps(i0);
+      __m128 v1 = _mm_loadu_ps(i1);
+      __m128 v2 = _mm_loadu_ps(i2);
+      __m128 v3 = _mm_setzero_ps();
+
+      _MM_TRANSPOSE4_PS(v0, v1, v2, v3);
+
+      if (bh & 2) {
+        _mm_storel_pi((__m64*) o3, v3);
+        o3 += 2;
+        _mm_storel_pi((__m64*) o2, v2);
+        o2 += 2;
+        _mm_storel_pi((__m64*) o1, v1);
+        o1 += 2;
+        _mm_storel_pi((__m64*) o0, v0);
+        o0 += 2;
+        v0 = _mm_movehl_ps(v0, v0);
+        v1 = _mm_movehl_ps(v1, v1);
+        v2 = _mm_movehl_ps(v2, v2);
+        v3 = _mm_movehl_ps(v3, v3);
+      }
+      if (bh & 1) {
+        _mm_store_ss(o3, v3);
+        _mm_store_ss(o2, v2);
+        _mm_store_ss(o1, v1);
+        _mm_store_ss(o0, v0);
+      }
+    }
+    i0 = (const float*) ((uintptr_t) i0 + input_vreset);
+    i1 = (const float*) ((uintptr_t) i0 + input_stride);
+    i2 = (const float*) ((uintptr_t) i1 + input_stride);
+    i3 = (const float*) ((uintptr_t) i2 + input_stride);
+    o0 = (float*) ((uintptr_t) o0 + output_vreset);
+    o1 = (float*) ((uintptr_t) o1 + output_vreset);
+    o2 = (float*) ((uintptr_t) o2 + output_vreset);
+    o3 = (float*) ((uintptr_t) o3 + output_vreset);
+    block_width = doz(block_width, tile_width);
+  } while (block_width != 0);
+}
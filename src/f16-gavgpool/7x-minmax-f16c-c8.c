@@ -0,0 +1,117 @@
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <immintrin.h>
+
+#include <xnnpack/gavgpool.h>
+
+
+void xnn_f16_gavgpool_minmax_ukernel_7x__f16c_c8(
+    size_t rows,
+    size_t channels,
+    const void* input,
+    size_t input_stride,
+    const void* zero,
+    void* output_ptr,
+    const union xnn_f16_scaleminmax_params params[restrict XNN_MIN_ELEMENTS(1)]) XNN_OOB_READS
+{
+  assert(rows != 0);
+  assert(rows <= 7);
+  assert(channels != 0);
+
+  uint16_t* output = (uint16_t*) output_ptr;
+  const uint16_t* i0 = (const uint16_t*) input;
+  const uint16_t* i1 = (const uint16_t*) ((uintptr_t) i0 + input_stride);
+  if (rows < 2) {
+    i1 = (const uint16_t*) zero;
+  }
+  const uint16_t* i2 = (const uint16_t*) ((uintptr_t) i1 + input_stride);
+  if (rows <= 2) {
+    i2 = (const uint16_t*) zero;
+  }
+  const uint16_t* i3 = (const uint16_t*) ((uintptr_t) i2 + input_stride);
+  if (rows < 4) {
+    i3 = (const uint16_t*) zero;
+  }
+  const uint16_t* i4 = (const uint16_t*) ((uintptr_t) i3 + input_stride);
+  if (rows <= 4) {
+    i4 = (const uint16_t*) zero;
+  }
+  const uint16_t* i5 = (const uint16_t*) ((uintptr_t) i4 + input_stride);
+  if (rows < 6) {
+    i5 = (const uint16_t*) zero;
+  }
+  const uint16_t* i6 = (const uint16_t*) ((uintptr_t) i5 + input_stride);
+  if (rows <= 6) {
+    i6 = (const uint16_t*) zero;
+  }
+  const __m256 vscale = _mm256_load_ps(params->avx.scale);
+  const __m256 vmin = _mm256_load_ps(params->avx.min);
+  const __m256 vmax = _mm256_load_ps(params->avx.max);
+
+  while (channels >= 8) {
+    const __m256 vi0 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i0)); i0 += 8;
+    const __m256 vi1 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i1)); i1 += 8;
+    const __m256 vi2 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i2)); i2 += 8;
+    const __m256 vi3 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i3)); i3 += 8;
+    const __m256 vi4 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i4)); i4 += 8;
+    const __m256 vi5 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i5)); i5 += 8;
+    const __m256 vi6 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i6)); i6 += 8;
+
+    const __m256 vsum01 = _mm256_add_ps(vi0, vi1);
+    const __m256 vsum23 = _mm256_add_ps(vi2, vi3);
+    const __m256 vsum45 = _mm256_add_ps(vi4, vi5);
+
+    const __m256 vsum016 = _mm256_add_ps(vsum01, vi6);
+    const __m256 vsum2345 = _mm256_add_ps(vsum23, vsum45);
+
+    const __m256 vsum = _mm256_add_ps(vsum016, vsum2345);
+
+    __m256 vout = _mm256_mul_ps(vsum, vscale);
+    vout = _mm256_max_ps(vout, vmin);
+    vout = _mm256_min_ps(vout, vmax);
+
+    _mm_storeu_si128((__m128i*) output, _mm256_cvtps_ph(vout, _MM_FROUND_NO_EXC)); output += 8;
+
+    channels -= 8;
+  }
+  if (channels != 0) {
+    const __m256 vi0 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i0));
+    const __m256 vi1 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i1));
+    const __m256 vi2 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i2));
+    const __m256 vi3 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i3));
+    const __m256 vi4 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i4));
+    const __m256 vi5 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i5));
+    const __m256 vi6 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i6));
+
+    const __m256 vsum01 = _mm256_add_ps(vi0, vi1);
+    const __m256 vsum23 = _mm256_add_ps(vi2, vi3);
+    const __m256 vsum45 = _mm256_add_ps(vi4, vi5);
+
+    const __m256 vsum016 = _mm256_add_ps(vsum01, vi6);
+    const __m256 vsum2345 = _mm256_add_ps(vsum23, vsum45);
+
+    const __m256 vsum = _mm256_add_ps(vsum016, vsum2345);
+
+    __m256 vout = _mm256_mul_ps(vsum, vscale);
+    vout = _mm256_max_ps(vout, vmin);
+    vout = _mm256_min_ps(vout, vmax);
+
+    __m128i vh = _mm256_cvtps_ph(vout, _MM_FROUND_NO_EXC);
+    if (channels & 4) {
+      _mm_storel_epi64((__m128i*) output, vh); output += 4;
+      vh = _mm_unpackhi_epi64(vh, vh);
+    }
+    if (channels & 2) {
+      *((uint32_t*) output) = (uint32_t) _mm_cvtsi128_si32(vh); output += 2;
+      vh = _mm_srli_epi64(vh, 32);
+    }
+    if (channels & 1) {
+      *output = (uint16_t) _mm_extract_epi16(vh, 0);
+    }
+  }
+}
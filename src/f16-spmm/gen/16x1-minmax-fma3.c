@@ -0,0 +1,188 @@
+// Auto-generated file. Do not edit!
+//   Template: src/f16-spmm/fma3.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <immintrin.h>
+
+#include <xnnpack/spmm.h>
+
+
+void xnn_f16_spmm_minmax_ukernel_16x1__fma3(
+    size_t mc,
+    size_t nc,
+    const void*restrict input,
+    const void*restrict weights,
+    const int32_t*restrict widx_dmap,
+    const uint32_t*restrict nidx_nnzmap,
+    void*restrict output,
+    size_t output_stride,
+    const union xnn_f16_scaleminmax_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(mc != 0);
+  assert(mc % sizeof(uint16_t) == 0);
+  assert(nc != 0);
+
+  const uint16_t*restrict i = (const uint16_t*) input;
+  uint16_t*restrict o = (uint16_t*) output;
+
+  // Products are accumulated in FP32, and rounded to FP16 only once, when the output is stored.
+  const __m256 vscale = _mm256_load_ps(params->avx.scale);
+  const __m256 vmin = _mm256_load_ps(params->avx.min);
+  const __m256 vmax = _mm256_load_ps(params->avx.max);
+
+  size_t output_decrement = output_stride * nc - 16 * sizeof(uint16_t);
+  while XNN_LIKELY(mc >= 16 * sizeof(uint16_t)) {
+    const uint16_t*restrict w = (const uint16_t*) weights;
+    const int32_t* dmap = widx_dmap;
+    const uint32_t* nnzmap = nidx_nnzmap;
+    size_t n = nc;
+    do {
+      uint32_t nnz = *nnzmap++;
+      __m256 vacc01234567 = _mm256_cvtph_ps(_mm_set1_epi16((short) *w)); w += 1;
+      __m256 vacc89ABCDEF = vacc01234567;
+      if XNN_LIKELY(nnz != 0) {
+        do {
+          const intptr_t diff = *dmap++;
+          const __m256 vi01234567 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i));
+          const __m256 vi89ABCDEF = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) (i + 8)));
+          i = (const uint16_t*restrict) ((uintptr_t) i + (uintptr_t) diff);
+          const __m256 vw = _mm256_cvtph_ps(_mm_set1_epi16((short) *w)); w += 1;
+          vacc01234567 = _mm256_fmadd_ps(vi01234567, vw, vacc01234567);
+          vacc89ABCDEF = _mm256_fmadd_ps(vi89ABCDEF, vw, vacc89ABCDEF);
+        } while (--nnz != 0);
+      }
+      __m256 vout01234567 = _mm256_mul_ps(vacc01234567, vscale);
+      __m256 vout89ABCDEF = _mm256_mul_ps(vacc89ABCDEF, vscale);
+      vout01234567 = _mm256_max_ps(vout01234567, vmin);
+      vout89ABCDEF = _mm256_max_ps(vout89ABCDEF, vmin);
+      vout01234567 = _mm256_min_ps(vout01234567, vmax);
+      vout89ABCDEF = _mm256_min_ps(vout89ABCDEF, vmax);
+      _mm_storeu_si128((__m128i*) o, _mm256_cvtps_ph(vout01234567, _MM_FROUND_NO_EXC));
+      _mm_storeu_si128((__m128i*) (o + 8), _mm256_cvtps_ph(vout89ABCDEF, _MM_FROUND_NO_EXC));
+      o = (uint16_t*restrict) ((uintptr_t) o + output_stride);
+    } while (--n != 0);
+    o = (uint16_t*restrict) ((uintptr_t) o - output_decrement);
+    i += 16;
+    mc -= 16 * sizeof(uint16_t);
+  }
+  if XNN_UNLIKELY(mc != 0) {
+    output_decrement += 8 * sizeof(uint16_t);
+    if (mc & (8 * sizeof(uint16_t))) {
+      const uint16_t*restrict w = (const uint16_t*) weights;
+      const int32_t* dmap = widx_dmap;
+      const uint32_t* nnzmap = nidx_nnzmap;
+      size_t n = nc;
+      do {
+        uint32_t nnz = *nnzmap++;
+        __m256 vacc01234567 = _mm256_cvtph_ps(_mm_set1_epi16((short) *w)); w += 1;
+        if XNN_LIKELY(nnz != 0) {
+          do {
+            const intptr_t diff = *dmap++;
+            const __m256 vi01234567 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i));
+            i = (const uint16_t*restrict) ((uintptr_t) i + (uintptr_t) diff);
+            const __m256 vw = _mm256_cvtph_ps(_mm_set1_epi16((short) *w)); w += 1;
+            vacc01234567 = _mm256_fmadd_ps(vi01234567, vw, vacc01234567);
+          } while (--nnz != 0);
+        }
+        __m256 vout01234567 = _mm256_mul_ps(vacc01234567, vscale);
+        vout01234567 = _mm256_max_ps(vout01234567, vmin);
+        vout01234567 = _mm256_min_ps(vout01234567, vmax);
+        _mm_storeu_si128((__m128i*) o, _mm256_cvtps_ph(vout01234567, _MM_FROUND_NO_EXC));
+        o = (uint16_t*restrict) ((uintptr_t) o + output_stride);
+      } while (--n != 0);
+      o = (uint16_t*restrict) ((uintptr_t) o - output_decrement);
+      i += 8;
+    }
+    output_decrement += 4 * sizeof(uint16_t);
+    if (mc & (4 * sizeof(uint16_t))) {
+      const uint16_t*restrict w = (const uint16_t*) weights;
+      const int32_t* dmap = widx_dmap;
+      const uint32_t* nnzmap = nidx_nnzmap;
+      size_t n = nc;
+      do {
+        uint32_t nnz = *nnzmap++;
+        __m128 vacc0123 = _mm_cvtph_ps(_mm_set1_epi16((short) *w)); w += 1;
+        if XNN_LIKELY(nnz != 0) {
+          do {
+            const intptr_t diff = *dmap++;
+            const __m128 vi0123 = _mm_cvtph_ps(_mm_loadl_epi64((const __m128i*) i));
+            i = (const uint16_t*restrict) ((uintptr_t) i + (uintptr_t) diff);
+            const __m128 vw = _mm_cvtph_ps(_mm_set1_epi16((short) *w)); w += 1;
+            vacc0123 = _mm_fmadd_ps(vi0123, vw, vacc0123);
+          } while (--nnz != 0);
+        }
+        __m128 vout0123 = _mm_mul_ps(vacc0123, _mm256_castps256_ps128(vscale));
+        vout0123 = _mm_max_ps(vout0123, _mm256_castps256_ps128(vmin));
+        vout0123 = _mm_min_ps(vout0123, _mm256_castps256_ps128(vmax));
+        const __m128i vh0123 = _mm_cvtps_ph(vout0123, _MM_FROUND_NO_EXC);
+        _mm_storel_epi64((__m128i*) o, vh0123);
+        o = (uint16_t*restrict) ((uintptr_t) o + output_stride);
+      } while (--n != 0);
+      o = (uint16_t*restrict) ((uintptr_t) o - output_decrement);
+      i += 4;
+    }
+    output_decrement += 2 * sizeof(uint16_t);
+    if (mc & (2 * sizeof(uint16_t))) {
+      const uint16_t*restrict w = (const uint16_t*) weights;
+      const int32_t* dmap = widx_dmap;
+      const uint32_t* nnzmap = nidx_nnzmap;
+      size_t n = nc;
+      do {
+        uint32_t nnz = *nnzmap++;
+        __m128 vacc01 = _mm_cvtph_ps(_mm_set1_epi16((short) *w)); w += 1;
+        if XNN_LIKELY(nnz != 0) {
+          do {
+            const intptr_t diff = *dmap++;
+            const __m128 vi01 = _mm_cvtph_ps(_mm_cvtsi32_si128(*((const int*) i)));
+            i = (const uint16_t*restrict) ((uintptr_t) i + (uintptr_t) diff);
+            const __m128 vw = _mm_cvtph_ps(_mm_set1_epi16((short) *w)); w += 1;
+            vacc01 = _mm_fmadd_ps(vi01, vw, vacc01);
+          } while (--nnz != 0);
+        }
+        __m128 vout01 = _mm_mul_ps(vacc01, _mm256_castps256_ps128(vscale));
+        vout01 = _mm_max_ps(vout01, _mm256_castps256_ps128(vmin));
+        vout01 = _mm_min_ps(vout01, _mm256_castps256_ps128(vmax));
+        const __m128i vh01 = _mm_cvtps_ph(vout01, _MM_FROUND_NO_EXC);
+        *((uint32_t*) o) = (uint32_t) _mm_cvtsi128_si32(vh01);
+        o = (uint16_t*restrict) ((uintptr_t) o + output_stride);
+      } while (--n != 0);
+      o = (uint16_t*restrict) ((uintptr_t) o - output_decrement);
+      i += 2;
+    }
+    output_decrement += 1 * sizeof(uint16_t);
+    if (mc & (1 * sizeof(uint16_t))) {
+      const uint16_t*restrict w = (const uint16_t*) weights;
+      const int32_t* dmap = widx_dmap;
+      const uint32_t* nnzmap = nidx_nnzmap;
+      size_t n = nc;
+      do {
+        uint32_t nnz = *nnzmap++;
+        __m128 vacc0 = _mm_cvtph_ps(_mm_set1_epi16((short) *w)); w += 1;
+        if XNN_LIKELY(nnz != 0) {
+          do {
+            const intptr_t diff = *dmap++;
+            const __m128 vi0 = _mm_cvtph_ps(_mm_cvtsi32_si128((int) (uint32_t) *i));
+            i = (const uint16_t*restrict) ((uintptr_t) i + (uintptr_t) diff);
+            const __m128 vw = _mm_cvtph_ps(_mm_set1_epi16((short) *w)); w += 1;
+            vacc0 = _mm_fmadd_ps(vi0, vw, vacc0);
+          } while (--nnz != 0);
+        }
+        __m128 vout0 = _mm_mul_ps(vacc0, _mm256_castps256_ps128(vscale));
+        vout0 = _mm_max_ps(vout0, _mm256_castps256_ps128(vmin));
+        vout0 = _mm_min_ps(vout0, _mm256_castps256_ps128(vmax));
+        const __m128i vh0 = _mm_cvtps_ph(vout0, _MM_FROUND_NO_EXC);
+        *o = (uint16_t) _mm_extract_epi16(vh0, 0);
+        o = (uint16_t*restrict) ((uintptr_t) o + output_stride);
+      } while (--n != 0);
+      o = (uint16_t*restrict) ((uintptr_t) o - output_decrement);
+      i += 1;
+    }
+  }
+}
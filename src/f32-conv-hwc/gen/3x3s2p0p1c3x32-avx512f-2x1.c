@@ -0,0 +1,531 @@
+// Auto-generated file. Do not edit!
+//   Template: src/f32-conv-hwc/3x3s2c3-avx512f.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <immintrin.h>
+
+#include <xnnpack/conv.h>
+#include <xnnpack/math.h>
+
+
+void xnn_f32_conv_hwc_ukernel_3x3s2p0p1c3x32__avx512f_2x1(
+    size_t input_height,
+    size_t input_width,
+    size_t output_y_start,
+    size_t output_y_end,
+    const float* input,
+    const float* zero,
+    const float* weights,
+    float* output,
+    size_t input_padding_top,
+    size_t output_channels,
+    size_t output_height_stride,
+    size_t output_width_stride,
+    const union xnn_f32_minmax_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(input_width > 1);
+  assert(output_y_end > output_y_start);
+  assert(input_padding_top <= 1);
+  assert(output_channels != 0);
+
+  const size_t input_height_stride = input_width * 3 /* channels */ * sizeof(float);
+  const size_t input_width_decrement = round_down_po2(input_width - 1, 2) * 3 /* channels */ * sizeof(float);
+  const size_t output_width = input_width / 2;
+  const size_t output_channel_decrement = output_width * output_width_stride - 32 * sizeof(float);
+  const size_t output_height_increment = output_height_stride * 2 - round_up_po2(output_channels, 32) * sizeof(float);
+
+  // Adjustment for padding processed below
+  const float* i0 = (const float*) ((uintptr_t) input +
+    input_height_stride * (output_y_start * 2 /* vertical stride */ - input_padding_top));
+  const float* i1 = (const float*) ((uintptr_t) i0 + input_height_stride);
+  const float* i2 = (const float*) ((uintptr_t) i1 + input_height_stride);
+  const float* i3 = (const float*) ((uintptr_t) i2 + input_height_stride);
+  const float* i4 = (const float*) ((uintptr_t) i3 + input_height_stride);
+  float* o0 = (float*) ((uintptr_t) output + output_height_stride * output_y_start);
+  float* o1 = (float*) ((uintptr_t) o0 + output_height_stride);
+
+  if XNN_UNPREDICTABLE(output_y_start < input_padding_top) {
+    i0 = zero;
+  }
+
+  const __m512 vmin = _mm512_set1_ps(params->scalar.min);
+  const __m512 vmax = _mm512_set1_ps(params->scalar.max);
+
+  for (size_t output_y = output_y_start; output_y < output_y_end; output_y += 2) {
+    const size_t input_y2 = output_y * 2 + 2 - input_padding_top;
+    const size_t input_y4 = input_y2 + 2;
+    if XNN_UNPREDICTABLE(input_y2 > input_height) {
+      i1 = zero;
+    }
+    if XNN_UNPREDICTABLE(input_y2 >= input_height) {
+      i2 = zero;
+    }
+    if XNN_UNPREDICTABLE(input_y4 > input_height) {
+      i3 = zero;
+    }
+    if XNN_UNPREDICTABLE(input_y4 >= input_height) {
+      i4 = zero;
+    }
+    if XNN_UNPREDICTABLE(output_y + 2 > output_y_end) {
+      o1 = o0;
+    }
+
+    const float* w = weights;
+    size_t c = output_channels;
+    do {
+      // voMx0 accumulates the leftmost output pixel of the next block. The input column to the left of it
+      // is either padding, or was already accumulated at the end of the previous block.
+      __m512 vo0x0c0123456789ABCDEF = _mm512_load_ps(w + 0);
+      __m512 vo0x0cGHIJKLMNOPQRSTUV = _mm512_load_ps(w + 16);
+      __m512 vo1x0c0123456789ABCDEF = vo0x0c0123456789ABCDEF;
+      __m512 vo1x0cGHIJKLMNOPQRSTUV = vo0x0cGHIJKLMNOPQRSTUV;
+
+      // No padding on the left: the first input column contributes only through the left column of the kernel.
+      const __m512 vi0c0 = _mm512_set1_ps(i0[0]);
+      vo0x0c0123456789ABCDEF = _mm512_fmadd_ps(_mm512_load_ps(w + 32), vi0c0, vo0x0c0123456789ABCDEF);
+      vo0x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(_mm512_load_ps(w + 48), vi0c0, vo0x0cGHIJKLMNOPQRSTUV);
+      const __m512 vi1c0 = _mm512_set1_ps(i1[0]);
+      vo0x0c0123456789ABCDEF = _mm512_fmadd_ps(_mm512_load_ps(w + 64), vi1c0, vo0x0c0123456789ABCDEF);
+      vo0x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(_mm512_load_ps(w + 80), vi1c0, vo0x0cGHIJKLMNOPQRSTUV);
+      const __m512 vi2c0 = _mm512_set1_ps(i2[0]);
+      vo0x0c0123456789ABCDEF = _mm512_fmadd_ps(_mm512_load_ps(w + 96), vi2c0, vo0x0c0123456789ABCDEF);
+      vo0x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(_mm512_load_ps(w + 112), vi2c0, vo0x0cGHIJKLMNOPQRSTUV);
+      vo1x0c0123456789ABCDEF = _mm512_fmadd_ps(_mm512_load_ps(w + 32), vi2c0, vo1x0c0123456789ABCDEF);
+      vo1x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(_mm512_load_ps(w + 48), vi2c0, vo1x0cGHIJKLMNOPQRSTUV);
+      const __m512 vi3c0 = _mm512_set1_ps(i3[0]);
+      vo1x0c0123456789ABCDEF = _mm512_fmadd_ps(_mm512_load_ps(w + 64), vi3c0, vo1x0c0123456789ABCDEF);
+      vo1x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(_mm512_load_ps(w + 80), vi3c0, vo1x0cGHIJKLMNOPQRSTUV);
+      const __m512 vi4c0 = _mm512_set1_ps(i4[0]);
+      vo1x0c0123456789ABCDEF = _mm512_fmadd_ps(_mm512_load_ps(w + 96), vi4c0, vo1x0c0123456789ABCDEF);
+      vo1x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(_mm512_load_ps(w + 112), vi4c0, vo1x0cGHIJKLMNOPQRSTUV);
+      const __m512 vi0c1 = _mm512_set1_ps(i0[1]);
+      vo0x0c0123456789ABCDEF = _mm512_fmadd_ps(_mm512_load_ps(w + 128), vi0c1, vo0x0c0123456789ABCDEF);
+      vo0x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(_mm512_load_ps(w + 144), vi0c1, vo0x0cGHIJKLMNOPQRSTUV);
+      const __m512 vi1c1 = _mm512_set1_ps(i1[1]);
+      vo0x0c0123456789ABCDEF = _mm512_fmadd_ps(_mm512_load_ps(w + 160), vi1c1, vo0x0c0123456789ABCDEF);
+      vo0x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(_mm512_load_ps(w + 176), vi1c1, vo0x0cGHIJKLMNOPQRSTUV);
+      const __m512 vi2c1 = _mm512_set1_ps(i2[1]);
+      vo0x0c0123456789ABCDEF = _mm512_fmadd_ps(_mm512_load_ps(w + 192), vi2c1, vo0x0c0123456789ABCDEF);
+      vo0x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(_mm512_load_ps(w + 208), vi2c1, vo0x0cGHIJKLMNOPQRSTUV);
+      vo1x0c0123456789ABCDEF = _mm512_fmadd_ps(_mm512_load_ps(w + 128), vi2c1, vo1x0c0123456789ABCDEF);
+      vo1x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(_mm512_load_ps(w + 144), vi2c1, vo1x0cGHIJKLMNOPQRSTUV);
+      const __m512 vi3c1 = _mm512_set1_ps(i3[1]);
+      vo1x0c0123456789ABCDEF = _mm512_fmadd_ps(_mm512_load_ps(w + 160), vi3c1, vo1x0c0123456789ABCDEF);
+      vo1x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(_mm512_load_ps(w + 176), vi3c1, vo1x0cGHIJKLMNOPQRSTUV);
+      const __m512 vi4c1 = _mm512_set1_ps(i4[1]);
+      vo1x0c0123456789ABCDEF = _mm512_fmadd_ps(_mm512_load_ps(w + 192), vi4c1, vo1x0c0123456789ABCDEF);
+      vo1x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(_mm512_load_ps(w + 208), vi4c1, vo1x0cGHIJKLMNOPQRSTUV);
+      const __m512 vi0c2 = _mm512_set1_ps(i0[2]);
+      vo0x0c0123456789ABCDEF = _mm512_fmadd_ps(_mm512_load_ps(w + 224), vi0c2, vo0x0c0123456789ABCDEF);
+      vo0x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(_mm512_load_ps(w + 240), vi0c2, vo0x0cGHIJKLMNOPQRSTUV);
+      const __m512 vi1c2 = _mm512_set1_ps(i1[2]);
+      vo0x0c0123456789ABCDEF = _mm512_fmadd_ps(_mm512_load_ps(w + 256), vi1c2, vo0x0c0123456789ABCDEF);
+      vo0x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(_mm512_load_ps(w + 272), vi1c2, vo0x0cGHIJKLMNOPQRSTUV);
+      const __m512 vi2c2 = _mm512_set1_ps(i2[2]);
+      vo0x0c0123456789ABCDEF = _mm512_fmadd_ps(_mm512_load_ps(w + 288), vi2c2, vo0x0c0123456789ABCDEF);
+      vo0x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(_mm512_load_ps(w + 304), vi2c2, vo0x0cGHIJKLMNOPQRSTUV);
+      vo1x0c0123456789ABCDEF = _mm512_fmadd_ps(_mm512_load_ps(w + 224), vi2c2, vo1x0c0123456789ABCDEF);
+      vo1x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(_mm512_load_ps(w + 240), vi2c2, vo1x0cGHIJKLMNOPQRSTUV);
+      const __m512 vi3c2 = _mm512_set1_ps(i3[2]);
+      vo1x0c0123456789ABCDEF = _mm512_fmadd_ps(_mm512_load_ps(w + 256), vi3c2, vo1x0c0123456789ABCDEF);
+      vo1x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(_mm512_load_ps(w + 272), vi3c2, vo1x0cGHIJKLMNOPQRSTUV);
+      const __m512 vi4c2 = _mm512_set1_ps(i4[2]);
+      vo1x0c0123456789ABCDEF = _mm512_fmadd_ps(_mm512_load_ps(w + 288), vi4c2, vo1x0c0123456789ABCDEF);
+      vo1x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(_mm512_load_ps(w + 304), vi4c2, vo1x0cGHIJKLMNOPQRSTUV);
+
+      size_t iw = input_width - 1;
+      for (; iw >= 2; iw -= 2) {
+        __m512 vo0x1c0123456789ABCDEF = _mm512_load_ps(w + 0);
+        __m512 vo0x1cGHIJKLMNOPQRSTUV = _mm512_load_ps(w + 16);
+        __m512 vo1x1c0123456789ABCDEF = vo0x1c0123456789ABCDEF;
+        __m512 vo1x1cGHIJKLMNOPQRSTUV = vo0x1cGHIJKLMNOPQRSTUV;
+
+        const __m512 vk01c0x0123456789ABCDEF = _mm512_load_ps(w + 320);
+        const __m512 vk01c0xGHIJKLMNOPQRSTUV = _mm512_load_ps(w + 336);
+        const __m512 vk11c0x0123456789ABCDEF = _mm512_load_ps(w + 352);
+        const __m512 vk11c0xGHIJKLMNOPQRSTUV = _mm512_load_ps(w + 368);
+        const __m512 vk21c0x0123456789ABCDEF = _mm512_load_ps(w + 384);
+        const __m512 vk21c0xGHIJKLMNOPQRSTUV = _mm512_load_ps(w + 400);
+
+        const __m512 vi0x0c0 = _mm512_set1_ps(i0[3]);
+        vo0x0c0123456789ABCDEF = _mm512_fmadd_ps(vk01c0x0123456789ABCDEF, vi0x0c0, vo0x0c0123456789ABCDEF);
+        vo0x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk01c0xGHIJKLMNOPQRSTUV, vi0x0c0, vo0x0cGHIJKLMNOPQRSTUV);
+        const __m512 vi1x0c0 = _mm512_set1_ps(i1[3]);
+        vo0x0c0123456789ABCDEF = _mm512_fmadd_ps(vk11c0x0123456789ABCDEF, vi1x0c0, vo0x0c0123456789ABCDEF);
+        vo0x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk11c0xGHIJKLMNOPQRSTUV, vi1x0c0, vo0x0cGHIJKLMNOPQRSTUV);
+        const __m512 vi2x0c0 = _mm512_set1_ps(i2[3]);
+        vo0x0c0123456789ABCDEF = _mm512_fmadd_ps(vk21c0x0123456789ABCDEF, vi2x0c0, vo0x0c0123456789ABCDEF);
+        vo0x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk21c0xGHIJKLMNOPQRSTUV, vi2x0c0, vo0x0cGHIJKLMNOPQRSTUV);
+        vo1x0c0123456789ABCDEF = _mm512_fmadd_ps(vk01c0x0123456789ABCDEF, vi2x0c0, vo1x0c0123456789ABCDEF);
+        vo1x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk01c0xGHIJKLMNOPQRSTUV, vi2x0c0, vo1x0cGHIJKLMNOPQRSTUV);
+        const __m512 vi3x0c0 = _mm512_set1_ps(i3[3]);
+        vo1x0c0123456789ABCDEF = _mm512_fmadd_ps(vk11c0x0123456789ABCDEF, vi3x0c0, vo1x0c0123456789ABCDEF);
+        vo1x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk11c0xGHIJKLMNOPQRSTUV, vi3x0c0, vo1x0cGHIJKLMNOPQRSTUV);
+        const __m512 vi4x0c0 = _mm512_set1_ps(i4[3]);
+        vo1x0c0123456789ABCDEF = _mm512_fmadd_ps(vk21c0x0123456789ABCDEF, vi4x0c0, vo1x0c0123456789ABCDEF);
+        vo1x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk21c0xGHIJKLMNOPQRSTUV, vi4x0c0, vo1x0cGHIJKLMNOPQRSTUV);
+
+        const __m512 vk02c0x0123456789ABCDEF = _mm512_load_ps(w + 608);
+        const __m512 vk02c0xGHIJKLMNOPQRSTUV = _mm512_load_ps(w + 624);
+        const __m512 vk12c0x0123456789ABCDEF = _mm512_load_ps(w + 640);
+        const __m512 vk12c0xGHIJKLMNOPQRSTUV = _mm512_load_ps(w + 656);
+        const __m512 vk22c0x0123456789ABCDEF = _mm512_load_ps(w + 672);
+        const __m512 vk22c0xGHIJKLMNOPQRSTUV = _mm512_load_ps(w + 688);
+        const __m512 vk00c0x0123456789ABCDEF = _mm512_load_ps(w + 32);
+        const __m512 vk00c0xGHIJKLMNOPQRSTUV = _mm512_load_ps(w + 48);
+        const __m512 vk10c0x0123456789ABCDEF = _mm512_load_ps(w + 64);
+        const __m512 vk10c0xGHIJKLMNOPQRSTUV = _mm512_load_ps(w + 80);
+        const __m512 vk20c0x0123456789ABCDEF = _mm512_load_ps(w + 96);
+        const __m512 vk20c0xGHIJKLMNOPQRSTUV = _mm512_load_ps(w + 112);
+
+        const __m512 vi0x1c0 = _mm512_set1_ps(i0[6]);
+        vo0x0c0123456789ABCDEF = _mm512_fmadd_ps(vk02c0x0123456789ABCDEF, vi0x1c0, vo0x0c0123456789ABCDEF);
+        vo0x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk02c0xGHIJKLMNOPQRSTUV, vi0x1c0, vo0x0cGHIJKLMNOPQRSTUV);
+        vo0x1c0123456789ABCDEF = _mm512_fmadd_ps(vk00c0x0123456789ABCDEF, vi0x1c0, vo0x1c0123456789ABCDEF);
+        vo0x1cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk00c0xGHIJKLMNOPQRSTUV, vi0x1c0, vo0x1cGHIJKLMNOPQRSTUV);
+        const __m512 vi1x1c0 = _mm512_set1_ps(i1[6]);
+        vo0x0c0123456789ABCDEF = _mm512_fmadd_ps(vk12c0x0123456789ABCDEF, vi1x1c0, vo0x0c0123456789ABCDEF);
+        vo0x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk12c0xGHIJKLMNOPQRSTUV, vi1x1c0, vo0x0cGHIJKLMNOPQRSTUV);
+        vo0x1c0123456789ABCDEF = _mm512_fmadd_ps(vk10c0x0123456789ABCDEF, vi1x1c0, vo0x1c0123456789ABCDEF);
+        vo0x1cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk10c0xGHIJKLMNOPQRSTUV, vi1x1c0, vo0x1cGHIJKLMNOPQRSTUV);
+        const __m512 vi2x1c0 = _mm512_set1_ps(i2[6]);
+        vo0x0c0123456789ABCDEF = _mm512_fmadd_ps(vk22c0x0123456789ABCDEF, vi2x1c0, vo0x0c0123456789ABCDEF);
+        vo0x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk22c0xGHIJKLMNOPQRSTUV, vi2x1c0, vo0x0cGHIJKLMNOPQRSTUV);
+        vo0x1c0123456789ABCDEF = _mm512_fmadd_ps(vk20c0x0123456789ABCDEF, vi2x1c0, vo0x1c0123456789ABCDEF);
+        vo0x1cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk20c0xGHIJKLMNOPQRSTUV, vi2x1c0, vo0x1cGHIJKLMNOPQRSTUV);
+        vo1x0c0123456789ABCDEF = _mm512_fmadd_ps(vk02c0x0123456789ABCDEF, vi2x1c0, vo1x0c0123456789ABCDEF);
+        vo1x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk02c0xGHIJKLMNOPQRSTUV, vi2x1c0, vo1x0cGHIJKLMNOPQRSTUV);
+        vo1x1c0123456789ABCDEF = _mm512_fmadd_ps(vk00c0x0123456789ABCDEF, vi2x1c0, vo1x1c0123456789ABCDEF);
+        vo1x1cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk00c0xGHIJKLMNOPQRSTUV, vi2x1c0, vo1x1cGHIJKLMNOPQRSTUV);
+        const __m512 vi3x1c0 = _mm512_set1_ps(i3[6]);
+        vo1x0c0123456789ABCDEF = _mm512_fmadd_ps(vk12c0x0123456789ABCDEF, vi3x1c0, vo1x0c0123456789ABCDEF);
+        vo1x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk12c0xGHIJKLMNOPQRSTUV, vi3x1c0, vo1x0cGHIJKLMNOPQRSTUV);
+        vo1x1c0123456789ABCDEF = _mm512_fmadd_ps(vk10c0x0123456789ABCDEF, vi3x1c0, vo1x1c0123456789ABCDEF);
+        vo1x1cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk10c0xGHIJKLMNOPQRSTUV, vi3x1c0, vo1x1cGHIJKLMNOPQRSTUV);
+        const __m512 vi4x1c0 = _mm512_set1_ps(i4[6]);
+        vo1x0c0123456789ABCDEF = _mm512_fmadd_ps(vk22c0x0123456789ABCDEF, vi4x1c0, vo1x0c0123456789ABCDEF);
+        vo1x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk22c0xGHIJKLMNOPQRSTUV, vi4x1c0, vo1x0cGHIJKLMNOPQRSTUV);
+        vo1x1c0123456789ABCDEF = _mm512_fmadd_ps(vk20c0x0123456789ABCDEF, vi4x1c0, vo1x1c0123456789ABCDEF);
+        vo1x1cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk20c0xGHIJKLMNOPQRSTUV, vi4x1c0, vo1x1cGHIJKLMNOPQRSTUV);
+        const __m512 vk01c1x0123456789ABCDEF = _mm512_load_ps(w + 416);
+        const __m512 vk01c1xGHIJKLMNOPQRSTUV = _mm512_load_ps(w + 432);
+        const __m512 vk11c1x0123456789ABCDEF = _mm512_load_ps(w + 448);
+        const __m512 vk11c1xGHIJKLMNOPQRSTUV = _mm512_load_ps(w + 464);
+        const __m512 vk21c1x0123456789ABCDEF = _mm512_load_ps(w + 480);
+        const __m512 vk21c1xGHIJKLMNOPQRSTUV = _mm512_load_ps(w + 496);
+
+        const __m512 vi0x0c1 = _mm512_set1_ps(i0[4]);
+        vo0x0c0123456789ABCDEF = _mm512_fmadd_ps(vk01c1x0123456789ABCDEF, vi0x0c1, vo0x0c0123456789ABCDEF);
+        vo0x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk01c1xGHIJKLMNOPQRSTUV, vi0x0c1, vo0x0cGHIJKLMNOPQRSTUV);
+        const __m512 vi1x0c1 = _mm512_set1_ps(i1[4]);
+        vo0x0c0123456789ABCDEF = _mm512_fmadd_ps(vk11c1x0123456789ABCDEF, vi1x0c1, vo0x0c0123456789ABCDEF);
+        vo0x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk11c1xGHIJKLMNOPQRSTUV, vi1x0c1, vo0x0cGHIJKLMNOPQRSTUV);
+        const __m512 vi2x0c1 = _mm512_set1_ps(i2[4]);
+        vo0x0c0123456789ABCDEF = _mm512_fmadd_ps(vk21c1x0123456789ABCDEF, vi2x0c1, vo0x0c0123456789ABCDEF);
+        vo0x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk21c1xGHIJKLMNOPQRSTUV, vi2x0c1, vo0x0cGHIJKLMNOPQRSTUV);
+        vo1x0c0123456789ABCDEF = _mm512_fmadd_ps(vk01c1x0123456789ABCDEF, vi2x0c1, vo1x0c0123456789ABCDEF);
+        vo1x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk01c1xGHIJKLMNOPQRSTUV, vi2x0c1, vo1x0cGHIJKLMNOPQRSTUV);
+        const __m512 vi3x0c1 = _mm512_set1_ps(i3[4]);
+        vo1x0c0123456789ABCDEF = _mm512_fmadd_ps(vk11c1x0123456789ABCDEF, vi3x0c1, vo1x0c0123456789ABCDEF);
+        vo1x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk11c1xGHIJKLMNOPQRSTUV, vi3x0c1, vo1x0cGHIJKLMNOPQRSTUV);
+        const __m512 vi4x0c1 = _mm512_set1_ps(i4[4]);
+        vo1x0c0123456789ABCDEF = _mm512_fmadd_ps(vk21c1x0123456789ABCDEF, vi4x0c1, vo1x0c0123456789ABCDEF);
+        vo1x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk21c1xGHIJKLMNOPQRSTUV, vi4x0c1, vo1x0cGHIJKLMNOPQRSTUV);
+
+        const __m512 vk02c1x0123456789ABCDEF = _mm512_load_ps(w + 704);
+        const __m512 vk02c1xGHIJKLMNOPQRSTUV = _mm512_load_ps(w + 720);
+        const __m512 vk12c1x0123456789ABCDEF = _mm512_load_ps(w + 736);
+        const __m512 vk12c1xGHIJKLMNOPQRSTUV = _mm512_load_ps(w + 752);
+        const __m512 vk22c1x0123456789ABCDEF = _mm512_load_ps(w + 768);
+        const __m512 vk22c1xGHIJKLMNOPQRSTUV = _mm512_load_ps(w + 784);
+        const __m512 vk00c1x0123456789ABCDEF = _mm512_load_ps(w + 128);
+        const __m512 vk00c1xGHIJKLMNOPQRSTUV = _mm512_load_ps(w + 144);
+        const __m512 vk10c1x0123456789ABCDEF = _mm512_load_ps(w + 160);
+        const __m512 vk10c1xGHIJKLMNOPQRSTUV = _mm512_load_ps(w + 176);
+        const __m512 vk20c1x0123456789ABCDEF = _mm512_load_ps(w + 192);
+        const __m512 vk20c1xGHIJKLMNOPQRSTUV = _mm512_load_ps(w + 208);
+
+        const __m512 vi0x1c1 = _mm512_set1_ps(i0[7]);
+        vo0x0c0123456789ABCDEF = _mm512_fmadd_ps(vk02c1x0123456789ABCDEF, vi0x1c1, vo0x0c0123456789ABCDEF);
+        vo0x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk02c1xGHIJKLMNOPQRSTUV, vi0x1c1, vo0x0cGHIJKLMNOPQRSTUV);
+        vo0x1c0123456789ABCDEF = _mm512_fmadd_ps(vk00c1x0123456789ABCDEF, vi0x1c1, vo0x1c0123456789ABCDEF);
+        vo0x1cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk00c1xGHIJKLMNOPQRSTUV, vi0x1c1, vo0x1cGHIJKLMNOPQRSTUV);
+        const __m512 vi1x1c1 = _mm512_set1_ps(i1[7]);
+        vo0x0c0123456789ABCDEF = _mm512_fmadd_ps(vk12c1x0123456789ABCDEF, vi1x1c1, vo0x0c0123456789ABCDEF);
+        vo0x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk12c1xGHIJKLMNOPQRSTUV, vi1x1c1, vo0x0cGHIJKLMNOPQRSTUV);
+        vo0x1c0123456789ABCDEF = _mm512_fmadd_ps(vk10c1x0123456789ABCDEF, vi1x1c1, vo0x1c0123456789ABCDEF);
+        vo0x1cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk10c1xGHIJKLMNOPQRSTUV, vi1x1c1, vo0x1cGHIJKLMNOPQRSTUV);
+        const __m512 vi2x1c1 = _mm512_set1_ps(i2[7]);
+        vo0x0c0123456789ABCDEF = _mm512_fmadd_ps(vk22c1x0123456789ABCDEF, vi2x1c1, vo0x0c0123456789ABCDEF);
+        vo0x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk22c1xGHIJKLMNOPQRSTUV, vi2x1c1, vo0x0cGHIJKLMNOPQRSTUV);
+        vo0x1c0123456789ABCDEF = _mm512_fmadd_ps(vk20c1x0123456789ABCDEF, vi2x1c1, vo0x1c0123456789ABCDEF);
+        vo0x1cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk20c1xGHIJKLMNOPQRSTUV, vi2x1c1, vo0x1cGHIJKLMNOPQRSTUV);
+        vo1x0c0123456789ABCDEF = _mm512_fmadd_ps(vk02c1x0123456789ABCDEF, vi2x1c1, vo1x0c0123456789ABCDEF);
+        vo1x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk02c1xGHIJKLMNOPQRSTUV, vi2x1c1, vo1x0cGHIJKLMNOPQRSTUV);
+        vo1x1c0123456789ABCDEF = _mm512_fmadd_ps(vk00c1x0123456789ABCDEF, vi2x1c1, vo1x1c0123456789ABCDEF);
+        vo1x1cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk00c1xGHIJKLMNOPQRSTUV, vi2x1c1, vo1x1cGHIJKLMNOPQRSTUV);
+        const __m512 vi3x1c1 = _mm512_set1_ps(i3[7]);
+        vo1x0c0123456789ABCDEF = _mm512_fmadd_ps(vk12c1x0123456789ABCDEF, vi3x1c1, vo1x0c0123456789ABCDEF);
+        vo1x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk12c1xGHIJKLMNOPQRSTUV, vi3x1c1, vo1x0cGHIJKLMNOPQRSTUV);
+        vo1x1c0123456789ABCDEF = _mm512_fmadd_ps(vk10c1x0123456789ABCDEF, vi3x1c1, vo1x1c0123456789ABCDEF);
+        vo1x1cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk10c1xGHIJKLMNOPQRSTUV, vi3x1c1, vo1x1cGHIJKLMNOPQRSTUV);
+        const __m512 vi4x1c1 = _mm512_set1_ps(i4[7]);
+        vo1x0c0123456789ABCDEF = _mm512_fmadd_ps(vk22c1x0123456789ABCDEF, vi4x1c1, vo1x0c0123456789ABCDEF);
+        vo1x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk22c1xGHIJKLMNOPQRSTUV, vi4x1c1, vo1x0cGHIJKLMNOPQRSTUV);
+        vo1x1c0123456789ABCDEF = _mm512_fmadd_ps(vk20c1x0123456789ABCDEF, vi4x1c1, vo1x1c0123456789ABCDEF);
+        vo1x1cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk20c1xGHIJKLMNOPQRSTUV, vi4x1c1, vo1x1cGHIJKLMNOPQRSTUV);
+        const __m512 vk01c2x0123456789ABCDEF = _mm512_load_ps(w + 512);
+        const __m512 vk01c2xGHIJKLMNOPQRSTUV = _mm512_load_ps(w + 528);
+        const __m512 vk11c2x0123456789ABCDEF = _mm512_load_ps(w + 544);
+        const __m512 vk11c2xGHIJKLMNOPQRSTUV = _mm512_load_ps(w + 560);
+        const __m512 vk21c2x0123456789ABCDEF = _mm512_load_ps(w + 576);
+        const __m512 vk21c2xGHIJKLMNOPQRSTUV = _mm512_load_ps(w + 592);
+
+        const __m512 vi0x0c2 = _mm512_set1_ps(i0[5]);
+        vo0x0c0123456789ABCDEF = _mm512_fmadd_ps(vk01c2x0123456789ABCDEF, vi0x0c2, vo0x0c0123456789ABCDEF);
+        vo0x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk01c2xGHIJKLMNOPQRSTUV, vi0x0c2, vo0x0cGHIJKLMNOPQRSTUV);
+        const __m512 vi1x0c2 = _mm512_set1_ps(i1[5]);
+        vo0x0c0123456789ABCDEF = _mm512_fmadd_ps(vk11c2x0123456789ABCDEF, vi1x0c2, vo0x0c0123456789ABCDEF);
+        vo0x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk11c2xGHIJKLMNOPQRSTUV, vi1x0c2, vo0x0cGHIJKLMNOPQRSTUV);
+        const __m512 vi2x0c2 = _mm512_set1_ps(i2[5]);
+        vo0x0c0123456789ABCDEF = _mm512_fmadd_ps(vk21c2x0123456789ABCDEF, vi2x0c2, vo0x0c0123456789ABCDEF);
+        vo0x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk21c2xGHIJKLMNOPQRSTUV, vi2x0c2, vo0x0cGHIJKLMNOPQRSTUV);
+        vo1x0c0123456789ABCDEF = _mm512_fmadd_ps(vk01c2x0123456789ABCDEF, vi2x0c2, vo1x0c0123456789ABCDEF);
+        vo1x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk01c2xGHIJKLMNOPQRSTUV, vi2x0c2, vo1x0cGHIJKLMNOPQRSTUV);
+        const __m512 vi3x0c2 = _mm512_set1_ps(i3[5]);
+        vo1x0c0123456789ABCDEF = _mm512_fmadd_ps(vk11c2x0123456789ABCDEF, vi3x0c2, vo1x0c0123456789ABCDEF);
+        vo1x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk11c2xGHIJKLMNOPQRSTUV, vi3x0c2, vo1x0cGHIJKLMNOPQRSTUV);
+        const __m512 vi4x0c2 = _mm512_set1_ps(i4[5]);
+        vo1x0c0123456789ABCDEF = _mm512_fmadd_ps(vk21c2x0123456789ABCDEF, vi4x0c2, vo1x0c0123456789ABCDEF);
+        vo1x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk21c2xGHIJKLMNOPQRSTUV, vi4x0c2, vo1x0cGHIJKLMNOPQRSTUV);
+
+        const __m512 vk02c2x0123456789ABCDEF = _mm512_load_ps(w + 800);
+        const __m512 vk02c2xGHIJKLMNOPQRSTUV = _mm512_load_ps(w + 816);
+        const __m512 vk12c2x0123456789ABCDEF = _mm512_load_ps(w + 832);
+        const __m512 vk12c2xGHIJKLMNOPQRSTUV = _mm512_load_ps(w + 848);
+        const __m512 vk22c2x0123456789ABCDEF = _mm512_load_ps(w + 864);
+        const __m512 vk22c2xGHIJKLMNOPQRSTUV = _mm512_load_ps(w + 880);
+        const __m512 vk00c2x0123456789ABCDEF = _mm512_load_ps(w + 224);
+        const __m512 vk00c2xGHIJKLMNOPQRSTUV = _mm512_load_ps(w + 240);
+        const __m512 vk10c2x0123456789ABCDEF = _mm512_load_ps(w + 256);
+        const __m512 vk10c2xGHIJKLMNOPQRSTUV = _mm512_load_ps(w + 272);
+        const __m512 vk20c2x0123456789ABCDEF = _mm512_load_ps(w + 288);
+        const __m512 vk20c2xGHIJKLMNOPQRSTUV = _mm512_load_ps(w + 304);
+
+        const __m512 vi0x1c2 = _mm512_set1_ps(i0[8]);
+        vo0x0c0123456789ABCDEF = _mm512_fmadd_ps(vk02c2x0123456789ABCDEF, vi0x1c2, vo0x0c0123456789ABCDEF);
+        vo0x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk02c2xGHIJKLMNOPQRSTUV, vi0x1c2, vo0x0cGHIJKLMNOPQRSTUV);
+        vo0x1c0123456789ABCDEF = _mm512_fmadd_ps(vk00c2x0123456789ABCDEF, vi0x1c2, vo0x1c0123456789ABCDEF);
+        vo0x1cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk00c2xGHIJKLMNOPQRSTUV, vi0x1c2, vo0x1cGHIJKLMNOPQRSTUV);
+        const __m512 vi1x1c2 = _mm512_set1_ps(i1[8]);
+        vo0x0c0123456789ABCDEF = _mm512_fmadd_ps(vk12c2x0123456789ABCDEF, vi1x1c2, vo0x0c0123456789ABCDEF);
+        vo0x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk12c2xGHIJKLMNOPQRSTUV, vi1x1c2, vo0x0cGHIJKLMNOPQRSTUV);
+        vo0x1c0123456789ABCDEF = _mm512_fmadd_ps(vk10c2x0123456789ABCDEF, vi1x1c2, vo0x1c0123456789ABCDEF);
+        vo0x1cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk10c2xGHIJKLMNOPQRSTUV, vi1x1c2, vo0x1cGHIJKLMNOPQRSTUV);
+        const __m512 vi2x1c2 = _mm512_set1_ps(i2[8]);
+        vo0x0c0123456789ABCDEF = _mm512_fmadd_ps(vk22c2x0123456789ABCDEF, vi2x1c2, vo0x0c0123456789ABCDEF);
+        vo0x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk22c2xGHIJKLMNOPQRSTUV, vi2x1c2, vo0x0cGHIJKLMNOPQRSTUV);
+        vo0x1c0123456789ABCDEF = _mm512_fmadd_ps(vk20c2x0123456789ABCDEF, vi2x1c2, vo0x1c0123456789ABCDEF);
+        vo0x1cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk20c2xGHIJKLMNOPQRSTUV, vi2x1c2, vo0x1cGHIJKLMNOPQRSTUV);
+        vo1x0c0123456789ABCDEF = _mm512_fmadd_ps(vk02c2x0123456789ABCDEF, vi2x1c2, vo1x0c0123456789ABCDEF);
+        vo1x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk02c2xGHIJKLMNOPQRSTUV, vi2x1c2, vo1x0cGHIJKLMNOPQRSTUV);
+        vo1x1c0123456789ABCDEF = _mm512_fmadd_ps(vk00c2x0123456789ABCDEF, vi2x1c2, vo1x1c0123456789ABCDEF);
+        vo1x1cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk00c2xGHIJKLMNOPQRSTUV, vi2x1c2, vo1x1cGHIJKLMNOPQRSTUV);
+        const __m512 vi3x1c2 = _mm512_set1_ps(i3[8]);
+        vo1x0c0123456789ABCDEF = _mm512_fmadd_ps(vk12c2x0123456789ABCDEF, vi3x1c2, vo1x0c0123456789ABCDEF);
+        vo1x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk12c2xGHIJKLMNOPQRSTUV, vi3x1c2, vo1x0cGHIJKLMNOPQRSTUV);
+        vo1x1c0123456789ABCDEF = _mm512_fmadd_ps(vk10c2x0123456789ABCDEF, vi3x1c2, vo1x1c0123456789ABCDEF);
+        vo1x1cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk10c2xGHIJKLMNOPQRSTUV, vi3x1c2, vo1x1cGHIJKLMNOPQRSTUV);
+        const __m512 vi4x1c2 = _mm512_set1_ps(i4[8]);
+        vo1x0c0123456789ABCDEF = _mm512_fmadd_ps(vk22c2x0123456789ABCDEF, vi4x1c2, vo1x0c0123456789ABCDEF);
+        vo1x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk22c2xGHIJKLMNOPQRSTUV, vi4x1c2, vo1x0cGHIJKLMNOPQRSTUV);
+        vo1x1c0123456789ABCDEF = _mm512_fmadd_ps(vk20c2x0123456789ABCDEF, vi4x1c2, vo1x1c0123456789ABCDEF);
+        vo1x1cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk20c2xGHIJKLMNOPQRSTUV, vi4x1c2, vo1x1cGHIJKLMNOPQRSTUV);
+
+        i0 += 6;
+        i1 += 6;
+        i2 += 6;
+        i3 += 6;
+        i4 += 6;
+
+        vo0x0c0123456789ABCDEF = _mm512_max_ps(vo0x0c0123456789ABCDEF, vmin);
+        vo0x0cGHIJKLMNOPQRSTUV = _mm512_max_ps(vo0x0cGHIJKLMNOPQRSTUV, vmin);
+        vo1x0c0123456789ABCDEF = _mm512_max_ps(vo1x0c0123456789ABCDEF, vmin);
+        vo1x0cGHIJKLMNOPQRSTUV = _mm512_max_ps(vo1x0cGHIJKLMNOPQRSTUV, vmin);
+        vo0x0c0123456789ABCDEF = _mm512_min_ps(vo0x0c0123456789ABCDEF, vmax);
+        vo0x0cGHIJKLMNOPQRSTUV = _mm512_min_ps(vo0x0cGHIJKLMNOPQRSTUV, vmax);
+        vo1x0c0123456789ABCDEF = _mm512_min_ps(vo1x0c0123456789ABCDEF, vmax);
+        vo1x0cGHIJKLMNOPQRSTUV = _mm512_min_ps(vo1x0cGHIJKLMNOPQRSTUV, vmax);
+
+        if XNN_LIKELY(c >= 32) {
+          _mm512_storeu_ps(o1, vo1x0c0123456789ABCDEF);
+          _mm512_storeu_ps(o1 + 16, vo1x0cGHIJKLMNOPQRSTUV);
+          o1 = (float*) ((uintptr_t) o1 + output_width_stride);
+          _mm512_storeu_ps(o0, vo0x0c0123456789ABCDEF);
+          _mm512_storeu_ps(o0 + 16, vo0x0cGHIJKLMNOPQRSTUV);
+          o0 = (float*) ((uintptr_t) o0 + output_width_stride);
+        } else {
+          float* o1_tmp = o1;
+          float* o0_tmp = o0;
+          if (c & 16) {
+            _mm512_storeu_ps((float*) ((uintptr_t) o1_tmp + output_width_stride * 0) + 0, vo1x0c0123456789ABCDEF);
+            _mm512_storeu_ps((float*) ((uintptr_t) o0_tmp + output_width_stride * 0) + 0, vo0x0c0123456789ABCDEF);
+            o1_tmp += 16;
+            o0_tmp += 16;
+            vo0x0c0123456789ABCDEF = vo0x0cGHIJKLMNOPQRSTUV;
+            vo1x0c0123456789ABCDEF = vo1x0cGHIJKLMNOPQRSTUV;
+          }
+          // Prepare mask for valid 32-bit elements (depends on c).
+          const __mmask16 vmask = _cvtu32_mask16((uint16_t) ((uint32_t) (UINT32_C(1) << (c & 15)) - UINT32_C(1)));
+          _mm512_mask_storeu_ps((float*) ((uintptr_t) o1_tmp + output_width_stride * 0), vmask, vo1x0c0123456789ABCDEF);
+          _mm512_mask_storeu_ps((float*) ((uintptr_t) o0_tmp + output_width_stride * 0), vmask, vo0x0c0123456789ABCDEF);
+          o1 = (float*) ((uintptr_t) o1 + output_width_stride);
+          o0 = (float*) ((uintptr_t) o0 + output_width_stride);
+        }
+
+        vo0x0c0123456789ABCDEF = vo0x1c0123456789ABCDEF;
+        vo0x0cGHIJKLMNOPQRSTUV = vo0x1cGHIJKLMNOPQRSTUV;
+        vo1x0c0123456789ABCDEF = vo1x1c0123456789ABCDEF;
+        vo1x0cGHIJKLMNOPQRSTUV = vo1x1cGHIJKLMNOPQRSTUV;
+      }
+      assert(iw < 2);
+      if XNN_UNLIKELY(iw != 0) {
+        // The last input column contributes through the center column of the kernel; the right column is padding.
+        const __m512 vk01c0x0123456789ABCDEF = _mm512_load_ps(w + 320);
+        const __m512 vk01c0xGHIJKLMNOPQRSTUV = _mm512_load_ps(w + 336);
+        const __m512 vk11c0x0123456789ABCDEF = _mm512_load_ps(w + 352);
+        const __m512 vk11c0xGHIJKLMNOPQRSTUV = _mm512_load_ps(w + 368);
+        const __m512 vk21c0x0123456789ABCDEF = _mm512_load_ps(w + 384);
+        const __m512 vk21c0xGHIJKLMNOPQRSTUV = _mm512_load_ps(w + 400);
+
+        const __m512 vi0x0c0 = _mm512_set1_ps(i0[3]);
+        vo0x0c0123456789ABCDEF = _mm512_fmadd_ps(vk01c0x0123456789ABCDEF, vi0x0c0, vo0x0c0123456789ABCDEF);
+        vo0x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk01c0xGHIJKLMNOPQRSTUV, vi0x0c0, vo0x0cGHIJKLMNOPQRSTUV);
+        const __m512 vi1x0c0 = _mm512_set1_ps(i1[3]);
+        vo0x0c0123456789ABCDEF = _mm512_fmadd_ps(vk11c0x0123456789ABCDEF, vi1x0c0, vo0x0c0123456789ABCDEF);
+        vo0x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk11c0xGHIJKLMNOPQRSTUV, vi1x0c0, vo0x0cGHIJKLMNOPQRSTUV);
+        const __m512 vi2x0c0 = _mm512_set1_ps(i2[3]);
+        vo0x0c0123456789ABCDEF = _mm512_fmadd_ps(vk21c0x0123456789ABCDEF, vi2x0c0, vo0x0c0123456789ABCDEF);
+        vo0x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk21c0xGHIJKLMNOPQRSTUV, vi2x0c0, vo0x0cGHIJKLMNOPQRSTUV);
+        vo1x0c0123456789ABCDEF = _mm512_fmadd_ps(vk01c0x0123456789ABCDEF, vi2x0c0, vo1x0c0123456789ABCDEF);
+        vo1x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk01c0xGHIJKLMNOPQRSTUV, vi2x0c0, vo1x0cGHIJKLMNOPQRSTUV);
+        const __m512 vi3x0c0 = _mm512_set1_ps(i3[3]);
+        vo1x0c0123456789ABCDEF = _mm512_fmadd_ps(vk11c0x0123456789ABCDEF, vi3x0c0, vo1x0c0123456789ABCDEF);
+        vo1x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk11c0xGHIJKLMNOPQRSTUV, vi3x0c0, vo1x0cGHIJKLMNOPQRSTUV);
+        const __m512 vi4x0c0 = _mm512_set1_ps(i4[3]);
+        vo1x0c0123456789ABCDEF = _mm512_fmadd_ps(vk21c0x0123456789ABCDEF, vi4x0c0, vo1x0c0123456789ABCDEF);
+        vo1x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk21c0xGHIJKLMNOPQRSTUV, vi4x0c0, vo1x0cGHIJKLMNOPQRSTUV);
+        const __m512 vk01c1x0123456789ABCDEF = _mm512_load_ps(w + 416);
+        const __m512 vk01c1xGHIJKLMNOPQRSTUV = _mm512_load_ps(w + 432);
+        const __m512 vk11c1x0123456789ABCDEF = _mm512_load_ps(w + 448);
+        const __m512 vk11c1xGHIJKLMNOPQRSTUV = _mm512_load_ps(w + 464);
+        const __m512 vk21c1x0123456789ABCDEF = _mm512_load_ps(w + 480);
+        const __m512 vk21c1xGHIJKLMNOPQRSTUV = _mm512_load_ps(w + 496);
+
+        const __m512 vi0x0c1 = _mm512_set1_ps(i0[4]);
+        vo0x0c0123456789ABCDEF = _mm512_fmadd_ps(vk01c1x0123456789ABCDEF, vi0x0c1, vo0x0c0123456789ABCDEF);
+        vo0x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk01c1xGHIJKLMNOPQRSTUV, vi0x0c1, vo0x0cGHIJKLMNOPQRSTUV);
+        const __m512 vi1x0c1 = _mm512_set1_ps(i1[4]);
+        vo0x0c0123456789ABCDEF = _mm512_fmadd_ps(vk11c1x0123456789ABCDEF, vi1x0c1, vo0x0c0123456789ABCDEF);
+        vo0x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk11c1xGHIJKLMNOPQRSTUV, vi1x0c1, vo0x0cGHIJKLMNOPQRSTUV);
+        const __m512 vi2x0c1 = _mm512_set1_ps(i2[4]);
+        vo0x0c0123456789ABCDEF = _mm512_fmadd_ps(vk21c1x0123456789ABCDEF, vi2x0c1, vo0x0c0123456789ABCDEF);
+        vo0x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk21c1xGHIJKLMNOPQRSTUV, vi2x0c1, vo0x0cGHIJKLMNOPQRSTUV);
+        vo1x0c0123456789ABCDEF = _mm512_fmadd_ps(vk01c1x0123456789ABCDEF, vi2x0c1, vo1x0c0123456789ABCDEF);
+        vo1x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk01c1xGHIJKLMNOPQRSTUV, vi2x0c1, vo1x0cGHIJKLMNOPQRSTUV);
+        const __m512 vi3x0c1 = _mm512_set1_ps(i3[4]);
+        vo1x0c0123456789ABCDEF = _mm512_fmadd_ps(vk11c1x0123456789ABCDEF, vi3x0c1, vo1x0c0123456789ABCDEF);
+        vo1x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk11c1xGHIJKLMNOPQRSTUV, vi3x0c1, vo1x0cGHIJKLMNOPQRSTUV);
+        const __m512 vi4x0c1 = _mm512_set1_ps(i4[4]);
+        vo1x0c0123456789ABCDEF = _mm512_fmadd_ps(vk21c1x0123456789ABCDEF, vi4x0c1, vo1x0c0123456789ABCDEF);
+        vo1x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk21c1xGHIJKLMNOPQRSTUV, vi4x0c1, vo1x0cGHIJKLMNOPQRSTUV);
+        const __m512 vk01c2x0123456789ABCDEF = _mm512_load_ps(w + 512);
+        const __m512 vk01c2xGHIJKLMNOPQRSTUV = _mm512_load_ps(w + 528);
+        const __m512 vk11c2x0123456789ABCDEF = _mm512_load_ps(w + 544);
+        const __m512 vk11c2xGHIJKLMNOPQRSTUV = _mm512_load_ps(w + 560);
+        const __m512 vk21c2x0123456789ABCDEF = _mm512_load_ps(w + 576);
+        const __m512 vk21c2xGHIJKLMNOPQRSTUV = _mm512_load_ps(w + 592);
+
+        const __m512 vi0x0c2 = _mm512_set1_ps(i0[5]);
+        vo0x0c0123456789ABCDEF = _mm512_fmadd_ps(vk01c2x0123456789ABCDEF, vi0x0c2, vo0x0c0123456789ABCDEF);
+        vo0x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk01c2xGHIJKLMNOPQRSTUV, vi0x0c2, vo0x0cGHIJKLMNOPQRSTUV);
+        const __m512 vi1x0c2 = _mm512_set1_ps(i1[5]);
+        vo0x0c0123456789ABCDEF = _mm512_fmadd_ps(vk11c2x0123456789ABCDEF, vi1x0c2, vo0x0c0123456789ABCDEF);
+        vo0x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk11c2xGHIJKLMNOPQRSTUV, vi1x0c2, vo0x0cGHIJKLMNOPQRSTUV);
+        const __m512 vi2x0c2 = _mm512_set1_ps(i2[5]);
+        vo0x0c0123456789ABCDEF = _mm512_fmadd_ps(vk21c2x0123456789ABCDEF, vi2x0c2, vo0x0c0123456789ABCDEF);
+        vo0x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk21c2xGHIJKLMNOPQRSTUV, vi2x0c2, vo0x0cGHIJKLMNOPQRSTUV);
+        vo1x0c0123456789ABCDEF = _mm512_fmadd_ps(vk01c2x0123456789ABCDEF, vi2x0c2, vo1x0c0123456789ABCDEF);
+        vo1x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk01c2xGHIJKLMNOPQRSTUV, vi2x0c2, vo1x0cGHIJKLMNOPQRSTUV);
+        const __m512 vi3x0c2 = _mm512_set1_ps(i3[5]);
+        vo1x0c0123456789ABCDEF = _mm512_fmadd_ps(vk11c2x0123456789ABCDEF, vi3x0c2, vo1x0c0123456789ABCDEF);
+        vo1x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk11c2xGHIJKLMNOPQRSTUV, vi3x0c2, vo1x0cGHIJKLMNOPQRSTUV);
+        const __m512 vi4x0c2 = _mm512_set1_ps(i4[5]);
+        vo1x0c0123456789ABCDEF = _mm512_fmadd_ps(vk21c2x0123456789ABCDEF, vi4x0c2, vo1x0c0123456789ABCDEF);
+        vo1x0cGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vk21c2xGHIJKLMNOPQRSTUV, vi4x0c2, vo1x0cGHIJKLMNOPQRSTUV);
+
+        vo0x0c0123456789ABCDEF = _mm512_max_ps(vo0x0c0123456789ABCDEF, vmin);
+        vo0x0cGHIJKLMNOPQRSTUV = _mm512_max_ps(vo0x0cGHIJKLMNOPQRSTUV, vmin);
+        vo1x0c0123456789ABCDEF = _mm512_max_ps(vo1x0c0123456789ABCDEF, vmin);
+        vo1x0cGHIJKLMNOPQRSTUV = _mm512_max_ps(vo1x0cGHIJKLMNOPQRSTUV, vmin);
+        vo0x0c0123456789ABCDEF = _mm512_min_ps(vo0x0c0123456789ABCDEF, vmax);
+        vo0x0cGHIJKLMNOPQRSTUV = _mm512_min_ps(vo0x0cGHIJKLMNOPQRSTUV, vmax);
+        vo1x0c0123456789ABCDEF = _mm512_min_ps(vo1x0c0123456789ABCDEF, vmax);
+        vo1x0cGHIJKLMNOPQRSTUV = _mm512_min_ps(vo1x0cGHIJKLMNOPQRSTUV, vmax);
+
+        if XNN_LIKELY(c >= 32) {
+          _mm512_storeu_ps(o1, vo1x0c0123456789ABCDEF);
+          _mm512_storeu_ps(o1 + 16, vo1x0cGHIJKLMNOPQRSTUV);
+          _mm512_storeu_ps(o0, vo0x0c0123456789ABCDEF);
+          _mm512_storeu_ps(o0 + 16, vo0x0cGHIJKLMNOPQRSTUV);
+        } else {
+          float* o1_tmp = o1;
+          float* o0_tmp = o0;
+          if (c & 16) {
+            _mm512_storeu_ps(o1_tmp + 0, vo1x0c0123456789ABCDEF);
+            _mm512_storeu_ps(o0_tmp + 0, vo0x0c0123456789ABCDEF);
+            o1_tmp += 16;
+            o0_tmp += 16;
+            vo0x0c0123456789ABCDEF = vo0x0cGHIJKLMNOPQRSTUV;
+            vo1x0c0123456789ABCDEF = vo1x0cGHIJKLMNOPQRSTUV;
+          }
+          // Prepare mask for valid 32-bit elements (depends on c).
+          const __mmask16 vmask = _cvtu32_mask16((uint16_t) ((uint32_t) (UINT32_C(1) << (c & 15)) - UINT32_C(1)));
+          _mm512_mask_storeu_ps(o1_tmp, vmask, vo1x0c0123456789ABCDEF);
+          _mm512_mask_storeu_ps(o0_tmp, vmask, vo0x0c0123456789ABCDEF);
+        }
+        o1 = (float*) ((uintptr_t) o1 + output_width_stride);
+        o0 = (float*) ((uintptr_t) o0 + output_width_stride);
+      }
+      // Move output pointers back to the position of the first pixel in a row,
+      // and forward to the next block of output channels
+      o0 = (float*) ((uintptr_t) o0 - output_channel_decrement);
+      o1 = (float*) ((uintptr_t) o1 - output_channel_decrement);
+      // Revert input pointers to the position of the first pixel in a row
+      i0 = (const float*) ((uintptr_t) i0 - input_width_decrement);
+      i1 = (const float*) ((uintptr_t) i1 - input_width_decrement);
+      i2 = (const float*) ((uintptr_t) i2 - input_width_decrement);
+      i3 = (const float*) ((uintptr_t) i3 - input_width_decrement);
+      i4 = (const float*) ((uintptr_t) i4 - input_width_decrement);
+      // Move to the block of weights for the next 32 output channels
+      w += 896;
+      c = doz(c, 32);
+    } while (c != 0);
+    // Move output pointers back to the position of the first channel, and forward to the next block of rows
+    o0 = (float*) ((uintptr_t) o0 + output_height_increment);
+    o1 = (float*) ((uintptr_t) o1 + output_height_increment);
+    // Move input pointers forward to the next four rows
+    i0 = i4;
+    i1 = (const float*) ((uintptr_t) i0 + input_height_stride);
+    i2 = (const float*) ((uintptr_t) i1 + input_height_stride);
+    i3 = (const float*) ((uintptr_t) i2 + input_height_stride);
+    i4 = (const float*) ((uintptr_t) i3 + input_height_stride);
+  }
+}
@@ -0,0 +1,284 @@
+// Auto-generated file. Do not edit!
+//   Template: src/f32-conv-hwc/3x3s2c3-avx.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <immintrin.h>
+
+#include <xnnpack/conv.h>
+#include <xnnpack/math.h>
+
+
+void xnn_f32_conv_hwc_ukernel_3x3s2p0p1c3x8__avx_1x1(
+    size_t input_height,
+    size_t input_width,
+    size_t output_y_start,
+    size_t output_y_end,
+    const float* input,
+    const float* zero,
+    const float* weights,
+    float* output,
+    size_t input_padding_top,
+    size_t output_channels,
+    size_t output_height_stride,
+    size_t output_width_stride,
+    const union xnn_f32_minmax_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(input_width > 1);
+  assert(output_y_end > output_y_start);
+  assert(input_padding_top <= 1);
+  assert(output_channels != 0);
+
+  const size_t input_height_stride = input_width * 3 /* channels */ * sizeof(float);
+  const size_t input_width_decrement = round_down_po2(input_width - 1, 2) * 3 /* channels */ * sizeof(float);
+  const size_t output_width = input_width / 2;
+  const size_t output_channel_decrement = output_width * output_width_stride - 8 * sizeof(float);
+  const size_t output_height_increment = output_height_stride * 1 - round_up_po2(output_channels, 8) * sizeof(float);
+
+  // Adjustment for padding processed below
+  const float* i0 = (const float*) ((uintptr_t) input +
+    input_height_stride * (output_y_start * 2 /* vertical stride */ - input_padding_top));
+  const float* i1 = (const float*) ((uintptr_t) i0 + input_height_stride);
+  const float* i2 = (const float*) ((uintptr_t) i1 + input_height_stride);
+  float* o0 = (float*) ((uintptr_t) output + output_height_stride * output_y_start);
+
+  if XNN_UNPREDICTABLE(output_y_start < input_padding_top) {
+    i0 = zero;
+  }
+
+  const __m256 vmin = _mm256_load_ps(params->avx.min);
+  const __m256 vmax = _mm256_load_ps(params->avx.max);
+
+  for (size_t output_y = output_y_start; output_y < output_y_end; output_y += 1) {
+    const size_t input_y2 = output_y * 2 + 2 - input_padding_top;
+    if XNN_UNPREDICTABLE(input_y2 >= input_height) {
+      i2 = zero;
+    }
+
+    const float* w = weights;
+    size_t c = output_channels;
+    do {
+      // voMx0 accumulates the leftmost output pixel of the next block. The input column to the left of it
+      // is either padding, or was already accumulated at the end of the previous block.
+      __m256 vo0x0c01234567 = _mm256_load_ps(w + 0);
+
+      // No padding on the left: the first input column contributes only through the left column of the kernel.
+      const __m256 vi0c0 = _mm256_broadcast_ss(i0 + 0);
+      vo0x0c01234567 = _mm256_add_ps(vo0x0c01234567, _mm256_mul_ps(_mm256_load_ps(w + 8), vi0c0));
+      const __m256 vi1c0 = _mm256_broadcast_ss(i1 + 0);
+      vo0x0c01234567 = _mm256_add_ps(vo0x0c01234567, _mm256_mul_ps(_mm256_load_ps(w + 16), vi1c0));
+      const __m256 vi2c0 = _mm256_broadcast_ss(i2 + 0);
+      vo0x0c01234567 = _mm256_add_ps(vo0x0c01234567, _mm256_mul_ps(_mm256_load_ps(w + 24), vi2c0));
+      const __m256 vi0c1 = _mm256_broadcast_ss(i0 + 1);
+      vo0x0c01234567 = _mm256_add_ps(vo0x0c01234567, _mm256_mul_ps(_mm256_load_ps(w + 32), vi0c1));
+      const __m256 vi1c1 = _mm256_broadcast_ss(i1 + 1);
+      vo0x0c01234567 = _mm256_add_ps(vo0x0c01234567, _mm256_mul_ps(_mm256_load_ps(w + 40), vi1c1));
+      const __m256 vi2c1 = _mm256_broadcast_ss(i2 + 1);
+      vo0x0c01234567 = _mm256_add_ps(vo0x0c01234567, _mm256_mul_ps(_mm256_load_ps(w + 48), vi2c1));
+      const __m256 vi0c2 = _mm256_broadcast_ss(i0 + 2);
+      vo0x0c01234567 = _mm256_add_ps(vo0x0c01234567, _mm256_mul_ps(_mm256_load_ps(w + 56), vi0c2));
+      const __m256 vi1c2 = _mm256_broadcast_ss(i1 + 2);
+      vo0x0c01234567 = _mm256_add_ps(vo0x0c01234567, _mm256_mul_ps(_mm256_load_ps(w + 64), vi1c2));
+      const __m256 vi2c2 = _mm256_broadcast_ss(i2 + 2);
+      vo0x0c01234567 = _mm256_add_ps(vo0x0c01234567, _mm256_mul_ps(_mm256_load_ps(w + 72), vi2c2));
+
+      size_t iw = input_width - 1;
+      for (; iw >= 2; iw -= 2) {
+        __m256 vo0x1c01234567 = _mm256_load_ps(w + 0);
+
+        const __m256 vk01c0x01234567 = _mm256_load_ps(w + 80);
+        const __m256 vk11c0x01234567 = _mm256_load_ps(w + 88);
+        const __m256 vk21c0x01234567 = _mm256_load_ps(w + 96);
+
+        const __m256 vi0x0c0 = _mm256_broadcast_ss(i0 + 3);
+        vo0x0c01234567 = _mm256_add_ps(vo0x0c01234567, _mm256_mul_ps(vk01c0x01234567, vi0x0c0));
+        const __m256 vi1x0c0 = _mm256_broadcast_ss(i1 + 3);
+        vo0x0c01234567 = _mm256_add_ps(vo0x0c01234567, _mm256_mul_ps(vk11c0x01234567, vi1x0c0));
+        const __m256 vi2x0c0 = _mm256_broadcast_ss(i2 + 3);
+        vo0x0c01234567 = _mm256_add_ps(vo0x0c01234567, _mm256_mul_ps(vk21c0x01234567, vi2x0c0));
+
+        const __m256 vk02c0x01234567 = _mm256_load_ps(w + 152);
+        const __m256 vk12c0x01234567 = _mm256_load_ps(w + 160);
+        const __m256 vk22c0x01234567 = _mm256_load_ps(w + 168);
+        const __m256 vk00c0x01234567 = _mm256_load_ps(w + 8);
+        const __m256 vk10c0x01234567 = _mm256_load_ps(w + 16);
+        const __m256 vk20c0x01234567 = _mm256_load_ps(w + 24);
+
+        const __m256 vi0x1c0 = _mm256_broadcast_ss(i0 + 6);
+        vo0x0c01234567 = _mm256_add_ps(vo0x0c01234567, _mm256_mul_ps(vk02c0x01234567, vi0x1c0));
+        vo0x1c01234567 = _mm256_add_ps(vo0x1c01234567, _mm256_mul_ps(vk00c0x01234567, vi0x1c0));
+        const __m256 vi1x1c0 = _mm256_broadcast_ss(i1 + 6);
+        vo0x0c01234567 = _mm256_add_ps(vo0x0c01234567, _mm256_mul_ps(vk12c0x01234567, vi1x1c0));
+        vo0x1c01234567 = _mm256_add_ps(vo0x1c01234567, _mm256_mul_ps(vk10c0x01234567, vi1x1c0));
+        const __m256 vi2x1c0 = _mm256_broadcast_ss(i2 + 6);
+        vo0x0c01234567 = _mm256_add_ps(vo0x0c01234567, _mm256_mul_ps(vk22c0x01234567, vi2x1c0));
+        vo0x1c01234567 = _mm256_add_ps(vo0x1c01234567, _mm256_mul_ps(vk20c0x01234567, vi2x1c0));
+        const __m256 vk01c1x01234567 = _mm256_load_ps(w + 104);
+        const __m256 vk11c1x01234567 = _mm256_load_ps(w + 112);
+        const __m256 vk21c1x01234567 = _mm256_load_ps(w + 120);
+
+        const __m256 vi0x0c1 = _mm256_broadcast_ss(i0 + 4);
+        vo0x0c01234567 = _mm256_add_ps(vo0x0c01234567, _mm256_mul_ps(vk01c1x01234567, vi0x0c1));
+        const __m256 vi1x0c1 = _mm256_broadcast_ss(i1 + 4);
+        vo0x0c01234567 = _mm256_add_ps(vo0x0c01234567, _mm256_mul_ps(vk11c1x01234567, vi1x0c1));
+        const __m256 vi2x0c1 = _mm256_broadcast_ss(i2 + 4);
+        vo0x0c01234567 = _mm256_add_ps(vo0x0c01234567, _mm256_mul_ps(vk21c1x01234567, vi2x0c1));
+
+        const __m256 vk02c1x01234567 = _mm256_load_ps(w + 176);
+        const __m256 vk12c1x01234567 = _mm256_load_ps(w + 184);
+        const __m256 vk22c1x01234567 = _mm256_load_ps(w + 192);
+        const __m256 vk00c1x01234567 = _mm256_load_ps(w + 32);
+        const __m256 vk10c1x01234567 = _mm256_load_ps(w + 40);
+        const __m256 vk20c1x01234567 = _mm256_load_ps(w + 48);
+
+        const __m256 vi0x1c1 = _mm256_broadcast_ss(i0 + 7);
+        vo0x0c01234567 = _mm256_add_ps(vo0x0c01234567, _mm256_mul_ps(vk02c1x01234567, vi0x1c1));
+        vo0x1c01234567 = _mm256_add_ps(vo0x1c01234567, _mm256_mul_ps(vk00c1x01234567, vi0x1c1));
+        const __m256 vi1x1c1 = _mm256_broadcast_ss(i1 + 7);
+        vo0x0c01234567 = _mm256_add_ps(vo0x0c01234567, _mm256_mul_ps(vk12c1x01234567, vi1x1c1));
+        vo0x1c01234567 = _mm256_add_ps(vo0x1c01234567, _mm256_mul_ps(vk10c1x01234567, vi1x1c1));
+        const __m256 vi2x1c1 = _mm256_broadcast_ss(i2 + 7);
+        vo0x0c01234567 = _mm256_add_ps(vo0x0c01234567, _mm256_mul_ps(vk22c1x01234567, vi2x1c1));
+        vo0x1c01234567 = _mm256_add_ps(vo0x1c01234567, _mm256_mul_ps(vk20c1x01234567, vi2x1c1));
+        const __m256 vk01c2x01234567 = _mm256_load_ps(w + 128);
+        const __m256 vk11c2x01234567 = _mm256_load_ps(w + 136);
+        const __m256 vk21c2x01234567 = _mm256_load_ps(w + 144);
+
+        const __m256 vi0x0c2 = _mm256_broadcast_ss(i0 + 5);
+        vo0x0c01234567 = _mm256_add_ps(vo0x0c01234567, _mm256_mul_ps(vk01c2x01234567, vi0x0c2));
+        const __m256 vi1x0c2 = _mm256_broadcast_ss(i1 + 5);
+        vo0x0c01234567 = _mm256_add_ps(vo0x0c01234567, _mm256_mul_ps(vk11c2x01234567, vi1x0c2));
+        const __m256 vi2x0c2 = _mm256_broadcast_ss(i2 + 5);
+        vo0x0c01234567 = _mm256_add_ps(vo0x0c01234567, _mm256_mul_ps(vk21c2x01234567, vi2x0c2));
+
+        const __m256 vk02c2x01234567 = _mm256_load_ps(w + 200);
+        const __m256 vk12c2x01234567 = _mm256_load_ps(w + 208);
+        const __m256 vk22c2x01234567 = _mm256_load_ps(w + 216);
+        const __m256 vk00c2x01234567 = _mm256_load_ps(w + 56);
+        const __m256 vk10c2x01234567 = _mm256_load_ps(w + 64);
+        const __m256 vk20c2x01234567 = _mm256_load_ps(w + 72);
+
+        const __m256 vi0x1c2 = _mm256_broadcast_ss(i0 + 8);
+        vo0x0c01234567 = _mm256_add_ps(vo0x0c01234567, _mm256_mul_ps(vk02c2x01234567, vi0x1c2));
+        vo0x1c01234567 = _mm256_add_ps(vo0x1c01234567, _mm256_mul_ps(vk00c2x01234567, vi0x1c2));
+        const __m256 vi1x1c2 = _mm256_broadcast_ss(i1 + 8);
+        vo0x0c01234567 = _mm256_add_ps(vo0x0c01234567, _mm256_mul_ps(vk12c2x01234567, vi1x1c2));
+        vo0x1c01234567 = _mm256_add_ps(vo0x1c01234567, _mm256_mul_ps(vk10c2x01234567, vi1x1c2));
+        const __m256 vi2x1c2 = _mm256_broadcast_ss(i2 + 8);
+        vo0x0c01234567 = _mm256_add_ps(vo0x0c01234567, _mm256_mul_ps(vk22c2x01234567, vi2x1c2));
+        vo0x1c01234567 = _mm256_add_ps(vo0x1c01234567, _mm256_mul_ps(vk20c2x01234567, vi2x1c2));
+
+        i0 += 6;
+        i1 += 6;
+        i2 += 6;
+
+        vo0x0c01234567 = _mm256_max_ps(vo0x0c01234567, vmin);
+        vo0x0c01234567 = _mm256_min_ps(vo0x0c01234567, vmax);
+
+        if XNN_LIKELY(c >= 8) {
+          _mm256_storeu_ps(o0, vo0x0c01234567);
+          o0 = (float*) ((uintptr_t) o0 + output_width_stride);
+        } else {
+          float* o0_tmp = o0;
+          __m128 vo0x0c0123 = _mm256_castps256_ps128(vo0x0c01234567);
+          if (c & 4) {
+            _mm_storeu_ps((float*) ((uintptr_t) o0_tmp + output_width_stride * 0), vo0x0c0123);
+            o0_tmp += 4;
+            vo0x0c0123 = _mm256_extractf128_ps(vo0x0c01234567, 1);
+          }
+          if (c & 2) {
+            _mm_storel_pi((__m64*) ((uintptr_t) o0_tmp + output_width_stride * 0), vo0x0c0123);
+            o0_tmp += 2;
+            vo0x0c0123 = _mm_movehl_ps(vo0x0c0123, vo0x0c0123);
+          }
+          if (c & 1) {
+            _mm_store_ss((float*) ((uintptr_t) o0_tmp + output_width_stride * 0), vo0x0c0123);
+          }
+          o0 = (float*) ((uintptr_t) o0 + output_width_stride);
+        }
+
+        vo0x0c01234567 = vo0x1c01234567;
+      }
+      assert(iw < 2);
+      if XNN_UNLIKELY(iw != 0) {
+        // The last input column contributes through the center column of the kernel; the right column is padding.
+        const __m256 vk01c0x01234567 = _mm256_load_ps(w + 80);
+        const __m256 vk11c0x01234567 = _mm256_load_ps(w + 88);
+        const __m256 vk21c0x01234567 = _mm256_load_ps(w + 96);
+
+        const __m256 vi0x0c0 = _mm256_broadcast_ss(i0 + 3);
+        vo0x0c01234567 = _mm256_add_ps(vo0x0c01234567, _mm256_mul_ps(vk01c0x01234567, vi0x0c0));
+        const __m256 vi1x0c0 = _mm256_broadcast_ss(i1 + 3);
+        vo0x0c01234567 = _mm256_add_ps(vo0x0c01234567, _mm256_mul_ps(vk11c0x01234567, vi1x0c0));
+        const __m256 vi2x0c0 = _mm256_broadcast_ss(i2 + 3);
+        vo0x0c01234567 = _mm256_add_ps(vo0x0c01234567, _mm256_mul_ps(vk21c0x01234567, vi2x0c0));
+        const __m256 vk01c1x01234567 = _mm256_load_ps(w + 104);
+        const __m256 vk11c1x01234567 = _mm256_load_ps(w + 112);
+        const __m256 vk21c1x01234567 = _mm256_load_ps(w + 120);
+
+        const __m256 vi0x0c1 = _mm256_broadcast_ss(i0 + 4);
+        vo0x0c01234567 = _mm256_add_ps(vo0x0c01234567, _mm256_mul_ps(vk01c1x01234567, vi0x0c1));
+        const __m256 vi1x0c1 = _mm256_broadcast_ss(i1 + 4);
+        vo0x0c01234567 = _mm256_add_ps(vo0x0c01234567, _mm256_mul_ps(vk11c1x01234567, vi1x0c1));
+        const __m256 vi2x0c1 = _mm256_broadcast_ss(i2 + 4);
+        vo0x0c01234567 = _mm256_add_ps(vo0x0c01234567, _mm256_mul_ps(vk21c1x01234567, vi2x0c1));
+        const __m256 vk01c2x01234567 = _mm256_load_ps(w + 128);
+        const __m256 vk11c2x01234567 = _mm256_load_ps(w + 136);
+        const __m256 vk21c2x01234567 = _mm256_load_ps(w + 144);
+
+        const __m256 vi0x0c2 = _mm256_broadcast_ss(i0 + 5);
+        vo0x0c01234567 = _mm256_add_ps(vo0x0c01234567, _mm256_mul_ps(vk01c2x01234567, vi0x0c2));
+        const __m256 vi1x0c2 = _mm256_broadcast_ss(i1 + 5);
+        vo0x0c01234567 = _mm256_add_ps(vo0x0c01234567, _mm256_mul_ps(vk11c2x01234567, vi1x0c2));
+        const __m256 vi2x0c2 = _mm256_broadcast_ss(i2 + 5);
+        vo0x0c01234567 = _mm256_add_ps(vo0x0c01234567, _mm256_mul_ps(vk21c2x01234567, vi2x0c2));
+
+        vo0x0c01234567 = _mm256_max_ps(vo0x0c01234567, vmin);
+        vo0x0c01234567 = _mm256_min_ps(vo0x0c01234567, vmax);
+
+        if XNN_LIKELY(c >= 8) {
+          _mm256_storeu_ps(o0, vo0x0c01234567);
+        } else {
+          float* o0_tmp = o0;
+          __m128 vo0x0c0123 = _mm256_castps256_ps128(vo0x0c01234567);
+          if (c & 4) {
+            _mm_storeu_ps(o0_tmp, vo0x0c0123);
+            o0_tmp += 4;
+            vo0x0c0123 = _mm256_extractf128_ps(vo0x0c01234567, 1);
+          }
+          if (c & 2) {
+            _mm_storel_pi((__m64*) o0_tmp, vo0x0c0123);
+            o0_tmp += 2;
+            vo0x0c0123 = _mm_movehl_ps(vo0x0c0123, vo0x0c0123);
+          }
+          if (c & 1) {
+            _mm_store_ss(o0_tmp, vo0x0c0123);
+          }
+        }
+        o0 = (float*) ((uintptr_t) o0 + output_width_stride);
+      }
+      // Move output pointers back to the position of the first pixel in a row,
+      // and forward to the next block of output channels
+      o0 = (float*) ((uintptr_t) o0 - output_channel_decrement);
+      // Revert input pointers to the position of the first pixel in a row
+      i0 = (const float*) ((uintptr_t) i0 - input_width_decrement);
+      i1 = (const float*) ((uintptr_t) i1 - input_width_decrement);
+      i2 = (const float*) ((uintptr_t) i2 - input_width_decrement);
+      // Move to the block of weights for the next 8 output channels
+      w += 224;
+      c = doz(c, 8);
+    } while (c != 0);
+    // Move output pointers back to the position of the first channel, and forward to the next block of rows
+    o0 = (float*) ((uintptr_t) o0 + output_height_increment);
+    // Move input pointers forward to the next two rows
+    i0 = i2;
+    i1 = (const float*) ((uintptr_t) i0 + input_height_stride);
+    i2 = (const float*) ((uintptr_t) i1 + input_height_stride);
+  }
+}
@@ -0,0 +1,547 @@
+// Auto-generated file. Do not edit!
+//   Template: src/f32-conv-hwc/3x3s2c3-sse.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <xmmintrin.h>
+
+#include <xnnpack/conv.h>
+#include <xnnpack/math.h>
+
+
+void xnn_f32_conv_hwc_ukernel_3x3s2p0p1c3x8__sse_2x1(
+    size_t input_height,
+    size_t input_width,
+    size_t output_y_start,
+    size_t output_y_end,
+    const float* input,
+    const float* zero,
+    const float* weights,
+    float* output,
+    size_t input_padding_top,
+    size_t output_channels,
+    size_t output_height_stride,
+    size_t output_width_stride,
+    const union xnn_f32_minmax_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(input_width > 1);
+  assert(output_y_end > output_y_start);
+  assert(input_padding_top <= 1);
+  assert(output_channels != 0);
+
+  const size_t input_height_stride = input_width * 3 /* channels */ * sizeof(float);
+  const size_t input_width_decrement = round_down_po2(input_width - 1, 2) * 3 /* channels */ * sizeof(float);
+  const size_t output_width = input_width / 2;
+  const size_t output_channel_decrement = output_width * output_width_stride - 8 * sizeof(float);
+  const size_t output_height_increment = output_height_stride * 2 - round_up_po2(output_channels, 8) * sizeof(float);
+
+  // Adjustment for padding processed below
+  const float* i0 = (const float*) ((uintptr_t) input +
+    input_height_stride * (output_y_start * 2 /* vertical stride */ - input_padding_top));
+  const float* i1 = (const float*) ((uintptr_t) i0 + input_height_stride);
+  const float* i2 = (const float*) ((uintptr_t) i1 + input_height_stride);
+  const float* i3 = (const float*) ((uintptr_t) i2 + input_height_stride);
+  const float* i4 = (const float*) ((uintptr_t) i3 + input_height_stride);
+  float* o0 = (float*) ((uintptr_t) output + output_height_stride * output_y_start);
+  float* o1 = (float*) ((uintptr_t) o0 + output_height_stride);
+
+  if XNN_UNPREDICTABLE(output_y_start < input_padding_top) {
+    i0 = zero;
+  }
+
+  const __m128 vmin = _mm_load_ps(params->sse.min);
+  const __m128 vmax = _mm_load_ps(params->sse.max);
+
+  for (size_t output_y = output_y_start; output_y < output_y_end; output_y += 2) {
+    const size_t input_y2 = output_y * 2 + 2 - input_padding_top;
+    const size_t input_y4 = input_y2 + 2;
+    if XNN_UNPREDICTABLE(input_y2 > input_height) {
+      i1 = zero;
+    }
+    if XNN_UNPREDICTABLE(input_y2 >= input_height) {
+      i2 = zero;
+    }
+    if XNN_UNPREDICTABLE(input_y4 > input_height) {
+      i3 = zero;
+    }
+    if XNN_UNPREDICTABLE(input_y4 >= input_height) {
+      i4 = zero;
+    }
+    if XNN_UNPREDICTABLE(output_y + 2 > output_y_end) {
+      o1 = o0;
+    }
+
+    const float* w = weights;
+    size_t c = output_channels;
+    do {
+      // voMx0 accumulates the leftmost output pixel of the next block. The input column to the left of it
+      // is either padding, or was already accumulated at the end of the previous block.
+      __m128 vo0x0c0123 = _mm_load_ps(w + 0);
+      __m128 vo0x0c4567 = _mm_load_ps(w + 4);
+      __m128 vo1x0c0123 = vo0x0c0123;
+      __m128 vo1x0c4567 = vo0x0c4567;
+
+      // No padding on the left: the first input column contributes only through the left column of the kernel.
+      const __m128 vi0c0 = _mm_load1_ps(i0 + 0);
+      vo0x0c0123 = _mm_add_ps(vo0x0c0123, _mm_mul_ps(_mm_load_ps(w + 8), vi0c0));
+      vo0x0c4567 = _mm_add_ps(vo0x0c4567, _mm_mul_ps(_mm_load_ps(w + 12), vi0c0));
+      const __m128 vi1c0 = _mm_load1_ps(i1 + 0);
+      vo0x0c0123 = _mm_add_ps(vo0x0c0123, _mm_mul_ps(_mm_load_ps(w + 16), vi1c0));
+      vo0x0c4567 = _mm_add_ps(vo0x0c4567, _mm_mul_ps(_mm_load_ps(w + 20), vi1c0));
+      const __m128 vi2c0 = _mm_load1_ps(i2 + 0);
+      vo0x0c0123 = _mm_add_ps(vo0x0c0123, _mm_mul_ps(_mm_load_ps(w + 24), vi2c0));
+      vo0x0c4567 = _mm_add_ps(vo0x0c4567, _mm_mul_ps(_mm_load_ps(w + 28), vi2c0));
+      vo1x0c0123 = _mm_add_ps(vo1x0c0123, _mm_mul_ps(_mm_load_ps(w + 8), vi2c0));
+      vo1x0c4567 = _mm_add_ps(vo1x0c4567, _mm_mul_ps(_mm_load_ps(w + 12), vi2c0));
+      const __m128 vi3c0 = _mm_load1_ps(i3 + 0);
+      vo1x0c0123 = _mm_add_ps(vo1x0c0123, _mm_mul_ps(_mm_load_ps(w + 16), vi3c0));
+      vo1x0c4567 = _mm_add_ps(vo1x0c4567, _mm_mul_ps(_mm_load_ps(w + 20), vi3c0));
+      const __m128 vi4c0 = _mm_load1_ps(i4 + 0);
+      vo1x0c0123 = _mm_add_ps(vo1x0c0123, _mm_mul_ps(_mm_load_ps(w + 24), vi4c0));
+      vo1x0c4567 = _mm_add_ps(vo1x0c4567, _mm_mul_ps(_mm_load_ps(w + 28), vi4c0));
+      const __m128 vi0c1 = _mm_load1_ps(i0 + 1);
+      vo0x0c0123 = _mm_add_ps(vo0x0c0123, _mm_mul_ps(_mm_load_ps(w + 32), vi0c1));
+      vo0x0c4567 = _mm_add_ps(vo0x0c4567, _mm_mul_ps(_mm_load_ps(w + 36), vi0c1));
+      const __m128 vi1c1 = _mm_load1_ps(i1 + 1);
+      vo0x0c0123 = _mm_add_ps(vo0x0c0123, _mm_mul_ps(_mm_load_ps(w + 40), vi1c1));
+      vo0x0c4567 = _mm_add_ps(vo0x0c4567, _mm_mul_ps(_mm_load_ps(w + 44), vi1c1));
+      const __m128 vi2c1 = _mm_load1_ps(i2 + 1);
+      vo0x0c0123 = _mm_add_ps(vo0x0c0123, _mm_mul_ps(_mm_load_ps(w + 48), vi2c1));
+      vo0x0c4567 = _mm_add_ps(vo0x0c4567, _mm_mul_ps(_mm_load_ps(w + 52), vi2c1));
+      vo1x0c0123 = _mm_add_ps(vo1x0c0123, _mm_mul_ps(_mm_load_ps(w + 32), vi2c1));
+      vo1x0c4567 = _mm_add_ps(vo1x0c4567, _mm_mul_ps(_mm_load_ps(w + 36), vi2c1));
+      const __m128 vi3c1 = _mm_load1_ps(i3 + 1);
+      vo1x0c0123 = _mm_add_ps(vo1x0c0123, _mm_mul_ps(_mm_load_ps(w + 40), vi3c1));
+      vo1x0c4567 = _mm_add_ps(vo1x0c4567, _mm_mul_ps(_mm_load_ps(w + 44), vi3c1));
+      const __m128 vi4c1 = _mm_load1_ps(i4 + 1);
+      vo1x0c0123 = _mm_add_ps(vo1x0c0123, _mm_mul_ps(_mm_load_ps(w + 48), vi4c1));
+      vo1x0c4567 = _mm_add_ps(vo1x0c4567, _mm_mul_ps(_mm_load_ps(w + 52), vi4c1));
+      const __m128 vi0c2 = _mm_load1_ps(i0 + 2);
+      vo0x0c0123 = _mm_add_ps(vo0x0c0123, _mm_mul_ps(_mm_load_ps(w + 56), vi0c2));
+      vo0x0c4567 = _mm_add_ps(vo0x0c4567, _mm_mul_ps(_mm_load_ps(w + 60), vi0c2));
+      const __m128 vi1c2 = _mm_load1_ps(i1 + 2);
+      vo0x0c0123 = _mm_add_ps(vo0x0c0123, _mm_mul_ps(_mm_load_ps(w + 64), vi1c2));
+      vo0x0c4567 = _mm_add_ps(vo0x0c4567, _mm_mul_ps(_mm_load_ps(w + 68), vi1c2));
+      const __m128 vi2c2 = _mm_load1_ps(i2 + 2);
+      vo0x0c0123 = _mm_add_ps(vo0x0c0123, _mm_mul_ps(_mm_load_ps(w + 72), vi2c2));
+      vo0x0c4567 = _mm_add_ps(vo0x0c4567, _mm_mul_ps(_mm_load_ps(w + 76), vi2c2));
+      vo1x0c0123 = _mm_add_ps(vo1x0c0123, _mm_mul_ps(_mm_load_ps(w + 56), vi2c2));
+      vo1x0c4567 = _mm_add_ps(vo1x0c4567, _mm_mul_ps(_mm_load_ps(w + 60), vi2c2));
+      const __m128 vi3c2 = _mm_load1_ps(i3 + 2);
+      vo1x0c0123 = _mm_add_ps(vo1x0c0123, _mm_mul_ps(_mm_load_ps(w + 64), vi3c2));
+      vo1x0c4567 = _mm_add_ps(vo1x0c4567, _mm_mul_ps(_mm_load_ps(w + 68), vi3c2));
+      const __m128 vi4c2 = _mm_load1_ps(i4 + 2);
+      vo1x0c0123 = _mm_add_ps(vo1x0c0123, _mm_mul_ps(_mm_load_ps(w + 72), vi4c2));
+      vo1x0c4567 = _mm_add_ps(vo1x0c4567, _mm_mul_ps(_mm_load_ps(w + 76), vi4c2));
+
+      size_t iw = input_width - 1;
+      for (; iw >= 2; iw -= 2) {
+        __m128 vo0x1c0123 = _mm_load_ps(w + 0);
+        __m128 vo0x1c4567 = _mm_load_ps(w + 4);
+        __m128 vo1x1c0123 = vo0x1c0123;
+        __m128 vo1x1c4567 = vo0x1c4567;
+
+        const __m128 vk01c0x0123 = _mm_load_ps(w + 80);
+        const __m128 vk01c0x4567 = _mm_load_ps(w + 84);
+        const __m128 vk11c0x0123 = _mm_load_ps(w + 88);
+        const __m128 vk11c0x4567 = _mm_load_ps(w + 92);
+        const __m128 vk21c0x0123 = _mm_load_ps(w + 96);
+        const __m128 vk21c0x4567 = _mm_load_ps(w + 100);
+
+        const __m128 vi0x0c0 = _mm_load1_ps(i0 + 3);
+        vo0x0c0123 = _mm_add_ps(vo0x0c0123, _mm_mul_ps(vk01c0x0123, vi0x0c0));
+        vo0x0c4567 = _mm_add_ps(vo0x0c4567, _mm_mul_ps(vk01c0x4567, vi0x0c0));
+        const __m128 vi1x0c0 = _mm_load1_ps(i1 + 3);
+        vo0x0c0123 = _mm_add_ps(vo0x0c0123, _mm_mul_ps(vk11c0x0123, vi1x0c0));
+        vo0x0c4567 = _mm_add_ps(vo0x0c4567, _mm_mul_ps(vk11c0x4567, vi1x0c0));
+        const __m128 vi2x0c0 = _mm_load1_ps(i2 + 3);
+        vo0x0c0123 = _mm_add_ps(vo0x0c0123, _mm_mul_ps(vk21c0x0123, vi2x0c0));
+        vo0x0c4567 = _mm_add_ps(vo0x0c4567, _mm_mul_ps(vk21c0x4567, vi2x0c0));
+        vo1x0c0123 = _mm_add_ps(vo1x0c0123, _mm_mul_ps(vk01c0x0123, vi2x0c0));
+        vo1x0c4567 = _mm_add_ps(vo1x0c4567, _mm_mul_ps(vk01c0x4567, vi2x0c0));
+        const __m128 vi3x0c0 = _mm_load1_ps(i3 + 3);
+        vo1x0c0123 = _mm_add_ps(vo1x0c0123, _mm_mul_ps(vk11c0x0123, vi3x0c0));
+        vo1x0c4567 = _mm_add_ps(vo1x0c4567, _mm_mul_ps(vk11c0x4567, vi3x0c0));
+        const __m128 vi4x0c0 = _mm_load1_ps(i4 + 3);
+        vo1x0c0123 = _mm_add_ps(vo1x0c0123, _mm_mul_ps(vk21c0x0123, vi4x0c0));
+        vo1x0c4567 = _mm_add_ps(vo1x0c4567, _mm_mul_ps(vk21c0x4567, vi4x0c0));
+
+        const __m128 vk02c0x0123 = _mm_load_ps(w + 152);
+        const __m128 vk02c0x4567 = _mm_load_ps(w + 156);
+        const __m128 vk12c0x0123 = _mm_load_ps(w + 160);
+        const __m128 vk12c0x4567 = _mm_load_ps(w + 164);
+        const __m128 vk22c0x0123 = _mm_load_ps(w + 168);
+        const __m128 vk22c0x4567 = _mm_load_ps(w + 172);
+        const __m128 vk00c0x0123 = _mm_load_ps(w + 8);
+        const __m128 vk00c0x4567 = _mm_load_ps(w + 12);
+        const __m128 vk10c0x0123 = _mm_load_ps(w + 16);
+        const __m128 vk10c0x4567 = _mm_load_ps(w + 20);
+        const __m128 vk20c0x0123 = _mm_load_ps(w + 24);
+        const __m128 vk20c0x4567 = _mm_load_ps(w + 28);
+
+        const __m128 vi0x1c0 = _mm_load1_ps(i0 + 6);
+        vo0x0c0123 = _mm_add_ps(vo0x0c0123, _mm_mul_ps(vk02c0x0123, vi0x1c0));
+        vo0x0c4567 = _mm_add_ps(vo0x0c4567, _mm_mul_ps(vk02c0x4567, vi0x1c0));
+        vo0x1c0123 = _mm_add_ps(vo0x1c0123, _mm_mul_ps(vk00c0x0123, vi0x1c0));
+        vo0x1c4567 = _mm_add_ps(vo0x1c4567, _mm_mul_ps(vk00c0x4567, vi0x1c0));
+        const __m128 vi1x1c0 = _mm_load1_ps(i1 + 6);
+        vo0x0c0123 = _mm_add_ps(vo0x0c0123, _mm_mul_ps(vk12c0x0123, vi1x1c0));
+        vo0x0c4567 = _mm_add_ps(vo0x0c4567, _mm_mul_ps(vk12c0x4567, vi1x1c0));
+        vo0x1c0123 = _mm_add_ps(vo0x1c0123, _mm_mul_ps(vk10c0x0123, vi1x1c0));
+        vo0x1c4567 = _mm_add_ps(vo0x1c4567, _mm_mul_ps(vk10c0x4567, vi1x1c0));
+        const __m128 vi2x1c0 = _mm_load1_ps(i2 + 6);
+        vo0x0c0123 = _mm_add_ps(vo0x0c0123, _mm_mul_ps(vk22c0x0123, vi2x1c0));
+        vo0x0c4567 = _mm_add_ps(vo0x0c4567, _mm_mul_ps(vk22c0x4567, vi2x1c0));
+        vo0x1c0123 = _mm_add_ps(vo0x1c0123, _mm_mul_ps(vk20c0x0123, vi2x1c0));
+        vo0x1c4567 = _mm_add_ps(vo0x1c4567, _mm_mul_ps(vk20c0x4567, vi2x1c0));
+        vo1x0c0123 = _mm_add_ps(vo1x0c0123, _mm_mul_ps(vk02c0x0123, vi2x1c0));
+        vo1x0c4567 = _mm_add_ps(vo1x0c4567, _mm_mul_ps(vk02c0x4567, vi2x1c0));
+        vo1x1c0123 = _mm_add_ps(vo1x1c0123, _mm_mul_ps(vk00c0x0123, vi2x1c0));
+        vo1x1c4567 = _mm_add_ps(vo1x1c4567, _mm_mul_ps(vk00c0x4567, vi2x1c0));
+        const __m128 vi3x1c0 = _mm_load1_ps(i3 + 6);
+        vo1x0c0123 = _mm_add_ps(vo1x0c0123, _mm_mul_ps(vk12c0x0123, vi3x1c0));
+        vo1x0c4567 = _mm_add_ps(vo1x0c4567, _mm_mul_ps(vk12c0x4567, vi3x1c0));
+        vo1x1c0123 = _mm_add_ps(vo1x1c0123, _mm_mul_ps(vk10c0x0123, vi3x1c0));
+        vo1x1c4567 = _mm_add_ps(vo1x1c4567, _mm_mul_ps(vk10c0x4567, vi3x1c0));
+        const __m128 vi4x1c0 = _mm_load1_ps(i4 + 6);
+        vo1x0c0123 = _mm_add_ps(vo1x0c0123, _mm_mul_ps(vk22c0x0123, vi4x1c0));
+        vo1x0c4567 = _mm_add_ps(vo1x0c4567, _mm_mul_ps(vk22c0x4567, vi4x1c0));
+        vo1x1c0123 = _mm_add_ps(vo1x1c0123, _mm_mul_ps(vk20c0x0123, vi4x1c0));
+        vo1x1c4567 = _mm_add_ps(vo1x1c4567, _mm_mul_ps(vk20c0x4567, vi4x1c0));
+        const __m128 vk01c1x0123 = _mm_load_ps(w + 104);
+        const __m128 vk01c1x4567 = _mm_load_ps(w + 108);
+        const __m128 vk11c1x0123 = _mm_load_ps(w + 112);
+        const __m128 vk11c1x4567 = _mm_load_ps(w + 116);
+        const __m128 vk21c1x0123 = _mm_load_ps(w + 120);
+        const __m128 vk21c1x4567 = _mm_load_ps(w + 124);
+
+        const __m128 vi0x0c1 = _mm_load1_ps(i0 + 4);
+        vo0x0c0123 = _mm_add_ps(vo0x0c0123, _mm_mul_ps(vk01c1x0123, vi0x0c1));
+        vo0x0c4567 = _mm_add_ps(vo0x0c4567, _mm_mul_ps(vk01c1x4567, vi0x0c1));
+        const __m128 vi1x0c1 = _mm_load1_ps(i1 + 4);
+        vo0x0c0123 = _mm_add_ps(vo0x0c0123, _mm_mul_ps(vk11c1x0123, vi1x0c1));
+        vo0x0c4567 = _mm_add_ps(vo0x0c4567, _mm_mul_ps(vk11c1x4567, vi1x0c1));
+        const __m128 vi2x0c1 = _mm_load1_ps(i2 + 4);
+        vo0x0c0123 = _mm_add_ps(vo0x0c0123, _mm_mul_ps(vk21c1x0123, vi2x0c1));
+        vo0x0c4567 = _mm_add_ps(vo0x0c4567, _mm_mul_ps(vk21c1x4567, vi2x0c1));
+        vo1x0c0123 = _mm_add_ps(vo1x0c0123, _mm_mul_ps(vk01c1x0123, vi2x0c1));
+        vo1x0c4567 = _mm_add_ps(vo1x0c4567, _mm_mul_ps(vk01c1x4567, vi2x0c1));
+        const __m128 vi3x0c1 = _mm_load1_ps(i3 + 4);
+        vo1x0c0123 = _mm_add_ps(vo1x0c0123, _mm_mul_ps(vk11c1x0123, vi3x0c1));
+        vo1x0c4567 = _mm_add_ps(vo1x0c4567, _mm_mul_ps(vk11c1x4567, vi3x0c1));
+        const __m128 vi4x0c1 = _mm_load1_ps(i4 + 4);
+        vo1x0c0123 = _mm_add_ps(vo1x0c0123, _mm_mul_ps(vk21c1x0123, vi4x0c1));
+        vo1x0c4567 = _mm_add_ps(vo1x0c4567, _mm_mul_ps(vk21c1x4567, vi4x0c1));
+
+        const __m128 vk02c1x0123 = _mm_load_ps(w + 176);
+        const __m128 vk02c1x4567 = _mm_load_ps(w + 180);
+        const __m128 vk12c1x0123 = _mm_load_ps(w + 184);
+        const __m128 vk12c1x4567 = _mm_load_ps(w + 188);
+        const __m128 vk22c1x0123 = _mm_load_ps(w + 192);
+        const __m128 vk22c1x4567 = _mm_load_ps(w + 196);
+        const __m128 vk00c1x0123 = _mm_load_ps(w + 32);
+        const __m128 vk00c1x4567 = _mm_load_ps(w + 36);
+        const __m128 vk10c1x0123 = _mm_load_ps(w + 40);
+        const __m128 vk10c1x4567 = _mm_load_ps(w + 44);
+        const __m128 vk20c1x0123 = _mm_load_ps(w + 48);
+        const __m128 vk20c1x4567 = _mm_load_ps(w + 52);
+
+        const __m128 vi0x1c1 = _mm_load1_ps(i0 + 7);
+        vo0x0c0123 = _mm_add_ps(vo0x0c0123, _mm_mul_ps(vk02c1x0123, vi0x1c1));
+        vo0x0c4567 = _mm_add_ps(vo0x0c4567, _mm_mul_ps(vk02c1x4567, vi0x1c1));
+        vo0x1c0123 = _mm_add_ps(vo0x1c0123, _mm_mul_ps(vk00c1x0123, vi0x1c1));
+        vo0x1c4567 = _mm_add_ps(vo0x1c4567, _mm_mul_ps(vk00c1x4567, vi0x1c1));
+        const __m128 vi1x1c1 = _mm_load1_ps(i1 + 7);
+        vo0x0c0123 = _mm_add_ps(vo0x0c0123, _mm_mul_ps(vk12c1x0123, vi1x1c1));
+        vo0x0c4567 = _mm_add_ps(vo0x0c4567, _mm_mul_ps(vk12c1x4567, vi1x1c1));
+        vo0x1c0123 = _mm_add_ps(vo0x1c0123, _mm_mul_ps(vk10c1x0123, vi1x1c1));
+        vo0x1c4567 = _mm_add_ps(vo0x1c4567, _mm_mul_ps(vk10c1x4567, vi1x1c1));
+        const __m128 vi2x1c1 = _mm_load1_ps(i2 + 7);
+        vo0x0c0123 = _mm_add_ps(vo0x0c0123, _mm_mul_ps(vk22c1x0123, vi2x1c1));
+        vo0x0c4567 = _mm_add_ps(vo0x0c4567, _mm_mul_ps(vk22c1x4567, vi2x1c1));
+        vo0x1c0123 = _mm_add_ps(vo0x1c0123, _mm_mul_ps(vk20c1x0123, vi2x1c1));
+        vo0x1c4567 = _mm_add_ps(vo0x1c4567, _mm_mul_ps(vk20c1x4567, vi2x1c1));
+        vo1x0c0123 = _mm_add_ps(vo1x0c0123, _mm_mul_ps(vk02c1x0123, vi2x1c1));
+        vo1x0c4567 = _mm_add_ps(vo1x0c4567, _mm_mul_ps(vk02c1x4567, vi2x1c1));
+        vo1x1c0123 = _mm_add_ps(vo1x1c0123, _mm_mul_ps(vk00c1x0123, vi2x1c1));
+        vo1x1c4567 = _mm_add_ps(vo1x1c4567, _mm_mul_ps(vk00c1x4567, vi2x1c1));
+        const __m128 vi3x1c1 = _mm_load1_ps(i3 + 7);
+        vo1x0c0123 = _mm_add_ps(vo1x0c0123, _mm_mul_ps(vk12c1x0123, vi3x1c1));
+        vo1x0c4567 = _mm_add_ps(vo1x0c4567, _mm_mul_ps(vk12c1x4567, vi3x1c1));
+        vo1x1c0123 = _mm_add_ps(vo1x1c0123, _mm_mul_ps(vk10c1x0123, vi3x1c1));
+        vo1x1c4567 = _mm_add_ps(vo1x1c4567, _mm_mul_ps(vk10c1x4567, vi3x1c1));
+        const __m128 vi4x1c1 = _mm_load1_ps(i4 + 7);
+        vo1x0c0123 = _mm_add_ps(vo1x0c0123, _mm_mul_ps(vk22c1x0123, vi4x1c1));
+        vo1x0c4567 = _mm_add_ps(vo1x0c4567, _mm_mul_ps(vk22c1x4567, vi4x1c1));
+        vo1x1c0123 = _mm_add_ps(vo1x1c0123, _mm_mul_ps(vk20c1x0123, vi4x1c1));
+        vo1x1c4567 = _mm_add_ps(vo1x1c4567, _mm_mul_ps(vk20c1x4567, vi4x1c1));
+        const __m128 vk01c2x0123 = _mm_load_ps(w + 128);
+        const __m128 vk01c2x4567 = _mm_load_ps(w + 132);
+        const __m128 vk11c2x0123 = _mm_load_ps(w + 136);
+        const __m128 vk11c2x4567 = _mm_load_ps(w + 140);
+        const __m128 vk21c2x0123 = _mm_load_ps(w + 144);
+        const __m128 vk21c2x4567 = _mm_load_ps(w + 148);
+
+        const __m128 vi0x0c2 = _mm_load1_ps(i0 + 5);
+        vo0x0c0123 = _mm_add_ps(vo0x0c0123, _mm_mul_ps(vk01c2x0123, vi0x0c2));
+        vo0x0c4567 = _mm_add_ps(vo0x0c4567, _mm_mul_ps(vk01c2x4567, vi0x0c2));
+        const __m128 vi1x0c2 = _mm_load1_ps(i1 + 5);
+        vo0x0c0123 = _mm_add_ps(vo0x0c0123, _mm_mul_ps(vk11c2x0123, vi1x0c2));
+        vo0x0c4567 = _mm_add_ps(vo0x0c4567, _mm_mul_ps(vk11c2x4567, vi1x0c2));
+        const __m128 vi2x0c2 = _mm_load1_ps(i2 + 5);
+        vo0x0c0123 = _mm_add_ps(vo0x0c0123, _mm_mul_ps(vk21c2x0123, vi2x0c2));
+        vo0x0c4567 = _mm_add_ps(vo0x0c4567, _mm_mul_ps(vk21c2x4567, vi2x0c2));
+        vo1x0c0123 = _mm_add_ps(vo1x0c0123, _mm_mul_ps(vk01c2x0123, vi2x0c2));
+        vo1x0c4567 = _mm_add_ps(vo1x0c4567, _mm_mul_ps(vk01c2x4567, vi2x0c2));
+        const __m128 vi3x0c2 = _mm_load1_ps(i3 + 5);
+        vo1x0c0123 = _mm_add_ps(vo1x0c0123, _mm_mul_ps(vk11c2x0123, vi3x0c2));
+        vo1x0c4567 = _mm_add_ps(vo1x0c4567, _mm_mul_ps(vk11c2x4567, vi3x0c2));
+        const __m128 vi4x0c2 = _mm_load1_ps(i4 + 5);
+        vo1x0c0123 = _mm_add_ps(vo1x0c0123, _mm_mul_ps(vk21c2x0123, vi4x0c2));
+        vo1x0c4567 = _mm_add_ps(vo1x0c4567, _mm_mul_ps(vk21c2x4567, vi4x0c2));
+
+        const __m128 vk02c2x0123 = _mm_load_ps(w + 200);
+        const __m128 vk02c2x4567 = _mm_load_ps(w + 204);
+        const __m128 vk12c2x0123 = _mm_load_ps(w + 208);
+        const __m128 vk12c2x4567 = _mm_load_ps(w + 212);
+        const __m128 vk22c2x0123 = _mm_load_ps(w + 216);
+        const __m128 vk22c2x4567 = _mm_load_ps(w + 220);
+        const __m128 vk00c2x0123 = _mm_load_ps(w + 56);
+        const __m128 vk00c2x4567 = _mm_load_ps(w + 60);
+        const __m128 vk10c2x0123 = _mm_load_ps(w + 64);
+        const __m128 vk10c2x4567 = _mm_load_ps(w + 68);
+        const __m128 vk20c2x0123 = _mm_load_ps(w + 72);
+        const __m128 vk20c2x4567 = _mm_load_ps(w + 76);
+
+        const __m128 vi0x1c2 = _mm_load1_ps(i0 + 8);
+        vo0x0c0123 = _mm_add_ps(vo0x0c0123, _mm_mul_ps(vk02c2x0123, vi0x1c2));
+        vo0x0c4567 = _mm_add_ps(vo0x0c4567, _mm_mul_ps(vk02c2x4567, vi0x1c2));
+        vo0x1c0123 = _mm_add_ps(vo0x1c0123, _mm_mul_ps(vk00c2x0123, vi0x1c2));
+        vo0x1c4567 = _mm_add_ps(vo0x1c4567, _mm_mul_ps(vk00c2x4567, vi0x1c2));
+        const __m128 vi1x1c2 = _mm_load1_ps(i1 + 8);
+        vo0x0c0123 = _mm_add_ps(vo0x0c0123, _mm_mul_ps(vk12c2x0123, vi1x1c2));
+        vo0x0c4567 = _mm_add_ps(vo0x0c4567, _mm_mul_ps(vk12c2x4567, vi1x1c2));
+        vo0x1c0123 = _mm_add_ps(vo0x1c0123, _mm_mul_ps(vk10c2x0123, vi1x1c2));
+        vo0x1c4567 = _mm_add_ps(vo0x1c4567, _mm_mul_ps(vk10c2x4567, vi1x1c2));
+        const __m128 vi2x1c2 = _mm_load1_ps(i2 + 8);
+        vo0x0c0123 = _mm_add_ps(vo0x0c0123, _mm_mul_ps(vk22c2x0123, vi2x1c2));
+        vo0x0c4567 = _mm_add_ps(vo0x0c4567, _mm_mul_ps(vk22c2x4567, vi2x1c2));
+        vo0x1c0123 = _mm_add_ps(vo0x1c0123, _mm_mul_ps(vk20c2x0123, vi2x1c2));
+        vo0x1c4567 = _mm_add_ps(vo0x1c4567, _mm_mul_ps(vk20c2x4567, vi2x1c2));
+        vo1x0c0123 = _mm_add_ps(vo1x0c0123, _mm_mul_ps(vk02c2x0123, vi2x1c2));
+        vo1x0c4567 = _mm_add_ps(vo1x0c4567, _mm_mul_ps(vk02c2x4567, vi2x1c2));
+        vo1x1c0123 = _mm_add_ps(vo1x1c0123, _mm_mul_ps(vk00c2x0123, vi2x1c2));
+        vo1x1c4567 = _mm_add_ps(vo1x1c4567, _mm_mul_ps(vk00c2x4567, vi2x1c2));
+        const __m128 vi3x1c2 = _mm_load1_ps(i3 + 8);
+        vo1x0c0123 = _mm_add_ps(vo1x0c0123, _mm_mul_ps(vk12c2x0123, vi3x1c2));
+        vo1x0c4567 = _mm_add_ps(vo1x0c4567, _mm_mul_ps(vk12c2x4567, vi3x1c2));
+        vo1x1c0123 = _mm_add_ps(vo1x1c0123, _mm_mul_ps(vk10c2x0123, vi3x1c2));
+        vo1x1c4567 = _mm_add_ps(vo1x1c4567, _mm_mul_ps(vk10c2x4567, vi3x1c2));
+        const __m128 vi4x1c2 = _mm_load1_ps(i4 + 8);
+        vo1x0c0123 = _mm_add_ps(vo1x0c0123, _mm_mul_ps(vk22c2x0123, vi4x1c2));
+        vo1x0c4567 = _mm_add_ps(vo1x0c4567, _mm_mul_ps(vk22c2x4567, vi4x1c2));
+        vo1x1c0123 = _mm_add_ps(vo1x1c0123, _mm_mul_ps(vk20c2x0123, vi4x1c2));
+        vo1x1c4567 = _mm_add_ps(vo1x1c4567, _mm_mul_ps(vk20c2x4567, vi4x1c2));
+
+        i0 += 6;
+        i1 += 6;
+        i2 += 6;
+        i3 += 6;
+        i4 += 6;
+
+        vo0x0c0123 = _mm_max_ps(vo0x0c0123, vmin);
+        vo0x0c4567 = _mm_max_ps(vo0x0c4567, vmin);
+        vo1x0c0123 = _mm_max_ps(vo1x0c0123, vmin);
+        vo1x0c4567 = _mm_max_ps(vo1x0c4567, vmin);
+        vo0x0c0123 = _mm_min_ps(vo0x0c0123, vmax);
+        vo0x0c4567 = _mm_min_ps(vo0x0c4567, vmax);
+        vo1x0c0123 = _mm_min_ps(vo1x0c0123, vmax);
+        vo1x0c4567 = _mm_min_ps(vo1x0c4567, vmax);
+
+        if XNN_LIKELY(c >= 8) {
+          _mm_storeu_ps(o1, vo1x0c0123);
+          _mm_storeu_ps(o1 + 4, vo1x0c4567);
+          o1 = (float*) ((uintptr_t) o1 + output_width_stride);
+          _mm_storeu_ps(o0, vo0x0c0123);
+          _mm_storeu_ps(o0 + 4, vo0x0c4567);
+          o0 = (float*) ((uintptr_t) o0 + output_width_stride);
+        } else {
+          float* o1_tmp = o1;
+          float* o0_tmp = o0;
+          if (c & 4) {
+            _mm_storeu_ps((float*) ((uintptr_t) o1_tmp + output_width_stride * 0) + 0, vo1x0c0123);
+            _mm_storeu_ps((float*) ((uintptr_t) o0_tmp + output_width_stride * 0) + 0, vo0x0c0123);
+            o1_tmp += 4;
+            o0_tmp += 4;
+            vo0x0c0123 = vo0x0c4567;
+            vo1x0c0123 = vo1x0c4567;
+          }
+          if (c & 2) {
+            _mm_storel_pi((__m64*) ((uintptr_t) o1_tmp + output_width_stride * 0), vo1x0c0123);
+            _mm_storel_pi((__m64*) ((uintptr_t) o0_tmp + output_width_stride * 0), vo0x0c0123);
+            o1_tmp += 2;
+            o0_tmp += 2;
+            vo0x0c0123 = _mm_movehl_ps(vo0x0c0123, vo0x0c0123);
+            vo1x0c0123 = _mm_movehl_ps(vo1x0c0123, vo1x0c0123);
+          }
+          if (c & 1) {
+            _mm_store_ss((float*) ((uintptr_t) o1_tmp + output_width_stride * 0), vo1x0c0123);
+            _mm_store_ss((float*) ((uintptr_t) o0_tmp + output_width_stride * 0), vo0x0c0123);
+          }
+          o1 = (float*) ((uintptr_t) o1 + output_width_stride);
+          o0 = (float*) ((uintptr_t) o0 + output_width_stride);
+        }
+
+        vo0x0c0123 = vo0x1c0123;
+        vo0x0c4567 = vo0x1c4567;
+        vo1x0c0123 = vo1x1c0123;
+        vo1x0c4567 = vo1x1c4567;
+      }
+      assert(iw < 2);
+      if XNN_UNLIKELY(iw != 0) {
+        // The last input column contributes through the center column of the kernel; the right column is padding.
+        const __m128 vk01c0x0123 = _mm_load_ps(w + 80);
+        const __m128 vk01c0x4567 = _mm_load_ps(w + 84);
+        const __m128 vk11c0x0123 = _mm_load_ps(w + 88);
+        const __m128 vk11c0x4567 = _mm_load_ps(w + 92);
+        const __m128 vk21c0x0123 = _mm_load_ps(w + 96);
+        const __m128 vk21c0x4567 = _mm_load_ps(w + 100);
+
+        const __m128 vi0x0c0 = _mm_load1_ps(i0 + 3);
+        vo0x0c0123 = _mm_add_ps(vo0x0c0123, _mm_mul_ps(vk01c0x0123, vi0x0c0));
+        vo0x0c4567 = _mm_add_ps(vo0x0c4567, _mm_mul_ps(vk01c0x4567, vi0x0c0));
+        const __m128 vi1x0c0 = _mm_load1_ps(i1 + 3);
+        vo0x0c0123 = _mm_add_ps(vo0x0c0123, _mm_mul_ps(vk11c0x0123, vi1x0c0));
+        vo0x0c4567 = _mm_add_ps(vo0x0c4567, _mm_mul_ps(vk11c0x4567, vi1x0c0));
+        const __m128 vi2x0c0 = _mm_load1_ps(i2 + 3);
+        vo0x0c0123 = _mm_add_ps(vo0x0c0123, _mm_mul_ps(vk21c0x0123, vi2x0c0));
+        vo0x0c4567 = _mm_add_ps(vo0x0c4567, _mm_mul_ps(vk21c0x4567, vi2x0c0));
+        vo1x0c0123 = _mm_add_ps(vo1x0c0123, _mm_mul_ps(vk01c0x0123, vi2x0c0));
+        vo1x0c4567 = _mm_add_ps(vo1x0c4567, _mm_mul_ps(vk01c0x4567, vi2x0c0));
+        const __m128 vi3x0c0 = _mm_load1_ps(i3 + 3);
+        vo1x0c0123 = _mm_add_ps(vo1x0c0123, _mm_mul_ps(vk11c0x0123, vi3x0c0));
+        vo1x0c4567 = _mm_add_ps(vo1x0c4567, _mm_mul_ps(vk11c0x4567, vi3x0c0));
+        const __m128 vi4x0c0 = _mm_load1_ps(i4 + 3);
+        vo1x0c0123 = _mm_add_ps(vo1x0c0123, _mm_mul_ps(vk21c0x0123, vi4x0c0));
+        vo1x0c4567 = _mm_add_ps(vo1x0c4567, _mm_mul_ps(vk21c0x4567, vi4x0c0));
+        const __m128 vk01c1x0123 = _mm_load_ps(w + 104);
+        const __m128 vk01c1x4567 = _mm_load_ps(w + 108);
+        const __m128 vk11c1x0123 = _mm_load_ps(w + 112);
+        const __m128 vk11c1x4567 = _mm_load_ps(w + 116);
+        const __m128 vk21c1x0123 = _mm_load_ps(w + 120);
+        const __m128 vk21c1x4567 = _mm_load_ps(w + 124);
+
+        const __m128 vi0x0c1 = _mm_load1_ps(i0 + 4);
+        vo0x0c0123 = _mm_add_ps(vo0x0c0123, _mm_mul_ps(vk01c1x0123, vi0x0c1));
+        vo0x0c4567 = _mm_add_ps(vo0x0c4567, _mm_mul_ps(vk01c1x4567, vi0x0c1));
+        const __m128 vi1x0c1 = _mm_load1_ps(i1 + 4);
+        vo0x0c0123 = _mm_add_ps(vo0x0c0123, _mm_mul_ps(vk11c1x0123, vi1x0c1));
+        vo0x0c4567 = _mm_add_ps(vo0x0c4567, _mm_mul_ps(vk11c1x4567, vi1x0c1));
+        const __m128 vi2x0c1 = _mm_load1_ps(i2 + 4);
+        vo0x0c0123 = _mm_add_ps(vo0x0c0123, _mm_mul_ps(vk21c1x0123, vi2x0c1));
+        vo0x0c4567 = _mm_add_ps(vo0x0c4567, _mm_mul_ps(vk21c1x4567, vi2x0c1));
+        vo1x0c0123 = _mm_add_ps(vo1x0c0123, _mm_mul_ps(vk01c1x0123, vi2x0c1));
+        vo1x0c4567 = _mm_add_ps(vo1x0c4567, _mm_mul_ps(vk01c1x4567, vi2x0c1));
+        const __m128 vi3x0c1 = _mm_load1_ps(i3 + 4);
+        vo1x0c0123 = _mm_add_ps(vo1x0c0123, _mm_mul_ps(vk11c1x0123, vi3x0c1));
+        vo1x0c4567 = _mm_add_ps(vo1x0c4567, _mm_mul_ps(vk11c1x4567, vi3x0c1));
+        const __m128 vi4x0c1 = _mm_load1_ps(i4 + 4);
+        vo1x0c0123 = _mm_add_ps(vo1x0c0123, _mm_mul_ps(vk21c1x0123, vi4x0c1));
+        vo1x0c4567 = _mm_add_ps(vo1x0c4567, _mm_mul_ps(vk21c1x4567, vi4x0c1));
+        const __m128 vk01c2x0123 = _mm_load_ps(w + 128);
+        const __m128 vk01c2x4567 = _mm_load_ps(w + 132);
+        const __m128 vk11c2x0123 = _mm_load_ps(w + 136);
+        const __m128 vk11c2x4567 = _mm_load_ps(w + 140);
+        const __m128 vk21c2x0123 = _mm_load_ps(w + 144);
+        const __m128 vk21c2x4567 = _mm_load_ps(w + 148);
+
+        const __m128 vi0x0c2 = _mm_load1_ps(i0 + 5);
+        vo0x0c0123 = _mm_add_ps(vo0x0c0123, _mm_mul_ps(vk01c2x0123, vi0x0c2));
+        vo0x0c4567 = _mm_add_ps(vo0x0c4567, _mm_mul_ps(vk01c2x4567, vi0x0c2));
+        const __m128 vi1x0c2 = _mm_load1_ps(i1 + 5);
+        vo0x0c0123 = _mm_add_ps(vo0x0c0123, _mm_mul_ps(vk11c2x0123, vi1x0c2));
+        vo0x0c4567 = _mm_add_ps(vo0x0c4567, _mm_mul_ps(vk11c2x4567, vi1x0c2));
+        const __m128 vi2x0c2 = _mm_load1_ps(i2 + 5);
+        vo0x0c0123 = _mm_add_ps(vo0x0c0123, _mm_mul_ps(vk21c2x0123, vi2x0c2));
+        vo0x0c4567 = _mm_add_ps(vo0x0c4567, _mm_mul_ps(vk21c2x4567, vi2x0c2));
+        vo1x0c0123 = _mm_add_ps(vo1x0c0123, _mm_mul_ps(vk01c2x0123, vi2x0c2));
+        vo1x0c4567 = _mm_add_ps(vo1x0c4567, _mm_mul_ps(vk01c2x4567, vi2x0c2));
+        const __m128 vi3x0c2 = _mm_load1_ps(i3 + 5);
+        vo1x0c0123 = _mm_add_ps(vo1x0c0123, _mm_mul_ps(vk11c2x0123, vi3x0c2));
+        vo1x0c4567 = _mm_add_ps(vo1x0c4567, _mm_mul_ps(vk11c2x4567, vi3x0c2));
+        const __m128 vi4x0c2 = _mm_load1_ps(i4 + 5);
+        vo1x0c0123 = _mm_add_ps(vo1x0c0123, _mm_mul_ps(vk21c2x0123, vi4x0c2));
+        vo1x0c4567 = _mm_add_ps(vo1x0c4567, _mm_mul_ps(vk21c2x4567, vi4x0c2));
+
+        vo0x0c0123 = _mm_max_ps(vo0x0c0123, vmin);
+        vo0x0c4567 = _mm_max_ps(vo0x0c4567, vmin);
+        vo1x0c0123 = _mm_max_ps(vo1x0c0123, vmin);
+        vo1x0c4567 = _mm_max_ps(vo1x0c4567, vmin);
+        vo0x0c0123 = _mm_min_ps(vo0x0c0123, vmax);
+        vo0x0c4567 = _mm_min_ps(vo0x0c4567, vmax);
+        vo1x0c0123 = _mm_min_ps(vo1x0c0123, vmax);
+        vo1x0c4567 = _mm_min_ps(vo1x0c4567, vmax);
+
+        if XNN_LIKELY(c >= 8) {
+          _mm_storeu_ps(o1, vo1x0c0123);
+          _mm_storeu_ps(o1 + 4, vo1x0c4567);
+          _mm_storeu_ps(o0, vo0x0c0123);
+          _mm_storeu_ps(o0 + 4, vo0x0c4567);
+        } else {
+          float* o1_tmp = o1;
+          float* o0_tmp = o0;
+          if (c & 4) {
+            _mm_storeu_ps(o1_tmp + 0, vo1x0c0123);
+            _mm_storeu_ps(o0_tmp + 0, vo0x0c0123);
+            o1_tmp += 4;
+            o0_tmp += 4;
+            vo0x0c0123 = vo0x0c4567;
+            vo1x0c0123 = vo1x0c4567;
+          }
+          if (c & 2) {
+            _mm_storel_pi((__m64*) o1_tmp, vo1x0c0123);
+            _mm_storel_pi((__m64*) o0_tmp, vo0x0c0123);
+            o1_tmp += 2;
+            o0_tmp += 2;
+            vo0x0c0123 = _mm_movehl_ps(vo0x0c0123, vo0x0c0123);
+            vo1x0c0123 = _mm_movehl_ps(vo1x0c0123, vo1x0c0123);
+          }
+          if (c & 1) {
+            _mm_store_ss(o1_tmp, vo1x0c0123);
+            _mm_store_ss(o0_tmp, vo0x0c0123);
+          }
+        }
+        o1 = (float*) ((uintptr_t) o1 + output_width_stride);
+        o0 = (float*) ((uintptr_t) o0 + output_width_stride);
+      }
+      // Move output pointers back to the position of the first pixel in a row,
+      // and forward to the next block of output channels
+      o0 = (float*) ((uintptr_t) o0 - output_channel_decrement);
+      o1 = (float*) ((uintptr_t) o1 - output_channel_decrement);
+      // Revert input pointers to the position of the first pixel in a row
+      i0 = (const float*) ((uintptr_t) i0 - input_width_decrement);
+      i1 = (const float*) ((uintptr_t) i1 - input_width_decrement);
+      i2 = (const float*) ((uintptr_t) i2 - input_width_decrement);
+      i3 = (const float*) ((uintptr_t) i3 - input_width_decrement);
+      i4 = (const float*) ((uintptr_t) i4 - input_width_decrement);
+      // Move to the block of weights for the next 8 output channels
+      w += 224;
+      c = doz(c, 8);
+    } while (c != 0);
+    // Move output pointers back to the position of the first channel, and forward to the next block of rows
+    o0 = (float*) ((uintptr_t) o0 + output_height_increment);
+    o1 = (float*) ((uintptr_t) o1 + output_height_increment);
+    // Move input pointers forward to the next four rows
+    i0 = i4;
+    i1 = (const float*) ((uintptr_t) i0 + input_height_stride);
+    i2 = (const float*) ((uintptr_t) i1 + input_height_stride);
+    i3 = (const float*) ((uintptr_t) i2 + input_height_stride);
+    i4 = (const float*) ((uintptr_t) i3 + input_height_stride);
+  }
+}
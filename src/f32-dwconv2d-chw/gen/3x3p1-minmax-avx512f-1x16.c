@@ -0,0 +1,202 @@
+// Auto-generated file. Do not edit!
+//   Template: src/f32-dwconv2d-chw/3x3p1-avx512f.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <immintrin.h>
+
+#include <xnnpack/dwconv.h>
+#include <xnnpack/intrinsics-polyfill.h>
+#include <xnnpack/math.h>
+
+
+void xnn_f32_dwconv2d_chw_ukernel_3x3p1__avx512f_1x16(
+    size_t input_height,
+    size_t input_width,
+    const float* input,
+    const float* weights,
+    const float* zero,
+    float* output,
+    uint32_t padding_top,
+    const union xnn_f32_chw_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(input_height != 0);
+  assert(input_width != 0);
+  assert(input_width % sizeof(float) == 0);
+  assert(padding_top == 1);
+
+  // Mask of the valid pixels in the last block of 1..16 pixels of each row.
+  const __mmask16 vmask = _cvtu32_mask16(UINT32_C(0xFFFF) >> (15 - (((input_width - 1 * sizeof(float)) / sizeof(float)) & 15)));
+  const __mmask16 vmask_first = input_width > 16 * sizeof(float) ? _cvtu32_mask16(UINT32_C(0xFFFF)) : vmask;
+  const __m512 vmax = _mm512_set1_ps(params->sse.max[0]);
+  const __m512 vmin = _mm512_set1_ps(params->sse.min[0]);
+
+  const __m512 vbias = _mm512_set1_ps(weights[0]);
+  const __m512 vk00 = _mm512_set1_ps(weights[1]);
+  const __m512 vk01 = _mm512_set1_ps(weights[2]);
+  const __m512 vk02 = _mm512_set1_ps(weights[3]);
+  const __m512 vk10 = _mm512_set1_ps(weights[4]);
+  const __m512 vk11 = _mm512_set1_ps(weights[5]);
+  const __m512 vk12 = _mm512_set1_ps(weights[6]);
+  const __m512 vk20 = _mm512_set1_ps(weights[7]);
+  const __m512 vk21 = _mm512_set1_ps(weights[8]);
+  const __m512 vk22 = _mm512_set1_ps(weights[9]);
+
+  const size_t input_decrement = round_up_po2(input_width, 16 * sizeof(float));
+
+  const float* i0 = zero;
+  const float* i1 = input;
+  const float* i2 = (const float*) ((uintptr_t) i1 + input_width);
+
+  float* o0 = output;
+
+  size_t output_height = input_height;
+  do {
+    if XNN_UNPREDICTABLE(output_height < 2) {
+      i2 = zero;
+    }
+
+    __m512 vi0x0123456789ABCDEF = _mm512_setzero_ps();
+    __m512 vi1x0123456789ABCDEF = _mm512_setzero_ps();
+    __m512 vi2x0123456789ABCDEF = _mm512_setzero_ps();
+
+    __m512 vi0xGHIJKLMNOPQRSTUV = _mm512_maskz_loadu_ps(vmask_first, i0);
+    i0 += 16;
+    __m512 vi1xGHIJKLMNOPQRSTUV = _mm512_maskz_loadu_ps(vmask_first, i1);
+    i1 += 16;
+    __m512 vi2xGHIJKLMNOPQRSTUV = _mm512_maskz_loadu_ps(vmask_first, i2);
+    i2 += 16;
+
+    size_t w = input_width;
+    for (; w > 32 * sizeof(float); w -= 16 * sizeof(float)) {
+      __m512 vo0p0 = _mm512_fmadd_ps(vi0xGHIJKLMNOPQRSTUV, vk01, vbias);
+      vo0p0 = _mm512_fmadd_ps(vi1xGHIJKLMNOPQRSTUV, vk11, vo0p0);
+      vo0p0 = _mm512_fmadd_ps(vi2xGHIJKLMNOPQRSTUV, vk21, vo0p0);
+
+      const __m512 vi0xWXYZabcdefghijkl = _mm512_loadu_ps(i0);
+      i0 += 16;
+      const __m512 vi1xWXYZabcdefghijkl = _mm512_loadu_ps(i1);
+      i1 += 16;
+      const __m512 vi2xWXYZabcdefghijkl = _mm512_loadu_ps(i2);
+      i2 += 16;
+
+      const __m512 vi0xFGHIJKLMNOPQRSTU = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi0xGHIJKLMNOPQRSTUV), _mm512_castps_si512(vi0x0123456789ABCDEF), 15));
+      const __m512 vi1xFGHIJKLMNOPQRSTU = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi1xGHIJKLMNOPQRSTUV), _mm512_castps_si512(vi1x0123456789ABCDEF), 15));
+      const __m512 vi2xFGHIJKLMNOPQRSTU = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi2xGHIJKLMNOPQRSTUV), _mm512_castps_si512(vi2x0123456789ABCDEF), 15));
+
+      vo0p0 = _mm512_fmadd_ps(vi0xFGHIJKLMNOPQRSTU, vk00, vo0p0);
+      vo0p0 = _mm512_fmadd_ps(vi1xFGHIJKLMNOPQRSTU, vk10, vo0p0);
+      vo0p0 = _mm512_fmadd_ps(vi2xFGHIJKLMNOPQRSTU, vk20, vo0p0);
+
+      const __m512 vi0xHIJKLMNOPQRSTUVW = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi0xWXYZabcdefghijkl), _mm512_castps_si512(vi0xGHIJKLMNOPQRSTUV), 1));
+      vi0x0123456789ABCDEF = vi0xGHIJKLMNOPQRSTUV;
+      vi0xGHIJKLMNOPQRSTUV = vi0xWXYZabcdefghijkl;
+      const __m512 vi1xHIJKLMNOPQRSTUVW = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi1xWXYZabcdefghijkl), _mm512_castps_si512(vi1xGHIJKLMNOPQRSTUV), 1));
+      vi1x0123456789ABCDEF = vi1xGHIJKLMNOPQRSTUV;
+      vi1xGHIJKLMNOPQRSTUV = vi1xWXYZabcdefghijkl;
+      const __m512 vi2xHIJKLMNOPQRSTUVW = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi2xWXYZabcdefghijkl), _mm512_castps_si512(vi2xGHIJKLMNOPQRSTUV), 1));
+      vi2x0123456789ABCDEF = vi2xGHIJKLMNOPQRSTUV;
+      vi2xGHIJKLMNOPQRSTUV = vi2xWXYZabcdefghijkl;
+
+      vo0p0 = _mm512_fmadd_ps(vi0xHIJKLMNOPQRSTUVW, vk02, vo0p0);
+      vo0p0 = _mm512_fmadd_ps(vi1xHIJKLMNOPQRSTUVW, vk12, vo0p0);
+      vo0p0 = _mm512_fmadd_ps(vi2xHIJKLMNOPQRSTUVW, vk22, vo0p0);
+
+
+      __m512 vo0 = _mm512_max_ps(vo0p0, vmin);
+
+      vo0 = _mm512_min_ps(vo0, vmax);
+
+      _mm512_storeu_ps(o0, vo0);
+      o0 += 16;
+    }
+    // Process the next-to-last block of 16 pixels; the last block is loaded with a mask.
+    if XNN_LIKELY(w > 16 * sizeof(float)) {
+      __m512 vo0p0 = _mm512_fmadd_ps(vi0xGHIJKLMNOPQRSTUV, vk01, vbias);
+      vo0p0 = _mm512_fmadd_ps(vi1xGHIJKLMNOPQRSTUV, vk11, vo0p0);
+      vo0p0 = _mm512_fmadd_ps(vi2xGHIJKLMNOPQRSTUV, vk21, vo0p0);
+
+      const __m512 vi0xWXYZabcdefghijkl = _mm512_maskz_loadu_ps(vmask, i0);
+      i0 += 16;
+      const __m512 vi1xWXYZabcdefghijkl = _mm512_maskz_loadu_ps(vmask, i1);
+      i1 += 16;
+      const __m512 vi2xWXYZabcdefghijkl = _mm512_maskz_loadu_ps(vmask, i2);
+      i2 += 16;
+
+      const __m512 vi0xFGHIJKLMNOPQRSTU = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi0xGHIJKLMNOPQRSTUV), _mm512_castps_si512(vi0x0123456789ABCDEF), 15));
+      const __m512 vi1xFGHIJKLMNOPQRSTU = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi1xGHIJKLMNOPQRSTUV), _mm512_castps_si512(vi1x0123456789ABCDEF), 15));
+      const __m512 vi2xFGHIJKLMNOPQRSTU = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi2xGHIJKLMNOPQRSTUV), _mm512_castps_si512(vi2x0123456789ABCDEF), 15));
+
+      vo0p0 = _mm512_fmadd_ps(vi0xFGHIJKLMNOPQRSTU, vk00, vo0p0);
+      vo0p0 = _mm512_fmadd_ps(vi1xFGHIJKLMNOPQRSTU, vk10, vo0p0);
+      vo0p0 = _mm512_fmadd_ps(vi2xFGHIJKLMNOPQRSTU, vk20, vo0p0);
+
+      const __m512 vi0xHIJKLMNOPQRSTUVW = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi0xWXYZabcdefghijkl), _mm512_castps_si512(vi0xGHIJKLMNOPQRSTUV), 1));
+      vi0x0123456789ABCDEF = vi0xGHIJKLMNOPQRSTUV;
+      vi0xGHIJKLMNOPQRSTUV = vi0xWXYZabcdefghijkl;
+      const __m512 vi1xHIJKLMNOPQRSTUVW = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi1xWXYZabcdefghijkl), _mm512_castps_si512(vi1xGHIJKLMNOPQRSTUV), 1));
+      vi1x0123456789ABCDEF = vi1xGHIJKLMNOPQRSTUV;
+      vi1xGHIJKLMNOPQRSTUV = vi1xWXYZabcdefghijkl;
+      const __m512 vi2xHIJKLMNOPQRSTUVW = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi2xWXYZabcdefghijkl), _mm512_castps_si512(vi2xGHIJKLMNOPQRSTUV), 1));
+      vi2x0123456789ABCDEF = vi2xGHIJKLMNOPQRSTUV;
+      vi2xGHIJKLMNOPQRSTUV = vi2xWXYZabcdefghijkl;
+
+      vo0p0 = _mm512_fmadd_ps(vi0xHIJKLMNOPQRSTUVW, vk02, vo0p0);
+      vo0p0 = _mm512_fmadd_ps(vi1xHIJKLMNOPQRSTUVW, vk12, vo0p0);
+      vo0p0 = _mm512_fmadd_ps(vi2xHIJKLMNOPQRSTUVW, vk22, vo0p0);
+
+
+      __m512 vo0 = _mm512_max_ps(vo0p0, vmin);
+
+      vo0 = _mm512_min_ps(vo0, vmax);
+
+      _mm512_storeu_ps(o0, vo0);
+      o0 += 16;
+      w -= 16 * sizeof(float);
+    }
+    // Always process the last block of 1..16 pixels.
+    assert(w >= 1 * sizeof(float));
+    assert(w <= 16 * sizeof(float));
+    {
+      __m512 vo0p0 = _mm512_fmadd_ps(vi0xGHIJKLMNOPQRSTUV, vk01, vbias);
+      vo0p0 = _mm512_fmadd_ps(vi1xGHIJKLMNOPQRSTUV, vk11, vo0p0);
+      vo0p0 = _mm512_fmadd_ps(vi2xGHIJKLMNOPQRSTUV, vk21, vo0p0);
+
+      const __m512 vi0xFGHIJKLMNOPQRSTU = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi0xGHIJKLMNOPQRSTUV), _mm512_castps_si512(vi0x0123456789ABCDEF), 15));
+      const __m512 vi1xFGHIJKLMNOPQRSTU = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi1xGHIJKLMNOPQRSTUV), _mm512_castps_si512(vi1x0123456789ABCDEF), 15));
+      const __m512 vi2xFGHIJKLMNOPQRSTU = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi2xGHIJKLMNOPQRSTUV), _mm512_castps_si512(vi2x0123456789ABCDEF), 15));
+
+      vo0p0 = _mm512_fmadd_ps(vi0xFGHIJKLMNOPQRSTU, vk00, vo0p0);
+      vo0p0 = _mm512_fmadd_ps(vi1xFGHIJKLMNOPQRSTU, vk10, vo0p0);
+      vo0p0 = _mm512_fmadd_ps(vi2xFGHIJKLMNOPQRSTU, vk20, vo0p0);
+
+      const __m512 vi0xHIJKLMNOPQRSTUVW = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_setzero_si512(), _mm512_castps_si512(vi0xGHIJKLMNOPQRSTUV), 1));
+      const __m512 vi1xHIJKLMNOPQRSTUVW = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_setzero_si512(), _mm512_castps_si512(vi1xGHIJKLMNOPQRSTUV), 1));
+      const __m512 vi2xHIJKLMNOPQRSTUVW = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_setzero_si512(), _mm512_castps_si512(vi2xGHIJKLMNOPQRSTUV), 1));
+
+      vo0p0 = _mm512_fmadd_ps(vi0xHIJKLMNOPQRSTUVW, vk02, vo0p0);
+      vo0p0 = _mm512_fmadd_ps(vi1xHIJKLMNOPQRSTUVW, vk12, vo0p0);
+      vo0p0 = _mm512_fmadd_ps(vi2xHIJKLMNOPQRSTUVW, vk22, vo0p0);
+
+
+      __m512 vo0 = _mm512_max_ps(vo0p0, vmin);
+
+      vo0 = _mm512_min_ps(vo0, vmax);
+
+      _mm512_mask_storeu_ps(o0, vmask, vo0);
+      o0 += w / sizeof(float);
+    }
+
+    i0 = (const float*) ((uintptr_t) i1 - input_decrement);
+    i1 = (const float*) ((uintptr_t) i2 - input_decrement);
+    i2 = (const float*) ((uintptr_t) i1 + input_width);
+
+
+  } while (--output_height != 0);
+}
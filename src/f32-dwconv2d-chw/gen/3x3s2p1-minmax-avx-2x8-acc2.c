@@ -0,0 +1,310 @@
+// Auto-generated file. Do not edit!
+//   Template: src/f32-dwconv2d-chw/3x3s2p1-avx.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <immintrin.h>
+
+#include <xnnpack/dwconv.h>
+#include <xnnpack/math.h>
+
+
+void xnn_f32_dwconv2d_chw_ukernel_3x3s2p1__avx_2x8_acc2(
+    size_t input_height,
+    size_t input_width,
+    const float* input,
+    const float* weights,
+    const float* zero,
+    float* output,
+    uint32_t padding_top,
+    const union xnn_f32_chw_params params[restrict XNN_MIN_ELEMENTS(1)]) XNN_OOB_READS
+{
+  assert(input_height != 0);
+  assert(input_width != 0);
+  assert(input_width % sizeof(float) == 0);
+  assert(padding_top >= 0);
+  assert(padding_top <= 1);
+
+  const __m256 vmask_even = _mm256_load_ps((const float*) params->sse.mask_even8);
+  const __m256 vmask_odd  = _mm256_load_ps((const float*) params->sse.mask_odd8);
+  const __m256 vmax = _mm256_broadcast_ss(params->sse.max);
+  const __m256 vmin = _mm256_broadcast_ss(params->sse.min);
+
+  const __m256 vbias = _mm256_broadcast_ss(weights);
+  const __m256 vk00 = _mm256_broadcast_ss(weights + 1);
+  const __m256 vk01 = _mm256_broadcast_ss(weights + 2);
+  const __m256 vk02 = _mm256_broadcast_ss(weights + 3);
+  const __m256 vk10 = _mm256_broadcast_ss(weights + 4);
+  const __m256 vk11 = _mm256_broadcast_ss(weights + 5);
+  const __m256 vk12 = _mm256_broadcast_ss(weights + 6);
+  const __m256 vk20 = _mm256_broadcast_ss(weights + 7);
+  const __m256 vk21 = _mm256_broadcast_ss(weights + 8);
+  const __m256 vk22 = _mm256_broadcast_ss(weights + 9);
+
+  const size_t input_decrement = round_down_po2(input_width, 8 /* SIMD output width */ * 2 /* subsampling */ * sizeof(float));
+  const size_t output_width = round_down_po2((input_width + (2 /* padding */ - 3 /* kernel size */ + 2 /* subsampling */) * sizeof(float)) / 2, sizeof(float));
+
+  const float* i0 = (const float*) ((uintptr_t) input - ((-padding_top) & input_width));
+  const float* i1 = (const float*) ((uintptr_t) i0 + input_width);
+  if XNN_UNPREDICTABLE(padding_top != 0) {
+    i0 = zero;
+  }
+  const float* i2 = (const float*) ((uintptr_t) i1 + input_width);
+  const float* i3 = (const float*) ((uintptr_t) i2 + input_width);
+  const float* i4 = (const float*) ((uintptr_t) i3 + input_width);
+
+  float* o0 = output;
+  float* o1 = (float*) ((uintptr_t) o0 + output_width);
+
+  size_t padded_input_height = input_height + padding_top + 1 /* padding bottom */;
+  size_t output_height = (padded_input_height - 3 /* kernel size */ + 2 /* subsampling */) / 2;
+  do {
+    if XNN_UNPREDICTABLE(padded_input_height < 4) {
+      i2 = zero;
+    }
+    if XNN_UNPREDICTABLE(padded_input_height < 5) {
+      i3 = zero;
+      o1 = o0;
+    }
+    if XNN_UNPREDICTABLE(padded_input_height < 6) {
+      i4 = zero;
+    }
+
+    __m256 vi0x13579BDF = _mm256_setzero_ps();
+    __m256 vi1x13579BDF = _mm256_setzero_ps();
+    __m256 vi2x13579BDF = _mm256_setzero_ps();
+    __m256 vi3x13579BDF = _mm256_setzero_ps();
+    __m256 vi4x13579BDF = _mm256_setzero_ps();
+
+    size_t w = input_width;
+    for (; w >= 16 * sizeof(float); w -= 16 * sizeof(float)) {
+      const __m256 vi0xGHIJKLMN = _mm256_loadu_ps(i0);
+      const __m256 vi0xOPQRSTUV = _mm256_loadu_ps(i0 + 8);
+      i0 += 16;
+      const __m256 vi1xGHIJKLMN = _mm256_loadu_ps(i1);
+      const __m256 vi1xOPQRSTUV = _mm256_loadu_ps(i1 + 8);
+      i1 += 16;
+      const __m256 vi2xGHIJKLMN = _mm256_loadu_ps(i2);
+      const __m256 vi2xOPQRSTUV = _mm256_loadu_ps(i2 + 8);
+      i2 += 16;
+      const __m256 vi3xGHIJKLMN = _mm256_loadu_ps(i3);
+      const __m256 vi3xOPQRSTUV = _mm256_loadu_ps(i3 + 8);
+      i3 += 16;
+      const __m256 vi4xGHIJKLMN = _mm256_loadu_ps(i4);
+      const __m256 vi4xOPQRSTUV = _mm256_loadu_ps(i4 + 8);
+      i4 += 16;
+
+      const __m256 vi0xGHIJOPQR = _mm256_permute2f128_ps(vi0xGHIJKLMN, vi0xOPQRSTUV, 0x20);
+      const __m256 vi0xKLMNSTUV = _mm256_permute2f128_ps(vi0xGHIJKLMN, vi0xOPQRSTUV, 0x31);
+      const __m256 vi1xGHIJOPQR = _mm256_permute2f128_ps(vi1xGHIJKLMN, vi1xOPQRSTUV, 0x20);
+      const __m256 vi1xKLMNSTUV = _mm256_permute2f128_ps(vi1xGHIJKLMN, vi1xOPQRSTUV, 0x31);
+      const __m256 vi2xGHIJOPQR = _mm256_permute2f128_ps(vi2xGHIJKLMN, vi2xOPQRSTUV, 0x20);
+      const __m256 vi2xKLMNSTUV = _mm256_permute2f128_ps(vi2xGHIJKLMN, vi2xOPQRSTUV, 0x31);
+      const __m256 vi3xGHIJOPQR = _mm256_permute2f128_ps(vi3xGHIJKLMN, vi3xOPQRSTUV, 0x20);
+      const __m256 vi3xKLMNSTUV = _mm256_permute2f128_ps(vi3xGHIJKLMN, vi3xOPQRSTUV, 0x31);
+      const __m256 vi4xGHIJOPQR = _mm256_permute2f128_ps(vi4xGHIJKLMN, vi4xOPQRSTUV, 0x20);
+      const __m256 vi4xKLMNSTUV = _mm256_permute2f128_ps(vi4xGHIJKLMN, vi4xOPQRSTUV, 0x31);
+
+      const __m256 vi0xGIKMOQSU = _mm256_shuffle_ps(vi0xGHIJOPQR, vi0xKLMNSTUV, _MM_SHUFFLE(2, 0, 2, 0));
+      const __m256 vi0xHJLNPRTV = _mm256_shuffle_ps(vi0xGHIJOPQR, vi0xKLMNSTUV, _MM_SHUFFLE(3, 1, 3, 1));
+      const __m256 vi1xGIKMOQSU = _mm256_shuffle_ps(vi1xGHIJOPQR, vi1xKLMNSTUV, _MM_SHUFFLE(2, 0, 2, 0));
+      const __m256 vi1xHJLNPRTV = _mm256_shuffle_ps(vi1xGHIJOPQR, vi1xKLMNSTUV, _MM_SHUFFLE(3, 1, 3, 1));
+      const __m256 vi2xGIKMOQSU = _mm256_shuffle_ps(vi2xGHIJOPQR, vi2xKLMNSTUV, _MM_SHUFFLE(2, 0, 2, 0));
+      const __m256 vi2xHJLNPRTV = _mm256_shuffle_ps(vi2xGHIJOPQR, vi2xKLMNSTUV, _MM_SHUFFLE(3, 1, 3, 1));
+      const __m256 vi3xGIKMOQSU = _mm256_shuffle_ps(vi3xGHIJOPQR, vi3xKLMNSTUV, _MM_SHUFFLE(2, 0, 2, 0));
+      const __m256 vi3xHJLNPRTV = _mm256_shuffle_ps(vi3xGHIJOPQR, vi3xKLMNSTUV, _MM_SHUFFLE(3, 1, 3, 1));
+      const __m256 vi4xGIKMOQSU = _mm256_shuffle_ps(vi4xGHIJOPQR, vi4xKLMNSTUV, _MM_SHUFFLE(2, 0, 2, 0));
+      const __m256 vi4xHJLNPRTV = _mm256_shuffle_ps(vi4xGHIJOPQR, vi4xKLMNSTUV, _MM_SHUFFLE(3, 1, 3, 1));
+
+      __m256 vo0p0 = _mm256_add_ps(vbias, _mm256_mul_ps(vi0xGIKMOQSU, vk01));
+      __m256 vo1p0 = _mm256_add_ps(vbias, _mm256_mul_ps(vi2xGIKMOQSU, vk01));
+      __m256 vo0p1 = _mm256_mul_ps(vi1xGIKMOQSU, vk11);
+      __m256 vo1p1 = _mm256_mul_ps(vi3xGIKMOQSU, vk11);
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi2xGIKMOQSU, vk21));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi4xGIKMOQSU, vk21));
+
+      const __m256 vi0x9BDFHJLN = _mm256_permute2f128_ps(vi0x13579BDF, vi0xHJLNPRTV, 0x21);
+      const __m256 vi1x9BDFHJLN = _mm256_permute2f128_ps(vi1x13579BDF, vi1xHJLNPRTV, 0x21);
+      const __m256 vi2x9BDFHJLN = _mm256_permute2f128_ps(vi2x13579BDF, vi2xHJLNPRTV, 0x21);
+      const __m256 vi3x9BDFHJLN = _mm256_permute2f128_ps(vi3x13579BDF, vi3xHJLNPRTV, 0x21);
+      const __m256 vi4x9BDFHJLN = _mm256_permute2f128_ps(vi4x13579BDF, vi4xHJLNPRTV, 0x21);
+
+      vo0p1 = _mm256_add_ps(vo0p1, _mm256_mul_ps(vi0xHJLNPRTV, vk02));
+      vo1p1 = _mm256_add_ps(vo1p1, _mm256_mul_ps(vi2xHJLNPRTV, vk02));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi1xHJLNPRTV, vk12));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi3xHJLNPRTV, vk12));
+      vo0p1 = _mm256_add_ps(vo0p1, _mm256_mul_ps(vi2xHJLNPRTV, vk22));
+      vo1p1 = _mm256_add_ps(vo1p1, _mm256_mul_ps(vi4xHJLNPRTV, vk22));
+
+      const __m256 vi0xFHJLNPRT = _mm256_permute_ps(_mm256_blend_ps(vi0xHJLNPRTV, vi0x9BDFHJLN, 0x88), _MM_SHUFFLE(2, 1, 0, 3));
+      vi0x13579BDF = vi0xHJLNPRTV;
+      const __m256 vi1xFHJLNPRT = _mm256_permute_ps(_mm256_blend_ps(vi1xHJLNPRTV, vi1x9BDFHJLN, 0x88), _MM_SHUFFLE(2, 1, 0, 3));
+      vi1x13579BDF = vi1xHJLNPRTV;
+      const __m256 vi2xFHJLNPRT = _mm256_permute_ps(_mm256_blend_ps(vi2xHJLNPRTV, vi2x9BDFHJLN, 0x88), _MM_SHUFFLE(2, 1, 0, 3));
+      vi2x13579BDF = vi2xHJLNPRTV;
+      const __m256 vi3xFHJLNPRT = _mm256_permute_ps(_mm256_blend_ps(vi3xHJLNPRTV, vi3x9BDFHJLN, 0x88), _MM_SHUFFLE(2, 1, 0, 3));
+      vi3x13579BDF = vi3xHJLNPRTV;
+      const __m256 vi4xFHJLNPRT = _mm256_permute_ps(_mm256_blend_ps(vi4xHJLNPRTV, vi4x9BDFHJLN, 0x88), _MM_SHUFFLE(2, 1, 0, 3));
+      vi4x13579BDF = vi4xHJLNPRTV;
+
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi0xFHJLNPRT, vk00));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi2xFHJLNPRT, vk00));
+      vo0p1 = _mm256_add_ps(vo0p1, _mm256_mul_ps(vi1xFHJLNPRT, vk10));
+      vo1p1 = _mm256_add_ps(vo1p1, _mm256_mul_ps(vi3xFHJLNPRT, vk10));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi2xFHJLNPRT, vk20));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi4xFHJLNPRT, vk20));
+
+      vo0p0 = _mm256_add_ps(vo0p0, vo0p1);
+      vo1p0 = _mm256_add_ps(vo1p0, vo1p1);
+
+      __m256 vo0 = _mm256_max_ps(vo0p0, vmin);
+      __m256 vo1 = _mm256_max_ps(vo1p0, vmin);
+
+      vo0 = _mm256_min_ps(vo0, vmax);
+      vo1 = _mm256_min_ps(vo1, vmax);
+
+      _mm256_storeu_ps(o1, vo1);
+      o1 += 8;
+      _mm256_storeu_ps(o0, vo0);
+      o0 += 8;
+    }
+    // Potentially process the last block of 0..15 pixels.
+    assert(w < 16 * sizeof(float));
+    if XNN_LIKELY(w != 0) {
+      const __m256 vi0xGHIJKLMN = _mm256_loadu_ps(i0);
+      const __m256 vi1xGHIJKLMN = _mm256_loadu_ps(i1);
+      const __m256 vi2xGHIJKLMN = _mm256_loadu_ps(i2);
+      const __m256 vi3xGHIJKLMN = _mm256_loadu_ps(i3);
+      const __m256 vi4xGHIJKLMN = _mm256_loadu_ps(i4);
+      __m256 vi0xOPQRSTUV = _mm256_setzero_ps();
+      __m256 vi1xOPQRSTUV = _mm256_setzero_ps();
+      __m256 vi2xOPQRSTUV = _mm256_setzero_ps();
+      __m256 vi3xOPQRSTUV = _mm256_setzero_ps();
+      __m256 vi4xOPQRSTUV = _mm256_setzero_ps();
+      if (w > 8 * sizeof(float)) {
+        vi0xOPQRSTUV = _mm256_loadu_ps(i0 + 8);
+        vi1xOPQRSTUV = _mm256_loadu_ps(i1 + 8);
+        vi2xOPQRSTUV = _mm256_loadu_ps(i2 + 8);
+        vi3xOPQRSTUV = _mm256_loadu_ps(i3 + 8);
+        vi4xOPQRSTUV = _mm256_loadu_ps(i4 + 8);
+      }
+
+      const __m256 vi0xGHIJOPQR = _mm256_permute2f128_ps(vi0xGHIJKLMN, vi0xOPQRSTUV, 0x20);
+      const __m256 vi0xKLMNSTUV = _mm256_permute2f128_ps(vi0xGHIJKLMN, vi0xOPQRSTUV, 0x31);
+      const __m256 vi1xGHIJOPQR = _mm256_permute2f128_ps(vi1xGHIJKLMN, vi1xOPQRSTUV, 0x20);
+      const __m256 vi1xKLMNSTUV = _mm256_permute2f128_ps(vi1xGHIJKLMN, vi1xOPQRSTUV, 0x31);
+      const __m256 vi2xGHIJOPQR = _mm256_permute2f128_ps(vi2xGHIJKLMN, vi2xOPQRSTUV, 0x20);
+      const __m256 vi2xKLMNSTUV = _mm256_permute2f128_ps(vi2xGHIJKLMN, vi2xOPQRSTUV, 0x31);
+      const __m256 vi3xGHIJOPQR = _mm256_permute2f128_ps(vi3xGHIJKLMN, vi3xOPQRSTUV, 0x20);
+      const __m256 vi3xKLMNSTUV = _mm256_permute2f128_ps(vi3xGHIJKLMN, vi3xOPQRSTUV, 0x31);
+      const __m256 vi4xGHIJOPQR = _mm256_permute2f128_ps(vi4xGHIJKLMN, vi4xOPQRSTUV, 0x20);
+      const __m256 vi4xKLMNSTUV = _mm256_permute2f128_ps(vi4xGHIJKLMN, vi4xOPQRSTUV, 0x31);
+
+      const __m256 vi0xGIKMOQSU = _mm256_and_ps(vmask_even, _mm256_shuffle_ps(vi0xGHIJOPQR, vi0xKLMNSTUV, _MM_SHUFFLE(2, 0, 2, 0)));
+      const __m256 vi0xHJLNPRTV = _mm256_and_ps(vmask_odd,  _mm256_shuffle_ps(vi0xGHIJOPQR, vi0xKLMNSTUV, _MM_SHUFFLE(3, 1, 3, 1)));
+      const __m256 vi1xGIKMOQSU = _mm256_and_ps(vmask_even, _mm256_shuffle_ps(vi1xGHIJOPQR, vi1xKLMNSTUV, _MM_SHUFFLE(2, 0, 2, 0)));
+      const __m256 vi1xHJLNPRTV = _mm256_and_ps(vmask_odd,  _mm256_shuffle_ps(vi1xGHIJOPQR, vi1xKLMNSTUV, _MM_SHUFFLE(3, 1, 3, 1)));
+      const __m256 vi2xGIKMOQSU = _mm256_and_ps(vmask_even, _mm256_shuffle_ps(vi2xGHIJOPQR, vi2xKLMNSTUV, _MM_SHUFFLE(2, 0, 2, 0)));
+      const __m256 vi2xHJLNPRTV = _mm256_and_ps(vmask_odd,  _mm256_shuffle_ps(vi2xGHIJOPQR, vi2xKLMNSTUV, _MM_SHUFFLE(3, 1, 3, 1)));
+      const __m256 vi3xGIKMOQSU = _mm256_and_ps(vmask_even, _mm256_shuffle_ps(vi3xGHIJOPQR, vi3xKLMNSTUV, _MM_SHUFFLE(2, 0, 2, 0)));
+      const __m256 vi3xHJLNPRTV = _mm256_and_ps(vmask_odd,  _mm256_shuffle_ps(vi3xGHIJOPQR, vi3xKLMNSTUV, _MM_SHUFFLE(3, 1, 3, 1)));
+      const __m256 vi4xGIKMOQSU = _mm256_and_ps(vmask_even, _mm256_shuffle_ps(vi4xGHIJOPQR, vi4xKLMNSTUV, _MM_SHUFFLE(2, 0, 2, 0)));
+      const __m256 vi4xHJLNPRTV = _mm256_and_ps(vmask_odd,  _mm256_shuffle_ps(vi4xGHIJOPQR, vi4xKLMNSTUV, _MM_SHUFFLE(3, 1, 3, 1)));
+
+      __m256 vo0p0 = _mm256_add_ps(vbias, _mm256_mul_ps(vi0xGIKMOQSU, vk01));
+      __m256 vo1p0 = _mm256_add_ps(vbias, _mm256_mul_ps(vi2xGIKMOQSU, vk01));
+      __m256 vo0p1 = _mm256_mul_ps(vi1xGIKMOQSU, vk11);
+      __m256 vo1p1 = _mm256_mul_ps(vi3xGIKMOQSU, vk11);
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi2xGIKMOQSU, vk21));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi4xGIKMOQSU, vk21));
+
+      const __m256 vi0x9BDFHJLN = _mm256_permute2f128_ps(vi0x13579BDF, vi0xHJLNPRTV, 0x21);
+      const __m256 vi1x9BDFHJLN = _mm256_permute2f128_ps(vi1x13579BDF, vi1xHJLNPRTV, 0x21);
+      const __m256 vi2x9BDFHJLN = _mm256_permute2f128_ps(vi2x13579BDF, vi2xHJLNPRTV, 0x21);
+      const __m256 vi3x9BDFHJLN = _mm256_permute2f128_ps(vi3x13579BDF, vi3xHJLNPRTV, 0x21);
+      const __m256 vi4x9BDFHJLN = _mm256_permute2f128_ps(vi4x13579BDF, vi4xHJLNPRTV, 0x21);
+
+      vo0p1 = _mm256_add_ps(vo0p1, _mm256_mul_ps(vi0xHJLNPRTV, vk02));
+      vo1p1 = _mm256_add_ps(vo1p1, _mm256_mul_ps(vi2xHJLNPRTV, vk02));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi1xHJLNPRTV, vk12));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi3xHJLNPRTV, vk12));
+      vo0p1 = _mm256_add_ps(vo0p1, _mm256_mul_ps(vi2xHJLNPRTV, vk22));
+      vo1p1 = _mm256_add_ps(vo1p1, _mm256_mul_ps(vi4xHJLNPRTV, vk22));
+
+      const __m256 vi0xFHJLNPRT = _mm256_permute_ps(_mm256_blend_ps(vi0xHJLNPRTV, vi0x9BDFHJLN, 0x88), _MM_SHUFFLE(2, 1, 0, 3));
+      const __m256 vi1xFHJLNPRT = _mm256_permute_ps(_mm256_blend_ps(vi1xHJLNPRTV, vi1x9BDFHJLN, 0x88), _MM_SHUFFLE(2, 1, 0, 3));
+      const __m256 vi2xFHJLNPRT = _mm256_permute_ps(_mm256_blend_ps(vi2xHJLNPRTV, vi2x9BDFHJLN, 0x88), _MM_SHUFFLE(2, 1, 0, 3));
+      const __m256 vi3xFHJLNPRT = _mm256_permute_ps(_mm256_blend_ps(vi3xHJLNPRTV, vi3x9BDFHJLN, 0x88), _MM_SHUFFLE(2, 1, 0, 3));
+      const __m256 vi4xFHJLNPRT = _mm256_permute_ps(_mm256_blend_ps(vi4xHJLNPRTV, vi4x9BDFHJLN, 0x88), _MM_SHUFFLE(2, 1, 0, 3));
+
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi0xFHJLNPRT, vk00));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi2xFHJLNPRT, vk00));
+      vo0p1 = _mm256_add_ps(vo0p1, _mm256_mul_ps(vi1xFHJLNPRT, vk10));
+      vo1p1 = _mm256_add_ps(vo1p1, _mm256_mul_ps(vi3xFHJLNPRT, vk10));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi2xFHJLNPRT, vk20));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi4xFHJLNPRT, vk20));
+
+      vo0p0 = _mm256_add_ps(vo0p0, vo0p1);
+      vo1p0 = _mm256_add_ps(vo1p0, vo1p1);
+
+      __m256 vo0 = _mm256_max_ps(vo0p0, vmin);
+      __m256 vo1 = _mm256_max_ps(vo1p0, vmin);
+
+      vo0 = _mm256_min_ps(vo0, vmax);
+      vo1 = _mm256_min_ps(vo1, vmax);
+
+      if (w == 15 * sizeof(float)) {
+        _mm256_storeu_ps(o1, vo1);
+        o1 += 8;
+        _mm256_storeu_ps(o0, vo0);
+        o0 += 8;
+      } else {
+        __m128 vo1_lo = _mm256_castps256_ps128(vo1);
+        __m128 vo0_lo = _mm256_castps256_ps128(vo0);
+        w += 1 * sizeof(float);
+        if (w & (8 * sizeof(float))) {
+          _mm_storeu_ps(o1, vo1_lo);
+          o1 += 4;
+          _mm_storeu_ps(o0, vo0_lo);
+          o0 += 4;
+
+          vo0_lo = _mm256_extractf128_ps(vo0, 1);
+          vo1_lo = _mm256_extractf128_ps(vo1, 1);
+        }
+        if (w & (4 * sizeof(float))) {
+          _mm_storel_pi((__m64*) o1, vo1_lo);
+          o1 += 2;
+          _mm_storel_pi((__m64*) o0, vo0_lo);
+          o0 += 2;
+
+          vo0_lo = _mm_movehl_ps(vo0_lo, vo0_lo);
+          vo1_lo = _mm_movehl_ps(vo1_lo, vo1_lo);
+        }
+        if (w & (2 * sizeof(float))) {
+          _mm_store_ss(o1, vo1_lo);
+          o1 += 1;
+          _mm_store_ss(o0, vo0_lo);
+          o0 += 1;
+        }
+      }
+    }
+
+    i0 = (const float*) ((uintptr_t) i4 - input_decrement);
+    i1 = (const float*) ((uintptr_t) i0 + input_width);
+    i2 = (const float*) ((uintptr_t) i1 + input_width);
+    i3 = (const float*) ((uintptr_t) i2 + input_width);
+    i4 = (const float*) ((uintptr_t) i3 + input_width);
+
+    o0 = o1;
+    o1 = (float*) ((uintptr_t) o0 + output_width);
+
+    output_height = doz(output_height, 2);
+    padded_input_height = doz(padded_input_height, 4);
+  } while (output_height != 0);
+}
@@ -0,0 +1,180 @@
+// Auto-generated file. Do not edit!
+//   Template: src/f32-dwconv2d-chw/3x3s2p1-avx512f.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <immintrin.h>
+
+#include <xnnpack/dwconv.h>
+#include <xnnpack/intrinsics-polyfill.h>
+#include <xnnpack/math.h>
+
+
+void xnn_f32_dwconv2d_chw_ukernel_3x3s2p1__avx512f_1x16_acc2(
+    size_t input_height,
+    size_t input_width,
+    const float* input,
+    const float* weights,
+    const float* zero,
+    float* output,
+    uint32_t padding_top,
+    const union xnn_f32_chw_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(input_height != 0);
+  assert(input_width != 0);
+  assert(input_width % sizeof(float) == 0);
+  assert(padding_top >= 0);
+  assert(padding_top <= 1);
+
+  // Masks of the valid pixels in the last block of 1..32 pixels of each row.
+  const uint32_t vmask_bits = UINT32_C(0xFFFFFFFF) >> (31 - (((input_width - 1 * sizeof(float)) / sizeof(float)) & 31));
+  const __mmask16 vmask_lo = _cvtu32_mask16(vmask_bits);
+  const __mmask16 vmask_hi = _cvtu32_mask16(vmask_bits >> 16);
+  const __m512i vidx_even = _mm512_set_epi32(30, 28, 26, 24, 22, 20, 18, 16, 14, 12, 10, 8, 6, 4, 2, 0);
+  const __m512i vidx_odd = _mm512_set_epi32(31, 29, 27, 25, 23, 21, 19, 17, 15, 13, 11, 9, 7, 5, 3, 1);
+  const __m512 vmax = _mm512_set1_ps(params->sse.max[0]);
+  const __m512 vmin = _mm512_set1_ps(params->sse.min[0]);
+
+  const __m512 vbias = _mm512_set1_ps(weights[0]);
+  const __m512 vk00 = _mm512_set1_ps(weights[1]);
+  const __m512 vk01 = _mm512_set1_ps(weights[2]);
+  const __m512 vk02 = _mm512_set1_ps(weights[3]);
+  const __m512 vk10 = _mm512_set1_ps(weights[4]);
+  const __m512 vk11 = _mm512_set1_ps(weights[5]);
+  const __m512 vk12 = _mm512_set1_ps(weights[6]);
+  const __m512 vk20 = _mm512_set1_ps(weights[7]);
+  const __m512 vk21 = _mm512_set1_ps(weights[8]);
+  const __m512 vk22 = _mm512_set1_ps(weights[9]);
+
+  const size_t input_decrement = round_down_po2(input_width, 16 /* SIMD output width */ * 2 /* subsampling */ * sizeof(float));
+
+  const float* i0 = (const float*) ((uintptr_t) input - ((-padding_top) & input_width));
+  const float* i1 = (const float*) ((uintptr_t) i0 + input_width);
+  if XNN_UNPREDICTABLE(padding_top != 0) {
+    i0 = zero;
+  }
+  const float* i2 = (const float*) ((uintptr_t) i1 + input_width);
+
+  float* o0 = output;
+
+  size_t padded_input_height = input_height + padding_top + 1 /* padding bottom */;
+  size_t output_height = (padded_input_height - 3 /* kernel size */ + 2 /* subsampling */) / 2;
+  do {
+    if XNN_UNPREDICTABLE(padded_input_height < 4) {
+      i2 = zero;
+    }
+
+    __m512 vi0_prev_odd = _mm512_setzero_ps();
+    __m512 vi1_prev_odd = _mm512_setzero_ps();
+    __m512 vi2_prev_odd = _mm512_setzero_ps();
+
+    size_t w = input_width;
+    for (; w >= 32 * sizeof(float); w -= 32 * sizeof(float)) {
+      const __m512 vi0_lo = _mm512_loadu_ps(i0);
+      const __m512 vi0_hi = _mm512_loadu_ps(i0 + 16);
+      i0 += 32;
+      const __m512 vi1_lo = _mm512_loadu_ps(i1);
+      const __m512 vi1_hi = _mm512_loadu_ps(i1 + 16);
+      i1 += 32;
+      const __m512 vi2_lo = _mm512_loadu_ps(i2);
+      const __m512 vi2_hi = _mm512_loadu_ps(i2 + 16);
+      i2 += 32;
+
+      const __m512 vi0_even = _mm512_permutex2var_ps(vi0_lo, vidx_even, vi0_hi);
+      const __m512 vi0_odd = _mm512_permutex2var_ps(vi0_lo, vidx_odd, vi0_hi);
+      const __m512 vi1_even = _mm512_permutex2var_ps(vi1_lo, vidx_even, vi1_hi);
+      const __m512 vi1_odd = _mm512_permutex2var_ps(vi1_lo, vidx_odd, vi1_hi);
+      const __m512 vi2_even = _mm512_permutex2var_ps(vi2_lo, vidx_even, vi2_hi);
+      const __m512 vi2_odd = _mm512_permutex2var_ps(vi2_lo, vidx_odd, vi2_hi);
+
+      __m512 vo0p0 = _mm512_fmadd_ps(vi0_even, vk01, vbias);
+      __m512 vo0p1 = _mm512_mul_ps(vi1_even, vk11);
+      vo0p0 = _mm512_fmadd_ps(vi2_even, vk21, vo0p0);
+
+      vo0p1 = _mm512_fmadd_ps(vi0_odd, vk02, vo0p1);
+      vo0p0 = _mm512_fmadd_ps(vi1_odd, vk12, vo0p0);
+      vo0p1 = _mm512_fmadd_ps(vi2_odd, vk22, vo0p1);
+
+      const __m512 vi0_odd_left = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi0_odd), _mm512_castps_si512(vi0_prev_odd), 15));
+      vi0_prev_odd = vi0_odd;
+      const __m512 vi1_odd_left = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi1_odd), _mm512_castps_si512(vi1_prev_odd), 15));
+      vi1_prev_odd = vi1_odd;
+      const __m512 vi2_odd_left = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi2_odd), _mm512_castps_si512(vi2_prev_odd), 15));
+      vi2_prev_odd = vi2_odd;
+
+      vo0p0 = _mm512_fmadd_ps(vi0_odd_left, vk00, vo0p0);
+      vo0p1 = _mm512_fmadd_ps(vi1_odd_left, vk10, vo0p1);
+      vo0p0 = _mm512_fmadd_ps(vi2_odd_left, vk20, vo0p0);
+
+      vo0p0 = _mm512_add_ps(vo0p0, vo0p1);
+
+      __m512 vo0 = _mm512_max_ps(vo0p0, vmin);
+
+      vo0 = _mm512_min_ps(vo0, vmax);
+
+      _mm512_storeu_ps(o0, vo0);
+      o0 += 16;
+    }
+    // Potentially process the last block of 0..31 pixels.
+    assert(w < 32 * sizeof(float));
+    if XNN_LIKELY(w != 0) {
+      const __m512 vi0_lo = _mm512_maskz_loadu_ps(vmask_lo, i0);
+      const __m512 vi0_hi = _mm512_maskz_loadu_ps(vmask_hi, i0 + 16);
+      const __m512 vi1_lo = _mm512_maskz_loadu_ps(vmask_lo, i1);
+      const __m512 vi1_hi = _mm512_maskz_loadu_ps(vmask_hi, i1 + 16);
+      const __m512 vi2_lo = _mm512_maskz_loadu_ps(vmask_lo, i2);
+      const __m512 vi2_hi = _mm512_maskz_loadu_ps(vmask_hi, i2 + 16);
+
+      const __m512 vi0_even = _mm512_permutex2var_ps(vi0_lo, vidx_even, vi0_hi);
+      const __m512 vi0_odd = _mm512_permutex2var_ps(vi0_lo, vidx_odd, vi0_hi);
+      const __m512 vi1_even = _mm512_permutex2var_ps(vi1_lo, vidx_even, vi1_hi);
+      const __m512 vi1_odd = _mm512_permutex2var_ps(vi1_lo, vidx_odd, vi1_hi);
+      const __m512 vi2_even = _mm512_permutex2var_ps(vi2_lo, vidx_even, vi2_hi);
+      const __m512 vi2_odd = _mm512_permutex2var_ps(vi2_lo, vidx_odd, vi2_hi);
+
+      __m512 vo0p0 = _mm512_fmadd_ps(vi0_even, vk01, vbias);
+      __m512 vo0p1 = _mm512_mul_ps(vi1_even, vk11);
+      vo0p0 = _mm512_fmadd_ps(vi2_even, vk21, vo0p0);
+
+      vo0p1 = _mm512_fmadd_ps(vi0_odd, vk02, vo0p1);
+      vo0p0 = _mm512_fmadd_ps(vi1_odd, vk12, vo0p0);
+      vo0p1 = _mm512_fmadd_ps(vi2_odd, vk22, vo0p1);
+
+      const __m512 vi0_odd_left = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi0_odd), _mm512_castps_si512(vi0_prev_odd), 15));
+      vi0_prev_odd = vi0_odd;
+      const __m512 vi1_odd_left = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi1_odd), _mm512_castps_si512(vi1_prev_odd), 15));
+      vi1_prev_odd = vi1_odd;
+      const __m512 vi2_odd_left = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi2_odd), _mm512_castps_si512(vi2_prev_odd), 15));
+      vi2_prev_odd = vi2_odd;
+
+      vo0p0 = _mm512_fmadd_ps(vi0_odd_left, vk00, vo0p0);
+      vo0p1 = _mm512_fmadd_ps(vi1_odd_left, vk10, vo0p1);
+      vo0p0 = _mm512_fmadd_ps(vi2_odd_left, vk20, vo0p0);
+
+      vo0p0 = _mm512_add_ps(vo0p0, vo0p1);
+
+      __m512 vo0 = _mm512_max_ps(vo0p0, vmin);
+
+      vo0 = _mm512_min_ps(vo0, vmax);
+
+      const size_t w_tmp = (w + 1 * sizeof(float)) / (2 * sizeof(float));
+      const __mmask16 vmask_output = _cvtu32_mask16((UINT32_C(1) << w_tmp) - UINT32_C(1));
+      _mm512_mask_storeu_ps(o0, vmask_output, vo0);
+      o0 += w_tmp;
+    }
+
+    i0 = (const float*) ((uintptr_t) i2 - input_decrement);
+    i1 = (const float*) ((uintptr_t) i0 + input_width);
+    i2 = (const float*) ((uintptr_t) i1 + input_width);
+
+
+    output_height -= 1;
+    padded_input_height -= 2;
+  } while (output_height != 0);
+}
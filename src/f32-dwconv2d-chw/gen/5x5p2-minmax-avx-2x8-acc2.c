@@ -0,0 +1,541 @@
+// Auto-generated file. Do not edit!
+//   Template: src/f32-dwconv2d-chw/5x5p2-avx.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <immintrin.h>
+
+#include <xnnpack/dwconv.h>
+#include <xnnpack/math.h>
+
+
+void xnn_f32_dwconv2d_chw_ukernel_5x5p2__avx_2x8_acc2(
+    size_t input_height,
+    size_t input_width,
+    const float* input,
+    const float* weights,
+    const float* zero,
+    float* output,
+    uint32_t padding_top,
+    const union xnn_f32_chw_params params[restrict XNN_MIN_ELEMENTS(1)]) XNN_OOB_READS
+{
+  assert(input_height != 0);
+  assert(input_width != 0);
+  assert(input_width % sizeof(float) == 0);
+  assert(padding_top == 2);
+
+  const __m256 vmask = _mm256_load_ps((const float*) params->sse.mask8);
+  const __m256 vmax = _mm256_broadcast_ss(params->sse.max);
+  const __m256 vmin = _mm256_broadcast_ss(params->sse.min);
+
+  const __m256 vbias = _mm256_broadcast_ss(weights);
+  const __m256 vk00 = _mm256_broadcast_ss(weights + 1);
+  const __m256 vk01 = _mm256_broadcast_ss(weights + 2);
+  const __m256 vk02 = _mm256_broadcast_ss(weights + 3);
+  const __m256 vk03 = _mm256_broadcast_ss(weights + 4);
+  const __m256 vk04 = _mm256_broadcast_ss(weights + 5);
+  const __m256 vk10 = _mm256_broadcast_ss(weights + 6);
+  const __m256 vk11 = _mm256_broadcast_ss(weights + 7);
+  const __m256 vk12 = _mm256_broadcast_ss(weights + 8);
+  const __m256 vk13 = _mm256_broadcast_ss(weights + 9);
+  const __m256 vk14 = _mm256_broadcast_ss(weights + 10);
+  const __m256 vk20 = _mm256_broadcast_ss(weights + 11);
+  const __m256 vk21 = _mm256_broadcast_ss(weights + 12);
+  const __m256 vk22 = _mm256_broadcast_ss(weights + 13);
+  const __m256 vk23 = _mm256_broadcast_ss(weights + 14);
+  const __m256 vk24 = _mm256_broadcast_ss(weights + 15);
+  const __m256 vk30 = _mm256_broadcast_ss(weights + 16);
+  const __m256 vk31 = _mm256_broadcast_ss(weights + 17);
+  const __m256 vk32 = _mm256_broadcast_ss(weights + 18);
+  const __m256 vk33 = _mm256_broadcast_ss(weights + 19);
+  const __m256 vk34 = _mm256_broadcast_ss(weights + 20);
+  const __m256 vk40 = _mm256_broadcast_ss(weights + 21);
+  const __m256 vk41 = _mm256_broadcast_ss(weights + 22);
+  const __m256 vk42 = _mm256_broadcast_ss(weights + 23);
+  const __m256 vk43 = _mm256_broadcast_ss(weights + 24);
+  const __m256 vk44 = _mm256_broadcast_ss(weights + 25);
+
+  const size_t input_decrement = round_up_po2(input_width, 8 * sizeof(float));
+
+  const float* i0 = zero;
+  const float* i1 = zero;
+  const float* i2 = input;
+  const float* i3 = (const float*) ((uintptr_t) i2 + input_width);
+  const float* i4 = (const float*) ((uintptr_t) i3 + input_width);
+  const float* i5 = (const float*) ((uintptr_t) i4 + input_width);
+
+  float* o0 = output;
+  float* o1 = (float*) ((uintptr_t) o0 + input_width);
+
+  size_t output_height = input_height;
+  do {
+    if XNN_UNPREDICTABLE(output_height < 2) {
+      i3 = zero;
+      o1 = o0;
+    }
+    if XNN_UNPREDICTABLE(output_height < 3) {
+      i4 = zero;
+    }
+    if XNN_UNPREDICTABLE(output_height < 4) {
+      i5 = zero;
+    }
+
+    __m256 vi0x89ABCDEF = _mm256_loadu_ps(i0);
+    i0 += 8;
+    __m256 vi1x89ABCDEF = _mm256_loadu_ps(i1);
+    i1 += 8;
+    __m256 vi2x89ABCDEF = _mm256_loadu_ps(i2);
+    i2 += 8;
+    __m256 vi3x89ABCDEF = _mm256_loadu_ps(i3);
+    i3 += 8;
+    __m256 vi4x89ABCDEF = _mm256_loadu_ps(i4);
+    i4 += 8;
+    __m256 vi5x89ABCDEF = _mm256_loadu_ps(i5);
+    i5 += 8;
+
+    // vi0x456789AB = ( vi0B, vi0A, vi09, vi08, 0.0, 0.0, 0.0, 0.0 )
+    __m256 vi0x456789AB = _mm256_permute2f128_ps(vi0x89ABCDEF, vi0x89ABCDEF, 0x08);
+    // vi1x456789AB = ( vi1B, vi1A, vi19, vi18, 0.0, 0.0, 0.0, 0.0 )
+    __m256 vi1x456789AB = _mm256_permute2f128_ps(vi1x89ABCDEF, vi1x89ABCDEF, 0x08);
+    // vi2x456789AB = ( vi2B, vi2A, vi29, vi28, 0.0, 0.0, 0.0, 0.0 )
+    __m256 vi2x456789AB = _mm256_permute2f128_ps(vi2x89ABCDEF, vi2x89ABCDEF, 0x08);
+    // vi3x456789AB = ( vi3B, vi3A, vi39, vi38, 0.0, 0.0, 0.0, 0.0 )
+    __m256 vi3x456789AB = _mm256_permute2f128_ps(vi3x89ABCDEF, vi3x89ABCDEF, 0x08);
+    // vi4x456789AB = ( vi4B, vi4A, vi49, vi48, 0.0, 0.0, 0.0, 0.0 )
+    __m256 vi4x456789AB = _mm256_permute2f128_ps(vi4x89ABCDEF, vi4x89ABCDEF, 0x08);
+    // vi5x456789AB = ( vi5B, vi5A, vi59, vi58, 0.0, 0.0, 0.0, 0.0 )
+    __m256 vi5x456789AB = _mm256_permute2f128_ps(vi5x89ABCDEF, vi5x89ABCDEF, 0x08);
+
+    size_t w = input_width;
+    for (; w > 16 * sizeof(float); w -= 8 * sizeof(float)) {
+      __m256 vo0p0 = _mm256_add_ps(vbias, _mm256_mul_ps(vi0x89ABCDEF, vk02));
+      __m256 vo1p0 = _mm256_add_ps(vbias, _mm256_mul_ps(vi1x89ABCDEF, vk02));
+      __m256 vo0p1 = _mm256_mul_ps(vi1x89ABCDEF, vk12);
+      __m256 vo1p1 = _mm256_mul_ps(vi2x89ABCDEF, vk12);
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi2x89ABCDEF, vk22));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi3x89ABCDEF, vk22));
+      vo0p1 = _mm256_add_ps(vo0p1, _mm256_mul_ps(vi3x89ABCDEF, vk32));
+      vo1p1 = _mm256_add_ps(vo1p1, _mm256_mul_ps(vi4x89ABCDEF, vk32));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi4x89ABCDEF, vk42));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi5x89ABCDEF, vk42));
+
+      const __m256 vi0xGHIJKLMN = _mm256_loadu_ps(i0);
+      i0 += 8;
+      const __m256 vi1xGHIJKLMN = _mm256_loadu_ps(i1);
+      i1 += 8;
+      const __m256 vi2xGHIJKLMN = _mm256_loadu_ps(i2);
+      i2 += 8;
+      const __m256 vi3xGHIJKLMN = _mm256_loadu_ps(i3);
+      i3 += 8;
+      const __m256 vi4xGHIJKLMN = _mm256_loadu_ps(i4);
+      i4 += 8;
+      const __m256 vi5xGHIJKLMN = _mm256_loadu_ps(i5);
+      i5 += 8;
+
+      const __m256 vi0x789ABCDE = _mm256_permute_ps(_mm256_blend_ps(vi0x89ABCDEF, vi0x456789AB, 0x88), _MM_SHUFFLE(2, 1, 0, 3));
+      const __m256 vi1x789ABCDE = _mm256_permute_ps(_mm256_blend_ps(vi1x89ABCDEF, vi1x456789AB, 0x88), _MM_SHUFFLE(2, 1, 0, 3));
+      const __m256 vi2x789ABCDE = _mm256_permute_ps(_mm256_blend_ps(vi2x89ABCDEF, vi2x456789AB, 0x88), _MM_SHUFFLE(2, 1, 0, 3));
+      const __m256 vi3x789ABCDE = _mm256_permute_ps(_mm256_blend_ps(vi3x89ABCDEF, vi3x456789AB, 0x88), _MM_SHUFFLE(2, 1, 0, 3));
+      const __m256 vi4x789ABCDE = _mm256_permute_ps(_mm256_blend_ps(vi4x89ABCDEF, vi4x456789AB, 0x88), _MM_SHUFFLE(2, 1, 0, 3));
+      const __m256 vi5x789ABCDE = _mm256_permute_ps(_mm256_blend_ps(vi5x89ABCDEF, vi5x456789AB, 0x88), _MM_SHUFFLE(2, 1, 0, 3));
+
+      vo0p1 = _mm256_add_ps(vo0p1, _mm256_mul_ps(vi0x789ABCDE, vk01));
+      vo1p1 = _mm256_add_ps(vo1p1, _mm256_mul_ps(vi1x789ABCDE, vk01));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi1x789ABCDE, vk11));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi2x789ABCDE, vk11));
+      vo0p1 = _mm256_add_ps(vo0p1, _mm256_mul_ps(vi2x789ABCDE, vk21));
+      vo1p1 = _mm256_add_ps(vo1p1, _mm256_mul_ps(vi3x789ABCDE, vk21));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi3x789ABCDE, vk31));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi4x789ABCDE, vk31));
+      vo0p1 = _mm256_add_ps(vo0p1, _mm256_mul_ps(vi4x789ABCDE, vk41));
+      vo1p1 = _mm256_add_ps(vo1p1, _mm256_mul_ps(vi5x789ABCDE, vk41));
+
+      const __m256 vi0x6789ABCD = _mm256_shuffle_ps(vi0x456789AB, vi0x89ABCDEF, _MM_SHUFFLE(1, 0, 3, 2));
+      const __m256 vi1x6789ABCD = _mm256_shuffle_ps(vi1x456789AB, vi1x89ABCDEF, _MM_SHUFFLE(1, 0, 3, 2));
+      const __m256 vi2x6789ABCD = _mm256_shuffle_ps(vi2x456789AB, vi2x89ABCDEF, _MM_SHUFFLE(1, 0, 3, 2));
+      const __m256 vi3x6789ABCD = _mm256_shuffle_ps(vi3x456789AB, vi3x89ABCDEF, _MM_SHUFFLE(1, 0, 3, 2));
+      const __m256 vi4x6789ABCD = _mm256_shuffle_ps(vi4x456789AB, vi4x89ABCDEF, _MM_SHUFFLE(1, 0, 3, 2));
+      const __m256 vi5x6789ABCD = _mm256_shuffle_ps(vi5x456789AB, vi5x89ABCDEF, _MM_SHUFFLE(1, 0, 3, 2));
+
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi0x6789ABCD, vk00));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi1x6789ABCD, vk00));
+      vo0p1 = _mm256_add_ps(vo0p1, _mm256_mul_ps(vi1x6789ABCD, vk10));
+      vo1p1 = _mm256_add_ps(vo1p1, _mm256_mul_ps(vi2x6789ABCD, vk10));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi2x6789ABCD, vk20));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi3x6789ABCD, vk20));
+      vo0p1 = _mm256_add_ps(vo0p1, _mm256_mul_ps(vi3x6789ABCD, vk30));
+      vo1p1 = _mm256_add_ps(vo1p1, _mm256_mul_ps(vi4x6789ABCD, vk30));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi4x6789ABCD, vk40));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi5x6789ABCD, vk40));
+
+      const __m256 vi0xCDEFGHIJ = _mm256_permute2f128_ps(vi0x89ABCDEF, vi0xGHIJKLMN, 0x21);
+      const __m256 vi1xCDEFGHIJ = _mm256_permute2f128_ps(vi1x89ABCDEF, vi1xGHIJKLMN, 0x21);
+      const __m256 vi2xCDEFGHIJ = _mm256_permute2f128_ps(vi2x89ABCDEF, vi2xGHIJKLMN, 0x21);
+      const __m256 vi3xCDEFGHIJ = _mm256_permute2f128_ps(vi3x89ABCDEF, vi3xGHIJKLMN, 0x21);
+      const __m256 vi4xCDEFGHIJ = _mm256_permute2f128_ps(vi4x89ABCDEF, vi4xGHIJKLMN, 0x21);
+      const __m256 vi5xCDEFGHIJ = _mm256_permute2f128_ps(vi5x89ABCDEF, vi5xGHIJKLMN, 0x21);
+
+      const __m256 vi0x9ABCDEFG = _mm256_permute_ps(_mm256_blend_ps(vi0x89ABCDEF, vi0xCDEFGHIJ, 0x11), _MM_SHUFFLE(0, 3, 2, 1));
+      const __m256 vi1x9ABCDEFG = _mm256_permute_ps(_mm256_blend_ps(vi1x89ABCDEF, vi1xCDEFGHIJ, 0x11), _MM_SHUFFLE(0, 3, 2, 1));
+      const __m256 vi2x9ABCDEFG = _mm256_permute_ps(_mm256_blend_ps(vi2x89ABCDEF, vi2xCDEFGHIJ, 0x11), _MM_SHUFFLE(0, 3, 2, 1));
+      const __m256 vi3x9ABCDEFG = _mm256_permute_ps(_mm256_blend_ps(vi3x89ABCDEF, vi3xCDEFGHIJ, 0x11), _MM_SHUFFLE(0, 3, 2, 1));
+      const __m256 vi4x9ABCDEFG = _mm256_permute_ps(_mm256_blend_ps(vi4x89ABCDEF, vi4xCDEFGHIJ, 0x11), _MM_SHUFFLE(0, 3, 2, 1));
+      const __m256 vi5x9ABCDEFG = _mm256_permute_ps(_mm256_blend_ps(vi5x89ABCDEF, vi5xCDEFGHIJ, 0x11), _MM_SHUFFLE(0, 3, 2, 1));
+
+      vo0p1 = _mm256_add_ps(vo0p1, _mm256_mul_ps(vi0x9ABCDEFG, vk03));
+      vo1p1 = _mm256_add_ps(vo1p1, _mm256_mul_ps(vi1x9ABCDEFG, vk03));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi1x9ABCDEFG, vk13));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi2x9ABCDEFG, vk13));
+      vo0p1 = _mm256_add_ps(vo0p1, _mm256_mul_ps(vi2x9ABCDEFG, vk23));
+      vo1p1 = _mm256_add_ps(vo1p1, _mm256_mul_ps(vi3x9ABCDEFG, vk23));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi3x9ABCDEFG, vk33));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi4x9ABCDEFG, vk33));
+      vo0p1 = _mm256_add_ps(vo0p1, _mm256_mul_ps(vi4x9ABCDEFG, vk43));
+      vo1p1 = _mm256_add_ps(vo1p1, _mm256_mul_ps(vi5x9ABCDEFG, vk43));
+
+      const __m256 vi0xABCDEFGH = _mm256_shuffle_ps(vi0x89ABCDEF, vi0xCDEFGHIJ, _MM_SHUFFLE(1, 0, 3, 2));
+      vi0x456789AB = vi0xCDEFGHIJ;
+      vi0x89ABCDEF = vi0xGHIJKLMN;
+      const __m256 vi1xABCDEFGH = _mm256_shuffle_ps(vi1x89ABCDEF, vi1xCDEFGHIJ, _MM_SHUFFLE(1, 0, 3, 2));
+      vi1x456789AB = vi1xCDEFGHIJ;
+      vi1x89ABCDEF = vi1xGHIJKLMN;
+      const __m256 vi2xABCDEFGH = _mm256_shuffle_ps(vi2x89ABCDEF, vi2xCDEFGHIJ, _MM_SHUFFLE(1, 0, 3, 2));
+      vi2x456789AB = vi2xCDEFGHIJ;
+      vi2x89ABCDEF = vi2xGHIJKLMN;
+      const __m256 vi3xABCDEFGH = _mm256_shuffle_ps(vi3x89ABCDEF, vi3xCDEFGHIJ, _MM_SHUFFLE(1, 0, 3, 2));
+      vi3x456789AB = vi3xCDEFGHIJ;
+      vi3x89ABCDEF = vi3xGHIJKLMN;
+      const __m256 vi4xABCDEFGH = _mm256_shuffle_ps(vi4x89ABCDEF, vi4xCDEFGHIJ, _MM_SHUFFLE(1, 0, 3, 2));
+      vi4x456789AB = vi4xCDEFGHIJ;
+      vi4x89ABCDEF = vi4xGHIJKLMN;
+      const __m256 vi5xABCDEFGH = _mm256_shuffle_ps(vi5x89ABCDEF, vi5xCDEFGHIJ, _MM_SHUFFLE(1, 0, 3, 2));
+      vi5x456789AB = vi5xCDEFGHIJ;
+      vi5x89ABCDEF = vi5xGHIJKLMN;
+
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi0xABCDEFGH, vk04));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi1xABCDEFGH, vk04));
+      vo0p1 = _mm256_add_ps(vo0p1, _mm256_mul_ps(vi1xABCDEFGH, vk14));
+      vo1p1 = _mm256_add_ps(vo1p1, _mm256_mul_ps(vi2xABCDEFGH, vk14));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi2xABCDEFGH, vk24));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi3xABCDEFGH, vk24));
+      vo0p1 = _mm256_add_ps(vo0p1, _mm256_mul_ps(vi3xABCDEFGH, vk34));
+      vo1p1 = _mm256_add_ps(vo1p1, _mm256_mul_ps(vi4xABCDEFGH, vk34));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi4xABCDEFGH, vk44));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi5xABCDEFGH, vk44));
+
+      vo0p0 = _mm256_add_ps(vo0p0, vo0p1);
+      vo1p0 = _mm256_add_ps(vo1p0, vo1p1);
+
+      __m256 vo0 = _mm256_max_ps(vo0p0, vmin);
+      __m256 vo1 = _mm256_max_ps(vo1p0, vmin);
+
+      vo0 = _mm256_min_ps(vo0, vmax);
+      vo1 = _mm256_min_ps(vo1, vmax);
+
+      _mm256_storeu_ps(o1, vo1);
+      o1 += 8;
+      _mm256_storeu_ps(o0, vo0);
+      o0 += 8;
+    }
+    // Always process the last block of 9..16 pixels.
+    if XNN_LIKELY(w > 8 * sizeof(float)) {
+      __m256 vo0p0 = _mm256_add_ps(vbias, _mm256_mul_ps(vi0x89ABCDEF, vk02));
+      __m256 vo1p0 = _mm256_add_ps(vbias, _mm256_mul_ps(vi1x89ABCDEF, vk02));
+      __m256 vo0p1 = _mm256_mul_ps(vi1x89ABCDEF, vk12);
+      __m256 vo1p1 = _mm256_mul_ps(vi2x89ABCDEF, vk12);
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi2x89ABCDEF, vk22));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi3x89ABCDEF, vk22));
+      vo0p1 = _mm256_add_ps(vo0p1, _mm256_mul_ps(vi3x89ABCDEF, vk32));
+      vo1p1 = _mm256_add_ps(vo1p1, _mm256_mul_ps(vi4x89ABCDEF, vk32));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi4x89ABCDEF, vk42));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi5x89ABCDEF, vk42));
+
+      const __m256 vi0xGHIJKLMN = _mm256_and_ps(_mm256_loadu_ps(i0), vmask);
+      i0 += 8;
+      const __m256 vi1xGHIJKLMN = _mm256_and_ps(_mm256_loadu_ps(i1), vmask);
+      i1 += 8;
+      const __m256 vi2xGHIJKLMN = _mm256_and_ps(_mm256_loadu_ps(i2), vmask);
+      i2 += 8;
+      const __m256 vi3xGHIJKLMN = _mm256_and_ps(_mm256_loadu_ps(i3), vmask);
+      i3 += 8;
+      const __m256 vi4xGHIJKLMN = _mm256_and_ps(_mm256_loadu_ps(i4), vmask);
+      i4 += 8;
+      const __m256 vi5xGHIJKLMN = _mm256_and_ps(_mm256_loadu_ps(i5), vmask);
+      i5 += 8;
+
+      const __m256 vi0x789ABCDE = _mm256_permute_ps(_mm256_blend_ps(vi0x89ABCDEF, vi0x456789AB, 0x88), _MM_SHUFFLE(2, 1, 0, 3));
+      const __m256 vi1x789ABCDE = _mm256_permute_ps(_mm256_blend_ps(vi1x89ABCDEF, vi1x456789AB, 0x88), _MM_SHUFFLE(2, 1, 0, 3));
+      const __m256 vi2x789ABCDE = _mm256_permute_ps(_mm256_blend_ps(vi2x89ABCDEF, vi2x456789AB, 0x88), _MM_SHUFFLE(2, 1, 0, 3));
+      const __m256 vi3x789ABCDE = _mm256_permute_ps(_mm256_blend_ps(vi3x89ABCDEF, vi3x456789AB, 0x88), _MM_SHUFFLE(2, 1, 0, 3));
+      const __m256 vi4x789ABCDE = _mm256_permute_ps(_mm256_blend_ps(vi4x89ABCDEF, vi4x456789AB, 0x88), _MM_SHUFFLE(2, 1, 0, 3));
+      const __m256 vi5x789ABCDE = _mm256_permute_ps(_mm256_blend_ps(vi5x89ABCDEF, vi5x456789AB, 0x88), _MM_SHUFFLE(2, 1, 0, 3));
+
+      vo0p1 = _mm256_add_ps(vo0p1, _mm256_mul_ps(vi0x789ABCDE, vk01));
+      vo1p1 = _mm256_add_ps(vo1p1, _mm256_mul_ps(vi1x789ABCDE, vk01));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi1x789ABCDE, vk11));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi2x789ABCDE, vk11));
+      vo0p1 = _mm256_add_ps(vo0p1, _mm256_mul_ps(vi2x789ABCDE, vk21));
+      vo1p1 = _mm256_add_ps(vo1p1, _mm256_mul_ps(vi3x789ABCDE, vk21));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi3x789ABCDE, vk31));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi4x789ABCDE, vk31));
+      vo0p1 = _mm256_add_ps(vo0p1, _mm256_mul_ps(vi4x789ABCDE, vk41));
+      vo1p1 = _mm256_add_ps(vo1p1, _mm256_mul_ps(vi5x789ABCDE, vk41));
+
+      const __m256 vi0x6789ABCD = _mm256_shuffle_ps(vi0x456789AB, vi0x89ABCDEF, _MM_SHUFFLE(1, 0, 3, 2));
+      const __m256 vi1x6789ABCD = _mm256_shuffle_ps(vi1x456789AB, vi1x89ABCDEF, _MM_SHUFFLE(1, 0, 3, 2));
+      const __m256 vi2x6789ABCD = _mm256_shuffle_ps(vi2x456789AB, vi2x89ABCDEF, _MM_SHUFFLE(1, 0, 3, 2));
+      const __m256 vi3x6789ABCD = _mm256_shuffle_ps(vi3x456789AB, vi3x89ABCDEF, _MM_SHUFFLE(1, 0, 3, 2));
+      const __m256 vi4x6789ABCD = _mm256_shuffle_ps(vi4x456789AB, vi4x89ABCDEF, _MM_SHUFFLE(1, 0, 3, 2));
+      const __m256 vi5x6789ABCD = _mm256_shuffle_ps(vi5x456789AB, vi5x89ABCDEF, _MM_SHUFFLE(1, 0, 3, 2));
+
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi0x6789ABCD, vk00));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi1x6789ABCD, vk00));
+      vo0p1 = _mm256_add_ps(vo0p1, _mm256_mul_ps(vi1x6789ABCD, vk10));
+      vo1p1 = _mm256_add_ps(vo1p1, _mm256_mul_ps(vi2x6789ABCD, vk10));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi2x6789ABCD, vk20));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi3x6789ABCD, vk20));
+      vo0p1 = _mm256_add_ps(vo0p1, _mm256_mul_ps(vi3x6789ABCD, vk30));
+      vo1p1 = _mm256_add_ps(vo1p1, _mm256_mul_ps(vi4x6789ABCD, vk30));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi4x6789ABCD, vk40));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi5x6789ABCD, vk40));
+
+      const __m256 vi0xCDEFGHIJ = _mm256_permute2f128_ps(vi0x89ABCDEF, vi0xGHIJKLMN, 0x21);
+      const __m256 vi1xCDEFGHIJ = _mm256_permute2f128_ps(vi1x89ABCDEF, vi1xGHIJKLMN, 0x21);
+      const __m256 vi2xCDEFGHIJ = _mm256_permute2f128_ps(vi2x89ABCDEF, vi2xGHIJKLMN, 0x21);
+      const __m256 vi3xCDEFGHIJ = _mm256_permute2f128_ps(vi3x89ABCDEF, vi3xGHIJKLMN, 0x21);
+      const __m256 vi4xCDEFGHIJ = _mm256_permute2f128_ps(vi4x89ABCDEF, vi4xGHIJKLMN, 0x21);
+      const __m256 vi5xCDEFGHIJ = _mm256_permute2f128_ps(vi5x89ABCDEF, vi5xGHIJKLMN, 0x21);
+
+      const __m256 vi0x9ABCDEFG = _mm256_permute_ps(_mm256_blend_ps(vi0x89ABCDEF, vi0xCDEFGHIJ, 0x11), _MM_SHUFFLE(0, 3, 2, 1));
+      const __m256 vi1x9ABCDEFG = _mm256_permute_ps(_mm256_blend_ps(vi1x89ABCDEF, vi1xCDEFGHIJ, 0x11), _MM_SHUFFLE(0, 3, 2, 1));
+      const __m256 vi2x9ABCDEFG = _mm256_permute_ps(_mm256_blend_ps(vi2x89ABCDEF, vi2xCDEFGHIJ, 0x11), _MM_SHUFFLE(0, 3, 2, 1));
+      const __m256 vi3x9ABCDEFG = _mm256_permute_ps(_mm256_blend_ps(vi3x89ABCDEF, vi3xCDEFGHIJ, 0x11), _MM_SHUFFLE(0, 3, 2, 1));
+      const __m256 vi4x9ABCDEFG = _mm256_permute_ps(_mm256_blend_ps(vi4x89ABCDEF, vi4xCDEFGHIJ, 0x11), _MM_SHUFFLE(0, 3, 2, 1));
+      const __m256 vi5x9ABCDEFG = _mm256_permute_ps(_mm256_blend_ps(vi5x89ABCDEF, vi5xCDEFGHIJ, 0x11), _MM_SHUFFLE(0, 3, 2, 1));
+
+      vo0p1 = _mm256_add_ps(vo0p1, _mm256_mul_ps(vi0x9ABCDEFG, vk03));
+      vo1p1 = _mm256_add_ps(vo1p1, _mm256_mul_ps(vi1x9ABCDEFG, vk03));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi1x9ABCDEFG, vk13));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi2x9ABCDEFG, vk13));
+      vo0p1 = _mm256_add_ps(vo0p1, _mm256_mul_ps(vi2x9ABCDEFG, vk23));
+      vo1p1 = _mm256_add_ps(vo1p1, _mm256_mul_ps(vi3x9ABCDEFG, vk23));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi3x9ABCDEFG, vk33));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi4x9ABCDEFG, vk33));
+      vo0p1 = _mm256_add_ps(vo0p1, _mm256_mul_ps(vi4x9ABCDEFG, vk43));
+      vo1p1 = _mm256_add_ps(vo1p1, _mm256_mul_ps(vi5x9ABCDEFG, vk43));
+
+      const __m256 vi0xABCDEFGH = _mm256_shuffle_ps(vi0x89ABCDEF, vi0xCDEFGHIJ, _MM_SHUFFLE(1, 0, 3, 2));
+      vi0x456789AB = vi0xCDEFGHIJ;
+      vi0x89ABCDEF = vi0xGHIJKLMN;
+      const __m256 vi1xABCDEFGH = _mm256_shuffle_ps(vi1x89ABCDEF, vi1xCDEFGHIJ, _MM_SHUFFLE(1, 0, 3, 2));
+      vi1x456789AB = vi1xCDEFGHIJ;
+      vi1x89ABCDEF = vi1xGHIJKLMN;
+      const __m256 vi2xABCDEFGH = _mm256_shuffle_ps(vi2x89ABCDEF, vi2xCDEFGHIJ, _MM_SHUFFLE(1, 0, 3, 2));
+      vi2x456789AB = vi2xCDEFGHIJ;
+      vi2x89ABCDEF = vi2xGHIJKLMN;
+      const __m256 vi3xABCDEFGH = _mm256_shuffle_ps(vi3x89ABCDEF, vi3xCDEFGHIJ, _MM_SHUFFLE(1, 0, 3, 2));
+      vi3x456789AB = vi3xCDEFGHIJ;
+      vi3x89ABCDEF = vi3xGHIJKLMN;
+      const __m256 vi4xABCDEFGH = _mm256_shuffle_ps(vi4x89ABCDEF, vi4xCDEFGHIJ, _MM_SHUFFLE(1, 0, 3, 2));
+      vi4x456789AB = vi4xCDEFGHIJ;
+      vi4x89ABCDEF = vi4xGHIJKLMN;
+      const __m256 vi5xABCDEFGH = _mm256_shuffle_ps(vi5x89ABCDEF, vi5xCDEFGHIJ, _MM_SHUFFLE(1, 0, 3, 2));
+      vi5x456789AB = vi5xCDEFGHIJ;
+      vi5x89ABCDEF = vi5xGHIJKLMN;
+
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi0xABCDEFGH, vk04));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi1xABCDEFGH, vk04));
+      vo0p1 = _mm256_add_ps(vo0p1, _mm256_mul_ps(vi1xABCDEFGH, vk14));
+      vo1p1 = _mm256_add_ps(vo1p1, _mm256_mul_ps(vi2xABCDEFGH, vk14));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi2xABCDEFGH, vk24));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi3xABCDEFGH, vk24));
+      vo0p1 = _mm256_add_ps(vo0p1, _mm256_mul_ps(vi3xABCDEFGH, vk34));
+      vo1p1 = _mm256_add_ps(vo1p1, _mm256_mul_ps(vi4xABCDEFGH, vk34));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi4xABCDEFGH, vk44));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi5xABCDEFGH, vk44));
+
+      vo0p0 = _mm256_add_ps(vo0p0, vo0p1);
+      vo1p0 = _mm256_add_ps(vo1p0, vo1p1);
+
+      __m256 vo0 = _mm256_max_ps(vo0p0, vmin);
+      __m256 vo1 = _mm256_max_ps(vo1p0, vmin);
+
+      vo0 = _mm256_min_ps(vo0, vmax);
+      vo1 = _mm256_min_ps(vo1, vmax);
+
+      _mm256_storeu_ps(o1, vo1);
+      o1 += 8;
+      _mm256_storeu_ps(o0, vo0);
+      o0 += 8;
+
+      w -= 8 * sizeof(float);
+    }
+    assert(w >= 1 * sizeof(float));
+    assert(w <= 8 * sizeof(float));
+    {
+      vi0x89ABCDEF = _mm256_and_ps(vi0x89ABCDEF, vmask);
+      vi1x89ABCDEF = _mm256_and_ps(vi1x89ABCDEF, vmask);
+      vi2x89ABCDEF = _mm256_and_ps(vi2x89ABCDEF, vmask);
+      vi3x89ABCDEF = _mm256_and_ps(vi3x89ABCDEF, vmask);
+      vi4x89ABCDEF = _mm256_and_ps(vi4x89ABCDEF, vmask);
+      vi5x89ABCDEF = _mm256_and_ps(vi5x89ABCDEF, vmask);
+
+      __m256 vo0p0 = _mm256_add_ps(vbias, _mm256_mul_ps(vi0x89ABCDEF, vk02));
+      __m256 vo1p0 = _mm256_add_ps(vbias, _mm256_mul_ps(vi1x89ABCDEF, vk02));
+      __m256 vo0p1 = _mm256_mul_ps(vi1x89ABCDEF, vk12);
+      __m256 vo1p1 = _mm256_mul_ps(vi2x89ABCDEF, vk12);
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi2x89ABCDEF, vk22));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi3x89ABCDEF, vk22));
+      vo0p1 = _mm256_add_ps(vo0p1, _mm256_mul_ps(vi3x89ABCDEF, vk32));
+      vo1p1 = _mm256_add_ps(vo1p1, _mm256_mul_ps(vi4x89ABCDEF, vk32));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi4x89ABCDEF, vk42));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi5x89ABCDEF, vk42));
+
+      const __m256 vi0x789ABCDE = _mm256_permute_ps(_mm256_blend_ps(vi0x89ABCDEF, vi0x456789AB, 0x88), _MM_SHUFFLE(2, 1, 0, 3));
+      const __m256 vi1x789ABCDE = _mm256_permute_ps(_mm256_blend_ps(vi1x89ABCDEF, vi1x456789AB, 0x88), _MM_SHUFFLE(2, 1, 0, 3));
+      const __m256 vi2x789ABCDE = _mm256_permute_ps(_mm256_blend_ps(vi2x89ABCDEF, vi2x456789AB, 0x88), _MM_SHUFFLE(2, 1, 0, 3));
+      const __m256 vi3x789ABCDE = _mm256_permute_ps(_mm256_blend_ps(vi3x89ABCDEF, vi3x456789AB, 0x88), _MM_SHUFFLE(2, 1, 0, 3));
+      const __m256 vi4x789ABCDE = _mm256_permute_ps(_mm256_blend_ps(vi4x89ABCDEF, vi4x456789AB, 0x88), _MM_SHUFFLE(2, 1, 0, 3));
+      const __m256 vi5x789ABCDE = _mm256_permute_ps(_mm256_blend_ps(vi5x89ABCDEF, vi5x456789AB, 0x88), _MM_SHUFFLE(2, 1, 0, 3));
+
+      vo0p1 = _mm256_add_ps(vo0p1, _mm256_mul_ps(vi0x789ABCDE, vk01));
+      vo1p1 = _mm256_add_ps(vo1p1, _mm256_mul_ps(vi1x789ABCDE, vk01));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi1x789ABCDE, vk11));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi2x789ABCDE, vk11));
+      vo0p1 = _mm256_add_ps(vo0p1, _mm256_mul_ps(vi2x789ABCDE, vk21));
+      vo1p1 = _mm256_add_ps(vo1p1, _mm256_mul_ps(vi3x789ABCDE, vk21));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi3x789ABCDE, vk31));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi4x789ABCDE, vk31));
+      vo0p1 = _mm256_add_ps(vo0p1, _mm256_mul_ps(vi4x789ABCDE, vk41));
+      vo1p1 = _mm256_add_ps(vo1p1, _mm256_mul_ps(vi5x789ABCDE, vk41));
+
+      const __m256 vi0x6789ABCD = _mm256_shuffle_ps(vi0x456789AB, vi0x89ABCDEF, _MM_SHUFFLE(1, 0, 3, 2));
+      const __m256 vi1x6789ABCD = _mm256_shuffle_ps(vi1x456789AB, vi1x89ABCDEF, _MM_SHUFFLE(1, 0, 3, 2));
+      const __m256 vi2x6789ABCD = _mm256_shuffle_ps(vi2x456789AB, vi2x89ABCDEF, _MM_SHUFFLE(1, 0, 3, 2));
+      const __m256 vi3x6789ABCD = _mm256_shuffle_ps(vi3x456789AB, vi3x89ABCDEF, _MM_SHUFFLE(1, 0, 3, 2));
+      const __m256 vi4x6789ABCD = _mm256_shuffle_ps(vi4x456789AB, vi4x89ABCDEF, _MM_SHUFFLE(1, 0, 3, 2));
+      const __m256 vi5x6789ABCD = _mm256_shuffle_ps(vi5x456789AB, vi5x89ABCDEF, _MM_SHUFFLE(1, 0, 3, 2));
+
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi0x6789ABCD, vk00));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi1x6789ABCD, vk00));
+      vo0p1 = _mm256_add_ps(vo0p1, _mm256_mul_ps(vi1x6789ABCD, vk10));
+      vo1p1 = _mm256_add_ps(vo1p1, _mm256_mul_ps(vi2x6789ABCD, vk10));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi2x6789ABCD, vk20));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi3x6789ABCD, vk20));
+      vo0p1 = _mm256_add_ps(vo0p1, _mm256_mul_ps(vi3x6789ABCD, vk30));
+      vo1p1 = _mm256_add_ps(vo1p1, _mm256_mul_ps(vi4x6789ABCD, vk30));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi4x6789ABCD, vk40));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi5x6789ABCD, vk40));
+
+      // vi0xCDEFGHIJ = ( 0.0, 0.0, 0.0, 0.0, vi0F, vi0E, vi0D, vi0C )
+      const __m256 vi0xCDEFGHIJ = _mm256_permute2f128_ps(vi0x89ABCDEF, vi0x89ABCDEF, 0x81);
+      // vi1xCDEFGHIJ = ( 0.0, 0.0, 0.0, 0.0, vi1F, vi1E, vi1D, vi1C )
+      const __m256 vi1xCDEFGHIJ = _mm256_permute2f128_ps(vi1x89ABCDEF, vi1x89ABCDEF, 0x81);
+      // vi2xCDEFGHIJ = ( 0.0, 0.0, 0.0, 0.0, vi2F, vi2E, vi2D, vi2C )
+      const __m256 vi2xCDEFGHIJ = _mm256_permute2f128_ps(vi2x89ABCDEF, vi2x89ABCDEF, 0x81);
+      // vi3xCDEFGHIJ = ( 0.0, 0.0, 0.0, 0.0, vi3F, vi3E, vi3D, vi3C )
+      const __m256 vi3xCDEFGHIJ = _mm256_permute2f128_ps(vi3x89ABCDEF, vi3x89ABCDEF, 0x81);
+      // vi4xCDEFGHIJ = ( 0.0, 0.0, 0.0, 0.0, vi4F, vi4E, vi4D, vi4C )
+      const __m256 vi4xCDEFGHIJ = _mm256_permute2f128_ps(vi4x89ABCDEF, vi4x89ABCDEF, 0x81);
+      // vi5xCDEFGHIJ = ( 0.0, 0.0, 0.0, 0.0, vi5F, vi5E, vi5D, vi5C )
+      const __m256 vi5xCDEFGHIJ = _mm256_permute2f128_ps(vi5x89ABCDEF, vi5x89ABCDEF, 0x81);
+
+      const __m256 vi0x9ABCDEFG = _mm256_permute_ps(_mm256_blend_ps(vi0x89ABCDEF, vi0xCDEFGHIJ, 0x11), _MM_SHUFFLE(0, 3, 2, 1));
+      const __m256 vi1x9ABCDEFG = _mm256_permute_ps(_mm256_blend_ps(vi1x89ABCDEF, vi1xCDEFGHIJ, 0x11), _MM_SHUFFLE(0, 3, 2, 1));
+      const __m256 vi2x9ABCDEFG = _mm256_permute_ps(_mm256_blend_ps(vi2x89ABCDEF, vi2xCDEFGHIJ, 0x11), _MM_SHUFFLE(0, 3, 2, 1));
+      const __m256 vi3x9ABCDEFG = _mm256_permute_ps(_mm256_blend_ps(vi3x89ABCDEF, vi3xCDEFGHIJ, 0x11), _MM_SHUFFLE(0, 3, 2, 1));
+      const __m256 vi4x9ABCDEFG = _mm256_permute_ps(_mm256_blend_ps(vi4x89ABCDEF, vi4xCDEFGHIJ, 0x11), _MM_SHUFFLE(0, 3, 2, 1));
+      const __m256 vi5x9ABCDEFG = _mm256_permute_ps(_mm256_blend_ps(vi5x89ABCDEF, vi5xCDEFGHIJ, 0x11), _MM_SHUFFLE(0, 3, 2, 1));
+
+      vo0p1 = _mm256_add_ps(vo0p1, _mm256_mul_ps(vi0x9ABCDEFG, vk03));
+      vo1p1 = _mm256_add_ps(vo1p1, _mm256_mul_ps(vi1x9ABCDEFG, vk03));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi1x9ABCDEFG, vk13));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi2x9ABCDEFG, vk13));
+      vo0p1 = _mm256_add_ps(vo0p1, _mm256_mul_ps(vi2x9ABCDEFG, vk23));
+      vo1p1 = _mm256_add_ps(vo1p1, _mm256_mul_ps(vi3x9ABCDEFG, vk23));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi3x9ABCDEFG, vk33));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi4x9ABCDEFG, vk33));
+      vo0p1 = _mm256_add_ps(vo0p1, _mm256_mul_ps(vi4x9ABCDEFG, vk43));
+      vo1p1 = _mm256_add_ps(vo1p1, _mm256_mul_ps(vi5x9ABCDEFG, vk43));
+
+      const __m256 vi0xABCDEFGH = _mm256_shuffle_ps(vi0x89ABCDEF, vi0xCDEFGHIJ, _MM_SHUFFLE(1, 0, 3, 2));
+      const __m256 vi1xABCDEFGH = _mm256_shuffle_ps(vi1x89ABCDEF, vi1xCDEFGHIJ, _MM_SHUFFLE(1, 0, 3, 2));
+      const __m256 vi2xABCDEFGH = _mm256_shuffle_ps(vi2x89ABCDEF, vi2xCDEFGHIJ, _MM_SHUFFLE(1, 0, 3, 2));
+      const __m256 vi3xABCDEFGH = _mm256_shuffle_ps(vi3x89ABCDEF, vi3xCDEFGHIJ, _MM_SHUFFLE(1, 0, 3, 2));
+      const __m256 vi4xABCDEFGH = _mm256_shuffle_ps(vi4x89ABCDEF, vi4xCDEFGHIJ, _MM_SHUFFLE(1, 0, 3, 2));
+      const __m256 vi5xABCDEFGH = _mm256_shuffle_ps(vi5x89ABCDEF, vi5xCDEFGHIJ, _MM_SHUFFLE(1, 0, 3, 2));
+
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi0xABCDEFGH, vk04));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi1xABCDEFGH, vk04));
+      vo0p1 = _mm256_add_ps(vo0p1, _mm256_mul_ps(vi1xABCDEFGH, vk14));
+      vo1p1 = _mm256_add_ps(vo1p1, _mm256_mul_ps(vi2xABCDEFGH, vk14));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi2xABCDEFGH, vk24));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi3xABCDEFGH, vk24));
+      vo0p1 = _mm256_add_ps(vo0p1, _mm256_mul_ps(vi3xABCDEFGH, vk34));
+      vo1p1 = _mm256_add_ps(vo1p1, _mm256_mul_ps(vi4xABCDEFGH, vk34));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi4xABCDEFGH, vk44));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi5xABCDEFGH, vk44));
+
+      vo0p0 = _mm256_add_ps(vo0p0, vo0p1);
+      vo1p0 = _mm256_add_ps(vo1p0, vo1p1);
+
+      __m256 vo0 = _mm256_max_ps(vo0p0, vmin);
+      __m256 vo1 = _mm256_max_ps(vo1p0, vmin);
+
+      vo0 = _mm256_min_ps(vo0, vmax);
+      vo1 = _mm256_min_ps(vo1, vmax);
+
+      if XNN_LIKELY(w & (8 * sizeof(float))) {
+        _mm256_storeu_ps(o1, vo1);
+        o1 += 8;
+        _mm256_storeu_ps(o0, vo0);
+        o0 += 8;
+      } else {
+        __m128 vo1_lo = _mm256_castps256_ps128(vo1);
+        __m128 vo0_lo = _mm256_castps256_ps128(vo0);
+        if (w & (4 * sizeof(float))) {
+          _mm_storeu_ps(o1, vo1_lo);
+          o1 += 4;
+          _mm_storeu_ps(o0, vo0_lo);
+          o0 += 4;
+
+          vo0_lo = _mm256_extractf128_ps(vo0, 1);
+          vo1_lo = _mm256_extractf128_ps(vo1, 1);
+        }
+        if (w & (2 * sizeof(float))) {
+          _mm_storel_pi((__m64*) o1, vo1_lo);
+          o1 += 2;
+          _mm_storel_pi((__m64*) o0, vo0_lo);
+          o0 += 2;
+
+          vo0_lo = _mm_movehl_ps(vo0_lo, vo0_lo);
+          vo1_lo = _mm_movehl_ps(vo1_lo, vo1_lo);
+        }
+        if (w & (1 * sizeof(float))) {
+          _mm_store_ss(o1, vo1_lo);
+          o1 += 1;
+          _mm_store_ss(o0, vo0_lo);
+          o0 += 1;
+        }
+      }
+    }
+
+    i0 = (const float*) ((uintptr_t) i2 - input_decrement);
+    i1 = (const float*) ((uintptr_t) i3 - input_decrement);
+    i2 = (const float*) ((uintptr_t) i1 + input_width);
+    i3 = (const float*) ((uintptr_t) i2 + input_width);
+    i4 = (const float*) ((uintptr_t) i3 + input_width);
+    i5 = (const float*) ((uintptr_t) i4 + input_width);
+
+    o0 = o1;
+    o1 = (float*) ((uintptr_t) o0 + input_width);
+
+    output_height = doz(output_height, 2);
+  } while (output_height != 0);
+}
@@ -0,0 +1,705 @@
+// Auto-generated file. Do not edit!
+//   Template: src/f32-dwconv2d-chw/5x5p2-avx512f.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <immintrin.h>
+
+#include <xnnpack/dwconv.h>
+#include <xnnpack/intrinsics-polyfill.h>
+#include <xnnpack/math.h>
+
+
+void xnn_f32_dwconv2d_chw_ukernel_5x5p2__avx512f_4x16(
+    size_t input_height,
+    size_t input_width,
+    const float* input,
+    const float* weights,
+    const float* zero,
+    float* output,
+    uint32_t padding_top,
+    const union xnn_f32_chw_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(input_height != 0);
+  assert(input_width != 0);
+  assert(input_width % sizeof(float) == 0);
+  assert(padding_top == 2);
+
+  // Mask of the valid pixels in the last block of 1..16 pixels of each row.
+  const __mmask16 vmask = _cvtu32_mask16(UINT32_C(0xFFFF) >> (15 - (((input_width - 1 * sizeof(float)) / sizeof(float)) & 15)));
+  const __mmask16 vmask_first = input_width > 16 * sizeof(float) ? _cvtu32_mask16(UINT32_C(0xFFFF)) : vmask;
+  const __m512 vmax = _mm512_set1_ps(params->sse.max[0]);
+  const __m512 vmin = _mm512_set1_ps(params->sse.min[0]);
+
+  const __m512 vbias = _mm512_set1_ps(weights[0]);
+  const __m512 vk00 = _mm512_set1_ps(weights[1]);
+  const __m512 vk01 = _mm512_set1_ps(weights[2]);
+  const __m512 vk02 = _mm512_set1_ps(weights[3]);
+  const __m512 vk03 = _mm512_set1_ps(weights[4]);
+  const __m512 vk04 = _mm512_set1_ps(weights[5]);
+  const __m512 vk10 = _mm512_set1_ps(weights[6]);
+  const __m512 vk11 = _mm512_set1_ps(weights[7]);
+  const __m512 vk12 = _mm512_set1_ps(weights[8]);
+  const __m512 vk13 = _mm512_set1_ps(weights[9]);
+  const __m512 vk14 = _mm512_set1_ps(weights[10]);
+  const __m512 vk20 = _mm512_set1_ps(weights[11]);
+  const __m512 vk21 = _mm512_set1_ps(weights[12]);
+  const __m512 vk22 = _mm512_set1_ps(weights[13]);
+  const __m512 vk23 = _mm512_set1_ps(weights[14]);
+  const __m512 vk24 = _mm512_set1_ps(weights[15]);
+  const __m512 vk30 = _mm512_set1_ps(weights[16]);
+  const __m512 vk31 = _mm512_set1_ps(weights[17]);
+  const __m512 vk32 = _mm512_set1_ps(weights[18]);
+  const __m512 vk33 = _mm512_set1_ps(weights[19]);
+  const __m512 vk34 = _mm512_set1_ps(weights[20]);
+  const __m512 vk40 = _mm512_set1_ps(weights[21]);
+  const __m512 vk41 = _mm512_set1_ps(weights[22]);
+  const __m512 vk42 = _mm512_set1_ps(weights[23]);
+  const __m512 vk43 = _mm512_set1_ps(weights[24]);
+  const __m512 vk44 = _mm512_set1_ps(weights[25]);
+
+  const size_t input_decrement = round_up_po2(input_width, 16 * sizeof(float));
+
+  const float* i0 = zero;
+  const float* i1 = zero;
+  const float* i2 = input;
+  const float* i3 = (const float*) ((uintptr_t) i2 + input_width);
+  const float* i4 = (const float*) ((uintptr_t) i3 + input_width);
+  const float* i5 = (const float*) ((uintptr_t) i4 + input_width);
+  const float* i6 = (const float*) ((uintptr_t) i5 + input_width);
+  const float* i7 = (const float*) ((uintptr_t) i6 + input_width);
+
+  float* o0 = output;
+  float* o1 = (float*) ((uintptr_t) o0 + input_width);
+  float* o2 = (float*) ((uintptr_t) o1 + input_width);
+  float* o3 = (float*) ((uintptr_t) o2 + input_width);
+
+  size_t output_height = input_height;
+  do {
+    if XNN_UNPREDICTABLE(output_height < 2) {
+      i3 = zero;
+      o1 = o0;
+    }
+    if XNN_UNPREDICTABLE(output_height < 3) {
+      i4 = zero;
+      o2 = o1;
+    }
+    if XNN_UNPREDICTABLE(output_height < 4) {
+      i5 = zero;
+      o3 = o2;
+    }
+    if XNN_UNPREDICTABLE(output_height < 5) {
+      i6 = zero;
+    }
+    if XNN_UNPREDICTABLE(output_height < 6) {
+      i7 = zero;
+    }
+
+    __m512 vi0x0123456789ABCDEF = _mm512_setzero_ps();
+    __m512 vi1x0123456789ABCDEF = _mm512_setzero_ps();
+    __m512 vi2x0123456789ABCDEF = _mm512_setzero_ps();
+    __m512 vi3x0123456789ABCDEF = _mm512_setzero_ps();
+    __m512 vi4x0123456789ABCDEF = _mm512_setzero_ps();
+    __m512 vi5x0123456789ABCDEF = _mm512_setzero_ps();
+    __m512 vi6x0123456789ABCDEF = _mm512_setzero_ps();
+    __m512 vi7x0123456789ABCDEF = _mm512_setzero_ps();
+
+    __m512 vi0xGHIJKLMNOPQRSTUV = _mm512_maskz_loadu_ps(vmask_first, i0);
+    i0 += 16;
+    __m512 vi1xGHIJKLMNOPQRSTUV = _mm512_maskz_loadu_ps(vmask_first, i1);
+    i1 += 16;
+    __m512 vi2xGHIJKLMNOPQRSTUV = _mm512_maskz_loadu_ps(vmask_first, i2);
+    i2 += 16;
+    __m512 vi3xGHIJKLMNOPQRSTUV = _mm512_maskz_loadu_ps(vmask_first, i3);
+    i3 += 16;
+    __m512 vi4xGHIJKLMNOPQRSTUV = _mm512_maskz_loadu_ps(vmask_first, i4);
+    i4 += 16;
+    __m512 vi5xGHIJKLMNOPQRSTUV = _mm512_maskz_loadu_ps(vmask_first, i5);
+    i5 += 16;
+    __m512 vi6xGHIJKLMNOPQRSTUV = _mm512_maskz_loadu_ps(vmask_first, i6);
+    i6 += 16;
+    __m512 vi7xGHIJKLMNOPQRSTUV = _mm512_maskz_loadu_ps(vmask_first, i7);
+    i7 += 16;
+
+    size_t w = input_width;
+    for (; w > 32 * sizeof(float); w -= 16 * sizeof(float)) {
+      __m512 vo0p0 = _mm512_fmadd_ps(vi0xGHIJKLMNOPQRSTUV, vk02, vbias);
+      __m512 vo1p0 = _mm512_fmadd_ps(vi1xGHIJKLMNOPQRSTUV, vk02, vbias);
+      __m512 vo2p0 = _mm512_fmadd_ps(vi2xGHIJKLMNOPQRSTUV, vk02, vbias);
+      __m512 vo3p0 = _mm512_fmadd_ps(vi3xGHIJKLMNOPQRSTUV, vk02, vbias);
+      vo0p0 = _mm512_fmadd_ps(vi1xGHIJKLMNOPQRSTUV, vk12, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi2xGHIJKLMNOPQRSTUV, vk12, vo1p0);
+      vo2p0 = _mm512_fmadd_ps(vi3xGHIJKLMNOPQRSTUV, vk12, vo2p0);
+      vo3p0 = _mm512_fmadd_ps(vi4xGHIJKLMNOPQRSTUV, vk12, vo3p0);
+      vo0p0 = _mm512_fmadd_ps(vi2xGHIJKLMNOPQRSTUV, vk22, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi3xGHIJKLMNOPQRSTUV, vk22, vo1p0);
+      vo2p0 = _mm512_fmadd_ps(vi4xGHIJKLMNOPQRSTUV, vk22, vo2p0);
+      vo3p0 = _mm512_fmadd_ps(vi5xGHIJKLMNOPQRSTUV, vk22, vo3p0);
+      vo0p0 = _mm512_fmadd_ps(vi3xGHIJKLMNOPQRSTUV, vk32, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi4xGHIJKLMNOPQRSTUV, vk32, vo1p0);
+      vo2p0 = _mm512_fmadd_ps(vi5xGHIJKLMNOPQRSTUV, vk32, vo2p0);
+      vo3p0 = _mm512_fmadd_ps(vi6xGHIJKLMNOPQRSTUV, vk32, vo3p0);
+      vo0p0 = _mm512_fmadd_ps(vi4xGHIJKLMNOPQRSTUV, vk42, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi5xGHIJKLMNOPQRSTUV, vk42, vo1p0);
+      vo2p0 = _mm512_fmadd_ps(vi6xGHIJKLMNOPQRSTUV, vk42, vo2p0);
+      vo3p0 = _mm512_fmadd_ps(vi7xGHIJKLMNOPQRSTUV, vk42, vo3p0);
+
+      const __m512 vi0xWXYZabcdefghijkl = _mm512_loadu_ps(i0);
+      i0 += 16;
+      const __m512 vi1xWXYZabcdefghijkl = _mm512_loadu_ps(i1);
+      i1 += 16;
+      const __m512 vi2xWXYZabcdefghijkl = _mm512_loadu_ps(i2);
+      i2 += 16;
+      const __m512 vi3xWXYZabcdefghijkl = _mm512_loadu_ps(i3);
+      i3 += 16;
+      const __m512 vi4xWXYZabcdefghijkl = _mm512_loadu_ps(i4);
+      i4 += 16;
+      const __m512 vi5xWXYZabcdefghijkl = _mm512_loadu_ps(i5);
+      i5 += 16;
+      const __m512 vi6xWXYZabcdefghijkl = _mm512_loadu_ps(i6);
+      i6 += 16;
+      const __m512 vi7xWXYZabcdefghijkl = _mm512_loadu_ps(i7);
+      i7 += 16;
+
+      const __m512 vi0xFGHIJKLMNOPQRSTU = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi0xGHIJKLMNOPQRSTUV), _mm512_castps_si512(vi0x0123456789ABCDEF), 15));
+      const __m512 vi1xFGHIJKLMNOPQRSTU = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi1xGHIJKLMNOPQRSTUV), _mm512_castps_si512(vi1x0123456789ABCDEF), 15));
+      const __m512 vi2xFGHIJKLMNOPQRSTU = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi2xGHIJKLMNOPQRSTUV), _mm512_castps_si512(vi2x0123456789ABCDEF), 15));
+      const __m512 vi3xFGHIJKLMNOPQRSTU = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi3xGHIJKLMNOPQRSTUV), _mm512_castps_si512(vi3x0123456789ABCDEF), 15));
+      const __m512 vi4xFGHIJKLMNOPQRSTU = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi4xGHIJKLMNOPQRSTUV), _mm512_castps_si512(vi4x0123456789ABCDEF), 15));
+      const __m512 vi5xFGHIJKLMNOPQRSTU = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi5xGHIJKLMNOPQRSTUV), _mm512_castps_si512(vi5x0123456789ABCDEF), 15));
+      const __m512 vi6xFGHIJKLMNOPQRSTU = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi6xGHIJKLMNOPQRSTUV), _mm512_castps_si512(vi6x0123456789ABCDEF), 15));
+      const __m512 vi7xFGHIJKLMNOPQRSTU = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi7xGHIJKLMNOPQRSTUV), _mm512_castps_si512(vi7x0123456789ABCDEF), 15));
+
+      vo0p0 = _mm512_fmadd_ps(vi0xFGHIJKLMNOPQRSTU, vk01, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi1xFGHIJKLMNOPQRSTU, vk01, vo1p0);
+      vo2p0 = _mm512_fmadd_ps(vi2xFGHIJKLMNOPQRSTU, vk01, vo2p0);
+      vo3p0 = _mm512_fmadd_ps(vi3xFGHIJKLMNOPQRSTU, vk01, vo3p0);
+      vo0p0 = _mm512_fmadd_ps(vi1xFGHIJKLMNOPQRSTU, vk11, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi2xFGHIJKLMNOPQRSTU, vk11, vo1p0);
+      vo2p0 = _mm512_fmadd_ps(vi3xFGHIJKLMNOPQRSTU, vk11, vo2p0);
+      vo3p0 = _mm512_fmadd_ps(vi4xFGHIJKLMNOPQRSTU, vk11, vo3p0);
+      vo0p0 = _mm512_fmadd_ps(vi2xFGHIJKLMNOPQRSTU, vk21, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi3xFGHIJKLMNOPQRSTU, vk21, vo1p0);
+      vo2p0 = _mm512_fmadd_ps(vi4xFGHIJKLMNOPQRSTU, vk21, vo2p0);
+      vo3p0 = _mm512_fmadd_ps(vi5xFGHIJKLMNOPQRSTU, vk21, vo3p0);
+      vo0p0 = _mm512_fmadd_ps(vi3xFGHIJKLMNOPQRSTU, vk31, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi4xFGHIJKLMNOPQRSTU, vk31, vo1p0);
+      vo2p0 = _mm512_fmadd_ps(vi5xFGHIJKLMNOPQRSTU, vk31, vo2p0);
+      vo3p0 = _mm512_fmadd_ps(vi6xFGHIJKLMNOPQRSTU, vk31, vo3p0);
+      vo0p0 = _mm512_fmadd_ps(vi4xFGHIJKLMNOPQRSTU, vk41, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi5xFGHIJKLMNOPQRSTU, vk41, vo1p0);
+      vo2p0 = _mm512_fmadd_ps(vi6xFGHIJKLMNOPQRSTU, vk41, vo2p0);
+      vo3p0 = _mm512_fmadd_ps(vi7xFGHIJKLMNOPQRSTU, vk41, vo3p0);
+
+      const __m512 vi0xEFGHIJKLMNOPQRST = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi0xGHIJKLMNOPQRSTUV), _mm512_castps_si512(vi0x0123456789ABCDEF), 14));
+      const __m512 vi1xEFGHIJKLMNOPQRST = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi1xGHIJKLMNOPQRSTUV), _mm512_castps_si512(vi1x0123456789ABCDEF), 14));
+      const __m512 vi2xEFGHIJKLMNOPQRST = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi2xGHIJKLMNOPQRSTUV), _mm512_castps_si512(vi2x0123456789ABCDEF), 14));
+      const __m512 vi3xEFGHIJKLMNOPQRST = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi3xGHIJKLMNOPQRSTUV), _mm512_castps_si512(vi3x0123456789ABCDEF), 14));
+      const __m512 vi4xEFGHIJKLMNOPQRST = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi4xGHIJKLMNOPQRSTUV), _mm512_castps_si512(vi4x0123456789ABCDEF), 14));
+      const __m512 vi5xEFGHIJKLMNOPQRST = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi5xGHIJKLMNOPQRSTUV), _mm512_castps_si512(vi5x0123456789ABCDEF), 14));
+      const __m512 vi6xEFGHIJKLMNOPQRST = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi6xGHIJKLMNOPQRSTUV), _mm512_castps_si512(vi6x0123456789ABCDEF), 14));
+      const __m512 vi7xEFGHIJKLMNOPQRST = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi7xGHIJKLMNOPQRSTUV), _mm512_castps_si512(vi7x0123456789ABCDEF), 14));
+
+      vo0p0 = _mm512_fmadd_ps(vi0xEFGHIJKLMNOPQRST, vk00, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi1xEFGHIJKLMNOPQRST, vk00, vo1p0);
+      vo2p0 = _mm512_fmadd_ps(vi2xEFGHIJKLMNOPQRST, vk00, vo2p0);
+      vo3p0 = _mm512_fmadd_ps(vi3xEFGHIJKLMNOPQRST, vk00, vo3p0);
+      vo0p0 = _mm512_fmadd_ps(vi1xEFGHIJKLMNOPQRST, vk10, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi2xEFGHIJKLMNOPQRST, vk10, vo1p0);
+      vo2p0 = _mm512_fmadd_ps(vi3xEFGHIJKLMNOPQRST, vk10, vo2p0);
+      vo3p0 = _mm512_fmadd_ps(vi4xEFGHIJKLMNOPQRST, vk10, vo3p0);
+      vo0p0 = _mm512_fmadd_ps(vi2xEFGHIJKLMNOPQRST, vk20, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi3xEFGHIJKLMNOPQRST, vk20, vo1p0);
+      vo2p0 = _mm512_fmadd_ps(vi4xEFGHIJKLMNOPQRST, vk20, vo2p0);
+      vo3p0 = _mm512_fmadd_ps(vi5xEFGHIJKLMNOPQRST, vk20, vo3p0);
+      vo0p0 = _mm512_fmadd_ps(vi3xEFGHIJKLMNOPQRST, vk30, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi4xEFGHIJKLMNOPQRST, vk30, vo1p0);
+      vo2p0 = _mm512_fmadd_ps(vi5xEFGHIJKLMNOPQRST, vk30, vo2p0);
+      vo3p0 = _mm512_fmadd_ps(vi6xEFGHIJKLMNOPQRST, vk30, vo3p0);
+      vo0p0 = _mm512_fmadd_ps(vi4xEFGHIJKLMNOPQRST, vk40, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi5xEFGHIJKLMNOPQRST, vk40, vo1p0);
+      vo2p0 = _mm512_fmadd_ps(vi6xEFGHIJKLMNOPQRST, vk40, vo2p0);
+      vo3p0 = _mm512_fmadd_ps(vi7xEFGHIJKLMNOPQRST, vk40, vo3p0);
+
+      const __m512 vi0xHIJKLMNOPQRSTUVW = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi0xWXYZabcdefghijkl), _mm512_castps_si512(vi0xGHIJKLMNOPQRSTUV), 1));
+      const __m512 vi1xHIJKLMNOPQRSTUVW = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi1xWXYZabcdefghijkl), _mm512_castps_si512(vi1xGHIJKLMNOPQRSTUV), 1));
+      const __m512 vi2xHIJKLMNOPQRSTUVW = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi2xWXYZabcdefghijkl), _mm512_castps_si512(vi2xGHIJKLMNOPQRSTUV), 1));
+      const __m512 vi3xHIJKLMNOPQRSTUVW = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi3xWXYZabcdefghijkl), _mm512_castps_si512(vi3xGHIJKLMNOPQRSTUV), 1));
+      const __m512 vi4xHIJKLMNOPQRSTUVW = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi4xWXYZabcdefghijkl), _mm512_castps_si512(vi4xGHIJKLMNOPQRSTUV), 1));
+      const __m512 vi5xHIJKLMNOPQRSTUVW = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi5xWXYZabcdefghijkl), _mm512_castps_si512(vi5xGHIJKLMNOPQRSTUV), 1));
+      const __m512 vi6xHIJKLMNOPQRSTUVW = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi6xWXYZabcdefghijkl), _mm512_castps_si512(vi6xGHIJKLMNOPQRSTUV), 1));
+      const __m512 vi7xHIJKLMNOPQRSTUVW = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi7xWXYZabcdefghijkl), _mm512_castps_si512(vi7xGHIJKLMNOPQRSTUV), 1));
+
+      vo0p0 = _mm512_fmadd_ps(vi0xHIJKLMNOPQRSTUVW, vk03, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi1xHIJKLMNOPQRSTUVW, vk03, vo1p0);
+      vo2p0 = _mm512_fmadd_ps(vi2xHIJKLMNOPQRSTUVW, vk03, vo2p0);
+      vo3p0 = _mm512_fmadd_ps(vi3xHIJKLMNOPQRSTUVW, vk03, vo3p0);
+      vo0p0 = _mm512_fmadd_ps(vi1xHIJKLMNOPQRSTUVW, vk13, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi2xHIJKLMNOPQRSTUVW, vk13, vo1p0);
+      vo2p0 = _mm512_fmadd_ps(vi3xHIJKLMNOPQRSTUVW, vk13, vo2p0);
+      vo3p0 = _mm512_fmadd_ps(vi4xHIJKLMNOPQRSTUVW, vk13, vo3p0);
+      vo0p0 = _mm512_fmadd_ps(vi2xHIJKLMNOPQRSTUVW, vk23, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi3xHIJKLMNOPQRSTUVW, vk23, vo1p0);
+      vo2p0 = _mm512_fmadd_ps(vi4xHIJKLMNOPQRSTUVW, vk23, vo2p0);
+      vo3p0 = _mm512_fmadd_ps(vi5xHIJKLMNOPQRSTUVW, vk23, vo3p0);
+      vo0p0 = _mm512_fmadd_ps(vi3xHIJKLMNOPQRSTUVW, vk33, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi4xHIJKLMNOPQRSTUVW, vk33, vo1p0);
+      vo2p0 = _mm512_fmadd_ps(vi5xHIJKLMNOPQRSTUVW, vk33, vo2p0);
+      vo3p0 = _mm512_fmadd_ps(vi6xHIJKLMNOPQRSTUVW, vk33, vo3p0);
+      vo0p0 = _mm512_fmadd_ps(vi4xHIJKLMNOPQRSTUVW, vk43, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi5xHIJKLMNOPQRSTUVW, vk43, vo1p0);
+      vo2p0 = _mm512_fmadd_ps(vi6xHIJKLMNOPQRSTUVW, vk43, vo2p0);
+      vo3p0 = _mm512_fmadd_ps(vi7xHIJKLMNOPQRSTUVW, vk43, vo3p0);
+
+      const __m512 vi0xIJKLMNOPQRSTUVWX = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi0xWXYZabcdefghijkl), _mm512_castps_si512(vi0xGHIJKLMNOPQRSTUV), 2));
+      vi0x0123456789ABCDEF = vi0xGHIJKLMNOPQRSTUV;
+      vi0xGHIJKLMNOPQRSTUV = vi0xWXYZabcdefghijkl;
+      const __m512 vi1xIJKLMNOPQRSTUVWX = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi1xWXYZabcdefghijkl), _mm512_castps_si512(vi1xGHIJKLMNOPQRSTUV), 2));
+      vi1x0123456789ABCDEF = vi1xGHIJKLMNOPQRSTUV;
+      vi1xGHIJKLMNOPQRSTUV = vi1xWXYZabcdefghijkl;
+      const __m512 vi2xIJKLMNOPQRSTUVWX = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi2xWXYZabcdefghijkl), _mm512_castps_si512(vi2xGHIJKLMNOPQRSTUV), 2));
+      vi2x0123456789ABCDEF = vi2xGHIJKLMNOPQRSTUV;
+      vi2xGHIJKLMNOPQRSTUV = vi2xWXYZabcdefghijkl;
+      const __m512 vi3xIJKLMNOPQRSTUVWX = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi3xWXYZabcdefghijkl), _mm512_castps_si512(vi3xGHIJKLMNOPQRSTUV), 2));
+      vi3x0123456789ABCDEF = vi3xGHIJKLMNOPQRSTUV;
+      vi3xGHIJKLMNOPQRSTUV = vi3xWXYZabcdefghijkl;
+      const __m512 vi4xIJKLMNOPQRSTUVWX = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi4xWXYZabcdefghijkl), _mm512_castps_si512(vi4xGHIJKLMNOPQRSTUV), 2));
+      vi4x0123456789ABCDEF = vi4xGHIJKLMNOPQRSTUV;
+      vi4xGHIJKLMNOPQRSTUV = vi4xWXYZabcdefghijkl;
+      const __m512 vi5xIJKLMNOPQRSTUVWX = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi5xWXYZabcdefghijkl), _mm512_castps_si512(vi5xGHIJKLMNOPQRSTUV), 2));
+      vi5x0123456789ABCDEF = vi5xGHIJKLMNOPQRSTUV;
+      vi5xGHIJKLMNOPQRSTUV = vi5xWXYZabcdefghijkl;
+      const __m512 vi6xIJKLMNOPQRSTUVWX = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi6xWXYZabcdefghijkl), _mm512_castps_si512(vi6xGHIJKLMNOPQRSTUV), 2));
+      vi6x0123456789ABCDEF = vi6xGHIJKLMNOPQRSTUV;
+      vi6xGHIJKLMNOPQRSTUV = vi6xWXYZabcdefghijkl;
+      const __m512 vi7xIJKLMNOPQRSTUVWX = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi7xWXYZabcdefghijkl), _mm512_castps_si512(vi7xGHIJKLMNOPQRSTUV), 2));
+      vi7x0123456789ABCDEF = vi7xGHIJKLMNOPQRSTUV;
+      vi7xGHIJKLMNOPQRSTUV = vi7xWXYZabcdefghijkl;
+
+      vo0p0 = _mm512_fmadd_ps(vi0xIJKLMNOPQRSTUVWX, vk04, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi1xIJKLMNOPQRSTUVWX, vk04, vo1p0);
+      vo2p0 = _mm512_fmadd_ps(vi2xIJKLMNOPQRSTUVWX, vk04, vo2p0);
+      vo3p0 = _mm512_fmadd_ps(vi3xIJKLMNOPQRSTUVWX, vk04, vo3p0);
+      vo0p0 = _mm512_fmadd_ps(vi1xIJKLMNOPQRSTUVWX, vk14, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi2xIJKLMNOPQRSTUVWX, vk14, vo1p0);
+      vo2p0 = _mm512_fmadd_ps(vi3xIJKLMNOPQRSTUVWX, vk14, vo2p0);
+      vo3p0 = _mm512_fmadd_ps(vi4xIJKLMNOPQRSTUVWX, vk14, vo3p0);
+      vo0p0 = _mm512_fmadd_ps(vi2xIJKLMNOPQRSTUVWX, vk24, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi3xIJKLMNOPQRSTUVWX, vk24, vo1p0);
+      vo2p0 = _mm512_fmadd_ps(vi4xIJKLMNOPQRSTUVWX, vk24, vo2p0);
+      vo3p0 = _mm512_fmadd_ps(vi5xIJKLMNOPQRSTUVWX, vk24, vo3p0);
+      vo0p0 = _mm512_fmadd_ps(vi3xIJKLMNOPQRSTUVWX, vk34, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi4xIJKLMNOPQRSTUVWX, vk34, vo1p0);
+      vo2p0 = _mm512_fmadd_ps(vi5xIJKLMNOPQRSTUVWX, vk34, vo2p0);
+      vo3p0 = _mm512_fmadd_ps(vi6xIJKLMNOPQRSTUVWX, vk34, vo3p0);
+      vo0p0 = _mm512_fmadd_ps(vi4xIJKLMNOPQRSTUVWX, vk44, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi5xIJKLMNOPQRSTUVWX, vk44, vo1p0);
+      vo2p0 = _mm512_fmadd_ps(vi6xIJKLMNOPQRSTUVWX, vk44, vo2p0);
+      vo3p0 = _mm512_fmadd_ps(vi7xIJKLMNOPQRSTUVWX, vk44, vo3p0);
+
+
+      __m512 vo0 = _mm512_max_ps(vo0p0, vmin);
+      __m512 vo1 = _mm512_max_ps(vo1p0, vmin);
+      __m512 vo2 = _mm512_max_ps(vo2p0, vmin);
+      __m512 vo3 = _mm512_max_ps(vo3p0, vmin);
+
+      vo0 = _mm512_min_ps(vo0, vmax);
+      vo1 = _mm512_min_ps(vo1, vmax);
+      vo2 = _mm512_min_ps(vo2, vmax);
+      vo3 = _mm512_min_ps(vo3, vmax);
+
+      _mm512_storeu_ps(o3, vo3);
+      o3 += 16;
+      _mm512_storeu_ps(o2, vo2);
+      o2 += 16;
+      _mm512_storeu_ps(o1, vo1);
+      o1 += 16;
+      _mm512_storeu_ps(o0, vo0);
+      o0 += 16;
+    }
+    // Process the next-to-last block of 16 pixels; the last block is loaded with a mask.
+    if XNN_LIKELY(w > 16 * sizeof(float)) {
+      __m512 vo0p0 = _mm512_fmadd_ps(vi0xGHIJKLMNOPQRSTUV, vk02, vbias);
+      __m512 vo1p0 = _mm512_fmadd_ps(vi1xGHIJKLMNOPQRSTUV, vk02, vbias);
+      __m512 vo2p0 = _mm512_fmadd_ps(vi2xGHIJKLMNOPQRSTUV, vk02, vbias);
+      __m512 vo3p0 = _mm512_fmadd_ps(vi3xGHIJKLMNOPQRSTUV, vk02, vbias);
+      vo0p0 = _mm512_fmadd_ps(vi1xGHIJKLMNOPQRSTUV, vk12, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi2xGHIJKLMNOPQRSTUV, vk12, vo1p0);
+      vo2p0 = _mm512_fmadd_ps(vi3xGHIJKLMNOPQRSTUV, vk12, vo2p0);
+      vo3p0 = _mm512_fmadd_ps(vi4xGHIJKLMNOPQRSTUV, vk12, vo3p0);
+      vo0p0 = _mm512_fmadd_ps(vi2xGHIJKLMNOPQRSTUV, vk22, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi3xGHIJKLMNOPQRSTUV, vk22, vo1p0);
+      vo2p0 = _mm512_fmadd_ps(vi4xGHIJKLMNOPQRSTUV, vk22, vo2p0);
+      vo3p0 = _mm512_fmadd_ps(vi5xGHIJKLMNOPQRSTUV, vk22, vo3p0);
+      vo0p0 = _mm512_fmadd_ps(vi3xGHIJKLMNOPQRSTUV, vk32, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi4xGHIJKLMNOPQRSTUV, vk32, vo1p0);
+      vo2p0 = _mm512_fmadd_ps(vi5xGHIJKLMNOPQRSTUV, vk32, vo2p0);
+      vo3p0 = _mm512_fmadd_ps(vi6xGHIJKLMNOPQRSTUV, vk32, vo3p0);
+      vo0p0 = _mm512_fmadd_ps(vi4xGHIJKLMNOPQRSTUV, vk42, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi5xGHIJKLMNOPQRSTUV, vk42, vo1p0);
+      vo2p0 = _mm512_fmadd_ps(vi6xGHIJKLMNOPQRSTUV, vk42, vo2p0);
+      vo3p0 = _mm512_fmadd_ps(vi7xGHIJKLMNOPQRSTUV, vk42, vo3p0);
+
+      const __m512 vi0xWXYZabcdefghijkl = _mm512_maskz_loadu_ps(vmask, i0);
+      i0 += 16;
+      const __m512 vi1xWXYZabcdefghijkl = _mm512_maskz_loadu_ps(vmask, i1);
+      i1 += 16;
+      const __m512 vi2xWXYZabcdefghijkl = _mm512_maskz_loadu_ps(vmask, i2);
+      i2 += 16;
+      const __m512 vi3xWXYZabcdefghijkl = _mm512_maskz_loadu_ps(vmask, i3);
+      i3 += 16;
+      const __m512 vi4xWXYZabcdefghijkl = _mm512_maskz_loadu_ps(vmask, i4);
+      i4 += 16;
+      const __m512 vi5xWXYZabcdefghijkl = _mm512_maskz_loadu_ps(vmask, i5);
+      i5 += 16;
+      const __m512 vi6xWXYZabcdefghijkl = _mm512_maskz_loadu_ps(vmask, i6);
+      i6 += 16;
+      const __m512 vi7xWXYZabcdefghijkl = _mm512_maskz_loadu_ps(vmask, i7);
+      i7 += 16;
+
+      const __m512 vi0xFGHIJKLMNOPQRSTU = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi0xGHIJKLMNOPQRSTUV), _mm512_castps_si512(vi0x0123456789ABCDEF), 15));
+      const __m512 vi1xFGHIJKLMNOPQRSTU = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi1xGHIJKLMNOPQRSTUV), _mm512_castps_si512(vi1x0123456789ABCDEF), 15));
+      const __m512 vi2xFGHIJKLMNOPQRSTU = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi2xGHIJKLMNOPQRSTUV), _mm512_castps_si512(vi2x0123456789ABCDEF), 15));
+      const __m512 vi3xFGHIJKLMNOPQRSTU = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi3xGHIJKLMNOPQRSTUV), _mm512_castps_si512(vi3x0123456789ABCDEF), 15));
+      const __m512 vi4xFGHIJKLMNOPQRSTU = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi4xGHIJKLMNOPQRSTUV), _mm512_castps_si512(vi4x0123456789ABCDEF), 15));
+      const __m512 vi5xFGHIJKLMNOPQRSTU = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi5xGHIJKLMNOPQRSTUV), _mm512_castps_si512(vi5x0123456789ABCDEF), 15));
+      const __m512 vi6xFGHIJKLMNOPQRSTU = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi6xGHIJKLMNOPQRSTUV), _mm512_castps_si512(vi6x0123456789ABCDEF), 15));
+      const __m512 vi7xFGHIJKLMNOPQRSTU = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi7xGHIJKLMNOPQRSTUV), _mm512_castps_si512(vi7x0123456789ABCDEF), 15));
+
+      vo0p0 = _mm512_fmadd_ps(vi0xFGHIJKLMNOPQRSTU, vk01, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi1xFGHIJKLMNOPQRSTU, vk01, vo1p0);
+      vo2p0 = _mm512_fmadd_ps(vi2xFGHIJKLMNOPQRSTU, vk01, vo2p0);
+      vo3p0 = _mm512_fmadd_ps(vi3xFGHIJKLMNOPQRSTU, vk01, vo3p0);
+      vo0p0 = _mm512_fmadd_ps(vi1xFGHIJKLMNOPQRSTU, vk11, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi2xFGHIJKLMNOPQRSTU, vk11, vo1p0);
+      vo2p0 = _mm512_fmadd_ps(vi3xFGHIJKLMNOPQRSTU, vk11, vo2p0);
+      vo3p0 = _mm512_fmadd_ps(vi4xFGHIJKLMNOPQRSTU, vk11, vo3p0);
+      vo0p0 = _mm512_fmadd_ps(vi2xFGHIJKLMNOPQRSTU, vk21, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi3xFGHIJKLMNOPQRSTU, vk21, vo1p0);
+      vo2p0 = _mm512_fmadd_ps(vi4xFGHIJKLMNOPQRSTU, vk21, vo2p0);
+      vo3p0 = _mm512_fmadd_ps(vi5xFGHIJKLMNOPQRSTU, vk21, vo3p0);
+      vo0p0 = _mm512_fmadd_ps(vi3xFGHIJKLMNOPQRSTU, vk31, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi4xFGHIJKLMNOPQRSTU, vk31, vo1p0);
+      vo2p0 = _mm512_fmadd_ps(vi5xFGHIJKLMNOPQRSTU, vk31, vo2p0);
+      vo3p0 = _mm512_fmadd_ps(vi6xFGHIJKLMNOPQRSTU, vk31, vo3p0);
+      vo0p0 = _mm512_fmadd_ps(vi4xFGHIJKLMNOPQRSTU, vk41, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi5xFGHIJKLMNOPQRSTU, vk41, vo1p0);
+      vo2p0 = _mm512_fmadd_ps(vi6xFGHIJKLMNOPQRSTU, vk41, vo2p0);
+      vo3p0 = _mm512_fmadd_ps(vi7xFGHIJKLMNOPQRSTU, vk41, vo3p0);
+
+      const __m512 vi0xEFGHIJKLMNOPQRST = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi0xGHIJKLMNOPQRSTUV), _mm512_castps_si512(vi0x0123456789ABCDEF), 14));
+      const __m512 vi1xEFGHIJKLMNOPQRST = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi1xGHIJKLMNOPQRSTUV), _mm512_castps_si512(vi1x0123456789ABCDEF), 14));
+      const __m512 vi2xEFGHIJKLMNOPQRST = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi2xGHIJKLMNOPQRSTUV), _mm512_castps_si512(vi2x0123456789ABCDEF), 14));
+      const __m512 vi3xEFGHIJKLMNOPQRST = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi3xGHIJKLMNOPQRSTUV), _mm512_castps_si512(vi3x0123456789ABCDEF), 14));
+      const __m512 vi4xEFGHIJKLMNOPQRST = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi4xGHIJKLMNOPQRSTUV), _mm512_castps_si512(vi4x0123456789ABCDEF), 14));
+      const __m512 vi5xEFGHIJKLMNOPQRST = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi5xGHIJKLMNOPQRSTUV), _mm512_castps_si512(vi5x0123456789ABCDEF), 14));
+      const __m512 vi6xEFGHIJKLMNOPQRST = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi6xGHIJKLMNOPQRSTUV), _mm512_castps_si512(vi6x0123456789ABCDEF), 14));
+      const __m512 vi7xEFGHIJKLMNOPQRST = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi7xGHIJKLMNOPQRSTUV), _mm512_castps_si512(vi7x0123456789ABCDEF), 14));
+
+      vo0p0 = _mm512_fmadd_ps(vi0xEFGHIJKLMNOPQRST, vk00, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi1xEFGHIJKLMNOPQRST, vk00, vo1p0);
+      vo2p0 = _mm512_fmadd_ps(vi2xEFGHIJKLMNOPQRST, vk00, vo2p0);
+      vo3p0 = _mm512_fmadd_ps(vi3xEFGHIJKLMNOPQRST, vk00, vo3p0);
+      vo0p0 = _mm512_fmadd_ps(vi1xEFGHIJKLMNOPQRST, vk10, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi2xEFGHIJKLMNOPQRST, vk10, vo1p0);
+      vo2p0 = _mm512_fmadd_ps(vi3xEFGHIJKLMNOPQRST, vk10, vo2p0);
+      vo3p0 = _mm512_fmadd_ps(vi4xEFGHIJKLMNOPQRST, vk10, vo3p0);
+      vo0p0 = _mm512_fmadd_ps(vi2xEFGHIJKLMNOPQRST, vk20, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi3xEFGHIJKLMNOPQRST, vk20, vo1p0);
+      vo2p0 = _mm512_fmadd_ps(vi4xEFGHIJKLMNOPQRST, vk20, vo2p0);
+      vo3p0 = _mm512_fmadd_ps(vi5xEFGHIJKLMNOPQRST, vk20, vo3p0);
+      vo0p0 = _mm512_fmadd_ps(vi3xEFGHIJKLMNOPQRST, vk30, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi4xEFGHIJKLMNOPQRST, vk30, vo1p0);
+      vo2p0 = _mm512_fmadd_ps(vi5xEFGHIJKLMNOPQRST, vk30, vo2p0);
+      vo3p0 = _mm512_fmadd_ps(vi6xEFGHIJKLMNOPQRST, vk30, vo3p0);
+      vo0p0 = _mm512_fmadd_ps(vi4xEFGHIJKLMNOPQRST, vk40, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi5xEFGHIJKLMNOPQRST, vk40, vo1p0);
+      vo2p0 = _mm512_fmadd_ps(vi6xEFGHIJKLMNOPQRST, vk40, vo2p0);
+      vo3p0 = _mm512_fmadd_ps(vi7xEFGHIJKLMNOPQRST, vk40, vo3p0);
+
+      const __m512 vi0xHIJKLMNOPQRSTUVW = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi0xWXYZabcdefghijkl), _mm512_castps_si512(vi0xGHIJKLMNOPQRSTUV), 1));
+      const __m512 vi1xHIJKLMNOPQRSTUVW = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi1xWXYZabcdefghijkl), _mm512_castps_si512(vi1xGHIJKLMNOPQRSTUV), 1));
+      const __m512 vi2xHIJKLMNOPQRSTUVW = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi2xWXYZabcdefghijkl), _mm512_castps_si512(vi2xGHIJKLMNOPQRSTUV), 1));
+      const __m512 vi3xHIJKLMNOPQRSTUVW = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi3xWXYZabcdefghijkl), _mm512_castps_si512(vi3xGHIJKLMNOPQRSTUV), 1));
+      const __m512 vi4xHIJKLMNOPQRSTUVW = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi4xWXYZabcdefghijkl), _mm512_castps_si512(vi4xGHIJKLMNOPQRSTUV), 1));
+      const __m512 vi5xHIJKLMNOPQRSTUVW = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi5xWXYZabcdefghijkl), _mm512_castps_si512(vi5xGHIJKLMNOPQRSTUV), 1));
+      const __m512 vi6xHIJKLMNOPQRSTUVW = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi6xWXYZabcdefghijkl), _mm512_castps_si512(vi6xGHIJKLMNOPQRSTUV), 1));
+      const __m512 vi7xHIJKLMNOPQRSTUVW = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi7xWXYZabcdefghijkl), _mm512_castps_si512(vi7xGHIJKLMNOPQRSTUV), 1));
+
+      vo0p0 = _mm512_fmadd_ps(vi0xHIJKLMNOPQRSTUVW, vk03, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi1xHIJKLMNOPQRSTUVW, vk03, vo1p0);
+      vo2p0 = _mm512_fmadd_ps(vi2xHIJKLMNOPQRSTUVW, vk03, vo2p0);
+      vo3p0 = _mm512_fmadd_ps(vi3xHIJKLMNOPQRSTUVW, vk03, vo3p0);
+      vo0p0 = _mm512_fmadd_ps(vi1xHIJKLMNOPQRSTUVW, vk13, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi2xHIJKLMNOPQRSTUVW, vk13, vo1p0);
+      vo2p0 = _mm512_fmadd_ps(vi3xHIJKLMNOPQRSTUVW, vk13, vo2p0);
+      vo3p0 = _mm512_fmadd_ps(vi4xHIJKLMNOPQRSTUVW, vk13, vo3p0);
+      vo0p0 = _mm512_fmadd_ps(vi2xHIJKLMNOPQRSTUVW, vk23, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi3xHIJKLMNOPQRSTUVW, vk23, vo1p0);
+      vo2p0 = _mm512_fmadd_ps(vi4xHIJKLMNOPQRSTUVW, vk23, vo2p0);
+      vo3p0 = _mm512_fmadd_ps(vi5xHIJKLMNOPQRSTUVW, vk23, vo3p0);
+      vo0p0 = _mm512_fmadd_ps(vi3xHIJKLMNOPQRSTUVW, vk33, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi4xHIJKLMNOPQRSTUVW, vk33, vo1p0);
+      vo2p0 = _mm512_fmadd_ps(vi5xHIJKLMNOPQRSTUVW, vk33, vo2p0);
+      vo3p0 = _mm512_fmadd_ps(vi6xHIJKLMNOPQRSTUVW, vk33, vo3p0);
+      vo0p0 = _mm512_fmadd_ps(vi4xHIJKLMNOPQRSTUVW, vk43, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi5xHIJKLMNOPQRSTUVW, vk43, vo1p0);
+      vo2p0 = _mm512_fmadd_ps(vi6xHIJKLMNOPQRSTUVW, vk43, vo2p0);
+      vo3p0 = _mm512_fmadd_ps(vi7xHIJKLMNOPQRSTUVW, vk43, vo3p0);
+
+      const __m512 vi0xIJKLMNOPQRSTUVWX = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi0xWXYZabcdefghijkl), _mm512_castps_si512(vi0xGHIJKLMNOPQRSTUV), 2));
+      vi0x0123456789ABCDEF = vi0xGHIJKLMNOPQRSTUV;
+      vi0xGHIJKLMNOPQRSTUV = vi0xWXYZabcdefghijkl;
+      const __m512 vi1xIJKLMNOPQRSTUVWX = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi1xWXYZabcdefghijkl), _mm512_castps_si512(vi1xGHIJKLMNOPQRSTUV), 2));
+      vi1x0123456789ABCDEF = vi1xGHIJKLMNOPQRSTUV;
+      vi1xGHIJKLMNOPQRSTUV = vi1xWXYZabcdefghijkl;
+      const __m512 vi2xIJKLMNOPQRSTUVWX = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi2xWXYZabcdefghijkl), _mm512_castps_si512(vi2xGHIJKLMNOPQRSTUV), 2));
+      vi2x0123456789ABCDEF = vi2xGHIJKLMNOPQRSTUV;
+      vi2xGHIJKLMNOPQRSTUV = vi2xWXYZabcdefghijkl;
+      const __m512 vi3xIJKLMNOPQRSTUVWX = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi3xWXYZabcdefghijkl), _mm512_castps_si512(vi3xGHIJKLMNOPQRSTUV), 2));
+      vi3x0123456789ABCDEF = vi3xGHIJKLMNOPQRSTUV;
+      vi3xGHIJKLMNOPQRSTUV = vi3xWXYZabcdefghijkl;
+      const __m512 vi4xIJKLMNOPQRSTUVWX = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi4xWXYZabcdefghijkl), _mm512_castps_si512(vi4xGHIJKLMNOPQRSTUV), 2));
+      vi4x0123456789ABCDEF = vi4xGHIJKLMNOPQRSTUV;
+      vi4xGHIJKLMNOPQRSTUV = vi4xWXYZabcdefghijkl;
+      const __m512 vi5xIJKLMNOPQRSTUVWX = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi5xWXYZabcdefghijkl), _mm512_castps_si512(vi5xGHIJKLMNOPQRSTUV), 2));
+      vi5x0123456789ABCDEF = vi5xGHIJKLMNOPQRSTUV;
+      vi5xGHIJKLMNOPQRSTUV = vi5xWXYZabcdefghijkl;
+      const __m512 vi6xIJKLMNOPQRSTUVWX = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi6xWXYZabcdefghijkl), _mm512_castps_si512(vi6xGHIJKLMNOPQRSTUV), 2));
+      vi6x0123456789ABCDEF = vi6xGHIJKLMNOPQRSTUV;
+      vi6xGHIJKLMNOPQRSTUV = vi6xWXYZabcdefghijkl;
+      const __m512 vi7xIJKLMNOPQRSTUVWX = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi7xWXYZabcdefghijkl), _mm512_castps_si512(vi7xGHIJKLMNOPQRSTUV), 2));
+      vi7x0123456789ABCDEF = vi7xGHIJKLMNOPQRSTUV;
+      vi7xGHIJKLMNOPQRSTUV = vi7xWXYZabcdefghijkl;
+
+      vo0p0 = _mm512_fmadd_ps(vi0xIJKLMNOPQRSTUVWX, vk04, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi1xIJKLMNOPQRSTUVWX, vk04, vo1p0);
+      vo2p0 = _mm512_fmadd_ps(vi2xIJKLMNOPQRSTUVWX, vk04, vo2p0);
+      vo3p0 = _mm512_fmadd_ps(vi3xIJKLMNOPQRSTUVWX, vk04, vo3p0);
+      vo0p0 = _mm512_fmadd_ps(vi1xIJKLMNOPQRSTUVWX, vk14, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi2xIJKLMNOPQRSTUVWX, vk14, vo1p0);
+      vo2p0 = _mm512_fmadd_ps(vi3xIJKLMNOPQRSTUVWX, vk14, vo2p0);
+      vo3p0 = _mm512_fmadd_ps(vi4xIJKLMNOPQRSTUVWX, vk14, vo3p0);
+      vo0p0 = _mm512_fmadd_ps(vi2xIJKLMNOPQRSTUVWX, vk24, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi3xIJKLMNOPQRSTUVWX, vk24, vo1p0);
+      vo2p0 = _mm512_fmadd_ps(vi4xIJKLMNOPQRSTUVWX, vk24, vo2p0);
+      vo3p0 = _mm512_fmadd_ps(vi5xIJKLMNOPQRSTUVWX, vk24, vo3p0);
+      vo0p0 = _mm512_fmadd_ps(vi3xIJKLMNOPQRSTUVWX, vk34, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi4xIJKLMNOPQRSTUVWX, vk34, vo1p0);
+      vo2p0 = _mm512_fmadd_ps(vi5xIJKLMNOPQRSTUVWX, vk34, vo2p0);
+      vo3p0 = _mm512_fmadd_ps(vi6xIJKLMNOPQRSTUVWX, vk34, vo3p0);
+      vo0p0 = _mm512_fmadd_ps(vi4xIJKLMNOPQRSTUVWX, vk44, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi5xIJKLMNOPQRSTUVWX, vk44, vo1p0);
+      vo2p0 = _mm512_fmadd_ps(vi6xIJKLMNOPQRSTUVWX, vk44, vo2p0);
+      vo3p0 = _mm512_fmadd_ps(vi7xIJKLMNOPQRSTUVWX, vk44, vo3p0);
+
+
+      __m512 vo0 = _mm512_max_ps(vo0p0, vmin);
+      __m512 vo1 = _mm512_max_ps(vo1p0, vmin);
+      __m512 vo2 = _mm512_max_ps(vo2p0, vmin);
+      __m512 vo3 = _mm512_max_ps(vo3p0, vmin);
+
+      vo0 = _mm512_min_ps(vo0, vmax);
+      vo1 = _mm512_min_ps(vo1, vmax);
+      vo2 = _mm512_min_ps(vo2, vmax);
+      vo3 = _mm512_min_ps(vo3, vmax);
+
+      _mm512_storeu_ps(o3, vo3);
+      o3 += 16;
+      _mm512_storeu_ps(o2, vo2);
+      o2 += 16;
+      _mm512_storeu_ps(o1, vo1);
+      o1 += 16;
+      _mm512_storeu_ps(o0, vo0);
+      o0 += 16;
+      w -= 16 * sizeof(float);
+    }
+    // Always process the last block of 1..16 pixels.
+    assert(w >= 1 * sizeof(float));
+    assert(w <= 16 * sizeof(float));
+    {
+      __m512 vo0p0 = _mm512_fmadd_ps(vi0xGHIJKLMNOPQRSTUV, vk02, vbias);
+      __m512 vo1p0 = _mm512_fmadd_ps(vi1xGHIJKLMNOPQRSTUV, vk02, vbias);
+      __m512 vo2p0 = _mm512_fmadd_ps(vi2xGHIJKLMNOPQRSTUV, vk02, vbias);
+      __m512 vo3p0 = _mm512_fmadd_ps(vi3xGHIJKLMNOPQRSTUV, vk02, vbias);
+      vo0p0 = _mm512_fmadd_ps(vi1xGHIJKLMNOPQRSTUV, vk12, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi2xGHIJKLMNOPQRSTUV, vk12, vo1p0);
+      vo2p0 = _mm512_fmadd_ps(vi3xGHIJKLMNOPQRSTUV, vk12, vo2p0);
+      vo3p0 = _mm512_fmadd_ps(vi4xGHIJKLMNOPQRSTUV, vk12, vo3p0);
+      vo0p0 = _mm512_fmadd_ps(vi2xGHIJKLMNOPQRSTUV, vk22, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi3xGHIJKLMNOPQRSTUV, vk22, vo1p0);
+      vo2p0 = _mm512_fmadd_ps(vi4xGHIJKLMNOPQRSTUV, vk22, vo2p0);
+      vo3p0 = _mm512_fmadd_ps(vi5xGHIJKLMNOPQRSTUV, vk22, vo3p0);
+      vo0p0 = _mm512_fmadd_ps(vi3xGHIJKLMNOPQRSTUV, vk32, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi4xGHIJKLMNOPQRSTUV, vk32, vo1p0);
+      vo2p0 = _mm512_fmadd_ps(vi5xGHIJKLMNOPQRSTUV, vk32, vo2p0);
+      vo3p0 = _mm512_fmadd_ps(vi6xGHIJKLMNOPQRSTUV, vk32, vo3p0);
+      vo0p0 = _mm512_fmadd_ps(vi4xGHIJKLMNOPQRSTUV, vk42, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi5xGHIJKLMNOPQRSTUV, vk42, vo1p0);
+      vo2p0 = _mm512_fmadd_ps(vi6xGHIJKLMNOPQRSTUV, vk42, vo2p0);
+      vo3p0 = _mm512_fmadd_ps(vi7xGHIJKLMNOPQRSTUV, vk42, vo3p0);
+
+      const __m512 vi0xFGHIJKLMNOPQRSTU = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi0xGHIJKLMNOPQRSTUV), _mm512_castps_si512(vi0x0123456789ABCDEF), 15));
+      const __m512 vi1xFGHIJKLMNOPQRSTU = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi1xGHIJKLMNOPQRSTUV), _mm512_castps_si512(vi1x0123456789ABCDEF), 15));
+      const __m512 vi2xFGHIJKLMNOPQRSTU = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi2xGHIJKLMNOPQRSTUV), _mm512_castps_si512(vi2x0123456789ABCDEF), 15));
+      const __m512 vi3xFGHIJKLMNOPQRSTU = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi3xGHIJKLMNOPQRSTUV), _mm512_castps_si512(vi3x0123456789ABCDEF), 15));
+      const __m512 vi4xFGHIJKLMNOPQRSTU = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi4xGHIJKLMNOPQRSTUV), _mm512_castps_si512(vi4x0123456789ABCDEF), 15));
+      const __m512 vi5xFGHIJKLMNOPQRSTU = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi5xGHIJKLMNOPQRSTUV), _mm512_castps_si512(vi5x0123456789ABCDEF), 15));
+      const __m512 vi6xFGHIJKLMNOPQRSTU = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi6xGHIJKLMNOPQRSTUV), _mm512_castps_si512(vi6x0123456789ABCDEF), 15));
+      const __m512 vi7xFGHIJKLMNOPQRSTU = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi7xGHIJKLMNOPQRSTUV), _mm512_castps_si512(vi7x0123456789ABCDEF), 15));
+
+      vo0p0 = _mm512_fmadd_ps(vi0xFGHIJKLMNOPQRSTU, vk01, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi1xFGHIJKLMNOPQRSTU, vk01, vo1p0);
+      vo2p0 = _mm512_fmadd_ps(vi2xFGHIJKLMNOPQRSTU, vk01, vo2p0);
+      vo3p0 = _mm512_fmadd_ps(vi3xFGHIJKLMNOPQRSTU, vk01, vo3p0);
+      vo0p0 = _mm512_fmadd_ps(vi1xFGHIJKLMNOPQRSTU, vk11, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi2xFGHIJKLMNOPQRSTU, vk11, vo1p0);
+      vo2p0 = _mm512_fmadd_ps(vi3xFGHIJKLMNOPQRSTU, vk11, vo2p0);
+      vo3p0 = _mm512_fmadd_ps(vi4xFGHIJKLMNOPQRSTU, vk11, vo3p0);
+      vo0p0 = _mm512_fmadd_ps(vi2xFGHIJKLMNOPQRSTU, vk21, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi3xFGHIJKLMNOPQRSTU, vk21, vo1p0);
+      vo2p0 = _mm512_fmadd_ps(vi4xFGHIJKLMNOPQRSTU, vk21, vo2p0);
+      vo3p0 = _mm512_fmadd_ps(vi5xFGHIJKLMNOPQRSTU, vk21, vo3p0);
+      vo0p0 = _mm512_fmadd_ps(vi3xFGHIJKLMNOPQRSTU, vk31, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi4xFGHIJKLMNOPQRSTU, vk31, vo1p0);
+      vo2p0 = _mm512_fmadd_ps(vi5xFGHIJKLMNOPQRSTU, vk31, vo2p0);
+      vo3p0 = _mm512_fmadd_ps(vi6xFGHIJKLMNOPQRSTU, vk31, vo3p0);
+      vo0p0 = _mm512_fmadd_ps(vi4xFGHIJKLMNOPQRSTU, vk41, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi5xFGHIJKLMNOPQRSTU, vk41, vo1p0);
+      vo2p0 = _mm512_fmadd_ps(vi6xFGHIJKLMNOPQRSTU, vk41, vo2p0);
+      vo3p0 = _mm512_fmadd_ps(vi7xFGHIJKLMNOPQRSTU, vk41, vo3p0);
+
+      const __m512 vi0xEFGHIJKLMNOPQRST = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi0xGHIJKLMNOPQRSTUV), _mm512_castps_si512(vi0x0123456789ABCDEF), 14));
+      const __m512 vi1xEFGHIJKLMNOPQRST = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi1xGHIJKLMNOPQRSTUV), _mm512_castps_si512(vi1x0123456789ABCDEF), 14));
+      const __m512 vi2xEFGHIJKLMNOPQRST = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi2xGHIJKLMNOPQRSTUV), _mm512_castps_si512(vi2x0123456789ABCDEF), 14));
+      const __m512 vi3xEFGHIJKLMNOPQRST = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi3xGHIJKLMNOPQRSTUV), _mm512_castps_si512(vi3x0123456789ABCDEF), 14));
+      const __m512 vi4xEFGHIJKLMNOPQRST = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi4xGHIJKLMNOPQRSTUV), _mm512_castps_si512(vi4x0123456789ABCDEF), 14));
+      const __m512 vi5xEFGHIJKLMNOPQRST = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi5xGHIJKLMNOPQRSTUV), _mm512_castps_si512(vi5x0123456789ABCDEF), 14));
+      const __m512 vi6xEFGHIJKLMNOPQRST = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi6xGHIJKLMNOPQRSTUV), _mm512_castps_si512(vi6x0123456789ABCDEF), 14));
+      const __m512 vi7xEFGHIJKLMNOPQRST = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi7xGHIJKLMNOPQRSTUV), _mm512_castps_si512(vi7x0123456789ABCDEF), 14));
+
+      vo0p0 = _mm512_fmadd_ps(vi0xEFGHIJKLMNOPQRST, vk00, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi1xEFGHIJKLMNOPQRST, vk00, vo1p0);
+      vo2p0 = _mm512_fmadd_ps(vi2xEFGHIJKLMNOPQRST, vk00, vo2p0);
+      vo3p0 = _mm512_fmadd_ps(vi3xEFGHIJKLMNOPQRST, vk00, vo3p0);
+      vo0p0 = _mm512_fmadd_ps(vi1xEFGHIJKLMNOPQRST, vk10, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi2xEFGHIJKLMNOPQRST, vk10, vo1p0);
+      vo2p0 = _mm512_fmadd_ps(vi3xEFGHIJKLMNOPQRST, vk10, vo2p0);
+      vo3p0 = _mm512_fmadd_ps(vi4xEFGHIJKLMNOPQRST, vk10, vo3p0);
+      vo0p0 = _mm512_fmadd_ps(vi2xEFGHIJKLMNOPQRST, vk20, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi3xEFGHIJKLMNOPQRST, vk20, vo1p0);
+      vo2p0 = _mm512_fmadd_ps(vi4xEFGHIJKLMNOPQRST, vk20, vo2p0);
+      vo3p0 = _mm512_fmadd_ps(vi5xEFGHIJKLMNOPQRST, vk20, vo3p0);
+      vo0p0 = _mm512_fmadd_ps(vi3xEFGHIJKLMNOPQRST, vk30, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi4xEFGHIJKLMNOPQRST, vk30, vo1p0);
+      vo2p0 = _mm512_fmadd_ps(vi5xEFGHIJKLMNOPQRST, vk30, vo2p0);
+      vo3p0 = _mm512_fmadd_ps(vi6xEFGHIJKLMNOPQRST, vk30, vo3p0);
+      vo0p0 = _mm512_fmadd_ps(vi4xEFGHIJKLMNOPQRST, vk40, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi5xEFGHIJKLMNOPQRST, vk40, vo1p0);
+      vo2p0 = _mm512_fmadd_ps(vi6xEFGHIJKLMNOPQRST, vk40, vo2p0);
+      vo3p0 = _mm512_fmadd_ps(vi7xEFGHIJKLMNOPQRST, vk40, vo3p0);
+
+      const __m512 vi0xHIJKLMNOPQRSTUVW = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_setzero_si512(), _mm512_castps_si512(vi0xGHIJKLMNOPQRSTUV), 1));
+      const __m512 vi1xHIJKLMNOPQRSTUVW = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_setzero_si512(), _mm512_castps_si512(vi1xGHIJKLMNOPQRSTUV), 1));
+      const __m512 vi2xHIJKLMNOPQRSTUVW = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_setzero_si512(), _mm512_castps_si512(vi2xGHIJKLMNOPQRSTUV), 1));
+      const __m512 vi3xHIJKLMNOPQRSTUVW = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_setzero_si512(), _mm512_castps_si512(vi3xGHIJKLMNOPQRSTUV), 1));
+      const __m512 vi4xHIJKLMNOPQRSTUVW = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_setzero_si512(), _mm512_castps_si512(vi4xGHIJKLMNOPQRSTUV), 1));
+      const __m512 vi5xHIJKLMNOPQRSTUVW = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_setzero_si512(), _mm512_castps_si512(vi5xGHIJKLMNOPQRSTUV), 1));
+      const __m512 vi6xHIJKLMNOPQRSTUVW = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_setzero_si512(), _mm512_castps_si512(vi6xGHIJKLMNOPQRSTUV), 1));
+      const __m512 vi7xHIJKLMNOPQRSTUVW = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_setzero_si512(), _mm512_castps_si512(vi7xGHIJKLMNOPQRSTUV), 1));
+
+      vo0p0 = _mm512_fmadd_ps(vi0xHIJKLMNOPQRSTUVW, vk03, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi1xHIJKLMNOPQRSTUVW, vk03, vo1p0);
+      vo2p0 = _mm512_fmadd_ps(vi2xHIJKLMNOPQRSTUVW, vk03, vo2p0);
+      vo3p0 = _mm512_fmadd_ps(vi3xHIJKLMNOPQRSTUVW, vk03, vo3p0);
+      vo0p0 = _mm512_fmadd_ps(vi1xHIJKLMNOPQRSTUVW, vk13, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi2xHIJKLMNOPQRSTUVW, vk13, vo1p0);
+      vo2p0 = _mm512_fmadd_ps(vi3xHIJKLMNOPQRSTUVW, vk13, vo2p0);
+      vo3p0 = _mm512_fmadd_ps(vi4xHIJKLMNOPQRSTUVW, vk13, vo3p0);
+      vo0p0 = _mm512_fmadd_ps(vi2xHIJKLMNOPQRSTUVW, vk23, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi3xHIJKLMNOPQRSTUVW, vk23, vo1p0);
+      vo2p0 = _mm512_fmadd_ps(vi4xHIJKLMNOPQRSTUVW, vk23, vo2p0);
+      vo3p0 = _mm512_fmadd_ps(vi5xHIJKLMNOPQRSTUVW, vk23, vo3p0);
+      vo0p0 = _mm512_fmadd_ps(vi3xHIJKLMNOPQRSTUVW, vk33, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi4xHIJKLMNOPQRSTUVW, vk33, vo1p0);
+      vo2p0 = _mm512_fmadd_ps(vi5xHIJKLMNOPQRSTUVW, vk33, vo2p0);
+      vo3p0 = _mm512_fmadd_ps(vi6xHIJKLMNOPQRSTUVW, vk33, vo3p0);
+      vo0p0 = _mm512_fmadd_ps(vi4xHIJKLMNOPQRSTUVW, vk43, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi5xHIJKLMNOPQRSTUVW, vk43, vo1p0);
+      vo2p0 = _mm512_fmadd_ps(vi6xHIJKLMNOPQRSTUVW, vk43, vo2p0);
+      vo3p0 = _mm512_fmadd_ps(vi7xHIJKLMNOPQRSTUVW, vk43, vo3p0);
+
+      const __m512 vi0xIJKLMNOPQRSTUVWX = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_setzero_si512(), _mm512_castps_si512(vi0xGHIJKLMNOPQRSTUV), 2));
+      const __m512 vi1xIJKLMNOPQRSTUVWX = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_setzero_si512(), _mm512_castps_si512(vi1xGHIJKLMNOPQRSTUV), 2));
+      const __m512 vi2xIJKLMNOPQRSTUVWX = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_setzero_si512(), _mm512_castps_si512(vi2xGHIJKLMNOPQRSTUV), 2));
+      const __m512 vi3xIJKLMNOPQRSTUVWX = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_setzero_si512(), _mm512_castps_si512(vi3xGHIJKLMNOPQRSTUV), 2));
+      const __m512 vi4xIJKLMNOPQRSTUVWX = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_setzero_si512(), _mm512_castps_si512(vi4xGHIJKLMNOPQRSTUV), 2));
+      const __m512 vi5xIJKLMNOPQRSTUVWX = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_setzero_si512(), _mm512_castps_si512(vi5xGHIJKLMNOPQRSTUV), 2));
+      const __m512 vi6xIJKLMNOPQRSTUVWX = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_setzero_si512(), _mm512_castps_si512(vi6xGHIJKLMNOPQRSTUV), 2));
+      const __m512 vi7xIJKLMNOPQRSTUVWX = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_setzero_si512(), _mm512_castps_si512(vi7xGHIJKLMNOPQRSTUV), 2));
+
+      vo0p0 = _mm512_fmadd_ps(vi0xIJKLMNOPQRSTUVWX, vk04, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi1xIJKLMNOPQRSTUVWX, vk04, vo1p0);
+      vo2p0 = _mm512_fmadd_ps(vi2xIJKLMNOPQRSTUVWX, vk04, vo2p0);
+      vo3p0 = _mm512_fmadd_ps(vi3xIJKLMNOPQRSTUVWX, vk04, vo3p0);
+      vo0p0 = _mm512_fmadd_ps(vi1xIJKLMNOPQRSTUVWX, vk14, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi2xIJKLMNOPQRSTUVWX, vk14, vo1p0);
+      vo2p0 = _mm512_fmadd_ps(vi3xIJKLMNOPQRSTUVWX, vk14, vo2p0);
+      vo3p0 = _mm512_fmadd_ps(vi4xIJKLMNOPQRSTUVWX, vk14, vo3p0);
+      vo0p0 = _mm512_fmadd_ps(vi2xIJKLMNOPQRSTUVWX, vk24, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi3xIJKLMNOPQRSTUVWX, vk24, vo1p0);
+      vo2p0 = _mm512_fmadd_ps(vi4xIJKLMNOPQRSTUVWX, vk24, vo2p0);
+      vo3p0 = _mm512_fmadd_ps(vi5xIJKLMNOPQRSTUVWX, vk24, vo3p0);
+      vo0p0 = _mm512_fmadd_ps(vi3xIJKLMNOPQRSTUVWX, vk34, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi4xIJKLMNOPQRSTUVWX, vk34, vo1p0);
+      vo2p0 = _mm512_fmadd_ps(vi5xIJKLMNOPQRSTUVWX, vk34, vo2p0);
+      vo3p0 = _mm512_fmadd_ps(vi6xIJKLMNOPQRSTUVWX, vk34, vo3p0);
+      vo0p0 = _mm512_fmadd_ps(vi4xIJKLMNOPQRSTUVWX, vk44, vo0p0);
+      vo1p0 = _mm512_fmadd_ps(vi5xIJKLMNOPQRSTUVWX, vk44, vo1p0);
+      vo2p0 = _mm512_fmadd_ps(vi6xIJKLMNOPQRSTUVWX, vk44, vo2p0);
+      vo3p0 = _mm512_fmadd_ps(vi7xIJKLMNOPQRSTUVWX, vk44, vo3p0);
+
+
+      __m512 vo0 = _mm512_max_ps(vo0p0, vmin);
+      __m512 vo1 = _mm512_max_ps(vo1p0, vmin);
+      __m512 vo2 = _mm512_max_ps(vo2p0, vmin);
+      __m512 vo3 = _mm512_max_ps(vo3p0, vmin);
+
+      vo0 = _mm512_min_ps(vo0, vmax);
+      vo1 = _mm512_min_ps(vo1, vmax);
+      vo2 = _mm512_min_ps(vo2, vmax);
+      vo3 = _mm512_min_ps(vo3, vmax);
+
+      _mm512_mask_storeu_ps(o3, vmask, vo3);
+      o3 += w / sizeof(float);
+      _mm512_mask_storeu_ps(o2, vmask, vo2);
+      o2 += w / sizeof(float);
+      _mm512_mask_storeu_ps(o1, vmask, vo1);
+      o1 += w / sizeof(float);
+      _mm512_mask_storeu_ps(o0, vmask, vo0);
+      o0 += w / sizeof(float);
+    }
+
+    i0 = (const float*) ((uintptr_t) i4 - input_decrement);
+    i1 = (const float*) ((uintptr_t) i5 - input_decrement);
+    i2 = (const float*) ((uintptr_t) i1 + input_width);
+    i3 = (const float*) ((uintptr_t) i2 + input_width);
+    i4 = (const float*) ((uintptr_t) i3 + input_width);
+    i5 = (const float*) ((uintptr_t) i4 + input_width);
+    i6 = (const float*) ((uintptr_t) i5 + input_width);
+    i7 = (const float*) ((uintptr_t) i6 + input_width);
+
+    o0 = o3;
+    o1 = (float*) ((uintptr_t) o0 + input_width);
+    o2 = (float*) ((uintptr_t) o1 + input_width);
+    o3 = (float*) ((uintptr_t) o2 + input_width);
+
+    output_height = doz(output_height, 4);
+  } while (output_height != 0);
+}
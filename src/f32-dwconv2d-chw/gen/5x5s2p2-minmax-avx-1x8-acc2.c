@@ -0,0 +1,554 @@
+// Auto-generated file. Do not edit!
+//   Template: src/f32-dwconv2d-chw/5x5s2p2-avx.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <immintrin.h>
+
+#include <xnnpack/dwconv.h>
+#include <xnnpack/math.h>
+
+
+void xnn_f32_dwconv2d_chw_ukernel_5x5s2p2__avx_1x8_acc2(
+    size_t input_height,
+    size_t input_width,
+    const float* input,
+    const float* weights,
+    const float* zero,
+    float* output,
+    uint32_t padding_top,
+    const union xnn_f32_chw_params params[restrict XNN_MIN_ELEMENTS(1)]) XNN_OOB_READS
+{
+  assert(input_height != 0);
+  assert(input_width != 0);
+  assert(input_width % sizeof(float) == 0);
+  assert(padding_top >= 1);
+  assert(padding_top <= 2);
+
+  const __m256 vmask_even = _mm256_load_ps((const float*) params->sse.mask_even8);
+  const __m256 vmask_odd  = _mm256_load_ps((const float*) params->sse.mask_odd8);
+  const __m256 vmax = _mm256_broadcast_ss(params->sse.max);
+  const __m256 vmin = _mm256_broadcast_ss(params->sse.min);
+
+  const __m256 vbias = _mm256_broadcast_ss(weights);
+  const __m256 vk00 = _mm256_broadcast_ss(weights + 1);
+  const __m256 vk01 = _mm256_broadcast_ss(weights + 2);
+  const __m256 vk02 = _mm256_broadcast_ss(weights + 3);
+  const __m256 vk03 = _mm256_broadcast_ss(weights + 4);
+  const __m256 vk04 = _mm256_broadcast_ss(weights + 5);
+  const __m256 vk10 = _mm256_broadcast_ss(weights + 6);
+  const __m256 vk11 = _mm256_broadcast_ss(weights + 7);
+  const __m256 vk12 = _mm256_broadcast_ss(weights + 8);
+  const __m256 vk13 = _mm256_broadcast_ss(weights + 9);
+  const __m256 vk14 = _mm256_broadcast_ss(weights + 10);
+  const __m256 vk20 = _mm256_broadcast_ss(weights + 11);
+  const __m256 vk21 = _mm256_broadcast_ss(weights + 12);
+  const __m256 vk22 = _mm256_broadcast_ss(weights + 13);
+  const __m256 vk23 = _mm256_broadcast_ss(weights + 14);
+  const __m256 vk24 = _mm256_broadcast_ss(weights + 15);
+  const __m256 vk30 = _mm256_broadcast_ss(weights + 16);
+  const __m256 vk31 = _mm256_broadcast_ss(weights + 17);
+  const __m256 vk32 = _mm256_broadcast_ss(weights + 18);
+  const __m256 vk33 = _mm256_broadcast_ss(weights + 19);
+  const __m256 vk34 = _mm256_broadcast_ss(weights + 20);
+  const __m256 vk40 = _mm256_broadcast_ss(weights + 21);
+  const __m256 vk41 = _mm256_broadcast_ss(weights + 22);
+  const __m256 vk42 = _mm256_broadcast_ss(weights + 23);
+  const __m256 vk43 = _mm256_broadcast_ss(weights + 24);
+  const __m256 vk44 = _mm256_broadcast_ss(weights + 25);
+
+  const uint32_t padding_top_less_1 = padding_top - 1;
+  const size_t input_decrement = round_up_po2(input_width, 8 /* SIMD output width */ * 2 /* subsampling */ * sizeof(float));
+
+  const float* i0 = zero;
+  const float* i1 = (const float*) ((uintptr_t) input - ((-padding_top_less_1) & input_width));
+  const float* i2 = (const float*) ((uintptr_t) i1 + input_width);
+  if XNN_UNPREDICTABLE(padding_top_less_1 != 0) {
+    i1 = zero;
+  }
+  const float* i3 = (const float*) ((uintptr_t) i2 + input_width);
+  const float* i4 = (const float*) ((uintptr_t) i3 + input_width);
+
+
+  float* o0 = output;
+
+  size_t padded_input_height = input_height + (padding_top_less_1 + 1) + 2 /* padding bottom */;
+  size_t output_height = (padded_input_height - 5 /* kernel size */ + 2 /* subsampling */) / 2;
+  do {
+    if XNN_UNPREDICTABLE(padded_input_height < 6) {
+      i3 = zero;
+    }
+    if XNN_UNPREDICTABLE(padded_input_height < 7) {
+      i4 = zero;
+    }
+
+    __m256 vi0x02468ACE = _mm256_setzero_ps();
+    __m256 vi1x02468ACE = _mm256_setzero_ps();
+    __m256 vi2x02468ACE = _mm256_setzero_ps();
+    __m256 vi3x02468ACE = _mm256_setzero_ps();
+    __m256 vi4x02468ACE = _mm256_setzero_ps();
+
+    __m256 vi0x13579BDF = _mm256_setzero_ps();
+    __m256 vi1x13579BDF = _mm256_setzero_ps();
+    __m256 vi2x13579BDF = _mm256_setzero_ps();
+    __m256 vi3x13579BDF = _mm256_setzero_ps();
+    __m256 vi4x13579BDF = _mm256_setzero_ps();
+
+    const __m256 vi0xGHIJKLMN = _mm256_loadu_ps(i0);
+    const __m256 vi1xGHIJKLMN = _mm256_loadu_ps(i1);
+    const __m256 vi2xGHIJKLMN = _mm256_loadu_ps(i2);
+    const __m256 vi3xGHIJKLMN = _mm256_loadu_ps(i3);
+    const __m256 vi4xGHIJKLMN = _mm256_loadu_ps(i4);
+    __m256 vi0xOPQRSTUV = _mm256_setzero_ps();
+    __m256 vi1xOPQRSTUV = _mm256_setzero_ps();
+    __m256 vi2xOPQRSTUV = _mm256_setzero_ps();
+    __m256 vi3xOPQRSTUV = _mm256_setzero_ps();
+    __m256 vi4xOPQRSTUV = _mm256_setzero_ps();
+    if XNN_LIKELY(input_width > 8 * sizeof(float)) {
+      vi0xOPQRSTUV = _mm256_loadu_ps(i0 + 8);
+      vi1xOPQRSTUV = _mm256_loadu_ps(i1 + 8);
+      vi2xOPQRSTUV = _mm256_loadu_ps(i2 + 8);
+      vi3xOPQRSTUV = _mm256_loadu_ps(i3 + 8);
+      vi4xOPQRSTUV = _mm256_loadu_ps(i4 + 8);
+    }
+    i0 += 16;
+    i1 += 16;
+    i2 += 16;
+    i3 += 16;
+    i4 += 16;
+
+    const __m256 vi0xGHIJOPQR = _mm256_permute2f128_ps(vi0xGHIJKLMN, vi0xOPQRSTUV, 0x20);
+    const __m256 vi0xKLMNSTUV = _mm256_permute2f128_ps(vi0xGHIJKLMN, vi0xOPQRSTUV, 0x31);
+    const __m256 vi1xGHIJOPQR = _mm256_permute2f128_ps(vi1xGHIJKLMN, vi1xOPQRSTUV, 0x20);
+    const __m256 vi1xKLMNSTUV = _mm256_permute2f128_ps(vi1xGHIJKLMN, vi1xOPQRSTUV, 0x31);
+    const __m256 vi2xGHIJOPQR = _mm256_permute2f128_ps(vi2xGHIJKLMN, vi2xOPQRSTUV, 0x20);
+    const __m256 vi2xKLMNSTUV = _mm256_permute2f128_ps(vi2xGHIJKLMN, vi2xOPQRSTUV, 0x31);
+    const __m256 vi3xGHIJOPQR = _mm256_permute2f128_ps(vi3xGHIJKLMN, vi3xOPQRSTUV, 0x20);
+    const __m256 vi3xKLMNSTUV = _mm256_permute2f128_ps(vi3xGHIJKLMN, vi3xOPQRSTUV, 0x31);
+    const __m256 vi4xGHIJOPQR = _mm256_permute2f128_ps(vi4xGHIJKLMN, vi4xOPQRSTUV, 0x20);
+    const __m256 vi4xKLMNSTUV = _mm256_permute2f128_ps(vi4xGHIJKLMN, vi4xOPQRSTUV, 0x31);
+
+    __m256 vi0xGIKMOQSU = _mm256_shuffle_ps(vi0xGHIJOPQR, vi0xKLMNSTUV, _MM_SHUFFLE(2, 0, 2, 0));
+    __m256 vi0xHJLNPRTV = _mm256_shuffle_ps(vi0xGHIJOPQR, vi0xKLMNSTUV, _MM_SHUFFLE(3, 1, 3, 1));
+    __m256 vi1xGIKMOQSU = _mm256_shuffle_ps(vi1xGHIJOPQR, vi1xKLMNSTUV, _MM_SHUFFLE(2, 0, 2, 0));
+    __m256 vi1xHJLNPRTV = _mm256_shuffle_ps(vi1xGHIJOPQR, vi1xKLMNSTUV, _MM_SHUFFLE(3, 1, 3, 1));
+    __m256 vi2xGIKMOQSU = _mm256_shuffle_ps(vi2xGHIJOPQR, vi2xKLMNSTUV, _MM_SHUFFLE(2, 0, 2, 0));
+    __m256 vi2xHJLNPRTV = _mm256_shuffle_ps(vi2xGHIJOPQR, vi2xKLMNSTUV, _MM_SHUFFLE(3, 1, 3, 1));
+    __m256 vi3xGIKMOQSU = _mm256_shuffle_ps(vi3xGHIJOPQR, vi3xKLMNSTUV, _MM_SHUFFLE(2, 0, 2, 0));
+    __m256 vi3xHJLNPRTV = _mm256_shuffle_ps(vi3xGHIJOPQR, vi3xKLMNSTUV, _MM_SHUFFLE(3, 1, 3, 1));
+    __m256 vi4xGIKMOQSU = _mm256_shuffle_ps(vi4xGHIJOPQR, vi4xKLMNSTUV, _MM_SHUFFLE(2, 0, 2, 0));
+    __m256 vi4xHJLNPRTV = _mm256_shuffle_ps(vi4xGHIJOPQR, vi4xKLMNSTUV, _MM_SHUFFLE(3, 1, 3, 1));
+
+    size_t w = input_width;
+    for (; w > 32 * sizeof(float); w -= 16 * sizeof(float)) {
+      __m256 vo0p0 = _mm256_add_ps(vbias, _mm256_mul_ps(vi0xGIKMOQSU, vk02));
+      __m256 vo0p1 = _mm256_mul_ps(vi1xGIKMOQSU, vk12);
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi2xGIKMOQSU, vk22));
+      vo0p1 = _mm256_add_ps(vo0p1, _mm256_mul_ps(vi3xGIKMOQSU, vk32));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi4xGIKMOQSU, vk42));
+
+      const __m256 vi0xWXYZabcd = _mm256_loadu_ps(i0);
+      const __m256 vi0xefghijkl = _mm256_loadu_ps(i0 + 8);
+      i0 += 16;
+      const __m256 vi1xWXYZabcd = _mm256_loadu_ps(i1);
+      const __m256 vi1xefghijkl = _mm256_loadu_ps(i1 + 8);
+      i1 += 16;
+      const __m256 vi2xWXYZabcd = _mm256_loadu_ps(i2);
+      const __m256 vi2xefghijkl = _mm256_loadu_ps(i2 + 8);
+      i2 += 16;
+      const __m256 vi3xWXYZabcd = _mm256_loadu_ps(i3);
+      const __m256 vi3xefghijkl = _mm256_loadu_ps(i3 + 8);
+      i3 += 16;
+      const __m256 vi4xWXYZabcd = _mm256_loadu_ps(i4);
+      const __m256 vi4xefghijkl = _mm256_loadu_ps(i4 + 8);
+      i4 += 16;
+
+      vo0p1 = _mm256_add_ps(vo0p1, _mm256_mul_ps(vi0xHJLNPRTV, vk03));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi1xHJLNPRTV, vk13));
+      vo0p1 = _mm256_add_ps(vo0p1, _mm256_mul_ps(vi2xHJLNPRTV, vk23));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi3xHJLNPRTV, vk33));
+      vo0p1 = _mm256_add_ps(vo0p1, _mm256_mul_ps(vi4xHJLNPRTV, vk43));
+
+      const __m256 vi0x8ACEGIKM = _mm256_permute2f128_ps(vi0x02468ACE, vi0xGIKMOQSU, 0x21);
+      vi0x02468ACE = vi0xGIKMOQSU;
+      const __m256 vi1x8ACEGIKM = _mm256_permute2f128_ps(vi1x02468ACE, vi1xGIKMOQSU, 0x21);
+      vi1x02468ACE = vi1xGIKMOQSU;
+      const __m256 vi2x8ACEGIKM = _mm256_permute2f128_ps(vi2x02468ACE, vi2xGIKMOQSU, 0x21);
+      vi2x02468ACE = vi2xGIKMOQSU;
+      const __m256 vi3x8ACEGIKM = _mm256_permute2f128_ps(vi3x02468ACE, vi3xGIKMOQSU, 0x21);
+      vi3x02468ACE = vi3xGIKMOQSU;
+      const __m256 vi4x8ACEGIKM = _mm256_permute2f128_ps(vi4x02468ACE, vi4xGIKMOQSU, 0x21);
+      vi4x02468ACE = vi4xGIKMOQSU;
+
+      const __m256 vi0xEGIKMOQS = _mm256_permute_ps(_mm256_blend_ps(vi0xGIKMOQSU, vi0x8ACEGIKM, 0x88), _MM_SHUFFLE(2, 1, 0, 3));
+      const __m256 vi1xEGIKMOQS = _mm256_permute_ps(_mm256_blend_ps(vi1xGIKMOQSU, vi1x8ACEGIKM, 0x88), _MM_SHUFFLE(2, 1, 0, 3));
+      const __m256 vi2xEGIKMOQS = _mm256_permute_ps(_mm256_blend_ps(vi2xGIKMOQSU, vi2x8ACEGIKM, 0x88), _MM_SHUFFLE(2, 1, 0, 3));
+      const __m256 vi3xEGIKMOQS = _mm256_permute_ps(_mm256_blend_ps(vi3xGIKMOQSU, vi3x8ACEGIKM, 0x88), _MM_SHUFFLE(2, 1, 0, 3));
+      const __m256 vi4xEGIKMOQS = _mm256_permute_ps(_mm256_blend_ps(vi4xGIKMOQSU, vi4x8ACEGIKM, 0x88), _MM_SHUFFLE(2, 1, 0, 3));
+
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi0xEGIKMOQS, vk00));
+      vo0p1 = _mm256_add_ps(vo0p1, _mm256_mul_ps(vi1xEGIKMOQS, vk10));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi2xEGIKMOQS, vk20));
+      vo0p1 = _mm256_add_ps(vo0p1, _mm256_mul_ps(vi3xEGIKMOQS, vk30));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi4xEGIKMOQS, vk40));
+
+      const __m256 vi0x9BDFHJLN = _mm256_permute2f128_ps(vi0x13579BDF, vi0xHJLNPRTV, 0x21);
+      vi0x13579BDF = vi0xHJLNPRTV;
+      const __m256 vi1x9BDFHJLN = _mm256_permute2f128_ps(vi1x13579BDF, vi1xHJLNPRTV, 0x21);
+      vi1x13579BDF = vi1xHJLNPRTV;
+      const __m256 vi2x9BDFHJLN = _mm256_permute2f128_ps(vi2x13579BDF, vi2xHJLNPRTV, 0x21);
+      vi2x13579BDF = vi2xHJLNPRTV;
+      const __m256 vi3x9BDFHJLN = _mm256_permute2f128_ps(vi3x13579BDF, vi3xHJLNPRTV, 0x21);
+      vi3x13579BDF = vi3xHJLNPRTV;
+      const __m256 vi4x9BDFHJLN = _mm256_permute2f128_ps(vi4x13579BDF, vi4xHJLNPRTV, 0x21);
+      vi4x13579BDF = vi4xHJLNPRTV;
+
+      const __m256 vi0xFHJLNPRT = _mm256_permute_ps(_mm256_blend_ps(vi0xHJLNPRTV, vi0x9BDFHJLN, 0x88), _MM_SHUFFLE(2, 1, 0, 3));
+      const __m256 vi1xFHJLNPRT = _mm256_permute_ps(_mm256_blend_ps(vi1xHJLNPRTV, vi1x9BDFHJLN, 0x88), _MM_SHUFFLE(2, 1, 0, 3));
+      const __m256 vi2xFHJLNPRT = _mm256_permute_ps(_mm256_blend_ps(vi2xHJLNPRTV, vi2x9BDFHJLN, 0x88), _MM_SHUFFLE(2, 1, 0, 3));
+      const __m256 vi3xFHJLNPRT = _mm256_permute_ps(_mm256_blend_ps(vi3xHJLNPRTV, vi3x9BDFHJLN, 0x88), _MM_SHUFFLE(2, 1, 0, 3));
+      const __m256 vi4xFHJLNPRT = _mm256_permute_ps(_mm256_blend_ps(vi4xHJLNPRTV, vi4x9BDFHJLN, 0x88), _MM_SHUFFLE(2, 1, 0, 3));
+
+      vo0p1 = _mm256_add_ps(vo0p1, _mm256_mul_ps(vi0xFHJLNPRT, vk01));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi1xFHJLNPRT, vk11));
+      vo0p1 = _mm256_add_ps(vo0p1, _mm256_mul_ps(vi2xFHJLNPRT, vk21));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi3xFHJLNPRT, vk31));
+      vo0p1 = _mm256_add_ps(vo0p1, _mm256_mul_ps(vi4xFHJLNPRT, vk41));
+
+      const __m256 vi0xWXYZefgh = _mm256_permute2f128_ps(vi0xWXYZabcd, vi0xefghijkl, 0x20);
+      const __m256 vi0xabcdijkl = _mm256_permute2f128_ps(vi0xWXYZabcd, vi0xefghijkl, 0x31);
+      const __m256 vi1xWXYZefgh = _mm256_permute2f128_ps(vi1xWXYZabcd, vi1xefghijkl, 0x20);
+      const __m256 vi1xabcdijkl = _mm256_permute2f128_ps(vi1xWXYZabcd, vi1xefghijkl, 0x31);
+      const __m256 vi2xWXYZefgh = _mm256_permute2f128_ps(vi2xWXYZabcd, vi2xefghijkl, 0x20);
+      const __m256 vi2xabcdijkl = _mm256_permute2f128_ps(vi2xWXYZabcd, vi2xefghijkl, 0x31);
+      const __m256 vi3xWXYZefgh = _mm256_permute2f128_ps(vi3xWXYZabcd, vi3xefghijkl, 0x20);
+      const __m256 vi3xabcdijkl = _mm256_permute2f128_ps(vi3xWXYZabcd, vi3xefghijkl, 0x31);
+      const __m256 vi4xWXYZefgh = _mm256_permute2f128_ps(vi4xWXYZabcd, vi4xefghijkl, 0x20);
+      const __m256 vi4xabcdijkl = _mm256_permute2f128_ps(vi4xWXYZabcd, vi4xefghijkl, 0x31);
+
+      const __m256 vi0xWYacegik = _mm256_shuffle_ps(vi0xWXYZefgh, vi0xabcdijkl, _MM_SHUFFLE(2, 0, 2, 0));
+      const __m256 vi0xXZbdfhjl = _mm256_shuffle_ps(vi0xWXYZefgh, vi0xabcdijkl, _MM_SHUFFLE(3, 1, 3, 1));
+      const __m256 vi1xWYacegik = _mm256_shuffle_ps(vi1xWXYZefgh, vi1xabcdijkl, _MM_SHUFFLE(2, 0, 2, 0));
+      const __m256 vi1xXZbdfhjl = _mm256_shuffle_ps(vi1xWXYZefgh, vi1xabcdijkl, _MM_SHUFFLE(3, 1, 3, 1));
+      const __m256 vi2xWYacegik = _mm256_shuffle_ps(vi2xWXYZefgh, vi2xabcdijkl, _MM_SHUFFLE(2, 0, 2, 0));
+      const __m256 vi2xXZbdfhjl = _mm256_shuffle_ps(vi2xWXYZefgh, vi2xabcdijkl, _MM_SHUFFLE(3, 1, 3, 1));
+      const __m256 vi3xWYacegik = _mm256_shuffle_ps(vi3xWXYZefgh, vi3xabcdijkl, _MM_SHUFFLE(2, 0, 2, 0));
+      const __m256 vi3xXZbdfhjl = _mm256_shuffle_ps(vi3xWXYZefgh, vi3xabcdijkl, _MM_SHUFFLE(3, 1, 3, 1));
+      const __m256 vi4xWYacegik = _mm256_shuffle_ps(vi4xWXYZefgh, vi4xabcdijkl, _MM_SHUFFLE(2, 0, 2, 0));
+      const __m256 vi4xXZbdfhjl = _mm256_shuffle_ps(vi4xWXYZefgh, vi4xabcdijkl, _MM_SHUFFLE(3, 1, 3, 1));
+
+      const __m256 vi0xOQSUWYac = _mm256_permute2f128_ps(vi0xGIKMOQSU, vi0xWYacegik, 0x21);
+      const __m256 vi1xOQSUWYac = _mm256_permute2f128_ps(vi1xGIKMOQSU, vi1xWYacegik, 0x21);
+      const __m256 vi2xOQSUWYac = _mm256_permute2f128_ps(vi2xGIKMOQSU, vi2xWYacegik, 0x21);
+      const __m256 vi3xOQSUWYac = _mm256_permute2f128_ps(vi3xGIKMOQSU, vi3xWYacegik, 0x21);
+      const __m256 vi4xOQSUWYac = _mm256_permute2f128_ps(vi4xGIKMOQSU, vi4xWYacegik, 0x21);
+
+      const __m256 vi0xIKMOQSUW = _mm256_permute_ps(_mm256_blend_ps(vi0xGIKMOQSU, vi0xOQSUWYac, 0x11), _MM_SHUFFLE(0, 3, 2, 1));
+      vi0xGIKMOQSU = vi0xWYacegik;
+      vi0xHJLNPRTV = vi0xXZbdfhjl;
+      const __m256 vi1xIKMOQSUW = _mm256_permute_ps(_mm256_blend_ps(vi1xGIKMOQSU, vi1xOQSUWYac, 0x11), _MM_SHUFFLE(0, 3, 2, 1));
+      vi1xGIKMOQSU = vi1xWYacegik;
+      vi1xHJLNPRTV = vi1xXZbdfhjl;
+      const __m256 vi2xIKMOQSUW = _mm256_permute_ps(_mm256_blend_ps(vi2xGIKMOQSU, vi2xOQSUWYac, 0x11), _MM_SHUFFLE(0, 3, 2, 1));
+      vi2xGIKMOQSU = vi2xWYacegik;
+      vi2xHJLNPRTV = vi2xXZbdfhjl;
+      const __m256 vi3xIKMOQSUW = _mm256_permute_ps(_mm256_blend_ps(vi3xGIKMOQSU, vi3xOQSUWYac, 0x11), _MM_SHUFFLE(0, 3, 2, 1));
+      vi3xGIKMOQSU = vi3xWYacegik;
+      vi3xHJLNPRTV = vi3xXZbdfhjl;
+      const __m256 vi4xIKMOQSUW = _mm256_permute_ps(_mm256_blend_ps(vi4xGIKMOQSU, vi4xOQSUWYac, 0x11), _MM_SHUFFLE(0, 3, 2, 1));
+      vi4xGIKMOQSU = vi4xWYacegik;
+      vi4xHJLNPRTV = vi4xXZbdfhjl;
+
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi0xIKMOQSUW, vk04));
+      vo0p1 = _mm256_add_ps(vo0p1, _mm256_mul_ps(vi1xIKMOQSUW, vk14));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi2xIKMOQSUW, vk24));
+      vo0p1 = _mm256_add_ps(vo0p1, _mm256_mul_ps(vi3xIKMOQSUW, vk34));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi4xIKMOQSUW, vk44));
+
+      vo0p0 = _mm256_add_ps(vo0p0, vo0p1);
+
+      __m256 vo0 = _mm256_max_ps(vo0p0, vmin);
+
+      vo0 = _mm256_min_ps(vo0, vmax);
+
+      _mm256_storeu_ps(o0, vo0);
+      o0 += 8;
+    }
+    // Process the next-to-last block, loading only the part of the last block that lies within the row.
+    if XNN_LIKELY(w > 16 * sizeof(float)) {
+      __m256 vo0p0 = _mm256_add_ps(vbias, _mm256_mul_ps(vi0xGIKMOQSU, vk02));
+      __m256 vo0p1 = _mm256_mul_ps(vi1xGIKMOQSU, vk12);
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi2xGIKMOQSU, vk22));
+      vo0p1 = _mm256_add_ps(vo0p1, _mm256_mul_ps(vi3xGIKMOQSU, vk32));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi4xGIKMOQSU, vk42));
+
+      const __m256 vi0xWXYZabcd = _mm256_loadu_ps(i0);
+      const __m256 vi1xWXYZabcd = _mm256_loadu_ps(i1);
+      const __m256 vi2xWXYZabcd = _mm256_loadu_ps(i2);
+      const __m256 vi3xWXYZabcd = _mm256_loadu_ps(i3);
+      const __m256 vi4xWXYZabcd = _mm256_loadu_ps(i4);
+      __m256 vi0xefghijkl = _mm256_setzero_ps();
+      __m256 vi1xefghijkl = _mm256_setzero_ps();
+      __m256 vi2xefghijkl = _mm256_setzero_ps();
+      __m256 vi3xefghijkl = _mm256_setzero_ps();
+      __m256 vi4xefghijkl = _mm256_setzero_ps();
+      if (w > 24 * sizeof(float)) {
+        vi0xefghijkl = _mm256_loadu_ps(i0 + 8);
+        vi1xefghijkl = _mm256_loadu_ps(i1 + 8);
+        vi2xefghijkl = _mm256_loadu_ps(i2 + 8);
+        vi3xefghijkl = _mm256_loadu_ps(i3 + 8);
+        vi4xefghijkl = _mm256_loadu_ps(i4 + 8);
+      }
+      i0 += 16;
+      i1 += 16;
+      i2 += 16;
+      i3 += 16;
+      i4 += 16;
+
+      vo0p1 = _mm256_add_ps(vo0p1, _mm256_mul_ps(vi0xHJLNPRTV, vk03));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi1xHJLNPRTV, vk13));
+      vo0p1 = _mm256_add_ps(vo0p1, _mm256_mul_ps(vi2xHJLNPRTV, vk23));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi3xHJLNPRTV, vk33));
+      vo0p1 = _mm256_add_ps(vo0p1, _mm256_mul_ps(vi4xHJLNPRTV, vk43));
+
+      const __m256 vi0x8ACEGIKM = _mm256_permute2f128_ps(vi0x02468ACE, vi0xGIKMOQSU, 0x21);
+      vi0x02468ACE = vi0xGIKMOQSU;
+      const __m256 vi1x8ACEGIKM = _mm256_permute2f128_ps(vi1x02468ACE, vi1xGIKMOQSU, 0x21);
+      vi1x02468ACE = vi1xGIKMOQSU;
+      const __m256 vi2x8ACEGIKM = _mm256_permute2f128_ps(vi2x02468ACE, vi2xGIKMOQSU, 0x21);
+      vi2x02468ACE = vi2xGIKMOQSU;
+      const __m256 vi3x8ACEGIKM = _mm256_permute2f128_ps(vi3x02468ACE, vi3xGIKMOQSU, 0x21);
+      vi3x02468ACE = vi3xGIKMOQSU;
+      const __m256 vi4x8ACEGIKM = _mm256_permute2f128_ps(vi4x02468ACE, vi4xGIKMOQSU, 0x21);
+      vi4x02468ACE = vi4xGIKMOQSU;
+
+      const __m256 vi0xEGIKMOQS = _mm256_permute_ps(_mm256_blend_ps(vi0xGIKMOQSU, vi0x8ACEGIKM, 0x88), _MM_SHUFFLE(2, 1, 0, 3));
+      const __m256 vi1xEGIKMOQS = _mm256_permute_ps(_mm256_blend_ps(vi1xGIKMOQSU, vi1x8ACEGIKM, 0x88), _MM_SHUFFLE(2, 1, 0, 3));
+      const __m256 vi2xEGIKMOQS = _mm256_permute_ps(_mm256_blend_ps(vi2xGIKMOQSU, vi2x8ACEGIKM, 0x88), _MM_SHUFFLE(2, 1, 0, 3));
+      const __m256 vi3xEGIKMOQS = _mm256_permute_ps(_mm256_blend_ps(vi3xGIKMOQSU, vi3x8ACEGIKM, 0x88), _MM_SHUFFLE(2, 1, 0, 3));
+      const __m256 vi4xEGIKMOQS = _mm256_permute_ps(_mm256_blend_ps(vi4xGIKMOQSU, vi4x8ACEGIKM, 0x88), _MM_SHUFFLE(2, 1, 0, 3));
+
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi0xEGIKMOQS, vk00));
+      vo0p1 = _mm256_add_ps(vo0p1, _mm256_mul_ps(vi1xEGIKMOQS, vk10));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi2xEGIKMOQS, vk20));
+      vo0p1 = _mm256_add_ps(vo0p1, _mm256_mul_ps(vi3xEGIKMOQS, vk30));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi4xEGIKMOQS, vk40));
+
+      const __m256 vi0x9BDFHJLN = _mm256_permute2f128_ps(vi0x13579BDF, vi0xHJLNPRTV, 0x21);
+      vi0x13579BDF = vi0xHJLNPRTV;
+      const __m256 vi1x9BDFHJLN = _mm256_permute2f128_ps(vi1x13579BDF, vi1xHJLNPRTV, 0x21);
+      vi1x13579BDF = vi1xHJLNPRTV;
+      const __m256 vi2x9BDFHJLN = _mm256_permute2f128_ps(vi2x13579BDF, vi2xHJLNPRTV, 0x21);
+      vi2x13579BDF = vi2xHJLNPRTV;
+      const __m256 vi3x9BDFHJLN = _mm256_permute2f128_ps(vi3x13579BDF, vi3xHJLNPRTV, 0x21);
+      vi3x13579BDF = vi3xHJLNPRTV;
+      const __m256 vi4x9BDFHJLN = _mm256_permute2f128_ps(vi4x13579BDF, vi4xHJLNPRTV, 0x21);
+      vi4x13579BDF = vi4xHJLNPRTV;
+
+      const __m256 vi0xFHJLNPRT = _mm256_permute_ps(_mm256_blend_ps(vi0xHJLNPRTV, vi0x9BDFHJLN, 0x88), _MM_SHUFFLE(2, 1, 0, 3));
+      const __m256 vi1xFHJLNPRT = _mm256_permute_ps(_mm256_blend_ps(vi1xHJLNPRTV, vi1x9BDFHJLN, 0x88), _MM_SHUFFLE(2, 1, 0, 3));
+      const __m256 vi2xFHJLNPRT = _mm256_permute_ps(_mm256_blend_ps(vi2xHJLNPRTV, vi2x9BDFHJLN, 0x88), _MM_SHUFFLE(2, 1, 0, 3));
+      const __m256 vi3xFHJLNPRT = _mm256_permute_ps(_mm256_blend_ps(vi3xHJLNPRTV, vi3x9BDFHJLN, 0x88), _MM_SHUFFLE(2, 1, 0, 3));
+      const __m256 vi4xFHJLNPRT = _mm256_permute_ps(_mm256_blend_ps(vi4xHJLNPRTV, vi4x9BDFHJLN, 0x88), _MM_SHUFFLE(2, 1, 0, 3));
+
+      vo0p1 = _mm256_add_ps(vo0p1, _mm256_mul_ps(vi0xFHJLNPRT, vk01));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi1xFHJLNPRT, vk11));
+      vo0p1 = _mm256_add_ps(vo0p1, _mm256_mul_ps(vi2xFHJLNPRT, vk21));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi3xFHJLNPRT, vk31));
+      vo0p1 = _mm256_add_ps(vo0p1, _mm256_mul_ps(vi4xFHJLNPRT, vk41));
+
+      const __m256 vi0xWXYZefgh = _mm256_permute2f128_ps(vi0xWXYZabcd, vi0xefghijkl, 0x20);
+      const __m256 vi0xabcdijkl = _mm256_permute2f128_ps(vi0xWXYZabcd, vi0xefghijkl, 0x31);
+      const __m256 vi1xWXYZefgh = _mm256_permute2f128_ps(vi1xWXYZabcd, vi1xefghijkl, 0x20);
+      const __m256 vi1xabcdijkl = _mm256_permute2f128_ps(vi1xWXYZabcd, vi1xefghijkl, 0x31);
+      const __m256 vi2xWXYZefgh = _mm256_permute2f128_ps(vi2xWXYZabcd, vi2xefghijkl, 0x20);
+      const __m256 vi2xabcdijkl = _mm256_permute2f128_ps(vi2xWXYZabcd, vi2xefghijkl, 0x31);
+      const __m256 vi3xWXYZefgh = _mm256_permute2f128_ps(vi3xWXYZabcd, vi3xefghijkl, 0x20);
+      const __m256 vi3xabcdijkl = _mm256_permute2f128_ps(vi3xWXYZabcd, vi3xefghijkl, 0x31);
+      const __m256 vi4xWXYZefgh = _mm256_permute2f128_ps(vi4xWXYZabcd, vi4xefghijkl, 0x20);
+      const __m256 vi4xabcdijkl = _mm256_permute2f128_ps(vi4xWXYZabcd, vi4xefghijkl, 0x31);
+
+      const __m256 vi0xWYacegik = _mm256_shuffle_ps(vi0xWXYZefgh, vi0xabcdijkl, _MM_SHUFFLE(2, 0, 2, 0));
+      const __m256 vi0xXZbdfhjl = _mm256_shuffle_ps(vi0xWXYZefgh, vi0xabcdijkl, _MM_SHUFFLE(3, 1, 3, 1));
+      const __m256 vi1xWYacegik = _mm256_shuffle_ps(vi1xWXYZefgh, vi1xabcdijkl, _MM_SHUFFLE(2, 0, 2, 0));
+      const __m256 vi1xXZbdfhjl = _mm256_shuffle_ps(vi1xWXYZefgh, vi1xabcdijkl, _MM_SHUFFLE(3, 1, 3, 1));
+      const __m256 vi2xWYacegik = _mm256_shuffle_ps(vi2xWXYZefgh, vi2xabcdijkl, _MM_SHUFFLE(2, 0, 2, 0));
+      const __m256 vi2xXZbdfhjl = _mm256_shuffle_ps(vi2xWXYZefgh, vi2xabcdijkl, _MM_SHUFFLE(3, 1, 3, 1));
+      const __m256 vi3xWYacegik = _mm256_shuffle_ps(vi3xWXYZefgh, vi3xabcdijkl, _MM_SHUFFLE(2, 0, 2, 0));
+      const __m256 vi3xXZbdfhjl = _mm256_shuffle_ps(vi3xWXYZefgh, vi3xabcdijkl, _MM_SHUFFLE(3, 1, 3, 1));
+      const __m256 vi4xWYacegik = _mm256_shuffle_ps(vi4xWXYZefgh, vi4xabcdijkl, _MM_SHUFFLE(2, 0, 2, 0));
+      const __m256 vi4xXZbdfhjl = _mm256_shuffle_ps(vi4xWXYZefgh, vi4xabcdijkl, _MM_SHUFFLE(3, 1, 3, 1));
+
+      const __m256 vi0xOQSUWYac = _mm256_permute2f128_ps(vi0xGIKMOQSU, vi0xWYacegik, 0x21);
+      const __m256 vi1xOQSUWYac = _mm256_permute2f128_ps(vi1xGIKMOQSU, vi1xWYacegik, 0x21);
+      const __m256 vi2xOQSUWYac = _mm256_permute2f128_ps(vi2xGIKMOQSU, vi2xWYacegik, 0x21);
+      const __m256 vi3xOQSUWYac = _mm256_permute2f128_ps(vi3xGIKMOQSU, vi3xWYacegik, 0x21);
+      const __m256 vi4xOQSUWYac = _mm256_permute2f128_ps(vi4xGIKMOQSU, vi4xWYacegik, 0x21);
+
+      const __m256 vi0xIKMOQSUW = _mm256_permute_ps(_mm256_blend_ps(vi0xGIKMOQSU, vi0xOQSUWYac, 0x11), _MM_SHUFFLE(0, 3, 2, 1));
+      vi0xGIKMOQSU = vi0xWYacegik;
+      vi0xHJLNPRTV = vi0xXZbdfhjl;
+      const __m256 vi1xIKMOQSUW = _mm256_permute_ps(_mm256_blend_ps(vi1xGIKMOQSU, vi1xOQSUWYac, 0x11), _MM_SHUFFLE(0, 3, 2, 1));
+      vi1xGIKMOQSU = vi1xWYacegik;
+      vi1xHJLNPRTV = vi1xXZbdfhjl;
+      const __m256 vi2xIKMOQSUW = _mm256_permute_ps(_mm256_blend_ps(vi2xGIKMOQSU, vi2xOQSUWYac, 0x11), _MM_SHUFFLE(0, 3, 2, 1));
+      vi2xGIKMOQSU = vi2xWYacegik;
+      vi2xHJLNPRTV = vi2xXZbdfhjl;
+      const __m256 vi3xIKMOQSUW = _mm256_permute_ps(_mm256_blend_ps(vi3xGIKMOQSU, vi3xOQSUWYac, 0x11), _MM_SHUFFLE(0, 3, 2, 1));
+      vi3xGIKMOQSU = vi3xWYacegik;
+      vi3xHJLNPRTV = vi3xXZbdfhjl;
+      const __m256 vi4xIKMOQSUW = _mm256_permute_ps(_mm256_blend_ps(vi4xGIKMOQSU, vi4xOQSUWYac, 0x11), _MM_SHUFFLE(0, 3, 2, 1));
+      vi4xGIKMOQSU = vi4xWYacegik;
+      vi4xHJLNPRTV = vi4xXZbdfhjl;
+
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi0xIKMOQSUW, vk04));
+      vo0p1 = _mm256_add_ps(vo0p1, _mm256_mul_ps(vi1xIKMOQSUW, vk14));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi2xIKMOQSUW, vk24));
+      vo0p1 = _mm256_add_ps(vo0p1, _mm256_mul_ps(vi3xIKMOQSUW, vk34));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi4xIKMOQSUW, vk44));
+
+      vo0p0 = _mm256_add_ps(vo0p0, vo0p1);
+
+      __m256 vo0 = _mm256_max_ps(vo0p0, vmin);
+
+      vo0 = _mm256_min_ps(vo0, vmax);
+
+      _mm256_storeu_ps(o0, vo0);
+      o0 += 8;
+
+      w -= 16 * sizeof(float);
+    }
+    // Last block has 1-16 pixels to process.
+    assert(w <= 16 * sizeof(float));
+    assert(w >= 1 * sizeof(float));
+    {
+      vi0xGIKMOQSU = _mm256_and_ps(vi0xGIKMOQSU, vmask_even);
+      vi0xHJLNPRTV = _mm256_and_ps(vi0xHJLNPRTV, vmask_odd);
+      vi1xGIKMOQSU = _mm256_and_ps(vi1xGIKMOQSU, vmask_even);
+      vi1xHJLNPRTV = _mm256_and_ps(vi1xHJLNPRTV, vmask_odd);
+      vi2xGIKMOQSU = _mm256_and_ps(vi2xGIKMOQSU, vmask_even);
+      vi2xHJLNPRTV = _mm256_and_ps(vi2xHJLNPRTV, vmask_odd);
+      vi3xGIKMOQSU = _mm256_and_ps(vi3xGIKMOQSU, vmask_even);
+      vi3xHJLNPRTV = _mm256_and_ps(vi3xHJLNPRTV, vmask_odd);
+      vi4xGIKMOQSU = _mm256_and_ps(vi4xGIKMOQSU, vmask_even);
+      vi4xHJLNPRTV = _mm256_and_ps(vi4xHJLNPRTV, vmask_odd);
+
+      __m256 vo0p0 = _mm256_add_ps(vbias, _mm256_mul_ps(vi0xGIKMOQSU, vk02));
+      __m256 vo0p1 = _mm256_mul_ps(vi1xGIKMOQSU, vk12);
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi2xGIKMOQSU, vk22));
+      vo0p1 = _mm256_add_ps(vo0p1, _mm256_mul_ps(vi3xGIKMOQSU, vk32));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi4xGIKMOQSU, vk42));
+
+      vo0p1 = _mm256_add_ps(vo0p1, _mm256_mul_ps(vi0xHJLNPRTV, vk03));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi1xHJLNPRTV, vk13));
+      vo0p1 = _mm256_add_ps(vo0p1, _mm256_mul_ps(vi2xHJLNPRTV, vk23));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi3xHJLNPRTV, vk33));
+      vo0p1 = _mm256_add_ps(vo0p1, _mm256_mul_ps(vi4xHJLNPRTV, vk43));
+
+      const __m256 vi0x8ACEGIKM = _mm256_permute2f128_ps(vi0x02468ACE, vi0xGIKMOQSU, 0x21);
+      const __m256 vi1x8ACEGIKM = _mm256_permute2f128_ps(vi1x02468ACE, vi1xGIKMOQSU, 0x21);
+      const __m256 vi2x8ACEGIKM = _mm256_permute2f128_ps(vi2x02468ACE, vi2xGIKMOQSU, 0x21);
+      const __m256 vi3x8ACEGIKM = _mm256_permute2f128_ps(vi3x02468ACE, vi3xGIKMOQSU, 0x21);
+      const __m256 vi4x8ACEGIKM = _mm256_permute2f128_ps(vi4x02468ACE, vi4xGIKMOQSU, 0x21);
+
+      const __m256 vi0xEGIKMOQS = _mm256_permute_ps(_mm256_blend_ps(vi0xGIKMOQSU, vi0x8ACEGIKM, 0x88), _MM_SHUFFLE(2, 1, 0, 3));
+      const __m256 vi1xEGIKMOQS = _mm256_permute_ps(_mm256_blend_ps(vi1xGIKMOQSU, vi1x8ACEGIKM, 0x88), _MM_SHUFFLE(2, 1, 0, 3));
+      const __m256 vi2xEGIKMOQS = _mm256_permute_ps(_mm256_blend_ps(vi2xGIKMOQSU, vi2x8ACEGIKM, 0x88), _MM_SHUFFLE(2, 1, 0, 3));
+      const __m256 vi3xEGIKMOQS = _mm256_permute_ps(_mm256_blend_ps(vi3xGIKMOQSU, vi3x8ACEGIKM, 0x88), _MM_SHUFFLE(2, 1, 0, 3));
+      const __m256 vi4xEGIKMOQS = _mm256_permute_ps(_mm256_blend_ps(vi4xGIKMOQSU, vi4x8ACEGIKM, 0x88), _MM_SHUFFLE(2, 1, 0, 3));
+
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi0xEGIKMOQS, vk00));
+      vo0p1 = _mm256_add_ps(vo0p1, _mm256_mul_ps(vi1xEGIKMOQS, vk10));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi2xEGIKMOQS, vk20));
+      vo0p1 = _mm256_add_ps(vo0p1, _mm256_mul_ps(vi3xEGIKMOQS, vk30));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi4xEGIKMOQS, vk40));
+
+      const __m256 vi0x9BDFHJLN = _mm256_permute2f128_ps(vi0x13579BDF, vi0xHJLNPRTV, 0x21);
+      const __m256 vi1x9BDFHJLN = _mm256_permute2f128_ps(vi1x13579BDF, vi1xHJLNPRTV, 0x21);
+      const __m256 vi2x9BDFHJLN = _mm256_permute2f128_ps(vi2x13579BDF, vi2xHJLNPRTV, 0x21);
+      const __m256 vi3x9BDFHJLN = _mm256_permute2f128_ps(vi3x13579BDF, vi3xHJLNPRTV, 0x21);
+      const __m256 vi4x9BDFHJLN = _mm256_permute2f128_ps(vi4x13579BDF, vi4xHJLNPRTV, 0x21);
+
+      const __m256 vi0xFHJLNPRT = _mm256_permute_ps(_mm256_blend_ps(vi0xHJLNPRTV, vi0x9BDFHJLN, 0x88), _MM_SHUFFLE(2, 1, 0, 3));
+      const __m256 vi1xFHJLNPRT = _mm256_permute_ps(_mm256_blend_ps(vi1xHJLNPRTV, vi1x9BDFHJLN, 0x88), _MM_SHUFFLE(2, 1, 0, 3));
+      const __m256 vi2xFHJLNPRT = _mm256_permute_ps(_mm256_blend_ps(vi2xHJLNPRTV, vi2x9BDFHJLN, 0x88), _MM_SHUFFLE(2, 1, 0, 3));
+      const __m256 vi3xFHJLNPRT = _mm256_permute_ps(_mm256_blend_ps(vi3xHJLNPRTV, vi3x9BDFHJLN, 0x88), _MM_SHUFFLE(2, 1, 0, 3));
+      const __m256 vi4xFHJLNPRT = _mm256_permute_ps(_mm256_blend_ps(vi4xHJLNPRTV, vi4x9BDFHJLN, 0x88), _MM_SHUFFLE(2, 1, 0, 3));
+
+      vo0p1 = _mm256_add_ps(vo0p1, _mm256_mul_ps(vi0xFHJLNPRT, vk01));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi1xFHJLNPRT, vk11));
+      vo0p1 = _mm256_add_ps(vo0p1, _mm256_mul_ps(vi2xFHJLNPRT, vk21));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi3xFHJLNPRT, vk31));
+      vo0p1 = _mm256_add_ps(vo0p1, _mm256_mul_ps(vi4xFHJLNPRT, vk41));
+
+      // vi0xOQSUWYac = ( 0.0, 0.0, 0.0, 0.0, vi0U, vi0S, vi0Q, vi0O )
+      const __m256 vi0xOQSUWYac = _mm256_permute2f128_ps(vi0xGIKMOQSU, vi0xGIKMOQSU, 0x81);
+      // vi1xOQSUWYac = ( 0.0, 0.0, 0.0, 0.0, vi1U, vi1S, vi1Q, vi1O )
+      const __m256 vi1xOQSUWYac = _mm256_permute2f128_ps(vi1xGIKMOQSU, vi1xGIKMOQSU, 0x81);
+      // vi2xOQSUWYac = ( 0.0, 0.0, 0.0, 0.0, vi2U, vi2S, vi2Q, vi2O )
+      const __m256 vi2xOQSUWYac = _mm256_permute2f128_ps(vi2xGIKMOQSU, vi2xGIKMOQSU, 0x81);
+      // vi3xOQSUWYac = ( 0.0, 0.0, 0.0, 0.0, vi3U, vi3S, vi3Q, vi3O )
+      const __m256 vi3xOQSUWYac = _mm256_permute2f128_ps(vi3xGIKMOQSU, vi3xGIKMOQSU, 0x81);
+      // vi4xOQSUWYac = ( 0.0, 0.0, 0.0, 0.0, vi4U, vi4S, vi4Q, vi4O )
+      const __m256 vi4xOQSUWYac = _mm256_permute2f128_ps(vi4xGIKMOQSU, vi4xGIKMOQSU, 0x81);
+
+      const __m256 vi0xIKMOQSUW = _mm256_permute_ps(_mm256_blend_ps(vi0xGIKMOQSU, vi0xOQSUWYac, 0x11), _MM_SHUFFLE(0, 3, 2, 1));
+      const __m256 vi1xIKMOQSUW = _mm256_permute_ps(_mm256_blend_ps(vi1xGIKMOQSU, vi1xOQSUWYac, 0x11), _MM_SHUFFLE(0, 3, 2, 1));
+      const __m256 vi2xIKMOQSUW = _mm256_permute_ps(_mm256_blend_ps(vi2xGIKMOQSU, vi2xOQSUWYac, 0x11), _MM_SHUFFLE(0, 3, 2, 1));
+      const __m256 vi3xIKMOQSUW = _mm256_permute_ps(_mm256_blend_ps(vi3xGIKMOQSU, vi3xOQSUWYac, 0x11), _MM_SHUFFLE(0, 3, 2, 1));
+      const __m256 vi4xIKMOQSUW = _mm256_permute_ps(_mm256_blend_ps(vi4xGIKMOQSU, vi4xOQSUWYac, 0x11), _MM_SHUFFLE(0, 3, 2, 1));
+
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi0xIKMOQSUW, vk04));
+      vo0p1 = _mm256_add_ps(vo0p1, _mm256_mul_ps(vi1xIKMOQSUW, vk14));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi2xIKMOQSUW, vk24));
+      vo0p1 = _mm256_add_ps(vo0p1, _mm256_mul_ps(vi3xIKMOQSUW, vk34));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi4xIKMOQSUW, vk44));
+
+      vo0p0 = _mm256_add_ps(vo0p0, vo0p1);
+
+      __m256 vo0 = _mm256_max_ps(vo0p0, vmin);
+
+      vo0 = _mm256_min_ps(vo0, vmax);
+
+      const size_t w_tmp = (w + 1 * sizeof(float)) / (2 * sizeof(float));
+      if XNN_LIKELY(w_tmp >= 8) {
+        _mm256_storeu_ps(o0, vo0);
+        o0 += 8;
+      } else {
+        __m128 vo0_lo = _mm256_castps256_ps128(vo0);
+        if (w_tmp & 4) {
+          _mm_storeu_ps(o0, vo0_lo);
+          o0 += 4;
+
+          vo0_lo = _mm256_extractf128_ps(vo0, 1);
+        }
+        if (w_tmp & 2) {
+          _mm_storel_pi((__m64*) o0, vo0_lo);
+          o0 += 2;
+
+          vo0_lo = _mm_movehl_ps(vo0_lo, vo0_lo);
+        }
+        if (w_tmp & 1) {
+          _mm_store_ss(o0, vo0_lo);
+          o0 += 1;
+        }
+      }
+    }
+
+    i0 = (const float*) ((uintptr_t) i2 - input_decrement);
+    i1 = (const float*) ((uintptr_t) i3 - input_decrement);
+    i2 = (const float*) ((uintptr_t) i4 - input_decrement);
+    i3 = (const float*) ((uintptr_t) i2 + input_width);
+    i4 = (const float*) ((uintptr_t) i3 + input_width);
+
+
+    output_height -= 1;
+    padded_input_height -= 2;
+  } while (output_height != 0);
+}
@@ -0,0 +1,987 @@
+// Auto-generated file. Do not edit!
+//   Template: src/f32-dwconv2d-chw/5x5s2p2-avx.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <immintrin.h>
+
+#include <xnnpack/dwconv.h>
+#include <xnnpack/math.h>
+
+
+void xnn_f32_dwconv2d_chw_ukernel_5x5s2p2__avx_3x8(
+    size_t input_height,
+    size_t input_width,
+    const float* input,
+    const float* weights,
+    const float* zero,
+    float* output,
+    uint32_t padding_top,
+    const union xnn_f32_chw_params params[restrict XNN_MIN_ELEMENTS(1)]) XNN_OOB_READS
+{
+  assert(input_height != 0);
+  assert(input_width != 0);
+  assert(input_width % sizeof(float) == 0);
+  assert(padding_top >= 1);
+  assert(padding_top <= 2);
+
+  const __m256 vmask_even = _mm256_load_ps((const float*) params->sse.mask_even8);
+  const __m256 vmask_odd  = _mm256_load_ps((const float*) params->sse.mask_odd8);
+  const __m256 vmax = _mm256_broadcast_ss(params->sse.max);
+  const __m256 vmin = _mm256_broadcast_ss(params->sse.min);
+
+  const __m256 vbias = _mm256_broadcast_ss(weights);
+  const __m256 vk00 = _mm256_broadcast_ss(weights + 1);
+  const __m256 vk01 = _mm256_broadcast_ss(weights + 2);
+  const __m256 vk02 = _mm256_broadcast_ss(weights + 3);
+  const __m256 vk03 = _mm256_broadcast_ss(weights + 4);
+  const __m256 vk04 = _mm256_broadcast_ss(weights + 5);
+  const __m256 vk10 = _mm256_broadcast_ss(weights + 6);
+  const __m256 vk11 = _mm256_broadcast_ss(weights + 7);
+  const __m256 vk12 = _mm256_broadcast_ss(weights + 8);
+  const __m256 vk13 = _mm256_broadcast_ss(weights + 9);
+  const __m256 vk14 = _mm256_broadcast_ss(weights + 10);
+  const __m256 vk20 = _mm256_broadcast_ss(weights + 11);
+  const __m256 vk21 = _mm256_broadcast_ss(weights + 12);
+  const __m256 vk22 = _mm256_broadcast_ss(weights + 13);
+  const __m256 vk23 = _mm256_broadcast_ss(weights + 14);
+  const __m256 vk24 = _mm256_broadcast_ss(weights + 15);
+  const __m256 vk30 = _mm256_broadcast_ss(weights + 16);
+  const __m256 vk31 = _mm256_broadcast_ss(weights + 17);
+  const __m256 vk32 = _mm256_broadcast_ss(weights + 18);
+  const __m256 vk33 = _mm256_broadcast_ss(weights + 19);
+  const __m256 vk34 = _mm256_broadcast_ss(weights + 20);
+  const __m256 vk40 = _mm256_broadcast_ss(weights + 21);
+  const __m256 vk41 = _mm256_broadcast_ss(weights + 22);
+  const __m256 vk42 = _mm256_broadcast_ss(weights + 23);
+  const __m256 vk43 = _mm256_broadcast_ss(weights + 24);
+  const __m256 vk44 = _mm256_broadcast_ss(weights + 25);
+
+  const uint32_t padding_top_less_1 = padding_top - 1;
+  const size_t input_decrement = round_up_po2(input_width, 8 /* SIMD output width */ * 2 /* subsampling */ * sizeof(float));
+
+  const float* i0 = zero;
+  const float* i1 = (const float*) ((uintptr_t) input - ((-padding_top_less_1) & input_width));
+  const float* i2 = (const float*) ((uintptr_t) i1 + input_width);
+  if XNN_UNPREDICTABLE(padding_top_less_1 != 0) {
+    i1 = zero;
+  }
+  const float* i3 = (const float*) ((uintptr_t) i2 + input_width);
+  const float* i4 = (const float*) ((uintptr_t) i3 + input_width);
+  const float* i5 = (const float*) ((uintptr_t) i4 + input_width);
+  const float* i6 = (const float*) ((uintptr_t) i5 + input_width);
+  const float* i7 = (const float*) ((uintptr_t) i6 + input_width);
+  const float* i8 = (const float*) ((uintptr_t) i7 + input_width);
+
+  const size_t output_width = round_down_po2((input_width + (2 /* padding */ - 3 /* kernel size */ + 2 /* subsampling */) * sizeof(float)) / 2, sizeof(float));
+
+  float* o0 = output;
+  float* o1 = (float*) ((uintptr_t) o0 + output_width);
+  float* o2 = (float*) ((uintptr_t) o1 + output_width);
+
+  size_t padded_input_height = input_height + (padding_top_less_1 + 1) + 2 /* padding bottom */;
+  size_t output_height = (padded_input_height - 5 /* kernel size */ + 2 /* subsampling */) / 2;
+  do {
+    if XNN_UNPREDICTABLE(padded_input_height < 6) {
+      i3 = zero;
+    }
+    if XNN_UNPREDICTABLE(padded_input_height < 7) {
+      i4 = zero;
+      o1 = o0;
+    }
+    if XNN_UNPREDICTABLE(padded_input_height < 8) {
+      i5 = zero;
+    }
+    if XNN_UNPREDICTABLE(padded_input_height < 9) {
+      i6 = zero;
+      o2 = o1;
+    }
+    if XNN_UNPREDICTABLE(padded_input_height < 10) {
+      i7 = zero;
+    }
+    if XNN_UNPREDICTABLE(padded_input_height < 11) {
+      i8 = zero;
+    }
+
+    __m256 vi0x02468ACE = _mm256_setzero_ps();
+    __m256 vi1x02468ACE = _mm256_setzero_ps();
+    __m256 vi2x02468ACE = _mm256_setzero_ps();
+    __m256 vi3x02468ACE = _mm256_setzero_ps();
+    __m256 vi4x02468ACE = _mm256_setzero_ps();
+    __m256 vi5x02468ACE = _mm256_setzero_ps();
+    __m256 vi6x02468ACE = _mm256_setzero_ps();
+    __m256 vi7x02468ACE = _mm256_setzero_ps();
+    __m256 vi8x02468ACE = _mm256_setzero_ps();
+
+    __m256 vi0x13579BDF = _mm256_setzero_ps();
+    __m256 vi1x13579BDF = _mm256_setzero_ps();
+    __m256 vi2x13579BDF = _mm256_setzero_ps();
+    __m256 vi3x13579BDF = _mm256_setzero_ps();
+    __m256 vi4x13579BDF = _mm256_setzero_ps();
+    __m256 vi5x13579BDF = _mm256_setzero_ps();
+    __m256 vi6x13579BDF = _mm256_setzero_ps();
+    __m256 vi7x13579BDF = _mm256_setzero_ps();
+    __m256 vi8x13579BDF = _mm256_setzero_ps();
+
+    const __m256 vi0xGHIJKLMN = _mm256_loadu_ps(i0);
+    const __m256 vi1xGHIJKLMN = _mm256_loadu_ps(i1);
+    const __m256 vi2xGHIJKLMN = _mm256_loadu_ps(i2);
+    const __m256 vi3xGHIJKLMN = _mm256_loadu_ps(i3);
+    const __m256 vi4xGHIJKLMN = _mm256_loadu_ps(i4);
+    const __m256 vi5xGHIJKLMN = _mm256_loadu_ps(i5);
+    const __m256 vi6xGHIJKLMN = _mm256_loadu_ps(i6);
+    const __m256 vi7xGHIJKLMN = _mm256_loadu_ps(i7);
+    const __m256 vi8xGHIJKLMN = _mm256_loadu_ps(i8);
+    __m256 vi0xOPQRSTUV = _mm256_setzero_ps();
+    __m256 vi1xOPQRSTUV = _mm256_setzero_ps();
+    __m256 vi2xOPQRSTUV = _mm256_setzero_ps();
+    __m256 vi3xOPQRSTUV = _mm256_setzero_ps();
+    __m256 vi4xOPQRSTUV = _mm256_setzero_ps();
+    __m256 vi5xOPQRSTUV = _mm256_setzero_ps();
+    __m256 vi6xOPQRSTUV = _mm256_setzero_ps();
+    __m256 vi7xOPQRSTUV = _mm256_setzero_ps();
+    __m256 vi8xOPQRSTUV = _mm256_setzero_ps();
+    if XNN_LIKELY(input_width > 8 * sizeof(float)) {
+      vi0xOPQRSTUV = _mm256_loadu_ps(i0 + 8);
+      vi1xOPQRSTUV = _mm256_loadu_ps(i1 + 8);
+      vi2xOPQRSTUV = _mm256_loadu_ps(i2 + 8);
+      vi3xOPQRSTUV = _mm256_loadu_ps(i3 + 8);
+      vi4xOPQRSTUV = _mm256_loadu_ps(i4 + 8);
+      vi5xOPQRSTUV = _mm256_loadu_ps(i5 + 8);
+      vi6xOPQRSTUV = _mm256_loadu_ps(i6 + 8);
+      vi7xOPQRSTUV = _mm256_loadu_ps(i7 + 8);
+      vi8xOPQRSTUV = _mm256_loadu_ps(i8 + 8);
+    }
+    i0 += 16;
+    i1 += 16;
+    i2 += 16;
+    i3 += 16;
+    i4 += 16;
+    i5 += 16;
+    i6 += 16;
+    i7 += 16;
+    i8 += 16;
+
+    const __m256 vi0xGHIJOPQR = _mm256_permute2f128_ps(vi0xGHIJKLMN, vi0xOPQRSTUV, 0x20);
+    const __m256 vi0xKLMNSTUV = _mm256_permute2f128_ps(vi0xGHIJKLMN, vi0xOPQRSTUV, 0x31);
+    const __m256 vi1xGHIJOPQR = _mm256_permute2f128_ps(vi1xGHIJKLMN, vi1xOPQRSTUV, 0x20);
+    const __m256 vi1xKLMNSTUV = _mm256_permute2f128_ps(vi1xGHIJKLMN, vi1xOPQRSTUV, 0x31);
+    const __m256 vi2xGHIJOPQR = _mm256_permute2f128_ps(vi2xGHIJKLMN, vi2xOPQRSTUV, 0x20);
+    const __m256 vi2xKLMNSTUV = _mm256_permute2f128_ps(vi2xGHIJKLMN, vi2xOPQRSTUV, 0x31);
+    const __m256 vi3xGHIJOPQR = _mm256_permute2f128_ps(vi3xGHIJKLMN, vi3xOPQRSTUV, 0x20);
+    const __m256 vi3xKLMNSTUV = _mm256_permute2f128_ps(vi3xGHIJKLMN, vi3xOPQRSTUV, 0x31);
+    const __m256 vi4xGHIJOPQR = _mm256_permute2f128_ps(vi4xGHIJKLMN, vi4xOPQRSTUV, 0x20);
+    const __m256 vi4xKLMNSTUV = _mm256_permute2f128_ps(vi4xGHIJKLMN, vi4xOPQRSTUV, 0x31);
+    const __m256 vi5xGHIJOPQR = _mm256_permute2f128_ps(vi5xGHIJKLMN, vi5xOPQRSTUV, 0x20);
+    const __m256 vi5xKLMNSTUV = _mm256_permute2f128_ps(vi5xGHIJKLMN, vi5xOPQRSTUV, 0x31);
+    const __m256 vi6xGHIJOPQR = _mm256_permute2f128_ps(vi6xGHIJKLMN, vi6xOPQRSTUV, 0x20);
+    const __m256 vi6xKLMNSTUV = _mm256_permute2f128_ps(vi6xGHIJKLMN, vi6xOPQRSTUV, 0x31);
+    const __m256 vi7xGHIJOPQR = _mm256_permute2f128_ps(vi7xGHIJKLMN, vi7xOPQRSTUV, 0x20);
+    const __m256 vi7xKLMNSTUV = _mm256_permute2f128_ps(vi7xGHIJKLMN, vi7xOPQRSTUV, 0x31);
+    const __m256 vi8xGHIJOPQR = _mm256_permute2f128_ps(vi8xGHIJKLMN, vi8xOPQRSTUV, 0x20);
+    const __m256 vi8xKLMNSTUV = _mm256_permute2f128_ps(vi8xGHIJKLMN, vi8xOPQRSTUV, 0x31);
+
+    __m256 vi0xGIKMOQSU = _mm256_shuffle_ps(vi0xGHIJOPQR, vi0xKLMNSTUV, _MM_SHUFFLE(2, 0, 2, 0));
+    __m256 vi0xHJLNPRTV = _mm256_shuffle_ps(vi0xGHIJOPQR, vi0xKLMNSTUV, _MM_SHUFFLE(3, 1, 3, 1));
+    __m256 vi1xGIKMOQSU = _mm256_shuffle_ps(vi1xGHIJOPQR, vi1xKLMNSTUV, _MM_SHUFFLE(2, 0, 2, 0));
+    __m256 vi1xHJLNPRTV = _mm256_shuffle_ps(vi1xGHIJOPQR, vi1xKLMNSTUV, _MM_SHUFFLE(3, 1, 3, 1));
+    __m256 vi2xGIKMOQSU = _mm256_shuffle_ps(vi2xGHIJOPQR, vi2xKLMNSTUV, _MM_SHUFFLE(2, 0, 2, 0));
+    __m256 vi2xHJLNPRTV = _mm256_shuffle_ps(vi2xGHIJOPQR, vi2xKLMNSTUV, _MM_SHUFFLE(3, 1, 3, 1));
+    __m256 vi3xGIKMOQSU = _mm256_shuffle_ps(vi3xGHIJOPQR, vi3xKLMNSTUV, _MM_SHUFFLE(2, 0, 2, 0));
+    __m256 vi3xHJLNPRTV = _mm256_shuffle_ps(vi3xGHIJOPQR, vi3xKLMNSTUV, _MM_SHUFFLE(3, 1, 3, 1));
+    __m256 vi4xGIKMOQSU = _mm256_shuffle_ps(vi4xGHIJOPQR, vi4xKLMNSTUV, _MM_SHUFFLE(2, 0, 2, 0));
+    __m256 vi4xHJLNPRTV = _mm256_shuffle_ps(vi4xGHIJOPQR, vi4xKLMNSTUV, _MM_SHUFFLE(3, 1, 3, 1));
+    __m256 vi5xGIKMOQSU = _mm256_shuffle_ps(vi5xGHIJOPQR, vi5xKLMNSTUV, _MM_SHUFFLE(2, 0, 2, 0));
+    __m256 vi5xHJLNPRTV = _mm256_shuffle_ps(vi5xGHIJOPQR, vi5xKLMNSTUV, _MM_SHUFFLE(3, 1, 3, 1));
+    __m256 vi6xGIKMOQSU = _mm256_shuffle_ps(vi6xGHIJOPQR, vi6xKLMNSTUV, _MM_SHUFFLE(2, 0, 2, 0));
+    __m256 vi6xHJLNPRTV = _mm256_shuffle_ps(vi6xGHIJOPQR, vi6xKLMNSTUV, _MM_SHUFFLE(3, 1, 3, 1));
+    __m256 vi7xGIKMOQSU = _mm256_shuffle_ps(vi7xGHIJOPQR, vi7xKLMNSTUV, _MM_SHUFFLE(2, 0, 2, 0));
+    __m256 vi7xHJLNPRTV = _mm256_shuffle_ps(vi7xGHIJOPQR, vi7xKLMNSTUV, _MM_SHUFFLE(3, 1, 3, 1));
+    __m256 vi8xGIKMOQSU = _mm256_shuffle_ps(vi8xGHIJOPQR, vi8xKLMNSTUV, _MM_SHUFFLE(2, 0, 2, 0));
+    __m256 vi8xHJLNPRTV = _mm256_shuffle_ps(vi8xGHIJOPQR, vi8xKLMNSTUV, _MM_SHUFFLE(3, 1, 3, 1));
+
+    size_t w = input_width;
+    for (; w > 32 * sizeof(float); w -= 16 * sizeof(float)) {
+      __m256 vo0p0 = _mm256_add_ps(vbias, _mm256_mul_ps(vi0xGIKMOQSU, vk02));
+      __m256 vo1p0 = _mm256_add_ps(vbias, _mm256_mul_ps(vi2xGIKMOQSU, vk02));
+      __m256 vo2p0 = _mm256_add_ps(vbias, _mm256_mul_ps(vi4xGIKMOQSU, vk02));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi1xGIKMOQSU, vk12));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi3xGIKMOQSU, vk12));
+      vo2p0 = _mm256_add_ps(vo2p0, _mm256_mul_ps(vi5xGIKMOQSU, vk12));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi2xGIKMOQSU, vk22));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi4xGIKMOQSU, vk22));
+      vo2p0 = _mm256_add_ps(vo2p0, _mm256_mul_ps(vi6xGIKMOQSU, vk22));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi3xGIKMOQSU, vk32));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi5xGIKMOQSU, vk32));
+      vo2p0 = _mm256_add_ps(vo2p0, _mm256_mul_ps(vi7xGIKMOQSU, vk32));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi4xGIKMOQSU, vk42));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi6xGIKMOQSU, vk42));
+      vo2p0 = _mm256_add_ps(vo2p0, _mm256_mul_ps(vi8xGIKMOQSU, vk42));
+
+      const __m256 vi0xWXYZabcd = _mm256_loadu_ps(i0);
+      const __m256 vi0xefghijkl = _mm256_loadu_ps(i0 + 8);
+      i0 += 16;
+      const __m256 vi1xWXYZabcd = _mm256_loadu_ps(i1);
+      const __m256 vi1xefghijkl = _mm256_loadu_ps(i1 + 8);
+      i1 += 16;
+      const __m256 vi2xWXYZabcd = _mm256_loadu_ps(i2);
+      const __m256 vi2xefghijkl = _mm256_loadu_ps(i2 + 8);
+      i2 += 16;
+      const __m256 vi3xWXYZabcd = _mm256_loadu_ps(i3);
+      const __m256 vi3xefghijkl = _mm256_loadu_ps(i3 + 8);
+      i3 += 16;
+      const __m256 vi4xWXYZabcd = _mm256_loadu_ps(i4);
+      const __m256 vi4xefghijkl = _mm256_loadu_ps(i4 + 8);
+      i4 += 16;
+      const __m256 vi5xWXYZabcd = _mm256_loadu_ps(i5);
+      const __m256 vi5xefghijkl = _mm256_loadu_ps(i5 + 8);
+      i5 += 16;
+      const __m256 vi6xWXYZabcd = _mm256_loadu_ps(i6);
+      const __m256 vi6xefghijkl = _mm256_loadu_ps(i6 + 8);
+      i6 += 16;
+      const __m256 vi7xWXYZabcd = _mm256_loadu_ps(i7);
+      const __m256 vi7xefghijkl = _mm256_loadu_ps(i7 + 8);
+      i7 += 16;
+      const __m256 vi8xWXYZabcd = _mm256_loadu_ps(i8);
+      const __m256 vi8xefghijkl = _mm256_loadu_ps(i8 + 8);
+      i8 += 16;
+
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi0xHJLNPRTV, vk03));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi2xHJLNPRTV, vk03));
+      vo2p0 = _mm256_add_ps(vo2p0, _mm256_mul_ps(vi4xHJLNPRTV, vk03));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi1xHJLNPRTV, vk13));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi3xHJLNPRTV, vk13));
+      vo2p0 = _mm256_add_ps(vo2p0, _mm256_mul_ps(vi5xHJLNPRTV, vk13));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi2xHJLNPRTV, vk23));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi4xHJLNPRTV, vk23));
+      vo2p0 = _mm256_add_ps(vo2p0, _mm256_mul_ps(vi6xHJLNPRTV, vk23));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi3xHJLNPRTV, vk33));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi5xHJLNPRTV, vk33));
+      vo2p0 = _mm256_add_ps(vo2p0, _mm256_mul_ps(vi7xHJLNPRTV, vk33));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi4xHJLNPRTV, vk43));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi6xHJLNPRTV, vk43));
+      vo2p0 = _mm256_add_ps(vo2p0, _mm256_mul_ps(vi8xHJLNPRTV, vk43));
+
+      const __m256 vi0x8ACEGIKM = _mm256_permute2f128_ps(vi0x02468ACE, vi0xGIKMOQSU, 0x21);
+      vi0x02468ACE = vi0xGIKMOQSU;
+      const __m256 vi1x8ACEGIKM = _mm256_permute2f128_ps(vi1x02468ACE, vi1xGIKMOQSU, 0x21);
+      vi1x02468ACE = vi1xGIKMOQSU;
+      const __m256 vi2x8ACEGIKM = _mm256_permute2f128_ps(vi2x02468ACE, vi2xGIKMOQSU, 0x21);
+      vi2x02468ACE = vi2xGIKMOQSU;
+      const __m256 vi3x8ACEGIKM = _mm256_permute2f128_ps(vi3x02468ACE, vi3xGIKMOQSU, 0x21);
+      vi3x02468ACE = vi3xGIKMOQSU;
+      const __m256 vi4x8ACEGIKM = _mm256_permute2f128_ps(vi4x02468ACE, vi4xGIKMOQSU, 0x21);
+      vi4x02468ACE = vi4xGIKMOQSU;
+      const __m256 vi5x8ACEGIKM = _mm256_permute2f128_ps(vi5x02468ACE, vi5xGIKMOQSU, 0x21);
+      vi5x02468ACE = vi5xGIKMOQSU;
+      const __m256 vi6x8ACEGIKM = _mm256_permute2f128_ps(vi6x02468ACE, vi6xGIKMOQSU, 0x21);
+      vi6x02468ACE = vi6xGIKMOQSU;
+      const __m256 vi7x8ACEGIKM = _mm256_permute2f128_ps(vi7x02468ACE, vi7xGIKMOQSU, 0x21);
+      vi7x02468ACE = vi7xGIKMOQSU;
+      const __m256 vi8x8ACEGIKM = _mm256_permute2f128_ps(vi8x02468ACE, vi8xGIKMOQSU, 0x21);
+      vi8x02468ACE = vi8xGIKMOQSU;
+
+      const __m256 vi0xEGIKMOQS = _mm256_permute_ps(_mm256_blend_ps(vi0xGIKMOQSU, vi0x8ACEGIKM, 0x88), _MM_SHUFFLE(2, 1, 0, 3));
+      const __m256 vi1xEGIKMOQS = _mm256_permute_ps(_mm256_blend_ps(vi1xGIKMOQSU, vi1x8ACEGIKM, 0x88), _MM_SHUFFLE(2, 1, 0, 3));
+      const __m256 vi2xEGIKMOQS = _mm256_permute_ps(_mm256_blend_ps(vi2xGIKMOQSU, vi2x8ACEGIKM, 0x88), _MM_SHUFFLE(2, 1, 0, 3));
+      const __m256 vi3xEGIKMOQS = _mm256_permute_ps(_mm256_blend_ps(vi3xGIKMOQSU, vi3x8ACEGIKM, 0x88), _MM_SHUFFLE(2, 1, 0, 3));
+      const __m256 vi4xEGIKMOQS = _mm256_permute_ps(_mm256_blend_ps(vi4xGIKMOQSU, vi4x8ACEGIKM, 0x88), _MM_SHUFFLE(2, 1, 0, 3));
+      const __m256 vi5xEGIKMOQS = _mm256_permute_ps(_mm256_blend_ps(vi5xGIKMOQSU, vi5x8ACEGIKM, 0x88), _MM_SHUFFLE(2, 1, 0, 3));
+      const __m256 vi6xEGIKMOQS = _mm256_permute_ps(_mm256_blend_ps(vi6xGIKMOQSU, vi6x8ACEGIKM, 0x88), _MM_SHUFFLE(2, 1, 0, 3));
+      const __m256 vi7xEGIKMOQS = _mm256_permute_ps(_mm256_blend_ps(vi7xGIKMOQSU, vi7x8ACEGIKM, 0x88), _MM_SHUFFLE(2, 1, 0, 3));
+      const __m256 vi8xEGIKMOQS = _mm256_permute_ps(_mm256_blend_ps(vi8xGIKMOQSU, vi8x8ACEGIKM, 0x88), _MM_SHUFFLE(2, 1, 0, 3));
+
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi0xEGIKMOQS, vk00));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi2xEGIKMOQS, vk00));
+      vo2p0 = _mm256_add_ps(vo2p0, _mm256_mul_ps(vi4xEGIKMOQS, vk00));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi1xEGIKMOQS, vk10));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi3xEGIKMOQS, vk10));
+      vo2p0 = _mm256_add_ps(vo2p0, _mm256_mul_ps(vi5xEGIKMOQS, vk10));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi2xEGIKMOQS, vk20));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi4xEGIKMOQS, vk20));
+      vo2p0 = _mm256_add_ps(vo2p0, _mm256_mul_ps(vi6xEGIKMOQS, vk20));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi3xEGIKMOQS, vk30));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi5xEGIKMOQS, vk30));
+      vo2p0 = _mm256_add_ps(vo2p0, _mm256_mul_ps(vi7xEGIKMOQS, vk30));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi4xEGIKMOQS, vk40));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi6xEGIKMOQS, vk40));
+      vo2p0 = _mm256_add_ps(vo2p0, _mm256_mul_ps(vi8xEGIKMOQS, vk40));
+
+      const __m256 vi0x9BDFHJLN = _mm256_permute2f128_ps(vi0x13579BDF, vi0xHJLNPRTV, 0x21);
+      vi0x13579BDF = vi0xHJLNPRTV;
+      const __m256 vi1x9BDFHJLN = _mm256_permute2f128_ps(vi1x13579BDF, vi1xHJLNPRTV, 0x21);
+      vi1x13579BDF = vi1xHJLNPRTV;
+      const __m256 vi2x9BDFHJLN = _mm256_permute2f128_ps(vi2x13579BDF, vi2xHJLNPRTV, 0x21);
+      vi2x13579BDF = vi2xHJLNPRTV;
+      const __m256 vi3x9BDFHJLN = _mm256_permute2f128_ps(vi3x13579BDF, vi3xHJLNPRTV, 0x21);
+      vi3x13579BDF = vi3xHJLNPRTV;
+      const __m256 vi4x9BDFHJLN = _mm256_permute2f128_ps(vi4x13579BDF, vi4xHJLNPRTV, 0x21);
+      vi4x13579BDF = vi4xHJLNPRTV;
+      const __m256 vi5x9BDFHJLN = _mm256_permute2f128_ps(vi5x13579BDF, vi5xHJLNPRTV, 0x21);
+      vi5x13579BDF = vi5xHJLNPRTV;
+      const __m256 vi6x9BDFHJLN = _mm256_permute2f128_ps(vi6x13579BDF, vi6xHJLNPRTV, 0x21);
+      vi6x13579BDF = vi6xHJLNPRTV;
+      const __m256 vi7x9BDFHJLN = _mm256_permute2f128_ps(vi7x13579BDF, vi7xHJLNPRTV, 0x21);
+      vi7x13579BDF = vi7xHJLNPRTV;
+      const __m256 vi8x9BDFHJLN = _mm256_permute2f128_ps(vi8x13579BDF, vi8xHJLNPRTV, 0x21);
+      vi8x13579BDF = vi8xHJLNPRTV;
+
+      const __m256 vi0xFHJLNPRT = _mm256_permute_ps(_mm256_blend_ps(vi0xHJLNPRTV, vi0x9BDFHJLN, 0x88), _MM_SHUFFLE(2, 1, 0, 3));
+      const __m256 vi1xFHJLNPRT = _mm256_permute_ps(_mm256_blend_ps(vi1xHJLNPRTV, vi1x9BDFHJLN, 0x88), _MM_SHUFFLE(2, 1, 0, 3));
+      const __m256 vi2xFHJLNPRT = _mm256_permute_ps(_mm256_blend_ps(vi2xHJLNPRTV, vi2x9BDFHJLN, 0x88), _MM_SHUFFLE(2, 1, 0, 3));
+      const __m256 vi3xFHJLNPRT = _mm256_permute_ps(_mm256_blend_ps(vi3xHJLNPRTV, vi3x9BDFHJLN, 0x88), _MM_SHUFFLE(2, 1, 0, 3));
+      const __m256 vi4xFHJLNPRT = _mm256_permute_ps(_mm256_blend_ps(vi4xHJLNPRTV, vi4x9BDFHJLN, 0x88), _MM_SHUFFLE(2, 1, 0, 3));
+      const __m256 vi5xFHJLNPRT = _mm256_permute_ps(_mm256_blend_ps(vi5xHJLNPRTV, vi5x9BDFHJLN, 0x88), _MM_SHUFFLE(2, 1, 0, 3));
+      const __m256 vi6xFHJLNPRT = _mm256_permute_ps(_mm256_blend_ps(vi6xHJLNPRTV, vi6x9BDFHJLN, 0x88), _MM_SHUFFLE(2, 1, 0, 3));
+      const __m256 vi7xFHJLNPRT = _mm256_permute_ps(_mm256_blend_ps(vi7xHJLNPRTV, vi7x9BDFHJLN, 0x88), _MM_SHUFFLE(2, 1, 0, 3));
+      const __m256 vi8xFHJLNPRT = _mm256_permute_ps(_mm256_blend_ps(vi8xHJLNPRTV, vi8x9BDFHJLN, 0x88), _MM_SHUFFLE(2, 1, 0, 3));
+
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi0xFHJLNPRT, vk01));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi2xFHJLNPRT, vk01));
+      vo2p0 = _mm256_add_ps(vo2p0, _mm256_mul_ps(vi4xFHJLNPRT, vk01));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi1xFHJLNPRT, vk11));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi3xFHJLNPRT, vk11));
+      vo2p0 = _mm256_add_ps(vo2p0, _mm256_mul_ps(vi5xFHJLNPRT, vk11));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi2xFHJLNPRT, vk21));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi4xFHJLNPRT, vk21));
+      vo2p0 = _mm256_add_ps(vo2p0, _mm256_mul_ps(vi6xFHJLNPRT, vk21));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi3xFHJLNPRT, vk31));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi5xFHJLNPRT, vk31));
+      vo2p0 = _mm256_add_ps(vo2p0, _mm256_mul_ps(vi7xFHJLNPRT, vk31));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi4xFHJLNPRT, vk41));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi6xFHJLNPRT, vk41));
+      vo2p0 = _mm256_add_ps(vo2p0, _mm256_mul_ps(vi8xFHJLNPRT, vk41));
+
+      const __m256 vi0xWXYZefgh = _mm256_permute2f128_ps(vi0xWXYZabcd, vi0xefghijkl, 0x20);
+      const __m256 vi0xabcdijkl = _mm256_permute2f128_ps(vi0xWXYZabcd, vi0xefghijkl, 0x31);
+      const __m256 vi1xWXYZefgh = _mm256_permute2f128_ps(vi1xWXYZabcd, vi1xefghijkl, 0x20);
+      const __m256 vi1xabcdijkl = _mm256_permute2f128_ps(vi1xWXYZabcd, vi1xefghijkl, 0x31);
+      const __m256 vi2xWXYZefgh = _mm256_permute2f128_ps(vi2xWXYZabcd, vi2xefghijkl, 0x20);
+      const __m256 vi2xabcdijkl = _mm256_permute2f128_ps(vi2xWXYZabcd, vi2xefghijkl, 0x31);
+      const __m256 vi3xWXYZefgh = _mm256_permute2f128_ps(vi3xWXYZabcd, vi3xefghijkl, 0x20);
+      const __m256 vi3xabcdijkl = _mm256_permute2f128_ps(vi3xWXYZabcd, vi3xefghijkl, 0x31);
+      const __m256 vi4xWXYZefgh = _mm256_permute2f128_ps(vi4xWXYZabcd, vi4xefghijkl, 0x20);
+      const __m256 vi4xabcdijkl = _mm256_permute2f128_ps(vi4xWXYZabcd, vi4xefghijkl, 0x31);
+      const __m256 vi5xWXYZefgh = _mm256_permute2f128_ps(vi5xWXYZabcd, vi5xefghijkl, 0x20);
+      const __m256 vi5xabcdijkl = _mm256_permute2f128_ps(vi5xWXYZabcd, vi5xefghijkl, 0x31);
+      const __m256 vi6xWXYZefgh = _mm256_permute2f128_ps(vi6xWXYZabcd, vi6xefghijkl, 0x20);
+      const __m256 vi6xabcdijkl = _mm256_permute2f128_ps(vi6xWXYZabcd, vi6xefghijkl, 0x31);
+      const __m256 vi7xWXYZefgh = _mm256_permute2f128_ps(vi7xWXYZabcd, vi7xefghijkl, 0x20);
+      const __m256 vi7xabcdijkl = _mm256_permute2f128_ps(vi7xWXYZabcd, vi7xefghijkl, 0x31);
+      const __m256 vi8xWXYZefgh = _mm256_permute2f128_ps(vi8xWXYZabcd, vi8xefghijkl, 0x20);
+      const __m256 vi8xabcdijkl = _mm256_permute2f128_ps(vi8xWXYZabcd, vi8xefghijkl, 0x31);
+
+      const __m256 vi0xWYacegik = _mm256_shuffle_ps(vi0xWXYZefgh, vi0xabcdijkl, _MM_SHUFFLE(2, 0, 2, 0));
+      const __m256 vi0xXZbdfhjl = _mm256_shuffle_ps(vi0xWXYZefgh, vi0xabcdijkl, _MM_SHUFFLE(3, 1, 3, 1));
+      const __m256 vi1xWYacegik = _mm256_shuffle_ps(vi1xWXYZefgh, vi1xabcdijkl, _MM_SHUFFLE(2, 0, 2, 0));
+      const __m256 vi1xXZbdfhjl = _mm256_shuffle_ps(vi1xWXYZefgh, vi1xabcdijkl, _MM_SHUFFLE(3, 1, 3, 1));
+      const __m256 vi2xWYacegik = _mm256_shuffle_ps(vi2xWXYZefgh, vi2xabcdijkl, _MM_SHUFFLE(2, 0, 2, 0));
+      const __m256 vi2xXZbdfhjl = _mm256_shuffle_ps(vi2xWXYZefgh, vi2xabcdijkl, _MM_SHUFFLE(3, 1, 3, 1));
+      const __m256 vi3xWYacegik = _mm256_shuffle_ps(vi3xWXYZefgh, vi3xabcdijkl, _MM_SHUFFLE(2, 0, 2, 0));
+      const __m256 vi3xXZbdfhjl = _mm256_shuffle_ps(vi3xWXYZefgh, vi3xabcdijkl, _MM_SHUFFLE(3, 1, 3, 1));
+      const __m256 vi4xWYacegik = _mm256_shuffle_ps(vi4xWXYZefgh, vi4xabcdijkl, _MM_SHUFFLE(2, 0, 2, 0));
+      const __m256 vi4xXZbdfhjl = _mm256_shuffle_ps(vi4xWXYZefgh, vi4xabcdijkl, _MM_SHUFFLE(3, 1, 3, 1));
+      const __m256 vi5xWYacegik = _mm256_shuffle_ps(vi5xWXYZefgh, vi5xabcdijkl, _MM_SHUFFLE(2, 0, 2, 0));
+      const __m256 vi5xXZbdfhjl = _mm256_shuffle_ps(vi5xWXYZefgh, vi5xabcdijkl, _MM_SHUFFLE(3, 1, 3, 1));
+      const __m256 vi6xWYacegik = _mm256_shuffle_ps(vi6xWXYZefgh, vi6xabcdijkl, _MM_SHUFFLE(2, 0, 2, 0));
+      const __m256 vi6xXZbdfhjl = _mm256_shuffle_ps(vi6xWXYZefgh, vi6xabcdijkl, _MM_SHUFFLE(3, 1, 3, 1));
+      const __m256 vi7xWYacegik = _mm256_shuffle_ps(vi7xWXYZefgh, vi7xabcdijkl, _MM_SHUFFLE(2, 0, 2, 0));
+      const __m256 vi7xXZbdfhjl = _mm256_shuffle_ps(vi7xWXYZefgh, vi7xabcdijkl, _MM_SHUFFLE(3, 1, 3, 1));
+      const __m256 vi8xWYacegik = _mm256_shuffle_ps(vi8xWXYZefgh, vi8xabcdijkl, _MM_SHUFFLE(2, 0, 2, 0));
+      const __m256 vi8xXZbdfhjl = _mm256_shuffle_ps(vi8xWXYZefgh, vi8xabcdijkl, _MM_SHUFFLE(3, 1, 3, 1));
+
+      const __m256 vi0xOQSUWYac = _mm256_permute2f128_ps(vi0xGIKMOQSU, vi0xWYacegik, 0x21);
+      const __m256 vi1xOQSUWYac = _mm256_permute2f128_ps(vi1xGIKMOQSU, vi1xWYacegik, 0x21);
+      const __m256 vi2xOQSUWYac = _mm256_permute2f128_ps(vi2xGIKMOQSU, vi2xWYacegik, 0x21);
+      const __m256 vi3xOQSUWYac = _mm256_permute2f128_ps(vi3xGIKMOQSU, vi3xWYacegik, 0x21);
+      const __m256 vi4xOQSUWYac = _mm256_permute2f128_ps(vi4xGIKMOQSU, vi4xWYacegik, 0x21);
+      const __m256 vi5xOQSUWYac = _mm256_permute2f128_ps(vi5xGIKMOQSU, vi5xWYacegik, 0x21);
+      const __m256 vi6xOQSUWYac = _mm256_permute2f128_ps(vi6xGIKMOQSU, vi6xWYacegik, 0x21);
+      const __m256 vi7xOQSUWYac = _mm256_permute2f128_ps(vi7xGIKMOQSU, vi7xWYacegik, 0x21);
+      const __m256 vi8xOQSUWYac = _mm256_permute2f128_ps(vi8xGIKMOQSU, vi8xWYacegik, 0x21);
+
+      const __m256 vi0xIKMOQSUW = _mm256_permute_ps(_mm256_blend_ps(vi0xGIKMOQSU, vi0xOQSUWYac, 0x11), _MM_SHUFFLE(0, 3, 2, 1));
+      vi0xGIKMOQSU = vi0xWYacegik;
+      vi0xHJLNPRTV = vi0xXZbdfhjl;
+      const __m256 vi1xIKMOQSUW = _mm256_permute_ps(_mm256_blend_ps(vi1xGIKMOQSU, vi1xOQSUWYac, 0x11), _MM_SHUFFLE(0, 3, 2, 1));
+      vi1xGIKMOQSU = vi1xWYacegik;
+      vi1xHJLNPRTV = vi1xXZbdfhjl;
+      const __m256 vi2xIKMOQSUW = _mm256_permute_ps(_mm256_blend_ps(vi2xGIKMOQSU, vi2xOQSUWYac, 0x11), _MM_SHUFFLE(0, 3, 2, 1));
+      vi2xGIKMOQSU = vi2xWYacegik;
+      vi2xHJLNPRTV = vi2xXZbdfhjl;
+      const __m256 vi3xIKMOQSUW = _mm256_permute_ps(_mm256_blend_ps(vi3xGIKMOQSU, vi3xOQSUWYac, 0x11), _MM_SHUFFLE(0, 3, 2, 1));
+      vi3xGIKMOQSU = vi3xWYacegik;
+      vi3xHJLNPRTV = vi3xXZbdfhjl;
+      const __m256 vi4xIKMOQSUW = _mm256_permute_ps(_mm256_blend_ps(vi4xGIKMOQSU, vi4xOQSUWYac, 0x11), _MM_SHUFFLE(0, 3, 2, 1));
+      vi4xGIKMOQSU = vi4xWYacegik;
+      vi4xHJLNPRTV = vi4xXZbdfhjl;
+      const __m256 vi5xIKMOQSUW = _mm256_permute_ps(_mm256_blend_ps(vi5xGIKMOQSU, vi5xOQSUWYac, 0x11), _MM_SHUFFLE(0, 3, 2, 1));
+      vi5xGIKMOQSU = vi5xWYacegik;
+      vi5xHJLNPRTV = vi5xXZbdfhjl;
+      const __m256 vi6xIKMOQSUW = _mm256_permute_ps(_mm256_blend_ps(vi6xGIKMOQSU, vi6xOQSUWYac, 0x11), _MM_SHUFFLE(0, 3, 2, 1));
+      vi6xGIKMOQSU = vi6xWYacegik;
+      vi6xHJLNPRTV = vi6xXZbdfhjl;
+      const __m256 vi7xIKMOQSUW = _mm256_permute_ps(_mm256_blend_ps(vi7xGIKMOQSU, vi7xOQSUWYac, 0x11), _MM_SHUFFLE(0, 3, 2, 1));
+      vi7xGIKMOQSU = vi7xWYacegik;
+      vi7xHJLNPRTV = vi7xXZbdfhjl;
+      const __m256 vi8xIKMOQSUW = _mm256_permute_ps(_mm256_blend_ps(vi8xGIKMOQSU, vi8xOQSUWYac, 0x11), _MM_SHUFFLE(0, 3, 2, 1));
+      vi8xGIKMOQSU = vi8xWYacegik;
+      vi8xHJLNPRTV = vi8xXZbdfhjl;
+
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi0xIKMOQSUW, vk04));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi2xIKMOQSUW, vk04));
+      vo2p0 = _mm256_add_ps(vo2p0, _mm256_mul_ps(vi4xIKMOQSUW, vk04));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi1xIKMOQSUW, vk14));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi3xIKMOQSUW, vk14));
+      vo2p0 = _mm256_add_ps(vo2p0, _mm256_mul_ps(vi5xIKMOQSUW, vk14));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi2xIKMOQSUW, vk24));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi4xIKMOQSUW, vk24));
+      vo2p0 = _mm256_add_ps(vo2p0, _mm256_mul_ps(vi6xIKMOQSUW, vk24));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi3xIKMOQSUW, vk34));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi5xIKMOQSUW, vk34));
+      vo2p0 = _mm256_add_ps(vo2p0, _mm256_mul_ps(vi7xIKMOQSUW, vk34));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi4xIKMOQSUW, vk44));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi6xIKMOQSUW, vk44));
+      vo2p0 = _mm256_add_ps(vo2p0, _mm256_mul_ps(vi8xIKMOQSUW, vk44));
+
+
+      __m256 vo0 = _mm256_max_ps(vo0p0, vmin);
+      __m256 vo1 = _mm256_max_ps(vo1p0, vmin);
+      __m256 vo2 = _mm256_max_ps(vo2p0, vmin);
+
+      vo0 = _mm256_min_ps(vo0, vmax);
+      vo1 = _mm256_min_ps(vo1, vmax);
+      vo2 = _mm256_min_ps(vo2, vmax);
+
+      _mm256_storeu_ps(o2, vo2);
+      o2 += 8;
+      _mm256_storeu_ps(o1, vo1);
+      o1 += 8;
+      _mm256_storeu_ps(o0, vo0);
+      o0 += 8;
+    }
+    // Process the next-to-last block, loading only the part of the last block that lies within the row.
+    if XNN_LIKELY(w > 16 * sizeof(float)) {
+      __m256 vo0p0 = _mm256_add_ps(vbias, _mm256_mul_ps(vi0xGIKMOQSU, vk02));
+      __m256 vo1p0 = _mm256_add_ps(vbias, _mm256_mul_ps(vi2xGIKMOQSU, vk02));
+      __m256 vo2p0 = _mm256_add_ps(vbias, _mm256_mul_ps(vi4xGIKMOQSU, vk02));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi1xGIKMOQSU, vk12));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi3xGIKMOQSU, vk12));
+      vo2p0 = _mm256_add_ps(vo2p0, _mm256_mul_ps(vi5xGIKMOQSU, vk12));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi2xGIKMOQSU, vk22));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi4xGIKMOQSU, vk22));
+      vo2p0 = _mm256_add_ps(vo2p0, _mm256_mul_ps(vi6xGIKMOQSU, vk22));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi3xGIKMOQSU, vk32));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi5xGIKMOQSU, vk32));
+      vo2p0 = _mm256_add_ps(vo2p0, _mm256_mul_ps(vi7xGIKMOQSU, vk32));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi4xGIKMOQSU, vk42));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi6xGIKMOQSU, vk42));
+      vo2p0 = _mm256_add_ps(vo2p0, _mm256_mul_ps(vi8xGIKMOQSU, vk42));
+
+      const __m256 vi0xWXYZabcd = _mm256_loadu_ps(i0);
+      const __m256 vi1xWXYZabcd = _mm256_loadu_ps(i1);
+      const __m256 vi2xWXYZabcd = _mm256_loadu_ps(i2);
+      const __m256 vi3xWXYZabcd = _mm256_loadu_ps(i3);
+      const __m256 vi4xWXYZabcd = _mm256_loadu_ps(i4);
+      const __m256 vi5xWXYZabcd = _mm256_loadu_ps(i5);
+      const __m256 vi6xWXYZabcd = _mm256_loadu_ps(i6);
+      const __m256 vi7xWXYZabcd = _mm256_loadu_ps(i7);
+      const __m256 vi8xWXYZabcd = _mm256_loadu_ps(i8);
+      __m256 vi0xefghijkl = _mm256_setzero_ps();
+      __m256 vi1xefghijkl = _mm256_setzero_ps();
+      __m256 vi2xefghijkl = _mm256_setzero_ps();
+      __m256 vi3xefghijkl = _mm256_setzero_ps();
+      __m256 vi4xefghijkl = _mm256_setzero_ps();
+      __m256 vi5xefghijkl = _mm256_setzero_ps();
+      __m256 vi6xefghijkl = _mm256_setzero_ps();
+      __m256 vi7xefghijkl = _mm256_setzero_ps();
+      __m256 vi8xefghijkl = _mm256_setzero_ps();
+      if (w > 24 * sizeof(float)) {
+        vi0xefghijkl = _mm256_loadu_ps(i0 + 8);
+        vi1xefghijkl = _mm256_loadu_ps(i1 + 8);
+        vi2xefghijkl = _mm256_loadu_ps(i2 + 8);
+        vi3xefghijkl = _mm256_loadu_ps(i3 + 8);
+        vi4xefghijkl = _mm256_loadu_ps(i4 + 8);
+        vi5xefghijkl = _mm256_loadu_ps(i5 + 8);
+        vi6xefghijkl = _mm256_loadu_ps(i6 + 8);
+        vi7xefghijkl = _mm256_loadu_ps(i7 + 8);
+        vi8xefghijkl = _mm256_loadu_ps(i8 + 8);
+      }
+      i0 += 16;
+      i1 += 16;
+      i2 += 16;
+      i3 += 16;
+      i4 += 16;
+      i5 += 16;
+      i6 += 16;
+      i7 += 16;
+      i8 += 16;
+
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi0xHJLNPRTV, vk03));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi2xHJLNPRTV, vk03));
+      vo2p0 = _mm256_add_ps(vo2p0, _mm256_mul_ps(vi4xHJLNPRTV, vk03));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi1xHJLNPRTV, vk13));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi3xHJLNPRTV, vk13));
+      vo2p0 = _mm256_add_ps(vo2p0, _mm256_mul_ps(vi5xHJLNPRTV, vk13));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi2xHJLNPRTV, vk23));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi4xHJLNPRTV, vk23));
+      vo2p0 = _mm256_add_ps(vo2p0, _mm256_mul_ps(vi6xHJLNPRTV, vk23));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi3xHJLNPRTV, vk33));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi5xHJLNPRTV, vk33));
+      vo2p0 = _mm256_add_ps(vo2p0, _mm256_mul_ps(vi7xHJLNPRTV, vk33));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi4xHJLNPRTV, vk43));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi6xHJLNPRTV, vk43));
+      vo2p0 = _mm256_add_ps(vo2p0, _mm256_mul_ps(vi8xHJLNPRTV, vk43));
+
+      const __m256 vi0x8ACEGIKM = _mm256_permute2f128_ps(vi0x02468ACE, vi0xGIKMOQSU, 0x21);
+      vi0x02468ACE = vi0xGIKMOQSU;
+      const __m256 vi1x8ACEGIKM = _mm256_permute2f128_ps(vi1x02468ACE, vi1xGIKMOQSU, 0x21);
+      vi1x02468ACE = vi1xGIKMOQSU;
+      const __m256 vi2x8ACEGIKM = _mm256_permute2f128_ps(vi2x02468ACE, vi2xGIKMOQSU, 0x21);
+      vi2x02468ACE = vi2xGIKMOQSU;
+      const __m256 vi3x8ACEGIKM = _mm256_permute2f128_ps(vi3x02468ACE, vi3xGIKMOQSU, 0x21);
+      vi3x02468ACE = vi3xGIKMOQSU;
+      const __m256 vi4x8ACEGIKM = _mm256_permute2f128_ps(vi4x02468ACE, vi4xGIKMOQSU, 0x21);
+      vi4x02468ACE = vi4xGIKMOQSU;
+      const __m256 vi5x8ACEGIKM = _mm256_permute2f128_ps(vi5x02468ACE, vi5xGIKMOQSU, 0x21);
+      vi5x02468ACE = vi5xGIKMOQSU;
+      const __m256 vi6x8ACEGIKM = _mm256_permute2f128_ps(vi6x02468ACE, vi6xGIKMOQSU, 0x21);
+      vi6x02468ACE = vi6xGIKMOQSU;
+      const __m256 vi7x8ACEGIKM = _mm256_permute2f128_ps(vi7x02468ACE, vi7xGIKMOQSU, 0x21);
+      vi7x02468ACE = vi7xGIKMOQSU;
+      const __m256 vi8x8ACEGIKM = _mm256_permute2f128_ps(vi8x02468ACE, vi8xGIKMOQSU, 0x21);
+      vi8x02468ACE = vi8xGIKMOQSU;
+
+      const __m256 vi0xEGIKMOQS = _mm256_permute_ps(_mm256_blend_ps(vi0xGIKMOQSU, vi0x8ACEGIKM, 0x88), _MM_SHUFFLE(2, 1, 0, 3));
+      const __m256 vi1xEGIKMOQS = _mm256_permute_ps(_mm256_blend_ps(vi1xGIKMOQSU, vi1x8ACEGIKM, 0x88), _MM_SHUFFLE(2, 1, 0, 3));
+      const __m256 vi2xEGIKMOQS = _mm256_permute_ps(_mm256_blend_ps(vi2xGIKMOQSU, vi2x8ACEGIKM, 0x88), _MM_SHUFFLE(2, 1, 0, 3));
+      const __m256 vi3xEGIKMOQS = _mm256_permute_ps(_mm256_blend_ps(vi3xGIKMOQSU, vi3x8ACEGIKM, 0x88), _MM_SHUFFLE(2, 1, 0, 3));
+      const __m256 vi4xEGIKMOQS = _mm256_permute_ps(_mm256_blend_ps(vi4xGIKMOQSU, vi4x8ACEGIKM, 0x88), _MM_SHUFFLE(2, 1, 0, 3));
+      const __m256 vi5xEGIKMOQS = _mm256_permute_ps(_mm256_blend_ps(vi5xGIKMOQSU, vi5x8ACEGIKM, 0x88), _MM_SHUFFLE(2, 1, 0, 3));
+      const __m256 vi6xEGIKMOQS = _mm256_permute_ps(_mm256_blend_ps(vi6xGIKMOQSU, vi6x8ACEGIKM, 0x88), _MM_SHUFFLE(2, 1, 0, 3));
+      const __m256 vi7xEGIKMOQS = _mm256_permute_ps(_mm256_blend_ps(vi7xGIKMOQSU, vi7x8ACEGIKM, 0x88), _MM_SHUFFLE(2, 1, 0, 3));
+      const __m256 vi8xEGIKMOQS = _mm256_permute_ps(_mm256_blend_ps(vi8xGIKMOQSU, vi8x8ACEGIKM, 0x88), _MM_SHUFFLE(2, 1, 0, 3));
+
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi0xEGIKMOQS, vk00));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi2xEGIKMOQS, vk00));
+      vo2p0 = _mm256_add_ps(vo2p0, _mm256_mul_ps(vi4xEGIKMOQS, vk00));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi1xEGIKMOQS, vk10));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi3xEGIKMOQS, vk10));
+      vo2p0 = _mm256_add_ps(vo2p0, _mm256_mul_ps(vi5xEGIKMOQS, vk10));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi2xEGIKMOQS, vk20));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi4xEGIKMOQS, vk20));
+      vo2p0 = _mm256_add_ps(vo2p0, _mm256_mul_ps(vi6xEGIKMOQS, vk20));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi3xEGIKMOQS, vk30));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi5xEGIKMOQS, vk30));
+      vo2p0 = _mm256_add_ps(vo2p0, _mm256_mul_ps(vi7xEGIKMOQS, vk30));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi4xEGIKMOQS, vk40));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi6xEGIKMOQS, vk40));
+      vo2p0 = _mm256_add_ps(vo2p0, _mm256_mul_ps(vi8xEGIKMOQS, vk40));
+
+      const __m256 vi0x9BDFHJLN = _mm256_permute2f128_ps(vi0x13579BDF, vi0xHJLNPRTV, 0x21);
+      vi0x13579BDF = vi0xHJLNPRTV;
+      const __m256 vi1x9BDFHJLN = _mm256_permute2f128_ps(vi1x13579BDF, vi1xHJLNPRTV, 0x21);
+      vi1x13579BDF = vi1xHJLNPRTV;
+      const __m256 vi2x9BDFHJLN = _mm256_permute2f128_ps(vi2x13579BDF, vi2xHJLNPRTV, 0x21);
+      vi2x13579BDF = vi2xHJLNPRTV;
+      const __m256 vi3x9BDFHJLN = _mm256_permute2f128_ps(vi3x13579BDF, vi3xHJLNPRTV, 0x21);
+      vi3x13579BDF = vi3xHJLNPRTV;
+      const __m256 vi4x9BDFHJLN = _mm256_permute2f128_ps(vi4x13579BDF, vi4xHJLNPRTV, 0x21);
+      vi4x13579BDF = vi4xHJLNPRTV;
+      const __m256 vi5x9BDFHJLN = _mm256_permute2f128_ps(vi5x13579BDF, vi5xHJLNPRTV, 0x21);
+      vi5x13579BDF = vi5xHJLNPRTV;
+      const __m256 vi6x9BDFHJLN = _mm256_permute2f128_ps(vi6x13579BDF, vi6xHJLNPRTV, 0x21);
+      vi6x13579BDF = vi6xHJLNPRTV;
+      const __m256 vi7x9BDFHJLN = _mm256_permute2f128_ps(vi7x13579BDF, vi7xHJLNPRTV, 0x21);
+      vi7x13579BDF = vi7xHJLNPRTV;
+      const __m256 vi8x9BDFHJLN = _mm256_permute2f128_ps(vi8x13579BDF, vi8xHJLNPRTV, 0x21);
+      vi8x13579BDF = vi8xHJLNPRTV;
+
+      const __m256 vi0xFHJLNPRT = _mm256_permute_ps(_mm256_blend_ps(vi0xHJLNPRTV, vi0x9BDFHJLN, 0x88), _MM_SHUFFLE(2, 1, 0, 3));
+      const __m256 vi1xFHJLNPRT = _mm256_permute_ps(_mm256_blend_ps(vi1xHJLNPRTV, vi1x9BDFHJLN, 0x88), _MM_SHUFFLE(2, 1, 0, 3));
+      const __m256 vi2xFHJLNPRT = _mm256_permute_ps(_mm256_blend_ps(vi2xHJLNPRTV, vi2x9BDFHJLN, 0x88), _MM_SHUFFLE(2, 1, 0, 3));
+      const __m256 vi3xFHJLNPRT = _mm256_permute_ps(_mm256_blend_ps(vi3xHJLNPRTV, vi3x9BDFHJLN, 0x88), _MM_SHUFFLE(2, 1, 0, 3));
+      const __m256 vi4xFHJLNPRT = _mm256_permute_ps(_mm256_blend_ps(vi4xHJLNPRTV, vi4x9BDFHJLN, 0x88), _MM_SHUFFLE(2, 1, 0, 3));
+      const __m256 vi5xFHJLNPRT = _mm256_permute_ps(_mm256_blend_ps(vi5xHJLNPRTV, vi5x9BDFHJLN, 0x88), _MM_SHUFFLE(2, 1, 0, 3));
+      const __m256 vi6xFHJLNPRT = _mm256_permute_ps(_mm256_blend_ps(vi6xHJLNPRTV, vi6x9BDFHJLN, 0x88), _MM_SHUFFLE(2, 1, 0, 3));
+      const __m256 vi7xFHJLNPRT = _mm256_permute_ps(_mm256_blend_ps(vi7xHJLNPRTV, vi7x9BDFHJLN, 0x88), _MM_SHUFFLE(2, 1, 0, 3));
+      const __m256 vi8xFHJLNPRT = _mm256_permute_ps(_mm256_blend_ps(vi8xHJLNPRTV, vi8x9BDFHJLN, 0x88), _MM_SHUFFLE(2, 1, 0, 3));
+
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi0xFHJLNPRT, vk01));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi2xFHJLNPRT, vk01));
+      vo2p0 = _mm256_add_ps(vo2p0, _mm256_mul_ps(vi4xFHJLNPRT, vk01));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi1xFHJLNPRT, vk11));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi3xFHJLNPRT, vk11));
+      vo2p0 = _mm256_add_ps(vo2p0, _mm256_mul_ps(vi5xFHJLNPRT, vk11));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi2xFHJLNPRT, vk21));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi4xFHJLNPRT, vk21));
+      vo2p0 = _mm256_add_ps(vo2p0, _mm256_mul_ps(vi6xFHJLNPRT, vk21));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi3xFHJLNPRT, vk31));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi5xFHJLNPRT, vk31));
+      vo2p0 = _mm256_add_ps(vo2p0, _mm256_mul_ps(vi7xFHJLNPRT, vk31));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi4xFHJLNPRT, vk41));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi6xFHJLNPRT, vk41));
+      vo2p0 = _mm256_add_ps(vo2p0, _mm256_mul_ps(vi8xFHJLNPRT, vk41));
+
+      const __m256 vi0xWXYZefgh = _mm256_permute2f128_ps(vi0xWXYZabcd, vi0xefghijkl, 0x20);
+      const __m256 vi0xabcdijkl = _mm256_permute2f128_ps(vi0xWXYZabcd, vi0xefghijkl, 0x31);
+      const __m256 vi1xWXYZefgh = _mm256_permute2f128_ps(vi1xWXYZabcd, vi1xefghijkl, 0x20);
+      const __m256 vi1xabcdijkl = _mm256_permute2f128_ps(vi1xWXYZabcd, vi1xefghijkl, 0x31);
+      const __m256 vi2xWXYZefgh = _mm256_permute2f128_ps(vi2xWXYZabcd, vi2xefghijkl, 0x20);
+      const __m256 vi2xabcdijkl = _mm256_permute2f128_ps(vi2xWXYZabcd, vi2xefghijkl, 0x31);
+      const __m256 vi3xWXYZefgh = _mm256_permute2f128_ps(vi3xWXYZabcd, vi3xefghijkl, 0x20);
+      const __m256 vi3xabcdijkl = _mm256_permute2f128_ps(vi3xWXYZabcd, vi3xefghijkl, 0x31);
+      const __m256 vi4xWXYZefgh = _mm256_permute2f128_ps(vi4xWXYZabcd, vi4xefghijkl, 0x20);
+      const __m256 vi4xabcdijkl = _mm256_permute2f128_ps(vi4xWXYZabcd, vi4xefghijkl, 0x31);
+      const __m256 vi5xWXYZefgh = _mm256_permute2f128_ps(vi5xWXYZabcd, vi5xefghijkl, 0x20);
+      const __m256 vi5xabcdijkl = _mm256_permute2f128_ps(vi5xWXYZabcd, vi5xefghijkl, 0x31);
+      const __m256 vi6xWXYZefgh = _mm256_permute2f128_ps(vi6xWXYZabcd, vi6xefghijkl, 0x20);
+      const __m256 vi6xabcdijkl = _mm256_permute2f128_ps(vi6xWXYZabcd, vi6xefghijkl, 0x31);
+      const __m256 vi7xWXYZefgh = _mm256_permute2f128_ps(vi7xWXYZabcd, vi7xefghijkl, 0x20);
+      const __m256 vi7xabcdijkl = _mm256_permute2f128_ps(vi7xWXYZabcd, vi7xefghijkl, 0x31);
+      const __m256 vi8xWXYZefgh = _mm256_permute2f128_ps(vi8xWXYZabcd, vi8xefghijkl, 0x20);
+      const __m256 vi8xabcdijkl = _mm256_permute2f128_ps(vi8xWXYZabcd, vi8xefghijkl, 0x31);
+
+      const __m256 vi0xWYacegik = _mm256_shuffle_ps(vi0xWXYZefgh, vi0xabcdijkl, _MM_SHUFFLE(2, 0, 2, 0));
+      const __m256 vi0xXZbdfhjl = _mm256_shuffle_ps(vi0xWXYZefgh, vi0xabcdijkl, _MM_SHUFFLE(3, 1, 3, 1));
+      const __m256 vi1xWYacegik = _mm256_shuffle_ps(vi1xWXYZefgh, vi1xabcdijkl, _MM_SHUFFLE(2, 0, 2, 0));
+      const __m256 vi1xXZbdfhjl = _mm256_shuffle_ps(vi1xWXYZefgh, vi1xabcdijkl, _MM_SHUFFLE(3, 1, 3, 1));
+      const __m256 vi2xWYacegik = _mm256_shuffle_ps(vi2xWXYZefgh, vi2xabcdijkl, _MM_SHUFFLE(2, 0, 2, 0));
+      const __m256 vi2xXZbdfhjl = _mm256_shuffle_ps(vi2xWXYZefgh, vi2xabcdijkl, _MM_SHUFFLE(3, 1, 3, 1));
+      const __m256 vi3xWYacegik = _mm256_shuffle_ps(vi3xWXYZefgh, vi3xabcdijkl, _MM_SHUFFLE(2, 0, 2, 0));
+      const __m256 vi3xXZbdfhjl = _mm256_shuffle_ps(vi3xWXYZefgh, vi3xabcdijkl, _MM_SHUFFLE(3, 1, 3, 1));
+      const __m256 vi4xWYacegik = _mm256_shuffle_ps(vi4xWXYZefgh, vi4xabcdijkl, _MM_SHUFFLE(2, 0, 2, 0));
+      const __m256 vi4xXZbdfhjl = _mm256_shuffle_ps(vi4xWXYZefgh, vi4xabcdijkl, _MM_SHUFFLE(3, 1, 3, 1));
+      const __m256 vi5xWYacegik = _mm256_shuffle_ps(vi5xWXYZefgh, vi5xabcdijkl, _MM_SHUFFLE(2, 0, 2, 0));
+      const __m256 vi5xXZbdfhjl = _mm256_shuffle_ps(vi5xWXYZefgh, vi5xabcdijkl, _MM_SHUFFLE(3, 1, 3, 1));
+      const __m256 vi6xWYacegik = _mm256_shuffle_ps(vi6xWXYZefgh, vi6xabcdijkl, _MM_SHUFFLE(2, 0, 2, 0));
+      const __m256 vi6xXZbdfhjl = _mm256_shuffle_ps(vi6xWXYZefgh, vi6xabcdijkl, _MM_SHUFFLE(3, 1, 3, 1));
+      const __m256 vi7xWYacegik = _mm256_shuffle_ps(vi7xWXYZefgh, vi7xabcdijkl, _MM_SHUFFLE(2, 0, 2, 0));
+      const __m256 vi7xXZbdfhjl = _mm256_shuffle_ps(vi7xWXYZefgh, vi7xabcdijkl, _MM_SHUFFLE(3, 1, 3, 1));
+      const __m256 vi8xWYacegik = _mm256_shuffle_ps(vi8xWXYZefgh, vi8xabcdijkl, _MM_SHUFFLE(2, 0, 2, 0));
+      const __m256 vi8xXZbdfhjl = _mm256_shuffle_ps(vi8xWXYZefgh, vi8xabcdijkl, _MM_SHUFFLE(3, 1, 3, 1));
+
+      const __m256 vi0xOQSUWYac = _mm256_permute2f128_ps(vi0xGIKMOQSU, vi0xWYacegik, 0x21);
+      const __m256 vi1xOQSUWYac = _mm256_permute2f128_ps(vi1xGIKMOQSU, vi1xWYacegik, 0x21);
+      const __m256 vi2xOQSUWYac = _mm256_permute2f128_ps(vi2xGIKMOQSU, vi2xWYacegik, 0x21);
+      const __m256 vi3xOQSUWYac = _mm256_permute2f128_ps(vi3xGIKMOQSU, vi3xWYacegik, 0x21);
+      const __m256 vi4xOQSUWYac = _mm256_permute2f128_ps(vi4xGIKMOQSU, vi4xWYacegik, 0x21);
+      const __m256 vi5xOQSUWYac = _mm256_permute2f128_ps(vi5xGIKMOQSU, vi5xWYacegik, 0x21);
+      const __m256 vi6xOQSUWYac = _mm256_permute2f128_ps(vi6xGIKMOQSU, vi6xWYacegik, 0x21);
+      const __m256 vi7xOQSUWYac = _mm256_permute2f128_ps(vi7xGIKMOQSU, vi7xWYacegik, 0x21);
+      const __m256 vi8xOQSUWYac = _mm256_permute2f128_ps(vi8xGIKMOQSU, vi8xWYacegik, 0x21);
+
+      const __m256 vi0xIKMOQSUW = _mm256_permute_ps(_mm256_blend_ps(vi0xGIKMOQSU, vi0xOQSUWYac, 0x11), _MM_SHUFFLE(0, 3, 2, 1));
+      vi0xGIKMOQSU = vi0xWYacegik;
+      vi0xHJLNPRTV = vi0xXZbdfhjl;
+      const __m256 vi1xIKMOQSUW = _mm256_permute_ps(_mm256_blend_ps(vi1xGIKMOQSU, vi1xOQSUWYac, 0x11), _MM_SHUFFLE(0, 3, 2, 1));
+      vi1xGIKMOQSU = vi1xWYacegik;
+      vi1xHJLNPRTV = vi1xXZbdfhjl;
+      const __m256 vi2xIKMOQSUW = _mm256_permute_ps(_mm256_blend_ps(vi2xGIKMOQSU, vi2xOQSUWYac, 0x11), _MM_SHUFFLE(0, 3, 2, 1));
+      vi2xGIKMOQSU = vi2xWYacegik;
+      vi2xHJLNPRTV = vi2xXZbdfhjl;
+      const __m256 vi3xIKMOQSUW = _mm256_permute_ps(_mm256_blend_ps(vi3xGIKMOQSU, vi3xOQSUWYac, 0x11), _MM_SHUFFLE(0, 3, 2, 1));
+      vi3xGIKMOQSU = vi3xWYacegik;
+      vi3xHJLNPRTV = vi3xXZbdfhjl;
+      const __m256 vi4xIKMOQSUW = _mm256_permute_ps(_mm256_blend_ps(vi4xGIKMOQSU, vi4xOQSUWYac, 0x11), _MM_SHUFFLE(0, 3, 2, 1));
+      vi4xGIKMOQSU = vi4xWYacegik;
+      vi4xHJLNPRTV = vi4xXZbdfhjl;
+      const __m256 vi5xIKMOQSUW = _mm256_permute_ps(_mm256_blend_ps(vi5xGIKMOQSU, vi5xOQSUWYac, 0x11), _MM_SHUFFLE(0, 3, 2, 1));
+      vi5xGIKMOQSU = vi5xWYacegik;
+      vi5xHJLNPRTV = vi5xXZbdfhjl;
+      const __m256 vi6xIKMOQSUW = _mm256_permute_ps(_mm256_blend_ps(vi6xGIKMOQSU, vi6xOQSUWYac, 0x11), _MM_SHUFFLE(0, 3, 2, 1));
+      vi6xGIKMOQSU = vi6xWYacegik;
+      vi6xHJLNPRTV = vi6xXZbdfhjl;
+      const __m256 vi7xIKMOQSUW = _mm256_permute_ps(_mm256_blend_ps(vi7xGIKMOQSU, vi7xOQSUWYac, 0x11), _MM_SHUFFLE(0, 3, 2, 1));
+      vi7xGIKMOQSU = vi7xWYacegik;
+      vi7xHJLNPRTV = vi7xXZbdfhjl;
+      const __m256 vi8xIKMOQSUW = _mm256_permute_ps(_mm256_blend_ps(vi8xGIKMOQSU, vi8xOQSUWYac, 0x11), _MM_SHUFFLE(0, 3, 2, 1));
+      vi8xGIKMOQSU = vi8xWYacegik;
+      vi8xHJLNPRTV = vi8xXZbdfhjl;
+
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi0xIKMOQSUW, vk04));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi2xIKMOQSUW, vk04));
+      vo2p0 = _mm256_add_ps(vo2p0, _mm256_mul_ps(vi4xIKMOQSUW, vk04));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi1xIKMOQSUW, vk14));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi3xIKMOQSUW, vk14));
+      vo2p0 = _mm256_add_ps(vo2p0, _mm256_mul_ps(vi5xIKMOQSUW, vk14));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi2xIKMOQSUW, vk24));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi4xIKMOQSUW, vk24));
+      vo2p0 = _mm256_add_ps(vo2p0, _mm256_mul_ps(vi6xIKMOQSUW, vk24));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi3xIKMOQSUW, vk34));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi5xIKMOQSUW, vk34));
+      vo2p0 = _mm256_add_ps(vo2p0, _mm256_mul_ps(vi7xIKMOQSUW, vk34));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi4xIKMOQSUW, vk44));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi6xIKMOQSUW, vk44));
+      vo2p0 = _mm256_add_ps(vo2p0, _mm256_mul_ps(vi8xIKMOQSUW, vk44));
+
+
+      __m256 vo0 = _mm256_max_ps(vo0p0, vmin);
+      __m256 vo1 = _mm256_max_ps(vo1p0, vmin);
+      __m256 vo2 = _mm256_max_ps(vo2p0, vmin);
+
+      vo0 = _mm256_min_ps(vo0, vmax);
+      vo1 = _mm256_min_ps(vo1, vmax);
+      vo2 = _mm256_min_ps(vo2, vmax);
+
+      _mm256_storeu_ps(o2, vo2);
+      o2 += 8;
+      _mm256_storeu_ps(o1, vo1);
+      o1 += 8;
+      _mm256_storeu_ps(o0, vo0);
+      o0 += 8;
+
+      w -= 16 * sizeof(float);
+    }
+    // Last block has 1-16 pixels to process.
+    assert(w <= 16 * sizeof(float));
+    assert(w >= 1 * sizeof(float));
+    {
+      vi0xGIKMOQSU = _mm256_and_ps(vi0xGIKMOQSU, vmask_even);
+      vi0xHJLNPRTV = _mm256_and_ps(vi0xHJLNPRTV, vmask_odd);
+      vi1xGIKMOQSU = _mm256_and_ps(vi1xGIKMOQSU, vmask_even);
+      vi1xHJLNPRTV = _mm256_and_ps(vi1xHJLNPRTV, vmask_odd);
+      vi2xGIKMOQSU = _mm256_and_ps(vi2xGIKMOQSU, vmask_even);
+      vi2xHJLNPRTV = _mm256_and_ps(vi2xHJLNPRTV, vmask_odd);
+      vi3xGIKMOQSU = _mm256_and_ps(vi3xGIKMOQSU, vmask_even);
+      vi3xHJLNPRTV = _mm256_and_ps(vi3xHJLNPRTV, vmask_odd);
+      vi4xGIKMOQSU = _mm256_and_ps(vi4xGIKMOQSU, vmask_even);
+      vi4xHJLNPRTV = _mm256_and_ps(vi4xHJLNPRTV, vmask_odd);
+      vi5xGIKMOQSU = _mm256_and_ps(vi5xGIKMOQSU, vmask_even);
+      vi5xHJLNPRTV = _mm256_and_ps(vi5xHJLNPRTV, vmask_odd);
+      vi6xGIKMOQSU = _mm256_and_ps(vi6xGIKMOQSU, vmask_even);
+      vi6xHJLNPRTV = _mm256_and_ps(vi6xHJLNPRTV, vmask_odd);
+      vi7xGIKMOQSU = _mm256_and_ps(vi7xGIKMOQSU, vmask_even);
+      vi7xHJLNPRTV = _mm256_and_ps(vi7xHJLNPRTV, vmask_odd);
+      vi8xGIKMOQSU = _mm256_and_ps(vi8xGIKMOQSU, vmask_even);
+      vi8xHJLNPRTV = _mm256_and_ps(vi8xHJLNPRTV, vmask_odd);
+
+      __m256 vo0p0 = _mm256_add_ps(vbias, _mm256_mul_ps(vi0xGIKMOQSU, vk02));
+      __m256 vo1p0 = _mm256_add_ps(vbias, _mm256_mul_ps(vi2xGIKMOQSU, vk02));
+      __m256 vo2p0 = _mm256_add_ps(vbias, _mm256_mul_ps(vi4xGIKMOQSU, vk02));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi1xGIKMOQSU, vk12));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi3xGIKMOQSU, vk12));
+      vo2p0 = _mm256_add_ps(vo2p0, _mm256_mul_ps(vi5xGIKMOQSU, vk12));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi2xGIKMOQSU, vk22));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi4xGIKMOQSU, vk22));
+      vo2p0 = _mm256_add_ps(vo2p0, _mm256_mul_ps(vi6xGIKMOQSU, vk22));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi3xGIKMOQSU, vk32));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi5xGIKMOQSU, vk32));
+      vo2p0 = _mm256_add_ps(vo2p0, _mm256_mul_ps(vi7xGIKMOQSU, vk32));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi4xGIKMOQSU, vk42));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi6xGIKMOQSU, vk42));
+      vo2p0 = _mm256_add_ps(vo2p0, _mm256_mul_ps(vi8xGIKMOQSU, vk42));
+
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi0xHJLNPRTV, vk03));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi2xHJLNPRTV, vk03));
+      vo2p0 = _mm256_add_ps(vo2p0, _mm256_mul_ps(vi4xHJLNPRTV, vk03));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi1xHJLNPRTV, vk13));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi3xHJLNPRTV, vk13));
+      vo2p0 = _mm256_add_ps(vo2p0, _mm256_mul_ps(vi5xHJLNPRTV, vk13));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi2xHJLNPRTV, vk23));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi4xHJLNPRTV, vk23));
+      vo2p0 = _mm256_add_ps(vo2p0, _mm256_mul_ps(vi6xHJLNPRTV, vk23));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi3xHJLNPRTV, vk33));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi5xHJLNPRTV, vk33));
+      vo2p0 = _mm256_add_ps(vo2p0, _mm256_mul_ps(vi7xHJLNPRTV, vk33));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi4xHJLNPRTV, vk43));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi6xHJLNPRTV, vk43));
+      vo2p0 = _mm256_add_ps(vo2p0, _mm256_mul_ps(vi8xHJLNPRTV, vk43));
+
+      const __m256 vi0x8ACEGIKM = _mm256_permute2f128_ps(vi0x02468ACE, vi0xGIKMOQSU, 0x21);
+      const __m256 vi1x8ACEGIKM = _mm256_permute2f128_ps(vi1x02468ACE, vi1xGIKMOQSU, 0x21);
+      const __m256 vi2x8ACEGIKM = _mm256_permute2f128_ps(vi2x02468ACE, vi2xGIKMOQSU, 0x21);
+      const __m256 vi3x8ACEGIKM = _mm256_permute2f128_ps(vi3x02468ACE, vi3xGIKMOQSU, 0x21);
+      const __m256 vi4x8ACEGIKM = _mm256_permute2f128_ps(vi4x02468ACE, vi4xGIKMOQSU, 0x21);
+      const __m256 vi5x8ACEGIKM = _mm256_permute2f128_ps(vi5x02468ACE, vi5xGIKMOQSU, 0x21);
+      const __m256 vi6x8ACEGIKM = _mm256_permute2f128_ps(vi6x02468ACE, vi6xGIKMOQSU, 0x21);
+      const __m256 vi7x8ACEGIKM = _mm256_permute2f128_ps(vi7x02468ACE, vi7xGIKMOQSU, 0x21);
+      const __m256 vi8x8ACEGIKM = _mm256_permute2f128_ps(vi8x02468ACE, vi8xGIKMOQSU, 0x21);
+
+      const __m256 vi0xEGIKMOQS = _mm256_permute_ps(_mm256_blend_ps(vi0xGIKMOQSU, vi0x8ACEGIKM, 0x88), _MM_SHUFFLE(2, 1, 0, 3));
+      const __m256 vi1xEGIKMOQS = _mm256_permute_ps(_mm256_blend_ps(vi1xGIKMOQSU, vi1x8ACEGIKM, 0x88), _MM_SHUFFLE(2, 1, 0, 3));
+      const __m256 vi2xEGIKMOQS = _mm256_permute_ps(_mm256_blend_ps(vi2xGIKMOQSU, vi2x8ACEGIKM, 0x88), _MM_SHUFFLE(2, 1, 0, 3));
+      const __m256 vi3xEGIKMOQS = _mm256_permute_ps(_mm256_blend_ps(vi3xGIKMOQSU, vi3x8ACEGIKM, 0x88), _MM_SHUFFLE(2, 1, 0, 3));
+      const __m256 vi4xEGIKMOQS = _mm256_permute_ps(_mm256_blend_ps(vi4xGIKMOQSU, vi4x8ACEGIKM, 0x88), _MM_SHUFFLE(2, 1, 0, 3));
+      const __m256 vi5xEGIKMOQS = _mm256_permute_ps(_mm256_blend_ps(vi5xGIKMOQSU, vi5x8ACEGIKM, 0x88), _MM_SHUFFLE(2, 1, 0, 3));
+      const __m256 vi6xEGIKMOQS = _mm256_permute_ps(_mm256_blend_ps(vi6xGIKMOQSU, vi6x8ACEGIKM, 0x88), _MM_SHUFFLE(2, 1, 0, 3));
+      const __m256 vi7xEGIKMOQS = _mm256_permute_ps(_mm256_blend_ps(vi7xGIKMOQSU, vi7x8ACEGIKM, 0x88), _MM_SHUFFLE(2, 1, 0, 3));
+      const __m256 vi8xEGIKMOQS = _mm256_permute_ps(_mm256_blend_ps(vi8xGIKMOQSU, vi8x8ACEGIKM, 0x88), _MM_SHUFFLE(2, 1, 0, 3));
+
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi0xEGIKMOQS, vk00));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi2xEGIKMOQS, vk00));
+      vo2p0 = _mm256_add_ps(vo2p0, _mm256_mul_ps(vi4xEGIKMOQS, vk00));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi1xEGIKMOQS, vk10));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi3xEGIKMOQS, vk10));
+      vo2p0 = _mm256_add_ps(vo2p0, _mm256_mul_ps(vi5xEGIKMOQS, vk10));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi2xEGIKMOQS, vk20));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi4xEGIKMOQS, vk20));
+      vo2p0 = _mm256_add_ps(vo2p0, _mm256_mul_ps(vi6xEGIKMOQS, vk20));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi3xEGIKMOQS, vk30));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi5xEGIKMOQS, vk30));
+      vo2p0 = _mm256_add_ps(vo2p0, _mm256_mul_ps(vi7xEGIKMOQS, vk30));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi4xEGIKMOQS, vk40));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi6xEGIKMOQS, vk40));
+      vo2p0 = _mm256_add_ps(vo2p0, _mm256_mul_ps(vi8xEGIKMOQS, vk40));
+
+      const __m256 vi0x9BDFHJLN = _mm256_permute2f128_ps(vi0x13579BDF, vi0xHJLNPRTV, 0x21);
+      const __m256 vi1x9BDFHJLN = _mm256_permute2f128_ps(vi1x13579BDF, vi1xHJLNPRTV, 0x21);
+      const __m256 vi2x9BDFHJLN = _mm256_permute2f128_ps(vi2x13579BDF, vi2xHJLNPRTV, 0x21);
+      const __m256 vi3x9BDFHJLN = _mm256_permute2f128_ps(vi3x13579BDF, vi3xHJLNPRTV, 0x21);
+      const __m256 vi4x9BDFHJLN = _mm256_permute2f128_ps(vi4x13579BDF, vi4xHJLNPRTV, 0x21);
+      const __m256 vi5x9BDFHJLN = _mm256_permute2f128_ps(vi5x13579BDF, vi5xHJLNPRTV, 0x21);
+      const __m256 vi6x9BDFHJLN = _mm256_permute2f128_ps(vi6x13579BDF, vi6xHJLNPRTV, 0x21);
+      const __m256 vi7x9BDFHJLN = _mm256_permute2f128_ps(vi7x13579BDF, vi7xHJLNPRTV, 0x21);
+      const __m256 vi8x9BDFHJLN = _mm256_permute2f128_ps(vi8x13579BDF, vi8xHJLNPRTV, 0x21);
+
+      const __m256 vi0xFHJLNPRT = _mm256_permute_ps(_mm256_blend_ps(vi0xHJLNPRTV, vi0x9BDFHJLN, 0x88), _MM_SHUFFLE(2, 1, 0, 3));
+      const __m256 vi1xFHJLNPRT = _mm256_permute_ps(_mm256_blend_ps(vi1xHJLNPRTV, vi1x9BDFHJLN, 0x88), _MM_SHUFFLE(2, 1, 0, 3));
+      const __m256 vi2xFHJLNPRT = _mm256_permute_ps(_mm256_blend_ps(vi2xHJLNPRTV, vi2x9BDFHJLN, 0x88), _MM_SHUFFLE(2, 1, 0, 3));
+      const __m256 vi3xFHJLNPRT = _mm256_permute_ps(_mm256_blend_ps(vi3xHJLNPRTV, vi3x9BDFHJLN, 0x88), _MM_SHUFFLE(2, 1, 0, 3));
+      const __m256 vi4xFHJLNPRT = _mm256_permute_ps(_mm256_blend_ps(vi4xHJLNPRTV, vi4x9BDFHJLN, 0x88), _MM_SHUFFLE(2, 1, 0, 3));
+      const __m256 vi5xFHJLNPRT = _mm256_permute_ps(_mm256_blend_ps(vi5xHJLNPRTV, vi5x9BDFHJLN, 0x88), _MM_SHUFFLE(2, 1, 0, 3));
+      const __m256 vi6xFHJLNPRT = _mm256_permute_ps(_mm256_blend_ps(vi6xHJLNPRTV, vi6x9BDFHJLN, 0x88), _MM_SHUFFLE(2, 1, 0, 3));
+      const __m256 vi7xFHJLNPRT = _mm256_permute_ps(_mm256_blend_ps(vi7xHJLNPRTV, vi7x9BDFHJLN, 0x88), _MM_SHUFFLE(2, 1, 0, 3));
+      const __m256 vi8xFHJLNPRT = _mm256_permute_ps(_mm256_blend_ps(vi8xHJLNPRTV, vi8x9BDFHJLN, 0x88), _MM_SHUFFLE(2, 1, 0, 3));
+
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi0xFHJLNPRT, vk01));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi2xFHJLNPRT, vk01));
+      vo2p0 = _mm256_add_ps(vo2p0, _mm256_mul_ps(vi4xFHJLNPRT, vk01));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi1xFHJLNPRT, vk11));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi3xFHJLNPRT, vk11));
+      vo2p0 = _mm256_add_ps(vo2p0, _mm256_mul_ps(vi5xFHJLNPRT, vk11));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi2xFHJLNPRT, vk21));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi4xFHJLNPRT, vk21));
+      vo2p0 = _mm256_add_ps(vo2p0, _mm256_mul_ps(vi6xFHJLNPRT, vk21));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi3xFHJLNPRT, vk31));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi5xFHJLNPRT, vk31));
+      vo2p0 = _mm256_add_ps(vo2p0, _mm256_mul_ps(vi7xFHJLNPRT, vk31));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi4xFHJLNPRT, vk41));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi6xFHJLNPRT, vk41));
+      vo2p0 = _mm256_add_ps(vo2p0, _mm256_mul_ps(vi8xFHJLNPRT, vk41));
+
+      // vi0xOQSUWYac = ( 0.0, 0.0, 0.0, 0.0, vi0U, vi0S, vi0Q, vi0O )
+      const __m256 vi0xOQSUWYac = _mm256_permute2f128_ps(vi0xGIKMOQSU, vi0xGIKMOQSU, 0x81);
+      // vi1xOQSUWYac = ( 0.0, 0.0, 0.0, 0.0, vi1U, vi1S, vi1Q, vi1O )
+      const __m256 vi1xOQSUWYac = _mm256_permute2f128_ps(vi1xGIKMOQSU, vi1xGIKMOQSU, 0x81);
+      // vi2xOQSUWYac = ( 0.0, 0.0, 0.0, 0.0, vi2U, vi2S, vi2Q, vi2O )
+      const __m256 vi2xOQSUWYac = _mm256_permute2f128_ps(vi2xGIKMOQSU, vi2xGIKMOQSU, 0x81);
+      // vi3xOQSUWYac = ( 0.0, 0.0, 0.0, 0.0, vi3U, vi3S, vi3Q, vi3O )
+      const __m256 vi3xOQSUWYac = _mm256_permute2f128_ps(vi3xGIKMOQSU, vi3xGIKMOQSU, 0x81);
+      // vi4xOQSUWYac = ( 0.0, 0.0, 0.0, 0.0, vi4U, vi4S, vi4Q, vi4O )
+      const __m256 vi4xOQSUWYac = _mm256_permute2f128_ps(vi4xGIKMOQSU, vi4xGIKMOQSU, 0x81);
+      // vi5xOQSUWYac = ( 0.0, 0.0, 0.0, 0.0, vi5U, vi5S, vi5Q, vi5O )
+      const __m256 vi5xOQSUWYac = _mm256_permute2f128_ps(vi5xGIKMOQSU, vi5xGIKMOQSU, 0x81);
+      // vi6xOQSUWYac = ( 0.0, 0.0, 0.0, 0.0, vi6U, vi6S, vi6Q, vi6O )
+      const __m256 vi6xOQSUWYac = _mm256_permute2f128_ps(vi6xGIKMOQSU, vi6xGIKMOQSU, 0x81);
+      // vi7xOQSUWYac = ( 0.0, 0.0, 0.0, 0.0, vi7U, vi7S, vi7Q, vi7O )
+      const __m256 vi7xOQSUWYac = _mm256_permute2f128_ps(vi7xGIKMOQSU, vi7xGIKMOQSU, 0x81);
+      // vi8xOQSUWYac = ( 0.0, 0.0, 0.0, 0.0, vi8U, vi8S, vi8Q, vi8O )
+      const __m256 vi8xOQSUWYac = _mm256_permute2f128_ps(vi8xGIKMOQSU, vi8xGIKMOQSU, 0x81);
+
+      const __m256 vi0xIKMOQSUW = _mm256_permute_ps(_mm256_blend_ps(vi0xGIKMOQSU, vi0xOQSUWYac, 0x11), _MM_SHUFFLE(0, 3, 2, 1));
+      const __m256 vi1xIKMOQSUW = _mm256_permute_ps(_mm256_blend_ps(vi1xGIKMOQSU, vi1xOQSUWYac, 0x11), _MM_SHUFFLE(0, 3, 2, 1));
+      const __m256 vi2xIKMOQSUW = _mm256_permute_ps(_mm256_blend_ps(vi2xGIKMOQSU, vi2xOQSUWYac, 0x11), _MM_SHUFFLE(0, 3, 2, 1));
+      const __m256 vi3xIKMOQSUW = _mm256_permute_ps(_mm256_blend_ps(vi3xGIKMOQSU, vi3xOQSUWYac, 0x11), _MM_SHUFFLE(0, 3, 2, 1));
+      const __m256 vi4xIKMOQSUW = _mm256_permute_ps(_mm256_blend_ps(vi4xGIKMOQSU, vi4xOQSUWYac, 0x11), _MM_SHUFFLE(0, 3, 2, 1));
+      const __m256 vi5xIKMOQSUW = _mm256_permute_ps(_mm256_blend_ps(vi5xGIKMOQSU, vi5xOQSUWYac, 0x11), _MM_SHUFFLE(0, 3, 2, 1));
+      const __m256 vi6xIKMOQSUW = _mm256_permute_ps(_mm256_blend_ps(vi6xGIKMOQSU, vi6xOQSUWYac, 0x11), _MM_SHUFFLE(0, 3, 2, 1));
+      const __m256 vi7xIKMOQSUW = _mm256_permute_ps(_mm256_blend_ps(vi7xGIKMOQSU, vi7xOQSUWYac, 0x11), _MM_SHUFFLE(0, 3, 2, 1));
+      const __m256 vi8xIKMOQSUW = _mm256_permute_ps(_mm256_blend_ps(vi8xGIKMOQSU, vi8xOQSUWYac, 0x11), _MM_SHUFFLE(0, 3, 2, 1));
+
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi0xIKMOQSUW, vk04));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi2xIKMOQSUW, vk04));
+      vo2p0 = _mm256_add_ps(vo2p0, _mm256_mul_ps(vi4xIKMOQSUW, vk04));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi1xIKMOQSUW, vk14));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi3xIKMOQSUW, vk14));
+      vo2p0 = _mm256_add_ps(vo2p0, _mm256_mul_ps(vi5xIKMOQSUW, vk14));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi2xIKMOQSUW, vk24));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi4xIKMOQSUW, vk24));
+      vo2p0 = _mm256_add_ps(vo2p0, _mm256_mul_ps(vi6xIKMOQSUW, vk24));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi3xIKMOQSUW, vk34));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi5xIKMOQSUW, vk34));
+      vo2p0 = _mm256_add_ps(vo2p0, _mm256_mul_ps(vi7xIKMOQSUW, vk34));
+      vo0p0 = _mm256_add_ps(vo0p0, _mm256_mul_ps(vi4xIKMOQSUW, vk44));
+      vo1p0 = _mm256_add_ps(vo1p0, _mm256_mul_ps(vi6xIKMOQSUW, vk44));
+      vo2p0 = _mm256_add_ps(vo2p0, _mm256_mul_ps(vi8xIKMOQSUW, vk44));
+
+
+      __m256 vo0 = _mm256_max_ps(vo0p0, vmin);
+      __m256 vo1 = _mm256_max_ps(vo1p0, vmin);
+      __m256 vo2 = _mm256_max_ps(vo2p0, vmin);
+
+      vo0 = _mm256_min_ps(vo0, vmax);
+      vo1 = _mm256_min_ps(vo1, vmax);
+      vo2 = _mm256_min_ps(vo2, vmax);
+
+      const size_t w_tmp = (w + 1 * sizeof(float)) / (2 * sizeof(float));
+      if XNN_LIKELY(w_tmp >= 8) {
+        _mm256_storeu_ps(o2, vo2);
+        o2 += 8;
+        _mm256_storeu_ps(o1, vo1);
+        o1 += 8;
+        _mm256_storeu_ps(o0, vo0);
+        o0 += 8;
+      } else {
+        __m128 vo2_lo = _mm256_castps256_ps128(vo2);
+        __m128 vo1_lo = _mm256_castps256_ps128(vo1);
+        __m128 vo0_lo = _mm256_castps256_ps128(vo0);
+        if (w_tmp & 4) {
+          _mm_storeu_ps(o2, vo2_lo);
+          o2 += 4;
+          _mm_storeu_ps(o1, vo1_lo);
+          o1 += 4;
+          _mm_storeu_ps(o0, vo0_lo);
+          o0 += 4;
+
+          vo0_lo = _mm256_extractf128_ps(vo0, 1);
+          vo1_lo = _mm256_extractf128_ps(vo1, 1);
+          vo2_lo = _mm256_extractf128_ps(vo2, 1);
+        }
+        if (w_tmp & 2) {
+          _mm_storel_pi((__m64*) o2, vo2_lo);
+          o2 += 2;
+          _mm_storel_pi((__m64*) o1, vo1_lo);
+          o1 += 2;
+          _mm_storel_pi((__m64*) o0, vo0_lo);
+          o0 += 2;
+
+          vo0_lo = _mm_movehl_ps(vo0_lo, vo0_lo);
+          vo1_lo = _mm_movehl_ps(vo1_lo, vo1_lo);
+          vo2_lo = _mm_movehl_ps(vo2_lo, vo2_lo);
+        }
+        if (w_tmp & 1) {
+          _mm_store_ss(o2, vo2_lo);
+          o2 += 1;
+          _mm_store_ss(o1, vo1_lo);
+          o1 += 1;
+          _mm_store_ss(o0, vo0_lo);
+          o0 += 1;
+        }
+      }
+    }
+
+    i0 = (const float*) ((uintptr_t) i6 - input_decrement);
+    i1 = (const float*) ((uintptr_t) i7 - input_decrement);
+    i2 = (const float*) ((uintptr_t) i8 - input_decrement);
+    i3 = (const float*) ((uintptr_t) i2 + input_width);
+    i4 = (const float*) ((uintptr_t) i3 + input_width);
+    i5 = (const float*) ((uintptr_t) i4 + input_width);
+    i6 = (const float*) ((uintptr_t) i5 + input_width);
+    i7 = (const float*) ((uintptr_t) i6 + input_width);
+    i8 = (const float*) ((uintptr_t) i7 + input_width);
+
+    o0 = o2;
+    o1 = (float*) ((uintptr_t) o0 + output_width);
+    o2 = (float*) ((uintptr_t) o1 + output_width);
+
+    output_height = doz(output_height, 3);
+    padded_input_height = doz(padded_input_height, 6);
+  } while (output_height != 0);
+}
@@ -0,0 +1,424 @@
+// Auto-generated file. Do not edit!
+//   Template: src/f32-dwconv2d-chw/5x5s2p2-avx512f.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <immintrin.h>
+
+#include <xnnpack/dwconv.h>
+#include <xnnpack/intrinsics-polyfill.h>
+#include <xnnpack/math.h>
+
+
+void xnn_f32_dwconv2d_chw_ukernel_5x5s2p2__avx512f_1x16_acc2(
+    size_t input_height,
+    size_t input_width,
+    const float* input,
+    const float* weights,
+    const float* zero,
+    float* output,
+    uint32_t padding_top,
+    const union xnn_f32_chw_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(input_height != 0);
+  assert(input_width != 0);
+  assert(input_width % sizeof(float) == 0);
+  assert(padding_top >= 1);
+  assert(padding_top <= 2);
+
+  // Masks of the valid pixels in the last block of 1..32 pixels of each row.
+  const uint32_t vmask_bits = UINT32_C(0xFFFFFFFF) >> (31 - (((input_width - 1 * sizeof(float)) / sizeof(float)) & 31));
+  const __mmask16 vmask_lo = _cvtu32_mask16(vmask_bits);
+  const __mmask16 vmask_hi = _cvtu32_mask16(vmask_bits >> 16);
+  const __mmask16 vmask_first_lo = input_width > 32 * sizeof(float) ? _cvtu32_mask16(UINT32_C(0xFFFF)) : vmask_lo;
+  const __mmask16 vmask_first_hi = input_width > 32 * sizeof(float) ? _cvtu32_mask16(UINT32_C(0xFFFF)) : vmask_hi;
+  const __m512i vidx_even = _mm512_set_epi32(30, 28, 26, 24, 22, 20, 18, 16, 14, 12, 10, 8, 6, 4, 2, 0);
+  const __m512i vidx_odd = _mm512_set_epi32(31, 29, 27, 25, 23, 21, 19, 17, 15, 13, 11, 9, 7, 5, 3, 1);
+  const __m512 vmax = _mm512_set1_ps(params->sse.max[0]);
+  const __m512 vmin = _mm512_set1_ps(params->sse.min[0]);
+
+  const __m512 vbias = _mm512_set1_ps(weights[0]);
+  const __m512 vk00 = _mm512_set1_ps(weights[1]);
+  const __m512 vk01 = _mm512_set1_ps(weights[2]);
+  const __m512 vk02 = _mm512_set1_ps(weights[3]);
+  const __m512 vk03 = _mm512_set1_ps(weights[4]);
+  const __m512 vk04 = _mm512_set1_ps(weights[5]);
+  const __m512 vk10 = _mm512_set1_ps(weights[6]);
+  const __m512 vk11 = _mm512_set1_ps(weights[7]);
+  const __m512 vk12 = _mm512_set1_ps(weights[8]);
+  const __m512 vk13 = _mm512_set1_ps(weights[9]);
+  const __m512 vk14 = _mm512_set1_ps(weights[10]);
+  const __m512 vk20 = _mm512_set1_ps(weights[11]);
+  const __m512 vk21 = _mm512_set1_ps(weights[12]);
+  const __m512 vk22 = _mm512_set1_ps(weights[13]);
+  const __m512 vk23 = _mm512_set1_ps(weights[14]);
+  const __m512 vk24 = _mm512_set1_ps(weights[15]);
+  const __m512 vk30 = _mm512_set1_ps(weights[16]);
+  const __m512 vk31 = _mm512_set1_ps(weights[17]);
+  const __m512 vk32 = _mm512_set1_ps(weights[18]);
+  const __m512 vk33 = _mm512_set1_ps(weights[19]);
+  const __m512 vk34 = _mm512_set1_ps(weights[20]);
+  const __m512 vk40 = _mm512_set1_ps(weights[21]);
+  const __m512 vk41 = _mm512_set1_ps(weights[22]);
+  const __m512 vk42 = _mm512_set1_ps(weights[23]);
+  const __m512 vk43 = _mm512_set1_ps(weights[24]);
+  const __m512 vk44 = _mm512_set1_ps(weights[25]);
+
+  const uint32_t padding_top_less_1 = padding_top - 1;
+  const size_t input_decrement = round_up_po2(input_width, 16 /* SIMD output width */ * 2 /* subsampling */ * sizeof(float));
+
+  const float* i0 = zero;
+  const float* i1 = (const float*) ((uintptr_t) input - ((-padding_top_less_1) & input_width));
+  const float* i2 = (const float*) ((uintptr_t) i1 + input_width);
+  if XNN_UNPREDICTABLE(padding_top_less_1 != 0) {
+    i1 = zero;
+  }
+  const float* i3 = (const float*) ((uintptr_t) i2 + input_width);
+  const float* i4 = (const float*) ((uintptr_t) i3 + input_width);
+
+
+  float* o0 = output;
+
+  size_t padded_input_height = input_height + (padding_top_less_1 + 1) + 2 /* padding bottom */;
+  size_t output_height = (padded_input_height - 5 /* kernel size */ + 2 /* subsampling */) / 2;
+  do {
+    if XNN_UNPREDICTABLE(padded_input_height < 6) {
+      i3 = zero;
+    }
+    if XNN_UNPREDICTABLE(padded_input_height < 7) {
+      i4 = zero;
+    }
+
+    __m512 vi0_prev_even = _mm512_setzero_ps();
+    __m512 vi0_prev_odd = _mm512_setzero_ps();
+    __m512 vi1_prev_even = _mm512_setzero_ps();
+    __m512 vi1_prev_odd = _mm512_setzero_ps();
+    __m512 vi2_prev_even = _mm512_setzero_ps();
+    __m512 vi2_prev_odd = _mm512_setzero_ps();
+    __m512 vi3_prev_even = _mm512_setzero_ps();
+    __m512 vi3_prev_odd = _mm512_setzero_ps();
+    __m512 vi4_prev_even = _mm512_setzero_ps();
+    __m512 vi4_prev_odd = _mm512_setzero_ps();
+
+    const __m512 vi0_lo = _mm512_maskz_loadu_ps(vmask_first_lo, i0);
+    const __m512 vi0_hi = _mm512_maskz_loadu_ps(vmask_first_hi, i0 + 16);
+    i0 += 32;
+    const __m512 vi1_lo = _mm512_maskz_loadu_ps(vmask_first_lo, i1);
+    const __m512 vi1_hi = _mm512_maskz_loadu_ps(vmask_first_hi, i1 + 16);
+    i1 += 32;
+    const __m512 vi2_lo = _mm512_maskz_loadu_ps(vmask_first_lo, i2);
+    const __m512 vi2_hi = _mm512_maskz_loadu_ps(vmask_first_hi, i2 + 16);
+    i2 += 32;
+    const __m512 vi3_lo = _mm512_maskz_loadu_ps(vmask_first_lo, i3);
+    const __m512 vi3_hi = _mm512_maskz_loadu_ps(vmask_first_hi, i3 + 16);
+    i3 += 32;
+    const __m512 vi4_lo = _mm512_maskz_loadu_ps(vmask_first_lo, i4);
+    const __m512 vi4_hi = _mm512_maskz_loadu_ps(vmask_first_hi, i4 + 16);
+    i4 += 32;
+
+    __m512 vi0_even = _mm512_permutex2var_ps(vi0_lo, vidx_even, vi0_hi);
+    __m512 vi0_odd = _mm512_permutex2var_ps(vi0_lo, vidx_odd, vi0_hi);
+    __m512 vi1_even = _mm512_permutex2var_ps(vi1_lo, vidx_even, vi1_hi);
+    __m512 vi1_odd = _mm512_permutex2var_ps(vi1_lo, vidx_odd, vi1_hi);
+    __m512 vi2_even = _mm512_permutex2var_ps(vi2_lo, vidx_even, vi2_hi);
+    __m512 vi2_odd = _mm512_permutex2var_ps(vi2_lo, vidx_odd, vi2_hi);
+    __m512 vi3_even = _mm512_permutex2var_ps(vi3_lo, vidx_even, vi3_hi);
+    __m512 vi3_odd = _mm512_permutex2var_ps(vi3_lo, vidx_odd, vi3_hi);
+    __m512 vi4_even = _mm512_permutex2var_ps(vi4_lo, vidx_even, vi4_hi);
+    __m512 vi4_odd = _mm512_permutex2var_ps(vi4_lo, vidx_odd, vi4_hi);
+
+    size_t w = input_width;
+    for (; w > 64 * sizeof(float); w -= 32 * sizeof(float)) {
+      __m512 vo0p0 = _mm512_fmadd_ps(vi0_even, vk02, vbias);
+      __m512 vo0p1 = _mm512_mul_ps(vi1_even, vk12);
+      vo0p0 = _mm512_fmadd_ps(vi2_even, vk22, vo0p0);
+      vo0p1 = _mm512_fmadd_ps(vi3_even, vk32, vo0p1);
+      vo0p0 = _mm512_fmadd_ps(vi4_even, vk42, vo0p0);
+
+      const __m512 vi0_next_lo = _mm512_loadu_ps(i0);
+      const __m512 vi0_next_hi = _mm512_loadu_ps(i0 + 16);
+      i0 += 32;
+      const __m512 vi1_next_lo = _mm512_loadu_ps(i1);
+      const __m512 vi1_next_hi = _mm512_loadu_ps(i1 + 16);
+      i1 += 32;
+      const __m512 vi2_next_lo = _mm512_loadu_ps(i2);
+      const __m512 vi2_next_hi = _mm512_loadu_ps(i2 + 16);
+      i2 += 32;
+      const __m512 vi3_next_lo = _mm512_loadu_ps(i3);
+      const __m512 vi3_next_hi = _mm512_loadu_ps(i3 + 16);
+      i3 += 32;
+      const __m512 vi4_next_lo = _mm512_loadu_ps(i4);
+      const __m512 vi4_next_hi = _mm512_loadu_ps(i4 + 16);
+      i4 += 32;
+
+      vo0p1 = _mm512_fmadd_ps(vi0_odd, vk03, vo0p1);
+      vo0p0 = _mm512_fmadd_ps(vi1_odd, vk13, vo0p0);
+      vo0p1 = _mm512_fmadd_ps(vi2_odd, vk23, vo0p1);
+      vo0p0 = _mm512_fmadd_ps(vi3_odd, vk33, vo0p0);
+      vo0p1 = _mm512_fmadd_ps(vi4_odd, vk43, vo0p1);
+
+      const __m512 vi0_even_left = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi0_even), _mm512_castps_si512(vi0_prev_even), 15));
+      vi0_prev_even = vi0_even;
+      const __m512 vi1_even_left = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi1_even), _mm512_castps_si512(vi1_prev_even), 15));
+      vi1_prev_even = vi1_even;
+      const __m512 vi2_even_left = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi2_even), _mm512_castps_si512(vi2_prev_even), 15));
+      vi2_prev_even = vi2_even;
+      const __m512 vi3_even_left = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi3_even), _mm512_castps_si512(vi3_prev_even), 15));
+      vi3_prev_even = vi3_even;
+      const __m512 vi4_even_left = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi4_even), _mm512_castps_si512(vi4_prev_even), 15));
+      vi4_prev_even = vi4_even;
+
+      vo0p0 = _mm512_fmadd_ps(vi0_even_left, vk00, vo0p0);
+      vo0p1 = _mm512_fmadd_ps(vi1_even_left, vk10, vo0p1);
+      vo0p0 = _mm512_fmadd_ps(vi2_even_left, vk20, vo0p0);
+      vo0p1 = _mm512_fmadd_ps(vi3_even_left, vk30, vo0p1);
+      vo0p0 = _mm512_fmadd_ps(vi4_even_left, vk40, vo0p0);
+
+      const __m512 vi0_odd_left = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi0_odd), _mm512_castps_si512(vi0_prev_odd), 15));
+      vi0_prev_odd = vi0_odd;
+      const __m512 vi1_odd_left = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi1_odd), _mm512_castps_si512(vi1_prev_odd), 15));
+      vi1_prev_odd = vi1_odd;
+      const __m512 vi2_odd_left = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi2_odd), _mm512_castps_si512(vi2_prev_odd), 15));
+      vi2_prev_odd = vi2_odd;
+      const __m512 vi3_odd_left = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi3_odd), _mm512_castps_si512(vi3_prev_odd), 15));
+      vi3_prev_odd = vi3_odd;
+      const __m512 vi4_odd_left = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi4_odd), _mm512_castps_si512(vi4_prev_odd), 15));
+      vi4_prev_odd = vi4_odd;
+
+      vo0p1 = _mm512_fmadd_ps(vi0_odd_left, vk01, vo0p1);
+      vo0p0 = _mm512_fmadd_ps(vi1_odd_left, vk11, vo0p0);
+      vo0p1 = _mm512_fmadd_ps(vi2_odd_left, vk21, vo0p1);
+      vo0p0 = _mm512_fmadd_ps(vi3_odd_left, vk31, vo0p0);
+      vo0p1 = _mm512_fmadd_ps(vi4_odd_left, vk41, vo0p1);
+
+      const __m512 vi0_next_even = _mm512_permutex2var_ps(vi0_next_lo, vidx_even, vi0_next_hi);
+      const __m512 vi0_next_odd = _mm512_permutex2var_ps(vi0_next_lo, vidx_odd, vi0_next_hi);
+      const __m512 vi1_next_even = _mm512_permutex2var_ps(vi1_next_lo, vidx_even, vi1_next_hi);
+      const __m512 vi1_next_odd = _mm512_permutex2var_ps(vi1_next_lo, vidx_odd, vi1_next_hi);
+      const __m512 vi2_next_even = _mm512_permutex2var_ps(vi2_next_lo, vidx_even, vi2_next_hi);
+      const __m512 vi2_next_odd = _mm512_permutex2var_ps(vi2_next_lo, vidx_odd, vi2_next_hi);
+      const __m512 vi3_next_even = _mm512_permutex2var_ps(vi3_next_lo, vidx_even, vi3_next_hi);
+      const __m512 vi3_next_odd = _mm512_permutex2var_ps(vi3_next_lo, vidx_odd, vi3_next_hi);
+      const __m512 vi4_next_even = _mm512_permutex2var_ps(vi4_next_lo, vidx_even, vi4_next_hi);
+      const __m512 vi4_next_odd = _mm512_permutex2var_ps(vi4_next_lo, vidx_odd, vi4_next_hi);
+
+      const __m512 vi0_even_right = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi0_next_even), _mm512_castps_si512(vi0_even), 1));
+      vi0_even = vi0_next_even;
+      vi0_odd = vi0_next_odd;
+      const __m512 vi1_even_right = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi1_next_even), _mm512_castps_si512(vi1_even), 1));
+      vi1_even = vi1_next_even;
+      vi1_odd = vi1_next_odd;
+      const __m512 vi2_even_right = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi2_next_even), _mm512_castps_si512(vi2_even), 1));
+      vi2_even = vi2_next_even;
+      vi2_odd = vi2_next_odd;
+      const __m512 vi3_even_right = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi3_next_even), _mm512_castps_si512(vi3_even), 1));
+      vi3_even = vi3_next_even;
+      vi3_odd = vi3_next_odd;
+      const __m512 vi4_even_right = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi4_next_even), _mm512_castps_si512(vi4_even), 1));
+      vi4_even = vi4_next_even;
+      vi4_odd = vi4_next_odd;
+
+      vo0p0 = _mm512_fmadd_ps(vi0_even_right, vk04, vo0p0);
+      vo0p1 = _mm512_fmadd_ps(vi1_even_right, vk14, vo0p1);
+      vo0p0 = _mm512_fmadd_ps(vi2_even_right, vk24, vo0p0);
+      vo0p1 = _mm512_fmadd_ps(vi3_even_right, vk34, vo0p1);
+      vo0p0 = _mm512_fmadd_ps(vi4_even_right, vk44, vo0p0);
+
+      vo0p0 = _mm512_add_ps(vo0p0, vo0p1);
+
+      __m512 vo0 = _mm512_max_ps(vo0p0, vmin);
+
+      vo0 = _mm512_min_ps(vo0, vmax);
+
+      _mm512_storeu_ps(o0, vo0);
+      o0 += 16;
+    }
+    // Process the next-to-last block of 32 pixels; the last block is loaded with masks.
+    if XNN_LIKELY(w > 32 * sizeof(float)) {
+      __m512 vo0p0 = _mm512_fmadd_ps(vi0_even, vk02, vbias);
+      __m512 vo0p1 = _mm512_mul_ps(vi1_even, vk12);
+      vo0p0 = _mm512_fmadd_ps(vi2_even, vk22, vo0p0);
+      vo0p1 = _mm512_fmadd_ps(vi3_even, vk32, vo0p1);
+      vo0p0 = _mm512_fmadd_ps(vi4_even, vk42, vo0p0);
+
+      const __m512 vi0_next_lo = _mm512_maskz_loadu_ps(vmask_lo, i0);
+      const __m512 vi0_next_hi = _mm512_maskz_loadu_ps(vmask_hi, i0 + 16);
+      i0 += 32;
+      const __m512 vi1_next_lo = _mm512_maskz_loadu_ps(vmask_lo, i1);
+      const __m512 vi1_next_hi = _mm512_maskz_loadu_ps(vmask_hi, i1 + 16);
+      i1 += 32;
+      const __m512 vi2_next_lo = _mm512_maskz_loadu_ps(vmask_lo, i2);
+      const __m512 vi2_next_hi = _mm512_maskz_loadu_ps(vmask_hi, i2 + 16);
+      i2 += 32;
+      const __m512 vi3_next_lo = _mm512_maskz_loadu_ps(vmask_lo, i3);
+      const __m512 vi3_next_hi = _mm512_maskz_loadu_ps(vmask_hi, i3 + 16);
+      i3 += 32;
+      const __m512 vi4_next_lo = _mm512_maskz_loadu_ps(vmask_lo, i4);
+      const __m512 vi4_next_hi = _mm512_maskz_loadu_ps(vmask_hi, i4 + 16);
+      i4 += 32;
+
+      vo0p1 = _mm512_fmadd_ps(vi0_odd, vk03, vo0p1);
+      vo0p0 = _mm512_fmadd_ps(vi1_odd, vk13, vo0p0);
+      vo0p1 = _mm512_fmadd_ps(vi2_odd, vk23, vo0p1);
+      vo0p0 = _mm512_fmadd_ps(vi3_odd, vk33, vo0p0);
+      vo0p1 = _mm512_fmadd_ps(vi4_odd, vk43, vo0p1);
+
+      const __m512 vi0_even_left = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi0_even), _mm512_castps_si512(vi0_prev_even), 15));
+      vi0_prev_even = vi0_even;
+      const __m512 vi1_even_left = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi1_even), _mm512_castps_si512(vi1_prev_even), 15));
+      vi1_prev_even = vi1_even;
+      const __m512 vi2_even_left = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi2_even), _mm512_castps_si512(vi2_prev_even), 15));
+      vi2_prev_even = vi2_even;
+      const __m512 vi3_even_left = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi3_even), _mm512_castps_si512(vi3_prev_even), 15));
+      vi3_prev_even = vi3_even;
+      const __m512 vi4_even_left = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi4_even), _mm512_castps_si512(vi4_prev_even), 15));
+      vi4_prev_even = vi4_even;
+
+      vo0p0 = _mm512_fmadd_ps(vi0_even_left, vk00, vo0p0);
+      vo0p1 = _mm512_fmadd_ps(vi1_even_left, vk10, vo0p1);
+      vo0p0 = _mm512_fmadd_ps(vi2_even_left, vk20, vo0p0);
+      vo0p1 = _mm512_fmadd_ps(vi3_even_left, vk30, vo0p1);
+      vo0p0 = _mm512_fmadd_ps(vi4_even_left, vk40, vo0p0);
+
+      const __m512 vi0_odd_left = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi0_odd), _mm512_castps_si512(vi0_prev_odd), 15));
+      vi0_prev_odd = vi0_odd;
+      const __m512 vi1_odd_left = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi1_odd), _mm512_castps_si512(vi1_prev_odd), 15));
+      vi1_prev_odd = vi1_odd;
+      const __m512 vi2_odd_left = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi2_odd), _mm512_castps_si512(vi2_prev_odd), 15));
+      vi2_prev_odd = vi2_odd;
+      const __m512 vi3_odd_left = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi3_odd), _mm512_castps_si512(vi3_prev_odd), 15));
+      vi3_prev_odd = vi3_odd;
+      const __m512 vi4_odd_left = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi4_odd), _mm512_castps_si512(vi4_prev_odd), 15));
+      vi4_prev_odd = vi4_odd;
+
+      vo0p1 = _mm512_fmadd_ps(vi0_odd_left, vk01, vo0p1);
+      vo0p0 = _mm512_fmadd_ps(vi1_odd_left, vk11, vo0p0);
+      vo0p1 = _mm512_fmadd_ps(vi2_odd_left, vk21, vo0p1);
+      vo0p0 = _mm512_fmadd_ps(vi3_odd_left, vk31, vo0p0);
+      vo0p1 = _mm512_fmadd_ps(vi4_odd_left, vk41, vo0p1);
+
+      const __m512 vi0_next_even = _mm512_permutex2var_ps(vi0_next_lo, vidx_even, vi0_next_hi);
+      const __m512 vi0_next_odd = _mm512_permutex2var_ps(vi0_next_lo, vidx_odd, vi0_next_hi);
+      const __m512 vi1_next_even = _mm512_permutex2var_ps(vi1_next_lo, vidx_even, vi1_next_hi);
+      const __m512 vi1_next_odd = _mm512_permutex2var_ps(vi1_next_lo, vidx_odd, vi1_next_hi);
+      const __m512 vi2_next_even = _mm512_permutex2var_ps(vi2_next_lo, vidx_even, vi2_next_hi);
+      const __m512 vi2_next_odd = _mm512_permutex2var_ps(vi2_next_lo, vidx_odd, vi2_next_hi);
+      const __m512 vi3_next_even = _mm512_permutex2var_ps(vi3_next_lo, vidx_even, vi3_next_hi);
+      const __m512 vi3_next_odd = _mm512_permutex2var_ps(vi3_next_lo, vidx_odd, vi3_next_hi);
+      const __m512 vi4_next_even = _mm512_permutex2var_ps(vi4_next_lo, vidx_even, vi4_next_hi);
+      const __m512 vi4_next_odd = _mm512_permutex2var_ps(vi4_next_lo, vidx_odd, vi4_next_hi);
+
+      const __m512 vi0_even_right = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi0_next_even), _mm512_castps_si512(vi0_even), 1));
+      vi0_even = vi0_next_even;
+      vi0_odd = vi0_next_odd;
+      const __m512 vi1_even_right = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi1_next_even), _mm512_castps_si512(vi1_even), 1));
+      vi1_even = vi1_next_even;
+      vi1_odd = vi1_next_odd;
+      const __m512 vi2_even_right = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi2_next_even), _mm512_castps_si512(vi2_even), 1));
+      vi2_even = vi2_next_even;
+      vi2_odd = vi2_next_odd;
+      const __m512 vi3_even_right = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi3_next_even), _mm512_castps_si512(vi3_even), 1));
+      vi3_even = vi3_next_even;
+      vi3_odd = vi3_next_odd;
+      const __m512 vi4_even_right = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi4_next_even), _mm512_castps_si512(vi4_even), 1));
+      vi4_even = vi4_next_even;
+      vi4_odd = vi4_next_odd;
+
+      vo0p0 = _mm512_fmadd_ps(vi0_even_right, vk04, vo0p0);
+      vo0p1 = _mm512_fmadd_ps(vi1_even_right, vk14, vo0p1);
+      vo0p0 = _mm512_fmadd_ps(vi2_even_right, vk24, vo0p0);
+      vo0p1 = _mm512_fmadd_ps(vi3_even_right, vk34, vo0p1);
+      vo0p0 = _mm512_fmadd_ps(vi4_even_right, vk44, vo0p0);
+
+      vo0p0 = _mm512_add_ps(vo0p0, vo0p1);
+
+      __m512 vo0 = _mm512_max_ps(vo0p0, vmin);
+
+      vo0 = _mm512_min_ps(vo0, vmax);
+
+      _mm512_storeu_ps(o0, vo0);
+      o0 += 16;
+
+      w -= 32 * sizeof(float);
+    }
+    // Always process the last block of 1..32 pixels.
+    assert(w >= 1 * sizeof(float));
+    assert(w <= 32 * sizeof(float));
+    {
+      __m512 vo0p0 = _mm512_fmadd_ps(vi0_even, vk02, vbias);
+      __m512 vo0p1 = _mm512_mul_ps(vi1_even, vk12);
+      vo0p0 = _mm512_fmadd_ps(vi2_even, vk22, vo0p0);
+      vo0p1 = _mm512_fmadd_ps(vi3_even, vk32, vo0p1);
+      vo0p0 = _mm512_fmadd_ps(vi4_even, vk42, vo0p0);
+
+      vo0p1 = _mm512_fmadd_ps(vi0_odd, vk03, vo0p1);
+      vo0p0 = _mm512_fmadd_ps(vi1_odd, vk13, vo0p0);
+      vo0p1 = _mm512_fmadd_ps(vi2_odd, vk23, vo0p1);
+      vo0p0 = _mm512_fmadd_ps(vi3_odd, vk33, vo0p0);
+      vo0p1 = _mm512_fmadd_ps(vi4_odd, vk43, vo0p1);
+
+      const __m512 vi0_even_left = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi0_even), _mm512_castps_si512(vi0_prev_even), 15));
+      const __m512 vi1_even_left = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi1_even), _mm512_castps_si512(vi1_prev_even), 15));
+      const __m512 vi2_even_left = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi2_even), _mm512_castps_si512(vi2_prev_even), 15));
+      const __m512 vi3_even_left = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi3_even), _mm512_castps_si512(vi3_prev_even), 15));
+      const __m512 vi4_even_left = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi4_even), _mm512_castps_si512(vi4_prev_even), 15));
+
+      vo0p0 = _mm512_fmadd_ps(vi0_even_left, vk00, vo0p0);
+      vo0p1 = _mm512_fmadd_ps(vi1_even_left, vk10, vo0p1);
+      vo0p0 = _mm512_fmadd_ps(vi2_even_left, vk20, vo0p0);
+      vo0p1 = _mm512_fmadd_ps(vi3_even_left, vk30, vo0p1);
+      vo0p0 = _mm512_fmadd_ps(vi4_even_left, vk40, vo0p0);
+
+      const __m512 vi0_odd_left = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi0_odd), _mm512_castps_si512(vi0_prev_odd), 15));
+      const __m512 vi1_odd_left = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi1_odd), _mm512_castps_si512(vi1_prev_odd), 15));
+      const __m512 vi2_odd_left = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi2_odd), _mm512_castps_si512(vi2_prev_odd), 15));
+      const __m512 vi3_odd_left = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi3_odd), _mm512_castps_si512(vi3_prev_odd), 15));
+      const __m512 vi4_odd_left = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vi4_odd), _mm512_castps_si512(vi4_prev_odd), 15));
+
+      vo0p1 = _mm512_fmadd_ps(vi0_odd_left, vk01, vo0p1);
+      vo0p0 = _mm512_fmadd_ps(vi1_odd_left, vk11, vo0p0);
+      vo0p1 = _mm512_fmadd_ps(vi2_odd_left, vk21, vo0p1);
+      vo0p0 = _mm512_fmadd_ps(vi3_odd_left, vk31, vo0p0);
+      vo0p1 = _mm512_fmadd_ps(vi4_odd_left, vk41, vo0p1);
+
+      const __m512 vi0_even_right = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_setzero_si512(), _mm512_castps_si512(vi0_even), 1));
+      const __m512 vi1_even_right = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_setzero_si512(), _mm512_castps_si512(vi1_even), 1));
+      const __m512 vi2_even_right = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_setzero_si512(), _mm512_castps_si512(vi2_even), 1));
+      const __m512 vi3_even_right = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_setzero_si512(), _mm512_castps_si512(vi3_even), 1));
+      const __m512 vi4_even_right = _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_setzero_si512(), _mm512_castps_si512(vi4_even), 1));
+
+      vo0p0 = _mm512_fmadd_ps(vi0_even_right, vk04, vo0p0);
+      vo0p1 = _mm512_fmadd_ps(vi1_even_right, vk14, vo0p1);
+      vo0p0 = _mm512_fmadd_ps(vi2_even_right, vk24, vo0p0);
+      vo0p1 = _mm512_fmadd_ps(vi3_even_right, vk34, vo0p1);
+      vo0p0 = _mm512_fmadd_ps(vi4_even_right, vk44, vo0p0);
+
+      vo0p0 = _mm512_add_ps(vo0p0, vo0p1);
+
+      __m512 vo0 = _mm512_max_ps(vo0p0, vmin);
+
+      vo0 = _mm512_min_ps(vo0, vmax);
+
+      const size_t w_tmp = (w + 1 * sizeof(float)) / (2 * sizeof(float));
+      const __mmask16 vmask_output = _cvtu32_mask16((UINT32_C(1) << w_tmp) - UINT32_C(1));
+      _mm512_mask_storeu_ps(o0, vmask_output, vo0);
+      o0 += w_tmp;
+    }
+
+    i0 = (const float*) ((uintptr_t) i2 - input_decrement);
+    i1 = (const float*) ((uintptr_t) i3 - input_decrement);
+    i2 = (const float*) ((uintptr_t) i4 - input_decrement);
+    i3 = (const float*) ((uintptr_t) i2 + input_width);
+    i4 = (const float*) ((uintptr_t) i3 + input_width);
+
+
+    output_height -= 1;
+    padded_input_height -= 2;
+  } while (output_height != 0);
+}
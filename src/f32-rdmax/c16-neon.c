@@ -0,0 +1,73 @@
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <arm_neon.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/rmax.h>
+
+
+void xnn_f32_rdmax_ukernel_c16__neon(
+    size_t rows,
+    size_t channels,
+    const float* input,
+    size_t input_stride,
+    float* output,
+    const union xnn_f32_default_params params[restrict XNN_MIN_ELEMENTS(1)]) XNN_OOB_READS
+{
+  assert(rows != 0);
+  assert(channels != 0);
+
+  for (; channels >= 16; channels -= 16) {
+    const float* i = input;
+    float32x4_t vmax0123 = vld1q_f32(i);
+    float32x4_t vmax4567 = vld1q_f32(i + 4);
+    float32x4_t vmax89AB = vld1q_f32(i + 8);
+    float32x4_t vmaxCDEF = vld1q_f32(i + 12);
+    for (size_t r = rows - 1; r != 0; r--) {
+      i = (const float*) ((uintptr_t) i + input_stride);
+      vmax0123 = vmaxq_f32(vmax0123, vld1q_f32(i));
+      vmax4567 = vmaxq_f32(vmax4567, vld1q_f32(i + 4));
+      vmax89AB = vmaxq_f32(vmax89AB, vld1q_f32(i + 8));
+      vmaxCDEF = vmaxq_f32(vmaxCDEF, vld1q_f32(i + 12));
+    }
+    input += 16;
+
+    vst1q_f32(output, vmax0123); output += 4;
+    vst1q_f32(output, vmax4567); output += 4;
+    vst1q_f32(output, vmax89AB); output += 4;
+    vst1q_f32(output, vmaxCDEF); output += 4;
+  }
+  for (; channels >= 4; channels -= 4) {
+    const float* i = input;
+    float32x4_t vmax = vld1q_f32(i);
+    for (size_t r = rows - 1; r != 0; r--) {
+      i = (const float*) ((uintptr_t) i + input_stride);
+      vmax = vmaxq_f32(vmax, vld1q_f32(i));
+    }
+    input += 4;
+
+    vst1q_f32(output, vmax); output += 4;
+  }
+  if XNN_UNLIKELY(channels != 0) {
+    const float* i = input;
+    float32x4_t vmax = vld1q_f32(i);
+    for (size_t r = rows - 1; r != 0; r--) {
+      i = (const float*) ((uintptr_t) i + input_stride);
+      vmax = vmaxq_f32(vmax, vld1q_f32(i));
+    }
+
+    float32x2_t vmax_lo = vget_low_f32(vmax);
+    if (channels & 2) {
+      vst1_f32(output, vmax_lo); output += 2;
+      vmax_lo = vget_high_f32(vmax);
+    }
+    if (channels & 1) {
+      vst1_lane_f32(output, vmax_lo, 0);
+    }
+  }
+}
@@ -0,0 +1,75 @@
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <xmmintrin.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/rmax.h>
+
+
+void xnn_f32_rdmax_ukernel_c16__sse(
+    size_t rows,
+    size_t channels,
+    const float* input,
+    size_t input_stride,
+    float* output,
+    const union xnn_f32_default_params params[restrict XNN_MIN_ELEMENTS(1)]) XNN_OOB_READS
+{
+  assert(rows != 0);
+  assert(channels != 0);
+
+  for (; channels >= 16; channels -= 16) {
+    const float* i = input;
+    __m128 vmax0123 = _mm_loadu_ps(i);
+    __m128 vmax4567 = _mm_loadu_ps(i + 4);
+    __m128 vmax89AB = _mm_loadu_ps(i + 8);
+    __m128 vmaxCDEF = _mm_loadu_ps(i + 12);
+    for (size_t r = rows - 1; r != 0; r--) {
+      i = (const float*) ((uintptr_t) i + input_stride);
+      vmax0123 = _mm_max_ps(vmax0123, _mm_loadu_ps(i));
+      vmax4567 = _mm_max_ps(vmax4567, _mm_loadu_ps(i + 4));
+      vmax89AB = _mm_max_ps(vmax89AB, _mm_loadu_ps(i + 8));
+      vmaxCDEF = _mm_max_ps(vmaxCDEF, _mm_loadu_ps(i + 12));
+    }
+    input += 16;
+
+    _mm_storeu_ps(output, vmax0123);
+    _mm_storeu_ps(output + 4, vmax4567);
+    _mm_storeu_ps(output + 8, vmax89AB);
+    _mm_storeu_ps(output + 12, vmaxCDEF);
+    output += 16;
+  }
+  for (; channels >= 4; channels -= 4) {
+    const float* i = input;
+    __m128 vmax = _mm_loadu_ps(i);
+    for (size_t r = rows - 1; r != 0; r--) {
+      i = (const float*) ((uintptr_t) i + input_stride);
+      vmax = _mm_max_ps(vmax, _mm_loadu_ps(i));
+    }
+    input += 4;
+
+    _mm_storeu_ps(output, vmax);
+    output += 4;
+  }
+  if XNN_UNLIKELY(channels != 0) {
+    const float* i = input;
+    __m128 vmax = _mm_loadu_ps(i);
+    for (size_t r = rows - 1; r != 0; r--) {
+      i = (const float*) ((uintptr_t) i + input_stride);
+      vmax = _mm_max_ps(vmax, _mm_loadu_ps(i));
+    }
+
+    if (channels & 2) {
+      _mm_storel_pi((__m64*) output, vmax);
+      vmax = _mm_movehl_ps(vmax, vmax);
+      output += 2;
+    }
+    if (channels & 1) {
+      _mm_store_ss(output, vmax);
+    }
+  }
+}
@@ -0,0 +1,58 @@
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/math.h>
+#include <xnnpack/rmax.h>
+
+
+void xnn_f32_rdmax_ukernel_c4__scalar(
+    size_t rows,
+    size_t channels,
+    const float* input,
+    size_t input_stride,
+    float* output,
+    const union xnn_f32_default_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(rows != 0);
+  assert(channels != 0);
+
+  for (; channels >= 4; channels -= 4) {
+    const float* i = input;
+    float vmax0 = i[0];
+    float vmax1 = i[1];
+    float vmax2 = i[2];
+    float vmax3 = i[3];
+    for (size_t r = rows - 1; r != 0; r--) {
+      i = (const float*) ((uintptr_t) i + input_stride);
+      vmax0 = math_max_f32(vmax0, i[0]);
+      vmax1 = math_max_f32(vmax1, i[1]);
+      vmax2 = math_max_f32(vmax2, i[2]);
+      vmax3 = math_max_f32(vmax3, i[3]);
+    }
+    input += 4;
+
+    output[0] = vmax0;
+    output[1] = vmax1;
+    output[2] = vmax2;
+    output[3] = vmax3;
+    output += 4;
+  }
+  if XNN_UNLIKELY(channels != 0) {
+    do {
+      const float* i = input;
+      float vmax = *i;
+      for (size_t r = rows - 1; r != 0; r--) {
+        i = (const float*) ((uintptr_t) i + input_stride);
+        vmax = math_max_f32(vmax, *i);
+      }
+      input += 1;
+
+      *output++ = vmax;
+    } while (--channels != 0);
+  }
+}
@@ -0,0 +1,130 @@
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <immintrin.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/rmeanvar.h>
+
+
+void xnn_f32_rmeanvar_ukernel__avx(
+    size_t n,
+    const float* x,
+    float* mean,
+    float* variance)
+{
+  assert(n != 0);
+  assert(n % sizeof(float) == 0);
+
+  // Every lane of every accumulator runs its own Welford recurrence:
+  //   delta := x - mean
+  //   mean := mean + delta / count
+  //   m2 := m2 + delta * (x - mean)
+  // All lanes see the same number of elements, so the reciprocal of the element count is shared between them.
+  __m256 vmean0 = _mm256_setzero_ps();
+  __m256 vmean1 = _mm256_setzero_ps();
+  __m256 vmean2 = _mm256_setzero_ps();
+  __m256 vmean3 = _mm256_setzero_ps();
+  __m256 vm2_0 = _mm256_setzero_ps();
+  __m256 vm2_1 = _mm256_setzero_ps();
+  __m256 vm2_2 = _mm256_setzero_ps();
+  __m256 vm2_3 = _mm256_setzero_ps();
+  float vcount = 0.0f;
+  for (; n >= 32 * sizeof(float); n -= 32 * sizeof(float)) {
+    const __m256 vx0 = _mm256_loadu_ps(x);
+    const __m256 vx1 = _mm256_loadu_ps(x + 8);
+    const __m256 vx2 = _mm256_loadu_ps(x + 16);
+    const __m256 vx3 = _mm256_loadu_ps(x + 24);
+    x += 32;
+
+    vcount += 1.0f;
+    const __m256 vrcp_count = _mm256_set1_ps(1.0f / vcount);
+
+    const __m256 vdelta0 = _mm256_sub_ps(vx0, vmean0);
+    const __m256 vdelta1 = _mm256_sub_ps(vx1, vmean1);
+    const __m256 vdelta2 = _mm256_sub_ps(vx2, vmean2);
+    const __m256 vdelta3 = _mm256_sub_ps(vx3, vmean3);
+
+    vmean0 = _mm256_add_ps(vmean0, _mm256_mul_ps(vdelta0, vrcp_count));
+    vmean1 = _mm256_add_ps(vmean1, _mm256_mul_ps(vdelta1, vrcp_count));
+    vmean2 = _mm256_add_ps(vmean2, _mm256_mul_ps(vdelta2, vrcp_count));
+    vmean3 = _mm256_add_ps(vmean3, _mm256_mul_ps(vdelta3, vrcp_count));
+
+    vm2_0 = _mm256_add_ps(vm2_0, _mm256_mul_ps(vdelta0, _mm256_sub_ps(vx0, vmean0)));
+    vm2_1 = _mm256_add_ps(vm2_1, _mm256_mul_ps(vdelta1, _mm256_sub_ps(vx1, vmean1)));
+    vm2_2 = _mm256_add_ps(vm2_2, _mm256_mul_ps(vdelta2, _mm256_sub_ps(vx2, vmean2)));
+    vm2_3 = _mm256_add_ps(vm2_3, _mm256_mul_ps(vdelta3, _mm256_sub_ps(vx3, vmean3)));
+  }
+
+  // Merge pairs of accumulators with equal element counts (Chan et al.):
+  //   mean := (mean_a + mean_b) / 2
+  //   m2 := m2_a + m2_b + (mean_b - mean_a)**2 * count / 2
+  const __m256 vhalf = _mm256_set1_ps(0.5f);
+  __m256 vhalf_count = _mm256_set1_ps(vcount * 0.5f);
+  const __m256 vdelta01 = _mm256_sub_ps(vmean1, vmean0);
+  const __m256 vdelta23 = _mm256_sub_ps(vmean3, vmean2);
+  const __m256 vmean01 = _mm256_add_ps(vmean0, _mm256_mul_ps(vdelta01, vhalf));
+  const __m256 vmean23 = _mm256_add_ps(vmean2, _mm256_mul_ps(vdelta23, vhalf));
+  const __m256 vm2_01 = _mm256_add_ps(_mm256_add_ps(vm2_0, vm2_1), _mm256_mul_ps(_mm256_mul_ps(vdelta01, vdelta01), vhalf_count));
+  const __m256 vm2_23 = _mm256_add_ps(_mm256_add_ps(vm2_2, vm2_3), _mm256_mul_ps(_mm256_mul_ps(vdelta23, vdelta23), vhalf_count));
+  vcount += vcount;
+
+  vhalf_count = _mm256_set1_ps(vcount * 0.5f);
+  const __m256 vdelta0123 = _mm256_sub_ps(vmean23, vmean01);
+  __m256 vmean = _mm256_add_ps(vmean01, _mm256_mul_ps(vdelta0123, vhalf));
+  __m256 vm2 = _mm256_add_ps(_mm256_add_ps(vm2_01, vm2_23), _mm256_mul_ps(_mm256_mul_ps(vdelta0123, vdelta0123), vhalf_count));
+  vcount += vcount;
+
+  for (; n >= 8 * sizeof(float); n -= 8 * sizeof(float)) {
+    const __m256 vx = _mm256_loadu_ps(x);
+    x += 8;
+
+    vcount += 1.0f;
+    const __m256 vrcp_count = _mm256_set1_ps(1.0f / vcount);
+
+    const __m256 vdelta = _mm256_sub_ps(vx, vmean);
+    vmean = _mm256_add_ps(vmean, _mm256_mul_ps(vdelta, vrcp_count));
+    vm2 = _mm256_add_ps(vm2, _mm256_mul_ps(vdelta, _mm256_sub_ps(vx, vmean)));
+  }
+
+  // Merge the lanes of the accumulator.
+  const __m128 vhalf_lo = _mm256_castps256_ps128(vhalf);
+  __m128 vhalf_count_lo = _mm_set1_ps(vcount * 0.5f);
+  __m128 vmean_lo = _mm256_castps256_ps128(vmean);
+  __m128 vm2_lo = _mm256_castps256_ps128(vm2);
+  const __m128 vdelta_hi = _mm_sub_ps(_mm256_extractf128_ps(vmean, 1), vmean_lo);
+  vmean_lo = _mm_add_ps(vmean_lo, _mm_mul_ps(vdelta_hi, vhalf_lo));
+  vm2_lo = _mm_add_ps(_mm_add_ps(vm2_lo, _mm256_extractf128_ps(vm2, 1)), _mm_mul_ps(_mm_mul_ps(vdelta_hi, vdelta_hi), vhalf_count_lo));
+  vcount += vcount;
+
+  vhalf_count_lo = _mm_set1_ps(vcount * 0.5f);
+  const __m128 vdelta_lh = _mm_sub_ps(_mm_movehl_ps(vmean_lo, vmean_lo), vmean_lo);
+  vmean_lo = _mm_add_ps(vmean_lo, _mm_mul_ps(vdelta_lh, vhalf_lo));
+  vm2_lo = _mm_add_ps(_mm_add_ps(vm2_lo, _mm_movehl_ps(vm2_lo, vm2_lo)), _mm_mul_ps(_mm_mul_ps(vdelta_lh, vdelta_lh), vhalf_count_lo));
+  vcount += vcount;
+
+  vhalf_count_lo = _mm_set_ss(vcount * 0.5f);
+  const __m128 vdelta_odd = _mm_sub_ss(_mm_movehdup_ps(vmean_lo), vmean_lo);
+  vmean_lo = _mm_add_ss(vmean_lo, _mm_mul_ss(vdelta_odd, vhalf_lo));
+  vm2_lo = _mm_add_ss(_mm_add_ss(vm2_lo, _mm_movehdup_ps(vm2_lo)), _mm_mul_ss(_mm_mul_ss(vdelta_odd, vdelta_odd), vhalf_count_lo));
+  vcount += vcount;
+
+  float vmean_ll = _mm_cvtss_f32(vmean_lo);
+  float vm2_ll = _mm_cvtss_f32(vm2_lo);
+  if XNN_UNLIKELY(n != 0) {
+    do {
+      const float vx = *x++;
+      vcount += 1.0f;
+      const float vdelta = vx - vmean_ll;
+      vmean_ll += vdelta / vcount;
+      vm2_ll += vdelta * (vx - vmean_ll);
+      n -= sizeof(float);
+    } while (n != 0);
+  }
+  *mean = vmean_ll;
+  *variance = vm2_ll / vcount;
+}
@@ -0,0 +1,141 @@
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <immintrin.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/intrinsics-polyfill.h>
+#include <xnnpack/rmeanvar.h>
+
+
+void xnn_f32_rmeanvar_ukernel__avx512f(
+    size_t n,
+    const float* x,
+    float* mean,
+    float* variance)
+{
+  assert(n != 0);
+  assert(n % sizeof(float) == 0);
+
+  // Every lane of every accumulator runs its own Welford recurrence:
+  //   delta := x - mean
+  //   mean := mean + delta / count
+  //   m2 := m2 + delta * (x - mean)
+  // All lanes see the same number of elements, so the reciprocal of the element count is shared between them.
+  __m512 vmean0 = _mm512_setzero_ps();
+  __m512 vmean1 = _mm512_setzero_ps();
+  __m512 vmean2 = _mm512_setzero_ps();
+  __m512 vmean3 = _mm512_setzero_ps();
+  __m512 vm2_0 = _mm512_setzero_ps();
+  __m512 vm2_1 = _mm512_setzero_ps();
+  __m512 vm2_2 = _mm512_setzero_ps();
+  __m512 vm2_3 = _mm512_setzero_ps();
+  float vcount = 0.0f;
+  for (; n >= 64 * sizeof(float); n -= 64 * sizeof(float)) {
+    const __m512 vx0 = _mm512_loadu_ps(x);
+    const __m512 vx1 = _mm512_loadu_ps(x + 16);
+    const __m512 vx2 = _mm512_loadu_ps(x + 32);
+    const __m512 vx3 = _mm512_loadu_ps(x + 48);
+    x += 64;
+
+    vcount += 1.0f;
+    const __m512 vrcp_count = _mm512_set1_ps(1.0f / vcount);
+
+    const __m512 vdelta0 = _mm512_sub_ps(vx0, vmean0);
+    const __m512 vdelta1 = _mm512_sub_ps(vx1, vmean1);
+    const __m512 vdelta2 = _mm512_sub_ps(vx2, vmean2);
+    const __m512 vdelta3 = _mm512_sub_ps(vx3, vmean3);
+
+    vmean0 = _mm512_fmadd_ps(vdelta0, vrcp_count, vmean0);
+    vmean1 = _mm512_fmadd_ps(vdelta1, vrcp_count, vmean1);
+    vmean2 = _mm512_fmadd_ps(vdelta2, vrcp_count, vmean2);
+    vmean3 = _mm512_fmadd_ps(vdelta3, vrcp_count, vmean3);
+
+    vm2_0 = _mm512_fmadd_ps(vdelta0, _mm512_sub_ps(vx0, vmean0), vm2_0);
+    vm2_1 = _mm512_fmadd_ps(vdelta1, _mm512_sub_ps(vx1, vmean1), vm2_1);
+    vm2_2 = _mm512_fmadd_ps(vdelta2, _mm512_sub_ps(vx2, vmean2), vm2_2);
+    vm2_3 = _mm512_fmadd_ps(vdelta3, _mm512_sub_ps(vx3, vmean3), vm2_3);
+  }
+
+  // Merge pairs of accumulators with equal element counts (Chan et al.):
+  //   mean := (mean_a + mean_b) / 2
+  //   m2 := m2_a + m2_b + (mean_b - mean_a)**2 * count / 2
+  const __m512 vhalf = _mm512_set1_ps(0.5f);
+  __m512 vhalf_count = _mm512_set1_ps(vcount * 0.5f);
+  const __m512 vdelta01 = _mm512_sub_ps(vmean1, vmean0);
+  const __m512 vdelta23 = _mm512_sub_ps(vmean3, vmean2);
+  const __m512 vmean01 = _mm512_fmadd_ps(vdelta01, vhalf, vmean0);
+  const __m512 vmean23 = _mm512_fmadd_ps(vdelta23, vhalf, vmean2);
+  const __m512 vm2_01 = _mm512_fmadd_ps(_mm512_mul_ps(vdelta01, vdelta01), vhalf_count, _mm512_add_ps(vm2_0, vm2_1));
+  const __m512 vm2_23 = _mm512_fmadd_ps(_mm512_mul_ps(vdelta23, vdelta23), vhalf_count, _mm512_add_ps(vm2_2, vm2_3));
+  vcount += vcount;
+
+  vhalf_count = _mm512_set1_ps(vcount * 0.5f);
+  const __m512 vdelta0123 = _mm512_sub_ps(vmean23, vmean01);
+  __m512 vmean = _mm512_fmadd_ps(vdelta0123, vhalf, vmean01);
+  __m512 vm2 = _mm512_fmadd_ps(_mm512_mul_ps(vdelta0123, vdelta0123), vhalf_count, _mm512_add_ps(vm2_01, vm2_23));
+  vcount += vcount;
+
+  for (; n >= 16 * sizeof(float); n -= 16 * sizeof(float)) {
+    const __m512 vx = _mm512_loadu_ps(x);
+    x += 16;
+
+    vcount += 1.0f;
+    const __m512 vrcp_count = _mm512_set1_ps(1.0f / vcount);
+
+    const __m512 vdelta = _mm512_sub_ps(vx, vmean);
+    vmean = _mm512_fmadd_ps(vdelta, vrcp_count, vmean);
+    vm2 = _mm512_fmadd_ps(vdelta, _mm512_sub_ps(vx, vmean), vm2);
+  }
+
+  // Merge the lanes of the accumulator.
+  const __m256 vhalf_lo = _mm512_castps512_ps256(vhalf);
+  const __m256 vhalf_count_lo = _mm256_set1_ps(vcount * 0.5f);
+  __m256 vmean_lo = _mm512_castps512_ps256(vmean);
+  __m256 vm2_lo = _mm512_castps512_ps256(vm2);
+  const __m256 vdelta_hi = _mm256_sub_ps(_mm512_castps512_ps256(_mm512_shuffle_f32x4(vmean, vmean, _MM_SHUFFLE(3, 2, 3, 2))), vmean_lo);
+  vmean_lo = _mm256_add_ps(vmean_lo, _mm256_mul_ps(vdelta_hi, vhalf_lo));
+  vm2_lo = _mm256_add_ps(_mm256_add_ps(vm2_lo, _mm512_castps512_ps256(_mm512_shuffle_f32x4(vm2, vm2, _MM_SHUFFLE(3, 2, 3, 2)))),
+    _mm256_mul_ps(_mm256_mul_ps(vdelta_hi, vdelta_hi), vhalf_count_lo));
+  vcount += vcount;
+
+  const __m128 vhalf_ll = _mm256_castps256_ps128(vhalf_lo);
+  __m128 vhalf_count_ll = _mm_set1_ps(vcount * 0.5f);
+  __m128 vmean_ll = _mm256_castps256_ps128(vmean_lo);
+  __m128 vm2_ll = _mm256_castps256_ps128(vm2_lo);
+  const __m128 vdelta_lh = _mm_sub_ps(_mm256_extractf128_ps(vmean_lo, 1), vmean_ll);
+  vmean_ll = _mm_add_ps(vmean_ll, _mm_mul_ps(vdelta_lh, vhalf_ll));
+  vm2_ll = _mm_add_ps(_mm_add_ps(vm2_ll, _mm256_extractf128_ps(vm2_lo, 1)), _mm_mul_ps(_mm_mul_ps(vdelta_lh, vdelta_lh), vhalf_count_ll));
+  vcount += vcount;
+
+  vhalf_count_ll = _mm_set1_ps(vcount * 0.5f);
+  const __m128 vdelta_llh = _mm_sub_ps(_mm_movehl_ps(vmean_ll, vmean_ll), vmean_ll);
+  vmean_ll = _mm_add_ps(vmean_ll, _mm_mul_ps(vdelta_llh, vhalf_ll));
+  vm2_ll = _mm_add_ps(_mm_add_ps(vm2_ll, _mm_movehl_ps(vm2_ll, vm2_ll)), _mm_mul_ps(_mm_mul_ps(vdelta_llh, vdelta_llh), vhalf_count_ll));
+  vcount += vcount;
+
+  vhalf_count_ll = _mm_set_ss(vcount * 0.5f);
+  const __m128 vdelta_odd = _mm_sub_ss(_mm_movehdup_ps(vmean_ll), vmean_ll);
+  vmean_ll = _mm_add_ss(vmean_ll, _mm_mul_ss(vdelta_odd, vhalf_ll));
+  vm2_ll = _mm_add_ss(_mm_add_ss(vm2_ll, _mm_movehdup_ps(vm2_ll)), _mm_mul_ss(_mm_mul_ss(vdelta_odd, vdelta_odd), vhalf_count_ll));
+  vcount += vcount;
+
+  float vmean_lll = _mm_cvtss_f32(vmean_ll);
+  float vm2_lll = _mm_cvtss_f32(vm2_ll);
+  if XNN_UNLIKELY(n != 0) {
+    do {
+      const float vx = *x++;
+      vcount += 1.0f;
+      const float vdelta = vx - vmean_lll;
+      vmean_lll += vdelta / vcount;
+      vm2_lll += vdelta * (vx - vmean_lll);
+      n -= sizeof(float);
+    } while (n != 0);
+  }
+  *mean = vmean_lll;
+  *variance = vm2_lll / vcount;
+}
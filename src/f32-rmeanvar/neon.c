@@ -0,0 +1,115 @@
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <arm_neon.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/rmeanvar.h>
+
+
+void xnn_f32_rmeanvar_ukernel__neon(
+    size_t n,
+    const float* x,
+    float* mean,
+    float* variance)
+{
+  assert(n != 0);
+  assert(n % sizeof(float) == 0);
+
+  // Every lane of every accumulator runs its own Welford recurrence:
+  //   delta := x - mean
+  //   mean := mean + delta / count
+  //   m2 := m2 + delta * (x - mean)
+  // All lanes see the same number of elements, so the reciprocal of the element count is shared between them.
+  float32x4_t vmean0 = vmovq_n_f32(0.0f);
+  float32x4_t vmean1 = vmovq_n_f32(0.0f);
+  float32x4_t vmean2 = vmovq_n_f32(0.0f);
+  float32x4_t vmean3 = vmovq_n_f32(0.0f);
+  float32x4_t vm2_0 = vmovq_n_f32(0.0f);
+  float32x4_t vm2_1 = vmovq_n_f32(0.0f);
+  float32x4_t vm2_2 = vmovq_n_f32(0.0f);
+  float32x4_t vm2_3 = vmovq_n_f32(0.0f);
+  float vcount = 0.0f;
+  for (; n >= 16 * sizeof(float); n -= 16 * sizeof(float)) {
+    const float32x4_t vx0 = vld1q_f32(x); x += 4;
+    const float32x4_t vx1 = vld1q_f32(x); x += 4;
+    const float32x4_t vx2 = vld1q_f32(x); x += 4;
+    const float32x4_t vx3 = vld1q_f32(x); x += 4;
+
+    vcount += 1.0f;
+    const float32x4_t vrcp_count = vdupq_n_f32(1.0f / vcount);
+
+    const float32x4_t vdelta0 = vsubq_f32(vx0, vmean0);
+    const float32x4_t vdelta1 = vsubq_f32(vx1, vmean1);
+    const float32x4_t vdelta2 = vsubq_f32(vx2, vmean2);
+    const float32x4_t vdelta3 = vsubq_f32(vx3, vmean3);
+
+    vmean0 = vmlaq_f32(vmean0, vdelta0, vrcp_count);
+    vmean1 = vmlaq_f32(vmean1, vdelta1, vrcp_count);
+    vmean2 = vmlaq_f32(vmean2, vdelta2, vrcp_count);
+    vmean3 = vmlaq_f32(vmean3, vdelta3, vrcp_count);
+
+    vm2_0 = vmlaq_f32(vm2_0, vdelta0, vsubq_f32(vx0, vmean0));
+    vm2_1 = vmlaq_f32(vm2_1, vdelta1, vsubq_f32(vx1, vmean1));
+    vm2_2 = vmlaq_f32(vm2_2, vdelta2, vsubq_f32(vx2, vmean2));
+    vm2_3 = vmlaq_f32(vm2_3, vdelta3, vsubq_f32(vx3, vmean3));
+  }
+
+  // Merge pairs of accumulators with equal element counts (Chan et al.):
+  //   mean := (mean_a + mean_b) / 2
+  //   m2 := m2_a + m2_b + (mean_b - mean_a)**2 * count / 2
+  float32x4_t vhalf_count = vdupq_n_f32(vcount * 0.5f);
+  const float32x4_t vdelta01 = vsubq_f32(vmean1, vmean0);
+  const float32x4_t vdelta23 = vsubq_f32(vmean3, vmean2);
+  const float32x4_t vmean01 = vmlaq_n_f32(vmean0, vdelta01, 0.5f);
+  const float32x4_t vmean23 = vmlaq_n_f32(vmean2, vdelta23, 0.5f);
+  const float32x4_t vm2_01 = vmlaq_f32(vaddq_f32(vm2_0, vm2_1), vmulq_f32(vdelta01, vdelta01), vhalf_count);
+  const float32x4_t vm2_23 = vmlaq_f32(vaddq_f32(vm2_2, vm2_3), vmulq_f32(vdelta23, vdelta23), vhalf_count);
+  vcount += vcount;
+
+  vhalf_count = vdupq_n_f32(vcount * 0.5f);
+  const float32x4_t vdelta0123 = vsubq_f32(vmean23, vmean01);
+  float32x4_t vmean = vmlaq_n_f32(vmean01, vdelta0123, 0.5f);
+  float32x4_t vm2 = vmlaq_f32(vaddq_f32(vm2_01, vm2_23), vmulq_f32(vdelta0123, vdelta0123), vhalf_count);
+  vcount += vcount;
+
+  for (; n >= 4 * sizeof(float); n -= 4 * sizeof(float)) {
+    const float32x4_t vx = vld1q_f32(x); x += 4;
+
+    vcount += 1.0f;
+    const float32x4_t vrcp_count = vdupq_n_f32(1.0f / vcount);
+
+    const float32x4_t vdelta = vsubq_f32(vx, vmean);
+    vmean = vmlaq_f32(vmean, vdelta, vrcp_count);
+    vm2 = vmlaq_f32(vm2, vdelta, vsubq_f32(vx, vmean));
+  }
+
+  // Merge the lanes of the accumulator.
+  const float32x2_t vdelta_hi = vsub_f32(vget_high_f32(vmean), vget_low_f32(vmean));
+  const float32x2_t vmean_lo = vmla_n_f32(vget_low_f32(vmean), vdelta_hi, 0.5f);
+  const float32x2_t vm2_lo = vmla_n_f32(vadd_f32(vget_low_f32(vm2), vget_high_f32(vm2)), vmul_f32(vdelta_hi, vdelta_hi), vcount * 0.5f);
+  vcount += vcount;
+
+  const float vmean_even = vget_lane_f32(vmean_lo, 0);
+  const float vdelta_odd = vget_lane_f32(vmean_lo, 1) - vmean_even;
+  float vmean_ll = vmean_even + vdelta_odd * 0.5f;
+  float vm2_ll = (vget_lane_f32(vm2_lo, 0) + vget_lane_f32(vm2_lo, 1)) + vdelta_odd * vdelta_odd * (vcount * 0.5f);
+  vcount += vcount;
+
+  if XNN_UNLIKELY(n != 0) {
+    do {
+      const float vx = *x++;
+      vcount += 1.0f;
+      const float vdelta = vx - vmean_ll;
+      vmean_ll += vdelta / vcount;
+      vm2_ll += vdelta * (vx - vmean_ll);
+      n -= sizeof(float);
+    } while (n != 0);
+  }
+  *mean = vmean_ll;
+  *variance = vm2_ll / vcount;
+}
@@ -0,0 +1,91 @@
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/rmeanvar.h>
+
+
+void xnn_f32_rmeanvar_ukernel__scalar(
+    size_t n,
+    const float* x,
+    float* mean,
+    float* variance)
+{
+  assert(n != 0);
+  assert(n % sizeof(float) == 0);
+
+  // Every accumulator runs its own Welford recurrence:
+  //   delta := x - mean
+  //   mean := mean + delta / count
+  //   m2 := m2 + delta * (x - mean)
+  // All accumulators see the same number of elements, so the reciprocal of the element count is shared between them.
+  float vmean0 = 0.0f;
+  float vmean1 = 0.0f;
+  float vmean2 = 0.0f;
+  float vmean3 = 0.0f;
+  float vm2_0 = 0.0f;
+  float vm2_1 = 0.0f;
+  float vm2_2 = 0.0f;
+  float vm2_3 = 0.0f;
+  float vcount = 0.0f;
+  for (; n >= 4 * sizeof(float); n -= 4 * sizeof(float)) {
+    const float vx0 = x[0];
+    const float vx1 = x[1];
+    const float vx2 = x[2];
+    const float vx3 = x[3];
+    x += 4;
+
+    vcount += 1.0f;
+    const float vrcp_count = 1.0f / vcount;
+
+    const float vdelta0 = vx0 - vmean0;
+    const float vdelta1 = vx1 - vmean1;
+    const float vdelta2 = vx2 - vmean2;
+    const float vdelta3 = vx3 - vmean3;
+
+    vmean0 += vdelta0 * vrcp_count;
+    vmean1 += vdelta1 * vrcp_count;
+    vmean2 += vdelta2 * vrcp_count;
+    vmean3 += vdelta3 * vrcp_count;
+
+    vm2_0 += vdelta0 * (vx0 - vmean0);
+    vm2_1 += vdelta1 * (vx1 - vmean1);
+    vm2_2 += vdelta2 * (vx2 - vmean2);
+    vm2_3 += vdelta3 * (vx3 - vmean3);
+  }
+
+  // Merge pairs of accumulators with equal element counts (Chan et al.):
+  //   mean := (mean_a + mean_b) / 2
+  //   m2 := m2_a + m2_b + (mean_b - mean_a)**2 * count / 2
+  float vhalf_count = vcount * 0.5f;
+  const float vdelta01 = vmean1 - vmean0;
+  const float vdelta23 = vmean3 - vmean2;
+  const float vmean01 = vmean0 + vdelta01 * 0.5f;
+  const float vmean23 = vmean2 + vdelta23 * 0.5f;
+  const float vm2_01 = (vm2_0 + vm2_1) + vdelta01 * vdelta01 * vhalf_count;
+  const float vm2_23 = (vm2_2 + vm2_3) + vdelta23 * vdelta23 * vhalf_count;
+  vcount += vcount;
+
+  vhalf_count = vcount * 0.5f;
+  const float vdelta0123 = vmean23 - vmean01;
+  float vmean = vmean01 + vdelta0123 * 0.5f;
+  float vm2 = (vm2_01 + vm2_23) + vdelta0123 * vdelta0123 * vhalf_count;
+  vcount += vcount;
+
+  if XNN_UNLIKELY(n != 0) {
+    do {
+      const float vx = *x++;
+      vcount += 1.0f;
+      const float vdelta = vx - vmean;
+      vmean += vdelta / vcount;
+      vm2 += vdelta * (vx - vmean);
+      n -= sizeof(float);
+    } while (n != 0);
+  }
+  *mean = vmean;
+  *variance = vm2 / vcount;
+}
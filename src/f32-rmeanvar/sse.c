@@ -0,0 +1,121 @@
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <xmmintrin.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/rmeanvar.h>
+
+
+void xnn_f32_rmeanvar_ukernel__sse(
+    size_t n,
+    const float* x,
+    float* mean,
+    float* variance)
+{
+  assert(n != 0);
+  assert(n % sizeof(float) == 0);
+
+  // Every lane of every accumulator runs its own Welford recurrence:
+  //   delta := x - mean
+  //   mean := mean + delta / count
+  //   m2 := m2 + delta * (x - mean)
+  // All lanes see the same number of elements, so the reciprocal of the element count is shared between them.
+  __m128 vmean0 = _mm_setzero_ps();
+  __m128 vmean1 = _mm_setzero_ps();
+  __m128 vmean2 = _mm_setzero_ps();
+  __m128 vmean3 = _mm_setzero_ps();
+  __m128 vm2_0 = _mm_setzero_ps();
+  __m128 vm2_1 = _mm_setzero_ps();
+  __m128 vm2_2 = _mm_setzero_ps();
+  __m128 vm2_3 = _mm_setzero_ps();
+  float vcount = 0.0f;
+  for (; n >= 16 * sizeof(float); n -= 16 * sizeof(float)) {
+    const __m128 vx0 = _mm_loadu_ps(x);
+    const __m128 vx1 = _mm_loadu_ps(x + 4);
+    const __m128 vx2 = _mm_loadu_ps(x + 8);
+    const __m128 vx3 = _mm_loadu_ps(x + 12);
+    x += 16;
+
+    vcount += 1.0f;
+    const __m128 vrcp_count = _mm_set1_ps(1.0f / vcount);
+
+    const __m128 vdelta0 = _mm_sub_ps(vx0, vmean0);
+    const __m128 vdelta1 = _mm_sub_ps(vx1, vmean1);
+    const __m128 vdelta2 = _mm_sub_ps(vx2, vmean2);
+    const __m128 vdelta3 = _mm_sub_ps(vx3, vmean3);
+
+    vmean0 = _mm_add_ps(vmean0, _mm_mul_ps(vdelta0, vrcp_count));
+    vmean1 = _mm_add_ps(vmean1, _mm_mul_ps(vdelta1, vrcp_count));
+    vmean2 = _mm_add_ps(vmean2, _mm_mul_ps(vdelta2, vrcp_count));
+    vmean3 = _mm_add_ps(vmean3, _mm_mul_ps(vdelta3, vrcp_count));
+
+    vm2_0 = _mm_add_ps(vm2_0, _mm_mul_ps(vdelta0, _mm_sub_ps(vx0, vmean0)));
+    vm2_1 = _mm_add_ps(vm2_1, _mm_mul_ps(vdelta1, _mm_sub_ps(vx1, vmean1)));
+    vm2_2 = _mm_add_ps(vm2_2, _mm_mul_ps(vdelta2, _mm_sub_ps(vx2, vmean2)));
+    vm2_3 = _mm_add_ps(vm2_3, _mm_mul_ps(vdelta3, _mm_sub_ps(vx3, vmean3)));
+  }
+
+  // Merge pairs of accumulators with equal element counts (Chan et al.):
+  //   mean := (mean_a + mean_b) / 2
+  //   m2 := m2_a + m2_b + (mean_b - mean_a)**2 * count / 2
+  const __m128 vhalf = _mm_set1_ps(0.5f);
+  __m128 vhalf_count = _mm_set1_ps(vcount * 0.5f);
+  const __m128 vdelta01 = _mm_sub_ps(vmean1, vmean0);
+  const __m128 vdelta23 = _mm_sub_ps(vmean3, vmean2);
+  const __m128 vmean01 = _mm_add_ps(vmean0, _mm_mul_ps(vdelta01, vhalf));
+  const __m128 vmean23 = _mm_add_ps(vmean2, _mm_mul_ps(vdelta23, vhalf));
+  const __m128 vm2_01 = _mm_add_ps(_mm_add_ps(vm2_0, vm2_1), _mm_mul_ps(_mm_mul_ps(vdelta01, vdelta01), vhalf_count));
+  const __m128 vm2_23 = _mm_add_ps(_mm_add_ps(vm2_2, vm2_3), _mm_mul_ps(_mm_mul_ps(vdelta23, vdelta23), vhalf_count));
+  vcount += vcount;
+
+  vhalf_count = _mm_set1_ps(vcount * 0.5f);
+  const __m128 vdelta0123 = _mm_sub_ps(vmean23, vmean01);
+  __m128 vmean = _mm_add_ps(vmean01, _mm_mul_ps(vdelta0123, vhalf));
+  __m128 vm2 = _mm_add_ps(_mm_add_ps(vm2_01, vm2_23), _mm_mul_ps(_mm_mul_ps(vdelta0123, vdelta0123), vhalf_count));
+  vcount += vcount;
+
+  for (; n >= 4 * sizeof(float); n -= 4 * sizeof(float)) {
+    const __m128 vx = _mm_loadu_ps(x);
+    x += 4;
+
+    vcount += 1.0f;
+    const __m128 vrcp_count = _mm_set1_ps(1.0f / vcount);
+
+    const __m128 vdelta = _mm_sub_ps(vx, vmean);
+    vmean = _mm_add_ps(vmean, _mm_mul_ps(vdelta, vrcp_count));
+    vm2 = _mm_add_ps(vm2, _mm_mul_ps(vdelta, _mm_sub_ps(vx, vmean)));
+  }
+
+  // Merge the lanes of the accumulator.
+  vhalf_count = _mm_set1_ps(vcount * 0.5f);
+  const __m128 vdelta_hi = _mm_sub_ps(_mm_movehl_ps(vmean, vmean), vmean);
+  vmean = _mm_add_ps(vmean, _mm_mul_ps(vdelta_hi, vhalf));
+  vm2 = _mm_add_ps(_mm_add_ps(vm2, _mm_movehl_ps(vm2, vm2)), _mm_mul_ps(_mm_mul_ps(vdelta_hi, vdelta_hi), vhalf_count));
+  vcount += vcount;
+
+  vhalf_count = _mm_set_ss(vcount * 0.5f);
+  const __m128 vdelta_odd = _mm_sub_ss(_mm_shuffle_ps(vmean, vmean, _MM_SHUFFLE(1, 1, 1, 1)), vmean);
+  vmean = _mm_add_ss(vmean, _mm_mul_ss(vdelta_odd, vhalf));
+  vm2 = _mm_add_ss(_mm_add_ss(vm2, _mm_shuffle_ps(vm2, vm2, _MM_SHUFFLE(1, 1, 1, 1))), _mm_mul_ss(_mm_mul_ss(vdelta_odd, vdelta_odd), vhalf_count));
+  vcount += vcount;
+
+  float vmean_lo = _mm_cvtss_f32(vmean);
+  float vm2_lo = _mm_cvtss_f32(vm2);
+  if XNN_UNLIKELY(n != 0) {
+    do {
+      const float vx = *x++;
+      vcount += 1.0f;
+      const float vdelta = vx - vmean_lo;
+      vmean_lo += vdelta / vcount;
+      vm2_lo += vdelta * (vx - vmean_lo);
+      n -= sizeof(float);
+    } while (n != 0);
+  }
+  *mean = vmean_lo;
+  *variance = vm2_lo / vcount;
+}
@@ -0,0 +1,329 @@
+// Auto-generated file. Do not edit!
+//   Template: src/f32-spmm/avx.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <immintrin.h>
+
+#include <xnnpack/spmm.h>
+
+
+void xnn_f32_spmm_minmax_ukernel_16x2__avx(
+    size_t mc,
+    size_t nc,
+    const float*restrict input,
+    const float*restrict weights,
+    const int32_t*restrict widx_dmap,
+    const uint32_t*restrict nidx_nnzmap,
+    float*restrict output,
+    size_t output_stride,
+    const union xnn_f32_minmax_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(mc != 0);
+  assert(mc % sizeof(float) == 0);
+  assert(nc != 0);
+
+  const __m256 vmin = _mm256_broadcast_ss(params->sse.min);
+  const __m256 vmax = _mm256_broadcast_ss(params->sse.max);
+  size_t output_decrement = output_stride * nc - 16 * sizeof(float);
+  while XNN_LIKELY(mc >= 16 * sizeof(float)) {
+    const float*restrict w = weights;
+    const int32_t* dmap = widx_dmap;
+    const uint32_t* nnzmap = nidx_nnzmap;
+    size_t n = nc;
+    while (n >= 2) {
+      uint32_t nnz = *nnzmap++;
+      __m256 vacc01234567n0 = _mm256_broadcast_ss(w); w += 1;
+      __m256 vacc89ABCDEFn0 = vacc01234567n0;
+      __m256 vacc01234567n1 = _mm256_broadcast_ss(w); w += 1;
+      __m256 vacc89ABCDEFn1 = vacc01234567n1;
+      if XNN_LIKELY(nnz != 0) {
+        do {
+          const intptr_t diff = *dmap++;
+          const __m256 vi01234567 = _mm256_loadu_ps(input);
+          const __m256 vi89ABCDEF = _mm256_loadu_ps(input + 8);
+          input = (const float*restrict) ((uintptr_t) input + (uintptr_t) diff);
+          const __m256 vw0 = _mm256_broadcast_ss(w);
+          const __m256 vw1 = _mm256_broadcast_ss(w + 1);
+          w += 2;
+          vacc01234567n0 = _mm256_add_ps(vacc01234567n0, _mm256_mul_ps(vi01234567, vw0));
+          vacc89ABCDEFn0 = _mm256_add_ps(vacc89ABCDEFn0, _mm256_mul_ps(vi89ABCDEF, vw0));
+          vacc01234567n1 = _mm256_add_ps(vacc01234567n1, _mm256_mul_ps(vi01234567, vw1));
+          vacc89ABCDEFn1 = _mm256_add_ps(vacc89ABCDEFn1, _mm256_mul_ps(vi89ABCDEF, vw1));
+        } while (--nnz != 0);
+      }
+      __m256 vout01234567n0 = _mm256_min_ps(vacc01234567n0, vmax);
+      __m256 vout89ABCDEFn0 = _mm256_min_ps(vacc89ABCDEFn0, vmax);
+      __m256 vout01234567n1 = _mm256_min_ps(vacc01234567n1, vmax);
+      __m256 vout89ABCDEFn1 = _mm256_min_ps(vacc89ABCDEFn1, vmax);
+      vout01234567n0 = _mm256_max_ps(vout01234567n0, vmin);
+      vout89ABCDEFn0 = _mm256_max_ps(vout89ABCDEFn0, vmin);
+      vout01234567n1 = _mm256_max_ps(vout01234567n1, vmin);
+      vout89ABCDEFn1 = _mm256_max_ps(vout89ABCDEFn1, vmin);
+      _mm256_storeu_ps(output, vout01234567n0);
+      _mm256_storeu_ps(output + 8, vout89ABCDEFn0);
+      output = (float*restrict) ((uintptr_t) output + output_stride);
+      _mm256_storeu_ps(output, vout01234567n1);
+      _mm256_storeu_ps(output + 8, vout89ABCDEFn1);
+      output = (float*restrict) ((uintptr_t) output + output_stride);
+      n -= 2;
+    }
+
+    // clean up loop, fall back to nr=1
+    while XNN_UNLIKELY(n != 0) {
+      uint32_t nnz = *nnzmap++;
+      __m256 vacc01234567 = _mm256_broadcast_ss(w); w += 1;
+      __m256 vacc89ABCDEF = vacc01234567;
+      if XNN_LIKELY(nnz != 0) {
+        do {
+          const intptr_t diff = *dmap++;
+          const __m256 vi01234567 = _mm256_loadu_ps(input);
+          const __m256 vi89ABCDEF = _mm256_loadu_ps(input + 8);
+          input = (const float*restrict) ((uintptr_t) input + (uintptr_t) diff);
+          const __m256 vw = _mm256_broadcast_ss(w); w += 1;
+          vacc01234567 = _mm256_add_ps(vacc01234567, _mm256_mul_ps(vi01234567, vw));
+          vacc89ABCDEF = _mm256_add_ps(vacc89ABCDEF, _mm256_mul_ps(vi89ABCDEF, vw));
+        } while (--nnz != 0);
+      }
+      __m256 vout01234567 = _mm256_min_ps(vacc01234567, vmax);
+      __m256 vout89ABCDEF = _mm256_min_ps(vacc89ABCDEF, vmax);
+      vout01234567 = _mm256_max_ps(vout01234567, vmin);
+      vout89ABCDEF = _mm256_max_ps(vout89ABCDEF, vmin);
+      _mm256_storeu_ps(output, vout01234567);
+      _mm256_storeu_ps(output + 8, vout89ABCDEF);
+      output = (float*restrict) ((uintptr_t) output + output_stride);
+      n -= 1;
+    }
+    output = (float*restrict) ((uintptr_t) output - output_decrement);
+    input += 16;
+    mc -= 16 * sizeof(float);
+  }
+  if XNN_UNLIKELY(mc != 0) {
+    output_decrement += 8 * sizeof(float);
+    if (mc & (8 * sizeof(float))) {
+      const float*restrict w = weights;
+      const int32_t* dmap = widx_dmap;
+      const uint32_t* nnzmap = nidx_nnzmap;
+      size_t n = nc;
+      while (n >= 2) {
+        uint32_t nnz = *nnzmap++;
+        __m256 vacc01234567n0 = _mm256_broadcast_ss(w); w += 1;
+        __m256 vacc01234567n1 = _mm256_broadcast_ss(w); w += 1;
+        if XNN_LIKELY(nnz != 0) {
+          do {
+            const intptr_t diff = *dmap++;
+            const __m256 vi01234567 = _mm256_loadu_ps(input);
+            input = (const float*restrict) ((uintptr_t) input + (uintptr_t) diff);
+            const __m256 vw0 = _mm256_broadcast_ss(w);
+            const __m256 vw1 = _mm256_broadcast_ss(w + 1);
+            w += 2;
+            vacc01234567n0 = _mm256_add_ps(vacc01234567n0, _mm256_mul_ps(vi01234567, vw0));
+            vacc01234567n1 = _mm256_add_ps(vacc01234567n1, _mm256_mul_ps(vi01234567, vw1));
+          } while (--nnz != 0);
+        }
+        __m256 vout01234567n0 = _mm256_min_ps(vacc01234567n0, vmax);
+        __m256 vout01234567n1 = _mm256_min_ps(vacc01234567n1, vmax);
+        vout01234567n0 = _mm256_max_ps(vout01234567n0, vmin);
+        vout01234567n1 = _mm256_max_ps(vout01234567n1, vmin);
+        _mm256_storeu_ps(output, vout01234567n0);
+        output = (float*restrict) ((uintptr_t) output + output_stride);
+        _mm256_storeu_ps(output, vout01234567n1);
+        output = (float*restrict) ((uintptr_t) output + output_stride);
+        n -= 2;
+      }
+
+      // clean up loop, fall back to nr=1
+      while XNN_UNLIKELY(n != 0) {
+        uint32_t nnz = *nnzmap++;
+        __m256 vacc01234567 = _mm256_broadcast_ss(w); w += 1;
+        if XNN_LIKELY(nnz != 0) {
+          do {
+            const intptr_t diff = *dmap++;
+            const __m256 vi01234567 = _mm256_loadu_ps(input);
+            input = (const float*restrict) ((uintptr_t) input + (uintptr_t) diff);
+            const __m256 vw = _mm256_broadcast_ss(w); w += 1;
+            vacc01234567 = _mm256_add_ps(vacc01234567, _mm256_mul_ps(vi01234567, vw));
+          } while (--nnz != 0);
+        }
+        __m256 vout01234567 = _mm256_min_ps(vacc01234567, vmax);
+        vout01234567 = _mm256_max_ps(vout01234567, vmin);
+        _mm256_storeu_ps(output, vout01234567);
+        output = (float*restrict) ((uintptr_t) output + output_stride);
+        n -= 1;
+      }
+      output = (float*restrict) ((uintptr_t) output - output_decrement);
+      input += 8;
+    }
+    output_decrement += 4 * sizeof(float);
+    if (mc & (4 * sizeof(float))) {
+      const float*restrict w = weights;
+      const int32_t* dmap = widx_dmap;
+      const uint32_t* nnzmap = nidx_nnzmap;
+      size_t n = nc;
+      while (n >= 2) {
+        uint32_t nnz = *nnzmap++;
+        __m128 vacc0123n0 = _mm_broadcast_ss(w); w += 1;
+        __m128 vacc0123n1 = _mm_broadcast_ss(w); w += 1;
+        if XNN_LIKELY(nnz != 0) {
+          do {
+            const intptr_t diff = *dmap++;
+            const __m128 vi0123 = _mm_loadu_ps(input);
+            input = (const float*restrict) ((uintptr_t) input + (uintptr_t) diff);
+            const __m128 vw0 = _mm_broadcast_ss(w);
+            const __m128 vw1 = _mm_broadcast_ss(w + 1);
+            w += 2;
+            vacc0123n0 = _mm_add_ps(vacc0123n0, _mm_mul_ps(vi0123, vw0));
+            vacc0123n1 = _mm_add_ps(vacc0123n1, _mm_mul_ps(vi0123, vw1));
+          } while (--nnz != 0);
+        }
+        __m128 vout0123n0 = _mm_min_ps(vacc0123n0, _mm256_castps256_ps128(vmax));
+        __m128 vout0123n1 = _mm_min_ps(vacc0123n1, _mm256_castps256_ps128(vmax));
+        vout0123n0 = _mm_max_ps(vout0123n0, _mm256_castps256_ps128(vmin));
+        vout0123n1 = _mm_max_ps(vout0123n1, _mm256_castps256_ps128(vmin));
+        _mm_storeu_ps(output, vout0123n0);
+        output = (float*restrict) ((uintptr_t) output + output_stride);
+        _mm_storeu_ps(output, vout0123n1);
+        output = (float*restrict) ((uintptr_t) output + output_stride);
+        n -= 2;
+      }
+
+      // clean up loop, fall back to nr=1
+      while XNN_UNLIKELY(n != 0) {
+        uint32_t nnz = *nnzmap++;
+        __m128 vacc0123 = _mm_broadcast_ss(w); w += 1;
+        if XNN_LIKELY(nnz != 0) {
+          do {
+            const intptr_t diff = *dmap++;
+            const __m128 vi0123 = _mm_loadu_ps(input);
+            input = (const float*restrict) ((uintptr_t) input + (uintptr_t) diff);
+            const __m128 vw = _mm_broadcast_ss(w); w += 1;
+            vacc0123 = _mm_add_ps(vacc0123, _mm_mul_ps(vi0123, vw));
+          } while (--nnz != 0);
+        }
+        __m128 vout0123 = _mm_min_ps(vacc0123, _mm256_castps256_ps128(vmax));
+        vout0123 = _mm_max_ps(vout0123, _mm256_castps256_ps128(vmin));
+        _mm_storeu_ps(output, vout0123);
+        output = (float*restrict) ((uintptr_t) output + output_stride);
+        n -= 1;
+      }
+      output = (float*restrict) ((uintptr_t) output - output_decrement);
+      input += 4;
+    }
+    output_decrement += 2 * sizeof(float);
+    if (mc & (2 * sizeof(float))) {
+      const float*restrict w = weights;
+      const int32_t* dmap = widx_dmap;
+      const uint32_t* nnzmap = nidx_nnzmap;
+      size_t n = nc;
+      while (n >= 2) {
+        uint32_t nnz = *nnzmap++;
+        __m128 vacc01n0 = _mm_broadcast_ss(w); w += 1;
+        __m128 vacc01n1 = _mm_broadcast_ss(w); w += 1;
+        if XNN_LIKELY(nnz != 0) {
+          do {
+            const intptr_t diff = *dmap++;
+            const __m128 vi01 = _mm_loadl_pi(_mm_undefined_ps(), (const __m64*) input);
+            input = (const float*restrict) ((uintptr_t) input + (uintptr_t) diff);
+            const __m128 vw0 = _mm_broadcast_ss(w);
+            const __m128 vw1 = _mm_broadcast_ss(w + 1);
+            w += 2;
+            vacc01n0 = _mm_add_ps(vacc01n0, _mm_mul_ps(vi01, vw0));
+            vacc01n1 = _mm_add_ps(vacc01n1, _mm_mul_ps(vi01, vw1));
+          } while (--nnz != 0);
+        }
+        __m128 vout01n0 = _mm_min_ps(vacc01n0, _mm256_castps256_ps128(vmax));
+        __m128 vout01n1 = _mm_min_ps(vacc01n1, _mm256_castps256_ps128(vmax));
+        vout01n0 = _mm_max_ps(vout01n0, _mm256_castps256_ps128(vmin));
+        vout01n1 = _mm_max_ps(vout01n1, _mm256_castps256_ps128(vmin));
+        _mm_storel_pi((__m64*) output, vout01n0);
+        output = (float*restrict) ((uintptr_t) output + output_stride);
+        _mm_storel_pi((__m64*) output, vout01n1);
+        output = (float*restrict) ((uintptr_t) output + output_stride);
+        n -= 2;
+      }
+
+      // clean up loop, fall back to nr=1
+      while XNN_UNLIKELY(n != 0) {
+        uint32_t nnz = *nnzmap++;
+        __m128 vacc01 = _mm_broadcast_ss(w); w += 1;
+        if XNN_LIKELY(nnz != 0) {
+          do {
+            const intptr_t diff = *dmap++;
+            const __m128 vi01 = _mm_loadl_pi(_mm_undefined_ps(), (const __m64*) input);
+            input = (const float*restrict) ((uintptr_t) input + (uintptr_t) diff);
+            const __m128 vw = _mm_broadcast_ss(w); w += 1;
+            vacc01 = _mm_add_ps(vacc01, _mm_mul_ps(vi01, vw));
+          } while (--nnz != 0);
+        }
+        __m128 vout01 = _mm_min_ps(vacc01, _mm256_castps256_ps128(vmax));
+        vout01 = _mm_max_ps(vout01, _mm256_castps256_ps128(vmin));
+        _mm_storel_pi((__m64*) output, vout01);
+        output = (float*restrict) ((uintptr_t) output + output_stride);
+        n -= 1;
+      }
+      output = (float*restrict) ((uintptr_t) output - output_decrement);
+      input += 2;
+    }
+    output_decrement += 1 * sizeof(float);
+    if (mc & (1 * sizeof(float))) {
+      const float*restrict w = weights;
+      const int32_t* dmap = widx_dmap;
+      const uint32_t* nnzmap = nidx_nnzmap;
+      size_t n = nc;
+      while (n >= 2) {
+        uint32_t nnz = *nnzmap++;
+        __m128 vacc0n0 = _mm_broadcast_ss(w); w += 1;
+        __m128 vacc0n1 = _mm_broadcast_ss(w); w += 1;
+        if XNN_LIKELY(nnz != 0) {
+          do {
+            const intptr_t diff = *dmap++;
+            const __m128 vi0 = _mm_load_ss(input);
+            input = (const float*restrict) ((uintptr_t) input + (uintptr_t) diff);
+            const __m128 vw0 = _mm_broadcast_ss(w);
+            const __m128 vw1 = _mm_broadcast_ss(w + 1);
+            w += 2;
+            vacc0n0 = _mm_add_ps(vacc0n0, _mm_mul_ps(vi0, vw0));
+            vacc0n1 = _mm_add_ps(vacc0n1, _mm_mul_ps(vi0, vw1));
+          } while (--nnz != 0);
+        }
+        __m128 vout0n0 = _mm_min_ps(vacc0n0, _mm256_castps256_ps128(vmax));
+        __m128 vout0n1 = _mm_min_ps(vacc0n1, _mm256_castps256_ps128(vmax));
+        vout0n0 = _mm_max_ps(vout0n0, _mm256_castps256_ps128(vmin));
+        vout0n1 = _mm_max_ps(vout0n1, _mm256_castps256_ps128(vmin));
+        _mm_store_ss(output, vout0n0);
+        output = (float*restrict) ((uintptr_t) output + output_stride);
+        _mm_store_ss(output, vout0n1);
+        output = (float*restrict) ((uintptr_t) output + output_stride);
+        n -= 2;
+      }
+
+      // clean up loop, fall back to nr=1
+      while XNN_UNLIKELY(n != 0) {
+        uint32_t nnz = *nnzmap++;
+        __m128 vacc0 = _mm_broadcast_ss(w); w += 1;
+        if XNN_LIKELY(nnz != 0) {
+          do {
+            const intptr_t diff = *dmap++;
+            const __m128 vi0 = _mm_load_ss(input);
+            input = (const float*restrict) ((uintptr_t) input + (uintptr_t) diff);
+            const __m128 vw = _mm_broadcast_ss(w); w += 1;
+            vacc0 = _mm_add_ps(vacc0, _mm_mul_ps(vi0, vw));
+          } while (--nnz != 0);
+        }
+        __m128 vout0 = _mm_min_ps(vacc0, _mm256_castps256_ps128(vmax));
+        vout0 = _mm_max_ps(vout0, _mm256_castps256_ps128(vmin));
+        _mm_store_ss(output, vout0);
+        output = (float*restrict) ((uintptr_t) output + output_stride);
+        n -= 1;
+      }
+      output = (float*restrict) ((uintptr_t) output - output_decrement);
+      input += 1;
+    }
+  }
+}
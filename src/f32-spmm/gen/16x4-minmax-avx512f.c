@@ -0,0 +1,387 @@
+// Auto-generated file. Do not edit!
+//   Template: src/f32-spmm/avx512f.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <immintrin.h>
+
+#include <xnnpack/intrinsics-polyfill.h>
+#include <xnnpack/spmm.h>
+
+
+void xnn_f32_spmm_minmax_ukernel_16x4__avx512f(
+    size_t mc,
+    size_t nc,
+    const float*restrict input,
+    const float*restrict weights,
+    const int32_t*restrict widx_dmap,
+    const uint32_t*restrict nidx_nnzmap,
+    float*restrict output,
+    size_t output_stride,
+    const union xnn_f32_minmax_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(mc != 0);
+  assert(mc % sizeof(float) == 0);
+  assert(nc != 0);
+
+  const __m512 vmin = _mm512_set1_ps(params->sse.min[0]);
+  const __m512 vmax = _mm512_set1_ps(params->sse.max[0]);
+  size_t output_decrement = output_stride * nc - 16 * sizeof(float);
+  while XNN_LIKELY(mc >= 16 * sizeof(float)) {
+    const float*restrict w = weights;
+    const int32_t* dmap = widx_dmap;
+    const uint32_t* nnzmap = nidx_nnzmap;
+    size_t n = nc;
+    while (n >= 4) {
+      uint32_t nnz = *nnzmap++;
+      __m512 vacc0123456789ABCDEFn0 = _mm512_set1_ps(*w); w += 1;
+      __m512 vacc0123456789ABCDEFn1 = _mm512_set1_ps(*w); w += 1;
+      __m512 vacc0123456789ABCDEFn2 = _mm512_set1_ps(*w); w += 1;
+      __m512 vacc0123456789ABCDEFn3 = _mm512_set1_ps(*w); w += 1;
+      if XNN_LIKELY(nnz != 0) {
+        do {
+          const intptr_t diff = *dmap++;
+          const __m512 vi0123456789ABCDEF = _mm512_loadu_ps(input);
+          input = (const float*restrict) ((uintptr_t) input + (uintptr_t) diff);
+          const __m512 vw0 = _mm512_set1_ps(w[0]);
+          const __m512 vw1 = _mm512_set1_ps(w[1]);
+          const __m512 vw2 = _mm512_set1_ps(w[2]);
+          const __m512 vw3 = _mm512_set1_ps(w[3]);
+          w += 4;
+          vacc0123456789ABCDEFn0 = _mm512_fmadd_ps(vi0123456789ABCDEF, vw0, vacc0123456789ABCDEFn0);
+          vacc0123456789ABCDEFn1 = _mm512_fmadd_ps(vi0123456789ABCDEF, vw1, vacc0123456789ABCDEFn1);
+          vacc0123456789ABCDEFn2 = _mm512_fmadd_ps(vi0123456789ABCDEF, vw2, vacc0123456789ABCDEFn2);
+          vacc0123456789ABCDEFn3 = _mm512_fmadd_ps(vi0123456789ABCDEF, vw3, vacc0123456789ABCDEFn3);
+        } while (--nnz != 0);
+      }
+      __m512 vout0123456789ABCDEFn0 = _mm512_min_ps(vacc0123456789ABCDEFn0, vmax);
+      __m512 vout0123456789ABCDEFn1 = _mm512_min_ps(vacc0123456789ABCDEFn1, vmax);
+      __m512 vout0123456789ABCDEFn2 = _mm512_min_ps(vacc0123456789ABCDEFn2, vmax);
+      __m512 vout0123456789ABCDEFn3 = _mm512_min_ps(vacc0123456789ABCDEFn3, vmax);
+      vout0123456789ABCDEFn0 = _mm512_max_ps(vout0123456789ABCDEFn0, vmin);
+      vout0123456789ABCDEFn1 = _mm512_max_ps(vout0123456789ABCDEFn1, vmin);
+      vout0123456789ABCDEFn2 = _mm512_max_ps(vout0123456789ABCDEFn2, vmin);
+      vout0123456789ABCDEFn3 = _mm512_max_ps(vout0123456789ABCDEFn3, vmin);
+      _mm512_storeu_ps(output, vout0123456789ABCDEFn0);
+      output = (float*restrict) ((uintptr_t) output + output_stride);
+      _mm512_storeu_ps(output, vout0123456789ABCDEFn1);
+      output = (float*restrict) ((uintptr_t) output + output_stride);
+      _mm512_storeu_ps(output, vout0123456789ABCDEFn2);
+      output = (float*restrict) ((uintptr_t) output + output_stride);
+      _mm512_storeu_ps(output, vout0123456789ABCDEFn3);
+      output = (float*restrict) ((uintptr_t) output + output_stride);
+      n -= 4;
+    }
+
+    // clean up loop, fall back to nr=1
+    while XNN_UNLIKELY(n != 0) {
+      uint32_t nnz = *nnzmap++;
+      __m512 vacc0123456789ABCDEF = _mm512_set1_ps(*w); w += 1;
+      if XNN_LIKELY(nnz != 0) {
+        do {
+          const intptr_t diff = *dmap++;
+          const __m512 vi0123456789ABCDEF = _mm512_loadu_ps(input);
+          input = (const float*restrict) ((uintptr_t) input + (uintptr_t) diff);
+          const __m512 vw = _mm512_set1_ps(*w); w += 1;
+          vacc0123456789ABCDEF = _mm512_fmadd_ps(vi0123456789ABCDEF, vw, vacc0123456789ABCDEF);
+        } while (--nnz != 0);
+      }
+      __m512 vout0123456789ABCDEF = _mm512_min_ps(vacc0123456789ABCDEF, vmax);
+      vout0123456789ABCDEF = _mm512_max_ps(vout0123456789ABCDEF, vmin);
+      _mm512_storeu_ps(output, vout0123456789ABCDEF);
+      output = (float*restrict) ((uintptr_t) output + output_stride);
+      n -= 1;
+    }
+    output = (float*restrict) ((uintptr_t) output - output_decrement);
+    input += 16;
+    mc -= 16 * sizeof(float);
+  }
+  if XNN_UNLIKELY(mc != 0) {
+    output_decrement += 8 * sizeof(float);
+    if (mc & (8 * sizeof(float))) {
+      const __mmask16 vmask = _cvtu32_mask16(UINT32_C(0xff));
+      const float*restrict w = weights;
+      const int32_t* dmap = widx_dmap;
+      const uint32_t* nnzmap = nidx_nnzmap;
+      size_t n = nc;
+      while (n >= 4) {
+        uint32_t nnz = *nnzmap++;
+        __m512 vacc01234567n0 = _mm512_set1_ps(*w); w += 1;
+        __m512 vacc01234567n1 = _mm512_set1_ps(*w); w += 1;
+        __m512 vacc01234567n2 = _mm512_set1_ps(*w); w += 1;
+        __m512 vacc01234567n3 = _mm512_set1_ps(*w); w += 1;
+        if XNN_LIKELY(nnz != 0) {
+          do {
+            const intptr_t diff = *dmap++;
+            const __m512 vi01234567 = _mm512_maskz_loadu_ps(vmask, input);
+            input = (const float*restrict) ((uintptr_t) input + (uintptr_t) diff);
+            const __m512 vw0 = _mm512_set1_ps(w[0]);
+            const __m512 vw1 = _mm512_set1_ps(w[1]);
+            const __m512 vw2 = _mm512_set1_ps(w[2]);
+            const __m512 vw3 = _mm512_set1_ps(w[3]);
+            w += 4;
+            vacc01234567n0 = _mm512_fmadd_ps(vi01234567, vw0, vacc01234567n0);
+            vacc01234567n1 = _mm512_fmadd_ps(vi01234567, vw1, vacc01234567n1);
+            vacc01234567n2 = _mm512_fmadd_ps(vi01234567, vw2, vacc01234567n2);
+            vacc01234567n3 = _mm512_fmadd_ps(vi01234567, vw3, vacc01234567n3);
+          } while (--nnz != 0);
+        }
+        __m512 vout01234567n0 = _mm512_min_ps(vacc01234567n0, vmax);
+        __m512 vout01234567n1 = _mm512_min_ps(vacc01234567n1, vmax);
+        __m512 vout01234567n2 = _mm512_min_ps(vacc01234567n2, vmax);
+        __m512 vout01234567n3 = _mm512_min_ps(vacc01234567n3, vmax);
+        vout01234567n0 = _mm512_max_ps(vout01234567n0, vmin);
+        vout01234567n1 = _mm512_max_ps(vout01234567n1, vmin);
+        vout01234567n2 = _mm512_max_ps(vout01234567n2, vmin);
+        vout01234567n3 = _mm512_max_ps(vout01234567n3, vmin);
+        _mm512_mask_storeu_ps(output, vmask, vout01234567n0);
+        output = (float*restrict) ((uintptr_t) output + output_stride);
+        _mm512_mask_storeu_ps(output, vmask, vout01234567n1);
+        output = (float*restrict) ((uintptr_t) output + output_stride);
+        _mm512_mask_storeu_ps(output, vmask, vout01234567n2);
+        output = (float*restrict) ((uintptr_t) output + output_stride);
+        _mm512_mask_storeu_ps(output, vmask, vout01234567n3);
+        output = (float*restrict) ((uintptr_t) output + output_stride);
+        n -= 4;
+      }
+
+      // clean up loop, fall back to nr=1
+      while XNN_UNLIKELY(n != 0) {
+        uint32_t nnz = *nnzmap++;
+        __m512 vacc01234567 = _mm512_set1_ps(*w); w += 1;
+        if XNN_LIKELY(nnz != 0) {
+          do {
+            const intptr_t diff = *dmap++;
+            const __m512 vi01234567 = _mm512_maskz_loadu_ps(vmask, input);
+            input = (const float*restrict) ((uintptr_t) input + (uintptr_t) diff);
+            const __m512 vw = _mm512_set1_ps(*w); w += 1;
+            vacc01234567 = _mm512_fmadd_ps(vi01234567, vw, vacc01234567);
+          } while (--nnz != 0);
+        }
+        __m512 vout01234567 = _mm512_min_ps(vacc01234567, vmax);
+        vout01234567 = _mm512_max_ps(vout01234567, vmin);
+        _mm512_mask_storeu_ps(output, vmask, vout01234567);
+        output = (float*restrict) ((uintptr_t) output + output_stride);
+        n -= 1;
+      }
+      output = (float*restrict) ((uintptr_t) output - output_decrement);
+      input += 8;
+    }
+    output_decrement += 4 * sizeof(float);
+    if (mc & (4 * sizeof(float))) {
+      const __mmask16 vmask = _cvtu32_mask16(UINT32_C(0xf));
+      const float*restrict w = weights;
+      const int32_t* dmap = widx_dmap;
+      const uint32_t* nnzmap = nidx_nnzmap;
+      size_t n = nc;
+      while (n >= 4) {
+        uint32_t nnz = *nnzmap++;
+        __m512 vacc0123n0 = _mm512_set1_ps(*w); w += 1;
+        __m512 vacc0123n1 = _mm512_set1_ps(*w); w += 1;
+        __m512 vacc0123n2 = _mm512_set1_ps(*w); w += 1;
+        __m512 vacc0123n3 = _mm512_set1_ps(*w); w += 1;
+        if XNN_LIKELY(nnz != 0) {
+          do {
+            const intptr_t diff = *dmap++;
+            const __m512 vi0123 = _mm512_maskz_loadu_ps(vmask, input);
+            input = (const float*restrict) ((uintptr_t) input + (uintptr_t) diff);
+            const __m512 vw0 = _mm512_set1_ps(w[0]);
+            const __m512 vw1 = _mm512_set1_ps(w[1]);
+            const __m512 vw2 = _mm512_set1_ps(w[2]);
+            const __m512 vw3 = _mm512_set1_ps(w[3]);
+            w += 4;
+            vacc0123n0 = _mm512_fmadd_ps(vi0123, vw0, vacc0123n0);
+            vacc0123n1 = _mm512_fmadd_ps(vi0123, vw1, vacc0123n1);
+            vacc0123n2 = _mm512_fmadd_ps(vi0123, vw2, vacc0123n2);
+            vacc0123n3 = _mm512_fmadd_ps(vi0123, vw3, vacc0123n3);
+          } while (--nnz != 0);
+        }
+        __m512 vout0123n0 = _mm512_min_ps(vacc0123n0, vmax);
+        __m512 vout0123n1 = _mm512_min_ps(vacc0123n1, vmax);
+        __m512 vout0123n2 = _mm512_min_ps(vacc0123n2, vmax);
+        __m512 vout0123n3 = _mm512_min_ps(vacc0123n3, vmax);
+        vout0123n0 = _mm512_max_ps(vout0123n0, vmin);
+        vout0123n1 = _mm512_max_ps(vout0123n1, vmin);
+        vout0123n2 = _mm512_max_ps(vout0123n2, vmin);
+        vout0123n3 = _mm512_max_ps(vout0123n3, vmin);
+        _mm512_mask_storeu_ps(output, vmask, vout0123n0);
+        output = (float*restrict) ((uintptr_t) output + output_stride);
+        _mm512_mask_storeu_ps(output, vmask, vout0123n1);
+        output = (float*restrict) ((uintptr_t) output + output_stride);
+        _mm512_mask_storeu_ps(output, vmask, vout0123n2);
+        output = (float*restrict) ((uintptr_t) output + output_stride);
+        _mm512_mask_storeu_ps(output, vmask, vout0123n3);
+        output = (float*restrict) ((uintptr_t) output + output_stride);
+        n -= 4;
+      }
+
+      // clean up loop, fall back to nr=1
+      while XNN_UNLIKELY(n != 0) {
+        uint32_t nnz = *nnzmap++;
+        __m512 vacc0123 = _mm512_set1_ps(*w); w += 1;
+        if XNN_LIKELY(nnz != 0) {
+          do {
+            const intptr_t diff = *dmap++;
+            const __m512 vi0123 = _mm512_maskz_loadu_ps(vmask, input);
+            input = (const float*restrict) ((uintptr_t) input + (uintptr_t) diff);
+            const __m512 vw = _mm512_set1_ps(*w); w += 1;
+            vacc0123 = _mm512_fmadd_ps(vi0123, vw, vacc0123);
+          } while (--nnz != 0);
+        }
+        __m512 vout0123 = _mm512_min_ps(vacc0123, vmax);
+        vout0123 = _mm512_max_ps(vout0123, vmin);
+        _mm512_mask_storeu_ps(output, vmask, vout0123);
+        output = (float*restrict) ((uintptr_t) output + output_stride);
+        n -= 1;
+      }
+      output = (float*restrict) ((uintptr_t) output - output_decrement);
+      input += 4;
+    }
+    output_decrement += 2 * sizeof(float);
+    if (mc & (2 * sizeof(float))) {
+      const __mmask16 vmask = _cvtu32_mask16(UINT32_C(0x3));
+      const float*restrict w = weights;
+      const int32_t* dmap = widx_dmap;
+      const uint32_t* nnzmap = nidx_nnzmap;
+      size_t n = nc;
+      while (n >= 4) {
+        uint32_t nnz = *nnzmap++;
+        __m512 vacc01n0 = _mm512_set1_ps(*w); w += 1;
+        __m512 vacc01n1 = _mm512_set1_ps(*w); w += 1;
+        __m512 vacc01n2 = _mm512_set1_ps(*w); w += 1;
+        __m512 vacc01n3 = _mm512_set1_ps(*w); w += 1;
+        if XNN_LIKELY(nnz != 0) {
+          do {
+            const intptr_t diff = *dmap++;
+            const __m512 vi01 = _mm512_maskz_loadu_ps(vmask, input);
+            input = (const float*restrict) ((uintptr_t) input + (uintptr_t) diff);
+            const __m512 vw0 = _mm512_set1_ps(w[0]);
+            const __m512 vw1 = _mm512_set1_ps(w[1]);
+            const __m512 vw2 = _mm512_set1_ps(w[2]);
+            const __m512 vw3 = _mm512_set1_ps(w[3]);
+            w += 4;
+            vacc01n0 = _mm512_fmadd_ps(vi01, vw0, vacc01n0);
+            vacc01n1 = _mm512_fmadd_ps(vi01, vw1, vacc01n1);
+            vacc01n2 = _mm512_fmadd_ps(vi01, vw2, vacc01n2);
+            vacc01n3 = _mm512_fmadd_ps(vi01, vw3, vacc01n3);
+          } while (--nnz != 0);
+        }
+        __m512 vout01n0 = _mm512_min_ps(vacc01n0, vmax);
+        __m512 vout01n1 = _mm512_min_ps(vacc01n1, vmax);
+        __m512 vout01n2 = _mm512_min_ps(vacc01n2, vmax);
+        __m512 vout01n3 = _mm512_min_ps(vacc01n3, vmax);
+        vout01n0 = _mm512_max_ps(vout01n0, vmin);
+        vout01n1 = _mm512_max_ps(vout01n1, vmin);
+        vout01n2 = _mm512_max_ps(vout01n2, vmin);
+        vout01n3 = _mm512_max_ps(vout01n3, vmin);
+        _mm512_mask_storeu_ps(output, vmask, vout01n0);
+        output = (float*restrict) ((uintptr_t) output + output_stride);
+        _mm512_mask_storeu_ps(output, vmask, vout01n1);
+        output = (float*restrict) ((uintptr_t) output + output_stride);
+        _mm512_mask_storeu_ps(output, vmask, vout01n2);
+        output = (float*restrict) ((uintptr_t) output + output_stride);
+        _mm512_mask_storeu_ps(output, vmask, vout01n3);
+        output = (float*restrict) ((uintptr_t) output + output_stride);
+        n -= 4;
+      }
+
+      // clean up loop, fall back to nr=1
+      while XNN_UNLIKELY(n != 0) {
+        uint32_t nnz = *nnzmap++;
+        __m512 vacc01 = _mm512_set1_ps(*w); w += 1;
+        if XNN_LIKELY(nnz != 0) {
+          do {
+            const intptr_t diff = *dmap++;
+            const __m512 vi01 = _mm512_maskz_loadu_ps(vmask, input);
+            input = (const float*restrict) ((uintptr_t) input + (uintptr_t) diff);
+            const __m512 vw = _mm512_set1_ps(*w); w += 1;
+            vacc01 = _mm512_fmadd_ps(vi01, vw, vacc01);
+          } while (--nnz != 0);
+        }
+        __m512 vout01 = _mm512_min_ps(vacc01, vmax);
+        vout01 = _mm512_max_ps(vout01, vmin);
+        _mm512_mask_storeu_ps(output, vmask, vout01);
+        output = (float*restrict) ((uintptr_t) output + output_stride);
+        n -= 1;
+      }
+      output = (float*restrict) ((uintptr_t) output - output_decrement);
+      input += 2;
+    }
+    output_decrement += 1 * sizeof(float);
+    if (mc & (1 * sizeof(float))) {
+      const __mmask16 vmask = _cvtu32_mask16(UINT32_C(0x1));
+      const float*restrict w = weights;
+      const int32_t* dmap = widx_dmap;
+      const uint32_t* nnzmap = nidx_nnzmap;
+      size_t n = nc;
+      while (n >= 4) {
+        uint32_t nnz = *nnzmap++;
+        __m512 vacc0n0 = _mm512_set1_ps(*w); w += 1;
+        __m512 vacc0n1 = _mm512_set1_ps(*w); w += 1;
+        __m512 vacc0n2 = _mm512_set1_ps(*w); w += 1;
+        __m512 vacc0n3 = _mm512_set1_ps(*w); w += 1;
+        if XNN_LIKELY(nnz != 0) {
+          do {
+            const intptr_t diff = *dmap++;
+            const __m512 vi0 = _mm512_maskz_loadu_ps(vmask, input);
+            input = (const float*restrict) ((uintptr_t) input + (uintptr_t) diff);
+            const __m512 vw0 = _mm512_set1_ps(w[0]);
+            const __m512 vw1 = _mm512_set1_ps(w[1]);
+            const __m512 vw2 = _mm512_set1_ps(w[2]);
+            const __m512 vw3 = _mm512_set1_ps(w[3]);
+            w += 4;
+            vacc0n0 = _mm512_fmadd_ps(vi0, vw0, vacc0n0);
+            vacc0n1 = _mm512_fmadd_ps(vi0, vw1, vacc0n1);
+            vacc0n2 = _mm512_fmadd_ps(vi0, vw2, vacc0n2);
+            vacc0n3 = _mm512_fmadd_ps(vi0, vw3, vacc0n3);
+          } while (--nnz != 0);
+        }
+        __m512 vout0n0 = _mm512_min_ps(vacc0n0, vmax);
+        __m512 vout0n1 = _mm512_min_ps(vacc0n1, vmax);
+        __m512 vout0n2 = _mm512_min_ps(vacc0n2, vmax);
+        __m512 vout0n3 = _mm512_min_ps(vacc0n3, vmax);
+        vout0n0 = _mm512_max_ps(vout0n0, vmin);
+        vout0n1 = _mm512_max_ps(vout0n1, vmin);
+        vout0n2 = _mm512_max_ps(vout0n2, vmin);
+        vout0n3 = _mm512_max_ps(vout0n3, vmin);
+        _mm512_mask_storeu_ps(output, vmask, vout0n0);
+        output = (float*restrict) ((uintptr_t) output + output_stride);
+        _mm512_mask_storeu_ps(output, vmask, vout0n1);
+        output = (float*restrict) ((uintptr_t) output + output_stride);
+        _mm512_mask_storeu_ps(output, vmask, vout0n2);
+        output = (float*restrict) ((uintptr_t) output + output_stride);
+        _mm512_mask_storeu_ps(output, vmask, vout0n3);
+        output = (float*restrict) ((uintptr_t) output + output_stride);
+        n -= 4;
+      }
+
+      // clean up loop, fall back to nr=1
+      while XNN_UNLIKELY(n != 0) {
+        uint32_t nnz = *nnzmap++;
+        __m512 vacc0 = _mm512_set1_ps(*w); w += 1;
+        if XNN_LIKELY(nnz != 0) {
+          do {
+            const intptr_t diff = *dmap++;
+            const __m512 vi0 = _mm512_maskz_loadu_ps(vmask, input);
+            input = (const float*restrict) ((uintptr_t) input + (uintptr_t) diff);
+            const __m512 vw = _mm512_set1_ps(*w); w += 1;
+            vacc0 = _mm512_fmadd_ps(vi0, vw, vacc0);
+          } while (--nnz != 0);
+        }
+        __m512 vout0 = _mm512_min_ps(vacc0, vmax);
+        vout0 = _mm512_max_ps(vout0, vmin);
+        _mm512_mask_storeu_ps(output, vmask, vout0);
+        output = (float*restrict) ((uintptr_t) output + output_stride);
+        n -= 1;
+      }
+      output = (float*restrict) ((uintptr_t) output - output_decrement);
+      input += 1;
+    }
+  }
+}
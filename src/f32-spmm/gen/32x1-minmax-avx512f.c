@@ -0,0 +1,204 @@
+// Auto-generated file. Do not edit!
+//   Template: src/f32-spmm/avx512f.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <immintrin.h>
+
+#include <xnnpack/intrinsics-polyfill.h>
+#include <xnnpack/spmm.h>
+
+
+void xnn_f32_spmm_minmax_ukernel_32x1__avx512f(
+    size_t mc,
+    size_t nc,
+    const float*restrict input,
+    const float*restrict weights,
+    const int32_t*restrict widx_dmap,
+    const uint32_t*restrict nidx_nnzmap,
+    float*restrict output,
+    size_t output_stride,
+    const union xnn_f32_minmax_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(mc != 0);
+  assert(mc % sizeof(float) == 0);
+  assert(nc != 0);
+
+  const __m512 vmin = _mm512_set1_ps(params->sse.min[0]);
+  const __m512 vmax = _mm512_set1_ps(params->sse.max[0]);
+  size_t output_decrement = output_stride * nc - 32 * sizeof(float);
+  while XNN_LIKELY(mc >= 32 * sizeof(float)) {
+    const float*restrict w = weights;
+    const int32_t* dmap = widx_dmap;
+    const uint32_t* nnzmap = nidx_nnzmap;
+    size_t n = nc;
+    do {
+      uint32_t nnz = *nnzmap++;
+      __m512 vacc0123456789ABCDEF = _mm512_set1_ps(*w); w += 1;
+      __m512 vaccGHIJKLMNOPQRSTUV = vacc0123456789ABCDEF;
+      if XNN_LIKELY(nnz != 0) {
+        do {
+          const intptr_t diff = *dmap++;
+          const __m512 vi0123456789ABCDEF = _mm512_loadu_ps(input);
+          const __m512 viGHIJKLMNOPQRSTUV = _mm512_loadu_ps(input + 16);
+          input = (const float*restrict) ((uintptr_t) input + (uintptr_t) diff);
+          const __m512 vw = _mm512_set1_ps(*w); w += 1;
+          vacc0123456789ABCDEF = _mm512_fmadd_ps(vi0123456789ABCDEF, vw, vacc0123456789ABCDEF);
+          vaccGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(viGHIJKLMNOPQRSTUV, vw, vaccGHIJKLMNOPQRSTUV);
+        } while (--nnz != 0);
+      }
+      __m512 vout0123456789ABCDEF = _mm512_min_ps(vacc0123456789ABCDEF, vmax);
+      __m512 voutGHIJKLMNOPQRSTUV = _mm512_min_ps(vaccGHIJKLMNOPQRSTUV, vmax);
+      vout0123456789ABCDEF = _mm512_max_ps(vout0123456789ABCDEF, vmin);
+      voutGHIJKLMNOPQRSTUV = _mm512_max_ps(voutGHIJKLMNOPQRSTUV, vmin);
+      _mm512_storeu_ps(output, vout0123456789ABCDEF);
+      _mm512_storeu_ps(output + 16, voutGHIJKLMNOPQRSTUV);
+      output = (float*restrict) ((uintptr_t) output + output_stride);
+    } while (--n != 0);
+    output = (float*restrict) ((uintptr_t) output - output_decrement);
+    input += 32;
+    mc -= 32 * sizeof(float);
+  }
+  if XNN_UNLIKELY(mc != 0) {
+    output_decrement += 16 * sizeof(float);
+    if (mc & (16 * sizeof(float))) {
+      const float*restrict w = weights;
+      const int32_t* dmap = widx_dmap;
+      const uint32_t* nnzmap = nidx_nnzmap;
+      size_t n = nc;
+      do {
+        uint32_t nnz = *nnzmap++;
+        __m512 vacc0123456789ABCDEF = _mm512_set1_ps(*w); w += 1;
+        if XNN_LIKELY(nnz != 0) {
+          do {
+            const intptr_t diff = *dmap++;
+            const __m512 vi0123456789ABCDEF = _mm512_loadu_ps(input);
+            input = (const float*restrict) ((uintptr_t) input + (uintptr_t) diff);
+            const __m512 vw = _mm512_set1_ps(*w); w += 1;
+            vacc0123456789ABCDEF = _mm512_fmadd_ps(vi0123456789ABCDEF, vw, vacc0123456789ABCDEF);
+          } while (--nnz != 0);
+        }
+        __m512 vout0123456789ABCDEF = _mm512_min_ps(vacc0123456789ABCDEF, vmax);
+        vout0123456789ABCDEF = _mm512_max_ps(vout0123456789ABCDEF, vmin);
+        _mm512_storeu_ps(output, vout0123456789ABCDEF);
+        output = (float*restrict) ((uintptr_t) output + output_stride);
+      } while (--n != 0);
+      output = (float*restrict) ((uintptr_t) output - output_decrement);
+      input += 16;
+    }
+    output_decrement += 8 * sizeof(float);
+    if (mc & (8 * sizeof(float))) {
+      const __mmask16 vmask = _cvtu32_mask16(UINT32_C(0xff));
+      const float*restrict w = weights;
+      const int32_t* dmap = widx_dmap;
+      const uint32_t* nnzmap = nidx_nnzmap;
+      size_t n = nc;
+      do {
+        uint32_t nnz = *nnzmap++;
+        __m512 vacc01234567 = _mm512_set1_ps(*w); w += 1;
+        if XNN_LIKELY(nnz != 0) {
+          do {
+            const intptr_t diff = *dmap++;
+            const __m512 vi01234567 = _mm512_maskz_loadu_ps(vmask, input);
+            input = (const float*restrict) ((uintptr_t) input + (uintptr_t) diff);
+            const __m512 vw = _mm512_set1_ps(*w); w += 1;
+            vacc01234567 = _mm512_fmadd_ps(vi01234567, vw, vacc01234567);
+          } while (--nnz != 0);
+        }
+        __m512 vout01234567 = _mm512_min_ps(vacc01234567, vmax);
+        vout01234567 = _mm512_max_ps(vout01234567, vmin);
+        _mm512_mask_storeu_ps(output, vmask, vout01234567);
+        output = (float*restrict) ((uintptr_t) output + output_stride);
+      } while (--n != 0);
+      output = (float*restrict) ((uintptr_t) output - output_decrement);
+      input += 8;
+    }
+    output_decrement += 4 * sizeof(float);
+    if (mc & (4 * sizeof(float))) {
+      const __mmask16 vmask = _cvtu32_mask16(UINT32_C(0xf));
+      const float*restrict w = weights;
+      const int32_t* dmap = widx_dmap;
+      const uint32_t* nnzmap = nidx_nnzmap;
+      size_t n = nc;
+      do {
+        uint32_t nnz = *nnzmap++;
+        __m512 vacc0123 = _mm512_set1_ps(*w); w += 1;
+        if XNN_LIKELY(nnz != 0) {
+          do {
+            const intptr_t diff = *dmap++;
+            const __m512 vi0123 = _mm512_maskz_loadu_ps(vmask, input);
+            input = (const float*restrict) ((uintptr_t) input + (uintptr_t) diff);
+            const __m512 vw = _mm512_set1_ps(*w); w += 1;
+            vacc0123 = _mm512_fmadd_ps(vi0123, vw, vacc0123);
+          } while (--nnz != 0);
+        }
+        __m512 vout0123 = _mm512_min_ps(vacc0123, vmax);
+        vout0123 = _mm512_max_ps(vout0123, vmin);
+        _mm512_mask_storeu_ps(output, vmask, vout0123);
+        output = (float*restrict) ((uintptr_t) output + output_stride);
+      } while (--n != 0);
+      output = (float*restrict) ((uintptr_t) output - output_decrement);
+      input += 4;
+    }
+    output_decrement += 2 * sizeof(float);
+    if (mc & (2 * sizeof(float))) {
+      const __mmask16 vmask = _cvtu32_mask16(UINT32_C(0x3));
+      const float*restrict w = weights;
+      const int32_t* dmap = widx_dmap;
+      const uint32_t* nnzmap = nidx_nnzmap;
+      size_t n = nc;
+      do {
+        uint32_t nnz = *nnzmap++;
+        __m512 vacc01 = _mm512_set1_ps(*w); w += 1;
+        if XNN_LIKELY(nnz != 0) {
+          do {
+            const intptr_t diff = *dmap++;
+            const __m512 vi01 = _mm512_maskz_loadu_ps(vmask, input);
+            input = (const float*restrict) ((uintptr_t) input + (uintptr_t) diff);
+            const __m512 vw = _mm512_set1_ps(*w); w += 1;
+            vacc01 = _mm512_fmadd_ps(vi01, vw, vacc01);
+          } while (--nnz != 0);
+        }
+        __m512 vout01 = _mm512_min_ps(vacc01, vmax);
+        vout01 = _mm512_max_ps(vout01, vmin);
+        _mm512_mask_storeu_ps(output, vmask, vout01);
+        output = (float*restrict) ((uintptr_t) output + output_stride);
+      } while (--n != 0);
+      output = (float*restrict) ((uintptr_t) output - output_decrement);
+      input += 2;
+    }
+    output_decrement += 1 * sizeof(float);
+    if (mc & (1 * sizeof(float))) {
+      const __mmask16 vmask = _cvtu32_mask16(UINT32_C(0x1));
+      const float*restrict w = weights;
+      const int32_t* dmap = widx_dmap;
+      const uint32_t* nnzmap = nidx_nnzmap;
+      size_t n = nc;
+      do {
+        uint32_t nnz = *nnzmap++;
+        __m512 vacc0 = _mm512_set1_ps(*w); w += 1;
+        if XNN_LIKELY(nnz != 0) {
+          do {
+            const intptr_t diff = *dmap++;
+            const __m512 vi0 = _mm512_maskz_loadu_ps(vmask, input);
+            input = (const float*restrict) ((uintptr_t) input + (uintptr_t) diff);
+            const __m512 vw = _mm512_set1_ps(*w); w += 1;
+            vacc0 = _mm512_fmadd_ps(vi0, vw, vacc0);
+          } while (--nnz != 0);
+        }
+        __m512 vout0 = _mm512_min_ps(vacc0, vmax);
+        vout0 = _mm512_max_ps(vout0, vmin);
+        _mm512_mask_storeu_ps(output, vmask, vout0);
+        output = (float*restrict) ((uintptr_t) output + output_stride);
+      } while (--n != 0);
+      output = (float*restrict) ((uintptr_t) output - output_decrement);
+      input += 1;
+    }
+  }
+}
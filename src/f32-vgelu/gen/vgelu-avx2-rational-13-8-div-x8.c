@@ -0,0 +1,120 @@
+// Auto-generated file. Do not edit!
+//   Template: src/f32-vgelu/avx2-rational-13-8-div.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <immintrin.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/vunary.h>
+
+
+void xnn_f32_vgelu_ukernel__avx2_rational_13_8_div_x8(
+    size_t n,
+    const float* x,
+    float* y,
+    const union xnn_f32_gelu_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(n != 0);
+  assert(n % sizeof(float) == 0);
+  assert(x != NULL);
+  assert(y != NULL);
+
+  const __m256 vminus_cutoff = _mm256_load_ps(params->avx_rational_13_8.minus_cutoff);
+  const __m256 vcutoff = _mm256_load_ps(params->avx_rational_13_8.cutoff);
+  const __m256 valpha13 = _mm256_load_ps(params->avx_rational_13_8.alpha13);
+  const __m256 valpha11 = _mm256_load_ps(params->avx_rational_13_8.alpha11);
+  const __m256 valpha9 = _mm256_load_ps(params->avx_rational_13_8.alpha9);
+  const __m256 valpha7 = _mm256_load_ps(params->avx_rational_13_8.alpha7);
+  const __m256 valpha5 = _mm256_load_ps(params->avx_rational_13_8.alpha5);
+  const __m256 valpha3 = _mm256_load_ps(params->avx_rational_13_8.alpha3);
+  const __m256 valpha1 = _mm256_load_ps(params->avx_rational_13_8.alpha1);
+  const __m256 vbeta8 = _mm256_load_ps(params->avx_rational_13_8.beta8);
+  const __m256 vbeta6 = _mm256_load_ps(params->avx_rational_13_8.beta6);
+  const __m256 vbeta4 = _mm256_load_ps(params->avx_rational_13_8.beta4);
+  const __m256 vbeta2 = _mm256_load_ps(params->avx_rational_13_8.beta2);
+  const __m256 vbeta0 = _mm256_load_ps(params->avx_rational_13_8.beta0);
+  const __m256 vminus_one = _mm256_load_ps(params->avx_rational_13_8.minus_one);
+  const __m256 vone = _mm256_load_ps(params->avx_rational_13_8.one);
+  const __m256 vhalf = _mm256_load_ps(params->avx_rational_13_8.half);
+
+  for (; n >= 8 * sizeof(float); n -= 8 * sizeof(float)) {
+    const __m256 vx = _mm256_loadu_ps(x);
+    x += 8;
+
+    const __m256 vz = _mm256_max_ps(vminus_cutoff, _mm256_min_ps(vx, vcutoff));
+    const __m256 vz2 = _mm256_mul_ps(vz, vz);
+
+    __m256 vp = _mm256_fmadd_ps(valpha13, vz2, valpha11);
+    vp = _mm256_fmadd_ps(vp, vz2, valpha9);
+    vp = _mm256_fmadd_ps(vp, vz2, valpha7);
+    vp = _mm256_fmadd_ps(vp, vz2, valpha5);
+    vp = _mm256_fmadd_ps(vp, vz2, valpha3);
+    vp = _mm256_fmadd_ps(vp, vz2, valpha1);
+    vp = _mm256_mul_ps(vp, vz);
+
+    __m256 vq = _mm256_fmadd_ps(vbeta8, vz2, vbeta6);
+    vq = _mm256_fmadd_ps(vq, vz2, vbeta4);
+    vq = _mm256_fmadd_ps(vq, vz2, vbeta2);
+    vq = _mm256_fmadd_ps(vq, vz2, vbeta0);
+
+    __m256 verf = _mm256_div_ps(vp, vq);
+    verf = _mm256_max_ps(vminus_one, _mm256_min_ps(verf, vone));
+
+    const __m256 vhalfx = _mm256_mul_ps(vx, vhalf);
+    const __m256 vy = _mm256_fmadd_ps(vhalfx, verf, vhalfx);
+
+    _mm256_storeu_ps(y, vy);
+    y += 8;
+  }
+  if XNN_UNLIKELY(n != 0) {
+    assert(n >= 1 * sizeof(float));
+    assert(n <= 7 * sizeof(float));
+    const __m256i vmask = _mm256_loadu_si256((const __m256i*) ((uintptr_t) &params->avx_rational_13_8.mask_table[7] - n));
+
+    const __m256 vx = _mm256_maskload_ps(x, vmask);
+
+    const __m256 vz = _mm256_max_ps(vminus_cutoff, _mm256_min_ps(vx, vcutoff));
+    const __m256 vz2 = _mm256_mul_ps(vz, vz);
+
+    __m256 vp = _mm256_fmadd_ps(valpha13, vz2, valpha11);
+    vp = _mm256_fmadd_ps(vp, vz2, valpha9);
+    vp = _mm256_fmadd_ps(vp, vz2, valpha7);
+    vp = _mm256_fmadd_ps(vp, vz2, valpha5);
+    vp = _mm256_fmadd_ps(vp, vz2, valpha3);
+    vp = _mm256_fmadd_ps(vp, vz2, valpha1);
+    vp = _mm256_mul_ps(vp, vz);
+
+    __m256 vq = _mm256_fmadd_ps(vbeta8, vz2, vbeta6);
+    vq = _mm256_fmadd_ps(vq, vz2, vbeta4);
+    vq = _mm256_fmadd_ps(vq, vz2, vbeta2);
+    vq = _mm256_fmadd_ps(vq, vz2, vbeta0);
+
+    __m256 verf = _mm256_div_ps(vp, vq);
+    verf = _mm256_max_ps(vminus_one, _mm256_min_ps(verf, vone));
+
+    const __m256 vhalfx = _mm256_mul_ps(vx, vhalf);
+    const __m256 vy = _mm256_fmadd_ps(vhalfx, verf, vhalfx);
+
+    __m128 vy_lo = _mm256_castps256_ps128(vy);
+    if (n & (4 * sizeof(float))) {
+      _mm_storeu_ps(y, vy_lo);
+      vy_lo = _mm256_extractf128_ps(vy, 1);
+      y += 4;
+    }
+    if (n & (2 * sizeof(float))) {
+      _mm_storel_pi((__m64*) y, vy_lo);
+      vy_lo = _mm_movehl_ps(vy_lo, vy_lo);
+      y += 2;
+    }
+    if (n & (1 * sizeof(float))) {
+      _mm_store_ss(y, vy_lo);
+    }
+  }
+}
@@ -0,0 +1,189 @@
+// Auto-generated file. Do not edit!
+//   Template: src/f32-vgelu/avx512f-rational-13-8-div.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <immintrin.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/intrinsics-polyfill.h>
+#include <xnnpack/vunary.h>
+
+
+void xnn_f32_vgelu_ukernel__avx512f_rational_13_8_div_x48(
+    size_t n,
+    const float* x,
+    float* y,
+    const union xnn_f32_gelu_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(n != 0);
+  assert(n % sizeof(float) == 0);
+  assert(x != NULL);
+  assert(y != NULL);
+
+  const __m512 vminus_cutoff = _mm512_set1_ps(params->avx512_rational_13_8.minus_cutoff);
+  const __m512 vcutoff = _mm512_set1_ps(params->avx512_rational_13_8.cutoff);
+  const __m512 valpha13 = _mm512_set1_ps(params->avx512_rational_13_8.alpha13);
+  const __m512 valpha11 = _mm512_set1_ps(params->avx512_rational_13_8.alpha11);
+  const __m512 valpha9 = _mm512_set1_ps(params->avx512_rational_13_8.alpha9);
+  const __m512 valpha7 = _mm512_set1_ps(params->avx512_rational_13_8.alpha7);
+  const __m512 valpha5 = _mm512_set1_ps(params->avx512_rational_13_8.alpha5);
+  const __m512 valpha3 = _mm512_set1_ps(params->avx512_rational_13_8.alpha3);
+  const __m512 valpha1 = _mm512_set1_ps(params->avx512_rational_13_8.alpha1);
+  const __m512 vbeta8 = _mm512_set1_ps(params->avx512_rational_13_8.beta8);
+  const __m512 vbeta6 = _mm512_set1_ps(params->avx512_rational_13_8.beta6);
+  const __m512 vbeta4 = _mm512_set1_ps(params->avx512_rational_13_8.beta4);
+  const __m512 vbeta2 = _mm512_set1_ps(params->avx512_rational_13_8.beta2);
+  const __m512 vbeta0 = _mm512_set1_ps(params->avx512_rational_13_8.beta0);
+  const __m512 vminus_one = _mm512_set1_ps(params->avx512_rational_13_8.minus_one);
+  const __m512 vone = _mm512_set1_ps(params->avx512_rational_13_8.one);
+  const __m512 vhalf = _mm512_set1_ps(params->avx512_rational_13_8.half);
+
+  for (; n >= 48 * sizeof(float); n -= 48 * sizeof(float)) {
+    const __m512 vx0 = _mm512_loadu_ps(x);
+    const __m512 vx1 = _mm512_loadu_ps(x + 16);
+    const __m512 vx2 = _mm512_loadu_ps(x + 32);
+    x += 48;
+
+    const __m512 vz0 = _mm512_max_ps(vminus_cutoff, _mm512_min_ps(vx0, vcutoff));
+    const __m512 vz1 = _mm512_max_ps(vminus_cutoff, _mm512_min_ps(vx1, vcutoff));
+    const __m512 vz2 = _mm512_max_ps(vminus_cutoff, _mm512_min_ps(vx2, vcutoff));
+
+    const __m512 vz20 = _mm512_mul_ps(vz0, vz0);
+    const __m512 vz21 = _mm512_mul_ps(vz1, vz1);
+    const __m512 vz22 = _mm512_mul_ps(vz2, vz2);
+
+    __m512 vp0 = _mm512_fmadd_ps(valpha13, vz20, valpha11);
+    __m512 vp1 = _mm512_fmadd_ps(valpha13, vz21, valpha11);
+    __m512 vp2 = _mm512_fmadd_ps(valpha13, vz22, valpha11);
+
+    vp0 = _mm512_fmadd_ps(vp0, vz20, valpha9);
+    vp1 = _mm512_fmadd_ps(vp1, vz21, valpha9);
+    vp2 = _mm512_fmadd_ps(vp2, vz22, valpha9);
+
+    vp0 = _mm512_fmadd_ps(vp0, vz20, valpha7);
+    vp1 = _mm512_fmadd_ps(vp1, vz21, valpha7);
+    vp2 = _mm512_fmadd_ps(vp2, vz22, valpha7);
+
+    vp0 = _mm512_fmadd_ps(vp0, vz20, valpha5);
+    vp1 = _mm512_fmadd_ps(vp1, vz21, valpha5);
+    vp2 = _mm512_fmadd_ps(vp2, vz22, valpha5);
+
+    vp0 = _mm512_fmadd_ps(vp0, vz20, valpha3);
+    vp1 = _mm512_fmadd_ps(vp1, vz21, valpha3);
+    vp2 = _mm512_fmadd_ps(vp2, vz22, valpha3);
+
+    vp0 = _mm512_fmadd_ps(vp0, vz20, valpha1);
+    vp1 = _mm512_fmadd_ps(vp1, vz21, valpha1);
+    vp2 = _mm512_fmadd_ps(vp2, vz22, valpha1);
+
+    vp0 = _mm512_mul_ps(vp0, vz0);
+    vp1 = _mm512_mul_ps(vp1, vz1);
+    vp2 = _mm512_mul_ps(vp2, vz2);
+
+    __m512 vq0 = _mm512_fmadd_ps(vbeta8, vz20, vbeta6);
+    __m512 vq1 = _mm512_fmadd_ps(vbeta8, vz21, vbeta6);
+    __m512 vq2 = _mm512_fmadd_ps(vbeta8, vz22, vbeta6);
+
+    vq0 = _mm512_fmadd_ps(vq0, vz20, vbeta4);
+    vq1 = _mm512_fmadd_ps(vq1, vz21, vbeta4);
+    vq2 = _mm512_fmadd_ps(vq2, vz22, vbeta4);
+
+    vq0 = _mm512_fmadd_ps(vq0, vz20, vbeta2);
+    vq1 = _mm512_fmadd_ps(vq1, vz21, vbeta2);
+    vq2 = _mm512_fmadd_ps(vq2, vz22, vbeta2);
+
+    vq0 = _mm512_fmadd_ps(vq0, vz20, vbeta0);
+    vq1 = _mm512_fmadd_ps(vq1, vz21, vbeta0);
+    vq2 = _mm512_fmadd_ps(vq2, vz22, vbeta0);
+
+    __m512 verf0 = _mm512_div_ps(vp0, vq0);
+    __m512 verf1 = _mm512_div_ps(vp1, vq1);
+    __m512 verf2 = _mm512_div_ps(vp2, vq2);
+
+    verf0 = _mm512_max_ps(vminus_one, _mm512_min_ps(verf0, vone));
+    verf1 = _mm512_max_ps(vminus_one, _mm512_min_ps(verf1, vone));
+    verf2 = _mm512_max_ps(vminus_one, _mm512_min_ps(verf2, vone));
+
+    const __m512 vhalfx0 = _mm512_mul_ps(vx0, vhalf);
+    const __m512 vhalfx1 = _mm512_mul_ps(vx1, vhalf);
+    const __m512 vhalfx2 = _mm512_mul_ps(vx2, vhalf);
+
+    const __m512 vy0 = _mm512_fmadd_ps(vhalfx0, verf0, vhalfx0);
+    const __m512 vy1 = _mm512_fmadd_ps(vhalfx1, verf1, vhalfx1);
+    const __m512 vy2 = _mm512_fmadd_ps(vhalfx2, verf2, vhalfx2);
+
+    _mm512_storeu_ps(y, vy0);
+    _mm512_storeu_ps(y + 16, vy1);
+    _mm512_storeu_ps(y + 32, vy2);
+    y += 48;
+  }
+  for (; n >= 16 * sizeof(float); n -= 16 * sizeof(float)) {
+    const __m512 vx = _mm512_loadu_ps(x);
+    x += 16;
+
+    const __m512 vz = _mm512_max_ps(vminus_cutoff, _mm512_min_ps(vx, vcutoff));
+    const __m512 vz2 = _mm512_mul_ps(vz, vz);
+
+    __m512 vp = _mm512_fmadd_ps(valpha13, vz2, valpha11);
+    vp = _mm512_fmadd_ps(vp, vz2, valpha9);
+    vp = _mm512_fmadd_ps(vp, vz2, valpha7);
+    vp = _mm512_fmadd_ps(vp, vz2, valpha5);
+    vp = _mm512_fmadd_ps(vp, vz2, valpha3);
+    vp = _mm512_fmadd_ps(vp, vz2, valpha1);
+    vp = _mm512_mul_ps(vp, vz);
+
+    __m512 vq = _mm512_fmadd_ps(vbeta8, vz2, vbeta6);
+    vq = _mm512_fmadd_ps(vq, vz2, vbeta4);
+    vq = _mm512_fmadd_ps(vq, vz2, vbeta2);
+    vq = _mm512_fmadd_ps(vq, vz2, vbeta0);
+
+    __m512 verf = _mm512_div_ps(vp, vq);
+    verf = _mm512_max_ps(vminus_one, _mm512_min_ps(verf, vone));
+
+    const __m512 vhalfx = _mm512_mul_ps(vx, vhalf);
+    const __m512 vy = _mm512_fmadd_ps(vhalfx, verf, vhalfx);
+
+    _mm512_storeu_ps(y, vy);
+    y += 16;
+  }
+  if XNN_UNLIKELY(n != 0) {
+    assert(n >= 1 * sizeof(float));
+    assert(n <= 15 * sizeof(float));
+    // Prepare mask for valid 32-bit elements (depends on n).
+    n >>= 2 /* log2(sizeof(float)) */;
+    const __mmask16 vmask = _cvtu32_mask16((uint16_t) ((uint32_t) (UINT32_C(1) << n) - UINT32_C(1)));
+
+    const __m512 vx = _mm512_maskz_loadu_ps(vmask, x);
+
+    const __m512 vz = _mm512_max_ps(vminus_cutoff, _mm512_min_ps(vx, vcutoff));
+    const __m512 vz2 = _mm512_mul_ps(vz, vz);
+
+    __m512 vp = _mm512_fmadd_ps(valpha13, vz2, valpha11);
+    vp = _mm512_fmadd_ps(vp, vz2, valpha9);
+    vp = _mm512_fmadd_ps(vp, vz2, valpha7);
+    vp = _mm512_fmadd_ps(vp, vz2, valpha5);
+    vp = _mm512_fmadd_ps(vp, vz2, valpha3);
+    vp = _mm512_fmadd_ps(vp, vz2, valpha1);
+    vp = _mm512_mul_ps(vp, vz);
+
+    __m512 vq = _mm512_fmadd_ps(vbeta8, vz2, vbeta6);
+    vq = _mm512_fmadd_ps(vq, vz2, vbeta4);
+    vq = _mm512_fmadd_ps(vq, vz2, vbeta2);
+    vq = _mm512_fmadd_ps(vq, vz2, vbeta0);
+
+    __m512 verf = _mm512_div_ps(vp, vq);
+    verf = _mm512_max_ps(vminus_one, _mm512_min_ps(verf, vone));
+
+    const __m512 vhalfx = _mm512_mul_ps(vx, vhalf);
+    const __m512 vy = _mm512_fmadd_ps(vhalfx, verf, vhalfx);
+
+    _mm512_mask_storeu_ps(y, vmask, vy);
+  }
+}
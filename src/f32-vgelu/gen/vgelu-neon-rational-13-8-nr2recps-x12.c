@@ -0,0 +1,205 @@
+// Auto-generated file. Do not edit!
+//   Template: src/f32-vgelu/neon-rational-13-8.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <arm_neon.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/vunary.h>
+
+
+void xnn_f32_vgelu_ukernel__neon_rational_13_8_nr2recps_x12(
+    size_t n,
+    const float* x,
+    float* y,
+    const union xnn_f32_gelu_params params[restrict XNN_MIN_ELEMENTS(1)]) XNN_OOB_READS
+{
+  assert(n != 0);
+  assert(n % sizeof(float) == 0);
+  assert(x != NULL);
+  assert(y != NULL);
+
+  const float32x4_t vminus_cutoff = vld1q_dup_f32(&params->neon_rational_13_8.minus_cutoff);
+  const float32x4_t vcutoff = vld1q_dup_f32(&params->neon_rational_13_8.cutoff);
+  const float32x4_t valpha13 = vld1q_dup_f32(&params->neon_rational_13_8.alpha13);
+  const float32x4_t valpha11 = vld1q_dup_f32(&params->neon_rational_13_8.alpha11);
+  const float32x4_t valpha9 = vld1q_dup_f32(&params->neon_rational_13_8.alpha9);
+  const float32x4_t valpha7 = vld1q_dup_f32(&params->neon_rational_13_8.alpha7);
+  const float32x4_t valpha5 = vld1q_dup_f32(&params->neon_rational_13_8.alpha5);
+  const float32x4_t valpha3 = vld1q_dup_f32(&params->neon_rational_13_8.alpha3);
+  const float32x4_t valpha1 = vld1q_dup_f32(&params->neon_rational_13_8.alpha1);
+  const float32x4_t vbeta8 = vld1q_dup_f32(&params->neon_rational_13_8.beta8);
+  const float32x4_t vbeta6 = vld1q_dup_f32(&params->neon_rational_13_8.beta6);
+  const float32x4_t vbeta4 = vld1q_dup_f32(&params->neon_rational_13_8.beta4);
+  const float32x4_t vbeta2 = vld1q_dup_f32(&params->neon_rational_13_8.beta2);
+  const float32x4_t vbeta0 = vld1q_dup_f32(&params->neon_rational_13_8.beta0);
+  const float32x4_t vminus_one = vld1q_dup_f32(&params->neon_rational_13_8.minus_one);
+  const float32x4_t vone = vld1q_dup_f32(&params->neon_rational_13_8.one);
+  const float32x4_t vhalf = vld1q_dup_f32(&params->neon_rational_13_8.half);
+
+  for (; n >= 12 * sizeof(float); n -= 12 * sizeof(float)) {
+    const float32x4_t vx0123 = vld1q_f32(x); x += 4;
+    const float32x4_t vx4567 = vld1q_f32(x); x += 4;
+    const float32x4_t vx89AB = vld1q_f32(x); x += 4;
+
+    const float32x4_t vz0123 = vmaxq_f32(vminus_cutoff, vminq_f32(vx0123, vcutoff));
+    const float32x4_t vz4567 = vmaxq_f32(vminus_cutoff, vminq_f32(vx4567, vcutoff));
+    const float32x4_t vz89AB = vmaxq_f32(vminus_cutoff, vminq_f32(vx89AB, vcutoff));
+
+    const float32x4_t vz20123 = vmulq_f32(vz0123, vz0123);
+    const float32x4_t vz24567 = vmulq_f32(vz4567, vz4567);
+    const float32x4_t vz289AB = vmulq_f32(vz89AB, vz89AB);
+
+    float32x4_t vp0123 = vmlaq_f32(valpha11, valpha13, vz20123);
+    float32x4_t vp4567 = vmlaq_f32(valpha11, valpha13, vz24567);
+    float32x4_t vp89AB = vmlaq_f32(valpha11, valpha13, vz289AB);
+
+    vp0123 = vmlaq_f32(valpha9, vp0123, vz20123);
+    vp4567 = vmlaq_f32(valpha9, vp4567, vz24567);
+    vp89AB = vmlaq_f32(valpha9, vp89AB, vz289AB);
+
+    vp0123 = vmlaq_f32(valpha7, vp0123, vz20123);
+    vp4567 = vmlaq_f32(valpha7, vp4567, vz24567);
+    vp89AB = vmlaq_f32(valpha7, vp89AB, vz289AB);
+
+    vp0123 = vmlaq_f32(valpha5, vp0123, vz20123);
+    vp4567 = vmlaq_f32(valpha5, vp4567, vz24567);
+    vp89AB = vmlaq_f32(valpha5, vp89AB, vz289AB);
+
+    vp0123 = vmlaq_f32(valpha3, vp0123, vz20123);
+    vp4567 = vmlaq_f32(valpha3, vp4567, vz24567);
+    vp89AB = vmlaq_f32(valpha3, vp89AB, vz289AB);
+
+    vp0123 = vmlaq_f32(valpha1, vp0123, vz20123);
+    vp4567 = vmlaq_f32(valpha1, vp4567, vz24567);
+    vp89AB = vmlaq_f32(valpha1, vp89AB, vz289AB);
+
+    vp0123 = vmulq_f32(vp0123, vz0123);
+    vp4567 = vmulq_f32(vp4567, vz4567);
+    vp89AB = vmulq_f32(vp89AB, vz89AB);
+
+    float32x4_t vq0123 = vmlaq_f32(vbeta6, vbeta8, vz20123);
+    float32x4_t vq4567 = vmlaq_f32(vbeta6, vbeta8, vz24567);
+    float32x4_t vq89AB = vmlaq_f32(vbeta6, vbeta8, vz289AB);
+
+    vq0123 = vmlaq_f32(vbeta4, vq0123, vz20123);
+    vq4567 = vmlaq_f32(vbeta4, vq4567, vz24567);
+    vq89AB = vmlaq_f32(vbeta4, vq89AB, vz289AB);
+
+    vq0123 = vmlaq_f32(vbeta2, vq0123, vz20123);
+    vq4567 = vmlaq_f32(vbeta2, vq4567, vz24567);
+    vq89AB = vmlaq_f32(vbeta2, vq89AB, vz289AB);
+
+    vq0123 = vmlaq_f32(vbeta0, vq0123, vz20123);
+    vq4567 = vmlaq_f32(vbeta0, vq4567, vz24567);
+    vq89AB = vmlaq_f32(vbeta0, vq89AB, vz289AB);
+
+    float32x4_t vr0123 = vrecpeq_f32(vq0123);
+    float32x4_t vr4567 = vrecpeq_f32(vq4567);
+    float32x4_t vr89AB = vrecpeq_f32(vq89AB);
+
+    vr0123 = vmulq_f32(vr0123, vrecpsq_f32(vr0123, vq0123));
+    vr4567 = vmulq_f32(vr4567, vrecpsq_f32(vr4567, vq4567));
+    vr89AB = vmulq_f32(vr89AB, vrecpsq_f32(vr89AB, vq89AB));
+
+    vr0123 = vmulq_f32(vr0123, vrecpsq_f32(vr0123, vq0123));
+    vr4567 = vmulq_f32(vr4567, vrecpsq_f32(vr4567, vq4567));
+    vr89AB = vmulq_f32(vr89AB, vrecpsq_f32(vr89AB, vq89AB));
+
+    float32x4_t verf0123 = vmulq_f32(vp0123, vr0123);
+    float32x4_t verf4567 = vmulq_f32(vp4567, vr4567);
+    float32x4_t verf89AB = vmulq_f32(vp89AB, vr89AB);
+
+    verf0123 = vmaxq_f32(vminus_one, vminq_f32(verf0123, vone));
+    verf4567 = vmaxq_f32(vminus_one, vminq_f32(verf4567, vone));
+    verf89AB = vmaxq_f32(vminus_one, vminq_f32(verf89AB, vone));
+
+    const float32x4_t vhalfx0123 = vmulq_f32(vx0123, vhalf);
+    const float32x4_t vhalfx4567 = vmulq_f32(vx4567, vhalf);
+    const float32x4_t vhalfx89AB = vmulq_f32(vx89AB, vhalf);
+
+    const float32x4_t vy0123 = vmlaq_f32(vhalfx0123, vhalfx0123, verf0123);
+    const float32x4_t vy4567 = vmlaq_f32(vhalfx4567, vhalfx4567, verf4567);
+    const float32x4_t vy89AB = vmlaq_f32(vhalfx89AB, vhalfx89AB, verf89AB);
+
+    vst1q_f32(y, vy0123); y += 4;
+    vst1q_f32(y, vy4567); y += 4;
+    vst1q_f32(y, vy89AB); y += 4;
+  }
+  for (; n >= 4 * sizeof(float); n -= 4 * sizeof(float)) {
+    const float32x4_t vx = vld1q_f32(x); x += 4;
+
+    const float32x4_t vz = vmaxq_f32(vminus_cutoff, vminq_f32(vx, vcutoff));
+    const float32x4_t vz2 = vmulq_f32(vz, vz);
+
+    float32x4_t vp = vmlaq_f32(valpha11, valpha13, vz2);
+    vp = vmlaq_f32(valpha9, vp, vz2);
+    vp = vmlaq_f32(valpha7, vp, vz2);
+    vp = vmlaq_f32(valpha5, vp, vz2);
+    vp = vmlaq_f32(valpha3, vp, vz2);
+    vp = vmlaq_f32(valpha1, vp, vz2);
+    vp = vmulq_f32(vp, vz);
+
+    float32x4_t vq = vmlaq_f32(vbeta6, vbeta8, vz2);
+    vq = vmlaq_f32(vbeta4, vq, vz2);
+    vq = vmlaq_f32(vbeta2, vq, vz2);
+    vq = vmlaq_f32(vbeta0, vq, vz2);
+
+    float32x4_t vr = vrecpeq_f32(vq);
+    vr = vmulq_f32(vr, vrecpsq_f32(vr, vq));
+    vr = vmulq_f32(vr, vrecpsq_f32(vr, vq));
+    float32x4_t verf = vmulq_f32(vp, vr);
+
+    verf = vmaxq_f32(vminus_one, vminq_f32(verf, vone));
+
+    const float32x4_t vhalfx = vmulq_f32(vx, vhalf);
+    const float32x4_t vy = vmlaq_f32(vhalfx, vhalfx, verf);
+
+    vst1q_f32(y, vy); y += 4;
+  }
+  if XNN_UNLIKELY(n != 0) {
+    const float32x4_t vx = vld1q_f32(x);
+
+    const float32x4_t vz = vmaxq_f32(vminus_cutoff, vminq_f32(vx, vcutoff));
+    const float32x4_t vz2 = vmulq_f32(vz, vz);
+
+    float32x4_t vp = vmlaq_f32(valpha11, valpha13, vz2);
+    vp = vmlaq_f32(valpha9, vp, vz2);
+    vp = vmlaq_f32(valpha7, vp, vz2);
+    vp = vmlaq_f32(valpha5, vp, vz2);
+    vp = vmlaq_f32(valpha3, vp, vz2);
+    vp = vmlaq_f32(valpha1, vp, vz2);
+    vp = vmulq_f32(vp, vz);
+
+    float32x4_t vq = vmlaq_f32(vbeta6, vbeta8, vz2);
+    vq = vmlaq_f32(vbeta4, vq, vz2);
+    vq = vmlaq_f32(vbeta2, vq, vz2);
+    vq = vmlaq_f32(vbeta0, vq, vz2);
+
+    float32x4_t vr = vrecpeq_f32(vq);
+    vr = vmulq_f32(vr, vrecpsq_f32(vr, vq));
+    vr = vmulq_f32(vr, vrecpsq_f32(vr, vq));
+    float32x4_t verf = vmulq_f32(vp, vr);
+
+    verf = vmaxq_f32(vminus_one, vminq_f32(verf, vone));
+
+    const float32x4_t vhalfx = vmulq_f32(vx, vhalf);
+    const float32x4_t vy = vmlaq_f32(vhalfx, vhalfx, verf);
+
+    float32x2_t vy_lo = vget_low_f32(vy);
+    if (n & (2 * sizeof(float))) {
+      vst1_f32(y, vy_lo); y += 2;
+      vy_lo = vget_high_f32(vy);
+    }
+    if (n & (1 * sizeof(float))) {
+      vst1_lane_f32(y, vy_lo, 0);
+    }
+  }
+}
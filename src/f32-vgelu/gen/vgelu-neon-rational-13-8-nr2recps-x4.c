@@ -0,0 +1,116 @@
+// Auto-generated file. Do not edit!
+//   Template: src/f32-vgelu/neon-rational-13-8.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <arm_neon.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/vunary.h>
+
+
+void xnn_f32_vgelu_ukernel__neon_rational_13_8_nr2recps_x4(
+    size_t n,
+    const float* x,
+    float* y,
+    const union xnn_f32_gelu_params params[restrict XNN_MIN_ELEMENTS(1)]) XNN_OOB_READS
+{
+  assert(n != 0);
+  assert(n % sizeof(float) == 0);
+  assert(x != NULL);
+  assert(y != NULL);
+
+  const float32x4_t vminus_cutoff = vld1q_dup_f32(&params->neon_rational_13_8.minus_cutoff);
+  const float32x4_t vcutoff = vld1q_dup_f32(&params->neon_rational_13_8.cutoff);
+  const float32x4_t valpha13 = vld1q_dup_f32(&params->neon_rational_13_8.alpha13);
+  const float32x4_t valpha11 = vld1q_dup_f32(&params->neon_rational_13_8.alpha11);
+  const float32x4_t valpha9 = vld1q_dup_f32(&params->neon_rational_13_8.alpha9);
+  const float32x4_t valpha7 = vld1q_dup_f32(&params->neon_rational_13_8.alpha7);
+  const float32x4_t valpha5 = vld1q_dup_f32(&params->neon_rational_13_8.alpha5);
+  const float32x4_t valpha3 = vld1q_dup_f32(&params->neon_rational_13_8.alpha3);
+  const float32x4_t valpha1 = vld1q_dup_f32(&params->neon_rational_13_8.alpha1);
+  const float32x4_t vbeta8 = vld1q_dup_f32(&params->neon_rational_13_8.beta8);
+  const float32x4_t vbeta6 = vld1q_dup_f32(&params->neon_rational_13_8.beta6);
+  const float32x4_t vbeta4 = vld1q_dup_f32(&params->neon_rational_13_8.beta4);
+  const float32x4_t vbeta2 = vld1q_dup_f32(&params->neon_rational_13_8.beta2);
+  const float32x4_t vbeta0 = vld1q_dup_f32(&params->neon_rational_13_8.beta0);
+  const float32x4_t vminus_one = vld1q_dup_f32(&params->neon_rational_13_8.minus_one);
+  const float32x4_t vone = vld1q_dup_f32(&params->neon_rational_13_8.one);
+  const float32x4_t vhalf = vld1q_dup_f32(&params->neon_rational_13_8.half);
+
+  for (; n >= 4 * sizeof(float); n -= 4 * sizeof(float)) {
+    const float32x4_t vx = vld1q_f32(x); x += 4;
+
+    const float32x4_t vz = vmaxq_f32(vminus_cutoff, vminq_f32(vx, vcutoff));
+    const float32x4_t vz2 = vmulq_f32(vz, vz);
+
+    float32x4_t vp = vmlaq_f32(valpha11, valpha13, vz2);
+    vp = vmlaq_f32(valpha9, vp, vz2);
+    vp = vmlaq_f32(valpha7, vp, vz2);
+    vp = vmlaq_f32(valpha5, vp, vz2);
+    vp = vmlaq_f32(valpha3, vp, vz2);
+    vp = vmlaq_f32(valpha1, vp, vz2);
+    vp = vmulq_f32(vp, vz);
+
+    float32x4_t vq = vmlaq_f32(vbeta6, vbeta8, vz2);
+    vq = vmlaq_f32(vbeta4, vq, vz2);
+    vq = vmlaq_f32(vbeta2, vq, vz2);
+    vq = vmlaq_f32(vbeta0, vq, vz2);
+
+    float32x4_t vr = vrecpeq_f32(vq);
+    vr = vmulq_f32(vr, vrecpsq_f32(vr, vq));
+    vr = vmulq_f32(vr, vrecpsq_f32(vr, vq));
+    float32x4_t verf = vmulq_f32(vp, vr);
+
+    verf = vmaxq_f32(vminus_one, vminq_f32(verf, vone));
+
+    const float32x4_t vhalfx = vmulq_f32(vx, vhalf);
+    const float32x4_t vy = vmlaq_f32(vhalfx, vhalfx, verf);
+
+    vst1q_f32(y, vy); y += 4;
+  }
+  if XNN_UNLIKELY(n != 0) {
+    const float32x4_t vx = vld1q_f32(x);
+
+    const float32x4_t vz = vmaxq_f32(vminus_cutoff, vminq_f32(vx, vcutoff));
+    const float32x4_t vz2 = vmulq_f32(vz, vz);
+
+    float32x4_t vp = vmlaq_f32(valpha11, valpha13, vz2);
+    vp = vmlaq_f32(valpha9, vp, vz2);
+    vp = vmlaq_f32(valpha7, vp, vz2);
+    vp = vmlaq_f32(valpha5, vp, vz2);
+    vp = vmlaq_f32(valpha3, vp, vz2);
+    vp = vmlaq_f32(valpha1, vp, vz2);
+    vp = vmulq_f32(vp, vz);
+
+    float32x4_t vq = vmlaq_f32(vbeta6, vbeta8, vz2);
+    vq = vmlaq_f32(vbeta4, vq, vz2);
+    vq = vmlaq_f32(vbeta2, vq, vz2);
+    vq = vmlaq_f32(vbeta0, vq, vz2);
+
+    float32x4_t vr = vrecpeq_f32(vq);
+    vr = vmulq_f32(vr, vrecpsq_f32(vr, vq));
+    vr = vmulq_f32(vr, vrecpsq_f32(vr, vq));
+    float32x4_t verf = vmulq_f32(vp, vr);
+
+    verf = vmaxq_f32(vminus_one, vminq_f32(verf, vone));
+
+    const float32x4_t vhalfx = vmulq_f32(vx, vhalf);
+    const float32x4_t vy = vmlaq_f32(vhalfx, vhalfx, verf);
+
+    float32x2_t vy_lo = vget_low_f32(vy);
+    if (n & (2 * sizeof(float))) {
+      vst1_f32(y, vy_lo); y += 2;
+      vy_lo = vget_high_f32(vy);
+    }
+    if (n & (1 * sizeof(float))) {
+      vst1_lane_f32(y, vy_lo, 0);
+    }
+  }
+}
@@ -0,0 +1,133 @@
+// Auto-generated file. Do not edit!
+//   Template: src/f32-vgelu/scalar-rational-13-8-div.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/math.h>
+#include <xnnpack/vunary.h>
+
+
+void xnn_f32_vgelu_ukernel__scalar_rational_13_8_div_x2(
+    size_t n,
+    const float* x,
+    float* y,
+    const union xnn_f32_gelu_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(n != 0);
+  assert(n % sizeof(float) == 0);
+  assert(x != NULL);
+  assert(y != NULL);
+
+  const float vminus_cutoff = params->scalar_rational_13_8.minus_cutoff;
+  const float vcutoff = params->scalar_rational_13_8.cutoff;
+  const float valpha13 = params->scalar_rational_13_8.alpha13;
+  const float valpha11 = params->scalar_rational_13_8.alpha11;
+  const float valpha9 = params->scalar_rational_13_8.alpha9;
+  const float valpha7 = params->scalar_rational_13_8.alpha7;
+  const float valpha5 = params->scalar_rational_13_8.alpha5;
+  const float valpha3 = params->scalar_rational_13_8.alpha3;
+  const float valpha1 = params->scalar_rational_13_8.alpha1;
+  const float vbeta8 = params->scalar_rational_13_8.beta8;
+  const float vbeta6 = params->scalar_rational_13_8.beta6;
+  const float vbeta4 = params->scalar_rational_13_8.beta4;
+  const float vbeta2 = params->scalar_rational_13_8.beta2;
+  const float vbeta0 = params->scalar_rational_13_8.beta0;
+  const float vminus_one = params->scalar_rational_13_8.minus_one;
+  const float vone = params->scalar_rational_13_8.one;
+  const float vhalf = params->scalar_rational_13_8.half;
+
+  for (; n >= 2 * sizeof(float); n -= 2 * sizeof(float)) {
+    const float vx0 = x[0];
+    const float vx1 = x[1];
+    x += 2;
+
+    const float vz0 = math_max_f32(vminus_cutoff, math_min_f32(vx0, vcutoff));
+    const float vz1 = math_max_f32(vminus_cutoff, math_min_f32(vx1, vcutoff));
+
+    const float vz20 = vz0 * vz0;
+    const float vz21 = vz1 * vz1;
+
+    float vp0 = valpha13 * vz20 + valpha11;
+    float vp1 = valpha13 * vz21 + valpha11;
+
+    vp0 = vp0 * vz20 + valpha9;
+    vp1 = vp1 * vz21 + valpha9;
+
+    vp0 = vp0 * vz20 + valpha7;
+    vp1 = vp1 * vz21 + valpha7;
+
+    vp0 = vp0 * vz20 + valpha5;
+    vp1 = vp1 * vz21 + valpha5;
+
+    vp0 = vp0 * vz20 + valpha3;
+    vp1 = vp1 * vz21 + valpha3;
+
+    vp0 = vp0 * vz20 + valpha1;
+    vp1 = vp1 * vz21 + valpha1;
+
+    vp0 *= vz0;
+    vp1 *= vz1;
+
+    float vq0 = vbeta8 * vz20 + vbeta6;
+    float vq1 = vbeta8 * vz21 + vbeta6;
+
+    vq0 = vq0 * vz20 + vbeta4;
+    vq1 = vq1 * vz21 + vbeta4;
+
+    vq0 = vq0 * vz20 + vbeta2;
+    vq1 = vq1 * vz21 + vbeta2;
+
+    vq0 = vq0 * vz20 + vbeta0;
+    vq1 = vq1 * vz21 + vbeta0;
+
+    float verf0 = vp0 / vq0;
+    float verf1 = vp1 / vq1;
+
+    verf0 = math_max_f32(vminus_one, math_min_f32(verf0, vone));
+    verf1 = math_max_f32(vminus_one, math_min_f32(verf1, vone));
+
+    const float vhalfx0 = vx0 * vhalf;
+    const float vhalfx1 = vx1 * vhalf;
+
+    const float vy0 = vhalfx0 * verf0 + vhalfx0;
+    const float vy1 = vhalfx1 * verf1 + vhalfx1;
+
+    y[0] = vy0;
+    y[1] = vy1;
+    y += 2;
+  }
+  if XNN_UNLIKELY(n != 0) {
+    const float vx = *x;
+
+    const float vz = math_max_f32(vminus_cutoff, math_min_f32(vx, vcutoff));
+    const float vz2 = vz * vz;
+
+    float vp = valpha13 * vz2 + valpha11;
+    vp = vp * vz2 + valpha9;
+    vp = vp * vz2 + valpha7;
+    vp = vp * vz2 + valpha5;
+    vp = vp * vz2 + valpha3;
+    vp = vp * vz2 + valpha1;
+    vp *= vz;
+
+    float vq = vbeta8 * vz2 + vbeta6;
+    vq = vq * vz2 + vbeta4;
+    vq = vq * vz2 + vbeta2;
+    vq = vq * vz2 + vbeta0;
+
+    float verf = vp / vq;
+    verf = math_max_f32(vminus_one, math_min_f32(verf, vone));
+
+    const float vhalfx = vx * vhalf;
+    const float vy = vhalfx * verf + vhalfx;
+
+    *y = vy;
+  }
+}
@@ -0,0 +1,170 @@
+// Auto-generated file. Do not edit!
+//   Template: src/f32-vgelu/sse-rational-13-8-div.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <emmintrin.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/vunary.h>
+
+
+void xnn_f32_vgelu_ukernel__sse2_rational_13_8_div_x8(
+    size_t n,
+    const float* x,
+    float* y,
+    const union xnn_f32_gelu_params params[restrict XNN_MIN_ELEMENTS(1)]) XNN_OOB_READS
+{
+  assert(n != 0);
+  assert(n % sizeof(float) == 0);
+  assert(x != NULL);
+  assert(y != NULL);
+
+  const __m128 vminus_cutoff = _mm_load_ps(params->sse_rational_13_8.minus_cutoff);
+  const __m128 vcutoff = _mm_load_ps(params->sse_rational_13_8.cutoff);
+  const __m128 valpha13 = _mm_load_ps(params->sse_rational_13_8.alpha13);
+  const __m128 valpha11 = _mm_load_ps(params->sse_rational_13_8.alpha11);
+  const __m128 valpha9 = _mm_load_ps(params->sse_rational_13_8.alpha9);
+  const __m128 valpha7 = _mm_load_ps(params->sse_rational_13_8.alpha7);
+  const __m128 valpha5 = _mm_load_ps(params->sse_rational_13_8.alpha5);
+  const __m128 valpha3 = _mm_load_ps(params->sse_rational_13_8.alpha3);
+  const __m128 valpha1 = _mm_load_ps(params->sse_rational_13_8.alpha1);
+  const __m128 vbeta8 = _mm_load_ps(params->sse_rational_13_8.beta8);
+  const __m128 vbeta6 = _mm_load_ps(params->sse_rational_13_8.beta6);
+  const __m128 vbeta4 = _mm_load_ps(params->sse_rational_13_8.beta4);
+  const __m128 vbeta2 = _mm_load_ps(params->sse_rational_13_8.beta2);
+  const __m128 vbeta0 = _mm_load_ps(params->sse_rational_13_8.beta0);
+  const __m128 vminus_one = _mm_load_ps(params->sse_rational_13_8.minus_one);
+  const __m128 vone = _mm_load_ps(params->sse_rational_13_8.one);
+  const __m128 vhalf = _mm_load_ps(params->sse_rational_13_8.half);
+
+  for (; n >= 8 * sizeof(float); n -= 8 * sizeof(float)) {
+    const __m128 vx0123 = _mm_loadu_ps(x);
+    const __m128 vx4567 = _mm_loadu_ps(x + 4);
+    x += 8;
+
+    const __m128 vz0123 = _mm_max_ps(vminus_cutoff, _mm_min_ps(vx0123, vcutoff));
+    const __m128 vz4567 = _mm_max_ps(vminus_cutoff, _mm_min_ps(vx4567, vcutoff));
+
+    const __m128 vz20123 = _mm_mul_ps(vz0123, vz0123);
+    const __m128 vz24567 = _mm_mul_ps(vz4567, vz4567);
+
+    __m128 vp0123 = _mm_add_ps(_mm_mul_ps(valpha13, vz20123), valpha11);
+    __m128 vp4567 = _mm_add_ps(_mm_mul_ps(valpha13, vz24567), valpha11);
+
+    vp0123 = _mm_add_ps(_mm_mul_ps(vp0123, vz20123), valpha9);
+    vp4567 = _mm_add_ps(_mm_mul_ps(vp4567, vz24567), valpha9);
+
+    vp0123 = _mm_add_ps(_mm_mul_ps(vp0123, vz20123), valpha7);
+    vp4567 = _mm_add_ps(_mm_mul_ps(vp4567, vz24567), valpha7);
+
+    vp0123 = _mm_add_ps(_mm_mul_ps(vp0123, vz20123), valpha5);
+    vp4567 = _mm_add_ps(_mm_mul_ps(vp4567, vz24567), valpha5);
+
+    vp0123 = _mm_add_ps(_mm_mul_ps(vp0123, vz20123), valpha3);
+    vp4567 = _mm_add_ps(_mm_mul_ps(vp4567, vz24567), valpha3);
+
+    vp0123 = _mm_add_ps(_mm_mul_ps(vp0123, vz20123), valpha1);
+    vp4567 = _mm_add_ps(_mm_mul_ps(vp4567, vz24567), valpha1);
+
+    vp0123 = _mm_mul_ps(vp0123, vz0123);
+    vp4567 = _mm_mul_ps(vp4567, vz4567);
+
+    __m128 vq0123 = _mm_add_ps(_mm_mul_ps(vbeta8, vz20123), vbeta6);
+    __m128 vq4567 = _mm_add_ps(_mm_mul_ps(vbeta8, vz24567), vbeta6);
+
+    vq0123 = _mm_add_ps(_mm_mul_ps(vq0123, vz20123), vbeta4);
+    vq4567 = _mm_add_ps(_mm_mul_ps(vq4567, vz24567), vbeta4);
+
+    vq0123 = _mm_add_ps(_mm_mul_ps(vq0123, vz20123), vbeta2);
+    vq4567 = _mm_add_ps(_mm_mul_ps(vq4567, vz24567), vbeta2);
+
+    vq0123 = _mm_add_ps(_mm_mul_ps(vq0123, vz20123), vbeta0);
+    vq4567 = _mm_add_ps(_mm_mul_ps(vq4567, vz24567), vbeta0);
+
+    __m128 verf0123 = _mm_div_ps(vp0123, vq0123);
+    __m128 verf4567 = _mm_div_ps(vp4567, vq4567);
+
+    verf0123 = _mm_max_ps(vminus_one, _mm_min_ps(verf0123, vone));
+    verf4567 = _mm_max_ps(vminus_one, _mm_min_ps(verf4567, vone));
+
+    const __m128 vhalfx0123 = _mm_mul_ps(vx0123, vhalf);
+    const __m128 vhalfx4567 = _mm_mul_ps(vx4567, vhalf);
+
+    const __m128 vy0123 = _mm_add_ps(_mm_mul_ps(vhalfx0123, verf0123), vhalfx0123);
+    const __m128 vy4567 = _mm_add_ps(_mm_mul_ps(vhalfx4567, verf4567), vhalfx4567);
+
+    _mm_storeu_ps(y, vy0123);
+    _mm_storeu_ps(y + 4, vy4567);
+    y += 8;
+  }
+  for (; n >= 4 * sizeof(float); n -= 4 * sizeof(float)) {
+    const __m128 vx = _mm_loadu_ps(x);
+    x += 4;
+
+    const __m128 vz = _mm_max_ps(vminus_cutoff, _mm_min_ps(vx, vcutoff));
+    const __m128 vz2 = _mm_mul_ps(vz, vz);
+
+    __m128 vp = _mm_add_ps(_mm_mul_ps(valpha13, vz2), valpha11);
+    vp = _mm_add_ps(_mm_mul_ps(vp, vz2), valpha9);
+    vp = _mm_add_ps(_mm_mul_ps(vp, vz2), valpha7);
+    vp = _mm_add_ps(_mm_mul_ps(vp, vz2), valpha5);
+    vp = _mm_add_ps(_mm_mul_ps(vp, vz2), valpha3);
+    vp = _mm_add_ps(_mm_mul_ps(vp, vz2), valpha1);
+    vp = _mm_mul_ps(vp, vz);
+
+    __m128 vq = _mm_add_ps(_mm_mul_ps(vbeta8, vz2), vbeta6);
+    vq = _mm_add_ps(_mm_mul_ps(vq, vz2), vbeta4);
+    vq = _mm_add_ps(_mm_mul_ps(vq, vz2), vbeta2);
+    vq = _mm_add_ps(_mm_mul_ps(vq, vz2), vbeta0);
+
+    __m128 verf = _mm_div_ps(vp, vq);
+    verf = _mm_max_ps(vminus_one, _mm_min_ps(verf, vone));
+
+    const __m128 vhalfx = _mm_mul_ps(vx, vhalf);
+    const __m128 vy = _mm_add_ps(_mm_mul_ps(vhalfx, verf), vhalfx);
+
+    _mm_storeu_ps(y, vy);
+    y += 4;
+  }
+  if XNN_UNLIKELY(n != 0) {
+    const __m128 vx = _mm_loadu_ps(x);
+
+    const __m128 vz = _mm_max_ps(vminus_cutoff, _mm_min_ps(vx, vcutoff));
+    const __m128 vz2 = _mm_mul_ps(vz, vz);
+
+    __m128 vp = _mm_add_ps(_mm_mul_ps(valpha13, vz2), valpha11);
+    vp = _mm_add_ps(_mm_mul_ps(vp, vz2), valpha9);
+    vp = _mm_add_ps(_mm_mul_ps(vp, vz2), valpha7);
+    vp = _mm_add_ps(_mm_mul_ps(vp, vz2), valpha5);
+    vp = _mm_add_ps(_mm_mul_ps(vp, vz2), valpha3);
+    vp = _mm_add_ps(_mm_mul_ps(vp, vz2), valpha1);
+    vp = _mm_mul_ps(vp, vz);
+
+    __m128 vq = _mm_add_ps(_mm_mul_ps(vbeta8, vz2), vbeta6);
+    vq = _mm_add_ps(_mm_mul_ps(vq, vz2), vbeta4);
+    vq = _mm_add_ps(_mm_mul_ps(vq, vz2), vbeta2);
+    vq = _mm_add_ps(_mm_mul_ps(vq, vz2), vbeta0);
+
+    __m128 verf = _mm_div_ps(vp, vq);
+    verf = _mm_max_ps(vminus_one, _mm_min_ps(verf, vone));
+
+    const __m128 vhalfx = _mm_mul_ps(vx, vhalf);
+    __m128 vy = _mm_add_ps(_mm_mul_ps(vhalfx, verf), vhalfx);
+
+    if (n & (2 * sizeof(float))) {
+      _mm_storel_pi((__m64*) y, vy);
+      vy = _mm_movehl_ps(vy, vy);
+      y += 2;
+    }
+    if (n & (1 * sizeof(float))) {
+      _mm_store_ss(y, vy);
+    }
+  }
+}
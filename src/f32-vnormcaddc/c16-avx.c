@@ -0,0 +1,79 @@
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <immintrin.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/vnormcaddc.h>
+
+
+void xnn_f32_vnormcaddc_ukernel_c16__avx(
+    size_t channels,
+    const float* input,
+    const float* mean,
+    const float* inv_stddev,
+    const float* weights,
+    float* output,
+    const union xnn_f32_default_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(channels != 0);
+  assert(channels % sizeof(float) == 0);
+
+  const __m256 vmean = _mm256_broadcast_ss(mean);
+  const __m256 vinv_stddev = _mm256_broadcast_ss(inv_stddev);
+  for (; channels >= 16 * sizeof(float); channels -= 16 * sizeof(float)) {
+    const __m256 vx01234567 = _mm256_loadu_ps(input);
+    const __m256 vx89ABCDEF = _mm256_loadu_ps(input + 8);
+    input += 16;
+
+    const __m256 vscale01234567 = _mm256_load_ps(weights);
+    const __m256 vscale89ABCDEF = _mm256_load_ps(weights + 8);
+    const __m256 vbias01234567 = _mm256_load_ps(weights + 16);
+    const __m256 vbias89ABCDEF = _mm256_load_ps(weights + 24);
+    weights += 32;
+
+    const __m256 vnorm01234567 = _mm256_mul_ps(_mm256_sub_ps(vx01234567, vmean), vinv_stddev);
+    const __m256 vnorm89ABCDEF = _mm256_mul_ps(_mm256_sub_ps(vx89ABCDEF, vmean), vinv_stddev);
+
+    const __m256 vy01234567 = _mm256_add_ps(_mm256_mul_ps(vnorm01234567, vscale01234567), vbias01234567);
+    const __m256 vy89ABCDEF = _mm256_add_ps(_mm256_mul_ps(vnorm89ABCDEF, vscale89ABCDEF), vbias89ABCDEF);
+
+    _mm256_storeu_ps(output, vy01234567);
+    _mm256_storeu_ps(output + 8, vy89ABCDEF);
+    output += 16;
+  }
+  if (channels >= 8 * sizeof(float)) {
+    const __m256 vx = _mm256_loadu_ps(input);
+    input += 8;
+
+    const __m256 vscale = _mm256_load_ps(weights);
+    const __m256 vbias = _mm256_load_ps(weights + 16);
+    weights += 8;
+
+    const __m256 vnorm = _mm256_mul_ps(_mm256_sub_ps(vx, vmean), vinv_stddev);
+    const __m256 vy = _mm256_add_ps(_mm256_mul_ps(vnorm, vscale), vbias);
+
+    _mm256_storeu_ps(output, vy);
+    output += 8;
+    channels -= 8 * sizeof(float);
+  }
+  if XNN_UNLIKELY(channels != 0) {
+    assert(channels >= 1 * sizeof(float));
+    assert(channels <= 7 * sizeof(float));
+    const __m256i vmask = _mm256_loadu_si256((const __m256i*) ((uintptr_t) &params->avx.mask_table[7] - channels));
+
+    const __m256 vx = _mm256_maskload_ps(input, vmask);
+
+    const __m256 vscale = _mm256_load_ps(weights);
+    const __m256 vbias = _mm256_load_ps(weights + 16);
+
+    const __m256 vnorm = _mm256_mul_ps(_mm256_sub_ps(vx, vmean), vinv_stddev);
+    const __m256 vy = _mm256_add_ps(_mm256_mul_ps(vnorm, vscale), vbias);
+
+    _mm256_maskstore_ps(output, vmask, vy);
+  }
+}
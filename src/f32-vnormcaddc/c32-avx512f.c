@@ -0,0 +1,81 @@
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <immintrin.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/intrinsics-polyfill.h>
+#include <xnnpack/vnormcaddc.h>
+
+
+void xnn_f32_vnormcaddc_ukernel_c32__avx512f(
+    size_t channels,
+    const float* input,
+    const float* mean,
+    const float* inv_stddev,
+    const float* weights,
+    float* output,
+    const union xnn_f32_default_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(channels != 0);
+  assert(channels % sizeof(float) == 0);
+
+  const __m512 vmean = _mm512_set1_ps(*mean);
+  const __m512 vinv_stddev = _mm512_set1_ps(*inv_stddev);
+  for (; channels >= 32 * sizeof(float); channels -= 32 * sizeof(float)) {
+    const __m512 vx0123456789ABCDEF = _mm512_loadu_ps(input);
+    const __m512 vxGHIJKLMNOPQRSTUV = _mm512_loadu_ps(input + 16);
+    input += 32;
+
+    const __m512 vscale0123456789ABCDEF = _mm512_load_ps(weights);
+    const __m512 vscaleGHIJKLMNOPQRSTUV = _mm512_load_ps(weights + 16);
+    const __m512 vbias0123456789ABCDEF = _mm512_load_ps(weights + 32);
+    const __m512 vbiasGHIJKLMNOPQRSTUV = _mm512_load_ps(weights + 48);
+    weights += 64;
+
+    const __m512 vnorm0123456789ABCDEF = _mm512_mul_ps(_mm512_sub_ps(vx0123456789ABCDEF, vmean), vinv_stddev);
+    const __m512 vnormGHIJKLMNOPQRSTUV = _mm512_mul_ps(_mm512_sub_ps(vxGHIJKLMNOPQRSTUV, vmean), vinv_stddev);
+
+    const __m512 vy0123456789ABCDEF = _mm512_fmadd_ps(vnorm0123456789ABCDEF, vscale0123456789ABCDEF, vbias0123456789ABCDEF);
+    const __m512 vyGHIJKLMNOPQRSTUV = _mm512_fmadd_ps(vnormGHIJKLMNOPQRSTUV, vscaleGHIJKLMNOPQRSTUV, vbiasGHIJKLMNOPQRSTUV);
+
+    _mm512_storeu_ps(output, vy0123456789ABCDEF);
+    _mm512_storeu_ps(output + 16, vyGHIJKLMNOPQRSTUV);
+    output += 32;
+  }
+  if (channels >= 16 * sizeof(float)) {
+    const __m512 vx = _mm512_loadu_ps(input);
+    input += 16;
+
+    const __m512 vscale = _mm512_load_ps(weights);
+    const __m512 vbias = _mm512_load_ps(weights + 32);
+    weights += 16;
+
+    const __m512 vnorm = _mm512_mul_ps(_mm512_sub_ps(vx, vmean), vinv_stddev);
+    const __m512 vy = _mm512_fmadd_ps(vnorm, vscale, vbias);
+
+    _mm512_storeu_ps(output, vy);
+    output += 16;
+    channels -= 16 * sizeof(float);
+  }
+  if XNN_UNLIKELY(channels != 0) {
+    assert(channels >= 1 * sizeof(float));
+    assert(channels <= 15 * sizeof(float));
+    // Prepare mask for valid 32-bit elements (depends on channels).
+    const __mmask16 vmask = _cvtu32_mask16((uint16_t) ((uint32_t) (UINT32_C(1) << (channels >> 2 /* log2(sizeof(float)) */)) - UINT32_C(1)));
+
+    const __m512 vx = _mm512_maskz_loadu_ps(vmask, input);
+
+    const __m512 vscale = _mm512_load_ps(weights);
+    const __m512 vbias = _mm512_load_ps(weights + 32);
+
+    const __m512 vnorm = _mm512_mul_ps(_mm512_sub_ps(vx, vmean), vinv_stddev);
+    const __m512 vy = _mm512_fmadd_ps(vnorm, vscale, vbias);
+
+    _mm512_mask_storeu_ps(output, vmask, vy);
+  }
+}
@@ -0,0 +1,55 @@
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/vnormcaddc.h>
+
+
+void xnn_f32_vnormcaddc_ukernel_c4__scalar(
+    size_t channels,
+    const float* input,
+    const float* mean,
+    const float* inv_stddev,
+    const float* weights,
+    float* output,
+    const union xnn_f32_default_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(channels != 0);
+  assert(channels % sizeof(float) == 0);
+
+  const float vmean = *mean;
+  const float vinv_stddev = *inv_stddev;
+  for (; channels >= 4 * sizeof(float); channels -= 4 * sizeof(float)) {
+    const float vx0 = input[0];
+    const float vx1 = input[1];
+    const float vx2 = input[2];
+    const float vx3 = input[3];
+    input += 4;
+
+    const float vnorm0 = (vx0 - vmean) * vinv_stddev;
+    const float vnorm1 = (vx1 - vmean) * vinv_stddev;
+    const float vnorm2 = (vx2 - vmean) * vinv_stddev;
+    const float vnorm3 = (vx3 - vmean) * vinv_stddev;
+
+    output[0] = vnorm0 * weights[0] + weights[4];
+    output[1] = vnorm1 * weights[1] + weights[5];
+    output[2] = vnorm2 * weights[2] + weights[6];
+    output[3] = vnorm3 * weights[3] + weights[7];
+    output += 4;
+
+    weights += 8;
+  }
+  if XNN_UNLIKELY(channels != 0) {
+    do {
+      const float vx = *input++;
+      const float vnorm = (vx - vmean) * vinv_stddev;
+      *output++ = vnorm * weights[0] + weights[4];
+      weights += 1;
+      channels -= sizeof(float);
+    } while (channels != 0);
+  }
+}
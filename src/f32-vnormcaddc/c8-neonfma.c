@@ -0,0 +1,77 @@
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <arm_neon.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/vnormcaddc.h>
+
+
+void xnn_f32_vnormcaddc_ukernel_c8__neonfma(
+    size_t channels,
+    const float* input,
+    const float* mean,
+    const float* inv_stddev,
+    const float* weights,
+    float* output,
+    const union xnn_f32_default_params params[restrict XNN_MIN_ELEMENTS(1)]) XNN_OOB_READS
+{
+  assert(channels != 0);
+  assert(channels % sizeof(float) == 0);
+
+  const float32x4_t vmean = vld1q_dup_f32(mean);
+  const float32x4_t vinv_stddev = vld1q_dup_f32(inv_stddev);
+  for (; channels >= 8 * sizeof(float); channels -= 8 * sizeof(float)) {
+    const float32x4_t vx0123 = vld1q_f32(input); input += 4;
+    const float32x4_t vx4567 = vld1q_f32(input); input += 4;
+
+    const float32x4_t vscale0123 = vld1q_f32(weights); weights += 4;
+    const float32x4_t vscale4567 = vld1q_f32(weights); weights += 4;
+    const float32x4_t vbias0123 = vld1q_f32(weights); weights += 4;
+    const float32x4_t vbias4567 = vld1q_f32(weights); weights += 4;
+
+    const float32x4_t vnorm0123 = vmulq_f32(vsubq_f32(vx0123, vmean), vinv_stddev);
+    const float32x4_t vnorm4567 = vmulq_f32(vsubq_f32(vx4567, vmean), vinv_stddev);
+
+    const float32x4_t vy0123 = vfmaq_f32(vbias0123, vnorm0123, vscale0123);
+    const float32x4_t vy4567 = vfmaq_f32(vbias4567, vnorm4567, vscale4567);
+
+    vst1q_f32(output, vy0123); output += 4;
+    vst1q_f32(output, vy4567); output += 4;
+  }
+  if (channels >= 4 * sizeof(float)) {
+    const float32x4_t vx0123 = vld1q_f32(input); input += 4;
+
+    const float32x4_t vscale0123 = vld1q_f32(weights);
+    const float32x4_t vbias0123 = vld1q_f32(weights + 8);
+    weights += 4;
+
+    const float32x4_t vnorm0123 = vmulq_f32(vsubq_f32(vx0123, vmean), vinv_stddev);
+    const float32x4_t vy0123 = vfmaq_f32(vbias0123, vnorm0123, vscale0123);
+
+    vst1q_f32(output, vy0123); output += 4;
+    channels -= 4 * sizeof(float);
+  }
+  if XNN_UNLIKELY(channels != 0) {
+    const float32x4_t vx0123 = vld1q_f32(input);
+
+    const float32x4_t vscale0123 = vld1q_f32(weights);
+    const float32x4_t vbias0123 = vld1q_f32(weights + 8);
+
+    const float32x4_t vnorm0123 = vmulq_f32(vsubq_f32(vx0123, vmean), vinv_stddev);
+    const float32x4_t vy0123 = vfmaq_f32(vbias0123, vnorm0123, vscale0123);
+
+    float32x2_t vy01 = vget_low_f32(vy0123);
+    if (channels & (2 * sizeof(float))) {
+      vst1_f32(output, vy01); output += 2;
+      vy01 = vget_high_f32(vy0123);
+    }
+    if (channels & (1 * sizeof(float))) {
+      vst1_lane_f32(output, vy01, 0);
+    }
+  }
+}
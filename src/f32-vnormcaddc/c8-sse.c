@@ -0,0 +1,82 @@
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <xmmintrin.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/vnormcaddc.h>
+
+
+void xnn_f32_vnormcaddc_ukernel_c8__sse(
+    size_t channels,
+    const float* input,
+    const float* mean,
+    const float* inv_stddev,
+    const float* weights,
+    float* output,
+    const union xnn_f32_default_params params[restrict XNN_MIN_ELEMENTS(1)]) XNN_OOB_READS
+{
+  assert(channels != 0);
+  assert(channels % sizeof(float) == 0);
+
+  const __m128 vmean = _mm_load1_ps(mean);
+  const __m128 vinv_stddev = _mm_load1_ps(inv_stddev);
+  for (; channels >= 8 * sizeof(float); channels -= 8 * sizeof(float)) {
+    const __m128 vx0123 = _mm_loadu_ps(input);
+    const __m128 vx4567 = _mm_loadu_ps(input + 4);
+    input += 8;
+
+    const __m128 vscale0123 = _mm_load_ps(weights);
+    const __m128 vscale4567 = _mm_load_ps(weights + 4);
+    const __m128 vbias0123 = _mm_load_ps(weights + 8);
+    const __m128 vbias4567 = _mm_load_ps(weights + 12);
+    weights += 16;
+
+    const __m128 vnorm0123 = _mm_mul_ps(_mm_sub_ps(vx0123, vmean), vinv_stddev);
+    const __m128 vnorm4567 = _mm_mul_ps(_mm_sub_ps(vx4567, vmean), vinv_stddev);
+
+    const __m128 vy0123 = _mm_add_ps(_mm_mul_ps(vnorm0123, vscale0123), vbias0123);
+    const __m128 vy4567 = _mm_add_ps(_mm_mul_ps(vnorm4567, vscale4567), vbias4567);
+
+    _mm_storeu_ps(output, vy0123);
+    _mm_storeu_ps(output + 4, vy4567);
+    output += 8;
+  }
+  if (channels >= 4 * sizeof(float)) {
+    const __m128 vx0123 = _mm_loadu_ps(input);
+    input += 4;
+
+    const __m128 vscale0123 = _mm_load_ps(weights);
+    const __m128 vbias0123 = _mm_load_ps(weights + 8);
+    weights += 4;
+
+    const __m128 vnorm0123 = _mm_mul_ps(_mm_sub_ps(vx0123, vmean), vinv_stddev);
+    const __m128 vy0123 = _mm_add_ps(_mm_mul_ps(vnorm0123, vscale0123), vbias0123);
+
+    _mm_storeu_ps(output, vy0123);
+    output += 4;
+    channels -= 4 * sizeof(float);
+  }
+  if XNN_UNLIKELY(channels != 0) {
+    const __m128 vx0123 = _mm_loadu_ps(input);
+
+    const __m128 vscale0123 = _mm_load_ps(weights);
+    const __m128 vbias0123 = _mm_load_ps(weights + 8);
+
+    const __m128 vnorm0123 = _mm_mul_ps(_mm_sub_ps(vx0123, vmean), vinv_stddev);
+    __m128 vy0123 = _mm_add_ps(_mm_mul_ps(vnorm0123, vscale0123), vbias0123);
+
+    if (channels & (2 * sizeof(float))) {
+      _mm_storel_pi((__m64*) output, vy0123);
+      vy0123 = _mm_movehl_ps(vy0123, vy0123);
+      output += 2;
+    }
+    if (channels & (1 * sizeof(float))) {
+      _mm_store_ss(output, vy0123);
+    }
+  }
+}
@@ -0,0 +1,217 @@
+// Auto-generated file. Do not edit!
+//   Template: src/f32-vtanh/avx-expm1minus-rr2-p6-div.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <immintrin.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/vunary.h>
+
+
+void xnn_f32_vtanh_ukernel__avx_expm1minus_rr2_p6_div_x24(
+    size_t n,
+    const float* x,
+    float* y,
+    const union xnn_f32_tanh_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(n != 0);
+  assert(n % sizeof(float) == 0);
+  assert(x != NULL);
+  assert(y != NULL);
+
+  const __m256 vsign_mask = _mm256_load_ps(params->avx_expm1minus_rr2_p6.sign_mask);
+  const __m256 vsat_cutoff = _mm256_load_ps(params->avx_expm1minus_rr2_p6.sat_cutoff);
+  const __m256 vlog2e = _mm256_load_ps(params->avx_expm1minus_rr2_p6.log2e);
+  const __m256 vmagic_bias = _mm256_load_ps(params->avx_expm1minus_rr2_p6.magic_bias);
+  const __m256 vminus_ln2_hi = _mm256_load_ps(params->avx_expm1minus_rr2_p6.minus_ln2_hi);
+  const __m256 vminus_ln2_lo = _mm256_load_ps(params->avx_expm1minus_rr2_p6.minus_ln2_lo);
+  const __m256 vc6 = _mm256_load_ps(params->avx_expm1minus_rr2_p6.c6);
+  const __m256 vc5 = _mm256_load_ps(params->avx_expm1minus_rr2_p6.c5);
+  const __m256 vc4 = _mm256_load_ps(params->avx_expm1minus_rr2_p6.c4);
+  const __m256 vc3 = _mm256_load_ps(params->avx_expm1minus_rr2_p6.c3);
+  const __m256 vc2 = _mm256_load_ps(params->avx_expm1minus_rr2_p6.c2);
+  const __m256 vone = _mm256_load_ps(params->avx_expm1minus_rr2_p6.one);
+  const __m256 vminus_two = _mm256_load_ps(params->avx_expm1minus_rr2_p6.minus_two);
+
+  for (; n >= 24 * sizeof(float); n -= 24 * sizeof(float)) {
+    const __m256 vx0 = _mm256_loadu_ps(x);
+    const __m256 vx1 = _mm256_loadu_ps(x + 8);
+    const __m256 vx2 = _mm256_loadu_ps(x + 16);
+    x += 24;
+
+    __m256 vz0 = _mm256_or_ps(vx0, vsign_mask);
+    __m256 vz1 = _mm256_or_ps(vx1, vsign_mask);
+    __m256 vz2 = _mm256_or_ps(vx2, vsign_mask);
+
+    vz0 = _mm256_max_ps(vsat_cutoff, _mm256_add_ps(vz0, vz0));
+    vz1 = _mm256_max_ps(vsat_cutoff, _mm256_add_ps(vz1, vz1));
+    vz2 = _mm256_max_ps(vsat_cutoff, _mm256_add_ps(vz2, vz2));
+
+    __m256 vn0 = _mm256_add_ps(_mm256_mul_ps(vz0, vlog2e), vmagic_bias);
+    __m256 vn1 = _mm256_add_ps(_mm256_mul_ps(vz1, vlog2e), vmagic_bias);
+    __m256 vn2 = _mm256_add_ps(_mm256_mul_ps(vz2, vlog2e), vmagic_bias);
+
+    const __m128 vs0_lo = _mm_castsi128_ps(_mm_slli_epi32(_mm_castps_si128(_mm256_castps256_ps128(vn0)), 23));
+    const __m128 vs0_hi = _mm_castsi128_ps(_mm_slli_epi32(_mm_castps_si128(_mm256_extractf128_ps(vn0, 1)), 23));
+    vn0 = _mm256_sub_ps(vn0, vmagic_bias);
+    const __m128 vs1_lo = _mm_castsi128_ps(_mm_slli_epi32(_mm_castps_si128(_mm256_castps256_ps128(vn1)), 23));
+    const __m128 vs1_hi = _mm_castsi128_ps(_mm_slli_epi32(_mm_castps_si128(_mm256_extractf128_ps(vn1, 1)), 23));
+    vn1 = _mm256_sub_ps(vn1, vmagic_bias);
+    const __m128 vs2_lo = _mm_castsi128_ps(_mm_slli_epi32(_mm_castps_si128(_mm256_castps256_ps128(vn2)), 23));
+    const __m128 vs2_hi = _mm_castsi128_ps(_mm_slli_epi32(_mm_castps_si128(_mm256_extractf128_ps(vn2, 1)), 23));
+    vn2 = _mm256_sub_ps(vn2, vmagic_bias);
+
+    __m256 vt0 = _mm256_add_ps(_mm256_mul_ps(vn0, vminus_ln2_hi), vz0);
+    const __m256 vs0 = _mm256_insertf128_ps(_mm256_castps128_ps256(vs0_lo), vs0_hi, 1);
+    __m256 vt1 = _mm256_add_ps(_mm256_mul_ps(vn1, vminus_ln2_hi), vz1);
+    const __m256 vs1 = _mm256_insertf128_ps(_mm256_castps128_ps256(vs1_lo), vs1_hi, 1);
+    __m256 vt2 = _mm256_add_ps(_mm256_mul_ps(vn2, vminus_ln2_hi), vz2);
+    const __m256 vs2 = _mm256_insertf128_ps(_mm256_castps128_ps256(vs2_lo), vs2_hi, 1);
+
+    vt0 = _mm256_add_ps(_mm256_mul_ps(vn0, vminus_ln2_lo), vt0);
+    vt1 = _mm256_add_ps(_mm256_mul_ps(vn1, vminus_ln2_lo), vt1);
+    vt2 = _mm256_add_ps(_mm256_mul_ps(vn2, vminus_ln2_lo), vt2);
+
+    __m256 vp0 = _mm256_add_ps(_mm256_mul_ps(vc6, vt0), vc5);
+    __m256 vp1 = _mm256_add_ps(_mm256_mul_ps(vc6, vt1), vc5);
+    __m256 vp2 = _mm256_add_ps(_mm256_mul_ps(vc6, vt2), vc5);
+
+    vp0 = _mm256_add_ps(_mm256_mul_ps(vp0, vt0), vc4);
+    vp1 = _mm256_add_ps(_mm256_mul_ps(vp1, vt1), vc4);
+    vp2 = _mm256_add_ps(_mm256_mul_ps(vp2, vt2), vc4);
+
+    vp0 = _mm256_add_ps(_mm256_mul_ps(vp0, vt0), vc3);
+    vp1 = _mm256_add_ps(_mm256_mul_ps(vp1, vt1), vc3);
+    vp2 = _mm256_add_ps(_mm256_mul_ps(vp2, vt2), vc3);
+
+    vp0 = _mm256_add_ps(_mm256_mul_ps(vp0, vt0), vc2);
+    vp1 = _mm256_add_ps(_mm256_mul_ps(vp1, vt1), vc2);
+    vp2 = _mm256_add_ps(_mm256_mul_ps(vp2, vt2), vc2);
+
+    vp0 = _mm256_mul_ps(vp0, vt0);
+    vp1 = _mm256_mul_ps(vp1, vt1);
+    vp2 = _mm256_mul_ps(vp2, vt2);
+
+    vt0 = _mm256_mul_ps(vt0, vs0);
+    const __m256 vsm10 = _mm256_sub_ps(vs0, vone);
+    vt1 = _mm256_mul_ps(vt1, vs1);
+    const __m256 vsm11 = _mm256_sub_ps(vs1, vone);
+    vt2 = _mm256_mul_ps(vt2, vs2);
+    const __m256 vsm12 = _mm256_sub_ps(vs2, vone);
+
+    vp0 = _mm256_add_ps(_mm256_mul_ps(vp0, vt0), vt0);
+    vp1 = _mm256_add_ps(_mm256_mul_ps(vp1, vt1), vt1);
+    vp2 = _mm256_add_ps(_mm256_mul_ps(vp2, vt2), vt2);
+
+    const __m256 vemo0 = _mm256_add_ps(vp0, vsm10);
+    const __m256 vemo1 = _mm256_add_ps(vp1, vsm11);
+    const __m256 vemo2 = _mm256_add_ps(vp2, vsm12);
+
+    const __m256 vepo0 = _mm256_sub_ps(vemo0, vminus_two);
+    const __m256 vepo1 = _mm256_sub_ps(vemo1, vminus_two);
+    const __m256 vepo2 = _mm256_sub_ps(vemo2, vminus_two);
+
+    __m256 vy0 = _mm256_div_ps(vemo0, vepo0);
+    __m256 vy1 = _mm256_div_ps(vemo1, vepo1);
+    __m256 vy2 = _mm256_div_ps(vemo2, vepo2);
+
+    vy0 = _mm256_or_ps(_mm256_andnot_ps(vsign_mask, vy0), _mm256_and_ps(vsign_mask, vx0));
+    vy1 = _mm256_or_ps(_mm256_andnot_ps(vsign_mask, vy1), _mm256_and_ps(vsign_mask, vx1));
+    vy2 = _mm256_or_ps(_mm256_andnot_ps(vsign_mask, vy2), _mm256_and_ps(vsign_mask, vx2));
+
+    _mm256_storeu_ps(y, vy0);
+    _mm256_storeu_ps(y + 8, vy1);
+    _mm256_storeu_ps(y + 16, vy2);
+    y += 24;
+  }
+  for (; n >= 8 * sizeof(float); n -= 8 * sizeof(float)) {
+    const __m256 vx = _mm256_loadu_ps(x);
+    x += 8;
+
+    __m256 vz = _mm256_or_ps(vx, vsign_mask);
+    vz = _mm256_max_ps(vsat_cutoff, _mm256_add_ps(vz, vz));
+
+    __m256 vn = _mm256_add_ps(_mm256_mul_ps(vz, vlog2e), vmagic_bias);
+    const __m128 vs_lo = _mm_castsi128_ps(_mm_slli_epi32(_mm_castps_si128(_mm256_castps256_ps128(vn)), 23));
+    const __m128 vs_hi = _mm_castsi128_ps(_mm_slli_epi32(_mm_castps_si128(_mm256_extractf128_ps(vn, 1)), 23));
+    vn = _mm256_sub_ps(vn, vmagic_bias);
+
+    __m256 vt = _mm256_add_ps(_mm256_mul_ps(vn, vminus_ln2_hi), vz);
+    const __m256 vs = _mm256_insertf128_ps(_mm256_castps128_ps256(vs_lo), vs_hi, 1);
+    vt = _mm256_add_ps(_mm256_mul_ps(vn, vminus_ln2_lo), vt);
+
+    __m256 vp = _mm256_add_ps(_mm256_mul_ps(vc6, vt), vc5);
+    vp = _mm256_add_ps(_mm256_mul_ps(vp, vt), vc4);
+    vp = _mm256_add_ps(_mm256_mul_ps(vp, vt), vc3);
+    vp = _mm256_add_ps(_mm256_mul_ps(vp, vt), vc2);
+    vp = _mm256_mul_ps(vp, vt);
+
+    vt = _mm256_mul_ps(vt, vs);
+    const __m256 vsm1 = _mm256_sub_ps(vs, vone);
+    vp = _mm256_add_ps(_mm256_mul_ps(vp, vt), vt);
+    const __m256 vemo = _mm256_add_ps(vp, vsm1);
+    const __m256 vepo = _mm256_sub_ps(vemo, vminus_two);
+
+    __m256 vy = _mm256_div_ps(vemo, vepo);
+    vy = _mm256_or_ps(_mm256_andnot_ps(vsign_mask, vy), _mm256_and_ps(vsign_mask, vx));
+
+    _mm256_storeu_ps(y, vy);
+    y += 8;
+  }
+  if XNN_UNLIKELY(n != 0) {
+    assert(n >= 1 * sizeof(float));
+    assert(n <= 7 * sizeof(float));
+    const __m256i vmask = _mm256_loadu_si256((const __m256i*) ((uintptr_t) &params->avx_expm1minus_rr2_p6.mask_table[7] - n));
+
+    const __m256 vx = _mm256_maskload_ps(x, vmask);
+
+    __m256 vz = _mm256_or_ps(vx, vsign_mask);
+    vz = _mm256_max_ps(vsat_cutoff, _mm256_add_ps(vz, vz));
+
+    __m256 vn = _mm256_add_ps(_mm256_mul_ps(vz, vlog2e), vmagic_bias);
+    const __m128 vs_lo = _mm_castsi128_ps(_mm_slli_epi32(_mm_castps_si128(_mm256_castps256_ps128(vn)), 23));
+    const __m128 vs_hi = _mm_castsi128_ps(_mm_slli_epi32(_mm_castps_si128(_mm256_extractf128_ps(vn, 1)), 23));
+    vn = _mm256_sub_ps(vn, vmagic_bias);
+
+    __m256 vt = _mm256_add_ps(_mm256_mul_ps(vn, vminus_ln2_hi), vz);
+    const __m256 vs = _mm256_insertf128_ps(_mm256_castps128_ps256(vs_lo), vs_hi, 1);
+    vt = _mm256_add_ps(_mm256_mul_ps(vn, vminus_ln2_lo), vt);
+
+    __m256 vp = _mm256_add_ps(_mm256_mul_ps(vc6, vt), vc5);
+    vp = _mm256_add_ps(_mm256_mul_ps(vp, vt), vc4);
+    vp = _mm256_add_ps(_mm256_mul_ps(vp, vt), vc3);
+    vp = _mm256_add_ps(_mm256_mul_ps(vp, vt), vc2);
+    vp = _mm256_mul_ps(vp, vt);
+
+    vt = _mm256_mul_ps(vt, vs);
+    const __m256 vsm1 = _mm256_sub_ps(vs, vone);
+    vp = _mm256_add_ps(_mm256_mul_ps(vp, vt), vt);
+    const __m256 vemo = _mm256_add_ps(vp, vsm1);
+    const __m256 vepo = _mm256_sub_ps(vemo, vminus_two);
+
+    __m256 vy = _mm256_div_ps(vemo, vepo);
+    vy = _mm256_or_ps(_mm256_andnot_ps(vsign_mask, vy), _mm256_and_ps(vsign_mask, vx));
+
+    __m128 vy_lo = _mm256_castps256_ps128(vy);
+    if (n & (4 * sizeof(float))) {
+      _mm_storeu_ps(y, vy_lo);
+      vy_lo = _mm256_extractf128_ps(vy, 1);
+      y += 4;
+    }
+    if (n & (2 * sizeof(float))) {
+      _mm_storel_pi((__m64*) y, vy_lo);
+      vy_lo = _mm_movehl_ps(vy_lo, vy_lo);
+      y += 2;
+    }
+    if (n & (1 * sizeof(float))) {
+      _mm_store_ss(y, vy_lo);
+    }
+  }
+}
@@ -0,0 +1,209 @@
+// Auto-generated file. Do not edit!
+//   Template: src/f32-vtanh/avx512f-expm1minus-rr1-p6-div.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <immintrin.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/intrinsics-polyfill.h>
+#include <xnnpack/vunary.h>
+
+
+void xnn_f32_vtanh_ukernel__avx512f_expm1minus_rr1_p6_div_x64(
+    size_t n,
+    const float* x,
+    float* y,
+    const union xnn_f32_tanh_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(n != 0);
+  assert(n % sizeof(float) == 0);
+  assert(x != NULL);
+  assert(y != NULL);
+
+  const __m512i vsign_mask = _mm512_set1_epi32((int) params->avx512_expm1minus_rr1_p6.sign_mask);
+  const __m512 vsat_cutoff = _mm512_set1_ps(params->avx512_expm1minus_rr1_p6.sat_cutoff);
+  const __m512 vlog2e = _mm512_set1_ps(params->avx512_expm1minus_rr1_p6.log2e);
+  const __m512 vmagic_bias = _mm512_set1_ps(params->avx512_expm1minus_rr1_p6.magic_bias);
+  const __m512 vminus_ln2 = _mm512_set1_ps(params->avx512_expm1minus_rr1_p6.minus_ln2);
+  const __m512 vc6 = _mm512_set1_ps(params->avx512_expm1minus_rr1_p6.c6);
+  const __m512 vc5 = _mm512_set1_ps(params->avx512_expm1minus_rr1_p6.c5);
+  const __m512 vc4 = _mm512_set1_ps(params->avx512_expm1minus_rr1_p6.c4);
+  const __m512 vc3 = _mm512_set1_ps(params->avx512_expm1minus_rr1_p6.c3);
+  const __m512 vc2 = _mm512_set1_ps(params->avx512_expm1minus_rr1_p6.c2);
+  const __m512 vone = _mm512_set1_ps(params->avx512_expm1minus_rr1_p6.one);
+  const __m512 vminus_two = _mm512_set1_ps(params->avx512_expm1minus_rr1_p6.minus_two);
+
+  for (; n >= 64 * sizeof(float); n -= 64 * sizeof(float)) {
+    const __m512 vx0 = _mm512_loadu_ps(x);
+    const __m512 vx1 = _mm512_loadu_ps(x + 16);
+    const __m512 vx2 = _mm512_loadu_ps(x + 32);
+    const __m512 vx3 = _mm512_loadu_ps(x + 48);
+    x += 64;
+
+    __m512 vz0 = _mm512_castsi512_ps(_mm512_or_epi32(_mm512_castps_si512(vx0), vsign_mask));
+    __m512 vz1 = _mm512_castsi512_ps(_mm512_or_epi32(_mm512_castps_si512(vx1), vsign_mask));
+    __m512 vz2 = _mm512_castsi512_ps(_mm512_or_epi32(_mm512_castps_si512(vx2), vsign_mask));
+    __m512 vz3 = _mm512_castsi512_ps(_mm512_or_epi32(_mm512_castps_si512(vx3), vsign_mask));
+
+    vz0 = _mm512_max_ps(vsat_cutoff, _mm512_add_ps(vz0, vz0));
+    vz1 = _mm512_max_ps(vsat_cutoff, _mm512_add_ps(vz1, vz1));
+    vz2 = _mm512_max_ps(vsat_cutoff, _mm512_add_ps(vz2, vz2));
+    vz3 = _mm512_max_ps(vsat_cutoff, _mm512_add_ps(vz3, vz3));
+
+    __m512 vn0 = _mm512_fmadd_ps(vz0, vlog2e, vmagic_bias);
+    __m512 vn1 = _mm512_fmadd_ps(vz1, vlog2e, vmagic_bias);
+    __m512 vn2 = _mm512_fmadd_ps(vz2, vlog2e, vmagic_bias);
+    __m512 vn3 = _mm512_fmadd_ps(vz3, vlog2e, vmagic_bias);
+
+    const __m512 vs0 = _mm512_castsi512_ps(_mm512_slli_epi32(_mm512_castps_si512(vn0), 23));
+    vn0 = _mm512_sub_ps(vn0, vmagic_bias);
+    const __m512 vs1 = _mm512_castsi512_ps(_mm512_slli_epi32(_mm512_castps_si512(vn1), 23));
+    vn1 = _mm512_sub_ps(vn1, vmagic_bias);
+    const __m512 vs2 = _mm512_castsi512_ps(_mm512_slli_epi32(_mm512_castps_si512(vn2), 23));
+    vn2 = _mm512_sub_ps(vn2, vmagic_bias);
+    const __m512 vs3 = _mm512_castsi512_ps(_mm512_slli_epi32(_mm512_castps_si512(vn3), 23));
+    vn3 = _mm512_sub_ps(vn3, vmagic_bias);
+
+    __m512 vt0 = _mm512_fmadd_ps(vn0, vminus_ln2, vz0);
+    __m512 vt1 = _mm512_fmadd_ps(vn1, vminus_ln2, vz1);
+    __m512 vt2 = _mm512_fmadd_ps(vn2, vminus_ln2, vz2);
+    __m512 vt3 = _mm512_fmadd_ps(vn3, vminus_ln2, vz3);
+
+    __m512 vp0 = _mm512_fmadd_ps(vc6, vt0, vc5);
+    __m512 vp1 = _mm512_fmadd_ps(vc6, vt1, vc5);
+    __m512 vp2 = _mm512_fmadd_ps(vc6, vt2, vc5);
+    __m512 vp3 = _mm512_fmadd_ps(vc6, vt3, vc5);
+
+    vp0 = _mm512_fmadd_ps(vp0, vt0, vc4);
+    vp1 = _mm512_fmadd_ps(vp1, vt1, vc4);
+    vp2 = _mm512_fmadd_ps(vp2, vt2, vc4);
+    vp3 = _mm512_fmadd_ps(vp3, vt3, vc4);
+
+    vp0 = _mm512_fmadd_ps(vp0, vt0, vc3);
+    vp1 = _mm512_fmadd_ps(vp1, vt1, vc3);
+    vp2 = _mm512_fmadd_ps(vp2, vt2, vc3);
+    vp3 = _mm512_fmadd_ps(vp3, vt3, vc3);
+
+    vp0 = _mm512_fmadd_ps(vp0, vt0, vc2);
+    vp1 = _mm512_fmadd_ps(vp1, vt1, vc2);
+    vp2 = _mm512_fmadd_ps(vp2, vt2, vc2);
+    vp3 = _mm512_fmadd_ps(vp3, vt3, vc2);
+
+    vp0 = _mm512_mul_ps(vp0, vt0);
+    vt0 = _mm512_mul_ps(vt0, vs0);
+    vp1 = _mm512_mul_ps(vp1, vt1);
+    vt1 = _mm512_mul_ps(vt1, vs1);
+    vp2 = _mm512_mul_ps(vp2, vt2);
+    vt2 = _mm512_mul_ps(vt2, vs2);
+    vp3 = _mm512_mul_ps(vp3, vt3);
+    vt3 = _mm512_mul_ps(vt3, vs3);
+
+    const __m512 vsm10 = _mm512_sub_ps(vs0, vone);
+    vp0 = _mm512_fmadd_ps(vp0, vt0, vt0);
+    const __m512 vsm11 = _mm512_sub_ps(vs1, vone);
+    vp1 = _mm512_fmadd_ps(vp1, vt1, vt1);
+    const __m512 vsm12 = _mm512_sub_ps(vs2, vone);
+    vp2 = _mm512_fmadd_ps(vp2, vt2, vt2);
+    const __m512 vsm13 = _mm512_sub_ps(vs3, vone);
+    vp3 = _mm512_fmadd_ps(vp3, vt3, vt3);
+
+    const __m512 vemo0 = _mm512_add_ps(vp0, vsm10);
+    const __m512 vemo1 = _mm512_add_ps(vp1, vsm11);
+    const __m512 vemo2 = _mm512_add_ps(vp2, vsm12);
+    const __m512 vemo3 = _mm512_add_ps(vp3, vsm13);
+
+    const __m512 vepo0 = _mm512_sub_ps(vemo0, vminus_two);
+    const __m512 vepo1 = _mm512_sub_ps(vemo1, vminus_two);
+    const __m512 vepo2 = _mm512_sub_ps(vemo2, vminus_two);
+    const __m512 vepo3 = _mm512_sub_ps(vemo3, vminus_two);
+
+    __m512 vy0 = _mm512_div_ps(vemo0, vepo0);
+    __m512 vy1 = _mm512_div_ps(vemo1, vepo1);
+    __m512 vy2 = _mm512_div_ps(vemo2, vepo2);
+    __m512 vy3 = _mm512_div_ps(vemo3, vepo3);
+
+    vy0 = _mm512_castsi512_ps(_mm512_ternarylogic_epi32(vsign_mask, _mm512_castps_si512(vy0), _mm512_castps_si512(vx0), 0xAC));
+    vy1 = _mm512_castsi512_ps(_mm512_ternarylogic_epi32(vsign_mask, _mm512_castps_si512(vy1), _mm512_castps_si512(vx1), 0xAC));
+    vy2 = _mm512_castsi512_ps(_mm512_ternarylogic_epi32(vsign_mask, _mm512_castps_si512(vy2), _mm512_castps_si512(vx2), 0xAC));
+    vy3 = _mm512_castsi512_ps(_mm512_ternarylogic_epi32(vsign_mask, _mm512_castps_si512(vy3), _mm512_castps_si512(vx3), 0xAC));
+
+    _mm512_storeu_ps(y, vy0);
+    _mm512_storeu_ps(y + 16, vy1);
+    _mm512_storeu_ps(y + 32, vy2);
+    _mm512_storeu_ps(y + 48, vy3);
+    y += 64;
+  }
+  for (; n >= 16 * sizeof(float); n -= 16 * sizeof(float)) {
+    const __m512 vx = _mm512_loadu_ps(x);
+    x += 16;
+
+    __m512 vz = _mm512_castsi512_ps(_mm512_or_epi32(_mm512_castps_si512(vx), vsign_mask));
+    vz = _mm512_max_ps(vsat_cutoff, _mm512_add_ps(vz, vz));
+
+    __m512 vn = _mm512_fmadd_ps(vz, vlog2e, vmagic_bias);
+    const __m512 vs = _mm512_castsi512_ps(_mm512_slli_epi32(_mm512_castps_si512(vn), 23));
+    vn = _mm512_sub_ps(vn, vmagic_bias);
+
+    __m512 vt = _mm512_fmadd_ps(vn, vminus_ln2, vz);
+
+    __m512 vp = _mm512_fmadd_ps(vc6, vt, vc5);
+    vp = _mm512_fmadd_ps(vp, vt, vc4);
+    vp = _mm512_fmadd_ps(vp, vt, vc3);
+    vp = _mm512_fmadd_ps(vp, vt, vc2);
+    vp = _mm512_mul_ps(vp, vt);
+
+    vt = _mm512_mul_ps(vt, vs);
+    const __m512 vsm1 = _mm512_sub_ps(vs, vone);
+    vp = _mm512_fmadd_ps(vp, vt, vt);
+    const __m512 vemo = _mm512_add_ps(vp, vsm1);
+    const __m512 vepo = _mm512_sub_ps(vemo, vminus_two);
+
+    __m512 vy = _mm512_div_ps(vemo, vepo);
+    vy = _mm512_castsi512_ps(_mm512_ternarylogic_epi32(vsign_mask, _mm512_castps_si512(vy), _mm512_castps_si512(vx), 0xAC));
+
+    _mm512_storeu_ps(y, vy);
+    y += 16;
+  }
+  if XNN_UNLIKELY(n != 0) {
+    assert(n >= 1 * sizeof(float));
+    assert(n <= 15 * sizeof(float));
+    // Prepare mask for valid 32-bit elements (depends on n).
+    n >>= 2 /* log2(sizeof(float)) */;
+    const __mmask16 vmask = _cvtu32_mask16((uint16_t) ((uint32_t) (UINT32_C(1) << n) - UINT32_C(1)));
+
+    const __m512 vx = _mm512_maskz_loadu_ps(vmask, x);
+
+    __m512 vz = _mm512_castsi512_ps(_mm512_or_epi32(_mm512_castps_si512(vx), vsign_mask));
+    vz = _mm512_max_ps(vsat_cutoff, _mm512_add_ps(vz, vz));
+
+    __m512 vn = _mm512_fmadd_ps(vz, vlog2e, vmagic_bias);
+    const __m512 vs = _mm512_castsi512_ps(_mm512_slli_epi32(_mm512_castps_si512(vn), 23));
+    vn = _mm512_sub_ps(vn, vmagic_bias);
+
+    __m512 vt = _mm512_fmadd_ps(vn, vminus_ln2, vz);
+
+    __m512 vp = _mm512_fmadd_ps(vc6, vt, vc5);
+    vp = _mm512_fmadd_ps(vp, vt, vc4);
+    vp = _mm512_fmadd_ps(vp, vt, vc3);
+    vp = _mm512_fmadd_ps(vp, vt, vc2);
+    vp = _mm512_mul_ps(vp, vt);
+
+    vt = _mm512_mul_ps(vt, vs);
+    const __m512 vsm1 = _mm512_sub_ps(vs, vone);
+    vp = _mm512_fmadd_ps(vp, vt, vt);
+    const __m512 vemo = _mm512_add_ps(vp, vsm1);
+    const __m512 vepo = _mm512_sub_ps(vemo, vminus_two);
+
+    __m512 vy = _mm512_div_ps(vemo, vepo);
+    vy = _mm512_castsi512_ps(_mm512_ternarylogic_epi32(vsign_mask, _mm512_castps_si512(vy), _mm512_castps_si512(vx), 0xAC));
+
+    _mm512_mask_storeu_ps(y, vmask, vy);
+  }
+}
@@ -0,0 +1,206 @@
+// Auto-generated file. Do not edit!
+//   Template: src/f32-vtanh/neon-expm1minus-p6.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <arm_neon.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/vunary.h>
+
+
+void xnn_f32_vtanh_ukernel__neon_expm1minus_rr2_p6_nr2recps_x12(
+    size_t n,
+    const float* x,
+    float* y,
+    const union xnn_f32_tanh_params params[restrict XNN_MIN_ELEMENTS(1)]) XNN_OOB_READS
+{
+  assert(n != 0);
+  assert(n % sizeof(float) == 0);
+  assert(x != NULL);
+  assert(y != NULL);
+
+  const float32x4_t vsat_cutoff = vld1q_dup_f32(&params->neon_expm1minus_rr2_p6.sat_cutoff);
+  const float32x4_t vlog2e = vld1q_dup_f32(&params->neon_expm1minus_rr2_p6.log2e);
+  const float32x4_t vmagic_bias = vld1q_dup_f32(&params->neon_expm1minus_rr2_p6.magic_bias);
+  const float32x4_t vminus_ln2_hi = vld1q_dup_f32(&params->neon_expm1minus_rr2_p6.minus_ln2_hi);
+  const float32x4_t vminus_ln2_lo = vld1q_dup_f32(&params->neon_expm1minus_rr2_p6.minus_ln2_lo);
+  const float32x4_t vc6 = vld1q_dup_f32(&params->neon_expm1minus_rr2_p6.c6);
+  const float32x4_t vc5 = vld1q_dup_f32(&params->neon_expm1minus_rr2_p6.c5);
+  const float32x4_t vc4 = vld1q_dup_f32(&params->neon_expm1minus_rr2_p6.c4);
+  const float32x4_t vc3 = vld1q_dup_f32(&params->neon_expm1minus_rr2_p6.c3);
+  const float32x4_t vc2 = vld1q_dup_f32(&params->neon_expm1minus_rr2_p6.c2);
+  const float32x4_t vminus_two = vld1q_dup_f32(&params->neon_expm1minus_rr2_p6.minus_two);
+  const float32x4_t vone = vmovq_n_f32(1.0f);
+  const uint32x4_t vsign_mask = vmovq_n_u32(UINT32_C(0x80000000));
+
+  for (; n >= 12 * sizeof(float); n -= 12 * sizeof(float)) {
+    const float32x4_t vx0123 = vld1q_f32(x); x += 4;
+    const float32x4_t vx4567 = vld1q_f32(x); x += 4;
+    const float32x4_t vx89AB = vld1q_f32(x); x += 4;
+
+    const float32x4_t vz0123 = vmaxq_f32(vsat_cutoff, vmulq_f32(vabsq_f32(vx0123), vminus_two));
+    const float32x4_t vz4567 = vmaxq_f32(vsat_cutoff, vmulq_f32(vabsq_f32(vx4567), vminus_two));
+    const float32x4_t vz89AB = vmaxq_f32(vsat_cutoff, vmulq_f32(vabsq_f32(vx89AB), vminus_two));
+
+    float32x4_t vn0123 = vmlaq_f32(vmagic_bias, vz0123, vlog2e);
+    float32x4_t vn4567 = vmlaq_f32(vmagic_bias, vz4567, vlog2e);
+    float32x4_t vn89AB = vmlaq_f32(vmagic_bias, vz89AB, vlog2e);
+
+    const float32x4_t vs0123 = vreinterpretq_f32_s32(vshlq_n_s32(vreinterpretq_s32_f32(vn0123), 23));
+    const float32x4_t vs4567 = vreinterpretq_f32_s32(vshlq_n_s32(vreinterpretq_s32_f32(vn4567), 23));
+    const float32x4_t vs89AB = vreinterpretq_f32_s32(vshlq_n_s32(vreinterpretq_s32_f32(vn89AB), 23));
+
+    vn0123 = vsubq_f32(vn0123, vmagic_bias);
+    vn4567 = vsubq_f32(vn4567, vmagic_bias);
+    vn89AB = vsubq_f32(vn89AB, vmagic_bias);
+
+    float32x4_t vt0123 = vmlaq_f32(vz0123, vn0123, vminus_ln2_hi);
+    float32x4_t vt4567 = vmlaq_f32(vz4567, vn4567, vminus_ln2_hi);
+    float32x4_t vt89AB = vmlaq_f32(vz89AB, vn89AB, vminus_ln2_hi);
+
+    vt0123 = vmlaq_f32(vt0123, vn0123, vminus_ln2_lo);
+    vt4567 = vmlaq_f32(vt4567, vn4567, vminus_ln2_lo);
+    vt89AB = vmlaq_f32(vt89AB, vn89AB, vminus_ln2_lo);
+
+    float32x4_t vp0123 = vmlaq_f32(vc5, vc6, vt0123);
+    float32x4_t vp4567 = vmlaq_f32(vc5, vc6, vt4567);
+    float32x4_t vp89AB = vmlaq_f32(vc5, vc6, vt89AB);
+
+    vp0123 = vmlaq_f32(vc4, vp0123, vt0123);
+    vp4567 = vmlaq_f32(vc4, vp4567, vt4567);
+    vp89AB = vmlaq_f32(vc4, vp89AB, vt89AB);
+
+    vp0123 = vmlaq_f32(vc3, vp0123, vt0123);
+    vp4567 = vmlaq_f32(vc3, vp4567, vt4567);
+    vp89AB = vmlaq_f32(vc3, vp89AB, vt89AB);
+
+    vp0123 = vmlaq_f32(vc2, vp0123, vt0123);
+    vp4567 = vmlaq_f32(vc2, vp4567, vt4567);
+    vp89AB = vmlaq_f32(vc2, vp89AB, vt89AB);
+
+    vp0123 = vmulq_f32(vp0123, vt0123);
+    vp4567 = vmulq_f32(vp4567, vt4567);
+    vp89AB = vmulq_f32(vp89AB, vt89AB);
+
+    vt0123 = vmulq_f32(vt0123, vs0123);
+    const float32x4_t vsm10123 = vsubq_f32(vs0123, vone);
+    vt4567 = vmulq_f32(vt4567, vs4567);
+    const float32x4_t vsm14567 = vsubq_f32(vs4567, vone);
+    vt89AB = vmulq_f32(vt89AB, vs89AB);
+    const float32x4_t vsm189AB = vsubq_f32(vs89AB, vone);
+
+    vp0123 = vmlaq_f32(vt0123, vp0123, vt0123);
+    vp4567 = vmlaq_f32(vt4567, vp4567, vt4567);
+    vp89AB = vmlaq_f32(vt89AB, vp89AB, vt89AB);
+
+    const float32x4_t vemo0123 = vaddq_f32(vp0123, vsm10123);
+    const float32x4_t vemo4567 = vaddq_f32(vp4567, vsm14567);
+    const float32x4_t vemo89AB = vaddq_f32(vp89AB, vsm189AB);
+
+    const float32x4_t vepo0123 = vsubq_f32(vemo0123, vminus_two);
+    const float32x4_t vepo4567 = vsubq_f32(vemo4567, vminus_two);
+    const float32x4_t vepo89AB = vsubq_f32(vemo89AB, vminus_two);
+
+    float32x4_t vr0123 = vrecpeq_f32(vepo0123);
+    float32x4_t vr4567 = vrecpeq_f32(vepo4567);
+    float32x4_t vr89AB = vrecpeq_f32(vepo89AB);
+
+    vr0123 = vmulq_f32(vr0123, vrecpsq_f32(vr0123, vepo0123));
+    vr4567 = vmulq_f32(vr4567, vrecpsq_f32(vr4567, vepo4567));
+    vr89AB = vmulq_f32(vr89AB, vrecpsq_f32(vr89AB, vepo89AB));
+
+    vr0123 = vmulq_f32(vr0123, vrecpsq_f32(vr0123, vepo0123));
+    vr4567 = vmulq_f32(vr4567, vrecpsq_f32(vr4567, vepo4567));
+    vr89AB = vmulq_f32(vr89AB, vrecpsq_f32(vr89AB, vepo89AB));
+
+    float32x4_t vy0123 = vmulq_f32(vemo0123, vr0123);
+    float32x4_t vy4567 = vmulq_f32(vemo4567, vr4567);
+    float32x4_t vy89AB = vmulq_f32(vemo89AB, vr89AB);
+
+    vy0123 = vbslq_f32(vsign_mask, vx0123, vy0123);
+    vy4567 = vbslq_f32(vsign_mask, vx4567, vy4567);
+    vy89AB = vbslq_f32(vsign_mask, vx89AB, vy89AB);
+
+    vst1q_f32(y, vy0123); y += 4;
+    vst1q_f32(y, vy4567); y += 4;
+    vst1q_f32(y, vy89AB); y += 4;
+  }
+  for (; n >= 4 * sizeof(float); n -= 4 * sizeof(float)) {
+    const float32x4_t vx = vld1q_f32(x); x += 4;
+
+    const float32x4_t vz = vmaxq_f32(vsat_cutoff, vmulq_f32(vabsq_f32(vx), vminus_two));
+
+    float32x4_t vn = vmlaq_f32(vmagic_bias, vz, vlog2e);
+    const float32x4_t vs = vreinterpretq_f32_s32(vshlq_n_s32(vreinterpretq_s32_f32(vn), 23));
+    vn = vsubq_f32(vn, vmagic_bias);
+    float32x4_t vt = vmlaq_f32(vz, vn, vminus_ln2_hi);
+    vt = vmlaq_f32(vt, vn, vminus_ln2_lo);
+
+    float32x4_t vp = vmlaq_f32(vc5, vc6, vt);
+    vp = vmlaq_f32(vc4, vp, vt);
+    vp = vmlaq_f32(vc3, vp, vt);
+    vp = vmlaq_f32(vc2, vp, vt);
+    vp = vmulq_f32(vp, vt);
+
+    vt = vmulq_f32(vt, vs);
+    const float32x4_t vsm1 = vsubq_f32(vs, vone);
+    vp = vmlaq_f32(vt, vp, vt);
+    const float32x4_t vemo = vaddq_f32(vp, vsm1);
+    const float32x4_t vepo = vsubq_f32(vemo, vminus_two);
+
+    float32x4_t vr = vrecpeq_f32(vepo);
+    vr = vmulq_f32(vr, vrecpsq_f32(vr, vepo));
+    vr = vmulq_f32(vr, vrecpsq_f32(vr, vepo));
+
+    float32x4_t vy = vmulq_f32(vemo, vr);
+    vy = vbslq_f32(vsign_mask, vx, vy);
+
+    vst1q_f32(y, vy); y += 4;
+  }
+  if XNN_UNLIKELY(n != 0) {
+    const float32x4_t vx = vld1q_f32(x);
+
+    const float32x4_t vz = vmaxq_f32(vsat_cutoff, vmulq_f32(vabsq_f32(vx), vminus_two));
+
+    float32x4_t vn = vmlaq_f32(vmagic_bias, vz, vlog2e);
+    const float32x4_t vs = vreinterpretq_f32_s32(vshlq_n_s32(vreinterpretq_s32_f32(vn), 23));
+    vn = vsubq_f32(vn, vmagic_bias);
+    float32x4_t vt = vmlaq_f32(vz, vn, vminus_ln2_hi);
+    vt = vmlaq_f32(vt, vn, vminus_ln2_lo);
+
+    float32x4_t vp = vmlaq_f32(vc5, vc6, vt);
+    vp = vmlaq_f32(vc4, vp, vt);
+    vp = vmlaq_f32(vc3, vp, vt);
+    vp = vmlaq_f32(vc2, vp, vt);
+    vp = vmulq_f32(vp, vt);
+
+    vt = vmulq_f32(vt, vs);
+    const float32x4_t vsm1 = vsubq_f32(vs, vone);
+    vp = vmlaq_f32(vt, vp, vt);
+    const float32x4_t vemo = vaddq_f32(vp, vsm1);
+    const float32x4_t vepo = vsubq_f32(vemo, vminus_two);
+
+    float32x4_t vr = vrecpeq_f32(vepo);
+    vr = vmulq_f32(vr, vrecpsq_f32(vr, vepo));
+    vr = vmulq_f32(vr, vrecpsq_f32(vr, vepo));
+
+    float32x4_t vy = vmulq_f32(vemo, vr);
+    vy = vbslq_f32(vsign_mask, vx, vy);
+
+    float32x2_t vy_lo = vget_low_f32(vy);
+    if (n & (2 * sizeof(float))) {
+      vst1_f32(y, vy_lo); y += 2;
+      vy_lo = vget_high_f32(vy);
+    }
+    if (n & (1 * sizeof(float))) {
+      vst1_lane_f32(y, vy_lo, 0);
+    }
+  }
+}
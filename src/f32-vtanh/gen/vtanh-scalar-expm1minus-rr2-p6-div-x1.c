@@ -0,0 +1,78 @@
+// Auto-generated file. Do not edit!
+//   Template: src/f32-vtanh/scalar-expm1minus-rr2-p6-div.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+#include <math.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/vunary.h>
+
+#include <fp16/bitcasts.h>
+
+
+void xnn_f32_vtanh_ukernel__scalar_expm1minus_rr2_p6_div_x1(
+    size_t n,
+    const float* x,
+    float* y,
+    const union xnn_f32_tanh_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(n != 0);
+  assert(n % sizeof(float) == 0);
+  assert(x != NULL);
+  assert(y != NULL);
+
+  const float vsat_cutoff = params->scalar_expm1minus_rr2_p6.sat_cutoff;
+  const float vlog2e = params->scalar_expm1minus_rr2_p6.log2e;
+  const float vmagic_bias = params->scalar_expm1minus_rr2_p6.magic_bias;
+  const float vminus_ln2_hi = params->scalar_expm1minus_rr2_p6.minus_ln2_hi;
+  const float vminus_ln2_lo = params->scalar_expm1minus_rr2_p6.minus_ln2_lo;
+  const float vc6 = params->scalar_expm1minus_rr2_p6.c6;
+  const float vc5 = params->scalar_expm1minus_rr2_p6.c5;
+  const float vc4 = params->scalar_expm1minus_rr2_p6.c4;
+  const float vc3 = params->scalar_expm1minus_rr2_p6.c3;
+  const float vc2 = params->scalar_expm1minus_rr2_p6.c2;
+  const float vone = params->scalar_expm1minus_rr2_p6.one;
+  const float vminus_two = params->scalar_expm1minus_rr2_p6.minus_two;
+
+  do {
+    const float vx = *x++;
+
+    const float vz = fabsf(vx) * vminus_two;
+
+    float vn = vz * vlog2e + vmagic_bias;
+    float vs = fp32_from_bits(fp32_to_bits(vn) << 23);
+    vn -= vmagic_bias;
+
+    float vt = vn * vminus_ln2_hi + vz;
+    vt = vn * vminus_ln2_lo + vt;
+    if XNN_UNPREDICTABLE(vz <= vsat_cutoff) {
+      vs = 0.0f;
+      vt = 0.0f;
+    }
+
+    float vp = vc6 * vt + vc5;
+    vp = vp * vt + vc4;
+    vp = vp * vt + vc3;
+    vp = vp * vt + vc2;
+    vp *= vt;
+
+    vt *= vs;
+    const float vsm1 = vs - vone;
+    vp = vp * vt + vt;
+    const float vemo = vp + vsm1;
+    const float vepo = vemo - vminus_two;
+
+    float vy = vemo / vepo;
+    vy = copysignf(vy, vx);
+
+    *y++ = vy;
+
+    n -= sizeof(float);
+  } while (n != 0);
+}
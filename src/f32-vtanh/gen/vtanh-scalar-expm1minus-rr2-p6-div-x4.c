@@ -0,0 +1,198 @@
+// Auto-generated file. Do not edit!
+//   Template: src/f32-vtanh/scalar-expm1minus-rr2-p6-div.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+#include <math.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/vunary.h>
+
+#include <fp16/bitcasts.h>
+
+
+void xnn_f32_vtanh_ukernel__scalar_expm1minus_rr2_p6_div_x4(
+    size_t n,
+    const float* x,
+    float* y,
+    const union xnn_f32_tanh_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(n != 0);
+  assert(n % sizeof(float) == 0);
+  assert(x != NULL);
+  assert(y != NULL);
+
+  const float vsat_cutoff = params->scalar_expm1minus_rr2_p6.sat_cutoff;
+  const float vlog2e = params->scalar_expm1minus_rr2_p6.log2e;
+  const float vmagic_bias = params->scalar_expm1minus_rr2_p6.magic_bias;
+  const float vminus_ln2_hi = params->scalar_expm1minus_rr2_p6.minus_ln2_hi;
+  const float vminus_ln2_lo = params->scalar_expm1minus_rr2_p6.minus_ln2_lo;
+  const float vc6 = params->scalar_expm1minus_rr2_p6.c6;
+  const float vc5 = params->scalar_expm1minus_rr2_p6.c5;
+  const float vc4 = params->scalar_expm1minus_rr2_p6.c4;
+  const float vc3 = params->scalar_expm1minus_rr2_p6.c3;
+  const float vc2 = params->scalar_expm1minus_rr2_p6.c2;
+  const float vone = params->scalar_expm1minus_rr2_p6.one;
+  const float vminus_two = params->scalar_expm1minus_rr2_p6.minus_two;
+
+  for (; n >= 4 * sizeof(float); n -= 4 * sizeof(float)) {
+    const float vx0 = x[0];
+    const float vx1 = x[1];
+    const float vx2 = x[2];
+    const float vx3 = x[3];
+    x += 4;
+
+    const float vz0 = fabsf(vx0) * vminus_two;
+    const float vz1 = fabsf(vx1) * vminus_two;
+    const float vz2 = fabsf(vx2) * vminus_two;
+    const float vz3 = fabsf(vx3) * vminus_two;
+
+    float vn0 = vz0 * vlog2e + vmagic_bias;
+    float vn1 = vz1 * vlog2e + vmagic_bias;
+    float vn2 = vz2 * vlog2e + vmagic_bias;
+    float vn3 = vz3 * vlog2e + vmagic_bias;
+
+    float vs0 = fp32_from_bits(fp32_to_bits(vn0) << 23);
+    vn0 -= vmagic_bias;
+    float vs1 = fp32_from_bits(fp32_to_bits(vn1) << 23);
+    vn1 -= vmagic_bias;
+    float vs2 = fp32_from_bits(fp32_to_bits(vn2) << 23);
+    vn2 -= vmagic_bias;
+    float vs3 = fp32_from_bits(fp32_to_bits(vn3) << 23);
+    vn3 -= vmagic_bias;
+
+    float vt0 = vn0 * vminus_ln2_hi + vz0;
+    float vt1 = vn1 * vminus_ln2_hi + vz1;
+    float vt2 = vn2 * vminus_ln2_hi + vz2;
+    float vt3 = vn3 * vminus_ln2_hi + vz3;
+
+    vt0 = vn0 * vminus_ln2_lo + vt0;
+    vt1 = vn1 * vminus_ln2_lo + vt1;
+    vt2 = vn2 * vminus_ln2_lo + vt2;
+    vt3 = vn3 * vminus_ln2_lo + vt3;
+
+    if XNN_UNPREDICTABLE(vz0 <= vsat_cutoff) {
+      vs0 = 0.0f;
+      vt0 = 0.0f;
+    }
+    if XNN_UNPREDICTABLE(vz1 <= vsat_cutoff) {
+      vs1 = 0.0f;
+      vt1 = 0.0f;
+    }
+    if XNN_UNPREDICTABLE(vz2 <= vsat_cutoff) {
+      vs2 = 0.0f;
+      vt2 = 0.0f;
+    }
+    if XNN_UNPREDICTABLE(vz3 <= vsat_cutoff) {
+      vs3 = 0.0f;
+      vt3 = 0.0f;
+    }
+
+    float vp0 = vc6 * vt0 + vc5;
+    float vp1 = vc6 * vt1 + vc5;
+    float vp2 = vc6 * vt2 + vc5;
+    float vp3 = vc6 * vt3 + vc5;
+
+    vp0 = vp0 * vt0 + vc4;
+    vp1 = vp1 * vt1 + vc4;
+    vp2 = vp2 * vt2 + vc4;
+    vp3 = vp3 * vt3 + vc4;
+
+    vp0 = vp0 * vt0 + vc3;
+    vp1 = vp1 * vt1 + vc3;
+    vp2 = vp2 * vt2 + vc3;
+    vp3 = vp3 * vt3 + vc3;
+
+    vp0 = vp0 * vt0 + vc2;
+    vp1 = vp1 * vt1 + vc2;
+    vp2 = vp2 * vt2 + vc2;
+    vp3 = vp3 * vt3 + vc2;
+
+    vp0 *= vt0;
+    vp1 *= vt1;
+    vp2 *= vt2;
+    vp3 *= vt3;
+
+    vt0 *= vs0;
+    const float vsm10 = vs0 - vone;
+    vt1 *= vs1;
+    const float vsm11 = vs1 - vone;
+    vt2 *= vs2;
+    const float vsm12 = vs2 - vone;
+    vt3 *= vs3;
+    const float vsm13 = vs3 - vone;
+
+    vp0 = vp0 * vt0 + vt0;
+    vp1 = vp1 * vt1 + vt1;
+    vp2 = vp2 * vt2 + vt2;
+    vp3 = vp3 * vt3 + vt3;
+
+    const float vemo0 = vp0 + vsm10;
+    const float vemo1 = vp1 + vsm11;
+    const float vemo2 = vp2 + vsm12;
+    const float vemo3 = vp3 + vsm13;
+
+    const float vepo0 = vemo0 - vminus_two;
+    const float vepo1 = vemo1 - vminus_two;
+    const float vepo2 = vemo2 - vminus_two;
+    const float vepo3 = vemo3 - vminus_two;
+
+    float vy0 = vemo0 / vepo0;
+    float vy1 = vemo1 / vepo1;
+    float vy2 = vemo2 / vepo2;
+    float vy3 = vemo3 / vepo3;
+
+    vy0 = copysignf(vy0, vx0);
+    vy1 = copysignf(vy1, vx1);
+    vy2 = copysignf(vy2, vx2);
+    vy3 = copysignf(vy3, vx3);
+
+    y[0] = vy0;
+    y[1] = vy1;
+    y[2] = vy2;
+    y[3] = vy3;
+    y += 4;
+  }
+  if XNN_UNLIKELY(n != 0) {
+    do {
+      const float vx = *x++;
+
+      const float vz = fabsf(vx) * vminus_two;
+
+      float vn = vz * vlog2e + vmagic_bias;
+      float vs = fp32_from_bits(fp32_to_bits(vn) << 23);
+      vn -= vmagic_bias;
+
+      float vt = vn * vminus_ln2_hi + vz;
+      vt = vn * vminus_ln2_lo + vt;
+      if XNN_UNPREDICTABLE(vz <= vsat_cutoff) {
+        vs = 0.0f;
+        vt = 0.0f;
+      }
+
+      float vp = vc6 * vt + vc5;
+      vp = vp * vt + vc4;
+      vp = vp * vt + vc3;
+      vp = vp * vt + vc2;
+      vp *= vt;
+
+      vt *= vs;
+      const float vsm1 = vs - vone;
+      vp = vp * vt + vt;
+      const float vemo = vp + vsm1;
+      const float vepo = vemo - vminus_two;
+
+      float vy = vemo / vepo;
+      vy = copysignf(vy, vx);
+
+      *y++ = vy;
+
+      n -= sizeof(float);
+    } while (n != 0);
+  }
+}
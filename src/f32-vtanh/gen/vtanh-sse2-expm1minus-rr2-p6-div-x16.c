@@ -0,0 +1,219 @@
+// Auto-generated file. Do not edit!
+//   Template: src/f32-vtanh/sse-expm1minus-rr2-p6-div.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <emmintrin.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/vunary.h>
+
+
+void xnn_f32_vtanh_ukernel__sse2_expm1minus_rr2_p6_div_x16(
+    size_t n,
+    const float* x,
+    float* y,
+    const union xnn_f32_tanh_params params[restrict XNN_MIN_ELEMENTS(1)]) XNN_OOB_READS
+{
+  assert(n != 0);
+  assert(n % sizeof(float) == 0);
+  assert(x != NULL);
+  assert(y != NULL);
+
+  const __m128 vsign_mask = _mm_load_ps(params->sse_expm1minus_rr2_p6.sign_mask);
+  const __m128 vsat_cutoff = _mm_load_ps(params->sse_expm1minus_rr2_p6.sat_cutoff);
+  const __m128 vlog2e = _mm_load_ps(params->sse_expm1minus_rr2_p6.log2e);
+  const __m128 vmagic_bias = _mm_load_ps(params->sse_expm1minus_rr2_p6.magic_bias);
+  const __m128 vminus_ln2_hi = _mm_load_ps(params->sse_expm1minus_rr2_p6.minus_ln2_hi);
+  const __m128 vminus_ln2_lo = _mm_load_ps(params->sse_expm1minus_rr2_p6.minus_ln2_lo);
+  const __m128 vc6 = _mm_load_ps(params->sse_expm1minus_rr2_p6.c6);
+  const __m128 vc5 = _mm_load_ps(params->sse_expm1minus_rr2_p6.c5);
+  const __m128 vc4 = _mm_load_ps(params->sse_expm1minus_rr2_p6.c4);
+  const __m128 vc3 = _mm_load_ps(params->sse_expm1minus_rr2_p6.c3);
+  const __m128 vc2 = _mm_load_ps(params->sse_expm1minus_rr2_p6.c2);
+  const __m128 vone = _mm_load_ps(params->sse_expm1minus_rr2_p6.one);
+  const __m128 vminus_two = _mm_load_ps(params->sse_expm1minus_rr2_p6.minus_two);
+
+  for (; n >= 16 * sizeof(float); n -= 16 * sizeof(float)) {
+    const __m128 vx0123 = _mm_loadu_ps(x);
+    const __m128 vx4567 = _mm_loadu_ps(x + 4);
+    const __m128 vx89AB = _mm_loadu_ps(x + 8);
+    const __m128 vxCDEF = _mm_loadu_ps(x + 12);
+    x += 16;
+
+    __m128 vz0123 = _mm_or_ps(vx0123, vsign_mask);
+    __m128 vz4567 = _mm_or_ps(vx4567, vsign_mask);
+    __m128 vz89AB = _mm_or_ps(vx89AB, vsign_mask);
+    __m128 vzCDEF = _mm_or_ps(vxCDEF, vsign_mask);
+
+    vz0123 = _mm_max_ps(vsat_cutoff, _mm_add_ps(vz0123, vz0123));
+    vz4567 = _mm_max_ps(vsat_cutoff, _mm_add_ps(vz4567, vz4567));
+    vz89AB = _mm_max_ps(vsat_cutoff, _mm_add_ps(vz89AB, vz89AB));
+    vzCDEF = _mm_max_ps(vsat_cutoff, _mm_add_ps(vzCDEF, vzCDEF));
+
+    __m128 vn0123 = _mm_add_ps(_mm_mul_ps(vz0123, vlog2e), vmagic_bias);
+    __m128 vn4567 = _mm_add_ps(_mm_mul_ps(vz4567, vlog2e), vmagic_bias);
+    __m128 vn89AB = _mm_add_ps(_mm_mul_ps(vz89AB, vlog2e), vmagic_bias);
+    __m128 vnCDEF = _mm_add_ps(_mm_mul_ps(vzCDEF, vlog2e), vmagic_bias);
+
+    const __m128 vs0123 = _mm_castsi128_ps(_mm_slli_epi32(_mm_castps_si128(vn0123), 23));
+    const __m128 vs4567 = _mm_castsi128_ps(_mm_slli_epi32(_mm_castps_si128(vn4567), 23));
+    const __m128 vs89AB = _mm_castsi128_ps(_mm_slli_epi32(_mm_castps_si128(vn89AB), 23));
+    const __m128 vsCDEF = _mm_castsi128_ps(_mm_slli_epi32(_mm_castps_si128(vnCDEF), 23));
+
+    vn0123 = _mm_sub_ps(vn0123, vmagic_bias);
+    vn4567 = _mm_sub_ps(vn4567, vmagic_bias);
+    vn89AB = _mm_sub_ps(vn89AB, vmagic_bias);
+    vnCDEF = _mm_sub_ps(vnCDEF, vmagic_bias);
+
+    __m128 vt0123 = _mm_add_ps(_mm_mul_ps(vn0123, vminus_ln2_hi), vz0123);
+    __m128 vt4567 = _mm_add_ps(_mm_mul_ps(vn4567, vminus_ln2_hi), vz4567);
+    __m128 vt89AB = _mm_add_ps(_mm_mul_ps(vn89AB, vminus_ln2_hi), vz89AB);
+    __m128 vtCDEF = _mm_add_ps(_mm_mul_ps(vnCDEF, vminus_ln2_hi), vzCDEF);
+
+    vt0123 = _mm_add_ps(_mm_mul_ps(vn0123, vminus_ln2_lo), vt0123);
+    vt4567 = _mm_add_ps(_mm_mul_ps(vn4567, vminus_ln2_lo), vt4567);
+    vt89AB = _mm_add_ps(_mm_mul_ps(vn89AB, vminus_ln2_lo), vt89AB);
+    vtCDEF = _mm_add_ps(_mm_mul_ps(vnCDEF, vminus_ln2_lo), vtCDEF);
+
+    __m128 vp0123 = _mm_add_ps(_mm_mul_ps(vc6, vt0123), vc5);
+    __m128 vp4567 = _mm_add_ps(_mm_mul_ps(vc6, vt4567), vc5);
+    __m128 vp89AB = _mm_add_ps(_mm_mul_ps(vc6, vt89AB), vc5);
+    __m128 vpCDEF = _mm_add_ps(_mm_mul_ps(vc6, vtCDEF), vc5);
+
+    vp0123 = _mm_add_ps(_mm_mul_ps(vp0123, vt0123), vc4);
+    vp4567 = _mm_add_ps(_mm_mul_ps(vp4567, vt4567), vc4);
+    vp89AB = _mm_add_ps(_mm_mul_ps(vp89AB, vt89AB), vc4);
+    vpCDEF = _mm_add_ps(_mm_mul_ps(vpCDEF, vtCDEF), vc4);
+
+    vp0123 = _mm_add_ps(_mm_mul_ps(vp0123, vt0123), vc3);
+    vp4567 = _mm_add_ps(_mm_mul_ps(vp4567, vt4567), vc3);
+    vp89AB = _mm_add_ps(_mm_mul_ps(vp89AB, vt89AB), vc3);
+    vpCDEF = _mm_add_ps(_mm_mul_ps(vpCDEF, vtCDEF), vc3);
+
+    vp0123 = _mm_add_ps(_mm_mul_ps(vp0123, vt0123), vc2);
+    vp4567 = _mm_add_ps(_mm_mul_ps(vp4567, vt4567), vc2);
+    vp89AB = _mm_add_ps(_mm_mul_ps(vp89AB, vt89AB), vc2);
+    vpCDEF = _mm_add_ps(_mm_mul_ps(vpCDEF, vtCDEF), vc2);
+
+    vp0123 = _mm_mul_ps(vp0123, vt0123);
+    vp4567 = _mm_mul_ps(vp4567, vt4567);
+    vp89AB = _mm_mul_ps(vp89AB, vt89AB);
+    vpCDEF = _mm_mul_ps(vpCDEF, vtCDEF);
+
+    vt0123 = _mm_mul_ps(vt0123, vs0123);
+    const __m128 vsm10123 = _mm_sub_ps(vs0123, vone);
+    vt4567 = _mm_mul_ps(vt4567, vs4567);
+    const __m128 vsm14567 = _mm_sub_ps(vs4567, vone);
+    vt89AB = _mm_mul_ps(vt89AB, vs89AB);
+    const __m128 vsm189AB = _mm_sub_ps(vs89AB, vone);
+    vtCDEF = _mm_mul_ps(vtCDEF, vsCDEF);
+    const __m128 vsm1CDEF = _mm_sub_ps(vsCDEF, vone);
+
+    vp0123 = _mm_add_ps(_mm_mul_ps(vp0123, vt0123), vt0123);
+    vp4567 = _mm_add_ps(_mm_mul_ps(vp4567, vt4567), vt4567);
+    vp89AB = _mm_add_ps(_mm_mul_ps(vp89AB, vt89AB), vt89AB);
+    vpCDEF = _mm_add_ps(_mm_mul_ps(vpCDEF, vtCDEF), vtCDEF);
+
+    const __m128 vemo0123 = _mm_add_ps(vp0123, vsm10123);
+    const __m128 vemo4567 = _mm_add_ps(vp4567, vsm14567);
+    const __m128 vemo89AB = _mm_add_ps(vp89AB, vsm189AB);
+    const __m128 vemoCDEF = _mm_add_ps(vpCDEF, vsm1CDEF);
+
+    const __m128 vepo0123 = _mm_sub_ps(vemo0123, vminus_two);
+    const __m128 vepo4567 = _mm_sub_ps(vemo4567, vminus_two);
+    const __m128 vepo89AB = _mm_sub_ps(vemo89AB, vminus_two);
+    const __m128 vepoCDEF = _mm_sub_ps(vemoCDEF, vminus_two);
+
+    __m128 vy0123 = _mm_div_ps(vemo0123, vepo0123);
+    __m128 vy4567 = _mm_div_ps(vemo4567, vepo4567);
+    __m128 vy89AB = _mm_div_ps(vemo89AB, vepo89AB);
+    __m128 vyCDEF = _mm_div_ps(vemoCDEF, vepoCDEF);
+
+    vy0123 = _mm_or_ps(_mm_andnot_ps(vsign_mask, vy0123), _mm_and_ps(vsign_mask, vx0123));
+    vy4567 = _mm_or_ps(_mm_andnot_ps(vsign_mask, vy4567), _mm_and_ps(vsign_mask, vx4567));
+    vy89AB = _mm_or_ps(_mm_andnot_ps(vsign_mask, vy89AB), _mm_and_ps(vsign_mask, vx89AB));
+    vyCDEF = _mm_or_ps(_mm_andnot_ps(vsign_mask, vyCDEF), _mm_and_ps(vsign_mask, vxCDEF));
+
+    _mm_storeu_ps(y, vy0123);
+    _mm_storeu_ps(y + 4, vy4567);
+    _mm_storeu_ps(y + 8, vy89AB);
+    _mm_storeu_ps(y + 12, vyCDEF);
+    y += 16;
+  }
+  for (; n >= 4 * sizeof(float); n -= 4 * sizeof(float)) {
+    const __m128 vx = _mm_loadu_ps(x);
+    x += 4;
+
+    __m128 vz = _mm_or_ps(vx, vsign_mask);
+    vz = _mm_max_ps(vsat_cutoff, _mm_add_ps(vz, vz));
+
+    __m128 vn = _mm_add_ps(_mm_mul_ps(vz, vlog2e), vmagic_bias);
+    const __m128 vs = _mm_castsi128_ps(_mm_slli_epi32(_mm_castps_si128(vn), 23));
+    vn = _mm_sub_ps(vn, vmagic_bias);
+
+    __m128 vt = _mm_add_ps(_mm_mul_ps(vn, vminus_ln2_hi), vz);
+    vt = _mm_add_ps(_mm_mul_ps(vn, vminus_ln2_lo), vt);
+
+    __m128 vp = _mm_add_ps(_mm_mul_ps(vc6, vt), vc5);
+    vp = _mm_add_ps(_mm_mul_ps(vp, vt), vc4);
+    vp = _mm_add_ps(_mm_mul_ps(vp, vt), vc3);
+    vp = _mm_add_ps(_mm_mul_ps(vp, vt), vc2);
+    vp = _mm_mul_ps(vp, vt);
+
+    vt = _mm_mul_ps(vt, vs);
+    const __m128 vsm1 = _mm_sub_ps(vs, vone);
+    vp = _mm_add_ps(_mm_mul_ps(vp, vt), vt);
+    const __m128 vemo = _mm_add_ps(vp, vsm1);
+    const __m128 vepo = _mm_sub_ps(vemo, vminus_two);
+
+    __m128 vy = _mm_div_ps(vemo, vepo);
+    vy = _mm_or_ps(_mm_andnot_ps(vsign_mask, vy), _mm_and_ps(vsign_mask, vx));
+
+    _mm_storeu_ps(y, vy);
+    y += 4;
+  }
+  if XNN_UNLIKELY(n != 0) {
+    const __m128 vx = _mm_loadu_ps(x);
+
+    __m128 vz = _mm_or_ps(vx, vsign_mask);
+    vz = _mm_max_ps(vsat_cutoff, _mm_add_ps(vz, vz));
+
+    __m128 vn = _mm_add_ps(_mm_mul_ps(vz, vlog2e), vmagic_bias);
+    const __m128 vs = _mm_castsi128_ps(_mm_slli_epi32(_mm_castps_si128(vn), 23));
+    vn = _mm_sub_ps(vn, vmagic_bias);
+
+    __m128 vt = _mm_add_ps(_mm_mul_ps(vn, vminus_ln2_hi), vz);
+    vt = _mm_add_ps(_mm_mul_ps(vn, vminus_ln2_lo), vt);
+
+    __m128 vp = _mm_add_ps(_mm_mul_ps(vc6, vt), vc5);
+    vp = _mm_add_ps(_mm_mul_ps(vp, vt), vc4);
+    vp = _mm_add_ps(_mm_mul_ps(vp, vt), vc3);
+    vp = _mm_add_ps(_mm_mul_ps(vp, vt), vc2);
+    vp = _mm_mul_ps(vp, vt);
+
+    vt = _mm_mul_ps(vt, vs);
+    const __m128 vsm1 = _mm_sub_ps(vs, vone);
+    vp = _mm_add_ps(_mm_mul_ps(vp, vt), vt);
+    const __m128 vemo = _mm_add_ps(vp, vsm1);
+    const __m128 vepo = _mm_sub_ps(vemo, vminus_two);
+
+    __m128 vy = _mm_div_ps(vemo, vepo);
+    vy = _mm_or_ps(_mm_andnot_ps(vsign_mask, vy), _mm_and_ps(vsign_mask, vx));
+
+    if (n & (2 * sizeof(float))) {
+      _mm_storel_pi((__m64*) y, vy);
+      vy = _mm_movehl_ps(vy, vy);
+      y += 2;
+    }
+    if (n & (1 * sizeof(float))) {
+      _mm_store_ss(y, vy);
+    }
+  }
+}
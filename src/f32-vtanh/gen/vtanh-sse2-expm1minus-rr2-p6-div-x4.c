@@ -0,0 +1,112 @@
+// Auto-generated file. Do not edit!
+//   Template: src/f32-vtanh/sse-expm1minus-rr2-p6-div.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <emmintrin.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/vunary.h>
+
+
+void xnn_f32_vtanh_ukernel__sse2_expm1minus_rr2_p6_div_x4(
+    size_t n,
+    const float* x,
+    float* y,
+    const union xnn_f32_tanh_params params[restrict XNN_MIN_ELEMENTS(1)]) XNN_OOB_READS
+{
+  assert(n != 0);
+  assert(n % sizeof(float) == 0);
+  assert(x != NULL);
+  assert(y != NULL);
+
+  const __m128 vsign_mask = _mm_load_ps(params->sse_expm1minus_rr2_p6.sign_mask);
+  const __m128 vsat_cutoff = _mm_load_ps(params->sse_expm1minus_rr2_p6.sat_cutoff);
+  const __m128 vlog2e = _mm_load_ps(params->sse_expm1minus_rr2_p6.log2e);
+  const __m128 vmagic_bias = _mm_load_ps(params->sse_expm1minus_rr2_p6.magic_bias);
+  const __m128 vminus_ln2_hi = _mm_load_ps(params->sse_expm1minus_rr2_p6.minus_ln2_hi);
+  const __m128 vminus_ln2_lo = _mm_load_ps(params->sse_expm1minus_rr2_p6.minus_ln2_lo);
+  const __m128 vc6 = _mm_load_ps(params->sse_expm1minus_rr2_p6.c6);
+  const __m128 vc5 = _mm_load_ps(params->sse_expm1minus_rr2_p6.c5);
+  const __m128 vc4 = _mm_load_ps(params->sse_expm1minus_rr2_p6.c4);
+  const __m128 vc3 = _mm_load_ps(params->sse_expm1minus_rr2_p6.c3);
+  const __m128 vc2 = _mm_load_ps(params->sse_expm1minus_rr2_p6.c2);
+  const __m128 vone = _mm_load_ps(params->sse_expm1minus_rr2_p6.one);
+  const __m128 vminus_two = _mm_load_ps(params->sse_expm1minus_rr2_p6.minus_two);
+
+  for (; n >= 4 * sizeof(float); n -= 4 * sizeof(float)) {
+    const __m128 vx = _mm_loadu_ps(x);
+    x += 4;
+
+    __m128 vz = _mm_or_ps(vx, vsign_mask);
+    vz = _mm_max_ps(vsat_cutoff, _mm_add_ps(vz, vz));
+
+    __m128 vn = _mm_add_ps(_mm_mul_ps(vz, vlog2e), vmagic_bias);
+    const __m128 vs = _mm_castsi128_ps(_mm_slli_epi32(_mm_castps_si128(vn), 23));
+    vn = _mm_sub_ps(vn, vmagic_bias);
+
+    __m128 vt = _mm_add_ps(_mm_mul_ps(vn, vminus_ln2_hi), vz);
+    vt = _mm_add_ps(_mm_mul_ps(vn, vminus_ln2_lo), vt);
+
+    __m128 vp = _mm_add_ps(_mm_mul_ps(vc6, vt), vc5);
+    vp = _mm_add_ps(_mm_mul_ps(vp, vt), vc4);
+    vp = _mm_add_ps(_mm_mul_ps(vp, vt), vc3);
+    vp = _mm_add_ps(_mm_mul_ps(vp, vt), vc2);
+    vp = _mm_mul_ps(vp, vt);
+
+    vt = _mm_mul_ps(vt, vs);
+    const __m128 vsm1 = _mm_sub_ps(vs, vone);
+    vp = _mm_add_ps(_mm_mul_ps(vp, vt), vt);
+    const __m128 vemo = _mm_add_ps(vp, vsm1);
+    const __m128 vepo = _mm_sub_ps(vemo, vminus_two);
+
+    __m128 vy = _mm_div_ps(vemo, vepo);
+    vy = _mm_or_ps(_mm_andnot_ps(vsign_mask, vy), _mm_and_ps(vsign_mask, vx));
+
+    _mm_storeu_ps(y, vy);
+    y += 4;
+  }
+  if XNN_UNLIKELY(n != 0) {
+    const __m128 vx = _mm_loadu_ps(x);
+
+    __m128 vz = _mm_or_ps(vx, vsign_mask);
+    vz = _mm_max_ps(vsat_cutoff, _mm_add_ps(vz, vz));
+
+    __m128 vn = _mm_add_ps(_mm_mul_ps(vz, vlog2e), vmagic_bias);
+    const __m128 vs = _mm_castsi128_ps(_mm_slli_epi32(_mm_castps_si128(vn), 23));
+    vn = _mm_sub_ps(vn, vmagic_bias);
+
+    __m128 vt = _mm_add_ps(_mm_mul_ps(vn, vminus_ln2_hi), vz);
+    vt = _mm_add_ps(_mm_mul_ps(vn, vminus_ln2_lo), vt);
+
+    __m128 vp = _mm_add_ps(_mm_mul_ps(vc6, vt), vc5);
+    vp = _mm_add_ps(_mm_mul_ps(vp, vt), vc4);
+    vp = _mm_add_ps(_mm_mul_ps(vp, vt), vc3);
+    vp = _mm_add_ps(_mm_mul_ps(vp, vt), vc2);
+    vp = _mm_mul_ps(vp, vt);
+
+    vt = _mm_mul_ps(vt, vs);
+    const __m128 vsm1 = _mm_sub_ps(vs, vone);
+    vp = _mm_add_ps(_mm_mul_ps(vp, vt), vt);
+    const __m128 vemo = _mm_add_ps(vp, vsm1);
+    const __m128 vepo = _mm_sub_ps(vemo, vminus_two);
+
+    __m128 vy = _mm_div_ps(vemo, vepo);
+    vy = _mm_or_ps(_mm_andnot_ps(vsign_mask, vy), _mm_and_ps(vsign_mask, vx));
+
+    if (n & (2 * sizeof(float))) {
+      _mm_storel_pi((__m64*) y, vy);
+      vy = _mm_movehl_ps(vy, vy);
+      y += 2;
+    }
+    if (n & (1 * sizeof(float))) {
+      _mm_store_ss(y, vy);
+    }
+  }
+}
@@ -49,13 +49,16 @@
 #include <xnnpack/prelu.h>
 #include <xnnpack/raddstoreexpminusmax.h>
 #include <xnnpack/rmax.h>
+#include <xnnpack/rmeanvar.h>
 #include <xnnpack/spmm.h>
+#include <xnnpack/transpose.h>
 #include <xnnpack/unpool.h>
 #include <xnnpack/vaddsub.h>
 #include <xnnpack/vbinary.h>
 #include <xnnpack/vcvt.h>
 #include <xnnpack/vmul.h>
 #include <xnnpack/vmulcaddc.h>
+#include <xnnpack/vnormcaddc.h>
 #include <xnnpack/vunary.h>
 #include <xnnpack/zip.h>
 
@@ -388,6 +391,11 @@ static void init(void) {
         .mr = 9,
         .qr = 8,
       };
+      xnn_params.s8.rdmax = (struct rdmax_parameters) {
+        .ukernel = (xnn_rdmax_ukernel_function) xnn_s8_rdmax_minmax_ukernel_c16__neon,
+        .init.s8 = xnn_init_s8_minmax_neon_params,
+        .channel_tile = 16,
+      };
     #endif  // XNN_NO_S8_OPERATORS
 
     /**************************** U8 AArch32 micro-kernels ****************************/
@@ -425,6 +433,10 @@ static void init(void) {
         .x4 = (xnn_zipc_ukernel_function) xnn_x8_zip_x4_ukernel__neon,
         .xm = (xnn_zipv_ukernel_function) xnn_x8_zip_xm_ukernel__neon,
       };
+      xnn_params.x8.transpose = (struct transpose_parameters) {
+        .const_size_ukernel = (xnn_transposec_ukernel_function) xnn_x8_transpose_ukernel__2x4_scalar_int,
+        .tile_size = 32,
+      };
     #endif  // XNN_NO_X8_OPERATORS
 
     /**************************** F32 AArch32 micro-kernels ****************************/
@@ -692,6 +704,16 @@ static void init(void) {
         .ukernel = (xnn_univector_ukernel_function) xnn_f32_vsqrt_ukernel__scalar_sqrt_x1,
         .element_tile = 1,
       };
+      xnn_params.f32.gelu = (struct vunary_parameters) {
+        .ukernel = (xnn_univector_ukernel_function) xnn_f32_vgelu_ukernel__neon_rational_13_8_nr2recps_x8,
+        .init.f32_gelu = xnn_init_f32_gelu_neon_rational_13_8_params,
+        .element_tile = 8,
+      };
+      xnn_params.f32.tanh = (struct vunary_parameters) {
+        .ukernel = (xnn_univector_ukernel_function) xnn_f32_vtanh_ukernel__neon_expm1minus_rr2_p6_nr2recps_x8,
+        .init.f32_tanh = xnn_init_f32_tanh_neon_expm1minus_rr2_p6_params,
+        .element_tile = 8,
+      };
       xnn_params.f32.prelu = (struct prelu_parameters) {
         .ukernel = (xnn_prelu_ukernel_function) xnn_f32_prelu_ukernel__neon_2x8,
         .row_tile = 2,
@@ -703,6 +725,15 @@ static void init(void) {
         .element_tile = 8,
       };
       xnn_params.f32.rmax = xnn_f32_rmax_ukernel__neon;
+      xnn_params.f32.rdmax = (struct rdmax_parameters) {
+        .ukernel = (xnn_rdmax_ukernel_function) xnn_f32_rdmax_ukernel_c16__neon,
+        .channel_tile = 16,
+      };
+      xnn_params.f32.layer_norm = (struct layer_norm_parameters) {
+        .rmeanvar = xnn_f32_rmeanvar_ukernel__neon,
+        .vnormcaddc = xnn_f32_vnormcaddc_ukernel_c8__neon,
+        .channel_tile = 8,
+      };
       xnn_params.f32.vadd = (struct vbinary_parameters) {
         .minmax.op_ukernel = (xnn_vbinary_ukernel_function) xnn_f32_vadd_minmax_ukernel__neon_x8,
         .minmax.opc_ukernel = (xnn_vbinary_ukernel_function) xnn_f32_vaddc_minmax_ukernel__neon_x8,
@@ -862,6 +893,16 @@ static void init(void) {
       };
     #endif  // XNN_NO_VCVT_OPERATORS
 
+    /**************************** X16 AArch32 micro-kernels ****************************/
+    #ifndef XNN_NO_X16_OPERATORS
+      init_flags |= XNN_INIT_FLAG_X16;
+
+      xnn_params.x16.transpose = (struct transpose_parameters) {
+        .const_size_ukernel = (xnn_transposec_ukernel_function) xnn_x16_transpose_ukernel__2x4_scalar_int,
+        .tile_size = 32,
+      };
+    #endif  // XNN_NO_X16_OPERATORS
+
     /**************************** X32 AArch32 micro-kernels ****************************/
     #ifndef XNN_NO_X32_OPERATORS
       init_flags |= XNN_INIT_FLAG_X32;
@@ -880,6 +921,10 @@ static void init(void) {
           .pixel_tile = 1,
         };
       #endif  // XNN_NO_NCHW_OPERATORS
+      xnn_params.x32.transpose = (struct transpose_parameters) {
+        .const_size_ukernel = (xnn_transposec_ukernel_function) xnn_x32_transpose_ukernel__2x4_scalar_int,
+        .tile_size = 32,
+      };
     #endif  // XNN_NO_X32_OPERATORS
 
     /**************************** XX AArch32 micro-kernels ****************************/
@@ -1017,6 +1062,11 @@ static void init(void) {
         .mr = 9,
         .qr = 8,
       };
+      xnn_params.s8.rdmax = (struct rdmax_parameters) {
+        .ukernel = (xnn_rdmax_ukernel_function) xnn_s8_rdmax_minmax_ukernel_c4__scalar,
+        .init.s8 = xnn_init_s8_minmax_scalar_params,
+        .channel_tile = 4,
+      };
     #endif  // XNN_NO_S8_OPERATORS
 
     /**************************** U8 AArch32 Pre-NEON micro-kernels ****************************/
@@ -1054,6 +1104,10 @@ static void init(void) {
         .x4 = (xnn_zipc_ukernel_function) xnn_x8_zip_x4_ukernel__scalar,
         .xm = (xnn_zipv_ukernel_function) xnn_x8_zip_xm_ukernel__scalar,
       };
+      xnn_params.x8.transpose = (struct transpose_parameters) {
+        .const_size_ukernel = (xnn_transposec_ukernel_function) xnn_x8_transpose_ukernel__2x4_scalar_int,
+        .tile_size = 32,
+      };
     #endif  // XNN_NO_X8_OPERATORS
 
     /**************************** F32 AArch32 Pre-NEON micro-kernels ****************************/
@@ -1212,6 +1266,16 @@ static void init(void) {
         .ukernel = (xnn_univector_ukernel_function) xnn_f32_vsqrt_ukernel__scalar_sqrt_x1,
         .element_tile = 1,
       };
+      xnn_params.f32.gelu = (struct vunary_parameters) {
+        .ukernel = (xnn_univector_ukernel_function) xnn_f32_vgelu_ukernel__scalar_rational_13_8_div_x2,
+        .init.f32_gelu = xnn_init_f32_gelu_scalar_rational_13_8_params,
+        .element_tile = 2,
+      };
+      xnn_params.f32.tanh = (struct vunary_parameters) {
+        .ukernel = (xnn_univector_ukernel_function) xnn_f32_vtanh_ukernel__scalar_expm1minus_rr2_p6_div_x2,
+        .init.f32_tanh = xnn_init_f32_tanh_scalar_expm1minus_rr2_p6_params,
+        .element_tile = 2,
+      };
       xnn_params.f32.prelu = (struct prelu_parameters) {
         .ukernel = (xnn_prelu_ukernel_function) xnn_f32_prelu_ukernel__scalar_2x4,
         .row_tile = 4,
@@ -1223,6 +1287,15 @@ static void init(void) {
         .element_tile = 4,
       };
       xnn_params.f32.rmax = xnn_f32_rmax_ukernel__scalar;
+      xnn_params.f32.rdmax = (struct rdmax_parameters) {
+        .ukernel = (xnn_rdmax_ukernel_function) xnn_f32_rdmax_ukernel_c4__scalar,
+        .channel_tile = 4,
+      };
+      xnn_params.f32.layer_norm = (struct layer_norm_parameters) {
+        .rmeanvar = xnn_f32_rmeanvar_ukernel__scalar,
+        .vnormcaddc = xnn_f32_vnormcaddc_ukernel_c4__scalar,
+        .channel_tile = 4,
+      };
       xnn_params.f32.vadd = (struct vbinary_parameters) {
         .minmax.op_ukernel = (xnn_vbinary_ukernel_function) xnn_f32_vadd_minmax_ukernel__scalar_x8,
         .minmax.opc_ukernel = (xnn_vbinary_ukernel_function) xnn_f32_vaddc_minmax_ukernel__scalar_x8,
@@ -1368,6 +1441,16 @@ static void init(void) {
       };
     #endif  // XNN_NO_VCVT_OPERATORS
 
+    /**************************** X16 AArch32 Pre-NEON micro-kernels ****************************/
+    #ifndef XNN_NO_X16_OPERATORS
+      init_flags |= XNN_INIT_FLAG_X16;
+
+      xnn_params.x16.transpose = (struct transpose_parameters) {
+        .const_size_ukernel = (xnn_transposec_ukernel_function) xnn_x16_transpose_ukernel__2x4_scalar_int,
+        .tile_size = 32,
+      };
+    #endif  // XNN_NO_X16_OPERATORS
+
     /**************************** X32 AArch32 Pre-NEON micro-kernels ****************************/
     #ifndef XNN_NO_X32_OPERATORS
       init_flags |= XNN_INIT_FLAG_X32;
@@ -1386,6 +1469,10 @@ static void init(void) {
           .pixel_tile = 1,
         };
       #endif  // XNN_NO_NCHW_OPERATORS
+      xnn_params.x32.transpose = (struct transpose_parameters) {
+        .const_size_ukernel = (xnn_transposec_ukernel_function) xnn_x32_transpose_ukernel__2x4_scalar_int,
+        .tile_size = 32,
+      };
     #endif  // XNN_NO_X32_OPERATORS
 
     /**************************** XX AArch32 Pre-NEON micro-kernels ****************************/
@@ -2008,6 +2095,11 @@ static void init(void) {
       .mr = 9,
       .qr = 8,
     };
+    xnn_params.s8.rdmax = (struct rdmax_parameters) {
+      .ukernel = (xnn_rdmax_ukernel_function) xnn_s8_rdmax_minmax_ukernel_c16__neon,
+      .init.s8 = xnn_init_s8_minmax_neon_params,
+      .channel_tile = 16,
+    };
   #endif  // XNN_NO_S8_OPERATORS
 
   /**************************** U8 AArch64 micro-kernels ****************************/
@@ -2045,6 +2137,10 @@ static void init(void) {
       .x4 = (xnn_zipc_ukernel_function) xnn_x8_zip_x4_ukernel__neon,
       .xm = (xnn_zipv_ukernel_function) xnn_x8_zip_xm_ukernel__neon,
     };
+    xnn_params.x8.transpose = (struct transpose_parameters) {
+      .const_size_ukernel = (xnn_transposec_ukernel_function) xnn_x8_transpose_ukernel__2x4_scalar_int,
+      .tile_size = 32,
+    };
   #endif  // XNN_NO_X8_OPERATORS
 
   /**************************** F16 AArch64 micro-kernels ****************************/
@@ -2500,6 +2596,16 @@ static void init(void) {
       .ukernel = (xnn_univector_ukernel_function) xnn_f32_vsqrt_ukernel__neon_sqrt_x4,
       .element_tile = 4,
     };
+    xnn_params.f32.gelu = (struct vunary_parameters) {
+      .ukernel = (xnn_univector_ukernel_function) xnn_f32_vgelu_ukernel__neonfma_rational_13_8_div_x16,
+      .init.f32_gelu = xnn_init_f32_gelu_neon_rational_13_8_params,
+      .element_tile = 16,
+    };
+    xnn_params.f32.tanh = (struct vunary_parameters) {
+      .ukernel = (xnn_univector_ukernel_function) xnn_f32_vtanh_ukernel__neonfma_expm1minus_rr1_p6_nr2recps_x16,
+      .init.f32_tanh = xnn_init_f32_tanh_neonfma_expm1minus_rr1_p6_params,
+      .element_tile = 16,
+    };
     xnn_params.f32.prelu = (struct prelu_parameters) {
       .ukernel = (xnn_prelu_ukernel_function) xnn_f32_prelu_ukernel__neon_2x8,
       .row_tile = 2,
@@ -2511,6 +2617,15 @@ static void init(void) {
       .element_tile = 16,
     };
     xnn_params.f32.rmax = xnn_f32_rmax_ukernel__neon;
+    xnn_params.f32.rdmax = (struct rdmax_parameters) {
+      .ukernel = (xnn_rdmax_ukernel_function) xnn_f32_rdmax_ukernel_c16__neon,
+      .channel_tile = 16,
+    };
+    xnn_params.f32.layer_norm = (struct layer_norm_parameters) {
+      .rmeanvar = xnn_f32_rmeanvar_ukernel__neon,
+      .vnormcaddc = xnn_f32_vnormcaddc_ukernel_c8__neonfma,
+      .channel_tile = 8,
+    };
     xnn_params.f32.vadd = (struct vbinary_parameters) {
       .minmax.op_ukernel = (xnn_vbinary_ukernel_function) xnn_f32_vadd_minmax_ukernel__neon_x8,
       .minmax.opc_ukernel = (xnn_vbinary_ukernel_function) xnn_f32_vaddc_minmax_ukernel__neon_x8,
@@ -2654,6 +2769,16 @@ static void init(void) {
     };
   #endif  // XNN_NO_VCVT_OPERATORS
 
+  /**************************** X16 AArch64 micro-kernels ****************************/
+  #ifndef XNN_NO_X16_OPERATORS
+    init_flags |= XNN_INIT_FLAG_X16;
+
+    xnn_params.x16.transpose = (struct transpose_parameters) {
+      .const_size_ukernel = (xnn_transposec_ukernel_function) xnn_x16_transpose_ukernel__2x4_scalar_int,
+      .tile_size = 32,
+    };
+  #endif  // XNN_NO_X16_OPERATORS
+
   /**************************** X32 AArch64 micro-kernels ****************************/
   #ifndef XNN_NO_X32_OPERATORS
     init_flags |= XNN_INIT_FLAG_X32;
@@ -2672,6 +2797,10 @@ static void init(void) {
         .pixel_tile = 1,
       };
     #endif  // XNN_NO_NCHW_OPERATORS
+    xnn_params.x32.transpose = (struct transpose_parameters) {
+      .const_size_ukernel = (xnn_transposec_ukernel_function) xnn_x32_transpose_ukernel__4x4_aarch64_neon_tbl,
+      .tile_size = 32,
+    };
   #endif  // XNN_NO_X32_OPERATORS
 
   /**************************** XX AArch64 micro-kernels ****************************/
@@ -2699,7 +2828,16 @@ static void init(void) {
   #ifndef XNN_NO_QC8_OPERATORS
     init_flags |= XNN_INIT_FLAG_QC8;
 
-    if (cpuinfo_has_x86_avx512f() && cpuinfo_has_x86_avx512bw() && cpuinfo_has_x86_avx512dq() && cpuinfo_has_x86_avx512vl()) {
+    if (cpuinfo_has_x86_avx512f() && cpuinfo_has_x86_avx512bw() && cpuinfo_has_x86_avx512dq() && cpuinfo_has_x86_avx512vl() && cpuinfo_has_x86_avx512vnni()) {
+      xnn_params.qc8.gemm.minmax.gemm = xnn_init_hmp_gemm_ukernel((xnn_gemm_ukernel_function) xnn_qc8_gemm_minmax_fp32_ukernel_4x16c8__avx512vnni);
+      xnn_params.qc8.gemm.minmax.igemm = xnn_init_hmp_igemm_ukernel((xnn_igemm_ukernel_function) xnn_qc8_igemm_minmax_fp32_ukernel_4x16c8__avx512vnni);
+      xnn_params.qc8.gemm.minmax.gemm1 = xnn_init_hmp_gemm_ukernel((xnn_gemm_ukernel_function) xnn_qc8_gemm_minmax_fp32_ukernel_1x16c8__avx512vnni);
+      xnn_params.qc8.gemm.minmax.igemm1 = xnn_init_hmp_igemm_ukernel((xnn_igemm_ukernel_function) xnn_qc8_igemm_minmax_fp32_ukernel_1x16c8__avx512vnni);
+      xnn_params.qc8.gemm.init.qc8 = xnn_init_qs8_minmax_avx512_params;
+      xnn_params.qc8.gemm.mr = 4;
+      xnn_params.qc8.gemm.nr = 16;
+      xnn_params.qc8.gemm.log2_kr = 3;
+    } else if (cpuinfo_has_x86_avx512f() && cpuinfo_has_x86_avx512bw() && cpuinfo_has_x86_avx512dq() && cpuinfo_has_x86_avx512vl()) {
       xnn_params.qc8.gemm.minmax.gemm = xnn_init_hmp_gemm_ukernel((xnn_gemm_ukernel_function) xnn_qc8_gemm_minmax_fp32_ukernel_4x16c8__avx512skx);
       xnn_params.qc8.gemm.minmax.igemm = xnn_init_hmp_igemm_ukernel((xnn_igemm_ukernel_function) xnn_qc8_igemm_minmax_fp32_ukernel_4x16c8__avx512skx);
       xnn_params.qc8.gemm.minmax.gemm1 = xnn_init_hmp_gemm_ukernel((xnn_gemm_ukernel_function) xnn_qc8_gemm_minmax_fp32_ukernel_1x16c8__avx512skx);
@@ -2808,7 +2946,16 @@ static void init(void) {
   #ifndef XNN_NO_QS8_OPERATORS
     init_flags |= XNN_INIT_FLAG_QS8;
 
-    if (cpuinfo_has_x86_avx512f() && cpuinfo_has_x86_avx512bw() && cpuinfo_has_x86_avx512dq() && cpuinfo_has_x86_avx512vl()) {
+    if (cpuinfo_has_x86_avx512f() && cpuinfo_has_x86_avx512bw() && cpuinfo_has_x86_avx512dq() && cpuinfo_has_x86_avx512vl() && cpuinfo_has_x86_avx512vnni()) {
+      xnn_params.qs8.gemm.minmax.gemm = xnn_init_hmp_gemm_ukernel((xnn_gemm_ukernel_function) xnn_qs8_gemm_minmax_fp32_ukernel_4x16c8__avx512vnni);
+      xnn_params.qs8.gemm.minmax.igemm = xnn_init_hmp_igemm_ukernel((xnn_igemm_ukernel_function) xnn_qs8_igemm_minmax_fp32_ukernel_4x16c8__avx512vnni);
+      xnn_params.qs8.gemm.minmax.gemm1 = xnn_init_hmp_gemm_ukernel((xnn_gemm_ukernel_function) xnn_qs8_gemm_minmax_fp32_ukernel_1x16c8__avx512vnni);
+      xnn_params.qs8.gemm.minmax.igemm1 = xnn_init_hmp_igemm_ukernel((xnn_igemm_ukernel_function) xnn_qs8_igemm_minmax_fp32_ukernel_1x16c8__avx512vnni);
+      xnn_params.qs8.gemm.init.qs8 = xnn_init_qs8_conv_minmax_fp32_avx512_params;
+      xnn_params.qs8.gemm.mr = 4;
+      xnn_params.qs8.gemm.nr = 16;
+      xnn_params.qs8.gemm.log2_kr = 3;
+    } else if (cpuinfo_has_x86_avx512f() && cpuinfo_has_x86_avx512bw() && cpuinfo_has_x86_avx512dq() && cpuinfo_has_x86_avx512vl()) {
       xnn_params.qs8.gemm.minmax.gemm = xnn_init_hmp_gemm_ukernel((xnn_gemm_ukernel_function) xnn_qs8_gemm_minmax_fp32_ukernel_4x16c8__avx512skx);
       xnn_params.qs8.gemm.minmax.igemm = xnn_init_hmp_igemm_ukernel((xnn_igemm_ukernel_function) xnn_qs8_igemm_minmax_fp32_ukernel_4x16c8__avx512skx);
       xnn_params.qs8.gemm.minmax.gemm1 = xnn_init_hmp_gemm_ukernel((xnn_gemm_ukernel_function) xnn_qs8_gemm_minmax_fp32_ukernel_1x16c8__avx512skx);
@@ -3012,7 +3159,16 @@ static void init(void) {
   #ifndef XNN_NO_QU8_OPERATORS
     init_flags |= XNN_INIT_FLAG_QU8;
 
-    if (cpuinfo_has_x86_avx512f() && cpuinfo_has_x86_avx512bw() && cpuinfo_has_x86_avx512dq() && cpuinfo_has_x86_avx512vl()) {
+    if (cpuinfo_has_x86_avx512f() && cpuinfo_has_x86_avx512bw() && cpuinfo_has_x86_avx512dq() && cpuinfo_has_x86_avx512vl() && cpuinfo_has_x86_avx512vnni()) {
+      xnn_params.qu8.gemm.minmax.gemm = xnn_init_hmp_gemm_ukernel((xnn_gemm_ukernel_function) xnn_qu8_gemm_minmax_fp32_ukernel_4x16c8__avx512vnni);
+      xnn_params.qu8.gemm.minmax.igemm = xnn_init_hmp_igemm_ukernel((xnn_igemm_ukernel_function) xnn_qu8_igemm_minmax_fp32_ukernel_4x16c8__avx512vnni);
+      xnn_params.qu8.gemm.minmax.gemm1 = xnn_init_hmp_gemm_ukernel((xnn_gemm_ukernel_function) xnn_qu8_gemm_minmax_fp32_ukernel_1x16c8__avx512vnni);
+      xnn_params.qu8.gemm.minmax.igemm1 = xnn_init_hmp_igemm_ukernel((xnn_igemm_ukernel_function) xnn_qu8_igemm_minmax_fp32_ukernel_1x16c8__avx512vnni);
+      xnn_params.qu8.gemm.init.qu8 = xnn_init_qu8_conv_minmax_fp32_avx512vnni_params;
+      xnn_params.qu8.gemm.mr = 4;
+      xnn_params.qu8.gemm.nr = 16;
+      xnn_params.qu8.gemm.log2_kr = 3;
+    } else if (cpuinfo_has_x86_avx512f() && cpuinfo_has_x86_avx512bw() && cpuinfo_has_x86_avx512dq() && cpuinfo_has_x86_avx512vl()) {
       xnn_params.qu8.gemm.minmax.gemm = xnn_init_hmp_gemm_ukernel((xnn_gemm_ukernel_function) xnn_qu8_gemm_minmax_fp32_ukernel_4x16c8__avx512skx);
       xnn_params.qu8.gemm.minmax.igemm = xnn_init_hmp_igemm_ukernel((xnn_igemm_ukernel_function) xnn_qu8_igemm_minmax_fp32_ukernel_4x16c8__avx512skx);
       xnn_params.qu8.gemm.minmax.gemm1 = xnn_init_hmp_gemm_ukernel((xnn_gemm_ukernel_function) xnn_qu8_gemm_minmax_fp32_ukernel_1x16c8__avx512skx);
@@ -3241,6 +3397,11 @@ static void init(void) {
         .mr = 9,
         .qr = 8,
       };
+      xnn_params.s8.rdmax = (struct rdmax_parameters) {
+        .ukernel = (xnn_rdmax_ukernel_function) xnn_s8_rdmax_minmax_ukernel_c16__sse41,
+        .init.s8 = xnn_init_s8_minmax_sse4_params,
+        .channel_tile = 16,
+      };
     } else {
       xnn_params.s8.clamp = (struct vunary_parameters) {
         .ukernel = (xnn_univector_ukernel_function) xnn_s8_vclamp_ukernel__sse2_x64,
@@ -3258,6 +3419,11 @@ static void init(void) {
         .mr = 9,
         .qr = 8,
       };
+      xnn_params.s8.rdmax = (struct rdmax_parameters) {
+        .ukernel = (xnn_rdmax_ukernel_function) xnn_s8_rdmax_minmax_ukernel_c16__sse2,
+        .init.s8 = xnn_init_s8_minmax_sse2_params,
+        .channel_tile = 16,
+      };
     }
   #endif  // XNN_NO_S8_OPERATORS
 
@@ -3313,8 +3479,76 @@ static void init(void) {
       .x4 = (xnn_zipc_ukernel_function) xnn_x8_zip_x4_ukernel__sse2,
       .xm = (xnn_zipv_ukernel_function) xnn_x8_zip_xm_ukernel__sse2,
     };
+    xnn_params.x8.transpose = (struct transpose_parameters) {
+      .const_size_ukernel = (xnn_transposec_ukernel_function) xnn_x8_transpose_ukernel__16x16_reuse_switch_sse2,
+      .tile_size = 32,
+    };
   #endif  // XNN_NO_X8_OPERATORS
 
+  /**************************** F16 x86 micro-kernels ****************************/
+  #ifndef XNN_NO_F16_OPERATORS
+    if (!XNN_PLATFORM_MOBILE && cpuinfo_has_x86_avx2()) {
+      init_flags |= XNN_INIT_FLAG_F16;
+
+      xnn_params.f16.gemm.minmax.gemm = xnn_init_hmp_gemm_ukernel((xnn_gemm_ukernel_function) xnn_f16_gemm_minmax_ukernel_4x16__avx2_broadcast);
+      xnn_params.f16.gemm.minmax.igemm = xnn_init_hmp_igemm_ukernel((xnn_igemm_ukernel_function) xnn_f16_igemm_minmax_ukernel_4x16__avx2_broadcast);
+      xnn_params.f16.gemm.minmax.gemm1 = xnn_init_hmp_gemm_ukernel((xnn_gemm_ukernel_function) xnn_f16_gemm_minmax_ukernel_1x16__avx2_broadcast);
+      xnn_params.f16.gemm.minmax.igemm1 = xnn_init_hmp_igemm_ukernel((xnn_igemm_ukernel_function) xnn_f16_igemm_minmax_ukernel_1x16__avx2_broadcast);
+      xnn_params.f16.gemm.init.f16 = xnn_init_f16_scaleminmax_avx_params;
+      xnn_params.f16.gemm.mr = 4;
+      xnn_params.f16.gemm.nr = 16;
+
+      xnn_params.f16.dwconv[0].minmax.unipass = (xnn_dwconv_unipass_ukernel_function) xnn_f16_dwconv_minmax_ukernel_up16x4__fma3;
+      xnn_params.f16.dwconv[0].init.f16 = xnn_init_f16_minmax_avx_params;
+      xnn_params.f16.dwconv[0].channel_tile = 16;
+      xnn_params.f16.dwconv[0].primary_tile = 4;
+
+      xnn_params.f16.dwconv[1].minmax.unipass = (xnn_dwconv_unipass_ukernel_function) xnn_f16_dwconv_minmax_ukernel_up16x9__fma3;
+      xnn_params.f16.dwconv[1].init.f16 = xnn_init_f16_minmax_avx_params;
+      xnn_params.f16.dwconv[1].channel_tile = 16;
+      xnn_params.f16.dwconv[1].primary_tile = 9;
+
+      xnn_params.f16.dwconv[2].minmax.unipass = (xnn_dwconv_unipass_ukernel_function) xnn_f16_dwconv_minmax_ukernel_up8x25__fma3_acc2;
+      xnn_params.f16.dwconv[2].init.f16 = xnn_init_f16_minmax_avx_params;
+      xnn_params.f16.dwconv[2].channel_tile = 8;
+      xnn_params.f16.dwconv[2].primary_tile = 25;
+
+      xnn_params.f16.gavgpool = (struct gavgpool_parameters) {
+        .unipass = (xnn_gavgpool_unipass_ukernel_function) xnn_f16_gavgpool_minmax_ukernel_7x__f16c_c8,
+        .multipass = (xnn_gavgpool_multipass_ukernel_function) xnn_f16_gavgpool_minmax_ukernel_7p7x__f16c_c8,
+        .init.f16 = xnn_init_f16_scaleminmax_avx_params,
+        .update.f16 = xnn_update_f16_scaleminmax_avx_params,
+        .row_tile = 7,
+        .channel_tile = 8,
+      };
+      xnn_params.f16.vadd = (struct vbinary_parameters) {
+        .minmax.op_ukernel = (xnn_vbinary_ukernel_function) xnn_f16_vadd_minmax_ukernel__f16c_x16,
+        .minmax.opc_ukernel = (xnn_vbinary_ukernel_function) xnn_f16_vaddc_minmax_ukernel__f16c_x16,
+        .minmax.ropc_ukernel = (xnn_vbinary_ukernel_function) xnn_f16_vaddc_minmax_ukernel__f16c_x16,
+        .init.f16_minmax = xnn_init_f16_minmax_avx_params,
+        .element_tile = 16,
+      };
+      xnn_params.f16.vmul = (struct vbinary_parameters) {
+        .minmax.op_ukernel = (xnn_vbinary_ukernel_function) xnn_f16_vmul_minmax_ukernel__f16c_x16,
+        .minmax.opc_ukernel = (xnn_vbinary_ukernel_function) xnn_f16_vmulc_minmax_ukernel__f16c_x16,
+        .minmax.ropc_ukernel = (xnn_vbinary_ukernel_function) xnn_f16_vmulc_minmax_ukernel__f16c_x16,
+        .init.f16_minmax = xnn_init_f16_minmax_avx_params,
+        .element_tile = 16,
+      };
+      xnn_params.f16.vmulcaddc = (struct vmulcaddc_parameters) {
+        .ukernel = (xnn_vmulcaddc_ukernel_function) xnn_f16_vmulcaddc_minmax_ukernel_c8__fma3_2x,
+        .init.f16 = xnn_init_f16_minmax_avx_params,
+        .channel_tile = 8,
+        .row_tile = 2,
+      };
+      xnn_params.f16.hswish = (struct vunary_parameters) {
+        .ukernel = (xnn_univector_ukernel_function) xnn_f16_vhswish_ukernel__f16c_x16,
+        .init.f16_hswish = xnn_init_f16_hswish_avx_params,
+        .element_tile = 16,
+      };
+    }
+  #endif  // XNN_NO_F16_OPERATORS
+
   /**************************** F32 x86 micro-kernels ****************************/
   #ifndef XNN_NO_F32_OPERATORS
     init_flags |= XNN_INIT_FLAG_F32;
@@ -3771,6 +4005,50 @@ static void init(void) {
         .element_tile = 4,
       };
     }
+    if (!XNN_PLATFORM_MOBILE && cpuinfo_has_x86_avx512f()) {
+      xnn_params.f32.gelu = (struct vunary_parameters) {
+        .ukernel = (xnn_univector_ukernel_function) xnn_f32_vgelu_ukernel__avx512f_rational_13_8_div_x64,
+        .init.f32_gelu = xnn_init_f32_gelu_avx512_rational_13_8_params,
+        .element_tile = 64,
+      };
+    } else if (cpuinfo_has_x86_avx2()) {
+      xnn_params.f32.gelu = (struct vunary_parameters) {
+        .ukernel = (xnn_univector_ukernel_function) xnn_f32_vgelu_ukernel__avx2_rational_13_8_div_x32,
+        .init.f32_gelu = xnn_init_f32_gelu_avx_rational_13_8_params,
+        .element_tile = 32,
+      };
+    } else {
+      xnn_params.f32.gelu = (struct vunary_parameters) {
+        .ukernel = (xnn_univector_ukernel_function) xnn_f32_vgelu_ukernel__sse2_rational_13_8_div_x8,
+        .init.f32_gelu = xnn_init_f32_gelu_sse_rational_13_8_params,
+        .element_tile = 8,
+      };
+    }
+    if (!XNN_PLATFORM_MOBILE && cpuinfo_has_x86_avx512f()) {
+      xnn_params.f32.tanh = (struct vunary_parameters) {
+        .ukernel = (xnn_univector_ukernel_function) xnn_f32_vtanh_ukernel__avx512f_expm1minus_rr1_p6_div_x64,
+        .init.f32_tanh = xnn_init_f32_tanh_avx512_expm1minus_rr1_p6_params,
+        .element_tile = 64,
+      };
+    } else if (cpuinfo_has_x86_avx2()) {
+      xnn_params.f32.tanh = (struct vunary_parameters) {
+        .ukernel = (xnn_univector_ukernel_function) xnn_f32_vtanh_ukernel__avx2_expm1minus_rr1_p6_div_x32,
+        .init.f32_tanh = xnn_init_f32_tanh_avx2_expm1minus_rr1_p6_params,
+        .element_tile = 32,
+      };
+    } else if (cpuinfo_has_x86_avx()) {
+      xnn_params.f32.tanh = (struct vunary_parameters) {
+        .ukernel = (xnn_univector_ukernel_function) xnn_f32_vtanh_ukernel__avx_expm1minus_rr2_p6_div_x32,
+        .init.f32_tanh = xnn_init_f32_tanh_avx_expm1minus_rr2_p6_params,
+        .element_tile = 32,
+      };
+    } else {
+      xnn_params.f32.tanh = (struct vunary_parameters) {
+        .ukernel = (xnn_univector_ukernel_function) xnn_f32_vtanh_ukernel__sse2_expm1minus_rr2_p6_div_x8,
+        .init.f32_tanh = xnn_init_f32_tanh_sse_expm1minus_rr2_p6_params,
+        .element_tile = 8,
+      };
+    }
     if (!XNN_PLATFORM_MOBILE && cpuinfo_has_x86_avx512f()) {
       xnn_params.f32.prelu = (struct prelu_parameters) {
         .ukernel = (xnn_prelu_ukernel_function) xnn_f32_prelu_ukernel__avx512f_2x16,
@@ -3802,6 +4080,30 @@ static void init(void) {
       .element_tile = 20,
     };
     xnn_params.f32.rmax = xnn_f32_rmax_ukernel__sse;
+    xnn_params.f32.rdmax = (struct rdmax_parameters) {
+      .ukernel = (xnn_rdmax_ukernel_function) xnn_f32_rdmax_ukernel_c16__sse,
+      .channel_tile = 16,
+    };
+    if (!XNN_PLATFORM_MOBILE && cpuinfo_has_x86_avx512f()) {
+      xnn_params.f32.layer_norm = (struct layer_norm_parameters) {
+        .rmeanvar = xnn_f32_rmeanvar_ukernel__avx512f,
+        .vnormcaddc = xnn_f32_vnormcaddc_ukernel_c32__avx512f,
+        .channel_tile = 32,
+      };
+    } else if (cpuinfo_has_x86_avx()) {
+      xnn_params.f32.layer_norm = (struct layer_norm_parameters) {
+        .rmeanvar = xnn_f32_rmeanvar_ukernel__avx,
+        .vnormcaddc = xnn_f32_vnormcaddc_ukernel_c16__avx,
+        .init = xnn_init_f32_default_avx_params,
+        .channel_tile = 16,
+      };
+    } else {
+      xnn_params.f32.layer_norm = (struct layer_norm_parameters) {
+        .rmeanvar = xnn_f32_rmeanvar_ukernel__sse,
+        .vnormcaddc = xnn_f32_vnormcaddc_ukernel_c8__sse,
+        .channel_tile = 8,
+      };
+    }
     if (!XNN_PLATFORM_MOBILE && cpuinfo_has_x86_avx512f()) {
       xnn_params.f32.vadd = (struct vbinary_parameters) {
         .minmax.op_ukernel = (xnn_vbinary_ukernel_function) xnn_f32_vadd_minmax_ukernel__avx512f_x32,
@@ -3953,18 +4255,109 @@ static void init(void) {
       .channel_tile = 4,
       .row_tile = 2,
     };
+    if (!XNN_PLATFORM_MOBILE && cpuinfo_has_x86_avx512f()) {
+      xnn_params.f32.conv_hwc_3x3c3s2 = (struct conv_hwc_parameters) {
+        .ukernel_with_symm_padding =
+          (xnn_conv_hwc_ukernel_function) xnn_f32_conv_hwc_ukernel_3x3s2p1c3x32__avx512f_2x2,
+        .ukernel_with_asymm_padding =
+          (xnn_conv_hwc_ukernel_function) xnn_f32_conv_hwc_ukernel_3x3s2p0p1c3x32__avx512f_2x2,
+        .init.f32 = xnn_init_f32_minmax_scalar_params,
+        .output_channel_tile = 32,
+        .output_height_tile = 2,
+      };
+    } else if (cpuinfo_has_x86_fma3()) {
+      xnn_params.f32.conv_hwc_3x3c3s2 = (struct conv_hwc_parameters) {
+        .ukernel_with_symm_padding =
+          (xnn_conv_hwc_ukernel_function) xnn_f32_conv_hwc_ukernel_3x3s2p1c3x16__fma3_2x2,
+        .ukernel_with_asymm_padding =
+          (xnn_conv_hwc_ukernel_function) xnn_f32_conv_hwc_ukernel_3x3s2p0p1c3x16__fma3_2x2,
+        .init.f32 = xnn_init_f32_minmax_avx_params,
+        .output_channel_tile = 16,
+        .output_height_tile = 2,
+      };
+    } else if (cpuinfo_has_x86_avx()) {
+      xnn_params.f32.conv_hwc_3x3c3s2 = (struct conv_hwc_parameters) {
+        .ukernel_with_symm_padding =
+          (xnn_conv_hwc_ukernel_function) xnn_f32_conv_hwc_ukernel_3x3s2p1c3x16__avx_1x1,
+        .ukernel_with_asymm_padding =
+          (xnn_conv_hwc_ukernel_function) xnn_f32_conv_hwc_ukernel_3x3s2p0p1c3x16__avx_1x1,
+        .init.f32 = xnn_init_f32_minmax_avx_params,
+        .output_channel_tile = 16,
+        .output_height_tile = 1,
+      };
+    } else {
+      xnn_params.f32.conv_hwc_3x3c3s2 = (struct conv_hwc_parameters) {
+        .ukernel_with_symm_padding =
+          (xnn_conv_hwc_ukernel_function) xnn_f32_conv_hwc_ukernel_3x3s2p1c3x8__sse_2x1,
+        .ukernel_with_asymm_padding =
+          (xnn_conv_hwc_ukernel_function) xnn_f32_conv_hwc_ukernel_3x3s2p0p1c3x8__sse_2x1,
+        .init.f32 = xnn_init_f32_minmax_sse_params,
+        .output_channel_tile = 8,
+        .output_height_tile = 2,
+      };
+    }
     #ifndef XNN_NO_NCHW_OPERATORS
-      // Sparse microkernels on x86 currently target only SSE, and on processors
-      // with AVX ISA dense inference is expected to be faster than sparse.
-      if (!cpuinfo_has_x86_avx()) {
+      // On processors with AVX ISA dense inference is expected to be faster than sparse, unless AVX512F SpMM
+      // microkernels are available.
+      if (!cpuinfo_has_x86_avx() || cpuinfo_has_x86_avx512f()) {
         init_flags |= XNN_INIT_FLAG_CHW_OPT;
       }
 
-      xnn_params.f32.spmm = (struct spmm_parameters) {
-        .ukernel = (xnn_spmm_ukernel_function) xnn_f32_spmm_minmax_ukernel_32x1__sse,
-        .mr = 32,
-        .nr = 1,
-      };
+      if (cpuinfo_has_x86_avx512f()) {
+        xnn_params.f32.spmm = (struct spmm_parameters) {
+          .ukernel = (xnn_spmm_ukernel_function) xnn_f32_spmm_minmax_ukernel_32x1__avx512f,
+          .mr = 32,
+          .nr = 1,
+        };
+        xnn_params.f32.spmm2 = (struct spmm_parameters) {
+          .ukernel = (xnn_spmm_ukernel_function) xnn_f32_spmm_minmax_ukernel_32x2__avx512f,
+          .mr = 32,
+          .nr = 2,
+        };
+        xnn_params.f32.spmm4 = (struct spmm_parameters) {
+          .ukernel = (xnn_spmm_ukernel_function) xnn_f32_spmm_minmax_ukernel_32x4__avx512f,
+          .mr = 32,
+          .nr = 4,
+        };
+      } else if (cpuinfo_has_x86_fma3()) {
+        xnn_params.f32.spmm = (struct spmm_parameters) {
+          .ukernel = (xnn_spmm_ukernel_function) xnn_f32_spmm_minmax_ukernel_32x1__fma3,
+          .mr = 32,
+          .nr = 1,
+        };
+        xnn_params.f32.spmm2 = (struct spmm_parameters) {
+          .ukernel = (xnn_spmm_ukernel_function) xnn_f32_spmm_minmax_ukernel_32x2__fma3,
+          .mr = 32,
+          .nr = 2,
+        };
+        xnn_params.f32.spmm4 = (struct spmm_parameters) {
+          .ukernel = (xnn_spmm_ukernel_function) xnn_f32_spmm_minmax_ukernel_16x4__fma3,
+          .mr = 16,
+          .nr = 4,
+        };
+      } else if (cpuinfo_has_x86_avx()) {
+        xnn_params.f32.spmm = (struct spmm_parameters) {
+          .ukernel = (xnn_spmm_ukernel_function) xnn_f32_spmm_minmax_ukernel_32x1__avx,
+          .mr = 32,
+          .nr = 1,
+        };
+        xnn_params.f32.spmm2 = (struct spmm_parameters) {
+          .ukernel = (xnn_spmm_ukernel_function) xnn_f32_spmm_minmax_ukernel_32x2__avx,
+          .mr = 32,
+          .nr = 2,
+        };
+        xnn_params.f32.spmm4 = (struct spmm_parameters) {
+          .ukernel = (xnn_spmm_ukernel_function) xnn_f32_spmm_minmax_ukernel_16x4__avx,
+          .mr = 16,
+          .nr = 4,
+        };
+      } else {
+        xnn_params.f32.spmm = (struct spmm_parameters) {
+          .ukernel = (xnn_spmm_ukernel_function) xnn_f32_spmm_minmax_ukernel_32x1__sse,
+          .mr = 32,
+          .nr = 1,
+        };
+      }
       xnn_params.f32.conv_hwc2chw_3x3c3s2 = (struct conv_hwc2chw_parameters) {
         .ukernel_with_symm_padding =
           (xnn_conv_hwc2chw_ukernel_function) xnn_f32_conv_hwc2chw_ukernel_3x3s2p1c3x4__sse_2x2,
@@ -3972,34 +4365,78 @@ static void init(void) {
         .output_height_tile = 2,
         .output_width_tile = 2,
       };
-      if (cpuinfo_has_x86_ssse3()) {
+      if (cpuinfo_has_x86_avx512f()) {
         xnn_params.f32.dwconv2d_chw_3x3 = (struct dwconv2d_chw_parameters) {
-          .ukernel = (xnn_dwconv2d_chw_ukernel_function) xnn_f32_dwconv2d_chw_ukernel_3x3p1__ssse3_2x4_acc2,
-          .output_width_tile = 4,
+          .ukernel = (xnn_dwconv2d_chw_ukernel_function) xnn_f32_dwconv2d_chw_ukernel_3x3p1__avx512f_4x16,
+          .output_width_tile = 16,
+          .output_height_tile = 4,
+        };
+        xnn_params.f32.dwconv2d_chw_3x3s2 = (struct dwconv2d_chw_parameters) {
+          .ukernel = (xnn_dwconv2d_chw_ukernel_function) xnn_f32_dwconv2d_chw_ukernel_3x3s2p1__avx512f_2x16_acc2,
+          .output_width_tile = 16,
           .output_height_tile = 2,
         };
-      } else {
+        xnn_params.f32.dwconv2d_chw_5x5 = (struct dwconv2d_chw_parameters) {
+          .ukernel = (xnn_dwconv2d_chw_ukernel_function) xnn_f32_dwconv2d_chw_ukernel_5x5p2__avx512f_4x16,
+          .output_width_tile = 16,
+          .output_height_tile = 4,
+        };
+        xnn_params.f32.dwconv2d_chw_5x5s2 = (struct dwconv2d_chw_parameters) {
+          .ukernel = (xnn_dwconv2d_chw_ukernel_function) xnn_f32_dwconv2d_chw_ukernel_5x5s2p2__avx512f_2x16_acc2,
+          .output_width_tile = 16,
+          .output_height_tile = 2,
+        };
+      } else if (cpuinfo_has_x86_avx()) {
         xnn_params.f32.dwconv2d_chw_3x3 = (struct dwconv2d_chw_parameters) {
-          .ukernel = (xnn_dwconv2d_chw_ukernel_function) xnn_f32_dwconv2d_chw_ukernel_3x3p1__sse_2x4_acc2,
+          .ukernel = (xnn_dwconv2d_chw_ukernel_function) xnn_f32_dwconv2d_chw_ukernel_3x3p1__avx_4x8,
+          .output_width_tile = 8,
+          .output_height_tile = 4,
+        };
+        xnn_params.f32.dwconv2d_chw_3x3s2 = (struct dwconv2d_chw_parameters) {
+          .ukernel = (xnn_dwconv2d_chw_ukernel_function) xnn_f32_dwconv2d_chw_ukernel_3x3s2p1__avx_2x8_acc2,
+          .output_width_tile = 8,
+          .output_height_tile = 2,
+        };
+        xnn_params.f32.dwconv2d_chw_5x5 = (struct dwconv2d_chw_parameters) {
+          .ukernel = (xnn_dwconv2d_chw_ukernel_function) xnn_f32_dwconv2d_chw_ukernel_5x5p2__avx_2x8,
+          .output_width_tile = 8,
+          .output_height_tile = 2,
+        };
+        xnn_params.f32.dwconv2d_chw_5x5s2 = (struct dwconv2d_chw_parameters) {
+          .ukernel = (xnn_dwconv2d_chw_ukernel_function) xnn_f32_dwconv2d_chw_ukernel_5x5s2p2__avx_1x8_acc3,
+          .output_width_tile = 8,
+          .output_height_tile = 1,
+        };
+      } else {
+        if (cpuinfo_has_x86_ssse3()) {
+          xnn_params.f32.dwconv2d_chw_3x3 = (struct dwconv2d_chw_parameters) {
+            .ukernel = (xnn_dwconv2d_chw_ukernel_function) xnn_f32_dwconv2d_chw_ukernel_3x3p1__ssse3_2x4_acc2,
+            .output_width_tile = 4,
+            .output_height_tile = 2,
+          };
+        } else {
+          xnn_params.f32.dwconv2d_chw_3x3 = (struct dwconv2d_chw_parameters) {
+            .ukernel = (xnn_dwconv2d_chw_ukernel_function) xnn_f32_dwconv2d_chw_ukernel_3x3p1__sse_2x4_acc2,
+            .output_width_tile = 4,
+            .output_height_tile = 2,
+          };
+        }
+        xnn_params.f32.dwconv2d_chw_3x3s2 = (struct dwconv2d_chw_parameters) {
+          .ukernel = (xnn_dwconv2d_chw_ukernel_function) xnn_f32_dwconv2d_chw_ukernel_3x3s2p1__sse_1x4_acc3,
+          .output_width_tile = 4,
+          .output_height_tile = 1,
+        };
+        xnn_params.f32.dwconv2d_chw_5x5 = (struct dwconv2d_chw_parameters) {
+          .ukernel = (xnn_dwconv2d_chw_ukernel_function) xnn_f32_dwconv2d_chw_ukernel_5x5p2__sse_4x4,
+          .output_width_tile = 4,
+          .output_height_tile = 4,
+        };
+        xnn_params.f32.dwconv2d_chw_5x5s2 = (struct dwconv2d_chw_parameters) {
+          .ukernel = (xnn_dwconv2d_chw_ukernel_function) xnn_f32_dwconv2d_chw_ukernel_5x5s2p2__sse_2x4,
           .output_width_tile = 4,
           .output_height_tile = 2,
         };
       }
-      xnn_params.f32.dwconv2d_chw_3x3s2 = (struct dwconv2d_chw_parameters) {
-        .ukernel = (xnn_dwconv2d_chw_ukernel_function) xnn_f32_dwconv2d_chw_ukernel_3x3s2p1__sse_1x4_acc3,
-        .output_width_tile = 4,
-        .output_height_tile = 1,
-      };
-      xnn_params.f32.dwconv2d_chw_5x5 = (struct dwconv2d_chw_parameters) {
-        .ukernel = (xnn_dwconv2d_chw_ukernel_function) xnn_f32_dwconv2d_chw_ukernel_5x5p2__sse_4x4,
-        .output_width_tile = 4,
-        .output_height_tile = 4,
-      };
-      xnn_params.f32.dwconv2d_chw_5x5s2 = (struct dwconv2d_chw_parameters) {
-        .ukernel = (xnn_dwconv2d_chw_ukernel_function) xnn_f32_dwconv2d_chw_ukernel_5x5s2p2__sse_2x4,
-        .output_width_tile = 4,
-        .output_height_tile = 2,
-      };
       xnn_params.f32.gavgpool_cw = (struct gavgpool_cw_parameters) {
         .ukernel = (xnn_gavgpool_cw_ukernel_function) xnn_f32_gavgpool_cw_ukernel__sse_x4,
         .channel_tile = 4,
@@ -4183,6 +4620,16 @@ static void init(void) {
     }
   #endif  // XNN_NO_VCVT_OPERATORS
 
+  /**************************** X16 x86 micro-kernels ****************************/
+  #ifndef XNN_NO_X16_OPERATORS
+    init_flags |= XNN_INIT_FLAG_X16;
+
+    xnn_params.x16.transpose = (struct transpose_parameters) {
+      .const_size_ukernel = (xnn_transposec_ukernel_function) xnn_x16_transpose_ukernel__8x8_reuse_switch_sse2,
+      .tile_size = 32,
+    };
+  #endif  // XNN_NO_X16_OPERATORS
+
   /**************************** X32 x86 micro-kernels ****************************/
   #ifndef XNN_NO_X32_OPERATORS
     init_flags |= XNN_INIT_FLAG_X32;
@@ -4201,6 +4648,10 @@ static void init(void) {
         .pixel_tile = 1,
       };
     #endif  // XNN_NO_NCHW_OPERATORS
+    xnn_params.x32.transpose = (struct transpose_parameters) {
+      .const_size_ukernel = (xnn_transposec_ukernel_function) xnn_x32_transpose_ukernel__4x4_sse,
+      .tile_size = 32,
+    };
   #endif  // XNN_NO_X32_OPERATORS
 
   /**************************** XX x86 micro-kernels ****************************/
@@ -4408,6 +4859,11 @@ static void init(void) {
       .mr = 9,
       .qr = 8,
     };
+    xnn_params.s8.rdmax = (struct rdmax_parameters) {
+      .ukernel = (xnn_rdmax_ukernel_function) xnn_s8_rdmax_minmax_ukernel_c4__scalar,
+      .init.s8 = xnn_init_s8_minmax_scalar_params,
+      .channel_tile = 4,
+    };
   #endif  // XNN_NO_S8_OPERATORS
 
   /**************************** U8 WAsm SIMD micro-kernels****************************/
@@ -4453,6 +4909,10 @@ static void init(void) {
       .x4 = (xnn_zipc_ukernel_function) xnn_x8_zip_x4_ukernel__scalar,
       .xm = (xnn_zipv_ukernel_function) xnn_x8_zip_xm_ukernel__scalar,
     };
+    xnn_params.x8.transpose = (struct transpose_parameters) {
+      .const_size_ukernel = (xnn_transposec_ukernel_function) xnn_x8_transpose_ukernel__2x4_scalar_int,
+      .tile_size = 32,
+    };
   #endif  // XNN_NO_X8_OPERATORS
 
   /**************************** F32 WAsm SIMD micro-kernels****************************/
@@ -4752,6 +5212,16 @@ static void init(void) {
       .ukernel = (xnn_univector_ukernel_function) xnn_f32_vsqrt_ukernel__wasmsimd_sqrt_x8,
       .element_tile = 8,
     };
+    xnn_params.f32.gelu = (struct vunary_parameters) {
+      .ukernel = (xnn_univector_ukernel_function) xnn_f32_vgelu_ukernel__scalar_rational_13_8_div_x2,
+      .init.f32_gelu = xnn_init_f32_gelu_scalar_rational_13_8_params,
+      .element_tile = 2,
+    };
+    xnn_params.f32.tanh = (struct vunary_parameters) {
+      .ukernel = (xnn_univector_ukernel_function) xnn_f32_vtanh_ukernel__scalar_expm1minus_rr2_p6_div_x2,
+      .init.f32_tanh = xnn_init_f32_tanh_scalar_expm1minus_rr2_p6_params,
+      .element_tile = 2,
+    };
     if (is_wasm_x86) {
       xnn_params.f32.prelu = (struct prelu_parameters) {
         .ukernel = (xnn_prelu_ukernel_function) xnn_f32_prelu_ukernel__wasmsimd_minmax_2x8,
@@ -4770,6 +5240,15 @@ static void init(void) {
       .init = xnn_init_f32_expminus_wasmsimd_rr2_p5_params,
       .element_tile = 16,
     };
+    xnn_params.f32.layer_norm = (struct layer_norm_parameters) {
+      .rmeanvar = xnn_f32_rmeanvar_ukernel__scalar,
+      .vnormcaddc = xnn_f32_vnormcaddc_ukernel_c4__scalar,
+      .channel_tile = 4,
+    };
+    xnn_params.f32.rdmax = (struct rdmax_parameters) {
+      .ukernel = (xnn_rdmax_ukernel_function) xnn_f32_rdmax_ukernel_c4__scalar,
+      .channel_tile = 4,
+    };
     if (is_wasm_x86) {
       xnn_params.f32.rmax = xnn_f32_rmax_ukernel__wasmsimd_x86;
       xnn_params.f32.vadd = (struct vbinary_parameters) {
@@ -5021,6 +5500,16 @@ static void init(void) {
     };
   #endif  // XNN_NO_VCVT_OPERATORS
 
+  /**************************** X16 WAsm SIMD micro-kernels****************************/
+  #ifndef XNN_NO_X16_OPERATORS
+    init_flags |= XNN_INIT_FLAG_X16;
+
+    xnn_params.x16.transpose = (struct transpose_parameters) {
+      .const_size_ukernel = (xnn_transposec_ukernel_function) xnn_x16_transpose_ukernel__2x4_scalar_int,
+      .tile_size = 32,
+    };
+  #endif  // XNN_NO_X16_OPERATORS
+
   /**************************** X32 WAsm SIMD micro-kernels****************************/
   #ifndef XNN_NO_X32_OPERATORS
     init_flags |= XNN_INIT_FLAG_X32;
@@ -5039,6 +5528,10 @@ static void init(void) {
         .pixel_tile = 1,
       };
     #endif  // XNN_NO_NCHW_OPERATORS
+    xnn_params.x32.transpose = (struct transpose_parameters) {
+      .const_size_ukernel = (xnn_transposec_ukernel_function) xnn_x32_transpose_ukernel__4x4_wasmsimd,
+      .tile_size = 32,
+    };
   #endif  // XNN_NO_X32_OPERATORS
 
   /**************************** XX WAsm SIMD micro-kernels****************************/
@@ -5263,6 +5756,11 @@ static void init(void) {
       .mr = 9,
       .qr = 8,
     };
+    xnn_params.s8.rdmax = (struct rdmax_parameters) {
+      .ukernel = (xnn_rdmax_ukernel_function) xnn_s8_rdmax_minmax_ukernel_c4__scalar,
+      .init.s8 = xnn_init_s8_minmax_scalar_params,
+      .channel_tile = 4,
+    };
   #endif  // XNN_NO_S8_OPERATORS
 
   /**************************** U8 WAsm micro-kernels****************************/
@@ -5300,6 +5798,10 @@ static void init(void) {
       .x4 = (xnn_zipc_ukernel_function) xnn_x8_zip_x4_ukernel__scalar,
       .xm = (xnn_zipv_ukernel_function) xnn_x8_zip_xm_ukernel__scalar,
     };
+    xnn_params.x8.transpose = (struct transpose_parameters) {
+      .const_size_ukernel = (xnn_transposec_ukernel_function) xnn_x8_transpose_ukernel__2x4_scalar_int,
+      .tile_size = 32,
+    };
   #endif  // XNN_NO_X8_OPERATORS
 
   /**************************** F32 WAsm micro-kernels****************************/
@@ -5496,6 +5998,16 @@ static void init(void) {
       .ukernel = (xnn_univector_ukernel_function) xnn_f32_vsqrt_ukernel__scalar_sqrt_x1,
       .element_tile = 1,
     };
+    xnn_params.f32.gelu = (struct vunary_parameters) {
+      .ukernel = (xnn_univector_ukernel_function) xnn_f32_vgelu_ukernel__scalar_rational_13_8_div_x2,
+      .init.f32_gelu = xnn_init_f32_gelu_scalar_rational_13_8_params,
+      .element_tile = 2,
+    };
+    xnn_params.f32.tanh = (struct vunary_parameters) {
+      .ukernel = (xnn_univector_ukernel_function) xnn_f32_vtanh_ukernel__scalar_expm1minus_rr2_p6_div_x2,
+      .init.f32_tanh = xnn_init_f32_tanh_scalar_expm1minus_rr2_p6_params,
+      .element_tile = 2,
+    };
     if (is_wasm_x86) {
       xnn_params.f32.prelu = (struct prelu_parameters) {
         .ukernel = (xnn_prelu_ukernel_function) xnn_f32_prelu_ukernel__scalar_2x4,
@@ -5515,6 +6027,15 @@ static void init(void) {
       .element_tile = 4,
     };
     xnn_params.f32.rmax = xnn_f32_rmax_ukernel__scalar;
+    xnn_params.f32.rdmax = (struct rdmax_parameters) {
+      .ukernel = (xnn_rdmax_ukernel_function) xnn_f32_rdmax_ukernel_c4__scalar,
+      .channel_tile = 4,
+    };
+    xnn_params.f32.layer_norm = (struct layer_norm_parameters) {
+      .rmeanvar = xnn_f32_rmeanvar_ukernel__scalar,
+      .vnormcaddc = xnn_f32_vnormcaddc_ukernel_c4__scalar,
+      .channel_tile = 4,
+    };
     xnn_params.f32.vadd = (struct vbinary_parameters) {
       .minmax.op_ukernel = (xnn_vbinary_ukernel_function) xnn_f32_vadd_minmax_ukernel__wasm_x8,
       .minmax.opc_ukernel = (xnn_vbinary_ukernel_function) xnn_f32_vaddc_minmax_ukernel__wasm_x8,
@@ -5673,6 +6194,16 @@ static void init(void) {
     };
   #endif  // XNN_NO_VCVT_OPERATORS
 
+  /**************************** X16 WAsm micro-kernels****************************/
+  #ifndef XNN_NO_X16_OPERATORS
+    init_flags |= XNN_INIT_FLAG_X16;
+
+    xnn_params.x16.transpose = (struct transpose_parameters) {
+      .const_size_ukernel = (xnn_transposec_ukernel_function) xnn_x16_transpose_ukernel__2x4_scalar_int,
+      .tile_size = 32,
+    };
+  #endif  // XNN_NO_X16_OPERATORS
+
   /**************************** X32 WAsm micro-kernels****************************/
   #ifndef XNN_NO_X32_OPERATORS
     init_flags |= XNN_INIT_FLAG_X32;
@@ -5691,6 +6222,10 @@ static void init(void) {
         .pixel_tile = 1,
       };
     #endif  // XNN_NO_NCHW_OPERATORS
+    xnn_params.x32.transpose = (struct transpose_parameters) {
+      .const_size_ukernel = (xnn_transposec_ukernel_function) xnn_x32_transpose_ukernel__2x4_scalar_int,
+      .tile_size = 32,
+    };
   #endif  // XNN_NO_X32_OPERATORS
 
   /**************************** XX WAsm micro-kernels****************************/
@@ -5852,6 +6387,11 @@ static void init(void) {
       .mr = 9,
       .qr = 8,
     };
+    xnn_params.s8.rdmax = (struct rdmax_parameters) {
+      .ukernel = (xnn_rdmax_ukernel_function) xnn_s8_rdmax_minmax_ukernel_c4__scalar,
+      .init.s8 = xnn_init_s8_minmax_scalar_params,
+      .channel_tile = 4,
+    };
   #endif  // XNN_NO_S8_OPERATORS
 
   /************************** U8 RISC-V micro-kernels ***************************/
@@ -5889,6 +6429,10 @@ static void init(void) {
       .x4 = (xnn_zipc_ukernel_function) xnn_x8_zip_x4_ukernel__scalar,
       .xm = (xnn_zipv_ukernel_function) xnn_x8_zip_xm_ukernel__scalar,
     };
+    xnn_params.x8.transpose = (struct transpose_parameters) {
+      .const_size_ukernel = (xnn_transposec_ukernel_function) xnn_x8_transpose_ukernel__2x4_scalar_int,
+      .tile_size = 32,
+    };
   #endif  // XNN_NO_X8_OPERATORS
 
   /************************** F32 RISC-V micro-kernels **************************/
@@ -6047,6 +6591,16 @@ static void init(void) {
       .ukernel = (xnn_univector_ukernel_function) xnn_f32_vsqrt_ukernel__scalar_sqrt_x1,
       .element_tile = 1,
     };
+    xnn_params.f32.gelu = (struct vunary_parameters) {
+      .ukernel = (xnn_univector_ukernel_function) xnn_f32_vgelu_ukernel__scalar_rational_13_8_div_x2,
+      .init.f32_gelu = xnn_init_f32_gelu_scalar_rational_13_8_params,
+      .element_tile = 2,
+    };
+    xnn_params.f32.tanh = (struct vunary_parameters) {
+      .ukernel = (xnn_univector_ukernel_function) xnn_f32_vtanh_ukernel__scalar_expm1minus_rr2_p6_div_x2,
+      .init.f32_tanh = xnn_init_f32_tanh_scalar_expm1minus_rr2_p6_params,
+      .element_tile = 2,
+    };
     xnn_params.f32.prelu = (struct prelu_parameters) {
       .ukernel = (xnn_prelu_ukernel_function) xnn_f32_prelu_ukernel__scalar_2x4,
       .row_tile = 4,
@@ -6058,6 +6612,15 @@ static void init(void) {
       .element_tile = 4,
     };
     xnn_params.f32.rmax = xnn_f32_rmax_ukernel__scalar;
+    xnn_params.f32.rdmax = (struct rdmax_parameters) {
+      .ukernel = (xnn_rdmax_ukernel_function) xnn_f32_rdmax_ukernel_c4__scalar,
+      .channel_tile = 4,
+    };
+    xnn_params.f32.layer_norm = (struct layer_norm_parameters) {
+      .rmeanvar = xnn_f32_rmeanvar_ukernel__scalar,
+      .vnormcaddc = xnn_f32_vnormcaddc_ukernel_c4__scalar,
+      .channel_tile = 4,
+    };
     xnn_params.f32.vadd = (struct vbinary_parameters) {
       .minmax.op_ukernel = (xnn_vbinary_ukernel_function) xnn_f32_vadd_minmax_ukernel__scalar_x8,
       .minmax.opc_ukernel = (xnn_vbinary_ukernel_function) xnn_f32_vaddc_minmax_ukernel__scalar_x8,
@@ -6203,6 +6766,16 @@ static void init(void) {
     };
   #endif  // XNN_NO_VCVT_OPERATORS
 
+  /************************** X16 RISC-V micro-kernels **************************/
+  #ifndef XNN_NO_X16_OPERATORS
+    init_flags |= XNN_INIT_FLAG_X16;
+
+    xnn_params.x16.transpose = (struct transpose_parameters) {
+      .const_size_ukernel = (xnn_transposec_ukernel_function) xnn_x16_transpose_ukernel__2x4_scalar_int,
+      .tile_size = 32,
+    };
+  #endif  // XNN_NO_X16_OPERATORS
+
   /************************** X32 RISC-V micro-kernels **************************/
   #ifndef XNN_NO_X32_OPERATORS
     init_flags |= XNN_INIT_FLAG_X32;
@@ -6221,6 +6794,10 @@ static void init(void) {
         .pixel_tile = 1,
       };
     #endif  // XNN_NO_NCHW_OPERATORS
+    xnn_params.x32.transpose = (struct transpose_parameters) {
+      .const_size_ukernel = (xnn_transposec_ukernel_function) xnn_x32_transpose_ukernel__2x4_scalar_int,
+      .tile_size = 32,
+    };
   #endif  // XNN_NO_X32_OPERATORS
 
   /************************** XX RISC-V micro-kernels ***************************/
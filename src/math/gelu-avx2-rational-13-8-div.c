@@ -0,0 +1,88 @@
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+#include <stddef.h>
+
+#include <immintrin.h>
+
+#include <xnnpack/math-stubs.h>
+
+
+void xnn_math_f32_gelu__avx2_rational_13_8_div(
+    size_t n,
+    const float* input,
+    float* output)
+{
+  assert(n % (8 * sizeof(float)) == 0);
+
+  // The largest |x| for which the rational approximation of erf(x / sqrt(2)) is evaluated. Beyond this cutoff the
+  // approximation is >= 1.0 in magnitude, and gets clamped to +-1.0 below, so GELU(x) is exactly x for x >= cutoff,
+  // and exactly 0 for x <= -cutoff.
+  const __m256 vcutoff = _mm256_set1_ps(0x1.7p+2f);
+  const __m256 vminus_cutoff = _mm256_set1_ps(-0x1.7p+2f);
+  // Coefficients of the odd numerator polynomial P(x) of the rational approximation of erf(x / sqrt(2)):
+  //   P(x) = x * (alpha_1 + x**2 * (alpha_3 + x**2 * (alpha_5 + ... + x**2 * alpha_13)))
+  const __m256 valpha_13 = _mm256_set1_ps(-0x1.A7E662p-39f);
+  const __m256 valpha_11 = _mm256_set1_ps(0x1.50951Ap-31f);
+  const __m256 valpha_9 = _mm256_set1_ps(-0x1.8ECCFAp-24f);
+  const __m256 valpha_7 = _mm256_set1_ps(-0x1.51A8BAp-18f);
+  const __m256 valpha_5 = _mm256_set1_ps(-0x1.107B38p-13f);
+  const __m256 valpha_3 = _mm256_set1_ps(-0x1.11D682p-10f);
+  const __m256 valpha_1 = _mm256_set1_ps(-0x1.74F3E6p-7f);
+  // Coefficients of the even denominator polynomial Q(x) of the rational approximation of erf(x / sqrt(2)):
+  //   Q(x) = beta_0 + x**2 * (beta_2 + x**2 * (beta_4 + x**2 * (beta_6 + x**2 * beta_8)))
+  const __m256 vbeta_8 = _mm256_set1_ps(-0x1.E8C19Ap-21f);
+  const __m256 vbeta_6 = _mm256_set1_ps(-0x1.BF7A52p-16f);
+  const __m256 vbeta_4 = _mm256_set1_ps(-0x1.B9249Cp-12f);
+  const __m256 vbeta_2 = _mm256_set1_ps(-0x1.E337F0p-9f);
+  const __m256 vbeta_0 = _mm256_set1_ps(-0x1.D36D4Ep-7f);
+  const __m256 vone = _mm256_set1_ps(1.0f);
+  const __m256 vminus_one = _mm256_set1_ps(-1.0f);
+  const __m256 vhalf = _mm256_set1_ps(0.5f);
+
+  for (; n != 0; n -= 8 * sizeof(float)) {
+    const __m256 vx = _mm256_loadu_ps(input);
+
+    // General structure of the algorithm:
+    //
+    //   GELU(x) := x * Phi(x) = 0.5 * x * (1 + erf(x / sqrt(2)))
+    //
+    // where erf(x / sqrt(2)) is approximated by a rational function P(x) / Q(x) with the 1 / sqrt(2) scaling folded
+    // into the coefficients. Note that for large negative x the result is computed as a difference of two nearly equal
+    // numbers, so the approximation provides a small absolute (rather than relative) error there.
+    const __m256 vz = _mm256_max_ps(vminus_cutoff, _mm256_min_ps(vx, vcutoff));
+    const __m256 vz2 = _mm256_mul_ps(vz, vz);
+
+    // Evaluate numerator polynomial P(z).
+    __m256 vp = _mm256_fmadd_ps(valpha_13, vz2, valpha_11);
+    vp = _mm256_fmadd_ps(vp, vz2, valpha_9);
+    vp = _mm256_fmadd_ps(vp, vz2, valpha_7);
+    vp = _mm256_fmadd_ps(vp, vz2, valpha_5);
+    vp = _mm256_fmadd_ps(vp, vz2, valpha_3);
+    vp = _mm256_fmadd_ps(vp, vz2, valpha_1);
+    vp = _mm256_mul_ps(vp, vz);
+
+    // Evaluate denominator polynomial Q(z).
+    __m256 vq = _mm256_fmadd_ps(vbeta_8, vz2, vbeta_6);
+    vq = _mm256_fmadd_ps(vq, vz2, vbeta_4);
+    vq = _mm256_fmadd_ps(vq, vz2, vbeta_2);
+    vq = _mm256_fmadd_ps(vq, vz2, vbeta_0);
+
+    // Reconstruct erf(x / sqrt(2)) ~ P(z) / Q(z), and clamp it to [-1.0, 1.0] because the approximation slightly
+    // overshoots near the cutoff.
+    __m256 verf = _mm256_div_ps(vp, vq);
+    verf = _mm256_max_ps(vminus_one, _mm256_min_ps(verf, vone));
+
+    // Reconstruct GELU(x) = 0.5 * x + 0.5 * x * erf(x / sqrt(2)).
+    const __m256 vhalfx = _mm256_mul_ps(vx, vhalf);
+    const __m256 vy = _mm256_fmadd_ps(vhalfx, verf, vhalfx);
+
+    _mm256_storeu_ps(output, vy);
+
+    input += 8;
+    output += 8;
+  }
+}
@@ -0,0 +1,85 @@
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+#include <stddef.h>
+
+#include <arm_neon.h>
+
+#include <xnnpack/math-stubs.h>
+
+
+void xnn_math_f32_gelu__neonfma_rational_13_8_div(
+    size_t n,
+    const float* input,
+    float* output)
+{
+  assert(n % (4 * sizeof(float)) == 0);
+
+  // The largest |x| for which the rational approximation of erf(x / sqrt(2)) is evaluated. Beyond this cutoff the
+  // approximation is >= 1.0 in magnitude, and gets clamped to +-1.0 below, so GELU(x) is exactly x for x >= cutoff,
+  // and exactly 0 for x <= -cutoff.
+  const float32x4_t vcutoff = vmovq_n_f32(0x1.7p+2f);
+  const float32x4_t vminus_cutoff = vmovq_n_f32(-0x1.7p+2f);
+  // Coefficients of the odd numerator polynomial P(x) of the rational approximation of erf(x / sqrt(2)):
+  //   P(x) = x * (alpha_1 + x**2 * (alpha_3 + x**2 * (alpha_5 + ... + x**2 * alpha_13)))
+  const float32x4_t valpha_13 = vmovq_n_f32(-0x1.A7E662p-39f);
+  const float32x4_t valpha_11 = vmovq_n_f32(0x1.50951Ap-31f);
+  const float32x4_t valpha_9 = vmovq_n_f32(-0x1.8ECCFAp-24f);
+  const float32x4_t valpha_7 = vmovq_n_f32(-0x1.51A8BAp-18f);
+  const float32x4_t valpha_5 = vmovq_n_f32(-0x1.107B38p-13f);
+  const float32x4_t valpha_3 = vmovq_n_f32(-0x1.11D682p-10f);
+  const float32x4_t valpha_1 = vmovq_n_f32(-0x1.74F3E6p-7f);
+  // Coefficients of the even denominator polynomial Q(x) of the rational approximation of erf(x / sqrt(2)):
+  //   Q(x) = beta_0 + x**2 * (beta_2 + x**2 * (beta_4 + x**2 * (beta_6 + x**2 * beta_8)))
+  const float32x4_t vbeta_8 = vmovq_n_f32(-0x1.E8C19Ap-21f);
+  const float32x4_t vbeta_6 = vmovq_n_f32(-0x1.BF7A52p-16f);
+  const float32x4_t vbeta_4 = vmovq_n_f32(-0x1.B9249Cp-12f);
+  const float32x4_t vbeta_2 = vmovq_n_f32(-0x1.E337F0p-9f);
+  const float32x4_t vbeta_0 = vmovq_n_f32(-0x1.D36D4Ep-7f);
+  const float32x4_t vone = vmovq_n_f32(1.0f);
+  const float32x4_t vminus_one = vmovq_n_f32(-1.0f);
+  const float32x4_t vhalf = vmovq_n_f32(0.5f);
+
+  for (; n != 0; n -= 4 * sizeof(float)) {
+    const float32x4_t vx = vld1q_f32(input); input += 4;
+
+    // General structure of the algorithm:
+    //
+    //   GELU(x) := x * Phi(x) = 0.5 * x * (1 + erf(x / sqrt(2)))
+    //
+    // where erf(x / sqrt(2)) is approximated by a rational function P(x) / Q(x) with the 1 / sqrt(2) scaling folded
+    // into the coefficients. Note that for large negative x the result is computed as a difference of two nearly equal
+    // numbers, so the approximation provides a small absolute (rather than relative) error there.
+    const float32x4_t vz = vmaxq_f32(vminus_cutoff, vminq_f32(vx, vcutoff));
+    const float32x4_t vz2 = vmulq_f32(vz, vz);
+
+    // Evaluate numerator polynomial P(z).
+    float32x4_t vp = vfmaq_f32(valpha_11, valpha_13, vz2);
+    vp = vfmaq_f32(valpha_9, vp, vz2);
+    vp = vfmaq_f32(valpha_7, vp, vz2);
+    vp = vfmaq_f32(valpha_5, vp, vz2);
+    vp = vfmaq_f32(valpha_3, vp, vz2);
+    vp = vfmaq_f32(valpha_1, vp, vz2);
+    vp = vmulq_f32(vp, vz);
+
+    // Evaluate denominator polynomial Q(z).
+    float32x4_t vq = vfmaq_f32(vbeta_6, vbeta_8, vz2);
+    vq = vfmaq_f32(vbeta_4, vq, vz2);
+    vq = vfmaq_f32(vbeta_2, vq, vz2);
+    vq = vfmaq_f32(vbeta_0, vq, vz2);
+
+    // Reconstruct erf(x / sqrt(2)) ~ P(z) / Q(z), and clamp it to [-1.0, 1.0] because the approximation slightly
+    // overshoots near the cutoff.
+    float32x4_t verf = vdivq_f32(vp, vq);
+    verf = vmaxq_f32(vminus_one, vminq_f32(verf, vone));
+
+    // Reconstruct GELU(x) = 0.5 * x + 0.5 * x * erf(x / sqrt(2)).
+    const float32x4_t vhalfx = vmulq_f32(vx, vhalf);
+    const float32x4_t vy = vfmaq_f32(vhalfx, vhalfx, verf);
+
+    vst1q_f32(output, vy); output += 4;
+  }
+}
@@ -0,0 +1,84 @@
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+#include <stddef.h>
+
+#include <xnnpack/math.h>
+#include <xnnpack/math-stubs.h>
+
+
+void xnn_math_f32_gelu__scalar_rational_13_8_div(
+    size_t n,
+    const float* input,
+    float* output)
+{
+  assert(n % sizeof(float) == 0);
+
+  // The largest |x| for which the rational approximation of erf(x / sqrt(2)) is evaluated. Beyond this cutoff the
+  // approximation is >= 1.0 in magnitude, and gets clamped to +-1.0 below, so GELU(x) is exactly x for x >= cutoff,
+  // and exactly 0 for x <= -cutoff.
+  const float vcutoff = 0x1.7p+2f;
+  const float vminus_cutoff = -0x1.7p+2f;
+  // Coefficients of the odd numerator polynomial P(x) of the rational approximation of erf(x / sqrt(2)):
+  //   P(x) = x * (alpha_1 + x**2 * (alpha_3 + x**2 * (alpha_5 + ... + x**2 * alpha_13)))
+  const float valpha_13 = -0x1.A7E662p-39f;
+  const float valpha_11 = 0x1.50951Ap-31f;
+  const float valpha_9 = -0x1.8ECCFAp-24f;
+  const float valpha_7 = -0x1.51A8BAp-18f;
+  const float valpha_5 = -0x1.107B38p-13f;
+  const float valpha_3 = -0x1.11D682p-10f;
+  const float valpha_1 = -0x1.74F3E6p-7f;
+  // Coefficients of the even denominator polynomial Q(x) of the rational approximation of erf(x / sqrt(2)):
+  //   Q(x) = beta_0 + x**2 * (beta_2 + x**2 * (beta_4 + x**2 * (beta_6 + x**2 * beta_8)))
+  const float vbeta_8 = -0x1.E8C19Ap-21f;
+  const float vbeta_6 = -0x1.BF7A52p-16f;
+  const float vbeta_4 = -0x1.B9249Cp-12f;
+  const float vbeta_2 = -0x1.E337F0p-9f;
+  const float vbeta_0 = -0x1.D36D4Ep-7f;
+  const float vone = 1.0f;
+  const float vminus_one = -1.0f;
+  const float vhalf = 0.5f;
+
+  for (; n != 0; n -= sizeof(float)) {
+    const float vx = *input++;
+
+    // General structure of the algorithm:
+    //
+    //   GELU(x) := x * Phi(x) = 0.5 * x * (1 + erf(x / sqrt(2)))
+    //
+    // where erf(x / sqrt(2)) is approximated by a rational function P(x) / Q(x) with the 1 / sqrt(2) scaling folded
+    // into the coefficients. Note that for large negative x the result is computed as a difference of two nearly equal
+    // numbers, so the approximation provides a small absolute (rather than relative) error there.
+    const float vz = math_max_f32(vminus_cutoff, math_min_f32(vx, vcutoff));
+    const float vz2 = vz * vz;
+
+    // Evaluate numerator polynomial P(z).
+    float vp = valpha_13 * vz2 + valpha_11;
+    vp = vp * vz2 + valpha_9;
+    vp = vp * vz2 + valpha_7;
+    vp = vp * vz2 + valpha_5;
+    vp = vp * vz2 + valpha_3;
+    vp = vp * vz2 + valpha_1;
+    vp = vp * vz;
+
+    // Evaluate denominator polynomial Q(z).
+    float vq = vbeta_8 * vz2 + vbeta_6;
+    vq = vq * vz2 + vbeta_4;
+    vq = vq * vz2 + vbeta_2;
+    vq = vq * vz2 + vbeta_0;
+
+    // Reconstruct erf(x / sqrt(2)) ~ P(z) / Q(z), and clamp it to [-1.0, 1.0] because the approximation slightly
+    // overshoots near the cutoff.
+    float verf = vp / vq;
+    verf = math_max_f32(vminus_one, math_min_f32(verf, vone));
+
+    // Reconstruct GELU(x) = 0.5 * x + 0.5 * x * erf(x / sqrt(2)).
+    const float vhalfx = vx * vhalf;
+    const float vy = vhalfx * verf + vhalfx;
+
+    *output++ = vy;
+  }
+}
@@ -8,6 +8,7 @@
 #include <stdint.h>
 #include <stdlib.h>
 
+#include <xnnpack/math.h>
 #include <xnnpack/memory-planner.h>
 #include <xnnpack/subgraph.h>
 
@@ -30,34 +31,274 @@ static inline int cmp_value_usage_tensor_size(const void* a, const void* b) {
   return (tensor_size_b > tensor_size_a) - (tensor_size_b < tensor_size_a);
 }
 
-static void populate_value_lifecycle(const xnn_subgraph_t subgraph, struct xnn_value_usage* usage) {
+// Use this comparison function to sort xnn_value_usage according to the tensor_size in decreasing order, and then
+// according to the length of the lifecycle in decreasing order.
+static inline int cmp_value_usage_tensor_size_lifecycle(const void* a, const void* b) {
+  const struct xnn_value_usage* usage_a = *(struct xnn_value_usage *const*)a;
+  const struct xnn_value_usage* usage_b = *(struct xnn_value_usage *const*)b;
+  if (usage_a->tensor_size != usage_b->tensor_size) {
+    return (usage_b->tensor_size > usage_a->tensor_size) - (usage_b->tensor_size < usage_a->tensor_size);
+  }
+  const uint32_t lifecycle_a = usage_a->last_node - usage_a->first_node;
+  const uint32_t lifecycle_b = usage_b->last_node - usage_b->first_node;
+  if (lifecycle_a != lifecycle_b) {
+    return (lifecycle_b > lifecycle_a) - (lifecycle_b < lifecycle_a);
+  }
+  return (usage_a->first_node > usage_b->first_node) - (usage_a->first_node < usage_b->first_node);
+}
+
+static void populate_value_lifecycle(
+  const xnn_subgraph_t subgraph,
+  const uint32_t* node_steps,
+  struct xnn_value_usage* usage)
+{
   assert(subgraph != NULL);
-  if (subgraph->num_nodes == 0) {
-    return;
+  for (uint32_t i = 0; i < subgraph->num_values; ++i) {
+    usage[i].first_node = UINT32_MAX;
   }
-  // As we initialized first/last_node in each xnn_value_usage to 0 as in 'xnn_init_value_mem_allocation_tracker',
-  // we start with the second node to tell whether first/last_node have been set or not, and check the first node last.
-  for (uint32_t nid = 1; nid < subgraph->num_nodes; ++nid) {
+  for (uint32_t nid = 0; nid < subgraph->num_nodes; ++nid) {
     const struct xnn_node* node = subgraph->nodes + nid;
+    // Without an explicit schedule, Nodes execute one by one in definition order.
+    const uint32_t step = node_steps != NULL ? node_steps[nid] : nid;
     for (uint32_t i = 0; i < node->num_inputs; ++i) {
-      if (usage[node->inputs[i]].first_node == 0) {
-        usage[node->inputs[i]].first_node = nid;
-      }
-      usage[node->inputs[i]].last_node = nid;
+      struct xnn_value_usage* input_usage = &usage[node->inputs[i]];
+      input_usage->first_node = math_min_u32(input_usage->first_node, step);
+      input_usage->last_node = math_max_u32(input_usage->last_node, step);
     }
     for (uint32_t i = 0; i < node->num_outputs; ++i) {
-      if (usage[node->outputs[i]].first_node == 0) {
-        usage[node->outputs[i]].first_node = nid;
+      struct xnn_value_usage* output_usage = &usage[node->outputs[i]];
+      output_usage->first_node = math_min_u32(output_usage->first_node, step);
+      output_usage->last_node = math_max_u32(output_usage->last_node, step);
+    }
+  }
+  // Values without any users keep the zero-initialized lifecycle.
+  for (uint32_t i = 0; i < subgraph->num_values; ++i) {
+    if (usage[i].first_node == UINT32_MAX) {
+      usage[i].first_node = 0;
+    }
+  }
+}
+
+// Check if the operator for the xnn_node reads each output element only from the same element of its inputs, and can
+// thus write its output over an input of the same shape.
+static bool node_supports_inplace(const struct xnn_node* node) {
+  switch (node->type) {
+    case xnn_node_type_abs:
+    case xnn_node_type_add2:
+    case xnn_node_type_bankers_rounding:
+    case xnn_node_type_ceiling:
+    case xnn_node_type_clamp:
+    case xnn_node_type_divide:
+    case xnn_node_type_elu:
+    case xnn_node_type_floor:
+    case xnn_node_type_gelu:
+    case xnn_node_type_hardswish:
+    case xnn_node_type_leaky_relu:
+    case xnn_node_type_maximum2:
+    case xnn_node_type_minimum2:
+    case xnn_node_type_multiply2:
+    case xnn_node_type_negate:
+    case xnn_node_type_sigmoid:
+    case xnn_node_type_square:
+    case xnn_node_type_square_root:
+    case xnn_node_type_squared_difference:
+    case xnn_node_type_subtract:
+    case xnn_node_type_tanh:
+      return true;
+    default:
+      return false;
+  }
+}
+
+static bool node_is_concatenate(const struct xnn_node* node) {
+  switch (node->type) {
+    case xnn_node_type_concatenate2:
+    case xnn_node_type_concatenate3:
+    case xnn_node_type_concatenate4:
+      return true;
+    default:
+      return false;
+  }
+}
+
+static bool node_is_even_split(const struct xnn_node* node) {
+  switch (node->type) {
+    case xnn_node_type_even_split2:
+    case xnn_node_type_even_split3:
+    case xnn_node_type_even_split4:
+      return true;
+    default:
+      return false;
+  }
+}
+
+// Check if the xnn_value is produced by a Concatenate, Even Split, or Static Slice xnn_node, and may share its memory
+// with other xnn_values.
+static bool value_is_sliced(const xnn_subgraph_t subgraph, uint32_t value_id) {
+  const uint32_t producer = subgraph->values[value_id].producer;
+  return producer != XNN_INVALID_NODE_ID && producer < subgraph->num_nodes &&
+    (node_is_concatenate(subgraph->nodes + producer) || node_is_even_split(subgraph->nodes + producer) ||
+     subgraph->nodes[producer].type == xnn_node_type_static_slice);
+}
+
+// Find the xnn_values that the operators can compute in place, over an input that dies at the same xnn_node.
+static void populate_value_reuse(struct xnn_value_allocation_tracker* tracker) {
+  const xnn_subgraph_t subgraph = tracker->subgraph;
+  struct xnn_value_usage* usage = tracker->usage;
+  uint32_t* num_consumers = xnn_allocate_zero_memory(sizeof(uint32_t) * subgraph->num_values);
+  if (num_consumers == NULL) {
+    return;
+  }
+  for (uint32_t nid = 0; nid < subgraph->num_nodes; ++nid) {
+    const struct xnn_node* node = subgraph->nodes + nid;
+    for (uint32_t i = 0; i < node->num_inputs; ++i) {
+      num_consumers[node->inputs[i]] += 1;
+    }
+  }
+  for (uint32_t nid = 0; nid < subgraph->num_nodes; ++nid) {
+    const struct xnn_node* node = subgraph->nodes + nid;
+    if (!node_supports_inplace(node)) {
+      continue;
+    }
+    assert(node->num_outputs == 1);
+    const uint32_t output_id = node->outputs[0];
+    if (usage[output_id].tensor_size == 0) {
+      continue;
+    }
+    for (uint32_t i = 0; i < node->num_inputs; ++i) {
+      // The input must be allocated in the memory arena with the same size, and no other xnn_node, including the ones
+      // executing concurrently, may read it. Outputs of Concatenate xnn_nodes may hold inputs that outlive them, and
+      // outputs of Even Split xnn_nodes may be views of an input that other xnn_nodes read.
+      const uint32_t input_id = node->inputs[i];
+      if (num_consumers[input_id] == 1 && usage[input_id].tensor_size == usage[output_id].tensor_size &&
+          subgraph->values[input_id].datatype == subgraph->values[output_id].datatype &&
+          !value_is_sliced(subgraph, input_id))
+      {
+        usage[output_id].reuse_value_id = input_id;
+        break;
       }
-      usage[node->outputs[i]].last_node = nid;
     }
   }
-  const struct xnn_node* first_node = subgraph->nodes;
-  for (uint32_t i = 0; i < first_node->num_inputs; ++i) {
-    usage[first_node->inputs[i]].first_node = 0;
+  xnn_release_memory(num_consumers);
+}
+
+// Place the outputs of Even Split xnn_nodes in the memory of the input, where they are views of the input, and the
+// Even Split xnn_nodes don't copy them. The outputs are contiguous slices of the input only if all dimensions before
+// the axis are 1.
+static void populate_even_split_slices(struct xnn_value_allocation_tracker* tracker, const struct xnn_node* node) {
+  const xnn_subgraph_t subgraph = tracker->subgraph;
+  struct xnn_value_usage* usage = tracker->usage;
+  assert(node->num_inputs == 1);
+  const uint32_t input_id = node->inputs[0];
+  if (usage[input_id].tensor_size == 0) {
+    return;
+  }
+  const struct xnn_shape* input_shape = &subgraph->values[input_id].shape;
+  size_t batch_size = 1;
+  for (size_t i = 0; i < node->params.even_split.axis; ++i) {
+    batch_size *= input_shape->dim[i];
   }
-  for (uint32_t i = 0; i < first_node->num_outputs; ++i) {
-    usage[first_node->outputs[i]].first_node = 0;
+  if (batch_size != 1) {
+    return;
+  }
+  // Outputs without consumers are cleared during Subgraph optimization, so slice sizes are derived from the input.
+  const size_t slice_size = xnn_tensor_get_size(subgraph, input_id) / node->num_outputs;
+  for (uint32_t i = 0; i < node->num_outputs; ++i) {
+    // The output must be allocated in the memory arena.
+    const uint32_t output_id = node->outputs[i];
+    if (subgraph->values[output_id].type != xnn_value_type_invalid && usage[output_id].tensor_size != 0) {
+      assert(usage[output_id].reuse_value_id == XNN_INVALID_VALUE_ID);
+      usage[output_id].reuse_value_id = input_id;
+      usage[output_id].reuse_offset = i * slice_size;
+    }
+  }
+}
+
+// Place the inputs of Concatenate xnn_nodes in the memory of the output, where the producers of the inputs write them
+// directly, and the Concatenate xnn_nodes don't copy them. The inputs are contiguous slices of the output only if all
+// dimensions before the axis are 1.
+static void populate_concatenate_slices(struct xnn_value_allocation_tracker* tracker, const struct xnn_node* node) {
+  const xnn_subgraph_t subgraph = tracker->subgraph;
+  struct xnn_value_usage* usage = tracker->usage;
+  assert(node->num_outputs == 1);
+  const uint32_t output_id = node->outputs[0];
+  if (usage[output_id].tensor_size == 0) {
+    return;
+  }
+  const struct xnn_shape* output_shape = &subgraph->values[output_id].shape;
+  size_t batch_size = 1;
+  for (size_t i = 0; i < node->params.concatenate.axis; ++i) {
+    batch_size *= output_shape->dim[i];
+  }
+  if (batch_size != 1) {
+    return;
+  }
+  size_t offset = 0;
+  for (uint32_t i = 0; i < node->num_inputs; ++i) {
+    // The input must be allocated in the memory arena, and not be computed in place over another xnn_value or be a view
+    // of another xnn_value. An input repeated in the xnn_node is placed in the first of its slices.
+    const uint32_t input_id = node->inputs[i];
+    if (usage[input_id].tensor_size != 0 && usage[input_id].reuse_value_id == XNN_INVALID_VALUE_ID) {
+      usage[input_id].reuse_value_id = output_id;
+      usage[input_id].reuse_offset = offset;
+    }
+    offset += xnn_tensor_get_size(subgraph, input_id);
+  }
+}
+
+// Place the output of a Static Slice xnn_node in the memory of the input, where it is a view of the input, and the
+// Static Slice xnn_node doesn't copy it. The output is a contiguous slice of the input only if it covers the inner
+// dimensions completely, selects adjacent elements in the next dimension, and a single element in the outer ones.
+static void populate_static_slice_view(struct xnn_value_allocation_tracker* tracker, const struct xnn_node* node) {
+  const xnn_subgraph_t subgraph = tracker->subgraph;
+  struct xnn_value_usage* usage = tracker->usage;
+  assert(node->num_inputs == 1);
+  assert(node->num_outputs == 1);
+  // Both the input and the output must be allocated in the memory arena, and the output must not be placed in the
+  // memory of another xnn_value already.
+  const uint32_t input_id = node->inputs[0];
+  const uint32_t output_id = node->outputs[0];
+  if (usage[input_id].tensor_size == 0 || usage[output_id].tensor_size == 0 ||
+      usage[output_id].reuse_value_id != XNN_INVALID_VALUE_ID)
+  {
+    return;
+  }
+  const struct xnn_shape* input_shape = &subgraph->values[input_id].shape;
+  size_t offset = 0;
+  size_t dim_stride = 1;
+  bool is_partial = false;
+  for (size_t i = input_shape->num_dims; i != 0; i--) {
+    const size_t size = node->params.static_slice.sizes[i - 1];
+    if (is_partial) {
+      if (size != 1) {
+        return;
+      }
+    } else if (size != input_shape->dim[i - 1]) {
+      if (size != 1 && node->params.static_slice.strides[i - 1] != 1) {
+        return;
+      }
+      is_partial = true;
+    }
+    offset += node->params.static_slice.offsets[i - 1] * dim_stride;
+    dim_stride *= input_shape->dim[i - 1];
+  }
+  const size_t element_size = xnn_tensor_get_size(subgraph, input_id) / xnn_shape_multiply_all_dims(input_shape);
+  usage[output_id].reuse_value_id = input_id;
+  usage[output_id].reuse_offset = offset * element_size;
+}
+
+// Find the xnn_values that share the memory of another xnn_value at an offset.
+static void populate_value_slices(struct xnn_value_allocation_tracker* tracker) {
+  const xnn_subgraph_t subgraph = tracker->subgraph;
+  for (uint32_t nid = 0; nid < subgraph->num_nodes; ++nid) {
+    const struct xnn_node* node = subgraph->nodes + nid;
+    if (node_is_concatenate(node)) {
+      populate_concatenate_slices(tracker, node);
+    } else if (node_is_even_split(node)) {
+      populate_even_split_slices(tracker, node);
+    } else if (node->type == xnn_node_type_static_slice) {
+      populate_static_slice_view(tracker, node);
+    }
   }
 }
 
@@ -122,12 +363,239 @@ static size_t find_value_alloc_offset(struct memory_block* live_mem_blocks,
   return live_mem_blocks[smallest_gap_index].end;
 }
 
+// Plan the memory arena for xnn_values with the xnn_memory_planning_strategy_smallest_gap strategy, and return the
+// size of the memory arena.
+static size_t plan_smallest_gap(struct xnn_value_usage** sorted_usage, size_t num_values_to_alloc) {
+  qsort(sorted_usage, num_values_to_alloc, sizeof(struct xnn_value_usage*), cmp_value_usage_tensor_size);
+
+  struct memory_block* current_live_mem_blocks = xnn_allocate_zero_memory(
+      sizeof(struct memory_block) * num_values_to_alloc);
+  size_t mem_arena_size = 0;
+  for (size_t i = 0; i < num_values_to_alloc; ++i) {
+    size_t num_live_mem_blocks = 0;
+    struct xnn_value_usage* current = sorted_usage[i];
+    for (size_t j = 0; j < i; ++j) {
+      const struct xnn_value_usage* allocated = sorted_usage[j];
+      if (value_lifecycle_overlap(current, allocated)) {
+        current_live_mem_blocks[num_live_mem_blocks++] = (struct memory_block){
+            .start = allocated->alloc_offset,
+            .end = allocated->alloc_offset + allocated->tensor_size,
+        };
+      }
+    }
+    current->alloc_offset = find_value_alloc_offset(current_live_mem_blocks, num_live_mem_blocks, current->tensor_size);
+    if (mem_arena_size < current->alloc_offset + current->tensor_size) {
+      mem_arena_size = current->alloc_offset + current->tensor_size;
+    }
+  }
+  xnn_release_memory(current_live_mem_blocks);
+  return mem_arena_size;
+}
+
+// Segment tree over execution steps which finds the allocated xnn_values whose lifecycle overlaps a given one.
+// Every tree node covers a range of steps, and the children of tree node n are tree nodes 2n+1 and 2n+2. An xnn_value
+// is listed in the 'cover' list of the tree nodes whose ranges make up its lifecycle, and in the 'partial' list of all
+// other tree nodes visited on the way to them. Both lists are singly-linked lists of 'entries'.
+struct lifecycle_tree {
+  // Head entries of the 'cover' and 'partial' lists of each tree node, or SIZE_MAX for empty lists.
+  size_t* cover_head;
+  size_t* partial_head;
+  // Index of an xnn_value in the planned order.
+  size_t* entry_value;
+  // Next entry in the same list, or SIZE_MAX.
+  size_t* entry_next;
+  size_t num_entries;
+};
+
+static void lifecycle_tree_push(struct lifecycle_tree* tree, size_t* head, size_t value_index) {
+  const size_t entry = tree->num_entries++;
+  tree->entry_value[entry] = value_index;
+  tree->entry_next[entry] = *head;
+  *head = entry;
+}
+
+static void lifecycle_tree_insert(
+  struct lifecycle_tree* tree, size_t node, uint32_t node_first, uint32_t node_last,
+  const struct xnn_value_usage* usage, size_t value_index)
+{
+  if (usage->last_node < node_first || usage->first_node > node_last) {
+    return;
+  }
+  if (usage->first_node <= node_first && usage->last_node >= node_last) {
+    lifecycle_tree_push(tree, &tree->cover_head[node], value_index);
+    return;
+  }
+  lifecycle_tree_push(tree, &tree->partial_head[node], value_index);
+  const uint32_t node_middle = node_first + (node_last - node_first) / 2;
+  lifecycle_tree_insert(tree, 2 * node + 1, node_first, node_middle, usage, value_index);
+  lifecycle_tree_insert(tree, 2 * node + 2, node_middle + 1, node_last, usage, value_index);
+}
+
+// Append the memory blocks of the allocated xnn_values listed from 'entry' on, which are not marked in 'visited' yet.
+static size_t lifecycle_tree_collect(
+  const struct lifecycle_tree* tree, size_t entry, struct xnn_value_usage** sorted_usage, size_t current_index,
+  size_t* visited, struct memory_block* blocks, size_t num_blocks)
+{
+  for (; entry != SIZE_MAX; entry = tree->entry_next[entry]) {
+    const size_t value_index = tree->entry_value[entry];
+    if (visited[value_index] != current_index) {
+      visited[value_index] = current_index;
+      const struct xnn_value_usage* allocated = sorted_usage[value_index];
+      blocks[num_blocks++] = (struct memory_block) {
+        .start = allocated->alloc_offset,
+        .end = allocated->alloc_offset + allocated->tensor_size,
+      };
+    }
+  }
+  return num_blocks;
+}
+
+static size_t lifecycle_tree_query(
+  const struct lifecycle_tree* tree, size_t node, uint32_t node_first, uint32_t node_last,
+  struct xnn_value_usage** sorted_usage, size_t current_index, size_t* visited,
+  struct memory_block* blocks, size_t num_blocks)
+{
+  const struct xnn_value_usage* current = sorted_usage[current_index];
+  if (current->last_node < node_first || current->first_node > node_last) {
+    return num_blocks;
+  }
+  num_blocks = lifecycle_tree_collect(
+    tree, tree->cover_head[node], sorted_usage, current_index, visited, blocks, num_blocks);
+  if (current->first_node <= node_first && current->last_node >= node_last) {
+    return lifecycle_tree_collect(
+      tree, tree->partial_head[node], sorted_usage, current_index, visited, blocks, num_blocks);
+  }
+  const uint32_t node_middle = node_first + (node_last - node_first) / 2;
+  num_blocks = lifecycle_tree_query(
+    tree, 2 * node + 1, node_first, node_middle, sorted_usage, current_index, visited, blocks, num_blocks);
+  return lifecycle_tree_query(
+    tree, 2 * node + 2, node_middle + 1, node_last, sorted_usage, current_index, visited, blocks, num_blocks);
+}
+
+// Plan the memory arena for xnn_values with the xnn_memory_planning_strategy_greedy_by_size strategy, and return the
+// size of the memory arena.
+static size_t plan_greedy_by_size(struct xnn_value_usage** sorted_usage, size_t num_values_to_alloc) {
+  if (num_values_to_alloc == 0) {
+    return 0;
+  }
+  qsort(sorted_usage, num_values_to_alloc, sizeof(struct xnn_value_usage*), cmp_value_usage_tensor_size_lifecycle);
+
+  uint32_t num_steps = 0;
+  for (size_t i = 0; i < num_values_to_alloc; ++i) {
+    num_steps = math_max_u32(num_steps, sorted_usage[i]->last_node + 1);
+  }
+  // Depth of the segment tree, and an upper bound on the number of tree nodes an insertion visits at each level.
+  size_t tree_depth = 1;
+  while ((UINT32_C(1) << (tree_depth - 1)) < num_steps) {
+    tree_depth++;
+  }
+  const size_t num_tree_nodes = (size_t) 4 * num_steps;
+  const size_t max_entries = num_values_to_alloc * 4 * tree_depth;
+
+  struct lifecycle_tree tree;
+  tree.cover_head = xnn_allocate_memory(sizeof(size_t) * num_tree_nodes);
+  tree.partial_head = xnn_allocate_memory(sizeof(size_t) * num_tree_nodes);
+  tree.entry_value = xnn_allocate_memory(sizeof(size_t) * max_entries);
+  tree.entry_next = xnn_allocate_memory(sizeof(size_t) * max_entries);
+  tree.num_entries = 0;
+  size_t* visited = xnn_allocate_memory(sizeof(size_t) * num_values_to_alloc);
+  struct memory_block* live_mem_blocks = xnn_allocate_memory(sizeof(struct memory_block) * num_values_to_alloc);
+  for (size_t i = 0; i < num_tree_nodes; ++i) {
+    tree.cover_head[i] = SIZE_MAX;
+    tree.partial_head[i] = SIZE_MAX;
+  }
+  for (size_t i = 0; i < num_values_to_alloc; ++i) {
+    visited[i] = SIZE_MAX;
+  }
+
+  size_t mem_arena_size = 0;
+  for (size_t i = 0; i < num_values_to_alloc; ++i) {
+    struct xnn_value_usage* current = sorted_usage[i];
+    const size_t num_live_mem_blocks = lifecycle_tree_query(
+      &tree, 0, 0, num_steps - 1, sorted_usage, i, visited, live_mem_blocks, 0);
+    // Sort memory blocks according to 'start' in increasing order.
+    qsort(live_mem_blocks, num_live_mem_blocks, sizeof(struct memory_block), cmp_memory_block);
+
+    // Walk the live memory blocks in the order of offsets, and track the end of the memory covered so far.
+    size_t live_mem_end = 0;
+    size_t best_offset = SIZE_MAX;
+    size_t smallest_gap_size = SIZE_MAX;
+    for (size_t j = 0; j < num_live_mem_blocks; ++j) {
+      if (live_mem_blocks[j].start > live_mem_end) {
+        const size_t gap = live_mem_blocks[j].start - live_mem_end;
+        if (gap >= current->tensor_size && gap < smallest_gap_size) {
+          best_offset = live_mem_end;
+          smallest_gap_size = gap;
+        }
+      }
+      live_mem_end = max(live_mem_end, live_mem_blocks[j].end);
+    }
+    current->alloc_offset = best_offset != SIZE_MAX ? best_offset : live_mem_end;
+    mem_arena_size = max(mem_arena_size, current->alloc_offset + current->tensor_size);
+
+    lifecycle_tree_insert(&tree, 0, 0, num_steps - 1, current, i);
+    assert(tree.num_entries <= max_entries);
+  }
+  xnn_release_memory(live_mem_blocks);
+  xnn_release_memory(visited);
+  xnn_release_memory(tree.entry_next);
+  xnn_release_memory(tree.entry_value);
+  xnn_release_memory(tree.partial_head);
+  xnn_release_memory(tree.cover_head);
+  return mem_arena_size;
+}
+
+// Compute the maximum over execution steps of the total size of live xnn_values.
+static size_t compute_mem_arena_lower_bound(const struct xnn_value_allocation_tracker* tracker) {
+  uint32_t num_steps = 0;
+  for (size_t i = tracker->min_value_id; i <= tracker->max_value_id; ++i) {
+    const struct xnn_value_usage* info = tracker->usage + i;
+    if (info->tensor_size != 0 && info->reuse_value_id == XNN_INVALID_VALUE_ID) {
+      num_steps = math_max_u32(num_steps, info->last_node + 1);
+    }
+  }
+  // Changes of the live size at the beginning of each step. Intermediate sums never go negative, and unsigned
+  // wrap-around in the deltas cancels out.
+  size_t* live_size_deltas = xnn_allocate_zero_memory(sizeof(size_t) * (num_steps + 1));
+  if (live_size_deltas == NULL) {
+    return 0;
+  }
+  for (size_t i = tracker->min_value_id; i <= tracker->max_value_id; ++i) {
+    const struct xnn_value_usage* info = tracker->usage + i;
+    if (info->tensor_size != 0 && info->reuse_value_id == XNN_INVALID_VALUE_ID) {
+      live_size_deltas[info->first_node] += info->tensor_size;
+      live_size_deltas[info->last_node + 1] -= info->tensor_size;
+    }
+  }
+  size_t live_size = 0;
+  size_t max_live_size = 0;
+  for (uint32_t step = 0; step < num_steps; ++step) {
+    live_size += live_size_deltas[step];
+    max_live_size = max(max_live_size, live_size);
+  }
+  xnn_release_memory(live_size_deltas);
+  return max_live_size;
+}
+
 void xnn_init_value_allocation_tracker(struct xnn_value_allocation_tracker* tracker, const xnn_subgraph_t subgraph) {
+  xnn_init_scheduled_value_allocation_tracker(tracker, subgraph, NULL);
+}
+
+void xnn_init_scheduled_value_allocation_tracker(
+  struct xnn_value_allocation_tracker* tracker,
+  const xnn_subgraph_t subgraph,
+  const uint32_t* node_steps)
+{
   tracker->subgraph = subgraph;
+  tracker->strategy = xnn_memory_planning_strategy_smallest_gap;
   tracker->mem_arena_size = 0;
+  tracker->mem_arena_lower_bound = 0;
   tracker->usage = xnn_allocate_zero_memory(sizeof(struct xnn_value_usage) * subgraph->num_values);
+  for (uint32_t i = 0; i < subgraph->num_values; ++i) {
+    tracker->usage[i].reuse_value_id = XNN_INVALID_VALUE_ID;
+  }
 #if XNN_ENABLE_MEMOPT
-  populate_value_lifecycle(tracker->subgraph, tracker->usage);
+  populate_value_lifecycle(tracker->subgraph, node_steps, tracker->usage);
 #endif
   tracker->min_value_id = XNN_INVALID_VALUE_ID;
   tracker->max_value_id = XNN_INVALID_VALUE_ID;
@@ -155,42 +623,57 @@ void xnn_plan_value_allocation_tracker(struct xnn_value_allocation_tracker* trac
     return;
   }
 
+  populate_value_reuse(tracker);
+  populate_value_slices(tracker);
+  // The memory block of an xnn_value that is overwritten in place, or that holds slices, stays live as long as the
+  // xnn_values reusing it.
+  for (size_t i = tracker->min_value_id; i <= tracker->max_value_id; ++i) {
+    const struct xnn_value_usage* info = tracker->usage + i;
+    if (info->reuse_value_id != XNN_INVALID_VALUE_ID) {
+      struct xnn_value_usage* reused = tracker->usage + info->reuse_value_id;
+      while (reused->reuse_value_id != XNN_INVALID_VALUE_ID) {
+        reused = tracker->usage + reused->reuse_value_id;
+      }
+      reused->first_node = math_min_u32(reused->first_node, info->first_node);
+      reused->last_node = math_max_u32(reused->last_node, info->last_node);
+    }
+  }
+
   const uint32_t num_values = tracker->max_value_id - tracker->min_value_id + 1;
   struct xnn_value_usage** sorted_usage = xnn_allocate_zero_memory(sizeof(struct xnn_value_usage*) * num_values);
   size_t num_values_to_alloc = 0;
   for (size_t i = tracker->min_value_id; i <= tracker->max_value_id; ++i) {
     struct xnn_value_usage* info = tracker->usage + i;
-    if (info->tensor_size != 0) {
+    if (info->tensor_size != 0 && info->reuse_value_id == XNN_INVALID_VALUE_ID) {
       sorted_usage[num_values_to_alloc++] = info;
     }
   }
-  qsort(sorted_usage, num_values_to_alloc, sizeof(struct xnn_value_usage*), cmp_value_usage_tensor_size);
-
-  // Start the allocation planning process.
-  struct memory_block* current_live_mem_blocks = xnn_allocate_zero_memory(
-      sizeof(struct memory_block) * num_values_to_alloc);
   size_t mem_arena_size = 0;
-  for (size_t i = 0; i < num_values_to_alloc; ++i) {
-    size_t num_live_mem_blocks = 0;
-    struct xnn_value_usage* current = sorted_usage[i];
-    for (size_t j = 0; j < i; ++j) {
-      const struct xnn_value_usage* allocated = sorted_usage[j];
-      if (value_lifecycle_overlap(current, allocated)) {
-        current_live_mem_blocks[num_live_mem_blocks++] = (struct memory_block){
-            .start = allocated->alloc_offset,
-            .end = allocated->alloc_offset + allocated->tensor_size,
-        };
+  switch (tracker->strategy) {
+    case xnn_memory_planning_strategy_smallest_gap:
+      mem_arena_size = plan_smallest_gap(sorted_usage, num_values_to_alloc);
+      break;
+    case xnn_memory_planning_strategy_greedy_by_size:
+      mem_arena_size = plan_greedy_by_size(sorted_usage, num_values_to_alloc);
+      break;
+  }
+
+  for (size_t i = tracker->min_value_id; i <= tracker->max_value_id; ++i) {
+    struct xnn_value_usage* info = tracker->usage + i;
+    if (info->reuse_value_id != XNN_INVALID_VALUE_ID) {
+      size_t reuse_offset = info->reuse_offset;
+      const struct xnn_value_usage* reused = tracker->usage + info->reuse_value_id;
+      while (reused->reuse_value_id != XNN_INVALID_VALUE_ID) {
+        reuse_offset += reused->reuse_offset;
+        reused = tracker->usage + reused->reuse_value_id;
       }
-    }
-    current->alloc_offset = find_value_alloc_offset(current_live_mem_blocks, num_live_mem_blocks, current->tensor_size);
-    if (mem_arena_size < current->alloc_offset + current->tensor_size) {
-      mem_arena_size = current->alloc_offset + current->tensor_size;
+      info->alloc_offset = reused->alloc_offset + reuse_offset;
     }
   }
 
   tracker->mem_arena_size = mem_arena_size;
+  tracker->mem_arena_lower_bound = compute_mem_arena_lower_bound(tracker);
   xnn_release_memory(sorted_usage);
-  xnn_release_memory(current_live_mem_blocks);
 #else
   tracker->mem_arena_size = 0;
   for (uint32_t i = tracker->min_value_id; i <= tracker->max_value_id; ++i) {
@@ -199,5 +682,6 @@ void xnn_plan_value_allocation_tracker(struct xnn_value_allocation_tracker* trac
       tracker->mem_arena_size += tracker->usage[i].tensor_size;
     }
   }
+  tracker->mem_arena_lower_bound = tracker->mem_arena_size;
 #endif
 }
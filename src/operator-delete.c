@@ -13,6 +13,7 @@
 #include <xnnpack/log.h>
 #include <xnnpack/operator.h>
 #include <xnnpack/params.h>
+#include <xnnpack/weights-cache.h>
 
 
 enum xnn_status xnn_delete_operator(xnn_operator_t op)
@@ -27,8 +28,13 @@ enum xnn_status xnn_delete_operator(xnn_operator_t op)
   }
 
   xnn_release_memory(op->indirection_buffer);
-  xnn_release_simd_memory(op->packed_weights);
+  if (op->weights_cache != NULL) {
+    xnn_weights_cache_release(op->weights_cache);
+  } else {
+    xnn_release_simd_memory(op->packed_weights);
+  }
   xnn_release_simd_memory(op->zero_buffer);
+  xnn_release_simd_memory(op->intermediate_buffer);
   xnn_release_memory(op->pixelwise_buffer);
   xnn_release_memory(op->subconvolution_buffer);
   xnn_release_simd_memory(op->lookup_table);
@@ -7,6 +7,8 @@
 // LICENSE file in the root directory of this source tree.
 
 #include <assert.h>
+#include <inttypes.h>
+#include <math.h>
 #include <stddef.h>
 #include <stdint.h>
 #include <string.h>
@@ -17,7 +19,9 @@
 #include <xnnpack/log.h>
 #include <xnnpack/common.h>
 #include <xnnpack/math.h>
+#include <xnnpack/pack.h>
 #include <xnnpack/params.h>
+#include <xnnpack/prefetch.h>
 #include <xnnpack/compute.h>
 
 
@@ -69,6 +73,57 @@ void xnn_compute_gemm(
       &context->params);
 }
 
+void xnn_compute_f32_batch_gemm_packw(
+    const struct batch_gemm_context context[restrict XNN_MIN_ELEMENTS(1)],
+    size_t batch_index,
+    size_t nr_block_start,
+    size_t nr_block_size)
+{
+  const size_t k = context->k;
+  const float* b = (const float*) ((uintptr_t) context->b + batch_index * context->bb_stride);
+  float* packed_w = (float*) ((uintptr_t) context->packed_w +
+    batch_index * context->wb_stride + nr_block_start * context->w_stride);
+
+  if (context->transpose_b) {
+    xnn_pack_f32_gemm_goi_w(
+        1 /* groups */, nr_block_size, k,
+        context->nr, context->kr, context->sr,
+        b + nr_block_start * k, NULL /* bias */,
+        packed_w, 0 /* extra bytes */, NULL /* params */);
+  } else {
+    xnn_pack_f32_gemm_io_strided_w(
+        nr_block_size, k,
+        context->nr, context->kr, context->sr,
+        context->n /* k stride */,
+        b + nr_block_start, NULL /* bias */,
+        packed_w, NULL /* params */);
+  }
+}
+
+void xnn_compute_batch_gemm(
+    const struct batch_gemm_context context[restrict XNN_MIN_ELEMENTS(1)],
+    size_t batch_index,
+    size_t mr_block_start,
+    size_t nr_block_start,
+    size_t mr_block_size,
+    size_t nr_block_size)
+{
+  const size_t a_stride  = context->a_stride;
+  const size_t cm_stride = context->cm_stride;
+
+  context->ukernel.function[XNN_UARCH_DEFAULT](
+      mr_block_size,
+      nr_block_size,
+      context->k_scaled,
+      (const void*) ((uintptr_t) context->a + batch_index * context->ab_stride + mr_block_start * a_stride),
+      a_stride,
+      (const void*) ((uintptr_t) context->packed_w + batch_index * context->wb_stride + nr_block_start * context->w_stride),
+      (void*) ((uintptr_t) context->c + batch_index * context->cb_stride + mr_block_start * cm_stride + (nr_block_start << context->log2_csize)),
+      cm_stride,
+      context->cn_stride,
+      &context->params);
+}
+
 void xnn_compute_spmm(
     const struct spmm_context context[restrict XNN_MIN_ELEMENTS(1)],
     size_t batch_index,
@@ -343,6 +398,28 @@ void xnn_compute_subconv2d(
       &context->params);
 }
 
+void xnn_compute_conv2d_hwc(
+      const struct conv2d_context context[restrict XNN_MIN_ELEMENTS(1)],
+      size_t batch_index,
+      size_t output_y_start,
+      size_t output_y_slice)
+{
+  context->hwc_ukernel(
+      context->input_height,
+      context->input_width,
+      output_y_start,
+      output_y_start + output_y_slice,
+      (const void*) ((uintptr_t) context->input + batch_index * context->input_batch_stride),
+      context->zero,
+      context->packed_weights,
+      (void*) ((uintptr_t) context->output + batch_index * context->output_batch_stride),
+      context->input_padding_top,
+      context->output_channels,
+      context->output_height_stride,
+      context->output_width_stride,
+      &context->params);
+}
+
 void xnn_compute_conv2d_hwc2chw(
       const struct conv2d_context context[restrict XNN_MIN_ELEMENTS(1)],
       size_t batch_index,
@@ -729,6 +806,31 @@ void xnn_compute_prelu(
   context->ukernel(batch_range, context->n, x, x_stride, context->w, y, y_stride);
 }
 
+void xnn_compute_f32_reduce_max_contiguous(
+    const struct reduce_max_contiguous_context context[restrict XNN_MIN_ELEMENTS(1)],
+    size_t batch_index)
+{
+  const void* input = (const void*) ((uintptr_t) context->input + batch_index * context->input_stride);
+  void* output = (void*) ((uintptr_t) context->output + batch_index * context->output_stride);
+
+  context->ukernel(context->scaled_elements, input, output);
+}
+
+void xnn_compute_reduce_max_discontiguous(
+    const struct reduce_max_discontiguous_context context[restrict XNN_MIN_ELEMENTS(1)],
+    size_t batch_index,
+    size_t channel_start,
+    size_t channel_slice)
+{
+  const uint32_t log2_element_size = context->log2_element_size;
+  const void* input = (const void*) ((uintptr_t) context->input +
+    batch_index * context->input_batch_stride + (channel_start << log2_element_size));
+  void* output = (void*) ((uintptr_t) context->output +
+    batch_index * context->output_batch_stride + (channel_start << log2_element_size));
+
+  context->ukernel(context->rows, channel_slice, input, context->input_row_stride, output, &context->params);
+}
+
 void xnn_compute_pad_5d(
     const struct pad_context context[restrict XNN_MIN_ELEMENTS(1)],
     size_t i, size_t j, size_t k, size_t l, size_t m)
@@ -763,6 +865,179 @@ void xnn_compute_pad_5d(
   }
 }
 
+void xnn_compute_slice_5d(
+    const struct slice_context context[restrict XNN_MIN_ELEMENTS(1)],
+    size_t i, size_t j, size_t k, size_t l, size_t m)
+{
+  const void* input = (const void*) ((uintptr_t) context->input +
+    i * context->input_stride[4] + j * context->input_stride[3] + k * context->input_stride[2] + l * context->input_stride[1] + m * context->input_stride[0]);
+  void* output = (void*) ((uintptr_t) context->output +
+    i * context->output_stride[4] + j * context->output_stride[3] + k * context->output_stride[2] + l * context->output_stride[1] + m * context->output_stride[0]);
+
+  context->pad_ukernel(
+    context->rows, context->row_size,
+    0 /* pre padding */, 0 /* post padding */,
+    input, context->input_row_stride,
+    output, context->output_row_stride,
+    0 /* fill value */);
+}
+
+void xnn_compute_strided_slice_5d(
+    const struct slice_context context[restrict XNN_MIN_ELEMENTS(1)],
+    size_t i, size_t j, size_t k, size_t l, size_t m)
+{
+  const void* input = (const void*) ((uintptr_t) context->input +
+    i * context->input_stride[4] + j * context->input_stride[3] + k * context->input_stride[2] + l * context->input_stride[1] + m * context->input_stride[0]);
+  void* output = (void*) ((uintptr_t) context->output +
+    i * context->output_stride[4] + j * context->output_stride[3] + k * context->output_stride[2] + l * context->output_stride[1] + m * context->output_stride[0]);
+
+  // Gather a whole row of strided elements in a tight loop: calling the micro-kernel per element costs more than the
+  // copy itself.
+  const size_t num_elements = context->rows;
+  const size_t input_element_stride = context->input_row_stride;
+  if (context->row_size == sizeof(uint32_t)) {
+    const uint32_t* input_element = (const uint32_t*) input;
+    uint32_t* output_element = (uint32_t*) output;
+    for (size_t n = 0; n < num_elements; n++) {
+      *output_element++ = *input_element;
+      input_element = (const uint32_t*) ((uintptr_t) input_element + input_element_stride);
+    }
+  } else {
+    assert(context->row_size == sizeof(uint8_t));
+    const uint8_t* input_element = (const uint8_t*) input;
+    uint8_t* output_element = (uint8_t*) output;
+    for (size_t n = 0; n < num_elements; n++) {
+      *output_element++ = *input_element;
+      input_element += input_element_stride;
+    }
+  }
+}
+
+void xnn_compute_gather(
+    const struct gather_context context[restrict XNN_MIN_ELEMENTS(1)],
+    size_t batch_index,
+    size_t index_start,
+    size_t index_range)
+{
+  const void* input = (const void*) ((uintptr_t) context->input + batch_index * context->input_batch_stride);
+  void* output = (void*) ((uintptr_t) context->output +
+    batch_index * context->output_batch_stride + index_start * context->output_row_size);
+  const int32_t* indices = context->indices + index_start;
+  const size_t input_row_size = context->input_row_size;
+  const size_t output_row_size = context->output_row_size;
+  const size_t prefetch_size = context->prefetch_size;
+
+  for (size_t i = 0; i < index_range; i++) {
+    // Indices are validated by xnn_validate_operator_inputs before the operator runs.
+    assert(indices[i] >= 0);
+    assert((size_t) indices[i] < context->axis_size);
+    // Rows are scattered in memory, and hardware prefetchers can't predict the next one.
+    if (i + 1 < index_range) {
+      const uintptr_t next_row = (uintptr_t) input + (size_t) indices[i + 1] * input_row_size;
+      for (size_t offset = 0; offset < prefetch_size; offset += 64) {
+        xnn_prefetch_to_l1((const void*) (next_row + offset));
+      }
+    }
+    const void* row = (const void*) ((uintptr_t) input + (size_t) indices[i] * input_row_size);
+    context->ukernel(input_row_size, row, output, &context->params);
+    output = (void*) ((uintptr_t) output + output_row_size);
+  }
+}
+
+static void transpose_tile(
+    const struct transpose_context context[restrict XNN_MIN_ELEMENTS(1)],
+    const void* input,
+    void* output,
+    size_t input_stride,
+    size_t output_stride,
+    size_t tile_width,
+    size_t tile_height)
+{
+  if XNN_LIKELY(context->const_size_ukernel != NULL) {
+    context->const_size_ukernel(input, output, input_stride, output_stride, tile_width, tile_height);
+  } else {
+    const size_t element_size = context->element_size;
+    for (size_t x = 0; x < tile_width; x++) {
+      const void* i = (const void*) ((uintptr_t) input + x * element_size);
+      void* o = (void*) ((uintptr_t) output + x * output_stride);
+      for (size_t y = 0; y < tile_height; y++) {
+        memcpy(o, i, element_size);
+        i = (const void*) ((uintptr_t) i + input_stride);
+        o = (void*) ((uintptr_t) o + element_size);
+      }
+    }
+  }
+}
+
+void xnn_compute_transpose_2d(
+    const struct transpose_context context[restrict XNN_MIN_ELEMENTS(1)],
+    size_t i, size_t j,
+    size_t tile_i, size_t tile_j)
+{
+  const void* input = (const void*) ((uintptr_t) context->input +
+    i * context->input_stride[0] + j * context->input_stride[1]);
+  void* output = (void*) ((uintptr_t) context->output +
+    i * context->output_stride[0] + j * context->output_stride[1]);
+
+  transpose_tile(context, input, output, context->input_stride[1], context->output_stride[0], tile_i, tile_j);
+}
+
+void xnn_compute_transpose_3d(
+    const struct transpose_context context[restrict XNN_MIN_ELEMENTS(1)],
+    size_t i, size_t j, size_t k,
+    size_t tile_j, size_t tile_k)
+{
+  const void* input = (const void*) ((uintptr_t) context->input +
+    i * context->input_stride[0] + j * context->input_stride[1] + k * context->input_stride[2]);
+  void* output = (void*) ((uintptr_t) context->output +
+    i * context->output_stride[0] + j * context->output_stride[1] + k * context->output_stride[2]);
+
+  transpose_tile(context, input, output, context->input_stride[2], context->output_stride[1], tile_j, tile_k);
+}
+
+void xnn_compute_transpose_4d(
+    const struct transpose_context context[restrict XNN_MIN_ELEMENTS(1)],
+    size_t i, size_t j, size_t k, size_t l,
+    size_t tile_k, size_t tile_l)
+{
+  const void* input = (const void*) ((uintptr_t) context->input +
+    i * context->input_stride[0] + j * context->input_stride[1] + k * context->input_stride[2] + l * context->input_stride[3]);
+  void* output = (void*) ((uintptr_t) context->output +
+    i * context->output_stride[0] + j * context->output_stride[1] + k * context->output_stride[2] + l * context->output_stride[3]);
+
+  transpose_tile(context, input, output, context->input_stride[3], context->output_stride[2], tile_k, tile_l);
+}
+
+void xnn_compute_transpose_5d(
+    const struct transpose_context context[restrict XNN_MIN_ELEMENTS(1)],
+    size_t i, size_t j, size_t k, size_t l, size_t m,
+    size_t tile_l, size_t tile_m)
+{
+  const void* input = (const void*) ((uintptr_t) context->input +
+    i * context->input_stride[0] + j * context->input_stride[1] + k * context->input_stride[2] +
+    l * context->input_stride[3] + m * context->input_stride[4]);
+  void* output = (void*) ((uintptr_t) context->output +
+    i * context->output_stride[0] + j * context->output_stride[1] + k * context->output_stride[2] +
+    l * context->output_stride[3] + m * context->output_stride[4]);
+
+  transpose_tile(context, input, output, context->input_stride[4], context->output_stride[3], tile_l, tile_m);
+}
+
+void xnn_compute_transpose_6d(
+    const struct transpose_context context[restrict XNN_MIN_ELEMENTS(1)],
+    size_t i, size_t j, size_t k, size_t l, size_t m, size_t n,
+    size_t tile_m, size_t tile_n)
+{
+  const void* input = (const void*) ((uintptr_t) context->input +
+    i * context->input_stride[0] + j * context->input_stride[1] + k * context->input_stride[2] +
+    l * context->input_stride[3] + m * context->input_stride[4] + n * context->input_stride[5]);
+  void* output = (void*) ((uintptr_t) context->output +
+    i * context->output_stride[0] + j * context->output_stride[1] + k * context->output_stride[2] +
+    l * context->output_stride[3] + m * context->output_stride[4] + n * context->output_stride[5]);
+
+  transpose_tile(context, input, output, context->input_stride[5], context->output_stride[4], tile_m, tile_n);
+}
+
 void xnn_compute_elementwise_binary_5d(
     const struct elementwise_binary_context context[restrict XNN_MIN_ELEMENTS(1)],
     size_t i, size_t j, size_t k, size_t l, size_t m)
@@ -882,6 +1157,23 @@ void xnn_compute_f32_three_pass_softmax(
   context->vmulc_ukernel(n, y, &y_scale, y, &context->minmax_params);
 }
 
+void xnn_compute_f32_layer_normalization(
+    const struct layer_normalization_context context[restrict XNN_MIN_ELEMENTS(1)],
+    size_t batch_index)
+{
+  const float* x = (const float*) ((uintptr_t) context->x + context->x_stride * batch_index);
+  float* y = (float*) ((uintptr_t) context->y + context->y_stride * batch_index);
+  const size_t n = context->n;
+
+  // First pass: reduce to mean & variance
+  float x_mean, x_variance;
+  context->rmeanvar_ukernel(n, x, &x_mean, &x_variance);
+
+  // Second pass: normalize, scale & shift
+  const float x_inv_stddev = 1.0f / sqrtf(x_variance + context->epsilon);
+  context->vnormcaddc_ukernel(n, x, &x_mean, &x_inv_stddev, context->w, y, &context->params);
+}
+
 void xnn_compute_vmulcaddc(
     const struct vmulcaddc_context context[restrict XNN_MIN_ELEMENTS(1)],
     size_t batch_start,
@@ -1062,231 +1354,277 @@ void xnn_compute_vmulcaddc(
   }
 #endif  // XNN_MAX_UARCH_TYPES > 1
 
-enum xnn_status xnn_run_operator(xnn_operator_t op, pthreadpool_t threadpool)
+static void run_compute(
+    const struct compute_parameters* compute,
+    void* context,
+    pthreadpool_t threadpool,
+    uint32_t flags)
 {
-  if ((xnn_params.init_flags & XNN_INIT_FLAG_XNNPACK) == 0) {
-    xnn_log_error("failed to run operator: XNNPACK is not initialized");
-    return xnn_status_uninitialized;
-  }
-  switch (op->state) {
-    case xnn_run_state_invalid:
-      xnn_log_error("failed to run operator: operator was not successfully setup");
-      return xnn_status_invalid_state;
-    case xnn_run_state_ready:
-      break;
-    case xnn_run_state_skip:
-      return xnn_status_success;
-  }
-
-  uint32_t flags = PTHREADPOOL_FLAG_DISABLE_DENORMALS;
-  if (op->flags & XNN_FLAG_YIELD_WORKERS) {
-    flags |= PTHREADPOOL_FLAG_YIELD_WORKERS;
-  }
-  switch (op->compute.type) {
+  switch (compute->type) {
     case xnn_parallelization_type_invalid:
       break;
     case xnn_parallelization_type_1d:
-      assert(op->compute.range[0] != 0);
+      assert(compute->range[0] != 0);
       pthreadpool_parallelize_1d(
           threadpool,
-          op->compute.task_1d,
-          &op->context,
-          op->compute.range[0],
+          compute->task_1d,
+          context,
+          compute->range[0],
           flags);
       break;
     case xnn_parallelization_type_1d_tile_1d:
-      assert(op->compute.range[0] != 0);
-      assert(op->compute.tile[0] != 0);
+      assert(compute->range[0] != 0);
+      assert(compute->tile[0] != 0);
       pthreadpool_parallelize_1d_tile_1d(
           threadpool,
-          op->compute.task_1d_tile_1d,
-          &op->context,
-          op->compute.range[0],
-          op->compute.tile[0],
+          compute->task_1d_tile_1d,
+          context,
+          compute->range[0],
+          compute->tile[0],
           flags);
       break;
     case xnn_parallelization_type_2d:
-      assert(op->compute.range[0] != 0);
-      assert(op->compute.range[1] != 0);
+      assert(compute->range[0] != 0);
+      assert(compute->range[1] != 0);
       pthreadpool_parallelize_2d(
           threadpool,
-          op->compute.task_2d,
-          &op->context,
-          op->compute.range[0], op->compute.range[1],
+          compute->task_2d,
+          context,
+          compute->range[0], compute->range[1],
           flags);
       break;
     case xnn_parallelization_type_2d_tile_1d:
-      assert(op->compute.range[0] != 0);
-      assert(op->compute.range[1] != 0);
-      assert(op->compute.tile[0] != 0);
+      assert(compute->range[0] != 0);
+      assert(compute->range[1] != 0);
+      assert(compute->tile[0] != 0);
       pthreadpool_parallelize_2d_tile_1d(
           threadpool,
-          op->compute.task_2d_tile_1d,
-          &op->context,
-          op->compute.range[0], op->compute.range[1],
-          op->compute.tile[0],
+          compute->task_2d_tile_1d,
+          context,
+          compute->range[0], compute->range[1],
+          compute->tile[0],
           flags);
       break;
     case xnn_parallelization_type_2d_tile_2d:
-      assert(op->compute.range[0] != 0);
-      assert(op->compute.range[1] != 0);
-      assert(op->compute.tile[0] != 0);
-      assert(op->compute.tile[1] != 0);
+      assert(compute->range[0] != 0);
+      assert(compute->range[1] != 0);
+      assert(compute->tile[0] != 0);
+      assert(compute->tile[1] != 0);
       pthreadpool_parallelize_2d_tile_2d(
           threadpool,
-          op->compute.task_2d_tile_2d,
-          &op->context,
-          op->compute.range[0], op->compute.range[1],
-          op->compute.tile[0], op->compute.tile[1],
+          compute->task_2d_tile_2d,
+          context,
+          compute->range[0], compute->range[1],
+          compute->tile[0], compute->tile[1],
           flags);
       break;
     case xnn_parallelization_type_3d:
-      assert(op->compute.range[0] != 0);
-      assert(op->compute.range[1] != 0);
-      assert(op->compute.range[2] != 0);
+      assert(compute->range[0] != 0);
+      assert(compute->range[1] != 0);
+      assert(compute->range[2] != 0);
       pthreadpool_parallelize_3d(
           threadpool,
-          op->compute.task_3d,
-          &op->context,
-          op->compute.range[0], op->compute.range[1], op->compute.range[2],
+          compute->task_3d,
+          context,
+          compute->range[0], compute->range[1], compute->range[2],
           flags);
       break;
     case xnn_parallelization_type_3d_tile_2d:
-      assert(op->compute.range[0] != 0);
-      assert(op->compute.range[1] != 0);
-      assert(op->compute.range[2] != 0);
-      assert(op->compute.tile[0] != 0);
-      assert(op->compute.tile[1] != 0);
+      assert(compute->range[0] != 0);
+      assert(compute->range[1] != 0);
+      assert(compute->range[2] != 0);
+      assert(compute->tile[0] != 0);
+      assert(compute->tile[1] != 0);
       pthreadpool_parallelize_3d_tile_2d(
           threadpool,
-          op->compute.task_3d_tile_2d,
-          &op->context,
-          op->compute.range[0], op->compute.range[1], op->compute.range[2],
-          op->compute.tile[0], op->compute.tile[1],
+          compute->task_3d_tile_2d,
+          context,
+          compute->range[0], compute->range[1], compute->range[2],
+          compute->tile[0], compute->tile[1],
           flags);
       break;
     case xnn_parallelization_type_4d:
-      assert(op->compute.range[0] != 0);
-      assert(op->compute.range[1] != 0);
-      assert(op->compute.range[2] != 0);
-      assert(op->compute.range[3] != 0);
+      assert(compute->range[0] != 0);
+      assert(compute->range[1] != 0);
+      assert(compute->range[2] != 0);
+      assert(compute->range[3] != 0);
       pthreadpool_parallelize_4d(
           threadpool,
-          op->compute.task_4d,
-          &op->context,
-          op->compute.range[0], op->compute.range[1], op->compute.range[2], op->compute.range[3],
+          compute->task_4d,
+          context,
+          compute->range[0], compute->range[1], compute->range[2], compute->range[3],
           flags);
       break;
     case xnn_parallelization_type_4d_tile_2d:
-      assert(op->compute.range[0] != 0);
-      assert(op->compute.range[1] != 0);
-      assert(op->compute.range[2] != 0);
-      assert(op->compute.range[3] != 0);
-      assert(op->compute.tile[0] != 0);
-      assert(op->compute.tile[1] != 0);
+      assert(compute->range[0] != 0);
+      assert(compute->range[1] != 0);
+      assert(compute->range[2] != 0);
+      assert(compute->range[3] != 0);
+      assert(compute->tile[0] != 0);
+      assert(compute->tile[1] != 0);
       pthreadpool_parallelize_4d_tile_2d(
           threadpool,
-          op->compute.task_4d_tile_2d,
-          &op->context,
-          op->compute.range[0], op->compute.range[1], op->compute.range[2], op->compute.range[3],
-          op->compute.tile[0], op->compute.tile[1],
+          compute->task_4d_tile_2d,
+          context,
+          compute->range[0], compute->range[1], compute->range[2], compute->range[3],
+          compute->tile[0], compute->tile[1],
           flags);
       break;
     case xnn_parallelization_type_5d:
-      assert(op->compute.range[0] != 0);
-      assert(op->compute.range[1] != 0);
-      assert(op->compute.range[2] != 0);
-      assert(op->compute.range[3] != 0);
-      assert(op->compute.range[4] != 0);
+      assert(compute->range[0] != 0);
+      assert(compute->range[1] != 0);
+      assert(compute->range[2] != 0);
+      assert(compute->range[3] != 0);
+      assert(compute->range[4] != 0);
       pthreadpool_parallelize_5d(
           threadpool,
-          op->compute.task_5d,
-          &op->context,
-          op->compute.range[0], op->compute.range[1], op->compute.range[2], op->compute.range[3], op->compute.range[4],
+          compute->task_5d,
+          context,
+          compute->range[0], compute->range[1], compute->range[2], compute->range[3], compute->range[4],
           flags);
       break;
     case xnn_parallelization_type_5d_tile_2d:
-      assert(op->compute.range[0] != 0);
-      assert(op->compute.range[1] != 0);
-      assert(op->compute.range[2] != 0);
-      assert(op->compute.range[3] != 0);
-      assert(op->compute.range[4] != 0);
-      assert(op->compute.tile[0] != 0);
-      assert(op->compute.tile[1] != 0);
+      assert(compute->range[0] != 0);
+      assert(compute->range[1] != 0);
+      assert(compute->range[2] != 0);
+      assert(compute->range[3] != 0);
+      assert(compute->range[4] != 0);
+      assert(compute->tile[0] != 0);
+      assert(compute->tile[1] != 0);
       pthreadpool_parallelize_5d_tile_2d(
           threadpool,
-          op->compute.task_5d_tile_2d,
-          &op->context,
-          op->compute.range[0], op->compute.range[1], op->compute.range[2], op->compute.range[3], op->compute.range[4],
-          op->compute.tile[0], op->compute.tile[1],
+          compute->task_5d_tile_2d,
+          context,
+          compute->range[0], compute->range[1], compute->range[2], compute->range[3], compute->range[4],
+          compute->tile[0], compute->tile[1],
           flags);
       break;
     case xnn_parallelization_type_6d_tile_2d:
-      assert(op->compute.range[0] != 0);
-      assert(op->compute.range[1] != 0);
-      assert(op->compute.range[2] != 0);
-      assert(op->compute.range[3] != 0);
-      assert(op->compute.range[4] != 0);
-      assert(op->compute.range[5] != 0);
-      assert(op->compute.tile[0] != 0);
-      assert(op->compute.tile[1] != 0);
+      assert(compute->range[0] != 0);
+      assert(compute->range[1] != 0);
+      assert(compute->range[2] != 0);
+      assert(compute->range[3] != 0);
+      assert(compute->range[4] != 0);
+      assert(compute->range[5] != 0);
+      assert(compute->tile[0] != 0);
+      assert(compute->tile[1] != 0);
       pthreadpool_parallelize_6d_tile_2d(
           threadpool,
-          op->compute.task_6d_tile_2d,
-          &op->context,
-          op->compute.range[0], op->compute.range[1], op->compute.range[2], op->compute.range[3], op->compute.range[4], op->compute.range[5],
-          op->compute.tile[0], op->compute.tile[1],
+          compute->task_6d_tile_2d,
+          context,
+          compute->range[0], compute->range[1], compute->range[2], compute->range[3], compute->range[4], compute->range[5],
+          compute->tile[0], compute->tile[1],
           flags);
       break;
 #if XNN_MAX_UARCH_TYPES > 1
     case xnn_parallelization_type_2d_tile_2d_with_uarch:
-      assert(op->compute.range[0] != 0);
-      assert(op->compute.range[1] != 0);
-      assert(op->compute.tile[0] != 0);
-      assert(op->compute.tile[1] != 0);
+      assert(compute->range[0] != 0);
+      assert(compute->range[1] != 0);
+      assert(compute->tile[0] != 0);
+      assert(compute->tile[1] != 0);
       pthreadpool_parallelize_2d_tile_2d_with_uarch(
           threadpool,
-          op->compute.task_2d_tile_2d_with_id,
-          &op->context,
+          compute->task_2d_tile_2d_with_id,
+          context,
           0 /* default uarch index */, XNN_MAX_UARCH_TYPES - 1,
-          op->compute.range[0], op->compute.range[1],
-          op->compute.tile[0], op->compute.tile[1],
+          compute->range[0], compute->range[1],
+          compute->tile[0], compute->tile[1],
           flags);
       break;
     case xnn_parallelization_type_3d_tile_2d_with_uarch:
-      assert(op->compute.range[0] != 0);
-      assert(op->compute.range[1] != 0);
-      assert(op->compute.range[2] != 0);
-      assert(op->compute.tile[0] != 0);
-      assert(op->compute.tile[1] != 0);
+      assert(compute->range[0] != 0);
+      assert(compute->range[1] != 0);
+      assert(compute->range[2] != 0);
+      assert(compute->tile[0] != 0);
+      assert(compute->tile[1] != 0);
       pthreadpool_parallelize_3d_tile_2d_with_uarch(
           threadpool,
-          op->compute.task_3d_tile_2d_with_id,
-          &op->context,
+          compute->task_3d_tile_2d_with_id,
+          context,
           0 /* default uarch index */, XNN_MAX_UARCH_TYPES - 1,
-          op->compute.range[0], op->compute.range[1], op->compute.range[2],
-          op->compute.tile[0], op->compute.tile[1],
+          compute->range[0], compute->range[1], compute->range[2],
+          compute->tile[0], compute->tile[1],
           flags);
       break;
     case xnn_parallelization_type_4d_tile_2d_with_uarch:
-      assert(op->compute.range[0] != 0);
-      assert(op->compute.range[1] != 0);
-      assert(op->compute.range[2] != 0);
-      assert(op->compute.range[3] != 0);
-      assert(op->compute.tile[0] != 0);
-      assert(op->compute.tile[1] != 0);
+      assert(compute->range[0] != 0);
+      assert(compute->range[1] != 0);
+      assert(compute->range[2] != 0);
+      assert(compute->range[3] != 0);
+      assert(compute->tile[0] != 0);
+      assert(compute->tile[1] != 0);
       pthreadpool_parallelize_4d_tile_2d_with_uarch(
           threadpool,
-          op->compute.task_4d_tile_2d_with_id,
-          &op->context,
+          compute->task_4d_tile_2d_with_id,
+          context,
           0 /* default uarch index */, XNN_MAX_UARCH_TYPES - 1,
-          op->compute.range[0], op->compute.range[1], op->compute.range[2], op->compute.range[3],
-          op->compute.tile[0], op->compute.tile[1],
+          compute->range[0], compute->range[1], compute->range[2], compute->range[3],
+          compute->tile[0], compute->tile[1],
           flags);
       break;
 #endif  // XNN_MAX_UARCH_TYPES > 1
     default:
       XNN_UNREACHABLE;
   }
+}
+
+enum xnn_status xnn_validate_operator_inputs(const struct xnn_operator* op)
+{
+  switch (op->type) {
+    case xnn_operator_type_gather_nd_qs8_f32:
+    case xnn_operator_type_gather_nd_qu8_f32:
+    case xnn_operator_type_gather_nd_x8:
+    case xnn_operator_type_gather_nd_x32:
+    {
+      // Indices may be produced by other operators, and are only known when the operator runs.
+      const struct gather_context* context = &op->context.gather;
+      const int32_t* indices = context->indices;
+      const size_t axis_size = context->axis_size;
+      for (size_t i = 0; i < context->num_indices; i++) {
+        if XNN_UNLIKELY(indices[i] < 0 || (size_t) indices[i] >= axis_size) {
+          xnn_log_error(
+            "failed to run %s operator: index #%zu (%" PRId32 ") is outside of the [0, %zu) range",
+            xnn_operator_type_to_string(op->type), i, indices[i], axis_size);
+          return xnn_status_invalid_parameter;
+        }
+      }
+      break;
+    }
+    default:
+      break;
+  }
+  return xnn_status_success;
+}
+
+enum xnn_status xnn_run_operator(xnn_operator_t op, pthreadpool_t threadpool)
+{
+  if ((xnn_params.init_flags & XNN_INIT_FLAG_XNNPACK) == 0) {
+    xnn_log_error("failed to run operator: XNNPACK is not initialized");
+    return xnn_status_uninitialized;
+  }
+  switch (op->state) {
+    case xnn_run_state_invalid:
+      xnn_log_error("failed to run operator: operator was not successfully setup");
+      return xnn_status_invalid_state;
+    case xnn_run_state_ready:
+      break;
+    case xnn_run_state_skip:
+      return xnn_status_success;
+  }
+
+  const enum xnn_status status = xnn_validate_operator_inputs(op);
+  if (status != xnn_status_success) {
+    return status;
+  }
+
+  uint32_t flags = PTHREADPOOL_FLAG_DISABLE_DENORMALS;
+  if (op->flags & XNN_FLAG_YIELD_WORKERS) {
+    flags |= PTHREADPOOL_FLAG_YIELD_WORKERS;
+  }
+  run_compute(&op->compute, (void*) ((uintptr_t) &op->context + op->compute.context_offset), threadpool, flags);
+  for (size_t i = 0; i < XNN_MAX_EXTRA_COMPUTE; i++) {
+    const struct compute_parameters* compute = &op->extra_compute[i];
+    run_compute(compute, (void*) ((uintptr_t) &op->context + compute->context_offset), threadpool, flags);
+  }
   return xnn_status_success;
 }
@@ -12,8 +12,6 @@
 #include <xnnpack/subgraph.h>
 
 
-// This function is defined inline when logging is disabled
-#if XNN_LOG_LEVEL > 0
 const char* xnn_operator_type_to_string(enum xnn_operator_type type) {
   switch (type) {
     case xnn_operator_type_invalid:
@@ -36,6 +34,8 @@ const char* xnn_operator_type_to_string(enum xnn_operator_type type) {
       return "Average Pooling (NHWC, QU8)";
     case xnn_operator_type_bankers_rounding_nc_f32:
       return "Bankers Rounding (NC, F32)";
+    case xnn_operator_type_batch_matrix_multiply_nc_f32:
+      return "Batch Matrix Multiply (NC, F32)";
     case xnn_operator_type_ceiling_nc_f32:
       return "Ceiling (NC, F32)";
     case xnn_operator_type_channel_shuffle_nc_x8:
@@ -76,6 +76,8 @@ const char* xnn_operator_type_to_string(enum xnn_operator_type type) {
       return "Convolution (NHWC, QU8)";
     case xnn_operator_type_convolution_nchw_f32:
       return "Convolution (NCHW, F32)";
+    case xnn_operator_type_copy_nc_x8:
+      return "Copy (NC, X8)";
     case xnn_operator_type_copy_nc_x32:
       return "Copy (NC, X32)";
     case xnn_operator_type_deconvolution_nhwc_f32:
@@ -96,6 +98,16 @@ const char* xnn_operator_type_to_string(enum xnn_operator_type type) {
       return "ELU (NC, QS8)";
     case xnn_operator_type_floor_nc_f32:
       return "Floor (NC, F32)";
+    case xnn_operator_type_gather_nd_qs8_f32:
+      return "Gather (ND, QS8, F32)";
+    case xnn_operator_type_gather_nd_qu8_f32:
+      return "Gather (ND, QU8, F32)";
+    case xnn_operator_type_gather_nd_x8:
+      return "Gather (ND, X8)";
+    case xnn_operator_type_gather_nd_x32:
+      return "Gather (ND, X32)";
+    case xnn_operator_type_gelu_nc_f32:
+      return "GELU (NC, F32)";
     case xnn_operator_type_fully_connected_nc_f16:
       return "Fully Connected (NC, F16)";
     case xnn_operator_type_fully_connected_nc_f32:
@@ -118,6 +130,8 @@ const char* xnn_operator_type_to_string(enum xnn_operator_type type) {
       return "HardSwish (NC, F16)";
     case xnn_operator_type_hardswish_nc_f32:
       return "HardSwish (NC, F32)";
+    case xnn_operator_type_layer_normalization_nc_f32:
+      return "Layer Normalization (NC, F32)";
     case xnn_operator_type_leaky_relu_nc_f32:
       return "Leaky ReLU (NC, F32)";
     case xnn_operator_type_leaky_relu_nc_qu8:
@@ -150,6 +164,10 @@ const char* xnn_operator_type_to_string(enum xnn_operator_type type) {
       return "Resize Bilinear (NHWC, S8)";
     case xnn_operator_type_resize_bilinear_nhwc_u8:
       return "Resize Bilinear (NHWC, U8)";
+    case xnn_operator_type_reduce_nd_f32:
+      return "Reduce (ND, F32)";
+    case xnn_operator_type_reduce_nd_qs8:
+      return "Reduce (ND, QS8)";
     case xnn_operator_type_resize_bilinear_nchw_f32:
       return "Resize Bilinear (NCHW, F32)";
     case xnn_operator_type_sigmoid_nc_f32:
@@ -158,6 +176,10 @@ const char* xnn_operator_type_to_string(enum xnn_operator_type type) {
       return "Sigmoid (NC, QS8)";
     case xnn_operator_type_sigmoid_nc_qu8:
       return "Sigmoid (NC, QU8)";
+    case xnn_operator_type_slice_nd_x8:
+      return "Slice (ND, X8)";
+    case xnn_operator_type_slice_nd_x32:
+      return "Slice (ND, X32)";
     case xnn_operator_type_softmax_nc_f32:
       return "Softmax (NC, F32)";
     case xnn_operator_type_softmax_nc_qu8:
@@ -174,10 +196,18 @@ const char* xnn_operator_type_to_string(enum xnn_operator_type type) {
       return "Subtract (ND, QS8)";
     case xnn_operator_type_subtract_nd_qu8:
       return "Subtract (ND, QU8)";
+    case xnn_operator_type_tanh_nc_f32:
+      return "Tanh (NC, F32)";
     case xnn_operator_type_tanh_nc_qs8:
       return "Tanh (NC, QS8)";
     case xnn_operator_type_tanh_nc_qu8:
       return "Tanh (NC, QU8)";
+    case xnn_operator_type_transpose_nd_x8:
+      return "Transpose (ND, X8)";
+    case xnn_operator_type_transpose_nd_x16:
+      return "Transpose (ND, X16)";
+    case xnn_operator_type_transpose_nd_x32:
+      return "Transpose (ND, X32)";
     case xnn_operator_type_truncation_nc_f32:
       return "Truncation (NC, F32)";
     case xnn_operator_type_unpooling_nhwc_x32:
@@ -186,4 +216,3 @@ const char* xnn_operator_type_to_string(enum xnn_operator_type type) {
   XNN_UNREACHABLE;
   return NULL;
 }
-#endif  // XNN_LOG_LEVEL > 0
@@ -0,0 +1,213 @@
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+#include <math.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <xnnpack.h>
+#include <xnnpack/allocator.h>
+#include <xnnpack/compute.h>
+#include <xnnpack/log.h>
+#include <xnnpack/math.h>
+#include <xnnpack/operator.h>
+#include <xnnpack/params.h>
+
+
+enum xnn_status xnn_create_batch_matrix_multiply_nc_f32(
+    uint32_t flags,
+    xnn_operator_t* batch_matrix_multiply_op_out)
+{
+  xnn_operator_t batch_matrix_multiply_op = NULL;
+  enum xnn_status status = xnn_status_uninitialized;
+
+  if ((xnn_params.init_flags & XNN_INIT_FLAG_XNNPACK) == 0) {
+    xnn_log_error("failed to create %s operator: XNNPACK is not initialized",
+      xnn_operator_type_to_string(xnn_operator_type_batch_matrix_multiply_nc_f32));
+    goto error;
+  }
+
+  status = xnn_status_unsupported_hardware;
+
+  if ((xnn_params.init_flags & XNN_INIT_FLAG_F32) == 0) {
+    xnn_log_error(
+      "failed to create %s operator: operations on data type are not supported",
+      xnn_operator_type_to_string(xnn_operator_type_batch_matrix_multiply_nc_f32));
+    goto error;
+  }
+
+  status = xnn_status_out_of_memory;
+
+  batch_matrix_multiply_op = xnn_allocate_zero_simd_memory(sizeof(struct xnn_operator));
+  if (batch_matrix_multiply_op == NULL) {
+    xnn_log_error(
+      "failed to allocate %zu bytes for %s operator descriptor",
+      sizeof(struct xnn_operator), xnn_operator_type_to_string(xnn_operator_type_batch_matrix_multiply_nc_f32));
+    goto error;
+  }
+
+  // The right-hand operand is packed without bias, and the output is not clamped: prefer micro-kernels with linear
+  // activation, and fall back to min-max micro-kernels with an infinite output range.
+  const struct gemm_fused_ukernels* gemm_ukernels = &xnn_params.f32.gemm.minmax;
+  if (xnn_params.f32.gemm.linear.gemm.function[XNN_UARCH_DEFAULT] != NULL) {
+    gemm_ukernels = &xnn_params.f32.gemm.linear;
+  }
+  if XNN_LIKELY(xnn_params.f32.gemm.init.f32 != NULL) {
+    xnn_params.f32.gemm.init.f32(&batch_matrix_multiply_op->params.f32_minmax, -INFINITY, INFINITY);
+  }
+
+  batch_matrix_multiply_op->ukernel.type = xnn_ukernel_type_gemm;
+  batch_matrix_multiply_op->ukernel.gemm = (struct xnn_ukernel_gemm) {
+    .general_case = gemm_ukernels->gemm,
+    .mr1_case = gemm_ukernels->gemm1,
+    .mr = xnn_params.f32.gemm.mr,
+    .nr = xnn_params.f32.gemm.nr,
+    .kr = UINT32_C(1) << xnn_params.f32.gemm.log2_kr,
+  };
+
+  batch_matrix_multiply_op->type = xnn_operator_type_batch_matrix_multiply_nc_f32;
+  batch_matrix_multiply_op->flags = flags;
+
+  batch_matrix_multiply_op->state = xnn_run_state_invalid;
+
+  *batch_matrix_multiply_op_out = batch_matrix_multiply_op;
+  return xnn_status_success;
+
+error:
+  xnn_delete_operator(batch_matrix_multiply_op);
+  return status;
+}
+
+enum xnn_status xnn_setup_batch_matrix_multiply_nc_f32(
+    xnn_operator_t batch_matrix_multiply_op,
+    size_t batch_size,
+    size_t m,
+    size_t k,
+    size_t n,
+    const float* input_a,
+    const float* input_b,
+    float* output,
+    pthreadpool_t threadpool)
+{
+  if (batch_matrix_multiply_op->type != xnn_operator_type_batch_matrix_multiply_nc_f32) {
+    xnn_log_error("failed to setup operator: operator type mismatch (expected %s, got %s)",
+      xnn_operator_type_to_string(xnn_operator_type_batch_matrix_multiply_nc_f32),
+      xnn_operator_type_to_string(batch_matrix_multiply_op->type));
+    return xnn_status_invalid_parameter;
+  }
+  batch_matrix_multiply_op->state = xnn_run_state_invalid;
+
+  if ((xnn_params.init_flags & XNN_INIT_FLAG_XNNPACK) == 0) {
+    xnn_log_error("failed to setup %s operator: XNNPACK is not initialized",
+      xnn_operator_type_to_string(xnn_operator_type_batch_matrix_multiply_nc_f32));
+    return xnn_status_uninitialized;
+  }
+
+  if (m == 0 || k == 0 || n == 0) {
+    xnn_log_error(
+      "failed to setup %s operator with %zux%zu by %zux%zu matrices: matrix dimensions must be non-zero",
+      xnn_operator_type_to_string(xnn_operator_type_batch_matrix_multiply_nc_f32), m, k, k, n);
+    return xnn_status_invalid_parameter;
+  }
+
+  if (batch_size == 0) {
+    batch_matrix_multiply_op->state = xnn_run_state_skip;
+    return xnn_status_success;
+  }
+
+  uint32_t mr = batch_matrix_multiply_op->ukernel.gemm.mr;
+  const uint32_t nr = batch_matrix_multiply_op->ukernel.gemm.nr;
+  const uint32_t kr = batch_matrix_multiply_op->ukernel.gemm.kr;
+  const uint32_t sr = UINT32_C(1) << xnn_params.f32.gemm.log2_sr;
+
+  const size_t n_stride = round_up(n, nr);
+  const size_t k_stride = round_up_po2(k, kr);
+  const size_t w_stride = (k_stride + 1) * sizeof(float);
+  const size_t wb_stride = n_stride * w_stride;
+  const size_t packed_weights_size = batch_size * wb_stride;
+  if (packed_weights_size > batch_matrix_multiply_op->packed_weights_size) {
+    xnn_release_simd_memory(batch_matrix_multiply_op->packed_weights);
+    batch_matrix_multiply_op->packed_weights_size = 0;
+    batch_matrix_multiply_op->packed_weights = xnn_allocate_simd_memory(packed_weights_size);
+    if (batch_matrix_multiply_op->packed_weights == NULL) {
+      xnn_log_error(
+        "failed to allocate %zu bytes for %s operator packed weights",
+        packed_weights_size, xnn_operator_type_to_string(xnn_operator_type_batch_matrix_multiply_nc_f32));
+      return xnn_status_out_of_memory;
+    }
+    batch_matrix_multiply_op->packed_weights_size = packed_weights_size;
+  }
+  // Packing in xnn_run_operator writes only the elements of the right-hand operand: bias and padding stay zero.
+  memset(batch_matrix_multiply_op->packed_weights, 0, packed_weights_size);
+
+  batch_matrix_multiply_op->batch_size = batch_size;
+  batch_matrix_multiply_op->input = input_a;
+  batch_matrix_multiply_op->input2 = input_b;
+  batch_matrix_multiply_op->output = output;
+
+  struct xnn_hmp_gemm_ukernel gemm_ukernel = batch_matrix_multiply_op->ukernel.gemm.general_case;
+  if (m == 1 && batch_matrix_multiply_op->ukernel.gemm.mr1_case.function[XNN_UARCH_DEFAULT] != NULL) {
+    gemm_ukernel = batch_matrix_multiply_op->ukernel.gemm.mr1_case;
+    mr = 1;
+  }
+
+  batch_matrix_multiply_op->context.batch_gemm = (struct batch_gemm_context) {
+    .k = k,
+    .n = n,
+    .b = input_b,
+    .bb_stride = k * n * sizeof(float),
+    .transpose_b = (batch_matrix_multiply_op->flags & XNN_FLAG_TRANSPOSE_B) != 0,
+    .nr = nr,
+    .kr = kr,
+    .sr = sr,
+    .packed_w = batch_matrix_multiply_op->packed_weights,
+    .w_stride = w_stride,
+    .wb_stride = wb_stride,
+    .k_scaled = k * sizeof(float),
+    .a = input_a,
+    .a_stride = k * sizeof(float),
+    .ab_stride = m * k * sizeof(float),
+    .c = output,
+    .cm_stride = n * sizeof(float),
+    .cn_stride = nr * sizeof(float),
+    .cb_stride = m * n * sizeof(float),
+    .log2_csize = 2 /* log2(sizeof(float)) */,
+    .ukernel = gemm_ukernel,
+  };
+  memcpy(&batch_matrix_multiply_op->context.batch_gemm.params.f32, &batch_matrix_multiply_op->params.f32_minmax,
+    sizeof(batch_matrix_multiply_op->params.f32_minmax));
+
+  // Pack blocks of NR columns of the right-hand operand of every batch element in parallel.
+  batch_matrix_multiply_op->compute.type = xnn_parallelization_type_2d_tile_1d;
+  batch_matrix_multiply_op->compute.task_2d_tile_1d =
+    (pthreadpool_task_2d_tile_1d_t) xnn_compute_f32_batch_gemm_packw;
+  batch_matrix_multiply_op->compute.range[0] = batch_size;
+  batch_matrix_multiply_op->compute.range[1] = n;
+  batch_matrix_multiply_op->compute.tile[0] = nr;
+
+  const size_t num_threads = pthreadpool_get_threads_count(threadpool);
+  size_t nc = n;
+  if (num_threads > 1) {
+    const size_t num_other_tiles = batch_size * divide_round_up(m, mr);
+    const size_t target_tiles_per_thread = 5;
+    const size_t max_nc = divide_round_up(n * num_other_tiles, num_threads * target_tiles_per_thread);
+    if (max_nc < nc) {
+      nc = min(nc, divide_round_up(nc, max_nc * nr) * nr);
+    }
+  }
+  batch_matrix_multiply_op->extra_compute[0].type = xnn_parallelization_type_3d_tile_2d;
+  batch_matrix_multiply_op->extra_compute[0].task_3d_tile_2d = (pthreadpool_task_3d_tile_2d_t) xnn_compute_batch_gemm;
+  batch_matrix_multiply_op->extra_compute[0].range[0] = batch_size;
+  batch_matrix_multiply_op->extra_compute[0].range[1] = m;
+  batch_matrix_multiply_op->extra_compute[0].range[2] = n;
+  batch_matrix_multiply_op->extra_compute[0].tile[0] = mr;
+  batch_matrix_multiply_op->extra_compute[0].tile[1] = nc;
+  batch_matrix_multiply_op->state = xnn_run_state_ready;
+
+  return xnn_status_success;
+}
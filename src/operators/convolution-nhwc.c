@@ -26,6 +26,7 @@
 #include <xnnpack/operator.h>
 #include <xnnpack/pack.h>
 #include <xnnpack/params.h>
+#include <xnnpack/weights-cache.h>
 #include <xnnpack/params-init.h>
 
 
@@ -88,7 +89,9 @@ static enum xnn_status create_convolution2d_nhwc(
     xnn_pack_gemm_goi_w_function pack_gemm_goi_w,
     xnn_pack_conv_kgo_w_function pack_conv_kgo_w,
     xnn_pack_conv_goki_w_function pack_conv_goki_w,
+    xnn_pack_dconv_oki_w_function pack_dconv_oki_w,
     const void* packing_params,
+    size_t packing_params_size,
     int input_padding_byte,
     int packed_weights_padding_byte,
     size_t extra_weights_bytes,
@@ -100,13 +103,17 @@ static enum xnn_status create_convolution2d_nhwc(
     size_t dwconv_params_size,
     const void* vmulcaddc_params,
     size_t vmulcaddc_params_size,
+    const void* conv_hwc_params,
+    size_t conv_hwc_params_size,
     const struct gemm_parameters* gemm_parameters,
     const struct dwconv_parameters* dwconv_ukernel,
     const struct vmulcaddc_parameters* vmulcaddc_parameters,
+    const struct conv_hwc_parameters* conv_hwc_parameters,
     bool linear_activation,
     bool relu_activation,
     uint32_t datatype_init_flags,
     enum xnn_operator_type operator_type,
+    xnn_weights_cache_t weights_cache,
     xnn_operator_t* convolution_op_out)
 {
   xnn_operator_t convolution_op = NULL;
@@ -226,7 +233,15 @@ static enum xnn_status create_convolution2d_nhwc(
 
   enum xnn_ukernel_type ukernel_type = xnn_ukernel_type_default;
   const bool unit_subsampling = (subsampling_width | subsampling_height) == 1;
-  if (group_input_channels == 1 && group_output_channels == 1 && kernel_size == 1 && unit_subsampling && !any_padding && vmulcaddc_parameters != NULL) {
+  const bool conv_hwc_padding = (flags & XNN_FLAG_TENSORFLOW_SAME_PADDING) != 0 ||
+    (input_padding_right == 1 && (input_padding_left | input_padding_top | input_padding_bottom) <= 1);
+  if (conv_hwc_parameters != NULL && conv_hwc_parameters->ukernel_with_symm_padding != NULL &&
+      groups == 1 && group_input_channels == 3 && input_channel_stride == 3 &&
+      kernel_height == 3 && kernel_width == 3 && subsampling_height == 2 && subsampling_width == 2 &&
+      dilation_height == 1 && dilation_width == 1 && conv_hwc_padding)
+  {
+    ukernel_type = xnn_ukernel_type_conv2d_hwc;
+  } else if (group_input_channels == 1 && group_output_channels == 1 && kernel_size == 1 && unit_subsampling && !any_padding && vmulcaddc_parameters != NULL) {
     ukernel_type = xnn_ukernel_type_vmulcaddc;
   } else if (group_input_channels == 1 && group_output_channels == 1 && dwconv_ukernel != NULL)
   {
@@ -238,8 +253,65 @@ static enum xnn_status create_convolution2d_nhwc(
   }
   assert(ukernel_type != xnn_ukernel_type_default);
 
+  struct xnn_weights_cache_key cache_key = {
+    .kernel = kernel,
+    .bias = bias,
+    .scale = scale_params,
+    .kernel_size = (groups * group_output_channels * kernel_size * group_input_channels) << log2_filter_element_size,
+    .bias_size = bias != NULL ? groups * group_output_channels * bias_element_size : 0,
+    .scale_size = scale_params != NULL ? groups * group_output_channels * sizeof(float) : 0,
+    .operator_type = operator_type,
+    .ukernel_type = ukernel_type,
+    .flags = flags & (XNN_FLAG_DEPTHWISE_CONVOLUTION | XNN_FLAG_FP32_STATIC_WEIGHTS),
+    .groups = groups,
+    .group_input_channels = group_input_channels,
+    .group_output_channels = group_output_channels,
+    .kernel_height = kernel_height,
+    .kernel_width = kernel_width,
+  };
+  xnn_weights_cache_key_set_packing_params(&cache_key, packing_params, packing_params_size);
+
   size_t zero_size = 0;
   switch (ukernel_type) {
+    case xnn_ukernel_type_conv2d_hwc:
+    {
+      assert(conv_hwc_parameters != NULL);
+      assert(conv_hwc_params != NULL);
+
+      const size_t output_channel_tile = conv_hwc_parameters->output_channel_tile;
+      const size_t packed_weights_size =
+        (((kernel_size * group_input_channels) << log2_filter_element_size) + bias_element_size) *
+        round_up(group_output_channels, output_channel_tile);
+      cache_key.nr = output_channel_tile;
+      cache_key.packed_weights_size = packed_weights_size;
+      if (!xnn_weights_cache_get_operator_weights(weights_cache, &cache_key, convolution_op)) {
+        convolution_op->packed_weights = xnn_allocate_simd_memory(packed_weights_size);
+        if (convolution_op->packed_weights == NULL) {
+          xnn_log_error(
+            "failed to allocate %zu bytes for %s operator packed weights",
+            packed_weights_size, xnn_operator_type_to_string(operator_type));
+          goto error;
+        }
+        memset(convolution_op->packed_weights, packed_weights_padding_byte, packed_weights_size);
+
+        pack_dconv_oki_w(
+          group_output_channels, group_input_channels, output_channel_tile,
+          kernel_height, kernel_width,
+          kernel, bias, convolution_op->packed_weights, packing_params);
+        xnn_weights_cache_put_operator_weights(weights_cache, &cache_key, convolution_op);
+      }
+
+      memcpy(&convolution_op->params, conv_hwc_params, conv_hwc_params_size);
+
+      convolution_op->ukernel.conv2d = (struct xnn_ukernel_conv2d) {
+        .hwc_function = conv_hwc_parameters->ukernel_with_symm_padding,
+        .hwc_asymm_function = conv_hwc_parameters->ukernel_with_asymm_padding,
+        .output_height_tile = conv_hwc_parameters->output_height_tile,
+        .output_channel_tile = conv_hwc_parameters->output_channel_tile,
+      };
+      // Zero buffer spans a full input row and is allocated in setup once the input width is known.
+      break;
+    }
     case xnn_ukernel_type_vmulcaddc:
     {
       assert(vmulcaddc_parameters != NULL);
@@ -247,17 +319,22 @@ static enum xnn_status create_convolution2d_nhwc(
 
       const size_t c_stride = round_up_po2(groups, vmulcaddc_parameters->channel_tile);
       const size_t packed_weights_size = ((UINT32_C(1) << log2_filter_element_size) + bias_element_size) * c_stride;
-      convolution_op->packed_weights = xnn_allocate_simd_memory(packed_weights_size);
-      if (convolution_op->packed_weights == NULL) {
-        xnn_log_error(
-          "failed to allocate %zu bytes for %s operator packed weights",
-          packed_weights_size, xnn_operator_type_to_string(operator_type));
-        goto error;
-      }
+      cache_key.nr = vmulcaddc_parameters->channel_tile;
+      cache_key.packed_weights_size = packed_weights_size;
+      if (!xnn_weights_cache_get_operator_weights(weights_cache, &cache_key, convolution_op)) {
+        convolution_op->packed_weights = xnn_allocate_simd_memory(packed_weights_size);
+        if (convolution_op->packed_weights == NULL) {
+          xnn_log_error(
+            "failed to allocate %zu bytes for %s operator packed weights",
+            packed_weights_size, xnn_operator_type_to_string(operator_type));
+          goto error;
+        }
 
-      pack_vmulcaddc_w(
-        groups, vmulcaddc_parameters->channel_tile,
-        kernel, bias, convolution_op->packed_weights, packing_params);
+        pack_vmulcaddc_w(
+          groups, vmulcaddc_parameters->channel_tile,
+          kernel, bias, convolution_op->packed_weights, packing_params);
+        xnn_weights_cache_put_operator_weights(weights_cache, &cache_key, convolution_op);
+      }
 
       memcpy(&convolution_op->params, vmulcaddc_params, vmulcaddc_params_size);
 
@@ -274,40 +351,45 @@ static enum xnn_status create_convolution2d_nhwc(
 
       const size_t c_stride = round_up_po2(groups, dwconv_ukernel->channel_tile);
       const size_t packed_weights_size = ((kernel_size << log2_filter_element_size) + bias_element_size + extra_weights_bytes) * c_stride;
-      convolution_op->packed_weights = xnn_allocate_simd_memory(packed_weights_size);
-      if (convolution_op->packed_weights == NULL) {
-        xnn_log_error(
-          "failed to allocate %zu bytes for %s operator packed weights",
-          packed_weights_size, xnn_operator_type_to_string(operator_type));
-        goto error;
-      }
-      memset(convolution_op->packed_weights, packed_weights_padding_byte, packed_weights_size);
       memcpy(&convolution_op->params, dwconv_params, dwconv_params_size);
+      cache_key.nr = dwconv_ukernel->channel_tile;
+      cache_key.packed_weights_size = packed_weights_size;
+      if (!xnn_weights_cache_get_operator_weights(weights_cache, &cache_key, convolution_op)) {
+        convolution_op->packed_weights = xnn_allocate_simd_memory(packed_weights_size);
+        if (convolution_op->packed_weights == NULL) {
+          xnn_log_error(
+            "failed to allocate %zu bytes for %s operator packed weights",
+            packed_weights_size, xnn_operator_type_to_string(operator_type));
+          goto error;
+        }
+        memset(convolution_op->packed_weights, packed_weights_padding_byte, packed_weights_size);
+
+        if (flags & XNN_FLAG_DEPTHWISE_CONVOLUTION) {
+          pack_dwconv_hwg_w(
+            kernel_height, kernel_width,
+            groups, dwconv_ukernel->channel_tile,
+            kernel, bias, convolution_op->packed_weights,
+            dwconv_ukernel->channel_tile * extra_weights_bytes,
+            packing_params);
+        } else {
+          pack_dwconv_ghw_w(
+            kernel_height, kernel_width,
+            groups, dwconv_ukernel->channel_tile,
+            kernel, bias, convolution_op->packed_weights,
+            dwconv_ukernel->channel_tile * extra_weights_bytes,
+            packing_params);
+        }
 
-      if (flags & XNN_FLAG_DEPTHWISE_CONVOLUTION) {
-        pack_dwconv_hwg_w(
-          kernel_height, kernel_width,
-          groups, dwconv_ukernel->channel_tile,
-          kernel, bias, convolution_op->packed_weights,
-          dwconv_ukernel->channel_tile * extra_weights_bytes,
-          packing_params);
-      } else {
-        pack_dwconv_ghw_w(
-          kernel_height, kernel_width,
-          groups, dwconv_ukernel->channel_tile,
-          kernel, bias, convolution_op->packed_weights,
-          dwconv_ukernel->channel_tile * extra_weights_bytes,
-          packing_params);
-      }
-
-      if (scale_params != NULL) {
-        assert(init_scale_params != NULL);
+        if (scale_params != NULL) {
+          assert(init_scale_params != NULL);
 
-        init_scale_params(
-          groups, dwconv_ukernel->channel_tile,
-          dwconv_ukernel->channel_tile * ((kernel_size << log2_filter_element_size) + bias_element_size + extra_weights_bytes),
-          scale_params,
-          (void*) ((uintptr_t) convolution_op->packed_weights + dwconv_ukernel->channel_tile * ((kernel_size << log2_filter_element_size) + bias_element_size)));
+          init_scale_params(
+            groups, dwconv_ukernel->channel_tile,
+            dwconv_ukernel->channel_tile * ((kernel_size << log2_filter_element_size) + bias_element_size + extra_weights_bytes),
+            scale_params,
+            (void*) ((uintptr_t) convolution_op->packed_weights + dwconv_ukernel->channel_tile * ((kernel_size << log2_filter_element_size) + bias_element_size)));
+        }
+        xnn_weights_cache_put_operator_weights(weights_cache, &cache_key, convolution_op);
       }
 
       const union dwconv_fused_ukernels* ukernels = &dwconv_ukernel->minmax;
@@ -333,15 +415,22 @@ static enum xnn_status create_convolution2d_nhwc(
       const size_t k_stride = round_up_po2(group_input_channels, kr);
 
       const size_t packed_group_weights_size = ((kernel_size * k_stride << log2_filter_element_size) + bias_element_size + extra_weights_bytes) * n_stride;
-      convolution_op->packed_weights = xnn_allocate_simd_memory(packed_group_weights_size * groups);
-      if (convolution_op->packed_weights == NULL) {
-        xnn_log_error(
-          "failed to allocate %zu bytes for %s operator packed weights",
-          packed_group_weights_size * groups, xnn_operator_type_to_string(operator_type));
-        goto error;
-      }
-      memset(convolution_op->packed_weights, packed_weights_padding_byte, packed_group_weights_size * groups);
       memcpy(&convolution_op->params, gemm_params, gemm_params_size);
+      cache_key.nr = nr;
+      cache_key.kr = kr;
+      cache_key.sr = sr;
+      cache_key.packed_weights_size = packed_group_weights_size * groups;
+      const bool cached_weights = xnn_weights_cache_get_operator_weights(weights_cache, &cache_key, convolution_op);
+      if (!cached_weights) {
+        convolution_op->packed_weights = xnn_allocate_simd_memory(packed_group_weights_size * groups);
+        if (convolution_op->packed_weights == NULL) {
+          xnn_log_error(
+            "failed to allocate %zu bytes for %s operator packed weights",
+            packed_group_weights_size * groups, xnn_operator_type_to_string(operator_type));
+          goto error;
+        }
+        memset(convolution_op->packed_weights, packed_weights_padding_byte, packed_group_weights_size * groups);
+      }
 
       const struct gemm_fused_ukernels* gemm_ukernels = &gemm_parameters->minmax;
       if (linear_activation && gemm_parameters->linear.gemm.function[XNN_UARCH_DEFAULT] != NULL) {
@@ -351,10 +440,12 @@ static enum xnn_status create_convolution2d_nhwc(
       }
       switch (ukernel_type) {
         case xnn_ukernel_type_gemm:
-          pack_gemm_goi_w(
-              groups, group_output_channels, group_input_channels,
-              nr, kr, sr,
-              kernel, bias, convolution_op->packed_weights, gemm_parameters->nr * extra_weights_bytes, packing_params);
+          if (!cached_weights) {
+            pack_gemm_goi_w(
+                groups, group_output_channels, group_input_channels,
+                nr, kr, sr,
+                kernel, bias, convolution_op->packed_weights, gemm_parameters->nr * extra_weights_bytes, packing_params);
+          }
           convolution_op->ukernel.gemm = (struct xnn_ukernel_gemm) {
             .mr = gemm_parameters->mr,
             .nr = nr,
@@ -364,16 +455,18 @@ static enum xnn_status create_convolution2d_nhwc(
           };
           break;
         case xnn_ukernel_type_igemm:
-          if (flags & XNN_FLAG_DEPTHWISE_CONVOLUTION) {
-            pack_conv_kgo_w(
-              groups, group_output_channels, kernel_size,
-              nr, kr,
-              kernel, bias, convolution_op->packed_weights, gemm_parameters->nr * extra_weights_bytes, packing_params);
-          } else {
-            pack_conv_goki_w(
-              groups, group_output_channels, kernel_size, group_input_channels,
-              nr, kr, sr,
-              kernel, bias, convolution_op->packed_weights, gemm_parameters->nr * extra_weights_bytes, packing_params);
+          if (!cached_weights) {
+            if (flags & XNN_FLAG_DEPTHWISE_CONVOLUTION) {
+              pack_conv_kgo_w(
+                groups, group_output_channels, kernel_size,
+                nr, kr,
+                kernel, bias, convolution_op->packed_weights, gemm_parameters->nr * extra_weights_bytes, packing_params);
+            } else {
+              pack_conv_goki_w(
+                groups, group_output_channels, kernel_size, group_input_channels,
+                nr, kr, sr,
+                kernel, bias, convolution_op->packed_weights, gemm_parameters->nr * extra_weights_bytes, packing_params);
+            }
           }
           convolution_op->ukernel.igemm = (struct xnn_ukernel_igemm) {
             .mr = gemm_parameters->mr,
@@ -387,7 +480,7 @@ static enum xnn_status create_convolution2d_nhwc(
           XNN_UNREACHABLE;
       }
 
-      if (scale_params != NULL) {
+      if (scale_params != NULL && !cached_weights) {
         assert(init_scale_params != NULL);
 
         void* group_weights = (void*)
@@ -402,6 +495,9 @@ static enum xnn_status create_convolution2d_nhwc(
           group_weights = (void*) ((uintptr_t) group_weights + n_stride * weights_stride);
         }
       }
+      if (!cached_weights) {
+        xnn_weights_cache_put_operator_weights(weights_cache, &cache_key, convolution_op);
+      }
 
       zero_size = XNN_EXTRA_BYTES + (k_stride << log2_input_element_size);
       break;
@@ -411,7 +507,7 @@ static enum xnn_status create_convolution2d_nhwc(
   }
 
   const bool tf_same_padding = (flags & XNN_FLAG_TENSORFLOW_SAME_PADDING) != 0 && kernel_size != 1;
-  if (any_padding || tf_same_padding) {
+  if ((any_padding || tf_same_padding) && zero_size != 0) {
     convolution_op->zero_buffer = xnn_allocate_simd_memory(zero_size);
     if (convolution_op->zero_buffer == NULL) {
       xnn_log_error(
@@ -456,7 +552,7 @@ error:
   return status;
 }
 
-enum xnn_status xnn_create_convolution2d_nhwc_qu8(
+enum xnn_status xnn_create_convolution2d_nhwc_qu8_with_cache(
     uint32_t input_padding_top,
     uint32_t input_padding_right,
     uint32_t input_padding_bottom,
@@ -483,6 +579,7 @@ enum xnn_status xnn_create_convolution2d_nhwc_qu8(
     uint8_t output_min,
     uint8_t output_max,
     uint32_t flags,
+    xnn_weights_cache_t weights_cache,
     xnn_operator_t* convolution_op_out)
 {
   if (input_scale <= 0.0f || !isnormal(input_scale)) {
@@ -560,18 +657,60 @@ enum xnn_status xnn_create_convolution2d_nhwc_qu8(
     (xnn_pack_gemm_goi_w_function) xnn_pack_qu8_gemm_goi_w,
     (xnn_pack_conv_kgo_w_function) xnn_pack_qu8_conv_kgo_w,
     (xnn_pack_conv_goki_w_function) xnn_pack_qu8_conv_goki_w,
-    &packing_params, input_zero_point /* input padding byte */, kernel_zero_point /* packed weights padding byte */,
+    (xnn_pack_dconv_oki_w_function) NULL,
+    &packing_params, sizeof(packing_params), input_zero_point /* input padding byte */, kernel_zero_point /* packed weights padding byte */,
     0 /* extra weights bytes */, NULL /* init scale params fn */, NULL /* scale params */,
     &gemm_params, sizeof(gemm_params),
     &dwconv_params, sizeof(dwconv_params),
     NULL /* vmulcaddc params */, 0,
+    NULL /* conv hwc params */, 0,
     &xnn_params.qu8.gemm, dwconv_ukernel, NULL /* vmulcaddc parameters */,
+    NULL /* conv hwc parameters */,
     false /* linear activation */, false /* relu activation */, XNN_INIT_FLAG_QU8,
     xnn_operator_type_convolution_nhwc_qu8,
+    weights_cache,
     convolution_op_out);
 }
 
-enum xnn_status xnn_create_convolution2d_nhwc_qs8(
+enum xnn_status xnn_create_convolution2d_nhwc_qu8(
+    uint32_t input_padding_top,
+    uint32_t input_padding_right,
+    uint32_t input_padding_bottom,
+    uint32_t input_padding_left,
+    uint32_t kernel_height,
+    uint32_t kernel_width,
+    uint32_t subsampling_height,
+    uint32_t subsampling_width,
+    uint32_t dilation_height,
+    uint32_t dilation_width,
+    uint32_t groups,
+    size_t group_input_channels,
+    size_t group_output_channels,
+    size_t input_channel_stride,
+    size_t output_channel_stride,
+    uint8_t input_zero_point,
+    float input_scale,
+    uint8_t kernel_zero_point,
+    float kernel_scale,
+    const uint8_t* kernel,
+    const int32_t* bias,
+    uint8_t output_zero_point,
+    float output_scale,
+    uint8_t output_min,
+    uint8_t output_max,
+    uint32_t flags,
+    xnn_operator_t* convolution_op_out)
+{
+  return xnn_create_convolution2d_nhwc_qu8_with_cache(
+    input_padding_top, input_padding_right, input_padding_bottom, input_padding_left, kernel_height,
+    kernel_width, subsampling_height, subsampling_width, dilation_height, dilation_width, groups,
+    group_input_channels, group_output_channels, input_channel_stride, output_channel_stride,
+    input_zero_point, input_scale, kernel_zero_point, kernel_scale, kernel, bias, output_zero_point,
+    output_scale, output_min, output_max, flags, NULL /* weights cache */,
+    convolution_op_out);
+}
+
+enum xnn_status xnn_create_convolution2d_nhwc_qs8_with_cache(
     uint32_t input_padding_top,
     uint32_t input_padding_right,
     uint32_t input_padding_bottom,
@@ -597,6 +736,7 @@ enum xnn_status xnn_create_convolution2d_nhwc_qs8(
     int8_t output_min,
     int8_t output_max,
     uint32_t flags,
+    xnn_weights_cache_t weights_cache,
     xnn_operator_t* convolution_op_out)
 {
   if (input_scale <= 0.0f || !isnormal(input_scale)) {
@@ -670,18 +810,59 @@ enum xnn_status xnn_create_convolution2d_nhwc_qs8(
     (xnn_pack_gemm_goi_w_function) xnn_pack_qs8_gemm_goi_w,
     (xnn_pack_conv_kgo_w_function) xnn_pack_qs8_conv_kgo_w,
     (xnn_pack_conv_goki_w_function) xnn_pack_qs8_conv_goki_w,
-    &packing_params, input_zero_point /* input padding byte */, 0 /* packed weights padding byte */,
+    (xnn_pack_dconv_oki_w_function) NULL,
+    &packing_params, sizeof(packing_params), input_zero_point /* input padding byte */, 0 /* packed weights padding byte */,
     0 /* extra weights bytes */, NULL /* init scale params fn */, NULL /* scale params */,
     &gemm_params, sizeof(gemm_params),
     &dwconv_params, sizeof(dwconv_params),
     NULL /* vmulcaddc params */, 0,
+    NULL /* conv hwc params */, 0,
     &xnn_params.qs8.gemm, dwconv_ukernel, NULL /* vmulcaddc parameters */,
+    NULL /* conv hwc parameters */,
     false /* linear activation */, false /* relu activation */, XNN_INIT_FLAG_QS8,
     xnn_operator_type_convolution_nhwc_qs8,
+    weights_cache,
     convolution_op_out);
 }
 
-enum xnn_status xnn_create_convolution2d_nhwc_qc8(
+enum xnn_status xnn_create_convolution2d_nhwc_qs8(
+    uint32_t input_padding_top,
+    uint32_t input_padding_right,
+    uint32_t input_padding_bottom,
+    uint32_t input_padding_left,
+    uint32_t kernel_height,
+    uint32_t kernel_width,
+    uint32_t subsampling_height,
+    uint32_t subsampling_width,
+    uint32_t dilation_height,
+    uint32_t dilation_width,
+    uint32_t groups,
+    size_t group_input_channels,
+    size_t group_output_channels,
+    size_t input_channel_stride,
+    size_t output_channel_stride,
+    int8_t input_zero_point,
+    float input_scale,
+    float kernel_scale,
+    const int8_t* kernel,
+    const int32_t* bias,
+    int8_t output_zero_point,
+    float output_scale,
+    int8_t output_min,
+    int8_t output_max,
+    uint32_t flags,
+    xnn_operator_t* convolution_op_out)
+{
+  return xnn_create_convolution2d_nhwc_qs8_with_cache(
+    input_padding_top, input_padding_right, input_padding_bottom, input_padding_left, kernel_height,
+    kernel_width, subsampling_height, subsampling_width, dilation_height, dilation_width, groups,
+    group_input_channels, group_output_channels, input_channel_stride, output_channel_stride,
+    input_zero_point, input_scale, kernel_scale, kernel, bias, output_zero_point, output_scale,
+    output_min, output_max, flags, NULL /* weights cache */,
+    convolution_op_out);
+}
+
+enum xnn_status xnn_create_convolution2d_nhwc_qc8_with_cache(
     uint32_t input_padding_top,
     uint32_t input_padding_right,
     uint32_t input_padding_bottom,
@@ -707,6 +888,7 @@ enum xnn_status xnn_create_convolution2d_nhwc_qc8(
     int8_t output_min,
     int8_t output_max,
     uint32_t flags,
+    xnn_weights_cache_t weights_cache,
     xnn_operator_t* convolution_op_out)
 {
   if (input_scale <= 0.0f || !isnormal(input_scale)) {
@@ -788,14 +970,55 @@ enum xnn_status xnn_create_convolution2d_nhwc_qc8(
     (xnn_pack_gemm_goi_w_function) xnn_pack_qs8_gemm_goi_w,
     (xnn_pack_conv_kgo_w_function) xnn_pack_qs8_conv_kgo_w,
     (xnn_pack_conv_goki_w_function) xnn_pack_qs8_conv_goki_w,
-    &packing_params, input_zero_point /* input padding byte */, 0 /* packed weights padding byte */,
+    (xnn_pack_dconv_oki_w_function) NULL,
+    &packing_params, sizeof(packing_params), input_zero_point /* input padding byte */, 0 /* packed weights padding byte */,
     sizeof(float) /* extra weights bytes */, xnn_init_qc8_scale_fp32_params, requantization_scale,
     &gemm_params, sizeof(gemm_params),
     &dwconv_params, sizeof(dwconv_params),
     NULL /* vmulcaddc params */, 0,
+    NULL /* conv hwc params */, 0,
     &xnn_params.qc8.gemm, dwconv_ukernel, NULL /* vmulcaddc parameters */,
+    NULL /* conv hwc parameters */,
     false /* linear activation */, false /* relu activation */, XNN_INIT_FLAG_QC8,
     xnn_operator_type_convolution_nhwc_qc8,
+    weights_cache,
+    convolution_op_out);
+}
+
+enum xnn_status xnn_create_convolution2d_nhwc_qc8(
+    uint32_t input_padding_top,
+    uint32_t input_padding_right,
+    uint32_t input_padding_bottom,
+    uint32_t input_padding_left,
+    uint32_t kernel_height,
+    uint32_t kernel_width,
+    uint32_t subsampling_height,
+    uint32_t subsampling_width,
+    uint32_t dilation_height,
+    uint32_t dilation_width,
+    uint32_t groups,
+    size_t group_input_channels,
+    size_t group_output_channels,
+    size_t input_channel_stride,
+    size_t output_channel_stride,
+    int8_t input_zero_point,
+    float input_scale,
+    const float* kernel_scale,
+    const int8_t* kernel,
+    const int32_t* bias,
+    int8_t output_zero_point,
+    float output_scale,
+    int8_t output_min,
+    int8_t output_max,
+    uint32_t flags,
+    xnn_operator_t* convolution_op_out)
+{
+  return xnn_create_convolution2d_nhwc_qc8_with_cache(
+    input_padding_top, input_padding_right, input_padding_bottom, input_padding_left, kernel_height,
+    kernel_width, subsampling_height, subsampling_width, dilation_height, dilation_width, groups,
+    group_input_channels, group_output_channels, input_channel_stride, output_channel_stride,
+    input_zero_point, input_scale, kernel_scale, kernel, bias, output_zero_point, output_scale,
+    output_min, output_max, flags, NULL /* weights cache */,
     convolution_op_out);
 }
 
@@ -897,18 +1120,22 @@ enum xnn_status xnn_create_convolution2d_nhwc_f16(
     pack_gemm_goi_w,
     pack_conv_kgo_w,
     pack_conv_goki_w,
-    NULL /* packing params */, 0 /* input padding byte */, 0 /* packed weights padding byte */,
+    (xnn_pack_dconv_oki_w_function) NULL,
+    NULL /* packing params */, 0 /* packing params size */, 0 /* input padding byte */, 0 /* packed weights padding byte */,
     0 /* extra weights bytes */, NULL /* init scale params fn */, NULL /* scale params */,
     &gemm_params, sizeof(gemm_params),
     &dwconv_params, sizeof(dwconv_params),
     &vmulcaddc_params, sizeof(vmulcaddc_params),
+    NULL /* conv hwc params */, 0,
     &xnn_params.f16.gemm, dwconv_ukernel, &xnn_params.f16.vmulcaddc,
+    NULL /* conv hwc parameters */,
     false /* linear activation */, false /* relu activation */, XNN_INIT_FLAG_F16,
     xnn_operator_type_convolution_nhwc_f16,
+    NULL /* weights cache */,
     convolution_op_out);
 }
 
-enum xnn_status xnn_create_convolution2d_nhwc_f32(
+enum xnn_status xnn_create_convolution2d_nhwc_f32_with_cache(
     uint32_t input_padding_top,
     uint32_t input_padding_right,
     uint32_t input_padding_bottom,
@@ -929,6 +1156,7 @@ enum xnn_status xnn_create_convolution2d_nhwc_f32(
     float output_min,
     float output_max,
     uint32_t flags,
+    xnn_weights_cache_t weights_cache,
     xnn_operator_t* convolution_op_out)
 {
   if (isnan(output_min)) {
@@ -972,6 +1200,11 @@ enum xnn_status xnn_create_convolution2d_nhwc_f32(
     xnn_params.f32.vmulcaddc.init.f32(&vmulcaddc_params, output_min, output_max);
   }
 
+  union xnn_f32_minmax_params conv_hwc_params;
+  if XNN_LIKELY(xnn_params.f32.conv_hwc_3x3c3s2.init.f32 != NULL) {
+    xnn_params.f32.conv_hwc_3x3c3s2.init.f32(&conv_hwc_params, output_min, output_max);
+  }
+
   return create_convolution2d_nhwc(
     input_padding_top, input_padding_right, input_padding_bottom, input_padding_left,
     kernel_height, kernel_width,
@@ -989,14 +1222,49 @@ enum xnn_status xnn_create_convolution2d_nhwc_f32(
     (xnn_pack_gemm_goi_w_function) xnn_pack_f32_gemm_goi_w,
     (xnn_pack_conv_kgo_w_function) xnn_pack_f32_conv_kgo_w,
     (xnn_pack_conv_goki_w_function) xnn_pack_f32_conv_goki_w,
-    NULL /* packing params */, 0 /* input padding byte */, 0 /* packed weights padding byte */,
+    (xnn_pack_dconv_oki_w_function) xnn_pack_f32_dconv_oki_w,
+    NULL /* packing params */, 0 /* packing params size */, 0 /* input padding byte */, 0 /* packed weights padding byte */,
     0 /* extra weights bytes */, NULL /* init scale params fn */, NULL /* scale params */,
     &gemm_params, sizeof(gemm_params),
     &dwconv_params, sizeof(dwconv_params),
     &vmulcaddc_params, sizeof(vmulcaddc_params),
+    &conv_hwc_params, sizeof(conv_hwc_params),
     &xnn_params.f32.gemm, dwconv_ukernel, &xnn_params.f32.vmulcaddc,
+    &xnn_params.f32.conv_hwc_3x3c3s2,
     linear_activation, relu_activation, XNN_INIT_FLAG_F32,
     xnn_operator_type_convolution_nhwc_f32,
+    weights_cache,
+    convolution_op_out);
+}
+
+enum xnn_status xnn_create_convolution2d_nhwc_f32(
+    uint32_t input_padding_top,
+    uint32_t input_padding_right,
+    uint32_t input_padding_bottom,
+    uint32_t input_padding_left,
+    uint32_t kernel_height,
+    uint32_t kernel_width,
+    uint32_t subsampling_height,
+    uint32_t subsampling_width,
+    uint32_t dilation_height,
+    uint32_t dilation_width,
+    uint32_t groups,
+    size_t group_input_channels,
+    size_t group_output_channels,
+    size_t input_channel_stride,
+    size_t output_channel_stride,
+    const float* kernel,
+    const float* bias,
+    float output_min,
+    float output_max,
+    uint32_t flags,
+    xnn_operator_t* convolution_op_out)
+{
+  return xnn_create_convolution2d_nhwc_f32_with_cache(
+    input_padding_top, input_padding_right, input_padding_bottom, input_padding_left, kernel_height,
+    kernel_width, subsampling_height, subsampling_width, dilation_height, dilation_width, groups,
+    group_input_channels, group_output_channels, input_channel_stride, output_channel_stride,
+    kernel, bias, output_min, output_max, flags, NULL /* weights cache */,
     convolution_op_out);
 }
 
@@ -1077,6 +1345,69 @@ static enum xnn_status setup_convolution2d_nhwc(
   convolution_op->output = output;
 
   switch (convolution_op->ukernel.type) {
+    case xnn_ukernel_type_conv2d_hwc:
+    {
+      const size_t output_height = convolution_op->output_height;
+      const size_t output_width = convolution_op->output_width;
+
+      xnn_conv_hwc_ukernel_function conv_hwc_ukernel = convolution_op->ukernel.conv2d.hwc_function;
+      if (convolution_op->padding_left == 0) {
+        if (input_width == 1) {
+          xnn_log_error(
+            "failed to setup %s operator with %zux%zu input: input width must be greater than 1 without left padding",
+            xnn_operator_type_to_string(convolution_op->type), input_width, input_height);
+          return xnn_status_unsupported_parameter;
+        }
+        conv_hwc_ukernel = convolution_op->ukernel.conv2d.hwc_asymm_function;
+      }
+
+      const size_t zero_size = ((input_width * convolution_op->group_input_channels) << log2_input_element_size) + XNN_EXTRA_BYTES;
+      void* zero_buffer = xnn_reallocate_memory(convolution_op->zero_buffer, zero_size);
+      if (zero_buffer == NULL) {
+        xnn_log_error(
+          "failed to allocate %zu bytes for %s operator zero padding",
+          zero_size, xnn_operator_type_to_string(convolution_op->type));
+        return xnn_status_out_of_memory;
+      }
+      memset(zero_buffer, 0, zero_size);
+      convolution_op->zero_buffer = zero_buffer;
+
+      convolution_op->context.conv2d = (struct conv2d_context) {
+        .input_height = input_height,
+        .input_width = input_width,
+        .input = input,
+        .input_batch_stride = (input_height * input_width * convolution_op->input_pixel_stride) << log2_input_element_size,
+        .zero = zero_buffer,
+        .packed_weights = convolution_op->packed_weights,
+        .output = output,
+        .output_batch_stride = (output_height * output_width * convolution_op->output_pixel_stride) << log2_output_element_size,
+        .input_padding_top = convolution_op->padding_top,
+        .output_channels = convolution_op->group_output_channels,
+        .output_height_stride = (output_width * convolution_op->output_pixel_stride) << log2_output_element_size,
+        .output_width_stride = convolution_op->output_pixel_stride << log2_output_element_size,
+        .hwc_ukernel = conv_hwc_ukernel,
+      };
+      memcpy(&convolution_op->context.conv2d.params, &convolution_op->params, sizeof(convolution_op->context.conv2d.params));
+
+      size_t output_height_slice = output_height;
+      const size_t output_height_tile = convolution_op->ukernel.conv2d.output_height_tile;
+      if (num_threads > 1) {
+        const size_t target_tiles_per_thread = 5;
+        const size_t max_output_height_slice = divide_round_up(output_height, num_threads * target_tiles_per_thread);
+        if (max_output_height_slice < output_height_slice) {
+          output_height_slice = min(output_height_slice,
+            divide_round_up(output_height_slice, max_output_height_slice * output_height_tile) * output_height_tile);
+        }
+      }
+      convolution_op->compute.type = xnn_parallelization_type_2d_tile_1d;
+      convolution_op->compute.task_2d_tile_1d = (pthreadpool_task_2d_tile_1d_t) xnn_compute_conv2d_hwc;
+      convolution_op->compute.range[0] = batch_size;
+      convolution_op->compute.range[1] = output_height;
+      convolution_op->compute.tile[0] = output_height_slice;
+      convolution_op->state = xnn_run_state_ready;
+
+      return xnn_status_success;
+    }
     case xnn_ukernel_type_gemm:
     {
       // Convolution maps directly to GEMM and doesn't use indirection buffer.
@@ -22,6 +22,7 @@
 #include <xnnpack/operator.h>
 #include <xnnpack/pack.h>
 #include <xnnpack/params.h>
+#include <xnnpack/weights-cache.h>
 
 
 static enum xnn_status create_fully_connected_nc(
@@ -37,6 +38,7 @@ static enum xnn_status create_fully_connected_nc(
     xnn_pack_gemm_io_w_function pack_gemm_io_w,
     xnn_pack_gemm_goi_w_function pack_gemm_goi_w,
     const void* packing_params,
+    size_t packing_params_size,
     int packed_weights_padding_byte,
     const void* params,
     size_t params_size,
@@ -44,6 +46,7 @@ static enum xnn_status create_fully_connected_nc(
     const struct gemm_fused_ukernels* gemm_ukernels,
     uint32_t datatype_init_flags,
     enum xnn_operator_type operator_type,
+    xnn_weights_cache_t weights_cache,
     xnn_operator_t* fully_connected_op_out)
 {
   xnn_operator_t fully_connected_op = NULL;
@@ -114,30 +117,52 @@ static enum xnn_status create_fully_connected_nc(
   const size_t k_stride = round_up_po2(input_channels, kr);
 
   const size_t packed_weights_size = n_stride * (bias_element_size + (k_stride << log2_filter_element_size));
-  fully_connected_op->packed_weights = xnn_allocate_simd_memory(packed_weights_size);
-  if (fully_connected_op->packed_weights == NULL) {
-    xnn_log_error(
-      "failed to allocate %zu bytes for %s operator packed weights",
-      packed_weights_size, xnn_operator_type_to_string(operator_type));
-    goto error;
-  }
-  memset(fully_connected_op->packed_weights, packed_weights_padding_byte, packed_weights_size);
-
-  if (flags & XNN_FLAG_TRANSPOSE_WEIGHTS) {
-    pack_gemm_io_w(
-      output_channels, input_channels,
-      nr, kr, sr,
-      kernel, bias,
-      fully_connected_op->packed_weights,
-      packing_params);
-  } else {
-    pack_gemm_goi_w(
-      1, output_channels, input_channels,
-      nr, kr, sr,
-      kernel, bias,
-      fully_connected_op->packed_weights,
-      0 /* extra bytes */,
-      packing_params);
+  struct xnn_weights_cache_key cache_key = {
+    .kernel = kernel,
+    .bias = bias,
+    .kernel_size = (input_channels * output_channels) << log2_filter_element_size,
+    .bias_size = bias != NULL ? output_channels * bias_element_size : 0,
+    .operator_type = operator_type,
+    .ukernel_type = xnn_ukernel_type_gemm,
+    .flags = flags & XNN_FLAG_TRANSPOSE_WEIGHTS,
+    .groups = 1,
+    .group_input_channels = input_channels,
+    .group_output_channels = output_channels,
+    .kernel_height = 1,
+    .kernel_width = 1,
+    .nr = nr,
+    .kr = kr,
+    .sr = sr,
+    .packed_weights_size = packed_weights_size,
+  };
+  xnn_weights_cache_key_set_packing_params(&cache_key, packing_params, packing_params_size);
+  if (!xnn_weights_cache_get_operator_weights(weights_cache, &cache_key, fully_connected_op)) {
+    fully_connected_op->packed_weights = xnn_allocate_simd_memory(packed_weights_size);
+    if (fully_connected_op->packed_weights == NULL) {
+      xnn_log_error(
+        "failed to allocate %zu bytes for %s operator packed weights",
+        packed_weights_size, xnn_operator_type_to_string(operator_type));
+      goto error;
+    }
+    memset(fully_connected_op->packed_weights, packed_weights_padding_byte, packed_weights_size);
+
+    if (flags & XNN_FLAG_TRANSPOSE_WEIGHTS) {
+      pack_gemm_io_w(
+        output_channels, input_channels,
+        nr, kr, sr,
+        kernel, bias,
+        fully_connected_op->packed_weights,
+        packing_params);
+    } else {
+      pack_gemm_goi_w(
+        1, output_channels, input_channels,
+        nr, kr, sr,
+        kernel, bias,
+        fully_connected_op->packed_weights,
+        0 /* extra bytes */,
+        packing_params);
+    }
+    xnn_weights_cache_put_operator_weights(weights_cache, &cache_key, fully_connected_op);
   }
 
   fully_connected_op->group_input_channels = input_channels;
@@ -250,7 +275,7 @@ static enum xnn_status setup_fully_connected_nc(
   return xnn_status_success;
 }
 
-enum xnn_status xnn_create_fully_connected_nc_qu8(
+enum xnn_status xnn_create_fully_connected_nc_qu8_with_cache(
     size_t input_channels,
     size_t output_channels,
     size_t input_stride,
@@ -266,6 +291,7 @@ enum xnn_status xnn_create_fully_connected_nc_qu8(
     uint8_t output_min,
     uint8_t output_max,
     uint32_t flags,
+    xnn_weights_cache_t weights_cache,
     xnn_operator_t* fully_connected_op_out)
 {
   if (input_scale <= 0.0f || !isnormal(input_scale)) {
@@ -323,15 +349,41 @@ enum xnn_status xnn_create_fully_connected_nc_qu8(
     sizeof(int32_t) /* sizeof(bias element) */,
     (xnn_pack_gemm_io_w_function) xnn_pack_qu8_gemm_io_w,
     (xnn_pack_gemm_goi_w_function) xnn_pack_qu8_gemm_goi_w,
-    &packing_params, kernel_zero_point /* packed weights padding byte */,
+    &packing_params, sizeof(packing_params), kernel_zero_point /* packed weights padding byte */,
     &params, sizeof(params),
     &xnn_params.qu8.gemm, &xnn_params.qu8.gemm.minmax,
     XNN_INIT_FLAG_QU8,
     xnn_operator_type_fully_connected_nc_qu8,
+    weights_cache,
     fully_connected_op_out);
 }
 
-enum xnn_status xnn_create_fully_connected_nc_qs8(
+enum xnn_status xnn_create_fully_connected_nc_qu8(
+    size_t input_channels,
+    size_t output_channels,
+    size_t input_stride,
+    size_t output_stride,
+    uint8_t input_zero_point,
+    float input_scale,
+    uint8_t kernel_zero_point,
+    float kernel_scale,
+    const uint8_t* kernel,
+    const int32_t* bias,
+    uint8_t output_zero_point,
+    float output_scale,
+    uint8_t output_min,
+    uint8_t output_max,
+    uint32_t flags,
+    xnn_operator_t* fully_connected_op_out)
+{
+  return xnn_create_fully_connected_nc_qu8_with_cache(
+    input_channels, output_channels, input_stride, output_stride, input_zero_point, input_scale,
+    kernel_zero_point, kernel_scale, kernel, bias, output_zero_point, output_scale, output_min,
+    output_max, flags, NULL /* weights cache */,
+    fully_connected_op_out);
+}
+
+enum xnn_status xnn_create_fully_connected_nc_qs8_with_cache(
     size_t input_channels,
     size_t output_channels,
     size_t input_stride,
@@ -346,6 +398,7 @@ enum xnn_status xnn_create_fully_connected_nc_qs8(
     int8_t output_min,
     int8_t output_max,
     uint32_t flags,
+    xnn_weights_cache_t weights_cache,
     xnn_operator_t* fully_connected_op_out)
 {
   if (input_scale <= 0.0f || !isnormal(input_scale)) {
@@ -401,15 +454,40 @@ enum xnn_status xnn_create_fully_connected_nc_qs8(
     sizeof(int32_t) /* sizeof(bias element) */,
     (xnn_pack_gemm_io_w_function) xnn_pack_qs8_gemm_io_w,
     (xnn_pack_gemm_goi_w_function) xnn_pack_qs8_gemm_goi_w,
-    &packing_params, 0 /* packed weights padding byte */,
+    &packing_params, sizeof(packing_params), 0 /* packed weights padding byte */,
     &params, sizeof(params),
     &xnn_params.qs8.gemm, &xnn_params.qs8.gemm.minmax,
     XNN_INIT_FLAG_QS8,
     xnn_operator_type_fully_connected_nc_qs8,
+    weights_cache,
     fully_connected_op_out);
 }
 
-enum xnn_status xnn_create_fully_connected_nc_f32(
+enum xnn_status xnn_create_fully_connected_nc_qs8(
+    size_t input_channels,
+    size_t output_channels,
+    size_t input_stride,
+    size_t output_stride,
+    int8_t input_zero_point,
+    float input_scale,
+    float kernel_scale,
+    const int8_t* kernel,
+    const int32_t* bias,
+    int8_t output_zero_point,
+    float output_scale,
+    int8_t output_min,
+    int8_t output_max,
+    uint32_t flags,
+    xnn_operator_t* fully_connected_op_out)
+{
+  return xnn_create_fully_connected_nc_qs8_with_cache(
+    input_channels, output_channels, input_stride, output_stride, input_zero_point, input_scale,
+    kernel_scale, kernel, bias, output_zero_point, output_scale, output_min, output_max, flags,
+    NULL /* weights cache */,
+    fully_connected_op_out);
+}
+
+enum xnn_status xnn_create_fully_connected_nc_f32_with_cache(
     size_t input_channels,
     size_t output_channels,
     size_t input_stride,
@@ -419,6 +497,7 @@ enum xnn_status xnn_create_fully_connected_nc_f32(
     float output_min,
     float output_max,
     uint32_t flags,
+    xnn_weights_cache_t weights_cache,
     xnn_operator_t* fully_connected_op_out)
 {
   if (isnan(output_min)) {
@@ -460,11 +539,30 @@ enum xnn_status xnn_create_fully_connected_nc_f32(
     sizeof(float) /* sizeof(bias element) */,
     (xnn_pack_gemm_io_w_function) xnn_pack_f32_gemm_io_w,
     (xnn_pack_gemm_goi_w_function) xnn_pack_f32_gemm_goi_w,
-    NULL /* packing params */, 0 /* packed weights padding byte */,
+    NULL /* packing params */, 0 /* packing params size */, 0 /* packed weights padding byte */,
     &params, sizeof(params),
     &xnn_params.f32.gemm, gemm_ukernels,
     XNN_INIT_FLAG_F32,
     xnn_operator_type_fully_connected_nc_f32,
+    weights_cache,
+    fully_connected_op_out);
+}
+
+enum xnn_status xnn_create_fully_connected_nc_f32(
+    size_t input_channels,
+    size_t output_channels,
+    size_t input_stride,
+    size_t output_stride,
+    const float* kernel,
+    const float* bias,
+    float output_min,
+    float output_max,
+    uint32_t flags,
+    xnn_operator_t* fully_connected_op_out)
+{
+  return xnn_create_fully_connected_nc_f32_with_cache(
+    input_channels, output_channels, input_stride, output_stride, kernel, bias, output_min,
+    output_max, flags, NULL /* weights cache */,
     fully_connected_op_out);
 }
 
@@ -523,11 +621,12 @@ enum xnn_status xnn_create_fully_connected_nc_f16(
     sizeof(uint16_t) /* sizeof(bias element) */,
     pack_gemm_io_w,
     pack_gemm_goi_w,
-    NULL /* packing params */, 0 /* packed weights padding byte */,
+    NULL /* packing params */, 0 /* packing params size */, 0 /* packed weights padding byte */,
     &params, sizeof(params),
     &xnn_params.f16.gemm, &xnn_params.f16.gemm.minmax,
     XNN_INIT_FLAG_F16,
     xnn_operator_type_fully_connected_nc_f16,
+    NULL /* weights cache */,
     fully_connected_op_out);
 }
 
@@ -0,0 +1,312 @@
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+#include <math.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <xnnpack.h>
+#include <xnnpack/allocator.h>
+#include <xnnpack/log.h>
+#include <xnnpack/math.h>
+#include <xnnpack/operator.h>
+#include <xnnpack/params.h>
+
+
+// Gathered rows are prefetched only up to this size: hardware prefetchers pick up the rest of a longer row after the
+// first few cache lines.
+#define XNN_GATHER_MAX_PREFETCH_SIZE 512
+
+static enum xnn_status create_gather_nd(
+    const void* params,
+    size_t params_size,
+    uint32_t flags,
+    enum xnn_operator_type operator_type,
+    xnn_operator_t* gather_op_out)
+{
+  xnn_operator_t gather_op = NULL;
+  enum xnn_status status = xnn_status_uninitialized;
+
+  if ((xnn_params.init_flags & XNN_INIT_FLAG_XNNPACK) == 0) {
+    xnn_log_error(
+      "failed to create %s operator: XNNPACK is not initialized",
+      xnn_operator_type_to_string(operator_type));
+    goto error;
+  }
+
+  status = xnn_status_out_of_memory;
+
+  gather_op = xnn_allocate_zero_simd_memory(sizeof(struct xnn_operator));
+  if (gather_op == NULL) {
+    xnn_log_error(
+      "failed to allocate %zu bytes for %s operator descriptor",
+      sizeof(struct xnn_operator), xnn_operator_type_to_string(operator_type));
+    goto error;
+  }
+
+  if (params_size != 0) {
+    memcpy(&gather_op->params, params, params_size);
+  }
+
+  gather_op->type = operator_type;
+  gather_op->flags = flags;
+
+  gather_op->state = xnn_run_state_invalid;
+
+  *gather_op_out = gather_op;
+  return xnn_status_success;
+
+error:
+  xnn_delete_operator(gather_op);
+  return status;
+}
+
+enum xnn_status xnn_create_gather_nd_x8(
+  uint32_t flags,
+  xnn_operator_t* gather_op_out)
+{
+  return create_gather_nd(NULL, 0, flags, xnn_operator_type_gather_nd_x8, gather_op_out);
+}
+
+enum xnn_status xnn_create_gather_nd_x32(
+  uint32_t flags,
+  xnn_operator_t* gather_op_out)
+{
+  return create_gather_nd(NULL, 0, flags, xnn_operator_type_gather_nd_x32, gather_op_out);
+}
+
+enum xnn_status xnn_create_gather_nd_qs8_f32(
+  float input_scale,
+  int8_t input_zero_point,
+  uint32_t flags,
+  xnn_operator_t* gather_op_out)
+{
+  if (input_scale <= 0.0f || !isnormal(input_scale)) {
+    xnn_log_error(
+      "failed to create %s operator with %.7g input scale parameter: scale must be finite, normalized, and positive",
+      xnn_operator_type_to_string(xnn_operator_type_gather_nd_qs8_f32), input_scale);
+    return xnn_status_invalid_parameter;
+  }
+
+  union xnn_qs8_f32_cvt_params params;
+  if (xnn_params.vcvt.qs8_to_f32.init.qs8_f32_cvt != NULL) {
+    xnn_params.vcvt.qs8_to_f32.init.qs8_f32_cvt(&params, input_scale, input_zero_point);
+  }
+  return create_gather_nd(
+    &params, sizeof(params), flags, xnn_operator_type_gather_nd_qs8_f32, gather_op_out);
+}
+
+enum xnn_status xnn_create_gather_nd_qu8_f32(
+  float input_scale,
+  uint8_t input_zero_point,
+  uint32_t flags,
+  xnn_operator_t* gather_op_out)
+{
+  if (input_scale <= 0.0f || !isnormal(input_scale)) {
+    xnn_log_error(
+      "failed to create %s operator with %.7g input scale parameter: scale must be finite, normalized, and positive",
+      xnn_operator_type_to_string(xnn_operator_type_gather_nd_qu8_f32), input_scale);
+    return xnn_status_invalid_parameter;
+  }
+
+  union xnn_qu8_f32_cvt_params params;
+  if (xnn_params.vcvt.qu8_to_f32.init.qu8_f32_cvt != NULL) {
+    xnn_params.vcvt.qu8_to_f32.init.qu8_f32_cvt(&params, input_scale, input_zero_point);
+  }
+  return create_gather_nd(
+    &params, sizeof(params), flags, xnn_operator_type_gather_nd_qu8_f32, gather_op_out);
+}
+
+static enum xnn_status setup_gather_nd(
+    xnn_operator_t gather_op,
+    enum xnn_operator_type expected_operator_type,
+    size_t num_input_dims,
+    const size_t* input_shape,
+    size_t axis,
+    size_t num_indices,
+    const int32_t* indices,
+    const void* input,
+    void* output,
+    uint32_t log2_input_element_size,
+    uint32_t log2_output_element_size,
+    xnn_univector_ukernel_function ukernel,
+    const void* params,
+    size_t params_size,
+    size_t num_threads)
+{
+  if (gather_op->type != expected_operator_type) {
+    xnn_log_error("failed to setup operator: operator type mismatch (expected %s, got %s)",
+      xnn_operator_type_to_string(expected_operator_type),
+      xnn_operator_type_to_string(gather_op->type));
+    return xnn_status_invalid_parameter;
+  }
+  gather_op->state = xnn_run_state_invalid;
+
+  if ((xnn_params.init_flags & XNN_INIT_FLAG_XNNPACK) == 0) {
+    xnn_log_error("failed to setup %s operator: XNNPACK is not initialized",
+      xnn_operator_type_to_string(gather_op->type));
+    return xnn_status_uninitialized;
+  }
+
+  if (num_input_dims == 0 || num_input_dims > XNN_MAX_TENSOR_DIMS) {
+    xnn_log_error(
+      "failed to setup %s operator with %zu dimensions in input shape: "
+      "the number of input dimensions must be between 1 and %d",
+      xnn_operator_type_to_string(gather_op->type), num_input_dims, XNN_MAX_TENSOR_DIMS);
+    return xnn_status_unsupported_parameter;
+  }
+
+  if (axis >= num_input_dims) {
+    xnn_log_error(
+      "failed to setup %s operator with gather axis %zu: the axis must be less than the number of input dimensions (%zu)",
+      xnn_operator_type_to_string(gather_op->type), axis, num_input_dims);
+    return xnn_status_invalid_parameter;
+  }
+
+  for (size_t i = 0; i < num_input_dims; i++) {
+    if (input_shape[i] == 0) {
+      xnn_log_error(
+        "failed to setup %s operator: input shape dimension #%zu is zero",
+        xnn_operator_type_to_string(gather_op->type), i);
+      return xnn_status_invalid_parameter;
+    }
+  }
+
+  if (num_indices == 0) {
+    gather_op->state = xnn_run_state_skip;
+    return xnn_status_success;
+  }
+
+  size_t batch_size = 1;
+  for (size_t i = 0; i < axis; i++) {
+    batch_size *= input_shape[i];
+  }
+  size_t row_elements = 1;
+  for (size_t i = axis + 1; i < num_input_dims; i++) {
+    row_elements *= input_shape[i];
+  }
+
+  const size_t input_row_size = row_elements << log2_input_element_size;
+  const size_t output_row_size = row_elements << log2_output_element_size;
+  gather_op->context.gather = (struct gather_context) {
+    .input = input,
+    .indices = indices,
+    .output = output,
+    .input_batch_stride = input_shape[axis] * input_row_size,
+    .output_batch_stride = num_indices * output_row_size,
+    .axis_size = input_shape[axis],
+    .num_indices = num_indices,
+    .input_row_size = input_row_size,
+    .output_row_size = output_row_size,
+    .prefetch_size = min(input_row_size, XNN_GATHER_MAX_PREFETCH_SIZE),
+    .ukernel = ukernel,
+  };
+  if (params_size != 0) {
+    memcpy(&gather_op->context.gather.params, params, params_size);
+  }
+
+  size_t index_tile = num_indices;
+  if (num_threads > 1) {
+    const size_t target_tiles_per_thread = 5;
+    const size_t max_index_tile = divide_round_up(batch_size * num_indices, num_threads * target_tiles_per_thread);
+    index_tile = min(index_tile, max_index_tile);
+  }
+
+  gather_op->compute.type = xnn_parallelization_type_2d_tile_1d;
+  gather_op->compute.task_2d_tile_1d = (pthreadpool_task_2d_tile_1d_t) xnn_compute_gather;
+  gather_op->compute.range[0] = batch_size;
+  gather_op->compute.range[1] = num_indices;
+  gather_op->compute.tile[0] = index_tile;
+  gather_op->state = xnn_run_state_ready;
+
+  return xnn_status_success;
+}
+
+enum xnn_status xnn_setup_gather_nd_x8(
+    xnn_operator_t gather_op,
+    size_t num_input_dims,
+    const size_t* input_shape,
+    size_t axis,
+    size_t num_indices,
+    const int32_t* indices,
+    const void* input,
+    void* output,
+    pthreadpool_t threadpool)
+{
+  return setup_gather_nd(
+    gather_op, xnn_operator_type_gather_nd_x8,
+    num_input_dims, input_shape, axis, num_indices, indices,
+    input, output,
+    0 /* log2(sizeof(uint8_t)) */,
+    0 /* log2(sizeof(uint8_t)) */,
+    xnn_params.xx.copy, NULL, 0,
+    pthreadpool_get_threads_count(threadpool));
+}
+
+enum xnn_status xnn_setup_gather_nd_x32(
+    xnn_operator_t gather_op,
+    size_t num_input_dims,
+    const size_t* input_shape,
+    size_t axis,
+    size_t num_indices,
+    const int32_t* indices,
+    const void* input,
+    void* output,
+    pthreadpool_t threadpool)
+{
+  return setup_gather_nd(
+    gather_op, xnn_operator_type_gather_nd_x32,
+    num_input_dims, input_shape, axis, num_indices, indices,
+    input, output,
+    2 /* log2(sizeof(uint32_t)) */,
+    2 /* log2(sizeof(uint32_t)) */,
+    xnn_params.xx.copy, NULL, 0,
+    pthreadpool_get_threads_count(threadpool));
+}
+
+enum xnn_status xnn_setup_gather_nd_qs8_f32(
+    xnn_operator_t gather_op,
+    size_t num_input_dims,
+    const size_t* input_shape,
+    size_t axis,
+    size_t num_indices,
+    const int32_t* indices,
+    const int8_t* input,
+    float* output,
+    pthreadpool_t threadpool)
+{
+  return setup_gather_nd(
+    gather_op, xnn_operator_type_gather_nd_qs8_f32,
+    num_input_dims, input_shape, axis, num_indices, indices,
+    input, output,
+    0 /* log2(sizeof(int8_t)) */,
+    2 /* log2(sizeof(float)) */,
+    xnn_params.vcvt.qs8_to_f32.ukernel, &gather_op->params.qs8_f32_cvt, sizeof(gather_op->params.qs8_f32_cvt),
+    pthreadpool_get_threads_count(threadpool));
+}
+
+enum xnn_status xnn_setup_gather_nd_qu8_f32(
+    xnn_operator_t gather_op,
+    size_t num_input_dims,
+    const size_t* input_shape,
+    size_t axis,
+    size_t num_indices,
+    const int32_t* indices,
+    const uint8_t* input,
+    float* output,
+    pthreadpool_t threadpool)
+{
+  return setup_gather_nd(
+    gather_op, xnn_operator_type_gather_nd_qu8_f32,
+    num_input_dims, input_shape, axis, num_indices, indices,
+    input, output,
+    0 /* log2(sizeof(uint8_t)) */,
+    2 /* log2(sizeof(float)) */,
+    xnn_params.vcvt.qu8_to_f32.ukernel, &gather_op->params.qu8_f32_cvt, sizeof(gather_op->params.qu8_f32_cvt),
+    pthreadpool_get_threads_count(threadpool));
+}
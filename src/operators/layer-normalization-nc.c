@@ -0,0 +1,162 @@
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <math.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#include <xnnpack.h>
+#include <xnnpack/allocator.h>
+#include <xnnpack/log.h>
+#include <xnnpack/math.h>
+#include <xnnpack/operator.h>
+#include <xnnpack/pack.h>
+#include <xnnpack/params.h>
+
+
+enum xnn_status xnn_create_layer_normalization_nc_f32(
+    size_t channels,
+    size_t input_stride,
+    size_t output_stride,
+    float epsilon,
+    const float* gamma,
+    const float* beta,
+    uint32_t flags,
+    xnn_operator_t* layer_normalization_op_out)
+{
+  xnn_operator_t layer_normalization_op = NULL;
+  enum xnn_status status = xnn_status_uninitialized;
+
+  if ((xnn_params.init_flags & XNN_INIT_FLAG_XNNPACK) == 0) {
+    xnn_log_error("failed to create %s operator: XNNPACK is not initialized",
+      xnn_operator_type_to_string(xnn_operator_type_layer_normalization_nc_f32));
+    goto error;
+  }
+
+  status = xnn_status_invalid_parameter;
+
+  if (channels == 0) {
+    xnn_log_error(
+      "failed to create %s operator with %zu channels: number of channels must be non-zero",
+      xnn_operator_type_to_string(xnn_operator_type_layer_normalization_nc_f32), channels);
+    goto error;
+  }
+
+  if (input_stride < channels) {
+    xnn_log_error(
+      "failed to create %s operator with input element stride of %zu: "
+      "stride must be at least as large as the number of channels (%zu)",
+      xnn_operator_type_to_string(xnn_operator_type_layer_normalization_nc_f32), input_stride, channels);
+    goto error;
+  }
+
+  if (output_stride < channels) {
+    xnn_log_error(
+      "failed to create %s operator with output element stride of %zu: "
+      "stride must be at least as large as the number of channels (%zu)",
+      xnn_operator_type_to_string(xnn_operator_type_layer_normalization_nc_f32), output_stride, channels);
+    goto error;
+  }
+
+  if (epsilon <= 0.0f || !isnormal(epsilon)) {
+    xnn_log_error(
+      "failed to create %s operator with %.7g epsilon: epsilon must be finite, normalized, and positive",
+      xnn_operator_type_to_string(xnn_operator_type_layer_normalization_nc_f32), epsilon);
+    goto error;
+  }
+
+  status = xnn_status_out_of_memory;
+
+  layer_normalization_op = xnn_allocate_zero_simd_memory(sizeof(struct xnn_operator));
+  if (layer_normalization_op == NULL) {
+    xnn_log_error(
+      "failed to allocate %zu bytes for %s operator descriptor",
+      sizeof(struct xnn_operator), xnn_operator_type_to_string(xnn_operator_type_layer_normalization_nc_f32));
+    goto error;
+  }
+
+  // Scale (gamma) and shift (beta) are packed in the same layout as the weights of the VMULCADDC micro-kernels.
+  const size_t channel_tile = xnn_params.f32.layer_norm.channel_tile;
+  const size_t packed_weights_size = 2 * sizeof(float) * round_up_po2(channels, channel_tile);
+  layer_normalization_op->packed_weights = xnn_allocate_zero_simd_memory(packed_weights_size);
+  if (layer_normalization_op->packed_weights == NULL) {
+    xnn_log_error(
+      "failed to allocate %zu bytes for %s operator packed weights",
+      packed_weights_size, xnn_operator_type_to_string(xnn_operator_type_layer_normalization_nc_f32));
+    goto error;
+  }
+  xnn_pack_f32_vmulcaddc_w(channels, channel_tile, gamma, beta, layer_normalization_op->packed_weights, NULL);
+
+  layer_normalization_op->channels = channels;
+  layer_normalization_op->input_pixel_stride = input_stride;
+  layer_normalization_op->output_pixel_stride = output_stride;
+  layer_normalization_op->params.f32_layer_norm.epsilon = epsilon;
+  if (xnn_params.f32.layer_norm.init != NULL) {
+    xnn_params.f32.layer_norm.init(&layer_normalization_op->params.f32_layer_norm.f32_default);
+  }
+
+  layer_normalization_op->type = xnn_operator_type_layer_normalization_nc_f32;
+  layer_normalization_op->flags = flags;
+
+  layer_normalization_op->state = xnn_run_state_invalid;
+
+  *layer_normalization_op_out = layer_normalization_op;
+  return xnn_status_success;
+
+error:
+  xnn_delete_operator(layer_normalization_op);
+  return status;
+}
+
+enum xnn_status xnn_setup_layer_normalization_nc_f32(
+    xnn_operator_t layer_normalization_op,
+    size_t batch_size,
+    const float* input,
+    float* output,
+    pthreadpool_t threadpool)
+{
+  if (layer_normalization_op->type != xnn_operator_type_layer_normalization_nc_f32) {
+    xnn_log_error("failed to setup operator: operator type mismatch (expected %s, got %s)",
+      xnn_operator_type_to_string(xnn_operator_type_layer_normalization_nc_f32),
+      xnn_operator_type_to_string(layer_normalization_op->type));
+    return xnn_status_invalid_parameter;
+  }
+  layer_normalization_op->state = xnn_run_state_invalid;
+
+  if ((xnn_params.init_flags & XNN_INIT_FLAG_XNNPACK) == 0) {
+    xnn_log_error("failed to setup %s operator: XNNPACK is not initialized",
+      xnn_operator_type_to_string(xnn_operator_type_layer_normalization_nc_f32));
+    return xnn_status_uninitialized;
+  }
+
+  if (batch_size == 0) {
+    layer_normalization_op->state = xnn_run_state_skip;
+    return xnn_status_success;
+  }
+
+  layer_normalization_op->batch_size = batch_size;
+  layer_normalization_op->input = input;
+  layer_normalization_op->output = output;
+
+  layer_normalization_op->context.layer_normalization = (struct layer_normalization_context) {
+    .n = layer_normalization_op->channels * sizeof(float),
+    .x = input,
+    .x_stride = layer_normalization_op->input_pixel_stride * sizeof(float),
+    .w = layer_normalization_op->packed_weights,
+    .y = output,
+    .y_stride = layer_normalization_op->output_pixel_stride * sizeof(float),
+    .epsilon = layer_normalization_op->params.f32_layer_norm.epsilon,
+    .rmeanvar_ukernel = xnn_params.f32.layer_norm.rmeanvar,
+    .vnormcaddc_ukernel = xnn_params.f32.layer_norm.vnormcaddc,
+    .params = layer_normalization_op->params.f32_layer_norm.f32_default,
+  };
+  layer_normalization_op->compute.type = xnn_parallelization_type_1d;
+  layer_normalization_op->compute.task_1d = (pthreadpool_task_1d_t) xnn_compute_f32_layer_normalization;
+  layer_normalization_op->compute.range[0] = batch_size;
+  layer_normalization_op->state = xnn_run_state_ready;
+
+  return xnn_status_success;
+}
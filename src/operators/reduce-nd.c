@@ -0,0 +1,899 @@
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+#include <inttypes.h>
+#include <math.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <xnnpack.h>
+#include <xnnpack/allocator.h>
+#include <xnnpack/log.h>
+#include <xnnpack/math.h>
+#include <xnnpack/operator.h>
+#include <xnnpack/params-init.h>
+#include <xnnpack/params.h>
+
+
+static enum xnn_status create_reduce_nd(
+    enum xnn_reduce_operator reduce_operator_type,
+    uint32_t flags,
+    uint32_t datatype_init_flags,
+    enum xnn_operator_type operator_type,
+    xnn_operator_t* reduce_op_out)
+{
+  xnn_operator_t reduce_op = NULL;
+  enum xnn_status status = xnn_status_uninitialized;
+
+  if ((xnn_params.init_flags & XNN_INIT_FLAG_XNNPACK) == 0) {
+    xnn_log_error("failed to create %s operator: XNNPACK is not initialized",
+      xnn_operator_type_to_string(operator_type));
+    goto error;
+  }
+
+  status = xnn_status_unsupported_hardware;
+
+  if ((xnn_params.init_flags & datatype_init_flags) != datatype_init_flags) {
+    xnn_log_error("failed to create %s operator: operations on data type are not supported",
+      xnn_operator_type_to_string(operator_type));
+    goto error;
+  }
+
+  status = xnn_status_out_of_memory;
+
+  reduce_op = xnn_allocate_zero_simd_memory(sizeof(struct xnn_operator));
+  if (reduce_op == NULL) {
+    xnn_log_error(
+      "failed to allocate %zu bytes for %s operator descriptor",
+      sizeof(struct xnn_operator), xnn_operator_type_to_string(operator_type));
+    goto error;
+  }
+
+  reduce_op->reduce_operator = reduce_operator_type;
+  reduce_op->type = operator_type;
+  reduce_op->flags = flags;
+
+  reduce_op->state = xnn_run_state_invalid;
+
+  *reduce_op_out = reduce_op;
+  return xnn_status_success;
+
+error:
+  xnn_delete_operator(reduce_op);
+  return status;
+}
+
+static enum xnn_status check_reduce_operator_type(
+    enum xnn_reduce_operator reduce_operator_type,
+    enum xnn_operator_type operator_type)
+{
+  switch (reduce_operator_type) {
+    case xnn_reduce_sum:
+    case xnn_reduce_mean:
+    case xnn_reduce_max:
+      return xnn_status_success;
+    default:
+      xnn_log_error(
+        "failed to create %s operator with reduce operator type %d: unsupported reduce operator type",
+        xnn_operator_type_to_string(operator_type), reduce_operator_type);
+      return xnn_status_invalid_parameter;
+  }
+}
+
+enum xnn_status xnn_create_reduce_nd_f32(
+    enum xnn_reduce_operator reduce_operator_type,
+    uint32_t flags,
+    xnn_operator_t* reduce_op_out)
+{
+  const enum xnn_status status =
+    check_reduce_operator_type(reduce_operator_type, xnn_operator_type_reduce_nd_f32);
+  if (status != xnn_status_success) {
+    return status;
+  }
+
+  return create_reduce_nd(
+    reduce_operator_type, flags,
+    XNN_INIT_FLAG_F32,
+    xnn_operator_type_reduce_nd_f32,
+    reduce_op_out);
+}
+
+enum xnn_status xnn_create_reduce_nd_qs8(
+    enum xnn_reduce_operator reduce_operator_type,
+    int8_t input_zero_point,
+    float input_scale,
+    int8_t output_zero_point,
+    float output_scale,
+    int8_t output_min,
+    int8_t output_max,
+    uint32_t flags,
+    xnn_operator_t* reduce_op_out)
+{
+  enum xnn_status status = check_reduce_operator_type(reduce_operator_type, xnn_operator_type_reduce_nd_qs8);
+  if (status != xnn_status_success) {
+    return status;
+  }
+
+  if (input_scale <= 0.0f || !isnormal(input_scale)) {
+    xnn_log_error(
+      "failed to create %s operator with %.7g input scale: scale must be finite, normalized, and positive",
+      xnn_operator_type_to_string(xnn_operator_type_reduce_nd_qs8), input_scale);
+    return xnn_status_invalid_parameter;
+  }
+
+  if (output_scale <= 0.0f || !isnormal(output_scale)) {
+    xnn_log_error(
+      "failed to create %s operator with %.7g output scale: scale must be finite, normalized, and positive",
+      xnn_operator_type_to_string(xnn_operator_type_reduce_nd_qs8), output_scale);
+    return xnn_status_invalid_parameter;
+  }
+
+  if (output_min >= output_max) {
+    xnn_log_error(
+      "failed to create %s operator with [%" PRId8 ", %" PRId8 "] output range: range min must be below range max",
+      xnn_operator_type_to_string(xnn_operator_type_reduce_nd_qs8), output_min, output_max);
+    return xnn_status_invalid_parameter;
+  }
+
+  // Maximum commutes with any monotonic requantization, but the strided maximum micro-kernels do not requantize.
+  if (reduce_operator_type == xnn_reduce_max &&
+      (input_zero_point != output_zero_point || input_scale != output_scale))
+  {
+    xnn_log_error(
+      "failed to create %s operator with %.7g input scale, %" PRId8 " input zero point, "
+      "%.7g output scale, and %" PRId8 " output zero point: "
+      "maximum reduction requires identical input and output quantization parameters",
+      xnn_operator_type_to_string(xnn_operator_type_reduce_nd_qs8),
+      input_scale, input_zero_point, output_scale, output_zero_point);
+    return xnn_status_unsupported_parameter;
+  }
+
+  const uint32_t datatype_init_flags =
+    reduce_operator_type == xnn_reduce_max ? XNN_INIT_FLAG_QS8 | XNN_INIT_FLAG_S8 : XNN_INIT_FLAG_QS8;
+  status = create_reduce_nd(
+    reduce_operator_type, flags,
+    datatype_init_flags,
+    xnn_operator_type_reduce_nd_qs8,
+    reduce_op_out);
+  if (status == xnn_status_success) {
+    xnn_operator_t reduce_op = *reduce_op_out;
+    reduce_op->input_zero_point = (int32_t) input_zero_point;
+    reduce_op->input_scale = input_scale;
+    reduce_op->output_scale = output_scale;
+    // Sum and mean reductions over non-adjacent axes quantize their F32 result with these parameters.
+    reduce_op->output_zero_point = (uint8_t) output_zero_point;
+    reduce_op->output_min = (uint8_t) output_min;
+    reduce_op->output_max = (uint8_t) output_max;
+    if (reduce_operator_type == xnn_reduce_max) {
+      xnn_params.s8.rdmax.init.s8(&reduce_op->params.s8_minmax, output_min, output_max);
+    } else if (xnn_params.qs8.gavgpool.init.qs8 != NULL) {
+      xnn_params.qs8.gavgpool.init.qs8(&reduce_op->params.qs8_gavgpool,
+        0 /* bias */, 1.0f /* scale */, output_zero_point, output_min, output_max);
+    }
+  }
+  return status;
+}
+
+// Shape of one pass of the reduction: the pass input is viewed as [batch_size, rows, channels] and reduced over rows.
+struct reduction_pass {
+  size_t batch_size;
+  size_t rows;
+  size_t channels;
+};
+
+// Normalizes the input shape and the reduction axes into passes over [batch, rows, channels] views of the input:
+// dimensions of size 1 are dropped, adjacent reduced dimensions are merged into rows, and adjacent kept dimensions are
+// merged together. Reductions over several groups of non-adjacent axes, e.g. [K0, R1, K1, R2, K2] views, run one pass
+// per group, each over the output of the previous pass, and larger groups are reduced first to keep the intermediate
+// tensors small.
+static enum xnn_status normalize_reduction(
+    enum xnn_operator_type operator_type,
+    size_t num_input_dims,
+    const size_t* input_shape,
+    size_t num_reduction_axes,
+    const size_t* reduction_axes,
+    struct reduction_pass passes[restrict XNN_MIN_ELEMENTS(XNN_MAX_REDUCE_PASSES)],
+    size_t* num_passes_out)
+{
+  if (num_input_dims == 0 || num_input_dims > XNN_MAX_TENSOR_DIMS) {
+    xnn_log_error(
+      "failed to setup %s operator with %zu input dimensions: number of dimensions must be in [1, %d] range",
+      xnn_operator_type_to_string(operator_type), num_input_dims, XNN_MAX_TENSOR_DIMS);
+    return xnn_status_invalid_parameter;
+  }
+
+  if (num_reduction_axes == 0 || num_reduction_axes > num_input_dims) {
+    xnn_log_error(
+      "failed to setup %s operator with %zu reduction axes: number of reduction axes must be in [1, %zu] range",
+      xnn_operator_type_to_string(operator_type), num_reduction_axes, num_input_dims);
+    return xnn_status_invalid_parameter;
+  }
+
+  for (size_t i = 0; i < num_input_dims; i++) {
+    if (input_shape[i] == 0) {
+      xnn_log_error(
+        "failed to setup %s operator: input shape dimension #%zu is zero",
+        xnn_operator_type_to_string(operator_type), i);
+      return xnn_status_invalid_parameter;
+    }
+  }
+
+  uint32_t reduction_mask = 0;
+  for (size_t i = 0; i < num_reduction_axes; i++) {
+    const size_t axis = reduction_axes[i];
+    if (axis >= num_input_dims) {
+      xnn_log_error(
+        "failed to setup %s operator with reduction axis #%zu of %zu: axis must be below the number of dimensions (%zu)",
+        xnn_operator_type_to_string(operator_type), i, axis, num_input_dims);
+      return xnn_status_invalid_parameter;
+    }
+    if (reduction_mask & (UINT32_C(1) << axis)) {
+      xnn_log_error(
+        "failed to setup %s operator with reduction axis #%zu of %zu: axis is specified more than once",
+        xnn_operator_type_to_string(operator_type), i, axis);
+      return xnn_status_invalid_parameter;
+    }
+    reduction_mask |= UINT32_C(1) << axis;
+  }
+
+  // Kept and reduced groups of dimensions alternate: even indices are kept groups, odd indices are reduced groups.
+  size_t normalized_shape[XNN_MAX_TENSOR_DIMS + 1];
+  for (size_t i = 0; i <= XNN_MAX_TENSOR_DIMS; i++) {
+    normalized_shape[i] = 1;
+  }
+  size_t group = 0;
+  for (size_t i = 0; i < num_input_dims; i++) {
+    const size_t dim = input_shape[i];
+    if (dim == 1) {
+      continue;
+    }
+
+    const bool reduced = (reduction_mask & (UINT32_C(1) << i)) != 0;
+    if (reduced != (group % 2 == 1)) {
+      group += 1;
+    }
+    normalized_shape[group] *= dim;
+  }
+
+  if (normalized_shape[1] == 1) {
+    // Nothing to reduce: the operator degenerates into an element-wise copy of a single row.
+    passes[0] = (struct reduction_pass) { 1, 1, normalized_shape[0] };
+    *num_passes_out = 1;
+    return xnn_status_success;
+  }
+
+  // The normalized shape ends with a kept group, which is 1 when the innermost dimensions are reduced.
+  size_t num_groups = group + 1 + group % 2;
+  size_t num_passes = 0;
+  while (num_groups > 1) {
+    size_t reduced_group = 1;
+    for (size_t g = 3; g < num_groups; g += 2) {
+      if (normalized_shape[g] > normalized_shape[reduced_group]) {
+        reduced_group = g;
+      }
+    }
+
+    size_t batch_size = 1;
+    for (size_t g = 0; g < reduced_group; g++) {
+      batch_size *= normalized_shape[g];
+    }
+    size_t channels = 1;
+    for (size_t g = reduced_group + 1; g < num_groups; g++) {
+      channels *= normalized_shape[g];
+    }
+    assert(num_passes < XNN_MAX_REDUCE_PASSES);
+    passes[num_passes++] = (struct reduction_pass) { batch_size, normalized_shape[reduced_group], channels };
+
+    // Kept groups around the reduced group become adjacent, and merge together.
+    normalized_shape[reduced_group - 1] *= normalized_shape[reduced_group + 1];
+    for (size_t g = reduced_group; g + 2 < num_groups; g++) {
+      normalized_shape[g] = normalized_shape[g + 2];
+    }
+    num_groups -= 2;
+  }
+  *num_passes_out = num_passes;
+  return xnn_status_success;
+}
+
+static enum xnn_status setup_reduce_nd(
+    xnn_operator_t reduce_op,
+    enum xnn_operator_type expected_operator_type,
+    size_t num_input_dims,
+    const size_t* input_shape,
+    size_t num_reduction_axes,
+    const size_t* reduction_axes,
+    struct reduction_pass passes[restrict XNN_MIN_ELEMENTS(XNN_MAX_REDUCE_PASSES)],
+    size_t* num_passes_out)
+{
+  if (reduce_op->type != expected_operator_type) {
+    xnn_log_error("failed to setup operator: operator type mismatch (expected %s, got %s)",
+      xnn_operator_type_to_string(expected_operator_type),
+      xnn_operator_type_to_string(reduce_op->type));
+    return xnn_status_invalid_parameter;
+  }
+  reduce_op->state = xnn_run_state_invalid;
+
+  if ((xnn_params.init_flags & XNN_INIT_FLAG_XNNPACK) == 0) {
+    xnn_log_error("failed to setup %s operator: XNNPACK is not initialized",
+      xnn_operator_type_to_string(expected_operator_type));
+    return xnn_status_uninitialized;
+  }
+
+  // Extra computations, and contexts past the beginning of the operator context, are set up only for reductions over
+  // non-adjacent axes.
+  reduce_op->compute.context_offset = 0;
+  for (size_t i = 0; i < XNN_MAX_EXTRA_COMPUTE; i++) {
+    reduce_op->extra_compute[i].type = xnn_parallelization_type_invalid;
+  }
+
+  return normalize_reduction(
+    expected_operator_type,
+    num_input_dims, input_shape,
+    num_reduction_axes, reduction_axes,
+    passes, num_passes_out);
+}
+
+// The Global Average Pooling micro-kernels read rows from a zero buffer when the number of rows is not a multiple of
+// the row tile. The buffer is sized for the number of channels in the most recent setup, and grows as needed.
+static enum xnn_status ensure_zero_buffer(
+    xnn_operator_t reduce_op,
+    size_t channels,
+    uint32_t log2_element_size)
+{
+  if (reduce_op->zero_buffer != NULL && reduce_op->channels >= channels) {
+    return xnn_status_success;
+  }
+
+  xnn_release_simd_memory(reduce_op->zero_buffer);
+  reduce_op->channels = 0;
+  const size_t zero_size = (channels << log2_element_size) + XNN_EXTRA_BYTES;
+  reduce_op->zero_buffer = xnn_allocate_zero_simd_memory(zero_size);
+  if (reduce_op->zero_buffer == NULL) {
+    xnn_log_error(
+      "failed to allocate %zu bytes for %s operator zero padding",
+      zero_size, xnn_operator_type_to_string(reduce_op->type));
+    return xnn_status_out_of_memory;
+  }
+  reduce_op->channels = channels;
+  return xnn_status_success;
+}
+
+// Size of an intermediate tensor in the intermediate buffer. Micro-kernels may read XNN_EXTRA_BYTES past the end of
+// their input, and the next intermediate tensor starts aligned.
+static size_t get_intermediate_tensor_size(
+    size_t num_elements,
+    uint32_t log2_element_size)
+{
+  return round_up_po2((num_elements << log2_element_size) + XNN_EXTRA_BYTES, XNN_ALLOCATION_ALIGNMENT);
+}
+
+// Total size of the outputs of the first 'num_passes' passes, which are stored one after another.
+static size_t get_pass_outputs_size(
+    const struct reduction_pass* passes,
+    size_t num_passes,
+    uint32_t log2_element_size)
+{
+  size_t size = 0;
+  for (size_t i = 0; i < num_passes; i++) {
+    size += get_intermediate_tensor_size(passes[i].batch_size * passes[i].channels, log2_element_size);
+  }
+  return size;
+}
+
+// Multi-pass reductions store intermediate tensors in an intermediate buffer, which grows as needed.
+static enum xnn_status ensure_intermediate_buffer(
+    xnn_operator_t reduce_op,
+    size_t intermediate_size)
+{
+  if (reduce_op->intermediate_buffer != NULL && reduce_op->intermediate_buffer_size >= intermediate_size) {
+    return xnn_status_success;
+  }
+
+  xnn_release_simd_memory(reduce_op->intermediate_buffer);
+  reduce_op->intermediate_buffer_size = 0;
+  reduce_op->intermediate_buffer = xnn_allocate_simd_memory(intermediate_size);
+  if (reduce_op->intermediate_buffer == NULL) {
+    xnn_log_error(
+      "failed to allocate %zu bytes for %s operator intermediate buffer",
+      intermediate_size, xnn_operator_type_to_string(reduce_op->type));
+    return xnn_status_out_of_memory;
+  }
+  reduce_op->intermediate_buffer_size = intermediate_size;
+  return xnn_status_success;
+}
+
+// Computations of the operator run in order: 'compute' first, followed by 'extra_compute'.
+static struct compute_parameters* get_compute(
+    xnn_operator_t reduce_op,
+    size_t compute_index,
+    const void* context)
+{
+  assert(compute_index <= XNN_MAX_EXTRA_COMPUTE);
+  struct compute_parameters* compute =
+    compute_index == 0 ? &reduce_op->compute : &reduce_op->extra_compute[compute_index - 1];
+  compute->context_offset = (size_t) ((uintptr_t) context - (uintptr_t) &reduce_op->context);
+  return compute;
+}
+
+static void setup_global_average_pooling(
+    xnn_operator_t reduce_op,
+    size_t compute_index,
+    size_t pass_index,
+    const struct reduction_pass* pass,
+    const void* input,
+    void* output,
+    uint32_t log2_element_size,
+    const struct gavgpool_parameters gavgpool[restrict XNN_MIN_ELEMENTS(1)],
+    const void* params,
+    size_t params_size)
+{
+  struct global_average_pooling_nwc_context* context = &reduce_op->context.reduce.passes.sum[pass_index];
+  struct compute_parameters* compute = get_compute(reduce_op, compute_index, context);
+
+  const size_t input_row_stride = pass->channels << log2_element_size;
+  *context = (struct global_average_pooling_nwc_context) {
+    .input = input,
+    .zero = reduce_op->zero_buffer,
+    .input_pixel_stride = input_row_stride,
+    .input_batch_stride = input_row_stride * pass->rows,
+    .input_elements = pass->rows,
+    .channels = pass->channels,
+    .output = output,
+    .output_batch_stride = pass->channels << log2_element_size,
+  };
+  memcpy(&context->params, params, params_size);
+
+  compute->type = xnn_parallelization_type_1d;
+  compute->range[0] = pass->batch_size;
+  if (pass->rows <= gavgpool->row_tile) {
+    compute->task_1d = (pthreadpool_task_1d_t) xnn_compute_global_average_pooling_nwc_unipass;
+    context->unipass_ukernel = gavgpool->unipass;
+  } else {
+    compute->task_1d = (pthreadpool_task_1d_t) xnn_compute_global_average_pooling_nwc_multipass;
+    context->multipass_ukernel = gavgpool->multipass;
+  }
+}
+
+static void setup_reduce_max_discontiguous(
+    xnn_operator_t reduce_op,
+    size_t pass_index,
+    const struct reduction_pass* pass,
+    const void* input,
+    void* output,
+    uint32_t log2_element_size,
+    const struct rdmax_parameters rdmax[restrict XNN_MIN_ELEMENTS(1)],
+    const void* params,
+    size_t params_size,
+    size_t num_threads)
+{
+  struct reduce_max_discontiguous_context* context = &reduce_op->context.reduce.passes.max[pass_index];
+  struct compute_parameters* compute = get_compute(reduce_op, pass_index, context);
+
+  const size_t batch_size = pass->batch_size;
+  const size_t channels = pass->channels;
+  const size_t input_row_stride = channels << log2_element_size;
+  *context = (struct reduce_max_discontiguous_context) {
+    .input = input,
+    .input_batch_stride = input_row_stride * pass->rows,
+    .input_row_stride = input_row_stride,
+    .rows = pass->rows,
+    .output = output,
+    .output_batch_stride = channels << log2_element_size,
+    .log2_element_size = log2_element_size,
+    .ukernel = rdmax->ukernel,
+  };
+  memcpy(&context->params, params, params_size);
+
+  // Split channels into blocks when there are too few batch elements to keep all threads busy.
+  size_t channel_block = channels;
+  if (num_threads > 1 && batch_size < num_threads) {
+    const size_t target_tiles_per_thread = 5;
+    const size_t max_channel_block = divide_round_up(channels * batch_size, num_threads * target_tiles_per_thread);
+    if (max_channel_block < channel_block) {
+      channel_block = min(channel_block, round_up(max_channel_block, rdmax->channel_tile));
+    }
+  }
+
+  compute->type = xnn_parallelization_type_2d_tile_1d;
+  compute->task_2d_tile_1d = (pthreadpool_task_2d_tile_1d_t) xnn_compute_reduce_max_discontiguous;
+  compute->range[0] = batch_size;
+  compute->range[1] = channels;
+  compute->tile[0] = channel_block;
+}
+
+static void setup_convert(
+    xnn_operator_t reduce_op,
+    size_t compute_index,
+    struct univector_contiguous_context* context,
+    const void* input,
+    void* output,
+    size_t num_elements,
+    uint32_t log2_input_size,
+    uint32_t log2_output_size,
+    xnn_univector_ukernel_function ukernel,
+    const void* params,
+    size_t params_size,
+    size_t num_threads)
+{
+  struct compute_parameters* compute = get_compute(reduce_op, compute_index, context);
+
+  *context = (struct univector_contiguous_context) {
+    .x = input,
+    .y = output,
+    .log2_xsize = (uint16_t) log2_input_size,
+    .log2_ysize = (uint16_t) log2_output_size,
+    .ukernel = ukernel,
+  };
+  memcpy(&context->params, params, params_size);
+
+  const size_t block_size = 4096;
+  const size_t range = num_elements << log2_input_size;
+  compute->type = xnn_parallelization_type_1d_tile_1d;
+  compute->task_1d_tile_1d = (pthreadpool_task_1d_tile_1d_t) xnn_compute_univector_contiguous;
+  compute->range[0] = range;
+  compute->tile[0] = (num_threads == 1) ? range : block_size;
+}
+
+// Sets up F32 sum or mean passes as computations starting at 'first_compute_index'. The first pass reads 'input', the
+// last pass writes 'output', and outputs of other passes are stored one after another in the intermediate buffer,
+// starting at 'intermediate_offset'.
+static enum xnn_status setup_f32_sum_passes(
+    xnn_operator_t reduce_op,
+    size_t first_compute_index,
+    const struct reduction_pass* passes,
+    size_t num_passes,
+    const float* input,
+    float* output,
+    size_t intermediate_offset)
+{
+  // All passes share the zero buffer, so it must fit the widest pass before any pass is set up.
+  size_t max_channels = 0;
+  for (size_t i = 0; i < num_passes; i++) {
+    max_channels = max(max_channels, passes[i].channels);
+  }
+  const enum xnn_status status = ensure_zero_buffer(reduce_op, max_channels, 2 /* log2(sizeof(float)) */);
+  if (status != xnn_status_success) {
+    return status;
+  }
+
+  const void* pass_input = input;
+  for (size_t i = 0; i < num_passes; i++) {
+    void* pass_output = output;
+    if (i + 1 != num_passes) {
+      pass_output = (void*) ((uintptr_t) reduce_op->intermediate_buffer + intermediate_offset);
+      intermediate_offset += get_intermediate_tensor_size(passes[i].batch_size * passes[i].channels, 2);
+    }
+    // The mean over all groups of axes is the mean of the means over each group.
+    const float scale = reduce_op->reduce_operator == xnn_reduce_mean ? 1.0f / (float) passes[i].rows : 1.0f;
+    union xnn_f32_scaleminmax_params params;
+    xnn_params.f32.gavgpool.init.f32(&params, scale, -INFINITY, INFINITY);
+    setup_global_average_pooling(
+      reduce_op, first_compute_index + i, i, &passes[i],
+      pass_input, pass_output,
+      2 /* log2(sizeof(float)) */,
+      &xnn_params.f32.gavgpool,
+      &params, sizeof(params));
+    pass_input = pass_output;
+  }
+  return xnn_status_success;
+}
+
+// Sets up maximum passes. The first pass reads 'input', the last pass writes 'output', and outputs of other passes are
+// stored one after another in the intermediate buffer. Maximum is exact in any data type, so intermediate tensors have
+// the data type of the input.
+static enum xnn_status setup_reduce_max_passes(
+    xnn_operator_t reduce_op,
+    const struct reduction_pass* passes,
+    size_t num_passes,
+    const void* input,
+    void* output,
+    uint32_t log2_element_size,
+    const struct rdmax_parameters rdmax[restrict XNN_MIN_ELEMENTS(1)],
+    const void* params,
+    size_t params_size,
+    size_t num_threads)
+{
+  if (num_passes > 1) {
+    const enum xnn_status status =
+      ensure_intermediate_buffer(reduce_op, get_pass_outputs_size(passes, num_passes - 1, log2_element_size));
+    if (status != xnn_status_success) {
+      return status;
+    }
+  }
+
+  const void* pass_input = input;
+  size_t intermediate_offset = 0;
+  for (size_t i = 0; i < num_passes; i++) {
+    void* pass_output = output;
+    if (i + 1 != num_passes) {
+      pass_output = (void*) ((uintptr_t) reduce_op->intermediate_buffer + intermediate_offset);
+      intermediate_offset +=
+        get_intermediate_tensor_size(passes[i].batch_size * passes[i].channels, log2_element_size);
+    }
+    setup_reduce_max_discontiguous(
+      reduce_op, i, &passes[i],
+      pass_input, pass_output,
+      log2_element_size,
+      rdmax,
+      params, params_size,
+      num_threads);
+    pass_input = pass_output;
+  }
+  return xnn_status_success;
+}
+
+enum xnn_status xnn_setup_reduce_nd_f32(
+    xnn_operator_t reduce_op,
+    const float* input,
+    float* output,
+    size_t num_input_dims,
+    const size_t* input_shape,
+    size_t num_reduction_axes,
+    const size_t* reduction_axes,
+    pthreadpool_t threadpool)
+{
+  struct reduction_pass passes[XNN_MAX_REDUCE_PASSES];
+  size_t num_passes;
+  enum xnn_status status = setup_reduce_nd(
+    reduce_op, xnn_operator_type_reduce_nd_f32,
+    num_input_dims, input_shape,
+    num_reduction_axes, reduction_axes,
+    passes, &num_passes);
+  if (status != xnn_status_success) {
+    return status;
+  }
+
+  const size_t num_threads = pthreadpool_get_threads_count(threadpool);
+  switch (reduce_op->reduce_operator) {
+    case xnn_reduce_sum:
+    case xnn_reduce_mean:
+    {
+      const size_t batch_size = passes[0].batch_size;
+      const size_t rows = passes[0].rows;
+      if (num_passes == 1 && passes[0].channels == 1 && xnn_params.f32.gavgpool_cw.ukernel != NULL) {
+        // Reduction over the innermost dimension: every batch element is a contiguous row of the input.
+        const float scale = reduce_op->reduce_operator == xnn_reduce_mean ? 1.0f / (float) rows : 1.0f;
+        xnn_init_f32_gavgpool_params(&reduce_op->params.f32_gavgpool, scale, -INFINITY, INFINITY, (uint32_t) rows);
+        reduce_op->context.global_average_pooling_ncw = (struct global_average_pooling_ncw_context) {
+          .input_elements = rows * sizeof(float),
+          .input = input,
+          .input_channel_stride = rows * sizeof(float),
+          .input_batch_stride = batch_size * rows * sizeof(float),
+          .output = output,
+          .output_channel_stride = sizeof(float),
+          .output_batch_stride = batch_size * sizeof(float),
+          .ukernel = xnn_params.f32.gavgpool_cw.ukernel,
+          .params.f32 = reduce_op->params.f32_gavgpool,
+        };
+
+        size_t channel_block = batch_size;
+        if (num_threads > 1) {
+          const size_t target_tiles_per_thread = 5;
+          const size_t max_channel_block = divide_round_up(batch_size, num_threads * target_tiles_per_thread);
+          channel_block = min(channel_block, round_up_po2(max_channel_block, 4));
+        }
+
+        reduce_op->compute.type = xnn_parallelization_type_2d_tile_1d;
+        reduce_op->compute.task_2d_tile_1d = (pthreadpool_task_2d_tile_1d_t) xnn_compute_global_average_pooling_ncw;
+        reduce_op->compute.range[0] = 1;
+        reduce_op->compute.range[1] = batch_size;
+        reduce_op->compute.tile[0] = channel_block;
+      } else {
+        if (num_passes > 1) {
+          status = ensure_intermediate_buffer(
+            reduce_op, get_pass_outputs_size(passes, num_passes - 1, 2 /* log2(sizeof(float)) */));
+          if (status != xnn_status_success) {
+            return status;
+          }
+        }
+        status = setup_f32_sum_passes(
+          reduce_op, 0 /* first compute index */, passes, num_passes, input, output, 0 /* intermediate offset */);
+        if (status != xnn_status_success) {
+          return status;
+        }
+      }
+      break;
+    }
+    case xnn_reduce_max:
+      if (num_passes == 1 && passes[0].channels == 1) {
+        // Reduction over the innermost dimension: every batch element is a contiguous row of the input.
+        const size_t rows = passes[0].rows;
+        reduce_op->context.reduce_max_contiguous = (struct reduce_max_contiguous_context) {
+          .scaled_elements = rows * sizeof(float),
+          .input = input,
+          .input_stride = rows * sizeof(float),
+          .output = output,
+          .output_stride = sizeof(float),
+          .ukernel = xnn_params.f32.rmax,
+        };
+        reduce_op->compute.type = xnn_parallelization_type_1d;
+        reduce_op->compute.task_1d = (pthreadpool_task_1d_t) xnn_compute_f32_reduce_max_contiguous;
+        reduce_op->compute.range[0] = passes[0].batch_size;
+      } else {
+        union xnn_f32_default_params params;
+        if (xnn_params.f32.rdmax.init.f32 != NULL) {
+          xnn_params.f32.rdmax.init.f32(&params);
+        }
+        status = setup_reduce_max_passes(
+          reduce_op, passes, num_passes, input, output,
+          2 /* log2(sizeof(float)) */,
+          &xnn_params.f32.rdmax,
+          &params, sizeof(params),
+          num_threads);
+        if (status != xnn_status_success) {
+          return status;
+        }
+      }
+      break;
+    default:
+      XNN_UNREACHABLE;
+  }
+  reduce_op->state = xnn_run_state_ready;
+
+  return xnn_status_success;
+}
+
+// Sum and mean over non-adjacent axes can't go through INT8 intermediate tensors, which would round partial results.
+// Instead, the input is dequantized into an F32 tensor, reduced in F32 passes, and the F32 result is quantized into
+// the output.
+static enum xnn_status setup_qs8_sum_passes(
+    xnn_operator_t reduce_op,
+    const struct reduction_pass* passes,
+    size_t num_passes,
+    const int8_t* input,
+    int8_t* output,
+    size_t num_threads)
+{
+  const uint32_t required_init_flags = XNN_INIT_FLAG_F32 | XNN_INIT_FLAG_VCVT;
+  if ((xnn_params.init_flags & required_init_flags) != required_init_flags) {
+    xnn_log_error(
+      "failed to setup %s operator: reductions over non-adjacent axes require F32 operations and conversions",
+      xnn_operator_type_to_string(reduce_op->type));
+    return xnn_status_unsupported_hardware;
+  }
+
+  // The intermediate buffer holds the dequantized input, the outputs of all passes but the last one, and the F32
+  // result.
+  const size_t num_input_elements = passes[0].batch_size * passes[0].rows * passes[0].channels;
+  const size_t num_output_elements = passes[num_passes - 1].batch_size * passes[num_passes - 1].channels;
+  const size_t pass_outputs_offset = get_intermediate_tensor_size(num_input_elements, 2 /* log2(sizeof(float)) */);
+  const size_t result_offset =
+    pass_outputs_offset + get_pass_outputs_size(passes, num_passes - 1, 2 /* log2(sizeof(float)) */);
+  enum xnn_status status = ensure_intermediate_buffer(
+    reduce_op, result_offset + get_intermediate_tensor_size(num_output_elements, 2 /* log2(sizeof(float)) */));
+  if (status != xnn_status_success) {
+    return status;
+  }
+  float* dequantized_input = (float*) reduce_op->intermediate_buffer;
+  float* result = (float*) ((uintptr_t) reduce_op->intermediate_buffer + result_offset);
+
+  union xnn_qs8_f32_cvt_params dequantize_params;
+  if (xnn_params.vcvt.qs8_to_f32.init.qs8_f32_cvt != NULL) {
+    xnn_params.vcvt.qs8_to_f32.init.qs8_f32_cvt(
+      &dequantize_params, reduce_op->input_scale, (int8_t) reduce_op->input_zero_point);
+  }
+  setup_convert(
+    reduce_op, 0 /* compute index */, &reduce_op->context.reduce.dequantize,
+    input, dequantized_input, num_input_elements,
+    0 /* log2(sizeof(int8_t)) */, 2 /* log2(sizeof(float)) */,
+    xnn_params.vcvt.qs8_to_f32.ukernel,
+    &dequantize_params, sizeof(dequantize_params),
+    num_threads);
+
+  status = setup_f32_sum_passes(
+    reduce_op, 1 /* first compute index */, passes, num_passes, dequantized_input, result, pass_outputs_offset);
+  if (status != xnn_status_success) {
+    return status;
+  }
+
+  union xnn_f32_qs8_cvt_params quantize_params;
+  if (xnn_params.vcvt.f32_to_qs8.init.f32_qs8_cvt != NULL) {
+    xnn_params.vcvt.f32_to_qs8.init.f32_qs8_cvt(
+      &quantize_params, 1.0f / reduce_op->output_scale, (int8_t) reduce_op->output_zero_point,
+      (int8_t) reduce_op->output_min, (int8_t) reduce_op->output_max);
+  }
+  setup_convert(
+    reduce_op, num_passes + 1 /* compute index */, &reduce_op->context.reduce.quantize,
+    result, output, num_output_elements,
+    2 /* log2(sizeof(float)) */, 0 /* log2(sizeof(int8_t)) */,
+    xnn_params.vcvt.f32_to_qs8.ukernel,
+    &quantize_params, sizeof(quantize_params),
+    num_threads);
+  return xnn_status_success;
+}
+
+enum xnn_status xnn_setup_reduce_nd_qs8(
+    xnn_operator_t reduce_op,
+    const int8_t* input,
+    int8_t* output,
+    size_t num_input_dims,
+    const size_t* input_shape,
+    size_t num_reduction_axes,
+    const size_t* reduction_axes,
+    pthreadpool_t threadpool)
+{
+  struct reduction_pass passes[XNN_MAX_REDUCE_PASSES];
+  size_t num_passes;
+  enum xnn_status status = setup_reduce_nd(
+    reduce_op, xnn_operator_type_reduce_nd_qs8,
+    num_input_dims, input_shape,
+    num_reduction_axes, reduction_axes,
+    passes, &num_passes);
+  if (status != xnn_status_success) {
+    return status;
+  }
+
+  const size_t num_threads = pthreadpool_get_threads_count(threadpool);
+  // Reductions over the innermost dimension are processed as single-channel reductions with a stride of one element.
+  switch (reduce_op->reduce_operator) {
+    case xnn_reduce_sum:
+    case xnn_reduce_mean:
+    {
+      if (num_passes > 1) {
+        status = setup_qs8_sum_passes(reduce_op, passes, num_passes, input, output, num_threads);
+        if (status != xnn_status_success) {
+          return status;
+        }
+        break;
+      }
+
+      const size_t rows = passes[0].rows;
+      // Accumulators of the Global Average Pooling micro-kernels are 32-bit.
+      if (rows > (size_t) (INT32_MAX >> 8)) {
+        xnn_log_error(
+          "failed to setup %s operator with %zu reduced elements: number of reduced elements must not exceed %" PRId32,
+          xnn_operator_type_to_string(reduce_op->type), rows, INT32_MAX >> 8);
+        return xnn_status_unsupported_parameter;
+      }
+
+      float scale = reduce_op->input_scale / reduce_op->output_scale;
+      if (reduce_op->reduce_operator == xnn_reduce_mean) {
+        scale /= (float) rows;
+      }
+      if (scale < 0x1.0p-32f || scale >= 0x1.0p+8f) {
+        xnn_log_error(
+          "failed to setup %s operator with %.7g input-to-output scale ratio over %zu reduced elements: "
+          "scale ratio must be in [2**-32, 2**8) range",
+          xnn_operator_type_to_string(reduce_op->type), scale, rows);
+        return xnn_status_unsupported_parameter;
+      }
+
+      // The zero buffer is shared with F32 passes over non-adjacent axes, and is sized for F32 elements.
+      status = ensure_zero_buffer(reduce_op, passes[0].channels, 2 /* log2(sizeof(float)) */);
+      if (status != xnn_status_success) {
+        return status;
+      }
+
+      const int32_t bias = -((int32_t) rows * reduce_op->input_zero_point);
+      xnn_params.qs8.gavgpool.update.qs8(&reduce_op->params.qs8_gavgpool, bias, scale);
+      setup_global_average_pooling(
+        reduce_op, 0 /* compute index */, 0 /* pass index */, &passes[0], input, output,
+        0 /* log2(sizeof(int8_t)) */,
+        &xnn_params.qs8.gavgpool,
+        &reduce_op->params.qs8_gavgpool, sizeof(reduce_op->params.qs8_gavgpool));
+      break;
+    }
+    case xnn_reduce_max:
+      status = setup_reduce_max_passes(
+        reduce_op, passes, num_passes, input, output,
+        0 /* log2(sizeof(int8_t)) */,
+        &xnn_params.s8.rdmax,
+        &reduce_op->params.s8_minmax, sizeof(reduce_op->params.s8_minmax),
+        num_threads);
+      if (status != xnn_status_success) {
+        return status;
+      }
+      break;
+    default:
+      XNN_UNREACHABLE;
+  }
+  reduce_op->state = xnn_run_state_ready;
+
+  return xnn_status_success;
+}
@@ -0,0 +1,270 @@
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#include <xnnpack.h>
+#include <xnnpack/allocator.h>
+#include <xnnpack/log.h>
+#include <xnnpack/operator.h>
+#include <xnnpack/params.h>
+
+
+static enum xnn_status create_slice_nd(
+    uint32_t flags,
+    enum xnn_operator_type operator_type,
+    xnn_operator_t* slice_op_out)
+{
+  xnn_operator_t slice_op = NULL;
+  enum xnn_status status = xnn_status_uninitialized;
+
+  if ((xnn_params.init_flags & XNN_INIT_FLAG_XNNPACK) == 0) {
+    xnn_log_error(
+      "failed to create %s operator: XNNPACK is not initialized",
+      xnn_operator_type_to_string(operator_type));
+    goto error;
+  }
+
+  status = xnn_status_out_of_memory;
+
+  slice_op = xnn_allocate_zero_simd_memory(sizeof(struct xnn_operator));
+  if (slice_op == NULL) {
+    xnn_log_error(
+      "failed to allocate %zu bytes for %s operator descriptor",
+      sizeof(struct xnn_operator), xnn_operator_type_to_string(operator_type));
+    goto error;
+  }
+
+  slice_op->type = operator_type;
+  slice_op->flags = flags;
+
+  slice_op->state = xnn_run_state_invalid;
+
+  *slice_op_out = slice_op;
+  return xnn_status_success;
+
+error:
+  xnn_delete_operator(slice_op);
+  return status;
+}
+
+enum xnn_status xnn_create_slice_nd_x8(
+  uint32_t flags,
+  xnn_operator_t* slice_op_out)
+{
+  return create_slice_nd(flags, xnn_operator_type_slice_nd_x8, slice_op_out);
+}
+
+enum xnn_status xnn_create_slice_nd_x32(
+  uint32_t flags,
+  xnn_operator_t* slice_op_out)
+{
+  return create_slice_nd(flags, xnn_operator_type_slice_nd_x32, slice_op_out);
+}
+
+static enum xnn_status setup_slice_nd(
+    xnn_operator_t slice_op,
+    enum xnn_operator_type expected_operator_type,
+    size_t num_dims,
+    const size_t* input_shape,
+    const size_t* offsets,
+    const size_t* sizes,
+    const size_t* strides,
+    const void* input,
+    void* output,
+    uint32_t log2_element_size,
+    size_t num_threads)
+{
+  if (slice_op->type != expected_operator_type) {
+    xnn_log_error("failed to setup operator: operator type mismatch (expected %s, got %s)",
+      xnn_operator_type_to_string(expected_operator_type),
+      xnn_operator_type_to_string(slice_op->type));
+    return xnn_status_invalid_parameter;
+  }
+  slice_op->state = xnn_run_state_invalid;
+
+  if ((xnn_params.init_flags & XNN_INIT_FLAG_XNNPACK) == 0) {
+    xnn_log_error("failed to setup %s operator: XNNPACK is not initialized",
+      xnn_operator_type_to_string(slice_op->type));
+    return xnn_status_uninitialized;
+  }
+
+  if (num_dims > XNN_MAX_TENSOR_DIMS) {
+    xnn_log_error(
+      "failed to setup %s operator with %zu dimensions in input shape: "
+      "the number of input dimensions must not exceed %d",
+      xnn_operator_type_to_string(slice_op->type), num_dims, XNN_MAX_TENSOR_DIMS);
+    return xnn_status_unsupported_parameter;
+  }
+
+  for (size_t i = 0; i < num_dims; i++) {
+    if (input_shape[i] == 0) {
+      xnn_log_error(
+        "failed to setup %s operator: input shape dimension #%zu is zero",
+        xnn_operator_type_to_string(slice_op->type), i);
+      return xnn_status_invalid_parameter;
+    }
+    if (sizes[i] == 0) {
+      xnn_log_error(
+        "failed to setup %s operator: slice size in dimension #%zu is zero",
+        xnn_operator_type_to_string(slice_op->type), i);
+      return xnn_status_invalid_parameter;
+    }
+    const size_t stride = strides != NULL ? strides[i] : 1;
+    if (stride == 0) {
+      xnn_log_error(
+        "failed to setup %s operator: slice stride in dimension #%zu is zero",
+        xnn_operator_type_to_string(slice_op->type), i);
+      return xnn_status_invalid_parameter;
+    }
+    if (offsets[i] >= input_shape[i] || (sizes[i] - 1) * stride >= input_shape[i] - offsets[i]) {
+      xnn_log_error(
+        "failed to setup %s operator: slice with offset %zu, size %zu, and stride %zu in dimension #%zu "
+        "exceeds input dimension %zu",
+        xnn_operator_type_to_string(slice_op->type), offsets[i], sizes[i], stride, i, input_shape[i]);
+      return xnn_status_invalid_parameter;
+    }
+  }
+
+  // Describe the slice as a list of (size, input step) pairs, innermost dimension first, with steps in elements.
+  // Dimensions of size 1 only contribute to the input offset, and a dimension is merged into the next inner one when
+  // the elements they select are evenly spaced in the input.
+  size_t num_normalized_dims = 0;
+  size_t normalized_sizes[XNN_MAX_TENSOR_DIMS];
+  size_t normalized_steps[XNN_MAX_TENSOR_DIMS];
+  size_t input_offset = 0;
+  size_t input_dim_stride = 1;
+  for (size_t i = 0; i < num_dims; i++) {
+    const size_t dim = num_dims - 1 - i;
+    const size_t size = sizes[dim];
+    const size_t step = (strides != NULL ? strides[dim] : 1) * input_dim_stride;
+    input_offset += offsets[dim] * input_dim_stride;
+    input_dim_stride *= input_shape[dim];
+
+    if (size == 1) {
+      continue;
+    }
+    if (num_normalized_dims != 0 &&
+        normalized_steps[num_normalized_dims - 1] * normalized_sizes[num_normalized_dims - 1] == step)
+    {
+      normalized_sizes[num_normalized_dims - 1] *= size;
+    } else {
+      normalized_sizes[num_normalized_dims] = size;
+      normalized_steps[num_normalized_dims] = step;
+      num_normalized_dims += 1;
+    }
+  }
+  if (num_normalized_dims == 0) {
+    normalized_sizes[0] = 1;
+    normalized_steps[0] = 1;
+    num_normalized_dims = 1;
+  }
+
+  const void* slice_input = (const void*) ((uintptr_t) input + (input_offset << log2_element_size));
+  if (num_normalized_dims == 1 && normalized_steps[0] == 1 && slice_input == output) {
+    // The output is a view of the input, and there is nothing to copy.
+    slice_op->state = xnn_run_state_skip;
+    return xnn_status_success;
+  }
+
+  slice_op->context.slice = (struct slice_context) {
+    .input = slice_input,
+    .output = output,
+    .pad_ukernel = xnn_params.xx.pad.ukernel,
+  };
+
+  // The micro-kernel copies a block of rows. If the innermost dimension is contiguous, each of its runs is a row, and
+  // the rows are taken from the next dimension. Otherwise, each task gathers all elements along the innermost
+  // dimension without the micro-kernel.
+  size_t first_parallel_dim;
+  size_t output_stride;
+  if (normalized_steps[0] == 1) {
+    slice_op->context.slice.row_size = normalized_sizes[0] << log2_element_size;
+    if (num_normalized_dims > 1) {
+      slice_op->context.slice.rows = normalized_sizes[1];
+      slice_op->context.slice.input_row_stride = normalized_steps[1] << log2_element_size;
+      first_parallel_dim = 2;
+    } else {
+      slice_op->context.slice.rows = 1;
+      slice_op->context.slice.input_row_stride = 0;
+      first_parallel_dim = 1;
+    }
+    slice_op->context.slice.output_row_stride = slice_op->context.slice.row_size;
+    output_stride = normalized_sizes[0] * slice_op->context.slice.rows;
+  } else {
+    slice_op->context.slice.row_size = UINT32_C(1) << log2_element_size;
+    slice_op->context.slice.rows = normalized_sizes[0];
+    slice_op->context.slice.input_row_stride = normalized_steps[0] << log2_element_size;
+    slice_op->context.slice.output_row_stride = slice_op->context.slice.row_size;
+    first_parallel_dim = 1;
+    output_stride = normalized_sizes[0];
+  }
+
+  size_t range[XNN_MAX_TENSOR_DIMS - 1];
+  for (size_t i = 0; i < XNN_MAX_TENSOR_DIMS - 1; i++) {
+    const size_t dim = first_parallel_dim + i;
+    if (dim < num_normalized_dims) {
+      range[i] = normalized_sizes[dim];
+      slice_op->context.slice.input_stride[i] = normalized_steps[dim] << log2_element_size;
+      slice_op->context.slice.output_stride[i] = output_stride << log2_element_size;
+      output_stride *= normalized_sizes[dim];
+    } else {
+      range[i] = 1;
+      slice_op->context.slice.input_stride[i] = 0;
+      slice_op->context.slice.output_stride[i] = 0;
+    }
+  }
+
+  slice_op->compute.type = xnn_parallelization_type_5d;
+  slice_op->compute.task_5d = normalized_steps[0] == 1 ?
+    (pthreadpool_task_5d_t) xnn_compute_slice_5d : (pthreadpool_task_5d_t) xnn_compute_strided_slice_5d;
+  slice_op->compute.range[0] = range[4];
+  slice_op->compute.range[1] = range[3];
+  slice_op->compute.range[2] = range[2];
+  slice_op->compute.range[3] = range[1];
+  slice_op->compute.range[4] = range[0];
+  slice_op->state = xnn_run_state_ready;
+
+  return xnn_status_success;
+}
+
+enum xnn_status xnn_setup_slice_nd_x8(
+    xnn_operator_t slice_op,
+    size_t num_dims,
+    const size_t* input_shape,
+    const size_t* offsets,
+    const size_t* sizes,
+    const size_t* strides,
+    const void* input,
+    void* output,
+    pthreadpool_t threadpool)
+{
+  return setup_slice_nd(
+    slice_op, xnn_operator_type_slice_nd_x8,
+    num_dims, input_shape, offsets, sizes, strides,
+    input, output, 0 /* log2(element size) */,
+    pthreadpool_get_threads_count(threadpool));
+}
+
+enum xnn_status xnn_setup_slice_nd_x32(
+    xnn_operator_t slice_op,
+    size_t num_dims,
+    const size_t* input_shape,
+    const size_t* offsets,
+    const size_t* sizes,
+    const size_t* strides,
+    const void* input,
+    void* output,
+    pthreadpool_t threadpool)
+{
+  return setup_slice_nd(
+    slice_op, xnn_operator_type_slice_nd_x32,
+    num_dims, input_shape, offsets, sizes, strides,
+    input, output, 2 /* log2(element size) */,
+    pthreadpool_get_threads_count(threadpool));
+}
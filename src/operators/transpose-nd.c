@@ -0,0 +1,370 @@
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#include <xnnpack.h>
+#include <xnnpack/allocator.h>
+#include <xnnpack/log.h>
+#include <xnnpack/operator.h>
+#include <xnnpack/params.h>
+
+
+static enum xnn_status create_transpose_nd(
+    uint32_t flags,
+    uint32_t datatype_init_flags,
+    enum xnn_operator_type operator_type,
+    xnn_operator_t* transpose_op_out)
+{
+  xnn_operator_t transpose_op = NULL;
+  enum xnn_status status = xnn_status_uninitialized;
+
+  if ((xnn_params.init_flags & XNN_INIT_FLAG_XNNPACK) == 0) {
+    xnn_log_error(
+      "failed to create %s operator: XNNPACK is not initialized",
+      xnn_operator_type_to_string(operator_type));
+    goto error;
+  }
+
+  status = xnn_status_unsupported_hardware;
+
+  if ((xnn_params.init_flags & datatype_init_flags) != datatype_init_flags) {
+    xnn_log_error(
+      "failed to create %s operator: operations on data type are not supported",
+      xnn_operator_type_to_string(operator_type));
+    goto error;
+  }
+
+  status = xnn_status_out_of_memory;
+
+  transpose_op = xnn_allocate_zero_simd_memory(sizeof(struct xnn_operator));
+  if (transpose_op == NULL) {
+    xnn_log_error(
+      "failed to allocate %zu bytes for %s operator descriptor",
+      sizeof(struct xnn_operator), xnn_operator_type_to_string(operator_type));
+    goto error;
+  }
+
+  transpose_op->type = operator_type;
+  transpose_op->flags = flags;
+
+  transpose_op->state = xnn_run_state_invalid;
+
+  *transpose_op_out = transpose_op;
+  return xnn_status_success;
+
+error:
+  xnn_delete_operator(transpose_op);
+  return status;
+}
+
+enum xnn_status xnn_create_transpose_nd_x8(
+  uint32_t flags,
+  xnn_operator_t* transpose_op_out)
+{
+  return create_transpose_nd(flags, XNN_INIT_FLAG_X8, xnn_operator_type_transpose_nd_x8, transpose_op_out);
+}
+
+enum xnn_status xnn_create_transpose_nd_x16(
+  uint32_t flags,
+  xnn_operator_t* transpose_op_out)
+{
+  return create_transpose_nd(flags, XNN_INIT_FLAG_X16, xnn_operator_type_transpose_nd_x16, transpose_op_out);
+}
+
+enum xnn_status xnn_create_transpose_nd_x32(
+  uint32_t flags,
+  xnn_operator_t* transpose_op_out)
+{
+  return create_transpose_nd(flags, XNN_INIT_FLAG_X32, xnn_operator_type_transpose_nd_x32, transpose_op_out);
+}
+
+static const struct transpose_parameters* get_transpose_parameters(size_t element_size)
+{
+  switch (element_size) {
+    case sizeof(uint8_t):
+      return &xnn_params.x8.transpose;
+    case sizeof(uint16_t):
+      return &xnn_params.x16.transpose;
+    case sizeof(uint32_t):
+      return &xnn_params.x32.transpose;
+    default:
+      return NULL;
+  }
+}
+
+static enum xnn_status setup_transpose_nd(
+    xnn_operator_t transpose_op,
+    enum xnn_operator_type expected_operator_type,
+    const void* input,
+    void* output,
+    size_t num_dims,
+    const size_t* input_shape,
+    const size_t* perm,
+    size_t element_size,
+    size_t num_threads)
+{
+  if (transpose_op->type != expected_operator_type) {
+    xnn_log_error("failed to setup operator: operator type mismatch (expected %s, got %s)",
+      xnn_operator_type_to_string(expected_operator_type),
+      xnn_operator_type_to_string(transpose_op->type));
+    return xnn_status_invalid_parameter;
+  }
+  transpose_op->state = xnn_run_state_invalid;
+
+  if ((xnn_params.init_flags & XNN_INIT_FLAG_XNNPACK) == 0) {
+    xnn_log_error("failed to setup %s operator: XNNPACK is not initialized",
+      xnn_operator_type_to_string(transpose_op->type));
+    return xnn_status_uninitialized;
+  }
+
+  if (num_dims > XNN_MAX_TENSOR_DIMS) {
+    xnn_log_error(
+      "failed to setup %s operator with %zu dimensions in input shape: "
+      "the number of input dimensions must not exceed %d",
+      xnn_operator_type_to_string(transpose_op->type), num_dims, XNN_MAX_TENSOR_DIMS);
+    return xnn_status_unsupported_parameter;
+  }
+
+  bool used_dims[XNN_MAX_TENSOR_DIMS] = { false };
+  for (size_t i = 0; i < num_dims; i++) {
+    if (input_shape[i] == 0) {
+      xnn_log_error(
+        "failed to setup %s operator: input shape dimension #%zu is zero",
+        xnn_operator_type_to_string(transpose_op->type), i);
+      return xnn_status_invalid_parameter;
+    }
+    if (perm[i] >= num_dims) {
+      xnn_log_error(
+        "failed to setup %s operator: permutation element #%zu (%zu) exceeds the number of dimensions (%zu)",
+        xnn_operator_type_to_string(transpose_op->type), i, perm[i], num_dims);
+      return xnn_status_invalid_parameter;
+    }
+    if (used_dims[perm[i]]) {
+      xnn_log_error(
+        "failed to setup %s operator: permutation element #%zu (%zu) is repeated",
+        xnn_operator_type_to_string(transpose_op->type), i, perm[i]);
+      return xnn_status_invalid_parameter;
+    }
+    used_dims[perm[i]] = true;
+  }
+
+  // Squeeze dimensions of size 1: they don't affect the memory layout.
+  size_t squeezed_dim_index[XNN_MAX_TENSOR_DIMS];
+  size_t squeezed_shape[XNN_MAX_TENSOR_DIMS];
+  size_t num_squeezed_dims = 0;
+  for (size_t i = 0; i < num_dims; i++) {
+    if (input_shape[i] != 1) {
+      squeezed_dim_index[i] = num_squeezed_dims;
+      squeezed_shape[num_squeezed_dims++] = input_shape[i];
+    }
+  }
+  size_t squeezed_perm[XNN_MAX_TENSOR_DIMS];
+  size_t num_squeezed_perm = 0;
+  for (size_t i = 0; i < num_dims; i++) {
+    if (input_shape[perm[i]] != 1) {
+      squeezed_perm[num_squeezed_perm++] = squeezed_dim_index[perm[i]];
+    }
+  }
+  assert(num_squeezed_perm == num_squeezed_dims);
+
+  // Coalesce input dimensions which stay adjacent and in the same order in the output.
+  size_t normalized_shape[XNN_MAX_TENSOR_DIMS];
+  size_t normalized_perm[XNN_MAX_TENSOR_DIMS];
+  size_t normalized_dim_index[XNN_MAX_TENSOR_DIMS];
+  size_t num_normalized_dims = 0;
+  for (size_t i = 0; i < num_squeezed_dims; i++) {
+    if (i != 0 && squeezed_perm[i] == squeezed_perm[i - 1] + 1) {
+      continue;
+    }
+    normalized_perm[num_normalized_dims++] = squeezed_perm[i];
+  }
+  // Input dimensions which start an output run get consecutive indices in the normalized input shape.
+  size_t num_runs = 0;
+  for (size_t d = 0; d < num_squeezed_dims; d++) {
+    bool starts_run = true;
+    for (size_t i = 1; i < num_squeezed_dims; i++) {
+      if (squeezed_perm[i] == d && squeezed_perm[i - 1] + 1 == d) {
+        starts_run = false;
+        break;
+      }
+    }
+    if (starts_run) {
+      normalized_dim_index[d] = num_runs;
+      normalized_shape[num_runs++] = squeezed_shape[d];
+    } else {
+      normalized_shape[num_runs - 1] *= squeezed_shape[d];
+    }
+  }
+  assert(num_runs == num_normalized_dims);
+  for (size_t i = 0; i < num_normalized_dims; i++) {
+    normalized_perm[i] = normalized_dim_index[normalized_perm[i]];
+  }
+
+  // If the innermost dimension stays innermost, whole rows move together as single elements.
+  if (num_normalized_dims != 0 && normalized_perm[num_normalized_dims - 1] == num_normalized_dims - 1) {
+    element_size *= normalized_shape[--num_normalized_dims];
+  }
+
+  if (num_normalized_dims == 0) {
+    // The permutation doesn't change the memory layout.
+    const size_t block_size = 4096;
+    transpose_op->context.univector_contiguous = (struct univector_contiguous_context) {
+      .x = input,
+      .x_stride = element_size,
+      .y = output,
+      .y_stride = element_size,
+      .log2_xsize = 0,
+      .log2_ysize = 0,
+      .ukernel = xnn_params.xx.copy,
+    };
+    transpose_op->compute.type = xnn_parallelization_type_1d_tile_1d;
+    transpose_op->compute.task_1d_tile_1d = (pthreadpool_task_1d_tile_1d_t) xnn_compute_univector_contiguous;
+    transpose_op->compute.range[0] = element_size;
+    transpose_op->compute.tile[0] = (num_threads == 1) ? element_size : block_size;
+    transpose_op->state = xnn_run_state_ready;
+    return xnn_status_success;
+  }
+  assert(num_normalized_dims >= 2);
+
+  size_t input_stride[XNN_MAX_TENSOR_DIMS];
+  size_t output_stride[XNN_MAX_TENSOR_DIMS];
+  size_t input_dim_stride = element_size;
+  size_t output_dim_stride = element_size;
+  for (size_t i = num_normalized_dims; i-- != 0; ) {
+    input_stride[i] = input_dim_stride;
+    output_stride[i] = output_dim_stride;
+    input_dim_stride *= normalized_shape[i];
+    output_dim_stride *= normalized_shape[normalized_perm[i]];
+  }
+
+  // Iterate over output dimensions in the output order, but move the output dimension which is innermost in the
+  // input to the second-to-last position: the two innermost dimensions of the iteration space are tiled and passed
+  // to the micro-kernel.
+  const size_t last_input_dim = num_normalized_dims - 1;
+  size_t loop_dims = 0;
+  size_t loop_range[XNN_MAX_TENSOR_DIMS];
+  transpose_op->context.transpose = (struct transpose_context) {
+    .input = input,
+    .output = output,
+    .element_size = element_size,
+  };
+  size_t input_contiguous_output_dim = 0;
+  for (size_t i = 0; i < num_normalized_dims; i++) {
+    if (normalized_perm[i] == last_input_dim) {
+      input_contiguous_output_dim = i;
+      continue;
+    }
+    if (i == num_normalized_dims - 1) {
+      transpose_op->context.transpose.input_stride[loop_dims + 1] = input_stride[normalized_perm[i]];
+      transpose_op->context.transpose.output_stride[loop_dims + 1] = output_stride[i];
+      loop_range[loop_dims + 1] = normalized_shape[normalized_perm[i]];
+    } else {
+      transpose_op->context.transpose.input_stride[loop_dims] = input_stride[normalized_perm[i]];
+      transpose_op->context.transpose.output_stride[loop_dims] = output_stride[i];
+      loop_range[loop_dims] = normalized_shape[normalized_perm[i]];
+      loop_dims += 1;
+    }
+  }
+  assert(loop_dims == num_normalized_dims - 2);
+  transpose_op->context.transpose.input_stride[loop_dims] = input_stride[last_input_dim];
+  transpose_op->context.transpose.output_stride[loop_dims] = output_stride[input_contiguous_output_dim];
+  loop_range[loop_dims] = normalized_shape[last_input_dim];
+
+  const struct transpose_parameters* transpose_parameters = get_transpose_parameters(element_size);
+  size_t tile_size;
+  if (transpose_parameters != NULL && transpose_parameters->const_size_ukernel != NULL) {
+    transpose_op->context.transpose.const_size_ukernel = transpose_parameters->const_size_ukernel;
+    tile_size = transpose_parameters->tile_size;
+  } else {
+    // Elements of other sizes are copied one by one; limit the tile to about 16 KB.
+    tile_size = 32;
+    while (tile_size > 1 && tile_size * tile_size * element_size > 16384) {
+      tile_size >>= 1;
+    }
+  }
+
+  transpose_op->compute.tile[0] = tile_size;
+  transpose_op->compute.tile[1] = tile_size;
+  for (size_t i = 0; i < num_normalized_dims; i++) {
+    transpose_op->compute.range[i] = loop_range[i];
+  }
+  switch (num_normalized_dims) {
+    case 2:
+      transpose_op->compute.type = xnn_parallelization_type_2d_tile_2d;
+      transpose_op->compute.task_2d_tile_2d = (pthreadpool_task_2d_tile_2d_t) xnn_compute_transpose_2d;
+      break;
+    case 3:
+      transpose_op->compute.type = xnn_parallelization_type_3d_tile_2d;
+      transpose_op->compute.task_3d_tile_2d = (pthreadpool_task_3d_tile_2d_t) xnn_compute_transpose_3d;
+      break;
+    case 4:
+      transpose_op->compute.type = xnn_parallelization_type_4d_tile_2d;
+      transpose_op->compute.task_4d_tile_2d = (pthreadpool_task_4d_tile_2d_t) xnn_compute_transpose_4d;
+      break;
+    case 5:
+      transpose_op->compute.type = xnn_parallelization_type_5d_tile_2d;
+      transpose_op->compute.task_5d_tile_2d = (pthreadpool_task_5d_tile_2d_t) xnn_compute_transpose_5d;
+      break;
+    case 6:
+      transpose_op->compute.type = xnn_parallelization_type_6d_tile_2d;
+      transpose_op->compute.task_6d_tile_2d = (pthreadpool_task_6d_tile_2d_t) xnn_compute_transpose_6d;
+      break;
+    default:
+      XNN_UNREACHABLE;
+  }
+  transpose_op->state = xnn_run_state_ready;
+
+  return xnn_status_success;
+}
+
+enum xnn_status xnn_setup_transpose_nd_x8(
+    xnn_operator_t transpose_op,
+    const void* input,
+    void* output,
+    size_t num_dims,
+    const size_t* input_shape,
+    const size_t* perm,
+    pthreadpool_t threadpool)
+{
+  return setup_transpose_nd(
+    transpose_op, xnn_operator_type_transpose_nd_x8,
+    input, output, num_dims, input_shape, perm,
+    sizeof(uint8_t), pthreadpool_get_threads_count(threadpool));
+}
+
+enum xnn_status xnn_setup_transpose_nd_x16(
+    xnn_operator_t transpose_op,
+    const void* input,
+    void* output,
+    size_t num_dims,
+    const size_t* input_shape,
+    const size_t* perm,
+    pthreadpool_t threadpool)
+{
+  return setup_transpose_nd(
+    transpose_op, xnn_operator_type_transpose_nd_x16,
+    input, output, num_dims, input_shape, perm,
+    sizeof(uint16_t), pthreadpool_get_threads_count(threadpool));
+}
+
+enum xnn_status xnn_setup_transpose_nd_x32(
+    xnn_operator_t transpose_op,
+    const void* input,
+    void* output,
+    size_t num_dims,
+    const size_t* input_shape,
+    const size_t* perm,
+    pthreadpool_t threadpool)
+{
+  return setup_transpose_nd(
+    transpose_op, xnn_operator_type_transpose_nd_x32,
+    input, output, num_dims, input_shape, perm,
+    sizeof(uint32_t), pthreadpool_get_threads_count(threadpool));
+}
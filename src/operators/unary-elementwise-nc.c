@@ -479,6 +479,21 @@ enum xnn_status xnn_create_convert_nc_qu8_f32(
     convert_op_out);
 }
 
+enum xnn_status xnn_create_copy_nc_x8(
+    size_t channels,
+    size_t input_stride,
+    size_t output_stride,
+    uint32_t flags,
+    xnn_operator_t* copy_op_out)
+{
+  return create_unary_elementwise_nc(
+    channels, input_stride, output_stride, flags,
+    NULL, 0,
+    xnn_operator_type_copy_nc_x8,
+    xnn_params.xx.copy,
+    copy_op_out);
+}
+
 enum xnn_status xnn_create_copy_nc_x32(
     size_t channels,
     size_t input_stride,
@@ -540,6 +555,25 @@ enum xnn_status xnn_create_floor_nc_f32(
     floor_op_out);
 }
 
+enum xnn_status xnn_create_gelu_nc_f32(
+    size_t channels,
+    size_t input_stride,
+    size_t output_stride,
+    uint32_t flags,
+    xnn_operator_t* gelu_op_out)
+{
+  union xnn_f32_gelu_params params;
+  if (xnn_params.f32.gelu.init.f32_gelu != NULL) {
+    xnn_params.f32.gelu.init.f32_gelu(&params);
+  }
+  return create_unary_elementwise_nc(
+    channels, input_stride, output_stride, flags,
+    &params, sizeof(params),
+    xnn_operator_type_gelu_nc_f32,
+    xnn_params.f32.gelu.ukernel,
+    gelu_op_out);
+}
+
 enum xnn_status xnn_create_hardswish_nc_f16(
     size_t channels,
     size_t input_stride,
@@ -694,6 +728,25 @@ enum xnn_status xnn_create_square_root_nc_f32(
     sqrt_op_out);
 }
 
+enum xnn_status xnn_create_tanh_nc_f32(
+    size_t channels,
+    size_t input_stride,
+    size_t output_stride,
+    uint32_t flags,
+    xnn_operator_t* tanh_op_out)
+{
+  union xnn_f32_tanh_params params;
+  if (xnn_params.f32.tanh.init.f32_tanh != NULL) {
+    xnn_params.f32.tanh.init.f32_tanh(&params);
+  }
+  return create_unary_elementwise_nc(
+    channels, input_stride, output_stride, flags,
+    &params, sizeof(params),
+    xnn_operator_type_tanh_nc_f32,
+    xnn_params.f32.tanh.ukernel,
+    tanh_op_out);
+}
+
 enum xnn_status xnn_create_truncation_nc_f32(
     size_t channels,
     size_t input_stride,
@@ -1001,6 +1054,30 @@ enum xnn_status xnn_setup_convert_nc_qu8_f32(
     pthreadpool_get_threads_count(threadpool));
 }
 
+enum xnn_status xnn_setup_copy_nc_x8(
+    xnn_operator_t copy_op,
+    size_t batch_size,
+    const void* input,
+    void* output,
+    pthreadpool_t threadpool)
+{
+  if (copy_op->type != xnn_operator_type_copy_nc_x8) {
+    xnn_log_error("failed to setup operator: operator type mismatch (expected %s, got %s)",
+      xnn_operator_type_to_string(xnn_operator_type_copy_nc_x8),
+      xnn_operator_type_to_string(copy_op->type));
+    return xnn_status_invalid_parameter;
+  }
+  copy_op->state = xnn_run_state_invalid;
+
+  return setup_unary_elementwise_nc(
+    copy_op,
+    batch_size, input, output,
+    0 /* log2(sizeof(uint8_t)) */,
+    0 /* log2(sizeof(uint8_t)) */,
+    NULL, 0,
+    pthreadpool_get_threads_count(threadpool));
+}
+
 enum xnn_status xnn_setup_copy_nc_x32(
     xnn_operator_t copy_op,
     size_t batch_size,
@@ -1073,6 +1150,30 @@ enum xnn_status xnn_setup_floor_nc_f32(
     pthreadpool_get_threads_count(threadpool));
 }
 
+enum xnn_status xnn_setup_gelu_nc_f32(
+    xnn_operator_t gelu_op,
+    size_t batch_size,
+    const float* input,
+    float* output,
+    pthreadpool_t threadpool)
+{
+  if (gelu_op->type != xnn_operator_type_gelu_nc_f32) {
+    xnn_log_error("failed to setup operator: operator type mismatch (expected %s, got %s)",
+      xnn_operator_type_to_string(xnn_operator_type_gelu_nc_f32),
+      xnn_operator_type_to_string(gelu_op->type));
+    return xnn_status_invalid_parameter;
+  }
+  gelu_op->state = xnn_run_state_invalid;
+
+  return setup_unary_elementwise_nc(
+    gelu_op,
+    batch_size, input, output,
+    2 /* log2(sizeof(float)) */,
+    2 /* log2(sizeof(float)) */,
+    &gelu_op->params.f32_gelu, sizeof(gelu_op->params.f32_gelu),
+    pthreadpool_get_threads_count(threadpool));
+}
+
 enum xnn_status xnn_setup_hardswish_nc_f16(
     xnn_operator_t hardswish_op,
     size_t batch_size,
@@ -1241,6 +1342,30 @@ enum xnn_status xnn_setup_square_root_nc_f32(
     pthreadpool_get_threads_count(threadpool));
 }
 
+enum xnn_status xnn_setup_tanh_nc_f32(
+    xnn_operator_t tanh_op,
+    size_t batch_size,
+    const float* input,
+    float* output,
+    pthreadpool_t threadpool)
+{
+  if (tanh_op->type != xnn_operator_type_tanh_nc_f32) {
+    xnn_log_error("failed to setup operator: operator type mismatch (expected %s, got %s)",
+      xnn_operator_type_to_string(xnn_operator_type_tanh_nc_f32),
+      xnn_operator_type_to_string(tanh_op->type));
+    return xnn_status_invalid_parameter;
+  }
+  tanh_op->state = xnn_run_state_invalid;
+
+  return setup_unary_elementwise_nc(
+    tanh_op,
+    batch_size, input, output,
+    2 /* log2(sizeof(float)) */,
+    2 /* log2(sizeof(float)) */,
+    &tanh_op->params.f32_tanh, sizeof(tanh_op->params.f32_tanh),
+    pthreadpool_get_threads_count(threadpool));
+}
+
 enum xnn_status xnn_setup_truncation_nc_f32(
     xnn_operator_t truncation_op,
     size_t batch_size,
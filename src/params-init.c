@@ -147,6 +147,31 @@ void xnn_init_qu8_conv_minmax_fp32_avx512_params(
     params->fp32_avx512.output_min[i] = output_min;
   }
 }
+
+void xnn_init_qu8_conv_minmax_fp32_avx512vnni_params(
+  union xnn_qu8_conv_minmax_params params[XNN_MIN_ELEMENTS(1)],
+  uint8_t kernel_zero_point,
+  float scale,
+  uint8_t output_zero_point,
+  uint8_t output_min,
+  uint8_t output_max)
+{
+  assert(scale >= 0x1.0p-32f);
+  assert(scale < 256.0f);
+
+  const float output_max_less_zero_point = (float) ((int32_t) output_max - (int32_t) output_zero_point);
+  for (uint32_t i = 0; i < 16; i++) {
+    params->fp32_avx512vnni.offset_less_kernel_zero_point[i] = INT32_C(128) - (int32_t) kernel_zero_point;
+    params->fp32_avx512vnni.scale[i] = scale;
+    params->fp32_avx512vnni.output_max_less_zero_point[i] = output_max_less_zero_point;
+  }
+  for (uint32_t i = 0; i < 32; i++) {
+    params->fp32_avx512vnni.output_zero_point[i] = (int16_t) (uint16_t) output_zero_point;
+  }
+  for (uint32_t i = 0; i < 64; i++) {
+    params->fp32_avx512vnni.output_min[i] = output_min;
+  }
+}
 #endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
 
 #if XNN_ARCH_ARM || XNN_ARCH_ARM64
@@ -3110,6 +3135,270 @@ void xnn_init_f32_sqrt_avx512_params(
 }
 #endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
 
+void xnn_init_f32_gelu_scalar_rational_13_8_params(
+  union xnn_f32_gelu_params params[XNN_MIN_ELEMENTS(1)])
+{
+  params->scalar_rational_13_8.minus_cutoff = -0x1.7p+2f;
+  params->scalar_rational_13_8.cutoff = 0x1.7p+2f;
+  params->scalar_rational_13_8.alpha13 = -0x1.A7E662p-39f;
+  params->scalar_rational_13_8.alpha11 = 0x1.50951Ap-31f;
+  params->scalar_rational_13_8.alpha9 = -0x1.8ECCFAp-24f;
+  params->scalar_rational_13_8.alpha7 = -0x1.51A8BAp-18f;
+  params->scalar_rational_13_8.alpha5 = -0x1.107B38p-13f;
+  params->scalar_rational_13_8.alpha3 = -0x1.11D682p-10f;
+  params->scalar_rational_13_8.alpha1 = -0x1.74F3E6p-7f;
+  params->scalar_rational_13_8.beta8 = -0x1.E8C19Ap-21f;
+  params->scalar_rational_13_8.beta6 = -0x1.BF7A52p-16f;
+  params->scalar_rational_13_8.beta4 = -0x1.B9249Cp-12f;
+  params->scalar_rational_13_8.beta2 = -0x1.E337F0p-9f;
+  params->scalar_rational_13_8.beta0 = -0x1.D36D4Ep-7f;
+  params->scalar_rational_13_8.minus_one = -1.0f;
+  params->scalar_rational_13_8.one = 1.0f;
+  params->scalar_rational_13_8.half = 0.5f;
+}
+
+#if XNN_ARCH_ARM || XNN_ARCH_ARM64
+void xnn_init_f32_gelu_neon_rational_13_8_params(
+  union xnn_f32_gelu_params params[XNN_MIN_ELEMENTS(1)])
+{
+  params->neon_rational_13_8.minus_cutoff = -0x1.7p+2f;
+  params->neon_rational_13_8.cutoff = 0x1.7p+2f;
+  params->neon_rational_13_8.alpha13 = -0x1.A7E662p-39f;
+  params->neon_rational_13_8.alpha11 = 0x1.50951Ap-31f;
+  params->neon_rational_13_8.alpha9 = -0x1.8ECCFAp-24f;
+  params->neon_rational_13_8.alpha7 = -0x1.51A8BAp-18f;
+  params->neon_rational_13_8.alpha5 = -0x1.107B38p-13f;
+  params->neon_rational_13_8.alpha3 = -0x1.11D682p-10f;
+  params->neon_rational_13_8.alpha1 = -0x1.74F3E6p-7f;
+  params->neon_rational_13_8.beta8 = -0x1.E8C19Ap-21f;
+  params->neon_rational_13_8.beta6 = -0x1.BF7A52p-16f;
+  params->neon_rational_13_8.beta4 = -0x1.B9249Cp-12f;
+  params->neon_rational_13_8.beta2 = -0x1.E337F0p-9f;
+  params->neon_rational_13_8.beta0 = -0x1.D36D4Ep-7f;
+  params->neon_rational_13_8.minus_one = -1.0f;
+  params->neon_rational_13_8.one = 1.0f;
+  params->neon_rational_13_8.half = 0.5f;
+}
+#endif  // XNN_ARCH_ARM || XNN_ARCH_ARM64
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+void xnn_init_f32_gelu_sse_rational_13_8_params(
+  union xnn_f32_gelu_params params[XNN_MIN_ELEMENTS(1)])
+{
+  for (uint32_t i = 0; i < 4; i++) {
+    params->sse_rational_13_8.minus_cutoff[i] = -0x1.7p+2f;
+    params->sse_rational_13_8.cutoff[i] = 0x1.7p+2f;
+    params->sse_rational_13_8.alpha13[i] = -0x1.A7E662p-39f;
+    params->sse_rational_13_8.alpha11[i] = 0x1.50951Ap-31f;
+    params->sse_rational_13_8.alpha9[i] = -0x1.8ECCFAp-24f;
+    params->sse_rational_13_8.alpha7[i] = -0x1.51A8BAp-18f;
+    params->sse_rational_13_8.alpha5[i] = -0x1.107B38p-13f;
+    params->sse_rational_13_8.alpha3[i] = -0x1.11D682p-10f;
+    params->sse_rational_13_8.alpha1[i] = -0x1.74F3E6p-7f;
+    params->sse_rational_13_8.beta8[i] = -0x1.E8C19Ap-21f;
+    params->sse_rational_13_8.beta6[i] = -0x1.BF7A52p-16f;
+    params->sse_rational_13_8.beta4[i] = -0x1.B9249Cp-12f;
+    params->sse_rational_13_8.beta2[i] = -0x1.E337F0p-9f;
+    params->sse_rational_13_8.beta0[i] = -0x1.D36D4Ep-7f;
+    params->sse_rational_13_8.minus_one[i] = -1.0f;
+    params->sse_rational_13_8.one[i] = 1.0f;
+    params->sse_rational_13_8.half[i] = 0.5f;
+  }
+}
+
+void xnn_init_f32_gelu_avx_rational_13_8_params(
+  union xnn_f32_gelu_params params[XNN_MIN_ELEMENTS(1)])
+{
+  for (uint32_t i = 0; i < 8; i++) {
+    params->avx_rational_13_8.minus_cutoff[i] = -0x1.7p+2f;
+    params->avx_rational_13_8.cutoff[i] = 0x1.7p+2f;
+    params->avx_rational_13_8.alpha13[i] = -0x1.A7E662p-39f;
+    params->avx_rational_13_8.alpha11[i] = 0x1.50951Ap-31f;
+    params->avx_rational_13_8.alpha9[i] = -0x1.8ECCFAp-24f;
+    params->avx_rational_13_8.alpha7[i] = -0x1.51A8BAp-18f;
+    params->avx_rational_13_8.alpha5[i] = -0x1.107B38p-13f;
+    params->avx_rational_13_8.alpha3[i] = -0x1.11D682p-10f;
+    params->avx_rational_13_8.alpha1[i] = -0x1.74F3E6p-7f;
+    params->avx_rational_13_8.beta8[i] = -0x1.E8C19Ap-21f;
+    params->avx_rational_13_8.beta6[i] = -0x1.BF7A52p-16f;
+    params->avx_rational_13_8.beta4[i] = -0x1.B9249Cp-12f;
+    params->avx_rational_13_8.beta2[i] = -0x1.E337F0p-9f;
+    params->avx_rational_13_8.beta0[i] = -0x1.D36D4Ep-7f;
+    params->avx_rational_13_8.minus_one[i] = -1.0f;
+    params->avx_rational_13_8.one[i] = 1.0f;
+    params->avx_rational_13_8.half[i] = 0.5f;
+  }
+  for (uint32_t i = 0; i < 7; i++) {
+    params->avx_rational_13_8.mask_table[i] = -1;
+  }
+  for (uint32_t i = 7; i < 14; i++) {
+    params->avx_rational_13_8.mask_table[i] = 0;
+  }
+}
+
+void xnn_init_f32_gelu_avx512_rational_13_8_params(
+  union xnn_f32_gelu_params params[XNN_MIN_ELEMENTS(1)])
+{
+  params->avx512_rational_13_8.minus_cutoff = -0x1.7p+2f;
+  params->avx512_rational_13_8.cutoff = 0x1.7p+2f;
+  params->avx512_rational_13_8.alpha13 = -0x1.A7E662p-39f;
+  params->avx512_rational_13_8.alpha11 = 0x1.50951Ap-31f;
+  params->avx512_rational_13_8.alpha9 = -0x1.8ECCFAp-24f;
+  params->avx512_rational_13_8.alpha7 = -0x1.51A8BAp-18f;
+  params->avx512_rational_13_8.alpha5 = -0x1.107B38p-13f;
+  params->avx512_rational_13_8.alpha3 = -0x1.11D682p-10f;
+  params->avx512_rational_13_8.alpha1 = -0x1.74F3E6p-7f;
+  params->avx512_rational_13_8.beta8 = -0x1.E8C19Ap-21f;
+  params->avx512_rational_13_8.beta6 = -0x1.BF7A52p-16f;
+  params->avx512_rational_13_8.beta4 = -0x1.B9249Cp-12f;
+  params->avx512_rational_13_8.beta2 = -0x1.E337F0p-9f;
+  params->avx512_rational_13_8.beta0 = -0x1.D36D4Ep-7f;
+  params->avx512_rational_13_8.minus_one = -1.0f;
+  params->avx512_rational_13_8.one = 1.0f;
+  params->avx512_rational_13_8.half = 0.5f;
+}
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+void xnn_init_f32_tanh_scalar_expm1minus_rr2_p6_params(
+  union xnn_f32_tanh_params params[XNN_MIN_ELEMENTS(1)])
+{
+  params->scalar_expm1minus_rr2_p6.sat_cutoff = -0x1.154246p+4f;
+  params->scalar_expm1minus_rr2_p6.log2e = 0x1.715476p+0f;
+  params->scalar_expm1minus_rr2_p6.magic_bias = 0x1.8000FEp23f;
+  params->scalar_expm1minus_rr2_p6.minus_ln2_hi = -0x1.62E440p-1f;
+  params->scalar_expm1minus_rr2_p6.minus_ln2_lo = 0x1.0105C6p-21f;
+  params->scalar_expm1minus_rr2_p6.c6 = 0x1.6B7338p-10f;
+  params->scalar_expm1minus_rr2_p6.c5 = 0x1.12278Ep-7f;
+  params->scalar_expm1minus_rr2_p6.c4 = 0x1.555716p-5f;
+  params->scalar_expm1minus_rr2_p6.c3 = 0x1.5554B0p-3f;
+  params->scalar_expm1minus_rr2_p6.c2 = 0x1.FFFFFEp-2f;
+  params->scalar_expm1minus_rr2_p6.one = 1.0f;
+  params->scalar_expm1minus_rr2_p6.minus_two = -2.0f;
+}
+
+#if XNN_ARCH_ARM || XNN_ARCH_ARM64
+void xnn_init_f32_tanh_neon_expm1minus_rr2_p6_params(
+  union xnn_f32_tanh_params params[XNN_MIN_ELEMENTS(1)])
+{
+  params->neon_expm1minus_rr2_p6.sat_cutoff = -0x1.154246p+4f;
+  params->neon_expm1minus_rr2_p6.log2e = 0x1.715476p+0f;
+  params->neon_expm1minus_rr2_p6.magic_bias = 0x1.8000FEp23f;
+  params->neon_expm1minus_rr2_p6.minus_ln2_hi = -0x1.62E440p-1f;
+  params->neon_expm1minus_rr2_p6.minus_ln2_lo = 0x1.0105C6p-21f;
+  params->neon_expm1minus_rr2_p6.c6 = 0x1.6B7338p-10f;
+  params->neon_expm1minus_rr2_p6.c5 = 0x1.12278Ep-7f;
+  params->neon_expm1minus_rr2_p6.c4 = 0x1.555716p-5f;
+  params->neon_expm1minus_rr2_p6.c3 = 0x1.5554B0p-3f;
+  params->neon_expm1minus_rr2_p6.c2 = 0x1.FFFFFEp-2f;
+  params->neon_expm1minus_rr2_p6.minus_two = -2.0f;
+}
+
+void xnn_init_f32_tanh_neonfma_expm1minus_rr1_p6_params(
+  union xnn_f32_tanh_params params[XNN_MIN_ELEMENTS(1)])
+{
+  params->neonfma_expm1minus_rr1_p6.sat_cutoff = -0x1.154246p+4f;
+  params->neonfma_expm1minus_rr1_p6.log2e = 0x1.715476p+0f;
+  params->neonfma_expm1minus_rr1_p6.magic_bias = 0x1.8000FEp23f;
+  params->neonfma_expm1minus_rr1_p6.minus_ln2 = -0x1.62E430p-1f;
+  params->neonfma_expm1minus_rr1_p6.c6 = 0x1.6B7338p-10f;
+  params->neonfma_expm1minus_rr1_p6.c5 = 0x1.12278Ep-7f;
+  params->neonfma_expm1minus_rr1_p6.c4 = 0x1.555716p-5f;
+  params->neonfma_expm1minus_rr1_p6.c3 = 0x1.5554B0p-3f;
+  params->neonfma_expm1minus_rr1_p6.c2 = 0x1.FFFFFEp-2f;
+  params->neonfma_expm1minus_rr1_p6.minus_two = -2.0f;
+}
+#endif  // XNN_ARCH_ARM || XNN_ARCH_ARM64
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+void xnn_init_f32_tanh_sse_expm1minus_rr2_p6_params(
+  union xnn_f32_tanh_params params[XNN_MIN_ELEMENTS(1)])
+{
+  for (uint32_t i = 0; i < 4; i++) {
+    params->sse_expm1minus_rr2_p6.sign_mask[i] = -0.0f;
+    params->sse_expm1minus_rr2_p6.sat_cutoff[i] = -0x1.154246p+4f;
+    params->sse_expm1minus_rr2_p6.log2e[i] = 0x1.715476p+0f;
+    params->sse_expm1minus_rr2_p6.magic_bias[i] = 0x1.8000FEp23f;
+    params->sse_expm1minus_rr2_p6.minus_ln2_hi[i] = -0x1.62E440p-1f;
+    params->sse_expm1minus_rr2_p6.minus_ln2_lo[i] = 0x1.0105C6p-21f;
+    params->sse_expm1minus_rr2_p6.c6[i] = 0x1.6B7338p-10f;
+    params->sse_expm1minus_rr2_p6.c5[i] = 0x1.12278Ep-7f;
+    params->sse_expm1minus_rr2_p6.c4[i] = 0x1.555716p-5f;
+    params->sse_expm1minus_rr2_p6.c3[i] = 0x1.5554B0p-3f;
+    params->sse_expm1minus_rr2_p6.c2[i] = 0x1.FFFFFEp-2f;
+    params->sse_expm1minus_rr2_p6.one[i] = 1.0f;
+    params->sse_expm1minus_rr2_p6.minus_two[i] = -2.0f;
+  }
+}
+
+void xnn_init_f32_tanh_avx_expm1minus_rr2_p6_params(
+  union xnn_f32_tanh_params params[XNN_MIN_ELEMENTS(1)])
+{
+  for (uint32_t i = 0; i < 8; i++) {
+    params->avx_expm1minus_rr2_p6.sign_mask[i] = -0.0f;
+    params->avx_expm1minus_rr2_p6.sat_cutoff[i] = -0x1.154246p+4f;
+    params->avx_expm1minus_rr2_p6.log2e[i] = 0x1.715476p+0f;
+    params->avx_expm1minus_rr2_p6.magic_bias[i] = 0x1.8000FEp23f;
+    params->avx_expm1minus_rr2_p6.minus_ln2_hi[i] = -0x1.62E440p-1f;
+    params->avx_expm1minus_rr2_p6.minus_ln2_lo[i] = 0x1.0105C6p-21f;
+    params->avx_expm1minus_rr2_p6.c6[i] = 0x1.6B7338p-10f;
+    params->avx_expm1minus_rr2_p6.c5[i] = 0x1.12278Ep-7f;
+    params->avx_expm1minus_rr2_p6.c4[i] = 0x1.555716p-5f;
+    params->avx_expm1minus_rr2_p6.c3[i] = 0x1.5554B0p-3f;
+    params->avx_expm1minus_rr2_p6.c2[i] = 0x1.FFFFFEp-2f;
+    params->avx_expm1minus_rr2_p6.one[i] = 1.0f;
+    params->avx_expm1minus_rr2_p6.minus_two[i] = -2.0f;
+  }
+  for (uint32_t i = 0; i < 7; i++) {
+    params->avx_expm1minus_rr2_p6.mask_table[i] = -1;
+  }
+  for (uint32_t i = 7; i < 14; i++) {
+    params->avx_expm1minus_rr2_p6.mask_table[i] = 0;
+  }
+}
+
+void xnn_init_f32_tanh_avx2_expm1minus_rr1_p6_params(
+  union xnn_f32_tanh_params params[XNN_MIN_ELEMENTS(1)])
+{
+  for (uint32_t i = 0; i < 8; i++) {
+    params->avx2_expm1minus_rr1_p6.sign_mask[i] = -0.0f;
+    params->avx2_expm1minus_rr1_p6.sat_cutoff[i] = -0x1.154246p+4f;
+    params->avx2_expm1minus_rr1_p6.log2e[i] = 0x1.715476p+0f;
+    params->avx2_expm1minus_rr1_p6.magic_bias[i] = 0x1.8000FEp23f;
+    params->avx2_expm1minus_rr1_p6.minus_ln2[i] = -0x1.62E430p-1f;
+    params->avx2_expm1minus_rr1_p6.c6[i] = 0x1.6B7338p-10f;
+    params->avx2_expm1minus_rr1_p6.c5[i] = 0x1.12278Ep-7f;
+    params->avx2_expm1minus_rr1_p6.c4[i] = 0x1.555716p-5f;
+    params->avx2_expm1minus_rr1_p6.c3[i] = 0x1.5554B0p-3f;
+    params->avx2_expm1minus_rr1_p6.c2[i] = 0x1.FFFFFEp-2f;
+    params->avx2_expm1minus_rr1_p6.one[i] = 1.0f;
+    params->avx2_expm1minus_rr1_p6.minus_two[i] = -2.0f;
+  }
+  for (uint32_t i = 0; i < 7; i++) {
+    params->avx2_expm1minus_rr1_p6.mask_table[i] = -1;
+  }
+  for (uint32_t i = 7; i < 14; i++) {
+    params->avx2_expm1minus_rr1_p6.mask_table[i] = 0;
+  }
+}
+
+void xnn_init_f32_tanh_avx512_expm1minus_rr1_p6_params(
+  union xnn_f32_tanh_params params[XNN_MIN_ELEMENTS(1)])
+{
+  params->avx512_expm1minus_rr1_p6.sign_mask = UINT32_C(0x80000000);
+  params->avx512_expm1minus_rr1_p6.sat_cutoff = -0x1.154246p+4f;
+  params->avx512_expm1minus_rr1_p6.log2e = 0x1.715476p+0f;
+  params->avx512_expm1minus_rr1_p6.magic_bias = 0x1.8000FEp23f;
+  params->avx512_expm1minus_rr1_p6.minus_ln2 = -0x1.62E430p-1f;
+  params->avx512_expm1minus_rr1_p6.c6 = 0x1.6B7338p-10f;
+  params->avx512_expm1minus_rr1_p6.c5 = 0x1.12278Ep-7f;
+  params->avx512_expm1minus_rr1_p6.c4 = 0x1.555716p-5f;
+  params->avx512_expm1minus_rr1_p6.c3 = 0x1.5554B0p-3f;
+  params->avx512_expm1minus_rr1_p6.c2 = 0x1.FFFFFEp-2f;
+  params->avx512_expm1minus_rr1_p6.one = 1.0f;
+  params->avx512_expm1minus_rr1_p6.minus_two = -2.0f;
+}
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
 void xnn_init_f32_chw_params(
   union xnn_f32_chw_params params[XNN_MIN_ELEMENTS(1)],
   uint32_t width,
@@ -3137,6 +3426,16 @@ void xnn_init_f32_chw_params(
     params->sse.mask_odd[1] = -(uint32_t) (w8 >= 3);
     params->sse.mask_odd[2] = -(uint32_t) (w8 >= 5);
     params->sse.mask_odd[3] = -(uint32_t) (w8 >= 7);
+
+    for (uint32_t i = 0; i < 8; i++) {
+      params->sse.mask8[i] = -(uint32_t) (w8 >= i);
+    }
+
+    const uint32_t w16 = (width - 1) & 15;
+    for (uint32_t i = 0; i < 8; i++) {
+      params->sse.mask_even8[i] = -(uint32_t) (w16 >= 2 * i);
+      params->sse.mask_odd8[i] = -(uint32_t) (w16 >= 2 * i + 1);
+    }
   #elif XNN_ARCH_ARM || XNN_ARCH_ARM64
     params->neon.min = output_min;
     params->neon.max = output_max;
@@ -3198,6 +3497,16 @@ void xnn_update_f32_chw_params(
     params->sse.mask_odd[1] = -(uint32_t) (w8 >= 3);
     params->sse.mask_odd[2] = -(uint32_t) (w8 >= 5);
     params->sse.mask_odd[3] = -(uint32_t) (w8 >= 7);
+
+    for (uint32_t i = 0; i < 8; i++) {
+      params->sse.mask8[i] = -(uint32_t) (w8 >= i);
+    }
+
+    const uint32_t w16 = (width - 1) & 15;
+    for (uint32_t i = 0; i < 8; i++) {
+      params->sse.mask_even8[i] = -(uint32_t) (w16 >= 2 * i);
+      params->sse.mask_odd8[i] = -(uint32_t) (w16 >= 2 * i + 1);
+    }
   #elif XNN_ARCH_ARM || XNN_ARCH_ARM64
     const uint32_t w4 = (width - 1) & 3;
     params->neon.mask[0] = UINT32_C(0xFFFFFFFF);
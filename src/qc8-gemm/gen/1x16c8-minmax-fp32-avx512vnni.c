@@ -0,0 +1,120 @@
+// Auto-generated file. Do not edit!
+//   Template: src/qs8-gemm/MRx16c8-avx512vnni.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <immintrin.h>
+
+#include <xnnpack/gemm.h>
+#include <xnnpack/intrinsics-polyfill.h>
+#include <xnnpack/math.h>
+
+
+void xnn_qc8_gemm_minmax_fp32_ukernel_1x16c8__avx512vnni(
+    size_t mr,
+    size_t nc,
+    size_t kc,
+    const int8_t* restrict a,
+    size_t a_stride,
+    const void* restrict w,
+    int8_t* restrict c,
+    size_t cm_stride,
+    size_t cn_stride,
+    const union xnn_qs8_minmax_params params[restrict XNN_MIN_ELEMENTS(1)]) XNN_OOB_READS
+{
+  assert(mr != 0);
+  assert(mr <= 1);
+  assert(nc != 0);
+  assert(kc != 0);
+  assert(kc % sizeof(int8_t) == 0);
+  assert(a != NULL);
+  assert(w != NULL);
+  assert(c != NULL);
+
+  kc = round_up_po2(kc, 8);
+  const int8_t* a0 = a;
+  int8_t* c0 = c;
+
+  // Even and odd 32-bit lanes accumulate the low and high halves of each column's 8-element K block.
+  const __mmask16 vbias_mask = _cvtu32_mask16(0x5555);
+  // VPDPBUSD multiplies unsigned 8-bit elements by signed 8-bit elements.
+  // Inputs are flipped to unsigned as (x ^ 0x80) = (x + 128), and 128 times the sum of
+  // weights is subtracted after the K loop.
+  const __m512i vsign_mask = _mm512_set1_epi8(INT8_C(-128));
+  const __m512 voutput_max_less_zero_point = _mm512_load_ps(params->avx512.output_max_less_zero_point);
+  const __m512i voutput_zero_point = _mm512_load_si512(params->avx512.output_zero_point);
+  const __m512i voutput_min = _mm512_load_si512(params->avx512.output_min);
+  do {
+    __m512i vacc0x01234567 = _mm512_maskz_expandloadu_epi32(vbias_mask, w);
+    __m512i vacc0x89ABCDEF = _mm512_maskz_expandloadu_epi32(vbias_mask, (const void*) ((const int32_t*) w + 8));
+    __m512i vbsum01234567 = _mm512_setzero_si512();
+    __m512i vbsum89ABCDEF = _mm512_setzero_si512();
+    w = (const void*) ((const int32_t*) w + 16);
+
+    size_t k = 0;
+    while (k < kc) {
+      const __m512i va0x01234567 = _mm512_xor_si512(_mm512_broadcastq_epi64(_mm_loadl_epi64((const __m128i*) a0)), vsign_mask);
+      a0 += 8;
+
+      const __m512i vb01234567 = _mm512_loadu_si512(w);
+      const __m512i vb89ABCDEF = _mm512_loadu_si512((const void*) ((const int8_t*) w + 64));
+
+      vacc0x01234567 = _mm512_dpbusd_epi32(vacc0x01234567, va0x01234567, vb01234567);
+      vacc0x89ABCDEF = _mm512_dpbusd_epi32(vacc0x89ABCDEF, va0x01234567, vb89ABCDEF);
+      vbsum01234567 = _mm512_dpbusd_epi32(vbsum01234567, vsign_mask, vb01234567);
+      vbsum89ABCDEF = _mm512_dpbusd_epi32(vbsum89ABCDEF, vsign_mask, vb89ABCDEF);
+
+      w = (const void*) ((const int8_t*) w + 128);
+      k += 8 * sizeof(int8_t);
+    }
+
+    vacc0x01234567 = _mm512_sub_epi32(vacc0x01234567, vbsum01234567);
+    vacc0x89ABCDEF = _mm512_sub_epi32(vacc0x89ABCDEF, vbsum89ABCDEF);
+
+    const __m512i vpermute_even = _mm512_set_epi32(30, 28, 26, 24, 22, 20, 18, 16, 14, 12, 10, 8, 6, 4, 2, 0);
+    const __m512i vpermute_odd = _mm512_set_epi32(31, 29, 27, 25, 23, 21, 19, 17, 15, 13, 11, 9, 7, 5, 3, 1);
+    __m512i vacc0x0123456789ABCDEF = _mm512_add_epi32(
+      _mm512_permutex2var_epi32(vacc0x01234567, vpermute_even, vacc0x89ABCDEF),
+      _mm512_permutex2var_epi32(vacc0x01234567, vpermute_odd, vacc0x89ABCDEF));
+
+    __m512 vscaled0x0123456789ABCDEF = _mm512_cvtepi32_ps(vacc0x0123456789ABCDEF);
+
+    const __m512 vscale0123456789ABCDEF = _mm512_loadu_ps(w);
+    w = (const void*) ((const float*) w + 16);
+    vscaled0x0123456789ABCDEF = _mm512_mul_ps(vscaled0x0123456789ABCDEF, vscale0123456789ABCDEF);
+
+    vscaled0x0123456789ABCDEF = _mm512_min_ps(vscaled0x0123456789ABCDEF, voutput_max_less_zero_point);
+
+    vacc0x0123456789ABCDEF = _mm512_cvtps_epi32(vscaled0x0123456789ABCDEF);
+
+    const __m512i vacc00x0123456789ABCDEF = _mm512_adds_epi16(_mm512_packs_epi32(vacc0x0123456789ABCDEF, vacc0x0123456789ABCDEF), voutput_zero_point);
+
+    __m512i vout = _mm512_packs_epi16(vacc00x0123456789ABCDEF, vacc00x0123456789ABCDEF);
+    // Gather the 4-column groups of each row into a contiguous 16-byte row.
+    vout = _mm512_permutexvar_epi32(_mm512_set_epi32(15, 11, 7, 3, 14, 10, 6, 2, 13, 9, 5, 1, 12, 8, 4, 0), vout);
+    vout = _mm512_max_epi8(vout, voutput_min);
+
+    if (nc >= 16) {
+      _mm_storeu_si128((__m128i*) c0, _mm512_castsi512_si128(vout));
+
+      a0 = (const int8_t*) ((uintptr_t) a0 - kc);
+
+      c0 = (int8_t*) ((uintptr_t) c0 + cn_stride);
+
+      nc -= 16;
+    } else {
+      // Prepare mask for valid 8-bit elements (depends on nc).
+      const __mmask16 vmask = _cvtu32_mask16((UINT32_C(1) << nc) - UINT32_C(1));
+
+      _mm_mask_storeu_epi8(c0, vmask, _mm512_castsi512_si128(vout));
+
+      nc = 0;
+    }
+  } while (nc != 0);
+}
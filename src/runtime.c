@@ -3,14 +3,29 @@
 // This source code is licensed under the BSD-style license found in the
 // LICENSE file in the root directory of this source tree.
 
+#if !defined(_WIN32) && !defined(__MACH__)
+  // For clock_gettime.
+  #define _POSIX_C_SOURCE 199309L
+#endif
+
 #include <math.h>
 #include <stddef.h>
 #include <stdint.h>
 #include <stdlib.h>
 #include <stdio.h>
+#include <string.h>
+
+#if defined(_WIN32)
+  #include <windows.h>
+#elif defined(__MACH__)
+  #include <mach/mach_time.h>
+#else
+  #include <time.h>
+#endif
 
 #include <xnnpack.h>
 #include <xnnpack/allocator.h>
+#include <xnnpack/common.h>
 #include <xnnpack/log.h>
 #include <xnnpack/math.h>
 #include <xnnpack/memory-planner.h>
@@ -19,6 +34,228 @@
 #include <xnnpack/subgraph.h>
 
 
+// Returns a monotonic timestamp in nanoseconds.
+static uint64_t read_timer(void)
+{
+  #if defined(_WIN32)
+    LARGE_INTEGER counter, frequency;
+    QueryPerformanceCounter(&counter);
+    QueryPerformanceFrequency(&frequency);
+    return (uint64_t) ((double) counter.QuadPart * 1.0e+9 / (double) frequency.QuadPart);
+  #elif defined(__MACH__)
+    static mach_timebase_info_data_t timebase_info;
+    if (timebase_info.denom == 0) {
+      mach_timebase_info(&timebase_info);
+    }
+    return mach_absolute_time() * (uint64_t) timebase_info.numer / (uint64_t) timebase_info.denom;
+  #else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t) ts.tv_sec * UINT64_C(1000000000) + (uint64_t) ts.tv_nsec;
+  #endif
+}
+
+// Independent operators run concurrently only if each of them reads and writes at most this many bytes: larger
+// operators have enough parallel work to occupy all threads, and run faster with intra-operator parallelism.
+#define XNN_INTER_OP_PARALLELISM_MAX_BYTES 131072
+
+static size_t get_node_num_bytes(
+  xnn_subgraph_t subgraph,
+  const struct xnn_node* node)
+{
+  size_t num_bytes = 0;
+  for (uint32_t i = 0; i < node->num_inputs; i++) {
+    num_bytes += xnn_tensor_get_size(subgraph, node->inputs[i]);
+  }
+  for (uint32_t i = 0; i < node->num_outputs; i++) {
+    // Skip outputs without consumers, which were cleared during Subgraph optimization.
+    if (subgraph->values[node->outputs[i]].type != xnn_value_type_invalid) {
+      num_bytes += xnn_tensor_get_size(subgraph, node->outputs[i]);
+    }
+  }
+  return num_bytes;
+}
+
+// Groups Nodes into levels, where Nodes in a level depend only on outputs of Nodes in the preceding levels, and
+// creates the execution plan for the runtime:
+// - execution_order[i] is the index of the Node executed as the i-th operator.
+// - node_steps[n] is the step at which Node n executes. Nodes in a concurrent level share a step.
+static enum xnn_status plan_operator_levels(
+  xnn_subgraph_t subgraph,
+  size_t num_threads,
+  struct xnn_runtime* runtime,
+  uint32_t* execution_order,
+  uint32_t* node_steps)
+{
+  // Use node_steps as a scratch buffer for Node levels. Nodes are sorted topologically, so producers of inputs
+  // are always processed before their consumers.
+  uint32_t* node_levels = node_steps;
+  uint32_t num_levels = 0;
+  for (uint32_t n = 0; n < subgraph->num_nodes; n++) {
+    const struct xnn_node* node = subgraph->nodes + n;
+    uint32_t level = 0;
+    for (uint32_t i = 0; i < node->num_inputs; i++) {
+      const uint32_t producer = subgraph->values[node->inputs[i]].producer;
+      if (producer != XNN_INVALID_NODE_ID && producer < n) {
+        level = math_max_u32(level, node_levels[producer] + 1);
+      }
+    }
+    node_levels[n] = level;
+    num_levels = math_max_u32(num_levels, level + 1);
+  }
+
+  runtime->levels = xnn_allocate_zero_memory(sizeof(struct xnn_operator_level) * num_levels);
+  if (runtime->levels == NULL) {
+    xnn_log_error("failed to allocate %zu bytes for operator levels",
+      sizeof(struct xnn_operator_level) * num_levels);
+    return xnn_status_out_of_memory;
+  }
+  runtime->num_levels = num_levels;
+
+  // Stable counting sort of Nodes by level.
+  struct xnn_operator_level* levels = runtime->levels;
+  for (uint32_t n = 0; n < subgraph->num_nodes; n++) {
+    levels[node_levels[n]].num_ops += 1;
+  }
+  size_t first_op = 0;
+  for (uint32_t l = 0; l < num_levels; l++) {
+    levels[l].first_op = first_op;
+    first_op += levels[l].num_ops;
+    levels[l].num_ops = 0;
+  }
+  for (uint32_t n = 0; n < subgraph->num_nodes; n++) {
+    struct xnn_operator_level* level = &levels[node_levels[n]];
+    execution_order[level->first_op + level->num_ops++] = n;
+  }
+
+  uint32_t step = 0;
+  for (uint32_t l = 0; l < num_levels; l++) {
+    struct xnn_operator_level* level = &levels[l];
+    size_t num_valid_ops = 0;
+    bool small_ops = true;
+    for (size_t i = level->first_op; i < level->first_op + level->num_ops; i++) {
+      const struct xnn_node* node = subgraph->nodes + execution_order[i];
+      if (node->type != xnn_node_type_invalid) {
+        num_valid_ops += 1;
+        small_ops &= get_node_num_bytes(subgraph, node) <= XNN_INTER_OP_PARALLELISM_MAX_BYTES;
+      }
+    }
+    level->concurrent = num_valid_ops >= 2 && (small_ops || num_valid_ops >= num_threads);
+
+    for (size_t i = level->first_op; i < level->first_op + level->num_ops; i++) {
+      node_steps[execution_order[i]] = level->concurrent ? step : step++;
+    }
+    if (level->concurrent) {
+      step++;
+    }
+  }
+  return xnn_status_success;
+}
+
+// Returns the index of the Node executed as the i-th operator of the runtime.
+static size_t get_operator_node_index(
+  const struct xnn_runtime* runtime,
+  size_t i)
+{
+  return runtime->execution_order != NULL ? runtime->execution_order[i] : i;
+}
+
+// Moves pointers to internal Values of the runtime from the old workspace allocation to the new one.
+static void relocate_workspace_blobs(
+  xnn_runtime_t runtime,
+  void* old_data,
+  size_t old_size,
+  void* new_data)
+{
+  for (size_t i = 0; i < runtime->num_blobs; i++) {
+    struct xnn_blob* blob = &runtime->blobs[i];
+    if (blob->data != NULL && !blob->external &&
+        (uintptr_t) blob->data >= (uintptr_t) old_data && (uintptr_t) blob->data < (uintptr_t) old_data + old_size)
+    {
+      blob->data = (void*) ((uintptr_t) new_data + ((uintptr_t) blob->data - (uintptr_t) old_data));
+    }
+  }
+  runtime->setup_pending = true;
+}
+
+// Computes sizes of Values, plans the workspace for internal Values, and grows the workspace if it is too small.
+// Pointers to external Values are preserved.
+static enum xnn_status plan_workspace(
+  xnn_runtime_t runtime)
+{
+  // The memory planner only reads Nodes and Values, and works on the runtime copies of them.
+  struct xnn_subgraph subgraph = {
+    .num_values = runtime->num_blobs,
+    .values = runtime->values,
+    .num_nodes = runtime->num_nodes,
+    .nodes = runtime->nodes,
+  };
+
+  struct xnn_value_allocation_tracker mem_alloc_tracker;
+  xnn_init_scheduled_value_allocation_tracker(&mem_alloc_tracker, &subgraph, runtime->node_steps);
+  if (runtime->greedy_by_size_memory_planning) {
+    mem_alloc_tracker.strategy = xnn_memory_planning_strategy_greedy_by_size;
+  }
+
+  for (uint32_t i = 0; i < subgraph.num_values; i++) {
+    const struct xnn_value* value = &subgraph.values[i];
+    struct xnn_blob* blob = &runtime->blobs[i];
+    if (value->datatype != xnn_datatype_invalid && value->type == xnn_value_type_dense_tensor) {
+      blob->size = xnn_tensor_get_size(&subgraph, i);
+      if (value->data != NULL) {
+        blob->data = (void*) (uintptr_t) value->data;
+      } else if ((value->flags & (XNN_VALUE_FLAG_EXTERNAL_INPUT | XNN_VALUE_FLAG_EXTERNAL_OUTPUT)) == 0) {
+        // Value is purely internal to the runtime, and must be allocated in its workspace.
+        xnn_add_value_allocation_tracker(&mem_alloc_tracker, i, round_up_po2(blob->size, XNN_EXTRA_BYTES));
+      } else {
+        // Value is non-static and external to the runtime: must be specified via a call to xnn_setup_runtime.
+        blob->external = true;
+      }
+    }
+  }
+  xnn_plan_value_allocation_tracker(&mem_alloc_tracker);
+  runtime->workspace_size = mem_alloc_tracker.mem_arena_size;
+  runtime->workspace_lower_bound = mem_alloc_tracker.mem_arena_lower_bound;
+  xnn_log_debug("planned %zu bytes of runtime workspace, %zu bytes lower bound",
+    runtime->workspace_size, runtime->workspace_lower_bound);
+
+  if (mem_alloc_tracker.mem_arena_size != 0) {
+    // XNN_EXTRA_BYTES ensures that out-of-bound reads of intermediate values don't segfault.
+    const size_t mem_arena_size = mem_alloc_tracker.mem_arena_size + XNN_EXTRA_BYTES;
+    xnn_workspace_t workspace = runtime->workspace;
+    if (mem_arena_size > workspace->size) {
+      void* old_data = workspace->data;
+      void* new_data = xnn_allocate_simd_memory(mem_arena_size);
+      if (new_data == NULL) {
+        xnn_log_error("failed to allocate %zu bytes for runtime workspace", mem_arena_size);
+        xnn_release_value_allocation_tracker(&mem_alloc_tracker);
+        return xnn_status_out_of_memory;
+      }
+      // Other Runtime objects bound to the workspace keep the offsets of their Values in the new allocation.
+      for (struct xnn_runtime* user = workspace->first_user; user != NULL; user = user->next_workspace_user) {
+        if (user != runtime) {
+          relocate_workspace_blobs(user, old_data, workspace->size, new_data);
+        }
+      }
+      xnn_release_simd_memory(old_data);
+      workspace->data = new_data;
+      workspace->size = mem_arena_size;
+    }
+    for (size_t i = 0; i < subgraph.num_values; i++) {
+      const struct xnn_value* value = &subgraph.values[i];
+      struct xnn_blob* blob = &runtime->blobs[i];
+      if (value->datatype != xnn_datatype_invalid && value->type == xnn_value_type_dense_tensor) {
+        if (value->data == NULL && !blob->external) {
+          // Value is purely internal to the runtime, allocate it in the workspace.
+          blob->data = (void*) ((uintptr_t) workspace->data + mem_alloc_tracker.usage[i].alloc_offset);
+        }
+      }
+    }
+  }
+  xnn_release_value_allocation_tracker(&mem_alloc_tracker);
+  return xnn_status_success;
+}
+
 enum xnn_status xnn_create_runtime(
   xnn_subgraph_t subgraph,
   xnn_runtime_t* runtime_out)
@@ -31,6 +268,59 @@ enum xnn_status xnn_create_runtime_v2(
   pthreadpool_t threadpool,
   uint32_t flags,
   xnn_runtime_t* runtime_out)
+{
+  return xnn_create_runtime_v3(subgraph, NULL /* weights cache */, threadpool, flags, runtime_out);
+}
+
+enum xnn_status xnn_create_runtime_v3(
+  xnn_subgraph_t subgraph,
+  xnn_weights_cache_t weights_cache,
+  pthreadpool_t threadpool,
+  uint32_t flags,
+  xnn_runtime_t* runtime_out)
+{
+  return xnn_create_runtime_v4(subgraph, weights_cache, NULL /* workspace */, threadpool, flags, runtime_out);
+}
+
+enum xnn_status xnn_create_workspace(
+  xnn_workspace_t* workspace_out)
+{
+  if ((xnn_params.init_flags & XNN_INIT_FLAG_XNNPACK) == 0) {
+    xnn_log_error("failed to create workspace: XNNPACK is not initialized");
+    return xnn_status_uninitialized;
+  }
+
+  struct xnn_workspace* workspace = xnn_allocate_zero_memory(sizeof(struct xnn_workspace));
+  if (workspace == NULL) {
+    xnn_log_error("failed to allocate %zu bytes for workspace descriptor", sizeof(struct xnn_workspace));
+    return xnn_status_out_of_memory;
+  }
+  workspace->ref_count = 1;
+  *workspace_out = workspace;
+  return xnn_status_success;
+}
+
+enum xnn_status xnn_release_workspace(
+  xnn_workspace_t workspace)
+{
+  if (workspace != NULL) {
+    assert(workspace->ref_count != 0);
+    if (--workspace->ref_count == 0) {
+      assert(workspace->first_user == NULL);
+      xnn_release_simd_memory(workspace->data);
+      xnn_release_memory(workspace);
+    }
+  }
+  return xnn_status_success;
+}
+
+enum xnn_status xnn_create_runtime_v4(
+  xnn_subgraph_t subgraph,
+  xnn_weights_cache_t weights_cache,
+  xnn_workspace_t workspace,
+  pthreadpool_t threadpool,
+  uint32_t flags,
+  xnn_runtime_t* runtime_out)
 {
   struct xnn_runtime* runtime = NULL;
   enum xnn_status status = xnn_status_uninitialized;
@@ -58,10 +348,30 @@ enum xnn_status xnn_create_runtime_v2(
   }
   runtime->num_ops = subgraph->num_nodes;
 
+  const size_t num_threads = pthreadpool_get_threads_count(threadpool);
+  if ((flags & (XNN_FLAG_INTER_OP_PARALLELISM | XNN_FLAG_BASIC_PROFILING)) == XNN_FLAG_INTER_OP_PARALLELISM &&
+      num_threads > 1 && subgraph->num_nodes != 0)
+  {
+    uint32_t* execution_order = xnn_allocate_memory(sizeof(uint32_t) * subgraph->num_nodes);
+    uint32_t* node_steps = xnn_allocate_memory(sizeof(uint32_t) * subgraph->num_nodes);
+    if (execution_order == NULL || node_steps == NULL) {
+      xnn_log_error("failed to allocate %zu bytes for execution plan", 2 * sizeof(uint32_t) * subgraph->num_nodes);
+      xnn_release_memory(execution_order);
+      xnn_release_memory(node_steps);
+      goto error;
+    }
+    runtime->execution_order = execution_order;
+    runtime->node_steps = node_steps;
+    status = plan_operator_levels(subgraph, num_threads, runtime, execution_order, node_steps);
+    if (status != xnn_status_success) {
+      goto error;
+    }
+  }
+
   if (flags & XNN_FLAG_YIELD_WORKERS) {
     struct xnn_node* last_valid_node = NULL;
     for (size_t i = 0; i < subgraph->num_nodes; i++) {
-      struct xnn_node* node = subgraph->nodes + i;
+      struct xnn_node* node = subgraph->nodes + get_operator_node_index(runtime, i);
       if (node->type != xnn_node_type_invalid) {
         last_valid_node = node;
       }
@@ -71,21 +381,43 @@ enum xnn_status xnn_create_runtime_v2(
     }
   }
 
+  // Keep copies of Nodes and Values to propagate shapes and re-plan the workspace in xnn_reshape_runtime.
+  status = xnn_status_out_of_memory;
+  runtime->nodes = xnn_allocate_memory(sizeof(struct xnn_node) * subgraph->num_nodes);
+  runtime->values = xnn_allocate_memory(sizeof(struct xnn_value) * subgraph->num_values);
+  if ((runtime->nodes == NULL && subgraph->num_nodes != 0) || (runtime->values == NULL && subgraph->num_values != 0)) {
+    xnn_log_error("failed to allocate %zu bytes for subgraph copy",
+      sizeof(struct xnn_node) * subgraph->num_nodes + sizeof(struct xnn_value) * subgraph->num_values);
+    goto error;
+  }
+  memcpy(runtime->nodes, subgraph->nodes, sizeof(struct xnn_node) * subgraph->num_nodes);
+  memcpy(runtime->values, subgraph->values, sizeof(struct xnn_value) * subgraph->num_values);
+  runtime->num_nodes = subgraph->num_nodes;
+
   struct xnn_value* values = subgraph->values;
   for (size_t i = 0; i < subgraph->num_nodes; i++) {
-    const struct xnn_node* node = subgraph->nodes + i;
+    const struct xnn_node* node = subgraph->nodes + get_operator_node_index(runtime, i);
 
     // Ignore fused nodes
     if (node->type != xnn_node_type_invalid) {
       assert(node->create != NULL);
-      status = node->create(node, values, subgraph->num_values, runtime->opdata + i);
+      // Weights cache identifies static data by address, and data allocated by the Subgraph doesn't outlive it.
+      xnn_weights_cache_t node_weights_cache = weights_cache;
+      for (uint32_t j = 0; j < node->num_inputs; j++) {
+        if (values[node->inputs[j]].allocated_data) {
+          node_weights_cache = NULL;
+        }
+      }
+      status = node->create(node, values, subgraph->num_values, runtime->opdata + i, node_weights_cache);
       if (status != xnn_status_success) {
         goto error;
       }
       runtime->opdata[i].setup = node->setup;
+      runtime->opdata[i].num_bytes = get_node_num_bytes(subgraph, node);
     }
   }
 
+  status = xnn_status_out_of_memory;
   runtime->blobs = xnn_allocate_zero_memory(sizeof(struct xnn_blob) * subgraph->num_values);
   if (runtime->blobs == NULL) {
     xnn_log_error("failed to allocate %zu bytes for blob descriptors",
@@ -94,51 +426,26 @@ enum xnn_status xnn_create_runtime_v2(
   }
   runtime->num_blobs = subgraph->num_values;
 
-  struct xnn_value_allocation_tracker mem_alloc_tracker;
-  xnn_init_value_allocation_tracker(&mem_alloc_tracker, subgraph);
-
-  for (uint32_t i = 0; i < subgraph->num_values; i++) {
-    struct xnn_value* value = &subgraph->values[i];
-    struct xnn_blob* blob = &runtime->blobs[i];
-    if (value->datatype != xnn_datatype_invalid && value->type == xnn_value_type_dense_tensor) {
-      blob->size = xnn_tensor_get_size(subgraph, i);
-      blob->data = (void*) (uintptr_t) value->data;
-      if (blob->data == NULL) {
-        if ((value->flags & (XNN_VALUE_FLAG_EXTERNAL_INPUT | XNN_VALUE_FLAG_EXTERNAL_OUTPUT)) == 0) {
-          // Value is purely internal to the runtime, and must be allocated in its workspace.
-          xnn_add_value_allocation_tracker(&mem_alloc_tracker, i, round_up_po2(blob->size, XNN_EXTRA_BYTES));
-        } else {
-          // Value is non-static and external to the runtime: must be specified via a call to xnn_setup_runtime.
-          blob->external = true;
-        }
-      }
+  if (workspace == NULL) {
+    status = xnn_create_workspace(&workspace);
+    if (status != xnn_status_success) {
+      goto error;
     }
+  } else {
+    workspace->ref_count++;
   }
-  xnn_plan_value_allocation_tracker(&mem_alloc_tracker);
+  runtime->greedy_by_size_memory_planning = (flags & XNN_FLAG_GREEDY_BY_SIZE_MEMORY_PLANNING) != 0;
+  runtime->workspace = workspace;
+  runtime->next_workspace_user = workspace->first_user;
+  workspace->first_user = runtime;
 
-  if (mem_alloc_tracker.mem_arena_size != 0) {
-    // XNN_EXTRA_BYTES ensures that out-of-bound reads of intermediate values don't segfault.
-    const size_t mem_arena_size = mem_alloc_tracker.mem_arena_size + XNN_EXTRA_BYTES;
-    runtime->workspace = xnn_allocate_simd_memory(mem_arena_size);
-    if (runtime->workspace == NULL) {
-      xnn_log_error("failed to allocate %zu bytes for runtime workspace", mem_arena_size);
-      xnn_release_value_allocation_tracker(&mem_alloc_tracker);
-      goto error;
-    }
-    for (size_t i = 0; i < subgraph->num_values; i++) {
-      const struct xnn_value* value = &subgraph->values[i];
-      struct xnn_blob* blob = &runtime->blobs[i];
-      if (value->datatype != xnn_datatype_invalid && value->type == xnn_value_type_dense_tensor) {
-        if (value->data == NULL && !blob->external) {
-          // Value is purely internal to the runtime, allocate it in the workspace.
-          blob->data = (void*) ((uintptr_t) runtime->workspace + mem_alloc_tracker.usage[i].alloc_offset);
-        }
-      }
-    }
+  status = plan_workspace(runtime);
+  if (status != xnn_status_success) {
+    goto error;
   }
-  xnn_release_value_allocation_tracker(&mem_alloc_tracker);
 
   runtime->threadpool = threadpool;
+  runtime->profiling = (flags & XNN_FLAG_BASIC_PROFILING) != 0;
 
   *runtime_out = runtime;
   return xnn_status_success;
@@ -148,11 +455,125 @@ error:
   return status;
 }
 
+enum xnn_status xnn_reshape_external_value(
+  xnn_runtime_t runtime,
+  uint32_t external_id,
+  size_t num_dims,
+  const size_t* dims)
+{
+  if (external_id >= runtime->num_blobs) {
+    xnn_log_error("failed to reshape external value: out-of-bounds ID %" PRIu32, external_id);
+    return xnn_status_invalid_parameter;
+  }
+
+  struct xnn_value* value = &runtime->values[external_id];
+  if ((value->flags & XNN_VALUE_FLAG_EXTERNAL_INPUT) == 0) {
+    xnn_log_error("failed to reshape external value: Value %" PRIu32 " is not an external input", external_id);
+    return xnn_status_invalid_parameter;
+  }
+
+  if (num_dims != value->shape.num_dims) {
+    xnn_log_error(
+      "failed to reshape external value %" PRIu32 ": number of dimensions can't change from %zu to %zu",
+      external_id, value->shape.num_dims, num_dims);
+    return xnn_status_invalid_parameter;
+  }
+
+  for (size_t i = 0; i < num_dims; i++) {
+    value->shape.dim[i] = dims[i];
+  }
+  runtime->reshape_pending = true;
+  return xnn_status_success;
+}
+
+enum xnn_status xnn_reshape_runtime(
+  xnn_runtime_t runtime)
+{
+  runtime->reshape_pending = true;
+  for (size_t i = 0; i < runtime->num_ops; i++) {
+    struct xnn_operator_data* opdata = &runtime->opdata[i];
+    if (opdata->operator_objects[0] == NULL) {
+      // Operator was removed during optimization
+      continue;
+    }
+
+    const struct xnn_node* node = &runtime->nodes[get_operator_node_index(runtime, i)];
+    assert(node->reshape != NULL);
+    const enum xnn_status status = node->reshape(node, runtime->values, runtime->num_blobs, opdata);
+    if (status != xnn_status_success) {
+      xnn_log_error("failed to reshape runtime: error in operator #%zu", i);
+      return status;
+    }
+  }
+
+  const enum xnn_status status = plan_workspace(runtime);
+  if (status != xnn_status_success) {
+    return status;
+  }
+
+  struct xnn_subgraph subgraph = {
+    .num_values = runtime->num_blobs,
+    .values = runtime->values,
+    .num_nodes = runtime->num_nodes,
+    .nodes = runtime->nodes,
+  };
+  for (size_t i = 0; i < runtime->num_ops; i++) {
+    struct xnn_operator_data* opdata = &runtime->opdata[i];
+    if (opdata->operator_objects[0] != NULL) {
+      opdata->num_bytes = get_node_num_bytes(&subgraph, &runtime->nodes[get_operator_node_index(runtime, i)]);
+    }
+  }
+
+  runtime->reshape_pending = false;
+  // Shapes of the operators changed, and the workspace may have moved: blob pointers must be set up again.
+  runtime->setup_pending = true;
+  return xnn_status_success;
+}
+
+enum xnn_status xnn_get_external_value_shape(
+  xnn_runtime_t runtime,
+  uint32_t external_id,
+  size_t* num_dims,
+  size_t* dims)
+{
+  if (external_id >= runtime->num_blobs) {
+    xnn_log_error("failed to get external value shape: out-of-bounds ID %" PRIu32, external_id);
+    return xnn_status_invalid_parameter;
+  }
+
+  const struct xnn_value* value = &runtime->values[external_id];
+  if ((value->flags & (XNN_VALUE_FLAG_EXTERNAL_INPUT | XNN_VALUE_FLAG_EXTERNAL_OUTPUT)) == 0) {
+    xnn_log_error("failed to get external value shape: Value %" PRIu32 " is not external", external_id);
+    return xnn_status_invalid_parameter;
+  }
+
+  *num_dims = value->shape.num_dims;
+  for (size_t i = 0; i < value->shape.num_dims; i++) {
+    dims[i] = value->shape.dim[i];
+  }
+  return xnn_status_success;
+}
+
+enum xnn_status xnn_get_runtime_workspace_size(
+  xnn_runtime_t runtime,
+  size_t* workspace_size,
+  size_t* workspace_lower_bound)
+{
+  *workspace_size = runtime->workspace_size;
+  *workspace_lower_bound = runtime->workspace_lower_bound;
+  return xnn_status_success;
+}
+
 enum xnn_status xnn_setup_runtime(
   xnn_runtime_t runtime,
   size_t num_external_values,
   const struct xnn_external_value* external_values)
 {
+  if (runtime->reshape_pending) {
+    xnn_log_error("failed to setup runtime: shapes of external inputs changed, but the runtime was not reshaped");
+    return xnn_status_invalid_state;
+  }
+
   // Validate inputs without changing internal state.
   // This ensures that runtime stays in consistent state in case validation fails midway.
   for (size_t i = 0; i < num_external_values; i++) {
@@ -181,7 +602,7 @@ enum xnn_status xnn_setup_runtime(
 
   for (size_t i = 0; i < runtime->num_ops; i++) {
     const struct xnn_operator_data* opdata = &runtime->opdata[i];
-    if (opdata->operator_object == NULL) {
+    if (opdata->operator_objects[0] == NULL) {
       // Operator was removed during optimization
       continue;
     }
@@ -194,22 +615,212 @@ enum xnn_status xnn_setup_runtime(
     }
   }
 
+  runtime->setup_pending = false;
+  return xnn_status_success;
+}
+
+// Runs all operators of a Node one after another.
+static enum xnn_status run_operator_data(
+  const struct xnn_operator_data* opdata,
+  pthreadpool_t threadpool)
+{
+  for (size_t j = 0; j < XNN_MAX_OPERATOR_OBJECTS && opdata->operator_objects[j] != NULL; j++) {
+    const enum xnn_status status = xnn_run_operator(opdata->operator_objects[j], threadpool);
+    if (status != xnn_status_success) {
+      return status;
+    }
+  }
+  return xnn_status_success;
+}
+
+static void run_operator_task(
+  const struct xnn_operator_data* opdata,
+  size_t index)
+{
+  // Status is validated before dispatching the level.
+  run_operator_data(&opdata[index], NULL /* threadpool */);
+}
+
+static enum xnn_status invoke_levels(
+  xnn_runtime_t runtime)
+{
+  for (size_t l = 0; l < runtime->num_levels; l++) {
+    const struct xnn_operator_level* level = &runtime->levels[l];
+    struct xnn_operator_data* opdata = runtime->opdata + level->first_op;
+    if (!level->concurrent) {
+      for (size_t i = 0; i < level->num_ops; i++) {
+        if (opdata[i].operator_objects[0] == NULL) {
+          // Operator was removed after fusion
+          continue;
+        }
+
+        const enum xnn_status status = run_operator_data(&opdata[i], runtime->threadpool);
+        if (status != xnn_status_success) {
+          return status;
+        }
+      }
+      continue;
+    }
+
+    // Operators run on worker threads can't report errors, so check for them before dispatching.
+    if ((xnn_params.init_flags & XNN_INIT_FLAG_XNNPACK) == 0) {
+      xnn_log_error("failed to run operator: XNNPACK is not initialized");
+      return xnn_status_uninitialized;
+    }
+    uint32_t flags = PTHREADPOOL_FLAG_DISABLE_DENORMALS;
+    for (size_t i = 0; i < level->num_ops; i++) {
+      for (size_t j = 0; j < XNN_MAX_OPERATOR_OBJECTS && opdata[i].operator_objects[j] != NULL; j++) {
+        const xnn_operator_t op = opdata[i].operator_objects[j];
+        if (op->state == xnn_run_state_invalid) {
+          xnn_log_error("failed to run operator: operator was not successfully setup");
+          return xnn_status_invalid_state;
+        }
+        // Inputs of operators in the level were produced by operators in the previous levels.
+        if (op->state == xnn_run_state_ready) {
+          const enum xnn_status status = xnn_validate_operator_inputs(op);
+          if (status != xnn_status_success) {
+            return status;
+          }
+        }
+        if (op->flags & XNN_FLAG_YIELD_WORKERS) {
+          flags |= PTHREADPOOL_FLAG_YIELD_WORKERS;
+        }
+      }
+    }
+    pthreadpool_parallelize_1d(
+      runtime->threadpool,
+      (pthreadpool_task_1d_t) run_operator_task,
+      opdata,
+      level->num_ops,
+      flags);
+  }
   return xnn_status_success;
 }
 
 enum xnn_status xnn_invoke_runtime(
   xnn_runtime_t runtime)
 {
+  if (runtime->reshape_pending) {
+    xnn_log_error("failed to invoke runtime: shapes of external inputs changed, but the runtime was not reshaped");
+    return xnn_status_invalid_state;
+  }
+
+  if (runtime->setup_pending) {
+    xnn_log_error(
+      "failed to invoke runtime: runtime was reshaped or its workspace was re-allocated, and it must be set up again");
+    return xnn_status_invalid_state;
+  }
+
+  if (runtime->levels != NULL) {
+    return invoke_levels(runtime);
+  }
+
+  if XNN_UNLIKELY(runtime->profiling) {
+    runtime->start_ts = read_timer();
+  }
   for (size_t i = 0; i < runtime->num_ops; i++) {
-    if (runtime->opdata[i].operator_object == NULL) {
+    if (runtime->opdata[i].operator_objects[0] == NULL) {
       // Operator was removed after fusion
       continue;
     }
 
-    const enum xnn_status status = xnn_run_operator(runtime->opdata[i].operator_object, runtime->threadpool);
+    const enum xnn_status status = run_operator_data(&runtime->opdata[i], runtime->threadpool);
     if (status != xnn_status_success) {
       return status;
     }
+    if XNN_UNLIKELY(runtime->profiling) {
+      runtime->opdata[i].end_ts = read_timer();
+    }
+  }
+  return xnn_status_success;
+}
+
+enum xnn_status xnn_get_runtime_profiling_info(
+  xnn_runtime_t runtime,
+  enum xnn_profile_info param_name,
+  size_t param_value_size,
+  void* param_value,
+  size_t* param_value_size_ret)
+{
+  if (!runtime->profiling) {
+    xnn_log_error("failed to get profiling info: runtime was created without XNN_FLAG_BASIC_PROFILING");
+    return xnn_status_invalid_state;
+  }
+
+  const struct xnn_operator_data* opdata = runtime->opdata;
+  size_t num_ops = 0;
+  size_t names_size = 0;
+  for (size_t i = 0; i < runtime->num_ops; i++) {
+    if (opdata[i].operator_objects[0] != NULL) {
+      num_ops += 1;
+      names_size += strlen(xnn_operator_type_to_string(opdata[i].operator_objects[0]->type)) + 1;
+    }
+  }
+
+  size_t required_size = 0;
+  switch (param_name) {
+    case xnn_profile_info_num_operators:
+      required_size = sizeof(size_t);
+      break;
+    case xnn_profile_info_operator_name:
+      required_size = names_size;
+      break;
+    case xnn_profile_info_operator_timing:
+      required_size = num_ops * sizeof(uint64_t);
+      break;
+    case xnn_profile_info_operator_bytes:
+      required_size = num_ops * sizeof(size_t);
+      break;
+    default:
+      xnn_log_error("failed to get profiling info: unsupported parameter %d", (int) param_name);
+      return xnn_status_invalid_parameter;
+  }
+  if (param_value_size < required_size) {
+    *param_value_size_ret = required_size;
+    return xnn_status_out_of_memory;
+  }
+
+  switch (param_name) {
+    case xnn_profile_info_num_operators:
+      memcpy(param_value, &num_ops, sizeof(size_t));
+      break;
+    case xnn_profile_info_operator_name:
+    {
+      char* name_out = (char*) param_value;
+      for (size_t i = 0; i < runtime->num_ops; i++) {
+        if (opdata[i].operator_objects[0] != NULL) {
+          const char* name = xnn_operator_type_to_string(opdata[i].operator_objects[0]->type);
+          const size_t name_size = strlen(name) + 1;
+          memcpy(name_out, name, name_size);
+          name_out += name_size;
+        }
+      }
+      break;
+    }
+    case xnn_profile_info_operator_timing:
+    {
+      // Time between consecutive operators is attributed to the latter one, so the sum of all timings matches the
+      // wall time of the invocation.
+      uint64_t previous_ts = runtime->start_ts;
+      uint64_t* timing_out = (uint64_t*) param_value;
+      for (size_t i = 0; i < runtime->num_ops; i++) {
+        if (opdata[i].operator_objects[0] != NULL) {
+          *timing_out++ = opdata[i].end_ts - previous_ts;
+          previous_ts = opdata[i].end_ts;
+        }
+      }
+      break;
+    }
+    case xnn_profile_info_operator_bytes:
+    {
+      size_t* bytes_out = (size_t*) param_value;
+      for (size_t i = 0; i < runtime->num_ops; i++) {
+        if (opdata[i].operator_objects[0] != NULL) {
+          *bytes_out++ = opdata[i].num_bytes;
+        }
+      }
+      break;
+    }
   }
   return xnn_status_success;
 }
@@ -220,12 +831,27 @@ enum xnn_status xnn_delete_runtime(
   if (runtime != NULL) {
     if (runtime->opdata != NULL) {
       for (size_t i = 0; i < runtime->num_ops; i++) {
-        xnn_delete_operator(runtime->opdata[i].operator_object);
+        for (size_t j = 0; j < XNN_MAX_OPERATOR_OBJECTS; j++) {
+          xnn_delete_operator(runtime->opdata[i].operator_objects[j]);
+        }
       }
       xnn_release_memory(runtime->opdata);
+      xnn_release_memory(runtime->levels);
+      xnn_release_memory(runtime->nodes);
+      xnn_release_memory(runtime->execution_order);
+      xnn_release_memory(runtime->node_steps);
+      xnn_release_memory(runtime->values);
 
       xnn_release_memory(runtime->blobs);
-      xnn_release_simd_memory(runtime->workspace);
+      if (runtime->workspace != NULL) {
+        // Unbind the runtime from the workspace before releasing the reference.
+        struct xnn_runtime** user = &runtime->workspace->first_user;
+        while (*user != runtime) {
+          user = &(*user)->next_workspace_user;
+        }
+        *user = runtime->next_workspace_user;
+        xnn_release_workspace(runtime->workspace);
+      }
     }
     xnn_release_memory(runtime);
   }
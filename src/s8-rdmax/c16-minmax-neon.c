@@ -0,0 +1,69 @@
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <arm_neon.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/rmax.h>
+
+
+void xnn_s8_rdmax_minmax_ukernel_c16__neon(
+    size_t rows,
+    size_t channels,
+    const int8_t* input,
+    size_t input_stride,
+    int8_t* output,
+    const union xnn_s8_minmax_params params[restrict XNN_MIN_ELEMENTS(1)]) XNN_OOB_READS
+{
+  assert(rows != 0);
+  assert(channels != 0);
+
+  const int8x16_t voutput_max = vld1q_dup_s8(&params->neon.max);
+  const int8x16_t voutput_min = vld1q_dup_s8(&params->neon.min);
+  for (; channels >= 16; channels -= 16) {
+    const int8_t* i = input;
+    int8x16_t vmax = vld1q_s8(i);
+    for (size_t r = rows - 1; r != 0; r--) {
+      i = (const int8_t*) ((uintptr_t) i + input_stride);
+      vmax = vmaxq_s8(vmax, vld1q_s8(i));
+    }
+    input += 16;
+
+    vmax = vmaxq_s8(vmax, voutput_min);
+    vmax = vminq_s8(vmax, voutput_max);
+
+    vst1q_s8(output, vmax); output += 16;
+  }
+  if XNN_UNLIKELY(channels != 0) {
+    const int8_t* i = input;
+    int8x16_t vmax = vld1q_s8(i);
+    for (size_t r = rows - 1; r != 0; r--) {
+      i = (const int8_t*) ((uintptr_t) i + input_stride);
+      vmax = vmaxq_s8(vmax, vld1q_s8(i));
+    }
+
+    vmax = vmaxq_s8(vmax, voutput_min);
+    vmax = vminq_s8(vmax, voutput_max);
+
+    int8x8_t vout_lo = vget_low_s8(vmax);
+    if (channels & 8) {
+      vst1_s8(output, vout_lo); output += 8;
+      vout_lo = vget_high_s8(vmax);
+    }
+    if (channels & 4) {
+      vst1_lane_u32((void*) output, vreinterpret_u32_s8(vout_lo), 0); output += 4;
+      vout_lo = vext_s8(vout_lo, vout_lo, 4);
+    }
+    if (channels & 2) {
+      vst1_lane_u16((void*) output, vreinterpret_u16_s8(vout_lo), 0); output += 2;
+      vout_lo = vext_s8(vout_lo, vout_lo, 2);
+    }
+    if (channels & 1) {
+      vst1_lane_s8(output, vout_lo, 0);
+    }
+  }
+}
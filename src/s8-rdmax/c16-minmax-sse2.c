@@ -0,0 +1,76 @@
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <emmintrin.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/rmax.h>
+
+
+void xnn_s8_rdmax_minmax_ukernel_c16__sse2(
+    size_t rows,
+    size_t channels,
+    const int8_t* input,
+    size_t input_stride,
+    int8_t* output,
+    const union xnn_s8_minmax_params params[restrict XNN_MIN_ELEMENTS(1)]) XNN_OOB_READS
+{
+  assert(rows != 0);
+  assert(channels != 0);
+
+  // SSE2 has no signed 8-bit maximum, so the computation is done on biased unsigned values.
+  const __m128i vbias = _mm_load_si128((const __m128i*) params->sse2.bias);
+  const __m128i voutput_max_with_bias = _mm_load_si128((const __m128i*) params->sse2.max_with_bias);
+  const __m128i voutput_min_with_bias = _mm_load_si128((const __m128i*) params->sse2.min_with_bias);
+  for (; channels >= 16; channels -= 16) {
+    const int8_t* i = input;
+    __m128i vmax = _mm_xor_si128(_mm_loadu_si128((const __m128i*) i), vbias);
+    for (size_t r = rows - 1; r != 0; r--) {
+      i = (const int8_t*) ((uintptr_t) i + input_stride);
+      vmax = _mm_max_epu8(vmax, _mm_xor_si128(_mm_loadu_si128((const __m128i*) i), vbias));
+    }
+    input += 16;
+
+    vmax = _mm_max_epu8(vmax, voutput_min_with_bias);
+    vmax = _mm_min_epu8(vmax, voutput_max_with_bias);
+    const __m128i vout = _mm_xor_si128(vmax, vbias);
+
+    _mm_storeu_si128((__m128i*) output, vout);
+    output += 16;
+  }
+  if XNN_UNLIKELY(channels != 0) {
+    const int8_t* i = input;
+    __m128i vmax = _mm_xor_si128(_mm_loadu_si128((const __m128i*) i), vbias);
+    for (size_t r = rows - 1; r != 0; r--) {
+      i = (const int8_t*) ((uintptr_t) i + input_stride);
+      vmax = _mm_max_epu8(vmax, _mm_xor_si128(_mm_loadu_si128((const __m128i*) i), vbias));
+    }
+
+    vmax = _mm_max_epu8(vmax, voutput_min_with_bias);
+    vmax = _mm_min_epu8(vmax, voutput_max_with_bias);
+    __m128i vout = _mm_xor_si128(vmax, vbias);
+
+    if (channels & 8) {
+      _mm_storel_epi64((__m128i*) output, vout);
+      vout = _mm_unpackhi_epi64(vout, vout);
+      output += 8;
+    }
+    if (channels & 4) {
+      *((uint32_t*) output) = (uint32_t) _mm_cvtsi128_si32(vout);
+      vout = _mm_srli_epi64(vout, 32);
+      output += 4;
+    }
+    if (channels & 2) {
+      *((uint16_t*) output) = (uint16_t) _mm_extract_epi16(vout, 0);
+      vout = _mm_srli_epi32(vout, 16);
+      output += 2;
+    }
+    if (channels & 1) {
+      *output = (int8_t) _mm_cvtsi128_si32(vout);
+    }
+  }
+}
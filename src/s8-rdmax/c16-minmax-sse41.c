@@ -0,0 +1,72 @@
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <smmintrin.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/rmax.h>
+
+
+void xnn_s8_rdmax_minmax_ukernel_c16__sse41(
+    size_t rows,
+    size_t channels,
+    const int8_t* input,
+    size_t input_stride,
+    int8_t* output,
+    const union xnn_s8_minmax_params params[restrict XNN_MIN_ELEMENTS(1)]) XNN_OOB_READS
+{
+  assert(rows != 0);
+  assert(channels != 0);
+
+  const __m128i voutput_max = _mm_load_si128((const __m128i*) params->sse4.max);
+  const __m128i voutput_min = _mm_load_si128((const __m128i*) params->sse4.min);
+  for (; channels >= 16; channels -= 16) {
+    const int8_t* i = input;
+    __m128i vmax = _mm_loadu_si128((const __m128i*) i);
+    for (size_t r = rows - 1; r != 0; r--) {
+      i = (const int8_t*) ((uintptr_t) i + input_stride);
+      vmax = _mm_max_epi8(vmax, _mm_loadu_si128((const __m128i*) i));
+    }
+    input += 16;
+
+    vmax = _mm_max_epi8(vmax, voutput_min);
+    vmax = _mm_min_epi8(vmax, voutput_max);
+
+    _mm_storeu_si128((__m128i*) output, vmax);
+    output += 16;
+  }
+  if XNN_UNLIKELY(channels != 0) {
+    const int8_t* i = input;
+    __m128i vmax = _mm_loadu_si128((const __m128i*) i);
+    for (size_t r = rows - 1; r != 0; r--) {
+      i = (const int8_t*) ((uintptr_t) i + input_stride);
+      vmax = _mm_max_epi8(vmax, _mm_loadu_si128((const __m128i*) i));
+    }
+
+    vmax = _mm_max_epi8(vmax, voutput_min);
+    __m128i vout = _mm_min_epi8(vmax, voutput_max);
+
+    if (channels & 8) {
+      _mm_storel_epi64((__m128i*) output, vout);
+      vout = _mm_unpackhi_epi64(vout, vout);
+      output += 8;
+    }
+    if (channels & 4) {
+      *((uint32_t*) output) = (uint32_t) _mm_cvtsi128_si32(vout);
+      vout = _mm_srli_epi64(vout, 32);
+      output += 4;
+    }
+    if (channels & 2) {
+      *((uint16_t*) output) = (uint16_t) _mm_extract_epi16(vout, 0);
+      vout = _mm_srli_epi32(vout, 16);
+      output += 2;
+    }
+    if (channels & 1) {
+      *output = (int8_t) _mm_extract_epi8(vout, 0);
+    }
+  }
+}
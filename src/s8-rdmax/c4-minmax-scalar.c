@@ -0,0 +1,66 @@
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/math.h>
+#include <xnnpack/rmax.h>
+
+
+void xnn_s8_rdmax_minmax_ukernel_c4__scalar(
+    size_t rows,
+    size_t channels,
+    const int8_t* input,
+    size_t input_stride,
+    int8_t* output,
+    const union xnn_s8_minmax_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(rows != 0);
+  assert(channels != 0);
+
+  const int32_t voutput_max = params->scalar.max;
+  const int32_t voutput_min = params->scalar.min;
+  for (; channels >= 4; channels -= 4) {
+    const int8_t* i = input;
+    int32_t vmax0 = (int32_t) i[0];
+    int32_t vmax1 = (int32_t) i[1];
+    int32_t vmax2 = (int32_t) i[2];
+    int32_t vmax3 = (int32_t) i[3];
+    for (size_t r = rows - 1; r != 0; r--) {
+      i = (const int8_t*) ((uintptr_t) i + input_stride);
+      vmax0 = math_max_s32(vmax0, (int32_t) i[0]);
+      vmax1 = math_max_s32(vmax1, (int32_t) i[1]);
+      vmax2 = math_max_s32(vmax2, (int32_t) i[2]);
+      vmax3 = math_max_s32(vmax3, (int32_t) i[3]);
+    }
+    input += 4;
+
+    vmax0 = math_min_s32(math_max_s32(vmax0, voutput_min), voutput_max);
+    vmax1 = math_min_s32(math_max_s32(vmax1, voutput_min), voutput_max);
+    vmax2 = math_min_s32(math_max_s32(vmax2, voutput_min), voutput_max);
+    vmax3 = math_min_s32(math_max_s32(vmax3, voutput_min), voutput_max);
+
+    output[0] = (int8_t) vmax0;
+    output[1] = (int8_t) vmax1;
+    output[2] = (int8_t) vmax2;
+    output[3] = (int8_t) vmax3;
+    output += 4;
+  }
+  if XNN_UNLIKELY(channels != 0) {
+    do {
+      const int8_t* i = input;
+      int32_t vmax = (int32_t) *i;
+      for (size_t r = rows - 1; r != 0; r--) {
+        i = (const int8_t*) ((uintptr_t) i + input_stride);
+        vmax = math_max_s32(vmax, (int32_t) *i);
+      }
+      input += 1;
+
+      vmax = math_min_s32(math_max_s32(vmax, voutput_min), voutput_max);
+      *output++ = (int8_t) vmax;
+    } while (--channels != 0);
+  }
+}
@@ -28,10 +28,18 @@ const char* xnn_node_type_to_string(enum xnn_node_type type) {
       return "Average Pooling 2D";
     case xnn_node_type_bankers_rounding:
       return "Bankers Rounding";
+    case xnn_node_type_batch_matrix_multiply:
+      return "Batch Matrix Multiply";
     case xnn_node_type_ceiling:
       return "Ceiling";
     case xnn_node_type_clamp:
       return "Clamp";
+    case xnn_node_type_concatenate2:
+      return "Concatenate2";
+    case xnn_node_type_concatenate3:
+      return "Concatenate3";
+    case xnn_node_type_concatenate4:
+      return "Concatenate4";
     case xnn_node_type_convert:
       return "Convert";
     case xnn_node_type_convolution_2d:
@@ -46,14 +54,26 @@ const char* xnn_node_type_to_string(enum xnn_node_type type) {
       return "Divide";
     case xnn_node_type_elu:
       return "ELU";
+    case xnn_node_type_even_split2:
+      return "Even Split2";
+    case xnn_node_type_even_split3:
+      return "Even Split3";
+    case xnn_node_type_even_split4:
+      return "Even Split4";
     case xnn_node_type_fully_connected:
       return "Fully Connected";
     case xnn_node_type_floor:
       return "Floor";
+    case xnn_node_type_gather:
+      return "Gather";
+    case xnn_node_type_gelu:
+      return "GELU";
     case xnn_node_type_global_average_pooling_2d:
       return "Global Average Pooling 2D";
     case xnn_node_type_hardswish:
       return "HardSwish";
+    case xnn_node_type_layer_normalization:
+      return "Layer Normalization";
     case xnn_node_type_leaky_relu:
       return "Leaky ReLU";
     case xnn_node_type_maximum2:
@@ -76,8 +96,12 @@ const char* xnn_node_type_to_string(enum xnn_node_type type) {
       return "Static Constant Pad";
     case xnn_node_type_static_reshape:
       return "Static Reshape";
+    case xnn_node_type_static_slice:
+      return "Static Slice";
     case xnn_node_type_static_resize_bilinear_2d:
       return "Static Resize Bilinear 2D";
+    case xnn_node_type_static_transpose:
+      return "Static Transpose";
     case xnn_node_type_square:
       return "Square";
     case xnn_node_type_square_root:
@@ -86,6 +110,8 @@ const char* xnn_node_type_to_string(enum xnn_node_type type) {
       return "Squared Difference";
     case xnn_node_type_subtract:
       return "Subtract";
+    case xnn_node_type_tanh:
+      return "Tanh";
     case xnn_node_type_unpooling_2d:
       return "Unpooling 2D";
   }
@@ -7,6 +7,7 @@
 #include <stddef.h>
 #include <stdint.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include <xnnpack.h>
 #include <xnnpack/allocator.h>
@@ -93,6 +94,9 @@ void xnn_node_clear(struct xnn_node* node) {
 void xnn_value_clear(struct xnn_value* value) {
   assert(value != NULL);
   assert(value->type != xnn_value_type_invalid);
+  if (value->allocated_data) {
+    xnn_release_memory((void*) value->data);
+  }
   memset(value, 0, sizeof(struct xnn_value));
 }
 
@@ -260,11 +264,13 @@ uint32_t xnn_check_nchw_compatibility(xnn_subgraph_t subgraph, struct xnn_node*
     case xnn_node_type_clamp:
     case xnn_node_type_elu:
     case xnn_node_type_floor:
+    case xnn_node_type_gelu:
     case xnn_node_type_hardswish:
     case xnn_node_type_leaky_relu:
     case xnn_node_type_negate:
     case xnn_node_type_sigmoid:
     case xnn_node_type_square:
+    case xnn_node_type_tanh:
       assert(node->num_inputs == 1);
       assert(node->num_outputs == 1);
       return subgraph->values[node->inputs[0]].shape.num_dims == 4 ? XNN_LAYOUT_FLAG_COMPATIBLE_NCHW : 0;
@@ -495,6 +501,195 @@ void xnn_subgraph_rewrite_for_nchw(xnn_subgraph_t subgraph)
   }
 }
 
+// Check if a static FP32 Value can be broadcasted along the channel dimension of an output with num_channels channels
+// without changing the output shape.
+static bool is_static_per_channel_value(
+  const struct xnn_value* value,
+  const struct xnn_value* output,
+  size_t num_channels)
+{
+  if (value->data == NULL || value->datatype != xnn_datatype_fp32) {
+    return false;
+  }
+  if (value->shape.num_dims > output->shape.num_dims) {
+    return false;
+  }
+  for (size_t i = 0; i + 1 < value->shape.num_dims; i++) {
+    if (value->shape.dim[i] != 1) {
+      return false;
+    }
+  }
+  if (value->shape.num_dims != 0) {
+    const size_t value_channels = value->shape.dim[value->shape.num_dims - 1];
+    if (value_channels != 1 && value_channels != num_channels) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Make static data of the Value writable by copying it into a buffer owned by the Subgraph.
+static float* get_allocated_data(
+  xnn_subgraph_t subgraph,
+  uint32_t value_id)
+{
+  struct xnn_value* value = &subgraph->values[value_id];
+  if (!value->allocated_data) {
+    const size_t size = xnn_tensor_get_size(subgraph, value_id);
+    void* data = xnn_allocate_memory(size);
+    if (data == NULL) {
+      xnn_log_error("failed to allocate %zu bytes for folded static data of Value #%" PRIu32, size, value_id);
+      return NULL;
+    }
+    memcpy(data, value->data, size);
+    value->data = data;
+    value->allocated_data = true;
+  }
+  return (float*) (uintptr_t) value->data;
+}
+
+// Fold static per-channel Multiply and Add Nodes downstream into the filter and bias of the producer Node.
+static enum xnn_status fold_static_scale_shift(
+  xnn_subgraph_t subgraph,
+  uint32_t producer_id)
+{
+  struct xnn_node* producer = &subgraph->nodes[producer_id];
+  if (producer->compute_type != xnn_compute_type_fp32) {
+    return xnn_status_success;
+  }
+
+  // Filter elements of an output channel are either contiguous (channel_first), or interleaved with a stride of
+  // num_channels elements.
+  const uint32_t filter_id = producer->inputs[1];
+  size_t num_channels = 0;
+  bool channel_first = true;
+  switch (producer->type) {
+    case xnn_node_type_convolution_2d:
+      num_channels = producer->params.convolution_2d.groups * producer->params.convolution_2d.group_output_channels;
+      break;
+    case xnn_node_type_depthwise_convolution_2d:
+      num_channels = producer->params.depthwise_convolution_2d.input_channels *
+        producer->params.depthwise_convolution_2d.depth_multiplier;
+      channel_first = false;
+      break;
+    case xnn_node_type_fully_connected:
+      if (producer->flags & XNN_FLAG_TRANSPOSE_WEIGHTS) {
+        num_channels = subgraph->values[filter_id].shape.dim[1];
+        channel_first = false;
+      } else {
+        num_channels = subgraph->values[filter_id].shape.dim[0];
+      }
+      break;
+    default:
+      return xnn_status_success;
+  }
+
+  for (;;) {
+    // Clamping in the producer Node can't be moved past the Multiply or Add.
+    if (producer->activation.output_min != -INFINITY || producer->activation.output_max != +INFINITY) {
+      return xnn_status_success;
+    }
+
+    const uint32_t output_id = producer->outputs[0];
+    const struct xnn_value* output = &subgraph->values[output_id];
+    if (output->num_consumers != 1 || output->first_consumer == XNN_INVALID_NODE_ID ||
+        output->shape.dim[output->shape.num_dims - 1] != num_channels)
+    {
+      return xnn_status_success;
+    }
+    const uint32_t consumer_id = output->first_consumer;
+    struct xnn_node* consumer = &subgraph->nodes[consumer_id];
+    if ((consumer->type != xnn_node_type_multiply2 && consumer->type != xnn_node_type_add2) ||
+        consumer->compute_type != xnn_compute_type_fp32)
+    {
+      return xnn_status_success;
+    }
+    const uint32_t operand_id = consumer->inputs[0] == output_id ? consumer->inputs[1] : consumer->inputs[0];
+    const struct xnn_value* operand = &subgraph->values[operand_id];
+    if (!is_static_per_channel_value(operand, output, num_channels)) {
+      return xnn_status_success;
+    }
+    const size_t operand_channels = operand->shape.num_dims == 0 ? 1 : operand->shape.dim[operand->shape.num_dims - 1];
+
+    // Static filter and bias are rewritten in place, and can't be shared with other Nodes.
+    const struct xnn_value* filter = &subgraph->values[filter_id];
+    if (filter->data == NULL || filter->datatype != xnn_datatype_fp32 || filter->num_consumers != 1) {
+      return xnn_status_success;
+    }
+    if (producer->num_inputs > 2) {
+      const struct xnn_value* bias = &subgraph->values[producer->inputs[2]];
+      if (bias->data == NULL || bias->datatype != xnn_datatype_fp32 || bias->num_consumers != 1) {
+        return xnn_status_success;
+      }
+    } else if (consumer->type == xnn_node_type_add2) {
+      // Create a zero-initialized bias to fold the Add into.
+      struct xnn_value* bias = xnn_subgraph_new_internal_value(subgraph);
+      if (bias == NULL) {
+        return xnn_status_out_of_memory;
+      }
+      void* bias_data = xnn_allocate_zero_memory(num_channels * sizeof(float));
+      if (bias_data == NULL) {
+        xnn_log_error("failed to allocate %zu bytes for folded bias", num_channels * sizeof(float));
+        return xnn_status_out_of_memory;
+      }
+      bias->type = xnn_value_type_dense_tensor;
+      bias->datatype = xnn_datatype_fp32;
+      bias->shape.num_dims = 1;
+      bias->shape.dim[0] = num_channels;
+      bias->data = bias_data;
+      bias->allocated_data = true;
+      bias->producer = XNN_INVALID_NODE_ID;
+      bias->first_consumer = producer_id;
+      bias->num_consumers = 1;
+      producer->inputs[2] = bias->id;
+      producer->num_inputs = 3;
+    }
+    // Reload Value pointers: creating the bias could re-allocate the array of Values.
+    operand = &subgraph->values[operand_id];
+    const float* operand_data = (const float*) operand->data;
+
+    float* bias_data = NULL;
+    if (producer->num_inputs > 2) {
+      bias_data = get_allocated_data(subgraph, producer->inputs[2]);
+      if (bias_data == NULL) {
+        return xnn_status_out_of_memory;
+      }
+    }
+    if (consumer->type == xnn_node_type_multiply2) {
+      float* filter_data = get_allocated_data(subgraph, filter_id);
+      if (filter_data == NULL) {
+        return xnn_status_out_of_memory;
+      }
+      const size_t num_filter_elements = xnn_shape_multiply_all_dims(&subgraph->values[filter_id].shape);
+      const size_t channel_size = num_filter_elements / num_channels;
+      for (size_t i = 0; i < num_filter_elements; i++) {
+        const size_t channel = channel_first ? i / channel_size : i % num_channels;
+        filter_data[i] *= operand_data[operand_channels == 1 ? 0 : channel];
+      }
+      if (bias_data != NULL) {
+        for (size_t c = 0; c < num_channels; c++) {
+          bias_data[c] *= operand_data[operand_channels == 1 ? 0 : c];
+        }
+      }
+    } else {
+      assert(bias_data != NULL);
+      for (size_t c = 0; c < num_channels; c++) {
+        bias_data[c] += operand_data[operand_channels == 1 ? 0 : c];
+      }
+    }
+
+    xnn_log_info("fold static %s Node #%" PRIu32 " into upstream Node #%" PRIu32,
+      xnn_node_type_to_string(consumer->type), consumer_id, producer_id);
+    const uint32_t fused_output_id = consumer->outputs[0];
+    subgraph->values[fused_output_id].producer = producer_id;
+    producer->outputs[0] = fused_output_id;
+    producer->activation = consumer->activation;
+    subgraph->values[operand_id].num_consumers -= 1;
+    xnn_node_clear(consumer);
+    xnn_value_clear(&subgraph->values[output_id]);
+  }
+}
+
 enum xnn_status xnn_subgraph_optimize(
   xnn_subgraph_t subgraph,
   uint32_t flags)
@@ -546,6 +741,14 @@ enum xnn_status xnn_subgraph_optimize(
     }
   }
 
+  // Fold static per-channel scale and shift into the weights of upstream Nodes
+  for (uint32_t n = 0; n < subgraph->num_nodes; n++) {
+    const enum xnn_status status = fold_static_scale_shift(subgraph, n);
+    if (status != xnn_status_success) {
+      return status;
+    }
+  }
+
   // Fuse Nodes where possible
   for (uint32_t i = 0; i < subgraph->num_values; i++) {
     struct xnn_value* value = &subgraph->values[i];
@@ -578,6 +781,7 @@ enum xnn_status xnn_subgraph_optimize(
           case xnn_node_type_deconvolution_2d:
           case xnn_node_type_depthwise_convolution_2d:
           case xnn_node_type_fully_connected:
+          case xnn_node_type_global_average_pooling_2d:
           case xnn_node_type_multiply2:
           case xnn_node_type_max_pooling_2d:
           case xnn_node_type_subtract:
@@ -692,6 +896,11 @@ enum xnn_status xnn_delete_subgraph(
     memset(subgraph->nodes, 0, sizeof(struct xnn_node) * subgraph->num_nodes);
     xnn_release_memory(subgraph->nodes);
 
+    for (uint32_t i = 0; i < subgraph->num_values; i++) {
+      if (subgraph->values[i].allocated_data) {
+        xnn_release_memory((void*) subgraph->values[i].data);
+      }
+    }
     memset(subgraph->values, 0, sizeof(struct xnn_value) * subgraph->num_values);
     xnn_release_memory(subgraph->values);
 
@@ -9,6 +9,7 @@
 
 #include <xnnpack.h>
 #include <xnnpack/log.h>
+#include <xnnpack/math.h>
 #include <xnnpack/params.h>
 #include <xnnpack/subgraph.h>
 
@@ -17,7 +18,8 @@ static enum xnn_status create_argmax_pooling_operator(
   const struct xnn_node* node,
   const struct xnn_value* values,
   size_t num_values,
-  struct xnn_operator_data* opdata)
+  struct xnn_operator_data* opdata,
+  xnn_weights_cache_t weights_cache)
 {
   assert(node->compute_type == xnn_compute_type_fp32);
 
@@ -47,7 +49,7 @@ static enum xnn_status create_argmax_pooling_operator(
     node->params.pooling_2d.pooling_width,
     channel_dim /* channels */, channel_dim /* input stride */, channel_dim /* output stride */,
     node->flags,
-    &opdata->operator_object);
+    &opdata->operator_objects[0]);
   if (status == xnn_status_success) {
     opdata->batch_size = values[input_id].shape.dim[0];
     opdata->input_height = values[input_id].shape.dim[1];
@@ -59,6 +61,48 @@ static enum xnn_status create_argmax_pooling_operator(
   return status;
 }
 
+static enum xnn_status reshape_argmax_pooling_operator(
+  const struct xnn_node* node,
+  struct xnn_value* values,
+  size_t num_values,
+  struct xnn_operator_data* opdata)
+{
+  const uint32_t input_id = node->inputs[0];
+  assert(input_id != XNN_INVALID_VALUE_ID);
+  assert(input_id < num_values);
+
+  const uint32_t output_value_id = node->outputs[0];
+  assert(output_value_id != XNN_INVALID_VALUE_ID);
+  assert(output_value_id < num_values);
+  const uint32_t output_index_id = node->outputs[1];
+  assert(output_index_id != XNN_INVALID_VALUE_ID);
+  assert(output_index_id < num_values);
+
+  const struct xnn_shape* input_shape = &values[input_id].shape;
+  struct xnn_shape* output_shape = &values[output_value_id].shape;
+  if (input_shape->dim[3] != output_shape->dim[3]) {
+    xnn_log_error(
+      "failed to reshape %s operator with input ID #%" PRIu32 ": number of channels can't change from %zu to %zu",
+      xnn_node_type_to_string(xnn_node_type_argmax_pooling_2d), input_id, (size_t) output_shape->dim[3], input_shape->dim[3]);
+    return xnn_status_invalid_parameter;
+  }
+
+  output_shape->dim[0] = input_shape->dim[0];
+  if (node->flags & XNN_FLAG_TENSORFLOW_SAME_PADDING) {
+    output_shape->dim[1] = divide_round_up(input_shape->dim[1], node->params.pooling_2d.pooling_height);
+    output_shape->dim[2] = divide_round_up(input_shape->dim[2], node->params.pooling_2d.pooling_width);
+  } else {
+    output_shape->dim[1] = (node->params.pooling_2d.padding_top + input_shape->dim[1] + node->params.pooling_2d.padding_bottom) / node->params.pooling_2d.pooling_height;
+    output_shape->dim[2] = (node->params.pooling_2d.padding_left + input_shape->dim[2] + node->params.pooling_2d.padding_right) / node->params.pooling_2d.pooling_width;
+  }
+  values[output_index_id].shape = *output_shape;
+
+  opdata->batch_size = input_shape->dim[0];
+  opdata->input_height = input_shape->dim[1];
+  opdata->input_width = input_shape->dim[2];
+  return xnn_status_success;
+}
+
 static enum xnn_status setup_argmax_pooling_operator(
   const struct xnn_operator_data* opdata,
   const struct xnn_blob* blobs,
@@ -90,7 +134,7 @@ static enum xnn_status setup_argmax_pooling_operator(
   assert(output_index_data != NULL);
 
   return xnn_setup_argmax_pooling2d_nhwc_f32(
-    opdata->operator_object,
+    opdata->operator_objects[0],
     opdata->batch_size,
     opdata->input_height,
     opdata->input_width,
@@ -223,6 +267,8 @@ enum xnn_status xnn_define_argmax_pooling_2d(
   node->flags = flags;
 
   node->create = create_argmax_pooling_operator;
+
+  node->reshape = reshape_argmax_pooling_operator;
   node->setup = setup_argmax_pooling_operator;
 
   return xnn_status_success;
@@ -9,6 +9,7 @@
 
 #include <xnnpack.h>
 #include <xnnpack/log.h>
+#include <xnnpack/math.h>
 #include <xnnpack/params.h>
 #include <xnnpack/subgraph.h>
 
@@ -17,7 +18,8 @@ static enum xnn_status create_average_pooling_operator(
   const struct xnn_node* node,
   const struct xnn_value* values,
   size_t num_values,
-  struct xnn_operator_data* opdata)
+  struct xnn_operator_data* opdata,
+  xnn_weights_cache_t weights_cache)
 {
   assert(node->compute_type == xnn_compute_type_fp32);
 
@@ -47,7 +49,7 @@ static enum xnn_status create_average_pooling_operator(
     node->activation.output_min,
     node->activation.output_max,
     node->flags,
-    &opdata->operator_object);
+    &opdata->operator_objects[0]);
   if (status == xnn_status_success) {
     opdata->batch_size = values[input_id].shape.dim[0];
     opdata->input_height = values[input_id].shape.dim[1];
@@ -58,6 +60,56 @@ static enum xnn_status create_average_pooling_operator(
   return status;
 }
 
+static inline size_t compute_output_dimension(
+  size_t padded_input_dimension,
+  size_t pooling_dimension,
+  size_t stride_dimension)
+{
+  return doz(padded_input_dimension, pooling_dimension) / stride_dimension + 1;
+}
+
+static enum xnn_status reshape_average_pooling_operator(
+  const struct xnn_node* node,
+  struct xnn_value* values,
+  size_t num_values,
+  struct xnn_operator_data* opdata)
+{
+  const uint32_t input_id = node->inputs[0];
+  assert(input_id != XNN_INVALID_VALUE_ID);
+  assert(input_id < num_values);
+
+  const uint32_t output_id = node->outputs[0];
+  assert(output_id != XNN_INVALID_VALUE_ID);
+  assert(output_id < num_values);
+
+  const struct xnn_shape* input_shape = &values[input_id].shape;
+  struct xnn_shape* output_shape = &values[output_id].shape;
+  if (input_shape->dim[3] != output_shape->dim[3]) {
+    xnn_log_error(
+      "failed to reshape %s operator with input ID #%" PRIu32 ": number of channels can't change from %zu to %zu",
+      xnn_node_type_to_string(xnn_node_type_average_pooling_2d), input_id, (size_t) output_shape->dim[3], input_shape->dim[3]);
+    return xnn_status_invalid_parameter;
+  }
+
+  output_shape->dim[0] = input_shape->dim[0];
+  if (node->flags & XNN_FLAG_TENSORFLOW_SAME_PADDING) {
+    output_shape->dim[1] = divide_round_up(input_shape->dim[1], node->params.pooling_2d.stride_height);
+    output_shape->dim[2] = divide_round_up(input_shape->dim[2], node->params.pooling_2d.stride_width);
+  } else {
+    output_shape->dim[1] = compute_output_dimension(
+      node->params.pooling_2d.padding_top + input_shape->dim[1] + node->params.pooling_2d.padding_bottom,
+      node->params.pooling_2d.pooling_height, node->params.pooling_2d.stride_height);
+    output_shape->dim[2] = compute_output_dimension(
+      node->params.pooling_2d.padding_left + input_shape->dim[2] + node->params.pooling_2d.padding_right,
+      node->params.pooling_2d.pooling_width, node->params.pooling_2d.stride_width);
+  }
+
+  opdata->batch_size = input_shape->dim[0];
+  opdata->input_height = input_shape->dim[1];
+  opdata->input_width = input_shape->dim[2];
+  return xnn_status_success;
+}
+
 static enum xnn_status setup_average_pooling_operator(
   const struct xnn_operator_data* opdata,
   const struct xnn_blob* blobs,
@@ -81,7 +133,7 @@ static enum xnn_status setup_average_pooling_operator(
   assert(output_data != NULL);
 
   return xnn_setup_average_pooling2d_nhwc_f32(
-    opdata->operator_object,
+    opdata->operator_objects[0],
     opdata->batch_size,
     opdata->input_height,
     opdata->input_width,
@@ -245,6 +297,8 @@ enum xnn_status xnn_define_average_pooling_2d(
   node->flags = flags;
 
   node->create = create_average_pooling_operator;
+
+  node->reshape = reshape_average_pooling_operator;
   node->setup = setup_average_pooling_operator;
 
   return xnn_status_success;
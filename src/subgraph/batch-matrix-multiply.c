@@ -0,0 +1,301 @@
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <xnnpack.h>
+#include <xnnpack/log.h>
+#include <xnnpack/params.h>
+#include <xnnpack/subgraph.h>
+
+
+static enum xnn_status create_batch_matrix_multiply_operator(
+  const struct xnn_node* node,
+  const struct xnn_value* values,
+  size_t num_values,
+  struct xnn_operator_data* opdata,
+  xnn_weights_cache_t weights_cache)
+{
+  assert(node->num_inputs == 2);
+  const uint32_t input1_id = node->inputs[0];
+  assert(input1_id != XNN_INVALID_VALUE_ID);
+  assert(input1_id < num_values);
+  const uint32_t input2_id = node->inputs[1];
+  assert(input2_id != XNN_INVALID_VALUE_ID);
+  assert(input2_id < num_values);
+
+  assert(node->num_outputs == 1);
+  const uint32_t output_id = node->outputs[0];
+  assert(output_id != XNN_INVALID_VALUE_ID);
+  assert(output_id < num_values);
+
+  assert(node->compute_type == xnn_compute_type_fp32);
+  const enum xnn_status status = xnn_create_batch_matrix_multiply_nc_f32(node->flags, &opdata->operator_objects[0]);
+  if (status == xnn_status_success) {
+    opdata->shape1 = values[input1_id].shape;
+    opdata->shape2 = values[input2_id].shape;
+    opdata->inputs[0] = input1_id;
+    opdata->inputs[1] = input2_id;
+    opdata->outputs[0] = output_id;
+  }
+  return status;
+}
+
+static enum xnn_status reshape_batch_matrix_multiply_operator(
+  const struct xnn_node* node,
+  struct xnn_value* values,
+  size_t num_values,
+  struct xnn_operator_data* opdata)
+{
+  const uint32_t input1_id = node->inputs[0];
+  assert(input1_id != XNN_INVALID_VALUE_ID);
+  assert(input1_id < num_values);
+  const uint32_t input2_id = node->inputs[1];
+  assert(input2_id != XNN_INVALID_VALUE_ID);
+  assert(input2_id < num_values);
+
+  const uint32_t output_id = node->outputs[0];
+  assert(output_id != XNN_INVALID_VALUE_ID);
+  assert(output_id < num_values);
+
+  const struct xnn_shape* input1_shape = &values[input1_id].shape;
+  const struct xnn_shape* input2_shape = &values[input2_id].shape;
+  struct xnn_shape* output_shape = &values[output_id].shape;
+  const size_t num_dims = input1_shape->num_dims;
+  assert(input2_shape->num_dims == num_dims);
+  assert(output_shape->num_dims == num_dims);
+
+  for (size_t i = 0; i + 2 < num_dims; i++) {
+    if (input1_shape->dim[i] != input2_shape->dim[i]) {
+      xnn_log_error(
+        "failed to reshape %s operator with the first input ID #%" PRIu32 " and the second input ID #%" PRIu32
+        ": mismatching batch dimension #%zu (%zu vs %zu)",
+        xnn_node_type_to_string(xnn_node_type_batch_matrix_multiply), input1_id, input2_id,
+        i, input1_shape->dim[i], input2_shape->dim[i]);
+      return xnn_status_invalid_parameter;
+    }
+    output_shape->dim[i] = input1_shape->dim[i];
+  }
+
+  const bool transpose_b = (node->flags & XNN_FLAG_TRANSPOSE_B) != 0;
+  const size_t k1 = input1_shape->dim[num_dims - 1];
+  const size_t k2 = input2_shape->dim[transpose_b ? num_dims - 1 : num_dims - 2];
+  if (k1 != k2) {
+    xnn_log_error(
+      "failed to reshape %s operator with the first input ID #%" PRIu32 " and the second input ID #%" PRIu32
+      ": mismatching reduction dimension (%zu vs %zu)",
+      xnn_node_type_to_string(xnn_node_type_batch_matrix_multiply), input1_id, input2_id, k1, k2);
+    return xnn_status_invalid_parameter;
+  }
+  output_shape->dim[num_dims - 2] = input1_shape->dim[num_dims - 2];
+  output_shape->dim[num_dims - 1] = input2_shape->dim[transpose_b ? num_dims - 2 : num_dims - 1];
+
+  opdata->shape1 = *input1_shape;
+  opdata->shape2 = *input2_shape;
+  return xnn_status_success;
+}
+
+static enum xnn_status setup_batch_matrix_multiply_operator(
+  const struct xnn_operator_data* opdata,
+  const struct xnn_blob* blobs,
+  size_t num_blobs,
+  pthreadpool_t threadpool)
+{
+  const uint32_t input1_id = opdata->inputs[0];
+  assert(input1_id != XNN_INVALID_VALUE_ID);
+  assert(input1_id < num_blobs);
+
+  const uint32_t input2_id = opdata->inputs[1];
+  assert(input2_id != XNN_INVALID_VALUE_ID);
+  assert(input2_id < num_blobs);
+
+  const uint32_t output_id = opdata->outputs[0];
+  assert(output_id != XNN_INVALID_VALUE_ID);
+  assert(output_id < num_blobs);
+
+  const struct xnn_blob* input1_blob = blobs + input1_id;
+  const void* input1_data = input1_blob->data;
+  assert(input1_data != NULL);
+
+  const struct xnn_blob* input2_blob = blobs + input2_id;
+  const void* input2_data = input2_blob->data;
+  assert(input2_data != NULL);
+
+  const struct xnn_blob* output_blob = blobs + output_id;
+  void* output_data = output_blob->data;
+  assert(output_data != NULL);
+
+  const size_t num_dims = opdata->shape1.num_dims;
+  size_t batch_size = 1;
+  for (size_t i = 0; i + 2 < num_dims; i++) {
+    batch_size *= opdata->shape1.dim[i];
+  }
+  const size_t m = opdata->shape1.dim[num_dims - 2];
+  const size_t k = opdata->shape1.dim[num_dims - 1];
+  const size_t n = (opdata->operator_objects[0]->flags & XNN_FLAG_TRANSPOSE_B) ?
+    opdata->shape2.dim[num_dims - 2] : opdata->shape2.dim[num_dims - 1];
+
+  switch (opdata->operator_objects[0]->type) {
+    case xnn_operator_type_batch_matrix_multiply_nc_f32:
+      return xnn_setup_batch_matrix_multiply_nc_f32(
+        opdata->operator_objects[0],
+        batch_size, m, k, n,
+        input1_data, input2_data, output_data,
+        threadpool);
+    default:
+      XNN_UNREACHABLE;
+  }
+}
+
+static enum xnn_status check_dense_fp32_value(
+  uint32_t value_id,
+  const struct xnn_value* value,
+  const char* value_name)
+{
+  if (value->type != xnn_value_type_dense_tensor) {
+    xnn_log_error(
+      "failed to define %s operator with %s ID #%" PRIu32 ": unsupported Value type %d (expected dense tensor)",
+      xnn_node_type_to_string(xnn_node_type_batch_matrix_multiply), value_name, value_id, value->type);
+    return xnn_status_invalid_parameter;
+  }
+
+  if (value->datatype != xnn_datatype_fp32) {
+    xnn_log_error(
+      "failed to define %s operator with %s ID #%" PRIu32 ": unsupported Value datatype %s (%d)",
+      xnn_node_type_to_string(xnn_node_type_batch_matrix_multiply), value_name, value_id,
+      xnn_datatype_to_string(value->datatype), value->datatype);
+    return xnn_status_invalid_parameter;
+  }
+
+  return xnn_status_success;
+}
+
+enum xnn_status xnn_define_batch_matrix_multiply(
+  xnn_subgraph_t subgraph,
+  uint32_t input1_id,
+  uint32_t input2_id,
+  uint32_t output_id,
+  uint32_t flags)
+{
+  if ((xnn_params.init_flags & XNN_INIT_FLAG_XNNPACK) == 0) {
+    xnn_log_error("failed to define %s operator: XNNPACK is not initialized",
+      xnn_node_type_to_string(xnn_node_type_batch_matrix_multiply));
+    return xnn_status_uninitialized;
+  }
+
+  if (input1_id >= subgraph->num_values) {
+    xnn_log_error(
+      "failed to define %s operator with the first input ID #%" PRIu32 ": invalid Value ID",
+      xnn_node_type_to_string(xnn_node_type_batch_matrix_multiply), input1_id);
+    return xnn_status_invalid_parameter;
+  }
+
+  const struct xnn_value* input1_value = &subgraph->values[input1_id];
+  enum xnn_status status = check_dense_fp32_value(input1_id, input1_value, "the first input");
+  if (status != xnn_status_success) {
+    return status;
+  }
+
+  if (input2_id >= subgraph->num_values) {
+    xnn_log_error(
+      "failed to define %s operator with the second input ID #%" PRIu32 ": invalid Value ID",
+      xnn_node_type_to_string(xnn_node_type_batch_matrix_multiply), input2_id);
+    return xnn_status_invalid_parameter;
+  }
+
+  const struct xnn_value* input2_value = &subgraph->values[input2_id];
+  status = check_dense_fp32_value(input2_id, input2_value, "the second input");
+  if (status != xnn_status_success) {
+    return status;
+  }
+
+  if (output_id >= subgraph->num_values) {
+    xnn_log_error(
+      "failed to define %s operator with output ID #%" PRIu32 ": invalid Value ID",
+      xnn_node_type_to_string(xnn_node_type_batch_matrix_multiply), output_id);
+    return xnn_status_invalid_parameter;
+  }
+
+  const struct xnn_value* output_value = &subgraph->values[output_id];
+  status = check_dense_fp32_value(output_id, output_value, "output");
+  if (status != xnn_status_success) {
+    return status;
+  }
+
+  const size_t num_dims = input1_value->shape.num_dims;
+  if (num_dims < 2) {
+    xnn_log_error(
+      "failed to define %s operator with the first input ID #%" PRIu32 ": %zu-dimensional input is not a matrix",
+      xnn_node_type_to_string(xnn_node_type_batch_matrix_multiply), input1_id, num_dims);
+    return xnn_status_invalid_parameter;
+  }
+
+  if (input2_value->shape.num_dims != num_dims || output_value->shape.num_dims != num_dims) {
+    xnn_log_error(
+      "failed to define %s operator with the first input ID #%" PRIu32 ", the second input ID #%" PRIu32
+      ", and output ID #%" PRIu32 ": mismatching number of dimensions (%zu, %zu, and %zu)",
+      xnn_node_type_to_string(xnn_node_type_batch_matrix_multiply), input1_id, input2_id, output_id,
+      num_dims, input2_value->shape.num_dims, output_value->shape.num_dims);
+    return xnn_status_invalid_parameter;
+  }
+
+  for (size_t i = 0; i + 2 < num_dims; i++) {
+    if (input2_value->shape.dim[i] != input1_value->shape.dim[i] ||
+        output_value->shape.dim[i] != input1_value->shape.dim[i])
+    {
+      xnn_log_error(
+        "failed to define %s operator with the first input ID #%" PRIu32 ", the second input ID #%" PRIu32
+        ", and output ID #%" PRIu32 ": mismatching batch dimension #%zu (%zu, %zu, and %zu)",
+        xnn_node_type_to_string(xnn_node_type_batch_matrix_multiply), input1_id, input2_id, output_id,
+        i, input1_value->shape.dim[i], input2_value->shape.dim[i], output_value->shape.dim[i]);
+      return xnn_status_invalid_parameter;
+    }
+  }
+
+  const bool transpose_b = (flags & XNN_FLAG_TRANSPOSE_B) != 0;
+  const size_t m = input1_value->shape.dim[num_dims - 2];
+  const size_t k = input1_value->shape.dim[num_dims - 1];
+  const size_t input2_k = input2_value->shape.dim[transpose_b ? num_dims - 1 : num_dims - 2];
+  const size_t n = input2_value->shape.dim[transpose_b ? num_dims - 2 : num_dims - 1];
+  if (input2_k != k) {
+    xnn_log_error(
+      "failed to define %s operator with the first input ID #%" PRIu32 " and the second input ID #%" PRIu32
+      ": mismatching reduction dimension (%zu vs %zu)",
+      xnn_node_type_to_string(xnn_node_type_batch_matrix_multiply), input1_id, input2_id, k, input2_k);
+    return xnn_status_invalid_parameter;
+  }
+
+  if (output_value->shape.dim[num_dims - 2] != m || output_value->shape.dim[num_dims - 1] != n) {
+    xnn_log_error(
+      "failed to define %s operator with output ID #%" PRIu32
+      ": output matrix dimensions %zux%zu don't match product dimensions %zux%zu",
+      xnn_node_type_to_string(xnn_node_type_batch_matrix_multiply), output_id,
+      output_value->shape.dim[num_dims - 2], output_value->shape.dim[num_dims - 1], m, n);
+    return xnn_status_invalid_parameter;
+  }
+
+  struct xnn_node* node = xnn_subgraph_new_node(subgraph);
+  if (node == NULL) {
+    return xnn_status_out_of_memory;
+  }
+
+  node->type = xnn_node_type_batch_matrix_multiply;
+  node->compute_type = xnn_compute_type_fp32;
+  node->num_inputs = 2;
+  node->inputs[0] = input1_id;
+  node->inputs[1] = input2_id;
+  node->num_outputs = 1;
+  node->outputs[0] = output_id;
+  node->flags = flags;
+
+  node->create = create_batch_matrix_multiply_operator;
+  node->reshape = reshape_batch_matrix_multiply_operator;
+  node->setup = setup_batch_matrix_multiply_operator;
+
+  return xnn_status_success;
+}
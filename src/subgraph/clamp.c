@@ -17,7 +17,8 @@ static enum xnn_status create_clamp_operator(
   const struct xnn_node* node,
   const struct xnn_value* values,
   size_t num_values,
-  struct xnn_operator_data* opdata)
+  struct xnn_operator_data* opdata,
+  xnn_weights_cache_t weights_cache)
 {
   assert(node->num_inputs == 1);
   const uint32_t input_id = node->inputs[0];
@@ -40,7 +41,7 @@ static enum xnn_status create_clamp_operator(
         node->activation.output_min,
         node->activation.output_max,
         node->flags,
-        &opdata->operator_object);
+        &opdata->operator_objects[0]);
       break;
 #ifndef XNN_NO_S8_OPERATORS
     case xnn_compute_type_qs8:
@@ -56,7 +57,7 @@ static enum xnn_status create_clamp_operator(
         output_min,
         output_max,
         node->flags,
-        &opdata->operator_object);
+        &opdata->operator_objects[0]);
       break;
     }
 #endif  // !defined(XNN_NO_S8_OPERATORS)
@@ -74,7 +75,7 @@ static enum xnn_status create_clamp_operator(
         output_min,
         output_max,
         node->flags,
-        &opdata->operator_object);
+        &opdata->operator_objects[0]);
       break;
     }
 #endif  // !defined(XNN_NO_U8_OPERATORS)
@@ -111,10 +112,10 @@ static enum xnn_status setup_clamp_operator(
   void* output_data = output_blob->data;
   assert(output_data != NULL);
 
-  switch (opdata->operator_object->type) {
+  switch (opdata->operator_objects[0]->type) {
     case xnn_operator_type_clamp_nc_f32:
       return xnn_setup_clamp_nc_f32(
-        opdata->operator_object,
+        opdata->operator_objects[0],
         opdata->batch_size,
         input_data,
         output_data,
@@ -122,7 +123,7 @@ static enum xnn_status setup_clamp_operator(
 #ifndef XNN_NO_S8_OPERATORS
     case xnn_operator_type_clamp_nc_s8:
       return xnn_setup_clamp_nc_s8(
-        opdata->operator_object,
+        opdata->operator_objects[0],
         opdata->batch_size,
         input_data,
         output_data,
@@ -131,7 +132,7 @@ static enum xnn_status setup_clamp_operator(
 #ifndef XNN_NO_U8_OPERATORS
     case xnn_operator_type_clamp_nc_u8:
       return xnn_setup_clamp_nc_u8(
-        opdata->operator_object,
+        opdata->operator_objects[0],
         opdata->batch_size,
         input_data,
         output_data,
@@ -274,6 +275,8 @@ enum xnn_status xnn_define_clamp(
   node->flags = flags;
 
   node->create = create_clamp_operator;
+
+  node->reshape = xnn_reshape_unary_elementwise_nc;
   node->setup = setup_clamp_operator;
 
   return xnn_status_success;
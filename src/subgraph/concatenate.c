@@ -0,0 +1,391 @@
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <xnnpack.h>
+#include <xnnpack/log.h>
+#include <xnnpack/params.h>
+#include <xnnpack/subgraph.h>
+
+
+// Creates one Copy operator per input, which copies the input into its slice of every row of the output, where rows
+// span the dimensions starting from the axis.
+static enum xnn_status create_copy_operators(
+  const struct xnn_node* node,
+  const struct xnn_value* values,
+  struct xnn_operator_data* opdata)
+{
+  const size_t axis = node->params.concatenate.axis;
+  const struct xnn_shape* output_shape = &values[node->outputs[0]].shape;
+
+  size_t batch_size = 1;
+  for (size_t i = 0; i < axis; i++) {
+    batch_size *= output_shape->dim[i];
+  }
+
+  size_t output_stride = 0;
+  for (uint32_t i = 0; i < node->num_inputs; i++) {
+    const struct xnn_shape* input_shape = &values[node->inputs[i]].shape;
+    size_t channels = 1;
+    for (size_t j = axis; j < input_shape->num_dims; j++) {
+      channels *= input_shape->dim[j];
+    }
+    opdata->slice_channels[i] = channels;
+    output_stride += channels;
+  }
+
+  for (uint32_t i = 0; i < node->num_inputs; i++) {
+    if (opdata->operator_objects[i] != NULL) {
+      xnn_delete_operator(opdata->operator_objects[i]);
+      opdata->operator_objects[i] = NULL;
+    }
+
+    const size_t channels = opdata->slice_channels[i];
+    enum xnn_status status;
+    switch (node->compute_type) {
+      case xnn_compute_type_fp32:
+        status = xnn_create_copy_nc_x32(channels, channels, output_stride, node->flags, &opdata->operator_objects[i]);
+        break;
+#ifndef XNN_NO_QS8_OPERATORS
+      case xnn_compute_type_qs8:
+#endif  // !defined(XNN_NO_QS8_OPERATORS)
+#ifndef XNN_NO_QU8_OPERATORS
+      case xnn_compute_type_qu8:
+#endif  // !defined(XNN_NO_QU8_OPERATORS)
+#if !defined(XNN_NO_QS8_OPERATORS) || !defined(XNN_NO_QU8_OPERATORS)
+        status = xnn_create_copy_nc_x8(channels, channels, output_stride, node->flags, &opdata->operator_objects[i]);
+        break;
+#endif  // !defined(XNN_NO_QS8_OPERATORS) || !defined(XNN_NO_QU8_OPERATORS)
+      default:
+        XNN_UNREACHABLE;
+    }
+    if (status != xnn_status_success) {
+      return status;
+    }
+  }
+  opdata->batch_size = batch_size;
+  return xnn_status_success;
+}
+
+static enum xnn_status create_concatenate_operator(
+  const struct xnn_node* node,
+  const struct xnn_value* values,
+  size_t num_values,
+  struct xnn_operator_data* opdata,
+  xnn_weights_cache_t weights_cache)
+{
+  assert(node->num_inputs >= 2);
+  assert(node->num_inputs <= XNN_MAX_RUNTIME_INPUTS);
+  for (uint32_t i = 0; i < node->num_inputs; i++) {
+    const uint32_t input_id = node->inputs[i];
+    assert(input_id != XNN_INVALID_VALUE_ID);
+    assert(input_id < num_values);
+    opdata->inputs[i] = input_id;
+  }
+
+  assert(node->num_outputs == 1);
+  const uint32_t output_id = node->outputs[0];
+  assert(output_id != XNN_INVALID_VALUE_ID);
+  assert(output_id < num_values);
+  opdata->outputs[0] = output_id;
+
+  return create_copy_operators(node, values, opdata);
+}
+
+static enum xnn_status reshape_concatenate_operator(
+  const struct xnn_node* node,
+  struct xnn_value* values,
+  size_t num_values,
+  struct xnn_operator_data* opdata)
+{
+  const uint32_t output_id = node->outputs[0];
+  assert(output_id != XNN_INVALID_VALUE_ID);
+  assert(output_id < num_values);
+
+  const size_t axis = node->params.concatenate.axis;
+  const struct xnn_shape* input1_shape = &values[node->inputs[0]].shape;
+  struct xnn_shape* output_shape = &values[output_id].shape;
+  assert(output_shape->num_dims == input1_shape->num_dims);
+  for (size_t i = 0; i < input1_shape->num_dims; i++) {
+    output_shape->dim[i] = input1_shape->dim[i];
+  }
+  for (uint32_t i = 1; i < node->num_inputs; i++) {
+    const struct xnn_shape* input_shape = &values[node->inputs[i]].shape;
+    for (size_t j = 0; j < input_shape->num_dims; j++) {
+      if (j != axis && input_shape->dim[j] != output_shape->dim[j]) {
+        xnn_log_error(
+          "failed to reshape %s operator: dimension #%zu of input #%" PRIu32
+          " (%zu) doesn't match the first input (%zu)",
+          xnn_node_type_to_string(node->type), j, i + 1, input_shape->dim[j], output_shape->dim[j]);
+        return xnn_status_invalid_parameter;
+      }
+    }
+    output_shape->dim[axis] += input_shape->dim[axis];
+  }
+
+  return create_copy_operators(node, values, opdata);
+}
+
+static enum xnn_status setup_concatenate_operator(
+  const struct xnn_operator_data* opdata,
+  const struct xnn_blob* blobs,
+  size_t num_blobs,
+  pthreadpool_t threadpool)
+{
+  const uint32_t output_id = opdata->outputs[0];
+  assert(output_id != XNN_INVALID_VALUE_ID);
+  assert(output_id < num_blobs);
+
+  const struct xnn_blob* output_blob = blobs + output_id;
+  void* output_data = output_blob->data;
+  assert(output_data != NULL);
+
+  size_t channels_offset = 0;
+  for (size_t i = 0; i < XNN_MAX_OPERATOR_OBJECTS && opdata->operator_objects[i] != NULL; i++) {
+    const uint32_t input_id = opdata->inputs[i];
+    assert(input_id != XNN_INVALID_VALUE_ID);
+    assert(input_id < num_blobs);
+
+    const struct xnn_blob* input_blob = blobs + input_id;
+    const void* input_data = input_blob->data;
+    assert(input_data != NULL);
+
+    const xnn_operator_t copy_op = opdata->operator_objects[i];
+    enum xnn_status status;
+    switch (copy_op->type) {
+#if !defined(XNN_NO_QS8_OPERATORS) || !defined(XNN_NO_QU8_OPERATORS)
+      case xnn_operator_type_copy_nc_x8:
+      {
+        void* output_slice = (void*) ((uintptr_t) output_data + channels_offset * sizeof(uint8_t));
+        // The memory planner may place the input in its slice of the output: then its producer already wrote it there.
+        const size_t batch_size = opdata->batch_size == 1 && input_data == output_slice ? 0 : opdata->batch_size;
+        status = xnn_setup_copy_nc_x8(copy_op, batch_size, input_data, output_slice, threadpool);
+        break;
+      }
+#endif  // !defined(XNN_NO_QS8_OPERATORS) || !defined(XNN_NO_QU8_OPERATORS)
+      case xnn_operator_type_copy_nc_x32:
+      {
+        void* output_slice = (void*) ((uintptr_t) output_data + channels_offset * sizeof(uint32_t));
+        // The memory planner may place the input in its slice of the output: then its producer already wrote it there.
+        const size_t batch_size = opdata->batch_size == 1 && input_data == output_slice ? 0 : opdata->batch_size;
+        status = xnn_setup_copy_nc_x32(copy_op, batch_size, input_data, output_slice, threadpool);
+        break;
+      }
+      default:
+        XNN_UNREACHABLE;
+    }
+    if (status != xnn_status_success) {
+      return status;
+    }
+    channels_offset += opdata->slice_channels[i];
+  }
+  return xnn_status_success;
+}
+
+static enum xnn_status define_concatenate_n(
+  xnn_subgraph_t subgraph,
+  enum xnn_node_type node_type,
+  size_t axis,
+  size_t num_inputs,
+  const uint32_t* input_ids,
+  uint32_t output_id,
+  uint32_t flags)
+{
+  if ((xnn_params.init_flags & XNN_INIT_FLAG_XNNPACK) == 0) {
+    xnn_log_error("failed to define %s operator: XNNPACK is not initialized",
+      xnn_node_type_to_string(node_type));
+    return xnn_status_uninitialized;
+  }
+
+  if (output_id >= subgraph->num_values) {
+    xnn_log_error(
+      "failed to define %s operator with output ID #%" PRIu32 ": invalid Value ID",
+      xnn_node_type_to_string(node_type), output_id);
+    return xnn_status_invalid_parameter;
+  }
+
+  const struct xnn_value* output_value = &subgraph->values[output_id];
+  if (output_value->type != xnn_value_type_dense_tensor) {
+    xnn_log_error(
+      "failed to define %s operator with output ID #%" PRIu32 ": unsupported Value type %d (expected dense tensor)",
+      xnn_node_type_to_string(node_type), output_id, output_value->type);
+    return xnn_status_invalid_parameter;
+  }
+
+  enum xnn_compute_type compute_type = xnn_compute_type_invalid;
+  switch (output_value->datatype) {
+    case xnn_datatype_fp32:
+      compute_type = xnn_compute_type_fp32;
+      break;
+#ifndef XNN_NO_QS8_OPERATORS
+    case xnn_datatype_qint8:
+      compute_type = xnn_compute_type_qs8;
+      break;
+#endif  // !defined(XNN_NO_QS8_OPERATORS)
+#ifndef XNN_NO_QU8_OPERATORS
+    case xnn_datatype_quint8:
+      compute_type = xnn_compute_type_qu8;
+      break;
+#endif  // !defined(XNN_NO_QU8_OPERATORS)
+    default:
+      xnn_log_error(
+        "failed to define %s operator with output ID #%" PRIu32 ": unsupported Value datatype %s (%d)",
+        xnn_node_type_to_string(node_type), output_id,
+        xnn_datatype_to_string(output_value->datatype), output_value->datatype);
+      return xnn_status_invalid_parameter;
+  }
+
+  if (axis >= output_value->shape.num_dims) {
+    xnn_log_error(
+      "failed to define %s operator with the output ID #%" PRIu32
+      ": axis (%zu) exceeds the number of dimensions (%zu)",
+      xnn_node_type_to_string(node_type), output_id, axis, output_value->shape.num_dims);
+    return xnn_status_invalid_parameter;
+  }
+
+  size_t axis_dim = 0;
+  for (size_t i = 0; i < num_inputs; i++) {
+    const uint32_t input_id = input_ids[i];
+    if (input_id >= subgraph->num_values) {
+      xnn_log_error(
+        "failed to define %s operator with input #%zu ID #%" PRIu32 ": invalid Value ID",
+        xnn_node_type_to_string(node_type), i + 1, input_id);
+      return xnn_status_invalid_parameter;
+    }
+
+    const struct xnn_value* input_value = &subgraph->values[input_id];
+    if (input_value->type != xnn_value_type_dense_tensor) {
+      xnn_log_error(
+        "failed to define %s operator with input #%zu ID #%" PRIu32
+        ": unsupported Value type %d (expected dense tensor)",
+        xnn_node_type_to_string(node_type), i + 1, input_id, input_value->type);
+      return xnn_status_invalid_parameter;
+    }
+
+    if (input_value->datatype != output_value->datatype) {
+      xnn_log_error(
+        "failed to define %s operator with input #%zu ID #%" PRIu32 " and output ID #%" PRIu32
+        ": mismatching datatypes across input (%s) and output (%s)",
+        xnn_node_type_to_string(node_type), i + 1, input_id, output_id,
+        xnn_datatype_to_string(input_value->datatype),
+        xnn_datatype_to_string(output_value->datatype));
+      return xnn_status_invalid_parameter;
+    }
+
+#if !defined(XNN_NO_QU8_OPERATORS) || !defined(XNN_NO_QS8_OPERATORS)
+    if (compute_type == xnn_compute_type_qs8 || compute_type == xnn_compute_type_qu8) {
+      if (input_value->quantization.zero_point != output_value->quantization.zero_point) {
+        xnn_log_error(
+          "failed to define %s operator with input #%zu ID #%" PRIu32 " and output ID #%" PRIu32
+          ": mismatching zero point quantization parameter across input (%"PRId32") and output (%"PRId32")",
+          xnn_node_type_to_string(node_type), i + 1, input_id, output_id,
+          input_value->quantization.zero_point, output_value->quantization.zero_point);
+        return xnn_status_invalid_parameter;
+      }
+      if (input_value->quantization.scale != output_value->quantization.scale) {
+        xnn_log_error(
+          "failed to define %s operator with input #%zu ID #%" PRIu32 " and output ID #%" PRIu32
+          ": mismatching scale quantization parameter across input (%.7g) and output (%.7g)",
+          xnn_node_type_to_string(node_type), i + 1, input_id, output_id,
+          input_value->quantization.scale, output_value->quantization.scale);
+        return xnn_status_invalid_parameter;
+      }
+    }
+#endif  // !defined(XNN_NO_QU8_OPERATORS) || !defined(XNN_NO_QS8_OPERATORS)
+
+    if (input_value->shape.num_dims != output_value->shape.num_dims) {
+      xnn_log_error(
+        "failed to define %s operator with input #%zu ID #%" PRIu32 " and output ID #%" PRIu32
+        ": mismatching number of dimensions across input (%zu) and output (%zu)",
+        xnn_node_type_to_string(node_type), i + 1, input_id, output_id,
+        input_value->shape.num_dims, output_value->shape.num_dims);
+      return xnn_status_invalid_parameter;
+    }
+
+    for (size_t j = 0; j < output_value->shape.num_dims; j++) {
+      if (j != axis && input_value->shape.dim[j] != output_value->shape.dim[j]) {
+        xnn_log_error(
+          "failed to define %s operator with input #%zu ID #%" PRIu32 " and output ID #%" PRIu32
+          ": mismatching dimension #%zu across input (%zu) and output (%zu)",
+          xnn_node_type_to_string(node_type), i + 1, input_id, output_id,
+          j, input_value->shape.dim[j], output_value->shape.dim[j]);
+        return xnn_status_invalid_parameter;
+      }
+    }
+    axis_dim += input_value->shape.dim[axis];
+  }
+
+  if (axis_dim != output_value->shape.dim[axis]) {
+    xnn_log_error(
+      "failed to define %s operator with output ID #%" PRIu32
+      ": output dimension #%zu (%zu) doesn't match the sum of input dimensions (%zu)",
+      xnn_node_type_to_string(node_type), output_id, axis, output_value->shape.dim[axis], axis_dim);
+    return xnn_status_invalid_parameter;
+  }
+
+  struct xnn_node* node = xnn_subgraph_new_node(subgraph);
+  if (node == NULL) {
+    return xnn_status_out_of_memory;
+  }
+
+  node->params.concatenate.axis = axis;
+  node->type = node_type;
+  node->compute_type = compute_type;
+  node->num_inputs = (uint32_t) num_inputs;
+  for (size_t i = 0; i < num_inputs; i++) {
+    node->inputs[i] = input_ids[i];
+  }
+  node->num_outputs = 1;
+  node->outputs[0] = output_id;
+  node->flags = flags;
+
+  node->create = create_concatenate_operator;
+  node->reshape = reshape_concatenate_operator;
+  node->setup = setup_concatenate_operator;
+
+  return xnn_status_success;
+}
+
+enum xnn_status xnn_define_concatenate2(
+  xnn_subgraph_t subgraph,
+  size_t axis,
+  uint32_t input1_id,
+  uint32_t input2_id,
+  uint32_t output_id,
+  uint32_t flags)
+{
+  const uint32_t input_ids[2] = { input1_id, input2_id };
+  return define_concatenate_n(subgraph, xnn_node_type_concatenate2, axis, 2, input_ids, output_id, flags);
+}
+
+enum xnn_status xnn_define_concatenate3(
+  xnn_subgraph_t subgraph,
+  size_t axis,
+  uint32_t input1_id,
+  uint32_t input2_id,
+  uint32_t input3_id,
+  uint32_t output_id,
+  uint32_t flags)
+{
+  const uint32_t input_ids[3] = { input1_id, input2_id, input3_id };
+  return define_concatenate_n(subgraph, xnn_node_type_concatenate3, axis, 3, input_ids, output_id, flags);
+}
+
+enum xnn_status xnn_define_concatenate4(
+  xnn_subgraph_t subgraph,
+  size_t axis,
+  uint32_t input1_id,
+  uint32_t input2_id,
+  uint32_t input3_id,
+  uint32_t input4_id,
+  uint32_t output_id,
+  uint32_t flags)
+{
+  const uint32_t input_ids[4] = { input1_id, input2_id, input3_id, input4_id };
+  return define_concatenate_n(subgraph, xnn_node_type_concatenate4, axis, 4, input_ids, output_id, flags);
+}
@@ -18,7 +18,8 @@ static enum xnn_status create_convert_operator(
   const struct xnn_node* node,
   const struct xnn_value* values,
   size_t num_values,
-  struct xnn_operator_data* opdata)
+  struct xnn_operator_data* opdata,
+  xnn_weights_cache_t weights_cache)
 {
   assert(node->num_inputs == 1);
   const uint32_t input_id = node->inputs[0];
@@ -42,7 +43,7 @@ static enum xnn_status create_convert_operator(
         (int8_t) values[output_id].quantization.zero_point,
         INT8_MIN, INT8_MAX,
         node->flags,
-        &opdata->operator_object);
+        &opdata->operator_objects[0]);
       break;
     case xnn_compute_type_fp32_to_qu8:
       status = xnn_create_convert_nc_f32_qu8(
@@ -51,7 +52,7 @@ static enum xnn_status create_convert_operator(
         (uint8_t) values[output_id].quantization.zero_point,
         0, UINT8_MAX,
         node->flags,
-        &opdata->operator_object);
+        &opdata->operator_objects[0]);
       break;
     case xnn_compute_type_qs8_to_fp32:
       status = xnn_create_convert_nc_qs8_f32(
@@ -59,7 +60,7 @@ static enum xnn_status create_convert_operator(
         values[input_id].quantization.scale,
         (int8_t) values[input_id].quantization.zero_point,
         node->flags,
-        &opdata->operator_object);
+        &opdata->operator_objects[0]);
       break;
     case xnn_compute_type_qu8_to_fp32:
       status = xnn_create_convert_nc_qu8_f32(
@@ -67,7 +68,7 @@ static enum xnn_status create_convert_operator(
         values[input_id].quantization.scale,
         (uint8_t) values[input_id].quantization.zero_point,
         node->flags,
-        &opdata->operator_object);
+        &opdata->operator_objects[0]);
       break;
     default:
       XNN_UNREACHABLE;
@@ -102,31 +103,31 @@ static enum xnn_status setup_convert_operator(
   void* output_data = output_blob->data;
   assert(output_data != NULL);
 
-  switch (opdata->operator_object->type) {
+  switch (opdata->operator_objects[0]->type) {
     case xnn_operator_type_convert_nc_f32_qs8:
       return xnn_setup_convert_nc_f32_qs8(
-        opdata->operator_object,
+        opdata->operator_objects[0],
         opdata->batch_size,
         input_data,
         output_data,
         threadpool);
     case xnn_operator_type_convert_nc_f32_qu8:
       return xnn_setup_convert_nc_f32_qu8(
-        opdata->operator_object,
+        opdata->operator_objects[0],
         opdata->batch_size,
         input_data,
         output_data,
         threadpool);
     case xnn_operator_type_convert_nc_qs8_f32:
       return xnn_setup_convert_nc_qs8_f32(
-        opdata->operator_object,
+        opdata->operator_objects[0],
         opdata->batch_size,
         input_data,
         output_data,
         threadpool);
     case xnn_operator_type_convert_nc_qu8_f32:
       return xnn_setup_convert_nc_qu8_f32(
-        opdata->operator_object,
+        opdata->operator_objects[0],
         opdata->batch_size,
         input_data,
         output_data,
@@ -260,6 +261,8 @@ enum xnn_status xnn_define_convert(
   node->flags = flags;
 
   node->create = create_convert_operator;
+
+  node->reshape = xnn_reshape_unary_elementwise_nc;
   node->setup = setup_convert_operator;
 
   return xnn_status_success;
@@ -10,6 +10,7 @@
 #include <xnnpack.h>
 #include <xnnpack/common.h>
 #include <xnnpack/log.h>
+#include <xnnpack/math.h>
 #include <xnnpack/operator.h>
 #include <xnnpack/params.h>
 #include <xnnpack/subgraph.h>
@@ -19,7 +20,8 @@ static enum xnn_status create_deconvolution_operator(
   const struct xnn_node* node,
   const struct xnn_value* values,
   size_t num_values,
-  struct xnn_operator_data* opdata)
+  struct xnn_operator_data* opdata,
+  xnn_weights_cache_t weights_cache)
 {
   assert(node->num_inputs >= 2);
   assert(node->num_inputs <= 3);
@@ -74,7 +76,7 @@ static enum xnn_status create_deconvolution_operator(
           node->activation.output_min,
           node->activation.output_max,
           node->flags,
-          &opdata->operator_object);
+          &opdata->operator_objects[0]);
       break;
 #ifndef XNN_NO_QS8_OPERATORS
     case xnn_compute_type_qs8:
@@ -111,7 +113,7 @@ static enum xnn_status create_deconvolution_operator(
           output_min,
           output_max,
           node->flags,
-          &opdata->operator_object);
+          &opdata->operator_objects[0]);
       break;
     }
 #endif  // !defined(XNN_NO_QS8_OPERATORS)
@@ -151,7 +153,7 @@ static enum xnn_status create_deconvolution_operator(
           output_min,
           output_max,
           node->flags,
-          &opdata->operator_object);
+          &opdata->operator_objects[0]);
       break;
     }
 #endif  // !defined(XNN_NO_QU8_OPERATORS)
@@ -170,6 +172,58 @@ static enum xnn_status create_deconvolution_operator(
   return status;
 }
 
+static inline size_t compute_output_dimension(
+  size_t input_dimension,
+  size_t output_padding_dimension,
+  size_t adjustment_dimension,
+  size_t kernel_dimension,
+  size_t dilation_dimension,
+  size_t stride_dimension)
+{
+  const size_t effective_kernel_dimension = (kernel_dimension - 1) * dilation_dimension + 1;
+  return doz(
+    stride_dimension * (input_dimension - 1) + adjustment_dimension + effective_kernel_dimension,
+    output_padding_dimension);
+}
+
+static enum xnn_status reshape_deconvolution_operator(
+  const struct xnn_node* node,
+  struct xnn_value* values,
+  size_t num_values,
+  struct xnn_operator_data* opdata)
+{
+  const uint32_t input_id = node->inputs[0];
+  assert(input_id != XNN_INVALID_VALUE_ID);
+  assert(input_id < num_values);
+
+  const uint32_t output_id = node->outputs[0];
+  assert(output_id != XNN_INVALID_VALUE_ID);
+  assert(output_id < num_values);
+
+  const struct xnn_shape* input_shape = &values[input_id].shape;
+  struct xnn_shape* output_shape = &values[output_id].shape;
+  const size_t input_channels = node->params.deconvolution_2d.groups * node->params.deconvolution_2d.group_input_channels;
+  if (input_shape->dim[3] != input_channels) {
+    xnn_log_error(
+      "failed to reshape %s operator with input ID #%" PRIu32 ": number of channels can't change from %zu to %zu",
+      xnn_node_type_to_string(xnn_node_type_deconvolution_2d), input_id, input_channels, input_shape->dim[3]);
+    return xnn_status_invalid_parameter;
+  }
+
+  output_shape->dim[0] = input_shape->dim[0];
+  output_shape->dim[1] = compute_output_dimension(
+    input_shape->dim[1], node->params.deconvolution_2d.padding_top + node->params.deconvolution_2d.padding_bottom, node->params.deconvolution_2d.adjustment_height,
+    node->params.deconvolution_2d.kernel_height, node->params.deconvolution_2d.dilation_height, node->params.deconvolution_2d.upsampling_height);
+  output_shape->dim[2] = compute_output_dimension(
+    input_shape->dim[2], node->params.deconvolution_2d.padding_left + node->params.deconvolution_2d.padding_right, node->params.deconvolution_2d.adjustment_width,
+    node->params.deconvolution_2d.kernel_width, node->params.deconvolution_2d.dilation_width, node->params.deconvolution_2d.upsampling_width);
+
+  opdata->batch_size = input_shape->dim[0];
+  opdata->input_height = input_shape->dim[1];
+  opdata->input_width = input_shape->dim[2];
+  return xnn_status_success;
+}
+
 static enum xnn_status setup_deconvolution_operator(
   const struct xnn_operator_data* opdata,
   const struct xnn_blob* blobs,
@@ -192,10 +246,10 @@ static enum xnn_status setup_deconvolution_operator(
   void* output_data = output_blob->data;
   assert(output_data != NULL);
 
-  switch (opdata->operator_object->type) {
+  switch (opdata->operator_objects[0]->type) {
     case xnn_operator_type_deconvolution_nhwc_f32:
       return xnn_setup_deconvolution2d_nhwc_f32(
-          opdata->operator_object,
+          opdata->operator_objects[0],
           opdata->batch_size,
           opdata->input_height,
           opdata->input_width,
@@ -208,7 +262,7 @@ static enum xnn_status setup_deconvolution_operator(
 #ifndef XNN_NO_QS8_OPERATORS
     case xnn_operator_type_deconvolution_nhwc_qs8:
       return xnn_setup_deconvolution2d_nhwc_qs8(
-          opdata->operator_object,
+          opdata->operator_objects[0],
           opdata->batch_size,
           opdata->input_height,
           opdata->input_width,
@@ -222,7 +276,7 @@ static enum xnn_status setup_deconvolution_operator(
 #ifndef XNN_NO_QU8_OPERATORS
     case xnn_operator_type_deconvolution_nhwc_qu8:
       return xnn_setup_deconvolution2d_nhwc_qu8(
-          opdata->operator_object,
+          opdata->operator_objects[0],
           opdata->batch_size,
           opdata->input_height,
           opdata->input_width,
@@ -618,6 +672,8 @@ enum xnn_status xnn_define_deconvolution_2d(
   node->flags = flags;
 
   node->create = create_deconvolution_operator;
+
+  node->reshape = reshape_deconvolution_operator;
   node->setup = setup_deconvolution_operator;
 
   return xnn_status_success;
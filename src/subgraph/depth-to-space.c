@@ -16,7 +16,8 @@ static enum xnn_status create_depth_to_space_operator(
   const struct xnn_node* node,
   const struct xnn_value* values,
   size_t num_values,
-  struct xnn_operator_data* opdata)
+  struct xnn_operator_data* opdata,
+  xnn_weights_cache_t weights_cache)
 {
   assert(node->compute_type == xnn_compute_type_fp32);
 
@@ -42,7 +43,7 @@ static enum xnn_status create_depth_to_space_operator(
         output_channel_dim /* output stride */,
         node->params.depth_to_space.block_size,
         node->flags,
-        &opdata->operator_object);
+        &opdata->operator_objects[0]);
   } else {
     assert(values[input_id].layout == xnn_layout_type_nhwc);
     assert(values[output_id].layout == xnn_layout_type_nhwc);
@@ -52,7 +53,7 @@ static enum xnn_status create_depth_to_space_operator(
         output_channel_dim /* output stride */,
         node->params.depth_to_space.block_size,
         node->flags,
-        &opdata->operator_object);
+        &opdata->operator_objects[0]);
   }
   if (status == xnn_status_success) {
     opdata->batch_size = values[input_id].shape.dim[0];
@@ -66,6 +67,42 @@ static enum xnn_status create_depth_to_space_operator(
   return status;
 }
 
+static enum xnn_status reshape_depth_to_space_operator(
+  const struct xnn_node* node,
+  struct xnn_value* values,
+  size_t num_values,
+  struct xnn_operator_data* opdata)
+{
+  const uint32_t input_id = node->inputs[0];
+  assert(input_id != XNN_INVALID_VALUE_ID);
+  assert(input_id < num_values);
+
+  const uint32_t output_id = node->outputs[0];
+  assert(output_id != XNN_INVALID_VALUE_ID);
+  assert(output_id < num_values);
+
+  const struct xnn_shape* input_shape = &values[input_id].shape;
+  struct xnn_shape* output_shape = &values[output_id].shape;
+  const uint32_t block_size = node->params.depth_to_space.block_size;
+  if (input_shape->dim[3] != output_shape->dim[3] * block_size * block_size) {
+    xnn_log_error(
+      "failed to reshape %s operator with input ID #%" PRIu32 ": number of channels can't change from %zu to %zu",
+      xnn_node_type_to_string(xnn_node_type_depth_to_space), input_id, (size_t) output_shape->dim[3] * block_size * block_size, input_shape->dim[3]);
+    return xnn_status_invalid_parameter;
+  }
+
+  output_shape->dim[0] = input_shape->dim[0];
+  output_shape->dim[1] = input_shape->dim[1] * block_size;
+  output_shape->dim[2] = input_shape->dim[2] * block_size;
+
+  opdata->batch_size = input_shape->dim[0];
+  opdata->input_height = input_shape->dim[1];
+  opdata->input_width = input_shape->dim[2];
+  opdata->output_height = output_shape->dim[1];
+  opdata->output_width = output_shape->dim[2];
+  return xnn_status_success;
+}
+
 static enum xnn_status setup_depth_to_space_operator(
   const struct xnn_operator_data* opdata,
   const struct xnn_blob* blobs,
@@ -88,10 +125,10 @@ static enum xnn_status setup_depth_to_space_operator(
   void* output_data = output_blob->data;
   assert(output_data != NULL);
 
-  switch (opdata->operator_object->type) {
+  switch (opdata->operator_objects[0]->type) {
     case xnn_operator_type_depth_to_space_nchw2nhwc_x32:
       return xnn_setup_depth_to_space_nchw2nhwc_x32(
-          opdata->operator_object,
+          opdata->operator_objects[0],
           opdata->batch_size,
           opdata->input_height,
           opdata->input_width,
@@ -100,7 +137,7 @@ static enum xnn_status setup_depth_to_space_operator(
           threadpool);
     case xnn_operator_type_depth_to_space_nhwc_x32:
       return xnn_setup_depth_to_space_nhwc_x32(
-          opdata->operator_object,
+          opdata->operator_objects[0],
           opdata->batch_size,
           opdata->input_height,
           opdata->input_width,
@@ -199,6 +236,8 @@ enum xnn_status xnn_define_depth_to_space(
   node->flags = flags;
 
   node->create = create_depth_to_space_operator;
+
+  node->reshape = reshape_depth_to_space_operator;
   node->setup = setup_depth_to_space_operator;
 
   return xnn_status_success;
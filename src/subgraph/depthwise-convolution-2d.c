@@ -9,15 +9,18 @@
 
 #include <xnnpack.h>
 #include <xnnpack/log.h>
+#include <xnnpack/math.h>
 #include <xnnpack/params.h>
 #include <xnnpack/subgraph.h>
+#include <xnnpack/weights-cache.h>
 
 
 static enum xnn_status create_convolution_operator(
   const struct xnn_node* node,
   const struct xnn_value* values,
   size_t num_values,
-  struct xnn_operator_data* opdata)
+  struct xnn_operator_data* opdata,
+  xnn_weights_cache_t weights_cache)
 {
   assert(node->num_inputs >= 2);
   assert(node->num_inputs <= 3);
@@ -71,13 +74,13 @@ static enum xnn_status create_convolution_operator(
       node->activation.output_min,
       node->activation.output_max,
       node->flags | XNN_FLAG_DEPTHWISE_CONVOLUTION,
-      &opdata->operator_object);
+      &opdata->operator_objects[0]);
   } else {
     assert(values[input_id].layout == xnn_layout_type_nhwc);
     assert(values[output_id].layout == xnn_layout_type_nhwc);
     switch (node->compute_type) {
       case xnn_compute_type_fp32:
-        status = xnn_create_convolution2d_nhwc_f32(
+        status = xnn_create_convolution2d_nhwc_f32_with_cache(
           node->params.depthwise_convolution_2d.input_padding_top,
           node->params.depthwise_convolution_2d.input_padding_right,
           node->params.depthwise_convolution_2d.input_padding_bottom,
@@ -98,7 +101,8 @@ static enum xnn_status create_convolution_operator(
           node->activation.output_min,
           node->activation.output_max,
           node->flags | XNN_FLAG_DEPTHWISE_CONVOLUTION,
-          &opdata->operator_object);
+          weights_cache,
+          &opdata->operator_objects[0]);
         break;
 #ifndef XNN_NO_QS8_OPERATORS
       case xnn_compute_type_qs8:
@@ -109,7 +113,7 @@ static enum xnn_status create_convolution_operator(
           (int8_t) lrintf(fminf(fmaxf(node->activation.output_min / output_scale + (float) output_zero_point, -128.0f), 127.0f));
         const int8_t output_max =
           (int8_t) lrintf(fminf(fmaxf(node->activation.output_max / output_scale + (float) output_zero_point, -128.0f), 127.0f));
-        status = xnn_create_convolution2d_nhwc_qs8(
+        status = xnn_create_convolution2d_nhwc_qs8_with_cache(
           node->params.depthwise_convolution_2d.input_padding_top,
           node->params.depthwise_convolution_2d.input_padding_right,
           node->params.depthwise_convolution_2d.input_padding_bottom,
@@ -133,7 +137,8 @@ static enum xnn_status create_convolution_operator(
           (int8_t) output_zero_point,
           output_scale, output_min, output_max,
           node->flags | XNN_FLAG_DEPTHWISE_CONVOLUTION,
-          &opdata->operator_object);
+          weights_cache,
+          &opdata->operator_objects[0]);
         break;
       }
       case xnn_compute_type_qc8:
@@ -144,7 +149,7 @@ static enum xnn_status create_convolution_operator(
           (int8_t) lrintf(fminf(fmaxf(node->activation.output_min / output_scale + (float) output_zero_point, -128.0f), 127.0f));
         const int8_t output_max =
           (int8_t) lrintf(fminf(fmaxf(node->activation.output_max / output_scale + (float) output_zero_point, -128.0f), 127.0f));
-        status = xnn_create_convolution2d_nhwc_qc8(
+        status = xnn_create_convolution2d_nhwc_qc8_with_cache(
           node->params.depthwise_convolution_2d.input_padding_top,
           node->params.depthwise_convolution_2d.input_padding_right,
           node->params.depthwise_convolution_2d.input_padding_bottom,
@@ -168,7 +173,8 @@ static enum xnn_status create_convolution_operator(
           (int8_t) output_zero_point,
           output_scale, output_min, output_max,
           node->flags | XNN_FLAG_DEPTHWISE_CONVOLUTION,
-          &opdata->operator_object);
+          weights_cache,
+          &opdata->operator_objects[0]);
         break;
       }
 #endif  // !defined(XNN_NO_QS8_OPERATORS)
@@ -181,7 +187,7 @@ static enum xnn_status create_convolution_operator(
           (uint8_t) lrintf(fminf(fmaxf(node->activation.output_min / output_scale + (float) output_zero_point, 0.0f), 255.0f));
         const uint8_t output_max =
           (uint8_t) lrintf(fminf(fmaxf(node->activation.output_max / output_scale + (float) output_zero_point, 0.0f), 255.0f));
-        status = xnn_create_convolution2d_nhwc_qu8(
+        status = xnn_create_convolution2d_nhwc_qu8_with_cache(
           node->params.depthwise_convolution_2d.input_padding_top,
           node->params.depthwise_convolution_2d.input_padding_right,
           node->params.depthwise_convolution_2d.input_padding_bottom,
@@ -206,7 +212,8 @@ static enum xnn_status create_convolution_operator(
           (uint8_t) output_zero_point,
           output_scale, output_min, output_max,
           node->flags | XNN_FLAG_DEPTHWISE_CONVOLUTION,
-          &opdata->operator_object);
+          weights_cache,
+          &opdata->operator_objects[0]);
         break;
       }
 #endif  // !defined(XNN_NO_QU8_OPERATORS)
@@ -224,6 +231,63 @@ static enum xnn_status create_convolution_operator(
   return status;
 }
 
+static inline size_t compute_output_dimension(
+  size_t padded_input_dimension,
+  size_t kernel_dimension,
+  size_t dilation_dimension,
+  size_t subsampling_dimension)
+{
+  const size_t effective_kernel_dimension = (kernel_dimension - 1) * dilation_dimension + 1;
+  return doz(padded_input_dimension, effective_kernel_dimension) / subsampling_dimension + 1;
+}
+
+static enum xnn_status reshape_convolution_operator(
+  const struct xnn_node* node,
+  struct xnn_value* values,
+  size_t num_values,
+  struct xnn_operator_data* opdata)
+{
+  const uint32_t input_id = node->inputs[0];
+  assert(input_id != XNN_INVALID_VALUE_ID);
+  assert(input_id < num_values);
+
+  const uint32_t output_id = node->outputs[0];
+  assert(output_id != XNN_INVALID_VALUE_ID);
+  assert(output_id < num_values);
+
+  const struct xnn_shape* input_shape = &values[input_id].shape;
+  struct xnn_shape* output_shape = &values[output_id].shape;
+  const size_t input_channels = node->params.depthwise_convolution_2d.input_channels;
+  if (input_shape->dim[3] != input_channels) {
+    xnn_log_error(
+      "failed to reshape %s operator with input ID #%" PRIu32 ": number of channels can't change from %zu to %zu",
+      xnn_node_type_to_string(xnn_node_type_depthwise_convolution_2d), input_id, input_channels, input_shape->dim[3]);
+    return xnn_status_invalid_parameter;
+  }
+
+  output_shape->dim[0] = input_shape->dim[0];
+  if (node->flags & XNN_FLAG_TENSORFLOW_SAME_PADDING) {
+    output_shape->dim[1] = divide_round_up(input_shape->dim[1], node->params.depthwise_convolution_2d.subsampling_height);
+    output_shape->dim[2] = divide_round_up(input_shape->dim[2], node->params.depthwise_convolution_2d.subsampling_width);
+  } else {
+    output_shape->dim[1] = compute_output_dimension(
+      node->params.depthwise_convolution_2d.input_padding_top + input_shape->dim[1] +
+        node->params.depthwise_convolution_2d.input_padding_bottom,
+      node->params.depthwise_convolution_2d.kernel_height, node->params.depthwise_convolution_2d.dilation_height,
+      node->params.depthwise_convolution_2d.subsampling_height);
+    output_shape->dim[2] = compute_output_dimension(
+      node->params.depthwise_convolution_2d.input_padding_left + input_shape->dim[2] +
+        node->params.depthwise_convolution_2d.input_padding_right,
+      node->params.depthwise_convolution_2d.kernel_width, node->params.depthwise_convolution_2d.dilation_width,
+      node->params.depthwise_convolution_2d.subsampling_width);
+  }
+
+  opdata->batch_size = input_shape->dim[0];
+  opdata->input_height = input_shape->dim[1];
+  opdata->input_width = input_shape->dim[2];
+  return xnn_status_success;
+}
+
 static enum xnn_status setup_convolution_operator(
   const struct xnn_operator_data* opdata,
   const struct xnn_blob* blobs,
@@ -246,10 +310,10 @@ static enum xnn_status setup_convolution_operator(
   void* output_data = output_blob->data;
   assert(output_data != NULL);
 
-  switch (opdata->operator_object->type) {
+  switch (opdata->operator_objects[0]->type) {
     case xnn_operator_type_convolution_nchw_f32:
       return xnn_setup_convolution2d_nchw_f32(
-        opdata->operator_object,
+        opdata->operator_objects[0],
         opdata->batch_size,
         opdata->input_height,
         opdata->input_width,
@@ -259,7 +323,7 @@ static enum xnn_status setup_convolution_operator(
       break;
     case xnn_operator_type_convolution_nhwc_f32:
       return xnn_setup_convolution2d_nhwc_f32(
-        opdata->operator_object,
+        opdata->operator_objects[0],
         opdata->batch_size,
         opdata->input_height,
         opdata->input_width,
@@ -270,7 +334,7 @@ static enum xnn_status setup_convolution_operator(
 #ifndef XNN_NO_QS8_OPERATORS
     case xnn_operator_type_convolution_nhwc_qc8:
       return xnn_setup_convolution2d_nhwc_qc8(
-        opdata->operator_object,
+        opdata->operator_objects[0],
         opdata->batch_size,
         opdata->input_height,
         opdata->input_width,
@@ -280,7 +344,7 @@ static enum xnn_status setup_convolution_operator(
       break;
     case xnn_operator_type_convolution_nhwc_qs8:
       return xnn_setup_convolution2d_nhwc_qs8(
-        opdata->operator_object,
+        opdata->operator_objects[0],
         opdata->batch_size,
         opdata->input_height,
         opdata->input_width,
@@ -292,7 +356,7 @@ static enum xnn_status setup_convolution_operator(
 #ifndef XNN_NO_QU8_OPERATORS
     case xnn_operator_type_convolution_nhwc_qu8:
       return xnn_setup_convolution2d_nhwc_qu8(
-        opdata->operator_object,
+        opdata->operator_objects[0],
         opdata->batch_size,
         opdata->input_height,
         opdata->input_width,
@@ -740,6 +804,8 @@ enum xnn_status xnn_define_depthwise_convolution_2d(
   node->flags = flags;
 
   node->create = create_convolution_operator;
+
+  node->reshape = reshape_convolution_operator;
   node->setup = setup_convolution_operator;
 
   return xnn_status_success;
@@ -18,7 +18,8 @@ static enum xnn_status create_divide_operator(
   const struct xnn_node* node,
   const struct xnn_value* values,
   size_t num_values,
-  struct xnn_operator_data* opdata)
+  struct xnn_operator_data* opdata,
+  xnn_weights_cache_t weights_cache)
 {
   assert(node->compute_type == xnn_compute_type_fp32);
 
@@ -39,7 +40,7 @@ static enum xnn_status create_divide_operator(
     node->activation.output_min,
     node->activation.output_max,
     node->flags,
-    &opdata->operator_object);
+    &opdata->operator_objects[0]);
   if (status == xnn_status_success) {
     opdata->shape1.num_dims = values[input1_id].shape.num_dims;
     opdata->shape2.num_dims = values[input2_id].shape.num_dims;
@@ -101,7 +102,7 @@ static enum xnn_status setup_divide_operator(
   assert(output_data != NULL);
 
   return xnn_setup_divide_nd_f32(
-    opdata->operator_object,
+    opdata->operator_objects[0],
     opdata->shape1.num_dims,
     opdata->shape1.dim,
     opdata->shape2.num_dims,
@@ -241,6 +242,8 @@ enum xnn_status xnn_define_divide(
   node->flags = flags;
 
   node->create = create_divide_operator;
+
+  node->reshape = xnn_reshape_binary_elementwise_nd;
   node->setup = setup_divide_operator;
 
   return xnn_status_success;
@@ -0,0 +1,403 @@
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <xnnpack.h>
+#include <xnnpack/log.h>
+#include <xnnpack/params.h>
+#include <xnnpack/subgraph.h>
+
+
+// Creates one Copy operator per output, which copies the slice of every row of the input into the output, where rows
+// span the dimensions starting from the axis.
+static enum xnn_status create_copy_operators(
+  const struct xnn_node* node,
+  const struct xnn_value* values,
+  struct xnn_operator_data* opdata)
+{
+  const size_t axis = node->params.even_split.axis;
+  const struct xnn_shape* input_shape = &values[node->inputs[0]].shape;
+
+  size_t batch_size = 1;
+  for (size_t i = 0; i < axis; i++) {
+    batch_size *= input_shape->dim[i];
+  }
+  size_t input_stride = 1;
+  for (size_t i = axis; i < input_shape->num_dims; i++) {
+    input_stride *= input_shape->dim[i];
+  }
+  const size_t channels = input_stride / node->num_outputs;
+
+  for (size_t i = 0; i < XNN_MAX_OPERATOR_OBJECTS; i++) {
+    if (opdata->operator_objects[i] != NULL) {
+      xnn_delete_operator(opdata->operator_objects[i]);
+      opdata->operator_objects[i] = NULL;
+    }
+  }
+
+  // Copy operators are created only for the outputs that are used, and are packed in the beginning of the array.
+  size_t num_operators = 0;
+  for (uint32_t i = 0; i < node->num_outputs; i++) {
+    opdata->slice_channels[i] = channels;
+    if (opdata->outputs[i] == XNN_INVALID_VALUE_ID) {
+      continue;
+    }
+
+    xnn_operator_t* copy_op = &opdata->operator_objects[num_operators++];
+    enum xnn_status status;
+    switch (node->compute_type) {
+      case xnn_compute_type_fp32:
+        status = xnn_create_copy_nc_x32(channels, input_stride, channels, node->flags, copy_op);
+        break;
+#ifndef XNN_NO_QS8_OPERATORS
+      case xnn_compute_type_qs8:
+#endif  // !defined(XNN_NO_QS8_OPERATORS)
+#ifndef XNN_NO_QU8_OPERATORS
+      case xnn_compute_type_qu8:
+#endif  // !defined(XNN_NO_QU8_OPERATORS)
+#if !defined(XNN_NO_QS8_OPERATORS) || !defined(XNN_NO_QU8_OPERATORS)
+        status = xnn_create_copy_nc_x8(channels, input_stride, channels, node->flags, copy_op);
+        break;
+#endif  // !defined(XNN_NO_QS8_OPERATORS) || !defined(XNN_NO_QU8_OPERATORS)
+      default:
+        XNN_UNREACHABLE;
+    }
+    if (status != xnn_status_success) {
+      return status;
+    }
+  }
+  opdata->batch_size = batch_size;
+  return xnn_status_success;
+}
+
+static enum xnn_status create_even_split_operator(
+  const struct xnn_node* node,
+  const struct xnn_value* values,
+  size_t num_values,
+  struct xnn_operator_data* opdata,
+  xnn_weights_cache_t weights_cache)
+{
+  assert(node->num_inputs == 1);
+  const uint32_t input_id = node->inputs[0];
+  assert(input_id != XNN_INVALID_VALUE_ID);
+  assert(input_id < num_values);
+  opdata->inputs[0] = input_id;
+
+  assert(node->num_outputs >= 2);
+  assert(node->num_outputs <= XNN_MAX_RUNTIME_OUTPUTS);
+  for (uint32_t i = 0; i < node->num_outputs; i++) {
+    const uint32_t output_id = node->outputs[i];
+    assert(output_id != XNN_INVALID_VALUE_ID);
+    assert(output_id < num_values);
+    // Outputs without consumers are cleared during Subgraph optimization, and are neither allocated nor computed.
+    opdata->outputs[i] = values[output_id].type == xnn_value_type_invalid ? XNN_INVALID_VALUE_ID : output_id;
+  }
+
+  return create_copy_operators(node, values, opdata);
+}
+
+static enum xnn_status reshape_even_split_operator(
+  const struct xnn_node* node,
+  struct xnn_value* values,
+  size_t num_values,
+  struct xnn_operator_data* opdata)
+{
+  const uint32_t input_id = node->inputs[0];
+  assert(input_id != XNN_INVALID_VALUE_ID);
+  assert(input_id < num_values);
+
+  const size_t axis = node->params.even_split.axis;
+  const struct xnn_shape* input_shape = &values[input_id].shape;
+  if (input_shape->dim[axis] % node->num_outputs != 0) {
+    xnn_log_error(
+      "failed to reshape %s operator: dimension #%zu of the input (%zu) is not divisible by the number of outputs (%"
+      PRIu32 ")",
+      xnn_node_type_to_string(node->type), axis, input_shape->dim[axis], node->num_outputs);
+    return xnn_status_invalid_parameter;
+  }
+
+  for (uint32_t i = 0; i < node->num_outputs; i++) {
+    const uint32_t output_id = opdata->outputs[i];
+    if (output_id == XNN_INVALID_VALUE_ID) {
+      continue;
+    }
+    assert(output_id < num_values);
+    struct xnn_shape* output_shape = &values[output_id].shape;
+    assert(output_shape->num_dims == input_shape->num_dims);
+    for (size_t j = 0; j < input_shape->num_dims; j++) {
+      output_shape->dim[j] = input_shape->dim[j];
+    }
+    output_shape->dim[axis] = input_shape->dim[axis] / node->num_outputs;
+  }
+
+  return create_copy_operators(node, values, opdata);
+}
+
+static enum xnn_status setup_even_split_operator(
+  const struct xnn_operator_data* opdata,
+  const struct xnn_blob* blobs,
+  size_t num_blobs,
+  pthreadpool_t threadpool)
+{
+  const uint32_t input_id = opdata->inputs[0];
+  assert(input_id != XNN_INVALID_VALUE_ID);
+  assert(input_id < num_blobs);
+
+  const struct xnn_blob* input_blob = blobs + input_id;
+  const void* input_data = input_blob->data;
+  assert(input_data != NULL);
+
+  size_t channels_offset = 0;
+  size_t num_operators = 0;
+  for (size_t i = 0; i < XNN_MAX_OPERATOR_OBJECTS && opdata->slice_channels[i] != 0; i++) {
+    const uint32_t output_id = opdata->outputs[i];
+    if (output_id == XNN_INVALID_VALUE_ID) {
+      channels_offset += opdata->slice_channels[i];
+      continue;
+    }
+    assert(output_id < num_blobs);
+
+    const struct xnn_blob* output_blob = blobs + output_id;
+    void* output_data = output_blob->data;
+    assert(output_data != NULL);
+
+    const xnn_operator_t copy_op = opdata->operator_objects[num_operators++];
+    assert(copy_op != NULL);
+    enum xnn_status status;
+    switch (copy_op->type) {
+#if !defined(XNN_NO_QS8_OPERATORS) || !defined(XNN_NO_QU8_OPERATORS)
+      case xnn_operator_type_copy_nc_x8:
+      {
+        const void* input_slice = (const void*) ((uintptr_t) input_data + channels_offset * sizeof(uint8_t));
+        // The memory planner may place the output in its slice of the input: then it is a view of the input.
+        const size_t batch_size = opdata->batch_size == 1 && output_data == input_slice ? 0 : opdata->batch_size;
+        status = xnn_setup_copy_nc_x8(copy_op, batch_size, input_slice, output_data, threadpool);
+        break;
+      }
+#endif  // !defined(XNN_NO_QS8_OPERATORS) || !defined(XNN_NO_QU8_OPERATORS)
+      case xnn_operator_type_copy_nc_x32:
+      {
+        const void* input_slice = (const void*) ((uintptr_t) input_data + channels_offset * sizeof(uint32_t));
+        // The memory planner may place the output in its slice of the input: then it is a view of the input.
+        const size_t batch_size = opdata->batch_size == 1 && output_data == input_slice ? 0 : opdata->batch_size;
+        status = xnn_setup_copy_nc_x32(copy_op, batch_size, input_slice, output_data, threadpool);
+        break;
+      }
+      default:
+        XNN_UNREACHABLE;
+    }
+    if (status != xnn_status_success) {
+      return status;
+    }
+    channels_offset += opdata->slice_channels[i];
+  }
+  return xnn_status_success;
+}
+
+static enum xnn_status define_even_split_n(
+  xnn_subgraph_t subgraph,
+  enum xnn_node_type node_type,
+  size_t split_dim,
+  uint32_t input_id,
+  size_t num_outputs,
+  const uint32_t* output_ids,
+  uint32_t flags)
+{
+  if ((xnn_params.init_flags & XNN_INIT_FLAG_XNNPACK) == 0) {
+    xnn_log_error("failed to define %s operator: XNNPACK is not initialized",
+      xnn_node_type_to_string(node_type));
+    return xnn_status_uninitialized;
+  }
+
+  if (input_id >= subgraph->num_values) {
+    xnn_log_error(
+      "failed to define %s operator with input ID #%" PRIu32 ": invalid Value ID",
+      xnn_node_type_to_string(node_type), input_id);
+    return xnn_status_invalid_parameter;
+  }
+
+  const struct xnn_value* input_value = &subgraph->values[input_id];
+  if (input_value->type != xnn_value_type_dense_tensor) {
+    xnn_log_error(
+      "failed to define %s operator with input ID #%" PRIu32 ": unsupported Value type %d (expected dense tensor)",
+      xnn_node_type_to_string(node_type), input_id, input_value->type);
+    return xnn_status_invalid_parameter;
+  }
+
+  enum xnn_compute_type compute_type = xnn_compute_type_invalid;
+  switch (input_value->datatype) {
+    case xnn_datatype_fp32:
+      compute_type = xnn_compute_type_fp32;
+      break;
+#ifndef XNN_NO_QS8_OPERATORS
+    case xnn_datatype_qint8:
+      compute_type = xnn_compute_type_qs8;
+      break;
+#endif  // !defined(XNN_NO_QS8_OPERATORS)
+#ifndef XNN_NO_QU8_OPERATORS
+    case xnn_datatype_quint8:
+      compute_type = xnn_compute_type_qu8;
+      break;
+#endif  // !defined(XNN_NO_QU8_OPERATORS)
+    default:
+      xnn_log_error(
+        "failed to define %s operator with input ID #%" PRIu32 ": unsupported Value datatype %s (%d)",
+        xnn_node_type_to_string(node_type), input_id,
+        xnn_datatype_to_string(input_value->datatype), input_value->datatype);
+      return xnn_status_invalid_parameter;
+  }
+
+  if (split_dim >= input_value->shape.num_dims) {
+    xnn_log_error(
+      "failed to define %s operator with the input ID #%" PRIu32
+      ": split dimension (%zu) exceeds the number of dimensions (%zu)",
+      xnn_node_type_to_string(node_type), input_id, split_dim, input_value->shape.num_dims);
+    return xnn_status_invalid_parameter;
+  }
+
+  if (input_value->shape.dim[split_dim] % num_outputs != 0) {
+    xnn_log_error(
+      "failed to define %s operator with the input ID #%" PRIu32
+      ": split dimension #%zu (%zu) is not divisible by the number of outputs (%zu)",
+      xnn_node_type_to_string(node_type), input_id, split_dim, input_value->shape.dim[split_dim], num_outputs);
+    return xnn_status_invalid_parameter;
+  }
+
+  for (size_t i = 0; i < num_outputs; i++) {
+    const uint32_t output_id = output_ids[i];
+    if (output_id >= subgraph->num_values) {
+      xnn_log_error(
+        "failed to define %s operator with output #%zu ID #%" PRIu32 ": invalid Value ID",
+        xnn_node_type_to_string(node_type), i + 1, output_id);
+      return xnn_status_invalid_parameter;
+    }
+
+    const struct xnn_value* output_value = &subgraph->values[output_id];
+    if (output_value->type != xnn_value_type_dense_tensor) {
+      xnn_log_error(
+        "failed to define %s operator with output #%zu ID #%" PRIu32
+        ": unsupported Value type %d (expected dense tensor)",
+        xnn_node_type_to_string(node_type), i + 1, output_id, output_value->type);
+      return xnn_status_invalid_parameter;
+    }
+
+    if (output_value->datatype != input_value->datatype) {
+      xnn_log_error(
+        "failed to define %s operator with input ID #%" PRIu32 " and output #%zu ID #%" PRIu32
+        ": mismatching datatypes across input (%s) and output (%s)",
+        xnn_node_type_to_string(node_type), input_id, i + 1, output_id,
+        xnn_datatype_to_string(input_value->datatype),
+        xnn_datatype_to_string(output_value->datatype));
+      return xnn_status_invalid_parameter;
+    }
+
+#if !defined(XNN_NO_QU8_OPERATORS) || !defined(XNN_NO_QS8_OPERATORS)
+    if (compute_type == xnn_compute_type_qs8 || compute_type == xnn_compute_type_qu8) {
+      if (input_value->quantization.zero_point != output_value->quantization.zero_point) {
+        xnn_log_error(
+          "failed to define %s operator with input ID #%" PRIu32 " and output #%zu ID #%" PRIu32
+          ": mismatching zero point quantization parameter across input (%"PRId32") and output (%"PRId32")",
+          xnn_node_type_to_string(node_type), input_id, i + 1, output_id,
+          input_value->quantization.zero_point, output_value->quantization.zero_point);
+        return xnn_status_invalid_parameter;
+      }
+      if (input_value->quantization.scale != output_value->quantization.scale) {
+        xnn_log_error(
+          "failed to define %s operator with input ID #%" PRIu32 " and output #%zu ID #%" PRIu32
+          ": mismatching scale quantization parameter across input (%.7g) and output (%.7g)",
+          xnn_node_type_to_string(node_type), input_id, i + 1, output_id,
+          input_value->quantization.scale, output_value->quantization.scale);
+        return xnn_status_invalid_parameter;
+      }
+    }
+#endif  // !defined(XNN_NO_QU8_OPERATORS) || !defined(XNN_NO_QS8_OPERATORS)
+
+    if (output_value->shape.num_dims != input_value->shape.num_dims) {
+      xnn_log_error(
+        "failed to define %s operator with input ID #%" PRIu32 " and output #%zu ID #%" PRIu32
+        ": mismatching number of dimensions across input (%zu) and output (%zu)",
+        xnn_node_type_to_string(node_type), input_id, i + 1, output_id,
+        input_value->shape.num_dims, output_value->shape.num_dims);
+      return xnn_status_invalid_parameter;
+    }
+
+    for (size_t j = 0; j < input_value->shape.num_dims; j++) {
+      const size_t expected_dim =
+        j == split_dim ? input_value->shape.dim[j] / num_outputs : input_value->shape.dim[j];
+      if (output_value->shape.dim[j] != expected_dim) {
+        xnn_log_error(
+          "failed to define %s operator with input ID #%" PRIu32 " and output #%zu ID #%" PRIu32
+          ": output dimension #%zu (%zu) doesn't match the expected dimension (%zu)",
+          xnn_node_type_to_string(node_type), input_id, i + 1, output_id,
+          j, output_value->shape.dim[j], expected_dim);
+        return xnn_status_invalid_parameter;
+      }
+    }
+  }
+
+  struct xnn_node* node = xnn_subgraph_new_node(subgraph);
+  if (node == NULL) {
+    return xnn_status_out_of_memory;
+  }
+
+  node->params.even_split.axis = split_dim;
+  node->type = node_type;
+  node->compute_type = compute_type;
+  node->num_inputs = 1;
+  node->inputs[0] = input_id;
+  node->num_outputs = (uint32_t) num_outputs;
+  for (size_t i = 0; i < num_outputs; i++) {
+    node->outputs[i] = output_ids[i];
+  }
+  node->flags = flags;
+
+  node->create = create_even_split_operator;
+  node->reshape = reshape_even_split_operator;
+  node->setup = setup_even_split_operator;
+
+  return xnn_status_success;
+}
+
+enum xnn_status xnn_define_even_split2(
+  xnn_subgraph_t subgraph,
+  size_t split_dim,
+  uint32_t input_id,
+  uint32_t output1_id,
+  uint32_t output2_id,
+  uint32_t flags)
+{
+  const uint32_t output_ids[2] = { output1_id, output2_id };
+  return define_even_split_n(subgraph, xnn_node_type_even_split2, split_dim, input_id, 2, output_ids, flags);
+}
+
+enum xnn_status xnn_define_even_split3(
+  xnn_subgraph_t subgraph,
+  size_t split_dim,
+  uint32_t input_id,
+  uint32_t output1_id,
+  uint32_t output2_id,
+  uint32_t output3_id,
+  uint32_t flags)
+{
+  const uint32_t output_ids[3] = { output1_id, output2_id, output3_id };
+  return define_even_split_n(subgraph, xnn_node_type_even_split3, split_dim, input_id, 3, output_ids, flags);
+}
+
+enum xnn_status xnn_define_even_split4(
+  xnn_subgraph_t subgraph,
+  size_t split_dim,
+  uint32_t input_id,
+  uint32_t output1_id,
+  uint32_t output2_id,
+  uint32_t output3_id,
+  uint32_t output4_id,
+  uint32_t flags)
+{
+  const uint32_t output_ids[4] = { output1_id, output2_id, output3_id, output4_id };
+  return define_even_split_n(subgraph, xnn_node_type_even_split4, split_dim, input_id, 4, output_ids, flags);
+}
@@ -17,7 +17,8 @@ static enum xnn_status create_floor_operator(
   const struct xnn_node* node,
   const struct xnn_value* values,
   size_t num_values,
-  struct xnn_operator_data* opdata)
+  struct xnn_operator_data* opdata,
+  xnn_weights_cache_t weights_cache)
 {
   assert(node->compute_type == xnn_compute_type_fp32);
 
@@ -37,7 +38,7 @@ static enum xnn_status create_floor_operator(
   const enum xnn_status status = xnn_create_floor_nc_f32(
     channel_dim /* channels */, channel_dim /* input stride */, channel_dim /* output stride */,
     node->flags,
-    &opdata->operator_object);
+    &opdata->operator_objects[0]);
   if (status == xnn_status_success) {
     opdata->batch_size = xnn_shape_multiply_non_channel_dims(&values[input_id].shape);
     opdata->inputs[0] = input_id;
@@ -69,7 +70,7 @@ static enum xnn_status setup_floor_operator(
   assert(output_data != NULL);
 
   return xnn_setup_floor_nc_f32(
-    opdata->operator_object,
+    opdata->operator_objects[0],
     opdata->batch_size,
     input_data,
     output_data,
@@ -154,6 +155,8 @@ enum xnn_status xnn_define_floor(
   node->flags = flags;
 
   node->create = create_floor_operator;
+
+  node->reshape = xnn_reshape_unary_elementwise_nc;
   node->setup = setup_floor_operator;
 
   return xnn_status_success;
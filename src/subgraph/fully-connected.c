@@ -11,13 +11,15 @@
 #include <xnnpack/log.h>
 #include <xnnpack/params.h>
 #include <xnnpack/subgraph.h>
+#include <xnnpack/weights-cache.h>
 
 
 static enum xnn_status create_fully_connected_operator(
   const struct xnn_node* node,
   const struct xnn_value* values,
   size_t num_values,
-  struct xnn_operator_data* opdata)
+  struct xnn_operator_data* opdata,
+  xnn_weights_cache_t weights_cache)
 {
   assert(node->num_inputs >= 2);
   assert(node->num_inputs <= 3);
@@ -59,7 +61,7 @@ static enum xnn_status create_fully_connected_operator(
   enum xnn_status status;
   switch (node->compute_type) {
     case xnn_compute_type_fp32:
-      status = xnn_create_fully_connected_nc_f32(
+      status = xnn_create_fully_connected_nc_f32_with_cache(
         input_channels,
         output_channels,
         input_channels /* input stride */,
@@ -69,7 +71,8 @@ static enum xnn_status create_fully_connected_operator(
         node->activation.output_min,
         node->activation.output_max,
         node->flags /* flags */,
-        &opdata->operator_object);
+        weights_cache,
+        &opdata->operator_objects[0]);
       break;
 #ifndef XNN_NO_QS8_OPERATORS
     case xnn_compute_type_qs8:
@@ -80,7 +83,7 @@ static enum xnn_status create_fully_connected_operator(
         (int8_t) lrintf(fminf(fmaxf(node->activation.output_min / output_scale + (float) output_zero_point, -128.0f), 127.0f));
       const int8_t output_max =
         (int8_t) lrintf(fminf(fmaxf(node->activation.output_max / output_scale + (float) output_zero_point, -128.0f), 127.0f));
-      status = xnn_create_fully_connected_nc_qs8(
+      status = xnn_create_fully_connected_nc_qs8_with_cache(
         input_channels,
         output_channels,
         input_channels /* input stride */,
@@ -93,7 +96,8 @@ static enum xnn_status create_fully_connected_operator(
         (int8_t) output_zero_point,
         output_scale, output_min, output_max,
         node->flags /* flags */,
-        &opdata->operator_object);
+        weights_cache,
+        &opdata->operator_objects[0]);
       break;
     }
 #endif  // !defined(XNN_NO_QS8_OPERATORS)
@@ -106,7 +110,7 @@ static enum xnn_status create_fully_connected_operator(
         (uint8_t) lrintf(fminf(fmaxf(node->activation.output_min / output_scale + (float) output_zero_point, 0.0f), 255.0f));
       const uint8_t output_max =
         (uint8_t) lrintf(fminf(fmaxf(node->activation.output_max / output_scale + (float) output_zero_point, 0.0f), 255.0f));
-      status = xnn_create_fully_connected_nc_qu8(
+      status = xnn_create_fully_connected_nc_qu8_with_cache(
         input_channels,
         output_channels,
         input_channels /* input stride */,
@@ -120,7 +124,8 @@ static enum xnn_status create_fully_connected_operator(
         (uint8_t) output_zero_point,
         output_scale, output_min, output_max,
         node->flags /* flags */,
-        &opdata->operator_object);
+        weights_cache,
+        &opdata->operator_objects[0]);
       break;
     }
 #endif  // !defined(XNN_NO_QU8_OPERATORS)
@@ -135,6 +140,62 @@ static enum xnn_status create_fully_connected_operator(
   return status;
 }
 
+static enum xnn_status reshape_fully_connected_operator(
+  const struct xnn_node* node,
+  struct xnn_value* values,
+  size_t num_values,
+  struct xnn_operator_data* opdata)
+{
+  const uint32_t input_id = node->inputs[0];
+  assert(input_id != XNN_INVALID_VALUE_ID);
+  assert(input_id < num_values);
+
+  const uint32_t output_id = node->outputs[0];
+  assert(output_id != XNN_INVALID_VALUE_ID);
+  assert(output_id < num_values);
+
+  const struct xnn_shape* input_shape = &values[input_id].shape;
+  struct xnn_shape* output_shape = &values[output_id].shape;
+  const uint32_t filter_id = node->inputs[1];
+  assert(filter_id != XNN_INVALID_VALUE_ID);
+  assert(filter_id < num_values);
+
+  size_t output_channels, input_channels;
+  if (node->flags & XNN_FLAG_TRANSPOSE_WEIGHTS) {
+    input_channels = values[filter_id].shape.dim[0];
+    output_channels = values[filter_id].shape.dim[1];
+  } else {
+    output_channels = values[filter_id].shape.dim[0];
+    input_channels = values[filter_id].shape.dim[1];
+  }
+
+  const size_t num_input_elements = xnn_shape_multiply_all_dims(input_shape);
+  if (num_input_elements % input_channels != 0) {
+    xnn_log_error(
+      "failed to reshape %s operator with input ID #%" PRIu32 ": number of elements %zu is not divisible by %zu input channels",
+      xnn_node_type_to_string(xnn_node_type_fully_connected), input_id, num_input_elements, input_channels);
+    return xnn_status_invalid_parameter;
+  }
+  const size_t batch_size = num_input_elements / input_channels;
+
+  if (output_shape->num_dims == input_shape->num_dims && input_shape->dim[input_shape->num_dims - 1] == input_channels) {
+    // Output keeps the non-channel dimensions of the input.
+    *output_shape = *input_shape;
+    output_shape->dim[output_shape->num_dims - 1] = output_channels;
+  } else if (output_shape->num_dims == 2) {
+    // Input is flattened into a batch of input_channels-sized vectors.
+    output_shape->dim[0] = batch_size;
+  } else {
+    xnn_log_error(
+      "failed to reshape %s operator with input ID #%" PRIu32 ": can't infer %zuD output shape from %zuD input",
+      xnn_node_type_to_string(xnn_node_type_fully_connected), input_id, output_shape->num_dims, input_shape->num_dims);
+    return xnn_status_invalid_parameter;
+  }
+
+  opdata->batch_size = batch_size;
+  return xnn_status_success;
+}
+
 static enum xnn_status setup_fully_connected_operator(
   const struct xnn_operator_data* opdata,
   const struct xnn_blob* blobs,
@@ -157,10 +218,10 @@ static enum xnn_status setup_fully_connected_operator(
   void* output_data = output_blob->data;
   assert(output_data != NULL);
 
-  switch (opdata->operator_object->type) {
+  switch (opdata->operator_objects[0]->type) {
     case xnn_operator_type_fully_connected_nc_f32:
       return xnn_setup_fully_connected_nc_f32(
-        opdata->operator_object,
+        opdata->operator_objects[0],
         opdata->batch_size,
         input_data,
         output_data,
@@ -168,7 +229,7 @@ static enum xnn_status setup_fully_connected_operator(
 #ifndef XNN_NO_QS8_OPERATORS
     case xnn_operator_type_fully_connected_nc_qs8:
       return xnn_setup_fully_connected_nc_qs8(
-        opdata->operator_object,
+        opdata->operator_objects[0],
         opdata->batch_size,
         input_data,
         output_data,
@@ -177,7 +238,7 @@ static enum xnn_status setup_fully_connected_operator(
 #ifndef XNN_NO_QU8_OPERATORS
     case xnn_operator_type_fully_connected_nc_qu8:
       return xnn_setup_fully_connected_nc_qu8(
-        opdata->operator_object,
+        opdata->operator_objects[0],
         opdata->batch_size,
         input_data,
         output_data,
@@ -495,6 +556,8 @@ enum xnn_status xnn_define_fully_connected(
   node->flags = flags;
 
   node->create = create_fully_connected_operator;
+
+  node->reshape = reshape_fully_connected_operator;
   node->setup = setup_fully_connected_operator;
 
   return xnn_status_success;
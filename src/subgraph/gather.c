@@ -0,0 +1,421 @@
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <xnnpack.h>
+#include <xnnpack/log.h>
+#include <xnnpack/params.h>
+#include <xnnpack/subgraph.h>
+
+
+static enum xnn_status create_gather_operator(
+  const struct xnn_node* node,
+  const struct xnn_value* values,
+  size_t num_values,
+  struct xnn_operator_data* opdata,
+  xnn_weights_cache_t weights_cache)
+{
+  assert(node->num_inputs == 2);
+  const uint32_t input_id = node->inputs[0];
+  assert(input_id != XNN_INVALID_VALUE_ID);
+  assert(input_id < num_values);
+  const uint32_t indices_id = node->inputs[1];
+  assert(indices_id != XNN_INVALID_VALUE_ID);
+  assert(indices_id < num_values);
+
+  assert(node->num_outputs == 1);
+  const uint32_t output_id = node->outputs[0];
+  assert(output_id != XNN_INVALID_VALUE_ID);
+  assert(output_id < num_values);
+
+  enum xnn_status status;
+  switch (node->compute_type) {
+    case xnn_compute_type_fp32:
+      status = xnn_create_gather_nd_x32(node->flags, &opdata->operator_objects[0]);
+      break;
+#ifndef XNN_NO_QS8_OPERATORS
+    case xnn_compute_type_qs8:
+#endif  // !defined(XNN_NO_QS8_OPERATORS)
+#ifndef XNN_NO_QU8_OPERATORS
+    case xnn_compute_type_qu8:
+#endif  // !defined(XNN_NO_QU8_OPERATORS)
+#if !defined(XNN_NO_QS8_OPERATORS) || !defined(XNN_NO_QU8_OPERATORS)
+      status = xnn_create_gather_nd_x8(node->flags, &opdata->operator_objects[0]);
+      break;
+#endif  // !defined(XNN_NO_QS8_OPERATORS) || !defined(XNN_NO_QU8_OPERATORS)
+    case xnn_compute_type_qs8_to_fp32:
+      status = xnn_create_gather_nd_qs8_f32(
+        values[input_id].quantization.scale,
+        (int8_t) values[input_id].quantization.zero_point,
+        node->flags,
+        &opdata->operator_objects[0]);
+      break;
+    case xnn_compute_type_qu8_to_fp32:
+      status = xnn_create_gather_nd_qu8_f32(
+        values[input_id].quantization.scale,
+        (uint8_t) values[input_id].quantization.zero_point,
+        node->flags,
+        &opdata->operator_objects[0]);
+      break;
+    default:
+      XNN_UNREACHABLE;
+  }
+  if (status == xnn_status_success) {
+    opdata->shape1 = values[input_id].shape;
+    opdata->batch_size = xnn_shape_multiply_all_dims(&values[indices_id].shape);
+    opdata->axis = node->params.gather.axis;
+    opdata->static_indices = values[indices_id].data != NULL;
+    opdata->inputs[0] = input_id;
+    opdata->inputs[1] = indices_id;
+    opdata->outputs[0] = output_id;
+  }
+  return status;
+}
+
+static enum xnn_status reshape_gather_operator(
+  const struct xnn_node* node,
+  struct xnn_value* values,
+  size_t num_values,
+  struct xnn_operator_data* opdata)
+{
+  const uint32_t input_id = node->inputs[0];
+  assert(input_id != XNN_INVALID_VALUE_ID);
+  assert(input_id < num_values);
+  const uint32_t indices_id = node->inputs[1];
+  assert(indices_id != XNN_INVALID_VALUE_ID);
+  assert(indices_id < num_values);
+
+  const uint32_t output_id = node->outputs[0];
+  assert(output_id != XNN_INVALID_VALUE_ID);
+  assert(output_id < num_values);
+
+  const size_t axis = node->params.gather.axis;
+  const struct xnn_shape* input_shape = &values[input_id].shape;
+  const struct xnn_shape* indices_shape = &values[indices_id].shape;
+  struct xnn_shape* output_shape = &values[output_id].shape;
+  assert(axis < input_shape->num_dims);
+  assert(output_shape->num_dims == input_shape->num_dims + indices_shape->num_dims - 1);
+  size_t output_dim = 0;
+  for (size_t i = 0; i < axis; i++) {
+    output_shape->dim[output_dim++] = input_shape->dim[i];
+  }
+  for (size_t i = 0; i < indices_shape->num_dims; i++) {
+    output_shape->dim[output_dim++] = indices_shape->dim[i];
+  }
+  for (size_t i = axis + 1; i < input_shape->num_dims; i++) {
+    output_shape->dim[output_dim++] = input_shape->dim[i];
+  }
+
+  opdata->shape1 = *input_shape;
+  opdata->batch_size = xnn_shape_multiply_all_dims(indices_shape);
+  return xnn_status_success;
+}
+
+static enum xnn_status setup_gather_operator(
+  const struct xnn_operator_data* opdata,
+  const struct xnn_blob* blobs,
+  size_t num_blobs,
+  pthreadpool_t threadpool)
+{
+  const uint32_t input_id = opdata->inputs[0];
+  assert(input_id != XNN_INVALID_VALUE_ID);
+  assert(input_id < num_blobs);
+
+  const uint32_t indices_id = opdata->inputs[1];
+  assert(indices_id != XNN_INVALID_VALUE_ID);
+  assert(indices_id < num_blobs);
+
+  const uint32_t output_id = opdata->outputs[0];
+  assert(output_id != XNN_INVALID_VALUE_ID);
+  assert(output_id < num_blobs);
+
+  const struct xnn_blob* input_blob = blobs + input_id;
+  const void* input_data = input_blob->data;
+  assert(input_data != NULL);
+
+  const struct xnn_blob* indices_blob = blobs + indices_id;
+  const int32_t* indices_data = (const int32_t*) indices_blob->data;
+  assert(indices_data != NULL);
+
+  if (opdata->static_indices) {
+    // Dynamic indices are computed after setup, and are validated when the operator runs.
+    const size_t axis_size = opdata->shape1.dim[opdata->axis];
+    for (size_t i = 0; i < opdata->batch_size; i++) {
+      if (indices_data[i] < 0 || (size_t) indices_data[i] >= axis_size) {
+        xnn_log_error(
+          "failed to setup %s operator: static index #%zu (%" PRId32 ") is outside of the [0, %zu) range",
+          xnn_node_type_to_string(xnn_node_type_gather), i, indices_data[i], axis_size);
+        return xnn_status_invalid_parameter;
+      }
+    }
+  }
+
+  const struct xnn_blob* output_blob = blobs + output_id;
+  void* output_data = output_blob->data;
+  assert(output_data != NULL);
+
+  switch (opdata->operator_objects[0]->type) {
+#if !defined(XNN_NO_QS8_OPERATORS) || !defined(XNN_NO_QU8_OPERATORS)
+    case xnn_operator_type_gather_nd_x8:
+      return xnn_setup_gather_nd_x8(
+        opdata->operator_objects[0],
+        opdata->shape1.num_dims,
+        opdata->shape1.dim,
+        opdata->axis,
+        opdata->batch_size,
+        indices_data,
+        input_data,
+        output_data,
+        threadpool);
+#endif  // !defined(XNN_NO_QS8_OPERATORS) || !defined(XNN_NO_QU8_OPERATORS)
+    case xnn_operator_type_gather_nd_x32:
+      return xnn_setup_gather_nd_x32(
+        opdata->operator_objects[0],
+        opdata->shape1.num_dims,
+        opdata->shape1.dim,
+        opdata->axis,
+        opdata->batch_size,
+        indices_data,
+        input_data,
+        output_data,
+        threadpool);
+    case xnn_operator_type_gather_nd_qs8_f32:
+      return xnn_setup_gather_nd_qs8_f32(
+        opdata->operator_objects[0],
+        opdata->shape1.num_dims,
+        opdata->shape1.dim,
+        opdata->axis,
+        opdata->batch_size,
+        indices_data,
+        input_data,
+        output_data,
+        threadpool);
+    case xnn_operator_type_gather_nd_qu8_f32:
+      return xnn_setup_gather_nd_qu8_f32(
+        opdata->operator_objects[0],
+        opdata->shape1.num_dims,
+        opdata->shape1.dim,
+        opdata->axis,
+        opdata->batch_size,
+        indices_data,
+        input_data,
+        output_data,
+        threadpool);
+    default:
+      XNN_UNREACHABLE;
+  }
+}
+
+enum xnn_status xnn_define_gather(
+  xnn_subgraph_t subgraph,
+  size_t axis,
+  uint32_t input_id,
+  uint32_t indices_id,
+  uint32_t output_id,
+  uint32_t flags)
+{
+  if ((xnn_params.init_flags & XNN_INIT_FLAG_XNNPACK) == 0) {
+    xnn_log_error("failed to define %s operator: XNNPACK is not initialized",
+      xnn_node_type_to_string(xnn_node_type_gather));
+    return xnn_status_uninitialized;
+  }
+
+  if (input_id >= subgraph->num_values) {
+    xnn_log_error(
+      "failed to define %s operator with input ID #%" PRIu32 ": invalid Value ID",
+      xnn_node_type_to_string(xnn_node_type_gather), input_id);
+    return xnn_status_invalid_parameter;
+  }
+
+  const struct xnn_value* input_value = &subgraph->values[input_id];
+  if (input_value->type != xnn_value_type_dense_tensor) {
+    xnn_log_error(
+      "failed to define %s operator with input ID #%" PRIu32 ": unsupported Value type %d (expected dense tensor)",
+      xnn_node_type_to_string(xnn_node_type_gather), input_id, input_value->type);
+    return xnn_status_invalid_parameter;
+  }
+
+  switch (input_value->datatype) {
+    case xnn_datatype_fp32:
+#ifndef XNN_NO_QS8_OPERATORS
+    case xnn_datatype_qint8:
+#endif  // !defined(XNN_NO_QS8_OPERATORS)
+#ifndef XNN_NO_QU8_OPERATORS
+    case xnn_datatype_quint8:
+#endif  // !defined(XNN_NO_QU8_OPERATORS)
+      break;
+    default:
+      xnn_log_error(
+        "failed to define %s operator with input ID #%" PRIu32 ": unsupported Value datatype %s (%d)",
+        xnn_node_type_to_string(xnn_node_type_gather), input_id,
+        xnn_datatype_to_string(input_value->datatype), input_value->datatype);
+      return xnn_status_invalid_parameter;
+  }
+
+  if (axis >= input_value->shape.num_dims) {
+    xnn_log_error(
+      "failed to define %s operator with input ID #%" PRIu32 ": gather axis %zu exceeds the number of input "
+      "dimensions (%zu)",
+      xnn_node_type_to_string(xnn_node_type_gather), input_id, axis, input_value->shape.num_dims);
+    return xnn_status_invalid_parameter;
+  }
+
+  if (indices_id >= subgraph->num_values) {
+    xnn_log_error(
+      "failed to define %s operator with indices ID #%" PRIu32 ": invalid Value ID",
+      xnn_node_type_to_string(xnn_node_type_gather), indices_id);
+    return xnn_status_invalid_parameter;
+  }
+
+  const struct xnn_value* indices_value = &subgraph->values[indices_id];
+  if (indices_value->type != xnn_value_type_dense_tensor) {
+    xnn_log_error(
+      "failed to define %s operator with indices ID #%" PRIu32 ": unsupported Value type %d (expected dense tensor)",
+      xnn_node_type_to_string(xnn_node_type_gather), indices_id, indices_value->type);
+    return xnn_status_invalid_parameter;
+  }
+
+  if (indices_value->datatype != xnn_datatype_int32) {
+    xnn_log_error(
+      "failed to define %s operator with indices ID #%" PRIu32 ": unsupported Value datatype %s (%d)",
+      xnn_node_type_to_string(xnn_node_type_gather), indices_id,
+      xnn_datatype_to_string(indices_value->datatype), indices_value->datatype);
+    return xnn_status_invalid_parameter;
+  }
+
+  if (output_id >= subgraph->num_values) {
+    xnn_log_error(
+      "failed to define %s operator with output ID #%" PRIu32 ": invalid Value ID",
+      xnn_node_type_to_string(xnn_node_type_gather), output_id);
+    return xnn_status_invalid_parameter;
+  }
+
+  const struct xnn_value* output_value = &subgraph->values[output_id];
+  if (output_value->type != xnn_value_type_dense_tensor) {
+    xnn_log_error(
+      "failed to define %s operator with output ID #%" PRIu32 ": unsupported Value type %d (expected dense tensor)",
+      xnn_node_type_to_string(xnn_node_type_gather), output_id, output_value->type);
+    return xnn_status_invalid_parameter;
+  }
+
+  enum xnn_compute_type compute_type = xnn_compute_type_invalid;
+  switch (output_value->datatype) {
+    case xnn_datatype_fp32:
+      switch (input_value->datatype) {
+        case xnn_datatype_fp32:
+          compute_type = xnn_compute_type_fp32;
+          break;
+        case xnn_datatype_qint8:
+          compute_type = xnn_compute_type_qs8_to_fp32;
+          break;
+        case xnn_datatype_quint8:
+          compute_type = xnn_compute_type_qu8_to_fp32;
+          break;
+        default:
+          XNN_UNREACHABLE;
+      }
+      break;
+#ifndef XNN_NO_QS8_OPERATORS
+    case xnn_datatype_qint8:
+      compute_type = xnn_compute_type_qs8;
+      break;
+#endif  // !defined(XNN_NO_QS8_OPERATORS)
+#ifndef XNN_NO_QU8_OPERATORS
+    case xnn_datatype_quint8:
+      compute_type = xnn_compute_type_qu8;
+      break;
+#endif  // !defined(XNN_NO_QU8_OPERATORS)
+    default:
+      xnn_log_error(
+        "failed to define %s operator with output ID #%" PRIu32 ": unsupported Value datatype %s (%d)",
+        xnn_node_type_to_string(xnn_node_type_gather), output_id,
+        xnn_datatype_to_string(output_value->datatype), output_value->datatype);
+      return xnn_status_invalid_parameter;
+  }
+
+  if (output_value->datatype != xnn_datatype_fp32 && input_value->datatype != output_value->datatype) {
+    xnn_log_error(
+      "failed to define %s operator with input ID #%" PRIu32 " and output ID #%" PRIu32
+      ": mismatching datatypes across input (%s) and output (%s)",
+      xnn_node_type_to_string(xnn_node_type_gather), input_id, output_id,
+      xnn_datatype_to_string(input_value->datatype),
+      xnn_datatype_to_string(output_value->datatype));
+    return xnn_status_invalid_parameter;
+  }
+
+#if !defined(XNN_NO_QU8_OPERATORS) || !defined(XNN_NO_QS8_OPERATORS)
+  if (output_value->datatype == xnn_datatype_qint8 || output_value->datatype == xnn_datatype_quint8) {
+    if (input_value->quantization.zero_point != output_value->quantization.zero_point) {
+      xnn_log_error(
+        "failed to define %s operator with input ID #%" PRIu32 " and output ID #%" PRIu32
+        ": mismatching zero point quantization parameter across input (%"PRId32") and output (%"PRId32")",
+        xnn_node_type_to_string(xnn_node_type_gather), input_id, output_id,
+        input_value->quantization.zero_point, output_value->quantization.zero_point);
+      return xnn_status_invalid_parameter;
+    }
+    if (input_value->quantization.scale != output_value->quantization.scale) {
+      xnn_log_error(
+        "failed to define %s operator with input ID #%" PRIu32 " and output ID #%" PRIu32
+        ": mismatching scale quantization parameter across input (%.7g) and output (%.7g)",
+        xnn_node_type_to_string(xnn_node_type_gather), input_id, output_id,
+        input_value->quantization.scale, output_value->quantization.scale);
+      return xnn_status_invalid_parameter;
+    }
+  }
+#endif  // !defined(XNN_NO_QU8_OPERATORS) || !defined(XNN_NO_QS8_OPERATORS)
+
+  const size_t num_output_dims = input_value->shape.num_dims + indices_value->shape.num_dims - 1;
+  if (output_value->shape.num_dims != num_output_dims) {
+    xnn_log_error(
+      "failed to define %s operator with output ID #%" PRIu32
+      ": number of output dimensions (%zu) doesn't match %zu-dimensional input and %zu-dimensional indices",
+      xnn_node_type_to_string(xnn_node_type_gather), output_id, output_value->shape.num_dims,
+      input_value->shape.num_dims, indices_value->shape.num_dims);
+    return xnn_status_invalid_parameter;
+  }
+
+  for (size_t i = 0; i < num_output_dims; i++) {
+    size_t expected_dim;
+    if (i < axis) {
+      expected_dim = input_value->shape.dim[i];
+    } else if (i < axis + indices_value->shape.num_dims) {
+      expected_dim = indices_value->shape.dim[i - axis];
+    } else {
+      expected_dim = input_value->shape.dim[i - indices_value->shape.num_dims + 1];
+    }
+    if (output_value->shape.dim[i] != expected_dim) {
+      xnn_log_error(
+        "failed to define %s operator with output ID #%" PRIu32 ": output dimension #%zu (%zu) doesn't match "
+        "the expected dimension (%zu)",
+        xnn_node_type_to_string(xnn_node_type_gather), output_id, i, output_value->shape.dim[i], expected_dim);
+      return xnn_status_invalid_parameter;
+    }
+  }
+
+  struct xnn_node* node = xnn_subgraph_new_node(subgraph);
+  if (node == NULL) {
+    return xnn_status_out_of_memory;
+  }
+
+  node->type = xnn_node_type_gather;
+  node->compute_type = compute_type;
+  node->params.gather.axis = axis;
+  node->num_inputs = 2;
+  node->inputs[0] = input_id;
+  node->inputs[1] = indices_id;
+  node->num_outputs = 1;
+  node->outputs[0] = output_id;
+  node->flags = flags;
+
+  node->create = create_gather_operator;
+
+  node->reshape = reshape_gather_operator;
+  node->setup = setup_gather_operator;
+
+  return xnn_status_success;
+}
@@ -17,7 +17,8 @@ static enum xnn_status create_global_average_pooling_operator(
   const struct xnn_node* node,
   const struct xnn_value* values,
   size_t num_values,
-  struct xnn_operator_data* opdata)
+  struct xnn_operator_data* opdata,
+  xnn_weights_cache_t weights_cache)
 {
   assert(node->num_inputs == 1);
   const uint32_t input_id = node->inputs[0];
@@ -41,7 +42,7 @@ static enum xnn_status create_global_average_pooling_operator(
       node->activation.output_min,
       node->activation.output_max,
       node->flags,
-      &opdata->operator_object);
+      &opdata->operator_objects[0]);
   } else {
     assert(values[node->inputs[0]].layout == xnn_layout_type_nhwc);
     assert(values[node->outputs[0]].layout == xnn_layout_type_nhwc);
@@ -52,7 +53,7 @@ static enum xnn_status create_global_average_pooling_operator(
           node->activation.output_min,
           node->activation.output_max,
           node->flags,
-          &opdata->operator_object);
+          &opdata->operator_objects[0]);
         break;
 #ifndef XNN_NO_QS8_OPERATORS
       case xnn_compute_type_qs8:
@@ -70,7 +71,7 @@ static enum xnn_status create_global_average_pooling_operator(
           output_min,
           output_max,
           node->flags,
-          &opdata->operator_object);
+          &opdata->operator_objects[0]);
         break;
       }
 #endif  // !defined(XNN_NO_QS8_OPERATORS)
@@ -90,7 +91,7 @@ static enum xnn_status create_global_average_pooling_operator(
           output_min,
           output_max,
           node->flags,
-          &opdata->operator_object);
+          &opdata->operator_objects[0]);
         break;
       }
 #endif  // !defined(XNN_NO_QU8_OPERATORS)
@@ -107,6 +108,39 @@ static enum xnn_status create_global_average_pooling_operator(
   return status;
 }
 
+static enum xnn_status reshape_global_average_pooling_operator(
+  const struct xnn_node* node,
+  struct xnn_value* values,
+  size_t num_values,
+  struct xnn_operator_data* opdata)
+{
+  const uint32_t input_id = node->inputs[0];
+  assert(input_id != XNN_INVALID_VALUE_ID);
+  assert(input_id < num_values);
+
+  const uint32_t output_id = node->outputs[0];
+  assert(output_id != XNN_INVALID_VALUE_ID);
+  assert(output_id < num_values);
+
+  const struct xnn_shape* input_shape = &values[input_id].shape;
+  struct xnn_shape* output_shape = &values[output_id].shape;
+  const size_t num_input_dims = input_shape->num_dims;
+  assert(num_input_dims >= 1);
+  if (input_shape->dim[num_input_dims - 1] != output_shape->dim[output_shape->num_dims - 1]) {
+    xnn_log_error(
+      "failed to reshape %s operator with input ID #%" PRIu32 ": number of channels can't change from %zu to %zu",
+      xnn_node_type_to_string(xnn_node_type_global_average_pooling_2d), input_id,
+      output_shape->dim[output_shape->num_dims - 1], input_shape->dim[num_input_dims - 1]);
+    return xnn_status_invalid_parameter;
+  }
+
+  output_shape->dim[0] = input_shape->dim[0];
+
+  opdata->batch_size = input_shape->dim[0];
+  opdata->input_width = input_shape->dim[1] * input_shape->dim[2];
+  return xnn_status_success;
+}
+
 static enum xnn_status setup_global_average_pooling_operator(
   const struct xnn_operator_data* opdata,
   const struct xnn_blob* blobs,
@@ -129,10 +163,10 @@ static enum xnn_status setup_global_average_pooling_operator(
   void* output_data = output_blob->data;
   assert(output_data != NULL);
 
-  switch (opdata->operator_object->type) {
+  switch (opdata->operator_objects[0]->type) {
     case xnn_operator_type_global_average_pooling_ncw_f32:
       return xnn_setup_global_average_pooling_ncw_f32(
-        opdata->operator_object,
+        opdata->operator_objects[0],
         opdata->batch_size,
         opdata->input_width,
         input_data,
@@ -141,7 +175,7 @@ static enum xnn_status setup_global_average_pooling_operator(
       break;
     case xnn_operator_type_global_average_pooling_nwc_f32:
       return xnn_setup_global_average_pooling_nwc_f32(
-        opdata->operator_object,
+        opdata->operator_objects[0],
         opdata->batch_size,
         opdata->input_width,
         input_data,
@@ -151,7 +185,7 @@ static enum xnn_status setup_global_average_pooling_operator(
 #ifndef XNN_NO_QS8_OPERATORS
     case xnn_operator_type_global_average_pooling_nwc_qs8:
       return xnn_setup_global_average_pooling_nwc_qs8(
-        opdata->operator_object,
+        opdata->operator_objects[0],
         opdata->batch_size,
         opdata->input_width,
         input_data,
@@ -162,7 +196,7 @@ static enum xnn_status setup_global_average_pooling_operator(
 #ifndef XNN_NO_QU8_OPERATORS
     case xnn_operator_type_global_average_pooling_nwc_qu8:
       return xnn_setup_global_average_pooling_nwc_qu8(
-        opdata->operator_object,
+        opdata->operator_objects[0],
         opdata->batch_size,
         opdata->input_width,
         input_data,
@@ -306,6 +340,8 @@ enum xnn_status xnn_define_global_average_pooling_2d(
   node->flags = flags;
 
   node->create = create_global_average_pooling_operator;
+
+  node->reshape = reshape_global_average_pooling_operator;
   node->setup = setup_global_average_pooling_operator;
 
   return xnn_status_success;
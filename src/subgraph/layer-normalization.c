@@ -0,0 +1,267 @@
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <math.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <xnnpack.h>
+#include <xnnpack/log.h>
+#include <xnnpack/params.h>
+#include <xnnpack/subgraph.h>
+
+
+static enum xnn_status create_layer_normalization_operator(
+  const struct xnn_node* node,
+  const struct xnn_value* values,
+  size_t num_values,
+  struct xnn_operator_data* opdata,
+  xnn_weights_cache_t weights_cache)
+{
+  assert(node->compute_type == xnn_compute_type_fp32);
+
+  assert(node->num_inputs == 3);
+  const uint32_t input_id = node->inputs[0];
+  assert(input_id != XNN_INVALID_VALUE_ID);
+  assert(input_id < num_values);
+  const uint32_t gamma_id = node->inputs[1];
+  assert(gamma_id != XNN_INVALID_VALUE_ID);
+  assert(gamma_id < num_values);
+  const uint32_t beta_id = node->inputs[2];
+  assert(beta_id != XNN_INVALID_VALUE_ID);
+  assert(beta_id < num_values);
+
+  assert(node->num_outputs == 1);
+  const uint32_t output_id = node->outputs[0];
+  assert(output_id != XNN_INVALID_VALUE_ID);
+  assert(output_id < num_values);
+
+  const size_t num_input_dims = values[input_id].shape.num_dims;
+  const size_t channel_dim = num_input_dims == 0 ? 1 : values[input_id].shape.dim[num_input_dims - 1];
+  if (values[gamma_id].shape.dim[0] != channel_dim) {
+    xnn_log_error(
+      "failed to create %s operator with gamma ID #%" PRIu32 ": "
+      "number of elements (%zu) does not match the number of channels (%zu)",
+      xnn_node_type_to_string(xnn_node_type_layer_normalization), gamma_id,
+      values[gamma_id].shape.dim[0], channel_dim);
+    return xnn_status_invalid_parameter;
+  }
+  if (values[beta_id].shape.dim[0] != channel_dim) {
+    xnn_log_error(
+      "failed to create %s operator with beta ID #%" PRIu32 ": "
+      "number of elements (%zu) does not match the number of channels (%zu)",
+      xnn_node_type_to_string(xnn_node_type_layer_normalization), beta_id,
+      values[beta_id].shape.dim[0], channel_dim);
+    return xnn_status_invalid_parameter;
+  }
+
+  const enum xnn_status status = xnn_create_layer_normalization_nc_f32(
+    channel_dim /* channels */, channel_dim /* input stride */, channel_dim /* output stride */,
+    node->params.layer_normalization.epsilon,
+    values[gamma_id].data /* gamma */,
+    values[beta_id].data /* beta */,
+    node->flags,
+    &opdata->operator_objects[0]);
+  if (status == xnn_status_success) {
+    opdata->batch_size = xnn_shape_multiply_non_channel_dims(&values[input_id].shape);
+    opdata->inputs[0] = input_id;
+    opdata->outputs[0] = output_id;
+  }
+  return status;
+}
+
+static enum xnn_status setup_layer_normalization_operator(
+  const struct xnn_operator_data* opdata,
+  const struct xnn_blob* blobs,
+  size_t num_blobs,
+  pthreadpool_t threadpool)
+{
+  const uint32_t input_id = opdata->inputs[0];
+  assert(input_id != XNN_INVALID_VALUE_ID);
+  assert(input_id < num_blobs);
+
+  const uint32_t output_id = opdata->outputs[0];
+  assert(output_id != XNN_INVALID_VALUE_ID);
+  assert(output_id < num_blobs);
+
+  const struct xnn_blob* input_blob = blobs + input_id;
+  const void* input_data = input_blob->data;
+  assert(input_data != NULL);
+
+  const struct xnn_blob* output_blob = blobs + output_id;
+  void* output_data = output_blob->data;
+  assert(output_data != NULL);
+
+  return xnn_setup_layer_normalization_nc_f32(
+    opdata->operator_objects[0],
+    opdata->batch_size,
+    input_data,
+    output_data,
+    threadpool);
+}
+
+static enum xnn_status check_static_parameter_value(
+  xnn_subgraph_t subgraph,
+  const char* name,
+  uint32_t value_id)
+{
+  if (value_id >= subgraph->num_values) {
+    xnn_log_error(
+      "failed to define %s operator with %s ID #%" PRIu32 ": invalid Value ID",
+      xnn_node_type_to_string(xnn_node_type_layer_normalization), name, value_id);
+    return xnn_status_invalid_parameter;
+  }
+
+  const struct xnn_value* value = &subgraph->values[value_id];
+  if (value->type != xnn_value_type_dense_tensor) {
+    xnn_log_error(
+      "failed to define %s operator with %s ID #%" PRIu32 ": unsupported Value type %d (expected dense tensor)",
+      xnn_node_type_to_string(xnn_node_type_layer_normalization), name, value_id, value->type);
+    return xnn_status_invalid_parameter;
+  }
+
+  if (value->data == NULL) {
+    xnn_log_error(
+      "failed to define %s operator with %s ID #%" PRIu32 ": non-static Value",
+      xnn_node_type_to_string(xnn_node_type_layer_normalization), name, value_id);
+    return xnn_status_invalid_parameter;
+  }
+
+  if (value->shape.num_dims != 1) {
+    xnn_log_error(
+      "failed to define %s operator with %s ID #%" PRIu32 ": "
+      "unsupported number of dimensions %zu (expected 1)",
+      xnn_node_type_to_string(xnn_node_type_layer_normalization), name, value_id, value->shape.num_dims);
+    return xnn_status_invalid_parameter;
+  }
+
+  switch (value->datatype) {
+    case xnn_datatype_fp32:
+      break;
+    default:
+      xnn_log_error(
+        "failed to define %s operator with %s ID #%" PRIu32 ": unsupported Value datatype %s (%d)",
+        xnn_node_type_to_string(xnn_node_type_layer_normalization), name, value_id,
+        xnn_datatype_to_string(value->datatype), value->datatype);
+      return xnn_status_invalid_parameter;
+  }
+
+  return xnn_status_success;
+}
+
+enum xnn_status xnn_define_layer_normalization(
+  xnn_subgraph_t subgraph,
+  float epsilon,
+  uint32_t input_id,
+  uint32_t gamma_id,
+  uint32_t beta_id,
+  uint32_t output_id,
+  uint32_t flags)
+{
+  if ((xnn_params.init_flags & XNN_INIT_FLAG_XNNPACK) == 0) {
+    xnn_log_error("failed to define %s operator: XNNPACK is not initialized",
+      xnn_node_type_to_string(xnn_node_type_layer_normalization));
+    return xnn_status_uninitialized;
+  }
+
+  if (epsilon <= 0.0f || !isnormal(epsilon)) {
+    xnn_log_error(
+      "failed to define %s operator with %.7g epsilon: epsilon must be finite, normalized, and positive",
+      xnn_node_type_to_string(xnn_node_type_layer_normalization), epsilon);
+    return xnn_status_invalid_parameter;
+  }
+
+  if (input_id >= subgraph->num_values) {
+    xnn_log_error(
+      "failed to define %s operator with input ID #%" PRIu32 ": invalid Value ID",
+      xnn_node_type_to_string(xnn_node_type_layer_normalization), input_id);
+    return xnn_status_invalid_parameter;
+  }
+
+  const struct xnn_value* input_value = &subgraph->values[input_id];
+  if (input_value->type != xnn_value_type_dense_tensor) {
+    xnn_log_error(
+      "failed to define %s operator with input ID #%" PRIu32 ": unsupported Value type %d (expected dense tensor)",
+      xnn_node_type_to_string(xnn_node_type_layer_normalization), input_id, input_value->type);
+    return xnn_status_invalid_parameter;
+  }
+
+  if (input_value->shape.num_dims == 0) {
+    xnn_log_error(
+      "failed to define %s operator with input ID #%" PRIu32 ": number of dimensions must be non-zero",
+      xnn_node_type_to_string(xnn_node_type_layer_normalization), input_id);
+    return xnn_status_invalid_parameter;
+  }
+
+  switch (input_value->datatype) {
+    case xnn_datatype_fp32:
+      break;
+    default:
+      xnn_log_error(
+        "failed to define %s operator with input ID #%" PRIu32 ": unsupported Value datatype %s (%d)",
+        xnn_node_type_to_string(xnn_node_type_layer_normalization), input_id,
+        xnn_datatype_to_string(input_value->datatype), input_value->datatype);
+      return xnn_status_invalid_parameter;
+  }
+
+  enum xnn_status status = check_static_parameter_value(subgraph, "gamma", gamma_id);
+  if (status != xnn_status_success) {
+    return status;
+  }
+
+  status = check_static_parameter_value(subgraph, "beta", beta_id);
+  if (status != xnn_status_success) {
+    return status;
+  }
+
+  if (output_id >= subgraph->num_values) {
+    xnn_log_error(
+      "failed to define %s operator with output ID #%" PRIu32 ": invalid Value ID",
+      xnn_node_type_to_string(xnn_node_type_layer_normalization), output_id);
+    return xnn_status_invalid_parameter;
+  }
+
+  const struct xnn_value* output_value = &subgraph->values[output_id];
+  if (output_value->type != xnn_value_type_dense_tensor) {
+    xnn_log_error(
+      "failed to define %s operator with output ID #%" PRIu32 ": unsupported Value type %d (expected dense tensor)",
+      xnn_node_type_to_string(xnn_node_type_layer_normalization), output_id, output_value->type);
+    return xnn_status_invalid_parameter;
+  }
+
+  switch (output_value->datatype) {
+    case xnn_datatype_fp32:
+      break;
+    default:
+      xnn_log_error(
+        "failed to define %s operator with output ID #%" PRIu32 ": unsupported Value datatype %s (%d)",
+        xnn_node_type_to_string(xnn_node_type_layer_normalization), output_id,
+        xnn_datatype_to_string(output_value->datatype), output_value->datatype);
+      return xnn_status_invalid_parameter;
+  }
+
+  struct xnn_node* node = xnn_subgraph_new_node(subgraph);
+  if (node == NULL) {
+    return xnn_status_out_of_memory;
+  }
+
+  node->type = xnn_node_type_layer_normalization;
+  node->compute_type = xnn_compute_type_fp32;
+  node->params.layer_normalization.epsilon = epsilon;
+  node->num_inputs = 3;
+  node->inputs[0] = input_id;
+  node->inputs[1] = gamma_id;
+  node->inputs[2] = beta_id;
+  node->num_outputs = 1;
+  node->outputs[0] = output_id;
+  node->flags = flags;
+
+  node->create = create_layer_normalization_operator;
+
+  node->reshape = xnn_reshape_unary_elementwise_nc;
+  node->setup = setup_layer_normalization_operator;
+
+  return xnn_status_success;
+}
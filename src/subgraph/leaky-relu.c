@@ -17,7 +17,8 @@ static enum xnn_status create_leaky_relu_operator(
   const struct xnn_node* node,
   const struct xnn_value* values,
   size_t num_values,
-  struct xnn_operator_data* opdata)
+  struct xnn_operator_data* opdata,
+  xnn_weights_cache_t weights_cache)
 {
   assert(node->compute_type == xnn_compute_type_fp32);
 
@@ -38,7 +39,7 @@ static enum xnn_status create_leaky_relu_operator(
     channel_dim /* channels */, channel_dim /* input stride */, channel_dim /* output stride */,
     node->params.leaky_relu.negative_slope,
     node->flags,
-    &opdata->operator_object);
+    &opdata->operator_objects[0]);
   if (status == xnn_status_success) {
     opdata->batch_size = xnn_shape_multiply_non_channel_dims(&values[input_id].shape);
     opdata->inputs[0] = input_id;
@@ -70,7 +71,7 @@ static enum xnn_status setup_leaky_relu_operator(
   assert(output_data != NULL);
 
   return xnn_setup_leaky_relu_nc_f32(
-    opdata->operator_object,
+    opdata->operator_objects[0],
     opdata->batch_size,
     input_data,
     output_data,
@@ -165,6 +166,8 @@ enum xnn_status xnn_define_leaky_relu(
   node->flags = flags;
 
   node->create = create_leaky_relu_operator;
+
+  node->reshape = xnn_reshape_unary_elementwise_nc;
   node->setup = setup_leaky_relu_operator;
 
   return xnn_status_success;
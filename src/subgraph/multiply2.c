@@ -18,7 +18,8 @@ static enum xnn_status create_multiply_operator(
   const struct xnn_node* node,
   const struct xnn_value* values,
   size_t num_values,
-  struct xnn_operator_data* opdata)
+  struct xnn_operator_data* opdata,
+  xnn_weights_cache_t weights_cache)
 {
   assert(node->num_inputs == 2);
   const uint32_t input1_id = node->inputs[0];
@@ -40,7 +41,7 @@ static enum xnn_status create_multiply_operator(
         node->activation.output_min,
         node->activation.output_max,
         node->flags,
-        &opdata->operator_object);
+        &opdata->operator_objects[0]);
       break;
 #ifndef XNN_NO_QS8_OPERATORS
     case xnn_compute_type_qs8:
@@ -58,7 +59,7 @@ static enum xnn_status create_multiply_operator(
         values[input2_id].quantization.scale,
         (int8_t) output_zero_point,
         output_scale, output_min, output_max, node->flags,
-        &opdata->operator_object);
+        &opdata->operator_objects[0]);
       break;
     }
 #endif  // !defined(XNN_NO_QS8_OPERATORS)
@@ -78,7 +79,7 @@ static enum xnn_status create_multiply_operator(
         values[input2_id].quantization.scale,
         (uint8_t) output_zero_point,
         output_scale, output_min, output_max, node->flags,
-        &opdata->operator_object);
+        &opdata->operator_objects[0]);
       break;
     }
 #endif  // !defined(XNN_NO_QU8_OPERATORS)
@@ -145,10 +146,10 @@ static enum xnn_status setup_multiply_operator(
   void* output_data = output_blob->data;
   assert(output_data != NULL);
 
-  switch (opdata->operator_object->type) {
+  switch (opdata->operator_objects[0]->type) {
     case xnn_operator_type_multiply_nd_f32:
       return xnn_setup_multiply_nd_f32(
-        opdata->operator_object,
+        opdata->operator_objects[0],
         opdata->shape1.num_dims,
         opdata->shape1.dim,
         opdata->shape2.num_dims,
@@ -159,7 +160,7 @@ static enum xnn_status setup_multiply_operator(
 #ifndef XNN_NO_QS8_OPERATORS
     case xnn_operator_type_multiply_nd_qs8:
       return xnn_setup_multiply_nd_qs8(
-        opdata->operator_object,
+        opdata->operator_objects[0],
         opdata->shape1.num_dims,
         opdata->shape1.dim,
         opdata->shape2.num_dims,
@@ -171,7 +172,7 @@ static enum xnn_status setup_multiply_operator(
 #ifndef XNN_NO_QU8_OPERATORS
     case xnn_operator_type_multiply_nd_qu8:
       return xnn_setup_multiply_nd_qu8(
-        opdata->operator_object,
+        opdata->operator_objects[0],
         opdata->shape1.num_dims,
         opdata->shape1.dim,
         opdata->shape2.num_dims,
@@ -353,6 +354,8 @@ enum xnn_status xnn_define_multiply2(
   node->flags = flags;
 
   node->create = create_multiply_operator;
+
+  node->reshape = xnn_reshape_binary_elementwise_nd;
   node->setup = setup_multiply_operator;
 
   return xnn_status_success;
@@ -17,7 +17,8 @@ static enum xnn_status create_sigmoid_operator(
   const struct xnn_node* node,
   const struct xnn_value* values,
   size_t num_values,
-  struct xnn_operator_data* opdata)
+  struct xnn_operator_data* opdata,
+  xnn_weights_cache_t weights_cache)
 {
   assert(node->num_inputs == 1);
   const uint32_t input_id = node->inputs[0];
@@ -38,7 +39,7 @@ static enum xnn_status create_sigmoid_operator(
       status = xnn_create_sigmoid_nc_f32(
         channel_dim /* channels */, channel_dim /* input stride */, channel_dim /* output stride */,
         node->flags,
-        &opdata->operator_object);
+        &opdata->operator_objects[0]);
       break;
 #ifndef XNN_NO_QS8_OPERATORS
     case xnn_compute_type_qs8:
@@ -51,7 +52,7 @@ static enum xnn_status create_sigmoid_operator(
         values[output_id].quantization.scale,
         INT8_MIN, INT8_MAX,
         node->flags,
-        &opdata->operator_object);
+        &opdata->operator_objects[0]);
       break;
     }
 #endif  // !defined(XNN_NO_QS8_OPERATORS)
@@ -66,7 +67,7 @@ static enum xnn_status create_sigmoid_operator(
         values[output_id].quantization.scale,
         0, UINT8_MAX,
         node->flags,
-        &opdata->operator_object);
+        &opdata->operator_objects[0]);
       break;
     }
 #endif  // !defined(XNN_NO_QU8_OPERATORS)
@@ -103,10 +104,10 @@ static enum xnn_status setup_sigmoid_operator(
   void* output_data = output_blob->data;
   assert(output_data != NULL);
 
-  switch (opdata->operator_object->type) {
+  switch (opdata->operator_objects[0]->type) {
     case xnn_operator_type_sigmoid_nc_f32:
       return xnn_setup_sigmoid_nc_f32(
-        opdata->operator_object,
+        opdata->operator_objects[0],
         opdata->batch_size,
         input_data,
         output_data,
@@ -114,7 +115,7 @@ static enum xnn_status setup_sigmoid_operator(
 #ifndef XNN_NO_QS8_OPERATORS
     case xnn_operator_type_sigmoid_nc_qs8:
       return xnn_setup_sigmoid_nc_qs8(
-        opdata->operator_object,
+        opdata->operator_objects[0],
         opdata->batch_size,
         input_data,
         output_data,
@@ -123,7 +124,7 @@ static enum xnn_status setup_sigmoid_operator(
 #ifndef XNN_NO_QU8_OPERATORS
     case xnn_operator_type_sigmoid_nc_qu8:
       return xnn_setup_sigmoid_nc_qu8(
-        opdata->operator_object,
+        opdata->operator_objects[0],
         opdata->batch_size,
         input_data,
         output_data,
@@ -241,6 +242,8 @@ enum xnn_status xnn_define_sigmoid(
   node->flags = flags;
 
   node->create = create_sigmoid_operator;
+
+  node->reshape = xnn_reshape_unary_elementwise_nc;
   node->setup = setup_sigmoid_operator;
 
   return xnn_status_success;
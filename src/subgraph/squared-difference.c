@@ -18,7 +18,8 @@ static enum xnn_status create_squared_difference_operator(
   const struct xnn_node* node,
   const struct xnn_value* values,
   size_t num_values,
-  struct xnn_operator_data* opdata)
+  struct xnn_operator_data* opdata,
+  xnn_weights_cache_t weights_cache)
 {
   assert(node->compute_type == xnn_compute_type_fp32);
 
@@ -37,7 +38,7 @@ static enum xnn_status create_squared_difference_operator(
 
   const enum xnn_status status = xnn_create_squared_difference_nd_f32(
     node->flags,
-    &opdata->operator_object);
+    &opdata->operator_objects[0]);
   if (status == xnn_status_success) {
     opdata->shape1.num_dims = values[input1_id].shape.num_dims;
     opdata->shape2.num_dims = values[input2_id].shape.num_dims;
@@ -99,7 +100,7 @@ static enum xnn_status setup_squared_difference_operator(
   assert(output_data != NULL);
 
   return xnn_setup_squared_difference_nd_f32(
-    opdata->operator_object,
+    opdata->operator_objects[0],
     opdata->shape1.num_dims,
     opdata->shape1.dim,
     opdata->shape2.num_dims,
@@ -214,6 +215,8 @@ enum xnn_status xnn_define_squared_difference(
   node->flags = flags;
 
   node->create = create_squared_difference_operator;
+
+  node->reshape = xnn_reshape_binary_elementwise_nd;
   node->setup = setup_squared_difference_operator;
 
   return xnn_status_success;
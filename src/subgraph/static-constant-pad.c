@@ -20,7 +20,8 @@ static enum xnn_status create_constant_pad_operator(
   const struct xnn_node* node,
   const struct xnn_value* values,
   size_t num_values,
-  struct xnn_operator_data* opdata)
+  struct xnn_operator_data* opdata,
+  xnn_weights_cache_t weights_cache)
 {
   assert(node->num_inputs == 1);
   const uint32_t input_id = node->inputs[0];
@@ -38,7 +39,7 @@ static enum xnn_status create_constant_pad_operator(
       status = xnn_create_constant_pad_nd_x32(
         &node->params.static_pad.padding_value,
         node->flags,
-        &opdata->operator_object);
+        &opdata->operator_objects[0]);
       break;
 #ifndef XNN_NO_QS8_OPERATORS
     case xnn_compute_type_qs8:
@@ -50,7 +51,7 @@ static enum xnn_status create_constant_pad_operator(
       status = xnn_create_constant_pad_nd_x8(
         &node->params.static_pad.padding_value,
         node->flags,
-        &opdata->operator_object);
+        &opdata->operator_objects[0]);
       break;
 #endif  // !defined(XNN_NO_QS8_OPERATORS) || !defined(XNN_NO_QU8_OPERATORS)
     default:
@@ -66,6 +67,32 @@ static enum xnn_status create_constant_pad_operator(
   return status;
 }
 
+static enum xnn_status reshape_constant_pad_operator(
+  const struct xnn_node* node,
+  struct xnn_value* values,
+  size_t num_values,
+  struct xnn_operator_data* opdata)
+{
+  const uint32_t input_id = node->inputs[0];
+  assert(input_id != XNN_INVALID_VALUE_ID);
+  assert(input_id < num_values);
+
+  const uint32_t output_id = node->outputs[0];
+  assert(output_id != XNN_INVALID_VALUE_ID);
+  assert(output_id < num_values);
+
+  const struct xnn_shape* input_shape = &values[input_id].shape;
+  struct xnn_shape* output_shape = &values[output_id].shape;
+  assert(output_shape->num_dims == input_shape->num_dims);
+  for (size_t i = 0; i < input_shape->num_dims; i++) {
+    output_shape->dim[i] =
+      node->params.static_pad.pre_paddings[i] + input_shape->dim[i] + node->params.static_pad.post_paddings[i];
+  }
+
+  opdata->shape1 = *input_shape;
+  return xnn_status_success;
+}
+
 static enum xnn_status setup_constant_pad_operator(
   const struct xnn_operator_data* opdata,
   const struct xnn_blob* blobs,
@@ -88,11 +115,11 @@ static enum xnn_status setup_constant_pad_operator(
   void* output_data = output_blob->data;
   assert(output_data != NULL);
 
-  switch (opdata->operator_object->type) {
+  switch (opdata->operator_objects[0]->type) {
 #if !defined(XNN_NO_QS8_OPERATORS) || !defined(XNN_NO_QU8_OPERATORS)
     case xnn_operator_type_constant_pad_nd_x8:
       return xnn_setup_constant_pad_nd_x8(
-        opdata->operator_object,
+        opdata->operator_objects[0],
         opdata->shape1.num_dims,
         opdata->shape1.dim,
         opdata->pre_paddings,
@@ -104,7 +131,7 @@ static enum xnn_status setup_constant_pad_operator(
 #endif  // !defined(XNN_NO_QS8_OPERATORS) || !defined(XNN_NO_QU8_OPERATORS)
     case xnn_operator_type_constant_pad_nd_x32:
       return xnn_setup_constant_pad_nd_x32(
-        opdata->operator_object,
+        opdata->operator_objects[0],
         opdata->shape1.num_dims,
         opdata->shape1.dim,
         opdata->pre_paddings,
@@ -279,6 +306,8 @@ enum xnn_status xnn_define_static_constant_pad(
   node->flags = flags;
 
   node->create = create_constant_pad_operator;
+
+  node->reshape = reshape_constant_pad_operator;
   node->setup = setup_constant_pad_operator;
 
   return xnn_status_success;
@@ -18,7 +18,8 @@ static enum xnn_status create_copy_operator(
   const struct xnn_node* node,
   const struct xnn_value* values,
   size_t num_values,
-  struct xnn_operator_data* opdata)
+  struct xnn_operator_data* opdata,
+  xnn_weights_cache_t weights_cache)
 {
   assert(node->compute_type == xnn_compute_type_fp32);
 
@@ -35,7 +36,7 @@ static enum xnn_status create_copy_operator(
   const enum xnn_status status = xnn_create_copy_nc_x32(
     1 /* channels */, 1 /* input stride */, 1 /* output stride */,
     node->flags,
-    &opdata->operator_object);
+    &opdata->operator_objects[0]);
   if (status == xnn_status_success) {
     opdata->batch_size = xnn_shape_multiply_all_dims(&values[input_id].shape);
     opdata->inputs[0] = input_id;
@@ -44,6 +45,36 @@ static enum xnn_status create_copy_operator(
   return status;
 }
 
+static enum xnn_status reshape_copy_operator(
+  const struct xnn_node* node,
+  struct xnn_value* values,
+  size_t num_values,
+  struct xnn_operator_data* opdata)
+{
+  const uint32_t input_id = node->inputs[0];
+  assert(input_id != XNN_INVALID_VALUE_ID);
+  assert(input_id < num_values);
+
+  const uint32_t output_id = node->outputs[0];
+  assert(output_id != XNN_INVALID_VALUE_ID);
+  assert(output_id < num_values);
+
+  const struct xnn_shape* input_shape = &values[input_id].shape;
+  struct xnn_shape* output_shape = &values[output_id].shape;
+  const size_t num_input_elements = xnn_shape_multiply_all_dims(input_shape);
+  const size_t num_output_elements = xnn_shape_multiply_all_dims(output_shape);
+  if (num_input_elements != num_output_elements) {
+    xnn_log_error(
+      "failed to reshape %s operator with input ID #%" PRIu32 ": "
+      "number of input elements %zu doesn't match %zu elements in the static output shape",
+      xnn_node_type_to_string(xnn_node_type_static_reshape), input_id, num_input_elements, num_output_elements);
+    return xnn_status_invalid_parameter;
+  }
+
+  opdata->batch_size = num_input_elements;
+  return xnn_status_success;
+}
+
 static enum xnn_status setup_copy_operator(
   const struct xnn_operator_data* opdata,
   const struct xnn_blob* blobs,
@@ -67,7 +98,7 @@ static enum xnn_status setup_copy_operator(
   assert(output_data != NULL);
 
   return xnn_setup_copy_nc_x32(
-    opdata->operator_object,
+    opdata->operator_objects[0],
     opdata->batch_size,
     input_data,
     output_data,
@@ -164,6 +195,8 @@ enum xnn_status xnn_define_static_reshape(
   node->flags = flags;
 
   node->create = create_copy_operator;
+
+  node->reshape = reshape_copy_operator;
   node->setup = setup_copy_operator;
 
   return xnn_status_success;
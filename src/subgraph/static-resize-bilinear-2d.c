@@ -17,7 +17,8 @@ static enum xnn_status create_resize_bilinear_operator(
   const struct xnn_node* node,
   const struct xnn_value* values,
   size_t num_values,
-  struct xnn_operator_data* opdata)
+  struct xnn_operator_data* opdata,
+  xnn_weights_cache_t weights_cache)
 {
   assert(node->num_inputs == 1);
   const uint32_t input_id = node->inputs[0];
@@ -39,7 +40,7 @@ static enum xnn_status create_resize_bilinear_operator(
     status = xnn_create_resize_bilinear2d_nchw_f32(
       channel_dim /* channels */, channel_dim /* input stride */, channel_dim /* output stride */,
       node->flags,
-      &opdata->operator_object);
+      &opdata->operator_objects[0]);
   } else {
     assert(values[input_id].layout == xnn_layout_type_nhwc);
     assert(values[output_id].layout == xnn_layout_type_nhwc);
@@ -48,14 +49,14 @@ static enum xnn_status create_resize_bilinear_operator(
         status = xnn_create_resize_bilinear2d_nhwc_f32(
           channel_dim /* channels */, channel_dim /* input stride */, channel_dim /* output stride */,
           node->flags,
-          &opdata->operator_object);
+          &opdata->operator_objects[0]);
         break;
 #ifndef XNN_NO_S8_OPERATORS
       case xnn_compute_type_qs8:
         status = xnn_create_resize_bilinear2d_nhwc_s8(
           channel_dim /* channels */, channel_dim /* input stride */, channel_dim /* output stride */,
           node->flags,
-          &opdata->operator_object);
+          &opdata->operator_objects[0]);
         break;
 #endif  // !defined(XNN_NO_S8_OPERATORS)
 #ifndef XNN_NO_U8_OPERATORS
@@ -63,7 +64,7 @@ static enum xnn_status create_resize_bilinear_operator(
         status = xnn_create_resize_bilinear2d_nhwc_u8(
           channel_dim /* channels */, channel_dim /* input stride */, channel_dim /* output stride */,
           node->flags,
-          &opdata->operator_object);
+          &opdata->operator_objects[0]);
         break;
 #endif  // !defined(XNN_NO_U8_OPERATORS)
       default:
@@ -82,6 +83,38 @@ static enum xnn_status create_resize_bilinear_operator(
   return status;
 }
 
+static enum xnn_status reshape_resize_bilinear_operator(
+  const struct xnn_node* node,
+  struct xnn_value* values,
+  size_t num_values,
+  struct xnn_operator_data* opdata)
+{
+  const uint32_t input_id = node->inputs[0];
+  assert(input_id != XNN_INVALID_VALUE_ID);
+  assert(input_id < num_values);
+
+  const uint32_t output_id = node->outputs[0];
+  assert(output_id != XNN_INVALID_VALUE_ID);
+  assert(output_id < num_values);
+
+  const struct xnn_shape* input_shape = &values[input_id].shape;
+  struct xnn_shape* output_shape = &values[output_id].shape;
+  if (input_shape->dim[3] != output_shape->dim[3]) {
+    xnn_log_error(
+      "failed to reshape %s operator with input ID #%" PRIu32 ": number of channels can't change from %zu to %zu",
+      xnn_node_type_to_string(xnn_node_type_static_resize_bilinear_2d), input_id, (size_t) output_shape->dim[3], input_shape->dim[3]);
+    return xnn_status_invalid_parameter;
+  }
+
+  // Output height and width are static parameters of the Node.
+  output_shape->dim[0] = input_shape->dim[0];
+
+  opdata->batch_size = input_shape->dim[0];
+  opdata->input_height = input_shape->dim[1];
+  opdata->input_width = input_shape->dim[2];
+  return xnn_status_success;
+}
+
 static enum xnn_status setup_resize_bilinear_operator(
   const struct xnn_operator_data* opdata,
   const struct xnn_blob* blobs,
@@ -104,10 +137,10 @@ static enum xnn_status setup_resize_bilinear_operator(
   void* output_data = output_blob->data;
   assert(output_data != NULL);
 
-  switch (opdata->operator_object->type) {
+  switch (opdata->operator_objects[0]->type) {
     case xnn_operator_type_resize_bilinear_nchw_f32:
       return xnn_setup_resize_bilinear2d_nchw_f32(
-        opdata->operator_object,
+        opdata->operator_objects[0],
         opdata->batch_size,
         opdata->input_height,
         opdata->input_width,
@@ -119,7 +152,7 @@ static enum xnn_status setup_resize_bilinear_operator(
       break;
     case xnn_operator_type_resize_bilinear_nhwc_f32:
       return xnn_setup_resize_bilinear2d_nhwc_f32(
-        opdata->operator_object,
+        opdata->operator_objects[0],
         opdata->batch_size,
         opdata->input_height,
         opdata->input_width,
@@ -132,7 +165,7 @@ static enum xnn_status setup_resize_bilinear_operator(
 #ifndef XNN_NO_S8_OPERATORS
     case xnn_operator_type_resize_bilinear_nhwc_s8:
       return xnn_setup_resize_bilinear2d_nhwc_s8(
-        opdata->operator_object,
+        opdata->operator_objects[0],
         opdata->batch_size,
         opdata->input_height,
         opdata->input_width,
@@ -146,7 +179,7 @@ static enum xnn_status setup_resize_bilinear_operator(
 #ifndef XNN_NO_U8_OPERATORS
     case xnn_operator_type_resize_bilinear_nhwc_u8:
       return xnn_setup_resize_bilinear2d_nhwc_u8(
-        opdata->operator_object,
+        opdata->operator_objects[0],
         opdata->batch_size,
         opdata->input_height,
         opdata->input_width,
@@ -317,6 +350,8 @@ enum xnn_status xnn_define_static_resize_bilinear_2d(
   node->flags = flags;
 
   node->create = create_resize_bilinear_operator;
+
+  node->reshape = reshape_resize_bilinear_operator;
   node->setup = setup_resize_bilinear_operator;
 
   return xnn_status_success;
@@ -12,6 +12,7 @@
 #include <xnnpack.h>
 #include <xnnpack/allocator.h>
 #include <xnnpack/log.h>
+#include <xnnpack/math.h>
 #include <xnnpack/params.h>
 #include <xnnpack/subgraph.h>
 
@@ -48,6 +49,7 @@ enum xnn_status xnn_define_tensor_value(
   switch (datatype) {
     case xnn_datatype_fp32:
     case xnn_datatype_fp16:
+    case xnn_datatype_int32:
       break;
     default:
       xnn_log_error("failed to create Dense Tensor value: unsupported datatype %s (%d)",
@@ -276,6 +278,7 @@ size_t xnn_tensor_get_size(
       break;
     case xnn_datatype_qint32:
     case xnn_datatype_qcint32:
+    case xnn_datatype_int32:
       size = 4;
       break;
     case xnn_datatype_invalid:
@@ -308,3 +311,97 @@ size_t xnn_shape_multiply_non_channel_dims(
   }
   return batch_size;
 }
+
+enum xnn_status xnn_reshape_unary_elementwise_nc(
+  const struct xnn_node* node,
+  struct xnn_value* values,
+  size_t num_values,
+  struct xnn_operator_data* opdata)
+{
+  assert(node->num_inputs >= 1);
+  const uint32_t input_id = node->inputs[0];
+  assert(input_id != XNN_INVALID_VALUE_ID);
+  assert(input_id < num_values);
+
+  assert(node->num_outputs == 1);
+  const uint32_t output_id = node->outputs[0];
+  assert(output_id != XNN_INVALID_VALUE_ID);
+  assert(output_id < num_values);
+
+  const struct xnn_shape* input_shape = &values[input_id].shape;
+  struct xnn_shape* output_shape = &values[output_id].shape;
+  const size_t input_channels = input_shape->num_dims == 0 ? 1 : input_shape->dim[input_shape->num_dims - 1];
+  const size_t output_channels = output_shape->num_dims == 0 ? 1 : output_shape->dim[output_shape->num_dims - 1];
+  if (input_channels != output_channels) {
+    xnn_log_error(
+      "failed to reshape %s operator with input ID #%" PRIu32 ": number of channels can't change from %zu to %zu",
+      xnn_node_type_to_string(node->type), input_id, output_channels, input_channels);
+    return xnn_status_invalid_parameter;
+  }
+
+  *output_shape = *input_shape;
+  opdata->batch_size = xnn_shape_multiply_non_channel_dims(input_shape);
+  return xnn_status_success;
+}
+
+enum xnn_status xnn_reshape_binary_elementwise_nd(
+  const struct xnn_node* node,
+  struct xnn_value* values,
+  size_t num_values,
+  struct xnn_operator_data* opdata)
+{
+  assert(node->num_inputs == 2);
+  const uint32_t input1_id = node->inputs[0];
+  assert(input1_id != XNN_INVALID_VALUE_ID);
+  assert(input1_id < num_values);
+  const uint32_t input2_id = node->inputs[1];
+  assert(input2_id != XNN_INVALID_VALUE_ID);
+  assert(input2_id < num_values);
+
+  assert(node->num_outputs == 1);
+  const uint32_t output_id = node->outputs[0];
+  assert(output_id != XNN_INVALID_VALUE_ID);
+  assert(output_id < num_values);
+
+  const struct xnn_shape* input1_shape = &values[input1_id].shape;
+  const struct xnn_shape* input2_shape = &values[input2_id].shape;
+  struct xnn_shape output_shape;
+  output_shape.num_dims = max(input1_shape->num_dims, input2_shape->num_dims);
+  for (size_t i = 1; i <= output_shape.num_dims; i++) {
+    const size_t input1_dim = i <= input1_shape->num_dims ? input1_shape->dim[input1_shape->num_dims - i] : 1;
+    const size_t input2_dim = i <= input2_shape->num_dims ? input2_shape->dim[input2_shape->num_dims - i] : 1;
+    if (input1_dim != input2_dim && input1_dim != 1 && input2_dim != 1) {
+      xnn_log_error(
+        "failed to reshape %s operator with input IDs #%" PRIu32 " and #%" PRIu32 ": "
+        "dimension %zu and %zu are not broadcastable",
+        xnn_node_type_to_string(node->type), input1_id, input2_id, input1_dim, input2_dim);
+      return xnn_status_invalid_parameter;
+    }
+    output_shape.dim[output_shape.num_dims - i] = input1_dim == 1 ? input2_dim : input1_dim;
+  }
+  values[output_id].shape = output_shape;
+
+  opdata->shape1.num_dims = input1_shape->num_dims;
+  opdata->shape2.num_dims = input2_shape->num_dims;
+  if (values[output_id].layout == xnn_layout_type_nchw) {
+    // Operators in NCHW layout take the channel dimension right after the batch dimension.
+    opdata->shape1.dim[0] = input1_shape->dim[0];
+    opdata->shape1.dim[1] = input1_shape->dim[input1_shape->num_dims - 1];
+    for (size_t i = 2; i < input1_shape->num_dims; i++) {
+      opdata->shape1.dim[i] = input1_shape->dim[i - 1];
+    }
+    opdata->shape2.dim[0] = input2_shape->dim[0];
+    opdata->shape2.dim[1] = input2_shape->dim[input2_shape->num_dims - 1];
+    for (size_t i = 2; i < input2_shape->num_dims; i++) {
+      opdata->shape2.dim[i] = input2_shape->dim[i - 1];
+    }
+  } else {
+    for (size_t i = 0; i < input1_shape->num_dims; i++) {
+      opdata->shape1.dim[i] = input1_shape->dim[i];
+    }
+    for (size_t i = 0; i < input2_shape->num_dims; i++) {
+      opdata->shape2.dim[i] = input2_shape->dim[i];
+    }
+  }
+  return xnn_status_success;
+}
@@ -0,0 +1,634 @@
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#ifdef _WIN32
+  #include <windows.h>
+#else
+  #include <fcntl.h>
+  #include <pthread.h>
+  #include <sys/mman.h>
+  #include <sys/stat.h>
+  #include <unistd.h>
+#endif
+
+#include <xnnpack.h>
+#include <xnnpack/allocator.h>
+#include <xnnpack/log.h>
+#include <xnnpack/math.h>
+#include <xnnpack/operator.h>
+#include <xnnpack/params.h>
+#include <xnnpack/weights-cache.h>
+
+
+struct xnn_weights_cache_entry {
+  // Key of the packed weights. Kernel, bias, and scale pointers are NULL for memory-mapped packed weights.
+  struct xnn_weights_cache_key key;
+  // Fingerprints of the static data, computed when the weights cache is saved, or loaded from the file.
+  struct xnn_weights_cache_fingerprint kernel_fingerprint;
+  struct xnn_weights_cache_fingerprint bias_fingerprint;
+  struct xnn_weights_cache_fingerprint scale_fingerprint;
+  bool has_fingerprints;
+  void* packed_weights;
+  // Whether the packed weights reside in the memory-mapped file rather than in memory owned by the weights cache.
+  bool mapped;
+};
+
+struct xnn_weights_cache {
+#ifdef _WIN32
+  SRWLOCK lock;
+#else
+  pthread_mutex_t lock;
+#endif
+  // Number of references to the weights cache: one held by the user until xnn_delete_weights_cache, plus one for
+  // every operator using packed weights from the cache.
+  size_t ref_count;
+  struct xnn_weights_cache_entry* entries;
+  size_t num_entries;
+  size_t max_entries;
+  // Memory-mapped weights cache file, or NULL if the weights cache was not created from a file.
+  void* mapped_data;
+  size_t mapped_size;
+};
+
+static void lock_weights_cache(xnn_weights_cache_t weights_cache) {
+#ifdef _WIN32
+  AcquireSRWLockExclusive(&weights_cache->lock);
+#else
+  pthread_mutex_lock(&weights_cache->lock);
+#endif
+}
+
+static void unlock_weights_cache(xnn_weights_cache_t weights_cache) {
+#ifdef _WIN32
+  ReleaseSRWLockExclusive(&weights_cache->lock);
+#else
+  pthread_mutex_unlock(&weights_cache->lock);
+#endif
+}
+
+static inline uint64_t rotl64(uint64_t x, uint32_t r) {
+  return (x << r) | (x >> (64 - r));
+}
+
+static inline uint64_t fmix64(uint64_t k) {
+  k ^= k >> 33;
+  k *= UINT64_C(0xFF51AFD7ED558CCD);
+  k ^= k >> 33;
+  k *= UINT64_C(0xC4CEB9FE1A85EC53);
+  k ^= k >> 33;
+  return k;
+}
+
+// 128-bit MurmurHash3 of the data contents. Words are read in the native byte order, as are all fields of the file.
+static struct xnn_weights_cache_fingerprint fingerprint(const void* data, size_t size) {
+  const uint64_t c1 = UINT64_C(0x87C37B91114253D5);
+  const uint64_t c2 = UINT64_C(0x4CF5AD432745937F);
+  uint64_t h1 = 0;
+  uint64_t h2 = 0;
+  const uint8_t* bytes = (const uint8_t*) data;
+  size_t n = size;
+  for (; n >= 2 * sizeof(uint64_t); n -= 2 * sizeof(uint64_t)) {
+    uint64_t k[2];
+    memcpy(k, bytes, sizeof(k));
+    bytes += sizeof(k);
+
+    h1 ^= rotl64(k[0] * c1, 31) * c2;
+    h1 = (rotl64(h1, 27) + h2) * 5 + UINT64_C(0x52DCE729);
+    h2 ^= rotl64(k[1] * c2, 33) * c1;
+    h2 = (rotl64(h2, 31) + h1) * 5 + UINT64_C(0x38495AB5);
+  }
+  if (n != 0) {
+    uint64_t k[2] = { 0, 0 };
+    memcpy(k, bytes, n);
+    if (n > sizeof(uint64_t)) {
+      h2 ^= rotl64(k[1] * c2, 33) * c1;
+    }
+    h1 ^= rotl64(k[0] * c1, 31) * c2;
+  }
+
+  h1 ^= (uint64_t) size;
+  h2 ^= (uint64_t) size;
+  h1 += h2;
+  h2 += h1;
+  h1 = fmix64(h1);
+  h2 = fmix64(h2);
+  h1 += h2;
+  h2 += h1;
+  return (struct xnn_weights_cache_fingerprint) { .low = h1, .high = h2 };
+}
+
+static bool fingerprints_equal(struct xnn_weights_cache_fingerprint a, struct xnn_weights_cache_fingerprint b) {
+  return a.low == b.low && a.high == b.high;
+}
+
+// Compares everything but the locations of static data.
+static bool layouts_equal(const struct xnn_weights_cache_key* a, const struct xnn_weights_cache_key* b) {
+  return a->kernel_size == b->kernel_size &&
+    a->bias_size == b->bias_size &&
+    a->scale_size == b->scale_size &&
+    a->operator_type == b->operator_type &&
+    a->ukernel_type == b->ukernel_type &&
+    a->flags == b->flags &&
+    a->groups == b->groups &&
+    a->group_input_channels == b->group_input_channels &&
+    a->group_output_channels == b->group_output_channels &&
+    a->kernel_height == b->kernel_height &&
+    a->kernel_width == b->kernel_width &&
+    a->nr == b->nr &&
+    a->kr == b->kr &&
+    a->sr == b->sr &&
+    memcmp(a->packing_params, b->packing_params, sizeof(a->packing_params)) == 0 &&
+    a->packed_weights_size == b->packed_weights_size;
+}
+
+// Must be called with the lock held.
+static void* find_packed_weights(xnn_weights_cache_t weights_cache, const struct xnn_weights_cache_key* key) {
+  bool has_fingerprints = false;
+  struct xnn_weights_cache_fingerprint kernel_fingerprint = { 0, 0 };
+  struct xnn_weights_cache_fingerprint bias_fingerprint = { 0, 0 };
+  struct xnn_weights_cache_fingerprint scale_fingerprint = { 0, 0 };
+  for (size_t i = 0; i < weights_cache->num_entries; i++) {
+    const struct xnn_weights_cache_entry* entry = &weights_cache->entries[i];
+    if (!layouts_equal(&entry->key, key)) {
+      continue;
+    }
+    if (!entry->mapped) {
+      if (entry->key.kernel == key->kernel && entry->key.bias == key->bias && entry->key.scale == key->scale) {
+        return entry->packed_weights;
+      }
+      continue;
+    }
+
+    // Memory-mapped packed weights could be created in another process, and are identified by data contents, along
+    // with sizes of the static data compared in layouts_equal.
+    if (!has_fingerprints) {
+      kernel_fingerprint = fingerprint(key->kernel, key->kernel_size);
+      bias_fingerprint = fingerprint(key->bias, key->bias_size);
+      scale_fingerprint = fingerprint(key->scale, key->scale_size);
+      has_fingerprints = true;
+    }
+    if (fingerprints_equal(entry->kernel_fingerprint, kernel_fingerprint) &&
+        fingerprints_equal(entry->bias_fingerprint, bias_fingerprint) &&
+        fingerprints_equal(entry->scale_fingerprint, scale_fingerprint))
+    {
+      return entry->packed_weights;
+    }
+  }
+  return NULL;
+}
+
+static void get_gemm_layouts(struct xnn_weights_cache_file_gemm_layout gemm_layouts[5]) {
+  const struct gemm_parameters* gemm_parameters[5] = {
+    &xnn_params.f32.gemm,
+    &xnn_params.f16.gemm,
+    &xnn_params.qc8.gemm,
+    &xnn_params.qs8.gemm,
+    &xnn_params.qu8.gemm,
+  };
+  for (size_t i = 0; i < 5; i++) {
+    gemm_layouts[i] = (struct xnn_weights_cache_file_gemm_layout) {
+      .mr = gemm_parameters[i]->mr,
+      .nr = gemm_parameters[i]->nr,
+      .log2_kr = gemm_parameters[i]->log2_kr,
+      .log2_sr = gemm_parameters[i]->log2_sr,
+    };
+  }
+}
+
+static void unmap_file(void* data, size_t size) {
+#ifdef _WIN32
+  UnmapViewOfFile(data);
+#else
+  munmap(data, size);
+#endif
+}
+
+static void destroy_weights_cache(xnn_weights_cache_t weights_cache) {
+  for (size_t i = 0; i < weights_cache->num_entries; i++) {
+    if (!weights_cache->entries[i].mapped) {
+      xnn_release_simd_memory(weights_cache->entries[i].packed_weights);
+    }
+  }
+  xnn_release_memory(weights_cache->entries);
+  if (weights_cache->mapped_data != NULL) {
+    unmap_file(weights_cache->mapped_data, weights_cache->mapped_size);
+  }
+#ifndef _WIN32
+  pthread_mutex_destroy(&weights_cache->lock);
+#endif
+  xnn_release_memory(weights_cache);
+}
+
+enum xnn_status xnn_create_weights_cache(
+  xnn_weights_cache_t* weights_cache_out)
+{
+  if ((xnn_params.init_flags & XNN_INIT_FLAG_XNNPACK) == 0) {
+    xnn_log_error("failed to create weights cache: XNNPACK is not initialized");
+    return xnn_status_uninitialized;
+  }
+
+  struct xnn_weights_cache* weights_cache = xnn_allocate_zero_memory(sizeof(struct xnn_weights_cache));
+  if (weights_cache == NULL) {
+    xnn_log_error("failed to allocate %zu bytes for weights cache descriptor", sizeof(struct xnn_weights_cache));
+    return xnn_status_out_of_memory;
+  }
+#ifdef _WIN32
+  InitializeSRWLock(&weights_cache->lock);
+#else
+  if (pthread_mutex_init(&weights_cache->lock, NULL) != 0) {
+    xnn_log_error("failed to initialize weights cache lock");
+    xnn_release_memory(weights_cache);
+    return xnn_status_out_of_memory;
+  }
+#endif
+  weights_cache->ref_count = 1;
+
+  *weights_cache_out = weights_cache;
+  return xnn_status_success;
+}
+
+enum xnn_status xnn_delete_weights_cache(
+  xnn_weights_cache_t weights_cache)
+{
+  if (weights_cache == NULL) {
+    return xnn_status_invalid_parameter;
+  }
+
+  xnn_weights_cache_release(weights_cache);
+  return xnn_status_success;
+}
+
+enum xnn_status xnn_save_weights_cache(
+  xnn_weights_cache_t weights_cache,
+  const char* filename)
+{
+  if ((xnn_params.init_flags & XNN_INIT_FLAG_XNNPACK) == 0) {
+    xnn_log_error("failed to save weights cache: XNNPACK is not initialized");
+    return xnn_status_uninitialized;
+  }
+
+  FILE* file = fopen(filename, "wb");
+  if (file == NULL) {
+    xnn_log_error("failed to save weights cache: unable to open file %s for writing", filename);
+    return xnn_status_invalid_parameter;
+  }
+
+  enum xnn_status status = xnn_status_out_of_memory;
+  lock_weights_cache(weights_cache);
+  const size_t num_entries = weights_cache->num_entries;
+  struct xnn_weights_cache_file_entry* file_entries =
+    xnn_allocate_zero_memory(num_entries * sizeof(struct xnn_weights_cache_file_entry));
+  if (file_entries == NULL && num_entries != 0) {
+    xnn_log_error("failed to allocate %zu bytes for weights cache file entries",
+      num_entries * sizeof(struct xnn_weights_cache_file_entry));
+    goto cleanup;
+  }
+
+  struct xnn_weights_cache_file_header header = {
+    .magic = XNN_WEIGHTS_CACHE_FILE_MAGIC,
+    .version = XNN_WEIGHTS_CACHE_FILE_VERSION,
+    .num_entries = (uint32_t) num_entries,
+  };
+  get_gemm_layouts(header.gemm);
+
+  size_t offset = sizeof(header) + num_entries * sizeof(struct xnn_weights_cache_file_entry);
+  for (size_t i = 0; i < num_entries; i++) {
+    struct xnn_weights_cache_entry* entry = &weights_cache->entries[i];
+    if (!entry->has_fingerprints) {
+      // Fingerprints are computed only when needed: hashing all static data would slow down creation of every
+      // operator with a weights cache.
+      entry->kernel_fingerprint = fingerprint(entry->key.kernel, entry->key.kernel_size);
+      entry->bias_fingerprint = fingerprint(entry->key.bias, entry->key.bias_size);
+      entry->scale_fingerprint = fingerprint(entry->key.scale, entry->key.scale_size);
+      entry->has_fingerprints = true;
+    }
+    offset = round_up_po2(offset, XNN_WEIGHTS_CACHE_FILE_ALIGNMENT);
+    file_entries[i] = (struct xnn_weights_cache_file_entry) {
+      .operator_type = (uint32_t) entry->key.operator_type,
+      .ukernel_type = (uint32_t) entry->key.ukernel_type,
+      .flags = entry->key.flags,
+      .groups = entry->key.groups,
+      .group_input_channels = entry->key.group_input_channels,
+      .group_output_channels = entry->key.group_output_channels,
+      .kernel_height = entry->key.kernel_height,
+      .kernel_width = entry->key.kernel_width,
+      .nr = entry->key.nr,
+      .kr = entry->key.kr,
+      .sr = entry->key.sr,
+      .kernel_size = entry->key.kernel_size,
+      .bias_size = entry->key.bias_size,
+      .scale_size = entry->key.scale_size,
+      .kernel_fingerprint = entry->kernel_fingerprint,
+      .bias_fingerprint = entry->bias_fingerprint,
+      .scale_fingerprint = entry->scale_fingerprint,
+      .offset = offset,
+      .size = entry->key.packed_weights_size,
+    };
+    memcpy(file_entries[i].packing_params, entry->key.packing_params, sizeof(entry->key.packing_params));
+    offset += entry->key.packed_weights_size;
+  }
+
+  if (fwrite(&header, sizeof(header), 1, file) != 1 ||
+      fwrite(file_entries, sizeof(struct xnn_weights_cache_file_entry), num_entries, file) != num_entries)
+  {
+    xnn_log_error("failed to save weights cache: error writing file %s", filename);
+    goto cleanup;
+  }
+  offset = sizeof(header) + num_entries * sizeof(struct xnn_weights_cache_file_entry);
+  for (size_t i = 0; i < num_entries; i++) {
+    static const uint8_t padding[XNN_WEIGHTS_CACHE_FILE_ALIGNMENT] = { 0 };
+    const size_t padding_size = (size_t) file_entries[i].offset - offset;
+    const size_t packed_weights_size = (size_t) file_entries[i].size;
+    if (fwrite(padding, 1, padding_size, file) != padding_size ||
+        fwrite(weights_cache->entries[i].packed_weights, 1, packed_weights_size, file) != packed_weights_size)
+    {
+      xnn_log_error("failed to save weights cache: error writing file %s", filename);
+      goto cleanup;
+    }
+    offset += padding_size + packed_weights_size;
+  }
+  status = xnn_status_success;
+
+cleanup:
+  unlock_weights_cache(weights_cache);
+  xnn_release_memory(file_entries);
+  if (fclose(file) != 0 && status == xnn_status_success) {
+    xnn_log_error("failed to save weights cache: error writing file %s", filename);
+    status = xnn_status_out_of_memory;
+  }
+  return status;
+}
+
+static enum xnn_status map_file(const char* filename, void** data_out, size_t* size_out) {
+#ifdef _WIN32
+  HANDLE file = CreateFileA(filename, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+  if (file == INVALID_HANDLE_VALUE) {
+    xnn_log_error("failed to open weights cache file %s", filename);
+    return xnn_status_invalid_parameter;
+  }
+  LARGE_INTEGER file_size;
+  if (!GetFileSizeEx(file, &file_size) || file_size.QuadPart == 0) {
+    xnn_log_error("failed to get size of weights cache file %s", filename);
+    CloseHandle(file);
+    return xnn_status_invalid_parameter;
+  }
+  HANDLE mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+  CloseHandle(file);
+  if (mapping == NULL) {
+    xnn_log_error("failed to map weights cache file %s", filename);
+    return xnn_status_out_of_memory;
+  }
+  void* data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+  CloseHandle(mapping);
+  if (data == NULL) {
+    xnn_log_error("failed to map weights cache file %s", filename);
+    return xnn_status_out_of_memory;
+  }
+  *size_out = (size_t) file_size.QuadPart;
+#else
+  const int fd = open(filename, O_RDONLY);
+  if (fd == -1) {
+    xnn_log_error("failed to open weights cache file %s", filename);
+    return xnn_status_invalid_parameter;
+  }
+  struct stat file_stat;
+  if (fstat(fd, &file_stat) != 0 || file_stat.st_size == 0) {
+    xnn_log_error("failed to get size of weights cache file %s", filename);
+    close(fd);
+    return xnn_status_invalid_parameter;
+  }
+  void* data = mmap(NULL, (size_t) file_stat.st_size, PROT_READ, MAP_SHARED, fd, 0);
+  close(fd);
+  if (data == MAP_FAILED) {
+    xnn_log_error("failed to map weights cache file %s", filename);
+    return xnn_status_out_of_memory;
+  }
+  *size_out = (size_t) file_stat.st_size;
+#endif
+  *data_out = data;
+  return xnn_status_success;
+}
+
+enum xnn_status xnn_create_weights_cache_from_file(
+  const char* filename,
+  xnn_weights_cache_t* weights_cache_out)
+{
+  if ((xnn_params.init_flags & XNN_INIT_FLAG_XNNPACK) == 0) {
+    xnn_log_error("failed to create weights cache: XNNPACK is not initialized");
+    return xnn_status_uninitialized;
+  }
+
+  void* data = NULL;
+  size_t size = 0;
+  enum xnn_status status = map_file(filename, &data, &size);
+  if (status != xnn_status_success) {
+    return status;
+  }
+
+  status = xnn_status_invalid_parameter;
+  const struct xnn_weights_cache_file_header* header = (const struct xnn_weights_cache_file_header*) data;
+  if (size < sizeof(struct xnn_weights_cache_file_header) ||
+      header->magic != XNN_WEIGHTS_CACHE_FILE_MAGIC ||
+      header->version != XNN_WEIGHTS_CACHE_FILE_VERSION)
+  {
+    xnn_log_error("failed to create weights cache: %s is not a weights cache file of version %d",
+      filename, XNN_WEIGHTS_CACHE_FILE_VERSION);
+    goto error;
+  }
+
+  struct xnn_weights_cache_file_gemm_layout gemm_layouts[5];
+  get_gemm_layouts(gemm_layouts);
+  if (memcmp(gemm_layouts, header->gemm, sizeof(gemm_layouts)) != 0) {
+    xnn_log_error(
+      "failed to create weights cache from file %s: file was created for different GEMM microkernels", filename);
+    status = xnn_status_unsupported_hardware;
+    goto error;
+  }
+
+  const size_t num_entries = header->num_entries;
+  const struct xnn_weights_cache_file_entry* file_entries = (const struct xnn_weights_cache_file_entry*) (header + 1);
+  if ((size - sizeof(struct xnn_weights_cache_file_header)) / sizeof(struct xnn_weights_cache_file_entry) < num_entries) {
+    xnn_log_error("failed to create weights cache: file %s is truncated", filename);
+    goto error;
+  }
+  for (size_t i = 0; i < num_entries; i++) {
+    if (file_entries[i].offset % XNN_WEIGHTS_CACHE_FILE_ALIGNMENT != 0 ||
+        file_entries[i].offset > size || file_entries[i].size > size - file_entries[i].offset)
+    {
+      xnn_log_error("failed to create weights cache: file %s is truncated", filename);
+      goto error;
+    }
+  }
+
+  xnn_weights_cache_t weights_cache = NULL;
+  status = xnn_create_weights_cache(&weights_cache);
+  if (status != xnn_status_success) {
+    goto error;
+  }
+  if (num_entries != 0) {
+    weights_cache->entries = xnn_allocate_zero_memory(num_entries * sizeof(struct xnn_weights_cache_entry));
+    if (weights_cache->entries == NULL) {
+      xnn_log_error("failed to allocate %zu bytes for weights cache entries",
+        num_entries * sizeof(struct xnn_weights_cache_entry));
+      xnn_delete_weights_cache(weights_cache);
+      status = xnn_status_out_of_memory;
+      goto error;
+    }
+  }
+  for (size_t i = 0; i < num_entries; i++) {
+    const struct xnn_weights_cache_file_entry* file_entry = &file_entries[i];
+    struct xnn_weights_cache_entry* entry = &weights_cache->entries[i];
+    *entry = (struct xnn_weights_cache_entry) {
+      .key = (struct xnn_weights_cache_key) {
+        .kernel_size = (size_t) file_entry->kernel_size,
+        .bias_size = (size_t) file_entry->bias_size,
+        .scale_size = (size_t) file_entry->scale_size,
+        .operator_type = (enum xnn_operator_type) file_entry->operator_type,
+        .ukernel_type = (enum xnn_ukernel_type) file_entry->ukernel_type,
+        .flags = file_entry->flags,
+        .groups = file_entry->groups,
+        .group_input_channels = (size_t) file_entry->group_input_channels,
+        .group_output_channels = (size_t) file_entry->group_output_channels,
+        .kernel_height = file_entry->kernel_height,
+        .kernel_width = file_entry->kernel_width,
+        .nr = file_entry->nr,
+        .kr = file_entry->kr,
+        .sr = file_entry->sr,
+        .packed_weights_size = (size_t) file_entry->size,
+      },
+      .kernel_fingerprint = file_entry->kernel_fingerprint,
+      .bias_fingerprint = file_entry->bias_fingerprint,
+      .scale_fingerprint = file_entry->scale_fingerprint,
+      .has_fingerprints = true,
+      .packed_weights = (void*) ((uintptr_t) data + (size_t) file_entry->offset),
+      .mapped = true,
+    };
+    memcpy(entry->key.packing_params, file_entry->packing_params, sizeof(entry->key.packing_params));
+  }
+  weights_cache->num_entries = num_entries;
+  weights_cache->max_entries = num_entries;
+  weights_cache->mapped_data = data;
+  weights_cache->mapped_size = size;
+
+  *weights_cache_out = weights_cache;
+  return xnn_status_success;
+
+error:
+  unmap_file(data, size);
+  return status;
+}
+
+void xnn_weights_cache_key_set_packing_params(
+  struct xnn_weights_cache_key* key,
+  const void* packing_params,
+  size_t packing_params_size)
+{
+  assert(packing_params_size <= sizeof(key->packing_params));
+  memset(key->packing_params, 0, sizeof(key->packing_params));
+  if (packing_params != NULL) {
+    memcpy(key->packing_params, packing_params, packing_params_size);
+  }
+}
+
+void* xnn_weights_cache_lookup(
+  xnn_weights_cache_t weights_cache,
+  const struct xnn_weights_cache_key* key)
+{
+  lock_weights_cache(weights_cache);
+  void* packed_weights = find_packed_weights(weights_cache, key);
+  if (packed_weights != NULL) {
+    weights_cache->ref_count += 1;
+  }
+  unlock_weights_cache(weights_cache);
+  return packed_weights;
+}
+
+void* xnn_weights_cache_insert(
+  xnn_weights_cache_t weights_cache,
+  const struct xnn_weights_cache_key* key,
+  void* packed_weights)
+{
+  lock_weights_cache(weights_cache);
+  void* cached_weights = find_packed_weights(weights_cache, key);
+  if (cached_weights != NULL) {
+    // Another operator packed the same weights after our lookup: share its copy.
+    xnn_release_simd_memory(packed_weights);
+  } else {
+    if (weights_cache->num_entries == weights_cache->max_entries) {
+      const size_t max_entries = weights_cache->max_entries == 0 ? 16 : weights_cache->max_entries * 2;
+      struct xnn_weights_cache_entry* entries =
+        xnn_reallocate_memory(weights_cache->entries, max_entries * sizeof(struct xnn_weights_cache_entry));
+      if (entries == NULL) {
+        unlock_weights_cache(weights_cache);
+        xnn_log_error("failed to allocate %zu bytes for weights cache entries",
+          max_entries * sizeof(struct xnn_weights_cache_entry));
+        return NULL;
+      }
+      weights_cache->entries = entries;
+      weights_cache->max_entries = max_entries;
+    }
+    weights_cache->entries[weights_cache->num_entries++] = (struct xnn_weights_cache_entry) {
+      .key = *key,
+      .packed_weights = packed_weights,
+    };
+    cached_weights = packed_weights;
+  }
+  weights_cache->ref_count += 1;
+  unlock_weights_cache(weights_cache);
+  return cached_weights;
+}
+
+bool xnn_weights_cache_get_operator_weights(
+  xnn_weights_cache_t weights_cache,
+  const struct xnn_weights_cache_key* key,
+  xnn_operator_t op)
+{
+  if (weights_cache == NULL) {
+    return false;
+  }
+
+  void* packed_weights = xnn_weights_cache_lookup(weights_cache, key);
+  if (packed_weights == NULL) {
+    return false;
+  }
+  op->packed_weights = packed_weights;
+  op->weights_cache = weights_cache;
+  return true;
+}
+
+void xnn_weights_cache_put_operator_weights(
+  xnn_weights_cache_t weights_cache,
+  const struct xnn_weights_cache_key* key,
+  xnn_operator_t op)
+{
+  if (weights_cache == NULL) {
+    return;
+  }
+
+  void* packed_weights = xnn_weights_cache_insert(weights_cache, key, op->packed_weights);
+  if (packed_weights != NULL) {
+    op->packed_weights = packed_weights;
+    op->weights_cache = weights_cache;
+  }
+}
+
+void xnn_weights_cache_release(
+  xnn_weights_cache_t weights_cache)
+{
+  lock_weights_cache(weights_cache);
+  assert(weights_cache->ref_count != 0);
+  const size_t ref_count = --weights_cache->ref_count;
+  unlock_weights_cache(weights_cache);
+  if (ref_count == 0) {
+    destroy_weights_cache(weights_cache);
+  }
+}
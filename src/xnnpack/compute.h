@@ -6,6 +6,7 @@
 #pragma once
 
 
+#include <stdbool.h>
 #include <stddef.h>
 #include <stdint.h>
 
@@ -59,6 +60,9 @@ struct compute_parameters {
   };
   size_t range[6];
   size_t tile[2];
+  // Offset, in bytes, of the context passed to the task from the beginning of the operator context. Computations of an
+  // operator that run one after another, e.g. passes of a reduction, use different contexts.
+  size_t context_offset;
 };
 
 struct gemm_context {
@@ -118,6 +122,68 @@ struct gemm_context {
   #endif  // XNN_MAX_UARCH_TYPES > 1
 #endif
 
+// Context for Batch Matrix Multiplication with a right-hand operand computed at runtime.
+// C [BxMxN] := A [BxMxK] * B [BxKxN]
+// A, B, and C are dense matrices with row-major storage. B is packed for the GEMM micro-kernel before multiplication.
+struct batch_gemm_context {
+  // K dimension of the A and B matrices.
+  size_t k;
+  // N dimension of the B and C matrices.
+  size_t n;
+  // Input matrices B, with [BxKxN] dimensions, or [BxNxK] dimensions if transpose_b is set.
+  const void* b;
+  // Stride, in bytes, between B matrices of adjacent batch elements.
+  size_t bb_stride;
+  // Whether the B matrices are stored transposed, with [BxNxK] dimensions.
+  bool transpose_b;
+  uint32_t nr;
+  uint32_t kr;
+  uint32_t sr;
+  // Packed B matrices.
+  void* packed_w;
+  // Stride, in bytes, between packed columns of a B matrix, including the (zero) bias.
+  size_t w_stride;
+  // Stride, in bytes, between packed B matrices of adjacent batch elements.
+  size_t wb_stride;
+  // K dimension of the A matrices, pre-scaled by sizeof(element size).
+  size_t k_scaled;
+  // Input matrices A.
+  const void* a;
+  // Stride, in bytes, between adjacent rows of an A matrix.
+  size_t a_stride;
+  // Stride, in bytes, between A matrices of adjacent batch elements.
+  size_t ab_stride;
+  // Output matrices C.
+  void* c;
+  // Stride, in bytes, between adjacent rows of a C matrix.
+  size_t cm_stride;
+  // Stride, in bytes, between blocks of NR columns of a C matrix.
+  size_t cn_stride;
+  // Stride, in bytes, between C matrices of adjacent batch elements.
+  size_t cb_stride;
+  uint32_t log2_csize;
+  struct xnn_hmp_gemm_ukernel ukernel;
+  union {
+    union xnn_f32_minmax_params f32;
+  } params;
+};
+
+#ifndef __cplusplus
+  XNN_PRIVATE void xnn_compute_f32_batch_gemm_packw(
+      const struct batch_gemm_context context[restrict XNN_MIN_ELEMENTS(1)],
+      size_t batch_index,
+      size_t nr_block_start,
+      size_t nr_block_size);
+
+  XNN_PRIVATE void xnn_compute_batch_gemm(
+      const struct batch_gemm_context context[restrict XNN_MIN_ELEMENTS(1)],
+      size_t batch_index,
+      size_t mr_block_start,
+      size_t nr_block_start,
+      size_t mr_block_size,
+      size_t nr_block_size);
+#endif
+
 // Context for Sparse Matrix-Dense Matrix Multiplication.
 // C [MxN] := A [MxK] * B [KxN] + bias [N]
 // A and C are dense matrices with row-major storage, B is a sparse matrix.
@@ -362,9 +428,13 @@ struct conv2d_context {
   size_t input_padding_top;
   size_t output_channels;
   size_t output_height_stride;
-  size_t output_channel_stride;
+  union {
+    size_t output_channel_stride;
+    size_t output_width_stride;
+  };
   union {
     xnn_conv_hwc2chw_ukernel_function hwc2chw_ukernel;
+    xnn_conv_hwc_ukernel_function hwc_ukernel;
   };
   union {
     union xnn_f32_minmax_params f32;
@@ -372,6 +442,12 @@ struct conv2d_context {
 };
 
 #ifndef __cplusplus
+  XNN_PRIVATE void xnn_compute_conv2d_hwc(
+      const struct conv2d_context context[restrict XNN_MIN_ELEMENTS(1)],
+      size_t batch_index,
+      size_t output_y_start,
+      size_t output_y_slice);
+
   XNN_PRIVATE void xnn_compute_conv2d_hwc2chw(
       const struct conv2d_context context[restrict XNN_MIN_ELEMENTS(1)],
       size_t batch_index,
@@ -852,6 +928,7 @@ struct univector_strided_context {
     union xnn_f32_default_params f32_default;
     union xnn_f32_elu_params f32_elu;
     union xnn_f32_f16_cvt_params f32_f16_cvt;
+    union xnn_f32_gelu_params f32_gelu;
     union xnn_f32_hswish_params f32_hswish;
     union xnn_f32_lrelu_params f32_lrelu;
     union xnn_f32_minmax_params f32_minmax;
@@ -861,6 +938,7 @@ struct univector_strided_context {
     union xnn_f32_rnd_params f32_rnd;
     union xnn_f32_sigmoid_params f32_sigmoid;
     union xnn_f32_sqrt_params f32_sqrt;
+    union xnn_f32_tanh_params f32_tanh;
     union xnn_qs8_f32_cvt_params qs8_f32_cvt;
     union xnn_qu8_f32_cvt_params qu8_f32_cvt;
     union xnn_s8_minmax_params s8_minmax;
@@ -890,6 +968,7 @@ struct univector_contiguous_context {
     union xnn_f32_default_params f32_default;
     union xnn_f32_elu_params f32_elu;
     union xnn_f32_f16_cvt_params f32_f16_cvt;
+    union xnn_f32_gelu_params f32_gelu;
     union xnn_f32_hswish_params f32_hswish;
     union xnn_f32_lrelu_params f32_lrelu;
     union xnn_f32_minmax_params f32_minmax;
@@ -899,6 +978,7 @@ struct univector_contiguous_context {
     union xnn_f32_rnd_params f32_rnd;
     union xnn_f32_sigmoid_params f32_sigmoid;
     union xnn_f32_sqrt_params f32_sqrt;
+    union xnn_f32_tanh_params f32_tanh;
     union xnn_qs8_f32_cvt_params qs8_f32_cvt;
     union xnn_qu8_f32_cvt_params qu8_f32_cvt;
     union xnn_s8_minmax_params s8_minmax;
@@ -930,6 +1010,44 @@ struct prelu_context {
       size_t batch_range);
 #endif
 
+struct reduce_max_contiguous_context {
+  size_t scaled_elements;
+  const void* input;
+  size_t input_stride;
+  void* output;
+  size_t output_stride;
+  xnn_f32_rmax_ukernel_function ukernel;
+};
+
+#ifndef __cplusplus
+  XNN_PRIVATE void xnn_compute_f32_reduce_max_contiguous(
+      const struct reduce_max_contiguous_context context[restrict XNN_MIN_ELEMENTS(1)],
+      size_t batch_index);
+#endif
+
+struct reduce_max_discontiguous_context {
+  const void* input;
+  size_t input_batch_stride;
+  size_t input_row_stride;
+  size_t rows;
+  void* output;
+  size_t output_batch_stride;
+  uint32_t log2_element_size;
+  xnn_rdmax_ukernel_function ukernel;
+  union {
+    union xnn_f32_default_params f32;
+    union xnn_s8_minmax_params s8;
+  } params;
+};
+
+#ifndef __cplusplus
+  XNN_PRIVATE void xnn_compute_reduce_max_discontiguous(
+      const struct reduce_max_discontiguous_context context[restrict XNN_MIN_ELEMENTS(1)],
+      size_t batch_index,
+      size_t channel_start,
+      size_t channel_slice);
+#endif
+
 struct vmulcaddc_context {
   size_t n;
   const void* x;
@@ -971,6 +1089,101 @@ struct pad_context {
       size_t i, size_t j, size_t k, size_t l, size_t m);
 #endif
 
+struct slice_context {
+  const void* input;
+  // Strides, in bytes, of the input and output tensors along the iterated dimensions, innermost first.
+  size_t input_stride[XNN_MAX_TENSOR_DIMS - 1];
+  void* output;
+  size_t output_stride[XNN_MAX_TENSOR_DIMS - 1];
+  // Rows of contiguous bytes copied in each call to the micro-kernel, and the strides between the rows. For slices
+  // with a strided innermost dimension, rows are single elements of row_size bytes.
+  size_t rows;
+  size_t input_row_stride;
+  size_t output_row_stride;
+  size_t row_size;
+  xnn_pad_ukernel_function pad_ukernel;
+};
+
+#ifndef __cplusplus
+  XNN_PRIVATE void xnn_compute_slice_5d(
+      const struct slice_context context[restrict XNN_MIN_ELEMENTS(1)],
+      size_t i, size_t j, size_t k, size_t l, size_t m);
+  XNN_PRIVATE void xnn_compute_strided_slice_5d(
+      const struct slice_context context[restrict XNN_MIN_ELEMENTS(1)],
+      size_t i, size_t j, size_t k, size_t l, size_t m);
+#endif
+
+struct gather_context {
+  const void* input;
+  const int32_t* indices;
+  void* output;
+  // Strides, in bytes, of the input and output tensors along the dimensions before the gather axis.
+  size_t input_batch_stride;
+  size_t output_batch_stride;
+  // Number of rows along the gather axis of the input tensor. Indices are validated against it before every run.
+  size_t axis_size;
+  size_t num_indices;
+  // Sizes, in bytes, of a gathered row in the input and output tensors.
+  size_t input_row_size;
+  size_t output_row_size;
+  // Number of bytes of the next gathered row to prefetch while the current one is copied.
+  size_t prefetch_size;
+  xnn_univector_ukernel_function ukernel;
+  union {
+    union xnn_qs8_f32_cvt_params qs8_f32_cvt;
+    union xnn_qu8_f32_cvt_params qu8_f32_cvt;
+  } params;
+};
+
+#ifndef __cplusplus
+  XNN_PRIVATE void xnn_compute_gather(
+      const struct gather_context context[restrict XNN_MIN_ELEMENTS(1)],
+      size_t batch_index,
+      size_t index_start,
+      size_t index_range);
+#endif
+
+struct transpose_context {
+  const void* input;
+  void* output;
+  // Strides, in bytes, of the input and output tensors along the iterated dimensions, outermost first.
+  // The last two dimensions are tiled: the second-to-last one is contiguous in the input, and the last one is
+  // contiguous in the output.
+  size_t input_stride[XNN_MAX_TENSOR_DIMS];
+  size_t output_stride[XNN_MAX_TENSOR_DIMS];
+  // Size, in bytes, of the elements moved as a whole.
+  size_t element_size;
+  // Micro-kernel transposing a tile of elements, or NULL if no micro-kernel handles the element size.
+  xnn_transposec_ukernel_function const_size_ukernel;
+};
+
+#ifndef __cplusplus
+  XNN_PRIVATE void xnn_compute_transpose_2d(
+      const struct transpose_context context[restrict XNN_MIN_ELEMENTS(1)],
+      size_t i, size_t j,
+      size_t tile_i, size_t tile_j);
+
+  XNN_PRIVATE void xnn_compute_transpose_3d(
+      const struct transpose_context context[restrict XNN_MIN_ELEMENTS(1)],
+      size_t i, size_t j, size_t k,
+      size_t tile_j, size_t tile_k);
+
+  XNN_PRIVATE void xnn_compute_transpose_4d(
+      const struct transpose_context context[restrict XNN_MIN_ELEMENTS(1)],
+      size_t i, size_t j, size_t k, size_t l,
+      size_t tile_k, size_t tile_l);
+
+  XNN_PRIVATE void xnn_compute_transpose_5d(
+      const struct transpose_context context[restrict XNN_MIN_ELEMENTS(1)],
+      size_t i, size_t j, size_t k, size_t l, size_t m,
+      size_t tile_l, size_t tile_m);
+
+  XNN_PRIVATE void xnn_compute_transpose_6d(
+      const struct transpose_context context[restrict XNN_MIN_ELEMENTS(1)],
+      size_t i, size_t j, size_t k, size_t l, size_t m, size_t n,
+      size_t tile_m, size_t tile_n);
+#endif
+
 struct u8_softmax_context {
   size_t n;
   const uint8_t* x;
@@ -988,6 +1201,25 @@ struct u8_softmax_context {
       size_t batch_index);
 #endif
 
+struct layer_normalization_context {
+  size_t n;
+  const void* x;
+  size_t x_stride;
+  const void* w;
+  void* y;
+  size_t y_stride;
+  float epsilon;
+  xnn_f32_rmeanvar_ukernel_function rmeanvar_ukernel;
+  xnn_f32_vnormcaddc_ukernel_function vnormcaddc_ukernel;
+  union xnn_f32_default_params params;
+};
+
+#ifndef __cplusplus
+  XNN_PRIVATE void xnn_compute_f32_layer_normalization(
+      const struct layer_normalization_context context[restrict XNN_MIN_ELEMENTS(1)],
+      size_t batch_index);
+#endif
+
 struct f32_three_pass_softmax_context {
   size_t n;
   const void* x;
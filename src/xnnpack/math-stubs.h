@@ -190,6 +190,13 @@ DECLARE_F32_UNARY_MATH_FUNCTION(xnn_math_f32_expm1minus__scalar_rr2_lut16_p4)
 DECLARE_F32_UNARY_MATH_FUNCTION(xnn_math_f32_expm1minus__scalar_rr2_p5)
 DECLARE_F32_UNARY_MATH_FUNCTION(xnn_math_f32_expm1minus__scalar_rr2_p6)
 
+DECLARE_F32_UNARY_MATH_FUNCTION(xnn_math_f32_gelu__neon_rational_13_8_nr2recps)
+DECLARE_F32_UNARY_MATH_FUNCTION(xnn_math_f32_gelu__neonfma_rational_13_8_div)
+DECLARE_F32_UNARY_MATH_FUNCTION(xnn_math_f32_gelu__sse2_rational_13_8_div)
+DECLARE_F32_UNARY_MATH_FUNCTION(xnn_math_f32_gelu__avx2_rational_13_8_div)
+DECLARE_F32_UNARY_MATH_FUNCTION(xnn_math_f32_gelu__avx512f_rational_13_8_div)
+DECLARE_F32_UNARY_MATH_FUNCTION(xnn_math_f32_gelu__scalar_rational_13_8_div)
+
 DECLARE_F32_EXT_UNARY_MATH_FUNCTION(xnn_math_f32_extexp__avx2_p5)
 DECLARE_F32_EXT_UNARY_MATH_FUNCTION(xnn_math_f32_extexp__avx512f_p5)
 
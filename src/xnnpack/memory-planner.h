@@ -18,20 +18,42 @@ extern "C" {
 #endif
 
 struct xnn_value_usage {
-  // The index (to xnn_subgraph_t->nodes) of the first xnn_node that uses this xnn_value.
+  // The execution step of the first xnn_node that uses this xnn_value. Unless the tracker is initialized with a
+  // schedule, the execution step is the index of the xnn_node in xnn_subgraph_t->nodes.
   uint32_t first_node;
-  // The index of the last xnn_node that uses this xnn_value.
+  // The execution step of the last xnn_node that uses this xnn_value.
   uint32_t last_node;
   // Note that 'tensor_size' includes the padding of XNN_EXTRA_BYTES.
   size_t tensor_size;
   // The memory offset of this xnn_value from the beginning of a memory buffer.
   size_t alloc_offset;
+  // The id of an input xnn_value whose memory the xnn_node producing this xnn_value overwrites in place, or of the
+  // output of a Concatenate xnn_node whose memory holds this xnn_value at 'reuse_offset', or XNN_INVALID_VALUE_ID.
+  uint32_t reuse_value_id;
+  // The offset of this xnn_value in the memory of the 'reuse_value_id' xnn_value.
+  size_t reuse_offset;
+};
+
+enum xnn_memory_planning_strategy {
+  // Allocate xnn_values in decreasing order of size, each in the smallest gap between the coalesced memory blocks of
+  // the already allocated xnn_values with an overlapping lifecycle.
+  xnn_memory_planning_strategy_smallest_gap = 0,
+  // Allocate xnn_values in decreasing order of size (and of lifecycle length for equal sizes), each in the smallest
+  // gap, starting from offset 0, between the memory blocks of the already allocated xnn_values with an overlapping
+  // lifecycle. The allocated xnn_values are indexed by lifecycle in a segment tree over execution steps, so placing
+  // an xnn_value takes O((K + 1) log(S) + K log(K)) time for S steps and K allocated xnn_values with an overlapping
+  // lifecycle.
+  xnn_memory_planning_strategy_greedy_by_size,
 };
 
 // Track the memory allocation in a memory arena for a subgraph.
 struct xnn_value_allocation_tracker {
   xnn_subgraph_t subgraph;
+  enum xnn_memory_planning_strategy strategy;
   size_t mem_arena_size;
+  // Maximum over the execution steps of the total size of the xnn_values live at the step. No allocation plan fits
+  // into a memory arena smaller than this.
+  size_t mem_arena_lower_bound;
   // Representing the lifecycle of xnn_values in the 'subgraph', and the array size is 'subgraph->num_values'.
   struct xnn_value_usage* usage;
   // The range of value ids (i.e. the index to subgraph->values) whose memory might need to be allocated.
@@ -43,6 +65,13 @@ struct xnn_value_allocation_tracker {
 XNN_INTERNAL void xnn_init_value_allocation_tracker(struct xnn_value_allocation_tracker* tracker,
                                                     const xnn_subgraph_t subgraph);
 
+// Initialize the memory allocation tracker for xnn_values of a subgraph whose nodes don't execute one by one in
+// definition order. 'node_steps' maps each xnn_node to its execution step: steps execute in increasing order, and
+// xnn_nodes sharing a step may execute concurrently, so all xnn_values they use are considered live at once.
+XNN_INTERNAL void xnn_init_scheduled_value_allocation_tracker(struct xnn_value_allocation_tracker* tracker,
+                                                              const xnn_subgraph_t subgraph,
+                                                              const uint32_t* node_steps);
+
 inline static void xnn_release_value_allocation_tracker(struct xnn_value_allocation_tracker* tracker) {
   xnn_release_memory(tracker->usage);
 }
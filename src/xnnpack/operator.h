@@ -16,10 +16,18 @@
 #include <xnnpack/params.h>
 #include <xnnpack/compute.h>
 
+// Maximum number of computations an operator runs after its first computation.
+#define XNN_MAX_EXTRA_COMPUTE 4
+
+// Reductions over XNN_MAX_TENSOR_DIMS dimensions have at most XNN_MAX_TENSOR_DIMS / 2 groups of non-adjacent axes,
+// and reduce each group in a separate pass.
+#define XNN_MAX_REDUCE_PASSES (XNN_MAX_TENSOR_DIMS / 2)
+
 
 enum xnn_ukernel_type {
   xnn_ukernel_type_default = 0,
   xnn_ukernel_type_average_pooling,
+  xnn_ukernel_type_conv2d_hwc,
   xnn_ukernel_type_conv2d_hwc2chw,
   xnn_ukernel_type_dwconv,
   xnn_ukernel_type_gemm,
@@ -41,6 +49,7 @@ enum xnn_operator_type {
   xnn_operator_type_average_pooling_nhwc_f32,
   xnn_operator_type_average_pooling_nhwc_qu8,
   xnn_operator_type_bankers_rounding_nc_f32,
+  xnn_operator_type_batch_matrix_multiply_nc_f32,
   xnn_operator_type_channel_shuffle_nc_x8,
   xnn_operator_type_channel_shuffle_nc_x32,
   xnn_operator_type_clamp_nc_f32,
@@ -61,6 +70,7 @@ enum xnn_operator_type {
   xnn_operator_type_convolution_nhwc_qc8,
   xnn_operator_type_convolution_nhwc_qs8,
   xnn_operator_type_convolution_nhwc_qu8,
+  xnn_operator_type_copy_nc_x8,
   xnn_operator_type_copy_nc_x32,
   xnn_operator_type_deconvolution_nhwc_f32,
   xnn_operator_type_deconvolution_nhwc_qs8,
@@ -75,6 +85,11 @@ enum xnn_operator_type {
   xnn_operator_type_fully_connected_nc_qs8,
   xnn_operator_type_fully_connected_nc_qu8,
   xnn_operator_type_floor_nc_f32,
+  xnn_operator_type_gather_nd_qs8_f32,
+  xnn_operator_type_gather_nd_qu8_f32,
+  xnn_operator_type_gather_nd_x8,
+  xnn_operator_type_gather_nd_x32,
+  xnn_operator_type_gelu_nc_f32,
   xnn_operator_type_global_average_pooling_nwc_f16,
   xnn_operator_type_global_average_pooling_nwc_f32,
   xnn_operator_type_global_average_pooling_nwc_qs8,
@@ -82,6 +97,7 @@ enum xnn_operator_type {
   xnn_operator_type_global_average_pooling_ncw_f32,
   xnn_operator_type_hardswish_nc_f16,
   xnn_operator_type_hardswish_nc_f32,
+  xnn_operator_type_layer_normalization_nc_f32,
   xnn_operator_type_leaky_relu_nc_f32,
   xnn_operator_type_leaky_relu_nc_qu8,
   xnn_operator_type_max_pooling_nhwc_f32,
@@ -95,6 +111,8 @@ enum xnn_operator_type {
   xnn_operator_type_multiply_nd_qu8,
   xnn_operator_type_negate_nc_f32,
   xnn_operator_type_prelu_nc_f32,
+  xnn_operator_type_reduce_nd_f32,
+  xnn_operator_type_reduce_nd_qs8,
   xnn_operator_type_resize_bilinear_nchw_f32,
   xnn_operator_type_resize_bilinear_nhwc_f32,
   xnn_operator_type_resize_bilinear_nhwc_s8,
@@ -102,6 +120,8 @@ enum xnn_operator_type {
   xnn_operator_type_sigmoid_nc_f32,
   xnn_operator_type_sigmoid_nc_qs8,
   xnn_operator_type_sigmoid_nc_qu8,
+  xnn_operator_type_slice_nd_x8,
+  xnn_operator_type_slice_nd_x32,
   xnn_operator_type_softmax_nc_f32,
   xnn_operator_type_softmax_nc_qu8,
   xnn_operator_type_square_nc_f32,
@@ -110,8 +130,12 @@ enum xnn_operator_type {
   xnn_operator_type_subtract_nd_f32,
   xnn_operator_type_subtract_nd_qs8,
   xnn_operator_type_subtract_nd_qu8,
+  xnn_operator_type_tanh_nc_f32,
   xnn_operator_type_tanh_nc_qs8,
   xnn_operator_type_tanh_nc_qu8,
+  xnn_operator_type_transpose_nd_x8,
+  xnn_operator_type_transpose_nd_x16,
+  xnn_operator_type_transpose_nd_x32,
   xnn_operator_type_truncation_nc_f32,
   xnn_operator_type_unpooling_nhwc_x32,
 };
@@ -121,6 +145,8 @@ struct xnn_ukernel_conv2d {
     xnn_conv_hwc2chw_ukernel_function hwc2chw_function;
     xnn_conv_hwc_ukernel_function hwc_function;
   };
+  // HWC micro-kernel for padding of 0 on the left side and 1 on the right side.
+  xnn_conv_hwc_ukernel_function hwc_asymm_function;
   uint8_t output_height_tile;
   uint8_t output_channel_tile;
 };
@@ -248,6 +274,8 @@ struct xnn_operator {
   void* output;
 
   void* packed_weights;
+  // Weights cache owning the packed weights, or NULL if the packed weights are owned by the operator.
+  xnn_weights_cache_t weights_cache;
   // Total number of non-zero kernel elements when weights use sparse representation.
   size_t num_nonzero_values;
   // Total number of non-zero kernel blocks when weights use sparse representation.
@@ -256,6 +284,8 @@ struct xnn_operator {
   size_t num_output_channel_blocks;
   // Input channel corresponding to the first non-zero kernel element.
   size_t first_input_channel;
+  // Size of the packed weights buffer when weights are packed in setup rather than in create.
+  size_t packed_weights_size;
 
   float input_scale;
   float output_scale;
@@ -274,6 +304,12 @@ struct xnn_operator {
 
   uint32_t block_size;
 
+  // Reduction computed by the Reduce operator.
+  enum xnn_reduce_operator reduce_operator;
+  // Intermediate tensors of the Reduce operator over non-adjacent axes, and their total size in bytes.
+  void* intermediate_buffer;
+  size_t intermediate_buffer_size;
+
   void* zero_buffer;
   void* lookup_table;
   void* pixelwise_buffer;
@@ -286,11 +322,18 @@ struct xnn_operator {
     union xnn_f32_abs_params f32_abs;
     union xnn_f32_default_params f32_default;
     union xnn_f32_elu_params f32_elu;
+    union xnn_f32_gelu_params f32_gelu;
+    // Layer Normalization keeps epsilon alongside the parameters of the normalization micro-kernel.
+    struct {
+      union xnn_f32_default_params f32_default;
+      float epsilon;
+    } f32_layer_norm;
     union xnn_f32_lrelu_params f32_lrelu;
     union xnn_f32_neg_params f32_neg;
     union xnn_f32_rnd_params f32_rnd;
     union xnn_f32_sigmoid_params f32_sigmoid;
     union xnn_f32_sqrt_params f32_sqrt;
+    union xnn_f32_tanh_params f32_tanh;
     // Parameters for Global Average Pooling in CHW layout
     union xnn_f32_gavgpool_params f32_gavgpool;
     union xnn_f32_hswish_params f32_hswish;
@@ -346,10 +389,13 @@ struct xnn_operator {
   struct xnn_ukernel ukernel;
 
   struct compute_parameters compute;
-  struct compute_parameters compute2;
+  // Computations that run after 'compute', one after another, e.g. passes of a reduction over non-adjacent axes.
+  // Computations of xnn_parallelization_type_invalid type are skipped.
+  struct compute_parameters extra_compute[XNN_MAX_EXTRA_COMPUTE];
   union {
     struct argmax_pooling_context argmax_pooling;
     struct average_pooling_context average_pooling;
+    struct batch_gemm_context batch_gemm;
     struct channel_shuffle_context channel_shuffle;
     struct conv2d_context conv2d;
     struct dwconv2d_context dwconv2d;
@@ -361,17 +407,33 @@ struct xnn_operator {
     struct global_average_pooling_nwc_context global_average_pooling_nwc;
     struct global_average_pooling_ncw_context global_average_pooling_ncw;
     struct igemm_context igemm;
+    struct layer_normalization_context layer_normalization;
     struct lut_contiguous_context lut_contiguous;
     struct lut_strided_context lut_strided;
     struct max_pooling_context max_pooling;
     struct pad_context pad;
     struct pixelwise_average_pooling_context pixelwise_average_pooling;
     struct prelu_context prelu;
+    struct reduce_max_contiguous_context reduce_max_contiguous;
+    struct reduce_max_discontiguous_context reduce_max_discontiguous;
+    // Contexts of the Reduce operator passes over groups of non-adjacent axes, and of the conversions of QS8 input and
+    // output to and from the F32 intermediate tensors of sum and mean reductions.
+    struct {
+      union {
+        struct global_average_pooling_nwc_context sum[XNN_MAX_REDUCE_PASSES];
+        struct reduce_max_discontiguous_context max[XNN_MAX_REDUCE_PASSES];
+      } passes;
+      struct univector_contiguous_context dequantize;
+      struct univector_contiguous_context quantize;
+    } reduce;
     struct resize_bilinear_context resize_bilinear;
     struct resize_bilinear_chw_context resize_bilinear_chw;
+    struct slice_context slice;
+    struct gather_context gather;
     struct spmm_context spmm;
     struct subconv_context subconv;
     struct subgemm_context subgemm;
+    struct transpose_context transpose;
     struct f32_three_pass_softmax_context f32_three_pass_softmax;
     struct u8_softmax_context u8_softmax;
     struct univector_contiguous_context univector_contiguous;
@@ -382,3 +444,8 @@ struct xnn_operator {
 
   enum xnn_run_state state;
 };
+
+#ifndef __cplusplus
+  // Validates inputs which are known only when the operator runs, i.e. dynamic indices of Gather operators.
+  XNN_PRIVATE enum xnn_status xnn_validate_operator_inputs(const struct xnn_operator* op);
+#endif
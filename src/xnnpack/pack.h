@@ -144,6 +144,18 @@ XNN_INTERNAL void xnn_pack_f32_gemm_io_w(
   float* packed_w,
   const void* params);
 
+XNN_INTERNAL void xnn_pack_f32_gemm_io_strided_w(
+  size_t nc,
+  size_t kc,
+  size_t nr,
+  size_t kr,
+  size_t sr,
+  size_t k_stride,
+  const float* k,
+  const float* b,
+  float* packed_w,
+  const void* params);
+
 XNN_INTERNAL void xnn_pack_f16_gemm_io_w(
   size_t nc,
   size_t kc,
@@ -590,6 +602,17 @@ XNN_INTERNAL void xnn_pack_f16_gemminc_goi_w(
   const void* params);
 
 
+typedef void (*xnn_pack_dconv_oki_w_function)(
+  size_t nc,
+  size_t kc,
+  size_t nr,
+  size_t kh,
+  size_t kw,
+  const void* k,
+  const void* b,
+  void* packed_w,
+  const void* params);
+
 XNN_INTERNAL void xnn_pack_f32_dconv_oki_w(
   size_t nc,
   size_t kc,
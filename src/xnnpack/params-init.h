@@ -40,6 +40,7 @@ DECLARE_INIT_QU8_CONV_MINMAX_PARAMS_FUNCTION(xnn_init_qu8_conv_minmax_fp32_scala
   DECLARE_INIT_QU8_CONV_MINMAX_PARAMS_FUNCTION(xnn_init_qu8_conv_minmax_fp32_sse2_params)
   DECLARE_INIT_QU8_CONV_MINMAX_PARAMS_FUNCTION(xnn_init_qu8_conv_minmax_fp32_avx2_params)
   DECLARE_INIT_QU8_CONV_MINMAX_PARAMS_FUNCTION(xnn_init_qu8_conv_minmax_fp32_avx512_params)
+  DECLARE_INIT_QU8_CONV_MINMAX_PARAMS_FUNCTION(xnn_init_qu8_conv_minmax_fp32_avx512vnni_params)
 #endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
 
 #if XNN_ARCH_WASMSIMD || XNN_ARCH_WASMRELAXEDSIMD
@@ -560,6 +561,42 @@ DECLARE_INIT_F32_LRELU_PARAMS_FUNCTION(xnn_init_f32_lrelu_scalar_params)
 #endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
 
 
+#define DECLARE_INIT_F32_GELU_PARAMS_FUNCTION(fn_name)      \
+  XNN_INTERNAL void fn_name(                                \
+    union xnn_f32_gelu_params params[XNN_MIN_ELEMENTS(1)]);
+
+DECLARE_INIT_F32_GELU_PARAMS_FUNCTION(xnn_init_f32_gelu_scalar_rational_13_8_params)
+
+#if XNN_ARCH_ARM || XNN_ARCH_ARM64
+  DECLARE_INIT_F32_GELU_PARAMS_FUNCTION(xnn_init_f32_gelu_neon_rational_13_8_params)
+#endif  // XNN_ARCH_ARM || XNN_ARCH_ARM64
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  DECLARE_INIT_F32_GELU_PARAMS_FUNCTION(xnn_init_f32_gelu_sse_rational_13_8_params)
+  DECLARE_INIT_F32_GELU_PARAMS_FUNCTION(xnn_init_f32_gelu_avx_rational_13_8_params)
+  DECLARE_INIT_F32_GELU_PARAMS_FUNCTION(xnn_init_f32_gelu_avx512_rational_13_8_params)
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#define DECLARE_INIT_F32_TANH_PARAMS_FUNCTION(fn_name)      \
+  XNN_INTERNAL void fn_name(                                \
+    union xnn_f32_tanh_params params[XNN_MIN_ELEMENTS(1)]);
+
+DECLARE_INIT_F32_TANH_PARAMS_FUNCTION(xnn_init_f32_tanh_scalar_expm1minus_rr2_p6_params)
+
+#if XNN_ARCH_ARM || XNN_ARCH_ARM64
+  DECLARE_INIT_F32_TANH_PARAMS_FUNCTION(xnn_init_f32_tanh_neon_expm1minus_rr2_p6_params)
+  DECLARE_INIT_F32_TANH_PARAMS_FUNCTION(xnn_init_f32_tanh_neonfma_expm1minus_rr1_p6_params)
+#endif  // XNN_ARCH_ARM || XNN_ARCH_ARM64
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  DECLARE_INIT_F32_TANH_PARAMS_FUNCTION(xnn_init_f32_tanh_sse_expm1minus_rr2_p6_params)
+  DECLARE_INIT_F32_TANH_PARAMS_FUNCTION(xnn_init_f32_tanh_avx_expm1minus_rr2_p6_params)
+  DECLARE_INIT_F32_TANH_PARAMS_FUNCTION(xnn_init_f32_tanh_avx2_expm1minus_rr1_p6_params)
+  DECLARE_INIT_F32_TANH_PARAMS_FUNCTION(xnn_init_f32_tanh_avx512_expm1minus_rr1_p6_params)
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
 XNN_INTERNAL void xnn_init_f32_chw_params(
   union xnn_f32_chw_params params[XNN_MIN_ELEMENTS(1)],
   uint32_t width,
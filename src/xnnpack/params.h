@@ -794,6 +794,112 @@ union xnn_f32_sqrt_params {
 #endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
 };
 
+union xnn_f32_tanh_params {
+  struct {
+    float sat_cutoff;
+    float log2e;
+    float magic_bias;
+    float minus_ln2_hi;
+    float minus_ln2_lo;
+    float c6;
+    float c5;
+    float c4;
+    float c3;
+    float c2;
+    float one;
+    float minus_two;
+  } scalar_expm1minus_rr2_p6;
+#if XNN_ARCH_ARM || XNN_ARCH_ARM64
+  struct {
+    float sat_cutoff;
+    float log2e;
+    float magic_bias;
+    float minus_ln2_hi;
+    float minus_ln2_lo;
+    float c6;
+    float c5;
+    float c4;
+    float c3;
+    float c2;
+    float minus_two;
+  } neon_expm1minus_rr2_p6;
+  struct {
+    float sat_cutoff;
+    float log2e;
+    float magic_bias;
+    float minus_ln2;
+    float c6;
+    float c5;
+    float c4;
+    float c3;
+    float c2;
+    float minus_two;
+  } neonfma_expm1minus_rr1_p6;
+#endif  // XNN_ARCH_ARM || XNN_ARCH_ARM64
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  struct {
+    XNN_ALIGN(16) float sign_mask[4];
+    XNN_ALIGN(16) float sat_cutoff[4];
+    XNN_ALIGN(16) float log2e[4];
+    XNN_ALIGN(16) float magic_bias[4];
+    XNN_ALIGN(16) float minus_ln2_hi[4];
+    XNN_ALIGN(16) float minus_ln2_lo[4];
+    XNN_ALIGN(16) float c6[4];
+    XNN_ALIGN(16) float c5[4];
+    XNN_ALIGN(16) float c4[4];
+    XNN_ALIGN(16) float c3[4];
+    XNN_ALIGN(16) float c2[4];
+    XNN_ALIGN(16) float one[4];
+    XNN_ALIGN(16) float minus_two[4];
+  } sse_expm1minus_rr2_p6;
+  struct {
+    XNN_ALIGN(32) float sign_mask[8];
+    XNN_ALIGN(32) float sat_cutoff[8];
+    XNN_ALIGN(32) float log2e[8];
+    XNN_ALIGN(32) float magic_bias[8];
+    XNN_ALIGN(32) float minus_ln2_hi[8];
+    XNN_ALIGN(32) float minus_ln2_lo[8];
+    XNN_ALIGN(32) float c6[8];
+    XNN_ALIGN(32) float c5[8];
+    XNN_ALIGN(32) float c4[8];
+    XNN_ALIGN(32) float c3[8];
+    XNN_ALIGN(32) float c2[8];
+    XNN_ALIGN(32) float one[8];
+    XNN_ALIGN(32) float minus_two[8];
+    int32_t mask_table[14];
+  } avx_expm1minus_rr2_p6;
+  struct {
+    XNN_ALIGN(32) float sign_mask[8];
+    XNN_ALIGN(32) float sat_cutoff[8];
+    XNN_ALIGN(32) float log2e[8];
+    XNN_ALIGN(32) float magic_bias[8];
+    XNN_ALIGN(32) float minus_ln2[8];
+    XNN_ALIGN(32) float c6[8];
+    XNN_ALIGN(32) float c5[8];
+    XNN_ALIGN(32) float c4[8];
+    XNN_ALIGN(32) float c3[8];
+    XNN_ALIGN(32) float c2[8];
+    XNN_ALIGN(32) float one[8];
+    XNN_ALIGN(32) float minus_two[8];
+    int32_t mask_table[14];
+  } avx2_expm1minus_rr1_p6;
+  struct {
+    uint32_t sign_mask;
+    float sat_cutoff;
+    float log2e;
+    float magic_bias;
+    float minus_ln2;
+    float c6;
+    float c5;
+    float c4;
+    float c3;
+    float c2;
+    float one;
+    float minus_two;
+  } avx512_expm1minus_rr1_p6;
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+};
+
 union xnn_f32_chw_params {
   struct {
     XNN_ALIGN(16) int32_t mask_even[4]; // used by stride 2 kernels
@@ -818,6 +924,9 @@ union xnn_f32_chw_params {
     XNN_ALIGN(16) uint32_t mask_even[4]; // used by stride 2 kernels
     XNN_ALIGN(16) uint32_t mask_odd[4];  // used by stride 2 kernels
     XNN_ALIGN(16) uint32_t mask[4]; // used by stride 1 kernels
+    XNN_ALIGN(32) uint32_t mask_even8[8]; // used by AVX stride 2 kernels
+    XNN_ALIGN(32) uint32_t mask_odd8[8];  // used by AVX stride 2 kernels
+    XNN_ALIGN(32) uint32_t mask8[8]; // used by AVX stride 1 kernels
   } sse;
 #endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
 };
@@ -935,6 +1044,109 @@ union xnn_f16_hswish_params {
 #endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
 };
 
+union xnn_f32_gelu_params {
+  struct {
+    float minus_cutoff;
+    float cutoff;
+    float alpha13;
+    float alpha11;
+    float alpha9;
+    float alpha7;
+    float alpha5;
+    float alpha3;
+    float alpha1;
+    float beta8;
+    float beta6;
+    float beta4;
+    float beta2;
+    float beta0;
+    float minus_one;
+    float one;
+    float half;
+  } scalar_rational_13_8;
+#if XNN_ARCH_ARM || XNN_ARCH_ARM64
+  struct {
+    float minus_cutoff;
+    float cutoff;
+    float alpha13;
+    float alpha11;
+    float alpha9;
+    float alpha7;
+    float alpha5;
+    float alpha3;
+    float alpha1;
+    float beta8;
+    float beta6;
+    float beta4;
+    float beta2;
+    float beta0;
+    float minus_one;
+    float one;
+    float half;
+  } neon_rational_13_8;
+#endif  // XNN_ARCH_ARM || XNN_ARCH_ARM64
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  struct {
+    XNN_ALIGN(16) float minus_cutoff[4];
+    XNN_ALIGN(16) float cutoff[4];
+    XNN_ALIGN(16) float alpha13[4];
+    XNN_ALIGN(16) float alpha11[4];
+    XNN_ALIGN(16) float alpha9[4];
+    XNN_ALIGN(16) float alpha7[4];
+    XNN_ALIGN(16) float alpha5[4];
+    XNN_ALIGN(16) float alpha3[4];
+    XNN_ALIGN(16) float alpha1[4];
+    XNN_ALIGN(16) float beta8[4];
+    XNN_ALIGN(16) float beta6[4];
+    XNN_ALIGN(16) float beta4[4];
+    XNN_ALIGN(16) float beta2[4];
+    XNN_ALIGN(16) float beta0[4];
+    XNN_ALIGN(16) float minus_one[4];
+    XNN_ALIGN(16) float one[4];
+    XNN_ALIGN(16) float half[4];
+  } sse_rational_13_8;
+  struct {
+    XNN_ALIGN(32) float minus_cutoff[8];
+    XNN_ALIGN(32) float cutoff[8];
+    XNN_ALIGN(32) float alpha13[8];
+    XNN_ALIGN(32) float alpha11[8];
+    XNN_ALIGN(32) float alpha9[8];
+    XNN_ALIGN(32) float alpha7[8];
+    XNN_ALIGN(32) float alpha5[8];
+    XNN_ALIGN(32) float alpha3[8];
+    XNN_ALIGN(32) float alpha1[8];
+    XNN_ALIGN(32) float beta8[8];
+    XNN_ALIGN(32) float beta6[8];
+    XNN_ALIGN(32) float beta4[8];
+    XNN_ALIGN(32) float beta2[8];
+    XNN_ALIGN(32) float beta0[8];
+    XNN_ALIGN(32) float minus_one[8];
+    XNN_ALIGN(32) float one[8];
+    XNN_ALIGN(32) float half[8];
+    int32_t mask_table[14];
+  } avx_rational_13_8;
+  struct {
+    float minus_cutoff;
+    float cutoff;
+    float alpha13;
+    float alpha11;
+    float alpha9;
+    float alpha7;
+    float alpha5;
+    float alpha3;
+    float alpha1;
+    float beta8;
+    float beta6;
+    float beta4;
+    float beta2;
+    float beta0;
+    float minus_one;
+    float one;
+    float half;
+  } avx512_rational_13_8;
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+};
+
 union xnn_f32_hswish_params {
   struct {
     float sixth;
@@ -1040,6 +1252,13 @@ union xnn_qu8_conv_minmax_params {
     XNN_ALIGN(64) int16_t output_zero_point[32];
     XNN_ALIGN(64) uint8_t output_min[64];
   } fp32_avx512;
+  struct {
+    XNN_ALIGN(64) int32_t offset_less_kernel_zero_point[16];
+    XNN_ALIGN(64) float scale[16];
+    XNN_ALIGN(64) float output_max_less_zero_point[16];
+    XNN_ALIGN(64) int16_t output_zero_point[32];
+    XNN_ALIGN(64) uint8_t output_min[64];
+  } fp32_avx512vnni;
 #endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
 #if XNN_ARCH_WASMSIMD || XNN_ARCH_WASMRELAXEDSIMD
   struct {
@@ -2132,6 +2351,14 @@ typedef void (*xnn_x64_transpose_ukernel_function)(
     size_t block_width,
     size_t block_height);
 
+typedef void (*xnn_transposec_ukernel_function)(
+    const void* a,
+    void* b,
+    size_t input_stride,
+    size_t output_stride,
+    size_t block_width,
+    size_t block_height);
+
 typedef void (*xnn_f32_gemm_relu_ukernel_function)(
     size_t mr,
     size_t nr,
@@ -3076,6 +3303,12 @@ typedef void (*xnn_f32_vabs_ukernel_function)(
     float* y,
     const union xnn_f32_abs_params* params);
 
+typedef void (*xnn_f32_vgelu_ukernel_function)(
+    size_t n,
+    const float* x,
+    float* y,
+    const union xnn_f32_gelu_params* params);
+
 typedef void (*xnn_f32_vhswish_ukernel_function)(
     size_t n,
     const float* x,
@@ -3106,6 +3339,12 @@ typedef void (*xnn_f32_vsigmoid_ukernel_function)(
     float* y,
     const union xnn_f32_sigmoid_params* params);
 
+typedef void (*xnn_f32_vtanh_ukernel_function)(
+    size_t n,
+    const float* x,
+    float* y,
+    const union xnn_f32_tanh_params* params);
+
 typedef void (*xnn_rmax_ukernel_function)(
     size_t n,
     const void* x,
@@ -3121,6 +3360,36 @@ typedef void (*xnn_f32_rmax_ukernel_function)(
     const float* x,
     float* y);
 
+typedef void (*xnn_rdmax_ukernel_function)(
+    size_t rows,
+    size_t channels,
+    const void* input,
+    size_t input_stride,
+    void* output,
+    const void* params);
+
+typedef void (*xnn_f32_rdmax_ukernel_function)(
+    size_t rows,
+    size_t channels,
+    const float* input,
+    size_t input_stride,
+    float* output,
+    const union xnn_f32_default_params* params);
+
+typedef void (*xnn_s8_rdmax_minmax_ukernel_function)(
+    size_t rows,
+    size_t channels,
+    const int8_t* input,
+    size_t input_stride,
+    int8_t* output,
+    const union xnn_s8_minmax_params* params);
+
+typedef void (*xnn_f32_rmeanvar_ukernel_function)(
+    size_t n,
+    const float* x,
+    float* mean,
+    float* variance);
+
 typedef void (*xnn_u8_lut32norm_ukernel_function)(
     size_t n,
     const uint8_t* x,
@@ -3360,6 +3629,15 @@ typedef void (*xnn_f32_raddstoreexpminusmax_ukernel_function)(
     float* sum,
     const union xnn_f32_expminus_params* params);
 
+typedef void (*xnn_f32_vnormcaddc_ukernel_function)(
+    size_t channels,
+    const float* input,
+    const float* mean,
+    const float* inv_stddev,
+    const float* weights,
+    float* output,
+    const union xnn_f32_default_params* params);
+
 typedef void (*xnn_f32_vscaleexpminusmax_ukernel_function)(
     size_t n,
     const float* input,
@@ -3535,6 +3813,9 @@ typedef void (*xnn_init_f32_elu_params_fn)(
   float alpha,
   float beta);
 
+typedef void (*xnn_init_f32_gelu_params_fn)(
+  union xnn_f32_gelu_params params[XNN_MIN_ELEMENTS(1)]);
+
 typedef void (*xnn_init_f32_hswish_params_fn)(
   union xnn_f32_hswish_params params[XNN_MIN_ELEMENTS(1)]);
 
@@ -3569,6 +3850,9 @@ typedef void (*xnn_init_f32_sigmoid_params_fn)(
 typedef void (*xnn_init_f32_sqrt_params_fn)(
   union xnn_f32_sqrt_params params[XNN_MIN_ELEMENTS(1)]);
 
+typedef void (*xnn_init_f32_tanh_params_fn)(
+  union xnn_f32_tanh_params params[XNN_MIN_ELEMENTS(1)]);
+
 typedef void (*xnn_init_s8_minmax_params_fn)(
   union xnn_s8_minmax_params params[XNN_MIN_ELEMENTS(1)],
   int8_t output_min,
@@ -3670,6 +3954,7 @@ struct vunary_parameters {
     xnn_init_f32_default_params_fn f32_default;
     xnn_init_f32_elu_params_fn f32_elu;
     xnn_init_f32_f16_cvt_params_fn f32_f16_cvt;
+    xnn_init_f32_gelu_params_fn f32_gelu;
     xnn_init_f32_hswish_params_fn f32_hswish;
     xnn_init_f32_lrelu_params_fn f32_lrelu;
     xnn_init_f32_minmax_params_fn f32_minmax;
@@ -3679,6 +3964,7 @@ struct vunary_parameters {
     xnn_init_f32_rnd_params_fn f32_rnd;
     xnn_init_f32_sigmoid_params_fn f32_sigmoid;
     xnn_init_f32_sqrt_params_fn f32_sqrt;
+    xnn_init_f32_tanh_params_fn f32_tanh;
     xnn_init_qs8_f32_cvt_params_fn qs8_f32_cvt;
     xnn_init_qu8_f32_cvt_params_fn qu8_f32_cvt;
     xnn_init_s8_minmax_params_fn s8_minmax;
@@ -3722,6 +4008,22 @@ struct spmm_parameters {
   uint8_t nr;
 };
 
+struct conv_hwc_parameters {
+  // Micro-kernel for padding of 1 on both the left and the right side.
+  xnn_conv_hwc_ukernel_function ukernel_with_symm_padding;
+  // Micro-kernel for padding of 0 on the left side and 1 on the right side.
+  xnn_conv_hwc_ukernel_function ukernel_with_asymm_padding;
+  union {
+    xnn_init_f32_minmax_params_fn f32;
+  } init;
+  // Number of output channels in a tile.
+  // This parameter must be passed as is to weight packing function.
+  uint8_t output_channel_tile;
+  // Number of output height pixels in a tile.
+  // For best efficiency, micro-kernel must produce a multiple of this number of rows in each call.
+  uint8_t output_height_tile;
+};
+
 struct conv_hwc2chw_parameters {
   xnn_conv_hwc2chw_ukernel_function ukernel_with_symm_padding;
   // Number of output channels in a tile.
@@ -3900,6 +4202,26 @@ struct raddstoreexpminusmax_parameters {
   uint8_t element_tile;
 };
 
+struct rdmax_parameters {
+  xnn_rdmax_ukernel_function ukernel;
+  union {
+    xnn_init_f32_default_params_fn f32;
+    xnn_init_s8_minmax_params_fn s8;
+  } init;
+  // Number of channels processed in one iteration of the micro-kernel main loop.
+  uint8_t channel_tile;
+};
+
+struct layer_norm_parameters {
+  // Single-pass reduction of a row to its mean and variance.
+  xnn_f32_rmeanvar_ukernel_function rmeanvar;
+  // Normalization of a row followed by per-channel scale and shift, with weights in the VMULCADDC layout.
+  xnn_f32_vnormcaddc_ukernel_function vnormcaddc;
+  xnn_init_f32_default_params_fn init;
+  // Number of channels in a tile of packed scale and shift weights.
+  uint8_t channel_tile;
+};
+
 struct fill_parameters {
   xnn_fill_ukernel_function ukernel;
   // Number of rows of inputs processed in one tile.
@@ -3914,6 +4236,13 @@ struct pad_parameters {
   uint8_t row_tile;
 };
 
+struct transpose_parameters {
+  xnn_transposec_ukernel_function const_size_ukernel;
+  // Size of the square block of elements transposed in one micro-kernel call.
+  // Blocks at the edges of the tensor may be smaller than this size.
+  uint8_t tile_size;
+};
+
 struct vmulcaddc_parameters {
   xnn_vmulcaddc_ukernel_function ukernel;
   union {
@@ -3994,6 +4323,8 @@ struct xnn_parameters {
     // Bilinear interpolation (2D).
     struct ibilinear_parameters ibilinear;
     struct maxpool_parameters maxpool;
+    // Maximum across strided rows of contiguous channels.
+    struct rdmax_parameters rdmax;
   } s8;
   struct {
     struct vunary_parameters clamp;
@@ -4006,7 +4337,11 @@ struct xnn_parameters {
   struct {
     xnn_x8_lut_ukernel_function lut;
     struct zip_parameters zip;
+    struct transpose_parameters transpose;
   } x8;
+  struct {
+    struct transpose_parameters transpose;
+  } x16;
   struct {
     struct gavgpool_parameters gavgpool;
     struct gemm_parameters gemm;
@@ -4031,6 +4366,7 @@ struct xnn_parameters {
     struct vunary_parameters abs;
     struct vunary_parameters clamp;
     struct vunary_parameters elu;
+    struct vunary_parameters gelu;
     struct vunary_parameters hswish;
     struct vunary_parameters lrelu;
     struct vunary_parameters neg;
@@ -4042,6 +4378,7 @@ struct xnn_parameters {
     struct vunary_parameters sigmoid;
     struct vunary_parameters sqr;
     struct vunary_parameters sqrt;
+    struct vunary_parameters tanh;
     struct prelu_parameters prelu;
     struct vbinary_parameters vadd;
     struct vbinary_parameters vdiv;
@@ -4053,12 +4390,17 @@ struct xnn_parameters {
     struct vmulcaddc_parameters vmulcaddc;
     struct raddstoreexpminusmax_parameters raddstoreexpminusmax;
     xnn_f32_rmax_ukernel_function rmax;
+    // Maximum across strided rows of contiguous channels.
+    struct rdmax_parameters rdmax;
+    struct layer_norm_parameters layer_norm;
     // Sparse Matrix-Dense Matrix Multiplication (NR=1 block).
     struct spmm_parameters spmm;
     // Sparse Matrix-Dense Matrix Multiplication (NR=2 block).
     struct spmm_parameters spmm2;
     // Sparse Matrix-Dense Matrix Multiplication (NR=4 block).
     struct spmm_parameters spmm4;
+    // Direct 3x3 stride-2 Convolution with 3 input channels in HWC layout.
+    struct conv_hwc_parameters conv_hwc_3x3c3s2;
     // Direct 3x3 stride-2 Convolution with 3 input channels and HWC->CHW layout conversion.
     struct conv_hwc2chw_parameters conv_hwc2chw_3x3c3s2;
     // Direct 3x3 stride-1 Convolution with padding 1 on left and right in CHW layout.
@@ -4087,6 +4429,7 @@ struct xnn_parameters {
     struct zip_parameters zip;
     // Depth To Space 2D with CHW->HWC layout conversion.
     struct depthtospace2d_chw2hwc_parameters depthtospace2d_chw2hwc;
+    struct transpose_parameters transpose;
   } x32;
   struct {
     xnn_univector_ukernel_function copy;
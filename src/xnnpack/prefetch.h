@@ -0,0 +1,24 @@
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#pragma once
+
+#include <xnnpack/common.h>
+
+#if defined(_MSC_VER) && (XNN_ARCH_X86 || XNN_ARCH_X86_64)
+  #include <xmmintrin.h>
+#endif
+
+
+// Hint the processor to load the cache line with the address into all levels of the cache.
+XNN_INLINE static void xnn_prefetch_to_l1(const void* address) {
+#if defined(__GNUC__)
+  __builtin_prefetch(address, 0 /* read */, 3 /* high temporal locality */);
+#elif defined(_MSC_VER) && (XNN_ARCH_X86 || XNN_ARCH_X86_64)
+  _mm_prefetch((const char*) address, _MM_HINT_T0);
+#else
+  (void) address;
+#endif
+}
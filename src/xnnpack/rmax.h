@@ -12,6 +12,7 @@
 #include <stdint.h>
 
 #include <xnnpack/common.h>
+#include <xnnpack/params.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -44,6 +45,35 @@ DECLARE_U8_RMAX_UKERNEL_FUNCTION(xnn_u8_rmax_ukernel__sse2)
 DECLARE_U8_RMAX_UKERNEL_FUNCTION(xnn_u8_rmax_ukernel__scalar)
 
 
+#define DECLARE_F32_RDMAX_UKERNEL_FUNCTION(fn_name) \
+  XNN_INTERNAL void fn_name(                        \
+      size_t rows,                                  \
+      size_t channels,                              \
+      const float* input,                           \
+      size_t input_stride,                          \
+      float* output,                                \
+      const union xnn_f32_default_params* params);
+
+DECLARE_F32_RDMAX_UKERNEL_FUNCTION(xnn_f32_rdmax_ukernel_c16__neon)
+DECLARE_F32_RDMAX_UKERNEL_FUNCTION(xnn_f32_rdmax_ukernel_c16__sse)
+DECLARE_F32_RDMAX_UKERNEL_FUNCTION(xnn_f32_rdmax_ukernel_c4__scalar)
+
+
+#define DECLARE_S8_RDMAX_MINMAX_UKERNEL_FUNCTION(fn_name) \
+  XNN_INTERNAL void fn_name(                              \
+      size_t rows,                                        \
+      size_t channels,                                    \
+      const int8_t* input,                                \
+      size_t input_stride,                                \
+      int8_t* output,                                     \
+      const union xnn_s8_minmax_params* params);
+
+DECLARE_S8_RDMAX_MINMAX_UKERNEL_FUNCTION(xnn_s8_rdmax_minmax_ukernel_c16__neon)
+DECLARE_S8_RDMAX_MINMAX_UKERNEL_FUNCTION(xnn_s8_rdmax_minmax_ukernel_c16__sse2)
+DECLARE_S8_RDMAX_MINMAX_UKERNEL_FUNCTION(xnn_s8_rdmax_minmax_ukernel_c16__sse41)
+DECLARE_S8_RDMAX_MINMAX_UKERNEL_FUNCTION(xnn_s8_rdmax_minmax_ukernel_c4__scalar)
+
+
 #ifdef __cplusplus
 }  // extern "C"
 #endif
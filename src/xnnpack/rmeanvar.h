@@ -0,0 +1,34 @@
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <xnnpack/common.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+#define DECLARE_F32_RMEANVAR_UKERNEL_FUNCTION(fn_name) \
+  XNN_INTERNAL void fn_name(                           \
+      size_t n,                                        \
+      const float* x,                                  \
+      float* mean,                                     \
+      float* variance);
+
+DECLARE_F32_RMEANVAR_UKERNEL_FUNCTION(xnn_f32_rmeanvar_ukernel__neon)
+DECLARE_F32_RMEANVAR_UKERNEL_FUNCTION(xnn_f32_rmeanvar_ukernel__sse)
+DECLARE_F32_RMEANVAR_UKERNEL_FUNCTION(xnn_f32_rmeanvar_ukernel__avx)
+DECLARE_F32_RMEANVAR_UKERNEL_FUNCTION(xnn_f32_rmeanvar_ukernel__avx512f)
+DECLARE_F32_RMEANVAR_UKERNEL_FUNCTION(xnn_f32_rmeanvar_ukernel__scalar)
+
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
@@ -10,11 +10,13 @@
 
 #include <xnnpack.h>
 
-#define XNN_MAX_INPUTS 3
-#define XNN_MAX_OUTPUTS 2
+#define XNN_MAX_INPUTS 4
+#define XNN_MAX_OUTPUTS 4
 
-#define XNN_MAX_RUNTIME_INPUTS 2
-#define XNN_MAX_RUNTIME_OUTPUTS 2
+#define XNN_MAX_RUNTIME_INPUTS 4
+#define XNN_MAX_RUNTIME_OUTPUTS 4
+
+#define XNN_MAX_OPERATOR_OBJECTS 4
 
 #define XNN_INVALID_NODE_ID UINT32_MAX
 
@@ -71,6 +73,9 @@ struct xnn_value {
   uint32_t flags;
   /// Static initialization data. Must be null for non-static values.
   const void* data;
+  /// Whether the static initialization data was allocated during Subgraph optimization rather than provided by the
+  /// caller. Such data is owned by the Subgraph and released in xnn_delete_subgraph.
+  bool allocated_data;
   /// Index of the Subgraph node that produced the value, or XNN_INVALID_NODE_ID is the Value is an external input.
   uint32_t producer;
   /// Index of the first Node that consume the value, or XNN_INVALID_NODE_ID if the Value has no consumers within the
@@ -99,6 +104,13 @@ typedef enum xnn_status (*xnn_create_operator_fn)(
   const struct xnn_node* node,
   const struct xnn_value* values,
   size_t num_values,
+  struct xnn_operator_data* opdata,
+  xnn_weights_cache_t weights_cache);
+
+typedef enum xnn_status (*xnn_reshape_operator_fn)(
+  const struct xnn_node* node,
+  struct xnn_value* values,
+  size_t num_values,
   struct xnn_operator_data* opdata);
 
 typedef enum xnn_status (*xnn_setup_operator_fn)(
@@ -126,8 +138,12 @@ enum xnn_node_type {
   xnn_node_type_argmax_pooling_2d,
   xnn_node_type_average_pooling_2d,
   xnn_node_type_bankers_rounding,
+  xnn_node_type_batch_matrix_multiply,
   xnn_node_type_ceiling,
   xnn_node_type_clamp,
+  xnn_node_type_concatenate2,
+  xnn_node_type_concatenate3,
+  xnn_node_type_concatenate4,
   xnn_node_type_convert,
   xnn_node_type_convolution_2d,
   xnn_node_type_deconvolution_2d,
@@ -135,10 +151,16 @@ enum xnn_node_type {
   xnn_node_type_depth_to_space,
   xnn_node_type_divide,
   xnn_node_type_elu,
+  xnn_node_type_even_split2,
+  xnn_node_type_even_split3,
+  xnn_node_type_even_split4,
   xnn_node_type_fully_connected,
   xnn_node_type_floor,
+  xnn_node_type_gather,
+  xnn_node_type_gelu,
   xnn_node_type_global_average_pooling_2d,
   xnn_node_type_hardswish,
+  xnn_node_type_layer_normalization,
   xnn_node_type_leaky_relu,
   xnn_node_type_max_pooling_2d,
   xnn_node_type_maximum2,
@@ -150,11 +172,14 @@ enum xnn_node_type {
   xnn_node_type_softmax,
   xnn_node_type_static_constant_pad,
   xnn_node_type_static_reshape,
+  xnn_node_type_static_slice,
   xnn_node_type_static_resize_bilinear_2d,
+  xnn_node_type_static_transpose,
   xnn_node_type_square,
   xnn_node_type_square_root,
   xnn_node_type_squared_difference,
   xnn_node_type_subtract,
+  xnn_node_type_tanh,
   xnn_node_type_unpooling_2d,
 };
 
@@ -164,6 +189,9 @@ struct xnn_node {
   enum xnn_compute_type compute_type;
   /// Static parameters of the operator node.
   union {
+    struct {
+      size_t axis;
+    } concatenate;
     struct {
       uint32_t input_padding_top;
       uint32_t input_padding_right;
@@ -228,6 +256,15 @@ struct xnn_node {
     struct {
       float alpha;
     } elu;
+    struct {
+      size_t axis;
+    } even_split;
+    struct {
+      size_t axis;
+    } gather;
+    struct {
+      float epsilon;
+    } layer_normalization;
     struct {
       float negative_slope;
     } leaky_relu;
@@ -243,6 +280,16 @@ struct xnn_node {
       size_t new_height;
       size_t new_width;
     } static_resize;
+    struct {
+      size_t offsets[XNN_MAX_TENSOR_DIMS];
+      size_t sizes[XNN_MAX_TENSOR_DIMS];
+      size_t strides[XNN_MAX_TENSOR_DIMS];
+      size_t num_dims;
+    } static_slice;
+    struct {
+      size_t perm[XNN_MAX_TENSOR_DIMS];
+      size_t num_dims;
+    } transpose;
   } params;
   struct {
     float output_min;
@@ -265,12 +312,16 @@ struct xnn_node {
   size_t num_zeroes;
   // Factory function to create an operator object from the node.
   xnn_create_operator_fn create;
+  // Function to compute output shapes of the node and update opdata after shapes of its inputs change.
+  xnn_reshape_operator_fn reshape;
   // Function to setup an operator using opdata.
   xnn_setup_operator_fn setup;
 };
 
 struct xnn_operator_data {
-  xnn_operator_t operator_object;
+  // Operators that implement the Node, run one after another. Unused trailing entries are NULL, and a NULL first
+  // entry denotes a Node removed during optimization.
+  xnn_operator_t operator_objects[XNN_MAX_OPERATOR_OBJECTS];
   xnn_setup_operator_fn setup;
   size_t batch_size;
   size_t input_height;
@@ -281,10 +332,24 @@ struct xnn_operator_data {
   struct xnn_shape shape2;
   size_t pre_paddings[XNN_MAX_TENSOR_DIMS];
   size_t post_paddings[XNN_MAX_TENSOR_DIMS];
+  size_t perm[XNN_MAX_TENSOR_DIMS];
+  size_t offsets[XNN_MAX_TENSOR_DIMS];
+  size_t sizes[XNN_MAX_TENSOR_DIMS];
+  size_t strides[XNN_MAX_TENSOR_DIMS];
+  // Axis of the input tensor that a Gather Node indexes.
+  size_t axis;
+  // Whether the indices of a Gather Node are static, and thus can be validated when the Node is set up.
+  bool static_indices;
+  // Number of elements in each slice of a Concatenate or Even Split Node per element of the dimensions before the axis.
+  size_t slice_channels[XNN_MAX_OPERATOR_OBJECTS];
   uint32_t adjustment_height;
   uint32_t adjustment_width;
   uint32_t inputs[XNN_MAX_RUNTIME_INPUTS];
   uint32_t outputs[XNN_MAX_RUNTIME_OUTPUTS];
+  // Total size in bytes of the input and output tensors of the Node, reported when profiling is enabled.
+  size_t num_bytes;
+  // Timestamp, in nanoseconds, when the operator finished executing in the last invocation with profiling enabled.
+  uint64_t end_ts;
 };
 
 struct xnn_subgraph {
@@ -301,6 +366,27 @@ struct xnn_subgraph {
   struct xnn_node* nodes;
 };
 
+/// Group of consecutive operators in the execution plan that don't depend on each other's outputs.
+struct xnn_operator_level {
+  /// Index of the first operator of the level in the execution plan.
+  size_t first_op;
+  /// Number of operators in the level, including operators removed during optimization.
+  size_t num_ops;
+  /// Whether operators in the level run concurrently, each on a single thread, rather than one after another.
+  bool concurrent;
+};
+
+/// Memory arena for internal Values, shared by Runtime objects which don't run concurrently.
+struct xnn_workspace {
+  void* data;
+  /// Size in bytes of the data allocation.
+  size_t size;
+  /// Runtime objects bound to the workspace, linked through xnn_runtime.next_workspace_user.
+  struct xnn_runtime* first_user;
+  /// Number of references to the workspace: one held by the creator, and one by each Runtime object bound to it.
+  size_t ref_count;
+};
+
 /// Runtime is a combination of an execution plan for subgraph Nodes and a memory manager for subgraph Values.
 struct xnn_runtime {
   uint32_t num_external_values;
@@ -310,12 +396,45 @@ struct xnn_runtime {
   /// Number of operators in the execution plan.
   size_t num_ops;
 
+  /// Levels of independent operators in the execution plan, or NULL if operators run one after another.
+  struct xnn_operator_level* levels;
+  /// Number of levels in the execution plan.
+  size_t num_levels;
+
+  /// Copies of the Subgraph Nodes, in the Subgraph order. Used to propagate shapes in xnn_reshape_runtime.
+  struct xnn_node* nodes;
+  size_t num_nodes;
+  /// Index of the Node executed as each operator, or NULL if operators execute in the Subgraph order.
+  uint32_t* execution_order;
+  /// Execution step of each Node for the memory planner, or NULL if Nodes execute one by one in the Subgraph order.
+  uint32_t* node_steps;
+
+  /// Copies of the Subgraph Values. Shapes of the Values are updated in xnn_reshape_runtime.
+  struct xnn_value* values;
   struct xnn_blob* blobs;
   size_t num_blobs;
 
-  void* workspace;
+  /// Whether the workspace is planned with the greedy-by-size strategy of the memory planner.
+  bool greedy_by_size_memory_planning;
+  /// Size of the workspace region planned for internal Values, in bytes.
+  size_t workspace_size;
+  /// Maximum total size of internal Values live at once, in bytes. No plan fits into a smaller workspace region.
+  size_t workspace_lower_bound;
+  xnn_workspace_t workspace;
+  /// Next Runtime object bound to the same workspace.
+  struct xnn_runtime* next_workspace_user;
+  /// Whether the Runtime was reshaped, or another Runtime object re-allocated the workspace, after the last call to
+  /// xnn_setup_runtime.
+  bool setup_pending;
+
+  /// Whether shapes of external inputs changed after the last successful call to xnn_reshape_runtime.
+  bool reshape_pending;
 
   pthreadpool_t threadpool;
+
+  bool profiling;
+  // Timestamp, in nanoseconds, when the last invocation with profiling enabled started.
+  uint64_t start_ts;
 };
 
 struct xnn_value* xnn_subgraph_new_internal_value(xnn_subgraph_t subgraph);
@@ -334,6 +453,21 @@ size_t xnn_shape_multiply_all_dims(
 size_t xnn_shape_multiply_non_channel_dims(
   const struct xnn_shape shape[1]);
 
+// Computes the output shape of a Node with a single input and output of the same shape, and updates the number of
+// pixels in opdata. Fails if the number of channels changes.
+enum xnn_status xnn_reshape_unary_elementwise_nc(
+  const struct xnn_node* node,
+  struct xnn_value* values,
+  size_t num_values,
+  struct xnn_operator_data* opdata);
+
+// Computes the broadcasted output shape of a Node with two inputs, and updates the shapes of the inputs in opdata.
+enum xnn_status xnn_reshape_binary_elementwise_nd(
+  const struct xnn_node* node,
+  struct xnn_value* values,
+  size_t num_values,
+  struct xnn_operator_data* opdata);
+
 enum xnn_status xnn_subgraph_optimize(xnn_subgraph_t subgraph, uint32_t flags);
 
 void xnn_subgraph_rewrite_for_nchw(xnn_subgraph_t subgraph);
@@ -0,0 +1,39 @@
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <xnnpack/params.h>
+#include <xnnpack/common.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+#define DECLARE_F32_VNORMCADDC_UKERNEL_FUNCTION(fn_name) \
+  XNN_INTERNAL void fn_name(                             \
+      size_t channels,                                   \
+      const float* input,                                \
+      const float* mean,                                 \
+      const float* inv_stddev,                           \
+      const float* weights,                              \
+      float* output,                                     \
+      const union xnn_f32_default_params* params);
+
+DECLARE_F32_VNORMCADDC_UKERNEL_FUNCTION(xnn_f32_vnormcaddc_ukernel_c8__neon)
+DECLARE_F32_VNORMCADDC_UKERNEL_FUNCTION(xnn_f32_vnormcaddc_ukernel_c8__neonfma)
+DECLARE_F32_VNORMCADDC_UKERNEL_FUNCTION(xnn_f32_vnormcaddc_ukernel_c8__sse)
+DECLARE_F32_VNORMCADDC_UKERNEL_FUNCTION(xnn_f32_vnormcaddc_ukernel_c16__avx)
+DECLARE_F32_VNORMCADDC_UKERNEL_FUNCTION(xnn_f32_vnormcaddc_ukernel_c32__avx512f)
+DECLARE_F32_VNORMCADDC_UKERNEL_FUNCTION(xnn_f32_vnormcaddc_ukernel_c4__scalar)
+
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
@@ -595,6 +595,99 @@ DECLARE_F32_VSQRT_UKERNEL_FUNCTION(xnn_f32_vsqrt_ukernel__scalar_sqrt_x2)
 DECLARE_F32_VSQRT_UKERNEL_FUNCTION(xnn_f32_vsqrt_ukernel__scalar_sqrt_x4)
 
 
+#define DECLARE_F32_VGELU_UKERNEL_FUNCTION(fn_name) \
+  XNN_INTERNAL void fn_name(                        \
+      size_t n,                                     \
+      const float* x,                               \
+      float* y,                                     \
+      const union xnn_f32_gelu_params* params);
+
+DECLARE_F32_VGELU_UKERNEL_FUNCTION(xnn_f32_vgelu_ukernel__neonfma_rational_13_8_div_x4)
+DECLARE_F32_VGELU_UKERNEL_FUNCTION(xnn_f32_vgelu_ukernel__neonfma_rational_13_8_div_x8)
+DECLARE_F32_VGELU_UKERNEL_FUNCTION(xnn_f32_vgelu_ukernel__neonfma_rational_13_8_div_x12)
+DECLARE_F32_VGELU_UKERNEL_FUNCTION(xnn_f32_vgelu_ukernel__neonfma_rational_13_8_div_x16)
+
+DECLARE_F32_VGELU_UKERNEL_FUNCTION(xnn_f32_vgelu_ukernel__neon_rational_13_8_nr2recps_x4)
+DECLARE_F32_VGELU_UKERNEL_FUNCTION(xnn_f32_vgelu_ukernel__neon_rational_13_8_nr2recps_x8)
+DECLARE_F32_VGELU_UKERNEL_FUNCTION(xnn_f32_vgelu_ukernel__neon_rational_13_8_nr2recps_x12)
+DECLARE_F32_VGELU_UKERNEL_FUNCTION(xnn_f32_vgelu_ukernel__neon_rational_13_8_nr2recps_x16)
+
+DECLARE_F32_VGELU_UKERNEL_FUNCTION(xnn_f32_vgelu_ukernel__sse2_rational_13_8_div_x4)
+DECLARE_F32_VGELU_UKERNEL_FUNCTION(xnn_f32_vgelu_ukernel__sse2_rational_13_8_div_x8)
+DECLARE_F32_VGELU_UKERNEL_FUNCTION(xnn_f32_vgelu_ukernel__sse2_rational_13_8_div_x12)
+DECLARE_F32_VGELU_UKERNEL_FUNCTION(xnn_f32_vgelu_ukernel__sse2_rational_13_8_div_x16)
+
+DECLARE_F32_VGELU_UKERNEL_FUNCTION(xnn_f32_vgelu_ukernel__avx2_rational_13_8_div_x8)
+DECLARE_F32_VGELU_UKERNEL_FUNCTION(xnn_f32_vgelu_ukernel__avx2_rational_13_8_div_x16)
+DECLARE_F32_VGELU_UKERNEL_FUNCTION(xnn_f32_vgelu_ukernel__avx2_rational_13_8_div_x24)
+DECLARE_F32_VGELU_UKERNEL_FUNCTION(xnn_f32_vgelu_ukernel__avx2_rational_13_8_div_x32)
+
+DECLARE_F32_VGELU_UKERNEL_FUNCTION(xnn_f32_vgelu_ukernel__avx512f_rational_13_8_div_x16)
+DECLARE_F32_VGELU_UKERNEL_FUNCTION(xnn_f32_vgelu_ukernel__avx512f_rational_13_8_div_x32)
+DECLARE_F32_VGELU_UKERNEL_FUNCTION(xnn_f32_vgelu_ukernel__avx512f_rational_13_8_div_x48)
+DECLARE_F32_VGELU_UKERNEL_FUNCTION(xnn_f32_vgelu_ukernel__avx512f_rational_13_8_div_x64)
+
+DECLARE_F32_VGELU_UKERNEL_FUNCTION(xnn_f32_vgelu_ukernel__scalar_rational_13_8_div_x1)
+DECLARE_F32_VGELU_UKERNEL_FUNCTION(xnn_f32_vgelu_ukernel__scalar_rational_13_8_div_x2)
+DECLARE_F32_VGELU_UKERNEL_FUNCTION(xnn_f32_vgelu_ukernel__scalar_rational_13_8_div_x4)
+
+#define DECLARE_F32_VTANH_UKERNEL_FUNCTION(fn_name) \
+  XNN_INTERNAL void fn_name(                        \
+      size_t n,                                     \
+      const float* x,                               \
+      float* y,                                     \
+      const union xnn_f32_tanh_params* params);
+
+DECLARE_F32_VTANH_UKERNEL_FUNCTION(xnn_f32_vtanh_ukernel__neonfma_expm1minus_rr1_p6_div_x4)
+DECLARE_F32_VTANH_UKERNEL_FUNCTION(xnn_f32_vtanh_ukernel__neonfma_expm1minus_rr1_p6_div_x8)
+DECLARE_F32_VTANH_UKERNEL_FUNCTION(xnn_f32_vtanh_ukernel__neonfma_expm1minus_rr1_p6_div_x12)
+DECLARE_F32_VTANH_UKERNEL_FUNCTION(xnn_f32_vtanh_ukernel__neonfma_expm1minus_rr1_p6_div_x16)
+
+DECLARE_F32_VTANH_UKERNEL_FUNCTION(xnn_f32_vtanh_ukernel__neonfma_expm1minus_rr1_p6_nr2fma_x4)
+DECLARE_F32_VTANH_UKERNEL_FUNCTION(xnn_f32_vtanh_ukernel__neonfma_expm1minus_rr1_p6_nr2fma_x8)
+DECLARE_F32_VTANH_UKERNEL_FUNCTION(xnn_f32_vtanh_ukernel__neonfma_expm1minus_rr1_p6_nr2fma_x12)
+DECLARE_F32_VTANH_UKERNEL_FUNCTION(xnn_f32_vtanh_ukernel__neonfma_expm1minus_rr1_p6_nr2fma_x16)
+
+DECLARE_F32_VTANH_UKERNEL_FUNCTION(xnn_f32_vtanh_ukernel__neonfma_expm1minus_rr1_p6_nr1recps1fma_x4)
+DECLARE_F32_VTANH_UKERNEL_FUNCTION(xnn_f32_vtanh_ukernel__neonfma_expm1minus_rr1_p6_nr1recps1fma_x8)
+DECLARE_F32_VTANH_UKERNEL_FUNCTION(xnn_f32_vtanh_ukernel__neonfma_expm1minus_rr1_p6_nr1recps1fma_x12)
+DECLARE_F32_VTANH_UKERNEL_FUNCTION(xnn_f32_vtanh_ukernel__neonfma_expm1minus_rr1_p6_nr1recps1fma_x16)
+
+DECLARE_F32_VTANH_UKERNEL_FUNCTION(xnn_f32_vtanh_ukernel__neonfma_expm1minus_rr1_p6_nr2recps_x4)
+DECLARE_F32_VTANH_UKERNEL_FUNCTION(xnn_f32_vtanh_ukernel__neonfma_expm1minus_rr1_p6_nr2recps_x8)
+DECLARE_F32_VTANH_UKERNEL_FUNCTION(xnn_f32_vtanh_ukernel__neonfma_expm1minus_rr1_p6_nr2recps_x12)
+DECLARE_F32_VTANH_UKERNEL_FUNCTION(xnn_f32_vtanh_ukernel__neonfma_expm1minus_rr1_p6_nr2recps_x16)
+
+DECLARE_F32_VTANH_UKERNEL_FUNCTION(xnn_f32_vtanh_ukernel__neon_expm1minus_rr2_p6_nr2recps_x4)
+DECLARE_F32_VTANH_UKERNEL_FUNCTION(xnn_f32_vtanh_ukernel__neon_expm1minus_rr2_p6_nr2recps_x8)
+DECLARE_F32_VTANH_UKERNEL_FUNCTION(xnn_f32_vtanh_ukernel__neon_expm1minus_rr2_p6_nr2recps_x12)
+DECLARE_F32_VTANH_UKERNEL_FUNCTION(xnn_f32_vtanh_ukernel__neon_expm1minus_rr2_p6_nr2recps_x16)
+
+DECLARE_F32_VTANH_UKERNEL_FUNCTION(xnn_f32_vtanh_ukernel__sse2_expm1minus_rr2_p6_div_x4)
+DECLARE_F32_VTANH_UKERNEL_FUNCTION(xnn_f32_vtanh_ukernel__sse2_expm1minus_rr2_p6_div_x8)
+DECLARE_F32_VTANH_UKERNEL_FUNCTION(xnn_f32_vtanh_ukernel__sse2_expm1minus_rr2_p6_div_x12)
+DECLARE_F32_VTANH_UKERNEL_FUNCTION(xnn_f32_vtanh_ukernel__sse2_expm1minus_rr2_p6_div_x16)
+
+DECLARE_F32_VTANH_UKERNEL_FUNCTION(xnn_f32_vtanh_ukernel__avx_expm1minus_rr2_p6_div_x8)
+DECLARE_F32_VTANH_UKERNEL_FUNCTION(xnn_f32_vtanh_ukernel__avx_expm1minus_rr2_p6_div_x16)
+DECLARE_F32_VTANH_UKERNEL_FUNCTION(xnn_f32_vtanh_ukernel__avx_expm1minus_rr2_p6_div_x24)
+DECLARE_F32_VTANH_UKERNEL_FUNCTION(xnn_f32_vtanh_ukernel__avx_expm1minus_rr2_p6_div_x32)
+
+DECLARE_F32_VTANH_UKERNEL_FUNCTION(xnn_f32_vtanh_ukernel__avx2_expm1minus_rr1_p6_div_x8)
+DECLARE_F32_VTANH_UKERNEL_FUNCTION(xnn_f32_vtanh_ukernel__avx2_expm1minus_rr1_p6_div_x16)
+DECLARE_F32_VTANH_UKERNEL_FUNCTION(xnn_f32_vtanh_ukernel__avx2_expm1minus_rr1_p6_div_x24)
+DECLARE_F32_VTANH_UKERNEL_FUNCTION(xnn_f32_vtanh_ukernel__avx2_expm1minus_rr1_p6_div_x32)
+
+DECLARE_F32_VTANH_UKERNEL_FUNCTION(xnn_f32_vtanh_ukernel__avx512f_expm1minus_rr1_p6_div_x16)
+DECLARE_F32_VTANH_UKERNEL_FUNCTION(xnn_f32_vtanh_ukernel__avx512f_expm1minus_rr1_p6_div_x32)
+DECLARE_F32_VTANH_UKERNEL_FUNCTION(xnn_f32_vtanh_ukernel__avx512f_expm1minus_rr1_p6_div_x48)
+DECLARE_F32_VTANH_UKERNEL_FUNCTION(xnn_f32_vtanh_ukernel__avx512f_expm1minus_rr1_p6_div_x64)
+
+DECLARE_F32_VTANH_UKERNEL_FUNCTION(xnn_f32_vtanh_ukernel__scalar_expm1minus_rr2_p6_div_x1)
+DECLARE_F32_VTANH_UKERNEL_FUNCTION(xnn_f32_vtanh_ukernel__scalar_expm1minus_rr2_p6_div_x2)
+DECLARE_F32_VTANH_UKERNEL_FUNCTION(xnn_f32_vtanh_ukernel__scalar_expm1minus_rr2_p6_div_x4)
+
+
 #define DECLARE_F32_VSIGMOID_UKERNEL_FUNCTION(fn_name) \
   XNN_INTERNAL void fn_name(                           \
       size_t n,                                        \
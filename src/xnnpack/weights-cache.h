@@ -0,0 +1,311 @@
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <xnnpack.h>
+#include <xnnpack/common.h>
+#include <xnnpack/operator.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Identifies packed weights: the static data they were packed from and everything that affects the packed layout.
+struct xnn_weights_cache_key {
+  const void* kernel;
+  const void* bias;
+  // Per-channel quantization scales, or NULL if scales are not packed with the weights.
+  const void* scale;
+  // Sizes, in bytes, of the kernel, bias, and scale data.
+  size_t kernel_size;
+  size_t bias_size;
+  size_t scale_size;
+  enum xnn_operator_type operator_type;
+  enum xnn_ukernel_type ukernel_type;
+  uint32_t flags;
+  uint32_t groups;
+  size_t group_input_channels;
+  size_t group_output_channels;
+  uint32_t kernel_height;
+  uint32_t kernel_width;
+  // Channel tile of the packed layout, i.e. NR for GEMM and IGEMM microkernels.
+  uint32_t nr;
+  uint32_t kr;
+  uint32_t sr;
+  // Packing parameters (e.g. zero points folded into the bias), zero-padded.
+  uint8_t packing_params[8];
+  size_t packed_weights_size;
+};
+
+// 128-bit hash of static data contents, which identifies static data across processes.
+struct xnn_weights_cache_fingerprint {
+  uint64_t low;
+  uint64_t high;
+};
+
+// Weights cache file, as written by xnn_save_weights_cache, consists of a header, followed by an array of entry
+// descriptors, followed by packed weights of all entries. All fields are in the native byte order.
+#define XNN_WEIGHTS_CACHE_FILE_MAGIC UINT32_C(0x574E4E58)
+#define XNN_WEIGHTS_CACHE_FILE_VERSION 3
+// Alignment of packed weights relative to the start of the file.
+#define XNN_WEIGHTS_CACHE_FILE_ALIGNMENT 64
+
+// Parameters of GEMM microkernels, which determine the packed layout of weights.
+struct xnn_weights_cache_file_gemm_layout {
+  uint32_t mr;
+  uint32_t nr;
+  uint32_t log2_kr;
+  uint32_t log2_sr;
+};
+
+struct xnn_weights_cache_file_header {
+  uint32_t magic;
+  uint32_t version;
+  uint32_t num_entries;
+  uint32_t reserved;
+  // GEMM parameters in xnn_params for F32, F16, QC8, QS8, and QU8 data types, in this order. The file is rejected
+  // unless these parameters match the microkernels selected for the running CPU.
+  struct xnn_weights_cache_file_gemm_layout gemm[5];
+};
+
+struct xnn_weights_cache_file_entry {
+  uint32_t operator_type;
+  uint32_t ukernel_type;
+  uint32_t flags;
+  uint32_t groups;
+  uint64_t group_input_channels;
+  uint64_t group_output_channels;
+  uint32_t kernel_height;
+  uint32_t kernel_width;
+  uint32_t nr;
+  uint32_t kr;
+  uint32_t sr;
+  uint8_t packing_params[8];
+  uint32_t reserved;
+  uint64_t kernel_size;
+  uint64_t bias_size;
+  uint64_t scale_size;
+  // Fingerprints of kernel, bias, and scale data, which substitute their addresses in a memory-mapped weights cache.
+  struct xnn_weights_cache_fingerprint kernel_fingerprint;
+  struct xnn_weights_cache_fingerprint bias_fingerprint;
+  struct xnn_weights_cache_fingerprint scale_fingerprint;
+  // Location of the packed weights, relative to the start of the file.
+  uint64_t offset;
+  uint64_t size;
+};
+
+// Fills the part of the key describing packing parameters.
+XNN_INTERNAL void xnn_weights_cache_key_set_packing_params(
+  struct xnn_weights_cache_key* key,
+  const void* packing_params,
+  size_t packing_params_size);
+
+// Looks up packed weights matching the key. On success, returns the packed weights and adds a reference to the
+// weights cache, which must be released with xnn_weights_cache_release. Returns NULL if the weights are not cached.
+XNN_INTERNAL void* xnn_weights_cache_lookup(
+  xnn_weights_cache_t weights_cache,
+  const struct xnn_weights_cache_key* key);
+
+// Transfers ownership of packed weights allocated with xnn_allocate_simd_memory to the weights cache. On success,
+// returns the cached copy of the packed weights and adds a reference to the weights cache, which must be released
+// with xnn_weights_cache_release. If a matching copy was inserted concurrently, the passed packed weights are released
+// and the existing copy is returned. Returns NULL if the weights cache is out of memory, in which case the caller
+// retains ownership of the packed weights.
+XNN_INTERNAL void* xnn_weights_cache_insert(
+  xnn_weights_cache_t weights_cache,
+  const struct xnn_weights_cache_key* key,
+  void* packed_weights);
+
+// Assigns cached packed weights matching the key to the operator. Returns false if the weights cache is NULL, or
+// the weights are not cached, in which case the operator must pack its own weights.
+XNN_INTERNAL bool xnn_weights_cache_get_operator_weights(
+  xnn_weights_cache_t weights_cache,
+  const struct xnn_weights_cache_key* key,
+  xnn_operator_t op);
+
+// Transfers ownership of the operator packed weights to the weights cache, so operators created later with the same
+// key can share them. Does nothing if the weights cache is NULL or out of memory.
+XNN_INTERNAL void xnn_weights_cache_put_operator_weights(
+  xnn_weights_cache_t weights_cache,
+  const struct xnn_weights_cache_key* key,
+  xnn_operator_t op);
+
+// Releases a reference to the weights cache acquired in xnn_weights_cache_lookup or xnn_weights_cache_insert.
+XNN_INTERNAL void xnn_weights_cache_release(
+  xnn_weights_cache_t weights_cache);
+
+// Variants of operator factory functions that share packed weights through a weights cache. A NULL weights cache
+// gives the same operator as the corresponding public factory function.
+
+enum xnn_status xnn_create_convolution2d_nhwc_qu8_with_cache(
+    uint32_t input_padding_top,
+    uint32_t input_padding_right,
+    uint32_t input_padding_bottom,
+    uint32_t input_padding_left,
+    uint32_t kernel_height,
+    uint32_t kernel_width,
+    uint32_t subsampling_height,
+    uint32_t subsampling_width,
+    uint32_t dilation_height,
+    uint32_t dilation_width,
+    uint32_t groups,
+    size_t group_input_channels,
+    size_t group_output_channels,
+    size_t input_channel_stride,
+    size_t output_channel_stride,
+    uint8_t input_zero_point,
+    float input_scale,
+    uint8_t kernel_zero_point,
+    float kernel_scale,
+    const uint8_t* kernel,
+    const int32_t* bias,
+    uint8_t output_zero_point,
+    float output_scale,
+    uint8_t output_min,
+    uint8_t output_max,
+    uint32_t flags,
+    xnn_weights_cache_t weights_cache,
+    xnn_operator_t* convolution_op_out);
+
+enum xnn_status xnn_create_convolution2d_nhwc_qs8_with_cache(
+    uint32_t input_padding_top,
+    uint32_t input_padding_right,
+    uint32_t input_padding_bottom,
+    uint32_t input_padding_left,
+    uint32_t kernel_height,
+    uint32_t kernel_width,
+    uint32_t subsampling_height,
+    uint32_t subsampling_width,
+    uint32_t dilation_height,
+    uint32_t dilation_width,
+    uint32_t groups,
+    size_t group_input_channels,
+    size_t group_output_channels,
+    size_t input_channel_stride,
+    size_t output_channel_stride,
+    int8_t input_zero_point,
+    float input_scale,
+    float kernel_scale,
+    const int8_t* kernel,
+    const int32_t* bias,
+    int8_t output_zero_point,
+    float output_scale,
+    int8_t output_min,
+    int8_t output_max,
+    uint32_t flags,
+    xnn_weights_cache_t weights_cache,
+    xnn_operator_t* convolution_op_out);
+
+enum xnn_status xnn_create_convolution2d_nhwc_qc8_with_cache(
+    uint32_t input_padding_top,
+    uint32_t input_padding_right,
+    uint32_t input_padding_bottom,
+    uint32_t input_padding_left,
+    uint32_t kernel_height,
+    uint32_t kernel_width,
+    uint32_t subsampling_height,
+    uint32_t subsampling_width,
+    uint32_t dilation_height,
+    uint32_t dilation_width,
+    uint32_t groups,
+    size_t group_input_channels,
+    size_t group_output_channels,
+    size_t input_channel_stride,
+    size_t output_channel_stride,
+    int8_t input_zero_point,
+    float input_scale,
+    const float* kernel_scale,
+    const int8_t* kernel,
+    const int32_t* bias,
+    int8_t output_zero_point,
+    float output_scale,
+    int8_t output_min,
+    int8_t output_max,
+    uint32_t flags,
+    xnn_weights_cache_t weights_cache,
+    xnn_operator_t* convolution_op_out);
+
+enum xnn_status xnn_create_convolution2d_nhwc_f32_with_cache(
+    uint32_t input_padding_top,
+    uint32_t input_padding_right,
+    uint32_t input_padding_bottom,
+    uint32_t input_padding_left,
+    uint32_t kernel_height,
+    uint32_t kernel_width,
+    uint32_t subsampling_height,
+    uint32_t subsampling_width,
+    uint32_t dilation_height,
+    uint32_t dilation_width,
+    uint32_t groups,
+    size_t group_input_channels,
+    size_t group_output_channels,
+    size_t input_channel_stride,
+    size_t output_channel_stride,
+    const float* kernel,
+    const float* bias,
+    float output_min,
+    float output_max,
+    uint32_t flags,
+    xnn_weights_cache_t weights_cache,
+    xnn_operator_t* convolution_op_out);
+
+enum xnn_status xnn_create_fully_connected_nc_qu8_with_cache(
+    size_t input_channels,
+    size_t output_channels,
+    size_t input_stride,
+    size_t output_stride,
+    uint8_t input_zero_point,
+    float input_scale,
+    uint8_t kernel_zero_point,
+    float kernel_scale,
+    const uint8_t* kernel,
+    const int32_t* bias,
+    uint8_t output_zero_point,
+    float output_scale,
+    uint8_t output_min,
+    uint8_t output_max,
+    uint32_t flags,
+    xnn_weights_cache_t weights_cache,
+    xnn_operator_t* fully_connected_op_out);
+
+enum xnn_status xnn_create_fully_connected_nc_qs8_with_cache(
+    size_t input_channels,
+    size_t output_channels,
+    size_t input_stride,
+    size_t output_stride,
+    int8_t input_zero_point,
+    float input_scale,
+    float kernel_scale,
+    const int8_t* kernel,
+    const int32_t* bias,
+    int8_t output_zero_point,
+    float output_scale,
+    int8_t output_min,
+    int8_t output_max,
+    uint32_t flags,
+    xnn_weights_cache_t weights_cache,
+    xnn_operator_t* fully_connected_op_out);
+
+enum xnn_status xnn_create_fully_connected_nc_f32_with_cache(
+    size_t input_channels,
+    size_t output_channels,
+    size_t input_stride,
+    size_t output_stride,
+    const float* kernel,
+    const float* bias,
+    float output_min,
+    float output_max,
+    uint32_t flags,
+    xnn_weights_cache_t weights_cache,
+    xnn_operator_t* fully_connected_op_out);
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
@@ -0,0 +1,97 @@
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <gtest/gtest.h>
+
+#include "batch-matrix-multiply-operator-tester.h"
+
+
+TEST(BATCH_MATRIX_MULTIPLY_NC_F32, unit_batch) {
+  BatchMatrixMultiplyOperatorTester()
+    .m(17)
+    .k(23)
+    .n(19)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(BATCH_MATRIX_MULTIPLY_NC_F32, small_batch) {
+  for (size_t batch_size = 2; batch_size <= 5; batch_size++) {
+    BatchMatrixMultiplyOperatorTester()
+      .batch_size(batch_size)
+      .m(13)
+      .k(29)
+      .n(11)
+      .TestF32();
+  }
+}
+
+TEST(BATCH_MATRIX_MULTIPLY_NC_F32, varying_m) {
+  for (size_t m = 1; m <= 15; m++) {
+    BatchMatrixMultiplyOperatorTester()
+      .batch_size(3)
+      .m(m)
+      .k(16)
+      .n(24)
+      .TestF32();
+  }
+}
+
+TEST(BATCH_MATRIX_MULTIPLY_NC_F32, varying_k) {
+  for (size_t k = 1; k <= 33; k++) {
+    BatchMatrixMultiplyOperatorTester()
+      .batch_size(2)
+      .m(7)
+      .k(k)
+      .n(9)
+      .TestF32();
+  }
+}
+
+TEST(BATCH_MATRIX_MULTIPLY_NC_F32, varying_n) {
+  for (size_t n = 1; n <= 41; n++) {
+    BatchMatrixMultiplyOperatorTester()
+      .batch_size(2)
+      .m(5)
+      .k(12)
+      .n(n)
+      .TestF32();
+  }
+}
+
+TEST(BATCH_MATRIX_MULTIPLY_NC_F32, transpose_b) {
+  for (size_t k = 1; k <= 20; k += 3) {
+    BatchMatrixMultiplyOperatorTester()
+      .batch_size(4)
+      .m(9)
+      .k(k)
+      .n(21)
+      .transpose_b(true)
+      .TestF32();
+  }
+}
+
+TEST(BATCH_MATRIX_MULTIPLY_NC_F32, multithreaded) {
+  BatchMatrixMultiplyOperatorTester()
+    .batch_size(6)
+    .m(37)
+    .k(64)
+    .n(53)
+    .num_threads(4)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(BATCH_MATRIX_MULTIPLY_NC_F32, multithreaded_transpose_b) {
+  BatchMatrixMultiplyOperatorTester()
+    .batch_size(6)
+    .m(37)
+    .k(64)
+    .n(53)
+    .transpose_b(true)
+    .num_threads(4)
+    .iterations(3)
+    .TestF32();
+}
@@ -0,0 +1,187 @@
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include <xnnpack.h>
+#include <xnnpack/subgraph.h>
+
+#include <gtest/gtest.h>
+
+namespace {
+
+// Creates a Runtime that multiplies an external input with ID 0 by an external input with ID 1 into an external
+// output with ID 2.
+xnn_runtime_t CreateRuntime(
+  const std::vector<size_t>& input1_dims,
+  const std::vector<size_t>& input2_dims,
+  const std::vector<size_t>& output_dims,
+  uint32_t flags)
+{
+  xnn_subgraph_t subgraph_ptr = nullptr;
+  EXPECT_EQ(xnn_status_success, xnn_create_subgraph(3, 0 /* flags */, &subgraph_ptr));
+  std::unique_ptr<xnn_subgraph, decltype(&xnn_delete_subgraph)> subgraph(subgraph_ptr, xnn_delete_subgraph);
+
+  uint32_t input1_id = XNN_INVALID_VALUE_ID;
+  EXPECT_EQ(xnn_status_success, xnn_define_tensor_value(
+    subgraph.get(), xnn_datatype_fp32, input1_dims.size(), input1_dims.data(), nullptr, 0,
+    XNN_VALUE_FLAG_EXTERNAL_INPUT, &input1_id));
+  uint32_t input2_id = XNN_INVALID_VALUE_ID;
+  EXPECT_EQ(xnn_status_success, xnn_define_tensor_value(
+    subgraph.get(), xnn_datatype_fp32, input2_dims.size(), input2_dims.data(), nullptr, 1,
+    XNN_VALUE_FLAG_EXTERNAL_INPUT, &input2_id));
+  uint32_t output_id = XNN_INVALID_VALUE_ID;
+  EXPECT_EQ(xnn_status_success, xnn_define_tensor_value(
+    subgraph.get(), xnn_datatype_fp32, output_dims.size(), output_dims.data(), nullptr, 2,
+    XNN_VALUE_FLAG_EXTERNAL_OUTPUT, &output_id));
+  EXPECT_EQ(xnn_status_success,
+    xnn_define_batch_matrix_multiply(subgraph.get(), input1_id, input2_id, output_id, flags));
+
+  xnn_runtime_t runtime = nullptr;
+  EXPECT_EQ(xnn_status_success, xnn_create_runtime_v2(subgraph.get(), nullptr, 0 /* flags */, &runtime));
+  return runtime;
+}
+
+std::vector<float> RandomInput(size_t num_elements) {
+  std::random_device random_device;
+  auto rng = std::mt19937(random_device());
+  auto f32rng = std::bind(std::uniform_real_distribution<float>(-1.0f, 1.0f), std::ref(rng));
+  std::vector<float> input(num_elements + XNN_EXTRA_BYTES / sizeof(float));
+  std::generate(input.begin(), input.end(), std::ref(f32rng));
+  return input;
+}
+
+std::vector<float> BatchMatrixMultiply(
+  const std::vector<float>& a, const std::vector<float>& b,
+  size_t batch_size, size_t m, size_t k, size_t n, bool transpose_b)
+{
+  std::vector<float> output(batch_size * m * n);
+  for (size_t bi = 0; bi < batch_size; bi++) {
+    for (size_t i = 0; i < m; i++) {
+      for (size_t j = 0; j < n; j++) {
+        double acc = 0.0;
+        for (size_t l = 0; l < k; l++) {
+          const float b_value = transpose_b ? b[(bi * n + j) * k + l] : b[(bi * k + l) * n + j];
+          acc += double(a[(bi * m + i) * k + l]) * double(b_value);
+        }
+        output[(bi * m + i) * n + j] = float(acc);
+      }
+    }
+  }
+  return output;
+}
+
+std::vector<float> Invoke(
+  xnn_runtime_t runtime, const std::vector<float>& input1, const std::vector<float>& input2, size_t num_elements)
+{
+  std::vector<float> output(num_elements);
+  const std::array<xnn_external_value, 3> external = {{
+    xnn_external_value{0, const_cast<float*>(input1.data())},
+    xnn_external_value{1, const_cast<float*>(input2.data())},
+    xnn_external_value{2, output.data()},
+  }};
+  EXPECT_EQ(xnn_status_success, xnn_setup_runtime(runtime, external.size(), external.data()));
+  EXPECT_EQ(xnn_status_success, xnn_invoke_runtime(runtime));
+  return output;
+}
+
+void ExpectNear(const std::vector<float>& expected, const std::vector<float>& actual) {
+  ASSERT_EQ(expected.size(), actual.size());
+  for (size_t i = 0; i < expected.size(); i++) {
+    EXPECT_NEAR(expected[i], actual[i], 1.0e-4f * std::max(1.0f, std::abs(expected[i]))) << "at element " << i;
+  }
+}
+
+}  // namespace
+
+TEST(BATCH_MATRIX_MULTIPLY, attention_scores) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  // Q [heads, tokens, head_size] * K^T, with K in [heads, tokens, head_size] layout.
+  std::unique_ptr<xnn_runtime, decltype(&xnn_delete_runtime)> runtime(
+    CreateRuntime({2, 4, 7, 16}, {2, 4, 9, 16}, {2, 4, 7, 9}, XNN_FLAG_TRANSPOSE_B), xnn_delete_runtime);
+  ASSERT_NE(nullptr, runtime);
+
+  const std::vector<float> q = RandomInput(2 * 4 * 7 * 16);
+  const std::vector<float> k = RandomInput(2 * 4 * 9 * 16);
+  ExpectNear(BatchMatrixMultiply(q, k, 8, 7, 16, 9, true), Invoke(runtime.get(), q, k, 2 * 4 * 7 * 9));
+}
+
+TEST(BATCH_MATRIX_MULTIPLY, attention_values) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  // P [heads, tokens, tokens] * V [heads, tokens, head_size].
+  std::unique_ptr<xnn_runtime, decltype(&xnn_delete_runtime)> runtime(
+    CreateRuntime({3, 11, 11}, {3, 11, 24}, {3, 11, 24}, 0 /* flags */), xnn_delete_runtime);
+  ASSERT_NE(nullptr, runtime);
+
+  const std::vector<float> p = RandomInput(3 * 11 * 11);
+  const std::vector<float> v = RandomInput(3 * 11 * 24);
+  ExpectNear(BatchMatrixMultiply(p, v, 3, 11, 11, 24, false), Invoke(runtime.get(), p, v, 3 * 11 * 24));
+}
+
+TEST(BATCH_MATRIX_MULTIPLY, reshape) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  std::unique_ptr<xnn_runtime, decltype(&xnn_delete_runtime)> runtime(
+    CreateRuntime({2, 3, 5}, {2, 5, 4}, {2, 3, 4}, 0 /* flags */), xnn_delete_runtime);
+  ASSERT_NE(nullptr, runtime);
+
+  const std::array<size_t, 3> input1_dims = {{4, 17, 5}};
+  const std::array<size_t, 3> input2_dims = {{4, 5, 13}};
+  ASSERT_EQ(xnn_status_success, xnn_reshape_external_value(runtime.get(), 0, input1_dims.size(), input1_dims.data()));
+  ASSERT_EQ(xnn_status_success, xnn_reshape_external_value(runtime.get(), 1, input2_dims.size(), input2_dims.data()));
+  ASSERT_EQ(xnn_status_success, xnn_reshape_runtime(runtime.get()));
+
+  size_t num_dims = 0;
+  std::array<size_t, XNN_MAX_TENSOR_DIMS> output_dims;
+  ASSERT_EQ(xnn_status_success, xnn_get_external_value_shape(runtime.get(), 2, &num_dims, output_dims.data()));
+  ASSERT_EQ(3, num_dims);
+  EXPECT_EQ(4, output_dims[0]);
+  EXPECT_EQ(17, output_dims[1]);
+  EXPECT_EQ(13, output_dims[2]);
+
+  const std::vector<float> a = RandomInput(4 * 17 * 5);
+  const std::vector<float> b = RandomInput(4 * 5 * 13);
+  ExpectNear(BatchMatrixMultiply(a, b, 4, 17, 5, 13, false), Invoke(runtime.get(), a, b, 4 * 17 * 13));
+
+  const std::array<size_t, 3> mismatching_dims = {{4, 6, 13}};
+  ASSERT_EQ(xnn_status_success,
+    xnn_reshape_external_value(runtime.get(), 1, mismatching_dims.size(), mismatching_dims.data()));
+  EXPECT_EQ(xnn_status_invalid_parameter, xnn_reshape_runtime(runtime.get()));
+}
+
+TEST(BATCH_MATRIX_MULTIPLY, rejects_mismatching_shapes) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  xnn_subgraph_t subgraph_ptr = nullptr;
+  ASSERT_EQ(xnn_status_success, xnn_create_subgraph(0, 0 /* flags */, &subgraph_ptr));
+  std::unique_ptr<xnn_subgraph, decltype(&xnn_delete_subgraph)> subgraph(subgraph_ptr, xnn_delete_subgraph);
+
+  auto define = [&](std::vector<size_t> dims) {
+    uint32_t id = XNN_INVALID_VALUE_ID;
+    EXPECT_EQ(xnn_status_success, xnn_define_tensor_value(
+      subgraph.get(), xnn_datatype_fp32, dims.size(), dims.data(), nullptr, XNN_INVALID_VALUE_ID, 0, &id));
+    return id;
+  };
+  const uint32_t a_id = define({2, 3, 5});
+  const uint32_t b_id = define({2, 5, 4});
+  const uint32_t wrong_batch_id = define({3, 5, 4});
+  const uint32_t output_id = define({2, 3, 4});
+  const uint32_t wrong_output_id = define({2, 4, 3});
+
+  EXPECT_EQ(xnn_status_invalid_parameter,
+    xnn_define_batch_matrix_multiply(subgraph.get(), a_id, wrong_batch_id, output_id, 0 /* flags */));
+  EXPECT_EQ(xnn_status_invalid_parameter,
+    xnn_define_batch_matrix_multiply(subgraph.get(), a_id, b_id, wrong_output_id, 0 /* flags */));
+  EXPECT_EQ(xnn_status_invalid_parameter,
+    xnn_define_batch_matrix_multiply(subgraph.get(), a_id, b_id, output_id, XNN_FLAG_TRANSPOSE_B));
+  EXPECT_EQ(xnn_status_success,
+    xnn_define_batch_matrix_multiply(subgraph.get(), a_id, b_id, output_id, 0 /* flags */));
+}
@@ -0,0 +1,255 @@
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include <xnnpack.h>
+#include <xnnpack/subgraph.h>
+
+#include <gtest/gtest.h>
+
+namespace {
+
+size_t NumElements(const std::vector<size_t>& dims) {
+  return std::accumulate(dims.cbegin(), dims.cend(), size_t(1), std::multiplies<size_t>());
+}
+
+template<class T>
+std::vector<T> RandomInput(size_t num_elements) {
+  std::random_device random_device;
+  auto rng = std::mt19937(random_device());
+  auto u8rng = std::bind(std::uniform_int_distribution<uint32_t>(0, std::numeric_limits<uint8_t>::max()), rng);
+  std::vector<T> input(num_elements + XNN_EXTRA_BYTES / sizeof(T));
+  std::generate(input.begin(), input.end(), [&]() { return static_cast<T>(u8rng()); });
+  return input;
+}
+
+template<class T>
+std::vector<T> Concatenate(
+  const std::vector<std::vector<T>>& inputs, const std::vector<std::vector<size_t>>& dims, size_t axis)
+{
+  const size_t batch_size = std::accumulate(
+    dims[0].cbegin(), dims[0].cbegin() + axis, size_t(1), std::multiplies<size_t>());
+  std::vector<T> output;
+  for (size_t b = 0; b < batch_size; b++) {
+    for (size_t i = 0; i < inputs.size(); i++) {
+      const size_t channels = NumElements(dims[i]) / batch_size;
+      output.insert(output.end(), inputs[i].begin() + b * channels, inputs[i].begin() + (b + 1) * channels);
+    }
+  }
+  return output;
+}
+
+// Defines external inputs with IDs [0, N-1], and an external output with ID N.
+void DefineExternalValues(
+  xnn_subgraph_t subgraph,
+  xnn_datatype datatype,
+  const std::vector<std::vector<size_t>>& input_dims,
+  const std::vector<size_t>& output_dims,
+  std::vector<uint32_t>& input_ids,
+  uint32_t& output_id)
+{
+  for (size_t i = 0; i < input_dims.size(); i++) {
+    uint32_t input_id = XNN_INVALID_VALUE_ID;
+    if (datatype == xnn_datatype_fp32) {
+      ASSERT_EQ(xnn_status_success, xnn_define_tensor_value(
+        subgraph, datatype, input_dims[i].size(), input_dims[i].data(), nullptr, i,
+        XNN_VALUE_FLAG_EXTERNAL_INPUT, &input_id));
+    } else {
+      ASSERT_EQ(xnn_status_success, xnn_define_quantized_tensor_value(
+        subgraph, datatype, 128, 0.5f, input_dims[i].size(), input_dims[i].data(), nullptr, i,
+        XNN_VALUE_FLAG_EXTERNAL_INPUT, &input_id));
+    }
+    input_ids.push_back(input_id);
+  }
+  if (datatype == xnn_datatype_fp32) {
+    ASSERT_EQ(xnn_status_success, xnn_define_tensor_value(
+      subgraph, datatype, output_dims.size(), output_dims.data(), nullptr, input_dims.size(),
+      XNN_VALUE_FLAG_EXTERNAL_OUTPUT, &output_id));
+  } else {
+    ASSERT_EQ(xnn_status_success, xnn_define_quantized_tensor_value(
+      subgraph, datatype, 128, 0.5f, output_dims.size(), output_dims.data(), nullptr, input_dims.size(),
+      XNN_VALUE_FLAG_EXTERNAL_OUTPUT, &output_id));
+  }
+}
+
+template<class T>
+std::vector<T> Invoke(xnn_runtime_t runtime, const std::vector<std::vector<T>>& inputs, size_t num_elements) {
+  std::vector<T> output(num_elements);
+  std::vector<xnn_external_value> external;
+  for (size_t i = 0; i < inputs.size(); i++) {
+    external.push_back(xnn_external_value{uint32_t(i), const_cast<T*>(inputs[i].data())});
+  }
+  external.push_back(xnn_external_value{uint32_t(inputs.size()), output.data()});
+  EXPECT_EQ(xnn_status_success, xnn_setup_runtime(runtime, external.size(), external.data()));
+  EXPECT_EQ(xnn_status_success, xnn_invoke_runtime(runtime));
+  return output;
+}
+
+}  // namespace
+
+TEST(CONCATENATE2, inner_axis_f32) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  xnn_subgraph_t subgraph_ptr = nullptr;
+  ASSERT_EQ(xnn_status_success, xnn_create_subgraph(3, 0 /* flags */, &subgraph_ptr));
+  std::unique_ptr<xnn_subgraph, decltype(&xnn_delete_subgraph)> subgraph(subgraph_ptr, xnn_delete_subgraph);
+
+  const std::vector<std::vector<size_t>> input_dims = {{2, 5, 7, 13}, {2, 5, 7, 19}};
+  const std::vector<size_t> output_dims = {2, 5, 7, 32};
+  std::vector<uint32_t> input_ids;
+  uint32_t output_id = XNN_INVALID_VALUE_ID;
+  DefineExternalValues(subgraph.get(), xnn_datatype_fp32, input_dims, output_dims, input_ids, output_id);
+  ASSERT_EQ(xnn_status_success,
+    xnn_define_concatenate2(subgraph.get(), 3, input_ids[0], input_ids[1], output_id, 0 /* flags */));
+
+  xnn_runtime_t runtime_ptr = nullptr;
+  ASSERT_EQ(xnn_status_success, xnn_create_runtime_v2(subgraph.get(), nullptr, 0 /* flags */, &runtime_ptr));
+  std::unique_ptr<xnn_runtime, decltype(&xnn_delete_runtime)> runtime(runtime_ptr, xnn_delete_runtime);
+
+  const std::vector<std::vector<float>> inputs = {
+    RandomInput<float>(NumElements(input_dims[0])), RandomInput<float>(NumElements(input_dims[1]))};
+  EXPECT_EQ(Concatenate(inputs, input_dims, 3), Invoke(runtime.get(), inputs, NumElements(output_dims)));
+}
+
+TEST(CONCATENATE3, outermost_axis_in_place) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  xnn_subgraph_t subgraph_ptr = nullptr;
+  ASSERT_EQ(xnn_status_success, xnn_create_subgraph(4, 0 /* flags */, &subgraph_ptr));
+  std::unique_ptr<xnn_subgraph, decltype(&xnn_delete_subgraph)> subgraph(subgraph_ptr, xnn_delete_subgraph);
+
+  // External inputs go through Clamp Nodes, which write into slices of the internal concatenated Value.
+  const std::vector<std::vector<size_t>> input_dims = {{1, 3, 8}, {1, 5, 8}, {1, 2, 8}};
+  const std::vector<size_t> output_dims = {1, 10, 8};
+  std::vector<uint32_t> input_ids;
+  uint32_t output_id = XNN_INVALID_VALUE_ID;
+  DefineExternalValues(subgraph.get(), xnn_datatype_fp32, input_dims, output_dims, input_ids, output_id);
+
+  std::array<uint32_t, 3> clamp_ids;
+  for (size_t i = 0; i < 3; i++) {
+    ASSERT_EQ(xnn_status_success, xnn_define_tensor_value(
+      subgraph.get(), xnn_datatype_fp32, input_dims[i].size(), input_dims[i].data(), nullptr,
+      XNN_INVALID_VALUE_ID, 0 /* flags */, &clamp_ids[i]));
+    ASSERT_EQ(xnn_status_success,
+      xnn_define_clamp(subgraph.get(), -INFINITY, INFINITY, input_ids[i], clamp_ids[i], 0 /* flags */));
+  }
+  uint32_t concat_id = XNN_INVALID_VALUE_ID;
+  ASSERT_EQ(xnn_status_success, xnn_define_tensor_value(
+    subgraph.get(), xnn_datatype_fp32, output_dims.size(), output_dims.data(), nullptr,
+    XNN_INVALID_VALUE_ID, 0 /* flags */, &concat_id));
+  ASSERT_EQ(xnn_status_success,
+    xnn_define_concatenate3(subgraph.get(), 1, clamp_ids[0], clamp_ids[1], clamp_ids[2], concat_id, 0 /* flags */));
+  ASSERT_EQ(xnn_status_success,
+    xnn_define_clamp(subgraph.get(), -INFINITY, INFINITY, concat_id, output_id, 0 /* flags */));
+
+  xnn_runtime_t runtime_ptr = nullptr;
+  ASSERT_EQ(xnn_status_success, xnn_create_runtime_v2(subgraph.get(), nullptr, 0 /* flags */, &runtime_ptr));
+  std::unique_ptr<xnn_runtime, decltype(&xnn_delete_runtime)> runtime(runtime_ptr, xnn_delete_runtime);
+
+  const std::vector<std::vector<float>> inputs = {
+    RandomInput<float>(NumElements(input_dims[0])),
+    RandomInput<float>(NumElements(input_dims[1])),
+    RandomInput<float>(NumElements(input_dims[2]))};
+  EXPECT_EQ(Concatenate(inputs, input_dims, 1), Invoke(runtime.get(), inputs, NumElements(output_dims)));
+
+#if XNN_ENABLE_MEMOPT
+  size_t offset = 0;
+  for (size_t i = 0; i < 3; i++) {
+    EXPECT_EQ(
+      reinterpret_cast<uintptr_t>(runtime->blobs[concat_id].data) + offset,
+      reinterpret_cast<uintptr_t>(runtime->blobs[clamp_ids[i]].data));
+    offset += NumElements(input_dims[i]) * sizeof(float);
+  }
+#endif
+}
+
+TEST(CONCATENATE4, inner_axis_qu8) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  xnn_subgraph_t subgraph_ptr = nullptr;
+  ASSERT_EQ(xnn_status_success, xnn_create_subgraph(5, 0 /* flags */, &subgraph_ptr));
+  std::unique_ptr<xnn_subgraph, decltype(&xnn_delete_subgraph)> subgraph(subgraph_ptr, xnn_delete_subgraph);
+
+  const std::vector<std::vector<size_t>> input_dims = {{3, 1, 5}, {3, 4, 5}, {3, 2, 5}, {3, 3, 5}};
+  const std::vector<size_t> output_dims = {3, 10, 5};
+  std::vector<uint32_t> input_ids;
+  uint32_t output_id = XNN_INVALID_VALUE_ID;
+  DefineExternalValues(subgraph.get(), xnn_datatype_quint8, input_dims, output_dims, input_ids, output_id);
+  ASSERT_EQ(xnn_status_success,
+    xnn_define_concatenate4(
+      subgraph.get(), 1, input_ids[0], input_ids[1], input_ids[2], input_ids[3], output_id, 0 /* flags */));
+
+  xnn_runtime_t runtime_ptr = nullptr;
+  ASSERT_EQ(xnn_status_success, xnn_create_runtime_v2(subgraph.get(), nullptr, 0 /* flags */, &runtime_ptr));
+  std::unique_ptr<xnn_runtime, decltype(&xnn_delete_runtime)> runtime(runtime_ptr, xnn_delete_runtime);
+
+  std::vector<std::vector<uint8_t>> inputs;
+  for (size_t i = 0; i < 4; i++) {
+    inputs.push_back(RandomInput<uint8_t>(NumElements(input_dims[i])));
+  }
+  EXPECT_EQ(Concatenate(inputs, input_dims, 1), Invoke(runtime.get(), inputs, NumElements(output_dims)));
+}
+
+TEST(CONCATENATE2, reshape) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  xnn_subgraph_t subgraph_ptr = nullptr;
+  ASSERT_EQ(xnn_status_success, xnn_create_subgraph(3, 0 /* flags */, &subgraph_ptr));
+  std::unique_ptr<xnn_subgraph, decltype(&xnn_delete_subgraph)> subgraph(subgraph_ptr, xnn_delete_subgraph);
+
+  std::vector<uint32_t> input_ids;
+  uint32_t output_id = XNN_INVALID_VALUE_ID;
+  DefineExternalValues(subgraph.get(), xnn_datatype_fp32, {{1, 4, 3}, {1, 4, 6}}, {1, 4, 9}, input_ids, output_id);
+  ASSERT_EQ(xnn_status_success,
+    xnn_define_concatenate2(subgraph.get(), 2, input_ids[0], input_ids[1], output_id, 0 /* flags */));
+
+  xnn_runtime_t runtime_ptr = nullptr;
+  ASSERT_EQ(xnn_status_success, xnn_create_runtime_v2(subgraph.get(), nullptr, 0 /* flags */, &runtime_ptr));
+  std::unique_ptr<xnn_runtime, decltype(&xnn_delete_runtime)> runtime(runtime_ptr, xnn_delete_runtime);
+
+  const std::vector<std::vector<size_t>> input_dims = {{3, 7, 5}, {3, 7, 2}};
+  ASSERT_EQ(xnn_status_success, xnn_reshape_external_value(runtime.get(), 0, 3, input_dims[0].data()));
+  ASSERT_EQ(xnn_status_success, xnn_reshape_external_value(runtime.get(), 1, 3, input_dims[1].data()));
+  ASSERT_EQ(xnn_status_success, xnn_reshape_runtime(runtime.get()));
+
+  size_t num_dims = 0;
+  std::array<size_t, XNN_MAX_TENSOR_DIMS> output_dims;
+  ASSERT_EQ(xnn_status_success, xnn_get_external_value_shape(runtime.get(), 2, &num_dims, output_dims.data()));
+  ASSERT_EQ(3, num_dims);
+  EXPECT_EQ(3, output_dims[0]);
+  EXPECT_EQ(7, output_dims[1]);
+  EXPECT_EQ(7, output_dims[2]);
+
+  const std::vector<std::vector<float>> inputs = {
+    RandomInput<float>(NumElements(input_dims[0])), RandomInput<float>(NumElements(input_dims[1]))};
+  EXPECT_EQ(Concatenate(inputs, input_dims, 2), Invoke(runtime.get(), inputs, 3 * 7 * 7));
+}
+
+TEST(CONCATENATE2, rejects_mismatching_shapes) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  xnn_subgraph_t subgraph_ptr = nullptr;
+  ASSERT_EQ(xnn_status_success, xnn_create_subgraph(3, 0 /* flags */, &subgraph_ptr));
+  std::unique_ptr<xnn_subgraph, decltype(&xnn_delete_subgraph)> subgraph(subgraph_ptr, xnn_delete_subgraph);
+
+  std::vector<uint32_t> input_ids;
+  uint32_t output_id = XNN_INVALID_VALUE_ID;
+  DefineExternalValues(subgraph.get(), xnn_datatype_fp32, {{2, 4, 3}, {2, 5, 3}}, {2, 9, 3}, input_ids, output_id);
+
+  EXPECT_EQ(xnn_status_invalid_parameter,
+    xnn_define_concatenate2(subgraph.get(), 2, input_ids[0], input_ids[1], output_id, 0 /* flags */));
+  EXPECT_EQ(xnn_status_invalid_parameter,
+    xnn_define_concatenate2(subgraph.get(), 3, input_ids[0], input_ids[1], output_id, 0 /* flags */));
+  EXPECT_EQ(xnn_status_invalid_parameter,
+    xnn_define_concatenate2(subgraph.get(), 1, input_ids[0], input_ids[0], output_id, 0 /* flags */));
+  EXPECT_EQ(xnn_status_success,
+    xnn_define_concatenate2(subgraph.get(), 1, input_ids[0], input_ids[1], output_id, 0 /* flags */));
+}
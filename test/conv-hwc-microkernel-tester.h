@@ -282,6 +282,17 @@ public:
   }
 
   void Test(xnn_f32_conv_hwc_ukernel_function conv, Variant variant = Variant::Native) const {
+    switch (variant) {
+      case Variant::Native:
+        Test(conv, xnn_init_f32_minmax_params);
+        break;
+      case Variant::Scalar:
+        Test(conv, xnn_init_f32_minmax_scalar_params);
+        break;
+    }
+  }
+
+  void Test(xnn_f32_conv_hwc_ukernel_function conv, xnn_init_f32_minmax_params_fn init_params) const {
     ASSERT_LT(output_y_start(), output_height());
     ASSERT_LE(output_y_end(), output_height());
     ASSERT_GT(output_y_end(), output_y_start());
@@ -356,14 +367,7 @@ public:
 
       // Prepare parameters.
       xnn_f32_minmax_params params;
-      switch (variant) {
-        case Variant::Native:
-          xnn_init_f32_minmax_params(&params, output_min, output_max);
-          break;
-        case Variant::Scalar:
-          xnn_init_f32_minmax_scalar_params(&params, output_min, output_max);
-          break;
-      }
+      init_params(&params, output_min, output_max);
 
       // Call optimized micro-kernel.
       conv(
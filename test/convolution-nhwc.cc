@@ -3968,6 +3968,120 @@ TEST(CONVOLUTION_NHWC_F32, 3x3s2_with_tf_same_padding) {
   }
 }
 
+TEST(CONVOLUTION_NHWC_F32, 3x3s2c3) {
+  for (size_t input_width = 1; input_width <= 17; input_width++) {
+    ConvolutionOperatorTester()
+      .input_size(11, input_width)
+      .padding(1)
+      .kernel_size(3, 3)
+      .subsampling(2)
+      .group_input_channels(3)
+      .group_output_channels(37)
+      .iterations(3)
+      .TestNHWCxF32();
+  }
+}
+
+TEST(CONVOLUTION_NHWC_F32, 3x3s2c3_with_asymmetric_padding) {
+  for (size_t input_height = 4; input_height <= 7; input_height++) {
+    for (size_t input_width = 2; input_width <= 17; input_width++) {
+      ConvolutionOperatorTester()
+        .input_size(input_height, input_width)
+        .padding_top(0)
+        .padding_left(0)
+        .padding_bottom(1)
+        .padding_right(1)
+        .kernel_size(3, 3)
+        .subsampling(2)
+        .group_input_channels(3)
+        .group_output_channels(37)
+        .iterations(3)
+        .TestNHWCxF32();
+    }
+  }
+}
+
+TEST(CONVOLUTION_NHWC_F32, 3x3s2c3_with_tf_same_padding) {
+  for (size_t input_height = 13; input_height <= 14; input_height++) {
+    for (size_t input_width = 13; input_width <= 14; input_width++) {
+      ConvolutionOperatorTester()
+        .input_size(input_height, input_width)
+        .padding_tf_same(true)
+        .kernel_size(3, 3)
+        .subsampling(2)
+        .group_input_channels(3)
+        .group_output_channels(37)
+        .iterations(3)
+        .TestNHWCxF32();
+    }
+  }
+}
+
+TEST(CONVOLUTION_NHWC_F32, 3x3s2c3_with_qmin) {
+  ConvolutionOperatorTester()
+    .input_size(14, 13)
+    .padding(1)
+    .kernel_size(3, 3)
+    .subsampling(2)
+    .group_input_channels(3)
+    .group_output_channels(37)
+    .qmin(128)
+    .iterations(3)
+    .TestNHWCxF32();
+}
+
+TEST(CONVOLUTION_NHWC_F32, 3x3s2c3_with_qmax) {
+  ConvolutionOperatorTester()
+    .input_size(14, 13)
+    .padding(1)
+    .kernel_size(3, 3)
+    .subsampling(2)
+    .group_input_channels(3)
+    .group_output_channels(37)
+    .qmax(128)
+    .iterations(3)
+    .TestNHWCxF32();
+}
+
+TEST(CONVOLUTION_NHWC_F32, 3x3s2c3_with_output_stride) {
+  ConvolutionOperatorTester()
+    .input_size(14, 13)
+    .padding(1)
+    .kernel_size(3, 3)
+    .subsampling(2)
+    .group_input_channels(3)
+    .group_output_channels(37)
+    .output_channel_stride(41)
+    .iterations(3)
+    .TestNHWCxF32();
+}
+
+TEST(CONVOLUTION_NHWC_F32, 3x3s2c3_without_bias) {
+  ConvolutionOperatorTester()
+    .has_bias(false)
+    .input_size(14, 13)
+    .padding(1)
+    .kernel_size(3, 3)
+    .subsampling(2)
+    .group_input_channels(3)
+    .group_output_channels(37)
+    .iterations(3)
+    .TestNHWCxF32();
+}
+
+TEST(CONVOLUTION_NHWC_F32, 3x3s2c3_with_batch) {
+  ConvolutionOperatorTester()
+    .batch_size(3)
+    .input_size(14, 13)
+    .padding(1)
+    .kernel_size(3, 3)
+    .subsampling(2)
+    .group_input_channels(3)
+    .group_output_channels(37)
+    .iterations(3)
+    .TestNHWCxF32();
+}
+
 TEST(CONVOLUTION_NHWC_F32, 3x3s1x2) {
   ConvolutionOperatorTester()
     .input_size(14, 13)
@@ -4912,6 +5026,32 @@ TEST(CONVOLUTION_NHWC_F32, setup_changing_width) {
     .TestSetupNHWCxF32();
 }
 
+TEST(CONVOLUTION_NHWC_F32, setup_changing_width_3x3s2c3) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  ConvolutionOperatorTester()
+    .batch_size(3)
+    .input_height(8)
+    .input_width(8)
+    .next_input_width(11)
+    .padding(1)
+    .kernel_size(3, 3)
+    .subsampling(2)
+    .group_input_channels(3)
+    .group_output_channels(17)
+    .TestSetupNHWCxF32();
+  ConvolutionOperatorTester()
+    .batch_size(3)
+    .input_height(8)
+    .input_width(11)
+    .next_input_width(8)
+    .padding(1)
+    .kernel_size(3, 3)
+    .subsampling(2)
+    .group_input_channels(3)
+    .group_output_channels(17)
+    .TestSetupNHWCxF32();
+}
+
 TEST(CONVOLUTION_NHWC_F32, setup_changing_width_grouped) {
   ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
   ConvolutionOperatorTester()
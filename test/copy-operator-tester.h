@@ -80,6 +80,60 @@ class CopyOperatorTester {
     return this->iterations_;
   }
 
+  void TestX8() const {
+    std::random_device random_device;
+    auto rng = std::mt19937(random_device());
+    auto u8rng = std::bind(
+      std::uniform_int_distribution<uint32_t>(0, std::numeric_limits<uint8_t>::max()), rng);
+
+    std::vector<uint8_t> input(XNN_EXTRA_BYTES / sizeof(uint8_t) +
+      (batch_size() - 1) * input_stride() + channels());
+    std::vector<uint8_t> output((batch_size() - 1) * output_stride() + channels());
+    std::vector<uint8_t> output_ref(batch_size() * channels());
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(input.begin(), input.end(), std::ref(u8rng));
+      std::fill(output.begin(), output.end(), UINT8_C(0xA5));
+
+      // Compute reference results.
+      for (size_t i = 0; i < batch_size(); i++) {
+        for (size_t c = 0; c < channels(); c++) {
+          output_ref[i * channels() + c] = input[i * input_stride() + c];
+        }
+      }
+
+      // Create, setup, run, and destroy Copy operator.
+      ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+      xnn_operator_t copy_op = nullptr;
+
+      ASSERT_EQ(xnn_status_success,
+        xnn_create_copy_nc_x8(
+          channels(), input_stride(), output_stride(),
+          0, &copy_op));
+      ASSERT_NE(nullptr, copy_op);
+
+      // Smart pointer to automatically delete copy_op.
+      std::unique_ptr<xnn_operator, decltype(&xnn_delete_operator)> auto_copy_op(copy_op, xnn_delete_operator);
+
+      ASSERT_EQ(xnn_status_success,
+        xnn_setup_copy_nc_x8(
+          copy_op,
+          batch_size(),
+          input.data(), output.data(),
+          nullptr /* thread pool */));
+
+      ASSERT_EQ(xnn_status_success,
+        xnn_run_operator(copy_op, nullptr /* thread pool */));
+
+      // Verify results.
+      for (size_t i = 0; i < batch_size(); i++) {
+        for (size_t c = 0; c < channels(); c++) {
+          ASSERT_EQ(uint32_t(output_ref[i * channels() + c]), uint32_t(output[i * output_stride() + c]))
+            << "at batch " << i << " / " << batch_size() << ", channel = " << c << " / " << channels();
+        }
+      }
+    }
+  }
+
   void TestX32() const {
     std::random_device random_device;
     auto rng = std::mt19937(random_device());
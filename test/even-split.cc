@@ -0,0 +1,348 @@
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include <xnnpack.h>
+#include <xnnpack/subgraph.h>
+
+#include <gtest/gtest.h>
+
+namespace {
+
+size_t NumElements(const std::vector<size_t>& dims) {
+  return std::accumulate(dims.cbegin(), dims.cend(), size_t(1), std::multiplies<size_t>());
+}
+
+template<class T>
+std::vector<T> RandomInput(size_t num_elements) {
+  std::random_device random_device;
+  auto rng = std::mt19937(random_device());
+  auto u8rng = std::bind(std::uniform_int_distribution<uint32_t>(0, std::numeric_limits<uint8_t>::max()), rng);
+  std::vector<T> input(num_elements + XNN_EXTRA_BYTES / sizeof(T));
+  std::generate(input.begin(), input.end(), [&]() { return static_cast<T>(u8rng()); });
+  return input;
+}
+
+template<class T>
+std::vector<std::vector<T>> EvenSplit(
+  const std::vector<T>& input, const std::vector<size_t>& dims, size_t axis, size_t num_outputs)
+{
+  const size_t batch_size = std::accumulate(
+    dims.cbegin(), dims.cbegin() + axis, size_t(1), std::multiplies<size_t>());
+  const size_t channels = NumElements(dims) / batch_size / num_outputs;
+  std::vector<std::vector<T>> outputs(num_outputs);
+  for (size_t b = 0; b < batch_size; b++) {
+    for (size_t i = 0; i < num_outputs; i++) {
+      const auto slice = input.begin() + (b * num_outputs + i) * channels;
+      outputs[i].insert(outputs[i].end(), slice, slice + channels);
+    }
+  }
+  return outputs;
+}
+
+// Defines an external input with ID 0, and external outputs with IDs [1, N].
+void DefineExternalValues(
+  xnn_subgraph_t subgraph,
+  xnn_datatype datatype,
+  const std::vector<size_t>& input_dims,
+  const std::vector<size_t>& output_dims,
+  size_t num_outputs,
+  uint32_t& input_id,
+  std::vector<uint32_t>& output_ids)
+{
+  if (datatype == xnn_datatype_fp32) {
+    ASSERT_EQ(xnn_status_success, xnn_define_tensor_value(
+      subgraph, datatype, input_dims.size(), input_dims.data(), nullptr, 0,
+      XNN_VALUE_FLAG_EXTERNAL_INPUT, &input_id));
+  } else {
+    ASSERT_EQ(xnn_status_success, xnn_define_quantized_tensor_value(
+      subgraph, datatype, 128, 0.5f, input_dims.size(), input_dims.data(), nullptr, 0,
+      XNN_VALUE_FLAG_EXTERNAL_INPUT, &input_id));
+  }
+  for (size_t i = 0; i < num_outputs; i++) {
+    uint32_t output_id = XNN_INVALID_VALUE_ID;
+    if (datatype == xnn_datatype_fp32) {
+      ASSERT_EQ(xnn_status_success, xnn_define_tensor_value(
+        subgraph, datatype, output_dims.size(), output_dims.data(), nullptr, i + 1,
+        XNN_VALUE_FLAG_EXTERNAL_OUTPUT, &output_id));
+    } else {
+      ASSERT_EQ(xnn_status_success, xnn_define_quantized_tensor_value(
+        subgraph, datatype, 128, 0.5f, output_dims.size(), output_dims.data(), nullptr, i + 1,
+        XNN_VALUE_FLAG_EXTERNAL_OUTPUT, &output_id));
+    }
+    output_ids.push_back(output_id);
+  }
+}
+
+template<class T>
+std::vector<std::vector<T>> Invoke(
+  xnn_runtime_t runtime, const std::vector<T>& input, size_t num_outputs, size_t output_num_elements)
+{
+  std::vector<std::vector<T>> outputs(num_outputs, std::vector<T>(output_num_elements));
+  std::vector<xnn_external_value> external;
+  external.push_back(xnn_external_value{0, const_cast<T*>(input.data())});
+  for (size_t i = 0; i < num_outputs; i++) {
+    external.push_back(xnn_external_value{uint32_t(i + 1), outputs[i].data()});
+  }
+  EXPECT_EQ(xnn_status_success, xnn_setup_runtime(runtime, external.size(), external.data()));
+  EXPECT_EQ(xnn_status_success, xnn_invoke_runtime(runtime));
+  return outputs;
+}
+
+}  // namespace
+
+TEST(EVEN_SPLIT2, inner_axis_f32) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  xnn_subgraph_t subgraph_ptr = nullptr;
+  ASSERT_EQ(xnn_status_success, xnn_create_subgraph(3, 0 /* flags */, &subgraph_ptr));
+  std::unique_ptr<xnn_subgraph, decltype(&xnn_delete_subgraph)> subgraph(subgraph_ptr, xnn_delete_subgraph);
+
+  const std::vector<size_t> input_dims = {2, 5, 7, 26};
+  const std::vector<size_t> output_dims = {2, 5, 7, 13};
+  uint32_t input_id = XNN_INVALID_VALUE_ID;
+  std::vector<uint32_t> output_ids;
+  DefineExternalValues(subgraph.get(), xnn_datatype_fp32, input_dims, output_dims, 2, input_id, output_ids);
+  ASSERT_EQ(xnn_status_success,
+    xnn_define_even_split2(subgraph.get(), 3, input_id, output_ids[0], output_ids[1], 0 /* flags */));
+
+  xnn_runtime_t runtime_ptr = nullptr;
+  ASSERT_EQ(xnn_status_success, xnn_create_runtime_v2(subgraph.get(), nullptr, 0 /* flags */, &runtime_ptr));
+  std::unique_ptr<xnn_runtime, decltype(&xnn_delete_runtime)> runtime(runtime_ptr, xnn_delete_runtime);
+
+  const std::vector<float> input = RandomInput<float>(NumElements(input_dims));
+  EXPECT_EQ(EvenSplit(input, input_dims, 3, 2), Invoke(runtime.get(), input, 2, NumElements(output_dims)));
+}
+
+TEST(EVEN_SPLIT3, outermost_axis_views) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  xnn_subgraph_t subgraph_ptr = nullptr;
+  ASSERT_EQ(xnn_status_success, xnn_create_subgraph(4, 0 /* flags */, &subgraph_ptr));
+  std::unique_ptr<xnn_subgraph, decltype(&xnn_delete_subgraph)> subgraph(subgraph_ptr, xnn_delete_subgraph);
+
+  // Clamp Nodes around the Even Split Node make its input and outputs internal Values.
+  const std::vector<size_t> input_dims = {1, 9, 8};
+  const std::vector<size_t> output_dims = {1, 3, 8};
+  uint32_t input_id = XNN_INVALID_VALUE_ID;
+  std::vector<uint32_t> output_ids;
+  DefineExternalValues(subgraph.get(), xnn_datatype_fp32, input_dims, output_dims, 3, input_id, output_ids);
+
+  uint32_t split_input_id = XNN_INVALID_VALUE_ID;
+  ASSERT_EQ(xnn_status_success, xnn_define_tensor_value(
+    subgraph.get(), xnn_datatype_fp32, input_dims.size(), input_dims.data(), nullptr,
+    XNN_INVALID_VALUE_ID, 0 /* flags */, &split_input_id));
+  ASSERT_EQ(xnn_status_success,
+    xnn_define_clamp(subgraph.get(), -INFINITY, INFINITY, input_id, split_input_id, 0 /* flags */));
+  std::array<uint32_t, 3> split_output_ids;
+  for (size_t i = 0; i < 3; i++) {
+    ASSERT_EQ(xnn_status_success, xnn_define_tensor_value(
+      subgraph.get(), xnn_datatype_fp32, output_dims.size(), output_dims.data(), nullptr,
+      XNN_INVALID_VALUE_ID, 0 /* flags */, &split_output_ids[i]));
+  }
+  ASSERT_EQ(xnn_status_success,
+    xnn_define_even_split3(
+      subgraph.get(), 1, split_input_id, split_output_ids[0], split_output_ids[1], split_output_ids[2],
+      0 /* flags */));
+  for (size_t i = 0; i < 3; i++) {
+    ASSERT_EQ(xnn_status_success,
+      xnn_define_clamp(subgraph.get(), -INFINITY, INFINITY, split_output_ids[i], output_ids[i], 0 /* flags */));
+  }
+
+  xnn_runtime_t runtime_ptr = nullptr;
+  ASSERT_EQ(xnn_status_success, xnn_create_runtime_v2(subgraph.get(), nullptr, 0 /* flags */, &runtime_ptr));
+  std::unique_ptr<xnn_runtime, decltype(&xnn_delete_runtime)> runtime(runtime_ptr, xnn_delete_runtime);
+
+  const std::vector<float> input = RandomInput<float>(NumElements(input_dims));
+  EXPECT_EQ(EvenSplit(input, input_dims, 1, 3), Invoke(runtime.get(), input, 3, NumElements(output_dims)));
+
+#if XNN_ENABLE_MEMOPT
+  for (size_t i = 0; i < 3; i++) {
+    EXPECT_EQ(
+      reinterpret_cast<uintptr_t>(runtime->blobs[split_input_id].data) + i * NumElements(output_dims) * sizeof(float),
+      reinterpret_cast<uintptr_t>(runtime->blobs[split_output_ids[i]].data));
+  }
+#endif
+}
+
+TEST(EVEN_SPLIT4, inner_axis_qu8) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  xnn_subgraph_t subgraph_ptr = nullptr;
+  ASSERT_EQ(xnn_status_success, xnn_create_subgraph(5, 0 /* flags */, &subgraph_ptr));
+  std::unique_ptr<xnn_subgraph, decltype(&xnn_delete_subgraph)> subgraph(subgraph_ptr, xnn_delete_subgraph);
+
+  const std::vector<size_t> input_dims = {3, 12, 5};
+  const std::vector<size_t> output_dims = {3, 3, 5};
+  uint32_t input_id = XNN_INVALID_VALUE_ID;
+  std::vector<uint32_t> output_ids;
+  DefineExternalValues(subgraph.get(), xnn_datatype_quint8, input_dims, output_dims, 4, input_id, output_ids);
+  ASSERT_EQ(xnn_status_success,
+    xnn_define_even_split4(
+      subgraph.get(), 1, input_id, output_ids[0], output_ids[1], output_ids[2], output_ids[3], 0 /* flags */));
+
+  xnn_runtime_t runtime_ptr = nullptr;
+  ASSERT_EQ(xnn_status_success, xnn_create_runtime_v2(subgraph.get(), nullptr, 0 /* flags */, &runtime_ptr));
+  std::unique_ptr<xnn_runtime, decltype(&xnn_delete_runtime)> runtime(runtime_ptr, xnn_delete_runtime);
+
+  const std::vector<uint8_t> input = RandomInput<uint8_t>(NumElements(input_dims));
+  EXPECT_EQ(EvenSplit(input, input_dims, 1, 4), Invoke(runtime.get(), input, 4, NumElements(output_dims)));
+}
+
+TEST(EVEN_SPLIT2, reshape) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  xnn_subgraph_t subgraph_ptr = nullptr;
+  ASSERT_EQ(xnn_status_success, xnn_create_subgraph(3, 0 /* flags */, &subgraph_ptr));
+  std::unique_ptr<xnn_subgraph, decltype(&xnn_delete_subgraph)> subgraph(subgraph_ptr, xnn_delete_subgraph);
+
+  uint32_t input_id = XNN_INVALID_VALUE_ID;
+  std::vector<uint32_t> output_ids;
+  DefineExternalValues(subgraph.get(), xnn_datatype_fp32, {1, 4, 6}, {1, 4, 3}, 2, input_id, output_ids);
+  ASSERT_EQ(xnn_status_success,
+    xnn_define_even_split2(subgraph.get(), 2, input_id, output_ids[0], output_ids[1], 0 /* flags */));
+
+  xnn_runtime_t runtime_ptr = nullptr;
+  ASSERT_EQ(xnn_status_success, xnn_create_runtime_v2(subgraph.get(), nullptr, 0 /* flags */, &runtime_ptr));
+  std::unique_ptr<xnn_runtime, decltype(&xnn_delete_runtime)> runtime(runtime_ptr, xnn_delete_runtime);
+
+  const std::vector<size_t> odd_dims = {3, 7, 5};
+  ASSERT_EQ(xnn_status_success, xnn_reshape_external_value(runtime.get(), 0, 3, odd_dims.data()));
+  EXPECT_EQ(xnn_status_invalid_parameter, xnn_reshape_runtime(runtime.get()));
+
+  const std::vector<size_t> input_dims = {3, 7, 10};
+  ASSERT_EQ(xnn_status_success, xnn_reshape_external_value(runtime.get(), 0, 3, input_dims.data()));
+  ASSERT_EQ(xnn_status_success, xnn_reshape_runtime(runtime.get()));
+
+  for (uint32_t i = 1; i <= 2; i++) {
+    size_t num_dims = 0;
+    std::array<size_t, XNN_MAX_TENSOR_DIMS> output_dims;
+    ASSERT_EQ(xnn_status_success, xnn_get_external_value_shape(runtime.get(), i, &num_dims, output_dims.data()));
+    ASSERT_EQ(3, num_dims);
+    EXPECT_EQ(3, output_dims[0]);
+    EXPECT_EQ(7, output_dims[1]);
+    EXPECT_EQ(5, output_dims[2]);
+  }
+
+  const std::vector<float> input = RandomInput<float>(NumElements(input_dims));
+  EXPECT_EQ(EvenSplit(input, input_dims, 2, 2), Invoke(runtime.get(), input, 2, 3 * 7 * 5));
+}
+
+TEST(EVEN_SPLIT2, rejects_invalid_shapes) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  xnn_subgraph_t subgraph_ptr = nullptr;
+  ASSERT_EQ(xnn_status_success, xnn_create_subgraph(3, 0 /* flags */, &subgraph_ptr));
+  std::unique_ptr<xnn_subgraph, decltype(&xnn_delete_subgraph)> subgraph(subgraph_ptr, xnn_delete_subgraph);
+
+  uint32_t input_id = XNN_INVALID_VALUE_ID;
+  std::vector<uint32_t> output_ids;
+  DefineExternalValues(subgraph.get(), xnn_datatype_fp32, {2, 6, 3}, {2, 3, 3}, 2, input_id, output_ids);
+
+  EXPECT_EQ(xnn_status_invalid_parameter,
+    xnn_define_even_split2(subgraph.get(), 2, input_id, output_ids[0], output_ids[1], 0 /* flags */));
+  EXPECT_EQ(xnn_status_invalid_parameter,
+    xnn_define_even_split2(subgraph.get(), 3, input_id, output_ids[0], output_ids[1], 0 /* flags */));
+  EXPECT_EQ(xnn_status_invalid_parameter,
+    xnn_define_even_split3(subgraph.get(), 1, input_id, output_ids[0], output_ids[1], output_ids[1], 0 /* flags */));
+  EXPECT_EQ(xnn_status_success,
+    xnn_define_even_split2(subgraph.get(), 1, input_id, output_ids[0], output_ids[1], 0 /* flags */));
+}
+
+namespace {
+
+// Defines an Even Split Node where the output at unused_index is an internal Value without consumers, which is cleared
+// during Subgraph optimization, and checks the other outputs.
+template<class T>
+void TestUnusedOutput(
+  xnn_datatype datatype, const std::vector<size_t>& input_dims, size_t axis, size_t num_outputs, size_t unused_index)
+{
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  xnn_subgraph_t subgraph_ptr = nullptr;
+  ASSERT_EQ(xnn_status_success, xnn_create_subgraph(num_outputs, 0 /* flags */, &subgraph_ptr));
+  std::unique_ptr<xnn_subgraph, decltype(&xnn_delete_subgraph)> subgraph(subgraph_ptr, xnn_delete_subgraph);
+
+  std::vector<size_t> output_dims = input_dims;
+  output_dims[axis] /= num_outputs;
+  uint32_t input_id = XNN_INVALID_VALUE_ID;
+  std::vector<uint32_t> used_output_ids;
+  DefineExternalValues(subgraph.get(), datatype, input_dims, output_dims, num_outputs - 1, input_id, used_output_ids);
+
+  uint32_t unused_output_id = XNN_INVALID_VALUE_ID;
+  if (datatype == xnn_datatype_fp32) {
+    ASSERT_EQ(xnn_status_success, xnn_define_tensor_value(
+      subgraph.get(), datatype, output_dims.size(), output_dims.data(), nullptr,
+      XNN_INVALID_VALUE_ID, 0 /* flags */, &unused_output_id));
+  } else {
+    ASSERT_EQ(xnn_status_success, xnn_define_quantized_tensor_value(
+      subgraph.get(), datatype, 128, 0.5f, output_dims.size(), output_dims.data(), nullptr,
+      XNN_INVALID_VALUE_ID, 0 /* flags */, &unused_output_id));
+  }
+  std::vector<uint32_t> output_ids = used_output_ids;
+  output_ids.insert(output_ids.begin() + unused_index, unused_output_id);
+
+  // A Clamp Node in front of the Even Split Node makes its input an internal Value, which the outputs may be views of.
+  uint32_t split_input_id = XNN_INVALID_VALUE_ID;
+  if (datatype == xnn_datatype_fp32) {
+    ASSERT_EQ(xnn_status_success, xnn_define_tensor_value(
+      subgraph.get(), datatype, input_dims.size(), input_dims.data(), nullptr,
+      XNN_INVALID_VALUE_ID, 0 /* flags */, &split_input_id));
+  } else {
+    ASSERT_EQ(xnn_status_success, xnn_define_quantized_tensor_value(
+      subgraph.get(), datatype, 128, 0.5f, input_dims.size(), input_dims.data(), nullptr,
+      XNN_INVALID_VALUE_ID, 0 /* flags */, &split_input_id));
+  }
+  ASSERT_EQ(xnn_status_success,
+    xnn_define_clamp(subgraph.get(), -INFINITY, INFINITY, input_id, split_input_id, 0 /* flags */));
+
+  switch (num_outputs) {
+    case 2:
+      ASSERT_EQ(xnn_status_success,
+        xnn_define_even_split2(subgraph.get(), axis, split_input_id, output_ids[0], output_ids[1], 0 /* flags */));
+      break;
+    case 3:
+      ASSERT_EQ(xnn_status_success,
+        xnn_define_even_split3(
+          subgraph.get(), axis, split_input_id, output_ids[0], output_ids[1], output_ids[2], 0 /* flags */));
+      break;
+    case 4:
+      ASSERT_EQ(xnn_status_success,
+        xnn_define_even_split4(
+          subgraph.get(), axis, split_input_id, output_ids[0], output_ids[1], output_ids[2], output_ids[3], 0 /* flags */));
+      break;
+  }
+
+  xnn_runtime_t runtime_ptr = nullptr;
+  ASSERT_EQ(xnn_status_success, xnn_create_runtime_v2(subgraph.get(), nullptr, 0 /* flags */, &runtime_ptr));
+  std::unique_ptr<xnn_runtime, decltype(&xnn_delete_runtime)> runtime(runtime_ptr, xnn_delete_runtime);
+
+  const std::vector<T> input = RandomInput<T>(NumElements(input_dims));
+  std::vector<std::vector<T>> expected = EvenSplit(input, input_dims, axis, num_outputs);
+  expected.erase(expected.begin() + unused_index);
+  EXPECT_EQ(expected, Invoke(runtime.get(), input, num_outputs - 1, NumElements(output_dims)));
+}
+
+}  // namespace
+
+TEST(EVEN_SPLIT2, unused_output) {
+  TestUnusedOutput<float>(xnn_datatype_fp32, {2, 5, 8}, 2, 2, 0 /* unused index */);
+  TestUnusedOutput<float>(xnn_datatype_fp32, {1, 6, 8}, 1, 2, 1 /* unused index */);
+}
+
+TEST(EVEN_SPLIT3, unused_output) {
+  TestUnusedOutput<float>(xnn_datatype_fp32, {1, 9, 4}, 1, 3, 1 /* unused index */);
+  TestUnusedOutput<uint8_t>(xnn_datatype_quint8, {3, 4, 12}, 2, 3, 0 /* unused index */);
+}
+
+TEST(EVEN_SPLIT4, unused_output) {
+  TestUnusedOutput<float>(xnn_datatype_fp32, {2, 8, 3}, 1, 4, 3 /* unused index */);
+  TestUnusedOutput<uint8_t>(xnn_datatype_quint8, {1, 16, 5}, 1, 4, 2 /* unused index */);
+}
@@ -1583,3 +1583,1179 @@
     }
   }
 #endif  // XNN_ARCH_ARM64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F16_SPMM_MINMAX_8X1__FMA3, k_eq_1) {
+    TEST_REQUIRES_X86_FMA3;
+    SpMMMicrokernelTester()
+      .mr(8)
+      .nr(1)
+      .m(8)
+      .n(1)
+      .k(1)
+      .sparsity(0.0f)
+      .Test(xnn_f16_spmm_minmax_ukernel_8x1__fma3, xnn_init_f16_scaleminmax_avx_params);
+  }
+
+  TEST(F16_SPMM_MINMAX_8X1__FMA3, k_gt_1) {
+    TEST_REQUIRES_X86_FMA3;
+    for (size_t k = 2; k < 10; k++) {
+      SpMMMicrokernelTester()
+        .mr(8)
+        .nr(1)
+        .m(8)
+        .n(1)
+        .k(k)
+        .sparsity(0.0f)
+        .Test(xnn_f16_spmm_minmax_ukernel_8x1__fma3, xnn_init_f16_scaleminmax_avx_params);
+    }
+  }
+
+  TEST(F16_SPMM_MINMAX_8X1__FMA3, n_gt_1) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t n = 2; n < 10; n++) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        SpMMMicrokernelTester()
+          .mr(8)
+          .nr(1)
+          .m(8)
+          .n(n)
+          .k(k)
+          .sparsity(0.0f)
+          .Test(xnn_f16_spmm_minmax_ukernel_8x1__fma3, xnn_init_f16_scaleminmax_avx_params);
+      }
+    }
+  }
+
+  TEST(F16_SPMM_MINMAX_8X1__FMA3, m_lt_8) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t m = 1; m < 8; m++) {
+      for (uint32_t n = 1; n < 10; n += 2) {
+        for (size_t k = 1; k <= 5; k += 2) {
+          SpMMMicrokernelTester()
+            .mr(8)
+            .nr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .sparsity(0.0f)
+            .Test(xnn_f16_spmm_minmax_ukernel_8x1__fma3, xnn_init_f16_scaleminmax_avx_params);
+        }
+      }
+    }
+  }
+
+  TEST(F16_SPMM_MINMAX_8X1__FMA3, m_div_8) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t m = 16; m <= 24; m += 8) {
+      for (uint32_t n = 1; n < 10; n += 2) {
+        for (size_t k = 1; k <= 5; k += 2) {
+          SpMMMicrokernelTester()
+            .mr(8)
+            .nr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .sparsity(0.0f)
+            .Test(xnn_f16_spmm_minmax_ukernel_8x1__fma3, xnn_init_f16_scaleminmax_avx_params);
+        }
+      }
+    }
+  }
+
+  TEST(F16_SPMM_MINMAX_8X1__FMA3, m_gt_8) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t m = 9; m < 16; m++) {
+      for (uint32_t n = 1; n < 10; n += 2) {
+        for (size_t k = 1; k <= 5; k += 2) {
+          SpMMMicrokernelTester()
+            .mr(8)
+            .nr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .sparsity(0.0f)
+            .Test(xnn_f16_spmm_minmax_ukernel_8x1__fma3, xnn_init_f16_scaleminmax_avx_params);
+        }
+      }
+    }
+  }
+
+  TEST(F16_SPMM_MINMAX_8X1__FMA3, output_stride) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t n = 1; n < 10; n += 2) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        SpMMMicrokernelTester()
+          .mr(8)
+          .nr(1)
+          .m(16)
+          .n(n)
+          .k(k)
+          .output_stride(19)
+          .sparsity(0.0f)
+          .Test(xnn_f16_spmm_minmax_ukernel_8x1__fma3, xnn_init_f16_scaleminmax_avx_params);
+      }
+    }
+  }
+
+  TEST(F16_SPMM_MINMAX_8X1__FMA3, qmin) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t n = 1; n < 10; n += 2) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        SpMMMicrokernelTester()
+          .mr(8)
+          .nr(1)
+          .m(16)
+          .n(n)
+          .k(k)
+          .sparsity(0.0f)
+          .qmin(128)
+          .Test(xnn_f16_spmm_minmax_ukernel_8x1__fma3, xnn_init_f16_scaleminmax_avx_params);
+      }
+    }
+  }
+
+  TEST(F16_SPMM_MINMAX_8X1__FMA3, qmax) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t n = 1; n < 10; n += 2) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        SpMMMicrokernelTester()
+          .mr(8)
+          .nr(1)
+          .m(16)
+          .n(n)
+          .k(k)
+          .sparsity(0.0f)
+          .qmax(128)
+          .Test(xnn_f16_spmm_minmax_ukernel_8x1__fma3, xnn_init_f16_scaleminmax_avx_params);
+      }
+    }
+  }
+
+  TEST(F16_SPMM_MINMAX_8X1__FMA3, half_sparse) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t n = 1; n < 10; n += 2) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        SpMMMicrokernelTester()
+          .mr(8)
+          .nr(1)
+          .m(16)
+          .n(n)
+          .k(k)
+          .sparsity(0.5f)
+          .Test(xnn_f16_spmm_minmax_ukernel_8x1__fma3, xnn_init_f16_scaleminmax_avx_params);
+      }
+    }
+  }
+
+  TEST(F16_SPMM_MINMAX_8X1__FMA3, zero_weights) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t n = 1; n < 10; n += 2) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        SpMMMicrokernelTester()
+          .mr(8)
+          .nr(1)
+          .m(16)
+          .n(n)
+          .k(k)
+          .sparsity(1.0f)
+          .Test(xnn_f16_spmm_minmax_ukernel_8x1__fma3, xnn_init_f16_scaleminmax_avx_params);
+      }
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F16_SPMM_MINMAX_8X1__FMA3_X2, k_eq_2) {
+    TEST_REQUIRES_X86_FMA3;
+    SpMMMicrokernelTester()
+      .mr(8)
+      .nr(1)
+      .m(8)
+      .n(1)
+      .k(2)
+      .sparsity(0.0f)
+      .Test(xnn_f16_spmm_minmax_ukernel_8x1__fma3_x2, xnn_init_f16_scaleminmax_avx_params);
+  }
+
+  TEST(F16_SPMM_MINMAX_8X1__FMA3_X2, k_lt_2) {
+    TEST_REQUIRES_X86_FMA3;
+    for (size_t k = 1; k < 2; k++) {
+      SpMMMicrokernelTester()
+        .mr(8)
+        .nr(1)
+        .m(8)
+        .n(1)
+        .k(k)
+        .sparsity(0.0f)
+        .Test(xnn_f16_spmm_minmax_ukernel_8x1__fma3_x2, xnn_init_f16_scaleminmax_avx_params);
+    }
+  }
+
+  TEST(F16_SPMM_MINMAX_8X1__FMA3_X2, k_gt_2) {
+    TEST_REQUIRES_X86_FMA3;
+    for (size_t k = 3; k < 4; k++) {
+      SpMMMicrokernelTester()
+        .mr(8)
+        .nr(1)
+        .m(8)
+        .n(1)
+        .k(k)
+        .sparsity(0.0f)
+        .Test(xnn_f16_spmm_minmax_ukernel_8x1__fma3_x2, xnn_init_f16_scaleminmax_avx_params);
+    }
+  }
+
+  TEST(F16_SPMM_MINMAX_8X1__FMA3_X2, k_div_2) {
+    TEST_REQUIRES_X86_FMA3;
+    for (size_t k = 4; k <= 20; k += 2) {
+      SpMMMicrokernelTester()
+        .mr(8)
+        .nr(1)
+        .m(8)
+        .n(1)
+        .k(k)
+        .sparsity(0.0f)
+        .Test(xnn_f16_spmm_minmax_ukernel_8x1__fma3_x2, xnn_init_f16_scaleminmax_avx_params);
+    }
+  }
+
+  TEST(F16_SPMM_MINMAX_8X1__FMA3_X2, n_gt_1) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t n = 2; n < 10; n++) {
+      for (size_t k = 1; k <= 10; k += 3) {
+        SpMMMicrokernelTester()
+          .mr(8)
+          .nr(1)
+          .m(8)
+          .n(n)
+          .k(k)
+          .sparsity(0.0f)
+          .Test(xnn_f16_spmm_minmax_ukernel_8x1__fma3_x2, xnn_init_f16_scaleminmax_avx_params);
+      }
+    }
+  }
+
+  TEST(F16_SPMM_MINMAX_8X1__FMA3_X2, m_lt_8) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t m = 1; m < 8; m++) {
+      for (uint32_t n = 1; n < 10; n += 2) {
+        for (size_t k = 1; k <= 10; k += 3) {
+          SpMMMicrokernelTester()
+            .mr(8)
+            .nr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .sparsity(0.0f)
+            .Test(xnn_f16_spmm_minmax_ukernel_8x1__fma3_x2, xnn_init_f16_scaleminmax_avx_params);
+        }
+      }
+    }
+  }
+
+  TEST(F16_SPMM_MINMAX_8X1__FMA3_X2, m_div_8) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t m = 16; m <= 24; m += 8) {
+      for (uint32_t n = 1; n < 10; n += 2) {
+        for (size_t k = 1; k <= 10; k += 3) {
+          SpMMMicrokernelTester()
+            .mr(8)
+            .nr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .sparsity(0.0f)
+            .Test(xnn_f16_spmm_minmax_ukernel_8x1__fma3_x2, xnn_init_f16_scaleminmax_avx_params);
+        }
+      }
+    }
+  }
+
+  TEST(F16_SPMM_MINMAX_8X1__FMA3_X2, m_gt_8) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t m = 9; m < 16; m++) {
+      for (uint32_t n = 1; n < 10; n += 2) {
+        for (size_t k = 1; k <= 10; k += 3) {
+          SpMMMicrokernelTester()
+            .mr(8)
+            .nr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .sparsity(0.0f)
+            .Test(xnn_f16_spmm_minmax_ukernel_8x1__fma3_x2, xnn_init_f16_scaleminmax_avx_params);
+        }
+      }
+    }
+  }
+
+  TEST(F16_SPMM_MINMAX_8X1__FMA3_X2, output_stride) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t n = 1; n < 10; n += 2) {
+      for (size_t k = 1; k <= 10; k += 3) {
+        SpMMMicrokernelTester()
+          .mr(8)
+          .nr(1)
+          .m(16)
+          .n(n)
+          .k(k)
+          .output_stride(19)
+          .sparsity(0.0f)
+          .Test(xnn_f16_spmm_minmax_ukernel_8x1__fma3_x2, xnn_init_f16_scaleminmax_avx_params);
+      }
+    }
+  }
+
+  TEST(F16_SPMM_MINMAX_8X1__FMA3_X2, qmin) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t n = 1; n < 10; n += 2) {
+      for (size_t k = 1; k <= 10; k += 3) {
+        SpMMMicrokernelTester()
+          .mr(8)
+          .nr(1)
+          .m(16)
+          .n(n)
+          .k(k)
+          .sparsity(0.0f)
+          .qmin(128)
+          .Test(xnn_f16_spmm_minmax_ukernel_8x1__fma3_x2, xnn_init_f16_scaleminmax_avx_params);
+      }
+    }
+  }
+
+  TEST(F16_SPMM_MINMAX_8X1__FMA3_X2, qmax) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t n = 1; n < 10; n += 2) {
+      for (size_t k = 1; k <= 10; k += 3) {
+        SpMMMicrokernelTester()
+          .mr(8)
+          .nr(1)
+          .m(16)
+          .n(n)
+          .k(k)
+          .sparsity(0.0f)
+          .qmax(128)
+          .Test(xnn_f16_spmm_minmax_ukernel_8x1__fma3_x2, xnn_init_f16_scaleminmax_avx_params);
+      }
+    }
+  }
+
+  TEST(F16_SPMM_MINMAX_8X1__FMA3_X2, half_sparse) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t n = 1; n < 10; n += 2) {
+      for (size_t k = 1; k <= 10; k += 3) {
+        SpMMMicrokernelTester()
+          .mr(8)
+          .nr(1)
+          .m(16)
+          .n(n)
+          .k(k)
+          .sparsity(0.5f)
+          .Test(xnn_f16_spmm_minmax_ukernel_8x1__fma3_x2, xnn_init_f16_scaleminmax_avx_params);
+      }
+    }
+  }
+
+  TEST(F16_SPMM_MINMAX_8X1__FMA3_X2, zero_weights) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t n = 1; n < 10; n += 2) {
+      for (size_t k = 1; k <= 10; k += 3) {
+        SpMMMicrokernelTester()
+          .mr(8)
+          .nr(1)
+          .m(16)
+          .n(n)
+          .k(k)
+          .sparsity(1.0f)
+          .Test(xnn_f16_spmm_minmax_ukernel_8x1__fma3_x2, xnn_init_f16_scaleminmax_avx_params);
+      }
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F16_SPMM_MINMAX_16X1__FMA3, k_eq_1) {
+    TEST_REQUIRES_X86_FMA3;
+    SpMMMicrokernelTester()
+      .mr(16)
+      .nr(1)
+      .m(16)
+      .n(1)
+      .k(1)
+      .sparsity(0.0f)
+      .Test(xnn_f16_spmm_minmax_ukernel_16x1__fma3, xnn_init_f16_scaleminmax_avx_params);
+  }
+
+  TEST(F16_SPMM_MINMAX_16X1__FMA3, k_gt_1) {
+    TEST_REQUIRES_X86_FMA3;
+    for (size_t k = 2; k < 10; k++) {
+      SpMMMicrokernelTester()
+        .mr(16)
+        .nr(1)
+        .m(16)
+        .n(1)
+        .k(k)
+        .sparsity(0.0f)
+        .Test(xnn_f16_spmm_minmax_ukernel_16x1__fma3, xnn_init_f16_scaleminmax_avx_params);
+    }
+  }
+
+  TEST(F16_SPMM_MINMAX_16X1__FMA3, n_gt_1) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t n = 2; n < 10; n++) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        SpMMMicrokernelTester()
+          .mr(16)
+          .nr(1)
+          .m(16)
+          .n(n)
+          .k(k)
+          .sparsity(0.0f)
+          .Test(xnn_f16_spmm_minmax_ukernel_16x1__fma3, xnn_init_f16_scaleminmax_avx_params);
+      }
+    }
+  }
+
+  TEST(F16_SPMM_MINMAX_16X1__FMA3, m_lt_16) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t m = 1; m < 16; m++) {
+      for (uint32_t n = 1; n < 10; n += 2) {
+        for (size_t k = 1; k <= 5; k += 2) {
+          SpMMMicrokernelTester()
+            .mr(16)
+            .nr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .sparsity(0.0f)
+            .Test(xnn_f16_spmm_minmax_ukernel_16x1__fma3, xnn_init_f16_scaleminmax_avx_params);
+        }
+      }
+    }
+  }
+
+  TEST(F16_SPMM_MINMAX_16X1__FMA3, m_div_16) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t m = 32; m <= 48; m += 16) {
+      for (uint32_t n = 1; n < 10; n += 2) {
+        for (size_t k = 1; k <= 5; k += 2) {
+          SpMMMicrokernelTester()
+            .mr(16)
+            .nr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .sparsity(0.0f)
+            .Test(xnn_f16_spmm_minmax_ukernel_16x1__fma3, xnn_init_f16_scaleminmax_avx_params);
+        }
+      }
+    }
+  }
+
+  TEST(F16_SPMM_MINMAX_16X1__FMA3, m_gt_16) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t m = 17; m < 32; m++) {
+      for (uint32_t n = 1; n < 10; n += 2) {
+        for (size_t k = 1; k <= 5; k += 2) {
+          SpMMMicrokernelTester()
+            .mr(16)
+            .nr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .sparsity(0.0f)
+            .Test(xnn_f16_spmm_minmax_ukernel_16x1__fma3, xnn_init_f16_scaleminmax_avx_params);
+        }
+      }
+    }
+  }
+
+  TEST(F16_SPMM_MINMAX_16X1__FMA3, output_stride) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t n = 1; n < 10; n += 2) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        SpMMMicrokernelTester()
+          .mr(16)
+          .nr(1)
+          .m(32)
+          .n(n)
+          .k(k)
+          .output_stride(37)
+          .sparsity(0.0f)
+          .Test(xnn_f16_spmm_minmax_ukernel_16x1__fma3, xnn_init_f16_scaleminmax_avx_params);
+      }
+    }
+  }
+
+  TEST(F16_SPMM_MINMAX_16X1__FMA3, qmin) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t n = 1; n < 10; n += 2) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        SpMMMicrokernelTester()
+          .mr(16)
+          .nr(1)
+          .m(32)
+          .n(n)
+          .k(k)
+          .sparsity(0.0f)
+          .qmin(128)
+          .Test(xnn_f16_spmm_minmax_ukernel_16x1__fma3, xnn_init_f16_scaleminmax_avx_params);
+      }
+    }
+  }
+
+  TEST(F16_SPMM_MINMAX_16X1__FMA3, qmax) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t n = 1; n < 10; n += 2) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        SpMMMicrokernelTester()
+          .mr(16)
+          .nr(1)
+          .m(32)
+          .n(n)
+          .k(k)
+          .sparsity(0.0f)
+          .qmax(128)
+          .Test(xnn_f16_spmm_minmax_ukernel_16x1__fma3, xnn_init_f16_scaleminmax_avx_params);
+      }
+    }
+  }
+
+  TEST(F16_SPMM_MINMAX_16X1__FMA3, half_sparse) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t n = 1; n < 10; n += 2) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        SpMMMicrokernelTester()
+          .mr(16)
+          .nr(1)
+          .m(32)
+          .n(n)
+          .k(k)
+          .sparsity(0.5f)
+          .Test(xnn_f16_spmm_minmax_ukernel_16x1__fma3, xnn_init_f16_scaleminmax_avx_params);
+      }
+    }
+  }
+
+  TEST(F16_SPMM_MINMAX_16X1__FMA3, zero_weights) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t n = 1; n < 10; n += 2) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        SpMMMicrokernelTester()
+          .mr(16)
+          .nr(1)
+          .m(32)
+          .n(n)
+          .k(k)
+          .sparsity(1.0f)
+          .Test(xnn_f16_spmm_minmax_ukernel_16x1__fma3, xnn_init_f16_scaleminmax_avx_params);
+      }
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F16_SPMM_MINMAX_16X1__FMA3_X2, k_eq_2) {
+    TEST_REQUIRES_X86_FMA3;
+    SpMMMicrokernelTester()
+      .mr(16)
+      .nr(1)
+      .m(16)
+      .n(1)
+      .k(2)
+      .sparsity(0.0f)
+      .Test(xnn_f16_spmm_minmax_ukernel_16x1__fma3_x2, xnn_init_f16_scaleminmax_avx_params);
+  }
+
+  TEST(F16_SPMM_MINMAX_16X1__FMA3_X2, k_lt_2) {
+    TEST_REQUIRES_X86_FMA3;
+    for (size_t k = 1; k < 2; k++) {
+      SpMMMicrokernelTester()
+        .mr(16)
+        .nr(1)
+        .m(16)
+        .n(1)
+        .k(k)
+        .sparsity(0.0f)
+        .Test(xnn_f16_spmm_minmax_ukernel_16x1__fma3_x2, xnn_init_f16_scaleminmax_avx_params);
+    }
+  }
+
+  TEST(F16_SPMM_MINMAX_16X1__FMA3_X2, k_gt_2) {
+    TEST_REQUIRES_X86_FMA3;
+    for (size_t k = 3; k < 4; k++) {
+      SpMMMicrokernelTester()
+        .mr(16)
+        .nr(1)
+        .m(16)
+        .n(1)
+        .k(k)
+        .sparsity(0.0f)
+        .Test(xnn_f16_spmm_minmax_ukernel_16x1__fma3_x2, xnn_init_f16_scaleminmax_avx_params);
+    }
+  }
+
+  TEST(F16_SPMM_MINMAX_16X1__FMA3_X2, k_div_2) {
+    TEST_REQUIRES_X86_FMA3;
+    for (size_t k = 4; k <= 20; k += 2) {
+      SpMMMicrokernelTester()
+        .mr(16)
+        .nr(1)
+        .m(16)
+        .n(1)
+        .k(k)
+        .sparsity(0.0f)
+        .Test(xnn_f16_spmm_minmax_ukernel_16x1__fma3_x2, xnn_init_f16_scaleminmax_avx_params);
+    }
+  }
+
+  TEST(F16_SPMM_MINMAX_16X1__FMA3_X2, n_gt_1) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t n = 2; n < 10; n++) {
+      for (size_t k = 1; k <= 10; k += 3) {
+        SpMMMicrokernelTester()
+          .mr(16)
+          .nr(1)
+          .m(16)
+          .n(n)
+          .k(k)
+          .sparsity(0.0f)
+          .Test(xnn_f16_spmm_minmax_ukernel_16x1__fma3_x2, xnn_init_f16_scaleminmax_avx_params);
+      }
+    }
+  }
+
+  TEST(F16_SPMM_MINMAX_16X1__FMA3_X2, m_lt_16) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t m = 1; m < 16; m++) {
+      for (uint32_t n = 1; n < 10; n += 2) {
+        for (size_t k = 1; k <= 10; k += 3) {
+          SpMMMicrokernelTester()
+            .mr(16)
+            .nr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .sparsity(0.0f)
+            .Test(xnn_f16_spmm_minmax_ukernel_16x1__fma3_x2, xnn_init_f16_scaleminmax_avx_params);
+        }
+      }
+    }
+  }
+
+  TEST(F16_SPMM_MINMAX_16X1__FMA3_X2, m_div_16) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t m = 32; m <= 48; m += 16) {
+      for (uint32_t n = 1; n < 10; n += 2) {
+        for (size_t k = 1; k <= 10; k += 3) {
+          SpMMMicrokernelTester()
+            .mr(16)
+            .nr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .sparsity(0.0f)
+            .Test(xnn_f16_spmm_minmax_ukernel_16x1__fma3_x2, xnn_init_f16_scaleminmax_avx_params);
+        }
+      }
+    }
+  }
+
+  TEST(F16_SPMM_MINMAX_16X1__FMA3_X2, m_gt_16) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t m = 17; m < 32; m++) {
+      for (uint32_t n = 1; n < 10; n += 2) {
+        for (size_t k = 1; k <= 10; k += 3) {
+          SpMMMicrokernelTester()
+            .mr(16)
+            .nr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .sparsity(0.0f)
+            .Test(xnn_f16_spmm_minmax_ukernel_16x1__fma3_x2, xnn_init_f16_scaleminmax_avx_params);
+        }
+      }
+    }
+  }
+
+  TEST(F16_SPMM_MINMAX_16X1__FMA3_X2, output_stride) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t n = 1; n < 10; n += 2) {
+      for (size_t k = 1; k <= 10; k += 3) {
+        SpMMMicrokernelTester()
+          .mr(16)
+          .nr(1)
+          .m(32)
+          .n(n)
+          .k(k)
+          .output_stride(37)
+          .sparsity(0.0f)
+          .Test(xnn_f16_spmm_minmax_ukernel_16x1__fma3_x2, xnn_init_f16_scaleminmax_avx_params);
+      }
+    }
+  }
+
+  TEST(F16_SPMM_MINMAX_16X1__FMA3_X2, qmin) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t n = 1; n < 10; n += 2) {
+      for (size_t k = 1; k <= 10; k += 3) {
+        SpMMMicrokernelTester()
+          .mr(16)
+          .nr(1)
+          .m(32)
+          .n(n)
+          .k(k)
+          .sparsity(0.0f)
+          .qmin(128)
+          .Test(xnn_f16_spmm_minmax_ukernel_16x1__fma3_x2, xnn_init_f16_scaleminmax_avx_params);
+      }
+    }
+  }
+
+  TEST(F16_SPMM_MINMAX_16X1__FMA3_X2, qmax) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t n = 1; n < 10; n += 2) {
+      for (size_t k = 1; k <= 10; k += 3) {
+        SpMMMicrokernelTester()
+          .mr(16)
+          .nr(1)
+          .m(32)
+          .n(n)
+          .k(k)
+          .sparsity(0.0f)
+          .qmax(128)
+          .Test(xnn_f16_spmm_minmax_ukernel_16x1__fma3_x2, xnn_init_f16_scaleminmax_avx_params);
+      }
+    }
+  }
+
+  TEST(F16_SPMM_MINMAX_16X1__FMA3_X2, half_sparse) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t n = 1; n < 10; n += 2) {
+      for (size_t k = 1; k <= 10; k += 3) {
+        SpMMMicrokernelTester()
+          .mr(16)
+          .nr(1)
+          .m(32)
+          .n(n)
+          .k(k)
+          .sparsity(0.5f)
+          .Test(xnn_f16_spmm_minmax_ukernel_16x1__fma3_x2, xnn_init_f16_scaleminmax_avx_params);
+      }
+    }
+  }
+
+  TEST(F16_SPMM_MINMAX_16X1__FMA3_X2, zero_weights) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t n = 1; n < 10; n += 2) {
+      for (size_t k = 1; k <= 10; k += 3) {
+        SpMMMicrokernelTester()
+          .mr(16)
+          .nr(1)
+          .m(32)
+          .n(n)
+          .k(k)
+          .sparsity(1.0f)
+          .Test(xnn_f16_spmm_minmax_ukernel_16x1__fma3_x2, xnn_init_f16_scaleminmax_avx_params);
+      }
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F16_SPMM_MINMAX_32X1__FMA3, k_eq_1) {
+    TEST_REQUIRES_X86_FMA3;
+    SpMMMicrokernelTester()
+      .mr(32)
+      .nr(1)
+      .m(32)
+      .n(1)
+      .k(1)
+      .sparsity(0.0f)
+      .Test(xnn_f16_spmm_minmax_ukernel_32x1__fma3, xnn_init_f16_scaleminmax_avx_params);
+  }
+
+  TEST(F16_SPMM_MINMAX_32X1__FMA3, k_gt_1) {
+    TEST_REQUIRES_X86_FMA3;
+    for (size_t k = 2; k < 10; k++) {
+      SpMMMicrokernelTester()
+        .mr(32)
+        .nr(1)
+        .m(32)
+        .n(1)
+        .k(k)
+        .sparsity(0.0f)
+        .Test(xnn_f16_spmm_minmax_ukernel_32x1__fma3, xnn_init_f16_scaleminmax_avx_params);
+    }
+  }
+
+  TEST(F16_SPMM_MINMAX_32X1__FMA3, n_gt_1) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t n = 2; n < 10; n++) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        SpMMMicrokernelTester()
+          .mr(32)
+          .nr(1)
+          .m(32)
+          .n(n)
+          .k(k)
+          .sparsity(0.0f)
+          .Test(xnn_f16_spmm_minmax_ukernel_32x1__fma3, xnn_init_f16_scaleminmax_avx_params);
+      }
+    }
+  }
+
+  TEST(F16_SPMM_MINMAX_32X1__FMA3, m_lt_32) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t m = 1; m < 32; m++) {
+      for (uint32_t n = 1; n < 10; n += 2) {
+        for (size_t k = 1; k <= 5; k += 2) {
+          SpMMMicrokernelTester()
+            .mr(32)
+            .nr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .sparsity(0.0f)
+            .Test(xnn_f16_spmm_minmax_ukernel_32x1__fma3, xnn_init_f16_scaleminmax_avx_params);
+        }
+      }
+    }
+  }
+
+  TEST(F16_SPMM_MINMAX_32X1__FMA3, m_div_32) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t m = 64; m <= 96; m += 32) {
+      for (uint32_t n = 1; n < 10; n += 2) {
+        for (size_t k = 1; k <= 5; k += 2) {
+          SpMMMicrokernelTester()
+            .mr(32)
+            .nr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .sparsity(0.0f)
+            .Test(xnn_f16_spmm_minmax_ukernel_32x1__fma3, xnn_init_f16_scaleminmax_avx_params);
+        }
+      }
+    }
+  }
+
+  TEST(F16_SPMM_MINMAX_32X1__FMA3, m_gt_32) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t m = 33; m < 64; m++) {
+      for (uint32_t n = 1; n < 10; n += 2) {
+        for (size_t k = 1; k <= 5; k += 2) {
+          SpMMMicrokernelTester()
+            .mr(32)
+            .nr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .sparsity(0.0f)
+            .Test(xnn_f16_spmm_minmax_ukernel_32x1__fma3, xnn_init_f16_scaleminmax_avx_params);
+        }
+      }
+    }
+  }
+
+  TEST(F16_SPMM_MINMAX_32X1__FMA3, output_stride) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t n = 1; n < 10; n += 2) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        SpMMMicrokernelTester()
+          .mr(32)
+          .nr(1)
+          .m(64)
+          .n(n)
+          .k(k)
+          .output_stride(67)
+          .sparsity(0.0f)
+          .Test(xnn_f16_spmm_minmax_ukernel_32x1__fma3, xnn_init_f16_scaleminmax_avx_params);
+      }
+    }
+  }
+
+  TEST(F16_SPMM_MINMAX_32X1__FMA3, qmin) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t n = 1; n < 10; n += 2) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        SpMMMicrokernelTester()
+          .mr(32)
+          .nr(1)
+          .m(64)
+          .n(n)
+          .k(k)
+          .sparsity(0.0f)
+          .qmin(128)
+          .Test(xnn_f16_spmm_minmax_ukernel_32x1__fma3, xnn_init_f16_scaleminmax_avx_params);
+      }
+    }
+  }
+
+  TEST(F16_SPMM_MINMAX_32X1__FMA3, qmax) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t n = 1; n < 10; n += 2) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        SpMMMicrokernelTester()
+          .mr(32)
+          .nr(1)
+          .m(64)
+          .n(n)
+          .k(k)
+          .sparsity(0.0f)
+          .qmax(128)
+          .Test(xnn_f16_spmm_minmax_ukernel_32x1__fma3, xnn_init_f16_scaleminmax_avx_params);
+      }
+    }
+  }
+
+  TEST(F16_SPMM_MINMAX_32X1__FMA3, half_sparse) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t n = 1; n < 10; n += 2) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        SpMMMicrokernelTester()
+          .mr(32)
+          .nr(1)
+          .m(64)
+          .n(n)
+          .k(k)
+          .sparsity(0.5f)
+          .Test(xnn_f16_spmm_minmax_ukernel_32x1__fma3, xnn_init_f16_scaleminmax_avx_params);
+      }
+    }
+  }
+
+  TEST(F16_SPMM_MINMAX_32X1__FMA3, zero_weights) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t n = 1; n < 10; n += 2) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        SpMMMicrokernelTester()
+          .mr(32)
+          .nr(1)
+          .m(64)
+          .n(n)
+          .k(k)
+          .sparsity(1.0f)
+          .Test(xnn_f16_spmm_minmax_ukernel_32x1__fma3, xnn_init_f16_scaleminmax_avx_params);
+      }
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F16_SPMM_MINMAX_32X1__FMA3_X2, k_eq_2) {
+    TEST_REQUIRES_X86_FMA3;
+    SpMMMicrokernelTester()
+      .mr(32)
+      .nr(1)
+      .m(32)
+      .n(1)
+      .k(2)
+      .sparsity(0.0f)
+      .Test(xnn_f16_spmm_minmax_ukernel_32x1__fma3_x2, xnn_init_f16_scaleminmax_avx_params);
+  }
+
+  TEST(F16_SPMM_MINMAX_32X1__FMA3_X2, k_lt_2) {
+    TEST_REQUIRES_X86_FMA3;
+    for (size_t k = 1; k < 2; k++) {
+      SpMMMicrokernelTester()
+        .mr(32)
+        .nr(1)
+        .m(32)
+        .n(1)
+        .k(k)
+        .sparsity(0.0f)
+        .Test(xnn_f16_spmm_minmax_ukernel_32x1__fma3_x2, xnn_init_f16_scaleminmax_avx_params);
+    }
+  }
+
+  TEST(F16_SPMM_MINMAX_32X1__FMA3_X2, k_gt_2) {
+    TEST_REQUIRES_X86_FMA3;
+    for (size_t k = 3; k < 4; k++) {
+      SpMMMicrokernelTester()
+        .mr(32)
+        .nr(1)
+        .m(32)
+        .n(1)
+        .k(k)
+        .sparsity(0.0f)
+        .Test(xnn_f16_spmm_minmax_ukernel_32x1__fma3_x2, xnn_init_f16_scaleminmax_avx_params);
+    }
+  }
+
+  TEST(F16_SPMM_MINMAX_32X1__FMA3_X2, k_div_2) {
+    TEST_REQUIRES_X86_FMA3;
+    for (size_t k = 4; k <= 20; k += 2) {
+      SpMMMicrokernelTester()
+        .mr(32)
+        .nr(1)
+        .m(32)
+        .n(1)
+        .k(k)
+        .sparsity(0.0f)
+        .Test(xnn_f16_spmm_minmax_ukernel_32x1__fma3_x2, xnn_init_f16_scaleminmax_avx_params);
+    }
+  }
+
+  TEST(F16_SPMM_MINMAX_32X1__FMA3_X2, n_gt_1) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t n = 2; n < 10; n++) {
+      for (size_t k = 1; k <= 10; k += 3) {
+        SpMMMicrokernelTester()
+          .mr(32)
+          .nr(1)
+          .m(32)
+          .n(n)
+          .k(k)
+          .sparsity(0.0f)
+          .Test(xnn_f16_spmm_minmax_ukernel_32x1__fma3_x2, xnn_init_f16_scaleminmax_avx_params);
+      }
+    }
+  }
+
+  TEST(F16_SPMM_MINMAX_32X1__FMA3_X2, m_lt_32) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t m = 1; m < 32; m++) {
+      for (uint32_t n = 1; n < 10; n += 2) {
+        for (size_t k = 1; k <= 10; k += 3) {
+          SpMMMicrokernelTester()
+            .mr(32)
+            .nr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .sparsity(0.0f)
+            .Test(xnn_f16_spmm_minmax_ukernel_32x1__fma3_x2, xnn_init_f16_scaleminmax_avx_params);
+        }
+      }
+    }
+  }
+
+  TEST(F16_SPMM_MINMAX_32X1__FMA3_X2, m_div_32) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t m = 64; m <= 96; m += 32) {
+      for (uint32_t n = 1; n < 10; n += 2) {
+        for (size_t k = 1; k <= 10; k += 3) {
+          SpMMMicrokernelTester()
+            .mr(32)
+            .nr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .sparsity(0.0f)
+            .Test(xnn_f16_spmm_minmax_ukernel_32x1__fma3_x2, xnn_init_f16_scaleminmax_avx_params);
+        }
+      }
+    }
+  }
+
+  TEST(F16_SPMM_MINMAX_32X1__FMA3_X2, m_gt_32) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t m = 33; m < 64; m++) {
+      for (uint32_t n = 1; n < 10; n += 2) {
+        for (size_t k = 1; k <= 10; k += 3) {
+          SpMMMicrokernelTester()
+            .mr(32)
+            .nr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .sparsity(0.0f)
+            .Test(xnn_f16_spmm_minmax_ukernel_32x1__fma3_x2, xnn_init_f16_scaleminmax_avx_params);
+        }
+      }
+    }
+  }
+
+  TEST(F16_SPMM_MINMAX_32X1__FMA3_X2, output_stride) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t n = 1; n < 10; n += 2) {
+      for (size_t k = 1; k <= 10; k += 3) {
+        SpMMMicrokernelTester()
+          .mr(32)
+          .nr(1)
+          .m(64)
+          .n(n)
+          .k(k)
+          .output_stride(67)
+          .sparsity(0.0f)
+          .Test(xnn_f16_spmm_minmax_ukernel_32x1__fma3_x2, xnn_init_f16_scaleminmax_avx_params);
+      }
+    }
+  }
+
+  TEST(F16_SPMM_MINMAX_32X1__FMA3_X2, qmin) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t n = 1; n < 10; n += 2) {
+      for (size_t k = 1; k <= 10; k += 3) {
+        SpMMMicrokernelTester()
+          .mr(32)
+          .nr(1)
+          .m(64)
+          .n(n)
+          .k(k)
+          .sparsity(0.0f)
+          .qmin(128)
+          .Test(xnn_f16_spmm_minmax_ukernel_32x1__fma3_x2, xnn_init_f16_scaleminmax_avx_params);
+      }
+    }
+  }
+
+  TEST(F16_SPMM_MINMAX_32X1__FMA3_X2, qmax) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t n = 1; n < 10; n += 2) {
+      for (size_t k = 1; k <= 10; k += 3) {
+        SpMMMicrokernelTester()
+          .mr(32)
+          .nr(1)
+          .m(64)
+          .n(n)
+          .k(k)
+          .sparsity(0.0f)
+          .qmax(128)
+          .Test(xnn_f16_spmm_minmax_ukernel_32x1__fma3_x2, xnn_init_f16_scaleminmax_avx_params);
+      }
+    }
+  }
+
+  TEST(F16_SPMM_MINMAX_32X1__FMA3_X2, half_sparse) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t n = 1; n < 10; n += 2) {
+      for (size_t k = 1; k <= 10; k += 3) {
+        SpMMMicrokernelTester()
+          .mr(32)
+          .nr(1)
+          .m(64)
+          .n(n)
+          .k(k)
+          .sparsity(0.5f)
+          .Test(xnn_f16_spmm_minmax_ukernel_32x1__fma3_x2, xnn_init_f16_scaleminmax_avx_params);
+      }
+    }
+  }
+
+  TEST(F16_SPMM_MINMAX_32X1__FMA3_X2, zero_weights) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t n = 1; n < 10; n += 2) {
+      for (size_t k = 1; k <= 10; k += 3) {
+        SpMMMicrokernelTester()
+          .mr(32)
+          .nr(1)
+          .m(64)
+          .n(n)
+          .k(k)
+          .sparsity(1.0f)
+          .Test(xnn_f16_spmm_minmax_ukernel_32x1__fma3_x2, xnn_init_f16_scaleminmax_avx_params);
+      }
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
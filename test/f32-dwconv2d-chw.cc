@@ -16731,6 +16731,8144 @@
 #endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
 
 
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F32_DWCONV2D_CHW_3X3P1__AVX_1X8, output_width_eq_8) {
+    TEST_REQUIRES_X86_AVX;
+    DWConv2DMicrokernelTester()
+      .input_width(8)
+      .input_height(1)
+      .kernel_height(3)
+      .kernel_width(3)
+      .subsampling(1)
+      .padding_left(1)
+      .padding_right(1)
+      .padding_top(1)
+      .padding_bottom(1)
+      .Test(xnn_f32_dwconv2d_chw_ukernel_3x3p1__avx_1x8);
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3P1__AVX_1X8, output_width_div_8) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_width = 16; input_width < 64; input_width += 8) {
+      DWConv2DMicrokernelTester()
+        .input_width(input_width)
+        .input_height(1)
+        .kernel_height(3)
+        .kernel_width(3)
+        .subsampling(1)
+        .padding_left(1)
+        .padding_right(1)
+        .padding_top(1)
+        .padding_bottom(1)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_3x3p1__avx_1x8);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3P1__AVX_1X8, output_width_lt_8) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_width = 1; input_width < 8; input_width++) {
+      DWConv2DMicrokernelTester()
+        .input_width(8)
+        .input_height(1)
+        .kernel_height(3)
+        .kernel_width(3)
+        .subsampling(1)
+        .padding_left(1)
+        .padding_right(1)
+        .padding_top(1)
+        .padding_bottom(1)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_3x3p1__avx_1x8);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3P1__AVX_1X8, output_width_gt_8) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_width = 9; input_width < 17; input_width++) {
+      DWConv2DMicrokernelTester()
+        .input_width(input_width)
+        .input_height(1)
+        .kernel_height(3)
+        .kernel_width(3)
+        .subsampling(1)
+        .padding_left(1)
+        .padding_right(1)
+        .padding_top(1)
+        .padding_bottom(1)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_3x3p1__avx_1x8);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3P1__AVX_1X8, output_height_gt_1) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_height = 2; input_height < 3; input_height++) {
+      for (size_t input_width = 1; input_width < 41; input_width += 7) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(3)
+          .kernel_width(3)
+          .subsampling(1)
+          .padding_left(1)
+          .padding_right(1)
+          .padding_top(1)
+          .padding_bottom(1)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_3x3p1__avx_1x8);
+      }
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F32_DWCONV2D_CHW_3X3P1__AVX_2X8, output_width_eq_8) {
+    TEST_REQUIRES_X86_AVX;
+    DWConv2DMicrokernelTester()
+      .input_width(8)
+      .input_height(2)
+      .kernel_height(3)
+      .kernel_width(3)
+      .subsampling(1)
+      .padding_left(1)
+      .padding_right(1)
+      .padding_top(1)
+      .padding_bottom(1)
+      .Test(xnn_f32_dwconv2d_chw_ukernel_3x3p1__avx_2x8);
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3P1__AVX_2X8, output_width_div_8) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_width = 16; input_width < 64; input_width += 8) {
+      DWConv2DMicrokernelTester()
+        .input_width(input_width)
+        .input_height(2)
+        .kernel_height(3)
+        .kernel_width(3)
+        .subsampling(1)
+        .padding_left(1)
+        .padding_right(1)
+        .padding_top(1)
+        .padding_bottom(1)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_3x3p1__avx_2x8);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3P1__AVX_2X8, output_width_lt_8) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_width = 1; input_width < 8; input_width++) {
+      DWConv2DMicrokernelTester()
+        .input_width(8)
+        .input_height(2)
+        .kernel_height(3)
+        .kernel_width(3)
+        .subsampling(1)
+        .padding_left(1)
+        .padding_right(1)
+        .padding_top(1)
+        .padding_bottom(1)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_3x3p1__avx_2x8);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3P1__AVX_2X8, output_width_gt_8) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_width = 9; input_width < 17; input_width++) {
+      DWConv2DMicrokernelTester()
+        .input_width(input_width)
+        .input_height(2)
+        .kernel_height(3)
+        .kernel_width(3)
+        .subsampling(1)
+        .padding_left(1)
+        .padding_right(1)
+        .padding_top(1)
+        .padding_bottom(1)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_3x3p1__avx_2x8);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3P1__AVX_2X8, output_height_div_2) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_height = 4; input_height < 16; input_height += 2) {
+      for (size_t input_width = 1; input_width < 41; input_width += 7) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(3)
+          .kernel_width(3)
+          .subsampling(1)
+          .padding_left(1)
+          .padding_right(1)
+          .padding_top(1)
+          .padding_bottom(1)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_3x3p1__avx_2x8);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3P1__AVX_2X8, output_height_lt_2) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_height = 1; input_height < 2; input_height++) {
+      for (size_t input_width = 1; input_width < 41; input_width += 7) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(3)
+          .kernel_width(3)
+          .subsampling(1)
+          .padding_left(1)
+          .padding_right(1)
+          .padding_top(1)
+          .padding_bottom(1)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_3x3p1__avx_2x8);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3P1__AVX_2X8, output_height_gt_2) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_height = 3; input_height < 5; input_height++) {
+      for (size_t input_width = 1; input_width < 41; input_width += 7) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(3)
+          .kernel_width(3)
+          .subsampling(1)
+          .padding_left(1)
+          .padding_right(1)
+          .padding_top(1)
+          .padding_bottom(1)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_3x3p1__avx_2x8);
+      }
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F32_DWCONV2D_CHW_3X3P1__AVX_3X8, output_width_eq_8) {
+    TEST_REQUIRES_X86_AVX;
+    DWConv2DMicrokernelTester()
+      .input_width(8)
+      .input_height(3)
+      .kernel_height(3)
+      .kernel_width(3)
+      .subsampling(1)
+      .padding_left(1)
+      .padding_right(1)
+      .padding_top(1)
+      .padding_bottom(1)
+      .Test(xnn_f32_dwconv2d_chw_ukernel_3x3p1__avx_3x8);
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3P1__AVX_3X8, output_width_div_8) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_width = 16; input_width < 64; input_width += 8) {
+      DWConv2DMicrokernelTester()
+        .input_width(input_width)
+        .input_height(3)
+        .kernel_height(3)
+        .kernel_width(3)
+        .subsampling(1)
+        .padding_left(1)
+        .padding_right(1)
+        .padding_top(1)
+        .padding_bottom(1)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_3x3p1__avx_3x8);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3P1__AVX_3X8, output_width_lt_8) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_width = 1; input_width < 8; input_width++) {
+      DWConv2DMicrokernelTester()
+        .input_width(8)
+        .input_height(3)
+        .kernel_height(3)
+        .kernel_width(3)
+        .subsampling(1)
+        .padding_left(1)
+        .padding_right(1)
+        .padding_top(1)
+        .padding_bottom(1)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_3x3p1__avx_3x8);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3P1__AVX_3X8, output_width_gt_8) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_width = 9; input_width < 17; input_width++) {
+      DWConv2DMicrokernelTester()
+        .input_width(input_width)
+        .input_height(3)
+        .kernel_height(3)
+        .kernel_width(3)
+        .subsampling(1)
+        .padding_left(1)
+        .padding_right(1)
+        .padding_top(1)
+        .padding_bottom(1)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_3x3p1__avx_3x8);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3P1__AVX_3X8, output_height_div_3) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_height = 6; input_height < 24; input_height += 3) {
+      for (size_t input_width = 1; input_width < 41; input_width += 7) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(3)
+          .kernel_width(3)
+          .subsampling(1)
+          .padding_left(1)
+          .padding_right(1)
+          .padding_top(1)
+          .padding_bottom(1)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_3x3p1__avx_3x8);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3P1__AVX_3X8, output_height_lt_3) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_height = 1; input_height < 3; input_height++) {
+      for (size_t input_width = 1; input_width < 41; input_width += 7) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(3)
+          .kernel_width(3)
+          .subsampling(1)
+          .padding_left(1)
+          .padding_right(1)
+          .padding_top(1)
+          .padding_bottom(1)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_3x3p1__avx_3x8);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3P1__AVX_3X8, output_height_gt_3) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_height = 4; input_height < 7; input_height++) {
+      for (size_t input_width = 1; input_width < 41; input_width += 7) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(3)
+          .kernel_width(3)
+          .subsampling(1)
+          .padding_left(1)
+          .padding_right(1)
+          .padding_top(1)
+          .padding_bottom(1)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_3x3p1__avx_3x8);
+      }
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F32_DWCONV2D_CHW_3X3P1__AVX_4X8, output_width_eq_8) {
+    TEST_REQUIRES_X86_AVX;
+    DWConv2DMicrokernelTester()
+      .input_width(8)
+      .input_height(4)
+      .kernel_height(3)
+      .kernel_width(3)
+      .subsampling(1)
+      .padding_left(1)
+      .padding_right(1)
+      .padding_top(1)
+      .padding_bottom(1)
+      .Test(xnn_f32_dwconv2d_chw_ukernel_3x3p1__avx_4x8);
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3P1__AVX_4X8, output_width_div_8) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_width = 16; input_width < 64; input_width += 8) {
+      DWConv2DMicrokernelTester()
+        .input_width(input_width)
+        .input_height(4)
+        .kernel_height(3)
+        .kernel_width(3)
+        .subsampling(1)
+        .padding_left(1)
+        .padding_right(1)
+        .padding_top(1)
+        .padding_bottom(1)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_3x3p1__avx_4x8);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3P1__AVX_4X8, output_width_lt_8) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_width = 1; input_width < 8; input_width++) {
+      DWConv2DMicrokernelTester()
+        .input_width(8)
+        .input_height(4)
+        .kernel_height(3)
+        .kernel_width(3)
+        .subsampling(1)
+        .padding_left(1)
+        .padding_right(1)
+        .padding_top(1)
+        .padding_bottom(1)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_3x3p1__avx_4x8);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3P1__AVX_4X8, output_width_gt_8) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_width = 9; input_width < 17; input_width++) {
+      DWConv2DMicrokernelTester()
+        .input_width(input_width)
+        .input_height(4)
+        .kernel_height(3)
+        .kernel_width(3)
+        .subsampling(1)
+        .padding_left(1)
+        .padding_right(1)
+        .padding_top(1)
+        .padding_bottom(1)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_3x3p1__avx_4x8);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3P1__AVX_4X8, output_height_div_4) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_height = 8; input_height < 32; input_height += 4) {
+      for (size_t input_width = 1; input_width < 41; input_width += 7) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(3)
+          .kernel_width(3)
+          .subsampling(1)
+          .padding_left(1)
+          .padding_right(1)
+          .padding_top(1)
+          .padding_bottom(1)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_3x3p1__avx_4x8);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3P1__AVX_4X8, output_height_lt_4) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_height = 1; input_height < 4; input_height++) {
+      for (size_t input_width = 1; input_width < 41; input_width += 7) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(3)
+          .kernel_width(3)
+          .subsampling(1)
+          .padding_left(1)
+          .padding_right(1)
+          .padding_top(1)
+          .padding_bottom(1)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_3x3p1__avx_4x8);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3P1__AVX_4X8, output_height_gt_4) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_height = 5; input_height < 9; input_height++) {
+      for (size_t input_width = 1; input_width < 41; input_width += 7) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(3)
+          .kernel_width(3)
+          .subsampling(1)
+          .padding_left(1)
+          .padding_right(1)
+          .padding_top(1)
+          .padding_bottom(1)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_3x3p1__avx_4x8);
+      }
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F32_DWCONV2D_CHW_3X3P1__AVX_5X8, output_width_eq_8) {
+    TEST_REQUIRES_X86_AVX;
+    DWConv2DMicrokernelTester()
+      .input_width(8)
+      .input_height(5)
+      .kernel_height(3)
+      .kernel_width(3)
+      .subsampling(1)
+      .padding_left(1)
+      .padding_right(1)
+      .padding_top(1)
+      .padding_bottom(1)
+      .Test(xnn_f32_dwconv2d_chw_ukernel_3x3p1__avx_5x8);
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3P1__AVX_5X8, output_width_div_8) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_width = 16; input_width < 64; input_width += 8) {
+      DWConv2DMicrokernelTester()
+        .input_width(input_width)
+        .input_height(5)
+        .kernel_height(3)
+        .kernel_width(3)
+        .subsampling(1)
+        .padding_left(1)
+        .padding_right(1)
+        .padding_top(1)
+        .padding_bottom(1)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_3x3p1__avx_5x8);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3P1__AVX_5X8, output_width_lt_8) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_width = 1; input_width < 8; input_width++) {
+      DWConv2DMicrokernelTester()
+        .input_width(8)
+        .input_height(5)
+        .kernel_height(3)
+        .kernel_width(3)
+        .subsampling(1)
+        .padding_left(1)
+        .padding_right(1)
+        .padding_top(1)
+        .padding_bottom(1)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_3x3p1__avx_5x8);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3P1__AVX_5X8, output_width_gt_8) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_width = 9; input_width < 17; input_width++) {
+      DWConv2DMicrokernelTester()
+        .input_width(input_width)
+        .input_height(5)
+        .kernel_height(3)
+        .kernel_width(3)
+        .subsampling(1)
+        .padding_left(1)
+        .padding_right(1)
+        .padding_top(1)
+        .padding_bottom(1)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_3x3p1__avx_5x8);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3P1__AVX_5X8, output_height_div_5) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_height = 10; input_height < 40; input_height += 5) {
+      for (size_t input_width = 1; input_width < 41; input_width += 7) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(3)
+          .kernel_width(3)
+          .subsampling(1)
+          .padding_left(1)
+          .padding_right(1)
+          .padding_top(1)
+          .padding_bottom(1)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_3x3p1__avx_5x8);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3P1__AVX_5X8, output_height_lt_5) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_height = 1; input_height < 5; input_height++) {
+      for (size_t input_width = 1; input_width < 41; input_width += 7) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(3)
+          .kernel_width(3)
+          .subsampling(1)
+          .padding_left(1)
+          .padding_right(1)
+          .padding_top(1)
+          .padding_bottom(1)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_3x3p1__avx_5x8);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3P1__AVX_5X8, output_height_gt_5) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_height = 6; input_height < 11; input_height++) {
+      for (size_t input_width = 1; input_width < 41; input_width += 7) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(3)
+          .kernel_width(3)
+          .subsampling(1)
+          .padding_left(1)
+          .padding_right(1)
+          .padding_top(1)
+          .padding_bottom(1)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_3x3p1__avx_5x8);
+      }
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F32_DWCONV2D_CHW_3X3P1__AVX_1X8_ACC2, output_width_eq_8) {
+    TEST_REQUIRES_X86_AVX;
+    DWConv2DMicrokernelTester()
+      .input_width(8)
+      .input_height(1)
+      .kernel_height(3)
+      .kernel_width(3)
+      .subsampling(1)
+      .padding_left(1)
+      .padding_right(1)
+      .padding_top(1)
+      .padding_bottom(1)
+      .Test(xnn_f32_dwconv2d_chw_ukernel_3x3p1__avx_1x8_acc2);
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3P1__AVX_1X8_ACC2, output_width_div_8) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_width = 16; input_width < 64; input_width += 8) {
+      DWConv2DMicrokernelTester()
+        .input_width(input_width)
+        .input_height(1)
+        .kernel_height(3)
+        .kernel_width(3)
+        .subsampling(1)
+        .padding_left(1)
+        .padding_right(1)
+        .padding_top(1)
+        .padding_bottom(1)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_3x3p1__avx_1x8_acc2);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3P1__AVX_1X8_ACC2, output_width_lt_8) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_width = 1; input_width < 8; input_width++) {
+      DWConv2DMicrokernelTester()
+        .input_width(8)
+        .input_height(1)
+        .kernel_height(3)
+        .kernel_width(3)
+        .subsampling(1)
+        .padding_left(1)
+        .padding_right(1)
+        .padding_top(1)
+        .padding_bottom(1)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_3x3p1__avx_1x8_acc2);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3P1__AVX_1X8_ACC2, output_width_gt_8) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_width = 9; input_width < 17; input_width++) {
+      DWConv2DMicrokernelTester()
+        .input_width(input_width)
+        .input_height(1)
+        .kernel_height(3)
+        .kernel_width(3)
+        .subsampling(1)
+        .padding_left(1)
+        .padding_right(1)
+        .padding_top(1)
+        .padding_bottom(1)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_3x3p1__avx_1x8_acc2);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3P1__AVX_1X8_ACC2, output_height_gt_1) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_height = 2; input_height < 3; input_height++) {
+      for (size_t input_width = 1; input_width < 41; input_width += 7) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(3)
+          .kernel_width(3)
+          .subsampling(1)
+          .padding_left(1)
+          .padding_right(1)
+          .padding_top(1)
+          .padding_bottom(1)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_3x3p1__avx_1x8_acc2);
+      }
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F32_DWCONV2D_CHW_3X3P1__AVX_1X8_ACC3, output_width_eq_8) {
+    TEST_REQUIRES_X86_AVX;
+    DWConv2DMicrokernelTester()
+      .input_width(8)
+      .input_height(1)
+      .kernel_height(3)
+      .kernel_width(3)
+      .subsampling(1)
+      .padding_left(1)
+      .padding_right(1)
+      .padding_top(1)
+      .padding_bottom(1)
+      .Test(xnn_f32_dwconv2d_chw_ukernel_3x3p1__avx_1x8_acc3);
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3P1__AVX_1X8_ACC3, output_width_div_8) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_width = 16; input_width < 64; input_width += 8) {
+      DWConv2DMicrokernelTester()
+        .input_width(input_width)
+        .input_height(1)
+        .kernel_height(3)
+        .kernel_width(3)
+        .subsampling(1)
+        .padding_left(1)
+        .padding_right(1)
+        .padding_top(1)
+        .padding_bottom(1)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_3x3p1__avx_1x8_acc3);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3P1__AVX_1X8_ACC3, output_width_lt_8) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_width = 1; input_width < 8; input_width++) {
+      DWConv2DMicrokernelTester()
+        .input_width(8)
+        .input_height(1)
+        .kernel_height(3)
+        .kernel_width(3)
+        .subsampling(1)
+        .padding_left(1)
+        .padding_right(1)
+        .padding_top(1)
+        .padding_bottom(1)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_3x3p1__avx_1x8_acc3);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3P1__AVX_1X8_ACC3, output_width_gt_8) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_width = 9; input_width < 17; input_width++) {
+      DWConv2DMicrokernelTester()
+        .input_width(input_width)
+        .input_height(1)
+        .kernel_height(3)
+        .kernel_width(3)
+        .subsampling(1)
+        .padding_left(1)
+        .padding_right(1)
+        .padding_top(1)
+        .padding_bottom(1)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_3x3p1__avx_1x8_acc3);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3P1__AVX_1X8_ACC3, output_height_gt_1) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_height = 2; input_height < 3; input_height++) {
+      for (size_t input_width = 1; input_width < 41; input_width += 7) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(3)
+          .kernel_width(3)
+          .subsampling(1)
+          .padding_left(1)
+          .padding_right(1)
+          .padding_top(1)
+          .padding_bottom(1)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_3x3p1__avx_1x8_acc3);
+      }
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F32_DWCONV2D_CHW_3X3P1__AVX_1X8_ACC4, output_width_eq_8) {
+    TEST_REQUIRES_X86_AVX;
+    DWConv2DMicrokernelTester()
+      .input_width(8)
+      .input_height(1)
+      .kernel_height(3)
+      .kernel_width(3)
+      .subsampling(1)
+      .padding_left(1)
+      .padding_right(1)
+      .padding_top(1)
+      .padding_bottom(1)
+      .Test(xnn_f32_dwconv2d_chw_ukernel_3x3p1__avx_1x8_acc4);
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3P1__AVX_1X8_ACC4, output_width_div_8) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_width = 16; input_width < 64; input_width += 8) {
+      DWConv2DMicrokernelTester()
+        .input_width(input_width)
+        .input_height(1)
+        .kernel_height(3)
+        .kernel_width(3)
+        .subsampling(1)
+        .padding_left(1)
+        .padding_right(1)
+        .padding_top(1)
+        .padding_bottom(1)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_3x3p1__avx_1x8_acc4);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3P1__AVX_1X8_ACC4, output_width_lt_8) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_width = 1; input_width < 8; input_width++) {
+      DWConv2DMicrokernelTester()
+        .input_width(8)
+        .input_height(1)
+        .kernel_height(3)
+        .kernel_width(3)
+        .subsampling(1)
+        .padding_left(1)
+        .padding_right(1)
+        .padding_top(1)
+        .padding_bottom(1)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_3x3p1__avx_1x8_acc4);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3P1__AVX_1X8_ACC4, output_width_gt_8) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_width = 9; input_width < 17; input_width++) {
+      DWConv2DMicrokernelTester()
+        .input_width(input_width)
+        .input_height(1)
+        .kernel_height(3)
+        .kernel_width(3)
+        .subsampling(1)
+        .padding_left(1)
+        .padding_right(1)
+        .padding_top(1)
+        .padding_bottom(1)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_3x3p1__avx_1x8_acc4);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3P1__AVX_1X8_ACC4, output_height_gt_1) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_height = 2; input_height < 3; input_height++) {
+      for (size_t input_width = 1; input_width < 41; input_width += 7) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(3)
+          .kernel_width(3)
+          .subsampling(1)
+          .padding_left(1)
+          .padding_right(1)
+          .padding_top(1)
+          .padding_bottom(1)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_3x3p1__avx_1x8_acc4);
+      }
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F32_DWCONV2D_CHW_3X3P1__AVX_2X8_ACC2, output_width_eq_8) {
+    TEST_REQUIRES_X86_AVX;
+    DWConv2DMicrokernelTester()
+      .input_width(8)
+      .input_height(2)
+      .kernel_height(3)
+      .kernel_width(3)
+      .subsampling(1)
+      .padding_left(1)
+      .padding_right(1)
+      .padding_top(1)
+      .padding_bottom(1)
+      .Test(xnn_f32_dwconv2d_chw_ukernel_3x3p1__avx_2x8_acc2);
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3P1__AVX_2X8_ACC2, output_width_div_8) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_width = 16; input_width < 64; input_width += 8) {
+      DWConv2DMicrokernelTester()
+        .input_width(input_width)
+        .input_height(2)
+        .kernel_height(3)
+        .kernel_width(3)
+        .subsampling(1)
+        .padding_left(1)
+        .padding_right(1)
+        .padding_top(1)
+        .padding_bottom(1)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_3x3p1__avx_2x8_acc2);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3P1__AVX_2X8_ACC2, output_width_lt_8) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_width = 1; input_width < 8; input_width++) {
+      DWConv2DMicrokernelTester()
+        .input_width(8)
+        .input_height(2)
+        .kernel_height(3)
+        .kernel_width(3)
+        .subsampling(1)
+        .padding_left(1)
+        .padding_right(1)
+        .padding_top(1)
+        .padding_bottom(1)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_3x3p1__avx_2x8_acc2);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3P1__AVX_2X8_ACC2, output_width_gt_8) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_width = 9; input_width < 17; input_width++) {
+      DWConv2DMicrokernelTester()
+        .input_width(input_width)
+        .input_height(2)
+        .kernel_height(3)
+        .kernel_width(3)
+        .subsampling(1)
+        .padding_left(1)
+        .padding_right(1)
+        .padding_top(1)
+        .padding_bottom(1)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_3x3p1__avx_2x8_acc2);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3P1__AVX_2X8_ACC2, output_height_div_2) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_height = 4; input_height < 16; input_height += 2) {
+      for (size_t input_width = 1; input_width < 41; input_width += 7) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(3)
+          .kernel_width(3)
+          .subsampling(1)
+          .padding_left(1)
+          .padding_right(1)
+          .padding_top(1)
+          .padding_bottom(1)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_3x3p1__avx_2x8_acc2);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3P1__AVX_2X8_ACC2, output_height_lt_2) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_height = 1; input_height < 2; input_height++) {
+      for (size_t input_width = 1; input_width < 41; input_width += 7) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(3)
+          .kernel_width(3)
+          .subsampling(1)
+          .padding_left(1)
+          .padding_right(1)
+          .padding_top(1)
+          .padding_bottom(1)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_3x3p1__avx_2x8_acc2);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3P1__AVX_2X8_ACC2, output_height_gt_2) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_height = 3; input_height < 5; input_height++) {
+      for (size_t input_width = 1; input_width < 41; input_width += 7) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(3)
+          .kernel_width(3)
+          .subsampling(1)
+          .padding_left(1)
+          .padding_right(1)
+          .padding_top(1)
+          .padding_bottom(1)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_3x3p1__avx_2x8_acc2);
+      }
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F32_DWCONV2D_CHW_3X3S2P1__AVX_1X8, output_width_eq_8) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_width = 15; input_width < 17; input_width++) {
+      DWConv2DMicrokernelTester()
+        .input_width(input_width)
+        .input_height(2)
+        .kernel_height(3)
+        .kernel_width(3)
+        .subsampling(2)
+        .padding_left(1)
+        .padding_right(1)
+        .padding_top(1)
+        .padding_bottom(1)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_3x3s2p1__avx_1x8);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3S2P1__AVX_1X8, output_width_div_8) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_width = 32; input_width < 128; input_width += 16) {
+      DWConv2DMicrokernelTester()
+        .input_width(input_width)
+        .input_height(2)
+        .kernel_height(3)
+        .kernel_width(3)
+        .subsampling(2)
+        .padding_left(1)
+        .padding_right(1)
+        .padding_top(1)
+        .padding_bottom(1)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_3x3s2p1__avx_1x8);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3S2P1__AVX_1X8, output_width_lt_8) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_width = 1; input_width < 15; input_width++) {
+      DWConv2DMicrokernelTester()
+        .input_width(16)
+        .input_height(2)
+        .kernel_height(3)
+        .kernel_width(3)
+        .subsampling(2)
+        .padding_left(1)
+        .padding_right(1)
+        .padding_top(1)
+        .padding_bottom(1)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_3x3s2p1__avx_1x8);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3S2P1__AVX_1X8, output_width_gt_8) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_width = 17; input_width < 33; input_width++) {
+      DWConv2DMicrokernelTester()
+        .input_width(input_width)
+        .input_height(2)
+        .kernel_height(3)
+        .kernel_width(3)
+        .subsampling(2)
+        .padding_left(1)
+        .padding_right(1)
+        .padding_top(1)
+        .padding_bottom(1)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_3x3s2p1__avx_1x8);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3S2P1__AVX_1X8, output_height_eq_1) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_height = 1; input_height < 3; input_height++) {
+      for (size_t input_width = 1; input_width < 81; input_width += 15) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(3)
+          .kernel_width(3)
+          .subsampling(2)
+          .padding_left(1)
+          .padding_right(1)
+          .padding_top(1)
+          .padding_bottom(1)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_3x3s2p1__avx_1x8);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3S2P1__AVX_1X8, output_height_gt_1) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_height = 3; input_height < 5; input_height++) {
+      for (size_t input_width = 1; input_width < 81; input_width += 15) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(3)
+          .kernel_width(3)
+          .subsampling(2)
+          .padding_left(1)
+          .padding_right(1)
+          .padding_top(1)
+          .padding_bottom(1)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_3x3s2p1__avx_1x8);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3S2P1__AVX_1X8, padding_top_eq_1) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_height = 2; input_height < 8; input_height++) {
+      for (size_t input_width = 1; input_width < 81; input_width += 15) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(3)
+          .kernel_width(3)
+          .subsampling(2)
+          .padding_left(1)
+          .padding_right(1)
+          .padding_top(0)
+          .padding_bottom(1)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_3x3s2p1__avx_1x8);
+      }
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F32_DWCONV2D_CHW_3X3S2P1__AVX_2X8, output_width_eq_8) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_width = 15; input_width < 17; input_width++) {
+      DWConv2DMicrokernelTester()
+        .input_width(input_width)
+        .input_height(4)
+        .kernel_height(3)
+        .kernel_width(3)
+        .subsampling(2)
+        .padding_left(1)
+        .padding_right(1)
+        .padding_top(1)
+        .padding_bottom(1)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_3x3s2p1__avx_2x8);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3S2P1__AVX_2X8, output_width_div_8) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_width = 32; input_width < 128; input_width += 16) {
+      DWConv2DMicrokernelTester()
+        .input_width(input_width)
+        .input_height(4)
+        .kernel_height(3)
+        .kernel_width(3)
+        .subsampling(2)
+        .padding_left(1)
+        .padding_right(1)
+        .padding_top(1)
+        .padding_bottom(1)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_3x3s2p1__avx_2x8);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3S2P1__AVX_2X8, output_width_lt_8) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_width = 1; input_width < 15; input_width++) {
+      DWConv2DMicrokernelTester()
+        .input_width(16)
+        .input_height(4)
+        .kernel_height(3)
+        .kernel_width(3)
+        .subsampling(2)
+        .padding_left(1)
+        .padding_right(1)
+        .padding_top(1)
+        .padding_bottom(1)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_3x3s2p1__avx_2x8);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3S2P1__AVX_2X8, output_width_gt_8) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_width = 17; input_width < 33; input_width++) {
+      DWConv2DMicrokernelTester()
+        .input_width(input_width)
+        .input_height(4)
+        .kernel_height(3)
+        .kernel_width(3)
+        .subsampling(2)
+        .padding_left(1)
+        .padding_right(1)
+        .padding_top(1)
+        .padding_bottom(1)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_3x3s2p1__avx_2x8);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3S2P1__AVX_2X8, output_height_eq_2) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_height = 3; input_height < 5; input_height++) {
+      for (size_t input_width = 1; input_width < 81; input_width += 15) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(3)
+          .kernel_width(3)
+          .subsampling(2)
+          .padding_left(1)
+          .padding_right(1)
+          .padding_top(1)
+          .padding_bottom(1)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_3x3s2p1__avx_2x8);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3S2P1__AVX_2X8, output_height_div_2) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_height = 8; input_height < 32; input_height += 4) {
+      for (size_t input_width = 1; input_width < 81; input_width += 15) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(3)
+          .kernel_width(3)
+          .subsampling(2)
+          .padding_left(1)
+          .padding_right(1)
+          .padding_top(1)
+          .padding_bottom(1)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_3x3s2p1__avx_2x8);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3S2P1__AVX_2X8, output_height_lt_2) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_height = 1; input_height < 3; input_height++) {
+      for (size_t input_width = 1; input_width < 81; input_width += 15) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(3)
+          .kernel_width(3)
+          .subsampling(2)
+          .padding_left(1)
+          .padding_right(1)
+          .padding_top(1)
+          .padding_bottom(1)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_3x3s2p1__avx_2x8);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3S2P1__AVX_2X8, output_height_gt_2) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_height = 5; input_height < 9; input_height++) {
+      for (size_t input_width = 1; input_width < 81; input_width += 15) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(3)
+          .kernel_width(3)
+          .subsampling(2)
+          .padding_left(1)
+          .padding_right(1)
+          .padding_top(1)
+          .padding_bottom(1)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_3x3s2p1__avx_2x8);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3S2P1__AVX_2X8, padding_top_eq_1) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_height = 2; input_height < 14; input_height++) {
+      for (size_t input_width = 1; input_width < 81; input_width += 15) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(3)
+          .kernel_width(3)
+          .subsampling(2)
+          .padding_left(1)
+          .padding_right(1)
+          .padding_top(0)
+          .padding_bottom(1)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_3x3s2p1__avx_2x8);
+      }
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F32_DWCONV2D_CHW_3X3S2P1__AVX_3X8, output_width_eq_8) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_width = 15; input_width < 17; input_width++) {
+      DWConv2DMicrokernelTester()
+        .input_width(input_width)
+        .input_height(6)
+        .kernel_height(3)
+        .kernel_width(3)
+        .subsampling(2)
+        .padding_left(1)
+        .padding_right(1)
+        .padding_top(1)
+        .padding_bottom(1)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_3x3s2p1__avx_3x8);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3S2P1__AVX_3X8, output_width_div_8) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_width = 32; input_width < 128; input_width += 16) {
+      DWConv2DMicrokernelTester()
+        .input_width(input_width)
+        .input_height(6)
+        .kernel_height(3)
+        .kernel_width(3)
+        .subsampling(2)
+        .padding_left(1)
+        .padding_right(1)
+        .padding_top(1)
+        .padding_bottom(1)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_3x3s2p1__avx_3x8);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3S2P1__AVX_3X8, output_width_lt_8) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_width = 1; input_width < 15; input_width++) {
+      DWConv2DMicrokernelTester()
+        .input_width(16)
+        .input_height(6)
+        .kernel_height(3)
+        .kernel_width(3)
+        .subsampling(2)
+        .padding_left(1)
+        .padding_right(1)
+        .padding_top(1)
+        .padding_bottom(1)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_3x3s2p1__avx_3x8);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3S2P1__AVX_3X8, output_width_gt_8) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_width = 17; input_width < 33; input_width++) {
+      DWConv2DMicrokernelTester()
+        .input_width(input_width)
+        .input_height(6)
+        .kernel_height(3)
+        .kernel_width(3)
+        .subsampling(2)
+        .padding_left(1)
+        .padding_right(1)
+        .padding_top(1)
+        .padding_bottom(1)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_3x3s2p1__avx_3x8);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3S2P1__AVX_3X8, output_height_eq_3) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_height = 5; input_height < 7; input_height++) {
+      for (size_t input_width = 1; input_width < 81; input_width += 15) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(3)
+          .kernel_width(3)
+          .subsampling(2)
+          .padding_left(1)
+          .padding_right(1)
+          .padding_top(1)
+          .padding_bottom(1)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_3x3s2p1__avx_3x8);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3S2P1__AVX_3X8, output_height_div_3) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_height = 12; input_height < 48; input_height += 6) {
+      for (size_t input_width = 1; input_width < 81; input_width += 15) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(3)
+          .kernel_width(3)
+          .subsampling(2)
+          .padding_left(1)
+          .padding_right(1)
+          .padding_top(1)
+          .padding_bottom(1)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_3x3s2p1__avx_3x8);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3S2P1__AVX_3X8, output_height_lt_3) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_height = 1; input_height < 5; input_height++) {
+      for (size_t input_width = 1; input_width < 81; input_width += 15) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(3)
+          .kernel_width(3)
+          .subsampling(2)
+          .padding_left(1)
+          .padding_right(1)
+          .padding_top(1)
+          .padding_bottom(1)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_3x3s2p1__avx_3x8);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3S2P1__AVX_3X8, output_height_gt_3) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_height = 7; input_height < 13; input_height++) {
+      for (size_t input_width = 1; input_width < 81; input_width += 15) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(3)
+          .kernel_width(3)
+          .subsampling(2)
+          .padding_left(1)
+          .padding_right(1)
+          .padding_top(1)
+          .padding_bottom(1)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_3x3s2p1__avx_3x8);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3S2P1__AVX_3X8, padding_top_eq_1) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_height = 2; input_height < 20; input_height++) {
+      for (size_t input_width = 1; input_width < 81; input_width += 15) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(3)
+          .kernel_width(3)
+          .subsampling(2)
+          .padding_left(1)
+          .padding_right(1)
+          .padding_top(0)
+          .padding_bottom(1)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_3x3s2p1__avx_3x8);
+      }
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F32_DWCONV2D_CHW_3X3S2P1__AVX_4X8, output_width_eq_8) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_width = 15; input_width < 17; input_width++) {
+      DWConv2DMicrokernelTester()
+        .input_width(input_width)
+        .input_height(8)
+        .kernel_height(3)
+        .kernel_width(3)
+        .subsampling(2)
+        .padding_left(1)
+        .padding_right(1)
+        .padding_top(1)
+        .padding_bottom(1)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_3x3s2p1__avx_4x8);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3S2P1__AVX_4X8, output_width_div_8) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_width = 32; input_width < 128; input_width += 16) {
+      DWConv2DMicrokernelTester()
+        .input_width(input_width)
+        .input_height(8)
+        .kernel_height(3)
+        .kernel_width(3)
+        .subsampling(2)
+        .padding_left(1)
+        .padding_right(1)
+        .padding_top(1)
+        .padding_bottom(1)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_3x3s2p1__avx_4x8);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3S2P1__AVX_4X8, output_width_lt_8) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_width = 1; input_width < 15; input_width++) {
+      DWConv2DMicrokernelTester()
+        .input_width(16)
+        .input_height(8)
+        .kernel_height(3)
+        .kernel_width(3)
+        .subsampling(2)
+        .padding_left(1)
+        .padding_right(1)
+        .padding_top(1)
+        .padding_bottom(1)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_3x3s2p1__avx_4x8);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3S2P1__AVX_4X8, output_width_gt_8) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_width = 17; input_width < 33; input_width++) {
+      DWConv2DMicrokernelTester()
+        .input_width(input_width)
+        .input_height(8)
+        .kernel_height(3)
+        .kernel_width(3)
+        .subsampling(2)
+        .padding_left(1)
+        .padding_right(1)
+        .padding_top(1)
+        .padding_bottom(1)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_3x3s2p1__avx_4x8);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3S2P1__AVX_4X8, output_height_eq_4) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_height = 7; input_height < 9; input_height++) {
+      for (size_t input_width = 1; input_width < 81; input_width += 15) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(3)
+          .kernel_width(3)
+          .subsampling(2)
+          .padding_left(1)
+          .padding_right(1)
+          .padding_top(1)
+          .padding_bottom(1)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_3x3s2p1__avx_4x8);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3S2P1__AVX_4X8, output_height_div_4) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_height = 16; input_height < 64; input_height += 8) {
+      for (size_t input_width = 1; input_width < 81; input_width += 15) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(3)
+          .kernel_width(3)
+          .subsampling(2)
+          .padding_left(1)
+          .padding_right(1)
+          .padding_top(1)
+          .padding_bottom(1)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_3x3s2p1__avx_4x8);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3S2P1__AVX_4X8, output_height_lt_4) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_height = 1; input_height < 7; input_height++) {
+      for (size_t input_width = 1; input_width < 81; input_width += 15) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(3)
+          .kernel_width(3)
+          .subsampling(2)
+          .padding_left(1)
+          .padding_right(1)
+          .padding_top(1)
+          .padding_bottom(1)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_3x3s2p1__avx_4x8);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3S2P1__AVX_4X8, output_height_gt_4) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_height = 9; input_height < 17; input_height++) {
+      for (size_t input_width = 1; input_width < 81; input_width += 15) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(3)
+          .kernel_width(3)
+          .subsampling(2)
+          .padding_left(1)
+          .padding_right(1)
+          .padding_top(1)
+          .padding_bottom(1)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_3x3s2p1__avx_4x8);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3S2P1__AVX_4X8, padding_top_eq_1) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_height = 2; input_height < 26; input_height++) {
+      for (size_t input_width = 1; input_width < 81; input_width += 15) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(3)
+          .kernel_width(3)
+          .subsampling(2)
+          .padding_left(1)
+          .padding_right(1)
+          .padding_top(0)
+          .padding_bottom(1)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_3x3s2p1__avx_4x8);
+      }
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F32_DWCONV2D_CHW_3X3S2P1__AVX_1X8_ACC2, output_width_eq_8) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_width = 15; input_width < 17; input_width++) {
+      DWConv2DMicrokernelTester()
+        .input_width(input_width)
+        .input_height(2)
+        .kernel_height(3)
+        .kernel_width(3)
+        .subsampling(2)
+        .padding_left(1)
+        .padding_right(1)
+        .padding_top(1)
+        .padding_bottom(1)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_3x3s2p1__avx_1x8_acc2);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3S2P1__AVX_1X8_ACC2, output_width_div_8) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_width = 32; input_width < 128; input_width += 16) {
+      DWConv2DMicrokernelTester()
+        .input_width(input_width)
+        .input_height(2)
+        .kernel_height(3)
+        .kernel_width(3)
+        .subsampling(2)
+        .padding_left(1)
+        .padding_right(1)
+        .padding_top(1)
+        .padding_bottom(1)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_3x3s2p1__avx_1x8_acc2);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3S2P1__AVX_1X8_ACC2, output_width_lt_8) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_width = 1; input_width < 15; input_width++) {
+      DWConv2DMicrokernelTester()
+        .input_width(16)
+        .input_height(2)
+        .kernel_height(3)
+        .kernel_width(3)
+        .subsampling(2)
+        .padding_left(1)
+        .padding_right(1)
+        .padding_top(1)
+        .padding_bottom(1)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_3x3s2p1__avx_1x8_acc2);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3S2P1__AVX_1X8_ACC2, output_width_gt_8) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_width = 17; input_width < 33; input_width++) {
+      DWConv2DMicrokernelTester()
+        .input_width(input_width)
+        .input_height(2)
+        .kernel_height(3)
+        .kernel_width(3)
+        .subsampling(2)
+        .padding_left(1)
+        .padding_right(1)
+        .padding_top(1)
+        .padding_bottom(1)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_3x3s2p1__avx_1x8_acc2);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3S2P1__AVX_1X8_ACC2, output_height_eq_1) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_height = 1; input_height < 3; input_height++) {
+      for (size_t input_width = 1; input_width < 81; input_width += 15) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(3)
+          .kernel_width(3)
+          .subsampling(2)
+          .padding_left(1)
+          .padding_right(1)
+          .padding_top(1)
+          .padding_bottom(1)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_3x3s2p1__avx_1x8_acc2);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3S2P1__AVX_1X8_ACC2, output_height_gt_1) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_height = 3; input_height < 5; input_height++) {
+      for (size_t input_width = 1; input_width < 81; input_width += 15) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(3)
+          .kernel_width(3)
+          .subsampling(2)
+          .padding_left(1)
+          .padding_right(1)
+          .padding_top(1)
+          .padding_bottom(1)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_3x3s2p1__avx_1x8_acc2);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3S2P1__AVX_1X8_ACC2, padding_top_eq_1) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_height = 2; input_height < 8; input_height++) {
+      for (size_t input_width = 1; input_width < 81; input_width += 15) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(3)
+          .kernel_width(3)
+          .subsampling(2)
+          .padding_left(1)
+          .padding_right(1)
+          .padding_top(0)
+          .padding_bottom(1)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_3x3s2p1__avx_1x8_acc2);
+      }
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F32_DWCONV2D_CHW_3X3S2P1__AVX_1X8_ACC3, output_width_eq_8) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_width = 15; input_width < 17; input_width++) {
+      DWConv2DMicrokernelTester()
+        .input_width(input_width)
+        .input_height(2)
+        .kernel_height(3)
+        .kernel_width(3)
+        .subsampling(2)
+        .padding_left(1)
+        .padding_right(1)
+        .padding_top(1)
+        .padding_bottom(1)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_3x3s2p1__avx_1x8_acc3);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3S2P1__AVX_1X8_ACC3, output_width_div_8) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_width = 32; input_width < 128; input_width += 16) {
+      DWConv2DMicrokernelTester()
+        .input_width(input_width)
+        .input_height(2)
+        .kernel_height(3)
+        .kernel_width(3)
+        .subsampling(2)
+        .padding_left(1)
+        .padding_right(1)
+        .padding_top(1)
+        .padding_bottom(1)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_3x3s2p1__avx_1x8_acc3);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3S2P1__AVX_1X8_ACC3, output_width_lt_8) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_width = 1; input_width < 15; input_width++) {
+      DWConv2DMicrokernelTester()
+        .input_width(16)
+        .input_height(2)
+        .kernel_height(3)
+        .kernel_width(3)
+        .subsampling(2)
+        .padding_left(1)
+        .padding_right(1)
+        .padding_top(1)
+        .padding_bottom(1)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_3x3s2p1__avx_1x8_acc3);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3S2P1__AVX_1X8_ACC3, output_width_gt_8) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_width = 17; input_width < 33; input_width++) {
+      DWConv2DMicrokernelTester()
+        .input_width(input_width)
+        .input_height(2)
+        .kernel_height(3)
+        .kernel_width(3)
+        .subsampling(2)
+        .padding_left(1)
+        .padding_right(1)
+        .padding_top(1)
+        .padding_bottom(1)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_3x3s2p1__avx_1x8_acc3);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3S2P1__AVX_1X8_ACC3, output_height_eq_1) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_height = 1; input_height < 3; input_height++) {
+      for (size_t input_width = 1; input_width < 81; input_width += 15) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(3)
+          .kernel_width(3)
+          .subsampling(2)
+          .padding_left(1)
+          .padding_right(1)
+          .padding_top(1)
+          .padding_bottom(1)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_3x3s2p1__avx_1x8_acc3);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3S2P1__AVX_1X8_ACC3, output_height_gt_1) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_height = 3; input_height < 5; input_height++) {
+      for (size_t input_width = 1; input_width < 81; input_width += 15) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(3)
+          .kernel_width(3)
+          .subsampling(2)
+          .padding_left(1)
+          .padding_right(1)
+          .padding_top(1)
+          .padding_bottom(1)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_3x3s2p1__avx_1x8_acc3);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3S2P1__AVX_1X8_ACC3, padding_top_eq_1) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_height = 2; input_height < 8; input_height++) {
+      for (size_t input_width = 1; input_width < 81; input_width += 15) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(3)
+          .kernel_width(3)
+          .subsampling(2)
+          .padding_left(1)
+          .padding_right(1)
+          .padding_top(0)
+          .padding_bottom(1)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_3x3s2p1__avx_1x8_acc3);
+      }
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F32_DWCONV2D_CHW_3X3S2P1__AVX_1X8_ACC4, output_width_eq_8) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_width = 15; input_width < 17; input_width++) {
+      DWConv2DMicrokernelTester()
+        .input_width(input_width)
+        .input_height(2)
+        .kernel_height(3)
+        .kernel_width(3)
+        .subsampling(2)
+        .padding_left(1)
+        .padding_right(1)
+        .padding_top(1)
+        .padding_bottom(1)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_3x3s2p1__avx_1x8_acc4);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3S2P1__AVX_1X8_ACC4, output_width_div_8) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_width = 32; input_width < 128; input_width += 16) {
+      DWConv2DMicrokernelTester()
+        .input_width(input_width)
+        .input_height(2)
+        .kernel_height(3)
+        .kernel_width(3)
+        .subsampling(2)
+        .padding_left(1)
+        .padding_right(1)
+        .padding_top(1)
+        .padding_bottom(1)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_3x3s2p1__avx_1x8_acc4);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3S2P1__AVX_1X8_ACC4, output_width_lt_8) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_width = 1; input_width < 15; input_width++) {
+      DWConv2DMicrokernelTester()
+        .input_width(16)
+        .input_height(2)
+        .kernel_height(3)
+        .kernel_width(3)
+        .subsampling(2)
+        .padding_left(1)
+        .padding_right(1)
+        .padding_top(1)
+        .padding_bottom(1)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_3x3s2p1__avx_1x8_acc4);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3S2P1__AVX_1X8_ACC4, output_width_gt_8) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_width = 17; input_width < 33; input_width++) {
+      DWConv2DMicrokernelTester()
+        .input_width(input_width)
+        .input_height(2)
+        .kernel_height(3)
+        .kernel_width(3)
+        .subsampling(2)
+        .padding_left(1)
+        .padding_right(1)
+        .padding_top(1)
+        .padding_bottom(1)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_3x3s2p1__avx_1x8_acc4);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3S2P1__AVX_1X8_ACC4, output_height_eq_1) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_height = 1; input_height < 3; input_height++) {
+      for (size_t input_width = 1; input_width < 81; input_width += 15) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(3)
+          .kernel_width(3)
+          .subsampling(2)
+          .padding_left(1)
+          .padding_right(1)
+          .padding_top(1)
+          .padding_bottom(1)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_3x3s2p1__avx_1x8_acc4);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3S2P1__AVX_1X8_ACC4, output_height_gt_1) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_height = 3; input_height < 5; input_height++) {
+      for (size_t input_width = 1; input_width < 81; input_width += 15) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(3)
+          .kernel_width(3)
+          .subsampling(2)
+          .padding_left(1)
+          .padding_right(1)
+          .padding_top(1)
+          .padding_bottom(1)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_3x3s2p1__avx_1x8_acc4);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3S2P1__AVX_1X8_ACC4, padding_top_eq_1) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_height = 2; input_height < 8; input_height++) {
+      for (size_t input_width = 1; input_width < 81; input_width += 15) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(3)
+          .kernel_width(3)
+          .subsampling(2)
+          .padding_left(1)
+          .padding_right(1)
+          .padding_top(0)
+          .padding_bottom(1)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_3x3s2p1__avx_1x8_acc4);
+      }
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F32_DWCONV2D_CHW_3X3S2P1__AVX_2X8_ACC2, output_width_eq_8) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_width = 15; input_width < 17; input_width++) {
+      DWConv2DMicrokernelTester()
+        .input_width(input_width)
+        .input_height(4)
+        .kernel_height(3)
+        .kernel_width(3)
+        .subsampling(2)
+        .padding_left(1)
+        .padding_right(1)
+        .padding_top(1)
+        .padding_bottom(1)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_3x3s2p1__avx_2x8_acc2);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3S2P1__AVX_2X8_ACC2, output_width_div_8) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_width = 32; input_width < 128; input_width += 16) {
+      DWConv2DMicrokernelTester()
+        .input_width(input_width)
+        .input_height(4)
+        .kernel_height(3)
+        .kernel_width(3)
+        .subsampling(2)
+        .padding_left(1)
+        .padding_right(1)
+        .padding_top(1)
+        .padding_bottom(1)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_3x3s2p1__avx_2x8_acc2);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3S2P1__AVX_2X8_ACC2, output_width_lt_8) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_width = 1; input_width < 15; input_width++) {
+      DWConv2DMicrokernelTester()
+        .input_width(16)
+        .input_height(4)
+        .kernel_height(3)
+        .kernel_width(3)
+        .subsampling(2)
+        .padding_left(1)
+        .padding_right(1)
+        .padding_top(1)
+        .padding_bottom(1)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_3x3s2p1__avx_2x8_acc2);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3S2P1__AVX_2X8_ACC2, output_width_gt_8) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_width = 17; input_width < 33; input_width++) {
+      DWConv2DMicrokernelTester()
+        .input_width(input_width)
+        .input_height(4)
+        .kernel_height(3)
+        .kernel_width(3)
+        .subsampling(2)
+        .padding_left(1)
+        .padding_right(1)
+        .padding_top(1)
+        .padding_bottom(1)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_3x3s2p1__avx_2x8_acc2);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3S2P1__AVX_2X8_ACC2, output_height_eq_2) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_height = 3; input_height < 5; input_height++) {
+      for (size_t input_width = 1; input_width < 81; input_width += 15) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(3)
+          .kernel_width(3)
+          .subsampling(2)
+          .padding_left(1)
+          .padding_right(1)
+          .padding_top(1)
+          .padding_bottom(1)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_3x3s2p1__avx_2x8_acc2);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3S2P1__AVX_2X8_ACC2, output_height_div_2) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_height = 8; input_height < 32; input_height += 4) {
+      for (size_t input_width = 1; input_width < 81; input_width += 15) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(3)
+          .kernel_width(3)
+          .subsampling(2)
+          .padding_left(1)
+          .padding_right(1)
+          .padding_top(1)
+          .padding_bottom(1)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_3x3s2p1__avx_2x8_acc2);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3S2P1__AVX_2X8_ACC2, output_height_lt_2) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_height = 1; input_height < 3; input_height++) {
+      for (size_t input_width = 1; input_width < 81; input_width += 15) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(3)
+          .kernel_width(3)
+          .subsampling(2)
+          .padding_left(1)
+          .padding_right(1)
+          .padding_top(1)
+          .padding_bottom(1)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_3x3s2p1__avx_2x8_acc2);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3S2P1__AVX_2X8_ACC2, output_height_gt_2) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_height = 5; input_height < 9; input_height++) {
+      for (size_t input_width = 1; input_width < 81; input_width += 15) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(3)
+          .kernel_width(3)
+          .subsampling(2)
+          .padding_left(1)
+          .padding_right(1)
+          .padding_top(1)
+          .padding_bottom(1)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_3x3s2p1__avx_2x8_acc2);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3S2P1__AVX_2X8_ACC2, padding_top_eq_1) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_height = 2; input_height < 14; input_height++) {
+      for (size_t input_width = 1; input_width < 81; input_width += 15) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(3)
+          .kernel_width(3)
+          .subsampling(2)
+          .padding_left(1)
+          .padding_right(1)
+          .padding_top(0)
+          .padding_bottom(1)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_3x3s2p1__avx_2x8_acc2);
+      }
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F32_DWCONV2D_CHW_5X5P2__AVX_1X8, output_width_eq_8) {
+    TEST_REQUIRES_X86_AVX;
+    DWConv2DMicrokernelTester()
+      .input_width(8)
+      .input_height(1)
+      .kernel_height(5)
+      .kernel_width(5)
+      .subsampling(1)
+      .padding_left(2)
+      .padding_right(2)
+      .padding_top(2)
+      .padding_bottom(2)
+      .Test(xnn_f32_dwconv2d_chw_ukernel_5x5p2__avx_1x8);
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5P2__AVX_1X8, output_width_div_8) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_width = 16; input_width < 64; input_width += 8) {
+      DWConv2DMicrokernelTester()
+        .input_width(input_width)
+        .input_height(1)
+        .kernel_height(5)
+        .kernel_width(5)
+        .subsampling(1)
+        .padding_left(2)
+        .padding_right(2)
+        .padding_top(2)
+        .padding_bottom(2)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_5x5p2__avx_1x8);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5P2__AVX_1X8, output_width_lt_8) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_width = 1; input_width < 8; input_width++) {
+      DWConv2DMicrokernelTester()
+        .input_width(8)
+        .input_height(1)
+        .kernel_height(5)
+        .kernel_width(5)
+        .subsampling(1)
+        .padding_left(2)
+        .padding_right(2)
+        .padding_top(2)
+        .padding_bottom(2)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_5x5p2__avx_1x8);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5P2__AVX_1X8, output_width_gt_8) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_width = 9; input_width < 17; input_width++) {
+      DWConv2DMicrokernelTester()
+        .input_width(input_width)
+        .input_height(1)
+        .kernel_height(5)
+        .kernel_width(5)
+        .subsampling(1)
+        .padding_left(2)
+        .padding_right(2)
+        .padding_top(2)
+        .padding_bottom(2)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_5x5p2__avx_1x8);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5P2__AVX_1X8, output_height_gt_1) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_height = 2; input_height < 3; input_height++) {
+      for (size_t input_width = 1; input_width < 41; input_width += 7) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(5)
+          .kernel_width(5)
+          .subsampling(1)
+          .padding_left(2)
+          .padding_right(2)
+          .padding_top(2)
+          .padding_bottom(2)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_5x5p2__avx_1x8);
+      }
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F32_DWCONV2D_CHW_5X5P2__AVX_2X8, output_width_eq_8) {
+    TEST_REQUIRES_X86_AVX;
+    DWConv2DMicrokernelTester()
+      .input_width(8)
+      .input_height(2)
+      .kernel_height(5)
+      .kernel_width(5)
+      .subsampling(1)
+      .padding_left(2)
+      .padding_right(2)
+      .padding_top(2)
+      .padding_bottom(2)
+      .Test(xnn_f32_dwconv2d_chw_ukernel_5x5p2__avx_2x8);
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5P2__AVX_2X8, output_width_div_8) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_width = 16; input_width < 64; input_width += 8) {
+      DWConv2DMicrokernelTester()
+        .input_width(input_width)
+        .input_height(2)
+        .kernel_height(5)
+        .kernel_width(5)
+        .subsampling(1)
+        .padding_left(2)
+        .padding_right(2)
+        .padding_top(2)
+        .padding_bottom(2)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_5x5p2__avx_2x8);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5P2__AVX_2X8, output_width_lt_8) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_width = 1; input_width < 8; input_width++) {
+      DWConv2DMicrokernelTester()
+        .input_width(8)
+        .input_height(2)
+        .kernel_height(5)
+        .kernel_width(5)
+        .subsampling(1)
+        .padding_left(2)
+        .padding_right(2)
+        .padding_top(2)
+        .padding_bottom(2)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_5x5p2__avx_2x8);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5P2__AVX_2X8, output_width_gt_8) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_width = 9; input_width < 17; input_width++) {
+      DWConv2DMicrokernelTester()
+        .input_width(input_width)
+        .input_height(2)
+        .kernel_height(5)
+        .kernel_width(5)
+        .subsampling(1)
+        .padding_left(2)
+        .padding_right(2)
+        .padding_top(2)
+        .padding_bottom(2)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_5x5p2__avx_2x8);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5P2__AVX_2X8, output_height_div_2) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_height = 4; input_height < 16; input_height += 2) {
+      for (size_t input_width = 1; input_width < 41; input_width += 7) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(5)
+          .kernel_width(5)
+          .subsampling(1)
+          .padding_left(2)
+          .padding_right(2)
+          .padding_top(2)
+          .padding_bottom(2)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_5x5p2__avx_2x8);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5P2__AVX_2X8, output_height_lt_2) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_height = 1; input_height < 2; input_height++) {
+      for (size_t input_width = 1; input_width < 41; input_width += 7) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(5)
+          .kernel_width(5)
+          .subsampling(1)
+          .padding_left(2)
+          .padding_right(2)
+          .padding_top(2)
+          .padding_bottom(2)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_5x5p2__avx_2x8);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5P2__AVX_2X8, output_height_gt_2) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_height = 3; input_height < 5; input_height++) {
+      for (size_t input_width = 1; input_width < 41; input_width += 7) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(5)
+          .kernel_width(5)
+          .subsampling(1)
+          .padding_left(2)
+          .padding_right(2)
+          .padding_top(2)
+          .padding_bottom(2)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_5x5p2__avx_2x8);
+      }
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F32_DWCONV2D_CHW_5X5P2__AVX_3X8, output_width_eq_8) {
+    TEST_REQUIRES_X86_AVX;
+    DWConv2DMicrokernelTester()
+      .input_width(8)
+      .input_height(3)
+      .kernel_height(5)
+      .kernel_width(5)
+      .subsampling(1)
+      .padding_left(2)
+      .padding_right(2)
+      .padding_top(2)
+      .padding_bottom(2)
+      .Test(xnn_f32_dwconv2d_chw_ukernel_5x5p2__avx_3x8);
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5P2__AVX_3X8, output_width_div_8) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_width = 16; input_width < 64; input_width += 8) {
+      DWConv2DMicrokernelTester()
+        .input_width(input_width)
+        .input_height(3)
+        .kernel_height(5)
+        .kernel_width(5)
+        .subsampling(1)
+        .padding_left(2)
+        .padding_right(2)
+        .padding_top(2)
+        .padding_bottom(2)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_5x5p2__avx_3x8);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5P2__AVX_3X8, output_width_lt_8) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_width = 1; input_width < 8; input_width++) {
+      DWConv2DMicrokernelTester()
+        .input_width(8)
+        .input_height(3)
+        .kernel_height(5)
+        .kernel_width(5)
+        .subsampling(1)
+        .padding_left(2)
+        .padding_right(2)
+        .padding_top(2)
+        .padding_bottom(2)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_5x5p2__avx_3x8);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5P2__AVX_3X8, output_width_gt_8) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_width = 9; input_width < 17; input_width++) {
+      DWConv2DMicrokernelTester()
+        .input_width(input_width)
+        .input_height(3)
+        .kernel_height(5)
+        .kernel_width(5)
+        .subsampling(1)
+        .padding_left(2)
+        .padding_right(2)
+        .padding_top(2)
+        .padding_bottom(2)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_5x5p2__avx_3x8);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5P2__AVX_3X8, output_height_div_3) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_height = 6; input_height < 24; input_height += 3) {
+      for (size_t input_width = 1; input_width < 41; input_width += 7) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(5)
+          .kernel_width(5)
+          .subsampling(1)
+          .padding_left(2)
+          .padding_right(2)
+          .padding_top(2)
+          .padding_bottom(2)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_5x5p2__avx_3x8);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5P2__AVX_3X8, output_height_lt_3) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_height = 1; input_height < 3; input_height++) {
+      for (size_t input_width = 1; input_width < 41; input_width += 7) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(5)
+          .kernel_width(5)
+          .subsampling(1)
+          .padding_left(2)
+          .padding_right(2)
+          .padding_top(2)
+          .padding_bottom(2)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_5x5p2__avx_3x8);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5P2__AVX_3X8, output_height_gt_3) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_height = 4; input_height < 7; input_height++) {
+      for (size_t input_width = 1; input_width < 41; input_width += 7) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(5)
+          .kernel_width(5)
+          .subsampling(1)
+          .padding_left(2)
+          .padding_right(2)
+          .padding_top(2)
+          .padding_bottom(2)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_5x5p2__avx_3x8);
+      }
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F32_DWCONV2D_CHW_5X5P2__AVX_1X8_ACC2, output_width_eq_8) {
+    TEST_REQUIRES_X86_AVX;
+    DWConv2DMicrokernelTester()
+      .input_width(8)
+      .input_height(1)
+      .kernel_height(5)
+      .kernel_width(5)
+      .subsampling(1)
+      .padding_left(2)
+      .padding_right(2)
+      .padding_top(2)
+      .padding_bottom(2)
+      .Test(xnn_f32_dwconv2d_chw_ukernel_5x5p2__avx_1x8_acc2);
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5P2__AVX_1X8_ACC2, output_width_div_8) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_width = 16; input_width < 64; input_width += 8) {
+      DWConv2DMicrokernelTester()
+        .input_width(input_width)
+        .input_height(1)
+        .kernel_height(5)
+        .kernel_width(5)
+        .subsampling(1)
+        .padding_left(2)
+        .padding_right(2)
+        .padding_top(2)
+        .padding_bottom(2)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_5x5p2__avx_1x8_acc2);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5P2__AVX_1X8_ACC2, output_width_lt_8) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_width = 1; input_width < 8; input_width++) {
+      DWConv2DMicrokernelTester()
+        .input_width(8)
+        .input_height(1)
+        .kernel_height(5)
+        .kernel_width(5)
+        .subsampling(1)
+        .padding_left(2)
+        .padding_right(2)
+        .padding_top(2)
+        .padding_bottom(2)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_5x5p2__avx_1x8_acc2);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5P2__AVX_1X8_ACC2, output_width_gt_8) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_width = 9; input_width < 17; input_width++) {
+      DWConv2DMicrokernelTester()
+        .input_width(input_width)
+        .input_height(1)
+        .kernel_height(5)
+        .kernel_width(5)
+        .subsampling(1)
+        .padding_left(2)
+        .padding_right(2)
+        .padding_top(2)
+        .padding_bottom(2)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_5x5p2__avx_1x8_acc2);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5P2__AVX_1X8_ACC2, output_height_gt_1) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_height = 2; input_height < 3; input_height++) {
+      for (size_t input_width = 1; input_width < 41; input_width += 7) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(5)
+          .kernel_width(5)
+          .subsampling(1)
+          .padding_left(2)
+          .padding_right(2)
+          .padding_top(2)
+          .padding_bottom(2)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_5x5p2__avx_1x8_acc2);
+      }
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F32_DWCONV2D_CHW_5X5P2__AVX_1X8_ACC3, output_width_eq_8) {
+    TEST_REQUIRES_X86_AVX;
+    DWConv2DMicrokernelTester()
+      .input_width(8)
+      .input_height(1)
+      .kernel_height(5)
+      .kernel_width(5)
+      .subsampling(1)
+      .padding_left(2)
+      .padding_right(2)
+      .padding_top(2)
+      .padding_bottom(2)
+      .Test(xnn_f32_dwconv2d_chw_ukernel_5x5p2__avx_1x8_acc3);
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5P2__AVX_1X8_ACC3, output_width_div_8) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_width = 16; input_width < 64; input_width += 8) {
+      DWConv2DMicrokernelTester()
+        .input_width(input_width)
+        .input_height(1)
+        .kernel_height(5)
+        .kernel_width(5)
+        .subsampling(1)
+        .padding_left(2)
+        .padding_right(2)
+        .padding_top(2)
+        .padding_bottom(2)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_5x5p2__avx_1x8_acc3);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5P2__AVX_1X8_ACC3, output_width_lt_8) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_width = 1; input_width < 8; input_width++) {
+      DWConv2DMicrokernelTester()
+        .input_width(8)
+        .input_height(1)
+        .kernel_height(5)
+        .kernel_width(5)
+        .subsampling(1)
+        .padding_left(2)
+        .padding_right(2)
+        .padding_top(2)
+        .padding_bottom(2)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_5x5p2__avx_1x8_acc3);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5P2__AVX_1X8_ACC3, output_width_gt_8) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_width = 9; input_width < 17; input_width++) {
+      DWConv2DMicrokernelTester()
+        .input_width(input_width)
+        .input_height(1)
+        .kernel_height(5)
+        .kernel_width(5)
+        .subsampling(1)
+        .padding_left(2)
+        .padding_right(2)
+        .padding_top(2)
+        .padding_bottom(2)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_5x5p2__avx_1x8_acc3);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5P2__AVX_1X8_ACC3, output_height_gt_1) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_height = 2; input_height < 3; input_height++) {
+      for (size_t input_width = 1; input_width < 41; input_width += 7) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(5)
+          .kernel_width(5)
+          .subsampling(1)
+          .padding_left(2)
+          .padding_right(2)
+          .padding_top(2)
+          .padding_bottom(2)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_5x5p2__avx_1x8_acc3);
+      }
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F32_DWCONV2D_CHW_5X5P2__AVX_1X8_ACC4, output_width_eq_8) {
+    TEST_REQUIRES_X86_AVX;
+    DWConv2DMicrokernelTester()
+      .input_width(8)
+      .input_height(1)
+      .kernel_height(5)
+      .kernel_width(5)
+      .subsampling(1)
+      .padding_left(2)
+      .padding_right(2)
+      .padding_top(2)
+      .padding_bottom(2)
+      .Test(xnn_f32_dwconv2d_chw_ukernel_5x5p2__avx_1x8_acc4);
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5P2__AVX_1X8_ACC4, output_width_div_8) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_width = 16; input_width < 64; input_width += 8) {
+      DWConv2DMicrokernelTester()
+        .input_width(input_width)
+        .input_height(1)
+        .kernel_height(5)
+        .kernel_width(5)
+        .subsampling(1)
+        .padding_left(2)
+        .padding_right(2)
+        .padding_top(2)
+        .padding_bottom(2)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_5x5p2__avx_1x8_acc4);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5P2__AVX_1X8_ACC4, output_width_lt_8) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_width = 1; input_width < 8; input_width++) {
+      DWConv2DMicrokernelTester()
+        .input_width(8)
+        .input_height(1)
+        .kernel_height(5)
+        .kernel_width(5)
+        .subsampling(1)
+        .padding_left(2)
+        .padding_right(2)
+        .padding_top(2)
+        .padding_bottom(2)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_5x5p2__avx_1x8_acc4);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5P2__AVX_1X8_ACC4, output_width_gt_8) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_width = 9; input_width < 17; input_width++) {
+      DWConv2DMicrokernelTester()
+        .input_width(input_width)
+        .input_height(1)
+        .kernel_height(5)
+        .kernel_width(5)
+        .subsampling(1)
+        .padding_left(2)
+        .padding_right(2)
+        .padding_top(2)
+        .padding_bottom(2)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_5x5p2__avx_1x8_acc4);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5P2__AVX_1X8_ACC4, output_height_gt_1) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_height = 2; input_height < 3; input_height++) {
+      for (size_t input_width = 1; input_width < 41; input_width += 7) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(5)
+          .kernel_width(5)
+          .subsampling(1)
+          .padding_left(2)
+          .padding_right(2)
+          .padding_top(2)
+          .padding_bottom(2)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_5x5p2__avx_1x8_acc4);
+      }
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F32_DWCONV2D_CHW_5X5P2__AVX_1X8_ACC5, output_width_eq_8) {
+    TEST_REQUIRES_X86_AVX;
+    DWConv2DMicrokernelTester()
+      .input_width(8)
+      .input_height(1)
+      .kernel_height(5)
+      .kernel_width(5)
+      .subsampling(1)
+      .padding_left(2)
+      .padding_right(2)
+      .padding_top(2)
+      .padding_bottom(2)
+      .Test(xnn_f32_dwconv2d_chw_ukernel_5x5p2__avx_1x8_acc5);
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5P2__AVX_1X8_ACC5, output_width_div_8) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_width = 16; input_width < 64; input_width += 8) {
+      DWConv2DMicrokernelTester()
+        .input_width(input_width)
+        .input_height(1)
+        .kernel_height(5)
+        .kernel_width(5)
+        .subsampling(1)
+        .padding_left(2)
+        .padding_right(2)
+        .padding_top(2)
+        .padding_bottom(2)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_5x5p2__avx_1x8_acc5);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5P2__AVX_1X8_ACC5, output_width_lt_8) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_width = 1; input_width < 8; input_width++) {
+      DWConv2DMicrokernelTester()
+        .input_width(8)
+        .input_height(1)
+        .kernel_height(5)
+        .kernel_width(5)
+        .subsampling(1)
+        .padding_left(2)
+        .padding_right(2)
+        .padding_top(2)
+        .padding_bottom(2)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_5x5p2__avx_1x8_acc5);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5P2__AVX_1X8_ACC5, output_width_gt_8) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_width = 9; input_width < 17; input_width++) {
+      DWConv2DMicrokernelTester()
+        .input_width(input_width)
+        .input_height(1)
+        .kernel_height(5)
+        .kernel_width(5)
+        .subsampling(1)
+        .padding_left(2)
+        .padding_right(2)
+        .padding_top(2)
+        .padding_bottom(2)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_5x5p2__avx_1x8_acc5);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5P2__AVX_1X8_ACC5, output_height_gt_1) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_height = 2; input_height < 3; input_height++) {
+      for (size_t input_width = 1; input_width < 41; input_width += 7) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(5)
+          .kernel_width(5)
+          .subsampling(1)
+          .padding_left(2)
+          .padding_right(2)
+          .padding_top(2)
+          .padding_bottom(2)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_5x5p2__avx_1x8_acc5);
+      }
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F32_DWCONV2D_CHW_5X5P2__AVX_2X8_ACC2, output_width_eq_8) {
+    TEST_REQUIRES_X86_AVX;
+    DWConv2DMicrokernelTester()
+      .input_width(8)
+      .input_height(2)
+      .kernel_height(5)
+      .kernel_width(5)
+      .subsampling(1)
+      .padding_left(2)
+      .padding_right(2)
+      .padding_top(2)
+      .padding_bottom(2)
+      .Test(xnn_f32_dwconv2d_chw_ukernel_5x5p2__avx_2x8_acc2);
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5P2__AVX_2X8_ACC2, output_width_div_8) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_width = 16; input_width < 64; input_width += 8) {
+      DWConv2DMicrokernelTester()
+        .input_width(input_width)
+        .input_height(2)
+        .kernel_height(5)
+        .kernel_width(5)
+        .subsampling(1)
+        .padding_left(2)
+        .padding_right(2)
+        .padding_top(2)
+        .padding_bottom(2)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_5x5p2__avx_2x8_acc2);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5P2__AVX_2X8_ACC2, output_width_lt_8) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_width = 1; input_width < 8; input_width++) {
+      DWConv2DMicrokernelTester()
+        .input_width(8)
+        .input_height(2)
+        .kernel_height(5)
+        .kernel_width(5)
+        .subsampling(1)
+        .padding_left(2)
+        .padding_right(2)
+        .padding_top(2)
+        .padding_bottom(2)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_5x5p2__avx_2x8_acc2);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5P2__AVX_2X8_ACC2, output_width_gt_8) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_width = 9; input_width < 17; input_width++) {
+      DWConv2DMicrokernelTester()
+        .input_width(input_width)
+        .input_height(2)
+        .kernel_height(5)
+        .kernel_width(5)
+        .subsampling(1)
+        .padding_left(2)
+        .padding_right(2)
+        .padding_top(2)
+        .padding_bottom(2)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_5x5p2__avx_2x8_acc2);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5P2__AVX_2X8_ACC2, output_height_div_2) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_height = 4; input_height < 16; input_height += 2) {
+      for (size_t input_width = 1; input_width < 41; input_width += 7) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(5)
+          .kernel_width(5)
+          .subsampling(1)
+          .padding_left(2)
+          .padding_right(2)
+          .padding_top(2)
+          .padding_bottom(2)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_5x5p2__avx_2x8_acc2);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5P2__AVX_2X8_ACC2, output_height_lt_2) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_height = 1; input_height < 2; input_height++) {
+      for (size_t input_width = 1; input_width < 41; input_width += 7) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(5)
+          .kernel_width(5)
+          .subsampling(1)
+          .padding_left(2)
+          .padding_right(2)
+          .padding_top(2)
+          .padding_bottom(2)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_5x5p2__avx_2x8_acc2);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5P2__AVX_2X8_ACC2, output_height_gt_2) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_height = 3; input_height < 5; input_height++) {
+      for (size_t input_width = 1; input_width < 41; input_width += 7) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(5)
+          .kernel_width(5)
+          .subsampling(1)
+          .padding_left(2)
+          .padding_right(2)
+          .padding_top(2)
+          .padding_bottom(2)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_5x5p2__avx_2x8_acc2);
+      }
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F32_DWCONV2D_CHW_5X5P2__AVX_2X8_ACC3, output_width_eq_8) {
+    TEST_REQUIRES_X86_AVX;
+    DWConv2DMicrokernelTester()
+      .input_width(8)
+      .input_height(2)
+      .kernel_height(5)
+      .kernel_width(5)
+      .subsampling(1)
+      .padding_left(2)
+      .padding_right(2)
+      .padding_top(2)
+      .padding_bottom(2)
+      .Test(xnn_f32_dwconv2d_chw_ukernel_5x5p2__avx_2x8_acc3);
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5P2__AVX_2X8_ACC3, output_width_div_8) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_width = 16; input_width < 64; input_width += 8) {
+      DWConv2DMicrokernelTester()
+        .input_width(input_width)
+        .input_height(2)
+        .kernel_height(5)
+        .kernel_width(5)
+        .subsampling(1)
+        .padding_left(2)
+        .padding_right(2)
+        .padding_top(2)
+        .padding_bottom(2)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_5x5p2__avx_2x8_acc3);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5P2__AVX_2X8_ACC3, output_width_lt_8) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_width = 1; input_width < 8; input_width++) {
+      DWConv2DMicrokernelTester()
+        .input_width(8)
+        .input_height(2)
+        .kernel_height(5)
+        .kernel_width(5)
+        .subsampling(1)
+        .padding_left(2)
+        .padding_right(2)
+        .padding_top(2)
+        .padding_bottom(2)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_5x5p2__avx_2x8_acc3);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5P2__AVX_2X8_ACC3, output_width_gt_8) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_width = 9; input_width < 17; input_width++) {
+      DWConv2DMicrokernelTester()
+        .input_width(input_width)
+        .input_height(2)
+        .kernel_height(5)
+        .kernel_width(5)
+        .subsampling(1)
+        .padding_left(2)
+        .padding_right(2)
+        .padding_top(2)
+        .padding_bottom(2)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_5x5p2__avx_2x8_acc3);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5P2__AVX_2X8_ACC3, output_height_div_2) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_height = 4; input_height < 16; input_height += 2) {
+      for (size_t input_width = 1; input_width < 41; input_width += 7) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(5)
+          .kernel_width(5)
+          .subsampling(1)
+          .padding_left(2)
+          .padding_right(2)
+          .padding_top(2)
+          .padding_bottom(2)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_5x5p2__avx_2x8_acc3);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5P2__AVX_2X8_ACC3, output_height_lt_2) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_height = 1; input_height < 2; input_height++) {
+      for (size_t input_width = 1; input_width < 41; input_width += 7) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(5)
+          .kernel_width(5)
+          .subsampling(1)
+          .padding_left(2)
+          .padding_right(2)
+          .padding_top(2)
+          .padding_bottom(2)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_5x5p2__avx_2x8_acc3);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5P2__AVX_2X8_ACC3, output_height_gt_2) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_height = 3; input_height < 5; input_height++) {
+      for (size_t input_width = 1; input_width < 41; input_width += 7) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(5)
+          .kernel_width(5)
+          .subsampling(1)
+          .padding_left(2)
+          .padding_right(2)
+          .padding_top(2)
+          .padding_bottom(2)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_5x5p2__avx_2x8_acc3);
+      }
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F32_DWCONV2D_CHW_5X5S2P2__AVX_1X8, output_width_eq_8) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_width = 15; input_width < 17; input_width++) {
+      DWConv2DMicrokernelTester()
+        .input_width(input_width)
+        .input_height(2)
+        .kernel_height(5)
+        .kernel_width(5)
+        .subsampling(2)
+        .padding_left(2)
+        .padding_right(2)
+        .padding_top(2)
+        .padding_bottom(2)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_5x5s2p2__avx_1x8);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5S2P2__AVX_1X8, output_width_div_8) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_width = 32; input_width < 128; input_width += 16) {
+      DWConv2DMicrokernelTester()
+        .input_width(input_width)
+        .input_height(2)
+        .kernel_height(5)
+        .kernel_width(5)
+        .subsampling(2)
+        .padding_left(2)
+        .padding_right(2)
+        .padding_top(2)
+        .padding_bottom(2)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_5x5s2p2__avx_1x8);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5S2P2__AVX_1X8, output_width_lt_8) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_width = 1; input_width < 15; input_width++) {
+      DWConv2DMicrokernelTester()
+        .input_width(16)
+        .input_height(2)
+        .kernel_height(5)
+        .kernel_width(5)
+        .subsampling(2)
+        .padding_left(2)
+        .padding_right(2)
+        .padding_top(2)
+        .padding_bottom(2)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_5x5s2p2__avx_1x8);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5S2P2__AVX_1X8, output_width_gt_8) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_width = 17; input_width < 33; input_width++) {
+      DWConv2DMicrokernelTester()
+        .input_width(input_width)
+        .input_height(2)
+        .kernel_height(5)
+        .kernel_width(5)
+        .subsampling(2)
+        .padding_left(2)
+        .padding_right(2)
+        .padding_top(2)
+        .padding_bottom(2)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_5x5s2p2__avx_1x8);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5S2P2__AVX_1X8, output_height_eq_1) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_height = 1; input_height < 3; input_height++) {
+      for (size_t input_width = 1; input_width < 81; input_width += 15) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(5)
+          .kernel_width(5)
+          .subsampling(2)
+          .padding_left(2)
+          .padding_right(2)
+          .padding_top(2)
+          .padding_bottom(2)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_5x5s2p2__avx_1x8);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5S2P2__AVX_1X8, output_height_gt_1) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_height = 3; input_height < 5; input_height++) {
+      for (size_t input_width = 1; input_width < 81; input_width += 15) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(5)
+          .kernel_width(5)
+          .subsampling(2)
+          .padding_left(2)
+          .padding_right(2)
+          .padding_top(2)
+          .padding_bottom(2)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_5x5s2p2__avx_1x8);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5S2P2__AVX_1X8, padding_top_eq_1) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_height = 2; input_height < 8; input_height++) {
+      for (size_t input_width = 1; input_width < 81; input_width += 15) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(5)
+          .kernel_width(5)
+          .subsampling(2)
+          .padding_left(2)
+          .padding_right(2)
+          .padding_top(1)
+          .padding_bottom(2)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_5x5s2p2__avx_1x8);
+      }
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F32_DWCONV2D_CHW_5X5S2P2__AVX_2X8, output_width_eq_8) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_width = 15; input_width < 17; input_width++) {
+      DWConv2DMicrokernelTester()
+        .input_width(input_width)
+        .input_height(4)
+        .kernel_height(5)
+        .kernel_width(5)
+        .subsampling(2)
+        .padding_left(2)
+        .padding_right(2)
+        .padding_top(2)
+        .padding_bottom(2)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_5x5s2p2__avx_2x8);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5S2P2__AVX_2X8, output_width_div_8) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_width = 32; input_width < 128; input_width += 16) {
+      DWConv2DMicrokernelTester()
+        .input_width(input_width)
+        .input_height(4)
+        .kernel_height(5)
+        .kernel_width(5)
+        .subsampling(2)
+        .padding_left(2)
+        .padding_right(2)
+        .padding_top(2)
+        .padding_bottom(2)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_5x5s2p2__avx_2x8);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5S2P2__AVX_2X8, output_width_lt_8) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_width = 1; input_width < 15; input_width++) {
+      DWConv2DMicrokernelTester()
+        .input_width(16)
+        .input_height(4)
+        .kernel_height(5)
+        .kernel_width(5)
+        .subsampling(2)
+        .padding_left(2)
+        .padding_right(2)
+        .padding_top(2)
+        .padding_bottom(2)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_5x5s2p2__avx_2x8);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5S2P2__AVX_2X8, output_width_gt_8) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_width = 17; input_width < 33; input_width++) {
+      DWConv2DMicrokernelTester()
+        .input_width(input_width)
+        .input_height(4)
+        .kernel_height(5)
+        .kernel_width(5)
+        .subsampling(2)
+        .padding_left(2)
+        .padding_right(2)
+        .padding_top(2)
+        .padding_bottom(2)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_5x5s2p2__avx_2x8);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5S2P2__AVX_2X8, output_height_eq_2) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_height = 3; input_height < 5; input_height++) {
+      for (size_t input_width = 1; input_width < 81; input_width += 15) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(5)
+          .kernel_width(5)
+          .subsampling(2)
+          .padding_left(2)
+          .padding_right(2)
+          .padding_top(2)
+          .padding_bottom(2)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_5x5s2p2__avx_2x8);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5S2P2__AVX_2X8, output_height_div_2) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_height = 8; input_height < 32; input_height += 4) {
+      for (size_t input_width = 1; input_width < 81; input_width += 15) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(5)
+          .kernel_width(5)
+          .subsampling(2)
+          .padding_left(2)
+          .padding_right(2)
+          .padding_top(2)
+          .padding_bottom(2)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_5x5s2p2__avx_2x8);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5S2P2__AVX_2X8, output_height_lt_2) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_height = 1; input_height < 3; input_height++) {
+      for (size_t input_width = 1; input_width < 81; input_width += 15) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(5)
+          .kernel_width(5)
+          .subsampling(2)
+          .padding_left(2)
+          .padding_right(2)
+          .padding_top(2)
+          .padding_bottom(2)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_5x5s2p2__avx_2x8);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5S2P2__AVX_2X8, output_height_gt_2) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_height = 5; input_height < 9; input_height++) {
+      for (size_t input_width = 1; input_width < 81; input_width += 15) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(5)
+          .kernel_width(5)
+          .subsampling(2)
+          .padding_left(2)
+          .padding_right(2)
+          .padding_top(2)
+          .padding_bottom(2)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_5x5s2p2__avx_2x8);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5S2P2__AVX_2X8, padding_top_eq_1) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_height = 2; input_height < 14; input_height++) {
+      for (size_t input_width = 1; input_width < 81; input_width += 15) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(5)
+          .kernel_width(5)
+          .subsampling(2)
+          .padding_left(2)
+          .padding_right(2)
+          .padding_top(1)
+          .padding_bottom(2)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_5x5s2p2__avx_2x8);
+      }
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F32_DWCONV2D_CHW_5X5S2P2__AVX_3X8, output_width_eq_8) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_width = 15; input_width < 17; input_width++) {
+      DWConv2DMicrokernelTester()
+        .input_width(input_width)
+        .input_height(6)
+        .kernel_height(5)
+        .kernel_width(5)
+        .subsampling(2)
+        .padding_left(2)
+        .padding_right(2)
+        .padding_top(2)
+        .padding_bottom(2)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_5x5s2p2__avx_3x8);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5S2P2__AVX_3X8, output_width_div_8) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_width = 32; input_width < 128; input_width += 16) {
+      DWConv2DMicrokernelTester()
+        .input_width(input_width)
+        .input_height(6)
+        .kernel_height(5)
+        .kernel_width(5)
+        .subsampling(2)
+        .padding_left(2)
+        .padding_right(2)
+        .padding_top(2)
+        .padding_bottom(2)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_5x5s2p2__avx_3x8);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5S2P2__AVX_3X8, output_width_lt_8) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_width = 1; input_width < 15; input_width++) {
+      DWConv2DMicrokernelTester()
+        .input_width(16)
+        .input_height(6)
+        .kernel_height(5)
+        .kernel_width(5)
+        .subsampling(2)
+        .padding_left(2)
+        .padding_right(2)
+        .padding_top(2)
+        .padding_bottom(2)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_5x5s2p2__avx_3x8);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5S2P2__AVX_3X8, output_width_gt_8) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_width = 17; input_width < 33; input_width++) {
+      DWConv2DMicrokernelTester()
+        .input_width(input_width)
+        .input_height(6)
+        .kernel_height(5)
+        .kernel_width(5)
+        .subsampling(2)
+        .padding_left(2)
+        .padding_right(2)
+        .padding_top(2)
+        .padding_bottom(2)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_5x5s2p2__avx_3x8);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5S2P2__AVX_3X8, output_height_eq_3) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_height = 5; input_height < 7; input_height++) {
+      for (size_t input_width = 1; input_width < 81; input_width += 15) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(5)
+          .kernel_width(5)
+          .subsampling(2)
+          .padding_left(2)
+          .padding_right(2)
+          .padding_top(2)
+          .padding_bottom(2)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_5x5s2p2__avx_3x8);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5S2P2__AVX_3X8, output_height_div_3) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_height = 12; input_height < 48; input_height += 6) {
+      for (size_t input_width = 1; input_width < 81; input_width += 15) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(5)
+          .kernel_width(5)
+          .subsampling(2)
+          .padding_left(2)
+          .padding_right(2)
+          .padding_top(2)
+          .padding_bottom(2)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_5x5s2p2__avx_3x8);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5S2P2__AVX_3X8, output_height_lt_3) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_height = 1; input_height < 5; input_height++) {
+      for (size_t input_width = 1; input_width < 81; input_width += 15) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(5)
+          .kernel_width(5)
+          .subsampling(2)
+          .padding_left(2)
+          .padding_right(2)
+          .padding_top(2)
+          .padding_bottom(2)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_5x5s2p2__avx_3x8);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5S2P2__AVX_3X8, output_height_gt_3) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_height = 7; input_height < 13; input_height++) {
+      for (size_t input_width = 1; input_width < 81; input_width += 15) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(5)
+          .kernel_width(5)
+          .subsampling(2)
+          .padding_left(2)
+          .padding_right(2)
+          .padding_top(2)
+          .padding_bottom(2)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_5x5s2p2__avx_3x8);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5S2P2__AVX_3X8, padding_top_eq_1) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_height = 2; input_height < 20; input_height++) {
+      for (size_t input_width = 1; input_width < 81; input_width += 15) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(5)
+          .kernel_width(5)
+          .subsampling(2)
+          .padding_left(2)
+          .padding_right(2)
+          .padding_top(1)
+          .padding_bottom(2)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_5x5s2p2__avx_3x8);
+      }
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F32_DWCONV2D_CHW_5X5S2P2__AVX_1X8_ACC2, output_width_eq_8) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_width = 15; input_width < 17; input_width++) {
+      DWConv2DMicrokernelTester()
+        .input_width(input_width)
+        .input_height(2)
+        .kernel_height(5)
+        .kernel_width(5)
+        .subsampling(2)
+        .padding_left(2)
+        .padding_right(2)
+        .padding_top(2)
+        .padding_bottom(2)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_5x5s2p2__avx_1x8_acc2);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5S2P2__AVX_1X8_ACC2, output_width_div_8) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_width = 32; input_width < 128; input_width += 16) {
+      DWConv2DMicrokernelTester()
+        .input_width(input_width)
+        .input_height(2)
+        .kernel_height(5)
+        .kernel_width(5)
+        .subsampling(2)
+        .padding_left(2)
+        .padding_right(2)
+        .padding_top(2)
+        .padding_bottom(2)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_5x5s2p2__avx_1x8_acc2);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5S2P2__AVX_1X8_ACC2, output_width_lt_8) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_width = 1; input_width < 15; input_width++) {
+      DWConv2DMicrokernelTester()
+        .input_width(16)
+        .input_height(2)
+        .kernel_height(5)
+        .kernel_width(5)
+        .subsampling(2)
+        .padding_left(2)
+        .padding_right(2)
+        .padding_top(2)
+        .padding_bottom(2)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_5x5s2p2__avx_1x8_acc2);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5S2P2__AVX_1X8_ACC2, output_width_gt_8) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_width = 17; input_width < 33; input_width++) {
+      DWConv2DMicrokernelTester()
+        .input_width(input_width)
+        .input_height(2)
+        .kernel_height(5)
+        .kernel_width(5)
+        .subsampling(2)
+        .padding_left(2)
+        .padding_right(2)
+        .padding_top(2)
+        .padding_bottom(2)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_5x5s2p2__avx_1x8_acc2);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5S2P2__AVX_1X8_ACC2, output_height_eq_1) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_height = 1; input_height < 3; input_height++) {
+      for (size_t input_width = 1; input_width < 81; input_width += 15) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(5)
+          .kernel_width(5)
+          .subsampling(2)
+          .padding_left(2)
+          .padding_right(2)
+          .padding_top(2)
+          .padding_bottom(2)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_5x5s2p2__avx_1x8_acc2);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5S2P2__AVX_1X8_ACC2, output_height_gt_1) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_height = 3; input_height < 5; input_height++) {
+      for (size_t input_width = 1; input_width < 81; input_width += 15) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(5)
+          .kernel_width(5)
+          .subsampling(2)
+          .padding_left(2)
+          .padding_right(2)
+          .padding_top(2)
+          .padding_bottom(2)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_5x5s2p2__avx_1x8_acc2);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5S2P2__AVX_1X8_ACC2, padding_top_eq_1) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_height = 2; input_height < 8; input_height++) {
+      for (size_t input_width = 1; input_width < 81; input_width += 15) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(5)
+          .kernel_width(5)
+          .subsampling(2)
+          .padding_left(2)
+          .padding_right(2)
+          .padding_top(1)
+          .padding_bottom(2)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_5x5s2p2__avx_1x8_acc2);
+      }
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F32_DWCONV2D_CHW_5X5S2P2__AVX_1X8_ACC3, output_width_eq_8) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_width = 15; input_width < 17; input_width++) {
+      DWConv2DMicrokernelTester()
+        .input_width(input_width)
+        .input_height(2)
+        .kernel_height(5)
+        .kernel_width(5)
+        .subsampling(2)
+        .padding_left(2)
+        .padding_right(2)
+        .padding_top(2)
+        .padding_bottom(2)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_5x5s2p2__avx_1x8_acc3);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5S2P2__AVX_1X8_ACC3, output_width_div_8) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_width = 32; input_width < 128; input_width += 16) {
+      DWConv2DMicrokernelTester()
+        .input_width(input_width)
+        .input_height(2)
+        .kernel_height(5)
+        .kernel_width(5)
+        .subsampling(2)
+        .padding_left(2)
+        .padding_right(2)
+        .padding_top(2)
+        .padding_bottom(2)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_5x5s2p2__avx_1x8_acc3);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5S2P2__AVX_1X8_ACC3, output_width_lt_8) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_width = 1; input_width < 15; input_width++) {
+      DWConv2DMicrokernelTester()
+        .input_width(16)
+        .input_height(2)
+        .kernel_height(5)
+        .kernel_width(5)
+        .subsampling(2)
+        .padding_left(2)
+        .padding_right(2)
+        .padding_top(2)
+        .padding_bottom(2)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_5x5s2p2__avx_1x8_acc3);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5S2P2__AVX_1X8_ACC3, output_width_gt_8) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_width = 17; input_width < 33; input_width++) {
+      DWConv2DMicrokernelTester()
+        .input_width(input_width)
+        .input_height(2)
+        .kernel_height(5)
+        .kernel_width(5)
+        .subsampling(2)
+        .padding_left(2)
+        .padding_right(2)
+        .padding_top(2)
+        .padding_bottom(2)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_5x5s2p2__avx_1x8_acc3);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5S2P2__AVX_1X8_ACC3, output_height_eq_1) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_height = 1; input_height < 3; input_height++) {
+      for (size_t input_width = 1; input_width < 81; input_width += 15) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(5)
+          .kernel_width(5)
+          .subsampling(2)
+          .padding_left(2)
+          .padding_right(2)
+          .padding_top(2)
+          .padding_bottom(2)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_5x5s2p2__avx_1x8_acc3);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5S2P2__AVX_1X8_ACC3, output_height_gt_1) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_height = 3; input_height < 5; input_height++) {
+      for (size_t input_width = 1; input_width < 81; input_width += 15) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(5)
+          .kernel_width(5)
+          .subsampling(2)
+          .padding_left(2)
+          .padding_right(2)
+          .padding_top(2)
+          .padding_bottom(2)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_5x5s2p2__avx_1x8_acc3);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5S2P2__AVX_1X8_ACC3, padding_top_eq_1) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_height = 2; input_height < 8; input_height++) {
+      for (size_t input_width = 1; input_width < 81; input_width += 15) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(5)
+          .kernel_width(5)
+          .subsampling(2)
+          .padding_left(2)
+          .padding_right(2)
+          .padding_top(1)
+          .padding_bottom(2)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_5x5s2p2__avx_1x8_acc3);
+      }
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F32_DWCONV2D_CHW_5X5S2P2__AVX_1X8_ACC4, output_width_eq_8) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_width = 15; input_width < 17; input_width++) {
+      DWConv2DMicrokernelTester()
+        .input_width(input_width)
+        .input_height(2)
+        .kernel_height(5)
+        .kernel_width(5)
+        .subsampling(2)
+        .padding_left(2)
+        .padding_right(2)
+        .padding_top(2)
+        .padding_bottom(2)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_5x5s2p2__avx_1x8_acc4);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5S2P2__AVX_1X8_ACC4, output_width_div_8) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_width = 32; input_width < 128; input_width += 16) {
+      DWConv2DMicrokernelTester()
+        .input_width(input_width)
+        .input_height(2)
+        .kernel_height(5)
+        .kernel_width(5)
+        .subsampling(2)
+        .padding_left(2)
+        .padding_right(2)
+        .padding_top(2)
+        .padding_bottom(2)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_5x5s2p2__avx_1x8_acc4);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5S2P2__AVX_1X8_ACC4, output_width_lt_8) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_width = 1; input_width < 15; input_width++) {
+      DWConv2DMicrokernelTester()
+        .input_width(16)
+        .input_height(2)
+        .kernel_height(5)
+        .kernel_width(5)
+        .subsampling(2)
+        .padding_left(2)
+        .padding_right(2)
+        .padding_top(2)
+        .padding_bottom(2)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_5x5s2p2__avx_1x8_acc4);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5S2P2__AVX_1X8_ACC4, output_width_gt_8) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_width = 17; input_width < 33; input_width++) {
+      DWConv2DMicrokernelTester()
+        .input_width(input_width)
+        .input_height(2)
+        .kernel_height(5)
+        .kernel_width(5)
+        .subsampling(2)
+        .padding_left(2)
+        .padding_right(2)
+        .padding_top(2)
+        .padding_bottom(2)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_5x5s2p2__avx_1x8_acc4);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5S2P2__AVX_1X8_ACC4, output_height_eq_1) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_height = 1; input_height < 3; input_height++) {
+      for (size_t input_width = 1; input_width < 81; input_width += 15) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(5)
+          .kernel_width(5)
+          .subsampling(2)
+          .padding_left(2)
+          .padding_right(2)
+          .padding_top(2)
+          .padding_bottom(2)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_5x5s2p2__avx_1x8_acc4);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5S2P2__AVX_1X8_ACC4, output_height_gt_1) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_height = 3; input_height < 5; input_height++) {
+      for (size_t input_width = 1; input_width < 81; input_width += 15) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(5)
+          .kernel_width(5)
+          .subsampling(2)
+          .padding_left(2)
+          .padding_right(2)
+          .padding_top(2)
+          .padding_bottom(2)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_5x5s2p2__avx_1x8_acc4);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5S2P2__AVX_1X8_ACC4, padding_top_eq_1) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_height = 2; input_height < 8; input_height++) {
+      for (size_t input_width = 1; input_width < 81; input_width += 15) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(5)
+          .kernel_width(5)
+          .subsampling(2)
+          .padding_left(2)
+          .padding_right(2)
+          .padding_top(1)
+          .padding_bottom(2)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_5x5s2p2__avx_1x8_acc4);
+      }
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F32_DWCONV2D_CHW_5X5S2P2__AVX_1X8_ACC5, output_width_eq_8) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_width = 15; input_width < 17; input_width++) {
+      DWConv2DMicrokernelTester()
+        .input_width(input_width)
+        .input_height(2)
+        .kernel_height(5)
+        .kernel_width(5)
+        .subsampling(2)
+        .padding_left(2)
+        .padding_right(2)
+        .padding_top(2)
+        .padding_bottom(2)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_5x5s2p2__avx_1x8_acc5);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5S2P2__AVX_1X8_ACC5, output_width_div_8) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_width = 32; input_width < 128; input_width += 16) {
+      DWConv2DMicrokernelTester()
+        .input_width(input_width)
+        .input_height(2)
+        .kernel_height(5)
+        .kernel_width(5)
+        .subsampling(2)
+        .padding_left(2)
+        .padding_right(2)
+        .padding_top(2)
+        .padding_bottom(2)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_5x5s2p2__avx_1x8_acc5);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5S2P2__AVX_1X8_ACC5, output_width_lt_8) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_width = 1; input_width < 15; input_width++) {
+      DWConv2DMicrokernelTester()
+        .input_width(16)
+        .input_height(2)
+        .kernel_height(5)
+        .kernel_width(5)
+        .subsampling(2)
+        .padding_left(2)
+        .padding_right(2)
+        .padding_top(2)
+        .padding_bottom(2)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_5x5s2p2__avx_1x8_acc5);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5S2P2__AVX_1X8_ACC5, output_width_gt_8) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_width = 17; input_width < 33; input_width++) {
+      DWConv2DMicrokernelTester()
+        .input_width(input_width)
+        .input_height(2)
+        .kernel_height(5)
+        .kernel_width(5)
+        .subsampling(2)
+        .padding_left(2)
+        .padding_right(2)
+        .padding_top(2)
+        .padding_bottom(2)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_5x5s2p2__avx_1x8_acc5);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5S2P2__AVX_1X8_ACC5, output_height_eq_1) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_height = 1; input_height < 3; input_height++) {
+      for (size_t input_width = 1; input_width < 81; input_width += 15) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(5)
+          .kernel_width(5)
+          .subsampling(2)
+          .padding_left(2)
+          .padding_right(2)
+          .padding_top(2)
+          .padding_bottom(2)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_5x5s2p2__avx_1x8_acc5);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5S2P2__AVX_1X8_ACC5, output_height_gt_1) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_height = 3; input_height < 5; input_height++) {
+      for (size_t input_width = 1; input_width < 81; input_width += 15) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(5)
+          .kernel_width(5)
+          .subsampling(2)
+          .padding_left(2)
+          .padding_right(2)
+          .padding_top(2)
+          .padding_bottom(2)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_5x5s2p2__avx_1x8_acc5);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5S2P2__AVX_1X8_ACC5, padding_top_eq_1) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_height = 2; input_height < 8; input_height++) {
+      for (size_t input_width = 1; input_width < 81; input_width += 15) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(5)
+          .kernel_width(5)
+          .subsampling(2)
+          .padding_left(2)
+          .padding_right(2)
+          .padding_top(1)
+          .padding_bottom(2)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_5x5s2p2__avx_1x8_acc5);
+      }
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F32_DWCONV2D_CHW_5X5S2P2__AVX_2X8_ACC2, output_width_eq_8) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_width = 15; input_width < 17; input_width++) {
+      DWConv2DMicrokernelTester()
+        .input_width(input_width)
+        .input_height(4)
+        .kernel_height(5)
+        .kernel_width(5)
+        .subsampling(2)
+        .padding_left(2)
+        .padding_right(2)
+        .padding_top(2)
+        .padding_bottom(2)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_5x5s2p2__avx_2x8_acc2);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5S2P2__AVX_2X8_ACC2, output_width_div_8) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_width = 32; input_width < 128; input_width += 16) {
+      DWConv2DMicrokernelTester()
+        .input_width(input_width)
+        .input_height(4)
+        .kernel_height(5)
+        .kernel_width(5)
+        .subsampling(2)
+        .padding_left(2)
+        .padding_right(2)
+        .padding_top(2)
+        .padding_bottom(2)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_5x5s2p2__avx_2x8_acc2);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5S2P2__AVX_2X8_ACC2, output_width_lt_8) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_width = 1; input_width < 15; input_width++) {
+      DWConv2DMicrokernelTester()
+        .input_width(16)
+        .input_height(4)
+        .kernel_height(5)
+        .kernel_width(5)
+        .subsampling(2)
+        .padding_left(2)
+        .padding_right(2)
+        .padding_top(2)
+        .padding_bottom(2)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_5x5s2p2__avx_2x8_acc2);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5S2P2__AVX_2X8_ACC2, output_width_gt_8) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_width = 17; input_width < 33; input_width++) {
+      DWConv2DMicrokernelTester()
+        .input_width(input_width)
+        .input_height(4)
+        .kernel_height(5)
+        .kernel_width(5)
+        .subsampling(2)
+        .padding_left(2)
+        .padding_right(2)
+        .padding_top(2)
+        .padding_bottom(2)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_5x5s2p2__avx_2x8_acc2);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5S2P2__AVX_2X8_ACC2, output_height_eq_2) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_height = 3; input_height < 5; input_height++) {
+      for (size_t input_width = 1; input_width < 81; input_width += 15) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(5)
+          .kernel_width(5)
+          .subsampling(2)
+          .padding_left(2)
+          .padding_right(2)
+          .padding_top(2)
+          .padding_bottom(2)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_5x5s2p2__avx_2x8_acc2);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5S2P2__AVX_2X8_ACC2, output_height_div_2) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_height = 8; input_height < 32; input_height += 4) {
+      for (size_t input_width = 1; input_width < 81; input_width += 15) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(5)
+          .kernel_width(5)
+          .subsampling(2)
+          .padding_left(2)
+          .padding_right(2)
+          .padding_top(2)
+          .padding_bottom(2)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_5x5s2p2__avx_2x8_acc2);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5S2P2__AVX_2X8_ACC2, output_height_lt_2) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_height = 1; input_height < 3; input_height++) {
+      for (size_t input_width = 1; input_width < 81; input_width += 15) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(5)
+          .kernel_width(5)
+          .subsampling(2)
+          .padding_left(2)
+          .padding_right(2)
+          .padding_top(2)
+          .padding_bottom(2)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_5x5s2p2__avx_2x8_acc2);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5S2P2__AVX_2X8_ACC2, output_height_gt_2) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_height = 5; input_height < 9; input_height++) {
+      for (size_t input_width = 1; input_width < 81; input_width += 15) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(5)
+          .kernel_width(5)
+          .subsampling(2)
+          .padding_left(2)
+          .padding_right(2)
+          .padding_top(2)
+          .padding_bottom(2)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_5x5s2p2__avx_2x8_acc2);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5S2P2__AVX_2X8_ACC2, padding_top_eq_1) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_height = 2; input_height < 14; input_height++) {
+      for (size_t input_width = 1; input_width < 81; input_width += 15) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(5)
+          .kernel_width(5)
+          .subsampling(2)
+          .padding_left(2)
+          .padding_right(2)
+          .padding_top(1)
+          .padding_bottom(2)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_5x5s2p2__avx_2x8_acc2);
+      }
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F32_DWCONV2D_CHW_5X5S2P2__AVX_2X8_ACC3, output_width_eq_8) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_width = 15; input_width < 17; input_width++) {
+      DWConv2DMicrokernelTester()
+        .input_width(input_width)
+        .input_height(4)
+        .kernel_height(5)
+        .kernel_width(5)
+        .subsampling(2)
+        .padding_left(2)
+        .padding_right(2)
+        .padding_top(2)
+        .padding_bottom(2)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_5x5s2p2__avx_2x8_acc3);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5S2P2__AVX_2X8_ACC3, output_width_div_8) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_width = 32; input_width < 128; input_width += 16) {
+      DWConv2DMicrokernelTester()
+        .input_width(input_width)
+        .input_height(4)
+        .kernel_height(5)
+        .kernel_width(5)
+        .subsampling(2)
+        .padding_left(2)
+        .padding_right(2)
+        .padding_top(2)
+        .padding_bottom(2)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_5x5s2p2__avx_2x8_acc3);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5S2P2__AVX_2X8_ACC3, output_width_lt_8) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_width = 1; input_width < 15; input_width++) {
+      DWConv2DMicrokernelTester()
+        .input_width(16)
+        .input_height(4)
+        .kernel_height(5)
+        .kernel_width(5)
+        .subsampling(2)
+        .padding_left(2)
+        .padding_right(2)
+        .padding_top(2)
+        .padding_bottom(2)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_5x5s2p2__avx_2x8_acc3);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5S2P2__AVX_2X8_ACC3, output_width_gt_8) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_width = 17; input_width < 33; input_width++) {
+      DWConv2DMicrokernelTester()
+        .input_width(input_width)
+        .input_height(4)
+        .kernel_height(5)
+        .kernel_width(5)
+        .subsampling(2)
+        .padding_left(2)
+        .padding_right(2)
+        .padding_top(2)
+        .padding_bottom(2)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_5x5s2p2__avx_2x8_acc3);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5S2P2__AVX_2X8_ACC3, output_height_eq_2) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_height = 3; input_height < 5; input_height++) {
+      for (size_t input_width = 1; input_width < 81; input_width += 15) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(5)
+          .kernel_width(5)
+          .subsampling(2)
+          .padding_left(2)
+          .padding_right(2)
+          .padding_top(2)
+          .padding_bottom(2)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_5x5s2p2__avx_2x8_acc3);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5S2P2__AVX_2X8_ACC3, output_height_div_2) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_height = 8; input_height < 32; input_height += 4) {
+      for (size_t input_width = 1; input_width < 81; input_width += 15) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(5)
+          .kernel_width(5)
+          .subsampling(2)
+          .padding_left(2)
+          .padding_right(2)
+          .padding_top(2)
+          .padding_bottom(2)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_5x5s2p2__avx_2x8_acc3);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5S2P2__AVX_2X8_ACC3, output_height_lt_2) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_height = 1; input_height < 3; input_height++) {
+      for (size_t input_width = 1; input_width < 81; input_width += 15) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(5)
+          .kernel_width(5)
+          .subsampling(2)
+          .padding_left(2)
+          .padding_right(2)
+          .padding_top(2)
+          .padding_bottom(2)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_5x5s2p2__avx_2x8_acc3);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5S2P2__AVX_2X8_ACC3, output_height_gt_2) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_height = 5; input_height < 9; input_height++) {
+      for (size_t input_width = 1; input_width < 81; input_width += 15) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(5)
+          .kernel_width(5)
+          .subsampling(2)
+          .padding_left(2)
+          .padding_right(2)
+          .padding_top(2)
+          .padding_bottom(2)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_5x5s2p2__avx_2x8_acc3);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5S2P2__AVX_2X8_ACC3, padding_top_eq_1) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t input_height = 2; input_height < 14; input_height++) {
+      for (size_t input_width = 1; input_width < 81; input_width += 15) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(5)
+          .kernel_width(5)
+          .subsampling(2)
+          .padding_left(2)
+          .padding_right(2)
+          .padding_top(1)
+          .padding_bottom(2)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_5x5s2p2__avx_2x8_acc3);
+      }
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F32_DWCONV2D_CHW_3X3P1__AVX512F_1X16, output_width_eq_16) {
+    TEST_REQUIRES_X86_AVX512F;
+    DWConv2DMicrokernelTester()
+      .input_width(16)
+      .input_height(1)
+      .kernel_height(3)
+      .kernel_width(3)
+      .subsampling(1)
+      .padding_left(1)
+      .padding_right(1)
+      .padding_top(1)
+      .padding_bottom(1)
+      .Test(xnn_f32_dwconv2d_chw_ukernel_3x3p1__avx512f_1x16);
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3P1__AVX512F_1X16, output_width_div_16) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_width = 32; input_width < 128; input_width += 16) {
+      DWConv2DMicrokernelTester()
+        .input_width(input_width)
+        .input_height(1)
+        .kernel_height(3)
+        .kernel_width(3)
+        .subsampling(1)
+        .padding_left(1)
+        .padding_right(1)
+        .padding_top(1)
+        .padding_bottom(1)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_3x3p1__avx512f_1x16);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3P1__AVX512F_1X16, output_width_lt_16) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_width = 1; input_width < 16; input_width++) {
+      DWConv2DMicrokernelTester()
+        .input_width(16)
+        .input_height(1)
+        .kernel_height(3)
+        .kernel_width(3)
+        .subsampling(1)
+        .padding_left(1)
+        .padding_right(1)
+        .padding_top(1)
+        .padding_bottom(1)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_3x3p1__avx512f_1x16);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3P1__AVX512F_1X16, output_width_gt_16) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_width = 17; input_width < 33; input_width++) {
+      DWConv2DMicrokernelTester()
+        .input_width(input_width)
+        .input_height(1)
+        .kernel_height(3)
+        .kernel_width(3)
+        .subsampling(1)
+        .padding_left(1)
+        .padding_right(1)
+        .padding_top(1)
+        .padding_bottom(1)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_3x3p1__avx512f_1x16);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3P1__AVX512F_1X16, output_height_gt_1) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_height = 2; input_height < 3; input_height++) {
+      for (size_t input_width = 1; input_width < 81; input_width += 15) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(3)
+          .kernel_width(3)
+          .subsampling(1)
+          .padding_left(1)
+          .padding_right(1)
+          .padding_top(1)
+          .padding_bottom(1)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_3x3p1__avx512f_1x16);
+      }
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F32_DWCONV2D_CHW_3X3P1__AVX512F_2X16, output_width_eq_16) {
+    TEST_REQUIRES_X86_AVX512F;
+    DWConv2DMicrokernelTester()
+      .input_width(16)
+      .input_height(2)
+      .kernel_height(3)
+      .kernel_width(3)
+      .subsampling(1)
+      .padding_left(1)
+      .padding_right(1)
+      .padding_top(1)
+      .padding_bottom(1)
+      .Test(xnn_f32_dwconv2d_chw_ukernel_3x3p1__avx512f_2x16);
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3P1__AVX512F_2X16, output_width_div_16) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_width = 32; input_width < 128; input_width += 16) {
+      DWConv2DMicrokernelTester()
+        .input_width(input_width)
+        .input_height(2)
+        .kernel_height(3)
+        .kernel_width(3)
+        .subsampling(1)
+        .padding_left(1)
+        .padding_right(1)
+        .padding_top(1)
+        .padding_bottom(1)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_3x3p1__avx512f_2x16);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3P1__AVX512F_2X16, output_width_lt_16) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_width = 1; input_width < 16; input_width++) {
+      DWConv2DMicrokernelTester()
+        .input_width(16)
+        .input_height(2)
+        .kernel_height(3)
+        .kernel_width(3)
+        .subsampling(1)
+        .padding_left(1)
+        .padding_right(1)
+        .padding_top(1)
+        .padding_bottom(1)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_3x3p1__avx512f_2x16);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3P1__AVX512F_2X16, output_width_gt_16) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_width = 17; input_width < 33; input_width++) {
+      DWConv2DMicrokernelTester()
+        .input_width(input_width)
+        .input_height(2)
+        .kernel_height(3)
+        .kernel_width(3)
+        .subsampling(1)
+        .padding_left(1)
+        .padding_right(1)
+        .padding_top(1)
+        .padding_bottom(1)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_3x3p1__avx512f_2x16);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3P1__AVX512F_2X16, output_height_div_2) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_height = 4; input_height < 16; input_height += 2) {
+      for (size_t input_width = 1; input_width < 81; input_width += 15) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(3)
+          .kernel_width(3)
+          .subsampling(1)
+          .padding_left(1)
+          .padding_right(1)
+          .padding_top(1)
+          .padding_bottom(1)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_3x3p1__avx512f_2x16);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3P1__AVX512F_2X16, output_height_lt_2) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_height = 1; input_height < 2; input_height++) {
+      for (size_t input_width = 1; input_width < 81; input_width += 15) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(3)
+          .kernel_width(3)
+          .subsampling(1)
+          .padding_left(1)
+          .padding_right(1)
+          .padding_top(1)
+          .padding_bottom(1)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_3x3p1__avx512f_2x16);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3P1__AVX512F_2X16, output_height_gt_2) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_height = 3; input_height < 5; input_height++) {
+      for (size_t input_width = 1; input_width < 81; input_width += 15) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(3)
+          .kernel_width(3)
+          .subsampling(1)
+          .padding_left(1)
+          .padding_right(1)
+          .padding_top(1)
+          .padding_bottom(1)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_3x3p1__avx512f_2x16);
+      }
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F32_DWCONV2D_CHW_3X3P1__AVX512F_3X16, output_width_eq_16) {
+    TEST_REQUIRES_X86_AVX512F;
+    DWConv2DMicrokernelTester()
+      .input_width(16)
+      .input_height(3)
+      .kernel_height(3)
+      .kernel_width(3)
+      .subsampling(1)
+      .padding_left(1)
+      .padding_right(1)
+      .padding_top(1)
+      .padding_bottom(1)
+      .Test(xnn_f32_dwconv2d_chw_ukernel_3x3p1__avx512f_3x16);
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3P1__AVX512F_3X16, output_width_div_16) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_width = 32; input_width < 128; input_width += 16) {
+      DWConv2DMicrokernelTester()
+        .input_width(input_width)
+        .input_height(3)
+        .kernel_height(3)
+        .kernel_width(3)
+        .subsampling(1)
+        .padding_left(1)
+        .padding_right(1)
+        .padding_top(1)
+        .padding_bottom(1)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_3x3p1__avx512f_3x16);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3P1__AVX512F_3X16, output_width_lt_16) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_width = 1; input_width < 16; input_width++) {
+      DWConv2DMicrokernelTester()
+        .input_width(16)
+        .input_height(3)
+        .kernel_height(3)
+        .kernel_width(3)
+        .subsampling(1)
+        .padding_left(1)
+        .padding_right(1)
+        .padding_top(1)
+        .padding_bottom(1)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_3x3p1__avx512f_3x16);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3P1__AVX512F_3X16, output_width_gt_16) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_width = 17; input_width < 33; input_width++) {
+      DWConv2DMicrokernelTester()
+        .input_width(input_width)
+        .input_height(3)
+        .kernel_height(3)
+        .kernel_width(3)
+        .subsampling(1)
+        .padding_left(1)
+        .padding_right(1)
+        .padding_top(1)
+        .padding_bottom(1)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_3x3p1__avx512f_3x16);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3P1__AVX512F_3X16, output_height_div_3) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_height = 6; input_height < 24; input_height += 3) {
+      for (size_t input_width = 1; input_width < 81; input_width += 15) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(3)
+          .kernel_width(3)
+          .subsampling(1)
+          .padding_left(1)
+          .padding_right(1)
+          .padding_top(1)
+          .padding_bottom(1)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_3x3p1__avx512f_3x16);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3P1__AVX512F_3X16, output_height_lt_3) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_height = 1; input_height < 3; input_height++) {
+      for (size_t input_width = 1; input_width < 81; input_width += 15) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(3)
+          .kernel_width(3)
+          .subsampling(1)
+          .padding_left(1)
+          .padding_right(1)
+          .padding_top(1)
+          .padding_bottom(1)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_3x3p1__avx512f_3x16);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3P1__AVX512F_3X16, output_height_gt_3) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_height = 4; input_height < 7; input_height++) {
+      for (size_t input_width = 1; input_width < 81; input_width += 15) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(3)
+          .kernel_width(3)
+          .subsampling(1)
+          .padding_left(1)
+          .padding_right(1)
+          .padding_top(1)
+          .padding_bottom(1)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_3x3p1__avx512f_3x16);
+      }
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F32_DWCONV2D_CHW_3X3P1__AVX512F_4X16, output_width_eq_16) {
+    TEST_REQUIRES_X86_AVX512F;
+    DWConv2DMicrokernelTester()
+      .input_width(16)
+      .input_height(4)
+      .kernel_height(3)
+      .kernel_width(3)
+      .subsampling(1)
+      .padding_left(1)
+      .padding_right(1)
+      .padding_top(1)
+      .padding_bottom(1)
+      .Test(xnn_f32_dwconv2d_chw_ukernel_3x3p1__avx512f_4x16);
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3P1__AVX512F_4X16, output_width_div_16) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_width = 32; input_width < 128; input_width += 16) {
+      DWConv2DMicrokernelTester()
+        .input_width(input_width)
+        .input_height(4)
+        .kernel_height(3)
+        .kernel_width(3)
+        .subsampling(1)
+        .padding_left(1)
+        .padding_right(1)
+        .padding_top(1)
+        .padding_bottom(1)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_3x3p1__avx512f_4x16);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3P1__AVX512F_4X16, output_width_lt_16) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_width = 1; input_width < 16; input_width++) {
+      DWConv2DMicrokernelTester()
+        .input_width(16)
+        .input_height(4)
+        .kernel_height(3)
+        .kernel_width(3)
+        .subsampling(1)
+        .padding_left(1)
+        .padding_right(1)
+        .padding_top(1)
+        .padding_bottom(1)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_3x3p1__avx512f_4x16);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3P1__AVX512F_4X16, output_width_gt_16) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_width = 17; input_width < 33; input_width++) {
+      DWConv2DMicrokernelTester()
+        .input_width(input_width)
+        .input_height(4)
+        .kernel_height(3)
+        .kernel_width(3)
+        .subsampling(1)
+        .padding_left(1)
+        .padding_right(1)
+        .padding_top(1)
+        .padding_bottom(1)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_3x3p1__avx512f_4x16);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3P1__AVX512F_4X16, output_height_div_4) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_height = 8; input_height < 32; input_height += 4) {
+      for (size_t input_width = 1; input_width < 81; input_width += 15) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(3)
+          .kernel_width(3)
+          .subsampling(1)
+          .padding_left(1)
+          .padding_right(1)
+          .padding_top(1)
+          .padding_bottom(1)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_3x3p1__avx512f_4x16);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3P1__AVX512F_4X16, output_height_lt_4) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_height = 1; input_height < 4; input_height++) {
+      for (size_t input_width = 1; input_width < 81; input_width += 15) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(3)
+          .kernel_width(3)
+          .subsampling(1)
+          .padding_left(1)
+          .padding_right(1)
+          .padding_top(1)
+          .padding_bottom(1)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_3x3p1__avx512f_4x16);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3P1__AVX512F_4X16, output_height_gt_4) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_height = 5; input_height < 9; input_height++) {
+      for (size_t input_width = 1; input_width < 81; input_width += 15) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(3)
+          .kernel_width(3)
+          .subsampling(1)
+          .padding_left(1)
+          .padding_right(1)
+          .padding_top(1)
+          .padding_bottom(1)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_3x3p1__avx512f_4x16);
+      }
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F32_DWCONV2D_CHW_3X3P1__AVX512F_1X16_ACC2, output_width_eq_16) {
+    TEST_REQUIRES_X86_AVX512F;
+    DWConv2DMicrokernelTester()
+      .input_width(16)
+      .input_height(1)
+      .kernel_height(3)
+      .kernel_width(3)
+      .subsampling(1)
+      .padding_left(1)
+      .padding_right(1)
+      .padding_top(1)
+      .padding_bottom(1)
+      .Test(xnn_f32_dwconv2d_chw_ukernel_3x3p1__avx512f_1x16_acc2);
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3P1__AVX512F_1X16_ACC2, output_width_div_16) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_width = 32; input_width < 128; input_width += 16) {
+      DWConv2DMicrokernelTester()
+        .input_width(input_width)
+        .input_height(1)
+        .kernel_height(3)
+        .kernel_width(3)
+        .subsampling(1)
+        .padding_left(1)
+        .padding_right(1)
+        .padding_top(1)
+        .padding_bottom(1)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_3x3p1__avx512f_1x16_acc2);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3P1__AVX512F_1X16_ACC2, output_width_lt_16) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_width = 1; input_width < 16; input_width++) {
+      DWConv2DMicrokernelTester()
+        .input_width(16)
+        .input_height(1)
+        .kernel_height(3)
+        .kernel_width(3)
+        .subsampling(1)
+        .padding_left(1)
+        .padding_right(1)
+        .padding_top(1)
+        .padding_bottom(1)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_3x3p1__avx512f_1x16_acc2);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3P1__AVX512F_1X16_ACC2, output_width_gt_16) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_width = 17; input_width < 33; input_width++) {
+      DWConv2DMicrokernelTester()
+        .input_width(input_width)
+        .input_height(1)
+        .kernel_height(3)
+        .kernel_width(3)
+        .subsampling(1)
+        .padding_left(1)
+        .padding_right(1)
+        .padding_top(1)
+        .padding_bottom(1)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_3x3p1__avx512f_1x16_acc2);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3P1__AVX512F_1X16_ACC2, output_height_gt_1) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_height = 2; input_height < 3; input_height++) {
+      for (size_t input_width = 1; input_width < 81; input_width += 15) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(3)
+          .kernel_width(3)
+          .subsampling(1)
+          .padding_left(1)
+          .padding_right(1)
+          .padding_top(1)
+          .padding_bottom(1)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_3x3p1__avx512f_1x16_acc2);
+      }
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F32_DWCONV2D_CHW_3X3P1__AVX512F_1X16_ACC3, output_width_eq_16) {
+    TEST_REQUIRES_X86_AVX512F;
+    DWConv2DMicrokernelTester()
+      .input_width(16)
+      .input_height(1)
+      .kernel_height(3)
+      .kernel_width(3)
+      .subsampling(1)
+      .padding_left(1)
+      .padding_right(1)
+      .padding_top(1)
+      .padding_bottom(1)
+      .Test(xnn_f32_dwconv2d_chw_ukernel_3x3p1__avx512f_1x16_acc3);
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3P1__AVX512F_1X16_ACC3, output_width_div_16) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_width = 32; input_width < 128; input_width += 16) {
+      DWConv2DMicrokernelTester()
+        .input_width(input_width)
+        .input_height(1)
+        .kernel_height(3)
+        .kernel_width(3)
+        .subsampling(1)
+        .padding_left(1)
+        .padding_right(1)
+        .padding_top(1)
+        .padding_bottom(1)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_3x3p1__avx512f_1x16_acc3);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3P1__AVX512F_1X16_ACC3, output_width_lt_16) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_width = 1; input_width < 16; input_width++) {
+      DWConv2DMicrokernelTester()
+        .input_width(16)
+        .input_height(1)
+        .kernel_height(3)
+        .kernel_width(3)
+        .subsampling(1)
+        .padding_left(1)
+        .padding_right(1)
+        .padding_top(1)
+        .padding_bottom(1)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_3x3p1__avx512f_1x16_acc3);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3P1__AVX512F_1X16_ACC3, output_width_gt_16) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_width = 17; input_width < 33; input_width++) {
+      DWConv2DMicrokernelTester()
+        .input_width(input_width)
+        .input_height(1)
+        .kernel_height(3)
+        .kernel_width(3)
+        .subsampling(1)
+        .padding_left(1)
+        .padding_right(1)
+        .padding_top(1)
+        .padding_bottom(1)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_3x3p1__avx512f_1x16_acc3);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3P1__AVX512F_1X16_ACC3, output_height_gt_1) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_height = 2; input_height < 3; input_height++) {
+      for (size_t input_width = 1; input_width < 81; input_width += 15) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(3)
+          .kernel_width(3)
+          .subsampling(1)
+          .padding_left(1)
+          .padding_right(1)
+          .padding_top(1)
+          .padding_bottom(1)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_3x3p1__avx512f_1x16_acc3);
+      }
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F32_DWCONV2D_CHW_3X3P1__AVX512F_1X16_ACC4, output_width_eq_16) {
+    TEST_REQUIRES_X86_AVX512F;
+    DWConv2DMicrokernelTester()
+      .input_width(16)
+      .input_height(1)
+      .kernel_height(3)
+      .kernel_width(3)
+      .subsampling(1)
+      .padding_left(1)
+      .padding_right(1)
+      .padding_top(1)
+      .padding_bottom(1)
+      .Test(xnn_f32_dwconv2d_chw_ukernel_3x3p1__avx512f_1x16_acc4);
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3P1__AVX512F_1X16_ACC4, output_width_div_16) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_width = 32; input_width < 128; input_width += 16) {
+      DWConv2DMicrokernelTester()
+        .input_width(input_width)
+        .input_height(1)
+        .kernel_height(3)
+        .kernel_width(3)
+        .subsampling(1)
+        .padding_left(1)
+        .padding_right(1)
+        .padding_top(1)
+        .padding_bottom(1)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_3x3p1__avx512f_1x16_acc4);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3P1__AVX512F_1X16_ACC4, output_width_lt_16) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_width = 1; input_width < 16; input_width++) {
+      DWConv2DMicrokernelTester()
+        .input_width(16)
+        .input_height(1)
+        .kernel_height(3)
+        .kernel_width(3)
+        .subsampling(1)
+        .padding_left(1)
+        .padding_right(1)
+        .padding_top(1)
+        .padding_bottom(1)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_3x3p1__avx512f_1x16_acc4);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3P1__AVX512F_1X16_ACC4, output_width_gt_16) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_width = 17; input_width < 33; input_width++) {
+      DWConv2DMicrokernelTester()
+        .input_width(input_width)
+        .input_height(1)
+        .kernel_height(3)
+        .kernel_width(3)
+        .subsampling(1)
+        .padding_left(1)
+        .padding_right(1)
+        .padding_top(1)
+        .padding_bottom(1)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_3x3p1__avx512f_1x16_acc4);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3P1__AVX512F_1X16_ACC4, output_height_gt_1) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_height = 2; input_height < 3; input_height++) {
+      for (size_t input_width = 1; input_width < 81; input_width += 15) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(3)
+          .kernel_width(3)
+          .subsampling(1)
+          .padding_left(1)
+          .padding_right(1)
+          .padding_top(1)
+          .padding_bottom(1)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_3x3p1__avx512f_1x16_acc4);
+      }
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F32_DWCONV2D_CHW_3X3P1__AVX512F_2X16_ACC2, output_width_eq_16) {
+    TEST_REQUIRES_X86_AVX512F;
+    DWConv2DMicrokernelTester()
+      .input_width(16)
+      .input_height(2)
+      .kernel_height(3)
+      .kernel_width(3)
+      .subsampling(1)
+      .padding_left(1)
+      .padding_right(1)
+      .padding_top(1)
+      .padding_bottom(1)
+      .Test(xnn_f32_dwconv2d_chw_ukernel_3x3p1__avx512f_2x16_acc2);
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3P1__AVX512F_2X16_ACC2, output_width_div_16) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_width = 32; input_width < 128; input_width += 16) {
+      DWConv2DMicrokernelTester()
+        .input_width(input_width)
+        .input_height(2)
+        .kernel_height(3)
+        .kernel_width(3)
+        .subsampling(1)
+        .padding_left(1)
+        .padding_right(1)
+        .padding_top(1)
+        .padding_bottom(1)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_3x3p1__avx512f_2x16_acc2);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3P1__AVX512F_2X16_ACC2, output_width_lt_16) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_width = 1; input_width < 16; input_width++) {
+      DWConv2DMicrokernelTester()
+        .input_width(16)
+        .input_height(2)
+        .kernel_height(3)
+        .kernel_width(3)
+        .subsampling(1)
+        .padding_left(1)
+        .padding_right(1)
+        .padding_top(1)
+        .padding_bottom(1)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_3x3p1__avx512f_2x16_acc2);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3P1__AVX512F_2X16_ACC2, output_width_gt_16) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_width = 17; input_width < 33; input_width++) {
+      DWConv2DMicrokernelTester()
+        .input_width(input_width)
+        .input_height(2)
+        .kernel_height(3)
+        .kernel_width(3)
+        .subsampling(1)
+        .padding_left(1)
+        .padding_right(1)
+        .padding_top(1)
+        .padding_bottom(1)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_3x3p1__avx512f_2x16_acc2);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3P1__AVX512F_2X16_ACC2, output_height_div_2) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_height = 4; input_height < 16; input_height += 2) {
+      for (size_t input_width = 1; input_width < 81; input_width += 15) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(3)
+          .kernel_width(3)
+          .subsampling(1)
+          .padding_left(1)
+          .padding_right(1)
+          .padding_top(1)
+          .padding_bottom(1)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_3x3p1__avx512f_2x16_acc2);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3P1__AVX512F_2X16_ACC2, output_height_lt_2) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_height = 1; input_height < 2; input_height++) {
+      for (size_t input_width = 1; input_width < 81; input_width += 15) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(3)
+          .kernel_width(3)
+          .subsampling(1)
+          .padding_left(1)
+          .padding_right(1)
+          .padding_top(1)
+          .padding_bottom(1)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_3x3p1__avx512f_2x16_acc2);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3P1__AVX512F_2X16_ACC2, output_height_gt_2) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_height = 3; input_height < 5; input_height++) {
+      for (size_t input_width = 1; input_width < 81; input_width += 15) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(3)
+          .kernel_width(3)
+          .subsampling(1)
+          .padding_left(1)
+          .padding_right(1)
+          .padding_top(1)
+          .padding_bottom(1)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_3x3p1__avx512f_2x16_acc2);
+      }
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F32_DWCONV2D_CHW_3X3S2P1__AVX512F_1X16, output_width_eq_16) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_width = 31; input_width < 33; input_width++) {
+      DWConv2DMicrokernelTester()
+        .input_width(input_width)
+        .input_height(2)
+        .kernel_height(3)
+        .kernel_width(3)
+        .subsampling(2)
+        .padding_left(1)
+        .padding_right(1)
+        .padding_top(1)
+        .padding_bottom(1)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_3x3s2p1__avx512f_1x16);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3S2P1__AVX512F_1X16, output_width_div_16) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_width = 64; input_width < 256; input_width += 32) {
+      DWConv2DMicrokernelTester()
+        .input_width(input_width)
+        .input_height(2)
+        .kernel_height(3)
+        .kernel_width(3)
+        .subsampling(2)
+        .padding_left(1)
+        .padding_right(1)
+        .padding_top(1)
+        .padding_bottom(1)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_3x3s2p1__avx512f_1x16);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3S2P1__AVX512F_1X16, output_width_lt_16) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_width = 1; input_width < 31; input_width++) {
+      DWConv2DMicrokernelTester()
+        .input_width(32)
+        .input_height(2)
+        .kernel_height(3)
+        .kernel_width(3)
+        .subsampling(2)
+        .padding_left(1)
+        .padding_right(1)
+        .padding_top(1)
+        .padding_bottom(1)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_3x3s2p1__avx512f_1x16);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3S2P1__AVX512F_1X16, output_width_gt_16) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_width = 33; input_width < 65; input_width++) {
+      DWConv2DMicrokernelTester()
+        .input_width(input_width)
+        .input_height(2)
+        .kernel_height(3)
+        .kernel_width(3)
+        .subsampling(2)
+        .padding_left(1)
+        .padding_right(1)
+        .padding_top(1)
+        .padding_bottom(1)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_3x3s2p1__avx512f_1x16);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3S2P1__AVX512F_1X16, output_height_eq_1) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_height = 1; input_height < 3; input_height++) {
+      for (size_t input_width = 1; input_width < 161; input_width += 31) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(3)
+          .kernel_width(3)
+          .subsampling(2)
+          .padding_left(1)
+          .padding_right(1)
+          .padding_top(1)
+          .padding_bottom(1)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_3x3s2p1__avx512f_1x16);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3S2P1__AVX512F_1X16, output_height_gt_1) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_height = 3; input_height < 5; input_height++) {
+      for (size_t input_width = 1; input_width < 161; input_width += 31) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(3)
+          .kernel_width(3)
+          .subsampling(2)
+          .padding_left(1)
+          .padding_right(1)
+          .padding_top(1)
+          .padding_bottom(1)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_3x3s2p1__avx512f_1x16);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3S2P1__AVX512F_1X16, padding_top_eq_1) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_height = 2; input_height < 8; input_height++) {
+      for (size_t input_width = 1; input_width < 161; input_width += 31) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(3)
+          .kernel_width(3)
+          .subsampling(2)
+          .padding_left(1)
+          .padding_right(1)
+          .padding_top(0)
+          .padding_bottom(1)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_3x3s2p1__avx512f_1x16);
+      }
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F32_DWCONV2D_CHW_3X3S2P1__AVX512F_2X16, output_width_eq_16) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_width = 31; input_width < 33; input_width++) {
+      DWConv2DMicrokernelTester()
+        .input_width(input_width)
+        .input_height(4)
+        .kernel_height(3)
+        .kernel_width(3)
+        .subsampling(2)
+        .padding_left(1)
+        .padding_right(1)
+        .padding_top(1)
+        .padding_bottom(1)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_3x3s2p1__avx512f_2x16);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3S2P1__AVX512F_2X16, output_width_div_16) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_width = 64; input_width < 256; input_width += 32) {
+      DWConv2DMicrokernelTester()
+        .input_width(input_width)
+        .input_height(4)
+        .kernel_height(3)
+        .kernel_width(3)
+        .subsampling(2)
+        .padding_left(1)
+        .padding_right(1)
+        .padding_top(1)
+        .padding_bottom(1)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_3x3s2p1__avx512f_2x16);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3S2P1__AVX512F_2X16, output_width_lt_16) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_width = 1; input_width < 31; input_width++) {
+      DWConv2DMicrokernelTester()
+        .input_width(32)
+        .input_height(4)
+        .kernel_height(3)
+        .kernel_width(3)
+        .subsampling(2)
+        .padding_left(1)
+        .padding_right(1)
+        .padding_top(1)
+        .padding_bottom(1)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_3x3s2p1__avx512f_2x16);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3S2P1__AVX512F_2X16, output_width_gt_16) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_width = 33; input_width < 65; input_width++) {
+      DWConv2DMicrokernelTester()
+        .input_width(input_width)
+        .input_height(4)
+        .kernel_height(3)
+        .kernel_width(3)
+        .subsampling(2)
+        .padding_left(1)
+        .padding_right(1)
+        .padding_top(1)
+        .padding_bottom(1)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_3x3s2p1__avx512f_2x16);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3S2P1__AVX512F_2X16, output_height_eq_2) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_height = 3; input_height < 5; input_height++) {
+      for (size_t input_width = 1; input_width < 161; input_width += 31) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(3)
+          .kernel_width(3)
+          .subsampling(2)
+          .padding_left(1)
+          .padding_right(1)
+          .padding_top(1)
+          .padding_bottom(1)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_3x3s2p1__avx512f_2x16);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3S2P1__AVX512F_2X16, output_height_div_2) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_height = 8; input_height < 32; input_height += 4) {
+      for (size_t input_width = 1; input_width < 161; input_width += 31) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(3)
+          .kernel_width(3)
+          .subsampling(2)
+          .padding_left(1)
+          .padding_right(1)
+          .padding_top(1)
+          .padding_bottom(1)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_3x3s2p1__avx512f_2x16);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3S2P1__AVX512F_2X16, output_height_lt_2) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_height = 1; input_height < 3; input_height++) {
+      for (size_t input_width = 1; input_width < 161; input_width += 31) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(3)
+          .kernel_width(3)
+          .subsampling(2)
+          .padding_left(1)
+          .padding_right(1)
+          .padding_top(1)
+          .padding_bottom(1)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_3x3s2p1__avx512f_2x16);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3S2P1__AVX512F_2X16, output_height_gt_2) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_height = 5; input_height < 9; input_height++) {
+      for (size_t input_width = 1; input_width < 161; input_width += 31) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(3)
+          .kernel_width(3)
+          .subsampling(2)
+          .padding_left(1)
+          .padding_right(1)
+          .padding_top(1)
+          .padding_bottom(1)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_3x3s2p1__avx512f_2x16);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3S2P1__AVX512F_2X16, padding_top_eq_1) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_height = 2; input_height < 14; input_height++) {
+      for (size_t input_width = 1; input_width < 161; input_width += 31) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(3)
+          .kernel_width(3)
+          .subsampling(2)
+          .padding_left(1)
+          .padding_right(1)
+          .padding_top(0)
+          .padding_bottom(1)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_3x3s2p1__avx512f_2x16);
+      }
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F32_DWCONV2D_CHW_3X3S2P1__AVX512F_3X16, output_width_eq_16) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_width = 31; input_width < 33; input_width++) {
+      DWConv2DMicrokernelTester()
+        .input_width(input_width)
+        .input_height(6)
+        .kernel_height(3)
+        .kernel_width(3)
+        .subsampling(2)
+        .padding_left(1)
+        .padding_right(1)
+        .padding_top(1)
+        .padding_bottom(1)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_3x3s2p1__avx512f_3x16);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3S2P1__AVX512F_3X16, output_width_div_16) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_width = 64; input_width < 256; input_width += 32) {
+      DWConv2DMicrokernelTester()
+        .input_width(input_width)
+        .input_height(6)
+        .kernel_height(3)
+        .kernel_width(3)
+        .subsampling(2)
+        .padding_left(1)
+        .padding_right(1)
+        .padding_top(1)
+        .padding_bottom(1)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_3x3s2p1__avx512f_3x16);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3S2P1__AVX512F_3X16, output_width_lt_16) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_width = 1; input_width < 31; input_width++) {
+      DWConv2DMicrokernelTester()
+        .input_width(32)
+        .input_height(6)
+        .kernel_height(3)
+        .kernel_width(3)
+        .subsampling(2)
+        .padding_left(1)
+        .padding_right(1)
+        .padding_top(1)
+        .padding_bottom(1)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_3x3s2p1__avx512f_3x16);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3S2P1__AVX512F_3X16, output_width_gt_16) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_width = 33; input_width < 65; input_width++) {
+      DWConv2DMicrokernelTester()
+        .input_width(input_width)
+        .input_height(6)
+        .kernel_height(3)
+        .kernel_width(3)
+        .subsampling(2)
+        .padding_left(1)
+        .padding_right(1)
+        .padding_top(1)
+        .padding_bottom(1)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_3x3s2p1__avx512f_3x16);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3S2P1__AVX512F_3X16, output_height_eq_3) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_height = 5; input_height < 7; input_height++) {
+      for (size_t input_width = 1; input_width < 161; input_width += 31) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(3)
+          .kernel_width(3)
+          .subsampling(2)
+          .padding_left(1)
+          .padding_right(1)
+          .padding_top(1)
+          .padding_bottom(1)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_3x3s2p1__avx512f_3x16);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3S2P1__AVX512F_3X16, output_height_div_3) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_height = 12; input_height < 48; input_height += 6) {
+      for (size_t input_width = 1; input_width < 161; input_width += 31) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(3)
+          .kernel_width(3)
+          .subsampling(2)
+          .padding_left(1)
+          .padding_right(1)
+          .padding_top(1)
+          .padding_bottom(1)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_3x3s2p1__avx512f_3x16);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3S2P1__AVX512F_3X16, output_height_lt_3) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_height = 1; input_height < 5; input_height++) {
+      for (size_t input_width = 1; input_width < 161; input_width += 31) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(3)
+          .kernel_width(3)
+          .subsampling(2)
+          .padding_left(1)
+          .padding_right(1)
+          .padding_top(1)
+          .padding_bottom(1)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_3x3s2p1__avx512f_3x16);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3S2P1__AVX512F_3X16, output_height_gt_3) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_height = 7; input_height < 13; input_height++) {
+      for (size_t input_width = 1; input_width < 161; input_width += 31) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(3)
+          .kernel_width(3)
+          .subsampling(2)
+          .padding_left(1)
+          .padding_right(1)
+          .padding_top(1)
+          .padding_bottom(1)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_3x3s2p1__avx512f_3x16);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3S2P1__AVX512F_3X16, padding_top_eq_1) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_height = 2; input_height < 20; input_height++) {
+      for (size_t input_width = 1; input_width < 161; input_width += 31) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(3)
+          .kernel_width(3)
+          .subsampling(2)
+          .padding_left(1)
+          .padding_right(1)
+          .padding_top(0)
+          .padding_bottom(1)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_3x3s2p1__avx512f_3x16);
+      }
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F32_DWCONV2D_CHW_3X3S2P1__AVX512F_1X16_ACC2, output_width_eq_16) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_width = 31; input_width < 33; input_width++) {
+      DWConv2DMicrokernelTester()
+        .input_width(input_width)
+        .input_height(2)
+        .kernel_height(3)
+        .kernel_width(3)
+        .subsampling(2)
+        .padding_left(1)
+        .padding_right(1)
+        .padding_top(1)
+        .padding_bottom(1)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_3x3s2p1__avx512f_1x16_acc2);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3S2P1__AVX512F_1X16_ACC2, output_width_div_16) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_width = 64; input_width < 256; input_width += 32) {
+      DWConv2DMicrokernelTester()
+        .input_width(input_width)
+        .input_height(2)
+        .kernel_height(3)
+        .kernel_width(3)
+        .subsampling(2)
+        .padding_left(1)
+        .padding_right(1)
+        .padding_top(1)
+        .padding_bottom(1)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_3x3s2p1__avx512f_1x16_acc2);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3S2P1__AVX512F_1X16_ACC2, output_width_lt_16) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_width = 1; input_width < 31; input_width++) {
+      DWConv2DMicrokernelTester()
+        .input_width(32)
+        .input_height(2)
+        .kernel_height(3)
+        .kernel_width(3)
+        .subsampling(2)
+        .padding_left(1)
+        .padding_right(1)
+        .padding_top(1)
+        .padding_bottom(1)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_3x3s2p1__avx512f_1x16_acc2);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3S2P1__AVX512F_1X16_ACC2, output_width_gt_16) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_width = 33; input_width < 65; input_width++) {
+      DWConv2DMicrokernelTester()
+        .input_width(input_width)
+        .input_height(2)
+        .kernel_height(3)
+        .kernel_width(3)
+        .subsampling(2)
+        .padding_left(1)
+        .padding_right(1)
+        .padding_top(1)
+        .padding_bottom(1)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_3x3s2p1__avx512f_1x16_acc2);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3S2P1__AVX512F_1X16_ACC2, output_height_eq_1) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_height = 1; input_height < 3; input_height++) {
+      for (size_t input_width = 1; input_width < 161; input_width += 31) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(3)
+          .kernel_width(3)
+          .subsampling(2)
+          .padding_left(1)
+          .padding_right(1)
+          .padding_top(1)
+          .padding_bottom(1)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_3x3s2p1__avx512f_1x16_acc2);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3S2P1__AVX512F_1X16_ACC2, output_height_gt_1) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_height = 3; input_height < 5; input_height++) {
+      for (size_t input_width = 1; input_width < 161; input_width += 31) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(3)
+          .kernel_width(3)
+          .subsampling(2)
+          .padding_left(1)
+          .padding_right(1)
+          .padding_top(1)
+          .padding_bottom(1)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_3x3s2p1__avx512f_1x16_acc2);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3S2P1__AVX512F_1X16_ACC2, padding_top_eq_1) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_height = 2; input_height < 8; input_height++) {
+      for (size_t input_width = 1; input_width < 161; input_width += 31) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(3)
+          .kernel_width(3)
+          .subsampling(2)
+          .padding_left(1)
+          .padding_right(1)
+          .padding_top(0)
+          .padding_bottom(1)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_3x3s2p1__avx512f_1x16_acc2);
+      }
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F32_DWCONV2D_CHW_3X3S2P1__AVX512F_1X16_ACC3, output_width_eq_16) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_width = 31; input_width < 33; input_width++) {
+      DWConv2DMicrokernelTester()
+        .input_width(input_width)
+        .input_height(2)
+        .kernel_height(3)
+        .kernel_width(3)
+        .subsampling(2)
+        .padding_left(1)
+        .padding_right(1)
+        .padding_top(1)
+        .padding_bottom(1)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_3x3s2p1__avx512f_1x16_acc3);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3S2P1__AVX512F_1X16_ACC3, output_width_div_16) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_width = 64; input_width < 256; input_width += 32) {
+      DWConv2DMicrokernelTester()
+        .input_width(input_width)
+        .input_height(2)
+        .kernel_height(3)
+        .kernel_width(3)
+        .subsampling(2)
+        .padding_left(1)
+        .padding_right(1)
+        .padding_top(1)
+        .padding_bottom(1)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_3x3s2p1__avx512f_1x16_acc3);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3S2P1__AVX512F_1X16_ACC3, output_width_lt_16) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_width = 1; input_width < 31; input_width++) {
+      DWConv2DMicrokernelTester()
+        .input_width(32)
+        .input_height(2)
+        .kernel_height(3)
+        .kernel_width(3)
+        .subsampling(2)
+        .padding_left(1)
+        .padding_right(1)
+        .padding_top(1)
+        .padding_bottom(1)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_3x3s2p1__avx512f_1x16_acc3);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3S2P1__AVX512F_1X16_ACC3, output_width_gt_16) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_width = 33; input_width < 65; input_width++) {
+      DWConv2DMicrokernelTester()
+        .input_width(input_width)
+        .input_height(2)
+        .kernel_height(3)
+        .kernel_width(3)
+        .subsampling(2)
+        .padding_left(1)
+        .padding_right(1)
+        .padding_top(1)
+        .padding_bottom(1)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_3x3s2p1__avx512f_1x16_acc3);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3S2P1__AVX512F_1X16_ACC3, output_height_eq_1) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_height = 1; input_height < 3; input_height++) {
+      for (size_t input_width = 1; input_width < 161; input_width += 31) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(3)
+          .kernel_width(3)
+          .subsampling(2)
+          .padding_left(1)
+          .padding_right(1)
+          .padding_top(1)
+          .padding_bottom(1)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_3x3s2p1__avx512f_1x16_acc3);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3S2P1__AVX512F_1X16_ACC3, output_height_gt_1) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_height = 3; input_height < 5; input_height++) {
+      for (size_t input_width = 1; input_width < 161; input_width += 31) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(3)
+          .kernel_width(3)
+          .subsampling(2)
+          .padding_left(1)
+          .padding_right(1)
+          .padding_top(1)
+          .padding_bottom(1)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_3x3s2p1__avx512f_1x16_acc3);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3S2P1__AVX512F_1X16_ACC3, padding_top_eq_1) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_height = 2; input_height < 8; input_height++) {
+      for (size_t input_width = 1; input_width < 161; input_width += 31) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(3)
+          .kernel_width(3)
+          .subsampling(2)
+          .padding_left(1)
+          .padding_right(1)
+          .padding_top(0)
+          .padding_bottom(1)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_3x3s2p1__avx512f_1x16_acc3);
+      }
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F32_DWCONV2D_CHW_3X3S2P1__AVX512F_1X16_ACC4, output_width_eq_16) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_width = 31; input_width < 33; input_width++) {
+      DWConv2DMicrokernelTester()
+        .input_width(input_width)
+        .input_height(2)
+        .kernel_height(3)
+        .kernel_width(3)
+        .subsampling(2)
+        .padding_left(1)
+        .padding_right(1)
+        .padding_top(1)
+        .padding_bottom(1)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_3x3s2p1__avx512f_1x16_acc4);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3S2P1__AVX512F_1X16_ACC4, output_width_div_16) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_width = 64; input_width < 256; input_width += 32) {
+      DWConv2DMicrokernelTester()
+        .input_width(input_width)
+        .input_height(2)
+        .kernel_height(3)
+        .kernel_width(3)
+        .subsampling(2)
+        .padding_left(1)
+        .padding_right(1)
+        .padding_top(1)
+        .padding_bottom(1)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_3x3s2p1__avx512f_1x16_acc4);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3S2P1__AVX512F_1X16_ACC4, output_width_lt_16) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_width = 1; input_width < 31; input_width++) {
+      DWConv2DMicrokernelTester()
+        .input_width(32)
+        .input_height(2)
+        .kernel_height(3)
+        .kernel_width(3)
+        .subsampling(2)
+        .padding_left(1)
+        .padding_right(1)
+        .padding_top(1)
+        .padding_bottom(1)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_3x3s2p1__avx512f_1x16_acc4);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3S2P1__AVX512F_1X16_ACC4, output_width_gt_16) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_width = 33; input_width < 65; input_width++) {
+      DWConv2DMicrokernelTester()
+        .input_width(input_width)
+        .input_height(2)
+        .kernel_height(3)
+        .kernel_width(3)
+        .subsampling(2)
+        .padding_left(1)
+        .padding_right(1)
+        .padding_top(1)
+        .padding_bottom(1)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_3x3s2p1__avx512f_1x16_acc4);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3S2P1__AVX512F_1X16_ACC4, output_height_eq_1) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_height = 1; input_height < 3; input_height++) {
+      for (size_t input_width = 1; input_width < 161; input_width += 31) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(3)
+          .kernel_width(3)
+          .subsampling(2)
+          .padding_left(1)
+          .padding_right(1)
+          .padding_top(1)
+          .padding_bottom(1)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_3x3s2p1__avx512f_1x16_acc4);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3S2P1__AVX512F_1X16_ACC4, output_height_gt_1) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_height = 3; input_height < 5; input_height++) {
+      for (size_t input_width = 1; input_width < 161; input_width += 31) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(3)
+          .kernel_width(3)
+          .subsampling(2)
+          .padding_left(1)
+          .padding_right(1)
+          .padding_top(1)
+          .padding_bottom(1)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_3x3s2p1__avx512f_1x16_acc4);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3S2P1__AVX512F_1X16_ACC4, padding_top_eq_1) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_height = 2; input_height < 8; input_height++) {
+      for (size_t input_width = 1; input_width < 161; input_width += 31) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(3)
+          .kernel_width(3)
+          .subsampling(2)
+          .padding_left(1)
+          .padding_right(1)
+          .padding_top(0)
+          .padding_bottom(1)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_3x3s2p1__avx512f_1x16_acc4);
+      }
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F32_DWCONV2D_CHW_3X3S2P1__AVX512F_2X16_ACC2, output_width_eq_16) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_width = 31; input_width < 33; input_width++) {
+      DWConv2DMicrokernelTester()
+        .input_width(input_width)
+        .input_height(4)
+        .kernel_height(3)
+        .kernel_width(3)
+        .subsampling(2)
+        .padding_left(1)
+        .padding_right(1)
+        .padding_top(1)
+        .padding_bottom(1)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_3x3s2p1__avx512f_2x16_acc2);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3S2P1__AVX512F_2X16_ACC2, output_width_div_16) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_width = 64; input_width < 256; input_width += 32) {
+      DWConv2DMicrokernelTester()
+        .input_width(input_width)
+        .input_height(4)
+        .kernel_height(3)
+        .kernel_width(3)
+        .subsampling(2)
+        .padding_left(1)
+        .padding_right(1)
+        .padding_top(1)
+        .padding_bottom(1)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_3x3s2p1__avx512f_2x16_acc2);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3S2P1__AVX512F_2X16_ACC2, output_width_lt_16) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_width = 1; input_width < 31; input_width++) {
+      DWConv2DMicrokernelTester()
+        .input_width(32)
+        .input_height(4)
+        .kernel_height(3)
+        .kernel_width(3)
+        .subsampling(2)
+        .padding_left(1)
+        .padding_right(1)
+        .padding_top(1)
+        .padding_bottom(1)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_3x3s2p1__avx512f_2x16_acc2);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3S2P1__AVX512F_2X16_ACC2, output_width_gt_16) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_width = 33; input_width < 65; input_width++) {
+      DWConv2DMicrokernelTester()
+        .input_width(input_width)
+        .input_height(4)
+        .kernel_height(3)
+        .kernel_width(3)
+        .subsampling(2)
+        .padding_left(1)
+        .padding_right(1)
+        .padding_top(1)
+        .padding_bottom(1)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_3x3s2p1__avx512f_2x16_acc2);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3S2P1__AVX512F_2X16_ACC2, output_height_eq_2) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_height = 3; input_height < 5; input_height++) {
+      for (size_t input_width = 1; input_width < 161; input_width += 31) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(3)
+          .kernel_width(3)
+          .subsampling(2)
+          .padding_left(1)
+          .padding_right(1)
+          .padding_top(1)
+          .padding_bottom(1)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_3x3s2p1__avx512f_2x16_acc2);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3S2P1__AVX512F_2X16_ACC2, output_height_div_2) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_height = 8; input_height < 32; input_height += 4) {
+      for (size_t input_width = 1; input_width < 161; input_width += 31) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(3)
+          .kernel_width(3)
+          .subsampling(2)
+          .padding_left(1)
+          .padding_right(1)
+          .padding_top(1)
+          .padding_bottom(1)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_3x3s2p1__avx512f_2x16_acc2);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3S2P1__AVX512F_2X16_ACC2, output_height_lt_2) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_height = 1; input_height < 3; input_height++) {
+      for (size_t input_width = 1; input_width < 161; input_width += 31) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(3)
+          .kernel_width(3)
+          .subsampling(2)
+          .padding_left(1)
+          .padding_right(1)
+          .padding_top(1)
+          .padding_bottom(1)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_3x3s2p1__avx512f_2x16_acc2);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3S2P1__AVX512F_2X16_ACC2, output_height_gt_2) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_height = 5; input_height < 9; input_height++) {
+      for (size_t input_width = 1; input_width < 161; input_width += 31) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(3)
+          .kernel_width(3)
+          .subsampling(2)
+          .padding_left(1)
+          .padding_right(1)
+          .padding_top(1)
+          .padding_bottom(1)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_3x3s2p1__avx512f_2x16_acc2);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_3X3S2P1__AVX512F_2X16_ACC2, padding_top_eq_1) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_height = 2; input_height < 14; input_height++) {
+      for (size_t input_width = 1; input_width < 161; input_width += 31) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(3)
+          .kernel_width(3)
+          .subsampling(2)
+          .padding_left(1)
+          .padding_right(1)
+          .padding_top(0)
+          .padding_bottom(1)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_3x3s2p1__avx512f_2x16_acc2);
+      }
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F32_DWCONV2D_CHW_5X5P2__AVX512F_1X16, output_width_eq_16) {
+    TEST_REQUIRES_X86_AVX512F;
+    DWConv2DMicrokernelTester()
+      .input_width(16)
+      .input_height(1)
+      .kernel_height(5)
+      .kernel_width(5)
+      .subsampling(1)
+      .padding_left(2)
+      .padding_right(2)
+      .padding_top(2)
+      .padding_bottom(2)
+      .Test(xnn_f32_dwconv2d_chw_ukernel_5x5p2__avx512f_1x16);
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5P2__AVX512F_1X16, output_width_div_16) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_width = 32; input_width < 128; input_width += 16) {
+      DWConv2DMicrokernelTester()
+        .input_width(input_width)
+        .input_height(1)
+        .kernel_height(5)
+        .kernel_width(5)
+        .subsampling(1)
+        .padding_left(2)
+        .padding_right(2)
+        .padding_top(2)
+        .padding_bottom(2)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_5x5p2__avx512f_1x16);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5P2__AVX512F_1X16, output_width_lt_16) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_width = 1; input_width < 16; input_width++) {
+      DWConv2DMicrokernelTester()
+        .input_width(16)
+        .input_height(1)
+        .kernel_height(5)
+        .kernel_width(5)
+        .subsampling(1)
+        .padding_left(2)
+        .padding_right(2)
+        .padding_top(2)
+        .padding_bottom(2)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_5x5p2__avx512f_1x16);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5P2__AVX512F_1X16, output_width_gt_16) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_width = 17; input_width < 33; input_width++) {
+      DWConv2DMicrokernelTester()
+        .input_width(input_width)
+        .input_height(1)
+        .kernel_height(5)
+        .kernel_width(5)
+        .subsampling(1)
+        .padding_left(2)
+        .padding_right(2)
+        .padding_top(2)
+        .padding_bottom(2)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_5x5p2__avx512f_1x16);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5P2__AVX512F_1X16, output_height_gt_1) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_height = 2; input_height < 3; input_height++) {
+      for (size_t input_width = 1; input_width < 81; input_width += 15) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(5)
+          .kernel_width(5)
+          .subsampling(1)
+          .padding_left(2)
+          .padding_right(2)
+          .padding_top(2)
+          .padding_bottom(2)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_5x5p2__avx512f_1x16);
+      }
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F32_DWCONV2D_CHW_5X5P2__AVX512F_2X16, output_width_eq_16) {
+    TEST_REQUIRES_X86_AVX512F;
+    DWConv2DMicrokernelTester()
+      .input_width(16)
+      .input_height(2)
+      .kernel_height(5)
+      .kernel_width(5)
+      .subsampling(1)
+      .padding_left(2)
+      .padding_right(2)
+      .padding_top(2)
+      .padding_bottom(2)
+      .Test(xnn_f32_dwconv2d_chw_ukernel_5x5p2__avx512f_2x16);
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5P2__AVX512F_2X16, output_width_div_16) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_width = 32; input_width < 128; input_width += 16) {
+      DWConv2DMicrokernelTester()
+        .input_width(input_width)
+        .input_height(2)
+        .kernel_height(5)
+        .kernel_width(5)
+        .subsampling(1)
+        .padding_left(2)
+        .padding_right(2)
+        .padding_top(2)
+        .padding_bottom(2)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_5x5p2__avx512f_2x16);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5P2__AVX512F_2X16, output_width_lt_16) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_width = 1; input_width < 16; input_width++) {
+      DWConv2DMicrokernelTester()
+        .input_width(16)
+        .input_height(2)
+        .kernel_height(5)
+        .kernel_width(5)
+        .subsampling(1)
+        .padding_left(2)
+        .padding_right(2)
+        .padding_top(2)
+        .padding_bottom(2)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_5x5p2__avx512f_2x16);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5P2__AVX512F_2X16, output_width_gt_16) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_width = 17; input_width < 33; input_width++) {
+      DWConv2DMicrokernelTester()
+        .input_width(input_width)
+        .input_height(2)
+        .kernel_height(5)
+        .kernel_width(5)
+        .subsampling(1)
+        .padding_left(2)
+        .padding_right(2)
+        .padding_top(2)
+        .padding_bottom(2)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_5x5p2__avx512f_2x16);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5P2__AVX512F_2X16, output_height_div_2) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_height = 4; input_height < 16; input_height += 2) {
+      for (size_t input_width = 1; input_width < 81; input_width += 15) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(5)
+          .kernel_width(5)
+          .subsampling(1)
+          .padding_left(2)
+          .padding_right(2)
+          .padding_top(2)
+          .padding_bottom(2)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_5x5p2__avx512f_2x16);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5P2__AVX512F_2X16, output_height_lt_2) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_height = 1; input_height < 2; input_height++) {
+      for (size_t input_width = 1; input_width < 81; input_width += 15) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(5)
+          .kernel_width(5)
+          .subsampling(1)
+          .padding_left(2)
+          .padding_right(2)
+          .padding_top(2)
+          .padding_bottom(2)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_5x5p2__avx512f_2x16);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5P2__AVX512F_2X16, output_height_gt_2) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_height = 3; input_height < 5; input_height++) {
+      for (size_t input_width = 1; input_width < 81; input_width += 15) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(5)
+          .kernel_width(5)
+          .subsampling(1)
+          .padding_left(2)
+          .padding_right(2)
+          .padding_top(2)
+          .padding_bottom(2)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_5x5p2__avx512f_2x16);
+      }
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F32_DWCONV2D_CHW_5X5P2__AVX512F_3X16, output_width_eq_16) {
+    TEST_REQUIRES_X86_AVX512F;
+    DWConv2DMicrokernelTester()
+      .input_width(16)
+      .input_height(3)
+      .kernel_height(5)
+      .kernel_width(5)
+      .subsampling(1)
+      .padding_left(2)
+      .padding_right(2)
+      .padding_top(2)
+      .padding_bottom(2)
+      .Test(xnn_f32_dwconv2d_chw_ukernel_5x5p2__avx512f_3x16);
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5P2__AVX512F_3X16, output_width_div_16) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_width = 32; input_width < 128; input_width += 16) {
+      DWConv2DMicrokernelTester()
+        .input_width(input_width)
+        .input_height(3)
+        .kernel_height(5)
+        .kernel_width(5)
+        .subsampling(1)
+        .padding_left(2)
+        .padding_right(2)
+        .padding_top(2)
+        .padding_bottom(2)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_5x5p2__avx512f_3x16);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5P2__AVX512F_3X16, output_width_lt_16) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_width = 1; input_width < 16; input_width++) {
+      DWConv2DMicrokernelTester()
+        .input_width(16)
+        .input_height(3)
+        .kernel_height(5)
+        .kernel_width(5)
+        .subsampling(1)
+        .padding_left(2)
+        .padding_right(2)
+        .padding_top(2)
+        .padding_bottom(2)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_5x5p2__avx512f_3x16);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5P2__AVX512F_3X16, output_width_gt_16) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_width = 17; input_width < 33; input_width++) {
+      DWConv2DMicrokernelTester()
+        .input_width(input_width)
+        .input_height(3)
+        .kernel_height(5)
+        .kernel_width(5)
+        .subsampling(1)
+        .padding_left(2)
+        .padding_right(2)
+        .padding_top(2)
+        .padding_bottom(2)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_5x5p2__avx512f_3x16);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5P2__AVX512F_3X16, output_height_div_3) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_height = 6; input_height < 24; input_height += 3) {
+      for (size_t input_width = 1; input_width < 81; input_width += 15) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(5)
+          .kernel_width(5)
+          .subsampling(1)
+          .padding_left(2)
+          .padding_right(2)
+          .padding_top(2)
+          .padding_bottom(2)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_5x5p2__avx512f_3x16);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5P2__AVX512F_3X16, output_height_lt_3) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_height = 1; input_height < 3; input_height++) {
+      for (size_t input_width = 1; input_width < 81; input_width += 15) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(5)
+          .kernel_width(5)
+          .subsampling(1)
+          .padding_left(2)
+          .padding_right(2)
+          .padding_top(2)
+          .padding_bottom(2)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_5x5p2__avx512f_3x16);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5P2__AVX512F_3X16, output_height_gt_3) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_height = 4; input_height < 7; input_height++) {
+      for (size_t input_width = 1; input_width < 81; input_width += 15) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(5)
+          .kernel_width(5)
+          .subsampling(1)
+          .padding_left(2)
+          .padding_right(2)
+          .padding_top(2)
+          .padding_bottom(2)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_5x5p2__avx512f_3x16);
+      }
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F32_DWCONV2D_CHW_5X5P2__AVX512F_4X16, output_width_eq_16) {
+    TEST_REQUIRES_X86_AVX512F;
+    DWConv2DMicrokernelTester()
+      .input_width(16)
+      .input_height(4)
+      .kernel_height(5)
+      .kernel_width(5)
+      .subsampling(1)
+      .padding_left(2)
+      .padding_right(2)
+      .padding_top(2)
+      .padding_bottom(2)
+      .Test(xnn_f32_dwconv2d_chw_ukernel_5x5p2__avx512f_4x16);
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5P2__AVX512F_4X16, output_width_div_16) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_width = 32; input_width < 128; input_width += 16) {
+      DWConv2DMicrokernelTester()
+        .input_width(input_width)
+        .input_height(4)
+        .kernel_height(5)
+        .kernel_width(5)
+        .subsampling(1)
+        .padding_left(2)
+        .padding_right(2)
+        .padding_top(2)
+        .padding_bottom(2)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_5x5p2__avx512f_4x16);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5P2__AVX512F_4X16, output_width_lt_16) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_width = 1; input_width < 16; input_width++) {
+      DWConv2DMicrokernelTester()
+        .input_width(16)
+        .input_height(4)
+        .kernel_height(5)
+        .kernel_width(5)
+        .subsampling(1)
+        .padding_left(2)
+        .padding_right(2)
+        .padding_top(2)
+        .padding_bottom(2)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_5x5p2__avx512f_4x16);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5P2__AVX512F_4X16, output_width_gt_16) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_width = 17; input_width < 33; input_width++) {
+      DWConv2DMicrokernelTester()
+        .input_width(input_width)
+        .input_height(4)
+        .kernel_height(5)
+        .kernel_width(5)
+        .subsampling(1)
+        .padding_left(2)
+        .padding_right(2)
+        .padding_top(2)
+        .padding_bottom(2)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_5x5p2__avx512f_4x16);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5P2__AVX512F_4X16, output_height_div_4) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_height = 8; input_height < 32; input_height += 4) {
+      for (size_t input_width = 1; input_width < 81; input_width += 15) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(5)
+          .kernel_width(5)
+          .subsampling(1)
+          .padding_left(2)
+          .padding_right(2)
+          .padding_top(2)
+          .padding_bottom(2)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_5x5p2__avx512f_4x16);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5P2__AVX512F_4X16, output_height_lt_4) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_height = 1; input_height < 4; input_height++) {
+      for (size_t input_width = 1; input_width < 81; input_width += 15) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(5)
+          .kernel_width(5)
+          .subsampling(1)
+          .padding_left(2)
+          .padding_right(2)
+          .padding_top(2)
+          .padding_bottom(2)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_5x5p2__avx512f_4x16);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5P2__AVX512F_4X16, output_height_gt_4) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_height = 5; input_height < 9; input_height++) {
+      for (size_t input_width = 1; input_width < 81; input_width += 15) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(5)
+          .kernel_width(5)
+          .subsampling(1)
+          .padding_left(2)
+          .padding_right(2)
+          .padding_top(2)
+          .padding_bottom(2)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_5x5p2__avx512f_4x16);
+      }
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F32_DWCONV2D_CHW_5X5P2__AVX512F_1X16_ACC2, output_width_eq_16) {
+    TEST_REQUIRES_X86_AVX512F;
+    DWConv2DMicrokernelTester()
+      .input_width(16)
+      .input_height(1)
+      .kernel_height(5)
+      .kernel_width(5)
+      .subsampling(1)
+      .padding_left(2)
+      .padding_right(2)
+      .padding_top(2)
+      .padding_bottom(2)
+      .Test(xnn_f32_dwconv2d_chw_ukernel_5x5p2__avx512f_1x16_acc2);
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5P2__AVX512F_1X16_ACC2, output_width_div_16) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_width = 32; input_width < 128; input_width += 16) {
+      DWConv2DMicrokernelTester()
+        .input_width(input_width)
+        .input_height(1)
+        .kernel_height(5)
+        .kernel_width(5)
+        .subsampling(1)
+        .padding_left(2)
+        .padding_right(2)
+        .padding_top(2)
+        .padding_bottom(2)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_5x5p2__avx512f_1x16_acc2);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5P2__AVX512F_1X16_ACC2, output_width_lt_16) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_width = 1; input_width < 16; input_width++) {
+      DWConv2DMicrokernelTester()
+        .input_width(16)
+        .input_height(1)
+        .kernel_height(5)
+        .kernel_width(5)
+        .subsampling(1)
+        .padding_left(2)
+        .padding_right(2)
+        .padding_top(2)
+        .padding_bottom(2)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_5x5p2__avx512f_1x16_acc2);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5P2__AVX512F_1X16_ACC2, output_width_gt_16) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_width = 17; input_width < 33; input_width++) {
+      DWConv2DMicrokernelTester()
+        .input_width(input_width)
+        .input_height(1)
+        .kernel_height(5)
+        .kernel_width(5)
+        .subsampling(1)
+        .padding_left(2)
+        .padding_right(2)
+        .padding_top(2)
+        .padding_bottom(2)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_5x5p2__avx512f_1x16_acc2);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5P2__AVX512F_1X16_ACC2, output_height_gt_1) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_height = 2; input_height < 3; input_height++) {
+      for (size_t input_width = 1; input_width < 81; input_width += 15) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(5)
+          .kernel_width(5)
+          .subsampling(1)
+          .padding_left(2)
+          .padding_right(2)
+          .padding_top(2)
+          .padding_bottom(2)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_5x5p2__avx512f_1x16_acc2);
+      }
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F32_DWCONV2D_CHW_5X5P2__AVX512F_1X16_ACC3, output_width_eq_16) {
+    TEST_REQUIRES_X86_AVX512F;
+    DWConv2DMicrokernelTester()
+      .input_width(16)
+      .input_height(1)
+      .kernel_height(5)
+      .kernel_width(5)
+      .subsampling(1)
+      .padding_left(2)
+      .padding_right(2)
+      .padding_top(2)
+      .padding_bottom(2)
+      .Test(xnn_f32_dwconv2d_chw_ukernel_5x5p2__avx512f_1x16_acc3);
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5P2__AVX512F_1X16_ACC3, output_width_div_16) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_width = 32; input_width < 128; input_width += 16) {
+      DWConv2DMicrokernelTester()
+        .input_width(input_width)
+        .input_height(1)
+        .kernel_height(5)
+        .kernel_width(5)
+        .subsampling(1)
+        .padding_left(2)
+        .padding_right(2)
+        .padding_top(2)
+        .padding_bottom(2)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_5x5p2__avx512f_1x16_acc3);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5P2__AVX512F_1X16_ACC3, output_width_lt_16) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_width = 1; input_width < 16; input_width++) {
+      DWConv2DMicrokernelTester()
+        .input_width(16)
+        .input_height(1)
+        .kernel_height(5)
+        .kernel_width(5)
+        .subsampling(1)
+        .padding_left(2)
+        .padding_right(2)
+        .padding_top(2)
+        .padding_bottom(2)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_5x5p2__avx512f_1x16_acc3);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5P2__AVX512F_1X16_ACC3, output_width_gt_16) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_width = 17; input_width < 33; input_width++) {
+      DWConv2DMicrokernelTester()
+        .input_width(input_width)
+        .input_height(1)
+        .kernel_height(5)
+        .kernel_width(5)
+        .subsampling(1)
+        .padding_left(2)
+        .padding_right(2)
+        .padding_top(2)
+        .padding_bottom(2)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_5x5p2__avx512f_1x16_acc3);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5P2__AVX512F_1X16_ACC3, output_height_gt_1) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_height = 2; input_height < 3; input_height++) {
+      for (size_t input_width = 1; input_width < 81; input_width += 15) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(5)
+          .kernel_width(5)
+          .subsampling(1)
+          .padding_left(2)
+          .padding_right(2)
+          .padding_top(2)
+          .padding_bottom(2)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_5x5p2__avx512f_1x16_acc3);
+      }
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F32_DWCONV2D_CHW_5X5P2__AVX512F_1X16_ACC4, output_width_eq_16) {
+    TEST_REQUIRES_X86_AVX512F;
+    DWConv2DMicrokernelTester()
+      .input_width(16)
+      .input_height(1)
+      .kernel_height(5)
+      .kernel_width(5)
+      .subsampling(1)
+      .padding_left(2)
+      .padding_right(2)
+      .padding_top(2)
+      .padding_bottom(2)
+      .Test(xnn_f32_dwconv2d_chw_ukernel_5x5p2__avx512f_1x16_acc4);
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5P2__AVX512F_1X16_ACC4, output_width_div_16) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_width = 32; input_width < 128; input_width += 16) {
+      DWConv2DMicrokernelTester()
+        .input_width(input_width)
+        .input_height(1)
+        .kernel_height(5)
+        .kernel_width(5)
+        .subsampling(1)
+        .padding_left(2)
+        .padding_right(2)
+        .padding_top(2)
+        .padding_bottom(2)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_5x5p2__avx512f_1x16_acc4);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5P2__AVX512F_1X16_ACC4, output_width_lt_16) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_width = 1; input_width < 16; input_width++) {
+      DWConv2DMicrokernelTester()
+        .input_width(16)
+        .input_height(1)
+        .kernel_height(5)
+        .kernel_width(5)
+        .subsampling(1)
+        .padding_left(2)
+        .padding_right(2)
+        .padding_top(2)
+        .padding_bottom(2)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_5x5p2__avx512f_1x16_acc4);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5P2__AVX512F_1X16_ACC4, output_width_gt_16) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_width = 17; input_width < 33; input_width++) {
+      DWConv2DMicrokernelTester()
+        .input_width(input_width)
+        .input_height(1)
+        .kernel_height(5)
+        .kernel_width(5)
+        .subsampling(1)
+        .padding_left(2)
+        .padding_right(2)
+        .padding_top(2)
+        .padding_bottom(2)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_5x5p2__avx512f_1x16_acc4);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5P2__AVX512F_1X16_ACC4, output_height_gt_1) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_height = 2; input_height < 3; input_height++) {
+      for (size_t input_width = 1; input_width < 81; input_width += 15) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(5)
+          .kernel_width(5)
+          .subsampling(1)
+          .padding_left(2)
+          .padding_right(2)
+          .padding_top(2)
+          .padding_bottom(2)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_5x5p2__avx512f_1x16_acc4);
+      }
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F32_DWCONV2D_CHW_5X5P2__AVX512F_2X16_ACC2, output_width_eq_16) {
+    TEST_REQUIRES_X86_AVX512F;
+    DWConv2DMicrokernelTester()
+      .input_width(16)
+      .input_height(2)
+      .kernel_height(5)
+      .kernel_width(5)
+      .subsampling(1)
+      .padding_left(2)
+      .padding_right(2)
+      .padding_top(2)
+      .padding_bottom(2)
+      .Test(xnn_f32_dwconv2d_chw_ukernel_5x5p2__avx512f_2x16_acc2);
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5P2__AVX512F_2X16_ACC2, output_width_div_16) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_width = 32; input_width < 128; input_width += 16) {
+      DWConv2DMicrokernelTester()
+        .input_width(input_width)
+        .input_height(2)
+        .kernel_height(5)
+        .kernel_width(5)
+        .subsampling(1)
+        .padding_left(2)
+        .padding_right(2)
+        .padding_top(2)
+        .padding_bottom(2)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_5x5p2__avx512f_2x16_acc2);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5P2__AVX512F_2X16_ACC2, output_width_lt_16) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_width = 1; input_width < 16; input_width++) {
+      DWConv2DMicrokernelTester()
+        .input_width(16)
+        .input_height(2)
+        .kernel_height(5)
+        .kernel_width(5)
+        .subsampling(1)
+        .padding_left(2)
+        .padding_right(2)
+        .padding_top(2)
+        .padding_bottom(2)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_5x5p2__avx512f_2x16_acc2);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5P2__AVX512F_2X16_ACC2, output_width_gt_16) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_width = 17; input_width < 33; input_width++) {
+      DWConv2DMicrokernelTester()
+        .input_width(input_width)
+        .input_height(2)
+        .kernel_height(5)
+        .kernel_width(5)
+        .subsampling(1)
+        .padding_left(2)
+        .padding_right(2)
+        .padding_top(2)
+        .padding_bottom(2)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_5x5p2__avx512f_2x16_acc2);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5P2__AVX512F_2X16_ACC2, output_height_div_2) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_height = 4; input_height < 16; input_height += 2) {
+      for (size_t input_width = 1; input_width < 81; input_width += 15) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(5)
+          .kernel_width(5)
+          .subsampling(1)
+          .padding_left(2)
+          .padding_right(2)
+          .padding_top(2)
+          .padding_bottom(2)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_5x5p2__avx512f_2x16_acc2);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5P2__AVX512F_2X16_ACC2, output_height_lt_2) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_height = 1; input_height < 2; input_height++) {
+      for (size_t input_width = 1; input_width < 81; input_width += 15) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(5)
+          .kernel_width(5)
+          .subsampling(1)
+          .padding_left(2)
+          .padding_right(2)
+          .padding_top(2)
+          .padding_bottom(2)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_5x5p2__avx512f_2x16_acc2);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5P2__AVX512F_2X16_ACC2, output_height_gt_2) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_height = 3; input_height < 5; input_height++) {
+      for (size_t input_width = 1; input_width < 81; input_width += 15) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(5)
+          .kernel_width(5)
+          .subsampling(1)
+          .padding_left(2)
+          .padding_right(2)
+          .padding_top(2)
+          .padding_bottom(2)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_5x5p2__avx512f_2x16_acc2);
+      }
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F32_DWCONV2D_CHW_5X5S2P2__AVX512F_1X16, output_width_eq_16) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_width = 31; input_width < 33; input_width++) {
+      DWConv2DMicrokernelTester()
+        .input_width(input_width)
+        .input_height(2)
+        .kernel_height(5)
+        .kernel_width(5)
+        .subsampling(2)
+        .padding_left(2)
+        .padding_right(2)
+        .padding_top(2)
+        .padding_bottom(2)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_5x5s2p2__avx512f_1x16);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5S2P2__AVX512F_1X16, output_width_div_16) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_width = 64; input_width < 256; input_width += 32) {
+      DWConv2DMicrokernelTester()
+        .input_width(input_width)
+        .input_height(2)
+        .kernel_height(5)
+        .kernel_width(5)
+        .subsampling(2)
+        .padding_left(2)
+        .padding_right(2)
+        .padding_top(2)
+        .padding_bottom(2)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_5x5s2p2__avx512f_1x16);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5S2P2__AVX512F_1X16, output_width_lt_16) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_width = 1; input_width < 31; input_width++) {
+      DWConv2DMicrokernelTester()
+        .input_width(32)
+        .input_height(2)
+        .kernel_height(5)
+        .kernel_width(5)
+        .subsampling(2)
+        .padding_left(2)
+        .padding_right(2)
+        .padding_top(2)
+        .padding_bottom(2)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_5x5s2p2__avx512f_1x16);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5S2P2__AVX512F_1X16, output_width_gt_16) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_width = 33; input_width < 65; input_width++) {
+      DWConv2DMicrokernelTester()
+        .input_width(input_width)
+        .input_height(2)
+        .kernel_height(5)
+        .kernel_width(5)
+        .subsampling(2)
+        .padding_left(2)
+        .padding_right(2)
+        .padding_top(2)
+        .padding_bottom(2)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_5x5s2p2__avx512f_1x16);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5S2P2__AVX512F_1X16, output_height_eq_1) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_height = 1; input_height < 3; input_height++) {
+      for (size_t input_width = 1; input_width < 161; input_width += 31) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(5)
+          .kernel_width(5)
+          .subsampling(2)
+          .padding_left(2)
+          .padding_right(2)
+          .padding_top(2)
+          .padding_bottom(2)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_5x5s2p2__avx512f_1x16);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5S2P2__AVX512F_1X16, output_height_gt_1) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_height = 3; input_height < 5; input_height++) {
+      for (size_t input_width = 1; input_width < 161; input_width += 31) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(5)
+          .kernel_width(5)
+          .subsampling(2)
+          .padding_left(2)
+          .padding_right(2)
+          .padding_top(2)
+          .padding_bottom(2)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_5x5s2p2__avx512f_1x16);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5S2P2__AVX512F_1X16, padding_top_eq_1) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_height = 2; input_height < 8; input_height++) {
+      for (size_t input_width = 1; input_width < 161; input_width += 31) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(5)
+          .kernel_width(5)
+          .subsampling(2)
+          .padding_left(2)
+          .padding_right(2)
+          .padding_top(1)
+          .padding_bottom(2)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_5x5s2p2__avx512f_1x16);
+      }
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F32_DWCONV2D_CHW_5X5S2P2__AVX512F_2X16, output_width_eq_16) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_width = 31; input_width < 33; input_width++) {
+      DWConv2DMicrokernelTester()
+        .input_width(input_width)
+        .input_height(4)
+        .kernel_height(5)
+        .kernel_width(5)
+        .subsampling(2)
+        .padding_left(2)
+        .padding_right(2)
+        .padding_top(2)
+        .padding_bottom(2)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_5x5s2p2__avx512f_2x16);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5S2P2__AVX512F_2X16, output_width_div_16) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_width = 64; input_width < 256; input_width += 32) {
+      DWConv2DMicrokernelTester()
+        .input_width(input_width)
+        .input_height(4)
+        .kernel_height(5)
+        .kernel_width(5)
+        .subsampling(2)
+        .padding_left(2)
+        .padding_right(2)
+        .padding_top(2)
+        .padding_bottom(2)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_5x5s2p2__avx512f_2x16);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5S2P2__AVX512F_2X16, output_width_lt_16) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_width = 1; input_width < 31; input_width++) {
+      DWConv2DMicrokernelTester()
+        .input_width(32)
+        .input_height(4)
+        .kernel_height(5)
+        .kernel_width(5)
+        .subsampling(2)
+        .padding_left(2)
+        .padding_right(2)
+        .padding_top(2)
+        .padding_bottom(2)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_5x5s2p2__avx512f_2x16);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5S2P2__AVX512F_2X16, output_width_gt_16) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_width = 33; input_width < 65; input_width++) {
+      DWConv2DMicrokernelTester()
+        .input_width(input_width)
+        .input_height(4)
+        .kernel_height(5)
+        .kernel_width(5)
+        .subsampling(2)
+        .padding_left(2)
+        .padding_right(2)
+        .padding_top(2)
+        .padding_bottom(2)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_5x5s2p2__avx512f_2x16);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5S2P2__AVX512F_2X16, output_height_eq_2) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_height = 3; input_height < 5; input_height++) {
+      for (size_t input_width = 1; input_width < 161; input_width += 31) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(5)
+          .kernel_width(5)
+          .subsampling(2)
+          .padding_left(2)
+          .padding_right(2)
+          .padding_top(2)
+          .padding_bottom(2)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_5x5s2p2__avx512f_2x16);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5S2P2__AVX512F_2X16, output_height_div_2) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_height = 8; input_height < 32; input_height += 4) {
+      for (size_t input_width = 1; input_width < 161; input_width += 31) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(5)
+          .kernel_width(5)
+          .subsampling(2)
+          .padding_left(2)
+          .padding_right(2)
+          .padding_top(2)
+          .padding_bottom(2)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_5x5s2p2__avx512f_2x16);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5S2P2__AVX512F_2X16, output_height_lt_2) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_height = 1; input_height < 3; input_height++) {
+      for (size_t input_width = 1; input_width < 161; input_width += 31) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(5)
+          .kernel_width(5)
+          .subsampling(2)
+          .padding_left(2)
+          .padding_right(2)
+          .padding_top(2)
+          .padding_bottom(2)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_5x5s2p2__avx512f_2x16);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5S2P2__AVX512F_2X16, output_height_gt_2) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_height = 5; input_height < 9; input_height++) {
+      for (size_t input_width = 1; input_width < 161; input_width += 31) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(5)
+          .kernel_width(5)
+          .subsampling(2)
+          .padding_left(2)
+          .padding_right(2)
+          .padding_top(2)
+          .padding_bottom(2)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_5x5s2p2__avx512f_2x16);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5S2P2__AVX512F_2X16, padding_top_eq_1) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_height = 2; input_height < 14; input_height++) {
+      for (size_t input_width = 1; input_width < 161; input_width += 31) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(5)
+          .kernel_width(5)
+          .subsampling(2)
+          .padding_left(2)
+          .padding_right(2)
+          .padding_top(1)
+          .padding_bottom(2)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_5x5s2p2__avx512f_2x16);
+      }
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F32_DWCONV2D_CHW_5X5S2P2__AVX512F_3X16, output_width_eq_16) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_width = 31; input_width < 33; input_width++) {
+      DWConv2DMicrokernelTester()
+        .input_width(input_width)
+        .input_height(6)
+        .kernel_height(5)
+        .kernel_width(5)
+        .subsampling(2)
+        .padding_left(2)
+        .padding_right(2)
+        .padding_top(2)
+        .padding_bottom(2)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_5x5s2p2__avx512f_3x16);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5S2P2__AVX512F_3X16, output_width_div_16) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_width = 64; input_width < 256; input_width += 32) {
+      DWConv2DMicrokernelTester()
+        .input_width(input_width)
+        .input_height(6)
+        .kernel_height(5)
+        .kernel_width(5)
+        .subsampling(2)
+        .padding_left(2)
+        .padding_right(2)
+        .padding_top(2)
+        .padding_bottom(2)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_5x5s2p2__avx512f_3x16);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5S2P2__AVX512F_3X16, output_width_lt_16) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_width = 1; input_width < 31; input_width++) {
+      DWConv2DMicrokernelTester()
+        .input_width(32)
+        .input_height(6)
+        .kernel_height(5)
+        .kernel_width(5)
+        .subsampling(2)
+        .padding_left(2)
+        .padding_right(2)
+        .padding_top(2)
+        .padding_bottom(2)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_5x5s2p2__avx512f_3x16);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5S2P2__AVX512F_3X16, output_width_gt_16) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_width = 33; input_width < 65; input_width++) {
+      DWConv2DMicrokernelTester()
+        .input_width(input_width)
+        .input_height(6)
+        .kernel_height(5)
+        .kernel_width(5)
+        .subsampling(2)
+        .padding_left(2)
+        .padding_right(2)
+        .padding_top(2)
+        .padding_bottom(2)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_5x5s2p2__avx512f_3x16);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5S2P2__AVX512F_3X16, output_height_eq_3) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_height = 5; input_height < 7; input_height++) {
+      for (size_t input_width = 1; input_width < 161; input_width += 31) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(5)
+          .kernel_width(5)
+          .subsampling(2)
+          .padding_left(2)
+          .padding_right(2)
+          .padding_top(2)
+          .padding_bottom(2)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_5x5s2p2__avx512f_3x16);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5S2P2__AVX512F_3X16, output_height_div_3) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_height = 12; input_height < 48; input_height += 6) {
+      for (size_t input_width = 1; input_width < 161; input_width += 31) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(5)
+          .kernel_width(5)
+          .subsampling(2)
+          .padding_left(2)
+          .padding_right(2)
+          .padding_top(2)
+          .padding_bottom(2)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_5x5s2p2__avx512f_3x16);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5S2P2__AVX512F_3X16, output_height_lt_3) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_height = 1; input_height < 5; input_height++) {
+      for (size_t input_width = 1; input_width < 161; input_width += 31) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(5)
+          .kernel_width(5)
+          .subsampling(2)
+          .padding_left(2)
+          .padding_right(2)
+          .padding_top(2)
+          .padding_bottom(2)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_5x5s2p2__avx512f_3x16);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5S2P2__AVX512F_3X16, output_height_gt_3) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_height = 7; input_height < 13; input_height++) {
+      for (size_t input_width = 1; input_width < 161; input_width += 31) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(5)
+          .kernel_width(5)
+          .subsampling(2)
+          .padding_left(2)
+          .padding_right(2)
+          .padding_top(2)
+          .padding_bottom(2)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_5x5s2p2__avx512f_3x16);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5S2P2__AVX512F_3X16, padding_top_eq_1) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_height = 2; input_height < 20; input_height++) {
+      for (size_t input_width = 1; input_width < 161; input_width += 31) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(5)
+          .kernel_width(5)
+          .subsampling(2)
+          .padding_left(2)
+          .padding_right(2)
+          .padding_top(1)
+          .padding_bottom(2)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_5x5s2p2__avx512f_3x16);
+      }
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F32_DWCONV2D_CHW_5X5S2P2__AVX512F_1X16_ACC2, output_width_eq_16) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_width = 31; input_width < 33; input_width++) {
+      DWConv2DMicrokernelTester()
+        .input_width(input_width)
+        .input_height(2)
+        .kernel_height(5)
+        .kernel_width(5)
+        .subsampling(2)
+        .padding_left(2)
+        .padding_right(2)
+        .padding_top(2)
+        .padding_bottom(2)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_5x5s2p2__avx512f_1x16_acc2);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5S2P2__AVX512F_1X16_ACC2, output_width_div_16) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_width = 64; input_width < 256; input_width += 32) {
+      DWConv2DMicrokernelTester()
+        .input_width(input_width)
+        .input_height(2)
+        .kernel_height(5)
+        .kernel_width(5)
+        .subsampling(2)
+        .padding_left(2)
+        .padding_right(2)
+        .padding_top(2)
+        .padding_bottom(2)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_5x5s2p2__avx512f_1x16_acc2);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5S2P2__AVX512F_1X16_ACC2, output_width_lt_16) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_width = 1; input_width < 31; input_width++) {
+      DWConv2DMicrokernelTester()
+        .input_width(32)
+        .input_height(2)
+        .kernel_height(5)
+        .kernel_width(5)
+        .subsampling(2)
+        .padding_left(2)
+        .padding_right(2)
+        .padding_top(2)
+        .padding_bottom(2)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_5x5s2p2__avx512f_1x16_acc2);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5S2P2__AVX512F_1X16_ACC2, output_width_gt_16) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_width = 33; input_width < 65; input_width++) {
+      DWConv2DMicrokernelTester()
+        .input_width(input_width)
+        .input_height(2)
+        .kernel_height(5)
+        .kernel_width(5)
+        .subsampling(2)
+        .padding_left(2)
+        .padding_right(2)
+        .padding_top(2)
+        .padding_bottom(2)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_5x5s2p2__avx512f_1x16_acc2);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5S2P2__AVX512F_1X16_ACC2, output_height_eq_1) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_height = 1; input_height < 3; input_height++) {
+      for (size_t input_width = 1; input_width < 161; input_width += 31) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(5)
+          .kernel_width(5)
+          .subsampling(2)
+          .padding_left(2)
+          .padding_right(2)
+          .padding_top(2)
+          .padding_bottom(2)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_5x5s2p2__avx512f_1x16_acc2);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5S2P2__AVX512F_1X16_ACC2, output_height_gt_1) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_height = 3; input_height < 5; input_height++) {
+      for (size_t input_width = 1; input_width < 161; input_width += 31) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(5)
+          .kernel_width(5)
+          .subsampling(2)
+          .padding_left(2)
+          .padding_right(2)
+          .padding_top(2)
+          .padding_bottom(2)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_5x5s2p2__avx512f_1x16_acc2);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5S2P2__AVX512F_1X16_ACC2, padding_top_eq_1) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_height = 2; input_height < 8; input_height++) {
+      for (size_t input_width = 1; input_width < 161; input_width += 31) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(5)
+          .kernel_width(5)
+          .subsampling(2)
+          .padding_left(2)
+          .padding_right(2)
+          .padding_top(1)
+          .padding_bottom(2)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_5x5s2p2__avx512f_1x16_acc2);
+      }
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F32_DWCONV2D_CHW_5X5S2P2__AVX512F_1X16_ACC3, output_width_eq_16) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_width = 31; input_width < 33; input_width++) {
+      DWConv2DMicrokernelTester()
+        .input_width(input_width)
+        .input_height(2)
+        .kernel_height(5)
+        .kernel_width(5)
+        .subsampling(2)
+        .padding_left(2)
+        .padding_right(2)
+        .padding_top(2)
+        .padding_bottom(2)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_5x5s2p2__avx512f_1x16_acc3);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5S2P2__AVX512F_1X16_ACC3, output_width_div_16) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_width = 64; input_width < 256; input_width += 32) {
+      DWConv2DMicrokernelTester()
+        .input_width(input_width)
+        .input_height(2)
+        .kernel_height(5)
+        .kernel_width(5)
+        .subsampling(2)
+        .padding_left(2)
+        .padding_right(2)
+        .padding_top(2)
+        .padding_bottom(2)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_5x5s2p2__avx512f_1x16_acc3);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5S2P2__AVX512F_1X16_ACC3, output_width_lt_16) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_width = 1; input_width < 31; input_width++) {
+      DWConv2DMicrokernelTester()
+        .input_width(32)
+        .input_height(2)
+        .kernel_height(5)
+        .kernel_width(5)
+        .subsampling(2)
+        .padding_left(2)
+        .padding_right(2)
+        .padding_top(2)
+        .padding_bottom(2)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_5x5s2p2__avx512f_1x16_acc3);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5S2P2__AVX512F_1X16_ACC3, output_width_gt_16) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_width = 33; input_width < 65; input_width++) {
+      DWConv2DMicrokernelTester()
+        .input_width(input_width)
+        .input_height(2)
+        .kernel_height(5)
+        .kernel_width(5)
+        .subsampling(2)
+        .padding_left(2)
+        .padding_right(2)
+        .padding_top(2)
+        .padding_bottom(2)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_5x5s2p2__avx512f_1x16_acc3);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5S2P2__AVX512F_1X16_ACC3, output_height_eq_1) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_height = 1; input_height < 3; input_height++) {
+      for (size_t input_width = 1; input_width < 161; input_width += 31) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(5)
+          .kernel_width(5)
+          .subsampling(2)
+          .padding_left(2)
+          .padding_right(2)
+          .padding_top(2)
+          .padding_bottom(2)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_5x5s2p2__avx512f_1x16_acc3);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5S2P2__AVX512F_1X16_ACC3, output_height_gt_1) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_height = 3; input_height < 5; input_height++) {
+      for (size_t input_width = 1; input_width < 161; input_width += 31) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(5)
+          .kernel_width(5)
+          .subsampling(2)
+          .padding_left(2)
+          .padding_right(2)
+          .padding_top(2)
+          .padding_bottom(2)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_5x5s2p2__avx512f_1x16_acc3);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5S2P2__AVX512F_1X16_ACC3, padding_top_eq_1) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_height = 2; input_height < 8; input_height++) {
+      for (size_t input_width = 1; input_width < 161; input_width += 31) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(5)
+          .kernel_width(5)
+          .subsampling(2)
+          .padding_left(2)
+          .padding_right(2)
+          .padding_top(1)
+          .padding_bottom(2)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_5x5s2p2__avx512f_1x16_acc3);
+      }
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F32_DWCONV2D_CHW_5X5S2P2__AVX512F_1X16_ACC4, output_width_eq_16) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_width = 31; input_width < 33; input_width++) {
+      DWConv2DMicrokernelTester()
+        .input_width(input_width)
+        .input_height(2)
+        .kernel_height(5)
+        .kernel_width(5)
+        .subsampling(2)
+        .padding_left(2)
+        .padding_right(2)
+        .padding_top(2)
+        .padding_bottom(2)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_5x5s2p2__avx512f_1x16_acc4);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5S2P2__AVX512F_1X16_ACC4, output_width_div_16) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_width = 64; input_width < 256; input_width += 32) {
+      DWConv2DMicrokernelTester()
+        .input_width(input_width)
+        .input_height(2)
+        .kernel_height(5)
+        .kernel_width(5)
+        .subsampling(2)
+        .padding_left(2)
+        .padding_right(2)
+        .padding_top(2)
+        .padding_bottom(2)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_5x5s2p2__avx512f_1x16_acc4);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5S2P2__AVX512F_1X16_ACC4, output_width_lt_16) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_width = 1; input_width < 31; input_width++) {
+      DWConv2DMicrokernelTester()
+        .input_width(32)
+        .input_height(2)
+        .kernel_height(5)
+        .kernel_width(5)
+        .subsampling(2)
+        .padding_left(2)
+        .padding_right(2)
+        .padding_top(2)
+        .padding_bottom(2)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_5x5s2p2__avx512f_1x16_acc4);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5S2P2__AVX512F_1X16_ACC4, output_width_gt_16) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_width = 33; input_width < 65; input_width++) {
+      DWConv2DMicrokernelTester()
+        .input_width(input_width)
+        .input_height(2)
+        .kernel_height(5)
+        .kernel_width(5)
+        .subsampling(2)
+        .padding_left(2)
+        .padding_right(2)
+        .padding_top(2)
+        .padding_bottom(2)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_5x5s2p2__avx512f_1x16_acc4);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5S2P2__AVX512F_1X16_ACC4, output_height_eq_1) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_height = 1; input_height < 3; input_height++) {
+      for (size_t input_width = 1; input_width < 161; input_width += 31) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(5)
+          .kernel_width(5)
+          .subsampling(2)
+          .padding_left(2)
+          .padding_right(2)
+          .padding_top(2)
+          .padding_bottom(2)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_5x5s2p2__avx512f_1x16_acc4);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5S2P2__AVX512F_1X16_ACC4, output_height_gt_1) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_height = 3; input_height < 5; input_height++) {
+      for (size_t input_width = 1; input_width < 161; input_width += 31) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(5)
+          .kernel_width(5)
+          .subsampling(2)
+          .padding_left(2)
+          .padding_right(2)
+          .padding_top(2)
+          .padding_bottom(2)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_5x5s2p2__avx512f_1x16_acc4);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5S2P2__AVX512F_1X16_ACC4, padding_top_eq_1) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_height = 2; input_height < 8; input_height++) {
+      for (size_t input_width = 1; input_width < 161; input_width += 31) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(5)
+          .kernel_width(5)
+          .subsampling(2)
+          .padding_left(2)
+          .padding_right(2)
+          .padding_top(1)
+          .padding_bottom(2)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_5x5s2p2__avx512f_1x16_acc4);
+      }
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F32_DWCONV2D_CHW_5X5S2P2__AVX512F_2X16_ACC2, output_width_eq_16) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_width = 31; input_width < 33; input_width++) {
+      DWConv2DMicrokernelTester()
+        .input_width(input_width)
+        .input_height(4)
+        .kernel_height(5)
+        .kernel_width(5)
+        .subsampling(2)
+        .padding_left(2)
+        .padding_right(2)
+        .padding_top(2)
+        .padding_bottom(2)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_5x5s2p2__avx512f_2x16_acc2);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5S2P2__AVX512F_2X16_ACC2, output_width_div_16) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_width = 64; input_width < 256; input_width += 32) {
+      DWConv2DMicrokernelTester()
+        .input_width(input_width)
+        .input_height(4)
+        .kernel_height(5)
+        .kernel_width(5)
+        .subsampling(2)
+        .padding_left(2)
+        .padding_right(2)
+        .padding_top(2)
+        .padding_bottom(2)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_5x5s2p2__avx512f_2x16_acc2);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5S2P2__AVX512F_2X16_ACC2, output_width_lt_16) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_width = 1; input_width < 31; input_width++) {
+      DWConv2DMicrokernelTester()
+        .input_width(32)
+        .input_height(4)
+        .kernel_height(5)
+        .kernel_width(5)
+        .subsampling(2)
+        .padding_left(2)
+        .padding_right(2)
+        .padding_top(2)
+        .padding_bottom(2)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_5x5s2p2__avx512f_2x16_acc2);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5S2P2__AVX512F_2X16_ACC2, output_width_gt_16) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_width = 33; input_width < 65; input_width++) {
+      DWConv2DMicrokernelTester()
+        .input_width(input_width)
+        .input_height(4)
+        .kernel_height(5)
+        .kernel_width(5)
+        .subsampling(2)
+        .padding_left(2)
+        .padding_right(2)
+        .padding_top(2)
+        .padding_bottom(2)
+        .Test(xnn_f32_dwconv2d_chw_ukernel_5x5s2p2__avx512f_2x16_acc2);
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5S2P2__AVX512F_2X16_ACC2, output_height_eq_2) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_height = 3; input_height < 5; input_height++) {
+      for (size_t input_width = 1; input_width < 161; input_width += 31) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(5)
+          .kernel_width(5)
+          .subsampling(2)
+          .padding_left(2)
+          .padding_right(2)
+          .padding_top(2)
+          .padding_bottom(2)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_5x5s2p2__avx512f_2x16_acc2);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5S2P2__AVX512F_2X16_ACC2, output_height_div_2) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_height = 8; input_height < 32; input_height += 4) {
+      for (size_t input_width = 1; input_width < 161; input_width += 31) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(5)
+          .kernel_width(5)
+          .subsampling(2)
+          .padding_left(2)
+          .padding_right(2)
+          .padding_top(2)
+          .padding_bottom(2)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_5x5s2p2__avx512f_2x16_acc2);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5S2P2__AVX512F_2X16_ACC2, output_height_lt_2) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_height = 1; input_height < 3; input_height++) {
+      for (size_t input_width = 1; input_width < 161; input_width += 31) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(5)
+          .kernel_width(5)
+          .subsampling(2)
+          .padding_left(2)
+          .padding_right(2)
+          .padding_top(2)
+          .padding_bottom(2)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_5x5s2p2__avx512f_2x16_acc2);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5S2P2__AVX512F_2X16_ACC2, output_height_gt_2) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_height = 5; input_height < 9; input_height++) {
+      for (size_t input_width = 1; input_width < 161; input_width += 31) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(5)
+          .kernel_width(5)
+          .subsampling(2)
+          .padding_left(2)
+          .padding_right(2)
+          .padding_top(2)
+          .padding_bottom(2)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_5x5s2p2__avx512f_2x16_acc2);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV2D_CHW_5X5S2P2__AVX512F_2X16_ACC2, padding_top_eq_1) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t input_height = 2; input_height < 14; input_height++) {
+      for (size_t input_width = 1; input_width < 161; input_width += 31) {
+        DWConv2DMicrokernelTester()
+          .input_width(input_width)
+          .input_height(input_height)
+          .kernel_height(5)
+          .kernel_width(5)
+          .subsampling(2)
+          .padding_left(2)
+          .padding_right(2)
+          .padding_top(1)
+          .padding_bottom(2)
+          .Test(xnn_f32_dwconv2d_chw_ukernel_5x5s2p2__avx512f_2x16_acc2);
+      }
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
 #if XNN_ARCH_WASMSIMD || XNN_ARCH_WASMRELAXEDSIMD
   TEST(F32_DWCONV2D_CHW_3X3P1__WASMSIMD_ARM_SPLAT_1X4, output_width_eq_4) {
     DWConv2DMicrokernelTester()
@@ -0,0 +1,199 @@
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <gtest/gtest.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/isa-checks.h>
+
+#include <xnnpack/rmax.h>
+#include "rdmax-microkernel-tester.h"
+
+#if XNN_ARCH_ARM || XNN_ARCH_ARM64
+  TEST(F32_RDMAX_C16__NEON, channels_eq_16) {
+    TEST_REQUIRES_ARM_NEON;
+    RDMaxMicrokernelTester()
+      .rows(1)
+      .channels(16)
+      .Test(xnn_f32_rdmax_ukernel_c16__neon);
+  }
+
+  TEST(F32_RDMAX_C16__NEON, channels_div_16) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t channels = 32; channels < 128; channels += 16) {
+      RDMaxMicrokernelTester()
+        .rows(3)
+        .channels(channels)
+        .Test(xnn_f32_rdmax_ukernel_c16__neon);
+    }
+  }
+
+  TEST(F32_RDMAX_C16__NEON, channels_lt_16) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t channels = 1; channels < 16; channels++) {
+      RDMaxMicrokernelTester()
+        .rows(3)
+        .channels(channels)
+        .Test(xnn_f32_rdmax_ukernel_c16__neon);
+    }
+  }
+
+  TEST(F32_RDMAX_C16__NEON, channels_gt_16) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t channels = 17; channels < 32; channels++) {
+      RDMaxMicrokernelTester()
+        .rows(3)
+        .channels(channels)
+        .Test(xnn_f32_rdmax_ukernel_c16__neon);
+    }
+  }
+
+  TEST(F32_RDMAX_C16__NEON, rows_gt_1) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t rows = 2; rows < 16; rows++) {
+      for (size_t channels = 1; channels <= 80; channels += 15) {
+        RDMaxMicrokernelTester()
+          .rows(rows)
+          .channels(channels)
+          .Test(xnn_f32_rdmax_ukernel_c16__neon);
+      }
+    }
+  }
+
+  TEST(F32_RDMAX_C16__NEON, input_stride) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t rows = 1; rows < 8; rows++) {
+      for (size_t channels = 1; channels <= 80; channels += 15) {
+        RDMaxMicrokernelTester()
+          .rows(rows)
+          .channels(channels)
+          .input_stride(83)
+          .Test(xnn_f32_rdmax_ukernel_c16__neon);
+      }
+    }
+  }
+#endif  // XNN_ARCH_ARM || XNN_ARCH_ARM64
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F32_RDMAX_C16__SSE, channels_eq_16) {
+    TEST_REQUIRES_X86_SSE;
+    RDMaxMicrokernelTester()
+      .rows(1)
+      .channels(16)
+      .Test(xnn_f32_rdmax_ukernel_c16__sse);
+  }
+
+  TEST(F32_RDMAX_C16__SSE, channels_div_16) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t channels = 32; channels < 128; channels += 16) {
+      RDMaxMicrokernelTester()
+        .rows(3)
+        .channels(channels)
+        .Test(xnn_f32_rdmax_ukernel_c16__sse);
+    }
+  }
+
+  TEST(F32_RDMAX_C16__SSE, channels_lt_16) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t channels = 1; channels < 16; channels++) {
+      RDMaxMicrokernelTester()
+        .rows(3)
+        .channels(channels)
+        .Test(xnn_f32_rdmax_ukernel_c16__sse);
+    }
+  }
+
+  TEST(F32_RDMAX_C16__SSE, channels_gt_16) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t channels = 17; channels < 32; channels++) {
+      RDMaxMicrokernelTester()
+        .rows(3)
+        .channels(channels)
+        .Test(xnn_f32_rdmax_ukernel_c16__sse);
+    }
+  }
+
+  TEST(F32_RDMAX_C16__SSE, rows_gt_1) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t rows = 2; rows < 16; rows++) {
+      for (size_t channels = 1; channels <= 80; channels += 15) {
+        RDMaxMicrokernelTester()
+          .rows(rows)
+          .channels(channels)
+          .Test(xnn_f32_rdmax_ukernel_c16__sse);
+      }
+    }
+  }
+
+  TEST(F32_RDMAX_C16__SSE, input_stride) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t rows = 1; rows < 8; rows++) {
+      for (size_t channels = 1; channels <= 80; channels += 15) {
+        RDMaxMicrokernelTester()
+          .rows(rows)
+          .channels(channels)
+          .input_stride(83)
+          .Test(xnn_f32_rdmax_ukernel_c16__sse);
+      }
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+TEST(F32_RDMAX_C4__SCALAR, channels_eq_4) {
+  RDMaxMicrokernelTester()
+    .rows(1)
+    .channels(4)
+    .Test(xnn_f32_rdmax_ukernel_c4__scalar);
+}
+
+TEST(F32_RDMAX_C4__SCALAR, channels_div_4) {
+  for (size_t channels = 8; channels < 32; channels += 4) {
+    RDMaxMicrokernelTester()
+      .rows(3)
+      .channels(channels)
+      .Test(xnn_f32_rdmax_ukernel_c4__scalar);
+  }
+}
+
+TEST(F32_RDMAX_C4__SCALAR, channels_lt_4) {
+  for (size_t channels = 1; channels < 4; channels++) {
+    RDMaxMicrokernelTester()
+      .rows(3)
+      .channels(channels)
+      .Test(xnn_f32_rdmax_ukernel_c4__scalar);
+  }
+}
+
+TEST(F32_RDMAX_C4__SCALAR, channels_gt_4) {
+  for (size_t channels = 5; channels < 8; channels++) {
+    RDMaxMicrokernelTester()
+      .rows(3)
+      .channels(channels)
+      .Test(xnn_f32_rdmax_ukernel_c4__scalar);
+  }
+}
+
+TEST(F32_RDMAX_C4__SCALAR, rows_gt_1) {
+  for (size_t rows = 2; rows < 16; rows++) {
+    for (size_t channels = 1; channels <= 20; channels += 3) {
+      RDMaxMicrokernelTester()
+        .rows(rows)
+        .channels(channels)
+        .Test(xnn_f32_rdmax_ukernel_c4__scalar);
+    }
+  }
+}
+
+TEST(F32_RDMAX_C4__SCALAR, input_stride) {
+  for (size_t rows = 1; rows < 8; rows++) {
+    for (size_t channels = 1; channels <= 20; channels += 3) {
+      RDMaxMicrokernelTester()
+        .rows(rows)
+        .channels(channels)
+        .input_stride(23)
+        .Test(xnn_f32_rdmax_ukernel_c4__scalar);
+    }
+  }
+}
@@ -0,0 +1,1061 @@
+// Copyright 2019 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+//
+// Auto-generated file. Do not edit!
+//   Specification: test/f32-vgelu.yaml
+//   Generator: tools/generate-vunary-test.py
+
+
+#include <gtest/gtest.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/isa-checks.h>
+
+#include <xnnpack/vunary.h>
+#include "vunary-microkernel-tester.h"
+
+
+#if XNN_ARCH_ARM64
+  TEST(F32_VGELU__NEONFMA_RATIONAL_13_8_DIV_X4, batch_eq_4) {
+    TEST_REQUIRES_ARM_NEON_FMA;
+    VUnaryMicrokernelTester()
+      .batch_size(4)
+      .Test(xnn_f32_vgelu_ukernel__neonfma_rational_13_8_div_x4, xnn_init_f32_gelu_neon_rational_13_8_params);
+  }
+
+  TEST(F32_VGELU__NEONFMA_RATIONAL_13_8_DIV_X4, batch_div_4) {
+    TEST_REQUIRES_ARM_NEON_FMA;
+    for (size_t batch_size = 8; batch_size < 40; batch_size += 4) {
+      VUnaryMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_vgelu_ukernel__neonfma_rational_13_8_div_x4, xnn_init_f32_gelu_neon_rational_13_8_params);
+    }
+  }
+
+  TEST(F32_VGELU__NEONFMA_RATIONAL_13_8_DIV_X4, batch_lt_4) {
+    TEST_REQUIRES_ARM_NEON_FMA;
+    for (size_t batch_size = 1; batch_size < 4; batch_size++) {
+      VUnaryMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_vgelu_ukernel__neonfma_rational_13_8_div_x4, xnn_init_f32_gelu_neon_rational_13_8_params);
+    }
+  }
+
+  TEST(F32_VGELU__NEONFMA_RATIONAL_13_8_DIV_X4, batch_gt_4) {
+    TEST_REQUIRES_ARM_NEON_FMA;
+    for (size_t batch_size = 5; batch_size < 8; batch_size++) {
+      VUnaryMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_vgelu_ukernel__neonfma_rational_13_8_div_x4, xnn_init_f32_gelu_neon_rational_13_8_params);
+    }
+  }
+
+  TEST(F32_VGELU__NEONFMA_RATIONAL_13_8_DIV_X4, inplace) {
+    TEST_REQUIRES_ARM_NEON_FMA;
+    for (size_t batch_size = 1; batch_size <= 20; batch_size += 3) {
+      VUnaryMicrokernelTester()
+        .batch_size(batch_size)
+        .inplace(true)
+        .Test(xnn_f32_vgelu_ukernel__neonfma_rational_13_8_div_x4, xnn_init_f32_gelu_neon_rational_13_8_params);
+    }
+  }
+#endif  // XNN_ARCH_ARM64
+
+
+#if XNN_ARCH_ARM64
+  TEST(F32_VGELU__NEONFMA_RATIONAL_13_8_DIV_X8, batch_eq_8) {
+    TEST_REQUIRES_ARM_NEON_FMA;
+    VUnaryMicrokernelTester()
+      .batch_size(8)
+      .Test(xnn_f32_vgelu_ukernel__neonfma_rational_13_8_div_x8, xnn_init_f32_gelu_neon_rational_13_8_params);
+  }
+
+  TEST(F32_VGELU__NEONFMA_RATIONAL_13_8_DIV_X8, batch_div_8) {
+    TEST_REQUIRES_ARM_NEON_FMA;
+    for (size_t batch_size = 16; batch_size < 80; batch_size += 8) {
+      VUnaryMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_vgelu_ukernel__neonfma_rational_13_8_div_x8, xnn_init_f32_gelu_neon_rational_13_8_params);
+    }
+  }
+
+  TEST(F32_VGELU__NEONFMA_RATIONAL_13_8_DIV_X8, batch_lt_8) {
+    TEST_REQUIRES_ARM_NEON_FMA;
+    for (size_t batch_size = 1; batch_size < 8; batch_size++) {
+      VUnaryMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_vgelu_ukernel__neonfma_rational_13_8_div_x8, xnn_init_f32_gelu_neon_rational_13_8_params);
+    }
+  }
+
+  TEST(F32_VGELU__NEONFMA_RATIONAL_13_8_DIV_X8, batch_gt_8) {
+    TEST_REQUIRES_ARM_NEON_FMA;
+    for (size_t batch_size = 9; batch_size < 16; batch_size++) {
+      VUnaryMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_vgelu_ukernel__neonfma_rational_13_8_div_x8, xnn_init_f32_gelu_neon_rational_13_8_params);
+    }
+  }
+
+  TEST(F32_VGELU__NEONFMA_RATIONAL_13_8_DIV_X8, inplace) {
+    TEST_REQUIRES_ARM_NEON_FMA;
+    for (size_t batch_size = 1; batch_size <= 40; batch_size += 7) {
+      VUnaryMicrokernelTester()
+        .batch_size(batch_size)
+        .inplace(true)
+        .Test(xnn_f32_vgelu_ukernel__neonfma_rational_13_8_div_x8, xnn_init_f32_gelu_neon_rational_13_8_params);
+    }
+  }
+#endif  // XNN_ARCH_ARM64
+
+
+#if XNN_ARCH_ARM64
+  TEST(F32_VGELU__NEONFMA_RATIONAL_13_8_DIV_X12, batch_eq_12) {
+    TEST_REQUIRES_ARM_NEON_FMA;
+    VUnaryMicrokernelTester()
+      .batch_size(12)
+      .Test(xnn_f32_vgelu_ukernel__neonfma_rational_13_8_div_x12, xnn_init_f32_gelu_neon_rational_13_8_params);
+  }
+
+  TEST(F32_VGELU__NEONFMA_RATIONAL_13_8_DIV_X12, batch_div_12) {
+    TEST_REQUIRES_ARM_NEON_FMA;
+    for (size_t batch_size = 24; batch_size < 120; batch_size += 12) {
+      VUnaryMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_vgelu_ukernel__neonfma_rational_13_8_div_x12, xnn_init_f32_gelu_neon_rational_13_8_params);
+    }
+  }
+
+  TEST(F32_VGELU__NEONFMA_RATIONAL_13_8_DIV_X12, batch_lt_12) {
+    TEST_REQUIRES_ARM_NEON_FMA;
+    for (size_t batch_size = 1; batch_size < 12; batch_size++) {
+      VUnaryMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_vgelu_ukernel__neonfma_rational_13_8_div_x12, xnn_init_f32_gelu_neon_rational_13_8_params);
+    }
+  }
+
+  TEST(F32_VGELU__NEONFMA_RATIONAL_13_8_DIV_X12, batch_gt_12) {
+    TEST_REQUIRES_ARM_NEON_FMA;
+    for (size_t batch_size = 13; batch_size < 24; batch_size++) {
+      VUnaryMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_vgelu_ukernel__neonfma_rational_13_8_div_x12, xnn_init_f32_gelu_neon_rational_13_8_params);
+    }
+  }
+
+  TEST(F32_VGELU__NEONFMA_RATIONAL_13_8_DIV_X12, inplace) {
+    TEST_REQUIRES_ARM_NEON_FMA;
+    for (size_t batch_size = 1; batch_size <= 60; batch_size += 11) {
+      VUnaryMicrokernelTester()
+        .batch_size(batch_size)
+        .inplace(true)
+        .Test(xnn_f32_vgelu_ukernel__neonfma_rational_13_8_div_x12, xnn_init_f32_gelu_neon_rational_13_8_params);
+    }
+  }
+#endif  // XNN_ARCH_ARM64
+
+
+#if XNN_ARCH_ARM64
+  TEST(F32_VGELU__NEONFMA_RATIONAL_13_8_DIV_X16, batch_eq_16) {
+    TEST_REQUIRES_ARM_NEON_FMA;
+    VUnaryMicrokernelTester()
+      .batch_size(16)
+      .Test(xnn_f32_vgelu_ukernel__neonfma_rational_13_8_div_x16, xnn_init_f32_gelu_neon_rational_13_8_params);
+  }
+
+  TEST(F32_VGELU__NEONFMA_RATIONAL_13_8_DIV_X16, batch_div_16) {
+    TEST_REQUIRES_ARM_NEON_FMA;
+    for (size_t batch_size = 32; batch_size < 160; batch_size += 16) {
+      VUnaryMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_vgelu_ukernel__neonfma_rational_13_8_div_x16, xnn_init_f32_gelu_neon_rational_13_8_params);
+    }
+  }
+
+  TEST(F32_VGELU__NEONFMA_RATIONAL_13_8_DIV_X16, batch_lt_16) {
+    TEST_REQUIRES_ARM_NEON_FMA;
+    for (size_t batch_size = 1; batch_size < 16; batch_size++) {
+      VUnaryMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_vgelu_ukernel__neonfma_rational_13_8_div_x16, xnn_init_f32_gelu_neon_rational_13_8_params);
+    }
+  }
+
+  TEST(F32_VGELU__NEONFMA_RATIONAL_13_8_DIV_X16, batch_gt_16) {
+    TEST_REQUIRES_ARM_NEON_FMA;
+    for (size_t batch_size = 17; batch_size < 32; batch_size++) {
+      VUnaryMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_vgelu_ukernel__neonfma_rational_13_8_div_x16, xnn_init_f32_gelu_neon_rational_13_8_params);
+    }
+  }
+
+  TEST(F32_VGELU__NEONFMA_RATIONAL_13_8_DIV_X16, inplace) {
+    TEST_REQUIRES_ARM_NEON_FMA;
+    for (size_t batch_size = 1; batch_size <= 80; batch_size += 15) {
+      VUnaryMicrokernelTester()
+        .batch_size(batch_size)
+        .inplace(true)
+        .Test(xnn_f32_vgelu_ukernel__neonfma_rational_13_8_div_x16, xnn_init_f32_gelu_neon_rational_13_8_params);
+    }
+  }
+#endif  // XNN_ARCH_ARM64
+
+
+#if XNN_ARCH_ARM || XNN_ARCH_ARM64
+  TEST(F32_VGELU__NEON_RATIONAL_13_8_NR2RECPS_X4, batch_eq_4) {
+    TEST_REQUIRES_ARM_NEON;
+    VUnaryMicrokernelTester()
+      .batch_size(4)
+      .Test(xnn_f32_vgelu_ukernel__neon_rational_13_8_nr2recps_x4, xnn_init_f32_gelu_neon_rational_13_8_params);
+  }
+
+  TEST(F32_VGELU__NEON_RATIONAL_13_8_NR2RECPS_X4, batch_div_4) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t batch_size = 8; batch_size < 40; batch_size += 4) {
+      VUnaryMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_vgelu_ukernel__neon_rational_13_8_nr2recps_x4, xnn_init_f32_gelu_neon_rational_13_8_params);
+    }
+  }
+
+  TEST(F32_VGELU__NEON_RATIONAL_13_8_NR2RECPS_X4, batch_lt_4) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t batch_size = 1; batch_size < 4; batch_size++) {
+      VUnaryMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_vgelu_ukernel__neon_rational_13_8_nr2recps_x4, xnn_init_f32_gelu_neon_rational_13_8_params);
+    }
+  }
+
+  TEST(F32_VGELU__NEON_RATIONAL_13_8_NR2RECPS_X4, batch_gt_4) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t batch_size = 5; batch_size < 8; batch_size++) {
+      VUnaryMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_vgelu_ukernel__neon_rational_13_8_nr2recps_x4, xnn_init_f32_gelu_neon_rational_13_8_params);
+    }
+  }
+
+  TEST(F32_VGELU__NEON_RATIONAL_13_8_NR2RECPS_X4, inplace) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t batch_size = 1; batch_size <= 20; batch_size += 3) {
+      VUnaryMicrokernelTester()
+        .batch_size(batch_size)
+        .inplace(true)
+        .Test(xnn_f32_vgelu_ukernel__neon_rational_13_8_nr2recps_x4, xnn_init_f32_gelu_neon_rational_13_8_params);
+    }
+  }
+#endif  // XNN_ARCH_ARM || XNN_ARCH_ARM64
+
+
+#if XNN_ARCH_ARM || XNN_ARCH_ARM64
+  TEST(F32_VGELU__NEON_RATIONAL_13_8_NR2RECPS_X8, batch_eq_8) {
+    TEST_REQUIRES_ARM_NEON;
+    VUnaryMicrokernelTester()
+      .batch_size(8)
+      .Test(xnn_f32_vgelu_ukernel__neon_rational_13_8_nr2recps_x8, xnn_init_f32_gelu_neon_rational_13_8_params);
+  }
+
+  TEST(F32_VGELU__NEON_RATIONAL_13_8_NR2RECPS_X8, batch_div_8) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t batch_size = 16; batch_size < 80; batch_size += 8) {
+      VUnaryMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_vgelu_ukernel__neon_rational_13_8_nr2recps_x8, xnn_init_f32_gelu_neon_rational_13_8_params);
+    }
+  }
+
+  TEST(F32_VGELU__NEON_RATIONAL_13_8_NR2RECPS_X8, batch_lt_8) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t batch_size = 1; batch_size < 8; batch_size++) {
+      VUnaryMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_vgelu_ukernel__neon_rational_13_8_nr2recps_x8, xnn_init_f32_gelu_neon_rational_13_8_params);
+    }
+  }
+
+  TEST(F32_VGELU__NEON_RATIONAL_13_8_NR2RECPS_X8, batch_gt_8) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t batch_size = 9; batch_size < 16; batch_size++) {
+      VUnaryMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_vgelu_ukernel__neon_rational_13_8_nr2recps_x8, xnn_init_f32_gelu_neon_rational_13_8_params);
+    }
+  }
+
+  TEST(F32_VGELU__NEON_RATIONAL_13_8_NR2RECPS_X8, inplace) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t batch_size = 1; batch_size <= 40; batch_size += 7) {
+      VUnaryMicrokernelTester()
+        .batch_size(batch_size)
+        .inplace(true)
+        .Test(xnn_f32_vgelu_ukernel__neon_rational_13_8_nr2recps_x8, xnn_init_f32_gelu_neon_rational_13_8_params);
+    }
+  }
+#endif  // XNN_ARCH_ARM || XNN_ARCH_ARM64
+
+
+#if XNN_ARCH_ARM || XNN_ARCH_ARM64
+  TEST(F32_VGELU__NEON_RATIONAL_13_8_NR2RECPS_X12, batch_eq_12) {
+    TEST_REQUIRES_ARM_NEON;
+    VUnaryMicrokernelTester()
+      .batch_size(12)
+      .Test(xnn_f32_vgelu_ukernel__neon_rational_13_8_nr2recps_x12, xnn_init_f32_gelu_neon_rational_13_8_params);
+  }
+
+  TEST(F32_VGELU__NEON_RATIONAL_13_8_NR2RECPS_X12, batch_div_12) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t batch_size = 24; batch_size < 120; batch_size += 12) {
+      VUnaryMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_vgelu_ukernel__neon_rational_13_8_nr2recps_x12, xnn_init_f32_gelu_neon_rational_13_8_params);
+    }
+  }
+
+  TEST(F32_VGELU__NEON_RATIONAL_13_8_NR2RECPS_X12, batch_lt_12) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t batch_size = 1; batch_size < 12; batch_size++) {
+      VUnaryMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_vgelu_ukernel__neon_rational_13_8_nr2recps_x12, xnn_init_f32_gelu_neon_rational_13_8_params);
+    }
+  }
+
+  TEST(F32_VGELU__NEON_RATIONAL_13_8_NR2RECPS_X12, batch_gt_12) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t batch_size = 13; batch_size < 24; batch_size++) {
+      VUnaryMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_vgelu_ukernel__neon_rational_13_8_nr2recps_x12, xnn_init_f32_gelu_neon_rational_13_8_params);
+    }
+  }
+
+  TEST(F32_VGELU__NEON_RATIONAL_13_8_NR2RECPS_X12, inplace) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t batch_size = 1; batch_size <= 60; batch_size += 11) {
+      VUnaryMicrokernelTester()
+        .batch_size(batch_size)
+        .inplace(true)
+        .Test(xnn_f32_vgelu_ukernel__neon_rational_13_8_nr2recps_x12, xnn_init_f32_gelu_neon_rational_13_8_params);
+    }
+  }
+#endif  // XNN_ARCH_ARM || XNN_ARCH_ARM64
+
+
+#if XNN_ARCH_ARM || XNN_ARCH_ARM64
+  TEST(F32_VGELU__NEON_RATIONAL_13_8_NR2RECPS_X16, batch_eq_16) {
+    TEST_REQUIRES_ARM_NEON;
+    VUnaryMicrokernelTester()
+      .batch_size(16)
+      .Test(xnn_f32_vgelu_ukernel__neon_rational_13_8_nr2recps_x16, xnn_init_f32_gelu_neon_rational_13_8_params);
+  }
+
+  TEST(F32_VGELU__NEON_RATIONAL_13_8_NR2RECPS_X16, batch_div_16) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t batch_size = 32; batch_size < 160; batch_size += 16) {
+      VUnaryMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_vgelu_ukernel__neon_rational_13_8_nr2recps_x16, xnn_init_f32_gelu_neon_rational_13_8_params);
+    }
+  }
+
+  TEST(F32_VGELU__NEON_RATIONAL_13_8_NR2RECPS_X16, batch_lt_16) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t batch_size = 1; batch_size < 16; batch_size++) {
+      VUnaryMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_vgelu_ukernel__neon_rational_13_8_nr2recps_x16, xnn_init_f32_gelu_neon_rational_13_8_params);
+    }
+  }
+
+  TEST(F32_VGELU__NEON_RATIONAL_13_8_NR2RECPS_X16, batch_gt_16) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t batch_size = 17; batch_size < 32; batch_size++) {
+      VUnaryMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_vgelu_ukernel__neon_rational_13_8_nr2recps_x16, xnn_init_f32_gelu_neon_rational_13_8_params);
+    }
+  }
+
+  TEST(F32_VGELU__NEON_RATIONAL_13_8_NR2RECPS_X16, inplace) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t batch_size = 1; batch_size <= 80; batch_size += 15) {
+      VUnaryMicrokernelTester()
+        .batch_size(batch_size)
+        .inplace(true)
+        .Test(xnn_f32_vgelu_ukernel__neon_rational_13_8_nr2recps_x16, xnn_init_f32_gelu_neon_rational_13_8_params);
+    }
+  }
+#endif  // XNN_ARCH_ARM || XNN_ARCH_ARM64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F32_VGELU__SSE2_RATIONAL_13_8_DIV_X4, batch_eq_4) {
+    TEST_REQUIRES_X86_SSE2;
+    VUnaryMicrokernelTester()
+      .batch_size(4)
+      .Test(xnn_f32_vgelu_ukernel__sse2_rational_13_8_div_x4, xnn_init_f32_gelu_sse_rational_13_8_params);
+  }
+
+  TEST(F32_VGELU__SSE2_RATIONAL_13_8_DIV_X4, batch_div_4) {
+    TEST_REQUIRES_X86_SSE2;
+    for (size_t batch_size = 8; batch_size < 40; batch_size += 4) {
+      VUnaryMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_vgelu_ukernel__sse2_rational_13_8_div_x4, xnn_init_f32_gelu_sse_rational_13_8_params);
+    }
+  }
+
+  TEST(F32_VGELU__SSE2_RATIONAL_13_8_DIV_X4, batch_lt_4) {
+    TEST_REQUIRES_X86_SSE2;
+    for (size_t batch_size = 1; batch_size < 4; batch_size++) {
+      VUnaryMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_vgelu_ukernel__sse2_rational_13_8_div_x4, xnn_init_f32_gelu_sse_rational_13_8_params);
+    }
+  }
+
+  TEST(F32_VGELU__SSE2_RATIONAL_13_8_DIV_X4, batch_gt_4) {
+    TEST_REQUIRES_X86_SSE2;
+    for (size_t batch_size = 5; batch_size < 8; batch_size++) {
+      VUnaryMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_vgelu_ukernel__sse2_rational_13_8_div_x4, xnn_init_f32_gelu_sse_rational_13_8_params);
+    }
+  }
+
+  TEST(F32_VGELU__SSE2_RATIONAL_13_8_DIV_X4, inplace) {
+    TEST_REQUIRES_X86_SSE2;
+    for (size_t batch_size = 1; batch_size <= 20; batch_size += 3) {
+      VUnaryMicrokernelTester()
+        .batch_size(batch_size)
+        .inplace(true)
+        .Test(xnn_f32_vgelu_ukernel__sse2_rational_13_8_div_x4, xnn_init_f32_gelu_sse_rational_13_8_params);
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F32_VGELU__SSE2_RATIONAL_13_8_DIV_X8, batch_eq_8) {
+    TEST_REQUIRES_X86_SSE2;
+    VUnaryMicrokernelTester()
+      .batch_size(8)
+      .Test(xnn_f32_vgelu_ukernel__sse2_rational_13_8_div_x8, xnn_init_f32_gelu_sse_rational_13_8_params);
+  }
+
+  TEST(F32_VGELU__SSE2_RATIONAL_13_8_DIV_X8, batch_div_8) {
+    TEST_REQUIRES_X86_SSE2;
+    for (size_t batch_size = 16; batch_size < 80; batch_size += 8) {
+      VUnaryMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_vgelu_ukernel__sse2_rational_13_8_div_x8, xnn_init_f32_gelu_sse_rational_13_8_params);
+    }
+  }
+
+  TEST(F32_VGELU__SSE2_RATIONAL_13_8_DIV_X8, batch_lt_8) {
+    TEST_REQUIRES_X86_SSE2;
+    for (size_t batch_size = 1; batch_size < 8; batch_size++) {
+      VUnaryMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_vgelu_ukernel__sse2_rational_13_8_div_x8, xnn_init_f32_gelu_sse_rational_13_8_params);
+    }
+  }
+
+  TEST(F32_VGELU__SSE2_RATIONAL_13_8_DIV_X8, batch_gt_8) {
+    TEST_REQUIRES_X86_SSE2;
+    for (size_t batch_size = 9; batch_size < 16; batch_size++) {
+      VUnaryMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_vgelu_ukernel__sse2_rational_13_8_div_x8, xnn_init_f32_gelu_sse_rational_13_8_params);
+    }
+  }
+
+  TEST(F32_VGELU__SSE2_RATIONAL_13_8_DIV_X8, inplace) {
+    TEST_REQUIRES_X86_SSE2;
+    for (size_t batch_size = 1; batch_size <= 40; batch_size += 7) {
+      VUnaryMicrokernelTester()
+        .batch_size(batch_size)
+        .inplace(true)
+        .Test(xnn_f32_vgelu_ukernel__sse2_rational_13_8_div_x8, xnn_init_f32_gelu_sse_rational_13_8_params);
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F32_VGELU__SSE2_RATIONAL_13_8_DIV_X12, batch_eq_12) {
+    TEST_REQUIRES_X86_SSE2;
+    VUnaryMicrokernelTester()
+      .batch_size(12)
+      .Test(xnn_f32_vgelu_ukernel__sse2_rational_13_8_div_x12, xnn_init_f32_gelu_sse_rational_13_8_params);
+  }
+
+  TEST(F32_VGELU__SSE2_RATIONAL_13_8_DIV_X12, batch_div_12) {
+    TEST_REQUIRES_X86_SSE2;
+    for (size_t batch_size = 24; batch_size < 120; batch_size += 12) {
+      VUnaryMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_vgelu_ukernel__sse2_rational_13_8_div_x12, xnn_init_f32_gelu_sse_rational_13_8_params);
+    }
+  }
+
+  TEST(F32_VGELU__SSE2_RATIONAL_13_8_DIV_X12, batch_lt_12) {
+    TEST_REQUIRES_X86_SSE2;
+    for (size_t batch_size = 1; batch_size < 12; batch_size++) {
+      VUnaryMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_vgelu_ukernel__sse2_rational_13_8_div_x12, xnn_init_f32_gelu_sse_rational_13_8_params);
+    }
+  }
+
+  TEST(F32_VGELU__SSE2_RATIONAL_13_8_DIV_X12, batch_gt_12) {
+    TEST_REQUIRES_X86_SSE2;
+    for (size_t batch_size = 13; batch_size < 24; batch_size++) {
+      VUnaryMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_vgelu_ukernel__sse2_rational_13_8_div_x12, xnn_init_f32_gelu_sse_rational_13_8_params);
+    }
+  }
+
+  TEST(F32_VGELU__SSE2_RATIONAL_13_8_DIV_X12, inplace) {
+    TEST_REQUIRES_X86_SSE2;
+    for (size_t batch_size = 1; batch_size <= 60; batch_size += 11) {
+      VUnaryMicrokernelTester()
+        .batch_size(batch_size)
+        .inplace(true)
+        .Test(xnn_f32_vgelu_ukernel__sse2_rational_13_8_div_x12, xnn_init_f32_gelu_sse_rational_13_8_params);
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F32_VGELU__SSE2_RATIONAL_13_8_DIV_X16, batch_eq_16) {
+    TEST_REQUIRES_X86_SSE2;
+    VUnaryMicrokernelTester()
+      .batch_size(16)
+      .Test(xnn_f32_vgelu_ukernel__sse2_rational_13_8_div_x16, xnn_init_f32_gelu_sse_rational_13_8_params);
+  }
+
+  TEST(F32_VGELU__SSE2_RATIONAL_13_8_DIV_X16, batch_div_16) {
+    TEST_REQUIRES_X86_SSE2;
+    for (size_t batch_size = 32; batch_size < 160; batch_size += 16) {
+      VUnaryMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_vgelu_ukernel__sse2_rational_13_8_div_x16, xnn_init_f32_gelu_sse_rational_13_8_params);
+    }
+  }
+
+  TEST(F32_VGELU__SSE2_RATIONAL_13_8_DIV_X16, batch_lt_16) {
+    TEST_REQUIRES_X86_SSE2;
+    for (size_t batch_size = 1; batch_size < 16; batch_size++) {
+      VUnaryMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_vgelu_ukernel__sse2_rational_13_8_div_x16, xnn_init_f32_gelu_sse_rational_13_8_params);
+    }
+  }
+
+  TEST(F32_VGELU__SSE2_RATIONAL_13_8_DIV_X16, batch_gt_16) {
+    TEST_REQUIRES_X86_SSE2;
+    for (size_t batch_size = 17; batch_size < 32; batch_size++) {
+      VUnaryMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_vgelu_ukernel__sse2_rational_13_8_div_x16, xnn_init_f32_gelu_sse_rational_13_8_params);
+    }
+  }
+
+  TEST(F32_VGELU__SSE2_RATIONAL_13_8_DIV_X16, inplace) {
+    TEST_REQUIRES_X86_SSE2;
+    for (size_t batch_size = 1; batch_size <= 80; batch_size += 15) {
+      VUnaryMicrokernelTester()
+        .batch_size(batch_size)
+        .inplace(true)
+        .Test(xnn_f32_vgelu_ukernel__sse2_rational_13_8_div_x16, xnn_init_f32_gelu_sse_rational_13_8_params);
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F32_VGELU__AVX2_RATIONAL_13_8_DIV_X8, batch_eq_8) {
+    TEST_REQUIRES_X86_AVX2;
+    VUnaryMicrokernelTester()
+      .batch_size(8)
+      .Test(xnn_f32_vgelu_ukernel__avx2_rational_13_8_div_x8, xnn_init_f32_gelu_avx_rational_13_8_params);
+  }
+
+  TEST(F32_VGELU__AVX2_RATIONAL_13_8_DIV_X8, batch_div_8) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t batch_size = 16; batch_size < 80; batch_size += 8) {
+      VUnaryMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_vgelu_ukernel__avx2_rational_13_8_div_x8, xnn_init_f32_gelu_avx_rational_13_8_params);
+    }
+  }
+
+  TEST(F32_VGELU__AVX2_RATIONAL_13_8_DIV_X8, batch_lt_8) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t batch_size = 1; batch_size < 8; batch_size++) {
+      VUnaryMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_vgelu_ukernel__avx2_rational_13_8_div_x8, xnn_init_f32_gelu_avx_rational_13_8_params);
+    }
+  }
+
+  TEST(F32_VGELU__AVX2_RATIONAL_13_8_DIV_X8, batch_gt_8) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t batch_size = 9; batch_size < 16; batch_size++) {
+      VUnaryMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_vgelu_ukernel__avx2_rational_13_8_div_x8, xnn_init_f32_gelu_avx_rational_13_8_params);
+    }
+  }
+
+  TEST(F32_VGELU__AVX2_RATIONAL_13_8_DIV_X8, inplace) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t batch_size = 1; batch_size <= 40; batch_size += 7) {
+      VUnaryMicrokernelTester()
+        .batch_size(batch_size)
+        .inplace(true)
+        .Test(xnn_f32_vgelu_ukernel__avx2_rational_13_8_div_x8, xnn_init_f32_gelu_avx_rational_13_8_params);
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F32_VGELU__AVX2_RATIONAL_13_8_DIV_X16, batch_eq_16) {
+    TEST_REQUIRES_X86_AVX2;
+    VUnaryMicrokernelTester()
+      .batch_size(16)
+      .Test(xnn_f32_vgelu_ukernel__avx2_rational_13_8_div_x16, xnn_init_f32_gelu_avx_rational_13_8_params);
+  }
+
+  TEST(F32_VGELU__AVX2_RATIONAL_13_8_DIV_X16, batch_div_16) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t batch_size = 32; batch_size < 160; batch_size += 16) {
+      VUnaryMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_vgelu_ukernel__avx2_rational_13_8_div_x16, xnn_init_f32_gelu_avx_rational_13_8_params);
+    }
+  }
+
+  TEST(F32_VGELU__AVX2_RATIONAL_13_8_DIV_X16, batch_lt_16) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t batch_size = 1; batch_size < 16; batch_size++) {
+      VUnaryMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_vgelu_ukernel__avx2_rational_13_8_div_x16, xnn_init_f32_gelu_avx_rational_13_8_params);
+    }
+  }
+
+  TEST(F32_VGELU__AVX2_RATIONAL_13_8_DIV_X16, batch_gt_16) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t batch_size = 17; batch_size < 32; batch_size++) {
+      VUnaryMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_vgelu_ukernel__avx2_rational_13_8_div_x16, xnn_init_f32_gelu_avx_rational_13_8_params);
+    }
+  }
+
+  TEST(F32_VGELU__AVX2_RATIONAL_13_8_DIV_X16, inplace) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t batch_size = 1; batch_size <= 80; batch_size += 15) {
+      VUnaryMicrokernelTester()
+        .batch_size(batch_size)
+        .inplace(true)
+        .Test(xnn_f32_vgelu_ukernel__avx2_rational_13_8_div_x16, xnn_init_f32_gelu_avx_rational_13_8_params);
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F32_VGELU__AVX2_RATIONAL_13_8_DIV_X24, batch_eq_24) {
+    TEST_REQUIRES_X86_AVX2;
+    VUnaryMicrokernelTester()
+      .batch_size(24)
+      .Test(xnn_f32_vgelu_ukernel__avx2_rational_13_8_div_x24, xnn_init_f32_gelu_avx_rational_13_8_params);
+  }
+
+  TEST(F32_VGELU__AVX2_RATIONAL_13_8_DIV_X24, batch_div_24) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t batch_size = 48; batch_size < 240; batch_size += 24) {
+      VUnaryMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_vgelu_ukernel__avx2_rational_13_8_div_x24, xnn_init_f32_gelu_avx_rational_13_8_params);
+    }
+  }
+
+  TEST(F32_VGELU__AVX2_RATIONAL_13_8_DIV_X24, batch_lt_24) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t batch_size = 1; batch_size < 24; batch_size++) {
+      VUnaryMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_vgelu_ukernel__avx2_rational_13_8_div_x24, xnn_init_f32_gelu_avx_rational_13_8_params);
+    }
+  }
+
+  TEST(F32_VGELU__AVX2_RATIONAL_13_8_DIV_X24, batch_gt_24) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t batch_size = 25; batch_size < 48; batch_size++) {
+      VUnaryMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_vgelu_ukernel__avx2_rational_13_8_div_x24, xnn_init_f32_gelu_avx_rational_13_8_params);
+    }
+  }
+
+  TEST(F32_VGELU__AVX2_RATIONAL_13_8_DIV_X24, inplace) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t batch_size = 1; batch_size <= 120; batch_size += 23) {
+      VUnaryMicrokernelTester()
+        .batch_size(batch_size)
+        .inplace(true)
+        .Test(xnn_f32_vgelu_ukernel__avx2_rational_13_8_div_x24, xnn_init_f32_gelu_avx_rational_13_8_params);
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F32_VGELU__AVX2_RATIONAL_13_8_DIV_X32, batch_eq_32) {
+    TEST_REQUIRES_X86_AVX2;
+    VUnaryMicrokernelTester()
+      .batch_size(32)
+      .Test(xnn_f32_vgelu_ukernel__avx2_rational_13_8_div_x32, xnn_init_f32_gelu_avx_rational_13_8_params);
+  }
+
+  TEST(F32_VGELU__AVX2_RATIONAL_13_8_DIV_X32, batch_div_32) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t batch_size = 64; batch_size < 320; batch_size += 32) {
+      VUnaryMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_vgelu_ukernel__avx2_rational_13_8_div_x32, xnn_init_f32_gelu_avx_rational_13_8_params);
+    }
+  }
+
+  TEST(F32_VGELU__AVX2_RATIONAL_13_8_DIV_X32, batch_lt_32) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t batch_size = 1; batch_size < 32; batch_size++) {
+      VUnaryMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_vgelu_ukernel__avx2_rational_13_8_div_x32, xnn_init_f32_gelu_avx_rational_13_8_params);
+    }
+  }
+
+  TEST(F32_VGELU__AVX2_RATIONAL_13_8_DIV_X32, batch_gt_32) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t batch_size = 33; batch_size < 64; batch_size++) {
+      VUnaryMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_vgelu_ukernel__avx2_rational_13_8_div_x32, xnn_init_f32_gelu_avx_rational_13_8_params);
+    }
+  }
+
+  TEST(F32_VGELU__AVX2_RATIONAL_13_8_DIV_X32, inplace) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t batch_size = 1; batch_size <= 160; batch_size += 31) {
+      VUnaryMicrokernelTester()
+        .batch_size(batch_size)
+        .inplace(true)
+        .Test(xnn_f32_vgelu_ukernel__avx2_rational_13_8_div_x32, xnn_init_f32_gelu_avx_rational_13_8_params);
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F32_VGELU__AVX512F_RATIONAL_13_8_DIV_X16, batch_eq_16) {
+    TEST_REQUIRES_X86_AVX512F;
+    VUnaryMicrokernelTester()
+      .batch_size(16)
+      .Test(xnn_f32_vgelu_ukernel__avx512f_rational_13_8_div_x16, xnn_init_f32_gelu_avx512_rational_13_8_params);
+  }
+
+  TEST(F32_VGELU__AVX512F_RATIONAL_13_8_DIV_X16, batch_div_16) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t batch_size = 32; batch_size < 160; batch_size += 16) {
+      VUnaryMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_vgelu_ukernel__avx512f_rational_13_8_div_x16, xnn_init_f32_gelu_avx512_rational_13_8_params);
+    }
+  }
+
+  TEST(F32_VGELU__AVX512F_RATIONAL_13_8_DIV_X16, batch_lt_16) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t batch_size = 1; batch_size < 16; batch_size++) {
+      VUnaryMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_vgelu_ukernel__avx512f_rational_13_8_div_x16, xnn_init_f32_gelu_avx512_rational_13_8_params);
+    }
+  }
+
+  TEST(F32_VGELU__AVX512F_RATIONAL_13_8_DIV_X16, batch_gt_16) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t batch_size = 17; batch_size < 32; batch_size++) {
+      VUnaryMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_vgelu_ukernel__avx512f_rational_13_8_div_x16, xnn_init_f32_gelu_avx512_rational_13_8_params);
+    }
+  }
+
+  TEST(F32_VGELU__AVX512F_RATIONAL_13_8_DIV_X16, inplace) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t batch_size = 1; batch_size <= 80; batch_size += 15) {
+      VUnaryMicrokernelTester()
+        .batch_size(batch_size)
+        .inplace(true)
+        .Test(xnn_f32_vgelu_ukernel__avx512f_rational_13_8_div_x16, xnn_init_f32_gelu_avx512_rational_13_8_params);
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F32_VGELU__AVX512F_RATIONAL_13_8_DIV_X32, batch_eq_32) {
+    TEST_REQUIRES_X86_AVX512F;
+    VUnaryMicrokernelTester()
+      .batch_size(32)
+      .Test(xnn_f32_vgelu_ukernel__avx512f_rational_13_8_div_x32, xnn_init_f32_gelu_avx512_rational_13_8_params);
+  }
+
+  TEST(F32_VGELU__AVX512F_RATIONAL_13_8_DIV_X32, batch_div_32) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t batch_size = 64; batch_size < 320; batch_size += 32) {
+      VUnaryMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_vgelu_ukernel__avx512f_rational_13_8_div_x32, xnn_init_f32_gelu_avx512_rational_13_8_params);
+    }
+  }
+
+  TEST(F32_VGELU__AVX512F_RATIONAL_13_8_DIV_X32, batch_lt_32) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t batch_size = 1; batch_size < 32; batch_size++) {
+      VUnaryMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_vgelu_ukernel__avx512f_rational_13_8_div_x32, xnn_init_f32_gelu_avx512_rational_13_8_params);
+    }
+  }
+
+  TEST(F32_VGELU__AVX512F_RATIONAL_13_8_DIV_X32, batch_gt_32) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t batch_size = 33; batch_size < 64; batch_size++) {
+      VUnaryMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_vgelu_ukernel__avx512f_rational_13_8_div_x32, xnn_init_f32_gelu_avx512_rational_13_8_params);
+    }
+  }
+
+  TEST(F32_VGELU__AVX512F_RATIONAL_13_8_DIV_X32, inplace) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t batch_size = 1; batch_size <= 160; batch_size += 31) {
+      VUnaryMicrokernelTester()
+        .batch_size(batch_size)
+        .inplace(true)
+        .Test(xnn_f32_vgelu_ukernel__avx512f_rational_13_8_div_x32, xnn_init_f32_gelu_avx512_rational_13_8_params);
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F32_VGELU__AVX512F_RATIONAL_13_8_DIV_X48, batch_eq_48) {
+    TEST_REQUIRES_X86_AVX512F;
+    VUnaryMicrokernelTester()
+      .batch_size(48)
+      .Test(xnn_f32_vgelu_ukernel__avx512f_rational_13_8_div_x48, xnn_init_f32_gelu_avx512_rational_13_8_params);
+  }
+
+  TEST(F32_VGELU__AVX512F_RATIONAL_13_8_DIV_X48, batch_div_48) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t batch_size = 96; batch_size < 480; batch_size += 48) {
+      VUnaryMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_vgelu_ukernel__avx512f_rational_13_8_div_x48, xnn_init_f32_gelu_avx512_rational_13_8_params);
+    }
+  }
+
+  TEST(F32_VGELU__AVX512F_RATIONAL_13_8_DIV_X48, batch_lt_48) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t batch_size = 1; batch_size < 48; batch_size++) {
+      VUnaryMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_vgelu_ukernel__avx512f_rational_13_8_div_x48, xnn_init_f32_gelu_avx512_rational_13_8_params);
+    }
+  }
+
+  TEST(F32_VGELU__AVX512F_RATIONAL_13_8_DIV_X48, batch_gt_48) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t batch_size = 49; batch_size < 96; batch_size++) {
+      VUnaryMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_vgelu_ukernel__avx512f_rational_13_8_div_x48, xnn_init_f32_gelu_avx512_rational_13_8_params);
+    }
+  }
+
+  TEST(F32_VGELU__AVX512F_RATIONAL_13_8_DIV_X48, inplace) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t batch_size = 1; batch_size <= 240; batch_size += 47) {
+      VUnaryMicrokernelTester()
+        .batch_size(batch_size)
+        .inplace(true)
+        .Test(xnn_f32_vgelu_ukernel__avx512f_rational_13_8_div_x48, xnn_init_f32_gelu_avx512_rational_13_8_params);
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F32_VGELU__AVX512F_RATIONAL_13_8_DIV_X64, batch_eq_64) {
+    TEST_REQUIRES_X86_AVX512F;
+    VUnaryMicrokernelTester()
+      .batch_size(64)
+      .Test(xnn_f32_vgelu_ukernel__avx512f_rational_13_8_div_x64, xnn_init_f32_gelu_avx512_rational_13_8_params);
+  }
+
+  TEST(F32_VGELU__AVX512F_RATIONAL_13_8_DIV_X64, batch_div_64) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t batch_size = 128; batch_size < 640; batch_size += 64) {
+      VUnaryMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_vgelu_ukernel__avx512f_rational_13_8_div_x64, xnn_init_f32_gelu_avx512_rational_13_8_params);
+    }
+  }
+
+  TEST(F32_VGELU__AVX512F_RATIONAL_13_8_DIV_X64, batch_lt_64) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t batch_size = 1; batch_size < 64; batch_size++) {
+      VUnaryMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_vgelu_ukernel__avx512f_rational_13_8_div_x64, xnn_init_f32_gelu_avx512_rational_13_8_params);
+    }
+  }
+
+  TEST(F32_VGELU__AVX512F_RATIONAL_13_8_DIV_X64, batch_gt_64) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t batch_size = 65; batch_size < 128; batch_size++) {
+      VUnaryMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_vgelu_ukernel__avx512f_rational_13_8_div_x64, xnn_init_f32_gelu_avx512_rational_13_8_params);
+    }
+  }
+
+  TEST(F32_VGELU__AVX512F_RATIONAL_13_8_DIV_X64, inplace) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t batch_size = 1; batch_size <= 320; batch_size += 63) {
+      VUnaryMicrokernelTester()
+        .batch_size(batch_size)
+        .inplace(true)
+        .Test(xnn_f32_vgelu_ukernel__avx512f_rational_13_8_div_x64, xnn_init_f32_gelu_avx512_rational_13_8_params);
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+TEST(F32_VGELU__SCALAR_RATIONAL_13_8_DIV_X1, batch_eq_1) {
+  VUnaryMicrokernelTester()
+    .batch_size(1)
+    .Test(xnn_f32_vgelu_ukernel__scalar_rational_13_8_div_x1, xnn_init_f32_gelu_scalar_rational_13_8_params);
+}
+
+TEST(F32_VGELU__SCALAR_RATIONAL_13_8_DIV_X1, batch_gt_1) {
+  for (size_t batch_size = 2; batch_size < 10; batch_size++) {
+    VUnaryMicrokernelTester()
+      .batch_size(batch_size)
+      .Test(xnn_f32_vgelu_ukernel__scalar_rational_13_8_div_x1, xnn_init_f32_gelu_scalar_rational_13_8_params);
+  }
+}
+
+TEST(F32_VGELU__SCALAR_RATIONAL_13_8_DIV_X1, inplace) {
+  for (size_t batch_size = 1; batch_size <= 5; batch_size += 1) {
+    VUnaryMicrokernelTester()
+      .batch_size(batch_size)
+      .inplace(true)
+      .Test(xnn_f32_vgelu_ukernel__scalar_rational_13_8_div_x1, xnn_init_f32_gelu_scalar_rational_13_8_params);
+  }
+}
+
+
+TEST(F32_VGELU__SCALAR_RATIONAL_13_8_DIV_X2, batch_eq_2) {
+  VUnaryMicrokernelTester()
+    .batch_size(2)
+    .Test(xnn_f32_vgelu_ukernel__scalar_rational_13_8_div_x2, xnn_init_f32_gelu_scalar_rational_13_8_params);
+}
+
+TEST(F32_VGELU__SCALAR_RATIONAL_13_8_DIV_X2, batch_div_2) {
+  for (size_t batch_size = 4; batch_size < 20; batch_size += 2) {
+    VUnaryMicrokernelTester()
+      .batch_size(batch_size)
+      .Test(xnn_f32_vgelu_ukernel__scalar_rational_13_8_div_x2, xnn_init_f32_gelu_scalar_rational_13_8_params);
+  }
+}
+
+TEST(F32_VGELU__SCALAR_RATIONAL_13_8_DIV_X2, batch_lt_2) {
+  for (size_t batch_size = 1; batch_size < 2; batch_size++) {
+    VUnaryMicrokernelTester()
+      .batch_size(batch_size)
+      .Test(xnn_f32_vgelu_ukernel__scalar_rational_13_8_div_x2, xnn_init_f32_gelu_scalar_rational_13_8_params);
+  }
+}
+
+TEST(F32_VGELU__SCALAR_RATIONAL_13_8_DIV_X2, batch_gt_2) {
+  for (size_t batch_size = 3; batch_size < 4; batch_size++) {
+    VUnaryMicrokernelTester()
+      .batch_size(batch_size)
+      .Test(xnn_f32_vgelu_ukernel__scalar_rational_13_8_div_x2, xnn_init_f32_gelu_scalar_rational_13_8_params);
+  }
+}
+
+TEST(F32_VGELU__SCALAR_RATIONAL_13_8_DIV_X2, inplace) {
+  for (size_t batch_size = 1; batch_size <= 10; batch_size += 1) {
+    VUnaryMicrokernelTester()
+      .batch_size(batch_size)
+      .inplace(true)
+      .Test(xnn_f32_vgelu_ukernel__scalar_rational_13_8_div_x2, xnn_init_f32_gelu_scalar_rational_13_8_params);
+  }
+}
+
+
+TEST(F32_VGELU__SCALAR_RATIONAL_13_8_DIV_X4, batch_eq_4) {
+  VUnaryMicrokernelTester()
+    .batch_size(4)
+    .Test(xnn_f32_vgelu_ukernel__scalar_rational_13_8_div_x4, xnn_init_f32_gelu_scalar_rational_13_8_params);
+}
+
+TEST(F32_VGELU__SCALAR_RATIONAL_13_8_DIV_X4, batch_div_4) {
+  for (size_t batch_size = 8; batch_size < 40; batch_size += 4) {
+    VUnaryMicrokernelTester()
+      .batch_size(batch_size)
+      .Test(xnn_f32_vgelu_ukernel__scalar_rational_13_8_div_x4, xnn_init_f32_gelu_scalar_rational_13_8_params);
+  }
+}
+
+TEST(F32_VGELU__SCALAR_RATIONAL_13_8_DIV_X4, batch_lt_4) {
+  for (size_t batch_size = 1; batch_size < 4; batch_size++) {
+    VUnaryMicrokernelTester()
+      .batch_size(batch_size)
+      .Test(xnn_f32_vgelu_ukernel__scalar_rational_13_8_div_x4, xnn_init_f32_gelu_scalar_rational_13_8_params);
+  }
+}
+
+TEST(F32_VGELU__SCALAR_RATIONAL_13_8_DIV_X4, batch_gt_4) {
+  for (size_t batch_size = 5; batch_size < 8; batch_size++) {
+    VUnaryMicrokernelTester()
+      .batch_size(batch_size)
+      .Test(xnn_f32_vgelu_ukernel__scalar_rational_13_8_div_x4, xnn_init_f32_gelu_scalar_rational_13_8_params);
+  }
+}
+
+TEST(F32_VGELU__SCALAR_RATIONAL_13_8_DIV_X4, inplace) {
+  for (size_t batch_size = 1; batch_size <= 20; batch_size += 3) {
+    VUnaryMicrokernelTester()
+      .batch_size(batch_size)
+      .inplace(true)
+      .Test(xnn_f32_vgelu_ukernel__scalar_rational_13_8_div_x4, xnn_init_f32_gelu_scalar_rational_13_8_params);
+  }
+}
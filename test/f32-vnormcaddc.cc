@@ -0,0 +1,247 @@
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <gtest/gtest.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/isa-checks.h>
+
+#include <xnnpack/vnormcaddc.h>
+#include "vnormcaddc-microkernel-tester.h"
+
+
+#if XNN_ARCH_ARM || XNN_ARCH_ARM64
+  TEST(F32_VNORMCADDC_C8__NEON, channels_eq_8) {
+    TEST_REQUIRES_ARM_NEON;
+    VNormCAddCMicrokernelTester()
+      .channel_tile(8)
+      .channels(8)
+      .Test(xnn_f32_vnormcaddc_ukernel_c8__neon);
+  }
+
+  TEST(F32_VNORMCADDC_C8__NEON, channels_div_8) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t channels = 16; channels < 80; channels += 8) {
+      VNormCAddCMicrokernelTester()
+        .channel_tile(8)
+        .channels(channels)
+        .Test(xnn_f32_vnormcaddc_ukernel_c8__neon);
+    }
+  }
+
+  TEST(F32_VNORMCADDC_C8__NEON, channels_lt_8) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t channels = 1; channels < 8; channels++) {
+      VNormCAddCMicrokernelTester()
+        .channel_tile(8)
+        .channels(channels)
+        .Test(xnn_f32_vnormcaddc_ukernel_c8__neon);
+    }
+  }
+
+  TEST(F32_VNORMCADDC_C8__NEON, channels_gt_8) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t channels = 9; channels < 16; channels++) {
+      VNormCAddCMicrokernelTester()
+        .channel_tile(8)
+        .channels(channels)
+        .Test(xnn_f32_vnormcaddc_ukernel_c8__neon);
+    }
+  }
+#endif  // XNN_ARCH_ARM || XNN_ARCH_ARM64
+
+#if XNN_ARCH_ARM64
+  TEST(F32_VNORMCADDC_C8__NEONFMA, channels_eq_8) {
+    TEST_REQUIRES_ARM_NEON_FMA;
+    VNormCAddCMicrokernelTester()
+      .channel_tile(8)
+      .channels(8)
+      .Test(xnn_f32_vnormcaddc_ukernel_c8__neonfma);
+  }
+
+  TEST(F32_VNORMCADDC_C8__NEONFMA, channels_div_8) {
+    TEST_REQUIRES_ARM_NEON_FMA;
+    for (size_t channels = 16; channels < 80; channels += 8) {
+      VNormCAddCMicrokernelTester()
+        .channel_tile(8)
+        .channels(channels)
+        .Test(xnn_f32_vnormcaddc_ukernel_c8__neonfma);
+    }
+  }
+
+  TEST(F32_VNORMCADDC_C8__NEONFMA, channels_lt_8) {
+    TEST_REQUIRES_ARM_NEON_FMA;
+    for (size_t channels = 1; channels < 8; channels++) {
+      VNormCAddCMicrokernelTester()
+        .channel_tile(8)
+        .channels(channels)
+        .Test(xnn_f32_vnormcaddc_ukernel_c8__neonfma);
+    }
+  }
+
+  TEST(F32_VNORMCADDC_C8__NEONFMA, channels_gt_8) {
+    TEST_REQUIRES_ARM_NEON_FMA;
+    for (size_t channels = 9; channels < 16; channels++) {
+      VNormCAddCMicrokernelTester()
+        .channel_tile(8)
+        .channels(channels)
+        .Test(xnn_f32_vnormcaddc_ukernel_c8__neonfma);
+    }
+  }
+#endif  // XNN_ARCH_ARM64
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F32_VNORMCADDC_C8__SSE, channels_eq_8) {
+    TEST_REQUIRES_X86_SSE;
+    VNormCAddCMicrokernelTester()
+      .channel_tile(8)
+      .channels(8)
+      .Test(xnn_f32_vnormcaddc_ukernel_c8__sse);
+  }
+
+  TEST(F32_VNORMCADDC_C8__SSE, channels_div_8) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t channels = 16; channels < 80; channels += 8) {
+      VNormCAddCMicrokernelTester()
+        .channel_tile(8)
+        .channels(channels)
+        .Test(xnn_f32_vnormcaddc_ukernel_c8__sse);
+    }
+  }
+
+  TEST(F32_VNORMCADDC_C8__SSE, channels_lt_8) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t channels = 1; channels < 8; channels++) {
+      VNormCAddCMicrokernelTester()
+        .channel_tile(8)
+        .channels(channels)
+        .Test(xnn_f32_vnormcaddc_ukernel_c8__sse);
+    }
+  }
+
+  TEST(F32_VNORMCADDC_C8__SSE, channels_gt_8) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t channels = 9; channels < 16; channels++) {
+      VNormCAddCMicrokernelTester()
+        .channel_tile(8)
+        .channels(channels)
+        .Test(xnn_f32_vnormcaddc_ukernel_c8__sse);
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F32_VNORMCADDC_C16__AVX, channels_eq_16) {
+    TEST_REQUIRES_X86_AVX;
+    VNormCAddCMicrokernelTester()
+      .channel_tile(16)
+      .channels(16)
+      .Test(xnn_f32_vnormcaddc_ukernel_c16__avx, xnn_init_f32_default_avx_params);
+  }
+
+  TEST(F32_VNORMCADDC_C16__AVX, channels_div_16) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t channels = 32; channels < 160; channels += 16) {
+      VNormCAddCMicrokernelTester()
+        .channel_tile(16)
+        .channels(channels)
+        .Test(xnn_f32_vnormcaddc_ukernel_c16__avx, xnn_init_f32_default_avx_params);
+    }
+  }
+
+  TEST(F32_VNORMCADDC_C16__AVX, channels_lt_16) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t channels = 1; channels < 16; channels++) {
+      VNormCAddCMicrokernelTester()
+        .channel_tile(16)
+        .channels(channels)
+        .Test(xnn_f32_vnormcaddc_ukernel_c16__avx, xnn_init_f32_default_avx_params);
+    }
+  }
+
+  TEST(F32_VNORMCADDC_C16__AVX, channels_gt_16) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t channels = 17; channels < 32; channels++) {
+      VNormCAddCMicrokernelTester()
+        .channel_tile(16)
+        .channels(channels)
+        .Test(xnn_f32_vnormcaddc_ukernel_c16__avx, xnn_init_f32_default_avx_params);
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F32_VNORMCADDC_C32__AVX512F, channels_eq_32) {
+    TEST_REQUIRES_X86_AVX512F;
+    VNormCAddCMicrokernelTester()
+      .channel_tile(32)
+      .channels(32)
+      .Test(xnn_f32_vnormcaddc_ukernel_c32__avx512f);
+  }
+
+  TEST(F32_VNORMCADDC_C32__AVX512F, channels_div_32) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t channels = 64; channels < 320; channels += 32) {
+      VNormCAddCMicrokernelTester()
+        .channel_tile(32)
+        .channels(channels)
+        .Test(xnn_f32_vnormcaddc_ukernel_c32__avx512f);
+    }
+  }
+
+  TEST(F32_VNORMCADDC_C32__AVX512F, channels_lt_32) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t channels = 1; channels < 32; channels++) {
+      VNormCAddCMicrokernelTester()
+        .channel_tile(32)
+        .channels(channels)
+        .Test(xnn_f32_vnormcaddc_ukernel_c32__avx512f);
+    }
+  }
+
+  TEST(F32_VNORMCADDC_C32__AVX512F, channels_gt_32) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t channels = 33; channels < 64; channels++) {
+      VNormCAddCMicrokernelTester()
+        .channel_tile(32)
+        .channels(channels)
+        .Test(xnn_f32_vnormcaddc_ukernel_c32__avx512f);
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+TEST(F32_VNORMCADDC_C4__SCALAR, channels_eq_4) {
+  VNormCAddCMicrokernelTester()
+    .channel_tile(4)
+    .channels(4)
+    .Test(xnn_f32_vnormcaddc_ukernel_c4__scalar);
+}
+
+TEST(F32_VNORMCADDC_C4__SCALAR, channels_div_4) {
+  for (size_t channels = 8; channels < 40; channels += 4) {
+    VNormCAddCMicrokernelTester()
+      .channel_tile(4)
+      .channels(channels)
+      .Test(xnn_f32_vnormcaddc_ukernel_c4__scalar);
+  }
+}
+
+TEST(F32_VNORMCADDC_C4__SCALAR, channels_lt_4) {
+  for (size_t channels = 1; channels < 4; channels++) {
+    VNormCAddCMicrokernelTester()
+      .channel_tile(4)
+      .channels(channels)
+      .Test(xnn_f32_vnormcaddc_ukernel_c4__scalar);
+  }
+}
+
+TEST(F32_VNORMCADDC_C4__SCALAR, channels_gt_4) {
+  for (size_t channels = 5; channels < 8; channels++) {
+    VNormCAddCMicrokernelTester()
+      .channel_tile(4)
+      .channels(channels)
+      .Test(xnn_f32_vnormcaddc_ukernel_c4__scalar);
+  }
+}
@@ -0,0 +1,286 @@
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include <xnnpack.h>
+
+#include "gather-operator-tester.h"
+
+
+TEST(GATHER_ND_X8, 1d_single_index) {
+  for (size_t num_rows = 1; num_rows <= 16; num_rows++) {
+    GatherOperatorTester()
+      .input_shape({num_rows})
+      .axis(0)
+      .num_indices(1)
+      .TestX8();
+  }
+}
+
+TEST(GATHER_ND_X8, 2d_axis_0) {
+  for (size_t num_indices = 1; num_indices <= 32; num_indices += 3) {
+    GatherOperatorTester()
+      .input_shape({19, 37})
+      .axis(0)
+      .num_indices(num_indices)
+      .TestX8();
+  }
+}
+
+TEST(GATHER_ND_X8, 2d_axis_1) {
+  for (size_t num_indices = 1; num_indices <= 32; num_indices += 3) {
+    GatherOperatorTester()
+      .input_shape({19, 37})
+      .axis(1)
+      .num_indices(num_indices)
+      .TestX8();
+  }
+}
+
+TEST(GATHER_ND_X8, 4d_middle_axis) {
+  for (size_t axis = 1; axis < 3; axis++) {
+    GatherOperatorTester()
+      .input_shape({3, 5, 7, 11})
+      .axis(axis)
+      .num_indices(9)
+      .TestX8();
+  }
+}
+
+TEST(GATHER_ND_X8, 6d) {
+  for (size_t axis = 0; axis < 6; axis++) {
+    GatherOperatorTester()
+      .input_shape({2, 3, 5, 2, 3, 7})
+      .axis(axis)
+      .num_indices(4)
+      .TestX8();
+  }
+}
+
+TEST(GATHER_ND_X8, zero_indices) {
+  GatherOperatorTester()
+    .input_shape({19, 37})
+    .axis(0)
+    .num_indices(0)
+    .TestX8();
+}
+
+TEST(GATHER_ND_X8, multithreaded) {
+  GatherOperatorTester()
+    .input_shape({5, 101, 17})
+    .axis(1)
+    .num_indices(67)
+    .multithreaded(true)
+    .TestX8();
+}
+
+
+TEST(GATHER_ND_X32, 1d_single_index) {
+  for (size_t num_rows = 1; num_rows <= 16; num_rows++) {
+    GatherOperatorTester()
+      .input_shape({num_rows})
+      .axis(0)
+      .num_indices(1)
+      .TestX32();
+  }
+}
+
+TEST(GATHER_ND_X32, embedding_lookup) {
+  for (size_t embedding_size = 1; embedding_size <= 256; embedding_size *= 2) {
+    GatherOperatorTester()
+      .input_shape({97, embedding_size})
+      .axis(0)
+      .num_indices(41)
+      .TestX32();
+  }
+}
+
+TEST(GATHER_ND_X32, 2d_axis_1) {
+  for (size_t num_indices = 1; num_indices <= 32; num_indices += 3) {
+    GatherOperatorTester()
+      .input_shape({19, 37})
+      .axis(1)
+      .num_indices(num_indices)
+      .TestX32();
+  }
+}
+
+TEST(GATHER_ND_X32, 4d_middle_axis) {
+  for (size_t axis = 1; axis < 3; axis++) {
+    GatherOperatorTester()
+      .input_shape({3, 5, 7, 11})
+      .axis(axis)
+      .num_indices(9)
+      .TestX32();
+  }
+}
+
+TEST(GATHER_ND_X32, 6d) {
+  for (size_t axis = 0; axis < 6; axis++) {
+    GatherOperatorTester()
+      .input_shape({2, 3, 5, 2, 3, 7})
+      .axis(axis)
+      .num_indices(4)
+      .TestX32();
+  }
+}
+
+TEST(GATHER_ND_X32, zero_indices) {
+  GatherOperatorTester()
+    .input_shape({19, 37})
+    .axis(1)
+    .num_indices(0)
+    .TestX32();
+}
+
+TEST(GATHER_ND_X32, multithreaded) {
+  GatherOperatorTester()
+    .input_shape({5, 101, 17})
+    .axis(1)
+    .num_indices(67)
+    .multithreaded(true)
+    .TestX32();
+}
+
+
+TEST(GATHER_ND_QS8_F32, embedding_lookup) {
+  for (size_t embedding_size = 1; embedding_size <= 256; embedding_size *= 2) {
+    GatherOperatorTester()
+      .input_shape({97, embedding_size})
+      .axis(0)
+      .num_indices(41)
+      .TestQS8F32();
+  }
+}
+
+TEST(GATHER_ND_QS8_F32, 4d_middle_axis) {
+  for (size_t axis = 1; axis < 3; axis++) {
+    GatherOperatorTester()
+      .input_shape({3, 5, 7, 11})
+      .axis(axis)
+      .num_indices(9)
+      .TestQS8F32();
+  }
+}
+
+TEST(GATHER_ND_QS8_F32, input_scale) {
+  for (float input_scale = 1.0e-2f; input_scale < 1.0e+2f; input_scale *= 3.14159265f) {
+    GatherOperatorTester()
+      .input_shape({31, 24})
+      .axis(0)
+      .num_indices(13)
+      .input_scale(input_scale)
+      .TestQS8F32();
+  }
+}
+
+TEST(GATHER_ND_QS8_F32, input_zero_point) {
+  for (int16_t input_zero_point = std::numeric_limits<int8_t>::min();
+       input_zero_point <= std::numeric_limits<int8_t>::max();
+       input_zero_point += 51)
+  {
+    GatherOperatorTester()
+      .input_shape({31, 24})
+      .axis(0)
+      .num_indices(13)
+      .input_zero_point(input_zero_point)
+      .TestQS8F32();
+  }
+}
+
+TEST(GATHER_ND_QS8_F32, multithreaded) {
+  GatherOperatorTester()
+    .input_shape({5, 101, 17})
+    .axis(1)
+    .num_indices(67)
+    .multithreaded(true)
+    .TestQS8F32();
+}
+
+
+TEST(GATHER_ND_QU8_F32, embedding_lookup) {
+  for (size_t embedding_size = 1; embedding_size <= 256; embedding_size *= 2) {
+    GatherOperatorTester()
+      .input_shape({97, embedding_size})
+      .axis(0)
+      .num_indices(41)
+      .TestQU8F32();
+  }
+}
+
+TEST(GATHER_ND_QU8_F32, 4d_middle_axis) {
+  for (size_t axis = 1; axis < 3; axis++) {
+    GatherOperatorTester()
+      .input_shape({3, 5, 7, 11})
+      .axis(axis)
+      .num_indices(9)
+      .TestQU8F32();
+  }
+}
+
+TEST(GATHER_ND_QU8_F32, input_scale) {
+  for (float input_scale = 1.0e-2f; input_scale < 1.0e+2f; input_scale *= 3.14159265f) {
+    GatherOperatorTester()
+      .input_shape({31, 24})
+      .axis(0)
+      .num_indices(13)
+      .input_scale(input_scale)
+      .TestQU8F32();
+  }
+}
+
+TEST(GATHER_ND_QU8_F32, input_zero_point) {
+  for (int16_t input_zero_point = 0; input_zero_point <= 255; input_zero_point += 51) {
+    GatherOperatorTester()
+      .input_shape({31, 24})
+      .axis(0)
+      .num_indices(13)
+      .input_zero_point(input_zero_point)
+      .TestQU8F32();
+  }
+}
+
+TEST(GATHER_ND_QU8_F32, multithreaded) {
+  GatherOperatorTester()
+    .input_shape({5, 101, 17})
+    .axis(1)
+    .num_indices(67)
+    .multithreaded(true)
+    .TestQU8F32();
+}
+
+TEST(GATHER_ND_X32, rejects_out_of_range_indices_at_run_time) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  xnn_operator_t gather_op = nullptr;
+  ASSERT_EQ(xnn_status_success, xnn_create_gather_nd_x32(0 /* flags */, &gather_op));
+  ASSERT_NE(nullptr, gather_op);
+  std::unique_ptr<xnn_operator, decltype(&xnn_delete_operator)> auto_gather_op(gather_op, xnn_delete_operator);
+
+  const size_t input_shape[2] = {7, 5};
+  std::vector<uint32_t> input(7 * 5 + XNN_EXTRA_BYTES / sizeof(uint32_t));
+  std::vector<uint32_t> output(3 * 5);
+  std::vector<int32_t> indices = {6, 0, 3};
+  ASSERT_EQ(xnn_status_success,
+    xnn_setup_gather_nd_x32(
+      gather_op,
+      2, input_shape, 0 /* axis */,
+      indices.size(), indices.data(),
+      input.data(), output.data(),
+      nullptr /* thread pool */));
+  ASSERT_EQ(xnn_status_success, xnn_run_operator(gather_op, nullptr /* thread pool */));
+
+  // Indices are read when the operator runs, so they may change after setup.
+  for (int32_t index : {7, -1, INT32_MAX, INT32_MIN}) {
+    indices[1] = index;
+    EXPECT_EQ(xnn_status_invalid_parameter, xnn_run_operator(gather_op, nullptr /* thread pool */));
+  }
+  indices[1] = 0;
+  EXPECT_EQ(xnn_status_success, xnn_run_operator(gather_op, nullptr /* thread pool */));
+}
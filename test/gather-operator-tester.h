@@ -0,0 +1,280 @@
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <functional>
+#include <initializer_list>
+#include <limits>
+#include <memory>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include <xnnpack.h>
+
+
+class GatherOperatorTester {
+ public:
+  inline GatherOperatorTester& input_shape(std::initializer_list<size_t> input_shape) {
+    assert(input_shape.size() <= XNN_MAX_TENSOR_DIMS);
+    this->input_shape_ = std::vector<size_t>(input_shape);
+    return *this;
+  }
+
+  inline const std::vector<size_t>& input_shape() const {
+    return this->input_shape_;
+  }
+
+  inline size_t num_dims() const {
+    return this->input_shape_.size();
+  }
+
+  inline GatherOperatorTester& axis(size_t axis) {
+    this->axis_ = axis;
+    return *this;
+  }
+
+  inline size_t axis() const {
+    return this->axis_;
+  }
+
+  inline GatherOperatorTester& num_indices(size_t num_indices) {
+    this->num_indices_ = num_indices;
+    return *this;
+  }
+
+  inline size_t num_indices() const {
+    return this->num_indices_;
+  }
+
+  inline GatherOperatorTester& input_scale(float input_scale) {
+    assert(input_scale > 0.0f);
+    assert(std::isnormal(input_scale));
+    this->input_scale_ = input_scale;
+    return *this;
+  }
+
+  inline float input_scale() const {
+    return this->input_scale_;
+  }
+
+  inline GatherOperatorTester& input_zero_point(int16_t input_zero_point) {
+    this->input_zero_point_ = input_zero_point;
+    return *this;
+  }
+
+  inline int16_t input_zero_point() const {
+    return this->input_zero_point_;
+  }
+
+  inline GatherOperatorTester& multithreaded(bool multithreaded) {
+    this->multithreaded_ = multithreaded;
+    return *this;
+  }
+
+  inline bool multithreaded() const {
+    return this->multithreaded_;
+  }
+
+  inline GatherOperatorTester& iterations(size_t iterations) {
+    this->iterations_ = iterations;
+    return *this;
+  }
+
+  inline size_t iterations() const {
+    return this->iterations_;
+  }
+
+  void TestX8() const {
+    std::vector<uint8_t> input;
+    std::vector<int32_t> indices;
+    std::vector<size_t> index_map;
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      GenerateInputs(input, indices, index_map);
+      std::vector<uint8_t> output(index_map.size(), UINT8_C(0xA5));
+
+      std::unique_ptr<pthreadpool, decltype(&pthreadpool_destroy)> threadpool(CreateThreadpool(), pthreadpool_destroy);
+      xnn_operator_t gather_op = nullptr;
+      ASSERT_EQ(xnn_status_success, xnn_create_gather_nd_x8(0, &gather_op));
+      ASSERT_NE(nullptr, gather_op);
+
+      // Smart pointer to automatically delete gather_op.
+      std::unique_ptr<xnn_operator, decltype(&xnn_delete_operator)> auto_gather_op(gather_op, xnn_delete_operator);
+
+      ASSERT_EQ(xnn_status_success,
+        xnn_setup_gather_nd_x8(
+          gather_op,
+          num_dims(), input_shape().data(), axis(),
+          num_indices(), indices.data(),
+          input.data(), output.data(),
+          threadpool.get()));
+
+      ASSERT_EQ(xnn_status_success, xnn_run_operator(gather_op, threadpool.get()));
+
+      // Verify results.
+      for (size_t o = 0; o < index_map.size(); o++) {
+        ASSERT_EQ(int32_t(output[o]), int32_t(input[index_map[o]])) << "at output element " << o;
+      }
+    }
+  }
+
+  void TestX32() const {
+    std::vector<uint32_t> input;
+    std::vector<int32_t> indices;
+    std::vector<size_t> index_map;
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      GenerateInputs(input, indices, index_map);
+      std::vector<uint32_t> output(index_map.size(), UINT32_C(0xA5A5A5A5));
+
+      std::unique_ptr<pthreadpool, decltype(&pthreadpool_destroy)> threadpool(CreateThreadpool(), pthreadpool_destroy);
+      xnn_operator_t gather_op = nullptr;
+      ASSERT_EQ(xnn_status_success, xnn_create_gather_nd_x32(0, &gather_op));
+      ASSERT_NE(nullptr, gather_op);
+
+      // Smart pointer to automatically delete gather_op.
+      std::unique_ptr<xnn_operator, decltype(&xnn_delete_operator)> auto_gather_op(gather_op, xnn_delete_operator);
+
+      ASSERT_EQ(xnn_status_success,
+        xnn_setup_gather_nd_x32(
+          gather_op,
+          num_dims(), input_shape().data(), axis(),
+          num_indices(), indices.data(),
+          input.data(), output.data(),
+          threadpool.get()));
+
+      ASSERT_EQ(xnn_status_success, xnn_run_operator(gather_op, threadpool.get()));
+
+      // Verify results.
+      for (size_t o = 0; o < index_map.size(); o++) {
+        ASSERT_EQ(output[o], input[index_map[o]]) << "at output element " << o;
+      }
+    }
+  }
+
+  void TestQS8F32() const {
+    std::vector<int8_t> input;
+    std::vector<int32_t> indices;
+    std::vector<size_t> index_map;
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      GenerateInputs(input, indices, index_map);
+      std::vector<float> output(index_map.size(), std::nanf(""));
+
+      std::unique_ptr<pthreadpool, decltype(&pthreadpool_destroy)> threadpool(CreateThreadpool(), pthreadpool_destroy);
+      xnn_operator_t gather_op = nullptr;
+      ASSERT_EQ(xnn_status_success,
+        xnn_create_gather_nd_qs8_f32(input_scale(), int8_t(input_zero_point()), 0, &gather_op));
+      ASSERT_NE(nullptr, gather_op);
+
+      // Smart pointer to automatically delete gather_op.
+      std::unique_ptr<xnn_operator, decltype(&xnn_delete_operator)> auto_gather_op(gather_op, xnn_delete_operator);
+
+      ASSERT_EQ(xnn_status_success,
+        xnn_setup_gather_nd_qs8_f32(
+          gather_op,
+          num_dims(), input_shape().data(), axis(),
+          num_indices(), indices.data(),
+          input.data(), output.data(),
+          threadpool.get()));
+
+      ASSERT_EQ(xnn_status_success, xnn_run_operator(gather_op, threadpool.get()));
+
+      // Verify results.
+      for (size_t o = 0; o < index_map.size(); o++) {
+        const float output_ref = float(int32_t(input[index_map[o]]) - int32_t(input_zero_point())) * input_scale();
+        ASSERT_EQ(output[o], output_ref) << "at output element " << o;
+      }
+    }
+  }
+
+  void TestQU8F32() const {
+    std::vector<uint8_t> input;
+    std::vector<int32_t> indices;
+    std::vector<size_t> index_map;
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      GenerateInputs(input, indices, index_map);
+      std::vector<float> output(index_map.size(), std::nanf(""));
+
+      std::unique_ptr<pthreadpool, decltype(&pthreadpool_destroy)> threadpool(CreateThreadpool(), pthreadpool_destroy);
+      xnn_operator_t gather_op = nullptr;
+      ASSERT_EQ(xnn_status_success,
+        xnn_create_gather_nd_qu8_f32(input_scale(), uint8_t(input_zero_point()), 0, &gather_op));
+      ASSERT_NE(nullptr, gather_op);
+
+      // Smart pointer to automatically delete gather_op.
+      std::unique_ptr<xnn_operator, decltype(&xnn_delete_operator)> auto_gather_op(gather_op, xnn_delete_operator);
+
+      ASSERT_EQ(xnn_status_success,
+        xnn_setup_gather_nd_qu8_f32(
+          gather_op,
+          num_dims(), input_shape().data(), axis(),
+          num_indices(), indices.data(),
+          input.data(), output.data(),
+          threadpool.get()));
+
+      ASSERT_EQ(xnn_status_success, xnn_run_operator(gather_op, threadpool.get()));
+
+      // Verify results.
+      for (size_t o = 0; o < index_map.size(); o++) {
+        const float output_ref = float(int32_t(input[index_map[o]]) - int32_t(input_zero_point())) * input_scale();
+        ASSERT_EQ(output[o], output_ref) << "at output element " << o;
+      }
+    }
+  }
+
+ private:
+  pthreadpool_t CreateThreadpool() const {
+    EXPECT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+    return multithreaded() ? pthreadpool_create(4) : nullptr;
+  }
+
+  // Generates random input elements and indices, and maps each output element to the input element it is gathered
+  // from.
+  template<typename T>
+  void GenerateInputs(std::vector<T>& input, std::vector<int32_t>& indices, std::vector<size_t>& index_map) const {
+    ASSERT_LT(axis(), num_dims());
+    std::random_device random_device;
+    auto rng = std::mt19937(random_device());
+    auto xrng = std::bind(std::uniform_int_distribution<uint32_t>(), std::ref(rng));
+    auto index_rng = std::bind(
+      std::uniform_int_distribution<int32_t>(0, int32_t(input_shape()[axis()]) - 1), std::ref(rng));
+
+    const size_t batch_size = std::accumulate(
+      input_shape().cbegin(), input_shape().cbegin() + axis(), size_t(1), std::multiplies<size_t>());
+    const size_t row_size = std::accumulate(
+      input_shape().cbegin() + axis() + 1, input_shape().cend(), size_t(1), std::multiplies<size_t>());
+    const size_t num_input_elements = batch_size * input_shape()[axis()] * row_size;
+
+    input.resize(num_input_elements + XNN_EXTRA_BYTES / sizeof(T));
+    std::generate(input.begin(), input.end(), [&]() { return T(xrng()); });
+    indices.resize(num_indices());
+    std::generate(indices.begin(), indices.end(), std::ref(index_rng));
+
+    index_map.clear();
+    for (size_t b = 0; b < batch_size; b++) {
+      for (size_t i = 0; i < num_indices(); i++) {
+        for (size_t c = 0; c < row_size; c++) {
+          index_map.push_back((b * input_shape()[axis()] + size_t(indices[i])) * row_size + c);
+        }
+      }
+    }
+  }
+
+  std::vector<size_t> input_shape_;
+  size_t axis_{0};
+  size_t num_indices_{1};
+  float input_scale_{0.75f};
+  int16_t input_zero_point_{0};
+  bool multithreaded_{false};
+  size_t iterations_{3};
+};
@@ -0,0 +1,393 @@
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include <xnnpack.h>
+#include <xnnpack/subgraph.h>
+
+#include <gtest/gtest.h>
+
+namespace {
+
+size_t NumElements(const std::vector<size_t>& dims) {
+  return std::accumulate(dims.cbegin(), dims.cend(), size_t(1), std::multiplies<size_t>());
+}
+
+template<class T>
+std::vector<T> RandomInput(size_t num_elements) {
+  std::random_device random_device;
+  auto rng = std::mt19937(random_device());
+  auto u8rng = std::bind(std::uniform_int_distribution<uint32_t>(0, std::numeric_limits<uint8_t>::max()), rng);
+  std::vector<T> input(num_elements + XNN_EXTRA_BYTES / sizeof(T));
+  std::generate(input.begin(), input.end(), [&]() { return static_cast<T>(u8rng()); });
+  return input;
+}
+
+std::vector<int32_t> RandomIndices(size_t num_indices, size_t max_index) {
+  std::random_device random_device;
+  auto rng = std::mt19937(random_device());
+  auto index_rng = std::bind(std::uniform_int_distribution<int32_t>(0, int32_t(max_index) - 1), rng);
+  std::vector<int32_t> indices(num_indices);
+  std::generate(indices.begin(), indices.end(), std::ref(index_rng));
+  return indices;
+}
+
+template<class T>
+std::vector<T> Gather(
+  const std::vector<T>& input, const std::vector<size_t>& dims, size_t axis, const std::vector<int32_t>& indices)
+{
+  const size_t batch_size = std::accumulate(dims.cbegin(), dims.cbegin() + axis, size_t(1), std::multiplies<size_t>());
+  const size_t row_size = std::accumulate(dims.cbegin() + axis + 1, dims.cend(), size_t(1), std::multiplies<size_t>());
+  std::vector<T> output;
+  for (size_t b = 0; b < batch_size; b++) {
+    for (int32_t index : indices) {
+      for (size_t c = 0; c < row_size; c++) {
+        output.push_back(input[(b * dims[axis] + size_t(index)) * row_size + c]);
+      }
+    }
+  }
+  return output;
+}
+
+// Defines an external input with ID 0, external indices with ID 1, and an external output with ID 2.
+void DefineExternalValues(
+  xnn_subgraph_t subgraph,
+  xnn_datatype input_datatype,
+  xnn_datatype output_datatype,
+  const std::vector<size_t>& input_dims,
+  const std::vector<size_t>& indices_dims,
+  const std::vector<size_t>& output_dims,
+  uint32_t& input_id,
+  uint32_t& indices_id,
+  uint32_t& output_id)
+{
+  if (input_datatype == xnn_datatype_fp32) {
+    ASSERT_EQ(xnn_status_success, xnn_define_tensor_value(
+      subgraph, input_datatype, input_dims.size(), input_dims.data(), nullptr, 0,
+      XNN_VALUE_FLAG_EXTERNAL_INPUT, &input_id));
+  } else {
+    ASSERT_EQ(xnn_status_success, xnn_define_quantized_tensor_value(
+      subgraph, input_datatype, 7, 0.5f, input_dims.size(), input_dims.data(), nullptr, 0,
+      XNN_VALUE_FLAG_EXTERNAL_INPUT, &input_id));
+  }
+  ASSERT_EQ(xnn_status_success, xnn_define_tensor_value(
+    subgraph, xnn_datatype_int32, indices_dims.size(), indices_dims.data(), nullptr, 1,
+    XNN_VALUE_FLAG_EXTERNAL_INPUT, &indices_id));
+  if (output_datatype == xnn_datatype_fp32) {
+    ASSERT_EQ(xnn_status_success, xnn_define_tensor_value(
+      subgraph, output_datatype, output_dims.size(), output_dims.data(), nullptr, 2,
+      XNN_VALUE_FLAG_EXTERNAL_OUTPUT, &output_id));
+  } else {
+    ASSERT_EQ(xnn_status_success, xnn_define_quantized_tensor_value(
+      subgraph, output_datatype, 7, 0.5f, output_dims.size(), output_dims.data(), nullptr, 2,
+      XNN_VALUE_FLAG_EXTERNAL_OUTPUT, &output_id));
+  }
+}
+
+template<class T, class U>
+std::vector<U> Invoke(
+  xnn_runtime_t runtime, const std::vector<T>& input, const std::vector<int32_t>& indices, size_t output_num_elements)
+{
+  std::vector<U> output(output_num_elements);
+  const std::array<xnn_external_value, 3> external = {{
+    xnn_external_value{0, const_cast<T*>(input.data())},
+    xnn_external_value{1, const_cast<int32_t*>(indices.data())},
+    xnn_external_value{2, output.data()},
+  }};
+  EXPECT_EQ(xnn_status_success, xnn_setup_runtime(runtime, external.size(), external.data()));
+  EXPECT_EQ(xnn_status_success, xnn_invoke_runtime(runtime));
+  return output;
+}
+
+}  // namespace
+
+TEST(GATHER, embedding_f32) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  xnn_subgraph_t subgraph_ptr = nullptr;
+  ASSERT_EQ(xnn_status_success, xnn_create_subgraph(3, 0 /* flags */, &subgraph_ptr));
+  std::unique_ptr<xnn_subgraph, decltype(&xnn_delete_subgraph)> subgraph(subgraph_ptr, xnn_delete_subgraph);
+
+  const std::vector<size_t> input_dims = {113, 48};
+  const std::vector<size_t> indices_dims = {4, 9};
+  const std::vector<size_t> output_dims = {4, 9, 48};
+  uint32_t input_id = XNN_INVALID_VALUE_ID;
+  uint32_t indices_id = XNN_INVALID_VALUE_ID;
+  uint32_t output_id = XNN_INVALID_VALUE_ID;
+  DefineExternalValues(
+    subgraph.get(), xnn_datatype_fp32, xnn_datatype_fp32, input_dims, indices_dims, output_dims,
+    input_id, indices_id, output_id);
+  ASSERT_EQ(xnn_status_success, xnn_define_gather(subgraph.get(), 0, input_id, indices_id, output_id, 0 /* flags */));
+
+  xnn_runtime_t runtime_ptr = nullptr;
+  ASSERT_EQ(xnn_status_success, xnn_create_runtime_v2(subgraph.get(), nullptr, 0 /* flags */, &runtime_ptr));
+  std::unique_ptr<xnn_runtime, decltype(&xnn_delete_runtime)> runtime(runtime_ptr, xnn_delete_runtime);
+
+  const std::vector<float> input = RandomInput<float>(NumElements(input_dims));
+  const std::vector<int32_t> indices = RandomIndices(NumElements(indices_dims), input_dims[0]);
+  EXPECT_EQ(
+    Gather(input, input_dims, 0, indices),
+    (Invoke<float, float>(runtime.get(), input, indices, NumElements(output_dims))));
+}
+
+TEST(GATHER, middle_axis_qs8) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  xnn_subgraph_t subgraph_ptr = nullptr;
+  ASSERT_EQ(xnn_status_success, xnn_create_subgraph(3, 0 /* flags */, &subgraph_ptr));
+  std::unique_ptr<xnn_subgraph, decltype(&xnn_delete_subgraph)> subgraph(subgraph_ptr, xnn_delete_subgraph);
+
+  const std::vector<size_t> input_dims = {3, 11, 5};
+  const std::vector<size_t> indices_dims = {7};
+  const std::vector<size_t> output_dims = {3, 7, 5};
+  uint32_t input_id = XNN_INVALID_VALUE_ID;
+  uint32_t indices_id = XNN_INVALID_VALUE_ID;
+  uint32_t output_id = XNN_INVALID_VALUE_ID;
+  DefineExternalValues(
+    subgraph.get(), xnn_datatype_qint8, xnn_datatype_qint8, input_dims, indices_dims, output_dims,
+    input_id, indices_id, output_id);
+  ASSERT_EQ(xnn_status_success, xnn_define_gather(subgraph.get(), 1, input_id, indices_id, output_id, 0 /* flags */));
+
+  xnn_runtime_t runtime_ptr = nullptr;
+  ASSERT_EQ(xnn_status_success, xnn_create_runtime_v2(subgraph.get(), nullptr, 0 /* flags */, &runtime_ptr));
+  std::unique_ptr<xnn_runtime, decltype(&xnn_delete_runtime)> runtime(runtime_ptr, xnn_delete_runtime);
+
+  const std::vector<int8_t> input = RandomInput<int8_t>(NumElements(input_dims));
+  const std::vector<int32_t> indices = RandomIndices(NumElements(indices_dims), input_dims[1]);
+  EXPECT_EQ(
+    Gather(input, input_dims, 1, indices),
+    (Invoke<int8_t, int8_t>(runtime.get(), input, indices, NumElements(output_dims))));
+}
+
+TEST(GATHER, dequantizing_qu8_to_f32) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  xnn_subgraph_t subgraph_ptr = nullptr;
+  ASSERT_EQ(xnn_status_success, xnn_create_subgraph(3, 0 /* flags */, &subgraph_ptr));
+  std::unique_ptr<xnn_subgraph, decltype(&xnn_delete_subgraph)> subgraph(subgraph_ptr, xnn_delete_subgraph);
+
+  const std::vector<size_t> input_dims = {61, 20};
+  const std::vector<size_t> indices_dims = {15};
+  const std::vector<size_t> output_dims = {15, 20};
+  uint32_t input_id = XNN_INVALID_VALUE_ID;
+  uint32_t indices_id = XNN_INVALID_VALUE_ID;
+  uint32_t output_id = XNN_INVALID_VALUE_ID;
+  DefineExternalValues(
+    subgraph.get(), xnn_datatype_quint8, xnn_datatype_fp32, input_dims, indices_dims, output_dims,
+    input_id, indices_id, output_id);
+  ASSERT_EQ(xnn_status_success, xnn_define_gather(subgraph.get(), 0, input_id, indices_id, output_id, 0 /* flags */));
+
+  xnn_runtime_t runtime_ptr = nullptr;
+  ASSERT_EQ(xnn_status_success, xnn_create_runtime_v2(subgraph.get(), nullptr, 0 /* flags */, &runtime_ptr));
+  std::unique_ptr<xnn_runtime, decltype(&xnn_delete_runtime)> runtime(runtime_ptr, xnn_delete_runtime);
+
+  const std::vector<uint8_t> input = RandomInput<uint8_t>(NumElements(input_dims));
+  const std::vector<int32_t> indices = RandomIndices(NumElements(indices_dims), input_dims[0]);
+  const std::vector<uint8_t> gathered = Gather(input, input_dims, 0, indices);
+  std::vector<float> expected(gathered.size());
+  std::transform(gathered.cbegin(), gathered.cend(), expected.begin(),
+    [](uint8_t x) { return float(int32_t(x) - 7) * 0.5f; });
+  EXPECT_EQ(expected, (Invoke<uint8_t, float>(runtime.get(), input, indices, NumElements(output_dims))));
+}
+
+TEST(GATHER, reshape) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  xnn_subgraph_t subgraph_ptr = nullptr;
+  ASSERT_EQ(xnn_status_success, xnn_create_subgraph(3, 0 /* flags */, &subgraph_ptr));
+  std::unique_ptr<xnn_subgraph, decltype(&xnn_delete_subgraph)> subgraph(subgraph_ptr, xnn_delete_subgraph);
+
+  const std::vector<size_t> input_dims = {50, 16};
+  const std::vector<size_t> indices_dims = {2, 3};
+  const std::vector<size_t> output_dims = {2, 3, 16};
+  uint32_t input_id = XNN_INVALID_VALUE_ID;
+  uint32_t indices_id = XNN_INVALID_VALUE_ID;
+  uint32_t output_id = XNN_INVALID_VALUE_ID;
+  DefineExternalValues(
+    subgraph.get(), xnn_datatype_fp32, xnn_datatype_fp32, input_dims, indices_dims, output_dims,
+    input_id, indices_id, output_id);
+  ASSERT_EQ(xnn_status_success, xnn_define_gather(subgraph.get(), 0, input_id, indices_id, output_id, 0 /* flags */));
+
+  xnn_runtime_t runtime_ptr = nullptr;
+  ASSERT_EQ(xnn_status_success, xnn_create_runtime_v2(subgraph.get(), nullptr, 0 /* flags */, &runtime_ptr));
+  std::unique_ptr<xnn_runtime, decltype(&xnn_delete_runtime)> runtime(runtime_ptr, xnn_delete_runtime);
+
+  // Batches of a different number of lookups reuse the same runtime.
+  const std::vector<size_t> new_indices_dims = {5, 7};
+  ASSERT_EQ(xnn_status_success,
+    xnn_reshape_external_value(runtime.get(), indices_id, new_indices_dims.size(), new_indices_dims.data()));
+  ASSERT_EQ(xnn_status_success, xnn_reshape_runtime(runtime.get()));
+
+  size_t num_dims = 0;
+  std::array<size_t, XNN_MAX_TENSOR_DIMS> new_output_dims;
+  ASSERT_EQ(xnn_status_success,
+    xnn_get_external_value_shape(runtime.get(), output_id, &num_dims, new_output_dims.data()));
+  ASSERT_EQ(3, num_dims);
+  EXPECT_EQ(5, new_output_dims[0]);
+  EXPECT_EQ(7, new_output_dims[1]);
+  EXPECT_EQ(16, new_output_dims[2]);
+
+  const std::vector<float> input = RandomInput<float>(NumElements(input_dims));
+  const std::vector<int32_t> indices = RandomIndices(NumElements(new_indices_dims), input_dims[0]);
+  EXPECT_EQ(
+    Gather(input, input_dims, 0, indices),
+    (Invoke<float, float>(runtime.get(), input, indices, 5 * 7 * 16)));
+}
+
+TEST(GATHER, indices_at_axis_boundary) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  xnn_subgraph_t subgraph_ptr = nullptr;
+  ASSERT_EQ(xnn_status_success, xnn_create_subgraph(3, 0 /* flags */, &subgraph_ptr));
+  std::unique_ptr<xnn_subgraph, decltype(&xnn_delete_subgraph)> subgraph(subgraph_ptr, xnn_delete_subgraph);
+
+  const std::vector<size_t> input_dims = {3, 11, 5};
+  const std::vector<size_t> indices_dims = {6};
+  const std::vector<size_t> output_dims = {3, 6, 5};
+  uint32_t input_id = XNN_INVALID_VALUE_ID;
+  uint32_t indices_id = XNN_INVALID_VALUE_ID;
+  uint32_t output_id = XNN_INVALID_VALUE_ID;
+  DefineExternalValues(
+    subgraph.get(), xnn_datatype_fp32, xnn_datatype_fp32, input_dims, indices_dims, output_dims,
+    input_id, indices_id, output_id);
+  ASSERT_EQ(xnn_status_success, xnn_define_gather(subgraph.get(), 1, input_id, indices_id, output_id, 0 /* flags */));
+
+  xnn_runtime_t runtime_ptr = nullptr;
+  ASSERT_EQ(xnn_status_success, xnn_create_runtime_v2(subgraph.get(), nullptr, 0 /* flags */, &runtime_ptr));
+  std::unique_ptr<xnn_runtime, decltype(&xnn_delete_runtime)> runtime(runtime_ptr, xnn_delete_runtime);
+
+  const std::vector<float> input = RandomInput<float>(NumElements(input_dims));
+  const std::vector<int32_t> indices = {10, 0, 10, 1, 9, 0};
+  EXPECT_EQ(
+    Gather(input, input_dims, 1, indices),
+    (Invoke<float, float>(runtime.get(), input, indices, NumElements(output_dims))));
+}
+
+TEST(GATHER, validates_static_indices) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+
+  const std::vector<size_t> input_dims = {7, 4};
+  const std::vector<size_t> indices_dims = {3};
+  const std::vector<size_t> output_dims = {3, 4};
+  for (const std::vector<int32_t>& indices : {
+      std::vector<int32_t>{6, 0, 6}, std::vector<int32_t>{0, 7, 1}, std::vector<int32_t>{-1, 0, 1}})
+  {
+    xnn_subgraph_t subgraph_ptr = nullptr;
+    ASSERT_EQ(xnn_status_success, xnn_create_subgraph(2, 0 /* flags */, &subgraph_ptr));
+    std::unique_ptr<xnn_subgraph, decltype(&xnn_delete_subgraph)> subgraph(subgraph_ptr, xnn_delete_subgraph);
+    uint32_t input_id = XNN_INVALID_VALUE_ID;
+    ASSERT_EQ(xnn_status_success, xnn_define_tensor_value(
+      subgraph.get(), xnn_datatype_fp32, input_dims.size(), input_dims.data(), nullptr, 0,
+      XNN_VALUE_FLAG_EXTERNAL_INPUT, &input_id));
+    uint32_t indices_id = XNN_INVALID_VALUE_ID;
+    ASSERT_EQ(xnn_status_success, xnn_define_tensor_value(
+      subgraph.get(), xnn_datatype_int32, indices_dims.size(), indices_dims.data(), indices.data(),
+      XNN_INVALID_VALUE_ID, 0 /* flags */, &indices_id));
+    uint32_t output_id = XNN_INVALID_VALUE_ID;
+    ASSERT_EQ(xnn_status_success, xnn_define_tensor_value(
+      subgraph.get(), xnn_datatype_fp32, output_dims.size(), output_dims.data(), nullptr, 1,
+      XNN_VALUE_FLAG_EXTERNAL_OUTPUT, &output_id));
+    ASSERT_EQ(xnn_status_success,
+      xnn_define_gather(subgraph.get(), 0, input_id, indices_id, output_id, 0 /* flags */));
+
+    xnn_runtime_t runtime_ptr = nullptr;
+    ASSERT_EQ(xnn_status_success, xnn_create_runtime_v2(subgraph.get(), nullptr, 0 /* flags */, &runtime_ptr));
+    std::unique_ptr<xnn_runtime, decltype(&xnn_delete_runtime)> runtime(runtime_ptr, xnn_delete_runtime);
+
+    const std::vector<float> input = RandomInput<float>(NumElements(input_dims));
+    std::vector<float> output(NumElements(output_dims));
+    const std::array<xnn_external_value, 2> external = {{
+      xnn_external_value{0, const_cast<float*>(input.data())},
+      xnn_external_value{1, output.data()},
+    }};
+    const bool in_range = std::all_of(indices.cbegin(), indices.cend(),
+      [&](int32_t index) { return index >= 0 && size_t(index) < input_dims[0]; });
+    if (in_range) {
+      ASSERT_EQ(xnn_status_success, xnn_setup_runtime(runtime.get(), external.size(), external.data()));
+      ASSERT_EQ(xnn_status_success, xnn_invoke_runtime(runtime.get()));
+      EXPECT_EQ(Gather(input, input_dims, 0, indices), output);
+    } else {
+      EXPECT_EQ(xnn_status_invalid_parameter, xnn_setup_runtime(runtime.get(), external.size(), external.data()));
+    }
+  }
+}
+
+TEST(GATHER, validates_dynamic_indices) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  xnn_subgraph_t subgraph_ptr = nullptr;
+  ASSERT_EQ(xnn_status_success, xnn_create_subgraph(3, 0 /* flags */, &subgraph_ptr));
+  std::unique_ptr<xnn_subgraph, decltype(&xnn_delete_subgraph)> subgraph(subgraph_ptr, xnn_delete_subgraph);
+
+  const std::vector<size_t> input_dims = {7, 4};
+  const std::vector<size_t> indices_dims = {3};
+  const std::vector<size_t> output_dims = {3, 4};
+  uint32_t input_id = XNN_INVALID_VALUE_ID;
+  uint32_t indices_id = XNN_INVALID_VALUE_ID;
+  uint32_t output_id = XNN_INVALID_VALUE_ID;
+  DefineExternalValues(
+    subgraph.get(), xnn_datatype_fp32, xnn_datatype_fp32, input_dims, indices_dims, output_dims,
+    input_id, indices_id, output_id);
+  ASSERT_EQ(xnn_status_success, xnn_define_gather(subgraph.get(), 0, input_id, indices_id, output_id, 0 /* flags */));
+
+  xnn_runtime_t runtime_ptr = nullptr;
+  ASSERT_EQ(xnn_status_success, xnn_create_runtime_v2(subgraph.get(), nullptr, 0 /* flags */, &runtime_ptr));
+  std::unique_ptr<xnn_runtime, decltype(&xnn_delete_runtime)> runtime(runtime_ptr, xnn_delete_runtime);
+
+  const std::vector<float> input = RandomInput<float>(NumElements(input_dims));
+  std::vector<int32_t> indices = {6, 0, 6};
+  std::vector<float> output(NumElements(output_dims));
+  const std::array<xnn_external_value, 3> external = {{
+    xnn_external_value{0, const_cast<float*>(input.data())},
+    xnn_external_value{1, indices.data()},
+    xnn_external_value{2, output.data()},
+  }};
+  ASSERT_EQ(xnn_status_success, xnn_setup_runtime(runtime.get(), external.size(), external.data()));
+  ASSERT_EQ(xnn_status_success, xnn_invoke_runtime(runtime.get()));
+  EXPECT_EQ(Gather(input, input_dims, 0, indices), output);
+
+  // Dynamic indices are only known when the Runtime is invoked.
+  for (int32_t index : {7, -1}) {
+    indices[2] = index;
+    EXPECT_EQ(xnn_status_invalid_parameter, xnn_invoke_runtime(runtime.get()));
+  }
+}
+
+TEST(GATHER, rejects_invalid_definitions) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  xnn_subgraph_t subgraph_ptr = nullptr;
+  ASSERT_EQ(xnn_status_success, xnn_create_subgraph(4, 0 /* flags */, &subgraph_ptr));
+  std::unique_ptr<xnn_subgraph, decltype(&xnn_delete_subgraph)> subgraph(subgraph_ptr, xnn_delete_subgraph);
+
+  const std::vector<size_t> input_dims = {10, 4};
+  const std::vector<size_t> indices_dims = {6};
+  const std::vector<size_t> output_dims = {6, 4};
+  uint32_t input_id = XNN_INVALID_VALUE_ID;
+  uint32_t indices_id = XNN_INVALID_VALUE_ID;
+  uint32_t output_id = XNN_INVALID_VALUE_ID;
+  DefineExternalValues(
+    subgraph.get(), xnn_datatype_fp32, xnn_datatype_fp32, input_dims, indices_dims, output_dims,
+    input_id, indices_id, output_id);
+
+  // Indices must be 32-bit integers.
+  uint32_t float_indices_id = XNN_INVALID_VALUE_ID;
+  ASSERT_EQ(xnn_status_success, xnn_define_tensor_value(
+    subgraph.get(), xnn_datatype_fp32, indices_dims.size(), indices_dims.data(), nullptr, 3,
+    XNN_VALUE_FLAG_EXTERNAL_INPUT, &float_indices_id));
+  EXPECT_EQ(xnn_status_invalid_parameter,
+    xnn_define_gather(subgraph.get(), 0, input_id, float_indices_id, output_id, 0 /* flags */));
+  // The axis must index the input.
+  EXPECT_EQ(xnn_status_invalid_parameter,
+    xnn_define_gather(subgraph.get(), 2, input_id, indices_id, output_id, 0 /* flags */));
+  // The output shape doesn't match a gather along the second axis.
+  EXPECT_EQ(xnn_status_invalid_parameter,
+    xnn_define_gather(subgraph.get(), 1, input_id, indices_id, output_id, 0 /* flags */));
+  EXPECT_EQ(xnn_status_success,
+    xnn_define_gather(subgraph.get(), 0, input_id, indices_id, output_id, 0 /* flags */));
+}
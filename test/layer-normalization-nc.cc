@@ -0,0 +1,103 @@
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <gtest/gtest.h>
+
+#include "layer-normalization-operator-tester.h"
+
+
+TEST(LAYER_NORMALIZATION_NC_F32, single_channel) {
+  LayerNormalizationOperatorTester()
+    .batch_size(1)
+    .channels(1)
+    .iterations(100)
+    .TestF32();
+}
+
+TEST(LAYER_NORMALIZATION_NC_F32, many_channels) {
+  for (size_t channels = 2; channels < 100; channels++) {
+    LayerNormalizationOperatorTester()
+      .batch_size(1)
+      .channels(channels)
+      .iterations(3)
+      .TestF32();
+  }
+}
+
+TEST(LAYER_NORMALIZATION_NC_F32, transformer_channels) {
+  for (size_t channels : {384, 512, 768, 1024}) {
+    LayerNormalizationOperatorTester()
+      .batch_size(3)
+      .channels(channels)
+      .iterations(3)
+      .TestF32();
+  }
+}
+
+TEST(LAYER_NORMALIZATION_NC_F32, small_batch) {
+  for (size_t channels = 1; channels < 100; channels += 15) {
+    LayerNormalizationOperatorTester()
+      .batch_size(12)
+      .channels(channels)
+      .iterations(3)
+      .TestF32();
+  }
+}
+
+TEST(LAYER_NORMALIZATION_NC_F32, small_batch_with_input_stride) {
+  for (size_t channels = 1; channels < 100; channels += 15) {
+    LayerNormalizationOperatorTester()
+      .batch_size(12)
+      .channels(channels)
+      .input_stride(129)
+      .iterations(3)
+      .TestF32();
+  }
+}
+
+TEST(LAYER_NORMALIZATION_NC_F32, small_batch_with_output_stride) {
+  for (size_t channels = 1; channels < 100; channels += 15) {
+    LayerNormalizationOperatorTester()
+      .batch_size(12)
+      .channels(channels)
+      .output_stride(117)
+      .iterations(3)
+      .TestF32();
+  }
+}
+
+TEST(LAYER_NORMALIZATION_NC_F32, strided_batch_with_input_and_output_stride) {
+  for (size_t channels = 1; channels < 100; channels += 15) {
+    LayerNormalizationOperatorTester()
+      .batch_size(12)
+      .channels(channels)
+      .input_stride(129)
+      .output_stride(117)
+      .iterations(3)
+      .TestF32();
+  }
+}
+
+TEST(LAYER_NORMALIZATION_NC_F32, large_epsilon) {
+  for (size_t channels = 1; channels < 100; channels += 15) {
+    LayerNormalizationOperatorTester()
+      .batch_size(3)
+      .channels(channels)
+      .epsilon(0.5f)
+      .iterations(3)
+      .TestF32();
+  }
+}
+
+TEST(LAYER_NORMALIZATION_NC_F32, large_input_offset) {
+  for (size_t channels = 1; channels < 100; channels += 15) {
+    LayerNormalizationOperatorTester()
+      .batch_size(3)
+      .channels(channels)
+      .input_offset(100.0f)
+      .iterations(3)
+      .TestF32();
+  }
+}
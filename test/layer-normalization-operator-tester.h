@@ -0,0 +1,186 @@
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <cstdlib>
+#include <functional>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include <xnnpack.h>
+
+
+class LayerNormalizationOperatorTester {
+ public:
+  inline LayerNormalizationOperatorTester& channels(size_t channels) {
+    assert(channels != 0);
+    this->channels_ = channels;
+    return *this;
+  }
+
+  inline size_t channels() const {
+    return this->channels_;
+  }
+
+  inline LayerNormalizationOperatorTester& input_stride(size_t input_stride) {
+    assert(input_stride != 0);
+    this->input_stride_ = input_stride;
+    return *this;
+  }
+
+  inline size_t input_stride() const {
+    if (this->input_stride_ == 0) {
+      return this->channels_;
+    } else {
+      assert(this->input_stride_ >= this->channels_);
+      return this->input_stride_;
+    }
+  }
+
+  inline LayerNormalizationOperatorTester& output_stride(size_t output_stride) {
+    assert(output_stride != 0);
+    this->output_stride_ = output_stride;
+    return *this;
+  }
+
+  inline size_t output_stride() const {
+    if (this->output_stride_ == 0) {
+      return this->channels_;
+    } else {
+      assert(this->output_stride_ >= this->channels_);
+      return this->output_stride_;
+    }
+  }
+
+  inline LayerNormalizationOperatorTester& batch_size(size_t batch_size) {
+    assert(batch_size != 0);
+    this->batch_size_ = batch_size;
+    return *this;
+  }
+
+  inline size_t batch_size() const {
+    return this->batch_size_;
+  }
+
+  inline LayerNormalizationOperatorTester& epsilon(float epsilon) {
+    assert(epsilon > 0.0f);
+    assert(std::isnormal(epsilon));
+    this->epsilon_ = epsilon;
+    return *this;
+  }
+
+  inline float epsilon() const {
+    return this->epsilon_;
+  }
+
+  inline LayerNormalizationOperatorTester& input_offset(float input_offset) {
+    this->input_offset_ = input_offset;
+    return *this;
+  }
+
+  inline float input_offset() const {
+    return this->input_offset_;
+  }
+
+  inline LayerNormalizationOperatorTester& iterations(size_t iterations) {
+    this->iterations_ = iterations;
+    return *this;
+  }
+
+  inline size_t iterations() const {
+    return this->iterations_;
+  }
+
+  void TestF32() const {
+    std::random_device random_device;
+    auto rng = std::mt19937(random_device());
+    auto f32irng = std::bind(std::uniform_real_distribution<float>(input_offset() - 1.0f, input_offset() + 1.0f), rng);
+    auto f32wrng = std::bind(std::uniform_real_distribution<float>(0.5f, 1.5f), rng);
+
+    std::vector<float> input((batch_size() - 1) * input_stride() + channels() + XNN_EXTRA_BYTES / sizeof(float));
+    std::vector<float> gamma(channels());
+    std::vector<float> beta(channels());
+    std::vector<float> output((batch_size() - 1) * output_stride() + channels());
+    std::vector<double> output_ref(batch_size() * channels());
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(input.begin(), input.end(), std::ref(f32irng));
+      std::generate(gamma.begin(), gamma.end(), std::ref(f32wrng));
+      std::generate(beta.begin(), beta.end(), std::ref(f32wrng));
+      std::fill(output.begin(), output.end(), std::nanf(""));
+
+      // Compute reference results.
+      for (size_t i = 0; i < batch_size(); i++) {
+        double sum = 0.0;
+        for (size_t c = 0; c < channels(); c++) {
+          sum += double(input[i * input_stride() + c]);
+        }
+        const double mean = sum / double(channels());
+        double sum_sq_dev = 0.0;
+        for (size_t c = 0; c < channels(); c++) {
+          const double dev = double(input[i * input_stride() + c]) - mean;
+          sum_sq_dev += dev * dev;
+        }
+        const double inv_stddev = 1.0 / std::sqrt(sum_sq_dev / double(channels()) + double(epsilon()));
+        for (size_t c = 0; c < channels(); c++) {
+          output_ref[i * channels() + c] =
+            (double(input[i * input_stride() + c]) - mean) * inv_stddev * double(gamma[c]) + double(beta[c]);
+        }
+      }
+
+      // Create, setup, run, and destroy Layer Normalization operator.
+      ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+      xnn_operator_t layer_normalization_op = nullptr;
+
+      ASSERT_EQ(xnn_status_success,
+        xnn_create_layer_normalization_nc_f32(
+          channels(), input_stride(), output_stride(),
+          epsilon(), gamma.data(), beta.data(),
+          0, &layer_normalization_op));
+      ASSERT_NE(nullptr, layer_normalization_op);
+
+      // Smart pointer to automatically delete layer_normalization_op.
+      std::unique_ptr<xnn_operator, decltype(&xnn_delete_operator)> auto_layer_normalization_op(layer_normalization_op, xnn_delete_operator);
+
+      ASSERT_EQ(xnn_status_success,
+        xnn_setup_layer_normalization_nc_f32(
+          layer_normalization_op,
+          batch_size(),
+          input.data(), output.data(),
+          nullptr /* thread pool */));
+
+      ASSERT_EQ(xnn_status_success,
+        xnn_run_operator(layer_normalization_op, nullptr /* thread pool */));
+
+      // Verify results.
+      for (size_t i = 0; i < batch_size(); i++) {
+        for (size_t c = 0; c < channels(); c++) {
+          ASSERT_NEAR(
+            double(output[i * output_stride() + c]),
+            output_ref[i * channels() + c],
+            std::max(std::abs(output_ref[i * channels() + c]) * 1.0e-4, 1.0e-4))
+            << "at batch index " << i << " / " << batch_size()
+            << ", channel " << c << " / " << channels();
+        }
+      }
+    }
+  }
+
+ private:
+  size_t batch_size_{1};
+  size_t channels_{1};
+  size_t input_stride_{0};
+  size_t output_stride_{0};
+  float epsilon_{1.0e-5f};
+  float input_offset_{0.0f};
+  size_t iterations_{15};
+};
@@ -3,6 +3,11 @@
 // This source code is licensed under the BSD-style license found in the
 // LICENSE file in the root directory of this source tree.
 
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+
 #include <xnnpack.h>
 #include <xnnpack/memory-planner.h>
 #include <xnnpack/subgraph.h>
@@ -17,7 +22,7 @@ TEST(MemoryPlanner, ValueLiveInfo) {
   struct xnn_subgraph subgraph;
   subgraph.num_values = 4;
   subgraph.num_nodes = 2;
-  struct xnn_node nodes[2];
+  struct xnn_node nodes[2] = {};
   nodes[0].num_inputs = 2;
   nodes[0].inputs[0] = 0;
   nodes[0].inputs[1] = 1;
@@ -164,3 +169,366 @@ TEST(MemoryPlanner, GeneralPlanning) {
 
   xnn_release_value_allocation_tracker(&tracker);
 }
+
+TEST(MemoryPlanner, ScheduledValueLiveInfo) {
+  EXPECT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  // Create subgraph with 3 nodes, where N0 and N1 are independent and share an execution step:
+  // T0 ----> N0 ----> T1 ----> N2 ----> T3
+  // T0 ----> N1 ----> T2 ----/
+  struct xnn_subgraph subgraph;
+  subgraph.num_values = 4;
+  subgraph.num_nodes = 3;
+  struct xnn_node nodes[3] = {};
+  nodes[0].num_inputs = 1;
+  nodes[0].inputs[0] = 0;
+  nodes[0].num_outputs = 1;
+  nodes[0].outputs[0] = 1;
+
+  nodes[1].num_inputs = 1;
+  nodes[1].inputs[0] = 0;
+  nodes[1].num_outputs = 1;
+  nodes[1].outputs[0] = 2;
+
+  nodes[2].num_inputs = 2;
+  nodes[2].inputs[0] = 1;
+  nodes[2].inputs[1] = 2;
+  nodes[2].num_outputs = 1;
+  nodes[2].outputs[0] = 3;
+  subgraph.nodes = nodes;
+
+  const uint32_t node_steps[3] = {0, 0, 1};
+  struct xnn_value_allocation_tracker tracker;
+  xnn_init_scheduled_value_allocation_tracker(&tracker, &subgraph, node_steps);
+
+#if XNN_ENABLE_MEMOPT
+  EXPECT_EQ(0, tracker.usage[0].first_node);
+  EXPECT_EQ(0, tracker.usage[0].last_node);
+
+  EXPECT_EQ(0, tracker.usage[1].first_node);
+  EXPECT_EQ(1, tracker.usage[1].last_node);
+
+  EXPECT_EQ(0, tracker.usage[2].first_node);
+  EXPECT_EQ(1, tracker.usage[2].last_node);
+
+  EXPECT_EQ(1, tracker.usage[3].first_node);
+  EXPECT_EQ(1, tracker.usage[3].last_node);
+#endif
+
+  xnn_add_value_allocation_tracker(&tracker, 0, 64);
+  xnn_add_value_allocation_tracker(&tracker, 1, 64);
+  xnn_add_value_allocation_tracker(&tracker, 2, 64);
+  xnn_add_value_allocation_tracker(&tracker, 3, 64);
+  xnn_plan_value_allocation_tracker(&tracker);
+
+#if XNN_ENABLE_MEMOPT
+  // T0, T1, and T2 are live at once while N0 and N1 run concurrently.
+  EXPECT_EQ(256, tracker.mem_arena_size);
+  EXPECT_EQ(0, tracker.usage[0].alloc_offset);
+  EXPECT_EQ(64, tracker.usage[1].alloc_offset);
+  EXPECT_EQ(128, tracker.usage[2].alloc_offset);
+  EXPECT_EQ(192, tracker.usage[3].alloc_offset);
+#endif
+
+  xnn_release_value_allocation_tracker(&tracker);
+}
+
+TEST(MemoryPlanner, InPlaceElementwise) {
+  EXPECT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  // Create subgraph where Clamp and Add can overwrite their inputs, but Add can't overwrite T0 which N0 also reads:
+  // T0 ----> N0 (Fully Connected) ----> T1 ----> N1 (Clamp) ----> T2 ----> N2 (Add) ----> T3
+  // T0 --------------------------------------------------------------------/
+  struct xnn_subgraph subgraph;
+  subgraph.num_values = 4;
+  subgraph.num_nodes = 3;
+  struct xnn_value values[4] = {};
+  for (uint32_t i = 0; i < 4; i++) {
+    values[i].datatype = xnn_datatype_fp32;
+  }
+  subgraph.values = values;
+  struct xnn_node nodes[3] = {};
+  nodes[0].type = xnn_node_type_fully_connected;
+  nodes[0].num_inputs = 1;
+  nodes[0].inputs[0] = 0;
+  nodes[0].num_outputs = 1;
+  nodes[0].outputs[0] = 1;
+
+  nodes[1].type = xnn_node_type_clamp;
+  nodes[1].num_inputs = 1;
+  nodes[1].inputs[0] = 1;
+  nodes[1].num_outputs = 1;
+  nodes[1].outputs[0] = 2;
+
+  nodes[2].type = xnn_node_type_add2;
+  nodes[2].num_inputs = 2;
+  nodes[2].inputs[0] = 0;
+  nodes[2].inputs[1] = 2;
+  nodes[2].num_outputs = 1;
+  nodes[2].outputs[0] = 3;
+  subgraph.nodes = nodes;
+
+  struct xnn_value_allocation_tracker tracker;
+  xnn_init_value_allocation_tracker(&tracker, &subgraph);
+  xnn_add_value_allocation_tracker(&tracker, 0, 64);
+  xnn_add_value_allocation_tracker(&tracker, 1, 64);
+  xnn_add_value_allocation_tracker(&tracker, 2, 64);
+  xnn_add_value_allocation_tracker(&tracker, 3, 64);
+  xnn_plan_value_allocation_tracker(&tracker);
+
+#if XNN_ENABLE_MEMOPT
+  EXPECT_EQ(128, tracker.mem_arena_size);
+  EXPECT_EQ(XNN_INVALID_VALUE_ID, tracker.usage[1].reuse_value_id);
+  EXPECT_EQ(1, tracker.usage[2].reuse_value_id);
+  EXPECT_EQ(2, tracker.usage[3].reuse_value_id);
+  EXPECT_NE(tracker.usage[0].alloc_offset, tracker.usage[1].alloc_offset);
+  EXPECT_EQ(tracker.usage[1].alloc_offset, tracker.usage[2].alloc_offset);
+  EXPECT_EQ(tracker.usage[1].alloc_offset, tracker.usage[3].alloc_offset);
+#endif
+
+  xnn_release_value_allocation_tracker(&tracker);
+}
+
+TEST(MemoryPlanner, InPlaceRequiresSameSize) {
+  EXPECT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  // Create subgraph where Multiply broadcasts T0, and can only overwrite T1:
+  // T0 ----> N0 (Multiply) ----> T2
+  // T1 ----/
+  struct xnn_subgraph subgraph;
+  subgraph.num_values = 3;
+  subgraph.num_nodes = 1;
+  struct xnn_value values[3] = {};
+  for (uint32_t i = 0; i < 3; i++) {
+    values[i].datatype = xnn_datatype_fp32;
+  }
+  subgraph.values = values;
+  struct xnn_node nodes[1] = {};
+  nodes[0].type = xnn_node_type_multiply2;
+  nodes[0].num_inputs = 2;
+  nodes[0].inputs[0] = 0;
+  nodes[0].inputs[1] = 1;
+  nodes[0].num_outputs = 1;
+  nodes[0].outputs[0] = 2;
+  subgraph.nodes = nodes;
+
+  struct xnn_value_allocation_tracker tracker;
+  xnn_init_value_allocation_tracker(&tracker, &subgraph);
+  xnn_add_value_allocation_tracker(&tracker, 0, 16);
+  xnn_add_value_allocation_tracker(&tracker, 1, 64);
+  xnn_add_value_allocation_tracker(&tracker, 2, 64);
+  xnn_plan_value_allocation_tracker(&tracker);
+
+#if XNN_ENABLE_MEMOPT
+  EXPECT_EQ(80, tracker.mem_arena_size);
+  EXPECT_EQ(1, tracker.usage[2].reuse_value_id);
+  EXPECT_EQ(tracker.usage[1].alloc_offset, tracker.usage[2].alloc_offset);
+#endif
+
+  xnn_release_value_allocation_tracker(&tracker);
+}
+
+namespace {
+
+// Create subgraph where Concatenate joins the outputs of two Clamp xnn_nodes along axis 1:
+// T0 ----> N0 (Clamp) ----> T1 ----> N2 (Concatenate) ----> T3
+// T0 ----> N1 (Clamp) ----> T2 ----/
+void PlanConcatenate(size_t batch_size, struct xnn_value (&values)[4], struct xnn_value_allocation_tracker* tracker) {
+  struct xnn_subgraph subgraph;
+  subgraph.num_values = 4;
+  subgraph.num_nodes = 3;
+  for (uint32_t i = 0; i < 4; i++) {
+    values[i] = {};
+    values[i].type = xnn_value_type_dense_tensor;
+    values[i].datatype = xnn_datatype_fp32;
+    values[i].shape.num_dims = 2;
+    values[i].shape.dim[0] = batch_size;
+    values[i].shape.dim[1] = i == 3 ? 16 : 8;
+    values[i].producer = i == 0 ? XNN_INVALID_NODE_ID : i - 1;
+  }
+  subgraph.values = values;
+  struct xnn_node nodes[3] = {};
+  nodes[0].type = xnn_node_type_clamp;
+  nodes[0].num_inputs = 1;
+  nodes[0].inputs[0] = 0;
+  nodes[0].num_outputs = 1;
+  nodes[0].outputs[0] = 1;
+
+  nodes[1].type = xnn_node_type_clamp;
+  nodes[1].num_inputs = 1;
+  nodes[1].inputs[0] = 0;
+  nodes[1].num_outputs = 1;
+  nodes[1].outputs[0] = 2;
+
+  nodes[2].type = xnn_node_type_concatenate2;
+  nodes[2].params.concatenate.axis = 1;
+  nodes[2].num_inputs = 2;
+  nodes[2].inputs[0] = 1;
+  nodes[2].inputs[1] = 2;
+  nodes[2].num_outputs = 1;
+  nodes[2].outputs[0] = 3;
+  subgraph.nodes = nodes;
+
+  xnn_init_value_allocation_tracker(tracker, &subgraph);
+  for (uint32_t i = 0; i < 4; i++) {
+    xnn_add_value_allocation_tracker(tracker, i, xnn_tensor_get_size(&subgraph, i));
+  }
+  xnn_plan_value_allocation_tracker(tracker);
+}
+
+}  // namespace
+
+TEST(MemoryPlanner, ConcatenateOutermostAxisInPlace) {
+  EXPECT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  struct xnn_value values[4];
+  struct xnn_value_allocation_tracker tracker;
+  PlanConcatenate(1, values, &tracker);
+
+#if XNN_ENABLE_MEMOPT
+  // Clamp xnn_nodes write T1 and T2 directly into their slices of T3.
+  EXPECT_EQ(96, tracker.mem_arena_size);
+  EXPECT_EQ(3, tracker.usage[1].reuse_value_id);
+  EXPECT_EQ(3, tracker.usage[2].reuse_value_id);
+  EXPECT_EQ(tracker.usage[3].alloc_offset, tracker.usage[1].alloc_offset);
+  EXPECT_EQ(tracker.usage[3].alloc_offset + 32, tracker.usage[2].alloc_offset);
+  EXPECT_EQ(0, tracker.usage[3].first_node);
+#endif
+
+  xnn_release_value_allocation_tracker(&tracker);
+}
+
+TEST(MemoryPlanner, ConcatenateInnerAxisCopies) {
+  EXPECT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  struct xnn_value values[4];
+  struct xnn_value_allocation_tracker tracker;
+  PlanConcatenate(2, values, &tracker);
+
+#if XNN_ENABLE_MEMOPT
+  // Slices of T3 are strided, so Concatenate copies T1 and T2.
+  EXPECT_EQ(XNN_INVALID_VALUE_ID, tracker.usage[1].reuse_value_id);
+  EXPECT_EQ(XNN_INVALID_VALUE_ID, tracker.usage[2].reuse_value_id);
+  EXPECT_EQ(256, tracker.mem_arena_lower_bound);
+#endif
+
+  xnn_release_value_allocation_tracker(&tracker);
+}
+
+TEST(MemoryPlanner, GreedyBySize) {
+  EXPECT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  struct xnn_subgraph subgraph;
+  subgraph.num_nodes = 0;
+  subgraph.num_values = 4;
+  for (int strategy = xnn_memory_planning_strategy_smallest_gap;
+       strategy <= xnn_memory_planning_strategy_greedy_by_size; strategy++)
+  {
+    struct xnn_value_allocation_tracker tracker;
+    xnn_init_value_allocation_tracker(&tracker, &subgraph);
+    tracker.strategy = static_cast<xnn_memory_planning_strategy>(strategy);
+    // As this is an empty subgraph, we create the following xnn_value_usage stub.
+    tracker.usage[0].first_node = 0,
+    tracker.usage[0].last_node = 0,
+    xnn_add_value_allocation_tracker(&tracker, 0, 100);
+
+    tracker.usage[1].first_node = 1,
+    tracker.usage[1].last_node = 1,
+    xnn_add_value_allocation_tracker(&tracker, 1, 60);
+
+    tracker.usage[2].first_node = 1,
+    tracker.usage[2].last_node = 2,
+    xnn_add_value_allocation_tracker(&tracker, 2, 30);
+
+    tracker.usage[3].first_node = 2,
+    tracker.usage[3].last_node = 2,
+    xnn_add_value_allocation_tracker(&tracker, 3, 50);
+
+    xnn_plan_value_allocation_tracker(&tracker);
+
+#if XNN_ENABLE_MEMOPT
+    EXPECT_EQ(100, tracker.mem_arena_lower_bound);
+    if (strategy == xnn_memory_planning_strategy_greedy_by_size) {
+      // T3 fits below T2, which is allocated after T1.
+      EXPECT_EQ(100, tracker.mem_arena_size);
+      EXPECT_EQ(0, tracker.usage[0].alloc_offset);
+      EXPECT_EQ(0, tracker.usage[1].alloc_offset);
+      EXPECT_EQ(60, tracker.usage[2].alloc_offset);
+      EXPECT_EQ(0, tracker.usage[3].alloc_offset);
+    } else {
+      EXPECT_GE(tracker.mem_arena_size, tracker.mem_arena_lower_bound);
+    }
+#else
+    EXPECT_EQ(240, tracker.mem_arena_size);
+    EXPECT_EQ(240, tracker.mem_arena_lower_bound);
+#endif
+
+    xnn_release_value_allocation_tracker(&tracker);
+  }
+}
+
+TEST(MemoryPlanner, GreedyBySizeMatchesLowerBoundOnChain) {
+  EXPECT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  // Chain of N xnn_values, where each xnn_value is live for two consecutive steps.
+  const uint32_t num_values = 10000;
+  struct xnn_subgraph subgraph;
+  subgraph.num_nodes = 0;
+  subgraph.num_values = num_values;
+  struct xnn_value_allocation_tracker tracker;
+  xnn_init_value_allocation_tracker(&tracker, &subgraph);
+  tracker.strategy = xnn_memory_planning_strategy_greedy_by_size;
+  for (uint32_t i = 0; i < num_values; i++) {
+    tracker.usage[i].first_node = i;
+    tracker.usage[i].last_node = i + 1;
+    xnn_add_value_allocation_tracker(&tracker, i, 64 * (1 + i % 7));
+  }
+  xnn_plan_value_allocation_tracker(&tracker);
+
+#if XNN_ENABLE_MEMOPT
+  EXPECT_EQ(64 * 13, tracker.mem_arena_lower_bound);
+  EXPECT_GE(tracker.mem_arena_size, tracker.mem_arena_lower_bound);
+  EXPECT_LE(tracker.mem_arena_size, 64 * 14);
+  for (uint32_t i = 1; i < num_values; i++) {
+    const xnn_value_usage& prev = tracker.usage[i - 1];
+    const xnn_value_usage& curr = tracker.usage[i];
+    EXPECT_TRUE(prev.alloc_offset + prev.tensor_size <= curr.alloc_offset ||
+                curr.alloc_offset + curr.tensor_size <= prev.alloc_offset);
+  }
+#endif
+
+  xnn_release_value_allocation_tracker(&tracker);
+}
+
+TEST(MemoryPlanner, GreedyBySizeOnLargeGraph) {
+  EXPECT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  // xnn_values are produced one per step, and stay live for up to 64 steps, as skip connections do.
+  const uint32_t num_values = 20000;
+  struct xnn_subgraph subgraph;
+  subgraph.num_nodes = 0;
+  subgraph.num_values = num_values;
+  struct xnn_value_allocation_tracker tracker;
+  xnn_init_value_allocation_tracker(&tracker, &subgraph);
+  tracker.strategy = xnn_memory_planning_strategy_greedy_by_size;
+  std::mt19937 rng(42);
+  std::uniform_int_distribution<uint32_t> lifecycle_dist(0, 63);
+  std::uniform_int_distribution<size_t> size_dist(1, 1024);
+  for (uint32_t i = 0; i < num_values; i++) {
+    tracker.usage[i].first_node = i;
+    tracker.usage[i].last_node = i + lifecycle_dist(rng);
+    xnn_add_value_allocation_tracker(&tracker, i, 16 * size_dist(rng));
+  }
+  xnn_plan_value_allocation_tracker(&tracker);
+
+#if XNN_ENABLE_MEMOPT
+  EXPECT_GE(tracker.mem_arena_size, tracker.mem_arena_lower_bound);
+  for (uint32_t i = 0; i < num_values; i++) {
+    const xnn_value_usage& a = tracker.usage[i];
+    EXPECT_LE(a.alloc_offset + a.tensor_size, tracker.mem_arena_size);
+    // xnn_values are ordered by first_node, so only the following 63 xnn_values can overlap with this one.
+    for (uint32_t j = i + 1; j < std::min(num_values, i + 64); j++) {
+      const xnn_value_usage& b = tracker.usage[j];
+      if (b.first_node <= a.last_node) {
+        ASSERT_TRUE(a.alloc_offset + a.tensor_size <= b.alloc_offset ||
+                    b.alloc_offset + b.tensor_size <= a.alloc_offset)
+          << "xnn_values " << i << " and " << j << " overlap";
+      }
+    }
+  }
+#endif
+
+  xnn_release_value_allocation_tracker(&tracker);
+}
@@ -0,0 +1,171 @@
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <functional>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include <xnnpack.h>
+#include <xnnpack/params.h>
+
+
+class RDMaxMicrokernelTester {
+ public:
+  inline RDMaxMicrokernelTester& rows(size_t rows) {
+    assert(rows != 0);
+    this->rows_ = rows;
+    return *this;
+  }
+
+  inline size_t rows() const {
+    return this->rows_;
+  }
+
+  inline RDMaxMicrokernelTester& channels(size_t channels) {
+    assert(channels != 0);
+    this->channels_ = channels;
+    return *this;
+  }
+
+  inline size_t channels() const {
+    return this->channels_;
+  }
+
+  inline RDMaxMicrokernelTester& input_stride(size_t input_stride) {
+    assert(input_stride != 0);
+    this->input_stride_ = input_stride;
+    return *this;
+  }
+
+  inline size_t input_stride() const {
+    if (this->input_stride_ == 0) {
+      return channels();
+    } else {
+      assert(this->input_stride_ >= channels());
+      return this->input_stride_;
+    }
+  }
+
+  inline RDMaxMicrokernelTester& qmin(int8_t qmin) {
+    this->qmin_ = qmin;
+    return *this;
+  }
+
+  inline int8_t qmin() const {
+    return this->qmin_;
+  }
+
+  inline RDMaxMicrokernelTester& qmax(int8_t qmax) {
+    this->qmax_ = qmax;
+    return *this;
+  }
+
+  inline int8_t qmax() const {
+    return this->qmax_;
+  }
+
+  inline RDMaxMicrokernelTester& iterations(size_t iterations) {
+    this->iterations_ = iterations;
+    return *this;
+  }
+
+  inline size_t iterations() const {
+    return this->iterations_;
+  }
+
+  void Test(xnn_f32_rdmax_ukernel_function rdmax) const {
+    std::random_device random_device;
+    auto rng = std::mt19937(random_device());
+    auto f32rng = std::bind(std::uniform_real_distribution<float>(-10.0f, 10.0f), rng);
+
+    std::vector<float> input((rows() - 1) * input_stride() + channels() + XNN_EXTRA_BYTES / sizeof(float));
+    std::vector<float> output(channels());
+    std::vector<float> output_ref(channels());
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(input.begin(), input.end(), std::ref(f32rng));
+      std::fill(output.begin(), output.end(), std::nanf(""));
+
+      // Compute reference results.
+      for (size_t c = 0; c < channels(); c++) {
+        float max = input[c];
+        for (size_t r = 1; r < rows(); r++) {
+          max = std::max(max, input[r * input_stride() + c]);
+        }
+        output_ref[c] = max;
+      }
+
+      // Prepare parameters.
+      union xnn_f32_default_params params = { };
+
+      // Call optimized micro-kernel.
+      rdmax(rows(), channels(), input.data(), input_stride() * sizeof(float), output.data(), &params);
+
+      // Verify results.
+      for (size_t c = 0; c < channels(); c++) {
+        ASSERT_EQ(output[c], output_ref[c])
+          << "at channel " << c << " / " << channels() << ", rows = " << rows()
+          << ", input stride = " << input_stride();
+      }
+    }
+  }
+
+  void Test(xnn_s8_rdmax_minmax_ukernel_function rdmax, xnn_init_s8_minmax_params_fn init_params) const {
+    std::random_device random_device;
+    auto rng = std::mt19937(random_device());
+    auto i8rng = std::bind(
+      std::uniform_int_distribution<int32_t>(std::numeric_limits<int8_t>::min(), std::numeric_limits<int8_t>::max()),
+      rng);
+
+    std::vector<int8_t> input((rows() - 1) * input_stride() + channels() + XNN_EXTRA_BYTES / sizeof(int8_t));
+    std::vector<int8_t> output(channels());
+    std::vector<int8_t> output_ref(channels());
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(input.begin(), input.end(), std::ref(i8rng));
+      std::fill(output.begin(), output.end(), INT8_C(0xA5));
+
+      // Compute reference results.
+      for (size_t c = 0; c < channels(); c++) {
+        int8_t max = input[c];
+        for (size_t r = 1; r < rows(); r++) {
+          max = std::max(max, input[r * input_stride() + c]);
+        }
+        output_ref[c] = std::min(std::max(max, qmin()), qmax());
+      }
+
+      // Prepare parameters.
+      union xnn_s8_minmax_params params;
+      init_params(&params, qmin(), qmax());
+
+      // Call optimized micro-kernel.
+      rdmax(rows(), channels(), input.data(), input_stride() * sizeof(int8_t), output.data(), &params);
+
+      // Verify results.
+      for (size_t c = 0; c < channels(); c++) {
+        ASSERT_EQ(int32_t(output[c]), int32_t(output_ref[c]))
+          << "at channel " << c << " / " << channels() << ", rows = " << rows()
+          << ", input stride = " << input_stride();
+      }
+    }
+  }
+
+ private:
+  size_t rows_{1};
+  size_t channels_{1};
+  size_t input_stride_{0};
+  int8_t qmin_{std::numeric_limits<int8_t>::min()};
+  int8_t qmax_{std::numeric_limits<int8_t>::max()};
+  size_t iterations_{15};
+};
@@ -0,0 +1,731 @@
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <gtest/gtest.h>
+
+#include <xnnpack.h>
+
+#include "reduce-operator-tester.h"
+
+TEST(REDUCE_ND_F32, sum_1d) {
+  ReduceOperatorTester()
+    .shape({37})
+    .reduction_axes({0})
+    .operation(xnn_reduce_sum)
+    .TestF32();
+}
+
+TEST(REDUCE_ND_F32, sum_2d_reduce_inner) {
+  ReduceOperatorTester()
+    .shape({5, 37})
+    .reduction_axes({1})
+    .operation(xnn_reduce_sum)
+    .TestF32();
+}
+
+TEST(REDUCE_ND_F32, sum_2d_reduce_outer) {
+  ReduceOperatorTester()
+    .shape({37, 17})
+    .reduction_axes({0})
+    .operation(xnn_reduce_sum)
+    .TestF32();
+}
+
+TEST(REDUCE_ND_F32, sum_3d_reduce_middle) {
+  ReduceOperatorTester()
+    .shape({3, 11, 19})
+    .reduction_axes({1})
+    .operation(xnn_reduce_sum)
+    .TestF32();
+}
+
+TEST(REDUCE_ND_F32, sum_3d_reduce_many_rows) {
+  ReduceOperatorTester()
+    .shape({3, 67, 20})
+    .reduction_axes({1})
+    .operation(xnn_reduce_sum)
+    .TestF32();
+}
+
+TEST(REDUCE_ND_F32, sum_4d_reduce_middle) {
+  ReduceOperatorTester()
+    .shape({2, 5, 7, 9})
+    .reduction_axes({1, 2})
+    .operation(xnn_reduce_sum)
+    .TestF32();
+}
+
+TEST(REDUCE_ND_F32, sum_4d_reduce_inner) {
+  ReduceOperatorTester()
+    .shape({2, 5, 7, 9})
+    .reduction_axes({2, 3})
+    .operation(xnn_reduce_sum)
+    .TestF32();
+}
+
+TEST(REDUCE_ND_F32, sum_4d_reduce_all) {
+  ReduceOperatorTester()
+    .shape({2, 5, 7, 9})
+    .reduction_axes({0, 1, 2, 3})
+    .operation(xnn_reduce_sum)
+    .TestF32();
+}
+
+TEST(REDUCE_ND_F32, sum_4d_unit_dims) {
+  ReduceOperatorTester()
+    .shape({5, 1, 7, 3})
+    .reduction_axes({0, 2})
+    .operation(xnn_reduce_sum)
+    .TestF32();
+}
+
+TEST(REDUCE_ND_F32, mean_1d) {
+  ReduceOperatorTester()
+    .shape({37})
+    .reduction_axes({0})
+    .operation(xnn_reduce_mean)
+    .TestF32();
+}
+
+TEST(REDUCE_ND_F32, mean_2d_reduce_inner) {
+  ReduceOperatorTester()
+    .shape({5, 37})
+    .reduction_axes({1})
+    .operation(xnn_reduce_mean)
+    .TestF32();
+}
+
+TEST(REDUCE_ND_F32, mean_2d_reduce_outer) {
+  ReduceOperatorTester()
+    .shape({37, 17})
+    .reduction_axes({0})
+    .operation(xnn_reduce_mean)
+    .TestF32();
+}
+
+TEST(REDUCE_ND_F32, mean_3d_reduce_middle) {
+  ReduceOperatorTester()
+    .shape({3, 11, 19})
+    .reduction_axes({1})
+    .operation(xnn_reduce_mean)
+    .TestF32();
+}
+
+TEST(REDUCE_ND_F32, mean_3d_reduce_many_rows) {
+  ReduceOperatorTester()
+    .shape({3, 67, 20})
+    .reduction_axes({1})
+    .operation(xnn_reduce_mean)
+    .TestF32();
+}
+
+TEST(REDUCE_ND_F32, mean_4d_reduce_middle) {
+  ReduceOperatorTester()
+    .shape({2, 5, 7, 9})
+    .reduction_axes({1, 2})
+    .operation(xnn_reduce_mean)
+    .TestF32();
+}
+
+TEST(REDUCE_ND_F32, mean_4d_reduce_inner) {
+  ReduceOperatorTester()
+    .shape({2, 5, 7, 9})
+    .reduction_axes({2, 3})
+    .operation(xnn_reduce_mean)
+    .TestF32();
+}
+
+TEST(REDUCE_ND_F32, mean_4d_reduce_all) {
+  ReduceOperatorTester()
+    .shape({2, 5, 7, 9})
+    .reduction_axes({0, 1, 2, 3})
+    .operation(xnn_reduce_mean)
+    .TestF32();
+}
+
+TEST(REDUCE_ND_F32, mean_4d_unit_dims) {
+  ReduceOperatorTester()
+    .shape({5, 1, 7, 3})
+    .reduction_axes({0, 2})
+    .operation(xnn_reduce_mean)
+    .TestF32();
+}
+
+TEST(REDUCE_ND_F32, max_1d) {
+  ReduceOperatorTester()
+    .shape({37})
+    .reduction_axes({0})
+    .operation(xnn_reduce_max)
+    .TestF32();
+}
+
+TEST(REDUCE_ND_F32, max_2d_reduce_inner) {
+  ReduceOperatorTester()
+    .shape({5, 37})
+    .reduction_axes({1})
+    .operation(xnn_reduce_max)
+    .TestF32();
+}
+
+TEST(REDUCE_ND_F32, max_2d_reduce_outer) {
+  ReduceOperatorTester()
+    .shape({37, 17})
+    .reduction_axes({0})
+    .operation(xnn_reduce_max)
+    .TestF32();
+}
+
+TEST(REDUCE_ND_F32, max_3d_reduce_middle) {
+  ReduceOperatorTester()
+    .shape({3, 11, 19})
+    .reduction_axes({1})
+    .operation(xnn_reduce_max)
+    .TestF32();
+}
+
+TEST(REDUCE_ND_F32, max_3d_reduce_many_rows) {
+  ReduceOperatorTester()
+    .shape({3, 67, 20})
+    .reduction_axes({1})
+    .operation(xnn_reduce_max)
+    .TestF32();
+}
+
+TEST(REDUCE_ND_F32, max_4d_reduce_middle) {
+  ReduceOperatorTester()
+    .shape({2, 5, 7, 9})
+    .reduction_axes({1, 2})
+    .operation(xnn_reduce_max)
+    .TestF32();
+}
+
+TEST(REDUCE_ND_F32, max_4d_reduce_inner) {
+  ReduceOperatorTester()
+    .shape({2, 5, 7, 9})
+    .reduction_axes({2, 3})
+    .operation(xnn_reduce_max)
+    .TestF32();
+}
+
+TEST(REDUCE_ND_F32, max_4d_reduce_all) {
+  ReduceOperatorTester()
+    .shape({2, 5, 7, 9})
+    .reduction_axes({0, 1, 2, 3})
+    .operation(xnn_reduce_max)
+    .TestF32();
+}
+
+TEST(REDUCE_ND_F32, max_4d_unit_dims) {
+  ReduceOperatorTester()
+    .shape({5, 1, 7, 3})
+    .reduction_axes({0, 2})
+    .operation(xnn_reduce_max)
+    .TestF32();
+}
+
+TEST(REDUCE_ND_QS8, sum_1d) {
+  ReduceOperatorTester()
+    .shape({37})
+    .reduction_axes({0})
+    .operation(xnn_reduce_sum)
+    .input_zero_point(-3)
+    .output_scale(32.0f)
+    .output_zero_point(7)
+    .TestQS8();
+}
+
+TEST(REDUCE_ND_QS8, sum_2d_reduce_inner) {
+  ReduceOperatorTester()
+    .shape({5, 37})
+    .reduction_axes({1})
+    .operation(xnn_reduce_sum)
+    .input_zero_point(-3)
+    .output_scale(32.0f)
+    .output_zero_point(7)
+    .TestQS8();
+}
+
+TEST(REDUCE_ND_QS8, sum_2d_reduce_outer) {
+  ReduceOperatorTester()
+    .shape({37, 17})
+    .reduction_axes({0})
+    .operation(xnn_reduce_sum)
+    .input_zero_point(-3)
+    .output_scale(32.0f)
+    .output_zero_point(7)
+    .TestQS8();
+}
+
+TEST(REDUCE_ND_QS8, sum_3d_reduce_middle) {
+  ReduceOperatorTester()
+    .shape({3, 11, 19})
+    .reduction_axes({1})
+    .operation(xnn_reduce_sum)
+    .input_zero_point(-3)
+    .output_scale(32.0f)
+    .output_zero_point(7)
+    .TestQS8();
+}
+
+TEST(REDUCE_ND_QS8, sum_3d_reduce_many_rows) {
+  ReduceOperatorTester()
+    .shape({3, 67, 20})
+    .reduction_axes({1})
+    .operation(xnn_reduce_sum)
+    .input_zero_point(-3)
+    .output_scale(32.0f)
+    .output_zero_point(7)
+    .TestQS8();
+}
+
+TEST(REDUCE_ND_QS8, sum_4d_reduce_middle) {
+  ReduceOperatorTester()
+    .shape({2, 5, 7, 9})
+    .reduction_axes({1, 2})
+    .operation(xnn_reduce_sum)
+    .input_zero_point(-3)
+    .output_scale(32.0f)
+    .output_zero_point(7)
+    .TestQS8();
+}
+
+TEST(REDUCE_ND_QS8, sum_4d_reduce_inner) {
+  ReduceOperatorTester()
+    .shape({2, 5, 7, 9})
+    .reduction_axes({2, 3})
+    .operation(xnn_reduce_sum)
+    .input_zero_point(-3)
+    .output_scale(32.0f)
+    .output_zero_point(7)
+    .TestQS8();
+}
+
+TEST(REDUCE_ND_QS8, sum_4d_reduce_all) {
+  ReduceOperatorTester()
+    .shape({2, 5, 7, 9})
+    .reduction_axes({0, 1, 2, 3})
+    .operation(xnn_reduce_sum)
+    .input_zero_point(-3)
+    .output_scale(32.0f)
+    .output_zero_point(7)
+    .TestQS8();
+}
+
+TEST(REDUCE_ND_QS8, sum_4d_unit_dims) {
+  ReduceOperatorTester()
+    .shape({5, 1, 7, 3})
+    .reduction_axes({0, 2})
+    .operation(xnn_reduce_sum)
+    .input_zero_point(-3)
+    .output_scale(32.0f)
+    .output_zero_point(7)
+    .TestQS8();
+}
+
+TEST(REDUCE_ND_QS8, mean_1d) {
+  ReduceOperatorTester()
+    .shape({37})
+    .reduction_axes({0})
+    .operation(xnn_reduce_mean)
+    .input_zero_point(-3)
+    .input_scale(0.75f)
+    .output_scale(0.5f)
+    .output_zero_point(7)
+    .TestQS8();
+}
+
+TEST(REDUCE_ND_QS8, mean_2d_reduce_inner) {
+  ReduceOperatorTester()
+    .shape({5, 37})
+    .reduction_axes({1})
+    .operation(xnn_reduce_mean)
+    .input_zero_point(-3)
+    .input_scale(0.75f)
+    .output_scale(0.5f)
+    .output_zero_point(7)
+    .TestQS8();
+}
+
+TEST(REDUCE_ND_QS8, mean_2d_reduce_outer) {
+  ReduceOperatorTester()
+    .shape({37, 17})
+    .reduction_axes({0})
+    .operation(xnn_reduce_mean)
+    .input_zero_point(-3)
+    .input_scale(0.75f)
+    .output_scale(0.5f)
+    .output_zero_point(7)
+    .TestQS8();
+}
+
+TEST(REDUCE_ND_QS8, mean_3d_reduce_middle) {
+  ReduceOperatorTester()
+    .shape({3, 11, 19})
+    .reduction_axes({1})
+    .operation(xnn_reduce_mean)
+    .input_zero_point(-3)
+    .input_scale(0.75f)
+    .output_scale(0.5f)
+    .output_zero_point(7)
+    .TestQS8();
+}
+
+TEST(REDUCE_ND_QS8, mean_3d_reduce_many_rows) {
+  ReduceOperatorTester()
+    .shape({3, 67, 20})
+    .reduction_axes({1})
+    .operation(xnn_reduce_mean)
+    .input_zero_point(-3)
+    .input_scale(0.75f)
+    .output_scale(0.5f)
+    .output_zero_point(7)
+    .TestQS8();
+}
+
+TEST(REDUCE_ND_QS8, mean_4d_reduce_middle) {
+  ReduceOperatorTester()
+    .shape({2, 5, 7, 9})
+    .reduction_axes({1, 2})
+    .operation(xnn_reduce_mean)
+    .input_zero_point(-3)
+    .input_scale(0.75f)
+    .output_scale(0.5f)
+    .output_zero_point(7)
+    .TestQS8();
+}
+
+TEST(REDUCE_ND_QS8, mean_4d_reduce_inner) {
+  ReduceOperatorTester()
+    .shape({2, 5, 7, 9})
+    .reduction_axes({2, 3})
+    .operation(xnn_reduce_mean)
+    .input_zero_point(-3)
+    .input_scale(0.75f)
+    .output_scale(0.5f)
+    .output_zero_point(7)
+    .TestQS8();
+}
+
+TEST(REDUCE_ND_QS8, mean_4d_reduce_all) {
+  ReduceOperatorTester()
+    .shape({2, 5, 7, 9})
+    .reduction_axes({0, 1, 2, 3})
+    .operation(xnn_reduce_mean)
+    .input_zero_point(-3)
+    .input_scale(0.75f)
+    .output_scale(0.5f)
+    .output_zero_point(7)
+    .TestQS8();
+}
+
+TEST(REDUCE_ND_QS8, mean_4d_unit_dims) {
+  ReduceOperatorTester()
+    .shape({5, 1, 7, 3})
+    .reduction_axes({0, 2})
+    .operation(xnn_reduce_mean)
+    .input_zero_point(-3)
+    .input_scale(0.75f)
+    .output_scale(0.5f)
+    .output_zero_point(7)
+    .TestQS8();
+}
+
+TEST(REDUCE_ND_QS8, max_1d) {
+  ReduceOperatorTester()
+    .shape({37})
+    .reduction_axes({0})
+    .operation(xnn_reduce_max)
+    .input_zero_point(5)
+    .output_zero_point(5)
+    .TestQS8();
+}
+
+TEST(REDUCE_ND_QS8, max_2d_reduce_inner) {
+  ReduceOperatorTester()
+    .shape({5, 37})
+    .reduction_axes({1})
+    .operation(xnn_reduce_max)
+    .input_zero_point(5)
+    .output_zero_point(5)
+    .TestQS8();
+}
+
+TEST(REDUCE_ND_QS8, max_2d_reduce_outer) {
+  ReduceOperatorTester()
+    .shape({37, 17})
+    .reduction_axes({0})
+    .operation(xnn_reduce_max)
+    .input_zero_point(5)
+    .output_zero_point(5)
+    .TestQS8();
+}
+
+TEST(REDUCE_ND_QS8, max_3d_reduce_middle) {
+  ReduceOperatorTester()
+    .shape({3, 11, 19})
+    .reduction_axes({1})
+    .operation(xnn_reduce_max)
+    .input_zero_point(5)
+    .output_zero_point(5)
+    .TestQS8();
+}
+
+TEST(REDUCE_ND_QS8, max_3d_reduce_many_rows) {
+  ReduceOperatorTester()
+    .shape({3, 67, 20})
+    .reduction_axes({1})
+    .operation(xnn_reduce_max)
+    .input_zero_point(5)
+    .output_zero_point(5)
+    .TestQS8();
+}
+
+TEST(REDUCE_ND_QS8, max_4d_reduce_middle) {
+  ReduceOperatorTester()
+    .shape({2, 5, 7, 9})
+    .reduction_axes({1, 2})
+    .operation(xnn_reduce_max)
+    .input_zero_point(5)
+    .output_zero_point(5)
+    .TestQS8();
+}
+
+TEST(REDUCE_ND_QS8, max_4d_reduce_inner) {
+  ReduceOperatorTester()
+    .shape({2, 5, 7, 9})
+    .reduction_axes({2, 3})
+    .operation(xnn_reduce_max)
+    .input_zero_point(5)
+    .output_zero_point(5)
+    .TestQS8();
+}
+
+TEST(REDUCE_ND_QS8, max_4d_reduce_all) {
+  ReduceOperatorTester()
+    .shape({2, 5, 7, 9})
+    .reduction_axes({0, 1, 2, 3})
+    .operation(xnn_reduce_max)
+    .input_zero_point(5)
+    .output_zero_point(5)
+    .TestQS8();
+}
+
+TEST(REDUCE_ND_QS8, max_4d_unit_dims) {
+  ReduceOperatorTester()
+    .shape({5, 1, 7, 3})
+    .reduction_axes({0, 2})
+    .operation(xnn_reduce_max)
+    .input_zero_point(5)
+    .output_zero_point(5)
+    .TestQS8();
+}
+
+TEST(REDUCE_ND_QS8, max_qmin_qmax) {
+  ReduceOperatorTester()
+    .shape({3, 11, 19})
+    .reduction_axes({1})
+    .operation(xnn_reduce_max)
+    .qmin(-64)
+    .qmax(64)
+    .TestQS8();
+}
+
+TEST(REDUCE_ND_F32, sum_3d_reduce_non_adjacent) {
+  ReduceOperatorTester()
+    .shape({3, 4, 5})
+    .reduction_axes({0, 2})
+    .operation(xnn_reduce_sum)
+    .TestF32();
+}
+
+TEST(REDUCE_ND_F32, sum_5d_reduce_non_adjacent_outer_first) {
+  ReduceOperatorTester()
+    .shape({2, 13, 3, 5, 7})
+    .reduction_axes({1, 3})
+    .operation(xnn_reduce_sum)
+    .TestF32();
+}
+
+TEST(REDUCE_ND_F32, sum_5d_reduce_non_adjacent_inner_first) {
+  ReduceOperatorTester()
+    .shape({2, 5, 3, 13, 7})
+    .reduction_axes({1, 3})
+    .operation(xnn_reduce_sum)
+    .TestF32();
+}
+
+TEST(REDUCE_ND_F32, sum_4d_reduce_non_adjacent_many_rows) {
+  ReduceOperatorTester()
+    .shape({67, 3, 11, 4})
+    .reduction_axes({0, 2, 3})
+    .operation(xnn_reduce_sum)
+    .TestF32();
+}
+
+TEST(REDUCE_ND_F32, mean_3d_reduce_non_adjacent) {
+  ReduceOperatorTester()
+    .shape({3, 4, 5})
+    .reduction_axes({0, 2})
+    .operation(xnn_reduce_mean)
+    .TestF32();
+}
+
+TEST(REDUCE_ND_F32, mean_5d_reduce_non_adjacent_outer_first) {
+  ReduceOperatorTester()
+    .shape({2, 13, 3, 5, 7})
+    .reduction_axes({1, 3})
+    .operation(xnn_reduce_mean)
+    .TestF32();
+}
+
+TEST(REDUCE_ND_F32, mean_5d_reduce_non_adjacent_inner_first) {
+  ReduceOperatorTester()
+    .shape({2, 5, 3, 13, 7})
+    .reduction_axes({1, 3})
+    .operation(xnn_reduce_mean)
+    .TestF32();
+}
+
+TEST(REDUCE_ND_F32, max_3d_reduce_non_adjacent) {
+  ReduceOperatorTester()
+    .shape({3, 4, 5})
+    .reduction_axes({0, 2})
+    .operation(xnn_reduce_max)
+    .TestF32();
+}
+
+TEST(REDUCE_ND_F32, max_5d_reduce_non_adjacent_outer_first) {
+  ReduceOperatorTester()
+    .shape({2, 13, 3, 5, 7})
+    .reduction_axes({1, 3})
+    .operation(xnn_reduce_max)
+    .TestF32();
+}
+
+TEST(REDUCE_ND_F32, max_5d_reduce_non_adjacent_inner_first) {
+  ReduceOperatorTester()
+    .shape({2, 5, 3, 13, 7})
+    .reduction_axes({1, 3})
+    .operation(xnn_reduce_max)
+    .TestF32();
+}
+
+TEST(REDUCE_ND_QS8, max_3d_reduce_non_adjacent) {
+  ReduceOperatorTester()
+    .shape({3, 4, 5})
+    .reduction_axes({0, 2})
+    .operation(xnn_reduce_max)
+    .input_zero_point(5)
+    .output_zero_point(5)
+    .TestQS8();
+}
+
+TEST(REDUCE_ND_QS8, max_5d_reduce_non_adjacent_inner_first) {
+  ReduceOperatorTester()
+    .shape({2, 5, 3, 13, 7})
+    .reduction_axes({1, 3})
+    .operation(xnn_reduce_max)
+    .input_zero_point(5)
+    .output_zero_point(5)
+    .TestQS8();
+}
+
+TEST(REDUCE_ND_F32, sum_5d_reduce_three_non_adjacent_groups) {
+  ReduceOperatorTester()
+    .shape({2, 3, 4, 5, 6})
+    .reduction_axes({0, 2, 4})
+    .operation(xnn_reduce_sum)
+    .TestF32();
+}
+
+TEST(REDUCE_ND_F32, mean_6d_reduce_three_non_adjacent_groups) {
+  ReduceOperatorTester()
+    .shape({3, 2, 5, 4, 7, 3})
+    .reduction_axes({0, 2, 4})
+    .operation(xnn_reduce_mean)
+    .TestF32();
+}
+
+TEST(REDUCE_ND_F32, mean_6d_reduce_three_non_adjacent_groups_innermost) {
+  ReduceOperatorTester()
+    .shape({3, 2, 5, 4, 7, 3})
+    .reduction_axes({1, 3, 5})
+    .operation(xnn_reduce_mean)
+    .TestF32();
+}
+
+TEST(REDUCE_ND_F32, max_6d_reduce_three_non_adjacent_groups) {
+  ReduceOperatorTester()
+    .shape({3, 2, 5, 4, 7, 3})
+    .reduction_axes({0, 2, 4})
+    .operation(xnn_reduce_max)
+    .TestF32();
+}
+
+TEST(REDUCE_ND_QS8, max_6d_reduce_three_non_adjacent_groups) {
+  ReduceOperatorTester()
+    .shape({3, 2, 5, 4, 7, 3})
+    .reduction_axes({1, 3, 5})
+    .operation(xnn_reduce_max)
+    .input_zero_point(5)
+    .output_zero_point(5)
+    .TestQS8();
+}
+
+TEST(REDUCE_ND_QS8, sum_3d_reduce_non_adjacent) {
+  ReduceOperatorTester()
+    .shape({3, 4, 5})
+    .reduction_axes({0, 2})
+    .operation(xnn_reduce_sum)
+    .input_zero_point(-3)
+    .output_scale(32.0f)
+    .output_zero_point(7)
+    .TestQS8();
+}
+
+TEST(REDUCE_ND_QS8, sum_5d_reduce_non_adjacent_inner_first) {
+  ReduceOperatorTester()
+    .shape({2, 5, 3, 13, 7})
+    .reduction_axes({1, 3})
+    .operation(xnn_reduce_sum)
+    .input_zero_point(-3)
+    .output_scale(32.0f)
+    .output_zero_point(7)
+    .TestQS8();
+}
+
+TEST(REDUCE_ND_QS8, sum_5d_reduce_three_non_adjacent_groups) {
+  ReduceOperatorTester()
+    .shape({2, 3, 4, 5, 6})
+    .reduction_axes({0, 2, 4})
+    .operation(xnn_reduce_sum)
+    .input_zero_point(-3)
+    .output_scale(32.0f)
+    .output_zero_point(7)
+    .TestQS8();
+}
+
+TEST(REDUCE_ND_QS8, mean_3d_reduce_non_adjacent) {
+  ReduceOperatorTester()
+    .shape({3, 4, 5})
+    .reduction_axes({0, 2})
+    .operation(xnn_reduce_mean)
+    .input_zero_point(-3)
+    .input_scale(2.0f)
+    .output_zero_point(7)
+    .TestQS8();
+}
+
+TEST(REDUCE_ND_QS8, mean_6d_reduce_three_non_adjacent_groups) {
+  ReduceOperatorTester()
+    .shape({3, 2, 5, 4, 7, 3})
+    .reduction_axes({1, 3, 5})
+    .operation(xnn_reduce_mean)
+    .input_zero_point(-3)
+    .output_zero_point(7)
+    .qmin(-64)
+    .qmax(64)
+    .TestQS8();
+}
@@ -0,0 +1,324 @@
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <cstdlib>
+#include <functional>
+#include <initializer_list>
+#include <limits>
+#include <memory>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include <xnnpack.h>
+
+
+class ReduceOperatorTester {
+ public:
+  inline ReduceOperatorTester& shape(std::initializer_list<size_t> shape) {
+    assert(shape.size() <= XNN_MAX_TENSOR_DIMS);
+    this->shape_ = std::vector<size_t>(shape);
+    return *this;
+  }
+
+  inline const std::vector<size_t>& shape() const {
+    return this->shape_;
+  }
+
+  inline size_t num_dims() const {
+    return this->shape_.size();
+  }
+
+  inline ReduceOperatorTester& reduction_axes(std::initializer_list<size_t> reduction_axes) {
+    assert(reduction_axes.size() <= XNN_MAX_TENSOR_DIMS);
+    this->reduction_axes_ = std::vector<size_t>(reduction_axes);
+    return *this;
+  }
+
+  inline const std::vector<size_t>& reduction_axes() const {
+    return this->reduction_axes_;
+  }
+
+  inline ReduceOperatorTester& operation(xnn_reduce_operator operation) {
+    this->operation_ = operation;
+    return *this;
+  }
+
+  inline xnn_reduce_operator operation() const {
+    return this->operation_;
+  }
+
+  inline ReduceOperatorTester& input_scale(float input_scale) {
+    assert(input_scale > 0.0f);
+    assert(std::isnormal(input_scale));
+    this->input_scale_ = input_scale;
+    return *this;
+  }
+
+  inline float input_scale() const {
+    return this->input_scale_;
+  }
+
+  inline ReduceOperatorTester& input_zero_point(int8_t input_zero_point) {
+    this->input_zero_point_ = input_zero_point;
+    return *this;
+  }
+
+  inline int8_t input_zero_point() const {
+    return this->input_zero_point_;
+  }
+
+  inline ReduceOperatorTester& output_scale(float output_scale) {
+    assert(output_scale > 0.0f);
+    assert(std::isnormal(output_scale));
+    this->output_scale_ = output_scale;
+    return *this;
+  }
+
+  inline float output_scale() const {
+    return this->output_scale_;
+  }
+
+  inline ReduceOperatorTester& output_zero_point(int8_t output_zero_point) {
+    this->output_zero_point_ = output_zero_point;
+    return *this;
+  }
+
+  inline int8_t output_zero_point() const {
+    return this->output_zero_point_;
+  }
+
+  inline ReduceOperatorTester& qmin(int8_t qmin) {
+    this->qmin_ = qmin;
+    return *this;
+  }
+
+  inline int8_t qmin() const {
+    return this->qmin_;
+  }
+
+  inline ReduceOperatorTester& qmax(int8_t qmax) {
+    this->qmax_ = qmax;
+    return *this;
+  }
+
+  inline int8_t qmax() const {
+    return this->qmax_;
+  }
+
+  inline ReduceOperatorTester& iterations(size_t iterations) {
+    this->iterations_ = iterations;
+    return *this;
+  }
+
+  inline size_t iterations() const {
+    return this->iterations_;
+  }
+
+  void TestF32() const {
+    std::random_device random_device;
+    auto rng = std::mt19937(random_device());
+    auto f32rng = std::bind(std::uniform_real_distribution<float>(-1.0f, 1.0f), rng);
+
+    std::vector<size_t> output_index;
+    std::vector<float> input(num_input_elements() + XNN_EXTRA_BYTES / sizeof(float));
+    std::vector<float> output(num_output_elements());
+    std::vector<double> output_ref(num_output_elements());
+    std::vector<size_t> reduced_elements(num_output_elements());
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(input.begin(), input.end(), std::ref(f32rng));
+      std::fill(output.begin(), output.end(), std::nanf(""));
+
+      // Compute reference results.
+      ComputeOutputIndex(output_index);
+      std::fill(reduced_elements.begin(), reduced_elements.end(), 0);
+      for (size_t i = 0; i < num_input_elements(); i++) {
+        const size_t o = output_index[i];
+        const double x = double(input[i]);
+        if (reduced_elements[o]++ == 0) {
+          output_ref[o] = x;
+        } else if (operation() == xnn_reduce_max) {
+          output_ref[o] = std::max(output_ref[o], x);
+        } else {
+          output_ref[o] += x;
+        }
+      }
+      if (operation() == xnn_reduce_mean) {
+        for (size_t o = 0; o < num_output_elements(); o++) {
+          output_ref[o] /= double(reduced_elements[o]);
+        }
+      }
+
+      // Create, setup, run, and destroy Reduce operator.
+      ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+      xnn_operator_t reduce_op = nullptr;
+
+      ASSERT_EQ(xnn_status_success,
+        xnn_create_reduce_nd_f32(operation(), 0, &reduce_op));
+      ASSERT_NE(nullptr, reduce_op);
+
+      // Smart pointer to automatically delete reduce_op.
+      std::unique_ptr<xnn_operator, decltype(&xnn_delete_operator)> auto_reduce_op(reduce_op, xnn_delete_operator);
+
+      ASSERT_EQ(xnn_status_success,
+        xnn_setup_reduce_nd_f32(
+          reduce_op,
+          input.data(), output.data(),
+          num_dims(), shape().data(),
+          reduction_axes().size(), reduction_axes().data(),
+          nullptr /* thread pool */));
+
+      ASSERT_EQ(xnn_status_success,
+        xnn_run_operator(reduce_op, nullptr /* thread pool */));
+
+      // Verify results.
+      for (size_t o = 0; o < num_output_elements(); o++) {
+        if (operation() == xnn_reduce_max) {
+          ASSERT_EQ(output[o], float(output_ref[o]))
+            << "at output element " << o << " / " << num_output_elements();
+        } else {
+          ASSERT_NEAR(output[o], output_ref[o], std::max(std::abs(output_ref[o]) * 1.0e-5, 1.0e-5))
+            << "at output element " << o << " / " << num_output_elements();
+        }
+      }
+    }
+  }
+
+  void TestQS8() const {
+    std::random_device random_device;
+    auto rng = std::mt19937(random_device());
+    auto i8rng = std::bind(
+      std::uniform_int_distribution<int32_t>(std::numeric_limits<int8_t>::min(), std::numeric_limits<int8_t>::max()),
+      rng);
+
+    std::vector<size_t> output_index;
+    std::vector<int8_t> input(num_input_elements() + XNN_EXTRA_BYTES / sizeof(int8_t));
+    std::vector<int8_t> output(num_output_elements());
+    std::vector<double> output_ref(num_output_elements());
+    std::vector<size_t> reduced_elements(num_output_elements());
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(input.begin(), input.end(), std::ref(i8rng));
+      std::fill(output.begin(), output.end(), INT8_C(0xA5));
+
+      // Compute reference results.
+      ComputeOutputIndex(output_index);
+      std::fill(reduced_elements.begin(), reduced_elements.end(), 0);
+      for (size_t i = 0; i < num_input_elements(); i++) {
+        const size_t o = output_index[i];
+        const double x = double(int32_t(input[i]) - int32_t(input_zero_point()));
+        if (reduced_elements[o]++ == 0) {
+          output_ref[o] = x;
+        } else if (operation() == xnn_reduce_max) {
+          output_ref[o] = std::max(output_ref[o], x);
+        } else {
+          output_ref[o] += x;
+        }
+      }
+      for (size_t o = 0; o < num_output_elements(); o++) {
+        double scale = double(input_scale()) / double(output_scale());
+        if (operation() == xnn_reduce_mean) {
+          scale /= double(reduced_elements[o]);
+        }
+        output_ref[o] = output_ref[o] * scale + double(output_zero_point());
+        output_ref[o] = std::min<double>(output_ref[o], double(qmax()));
+        output_ref[o] = std::max<double>(output_ref[o], double(qmin()));
+      }
+
+      // Create, setup, run, and destroy Reduce operator.
+      ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+      xnn_operator_t reduce_op = nullptr;
+
+      ASSERT_EQ(xnn_status_success,
+        xnn_create_reduce_nd_qs8(
+          operation(),
+          input_zero_point(), input_scale(),
+          output_zero_point(), output_scale(),
+          qmin(), qmax(),
+          0, &reduce_op));
+      ASSERT_NE(nullptr, reduce_op);
+
+      // Smart pointer to automatically delete reduce_op.
+      std::unique_ptr<xnn_operator, decltype(&xnn_delete_operator)> auto_reduce_op(reduce_op, xnn_delete_operator);
+
+      ASSERT_EQ(xnn_status_success,
+        xnn_setup_reduce_nd_qs8(
+          reduce_op,
+          input.data(), output.data(),
+          num_dims(), shape().data(),
+          reduction_axes().size(), reduction_axes().data(),
+          nullptr /* thread pool */));
+
+      ASSERT_EQ(xnn_status_success,
+        xnn_run_operator(reduce_op, nullptr /* thread pool */));
+
+      // Verify results.
+      for (size_t o = 0; o < num_output_elements(); o++) {
+        ASSERT_LE(int32_t(output[o]), int32_t(qmax()));
+        ASSERT_GE(int32_t(output[o]), int32_t(qmin()));
+        ASSERT_NEAR(double(int32_t(output[o])), output_ref[o], 0.80)
+          << "at output element " << o << " / " << num_output_elements();
+      }
+    }
+  }
+
+ private:
+  size_t num_input_elements() const {
+    return std::accumulate(shape().cbegin(), shape().cend(), size_t(1), std::multiplies<size_t>());
+  }
+
+  bool is_reduced(size_t axis) const {
+    return std::find(reduction_axes().cbegin(), reduction_axes().cend(), axis) != reduction_axes().cend();
+  }
+
+  size_t num_output_elements() const {
+    size_t num_output_elements = 1;
+    for (size_t i = 0; i < num_dims(); i++) {
+      if (!is_reduced(i)) {
+        num_output_elements *= shape()[i];
+      }
+    }
+    return num_output_elements;
+  }
+
+  // Maps each element of the row-major input tensor to the row-major output tensor element it is reduced into.
+  void ComputeOutputIndex(std::vector<size_t>& output_index) const {
+    output_index.resize(num_input_elements());
+    std::vector<size_t> input_coordinates(num_dims());
+    for (size_t i = 0; i < num_input_elements(); i++) {
+      size_t output_offset = 0;
+      for (size_t d = 0; d < num_dims(); d++) {
+        if (!is_reduced(d)) {
+          output_offset = output_offset * shape()[d] + input_coordinates[d];
+        }
+      }
+      output_index[i] = output_offset;
+      for (size_t d = num_dims(); d != 0; d--) {
+        if (++input_coordinates[d - 1] != shape()[d - 1]) {
+          break;
+        }
+        input_coordinates[d - 1] = 0;
+      }
+    }
+  }
+
+  std::vector<size_t> shape_;
+  std::vector<size_t> reduction_axes_;
+  xnn_reduce_operator operation_{xnn_reduce_sum};
+  float input_scale_{1.0f};
+  int8_t input_zero_point_{0};
+  float output_scale_{1.0f};
+  int8_t output_zero_point_{0};
+  int8_t qmin_{std::numeric_limits<int8_t>::min()};
+  int8_t qmax_{std::numeric_limits<int8_t>::max()};
+  size_t iterations_{3};
+};
@@ -0,0 +1,91 @@
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <cstdlib>
+#include <functional>
+#include <random>
+#include <vector>
+
+#include <xnnpack/params.h>
+
+
+class RMeanVarMicrokernelTester {
+ public:
+  inline RMeanVarMicrokernelTester& n(size_t n) {
+    assert(n != 0);
+    this->n_ = n;
+    return *this;
+  }
+
+  inline size_t n() const {
+    return this->n_;
+  }
+
+  inline RMeanVarMicrokernelTester& offset(float offset) {
+    this->offset_ = offset;
+    return *this;
+  }
+
+  inline float offset() const {
+    return this->offset_;
+  }
+
+  inline RMeanVarMicrokernelTester& iterations(size_t iterations) {
+    this->iterations_ = iterations;
+    return *this;
+  }
+
+  inline size_t iterations() const {
+    return this->iterations_;
+  }
+
+  void Test(xnn_f32_rmeanvar_ukernel_function rmeanvar) const {
+    std::random_device random_device;
+    auto rng = std::mt19937(random_device());
+    auto f32rng = std::bind(std::uniform_real_distribution<float>(offset() - 1.0f, offset() + 1.0f), rng);
+
+    std::vector<float> x(n());
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(x.begin(), x.end(), std::ref(f32rng));
+
+      // Compute reference results.
+      double sum = 0.0;
+      for (size_t i = 0; i < n(); i++) {
+        sum += double(x[i]);
+      }
+      const double mean_ref = sum / double(n());
+      double sum_sq_dev = 0.0;
+      for (size_t i = 0; i < n(); i++) {
+        const double dev = double(x[i]) - mean_ref;
+        sum_sq_dev += dev * dev;
+      }
+      const double variance_ref = sum_sq_dev / double(n());
+
+      // Call optimized micro-kernel.
+      float mean = std::nanf("");
+      float variance = std::nanf("");
+      rmeanvar(n() * sizeof(float), x.data(), &mean, &variance);
+
+      // Verify results.
+      ASSERT_NEAR(mean, mean_ref, std::max(std::abs(mean_ref) * 1.0e-5, 1.0e-6))
+        << "n = " << n() << ", offset = " << offset();
+      ASSERT_NEAR(variance, variance_ref, std::max(variance_ref * 1.0e-4, 1.0e-6))
+        << "n = " << n() << ", offset = " << offset();
+    }
+  }
+
+ private:
+  size_t n_{1};
+  float offset_{0.0f};
+  size_t iterations_{15};
+};
@@ -0,0 +1,228 @@
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include <xnnpack.h>
+#include <xnnpack/subgraph.h>
+
+#include <pthreadpool.h>
+
+#include <gtest/gtest.h>
+
+namespace {
+
+constexpr size_t kNumThreads = 4;
+constexpr size_t kChannels = 8;
+
+// Builds Subgraphs over [1, height, width, 8] FP32 tensors with external input 0 and external output 1, and runs
+// them with and without XNN_FLAG_INTER_OP_PARALLELISM on a multi-threaded pthreadpool.
+class RuntimeInterOpTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+    threadpool = pthreadpool_create(kNumThreads);
+    ASSERT_NE(nullptr, threadpool);
+    ASSERT_EQ(kNumThreads, pthreadpool_get_threads_count(threadpool));
+
+    std::random_device random_device;
+    rng = std::mt19937(random_device());
+  }
+
+  void TearDown() override {
+    pthreadpool_destroy(threadpool);
+  }
+
+  uint32_t DefineValue(xnn_subgraph_t subgraph, size_t height, size_t width, uint32_t external_id, uint32_t flags) {
+    const std::array<size_t, 4> dims = {{1, height, width, kChannels}};
+    uint32_t id = XNN_INVALID_VALUE_ID;
+    EXPECT_EQ(xnn_status_success, xnn_define_tensor_value(
+      subgraph, xnn_datatype_fp32, dims.size(), dims.data(), nullptr, external_id, flags, &id));
+    return id;
+  }
+
+  uint32_t DefineInternalValue(xnn_subgraph_t subgraph, size_t height, size_t width) {
+    return DefineValue(subgraph, height, width, XNN_INVALID_VALUE_ID, 0 /* flags */);
+  }
+
+  // HardSwish, Sigmoid, and Abs branches of the input, followed by Multiply (HardSwish, Sigmoid) and Negate (Abs),
+  // joined by Add:
+  //   level 0: HardSwish, Sigmoid, Abs
+  //   level 1: Multiply, Negate
+  //   level 2: Add
+  xnn_subgraph_t CreateBranchySubgraph(size_t height, size_t width) {
+    xnn_subgraph_t subgraph = nullptr;
+    EXPECT_EQ(xnn_status_success, xnn_create_subgraph(2, 0 /* flags */, &subgraph));
+
+    const uint32_t input_id = DefineValue(subgraph, height, width, 0, XNN_VALUE_FLAG_EXTERNAL_INPUT);
+    const uint32_t hardswish_id = DefineInternalValue(subgraph, height, width);
+    const uint32_t sigmoid_id = DefineInternalValue(subgraph, height, width);
+    const uint32_t abs_id = DefineInternalValue(subgraph, height, width);
+    const uint32_t product_id = DefineInternalValue(subgraph, height, width);
+    const uint32_t negate_id = DefineInternalValue(subgraph, height, width);
+    const uint32_t output_id = DefineValue(subgraph, height, width, 1, XNN_VALUE_FLAG_EXTERNAL_OUTPUT);
+
+    EXPECT_EQ(xnn_status_success, xnn_define_hardswish(subgraph, input_id, hardswish_id, 0 /* flags */));
+    EXPECT_EQ(xnn_status_success, xnn_define_sigmoid(subgraph, input_id, sigmoid_id, 0 /* flags */));
+    EXPECT_EQ(xnn_status_success, xnn_define_abs(subgraph, input_id, abs_id, 0 /* flags */));
+    EXPECT_EQ(xnn_status_success, xnn_define_multiply2(
+      subgraph, -std::numeric_limits<float>::infinity(), std::numeric_limits<float>::infinity(),
+      hardswish_id, sigmoid_id, product_id, 0 /* flags */));
+    EXPECT_EQ(xnn_status_success, xnn_define_negate(subgraph, abs_id, negate_id, 0 /* flags */));
+    EXPECT_EQ(xnn_status_success, xnn_define_add2(
+      subgraph, -std::numeric_limits<float>::infinity(), std::numeric_limits<float>::infinity(),
+      product_id, negate_id, output_id, 0 /* flags */));
+    return subgraph;
+  }
+
+  // HardSwish -> Sigmoid -> Negate -> Abs, where every Node depends on the previous one.
+  xnn_subgraph_t CreateChainSubgraph(size_t height, size_t width) {
+    xnn_subgraph_t subgraph = nullptr;
+    EXPECT_EQ(xnn_status_success, xnn_create_subgraph(2, 0 /* flags */, &subgraph));
+
+    const uint32_t input_id = DefineValue(subgraph, height, width, 0, XNN_VALUE_FLAG_EXTERNAL_INPUT);
+    const uint32_t hardswish_id = DefineInternalValue(subgraph, height, width);
+    const uint32_t sigmoid_id = DefineInternalValue(subgraph, height, width);
+    const uint32_t negate_id = DefineInternalValue(subgraph, height, width);
+    const uint32_t output_id = DefineValue(subgraph, height, width, 1, XNN_VALUE_FLAG_EXTERNAL_OUTPUT);
+
+    EXPECT_EQ(xnn_status_success, xnn_define_hardswish(subgraph, input_id, hardswish_id, 0 /* flags */));
+    EXPECT_EQ(xnn_status_success, xnn_define_sigmoid(subgraph, hardswish_id, sigmoid_id, 0 /* flags */));
+    EXPECT_EQ(xnn_status_success, xnn_define_negate(subgraph, sigmoid_id, negate_id, 0 /* flags */));
+    EXPECT_EQ(xnn_status_success, xnn_define_abs(subgraph, negate_id, output_id, 0 /* flags */));
+    return subgraph;
+  }
+
+  xnn_runtime_t CreateRuntime(xnn_subgraph_t subgraph, uint32_t flags) {
+    xnn_runtime_t runtime = nullptr;
+    EXPECT_EQ(xnn_status_success, xnn_create_runtime_v2(subgraph, threadpool, flags, &runtime));
+    return runtime;
+  }
+
+  std::vector<float> Invoke(xnn_runtime_t runtime, const std::vector<float>& input) {
+    size_t num_dims = 0;
+    std::array<size_t, XNN_MAX_TENSOR_DIMS> dims;
+    EXPECT_EQ(xnn_status_success, xnn_get_external_value_shape(runtime, 1, &num_dims, dims.data()));
+    size_t num_elements = 1;
+    for (size_t i = 0; i < num_dims; i++) {
+      num_elements *= dims[i];
+    }
+    std::vector<float> output(num_elements);
+    const std::array<xnn_external_value, 2> external = {{
+      xnn_external_value{0, const_cast<float*>(input.data())},
+      xnn_external_value{1, output.data()},
+    }};
+    EXPECT_EQ(xnn_status_success, xnn_setup_runtime(runtime, external.size(), external.data()));
+    EXPECT_EQ(xnn_status_success, xnn_invoke_runtime(runtime));
+    return output;
+  }
+
+  std::vector<float> RandomInput(size_t height, size_t width) {
+    auto f32rng = std::bind(std::uniform_real_distribution<float>(-5.0f, 5.0f), std::ref(rng));
+    std::vector<float> input(height * width * kChannels + XNN_EXTRA_BYTES / sizeof(float));
+    std::generate(input.begin(), input.end(), std::ref(f32rng));
+    return input;
+  }
+
+  pthreadpool_t threadpool = nullptr;
+  std::mt19937 rng;
+};
+
+}  // namespace
+
+TEST_F(RuntimeInterOpTest, branches_run_concurrently) {
+  std::unique_ptr<xnn_subgraph, decltype(&xnn_delete_subgraph)> subgraph(
+    CreateBranchySubgraph(5, 7), xnn_delete_subgraph);
+  std::unique_ptr<xnn_runtime, decltype(&xnn_delete_runtime)> runtime(
+    CreateRuntime(subgraph.get(), XNN_FLAG_INTER_OP_PARALLELISM), xnn_delete_runtime);
+  ASSERT_NE(nullptr, runtime);
+
+  ASSERT_EQ(3, runtime->num_levels);
+  EXPECT_EQ(3, runtime->levels[0].num_ops);
+  EXPECT_TRUE(runtime->levels[0].concurrent);
+  EXPECT_EQ(2, runtime->levels[1].num_ops);
+  EXPECT_TRUE(runtime->levels[1].concurrent);
+  EXPECT_EQ(1, runtime->levels[2].num_ops);
+  EXPECT_FALSE(runtime->levels[2].concurrent);
+  // Operators of a concurrent level share a step, and their Values must not share memory.
+  EXPECT_EQ(runtime->node_steps[0], runtime->node_steps[1]);
+  EXPECT_EQ(runtime->node_steps[0], runtime->node_steps[2]);
+  EXPECT_EQ(runtime->node_steps[3], runtime->node_steps[4]);
+  EXPECT_LT(runtime->node_steps[0], runtime->node_steps[3]);
+  EXPECT_LT(runtime->node_steps[3], runtime->node_steps[5]);
+}
+
+TEST_F(RuntimeInterOpTest, chain_runs_sequentially) {
+  std::unique_ptr<xnn_subgraph, decltype(&xnn_delete_subgraph)> subgraph(
+    CreateChainSubgraph(5, 7), xnn_delete_subgraph);
+  std::unique_ptr<xnn_runtime, decltype(&xnn_delete_runtime)> runtime(
+    CreateRuntime(subgraph.get(), XNN_FLAG_INTER_OP_PARALLELISM), xnn_delete_runtime);
+  ASSERT_NE(nullptr, runtime);
+
+  ASSERT_EQ(4, runtime->num_levels);
+  for (size_t l = 0; l < runtime->num_levels; l++) {
+    EXPECT_EQ(1, runtime->levels[l].num_ops);
+    EXPECT_FALSE(runtime->levels[l].concurrent);
+    EXPECT_EQ(l, runtime->node_steps[l]);
+  }
+
+  std::unique_ptr<xnn_runtime, decltype(&xnn_delete_runtime)> reference_runtime(
+    CreateRuntime(subgraph.get(), 0 /* flags */), xnn_delete_runtime);
+  ASSERT_NE(nullptr, reference_runtime);
+  const std::vector<float> input = RandomInput(5, 7);
+  EXPECT_EQ(Invoke(reference_runtime.get(), input), Invoke(runtime.get(), input));
+}
+
+TEST_F(RuntimeInterOpTest, matches_sequential_runtime) {
+  std::unique_ptr<xnn_subgraph, decltype(&xnn_delete_subgraph)> subgraph(
+    CreateBranchySubgraph(5, 7), xnn_delete_subgraph);
+  std::unique_ptr<xnn_runtime, decltype(&xnn_delete_runtime)> runtime(
+    CreateRuntime(subgraph.get(), XNN_FLAG_INTER_OP_PARALLELISM), xnn_delete_runtime);
+  ASSERT_NE(nullptr, runtime);
+  std::unique_ptr<xnn_runtime, decltype(&xnn_delete_runtime)> reference_runtime(
+    CreateRuntime(subgraph.get(), 0 /* flags */), xnn_delete_runtime);
+  ASSERT_NE(nullptr, reference_runtime);
+  ASSERT_EQ(nullptr, reference_runtime->levels);
+
+  // Repeat to give races between concurrently running operators a chance to show up.
+  for (size_t iteration = 0; iteration < 20; iteration++) {
+    const std::vector<float> input = RandomInput(5, 7);
+    EXPECT_EQ(Invoke(reference_runtime.get(), input), Invoke(runtime.get(), input));
+  }
+}
+
+TEST_F(RuntimeInterOpTest, matches_sequential_runtime_after_reshape) {
+  std::unique_ptr<xnn_subgraph, decltype(&xnn_delete_subgraph)> subgraph(
+    CreateBranchySubgraph(5, 7), xnn_delete_subgraph);
+  std::unique_ptr<xnn_runtime, decltype(&xnn_delete_runtime)> runtime(
+    CreateRuntime(subgraph.get(), XNN_FLAG_INTER_OP_PARALLELISM), xnn_delete_runtime);
+  ASSERT_NE(nullptr, runtime);
+  Invoke(runtime.get(), RandomInput(5, 7));
+
+  // Grow, then shrink the input: both re-plan the workspace shared by concurrently running operators.
+  for (const std::array<size_t, 2>& shape : {std::array<size_t, 2>{{19, 23}}, std::array<size_t, 2>{{3, 2}}}) {
+    const std::array<size_t, 4> input_dims = {{1, shape[0], shape[1], kChannels}};
+    ASSERT_EQ(xnn_status_success, xnn_reshape_external_value(runtime.get(), 0, input_dims.size(), input_dims.data()));
+    ASSERT_EQ(xnn_status_success, xnn_reshape_runtime(runtime.get()));
+
+    std::unique_ptr<xnn_subgraph, decltype(&xnn_delete_subgraph)> reference_subgraph(
+      CreateBranchySubgraph(shape[0], shape[1]), xnn_delete_subgraph);
+    std::unique_ptr<xnn_runtime, decltype(&xnn_delete_runtime)> reference_runtime(
+      CreateRuntime(reference_subgraph.get(), 0 /* flags */), xnn_delete_runtime);
+    ASSERT_NE(nullptr, reference_runtime);
+    for (size_t iteration = 0; iteration < 5; iteration++) {
+      const std::vector<float> input = RandomInput(shape[0], shape[1]);
+      EXPECT_EQ(Invoke(reference_runtime.get(), input), Invoke(runtime.get(), input));
+    }
+  }
+}
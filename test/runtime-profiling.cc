@@ -0,0 +1,128 @@
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <xnnpack.h>
+
+#include <gtest/gtest.h>
+
+namespace {
+
+// Builds a Subgraph with Add -> HardSwish -> Negate over [1, 4, 4, 8] FP32 tensors.
+xnn_subgraph_t CreateSubgraph() {
+  xnn_subgraph_t subgraph = nullptr;
+  EXPECT_EQ(xnn_status_success, xnn_create_subgraph(4, 0 /* flags */, &subgraph));
+
+  const std::array<size_t, 4> dims = {{1, 4, 4, 8}};
+  uint32_t input1_id = XNN_INVALID_VALUE_ID;
+  EXPECT_EQ(xnn_status_success, xnn_define_tensor_value(
+    subgraph, xnn_datatype_fp32, dims.size(), dims.data(), nullptr, 0,
+    XNN_VALUE_FLAG_EXTERNAL_INPUT, &input1_id));
+  uint32_t input2_id = XNN_INVALID_VALUE_ID;
+  EXPECT_EQ(xnn_status_success, xnn_define_tensor_value(
+    subgraph, xnn_datatype_fp32, dims.size(), dims.data(), nullptr, 1,
+    XNN_VALUE_FLAG_EXTERNAL_INPUT, &input2_id));
+  uint32_t sum_id = XNN_INVALID_VALUE_ID;
+  EXPECT_EQ(xnn_status_success, xnn_define_tensor_value(
+    subgraph, xnn_datatype_fp32, dims.size(), dims.data(), nullptr, XNN_INVALID_VALUE_ID, 0 /* flags */, &sum_id));
+  uint32_t hardswish_id = XNN_INVALID_VALUE_ID;
+  EXPECT_EQ(xnn_status_success, xnn_define_tensor_value(
+    subgraph, xnn_datatype_fp32, dims.size(), dims.data(), nullptr, XNN_INVALID_VALUE_ID, 0 /* flags */,
+    &hardswish_id));
+  uint32_t output_id = XNN_INVALID_VALUE_ID;
+  EXPECT_EQ(xnn_status_success, xnn_define_tensor_value(
+    subgraph, xnn_datatype_fp32, dims.size(), dims.data(), nullptr, 2,
+    XNN_VALUE_FLAG_EXTERNAL_OUTPUT, &output_id));
+
+  EXPECT_EQ(xnn_status_success, xnn_define_add2(
+    subgraph, -std::numeric_limits<float>::infinity(), std::numeric_limits<float>::infinity(),
+    input1_id, input2_id, sum_id, 0 /* flags */));
+  EXPECT_EQ(xnn_status_success, xnn_define_hardswish(subgraph, sum_id, hardswish_id, 0 /* flags */));
+  EXPECT_EQ(xnn_status_success, xnn_define_negate(subgraph, hardswish_id, output_id, 0 /* flags */));
+  return subgraph;
+}
+
+}  // namespace
+
+TEST(RUNTIME_PROFILING, disabled_by_default) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  std::unique_ptr<xnn_subgraph, decltype(&xnn_delete_subgraph)> subgraph(CreateSubgraph(), xnn_delete_subgraph);
+
+  xnn_runtime_t runtime_ptr = nullptr;
+  ASSERT_EQ(xnn_status_success, xnn_create_runtime_v2(subgraph.get(), nullptr, 0 /* flags */, &runtime_ptr));
+  std::unique_ptr<xnn_runtime, decltype(&xnn_delete_runtime)> runtime(runtime_ptr, xnn_delete_runtime);
+
+  size_t num_operators = 0;
+  size_t required_size = 0;
+  ASSERT_EQ(xnn_status_invalid_state,
+    xnn_get_runtime_profiling_info(runtime.get(), xnn_profile_info_num_operators,
+      sizeof(num_operators), &num_operators, &required_size));
+}
+
+TEST(RUNTIME_PROFILING, per_operator_info) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  std::unique_ptr<xnn_subgraph, decltype(&xnn_delete_subgraph)> subgraph(CreateSubgraph(), xnn_delete_subgraph);
+
+  xnn_runtime_t runtime_ptr = nullptr;
+  ASSERT_EQ(xnn_status_success,
+    xnn_create_runtime_v2(subgraph.get(), nullptr, XNN_FLAG_BASIC_PROFILING, &runtime_ptr));
+  std::unique_ptr<xnn_runtime, decltype(&xnn_delete_runtime)> runtime(runtime_ptr, xnn_delete_runtime);
+
+  const size_t num_elements = 1 * 4 * 4 * 8;
+  std::vector<float> input1(num_elements + XNN_EXTRA_BYTES / sizeof(float), 1.0f);
+  std::vector<float> input2(num_elements + XNN_EXTRA_BYTES / sizeof(float), 2.0f);
+  std::vector<float> output(num_elements);
+  const std::array<xnn_external_value, 3> external = {{
+    xnn_external_value{0, input1.data()},
+    xnn_external_value{1, input2.data()},
+    xnn_external_value{2, output.data()},
+  }};
+  ASSERT_EQ(xnn_status_success, xnn_setup_runtime(runtime.get(), external.size(), external.data()));
+  ASSERT_EQ(xnn_status_success, xnn_invoke_runtime(runtime.get()));
+
+  size_t required_size = 0;
+  size_t num_operators = 0;
+  ASSERT_EQ(xnn_status_success,
+    xnn_get_runtime_profiling_info(runtime.get(), xnn_profile_info_num_operators,
+      sizeof(num_operators), &num_operators, &required_size));
+  ASSERT_EQ(3, num_operators);
+
+  // Too small buffer reports the required size.
+  ASSERT_EQ(xnn_status_out_of_memory,
+    xnn_get_runtime_profiling_info(runtime.get(), xnn_profile_info_operator_name, 0, nullptr, &required_size));
+  std::vector<char> names(required_size);
+  ASSERT_EQ(xnn_status_success,
+    xnn_get_runtime_profiling_info(runtime.get(), xnn_profile_info_operator_name,
+      names.size(), names.data(), &required_size));
+  std::vector<std::string> operator_names;
+  for (const char* name = names.data(); name != names.data() + names.size(); name += std::strlen(name) + 1) {
+    operator_names.emplace_back(name);
+  }
+  ASSERT_EQ(3, operator_names.size());
+  EXPECT_EQ("Add (ND, F32)", operator_names[0]);
+  EXPECT_EQ("HardSwish (NC, F32)", operator_names[1]);
+  EXPECT_EQ("Negate (NC, F32)", operator_names[2]);
+
+  std::vector<uint64_t> timing(num_operators);
+  ASSERT_EQ(xnn_status_success,
+    xnn_get_runtime_profiling_info(runtime.get(), xnn_profile_info_operator_timing,
+      timing.size() * sizeof(uint64_t), timing.data(), &required_size));
+
+  std::vector<size_t> bytes(num_operators);
+  ASSERT_EQ(xnn_status_success,
+    xnn_get_runtime_profiling_info(runtime.get(), xnn_profile_info_operator_bytes,
+      bytes.size() * sizeof(size_t), bytes.data(), &required_size));
+  EXPECT_EQ(3 * num_elements * sizeof(float), bytes[0]);
+  EXPECT_EQ(2 * num_elements * sizeof(float), bytes[1]);
+  EXPECT_EQ(2 * num_elements * sizeof(float), bytes[2]);
+}
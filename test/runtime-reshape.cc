@@ -0,0 +1,246 @@
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include <xnnpack.h>
+#include <xnnpack/math.h>
+#include <xnnpack/subgraph.h>
+
+#include <gtest/gtest.h>
+
+namespace {
+
+// Builds a Subgraph with Convolution (3x3 stride 2, 3 -> 8 channels) -> HardSwish -> Add (with the Convolution output)
+// over [1, height, width, 3] FP32 input.
+class RuntimeReshapeTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+
+    std::random_device random_device;
+    rng = std::mt19937(random_device());
+    auto f32rng = std::bind(std::uniform_real_distribution<float>(-1.0f, 1.0f), std::ref(rng));
+    std::generate(filter.begin(), filter.end(), std::ref(f32rng));
+    std::generate(bias.begin(), bias.end(), std::ref(f32rng));
+  }
+
+  static size_t OutputDimension(size_t input_dimension) {
+    return (input_dimension + 2 - 3) / 2 + 1;
+  }
+
+  xnn_runtime_t CreateRuntime(size_t height, size_t width, uint32_t flags = 0) {
+    xnn_subgraph_t subgraph_ptr = nullptr;
+    EXPECT_EQ(xnn_status_success, xnn_create_subgraph(2, 0 /* flags */, &subgraph_ptr));
+    std::unique_ptr<xnn_subgraph, decltype(&xnn_delete_subgraph)> subgraph(subgraph_ptr, xnn_delete_subgraph);
+
+    const std::array<size_t, 4> input_dims = {{1, height, width, 3}};
+    uint32_t input_id = XNN_INVALID_VALUE_ID;
+    EXPECT_EQ(xnn_status_success, xnn_define_tensor_value(
+      subgraph.get(), xnn_datatype_fp32, input_dims.size(), input_dims.data(), nullptr, 0,
+      XNN_VALUE_FLAG_EXTERNAL_INPUT, &input_id));
+    const std::array<size_t, 4> filter_dims = {{8, 3, 3, 3}};
+    uint32_t filter_id = XNN_INVALID_VALUE_ID;
+    EXPECT_EQ(xnn_status_success, xnn_define_tensor_value(
+      subgraph.get(), xnn_datatype_fp32, filter_dims.size(), filter_dims.data(), filter.data(),
+      XNN_INVALID_VALUE_ID, 0 /* flags */, &filter_id));
+    const std::array<size_t, 1> bias_dims = {{8}};
+    uint32_t bias_id = XNN_INVALID_VALUE_ID;
+    EXPECT_EQ(xnn_status_success, xnn_define_tensor_value(
+      subgraph.get(), xnn_datatype_fp32, bias_dims.size(), bias_dims.data(), bias.data(),
+      XNN_INVALID_VALUE_ID, 0 /* flags */, &bias_id));
+    const std::array<size_t, 4> output_dims = {{1, OutputDimension(height), OutputDimension(width), 8}};
+    uint32_t conv_output_id = XNN_INVALID_VALUE_ID;
+    EXPECT_EQ(xnn_status_success, xnn_define_tensor_value(
+      subgraph.get(), xnn_datatype_fp32, output_dims.size(), output_dims.data(), nullptr,
+      XNN_INVALID_VALUE_ID, 0 /* flags */, &conv_output_id));
+    uint32_t hardswish_output_id = XNN_INVALID_VALUE_ID;
+    EXPECT_EQ(xnn_status_success, xnn_define_tensor_value(
+      subgraph.get(), xnn_datatype_fp32, output_dims.size(), output_dims.data(), nullptr,
+      XNN_INVALID_VALUE_ID, 0 /* flags */, &hardswish_output_id));
+    uint32_t output_id = XNN_INVALID_VALUE_ID;
+    EXPECT_EQ(xnn_status_success, xnn_define_tensor_value(
+      subgraph.get(), xnn_datatype_fp32, output_dims.size(), output_dims.data(), nullptr, 1,
+      XNN_VALUE_FLAG_EXTERNAL_OUTPUT, &output_id));
+
+    EXPECT_EQ(xnn_status_success, xnn_define_convolution_2d(
+      subgraph.get(), 1, 1, 1, 1, 3, 3, 2, 2, 1, 1, 1, 3, 8,
+      -std::numeric_limits<float>::infinity(), std::numeric_limits<float>::infinity(),
+      input_id, filter_id, bias_id, conv_output_id, 0 /* flags */));
+    EXPECT_EQ(xnn_status_success, xnn_define_hardswish(
+      subgraph.get(), conv_output_id, hardswish_output_id, 0 /* flags */));
+    EXPECT_EQ(xnn_status_success, xnn_define_add2(
+      subgraph.get(), -std::numeric_limits<float>::infinity(), std::numeric_limits<float>::infinity(),
+      hardswish_output_id, conv_output_id, output_id, 0 /* flags */));
+
+    xnn_runtime_t runtime = nullptr;
+    EXPECT_EQ(xnn_status_success, xnn_create_runtime_v2(subgraph.get(), nullptr, flags, &runtime));
+    return runtime;
+  }
+
+  std::vector<float> Invoke(xnn_runtime_t runtime, const std::vector<float>& input) {
+    size_t num_dims = 0;
+    std::array<size_t, XNN_MAX_TENSOR_DIMS> dims;
+    EXPECT_EQ(xnn_status_success, xnn_get_external_value_shape(runtime, 1, &num_dims, dims.data()));
+    size_t num_elements = 1;
+    for (size_t i = 0; i < num_dims; i++) {
+      num_elements *= dims[i];
+    }
+    std::vector<float> output(num_elements);
+    const std::array<xnn_external_value, 2> external = {{
+      xnn_external_value{0, const_cast<float*>(input.data())},
+      xnn_external_value{1, output.data()},
+    }};
+    EXPECT_EQ(xnn_status_success, xnn_setup_runtime(runtime, external.size(), external.data()));
+    EXPECT_EQ(xnn_status_success, xnn_invoke_runtime(runtime));
+    return output;
+  }
+
+  std::vector<float> RandomInput(size_t height, size_t width) {
+    auto f32rng = std::bind(std::uniform_real_distribution<float>(-1.0f, 1.0f), std::ref(rng));
+    std::vector<float> input(height * width * 3 + XNN_EXTRA_BYTES / sizeof(float));
+    std::generate(input.begin(), input.end(), std::ref(f32rng));
+    return input;
+  }
+
+  std::mt19937 rng;
+  std::vector<float> filter = std::vector<float>(8 * 3 * 3 * 3);
+  std::vector<float> bias = std::vector<float>(8);
+};
+
+}  // namespace
+
+TEST_F(RuntimeReshapeTest, matches_new_runtime) {
+  std::unique_ptr<xnn_runtime, decltype(&xnn_delete_runtime)> runtime(CreateRuntime(5, 5), xnn_delete_runtime);
+  ASSERT_NE(nullptr, runtime);
+  Invoke(runtime.get(), RandomInput(5, 5));
+
+  const std::array<size_t, 4> input_dims = {{1, 9, 7, 3}};
+  ASSERT_EQ(xnn_status_success, xnn_reshape_external_value(runtime.get(), 0, input_dims.size(), input_dims.data()));
+  ASSERT_EQ(xnn_status_success, xnn_reshape_runtime(runtime.get()));
+
+  size_t num_dims = 0;
+  std::array<size_t, XNN_MAX_TENSOR_DIMS> dims;
+  ASSERT_EQ(xnn_status_success, xnn_get_external_value_shape(runtime.get(), 1, &num_dims, dims.data()));
+  ASSERT_EQ(4, num_dims);
+  EXPECT_EQ(1, dims[0]);
+  EXPECT_EQ(OutputDimension(9), dims[1]);
+  EXPECT_EQ(OutputDimension(7), dims[2]);
+  EXPECT_EQ(8, dims[3]);
+
+  std::unique_ptr<xnn_runtime, decltype(&xnn_delete_runtime)> new_runtime(CreateRuntime(9, 7), xnn_delete_runtime);
+  ASSERT_NE(nullptr, new_runtime);
+  const std::vector<float> input = RandomInput(9, 7);
+  EXPECT_EQ(Invoke(new_runtime.get(), input), Invoke(runtime.get(), input));
+}
+
+TEST_F(RuntimeReshapeTest, reuses_workspace_when_shrinking) {
+  std::unique_ptr<xnn_runtime, decltype(&xnn_delete_runtime)> runtime(CreateRuntime(9, 9), xnn_delete_runtime);
+  ASSERT_NE(nullptr, runtime);
+  const void* workspace_data = runtime->workspace->data;
+  const size_t workspace_size = runtime->workspace->size;
+
+  const std::array<size_t, 4> input_dims = {{1, 5, 5, 3}};
+  ASSERT_EQ(xnn_status_success, xnn_reshape_external_value(runtime.get(), 0, input_dims.size(), input_dims.data()));
+  ASSERT_EQ(xnn_status_success, xnn_reshape_runtime(runtime.get()));
+  EXPECT_EQ(workspace_data, runtime->workspace->data);
+  EXPECT_EQ(workspace_size, runtime->workspace->size);
+
+  std::unique_ptr<xnn_runtime, decltype(&xnn_delete_runtime)> new_runtime(CreateRuntime(5, 5), xnn_delete_runtime);
+  ASSERT_NE(nullptr, new_runtime);
+  const std::vector<float> input = RandomInput(5, 5);
+  EXPECT_EQ(Invoke(new_runtime.get(), input), Invoke(runtime.get(), input));
+}
+
+TEST_F(RuntimeReshapeTest, reports_workspace_size) {
+  std::unique_ptr<xnn_runtime, decltype(&xnn_delete_runtime)> runtime(
+    CreateRuntime(5, 5, XNN_FLAG_GREEDY_BY_SIZE_MEMORY_PLANNING), xnn_delete_runtime);
+  ASSERT_NE(nullptr, runtime);
+
+  // Convolution and HardSwish outputs are both live while Add runs.
+  size_t workspace_size = 0;
+  size_t workspace_lower_bound = 0;
+  ASSERT_EQ(xnn_status_success, xnn_get_runtime_workspace_size(runtime.get(), &workspace_size, &workspace_lower_bound));
+  const size_t value_size = round_up_po2(OutputDimension(5) * OutputDimension(5) * 8 * sizeof(float), XNN_EXTRA_BYTES);
+  EXPECT_EQ(2 * value_size, workspace_lower_bound);
+  EXPECT_EQ(workspace_lower_bound, workspace_size);
+
+  const std::array<size_t, 4> input_dims = {{1, 9, 9, 3}};
+  ASSERT_EQ(xnn_status_success, xnn_reshape_external_value(runtime.get(), 0, input_dims.size(), input_dims.data()));
+  ASSERT_EQ(xnn_status_success, xnn_reshape_runtime(runtime.get()));
+  ASSERT_EQ(xnn_status_success, xnn_get_runtime_workspace_size(runtime.get(), &workspace_size, &workspace_lower_bound));
+  const size_t reshaped_value_size =
+    round_up_po2(OutputDimension(9) * OutputDimension(9) * 8 * sizeof(float), XNN_EXTRA_BYTES);
+  EXPECT_EQ(2 * reshaped_value_size, workspace_lower_bound);
+  EXPECT_EQ(workspace_lower_bound, workspace_size);
+}
+
+TEST_F(RuntimeReshapeTest, setup_requires_reshape) {
+  std::unique_ptr<xnn_runtime, decltype(&xnn_delete_runtime)> runtime(CreateRuntime(5, 5), xnn_delete_runtime);
+  ASSERT_NE(nullptr, runtime);
+
+  const std::array<size_t, 4> input_dims = {{1, 7, 7, 3}};
+  ASSERT_EQ(xnn_status_success, xnn_reshape_external_value(runtime.get(), 0, input_dims.size(), input_dims.data()));
+
+  std::vector<float> input = RandomInput(7, 7);
+  std::vector<float> output(OutputDimension(7) * OutputDimension(7) * 8);
+  const std::array<xnn_external_value, 2> external = {{
+    xnn_external_value{0, input.data()},
+    xnn_external_value{1, output.data()},
+  }};
+  EXPECT_EQ(xnn_status_invalid_state, xnn_setup_runtime(runtime.get(), external.size(), external.data()));
+}
+
+TEST_F(RuntimeReshapeTest, invoke_requires_setup_after_reshape) {
+  std::unique_ptr<xnn_runtime, decltype(&xnn_delete_runtime)> runtime(CreateRuntime(5, 5), xnn_delete_runtime);
+  ASSERT_NE(nullptr, runtime);
+  Invoke(runtime.get(), RandomInput(5, 5));
+
+  // Shapes changed, but the runtime was not reshaped yet.
+  const std::array<size_t, 4> input_dims = {{1, 9, 9, 3}};
+  ASSERT_EQ(xnn_status_success, xnn_reshape_external_value(runtime.get(), 0, input_dims.size(), input_dims.data()));
+  EXPECT_EQ(xnn_status_invalid_state, xnn_invoke_runtime(runtime.get()));
+
+  // Operators were reshaped and the workspace was re-planned, but blob pointers were not set up again.
+  ASSERT_EQ(xnn_status_success, xnn_reshape_runtime(runtime.get()));
+  EXPECT_EQ(xnn_status_invalid_state, xnn_invoke_runtime(runtime.get()));
+
+  std::vector<float> input = RandomInput(9, 9);
+  std::vector<float> output(OutputDimension(9) * OutputDimension(9) * 8);
+  const std::array<xnn_external_value, 2> external = {{
+    xnn_external_value{0, input.data()},
+    xnn_external_value{1, output.data()},
+  }};
+  ASSERT_EQ(xnn_status_success, xnn_setup_runtime(runtime.get(), external.size(), external.data()));
+  EXPECT_EQ(xnn_status_success, xnn_invoke_runtime(runtime.get()));
+}
+
+TEST_F(RuntimeReshapeTest, rejects_invalid_shapes) {
+  std::unique_ptr<xnn_runtime, decltype(&xnn_delete_runtime)> runtime(CreateRuntime(5, 5), xnn_delete_runtime);
+  ASSERT_NE(nullptr, runtime);
+
+  // Number of dimensions can't change.
+  const std::array<size_t, 3> input_dims_3d = {{5, 5, 3}};
+  EXPECT_EQ(xnn_status_invalid_parameter,
+    xnn_reshape_external_value(runtime.get(), 0, input_dims_3d.size(), input_dims_3d.data()));
+
+  // Only external inputs can be reshaped.
+  const std::array<size_t, 4> output_dims = {{1, 4, 4, 8}};
+  EXPECT_EQ(xnn_status_invalid_parameter,
+    xnn_reshape_external_value(runtime.get(), 1, output_dims.size(), output_dims.data()));
+
+  // Number of channels is fixed by the packed weights.
+  const std::array<size_t, 4> input_dims = {{1, 5, 5, 4}};
+  ASSERT_EQ(xnn_status_success, xnn_reshape_external_value(runtime.get(), 0, input_dims.size(), input_dims.data()));
+  EXPECT_EQ(xnn_status_invalid_parameter, xnn_reshape_runtime(runtime.get()));
+}
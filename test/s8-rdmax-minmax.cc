@@ -0,0 +1,351 @@
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <gtest/gtest.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/isa-checks.h>
+
+#include <xnnpack/params-init.h>
+#include <xnnpack/rmax.h>
+#include "rdmax-microkernel-tester.h"
+
+#if XNN_ARCH_ARM || XNN_ARCH_ARM64
+  TEST(S8_RDMAX_MINMAX_C16__NEON, channels_eq_16) {
+    TEST_REQUIRES_ARM_NEON;
+    RDMaxMicrokernelTester()
+      .rows(1)
+      .channels(16)
+      .Test(xnn_s8_rdmax_minmax_ukernel_c16__neon, xnn_init_s8_minmax_neon_params);
+  }
+
+  TEST(S8_RDMAX_MINMAX_C16__NEON, channels_div_16) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t channels = 32; channels < 128; channels += 16) {
+      RDMaxMicrokernelTester()
+        .rows(3)
+        .channels(channels)
+        .Test(xnn_s8_rdmax_minmax_ukernel_c16__neon, xnn_init_s8_minmax_neon_params);
+    }
+  }
+
+  TEST(S8_RDMAX_MINMAX_C16__NEON, channels_lt_16) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t channels = 1; channels < 16; channels++) {
+      RDMaxMicrokernelTester()
+        .rows(3)
+        .channels(channels)
+        .Test(xnn_s8_rdmax_minmax_ukernel_c16__neon, xnn_init_s8_minmax_neon_params);
+    }
+  }
+
+  TEST(S8_RDMAX_MINMAX_C16__NEON, channels_gt_16) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t channels = 17; channels < 32; channels++) {
+      RDMaxMicrokernelTester()
+        .rows(3)
+        .channels(channels)
+        .Test(xnn_s8_rdmax_minmax_ukernel_c16__neon, xnn_init_s8_minmax_neon_params);
+    }
+  }
+
+  TEST(S8_RDMAX_MINMAX_C16__NEON, rows_gt_1) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t rows = 2; rows < 16; rows++) {
+      for (size_t channels = 1; channels <= 80; channels += 15) {
+        RDMaxMicrokernelTester()
+          .rows(rows)
+          .channels(channels)
+          .Test(xnn_s8_rdmax_minmax_ukernel_c16__neon, xnn_init_s8_minmax_neon_params);
+      }
+    }
+  }
+
+  TEST(S8_RDMAX_MINMAX_C16__NEON, input_stride) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t rows = 1; rows < 8; rows++) {
+      for (size_t channels = 1; channels <= 80; channels += 15) {
+        RDMaxMicrokernelTester()
+          .rows(rows)
+          .channels(channels)
+          .input_stride(83)
+          .Test(xnn_s8_rdmax_minmax_ukernel_c16__neon, xnn_init_s8_minmax_neon_params);
+      }
+    }
+  }
+
+  TEST(S8_RDMAX_MINMAX_C16__NEON, qmin) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t channels = 1; channels <= 80; channels += 15) {
+      RDMaxMicrokernelTester()
+        .rows(5)
+        .channels(channels)
+        .qmin(-64)
+        .Test(xnn_s8_rdmax_minmax_ukernel_c16__neon, xnn_init_s8_minmax_neon_params);
+    }
+  }
+
+  TEST(S8_RDMAX_MINMAX_C16__NEON, qmax) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t channels = 1; channels <= 80; channels += 15) {
+      RDMaxMicrokernelTester()
+        .rows(5)
+        .channels(channels)
+        .qmax(64)
+        .Test(xnn_s8_rdmax_minmax_ukernel_c16__neon, xnn_init_s8_minmax_neon_params);
+    }
+  }
+#endif  // XNN_ARCH_ARM || XNN_ARCH_ARM64
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(S8_RDMAX_MINMAX_C16__SSE2, channels_eq_16) {
+    TEST_REQUIRES_X86_SSE2;
+    RDMaxMicrokernelTester()
+      .rows(1)
+      .channels(16)
+      .Test(xnn_s8_rdmax_minmax_ukernel_c16__sse2, xnn_init_s8_minmax_sse2_params);
+  }
+
+  TEST(S8_RDMAX_MINMAX_C16__SSE2, channels_div_16) {
+    TEST_REQUIRES_X86_SSE2;
+    for (size_t channels = 32; channels < 128; channels += 16) {
+      RDMaxMicrokernelTester()
+        .rows(3)
+        .channels(channels)
+        .Test(xnn_s8_rdmax_minmax_ukernel_c16__sse2, xnn_init_s8_minmax_sse2_params);
+    }
+  }
+
+  TEST(S8_RDMAX_MINMAX_C16__SSE2, channels_lt_16) {
+    TEST_REQUIRES_X86_SSE2;
+    for (size_t channels = 1; channels < 16; channels++) {
+      RDMaxMicrokernelTester()
+        .rows(3)
+        .channels(channels)
+        .Test(xnn_s8_rdmax_minmax_ukernel_c16__sse2, xnn_init_s8_minmax_sse2_params);
+    }
+  }
+
+  TEST(S8_RDMAX_MINMAX_C16__SSE2, channels_gt_16) {
+    TEST_REQUIRES_X86_SSE2;
+    for (size_t channels = 17; channels < 32; channels++) {
+      RDMaxMicrokernelTester()
+        .rows(3)
+        .channels(channels)
+        .Test(xnn_s8_rdmax_minmax_ukernel_c16__sse2, xnn_init_s8_minmax_sse2_params);
+    }
+  }
+
+  TEST(S8_RDMAX_MINMAX_C16__SSE2, rows_gt_1) {
+    TEST_REQUIRES_X86_SSE2;
+    for (size_t rows = 2; rows < 16; rows++) {
+      for (size_t channels = 1; channels <= 80; channels += 15) {
+        RDMaxMicrokernelTester()
+          .rows(rows)
+          .channels(channels)
+          .Test(xnn_s8_rdmax_minmax_ukernel_c16__sse2, xnn_init_s8_minmax_sse2_params);
+      }
+    }
+  }
+
+  TEST(S8_RDMAX_MINMAX_C16__SSE2, input_stride) {
+    TEST_REQUIRES_X86_SSE2;
+    for (size_t rows = 1; rows < 8; rows++) {
+      for (size_t channels = 1; channels <= 80; channels += 15) {
+        RDMaxMicrokernelTester()
+          .rows(rows)
+          .channels(channels)
+          .input_stride(83)
+          .Test(xnn_s8_rdmax_minmax_ukernel_c16__sse2, xnn_init_s8_minmax_sse2_params);
+      }
+    }
+  }
+
+  TEST(S8_RDMAX_MINMAX_C16__SSE2, qmin) {
+    TEST_REQUIRES_X86_SSE2;
+    for (size_t channels = 1; channels <= 80; channels += 15) {
+      RDMaxMicrokernelTester()
+        .rows(5)
+        .channels(channels)
+        .qmin(-64)
+        .Test(xnn_s8_rdmax_minmax_ukernel_c16__sse2, xnn_init_s8_minmax_sse2_params);
+    }
+  }
+
+  TEST(S8_RDMAX_MINMAX_C16__SSE2, qmax) {
+    TEST_REQUIRES_X86_SSE2;
+    for (size_t channels = 1; channels <= 80; channels += 15) {
+      RDMaxMicrokernelTester()
+        .rows(5)
+        .channels(channels)
+        .qmax(64)
+        .Test(xnn_s8_rdmax_minmax_ukernel_c16__sse2, xnn_init_s8_minmax_sse2_params);
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(S8_RDMAX_MINMAX_C16__SSE41, channels_eq_16) {
+    TEST_REQUIRES_X86_SSE41;
+    RDMaxMicrokernelTester()
+      .rows(1)
+      .channels(16)
+      .Test(xnn_s8_rdmax_minmax_ukernel_c16__sse41, xnn_init_s8_minmax_sse4_params);
+  }
+
+  TEST(S8_RDMAX_MINMAX_C16__SSE41, channels_div_16) {
+    TEST_REQUIRES_X86_SSE41;
+    for (size_t channels = 32; channels < 128; channels += 16) {
+      RDMaxMicrokernelTester()
+        .rows(3)
+        .channels(channels)
+        .Test(xnn_s8_rdmax_minmax_ukernel_c16__sse41, xnn_init_s8_minmax_sse4_params);
+    }
+  }
+
+  TEST(S8_RDMAX_MINMAX_C16__SSE41, channels_lt_16) {
+    TEST_REQUIRES_X86_SSE41;
+    for (size_t channels = 1; channels < 16; channels++) {
+      RDMaxMicrokernelTester()
+        .rows(3)
+        .channels(channels)
+        .Test(xnn_s8_rdmax_minmax_ukernel_c16__sse41, xnn_init_s8_minmax_sse4_params);
+    }
+  }
+
+  TEST(S8_RDMAX_MINMAX_C16__SSE41, channels_gt_16) {
+    TEST_REQUIRES_X86_SSE41;
+    for (size_t channels = 17; channels < 32; channels++) {
+      RDMaxMicrokernelTester()
+        .rows(3)
+        .channels(channels)
+        .Test(xnn_s8_rdmax_minmax_ukernel_c16__sse41, xnn_init_s8_minmax_sse4_params);
+    }
+  }
+
+  TEST(S8_RDMAX_MINMAX_C16__SSE41, rows_gt_1) {
+    TEST_REQUIRES_X86_SSE41;
+    for (size_t rows = 2; rows < 16; rows++) {
+      for (size_t channels = 1; channels <= 80; channels += 15) {
+        RDMaxMicrokernelTester()
+          .rows(rows)
+          .channels(channels)
+          .Test(xnn_s8_rdmax_minmax_ukernel_c16__sse41, xnn_init_s8_minmax_sse4_params);
+      }
+    }
+  }
+
+  TEST(S8_RDMAX_MINMAX_C16__SSE41, input_stride) {
+    TEST_REQUIRES_X86_SSE41;
+    for (size_t rows = 1; rows < 8; rows++) {
+      for (size_t channels = 1; channels <= 80; channels += 15) {
+        RDMaxMicrokernelTester()
+          .rows(rows)
+          .channels(channels)
+          .input_stride(83)
+          .Test(xnn_s8_rdmax_minmax_ukernel_c16__sse41, xnn_init_s8_minmax_sse4_params);
+      }
+    }
+  }
+
+  TEST(S8_RDMAX_MINMAX_C16__SSE41, qmin) {
+    TEST_REQUIRES_X86_SSE41;
+    for (size_t channels = 1; channels <= 80; channels += 15) {
+      RDMaxMicrokernelTester()
+        .rows(5)
+        .channels(channels)
+        .qmin(-64)
+        .Test(xnn_s8_rdmax_minmax_ukernel_c16__sse41, xnn_init_s8_minmax_sse4_params);
+    }
+  }
+
+  TEST(S8_RDMAX_MINMAX_C16__SSE41, qmax) {
+    TEST_REQUIRES_X86_SSE41;
+    for (size_t channels = 1; channels <= 80; channels += 15) {
+      RDMaxMicrokernelTester()
+        .rows(5)
+        .channels(channels)
+        .qmax(64)
+        .Test(xnn_s8_rdmax_minmax_ukernel_c16__sse41, xnn_init_s8_minmax_sse4_params);
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+TEST(S8_RDMAX_MINMAX_C4__SCALAR, channels_eq_4) {
+  RDMaxMicrokernelTester()
+    .rows(1)
+    .channels(4)
+    .Test(xnn_s8_rdmax_minmax_ukernel_c4__scalar, xnn_init_s8_minmax_scalar_params);
+}
+
+TEST(S8_RDMAX_MINMAX_C4__SCALAR, channels_div_4) {
+  for (size_t channels = 8; channels < 32; channels += 4) {
+    RDMaxMicrokernelTester()
+      .rows(3)
+      .channels(channels)
+      .Test(xnn_s8_rdmax_minmax_ukernel_c4__scalar, xnn_init_s8_minmax_scalar_params);
+  }
+}
+
+TEST(S8_RDMAX_MINMAX_C4__SCALAR, channels_lt_4) {
+  for (size_t channels = 1; channels < 4; channels++) {
+    RDMaxMicrokernelTester()
+      .rows(3)
+      .channels(channels)
+      .Test(xnn_s8_rdmax_minmax_ukernel_c4__scalar, xnn_init_s8_minmax_scalar_params);
+  }
+}
+
+TEST(S8_RDMAX_MINMAX_C4__SCALAR, channels_gt_4) {
+  for (size_t channels = 5; channels < 8; channels++) {
+    RDMaxMicrokernelTester()
+      .rows(3)
+      .channels(channels)
+      .Test(xnn_s8_rdmax_minmax_ukernel_c4__scalar, xnn_init_s8_minmax_scalar_params);
+  }
+}
+
+TEST(S8_RDMAX_MINMAX_C4__SCALAR, rows_gt_1) {
+  for (size_t rows = 2; rows < 16; rows++) {
+    for (size_t channels = 1; channels <= 20; channels += 3) {
+      RDMaxMicrokernelTester()
+        .rows(rows)
+        .channels(channels)
+        .Test(xnn_s8_rdmax_minmax_ukernel_c4__scalar, xnn_init_s8_minmax_scalar_params);
+    }
+  }
+}
+
+TEST(S8_RDMAX_MINMAX_C4__SCALAR, input_stride) {
+  for (size_t rows = 1; rows < 8; rows++) {
+    for (size_t channels = 1; channels <= 20; channels += 3) {
+      RDMaxMicrokernelTester()
+        .rows(rows)
+        .channels(channels)
+        .input_stride(23)
+        .Test(xnn_s8_rdmax_minmax_ukernel_c4__scalar, xnn_init_s8_minmax_scalar_params);
+    }
+  }
+}
+
+TEST(S8_RDMAX_MINMAX_C4__SCALAR, qmin) {
+  for (size_t channels = 1; channels <= 20; channels += 3) {
+    RDMaxMicrokernelTester()
+      .rows(5)
+      .channels(channels)
+      .qmin(-64)
+      .Test(xnn_s8_rdmax_minmax_ukernel_c4__scalar, xnn_init_s8_minmax_scalar_params);
+  }
+}
+
+TEST(S8_RDMAX_MINMAX_C4__SCALAR, qmax) {
+  for (size_t channels = 1; channels <= 20; channels += 3) {
+    RDMaxMicrokernelTester()
+      .rows(5)
+      .channels(channels)
+      .qmax(64)
+      .Test(xnn_s8_rdmax_minmax_ukernel_c4__scalar, xnn_init_s8_minmax_scalar_params);
+  }
+}
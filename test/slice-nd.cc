@@ -0,0 +1,298 @@
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <gtest/gtest.h>
+
+#include "slice-operator-tester.h"
+
+TEST(SLICE_ND_X8, 1d) {
+  SliceOperatorTester()
+    .input_shape({17})
+    .offsets({3})
+    .sizes({11})
+    .TestX8();
+}
+
+TEST(SLICE_ND_X8, 1d_strided) {
+  SliceOperatorTester()
+    .input_shape({17})
+    .offsets({1})
+    .sizes({6})
+    .strides({3})
+    .TestX8();
+}
+
+TEST(SLICE_ND_X8, 1d_in_place) {
+  SliceOperatorTester()
+    .input_shape({17})
+    .offsets({5})
+    .sizes({9})
+    .in_place(true)
+    .TestX8();
+}
+
+TEST(SLICE_ND_X8, 2d_inner) {
+  SliceOperatorTester()
+    .input_shape({5, 17})
+    .offsets({0, 3})
+    .sizes({5, 11})
+    .TestX8();
+}
+
+TEST(SLICE_ND_X8, 2d_outer) {
+  SliceOperatorTester()
+    .input_shape({5, 17})
+    .offsets({1, 0})
+    .sizes({3, 17})
+    .TestX8();
+}
+
+TEST(SLICE_ND_X8, 2d_outer_in_place) {
+  SliceOperatorTester()
+    .input_shape({5, 17})
+    .offsets({1, 0})
+    .sizes({3, 17})
+    .in_place(true)
+    .TestX8();
+}
+
+TEST(SLICE_ND_X8, 2d_strided_inner) {
+  SliceOperatorTester()
+    .input_shape({5, 17})
+    .offsets({1, 2})
+    .sizes({3, 5})
+    .strides({1, 3})
+    .TestX8();
+}
+
+TEST(SLICE_ND_X8, 2d_strided_outer) {
+  SliceOperatorTester()
+    .input_shape({9, 17})
+    .offsets({1, 0})
+    .sizes({4, 17})
+    .strides({2, 1})
+    .TestX8();
+}
+
+TEST(SLICE_ND_X8, 3d) {
+  SliceOperatorTester()
+    .input_shape({3, 5, 7})
+    .offsets({1, 2, 3})
+    .sizes({2, 2, 4})
+    .TestX8();
+}
+
+TEST(SLICE_ND_X8, 3d_in_place) {
+  SliceOperatorTester()
+    .input_shape({3, 5, 7})
+    .offsets({1, 2, 0})
+    .sizes({1, 3, 7})
+    .in_place(true)
+    .TestX8();
+}
+
+TEST(SLICE_ND_X8, 4d) {
+  SliceOperatorTester()
+    .input_shape({2, 3, 5, 7})
+    .offsets({1, 0, 1, 2})
+    .sizes({1, 3, 3, 5})
+    .TestX8();
+}
+
+TEST(SLICE_ND_X8, 4d_strided) {
+  SliceOperatorTester()
+    .input_shape({2, 3, 5, 7})
+    .offsets({0, 1, 0, 1})
+    .sizes({2, 1, 3, 3})
+    .strides({1, 2, 2, 2})
+    .TestX8();
+}
+
+TEST(SLICE_ND_X8, 5d) {
+  SliceOperatorTester()
+    .input_shape({2, 3, 2, 5, 7})
+    .offsets({1, 1, 0, 1, 2})
+    .sizes({1, 2, 2, 3, 5})
+    .TestX8();
+}
+
+TEST(SLICE_ND_X8, 6d) {
+  SliceOperatorTester()
+    .input_shape({2, 3, 2, 3, 5, 7})
+    .offsets({0, 1, 0, 1, 1, 2})
+    .sizes({2, 2, 2, 1, 3, 5})
+    .TestX8();
+}
+
+TEST(SLICE_ND_X8, 6d_strided) {
+  SliceOperatorTester()
+    .input_shape({3, 3, 2, 3, 5, 7})
+    .offsets({0, 1, 0, 0, 1, 0})
+    .sizes({2, 2, 2, 2, 2, 3})
+    .strides({2, 1, 1, 2, 2, 3})
+    .TestX8();
+}
+
+TEST(SLICE_ND_X8, full) {
+  SliceOperatorTester()
+    .input_shape({3, 5, 7})
+    .offsets({0, 0, 0})
+    .sizes({3, 5, 7})
+    .TestX8();
+}
+
+TEST(SLICE_ND_X8, full_in_place) {
+  SliceOperatorTester()
+    .input_shape({3, 5, 7})
+    .offsets({0, 0, 0})
+    .sizes({3, 5, 7})
+    .in_place(true)
+    .TestX8();
+}
+
+TEST(SLICE_ND_X32, 1d) {
+  SliceOperatorTester()
+    .input_shape({17})
+    .offsets({3})
+    .sizes({11})
+    .TestX32();
+}
+
+TEST(SLICE_ND_X32, 1d_strided) {
+  SliceOperatorTester()
+    .input_shape({17})
+    .offsets({1})
+    .sizes({6})
+    .strides({3})
+    .TestX32();
+}
+
+TEST(SLICE_ND_X32, 1d_in_place) {
+  SliceOperatorTester()
+    .input_shape({17})
+    .offsets({5})
+    .sizes({9})
+    .in_place(true)
+    .TestX32();
+}
+
+TEST(SLICE_ND_X32, 2d_inner) {
+  SliceOperatorTester()
+    .input_shape({5, 17})
+    .offsets({0, 3})
+    .sizes({5, 11})
+    .TestX32();
+}
+
+TEST(SLICE_ND_X32, 2d_outer) {
+  SliceOperatorTester()
+    .input_shape({5, 17})
+    .offsets({1, 0})
+    .sizes({3, 17})
+    .TestX32();
+}
+
+TEST(SLICE_ND_X32, 2d_outer_in_place) {
+  SliceOperatorTester()
+    .input_shape({5, 17})
+    .offsets({1, 0})
+    .sizes({3, 17})
+    .in_place(true)
+    .TestX32();
+}
+
+TEST(SLICE_ND_X32, 2d_strided_inner) {
+  SliceOperatorTester()
+    .input_shape({5, 17})
+    .offsets({1, 2})
+    .sizes({3, 5})
+    .strides({1, 3})
+    .TestX32();
+}
+
+TEST(SLICE_ND_X32, 2d_strided_outer) {
+  SliceOperatorTester()
+    .input_shape({9, 17})
+    .offsets({1, 0})
+    .sizes({4, 17})
+    .strides({2, 1})
+    .TestX32();
+}
+
+TEST(SLICE_ND_X32, 3d) {
+  SliceOperatorTester()
+    .input_shape({3, 5, 7})
+    .offsets({1, 2, 3})
+    .sizes({2, 2, 4})
+    .TestX32();
+}
+
+TEST(SLICE_ND_X32, 3d_in_place) {
+  SliceOperatorTester()
+    .input_shape({3, 5, 7})
+    .offsets({1, 2, 0})
+    .sizes({1, 3, 7})
+    .in_place(true)
+    .TestX32();
+}
+
+TEST(SLICE_ND_X32, 4d) {
+  SliceOperatorTester()
+    .input_shape({2, 3, 5, 7})
+    .offsets({1, 0, 1, 2})
+    .sizes({1, 3, 3, 5})
+    .TestX32();
+}
+
+TEST(SLICE_ND_X32, 4d_strided) {
+  SliceOperatorTester()
+    .input_shape({2, 3, 5, 7})
+    .offsets({0, 1, 0, 1})
+    .sizes({2, 1, 3, 3})
+    .strides({1, 2, 2, 2})
+    .TestX32();
+}
+
+TEST(SLICE_ND_X32, 5d) {
+  SliceOperatorTester()
+    .input_shape({2, 3, 2, 5, 7})
+    .offsets({1, 1, 0, 1, 2})
+    .sizes({1, 2, 2, 3, 5})
+    .TestX32();
+}
+
+TEST(SLICE_ND_X32, 6d) {
+  SliceOperatorTester()
+    .input_shape({2, 3, 2, 3, 5, 7})
+    .offsets({0, 1, 0, 1, 1, 2})
+    .sizes({2, 2, 2, 1, 3, 5})
+    .TestX32();
+}
+
+TEST(SLICE_ND_X32, 6d_strided) {
+  SliceOperatorTester()
+    .input_shape({3, 3, 2, 3, 5, 7})
+    .offsets({0, 1, 0, 0, 1, 0})
+    .sizes({2, 2, 2, 2, 2, 3})
+    .strides({2, 1, 1, 2, 2, 3})
+    .TestX32();
+}
+
+TEST(SLICE_ND_X32, full) {
+  SliceOperatorTester()
+    .input_shape({3, 5, 7})
+    .offsets({0, 0, 0})
+    .sizes({3, 5, 7})
+    .TestX32();
+}
+
+TEST(SLICE_ND_X32, full_in_place) {
+  SliceOperatorTester()
+    .input_shape({3, 5, 7})
+    .offsets({0, 0, 0})
+    .sizes({3, 5, 7})
+    .in_place(true)
+    .TestX32();
+}
@@ -0,0 +1,180 @@
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <functional>
+#include <initializer_list>
+#include <memory>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include <xnnpack.h>
+
+
+class SliceOperatorTester {
+ public:
+  inline SliceOperatorTester& input_shape(std::initializer_list<size_t> input_shape) {
+    assert(input_shape.size() <= XNN_MAX_TENSOR_DIMS);
+    this->input_shape_ = std::vector<size_t>(input_shape);
+    return *this;
+  }
+
+  inline const std::vector<size_t>& input_shape() const {
+    return this->input_shape_;
+  }
+
+  inline size_t num_dims() const {
+    return this->input_shape_.size();
+  }
+
+  inline SliceOperatorTester& offsets(std::initializer_list<size_t> offsets) {
+    assert(offsets.size() <= XNN_MAX_TENSOR_DIMS);
+    this->offsets_ = std::vector<size_t>(offsets);
+    return *this;
+  }
+
+  inline const std::vector<size_t>& offsets() const {
+    return this->offsets_;
+  }
+
+  inline SliceOperatorTester& sizes(std::initializer_list<size_t> sizes) {
+    assert(sizes.size() <= XNN_MAX_TENSOR_DIMS);
+    this->sizes_ = std::vector<size_t>(sizes);
+    return *this;
+  }
+
+  inline const std::vector<size_t>& sizes() const {
+    return this->sizes_;
+  }
+
+  inline SliceOperatorTester& strides(std::initializer_list<size_t> strides) {
+    assert(strides.size() <= XNN_MAX_TENSOR_DIMS);
+    this->strides_ = std::vector<size_t>(strides);
+    return *this;
+  }
+
+  inline const std::vector<size_t>& strides() const {
+    return this->strides_;
+  }
+
+  inline size_t stride(size_t i) const {
+    return this->strides_.empty() ? 1 : this->strides_[i];
+  }
+
+  inline SliceOperatorTester& in_place(bool in_place) {
+    this->in_place_ = in_place;
+    return *this;
+  }
+
+  inline bool in_place() const {
+    return this->in_place_;
+  }
+
+  inline SliceOperatorTester& iterations(size_t iterations) {
+    this->iterations_ = iterations;
+    return *this;
+  }
+
+  inline size_t iterations() const {
+    return this->iterations_;
+  }
+
+  void TestX8() const {
+    Test<uint8_t>(xnn_create_slice_nd_x8, xnn_setup_slice_nd_x8);
+  }
+
+  void TestX32() const {
+    Test<uint32_t>(xnn_create_slice_nd_x32, xnn_setup_slice_nd_x32);
+  }
+
+ private:
+  template<typename T, typename CreateFn, typename SetupFn>
+  void Test(CreateFn create_fn, SetupFn setup_fn) const {
+    ASSERT_EQ(num_dims(), offsets().size());
+    ASSERT_EQ(num_dims(), sizes().size());
+    ASSERT_TRUE(strides().empty() || strides().size() == num_dims());
+
+    std::random_device random_device;
+    auto rng = std::mt19937(random_device());
+    auto xrng = std::bind(std::uniform_int_distribution<uint32_t>(), rng);
+
+    std::vector<size_t> input_strides(num_dims(), 1);
+    std::vector<size_t> output_strides(num_dims(), 1);
+    for (size_t i = num_dims() - 1; i != 0; i--) {
+      input_strides[i - 1] = input_strides[i] * input_shape()[i];
+      output_strides[i - 1] = output_strides[i] * sizes()[i];
+    }
+    const size_t num_input_elements = std::accumulate(
+      input_shape().cbegin(), input_shape().cend(), size_t(1), std::multiplies<size_t>());
+    const size_t num_output_elements = std::accumulate(
+      sizes().cbegin(), sizes().cend(), size_t(1), std::multiplies<size_t>());
+
+    std::vector<T> input(num_input_elements + XNN_EXTRA_BYTES / sizeof(T));
+    std::vector<T> output(num_output_elements);
+    std::vector<T> output_ref(num_output_elements);
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(input.begin(), input.end(), [&]() { return T(xrng()); });
+      std::fill(output.begin(), output.end(), T(0xA5A5A5A5));
+
+      // Compute reference results.
+      size_t input_offset = 0;
+      for (size_t d = 0; d < num_dims(); d++) {
+        input_offset += offsets()[d] * input_strides[d];
+      }
+      for (size_t o = 0; o < num_output_elements; o++) {
+        size_t input_index = input_offset;
+        for (size_t d = 0; d < num_dims(); d++) {
+          const size_t coordinate = o / output_strides[d] % sizes()[d];
+          input_index += coordinate * stride(d) * input_strides[d];
+        }
+        output_ref[o] = input[input_index];
+      }
+
+      // Create, setup, run, and destroy Slice operator.
+      ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+      xnn_operator_t slice_op = nullptr;
+
+      ASSERT_EQ(xnn_status_success, create_fn(0, &slice_op));
+      ASSERT_NE(nullptr, slice_op);
+
+      // Smart pointer to automatically delete slice_op.
+      std::unique_ptr<xnn_operator, decltype(&xnn_delete_operator)> auto_slice_op(slice_op, xnn_delete_operator);
+
+      // A slice run in place reads and writes the same memory, and is valid only if the output is a view of the input.
+      T* output_data = in_place() ? input.data() + input_offset : output.data();
+      ASSERT_EQ(xnn_status_success,
+        setup_fn(
+          slice_op,
+          num_dims(), input_shape().data(),
+          offsets().data(), sizes().data(), strides().empty() ? nullptr : strides().data(),
+          input.data(), output_data,
+          nullptr /* thread pool */));
+
+      ASSERT_EQ(xnn_status_success,
+        xnn_run_operator(slice_op, nullptr /* thread pool */));
+
+      // Verify results.
+      for (size_t o = 0; o < num_output_elements; o++) {
+        ASSERT_EQ(output_data[o], output_ref[o]) << "at output element " << o << " / " << num_output_elements;
+      }
+    }
+  }
+
+  std::vector<size_t> input_shape_;
+  std::vector<size_t> offsets_;
+  std::vector<size_t> sizes_;
+  std::vector<size_t> strides_;
+  bool in_place_{false};
+  size_t iterations_{3};
+};
@@ -0,0 +1,331 @@
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include <xnnpack.h>
+#include <xnnpack/subgraph.h>
+
+#include <gtest/gtest.h>
+
+namespace {
+
+size_t NumElements(const std::vector<size_t>& dims) {
+  return std::accumulate(dims.cbegin(), dims.cend(), size_t(1), std::multiplies<size_t>());
+}
+
+template<class T>
+std::vector<T> RandomInput(size_t num_elements) {
+  std::random_device random_device;
+  auto rng = std::mt19937(random_device());
+  auto u8rng = std::bind(std::uniform_int_distribution<uint32_t>(0, std::numeric_limits<uint8_t>::max()), rng);
+  std::vector<T> input(num_elements + XNN_EXTRA_BYTES / sizeof(T));
+  std::generate(input.begin(), input.end(), [&]() { return static_cast<T>(u8rng()); });
+  return input;
+}
+
+template<class T>
+std::vector<T> Slice(
+  const std::vector<T>& input, const std::vector<size_t>& dims,
+  const std::vector<size_t>& offsets, const std::vector<size_t>& sizes, const std::vector<size_t>& strides)
+{
+  std::vector<size_t> input_strides(dims.size(), 1);
+  for (size_t i = dims.size() - 1; i != 0; i--) {
+    input_strides[i - 1] = input_strides[i] * dims[i];
+  }
+  std::vector<T> output;
+  std::vector<size_t> coordinates(dims.size(), 0);
+  for (size_t o = 0; o < NumElements(sizes); o++) {
+    size_t index = 0;
+    for (size_t d = 0; d < dims.size(); d++) {
+      index += (offsets[d] + coordinates[d] * strides[d]) * input_strides[d];
+    }
+    output.push_back(input[index]);
+    for (size_t d = dims.size(); d != 0; d--) {
+      if (++coordinates[d - 1] != sizes[d - 1]) {
+        break;
+      }
+      coordinates[d - 1] = 0;
+    }
+  }
+  return output;
+}
+
+// Defines an external input with ID 0 and an external output with ID 1.
+void DefineExternalValues(
+  xnn_subgraph_t subgraph,
+  xnn_datatype datatype,
+  const std::vector<size_t>& input_dims,
+  const std::vector<size_t>& output_dims,
+  uint32_t& input_id,
+  uint32_t& output_id)
+{
+  if (datatype == xnn_datatype_fp32) {
+    ASSERT_EQ(xnn_status_success, xnn_define_tensor_value(
+      subgraph, datatype, input_dims.size(), input_dims.data(), nullptr, 0,
+      XNN_VALUE_FLAG_EXTERNAL_INPUT, &input_id));
+    ASSERT_EQ(xnn_status_success, xnn_define_tensor_value(
+      subgraph, datatype, output_dims.size(), output_dims.data(), nullptr, 1,
+      XNN_VALUE_FLAG_EXTERNAL_OUTPUT, &output_id));
+  } else {
+    ASSERT_EQ(xnn_status_success, xnn_define_quantized_tensor_value(
+      subgraph, datatype, 1, 0.5f, input_dims.size(), input_dims.data(), nullptr, 0,
+      XNN_VALUE_FLAG_EXTERNAL_INPUT, &input_id));
+    ASSERT_EQ(xnn_status_success, xnn_define_quantized_tensor_value(
+      subgraph, datatype, 1, 0.5f, output_dims.size(), output_dims.data(), nullptr, 1,
+      XNN_VALUE_FLAG_EXTERNAL_OUTPUT, &output_id));
+  }
+}
+
+template<class T>
+std::vector<T> Invoke(xnn_runtime_t runtime, const std::vector<T>& input, size_t output_num_elements) {
+  std::vector<T> output(output_num_elements);
+  const std::array<xnn_external_value, 2> external = {{
+    xnn_external_value{0, const_cast<T*>(input.data())},
+    xnn_external_value{1, output.data()},
+  }};
+  EXPECT_EQ(xnn_status_success, xnn_setup_runtime(runtime, external.size(), external.data()));
+  EXPECT_EQ(xnn_status_success, xnn_invoke_runtime(runtime));
+  return output;
+}
+
+}  // namespace
+
+TEST(STATIC_SLICE, strided_f32) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  xnn_subgraph_t subgraph_ptr = nullptr;
+  ASSERT_EQ(xnn_status_success, xnn_create_subgraph(2, 0 /* flags */, &subgraph_ptr));
+  std::unique_ptr<xnn_subgraph, decltype(&xnn_delete_subgraph)> subgraph(subgraph_ptr, xnn_delete_subgraph);
+
+  const std::vector<size_t> input_dims = {2, 9, 7, 19};
+  const std::vector<size_t> offsets = {1, 1, 0, 2};
+  const std::vector<size_t> sizes = {1, 4, 7, 6};
+  const std::vector<size_t> strides = {1, 2, 1, 3};
+  uint32_t input_id = XNN_INVALID_VALUE_ID;
+  uint32_t output_id = XNN_INVALID_VALUE_ID;
+  DefineExternalValues(subgraph.get(), xnn_datatype_fp32, input_dims, sizes, input_id, output_id);
+  ASSERT_EQ(xnn_status_success,
+    xnn_define_static_slice(
+      subgraph.get(), input_dims.size(), offsets.data(), sizes.data(), strides.data(),
+      input_id, output_id, 0 /* flags */));
+
+  xnn_runtime_t runtime_ptr = nullptr;
+  ASSERT_EQ(xnn_status_success, xnn_create_runtime_v2(subgraph.get(), nullptr, 0 /* flags */, &runtime_ptr));
+  std::unique_ptr<xnn_runtime, decltype(&xnn_delete_runtime)> runtime(runtime_ptr, xnn_delete_runtime);
+
+  const std::vector<float> input = RandomInput<float>(NumElements(input_dims));
+  EXPECT_EQ(Slice(input, input_dims, offsets, sizes, strides), Invoke(runtime.get(), input, NumElements(sizes)));
+}
+
+TEST(STATIC_SLICE, unit_strides_qs8) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  xnn_subgraph_t subgraph_ptr = nullptr;
+  ASSERT_EQ(xnn_status_success, xnn_create_subgraph(2, 0 /* flags */, &subgraph_ptr));
+  std::unique_ptr<xnn_subgraph, decltype(&xnn_delete_subgraph)> subgraph(subgraph_ptr, xnn_delete_subgraph);
+
+  const std::vector<size_t> input_dims = {3, 5, 33};
+  const std::vector<size_t> offsets = {1, 2, 5};
+  const std::vector<size_t> sizes = {2, 3, 17};
+  uint32_t input_id = XNN_INVALID_VALUE_ID;
+  uint32_t output_id = XNN_INVALID_VALUE_ID;
+  DefineExternalValues(subgraph.get(), xnn_datatype_qint8, input_dims, sizes, input_id, output_id);
+  ASSERT_EQ(xnn_status_success,
+    xnn_define_static_slice(
+      subgraph.get(), input_dims.size(), offsets.data(), sizes.data(), nullptr /* strides */,
+      input_id, output_id, 0 /* flags */));
+
+  xnn_runtime_t runtime_ptr = nullptr;
+  ASSERT_EQ(xnn_status_success, xnn_create_runtime_v2(subgraph.get(), nullptr, 0 /* flags */, &runtime_ptr));
+  std::unique_ptr<xnn_runtime, decltype(&xnn_delete_runtime)> runtime(runtime_ptr, xnn_delete_runtime);
+
+  const std::vector<int8_t> input = RandomInput<int8_t>(NumElements(input_dims));
+  EXPECT_EQ(
+    Slice(input, input_dims, offsets, sizes, {1, 1, 1}),
+    Invoke(runtime.get(), input, NumElements(sizes)));
+}
+
+TEST(STATIC_SLICE, contiguous_view) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  xnn_subgraph_t subgraph_ptr = nullptr;
+  ASSERT_EQ(xnn_status_success, xnn_create_subgraph(2, 0 /* flags */, &subgraph_ptr));
+  std::unique_ptr<xnn_subgraph, decltype(&xnn_delete_subgraph)> subgraph(subgraph_ptr, xnn_delete_subgraph);
+
+  // Clamp Nodes around the Static Slice Node make its input and output internal Values.
+  const std::vector<size_t> input_dims = {1, 9, 5, 8};
+  const std::vector<size_t> offsets = {0, 3, 0, 0};
+  const std::vector<size_t> sizes = {1, 4, 5, 8};
+  uint32_t input_id = XNN_INVALID_VALUE_ID;
+  uint32_t output_id = XNN_INVALID_VALUE_ID;
+  DefineExternalValues(subgraph.get(), xnn_datatype_fp32, input_dims, sizes, input_id, output_id);
+
+  uint32_t slice_input_id = XNN_INVALID_VALUE_ID;
+  ASSERT_EQ(xnn_status_success, xnn_define_tensor_value(
+    subgraph.get(), xnn_datatype_fp32, input_dims.size(), input_dims.data(), nullptr,
+    XNN_INVALID_VALUE_ID, 0 /* flags */, &slice_input_id));
+  ASSERT_EQ(xnn_status_success,
+    xnn_define_clamp(subgraph.get(), -INFINITY, INFINITY, input_id, slice_input_id, 0 /* flags */));
+  uint32_t slice_output_id = XNN_INVALID_VALUE_ID;
+  ASSERT_EQ(xnn_status_success, xnn_define_tensor_value(
+    subgraph.get(), xnn_datatype_fp32, sizes.size(), sizes.data(), nullptr,
+    XNN_INVALID_VALUE_ID, 0 /* flags */, &slice_output_id));
+  ASSERT_EQ(xnn_status_success,
+    xnn_define_static_slice(
+      subgraph.get(), input_dims.size(), offsets.data(), sizes.data(), nullptr /* strides */,
+      slice_input_id, slice_output_id, 0 /* flags */));
+  ASSERT_EQ(xnn_status_success,
+    xnn_define_clamp(subgraph.get(), -INFINITY, INFINITY, slice_output_id, output_id, 0 /* flags */));
+
+  xnn_runtime_t runtime_ptr = nullptr;
+  ASSERT_EQ(xnn_status_success, xnn_create_runtime_v2(subgraph.get(), nullptr, 0 /* flags */, &runtime_ptr));
+  std::unique_ptr<xnn_runtime, decltype(&xnn_delete_runtime)> runtime(runtime_ptr, xnn_delete_runtime);
+
+  const std::vector<float> input = RandomInput<float>(NumElements(input_dims));
+  EXPECT_EQ(
+    Slice(input, input_dims, offsets, sizes, {1, 1, 1, 1}),
+    Invoke(runtime.get(), input, NumElements(sizes)));
+
+#if XNN_ENABLE_MEMOPT
+  EXPECT_EQ(
+    reinterpret_cast<uintptr_t>(runtime->blobs[slice_input_id].data) + 3 * 5 * 8 * sizeof(float),
+    reinterpret_cast<uintptr_t>(runtime->blobs[slice_output_id].data));
+#endif
+}
+
+TEST(STATIC_SLICE, view_is_not_overwritten_in_place) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  xnn_subgraph_t subgraph_ptr = nullptr;
+  ASSERT_EQ(xnn_status_success, xnn_create_subgraph(2, 0 /* flags */, &subgraph_ptr));
+  std::unique_ptr<xnn_subgraph, decltype(&xnn_delete_subgraph)> subgraph(subgraph_ptr, xnn_delete_subgraph);
+
+  // The slice selects the first half of the input, and the Add Node reads both the slice and the second half of the
+  // input, which the Negate Node must not overwrite when it computes the negated slice.
+  const std::vector<size_t> input_dims = {2, 24};
+  const std::vector<size_t> half_dims = {1, 24};
+  uint32_t input_id = XNN_INVALID_VALUE_ID;
+  uint32_t output_id = XNN_INVALID_VALUE_ID;
+  DefineExternalValues(subgraph.get(), xnn_datatype_fp32, input_dims, half_dims, input_id, output_id);
+
+  uint32_t slice_input_id = XNN_INVALID_VALUE_ID;
+  ASSERT_EQ(xnn_status_success, xnn_define_tensor_value(
+    subgraph.get(), xnn_datatype_fp32, input_dims.size(), input_dims.data(), nullptr,
+    XNN_INVALID_VALUE_ID, 0 /* flags */, &slice_input_id));
+  ASSERT_EQ(xnn_status_success,
+    xnn_define_clamp(subgraph.get(), -INFINITY, INFINITY, input_id, slice_input_id, 0 /* flags */));
+  std::array<uint32_t, 2> half_ids;
+  for (size_t i = 0; i < 2; i++) {
+    const std::vector<size_t> offsets = {i, 0};
+    ASSERT_EQ(xnn_status_success, xnn_define_tensor_value(
+      subgraph.get(), xnn_datatype_fp32, half_dims.size(), half_dims.data(), nullptr,
+      XNN_INVALID_VALUE_ID, 0 /* flags */, &half_ids[i]));
+    ASSERT_EQ(xnn_status_success,
+      xnn_define_static_slice(
+        subgraph.get(), input_dims.size(), offsets.data(), half_dims.data(), nullptr /* strides */,
+        slice_input_id, half_ids[i], 0 /* flags */));
+  }
+  uint32_t negated_id = XNN_INVALID_VALUE_ID;
+  ASSERT_EQ(xnn_status_success, xnn_define_tensor_value(
+    subgraph.get(), xnn_datatype_fp32, half_dims.size(), half_dims.data(), nullptr,
+    XNN_INVALID_VALUE_ID, 0 /* flags */, &negated_id));
+  ASSERT_EQ(xnn_status_success, xnn_define_negate(subgraph.get(), half_ids[0], negated_id, 0 /* flags */));
+  ASSERT_EQ(xnn_status_success,
+    xnn_define_add2(subgraph.get(), -INFINITY, INFINITY, negated_id, half_ids[1], output_id, 0 /* flags */));
+
+  xnn_runtime_t runtime_ptr = nullptr;
+  ASSERT_EQ(xnn_status_success, xnn_create_runtime_v2(subgraph.get(), nullptr, 0 /* flags */, &runtime_ptr));
+  std::unique_ptr<xnn_runtime, decltype(&xnn_delete_runtime)> runtime(runtime_ptr, xnn_delete_runtime);
+
+  const std::vector<float> input = RandomInput<float>(NumElements(input_dims));
+  std::vector<float> expected(24);
+  for (size_t i = 0; i < 24; i++) {
+    expected[i] = input[24 + i] - input[i];
+  }
+  EXPECT_EQ(expected, Invoke(runtime.get(), input, 24));
+}
+
+TEST(STATIC_SLICE, reshape) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  xnn_subgraph_t subgraph_ptr = nullptr;
+  ASSERT_EQ(xnn_status_success, xnn_create_subgraph(2, 0 /* flags */, &subgraph_ptr));
+  std::unique_ptr<xnn_subgraph, decltype(&xnn_delete_subgraph)> subgraph(subgraph_ptr, xnn_delete_subgraph);
+
+  const std::vector<size_t> input_dims = {4, 6, 5};
+  const std::vector<size_t> offsets = {1, 0, 1};
+  const std::vector<size_t> sizes = {2, 3, 2};
+  const std::vector<size_t> strides = {2, 1, 2};
+  uint32_t input_id = XNN_INVALID_VALUE_ID;
+  uint32_t output_id = XNN_INVALID_VALUE_ID;
+  DefineExternalValues(subgraph.get(), xnn_datatype_fp32, input_dims, sizes, input_id, output_id);
+  ASSERT_EQ(xnn_status_success,
+    xnn_define_static_slice(
+      subgraph.get(), input_dims.size(), offsets.data(), sizes.data(), strides.data(),
+      input_id, output_id, 0 /* flags */));
+
+  xnn_runtime_t runtime_ptr = nullptr;
+  ASSERT_EQ(xnn_status_success, xnn_create_runtime_v2(subgraph.get(), nullptr, 0 /* flags */, &runtime_ptr));
+  std::unique_ptr<xnn_runtime, decltype(&xnn_delete_runtime)> runtime(runtime_ptr, xnn_delete_runtime);
+
+  const std::vector<size_t> new_input_dims = {5, 3, 9};
+  ASSERT_EQ(xnn_status_success,
+    xnn_reshape_external_value(runtime.get(), input_id, new_input_dims.size(), new_input_dims.data()));
+  ASSERT_EQ(xnn_status_success, xnn_reshape_runtime(runtime.get()));
+
+  size_t num_dims = 0;
+  std::array<size_t, XNN_MAX_TENSOR_DIMS> output_dims;
+  ASSERT_EQ(xnn_status_success, xnn_get_external_value_shape(runtime.get(), output_id, &num_dims, output_dims.data()));
+  ASSERT_EQ(3, num_dims);
+  for (size_t i = 0; i < 3; i++) {
+    EXPECT_EQ(sizes[i], output_dims[i]);
+  }
+
+  const std::vector<float> input = RandomInput<float>(NumElements(new_input_dims));
+  EXPECT_EQ(Slice(input, new_input_dims, offsets, sizes, strides), Invoke(runtime.get(), input, NumElements(sizes)));
+
+  // The slice doesn't fit into the first dimension of the input anymore.
+  const std::vector<size_t> small_input_dims = {3, 6, 5};
+  ASSERT_EQ(xnn_status_success,
+    xnn_reshape_external_value(runtime.get(), input_id, small_input_dims.size(), small_input_dims.data()));
+  EXPECT_NE(xnn_status_success, xnn_reshape_runtime(runtime.get()));
+}
+
+TEST(STATIC_SLICE, rejects_invalid_slices) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  xnn_subgraph_t subgraph_ptr = nullptr;
+  ASSERT_EQ(xnn_status_success, xnn_create_subgraph(2, 0 /* flags */, &subgraph_ptr));
+  std::unique_ptr<xnn_subgraph, decltype(&xnn_delete_subgraph)> subgraph(subgraph_ptr, xnn_delete_subgraph);
+
+  const std::vector<size_t> input_dims = {4, 7};
+  const std::vector<size_t> output_dims = {2, 3};
+  uint32_t input_id = XNN_INVALID_VALUE_ID;
+  uint32_t output_id = XNN_INVALID_VALUE_ID;
+  DefineExternalValues(subgraph.get(), xnn_datatype_fp32, input_dims, output_dims, input_id, output_id);
+
+  const std::vector<size_t> offsets = {2, 1};
+  const std::vector<size_t> out_of_bounds_strides = {2, 3};
+  EXPECT_EQ(xnn_status_invalid_parameter,
+    xnn_define_static_slice(
+      subgraph.get(), 2, offsets.data(), output_dims.data(), out_of_bounds_strides.data(), input_id, output_id, 0));
+  const std::vector<size_t> zero_strides = {1, 0};
+  EXPECT_EQ(xnn_status_invalid_parameter,
+    xnn_define_static_slice(
+      subgraph.get(), 2, offsets.data(), output_dims.data(), zero_strides.data(), input_id, output_id, 0));
+  const std::vector<size_t> mismatching_sizes = {2, 4};
+  EXPECT_EQ(xnn_status_invalid_parameter,
+    xnn_define_static_slice(
+      subgraph.get(), 2, offsets.data(), mismatching_sizes.data(), nullptr, input_id, output_id, 0));
+  const std::vector<size_t> strides = {1, 2};
+  EXPECT_EQ(xnn_status_success,
+    xnn_define_static_slice(
+      subgraph.get(), 2, offsets.data(), output_dims.data(), strides.data(), input_id, output_id, 0));
+}
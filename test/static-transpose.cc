@@ -0,0 +1,146 @@
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include <xnnpack.h>
+#include <xnnpack/subgraph.h>
+
+#include <gtest/gtest.h>
+
+namespace {
+
+xnn_runtime_t CreateRuntime(const std::array<size_t, 4>& input_dims, const std::array<size_t, 4>& perm) {
+  xnn_subgraph_t subgraph_ptr = nullptr;
+  EXPECT_EQ(xnn_status_success, xnn_create_subgraph(2, 0 /* flags */, &subgraph_ptr));
+  std::unique_ptr<xnn_subgraph, decltype(&xnn_delete_subgraph)> subgraph(subgraph_ptr, xnn_delete_subgraph);
+
+  std::array<size_t, 4> output_dims;
+  for (size_t i = 0; i < perm.size(); i++) {
+    output_dims[i] = input_dims[perm[i]];
+  }
+  uint32_t input_id = XNN_INVALID_VALUE_ID;
+  EXPECT_EQ(xnn_status_success, xnn_define_tensor_value(
+    subgraph.get(), xnn_datatype_fp32, input_dims.size(), input_dims.data(), nullptr, 0,
+    XNN_VALUE_FLAG_EXTERNAL_INPUT, &input_id));
+  uint32_t output_id = XNN_INVALID_VALUE_ID;
+  EXPECT_EQ(xnn_status_success, xnn_define_tensor_value(
+    subgraph.get(), xnn_datatype_fp32, output_dims.size(), output_dims.data(), nullptr, 1,
+    XNN_VALUE_FLAG_EXTERNAL_OUTPUT, &output_id));
+  EXPECT_EQ(xnn_status_success,
+    xnn_define_static_transpose(subgraph.get(), perm.size(), perm.data(), input_id, output_id, 0 /* flags */));
+
+  xnn_runtime_t runtime = nullptr;
+  EXPECT_EQ(xnn_status_success, xnn_create_runtime_v2(subgraph.get(), nullptr, 0 /* flags */, &runtime));
+  return runtime;
+}
+
+std::vector<float> Transpose(
+  const std::vector<float>& input, const std::array<size_t, 4>& dims, const std::array<size_t, 4>& perm)
+{
+  const std::array<size_t, 4> strides = {{dims[1] * dims[2] * dims[3], dims[2] * dims[3], dims[3], 1}};
+  std::vector<float> output;
+  for (size_t i = 0; i < dims[perm[0]]; i++) {
+    for (size_t j = 0; j < dims[perm[1]]; j++) {
+      for (size_t k = 0; k < dims[perm[2]]; k++) {
+        for (size_t l = 0; l < dims[perm[3]]; l++) {
+          output.push_back(input[i * strides[perm[0]] + j * strides[perm[1]] + k * strides[perm[2]] + l * strides[perm[3]]]);
+        }
+      }
+    }
+  }
+  return output;
+}
+
+std::vector<float> Invoke(xnn_runtime_t runtime, const std::vector<float>& input, size_t num_elements) {
+  std::vector<float> output(num_elements);
+  const std::array<xnn_external_value, 2> external = {{
+    xnn_external_value{0, const_cast<float*>(input.data())},
+    xnn_external_value{1, output.data()},
+  }};
+  EXPECT_EQ(xnn_status_success, xnn_setup_runtime(runtime, external.size(), external.data()));
+  EXPECT_EQ(xnn_status_success, xnn_invoke_runtime(runtime));
+  return output;
+}
+
+std::vector<float> RandomInput(size_t num_elements) {
+  std::random_device random_device;
+  auto rng = std::mt19937(random_device());
+  auto f32rng = std::bind(std::uniform_real_distribution<float>(-1.0f, 1.0f), std::ref(rng));
+  std::vector<float> input(num_elements + XNN_EXTRA_BYTES / sizeof(float));
+  std::generate(input.begin(), input.end(), std::ref(f32rng));
+  return input;
+}
+
+}  // namespace
+
+TEST(STATIC_TRANSPOSE, nhwc_to_nchw) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  const std::array<size_t, 4> dims = {{2, 9, 7, 19}};
+  const std::array<size_t, 4> perm = {{0, 3, 1, 2}};
+  std::unique_ptr<xnn_runtime, decltype(&xnn_delete_runtime)> runtime(CreateRuntime(dims, perm), xnn_delete_runtime);
+  ASSERT_NE(nullptr, runtime);
+
+  const std::vector<float> input = RandomInput(2 * 9 * 7 * 19);
+  EXPECT_EQ(Transpose(input, dims, perm), Invoke(runtime.get(), input, 2 * 9 * 7 * 19));
+}
+
+TEST(STATIC_TRANSPOSE, reshape) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  const std::array<size_t, 4> perm = {{2, 0, 3, 1}};
+  std::unique_ptr<xnn_runtime, decltype(&xnn_delete_runtime)> runtime(
+    CreateRuntime({{2, 3, 4, 5}}, perm), xnn_delete_runtime);
+  ASSERT_NE(nullptr, runtime);
+
+  const std::array<size_t, 4> dims = {{3, 6, 5, 4}};
+  ASSERT_EQ(xnn_status_success, xnn_reshape_external_value(runtime.get(), 0, dims.size(), dims.data()));
+  ASSERT_EQ(xnn_status_success, xnn_reshape_runtime(runtime.get()));
+
+  size_t num_dims = 0;
+  std::array<size_t, XNN_MAX_TENSOR_DIMS> output_dims;
+  ASSERT_EQ(xnn_status_success, xnn_get_external_value_shape(runtime.get(), 1, &num_dims, output_dims.data()));
+  ASSERT_EQ(4, num_dims);
+  for (size_t i = 0; i < 4; i++) {
+    EXPECT_EQ(dims[perm[i]], output_dims[i]);
+  }
+
+  const std::vector<float> input = RandomInput(3 * 6 * 5 * 4);
+  EXPECT_EQ(Transpose(input, dims, perm), Invoke(runtime.get(), input, 3 * 6 * 5 * 4));
+}
+
+TEST(STATIC_TRANSPOSE, rejects_mismatching_output_shape) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  xnn_subgraph_t subgraph_ptr = nullptr;
+  ASSERT_EQ(xnn_status_success, xnn_create_subgraph(2, 0 /* flags */, &subgraph_ptr));
+  std::unique_ptr<xnn_subgraph, decltype(&xnn_delete_subgraph)> subgraph(subgraph_ptr, xnn_delete_subgraph);
+
+  const std::array<size_t, 3> input_dims = {{2, 3, 4}};
+  const std::array<size_t, 3> output_dims = {{2, 4, 3}};
+  uint32_t input_id = XNN_INVALID_VALUE_ID;
+  ASSERT_EQ(xnn_status_success, xnn_define_tensor_value(
+    subgraph.get(), xnn_datatype_fp32, input_dims.size(), input_dims.data(), nullptr, 0,
+    XNN_VALUE_FLAG_EXTERNAL_INPUT, &input_id));
+  uint32_t output_id = XNN_INVALID_VALUE_ID;
+  ASSERT_EQ(xnn_status_success, xnn_define_tensor_value(
+    subgraph.get(), xnn_datatype_fp32, output_dims.size(), output_dims.data(), nullptr, 1,
+    XNN_VALUE_FLAG_EXTERNAL_OUTPUT, &output_id));
+
+  const std::array<size_t, 3> wrong_perm = {{1, 0, 2}};
+  EXPECT_EQ(xnn_status_invalid_parameter,
+    xnn_define_static_transpose(subgraph.get(), wrong_perm.size(), wrong_perm.data(), input_id, output_id, 0));
+  const std::array<size_t, 3> repeated_perm = {{0, 2, 2}};
+  EXPECT_EQ(xnn_status_invalid_parameter,
+    xnn_define_static_transpose(subgraph.get(), repeated_perm.size(), repeated_perm.data(), input_id, output_id, 0));
+  const std::array<size_t, 3> perm = {{0, 2, 1}};
+  EXPECT_EQ(xnn_status_success,
+    xnn_define_static_transpose(subgraph.get(), perm.size(), perm.data(), input_id, output_id, 0));
+}
@@ -0,0 +1,320 @@
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <vector>
+
+#include <xnnpack.h>
+#include <xnnpack/subgraph.h>
+
+#include "subgraph-tester.h"
+#include <gtest/gtest.h>
+
+TEST(SUBGRAPH_FUSION, add_and_clamp) {
+  auto tester = SubgraphTester(4);
+  tester
+    .add_tensor({1, 16, 16, 8}, kDynamic, 0)
+    .add_tensor({1, 16, 16, 8}, kDynamic, 1)
+    .add_tensor({1, 16, 16, 8}, kDynamic, 2)
+    .add_tensor({1, 16, 16, 8}, kDynamic, 3)
+    .add_addition(0, 1, 2)
+    .add_clamp(0.0f, 6.0f, 2, 3)
+    .optimize();
+
+  ASSERT_EQ(1, tester.get_num_active_nodes());
+  const xnn_node* add = tester.get_node(0);
+  ASSERT_EQ(xnn_node_type_add2, add->type);
+  ASSERT_EQ(3, add->outputs[0]);
+  ASSERT_EQ(0.0f, add->activation.output_min);
+  ASSERT_EQ(6.0f, add->activation.output_max);
+}
+
+TEST(SUBGRAPH_FUSION, multiply_and_clamp) {
+  auto tester = SubgraphTester(4);
+  tester
+    .add_tensor({1, 16, 16, 8}, kDynamic, 0)
+    .add_tensor({1, 1, 1, 8}, kStaticDense, 1)
+    .add_tensor({1, 16, 16, 8}, kDynamic, 2)
+    .add_tensor({1, 16, 16, 8}, kDynamic, 3)
+    .add_multiplication(0, 1, 2)
+    .add_clamp(-1.0f, 1.0f, 2, 3)
+    .optimize();
+
+  ASSERT_EQ(1, tester.get_num_active_nodes());
+  const xnn_node* multiply = tester.get_node(0);
+  ASSERT_EQ(xnn_node_type_multiply2, multiply->type);
+  ASSERT_EQ(3, multiply->outputs[0]);
+  ASSERT_EQ(-1.0f, multiply->activation.output_min);
+  ASSERT_EQ(1.0f, multiply->activation.output_max);
+}
+
+TEST(SUBGRAPH_FUSION, subtract_and_relu) {
+  auto tester = SubgraphTester(4);
+  tester
+    .add_tensor({1, 16, 16, 8}, kDynamic, 0)
+    .add_tensor({1, 16, 16, 8}, kDynamic, 1)
+    .add_tensor({1, 16, 16, 8}, kDynamic, 2)
+    .add_tensor({1, 16, 16, 8}, kDynamic, 3)
+    .add_subtraction(0, 1, 2)
+    .add_clamp(0.0f, std::numeric_limits<float>::infinity(), 2, 3)
+    .optimize();
+
+  ASSERT_EQ(1, tester.get_num_active_nodes());
+  const xnn_node* subtract = tester.get_node(0);
+  ASSERT_EQ(xnn_node_type_subtract, subtract->type);
+  ASSERT_EQ(3, subtract->outputs[0]);
+  ASSERT_EQ(0.0f, subtract->activation.output_min);
+  ASSERT_EQ(std::numeric_limits<float>::infinity(), subtract->activation.output_max);
+}
+
+TEST(SUBGRAPH_FUSION, divide_and_chained_clamps) {
+  auto tester = SubgraphTester(5);
+  tester
+    .add_tensor({1, 16, 16, 8}, kDynamic, 0)
+    .add_tensor({1, 16, 16, 8}, kDynamic, 1)
+    .add_tensor({1, 16, 16, 8}, kDynamic, 2)
+    .add_tensor({1, 16, 16, 8}, kDynamic, 3)
+    .add_tensor({1, 16, 16, 8}, kDynamic, 4)
+    .add_division(0, 1, 2)
+    .add_clamp(-6.0f, 4.0f, 2, 3)
+    .add_clamp(-2.0f, 8.0f, 3, 4)
+    .optimize();
+
+  ASSERT_EQ(1, tester.get_num_active_nodes());
+  const xnn_node* divide = tester.get_node(0);
+  ASSERT_EQ(xnn_node_type_divide, divide->type);
+  ASSERT_EQ(4, divide->outputs[0]);
+  ASSERT_EQ(-2.0f, divide->activation.output_min);
+  ASSERT_EQ(4.0f, divide->activation.output_max);
+}
+
+TEST(SUBGRAPH_FUSION, global_average_pooling_and_clamp) {
+  auto tester = SubgraphTester(3);
+  tester
+    .add_tensor({1, 16, 16, 8}, kDynamic, 0)
+    .add_tensor({1, 1, 1, 8}, kDynamic, 1)
+    .add_tensor({1, 1, 1, 8}, kDynamic, 2)
+    .add_global_average_pooling(0, 1)
+    .add_clamp(0.0f, 6.0f, 1, 2)
+    .optimize();
+
+  ASSERT_EQ(1, tester.get_num_active_nodes());
+  const xnn_node* global_average_pooling = tester.get_node(0);
+  ASSERT_EQ(xnn_node_type_global_average_pooling_2d, global_average_pooling->type);
+  ASSERT_EQ(2, global_average_pooling->outputs[0]);
+  ASSERT_EQ(0.0f, global_average_pooling->activation.output_min);
+  ASSERT_EQ(6.0f, global_average_pooling->activation.output_max);
+}
+
+TEST(SUBGRAPH_FUSION, no_fusion_with_multiple_consumers) {
+  auto tester = SubgraphTester(5);
+  tester
+    .add_tensor({1, 16, 16, 8}, kDynamic, 0)
+    .add_tensor({1, 16, 16, 8}, kDynamic, 1)
+    .add_tensor({1, 16, 16, 8}, kDynamic, 2)
+    .add_tensor({1, 16, 16, 8}, kDynamic, 3)
+    .add_tensor({1, 16, 16, 8}, kDynamic, 4)
+    .add_addition(0, 1, 2)
+    .add_clamp(0.0f, 6.0f, 2, 3)
+    .add_addition(2, 3, 4)
+    .optimize();
+
+  ASSERT_EQ(3, tester.get_num_active_nodes());
+  const xnn_node* add = tester.get_node(0);
+  ASSERT_EQ(2, add->outputs[0]);
+  ASSERT_EQ(-std::numeric_limits<float>::infinity(), add->activation.output_min);
+  ASSERT_EQ(std::numeric_limits<float>::infinity(), add->activation.output_max);
+}
+
+TEST(SUBGRAPH_FUSION, conv_and_static_multiply_add) {
+  auto tester = SubgraphTester(8);
+  tester
+    .add_tensor({1, 16, 16, 3}, kDynamic, 0)
+    .add_tensor({4, 3, 3, 3}, kStaticDense, 1)
+    .add_tensor({4}, kStaticDense, 2)
+    .add_tensor({1, 16, 16, 4}, kDynamic, 3)
+    .add_tensor({4}, kStaticDense, 4)
+    .add_tensor({1, 16, 16, 4}, kDynamic, 5)
+    .add_tensor({1, 1, 1, 4}, kStaticDense, 6)
+    .add_tensor({1, 16, 16, 4}, kDynamic, 7);
+  const std::vector<float> filter(
+    static_cast<const float*>(tester.get_value(1)->data), static_cast<const float*>(tester.get_value(1)->data) + 108);
+  const std::vector<float> bias(
+    static_cast<const float*>(tester.get_value(2)->data), static_cast<const float*>(tester.get_value(2)->data) + 4);
+  const float* scale = static_cast<const float*>(tester.get_value(4)->data);
+  const float* shift = static_cast<const float*>(tester.get_value(6)->data);
+  tester
+    .add_conv(1, 1, 1, 1, 3, 3, 1, 1, 1, 1, 1, 3, 4, 0, 1, 2, 3)
+    .add_multiplication(3, 4, 5)
+    .add_addition(6, 5, 7)
+    .optimize();
+
+  ASSERT_EQ(1, tester.get_num_active_nodes());
+  const xnn_node* conv = tester.get_node(0);
+  ASSERT_EQ(xnn_node_type_convolution_2d, conv->type);
+  ASSERT_EQ(7, conv->outputs[0]);
+  // Caller-provided static data stays intact.
+  ASSERT_NE(filter.data(), tester.get_value(1)->data);
+  ASSERT_TRUE(tester.get_value(1)->allocated_data);
+  const float* folded_filter = static_cast<const float*>(tester.get_value(1)->data);
+  const float* folded_bias = static_cast<const float*>(tester.get_value(2)->data);
+  for (size_t oc = 0; oc < 4; oc++) {
+    for (size_t i = 0; i < 27; i++) {
+      ASSERT_EQ(filter[oc * 27 + i] * scale[oc], folded_filter[oc * 27 + i]);
+    }
+    ASSERT_EQ(bias[oc] * scale[oc] + shift[oc], folded_bias[oc]);
+  }
+}
+
+TEST(SUBGRAPH_FUSION, depthwise_conv_without_bias_and_static_add) {
+  auto tester = SubgraphTester(5);
+  tester
+    .add_tensor({1, 16, 16, 4}, kDynamic, 0)
+    .add_tensor({1, 3, 3, 4}, kStaticDense, 1)
+    .add_tensor({1, 16, 16, 4}, kDynamic, 2)
+    .add_tensor({4}, kStaticDense, 3)
+    .add_tensor({1, 16, 16, 4}, kDynamic, 4)
+    .add_depthwise_conv(1, 1, 1, 1, 3, 3, 1, 1, 1, 1, 1, 4, 0, 1, XNN_INVALID_VALUE_ID, 2)
+    .add_addition(2, 3, 4)
+    .optimize();
+
+  ASSERT_EQ(1, tester.get_num_active_nodes());
+  const xnn_node* conv = tester.get_node(0);
+  ASSERT_EQ(xnn_node_type_depthwise_convolution_2d, conv->type);
+  ASSERT_EQ(4, conv->outputs[0]);
+  ASSERT_EQ(3, conv->num_inputs);
+  const float* shift = static_cast<const float*>(tester.get_value(3)->data);
+  const float* folded_bias = static_cast<const float*>(tester.get_value(conv->inputs[2])->data);
+  for (size_t c = 0; c < 4; c++) {
+    ASSERT_EQ(shift[c], folded_bias[c]);
+  }
+}
+
+TEST(SUBGRAPH_FUSION, no_folding_after_clamp) {
+  auto tester = SubgraphTester(7);
+  tester
+    .add_tensor({1, 16, 16, 3}, kDynamic, 0)
+    .add_tensor({4, 3, 3, 3}, kStaticDense, 1)
+    .add_tensor({4}, kStaticDense, 2)
+    .add_tensor({1, 16, 16, 4}, kDynamic, 3)
+    .add_tensor({1, 16, 16, 4}, kDynamic, 4)
+    .add_tensor({4}, kStaticDense, 5)
+    .add_tensor({1, 16, 16, 4}, kDynamic, 6)
+    .add_conv(1, 1, 1, 1, 3, 3, 1, 1, 1, 1, 1, 3, 4, 0, 1, 2, 3)
+    .add_clamp(0.0f, 6.0f, 3, 4)
+    .add_multiplication(4, 5, 6)
+    .optimize();
+
+  ASSERT_EQ(2, tester.get_num_active_nodes());
+  ASSERT_FALSE(tester.get_value(1)->allocated_data);
+  ASSERT_EQ(xnn_node_type_multiply2, tester.get_node(2)->type);
+}
+
+TEST(SUBGRAPH_FUSION, fully_connected_and_static_multiply_add_runtime) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  const size_t batch_size = 2;
+  const size_t input_channels = 5;
+  const size_t output_channels = 3;
+  const std::vector<float> input = {0.5f, -1.0f, 2.0f, 0.25f, -0.75f, 1.5f, 0.0f, -2.0f, 1.0f, 0.5f};
+  const std::vector<float> filter = {
+    0.1f, 0.2f, -0.3f, 0.4f, 0.5f,
+    -0.6f, 0.7f, 0.8f, -0.9f, 1.0f,
+    1.1f, -1.2f, 1.3f, 1.4f, -1.5f,
+  };
+  const std::vector<float> bias = {0.25f, -0.5f, 0.75f};
+  const std::vector<float> scale = {2.0f, -0.5f, 1.5f};
+  const std::vector<float> shift = {-1.0f};
+
+  std::vector<float> expected(batch_size * output_channels);
+  for (size_t b = 0; b < batch_size; b++) {
+    for (size_t oc = 0; oc < output_channels; oc++) {
+      float acc = bias[oc];
+      for (size_t ic = 0; ic < input_channels; ic++) {
+        acc += input[b * input_channels + ic] * filter[oc * input_channels + ic];
+      }
+      expected[b * output_channels + oc] = acc * scale[oc] + shift[0];
+    }
+  }
+
+  for (uint32_t flags : {0u, static_cast<uint32_t>(XNN_FLAG_TRANSPOSE_WEIGHTS)}) {
+    std::vector<float> filter_data = filter;
+    std::vector<size_t> filter_dims = {output_channels, input_channels};
+    if (flags & XNN_FLAG_TRANSPOSE_WEIGHTS) {
+      filter_dims = {input_channels, output_channels};
+      for (size_t oc = 0; oc < output_channels; oc++) {
+        for (size_t ic = 0; ic < input_channels; ic++) {
+          filter_data[ic * output_channels + oc] = filter[oc * input_channels + ic];
+        }
+      }
+    }
+
+    xnn_subgraph_t subgraph_ptr = nullptr;
+    ASSERT_EQ(xnn_status_success, xnn_create_subgraph(2, 0 /* flags */, &subgraph_ptr));
+    std::unique_ptr<xnn_subgraph, decltype(&xnn_delete_subgraph)> subgraph(subgraph_ptr, xnn_delete_subgraph);
+    const std::vector<size_t> input_dims = {batch_size, input_channels};
+    const std::vector<size_t> output_dims = {batch_size, output_channels};
+    const std::vector<size_t> channel_dims = {output_channels};
+    const std::vector<size_t> scalar_dims = {1};
+    uint32_t input_id, filter_id, bias_id, fc_id, scale_id, multiply_id, shift_id, output_id;
+    ASSERT_EQ(xnn_status_success, xnn_define_tensor_value(
+      subgraph.get(), xnn_datatype_fp32, input_dims.size(), input_dims.data(), nullptr, 0,
+      XNN_VALUE_FLAG_EXTERNAL_INPUT, &input_id));
+    ASSERT_EQ(xnn_status_success, xnn_define_tensor_value(
+      subgraph.get(), xnn_datatype_fp32, filter_dims.size(), filter_dims.data(), filter_data.data(),
+      XNN_INVALID_VALUE_ID, 0 /* flags */, &filter_id));
+    ASSERT_EQ(xnn_status_success, xnn_define_tensor_value(
+      subgraph.get(), xnn_datatype_fp32, channel_dims.size(), channel_dims.data(), bias.data(),
+      XNN_INVALID_VALUE_ID, 0 /* flags */, &bias_id));
+    ASSERT_EQ(xnn_status_success, xnn_define_tensor_value(
+      subgraph.get(), xnn_datatype_fp32, output_dims.size(), output_dims.data(), nullptr,
+      XNN_INVALID_VALUE_ID, 0 /* flags */, &fc_id));
+    ASSERT_EQ(xnn_status_success, xnn_define_tensor_value(
+      subgraph.get(), xnn_datatype_fp32, channel_dims.size(), channel_dims.data(), scale.data(),
+      XNN_INVALID_VALUE_ID, 0 /* flags */, &scale_id));
+    ASSERT_EQ(xnn_status_success, xnn_define_tensor_value(
+      subgraph.get(), xnn_datatype_fp32, output_dims.size(), output_dims.data(), nullptr,
+      XNN_INVALID_VALUE_ID, 0 /* flags */, &multiply_id));
+    ASSERT_EQ(xnn_status_success, xnn_define_tensor_value(
+      subgraph.get(), xnn_datatype_fp32, scalar_dims.size(), scalar_dims.data(), shift.data(),
+      XNN_INVALID_VALUE_ID, 0 /* flags */, &shift_id));
+    ASSERT_EQ(xnn_status_success, xnn_define_tensor_value(
+      subgraph.get(), xnn_datatype_fp32, output_dims.size(), output_dims.data(), nullptr, 1,
+      XNN_VALUE_FLAG_EXTERNAL_OUTPUT, &output_id));
+    ASSERT_EQ(xnn_status_success, xnn_define_fully_connected(
+      subgraph.get(), -std::numeric_limits<float>::infinity(), std::numeric_limits<float>::infinity(),
+      input_id, filter_id, bias_id, fc_id, flags));
+    ASSERT_EQ(xnn_status_success, xnn_define_multiply2(
+      subgraph.get(), -std::numeric_limits<float>::infinity(), std::numeric_limits<float>::infinity(),
+      fc_id, scale_id, multiply_id, 0 /* flags */));
+    ASSERT_EQ(xnn_status_success, xnn_define_add2(
+      subgraph.get(), -std::numeric_limits<float>::infinity(), std::numeric_limits<float>::infinity(),
+      multiply_id, shift_id, output_id, 0 /* flags */));
+
+    xnn_runtime_t runtime_ptr = nullptr;
+    ASSERT_EQ(xnn_status_success, xnn_create_runtime_v2(subgraph.get(), nullptr, 0 /* flags */, &runtime_ptr));
+    std::unique_ptr<xnn_runtime, decltype(&xnn_delete_runtime)> runtime(runtime_ptr, xnn_delete_runtime);
+    ASSERT_EQ(1, runtime->num_ops - std::count_if(runtime->opdata, runtime->opdata + runtime->num_ops,
+      [](const xnn_operator_data& opdata) { return opdata.operator_objects[0] == nullptr; }));
+    // Static data of the Subgraph is not needed after the Runtime is created.
+    subgraph.reset();
+
+    std::vector<float> input_data = input;
+    input_data.resize(input.size() + XNN_EXTRA_BYTES / sizeof(float));
+    std::vector<float> output(batch_size * output_channels);
+    const std::array<xnn_external_value, 2> external = {{
+      xnn_external_value{input_id, input_data.data()},
+      xnn_external_value{output_id, output.data()},
+    }};
+    ASSERT_EQ(xnn_status_success, xnn_setup_runtime(runtime.get(), external.size(), external.data()));
+    ASSERT_EQ(xnn_status_success, xnn_invoke_runtime(runtime.get()));
+    for (size_t i = 0; i < output.size(); i++) {
+      ASSERT_NEAR(expected[i], output[i], 1.0e-5f * std::abs(expected[i]) + 1.0e-6f);
+    }
+  }
+}
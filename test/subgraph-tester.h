@@ -128,6 +128,48 @@ class SubgraphTester {
     return *this;
   }
 
+  inline SubgraphTester& add_multiplication(uint32_t input_id1, uint32_t input_id2, uint32_t output_id)
+  {
+    const xnn_status status =
+        xnn_define_multiply2(subgraph_.get(), -std::numeric_limits<float>::infinity(),
+                             std::numeric_limits<float>::infinity(), input_id1,
+                             input_id2, output_id, 0 /* flags */);
+    EXPECT_EQ(status, xnn_status_success);
+
+    return *this;
+  }
+
+  inline SubgraphTester& add_subtraction(uint32_t input_id1, uint32_t input_id2, uint32_t output_id)
+  {
+    const xnn_status status =
+        xnn_define_subtract(subgraph_.get(), -std::numeric_limits<float>::infinity(),
+                            std::numeric_limits<float>::infinity(), input_id1,
+                            input_id2, output_id, 0 /* flags */);
+    EXPECT_EQ(status, xnn_status_success);
+
+    return *this;
+  }
+
+  inline SubgraphTester& add_division(uint32_t input_id1, uint32_t input_id2, uint32_t output_id)
+  {
+    const xnn_status status =
+        xnn_define_divide(subgraph_.get(), -std::numeric_limits<float>::infinity(),
+                          std::numeric_limits<float>::infinity(), input_id1,
+                          input_id2, output_id, 0 /* flags */);
+    EXPECT_EQ(status, xnn_status_success);
+
+    return *this;
+  }
+
+  inline SubgraphTester& add_clamp(float output_min, float output_max, uint32_t input_id, uint32_t output_id)
+  {
+    const xnn_status status =
+        xnn_define_clamp(subgraph_.get(), output_min, output_max, input_id, output_id, 0 /* flags */);
+    EXPECT_EQ(status, xnn_status_success);
+
+    return *this;
+  }
+
   inline SubgraphTester& add_global_average_pooling(uint32_t input_id, uint32_t output_id)
   {
     const xnn_status status = xnn_define_global_average_pooling_2d(
@@ -155,6 +197,19 @@ class SubgraphTester {
     return subgraph_->values[value_id].layout;
   }
 
+  inline size_t get_num_active_nodes() const {
+    return std::count_if(subgraph_->nodes, subgraph_->nodes + subgraph_->num_nodes,
+                         [](const xnn_node& node) { return node.type != xnn_node_type_invalid; });
+  }
+
+  inline const xnn_value* get_value(uint32_t value_id) const {
+    return &subgraph_->values[value_id];
+  }
+
+  inline const xnn_node* get_node(uint32_t node_id) const {
+    return &subgraph_->nodes[node_id];
+  }
+
  private:
   std::vector<std::vector<float>> static_data_;
   std::unique_ptr<xnn_subgraph, decltype(&xnn_delete_subgraph)> subgraph_{nullptr, xnn_delete_subgraph};
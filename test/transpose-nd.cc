@@ -0,0 +1,157 @@
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <gtest/gtest.h>
+
+#include "transpose-operator-tester.h"
+
+
+TEST(TRANSPOSE_ND_X8, 0d) {
+  TransposeOperatorTester()
+    .TestX8();
+}
+
+TEST(TRANSPOSE_ND_X8, 1d) {
+  TransposeOperatorTester()
+    .shape({37})
+    .perm({0})
+    .TestX8();
+}
+
+TEST(TRANSPOSE_ND_X8, 2d) {
+  TransposeOperatorTester()
+    .shape({37, 45})
+    .perm({1, 0})
+    .TestX8();
+}
+
+TEST(TRANSPOSE_ND_X8, 3d_all_permutations) {
+  std::array<size_t, 3> perm = {{0, 1, 2}};
+  do {
+    TransposeOperatorTester()
+      .shape({5, 7, 11})
+      .perm({perm[0], perm[1], perm[2]})
+      .TestX8();
+  } while (std::next_permutation(perm.begin(), perm.end()));
+}
+
+TEST(TRANSPOSE_ND_X8, nhwc_to_nchw) {
+  TransposeOperatorTester()
+    .shape({2, 9, 7, 19})
+    .perm({0, 3, 1, 2})
+    .TestX8();
+}
+
+TEST(TRANSPOSE_ND_X8, preserved_inner_dim) {
+  TransposeOperatorTester()
+    .shape({3, 5, 6})
+    .perm({1, 0, 2})
+    .TestX8();
+}
+
+TEST(TRANSPOSE_ND_X8, unit_dims) {
+  TransposeOperatorTester()
+    .shape({1, 7, 1, 13})
+    .perm({3, 2, 0, 1})
+    .TestX8();
+}
+
+TEST(TRANSPOSE_ND_X16, 2d) {
+  TransposeOperatorTester()
+    .shape({37, 45})
+    .perm({1, 0})
+    .TestX16();
+}
+
+TEST(TRANSPOSE_ND_X16, 3d_all_permutations) {
+  std::array<size_t, 3> perm = {{0, 1, 2}};
+  do {
+    TransposeOperatorTester()
+      .shape({5, 7, 11})
+      .perm({perm[0], perm[1], perm[2]})
+      .TestX16();
+  } while (std::next_permutation(perm.begin(), perm.end()));
+}
+
+TEST(TRANSPOSE_ND_X16, nchw_to_nhwc) {
+  TransposeOperatorTester()
+    .shape({2, 19, 9, 7})
+    .perm({0, 2, 3, 1})
+    .TestX16();
+}
+
+TEST(TRANSPOSE_ND_X32, 0d) {
+  TransposeOperatorTester()
+    .TestX32();
+}
+
+TEST(TRANSPOSE_ND_X32, 1d) {
+  TransposeOperatorTester()
+    .shape({37})
+    .perm({0})
+    .TestX32();
+}
+
+TEST(TRANSPOSE_ND_X32, 2d) {
+  TransposeOperatorTester()
+    .shape({37, 45})
+    .perm({1, 0})
+    .TestX32();
+}
+
+TEST(TRANSPOSE_ND_X32, 3d_all_permutations) {
+  std::array<size_t, 3> perm = {{0, 1, 2}};
+  do {
+    TransposeOperatorTester()
+      .shape({5, 7, 11})
+      .perm({perm[0], perm[1], perm[2]})
+      .TestX32();
+  } while (std::next_permutation(perm.begin(), perm.end()));
+}
+
+TEST(TRANSPOSE_ND_X32, 4d_all_permutations) {
+  std::array<size_t, 4> perm = {{0, 1, 2, 3}};
+  do {
+    TransposeOperatorTester()
+      .shape({3, 5, 7, 11})
+      .perm({perm[0], perm[1], perm[2], perm[3]})
+      .TestX32();
+  } while (std::next_permutation(perm.begin(), perm.end()));
+}
+
+TEST(TRANSPOSE_ND_X32, 5d) {
+  TransposeOperatorTester()
+    .shape({2, 3, 5, 7, 11})
+    .perm({4, 1, 3, 0, 2})
+    .TestX32();
+}
+
+TEST(TRANSPOSE_ND_X32, 6d) {
+  TransposeOperatorTester()
+    .shape({2, 3, 2, 5, 3, 7})
+    .perm({5, 3, 1, 4, 0, 2})
+    .TestX32();
+}
+
+TEST(TRANSPOSE_ND_X32, attention_heads) {
+  TransposeOperatorTester()
+    .shape({2, 17, 4, 16})
+    .perm({0, 2, 1, 3})
+    .TestX32();
+}
+
+TEST(TRANSPOSE_ND_X32, identity) {
+  TransposeOperatorTester()
+    .shape({3, 5, 7})
+    .perm({0, 1, 2})
+    .TestX32();
+}
+
+TEST(TRANSPOSE_ND_X32, unit_dims) {
+  TransposeOperatorTester()
+    .shape({1, 7, 1, 13, 1})
+    .perm({4, 3, 2, 0, 1})
+    .TestX32();
+}
@@ -0,0 +1,154 @@
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <limits>
+#include <memory>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include <xnnpack.h>
+
+
+class TransposeOperatorTester {
+ public:
+  inline TransposeOperatorTester& shape(std::initializer_list<size_t> shape) {
+    assert(shape.size() <= XNN_MAX_TENSOR_DIMS);
+    shape_ = std::vector<size_t>(shape);
+    return *this;
+  }
+
+  inline const std::vector<size_t>& shape() const {
+    return shape_;
+  }
+
+  inline size_t num_dims() const {
+    return shape_.size();
+  }
+
+  inline TransposeOperatorTester& perm(std::initializer_list<size_t> perm) {
+    assert(perm.size() <= XNN_MAX_TENSOR_DIMS);
+    perm_ = std::vector<size_t>(perm);
+    return *this;
+  }
+
+  inline const std::vector<size_t>& perm() const {
+    return perm_;
+  }
+
+  inline size_t num_elements() const {
+    return std::accumulate(shape_.cbegin(), shape_.cend(), size_t(1), std::multiplies<size_t>());
+  }
+
+  inline TransposeOperatorTester& iterations(size_t iterations) {
+    this->iterations_ = iterations;
+    return *this;
+  }
+
+  inline size_t iterations() const {
+    return this->iterations_;
+  }
+
+  void TestX8() const {
+    Test<uint8_t>(xnn_create_transpose_nd_x8, xnn_setup_transpose_nd_x8);
+  }
+
+  void TestX16() const {
+    Test<uint16_t>(xnn_create_transpose_nd_x16, xnn_setup_transpose_nd_x16);
+  }
+
+  void TestX32() const {
+    Test<uint32_t>(xnn_create_transpose_nd_x32, xnn_setup_transpose_nd_x32);
+  }
+
+ private:
+  template<class T>
+  void Test(
+    decltype(&xnn_create_transpose_nd_x32) create,
+    decltype(&xnn_setup_transpose_nd_x32) setup) const
+  {
+    ASSERT_EQ(num_dims(), perm().size());
+
+    std::random_device random_device;
+    auto rng = std::mt19937(random_device());
+    auto rng_fn = std::bind(std::uniform_int_distribution<uint32_t>(0, std::numeric_limits<T>::max()), rng);
+
+    // Compute input strides and output shape.
+    std::vector<size_t> input_strides(num_dims());
+    std::vector<size_t> output_shape(num_dims());
+    size_t input_stride = 1;
+    for (size_t i = num_dims(); i != 0; i--) {
+      input_strides[i - 1] = input_stride;
+      input_stride *= shape()[i - 1];
+    }
+    for (size_t i = 0; i < num_dims(); i++) {
+      output_shape[i] = shape()[perm()[i]];
+    }
+
+    std::vector<T> input(XNN_EXTRA_BYTES / sizeof(T) + num_elements());
+    std::vector<T> output(num_elements());
+    std::vector<T> output_ref(num_elements());
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(input.begin(), input.end(), [&]() { return static_cast<T>(rng_fn()); });
+      std::fill(output.begin(), output.end(), static_cast<T>(0xAAAAAAAA));
+
+      // Compute reference results.
+      std::vector<size_t> output_index(num_dims(), 0);
+      for (size_t i = 0; i < num_elements(); i++) {
+        size_t input_offset = 0;
+        for (size_t d = 0; d < num_dims(); d++) {
+          input_offset += output_index[d] * input_strides[perm()[d]];
+        }
+        output_ref[i] = input[input_offset];
+        for (size_t d = num_dims(); d != 0; d--) {
+          if (++output_index[d - 1] != output_shape[d - 1]) {
+            break;
+          }
+          output_index[d - 1] = 0;
+        }
+      }
+
+      // Create, setup, run, and destroy a transpose operator.
+      ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+      xnn_operator_t transpose_op = nullptr;
+
+      ASSERT_EQ(xnn_status_success, create(0, &transpose_op));
+      ASSERT_NE(nullptr, transpose_op);
+
+      // Smart pointer to automatically delete transpose_op.
+      std::unique_ptr<xnn_operator, decltype(&xnn_delete_operator)> auto_transpose_op(transpose_op, xnn_delete_operator);
+
+      ASSERT_EQ(xnn_status_success,
+        setup(
+          transpose_op,
+          input.data(), output.data(),
+          num_dims(), shape().data(), perm().data(),
+          nullptr /* thread pool */));
+
+      ASSERT_EQ(xnn_status_success,
+        xnn_run_operator(transpose_op, nullptr /* thread pool */));
+
+      // Verify results.
+      for (size_t i = 0; i < num_elements(); i++) {
+        ASSERT_EQ(output_ref[i], output[i]) << "at element " << i;
+      }
+    }
+  }
+
+  std::vector<size_t> shape_;
+  std::vector<size_t> perm_;
+  size_t iterations_{3};
+};
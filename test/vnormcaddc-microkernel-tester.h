@@ -0,0 +1,109 @@
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <cstdlib>
+#include <functional>
+#include <random>
+#include <vector>
+
+#include <xnnpack.h>
+#include <xnnpack/AlignedAllocator.h>
+#include <xnnpack/pack.h>
+#include <xnnpack/params-init.h>
+#include <xnnpack/params.h>
+
+
+class VNormCAddCMicrokernelTester {
+ public:
+  inline VNormCAddCMicrokernelTester& channel_tile(size_t channel_tile) {
+    this->channel_tile_ = channel_tile;
+    return *this;
+  }
+
+  inline size_t channel_tile() const {
+    return this->channel_tile_;
+  }
+
+  inline VNormCAddCMicrokernelTester& channels(size_t channels) {
+    assert(channels != 0);
+    this->channels_ = channels;
+    return *this;
+  }
+
+  inline size_t channels() const {
+    return this->channels_;
+  }
+
+  inline size_t packed_channels() const {
+    return channels() % channel_tile() == 0 ? channels() : (channels() / channel_tile() + 1) * channel_tile();
+  }
+
+  inline VNormCAddCMicrokernelTester& iterations(size_t iterations) {
+    this->iterations_ = iterations;
+    return *this;
+  }
+
+  inline size_t iterations() const {
+    return this->iterations_;
+  }
+
+  void Test(xnn_f32_vnormcaddc_ukernel_function vnormcaddc, xnn_init_f32_default_params_fn init_params = nullptr) const {
+    std::random_device random_device;
+    auto rng = std::mt19937(random_device());
+    auto f32rng = std::bind(std::uniform_real_distribution<float>(-1.0f, 1.0f), rng);
+
+    std::vector<float> x(channels() + XNN_EXTRA_BYTES / sizeof(float));
+    std::vector<float> scale(channels());
+    std::vector<float> bias(channels());
+    std::vector<float, AlignedAllocator<float, 64>> packed_w(packed_channels() * 2);
+    std::vector<float> y(channels());
+    std::vector<float> y_ref(channels());
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(scale.begin(), scale.end(), std::ref(f32rng));
+      std::generate(bias.begin(), bias.end(), std::ref(f32rng));
+      std::generate(x.begin(), x.end(), std::ref(f32rng));
+      std::fill(y.begin(), y.end(), std::nanf(""));
+      const float mean = f32rng();
+      const float inv_stddev = 1.0f + std::abs(f32rng());
+
+      std::fill(packed_w.begin(), packed_w.end(), 0.0f);
+      xnn_pack_f32_vmulcaddc_w(channels(), channel_tile(),
+        scale.data(), bias.data(), packed_w.data(), nullptr);
+
+      // Compute reference results.
+      for (size_t c = 0; c < channels(); c++) {
+        y_ref[c] = (x[c] - mean) * inv_stddev * scale[c] + bias[c];
+      }
+
+      // Prepare parameters.
+      xnn_f32_default_params params;
+      if (init_params != nullptr) {
+        init_params(&params);
+      }
+
+      // Call optimized micro-kernel.
+      vnormcaddc(channels() * sizeof(float), x.data(), &mean, &inv_stddev, packed_w.data(), y.data(), &params);
+
+      // Verify results.
+      for (size_t c = 0; c < channels(); c++) {
+        ASSERT_NEAR(y[c], y_ref[c], std::max(std::abs(y_ref[c]) * 1.0e-5f, 1.0e-5f))
+          << "at channel " << c << " / " << channels();
+      }
+    }
+  }
+
+ private:
+  size_t channel_tile_{1};
+  size_t channels_{1};
+  size_t iterations_{15};
+};
@@ -0,0 +1,251 @@
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <xnnpack.h>
+#include <xnnpack/operator.h>
+#include <xnnpack/subgraph.h>
+#include <xnnpack/weights-cache.h>
+
+#include <gtest/gtest.h>
+
+namespace {
+
+// Builds a Subgraph with Convolution (3x3, 8 -> 16 channels) -> Fully Connected (16 -> 4 channels) over FP32 tensors.
+class WeightsCacheTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+
+    std::random_device random_device;
+    auto rng = std::mt19937(random_device());
+    auto f32rng = std::bind(std::uniform_real_distribution<float>(-1.0f, 1.0f), std::ref(rng));
+    std::generate(conv_filter.begin(), conv_filter.end(), std::ref(f32rng));
+    std::generate(conv_bias.begin(), conv_bias.end(), std::ref(f32rng));
+    std::generate(fc_filter.begin(), fc_filter.end(), std::ref(f32rng));
+    std::generate(fc_bias.begin(), fc_bias.end(), std::ref(f32rng));
+    std::generate(input.begin(), input.end(), std::ref(f32rng));
+  }
+
+  xnn_subgraph_t CreateSubgraph() {
+    xnn_subgraph_t subgraph = nullptr;
+    EXPECT_EQ(xnn_status_success, xnn_create_subgraph(2, 0 /* flags */, &subgraph));
+
+    const std::array<size_t, 4> input_dims = {{1, 5, 5, 8}};
+    uint32_t input_id = XNN_INVALID_VALUE_ID;
+    EXPECT_EQ(xnn_status_success, xnn_define_tensor_value(
+      subgraph, xnn_datatype_fp32, input_dims.size(), input_dims.data(), nullptr, 0,
+      XNN_VALUE_FLAG_EXTERNAL_INPUT, &input_id));
+    const std::array<size_t, 4> conv_filter_dims = {{16, 3, 3, 8}};
+    uint32_t conv_filter_id = XNN_INVALID_VALUE_ID;
+    EXPECT_EQ(xnn_status_success, xnn_define_tensor_value(
+      subgraph, xnn_datatype_fp32, conv_filter_dims.size(), conv_filter_dims.data(), conv_filter.data(),
+      XNN_INVALID_VALUE_ID, 0 /* flags */, &conv_filter_id));
+    const std::array<size_t, 1> conv_bias_dims = {{16}};
+    uint32_t conv_bias_id = XNN_INVALID_VALUE_ID;
+    EXPECT_EQ(xnn_status_success, xnn_define_tensor_value(
+      subgraph, xnn_datatype_fp32, conv_bias_dims.size(), conv_bias_dims.data(), conv_bias.data(),
+      XNN_INVALID_VALUE_ID, 0 /* flags */, &conv_bias_id));
+    const std::array<size_t, 4> conv_output_dims = {{1, 3, 3, 16}};
+    uint32_t conv_output_id = XNN_INVALID_VALUE_ID;
+    EXPECT_EQ(xnn_status_success, xnn_define_tensor_value(
+      subgraph, xnn_datatype_fp32, conv_output_dims.size(), conv_output_dims.data(), nullptr,
+      XNN_INVALID_VALUE_ID, 0 /* flags */, &conv_output_id));
+    const std::array<size_t, 2> fc_filter_dims = {{4, 16}};
+    uint32_t fc_filter_id = XNN_INVALID_VALUE_ID;
+    EXPECT_EQ(xnn_status_success, xnn_define_tensor_value(
+      subgraph, xnn_datatype_fp32, fc_filter_dims.size(), fc_filter_dims.data(), fc_filter.data(),
+      XNN_INVALID_VALUE_ID, 0 /* flags */, &fc_filter_id));
+    const std::array<size_t, 1> fc_bias_dims = {{4}};
+    uint32_t fc_bias_id = XNN_INVALID_VALUE_ID;
+    EXPECT_EQ(xnn_status_success, xnn_define_tensor_value(
+      subgraph, xnn_datatype_fp32, fc_bias_dims.size(), fc_bias_dims.data(), fc_bias.data(),
+      XNN_INVALID_VALUE_ID, 0 /* flags */, &fc_bias_id));
+    const std::array<size_t, 4> output_dims = {{1, 3, 3, 4}};
+    uint32_t output_id = XNN_INVALID_VALUE_ID;
+    EXPECT_EQ(xnn_status_success, xnn_define_tensor_value(
+      subgraph, xnn_datatype_fp32, output_dims.size(), output_dims.data(), nullptr, 1,
+      XNN_VALUE_FLAG_EXTERNAL_OUTPUT, &output_id));
+
+    EXPECT_EQ(xnn_status_success, xnn_define_convolution_2d(
+      subgraph, 0, 0, 0, 0, 3, 3, 1, 1, 1, 1, 1, 8, 16,
+      -std::numeric_limits<float>::infinity(), std::numeric_limits<float>::infinity(),
+      input_id, conv_filter_id, conv_bias_id, conv_output_id, 0 /* flags */));
+    EXPECT_EQ(xnn_status_success, xnn_define_fully_connected(
+      subgraph, -std::numeric_limits<float>::infinity(), std::numeric_limits<float>::infinity(),
+      conv_output_id, fc_filter_id, fc_bias_id, output_id, 0 /* flags */));
+    return subgraph;
+  }
+
+  std::vector<float> Invoke(xnn_runtime_t runtime) {
+    std::vector<float> output(3 * 3 * 4);
+    const std::array<xnn_external_value, 2> external = {{
+      xnn_external_value{0, input.data()},
+      xnn_external_value{1, output.data()},
+    }};
+    EXPECT_EQ(xnn_status_success, xnn_setup_runtime(runtime, external.size(), external.data()));
+    EXPECT_EQ(xnn_status_success, xnn_invoke_runtime(runtime));
+    return output;
+  }
+
+  std::vector<float> conv_filter = std::vector<float>(16 * 3 * 3 * 8);
+  std::vector<float> conv_bias = std::vector<float>(16);
+  std::vector<float> fc_filter = std::vector<float>(4 * 16);
+  std::vector<float> fc_bias = std::vector<float>(4);
+  std::vector<float> input = std::vector<float>(5 * 5 * 8 + XNN_EXTRA_BYTES / sizeof(float));
+};
+
+}  // namespace
+
+TEST_F(WeightsCacheTest, shares_packed_weights) {
+  xnn_weights_cache_t weights_cache = nullptr;
+  ASSERT_EQ(xnn_status_success, xnn_create_weights_cache(&weights_cache));
+
+  std::unique_ptr<xnn_subgraph, decltype(&xnn_delete_subgraph)> subgraph1(CreateSubgraph(), xnn_delete_subgraph);
+  std::unique_ptr<xnn_subgraph, decltype(&xnn_delete_subgraph)> subgraph2(CreateSubgraph(), xnn_delete_subgraph);
+  xnn_runtime_t runtime1 = nullptr;
+  ASSERT_EQ(xnn_status_success, xnn_create_runtime_v3(subgraph1.get(), weights_cache, nullptr, 0, &runtime1));
+  xnn_runtime_t runtime2 = nullptr;
+  ASSERT_EQ(xnn_status_success, xnn_create_runtime_v3(subgraph2.get(), weights_cache, nullptr, 0, &runtime2));
+
+  ASSERT_EQ(runtime1->num_ops, runtime2->num_ops);
+  for (size_t i = 0; i < runtime1->num_ops; i++) {
+    const xnn_operator_t op1 = runtime1->opdata[i].operator_objects[0];
+    const xnn_operator_t op2 = runtime2->opdata[i].operator_objects[0];
+    ASSERT_NE(nullptr, op1);
+    ASSERT_NE(nullptr, op2);
+    EXPECT_EQ(op1->packed_weights, op2->packed_weights);
+  }
+
+  EXPECT_EQ(Invoke(runtime1), Invoke(runtime2));
+
+  ASSERT_EQ(xnn_status_success, xnn_delete_runtime(runtime1));
+  ASSERT_EQ(xnn_status_success, xnn_delete_runtime(runtime2));
+  ASSERT_EQ(xnn_status_success, xnn_delete_weights_cache(weights_cache));
+}
+
+TEST_F(WeightsCacheTest, matches_uncached_runtime) {
+  xnn_weights_cache_t weights_cache = nullptr;
+  ASSERT_EQ(xnn_status_success, xnn_create_weights_cache(&weights_cache));
+
+  std::unique_ptr<xnn_subgraph, decltype(&xnn_delete_subgraph)> subgraph(CreateSubgraph(), xnn_delete_subgraph);
+  xnn_runtime_t cached_runtime_ptr = nullptr;
+  ASSERT_EQ(xnn_status_success,
+    xnn_create_runtime_v3(subgraph.get(), weights_cache, nullptr, 0, &cached_runtime_ptr));
+  std::unique_ptr<xnn_runtime, decltype(&xnn_delete_runtime)> cached_runtime(cached_runtime_ptr, xnn_delete_runtime);
+  xnn_runtime_t runtime_ptr = nullptr;
+  ASSERT_EQ(xnn_status_success, xnn_create_runtime_v2(subgraph.get(), nullptr, 0, &runtime_ptr));
+  std::unique_ptr<xnn_runtime, decltype(&xnn_delete_runtime)> runtime(runtime_ptr, xnn_delete_runtime);
+
+  // Runtime keeps the packed weights alive after the weights cache is deleted.
+  ASSERT_EQ(xnn_status_success, xnn_delete_weights_cache(weights_cache));
+
+  EXPECT_EQ(Invoke(runtime.get()), Invoke(cached_runtime.get()));
+}
+
+TEST_F(WeightsCacheTest, loads_saved_file) {
+  const std::string filename = ::testing::TempDir() + "weights-cache-test.bin";
+  std::unique_ptr<xnn_subgraph, decltype(&xnn_delete_subgraph)> subgraph(CreateSubgraph(), xnn_delete_subgraph);
+
+  xnn_weights_cache_t weights_cache = nullptr;
+  ASSERT_EQ(xnn_status_success, xnn_create_weights_cache(&weights_cache));
+  xnn_runtime_t runtime_ptr = nullptr;
+  ASSERT_EQ(xnn_status_success, xnn_create_runtime_v3(subgraph.get(), weights_cache, nullptr, 0, &runtime_ptr));
+  std::unique_ptr<xnn_runtime, decltype(&xnn_delete_runtime)> runtime(runtime_ptr, xnn_delete_runtime);
+  ASSERT_EQ(xnn_status_success, xnn_save_weights_cache(weights_cache, filename.c_str()));
+  ASSERT_EQ(xnn_status_success, xnn_delete_weights_cache(weights_cache));
+
+  xnn_weights_cache_t file_weights_cache = nullptr;
+  ASSERT_EQ(xnn_status_success, xnn_create_weights_cache_from_file(filename.c_str(), &file_weights_cache));
+  xnn_runtime_t file_runtime_ptr = nullptr;
+  ASSERT_EQ(xnn_status_success,
+    xnn_create_runtime_v3(subgraph.get(), file_weights_cache, nullptr, 0, &file_runtime_ptr));
+  std::unique_ptr<xnn_runtime, decltype(&xnn_delete_runtime)> file_runtime(file_runtime_ptr, xnn_delete_runtime);
+  ASSERT_EQ(xnn_status_success, xnn_delete_weights_cache(file_weights_cache));
+
+  // Packed weights are not copied out of the file.
+  ASSERT_EQ(runtime->num_ops, file_runtime->num_ops);
+  for (size_t i = 0; i < runtime->num_ops; i++) {
+    const xnn_operator_t op = file_runtime->opdata[i].operator_objects[0];
+    ASSERT_NE(nullptr, op);
+    EXPECT_NE(runtime->opdata[i].operator_objects[0]->packed_weights, op->packed_weights);
+    EXPECT_EQ(0, reinterpret_cast<uintptr_t>(op->packed_weights) % XNN_WEIGHTS_CACHE_FILE_ALIGNMENT);
+  }
+
+  EXPECT_EQ(Invoke(runtime.get()), Invoke(file_runtime.get()));
+  std::remove(filename.c_str());
+}
+
+TEST_F(WeightsCacheTest, rejects_file_for_other_microkernels) {
+  const std::string filename = ::testing::TempDir() + "weights-cache-test-mismatch.bin";
+  std::unique_ptr<xnn_subgraph, decltype(&xnn_delete_subgraph)> subgraph(CreateSubgraph(), xnn_delete_subgraph);
+
+  xnn_weights_cache_t weights_cache = nullptr;
+  ASSERT_EQ(xnn_status_success, xnn_create_weights_cache(&weights_cache));
+  xnn_runtime_t runtime = nullptr;
+  ASSERT_EQ(xnn_status_success, xnn_create_runtime_v3(subgraph.get(), weights_cache, nullptr, 0, &runtime));
+  ASSERT_EQ(xnn_status_success, xnn_delete_runtime(runtime));
+  ASSERT_EQ(xnn_status_success, xnn_save_weights_cache(weights_cache, filename.c_str()));
+  ASSERT_EQ(xnn_status_success, xnn_delete_weights_cache(weights_cache));
+
+  // Pretend the file was created on a CPU with a different F32 GEMM microkernel.
+  FILE* file = std::fopen(filename.c_str(), "r+b");
+  ASSERT_NE(nullptr, file);
+  xnn_weights_cache_file_header header;
+  ASSERT_EQ(1, std::fread(&header, sizeof(header), 1, file));
+  header.gemm[0].nr += 1;
+  ASSERT_EQ(0, std::fseek(file, 0, SEEK_SET));
+  ASSERT_EQ(1, std::fwrite(&header, sizeof(header), 1, file));
+  ASSERT_EQ(0, std::fclose(file));
+
+  xnn_weights_cache_t file_weights_cache = nullptr;
+  EXPECT_EQ(xnn_status_unsupported_hardware,
+    xnn_create_weights_cache_from_file(filename.c_str(), &file_weights_cache));
+  std::remove(filename.c_str());
+}
+
+TEST_F(WeightsCacheTest, ignores_file_for_other_weights) {
+  const std::string filename = ::testing::TempDir() + "weights-cache-test-other-weights.bin";
+  {
+    std::unique_ptr<xnn_subgraph, decltype(&xnn_delete_subgraph)> subgraph(CreateSubgraph(), xnn_delete_subgraph);
+    xnn_weights_cache_t weights_cache = nullptr;
+    ASSERT_EQ(xnn_status_success, xnn_create_weights_cache(&weights_cache));
+    xnn_runtime_t runtime = nullptr;
+    ASSERT_EQ(xnn_status_success, xnn_create_runtime_v3(subgraph.get(), weights_cache, nullptr, 0, &runtime));
+    ASSERT_EQ(xnn_status_success, xnn_delete_runtime(runtime));
+    ASSERT_EQ(xnn_status_success, xnn_save_weights_cache(weights_cache, filename.c_str()));
+    ASSERT_EQ(xnn_status_success, xnn_delete_weights_cache(weights_cache));
+  }
+
+  // Static weights of the same sizes, but with different contents, must not match packed weights in the file.
+  conv_filter[conv_filter.size() / 2] += 1.0f;
+  fc_bias.back() -= 1.0f;
+  std::unique_ptr<xnn_subgraph, decltype(&xnn_delete_subgraph)> subgraph(CreateSubgraph(), xnn_delete_subgraph);
+
+  xnn_weights_cache_t file_weights_cache = nullptr;
+  ASSERT_EQ(xnn_status_success, xnn_create_weights_cache_from_file(filename.c_str(), &file_weights_cache));
+  xnn_runtime_t file_runtime_ptr = nullptr;
+  ASSERT_EQ(xnn_status_success,
+    xnn_create_runtime_v3(subgraph.get(), file_weights_cache, nullptr, 0, &file_runtime_ptr));
+  std::unique_ptr<xnn_runtime, decltype(&xnn_delete_runtime)> file_runtime(file_runtime_ptr, xnn_delete_runtime);
+  ASSERT_EQ(xnn_status_success, xnn_delete_weights_cache(file_weights_cache));
+  xnn_runtime_t runtime_ptr = nullptr;
+  ASSERT_EQ(xnn_status_success, xnn_create_runtime_v2(subgraph.get(), nullptr, 0, &runtime_ptr));
+  std::unique_ptr<xnn_runtime, decltype(&xnn_delete_runtime)> runtime(runtime_ptr, xnn_delete_runtime);
+
+  EXPECT_EQ(Invoke(runtime.get()), Invoke(file_runtime.get()));
+  std::remove(filename.c_str());
+}
@@ -0,0 +1,126 @@
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include <xnnpack.h>
+#include <xnnpack/subgraph.h>
+
+#include <gtest/gtest.h>
+
+namespace {
+
+// Creates a Runtime with HardSwish -> Negate over [1, size, size, 8] FP32 tensors. The HardSwish output is an internal
+// Value allocated in the workspace.
+xnn_runtime_t CreateRuntime(size_t size, xnn_workspace_t workspace) {
+  xnn_subgraph_t subgraph_ptr = nullptr;
+  EXPECT_EQ(xnn_status_success, xnn_create_subgraph(2, 0 /* flags */, &subgraph_ptr));
+  std::unique_ptr<xnn_subgraph, decltype(&xnn_delete_subgraph)> subgraph(subgraph_ptr, xnn_delete_subgraph);
+
+  const std::array<size_t, 4> dims = {{1, size, size, 8}};
+  uint32_t input_id = XNN_INVALID_VALUE_ID;
+  EXPECT_EQ(xnn_status_success, xnn_define_tensor_value(
+    subgraph.get(), xnn_datatype_fp32, dims.size(), dims.data(), nullptr, 0,
+    XNN_VALUE_FLAG_EXTERNAL_INPUT, &input_id));
+  uint32_t hardswish_id = XNN_INVALID_VALUE_ID;
+  EXPECT_EQ(xnn_status_success, xnn_define_tensor_value(
+    subgraph.get(), xnn_datatype_fp32, dims.size(), dims.data(), nullptr, XNN_INVALID_VALUE_ID, 0 /* flags */,
+    &hardswish_id));
+  uint32_t output_id = XNN_INVALID_VALUE_ID;
+  EXPECT_EQ(xnn_status_success, xnn_define_tensor_value(
+    subgraph.get(), xnn_datatype_fp32, dims.size(), dims.data(), nullptr, 1,
+    XNN_VALUE_FLAG_EXTERNAL_OUTPUT, &output_id));
+
+  EXPECT_EQ(xnn_status_success, xnn_define_hardswish(subgraph.get(), input_id, hardswish_id, 0 /* flags */));
+  EXPECT_EQ(xnn_status_success, xnn_define_negate(subgraph.get(), hardswish_id, output_id, 0 /* flags */));
+
+  xnn_runtime_t runtime = nullptr;
+  EXPECT_EQ(xnn_status_success,
+    xnn_create_runtime_v4(subgraph.get(), nullptr, workspace, nullptr, 0 /* flags */, &runtime));
+  return runtime;
+}
+
+std::vector<float> RandomInput(size_t size) {
+  std::random_device random_device;
+  auto rng = std::mt19937(random_device());
+  auto f32rng = std::bind(std::uniform_real_distribution<float>(-5.0f, 5.0f), std::ref(rng));
+  std::vector<float> input(size * size * 8 + XNN_EXTRA_BYTES / sizeof(float));
+  std::generate(input.begin(), input.end(), std::ref(f32rng));
+  return input;
+}
+
+xnn_status SetupRuntime(xnn_runtime_t runtime, std::vector<float>& input, std::vector<float>& output) {
+  const std::array<xnn_external_value, 2> external = {{
+    xnn_external_value{0, input.data()},
+    xnn_external_value{1, output.data()},
+  }};
+  return xnn_setup_runtime(runtime, external.size(), external.data());
+}
+
+}  // namespace
+
+TEST(WORKSPACE, grows_to_largest_runtime) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  xnn_workspace_t workspace = nullptr;
+  ASSERT_EQ(xnn_status_success, xnn_create_workspace(&workspace));
+
+  std::unique_ptr<xnn_runtime, decltype(&xnn_delete_runtime)> small_runtime(
+    CreateRuntime(4, workspace), xnn_delete_runtime);
+  ASSERT_NE(nullptr, small_runtime);
+  std::vector<float> small_input = RandomInput(4);
+  std::vector<float> small_output(4 * 4 * 8);
+  ASSERT_EQ(xnn_status_success, SetupRuntime(small_runtime.get(), small_input, small_output));
+
+  std::unique_ptr<xnn_runtime, decltype(&xnn_delete_runtime)> large_runtime(
+    CreateRuntime(16, workspace), xnn_delete_runtime);
+  ASSERT_NE(nullptr, large_runtime);
+  EXPECT_EQ(workspace, small_runtime->workspace);
+  EXPECT_EQ(workspace, large_runtime->workspace);
+  EXPECT_GE(workspace->size, 16 * 16 * 8 * sizeof(float));
+
+  // The large runtime re-allocated the workspace, and the small runtime must be set up again.
+  EXPECT_EQ(xnn_status_invalid_state, xnn_invoke_runtime(small_runtime.get()));
+  ASSERT_EQ(xnn_status_success, SetupRuntime(small_runtime.get(), small_input, small_output));
+  ASSERT_EQ(xnn_status_success, xnn_invoke_runtime(small_runtime.get()));
+
+  std::unique_ptr<xnn_runtime, decltype(&xnn_delete_runtime)> private_runtime(
+    CreateRuntime(4, nullptr), xnn_delete_runtime);
+  ASSERT_NE(nullptr, private_runtime);
+  EXPECT_NE(workspace, private_runtime->workspace);
+  std::vector<float> private_output(4 * 4 * 8);
+  ASSERT_EQ(xnn_status_success, SetupRuntime(private_runtime.get(), small_input, private_output));
+  ASSERT_EQ(xnn_status_success, xnn_invoke_runtime(private_runtime.get()));
+  EXPECT_EQ(private_output, small_output);
+
+  ASSERT_EQ(xnn_status_success, xnn_release_workspace(workspace));
+}
+
+TEST(WORKSPACE, outlives_released_handle) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  xnn_workspace_t workspace = nullptr;
+  ASSERT_EQ(xnn_status_success, xnn_create_workspace(&workspace));
+
+  xnn_runtime_t runtime1 = CreateRuntime(8, workspace);
+  ASSERT_NE(nullptr, runtime1);
+  xnn_runtime_t runtime2 = CreateRuntime(8, workspace);
+  ASSERT_NE(nullptr, runtime2);
+
+  // Runtime objects keep the workspace alive after the creator releases it.
+  ASSERT_EQ(xnn_status_success, xnn_release_workspace(workspace));
+  ASSERT_EQ(xnn_status_success, xnn_delete_runtime(runtime1));
+
+  std::vector<float> input = RandomInput(8);
+  std::vector<float> output(8 * 8 * 8);
+  ASSERT_EQ(xnn_status_success, SetupRuntime(runtime2, input, output));
+  ASSERT_EQ(xnn_status_success, xnn_invoke_runtime(runtime2));
+  ASSERT_EQ(xnn_status_success, xnn_delete_runtime(runtime2));
+}
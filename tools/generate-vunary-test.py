@@ -27,13 +27,14 @@ parser.set_defaults(defines=list())
 
 
 def split_ukernel_name(name):
-  match = re.match(r"^xnn_(s8|u8|f16|f32)_v(abs|clamp|elu|hswish|lrelu|neg|relu|rndd|rndne|rndu|rndz|sigmoid|sqr|sqrt)_(fact_)?ukernel__(.+)_x(\d+)$", name)
+  match = re.match(r"^xnn_(s8|u8|f16|f32)_v(abs|clamp|elu|gelu|hswish|lrelu|neg|relu|rndd|rndne|rndu|rndz|sigmoid|sqr|sqrt|tanh)_(fact_)?ukernel__(.+)_x(\d+)$", name)
   if match is None:
     raise ValueError("Unexpected microkernel name: " + name)
   op_type = {
     "abs": "Abs",
     "clamp": "Clamp",
     "elu": "ELU",
+    "gelu": "GELU",
     "hswish": "HardSwish",
     "lrelu": "LeakyReLU",
     "neg": "Negate",
@@ -45,6 +46,7 @@ def split_ukernel_name(name):
     "sigmoid": "Sigmoid",
     "sqr": "Square",
     "sqrt": "SquareRoot",
+    "tanh": "Tanh",
   }[match.group(2)]
   batch_tile = int(match.group(5))
 
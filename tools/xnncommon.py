@@ -48,6 +48,7 @@ _ISA_TO_ARCH_MAP = {
   "avx2": ["x86-32", "x86-64"],
   "avx512f": ["x86-32", "x86-64"],
   "avx512skx": ["x86-32", "x86-64"],
+  "avx512vnni": ["x86-32", "x86-64"],
   "wasm32": ["wasm", "wasmsimd"],
   "wasm": ["wasm", "wasmsimd", "wasmrelaxedsimd"],
   "wasmsimd": ["wasmsimd", "wasmrelaxedsimd"],
@@ -72,6 +73,7 @@ _ISA_TO_CHECK_MAP = {
   "fma3": "TEST_REQUIRES_X86_FMA3",
   "avx512f": "TEST_REQUIRES_X86_AVX512F",
   "avx512skx": "TEST_REQUIRES_X86_AVX512SKX",
+  "avx512vnni": "TEST_REQUIRES_X86_AVX512VNNI",
 }
 
 